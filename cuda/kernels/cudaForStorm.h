@@ -8,6 +8,9 @@
 // TopologicalValueIteration
 #include "basicValueIteration.h"
 
+// Device-resident value iteration
+#include "deviceValueIteration.h"
+
 // Utility Functions
 #include "utility.h"
 
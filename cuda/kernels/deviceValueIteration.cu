@@ -0,0 +1,393 @@
+#include "deviceValueIteration.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <cuda_runtime.h>
+
+namespace {
+	// The number of threads per block of the iteration kernels. Each thread updates one row group.
+	unsigned int const ThreadsPerBlock = 256;
+
+	// The size of each of the two page-locked staging buffers through which all transfers are performed.
+	size_t const StagingBufferSize = size_t(1) << 22;
+
+	thread_local char const* lastError = "no error";
+}
+
+#define DEVICE_VI_CHECK(call)                            \
+	do {                                                 \
+		cudaError_t const deviceViError = (call);        \
+		if (deviceViError != cudaSuccess) {              \
+			lastError = cudaGetErrorString(deviceViError); \
+			return false;                                \
+		}                                                \
+	} while (false)
+
+struct DeviceValueIterationSystem {
+	uint64_t rowCount = 0;
+	uint64_t rowGroupCount = 0;
+	uint64_t entryCount = 0;
+
+	// The matrix in compressed row storage.
+	uint64_t* rowIndications = nullptr;
+	uint32_t* columns = nullptr;
+	double* values = nullptr;
+	uint64_t* rowGroupIndices = nullptr;
+	double* offsets = nullptr;
+
+	// Two buffers per value vector between which the iterations alternate. The upper values are only used for interval iteration.
+	double* lower[2] = {nullptr, nullptr};
+	double* upper[2] = {nullptr, nullptr};
+	// The index of the buffers that hold the current values.
+	int current = 0;
+
+	// One convergence flag per buffer of the values, in device memory and in page-locked host memory.
+	int* deviceFlags = nullptr;
+	int* hostFlags = nullptr;
+	cudaEvent_t flagCopied[2] = {nullptr, nullptr};
+
+	cudaStream_t computeStream = nullptr;
+	cudaStream_t transferStreams[2] = {nullptr, nullptr};
+	char* staging[2] = {nullptr, nullptr};
+};
+
+namespace {
+	template<bool Minimize>
+	__device__ __forceinline__ double better(double a, double b) {
+		return Minimize ? fmin(a, b) : fmax(a, b);
+	}
+
+	__device__ __forceinline__ double multiplyRow(uint64_t row, uint64_t const* __restrict__ rowIndications, uint32_t const* __restrict__ columns,
+		double const* __restrict__ values, double const* __restrict__ offsets, double const* __restrict__ x) {
+		double result = offsets[row];
+		for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+			result += values[entry] * x[columns[entry]];
+		}
+		return result;
+	}
+
+	template<bool Minimize, bool Relative>
+	__global__ void valueIterationStep(uint64_t firstGroup, uint64_t lastGroup, uint64_t const* __restrict__ rowIndications,
+		uint32_t const* __restrict__ columns, double const* __restrict__ values, uint64_t const* __restrict__ rowGroupIndices,
+		double const* __restrict__ offsets, double const* __restrict__ xIn, double* __restrict__ xOut, double precision, int* notConverged) {
+		uint64_t const group = firstGroup + static_cast<uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+		if (group >= lastGroup) {
+			return;
+		}
+		uint64_t row = rowGroupIndices[group];
+		uint64_t const rowEnd = rowGroupIndices[group + 1];
+		double const oldValue = xIn[group];
+		if (row == rowEnd) {
+			xOut[group] = oldValue;
+			return;
+		}
+		double best = multiplyRow(row, rowIndications, columns, values, offsets, xIn);
+		for (++row; row < rowEnd; ++row) {
+			best = better<Minimize>(best, multiplyRow(row, rowIndications, columns, values, offsets, xIn));
+		}
+		xOut[group] = best;
+
+		double const difference = fabs(best - oldValue);
+		if (Relative ? (best == 0.0 ? difference != 0.0 : difference > precision * fabs(best)) : difference > precision) {
+			*notConverged = 1;
+		}
+	}
+
+	template<bool Minimize, bool Relative>
+	__global__ void intervalIterationStep(uint64_t firstGroup, uint64_t lastGroup, uint64_t const* __restrict__ rowIndications,
+		uint32_t const* __restrict__ columns, double const* __restrict__ values, uint64_t const* __restrict__ rowGroupIndices,
+		double const* __restrict__ offsets, double const* __restrict__ lowerIn, double const* __restrict__ upperIn, double* __restrict__ lowerOut,
+		double* __restrict__ upperOut, double precision, int* notConverged) {
+		uint64_t const group = firstGroup + static_cast<uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+		if (group >= lastGroup) {
+			return;
+		}
+		uint64_t row = rowGroupIndices[group];
+		uint64_t const rowEnd = rowGroupIndices[group + 1];
+		double lower = lowerIn[group];
+		double upper = upperIn[group];
+		if (row != rowEnd) {
+			// Both bounds are updated in the same pass over the entries of the matrix.
+			double bestLower = 0.0;
+			double bestUpper = 0.0;
+			for (bool first = true; row < rowEnd; ++row, first = false) {
+				double rowLower = offsets[row];
+				double rowUpper = offsets[row];
+				for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+					double const value = values[entry];
+					uint32_t const column = columns[entry];
+					rowLower += value * lowerIn[column];
+					rowUpper += value * upperIn[column];
+				}
+				bestLower = first ? rowLower : better<Minimize>(bestLower, rowLower);
+				bestUpper = first ? rowUpper : better<Minimize>(bestUpper, rowUpper);
+			}
+			// Keep the bounds monotone.
+			lower = fmax(lower, bestLower);
+			upper = fmin(upper, bestUpper);
+		}
+		lowerOut[group] = lower;
+		upperOut[group] = upper;
+
+		bool groupConverged;
+		if (Relative) {
+			if (lower > 0.0) {
+				groupConverged = upper - lower <= lower * precision;
+			} else if (upper < 0.0) {
+				groupConverged = upper - lower <= -upper * precision;
+			} else {
+				groupConverged = lower == upper;
+			}
+		} else {
+			groupConverged = upper - lower <= precision;
+		}
+		if (!groupConverged) {
+			*notConverged = 1;
+		}
+	}
+
+	template<bool Minimize, bool Relative>
+	void launchStep(DeviceValueIterationSystem* system, bool interval, uint64_t firstGroup, uint64_t lastGroup, double precision, int flag) {
+		unsigned int const gridSize = static_cast<unsigned int>((lastGroup - firstGroup + ThreadsPerBlock - 1) / ThreadsPerBlock);
+		int const in = system->current;
+		int const out = 1 - in;
+		if (interval) {
+			intervalIterationStep<Minimize, Relative><<<gridSize, ThreadsPerBlock, 0, system->computeStream>>>(firstGroup, lastGroup,
+				system->rowIndications, system->columns, system->values, system->rowGroupIndices, system->offsets, system->lower[in], system->upper[in],
+				system->lower[out], system->upper[out], precision, system->deviceFlags + flag);
+		} else {
+			valueIterationStep<Minimize, Relative><<<gridSize, ThreadsPerBlock, 0, system->computeStream>>>(firstGroup, lastGroup,
+				system->rowIndications, system->columns, system->values, system->rowGroupIndices, system->offsets, system->lower[in], system->lower[out],
+				precision, system->deviceFlags + flag);
+		}
+	}
+
+	/*
+	 * Copies the given host memory to the device. The host memory is staged chunk-wise in the page-locked buffers, alternating between the two
+	 * buffers and their streams, such that staging a chunk overlaps the transfer of the previous one. The transfers are not awaited.
+	 */
+	bool upload(DeviceValueIterationSystem* system, void* destination, void const* source, size_t bytes) {
+		char* target = static_cast<char*>(destination);
+		char const* origin = static_cast<char const*>(source);
+		size_t chunk = 0;
+		for (size_t offset = 0; offset < bytes; offset += StagingBufferSize, ++chunk) {
+			int const buffer = chunk % 2;
+			size_t const length = std::min(StagingBufferSize, bytes - offset);
+			// The previous transfer from this buffer has to be finished before the buffer can be overwritten.
+			DEVICE_VI_CHECK(cudaStreamSynchronize(system->transferStreams[buffer]));
+			std::memcpy(system->staging[buffer], origin + offset, length);
+			DEVICE_VI_CHECK(cudaMemcpyAsync(target + offset, system->staging[buffer], length, cudaMemcpyHostToDevice, system->transferStreams[buffer]));
+		}
+		return true;
+	}
+
+	/*
+	 * Copies the given device memory to the host after all pending computations are finished. As for uploads, the transfer of a chunk
+	 * overlaps copying the previous chunk out of its staging buffer.
+	 */
+	bool download(DeviceValueIterationSystem* system, void* destination, void const* source, size_t bytes) {
+		DEVICE_VI_CHECK(cudaStreamSynchronize(system->computeStream));
+		char* target = static_cast<char*>(destination);
+		char const* origin = static_cast<char const*>(source);
+		size_t const numberOfChunks = (bytes + StagingBufferSize - 1) / StagingBufferSize;
+		for (size_t chunk = 0; chunk <= numberOfChunks; ++chunk) {
+			if (chunk < numberOfChunks) {
+				int const buffer = chunk % 2;
+				size_t const offset = chunk * StagingBufferSize;
+				size_t const length = std::min(StagingBufferSize, bytes - offset);
+				DEVICE_VI_CHECK(cudaMemcpyAsync(system->staging[buffer], origin + offset, length, cudaMemcpyDeviceToHost, system->transferStreams[buffer]));
+			}
+			if (chunk > 0) {
+				int const buffer = (chunk - 1) % 2;
+				size_t const offset = (chunk - 1) * StagingBufferSize;
+				size_t const length = std::min(StagingBufferSize, bytes - offset);
+				DEVICE_VI_CHECK(cudaStreamSynchronize(system->transferStreams[buffer]));
+				std::memcpy(target + offset, system->staging[buffer], length);
+			}
+		}
+		return true;
+	}
+
+	bool synchronizeTransfers(DeviceValueIterationSystem* system) {
+		DEVICE_VI_CHECK(cudaStreamSynchronize(system->transferStreams[0]));
+		DEVICE_VI_CHECK(cudaStreamSynchronize(system->transferStreams[1]));
+		return true;
+	}
+
+	/*
+	 * Copies the given range of row groups from the current buffers to the other ones.
+	 */
+	bool copyToOtherBuffers(DeviceValueIterationSystem* system, uint64_t firstGroup, uint64_t lastGroup, bool interval) {
+		int const in = system->current;
+		int const out = 1 - in;
+		size_t const bytes = (lastGroup - firstGroup) * sizeof(double);
+		DEVICE_VI_CHECK(cudaMemcpyAsync(system->lower[out] + firstGroup, system->lower[in] + firstGroup, bytes, cudaMemcpyDeviceToDevice, system->computeStream));
+		if (interval) {
+			DEVICE_VI_CHECK(cudaMemcpyAsync(system->upper[out] + firstGroup, system->upper[in] + firstGroup, bytes, cudaMemcpyDeviceToDevice, system->computeStream));
+		}
+		return true;
+	}
+
+	bool initializeSystem(DeviceValueIterationSystem* system, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+		uint64_t const* rowGroupIndices) {
+		DEVICE_VI_CHECK(cudaStreamCreateWithFlags(&system->computeStream, cudaStreamNonBlocking));
+		for (int buffer = 0; buffer < 2; ++buffer) {
+			DEVICE_VI_CHECK(cudaStreamCreateWithFlags(&system->transferStreams[buffer], cudaStreamNonBlocking));
+			DEVICE_VI_CHECK(cudaEventCreateWithFlags(&system->flagCopied[buffer], cudaEventDisableTiming));
+			DEVICE_VI_CHECK(cudaMallocHost(reinterpret_cast<void**>(&system->staging[buffer]), StagingBufferSize));
+		}
+		DEVICE_VI_CHECK(cudaMallocHost(reinterpret_cast<void**>(&system->hostFlags), 2 * sizeof(int)));
+		DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->deviceFlags), 2 * sizeof(int)));
+
+		DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->rowIndications), (system->rowCount + 1) * sizeof(uint64_t)));
+		DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->columns), system->entryCount * sizeof(uint32_t)));
+		DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->values), system->entryCount * sizeof(double)));
+		DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->rowGroupIndices), (system->rowGroupCount + 1) * sizeof(uint64_t)));
+		DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->offsets), system->rowCount * sizeof(double)));
+		for (int buffer = 0; buffer < 2; ++buffer) {
+			DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->lower[buffer]), system->rowGroupCount * sizeof(double)));
+			DEVICE_VI_CHECK(cudaMalloc(reinterpret_cast<void**>(&system->upper[buffer]), system->rowGroupCount * sizeof(double)));
+		}
+
+		if (!upload(system, system->rowIndications, rowIndications, (system->rowCount + 1) * sizeof(uint64_t)) ||
+			!upload(system, system->columns, columns, system->entryCount * sizeof(uint32_t)) ||
+			!upload(system, system->values, values, system->entryCount * sizeof(double)) ||
+			!upload(system, system->rowGroupIndices, rowGroupIndices, (system->rowGroupCount + 1) * sizeof(uint64_t))) {
+			return false;
+		}
+		return synchronizeTransfers(system);
+	}
+}
+
+DeviceValueIterationSystem* deviceValueIteration_createSystem(uint64_t rowCount, uint64_t rowGroupCount, uint64_t entryCount, uint64_t const* rowIndications,
+	uint32_t const* columns, double const* values, uint64_t const* rowGroupIndices) {
+	DeviceValueIterationSystem* system = new DeviceValueIterationSystem();
+	system->rowCount = rowCount;
+	system->rowGroupCount = rowGroupCount;
+	system->entryCount = entryCount;
+	if (!initializeSystem(system, rowIndications, columns, values, rowGroupIndices)) {
+		deviceValueIteration_destroySystem(system);
+		return nullptr;
+	}
+	return system;
+}
+
+void deviceValueIteration_destroySystem(DeviceValueIterationSystem* system) {
+	if (system == nullptr) {
+		return;
+	}
+	if (system->computeStream != nullptr) {
+		cudaStreamSynchronize(system->computeStream);
+		cudaStreamDestroy(system->computeStream);
+	}
+	for (int buffer = 0; buffer < 2; ++buffer) {
+		if (system->transferStreams[buffer] != nullptr) {
+			cudaStreamSynchronize(system->transferStreams[buffer]);
+			cudaStreamDestroy(system->transferStreams[buffer]);
+		}
+		if (system->flagCopied[buffer] != nullptr) {
+			cudaEventDestroy(system->flagCopied[buffer]);
+		}
+		cudaFreeHost(system->staging[buffer]);
+		cudaFree(system->lower[buffer]);
+		cudaFree(system->upper[buffer]);
+	}
+	cudaFreeHost(system->hostFlags);
+	cudaFree(system->deviceFlags);
+	cudaFree(system->rowIndications);
+	cudaFree(system->columns);
+	cudaFree(system->values);
+	cudaFree(system->rowGroupIndices);
+	cudaFree(system->offsets);
+	delete system;
+}
+
+size_t deviceValueIteration_getRequiredMemory(uint64_t rowCount, uint64_t rowGroupCount, uint64_t entryCount) {
+	return (rowCount + 1) * sizeof(uint64_t) + entryCount * (sizeof(uint32_t) + sizeof(double)) + (rowGroupCount + 1) * sizeof(uint64_t) +
+		rowCount * sizeof(double) + 4 * rowGroupCount * sizeof(double) + 2 * sizeof(int);
+}
+
+bool deviceValueIteration_setOffsets(DeviceValueIterationSystem* system, double const* b) {
+	return upload(system, system->offsets, b, system->rowCount * sizeof(double)) && synchronizeTransfers(system);
+}
+
+bool deviceValueIteration_setValues(DeviceValueIterationSystem* system, double const* lower, double const* upper) {
+	// Pending iterations might still read the current values.
+	DEVICE_VI_CHECK(cudaStreamSynchronize(system->computeStream));
+	size_t const bytes = system->rowGroupCount * sizeof(double);
+	if (!upload(system, system->lower[system->current], lower, bytes) || (upper != nullptr && !upload(system, system->upper[system->current], upper, bytes)) ||
+		!synchronizeTransfers(system)) {
+		return false;
+	}
+	// Blocks are solved in alternating buffers, so the initial values need to be present in both of them.
+	return copyToOtherBuffers(system, 0, system->rowGroupCount, upper != nullptr);
+}
+
+bool deviceValueIteration_getValues(DeviceValueIterationSystem* system, double* lower, double* upper) {
+	size_t const bytes = system->rowGroupCount * sizeof(double);
+	return download(system, lower, system->lower[system->current], bytes) &&
+		(upper == nullptr || download(system, upper, system->upper[system->current], bytes));
+}
+
+bool deviceValueIteration_solve(DeviceValueIterationSystem* system, uint64_t numberOfBlocks, uint64_t const* blockStarts, bool minimize, bool interval,
+	double precision, bool relative, uint64_t maxIterations, bool (*terminate)(), uint64_t* iterations, bool* converged) {
+	*iterations = 0;
+	*converged = true;
+	for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+		uint64_t const firstGroup = blockStarts[block];
+		uint64_t const lastGroup = blockStarts[block + 1];
+		if (firstGroup == lastGroup) {
+			continue;
+		}
+
+		// The convergence flag of an iteration is only inspected after the next iteration has been issued, so the host never waits for the
+		// device in between two iterations. Once convergence is detected, the values of the subsequent iteration are kept.
+		bool blockConverged = false;
+		bool aborted = false;
+		int pendingFlag = -1;
+		for (uint64_t blockIterations = 0; !blockConverged && !aborted && *iterations < maxIterations; ++blockIterations) {
+			int const flag = blockIterations % 2;
+			DEVICE_VI_CHECK(cudaMemsetAsync(system->deviceFlags + flag, 0, sizeof(int), system->computeStream));
+			if (minimize) {
+				relative ? launchStep<true, true>(system, interval, firstGroup, lastGroup, precision, flag)
+						 : launchStep<true, false>(system, interval, firstGroup, lastGroup, precision, flag);
+			} else {
+				relative ? launchStep<false, true>(system, interval, firstGroup, lastGroup, precision, flag)
+						 : launchStep<false, false>(system, interval, firstGroup, lastGroup, precision, flag);
+			}
+			DEVICE_VI_CHECK(cudaGetLastError());
+			DEVICE_VI_CHECK(cudaMemcpyAsync(system->hostFlags + flag, system->deviceFlags + flag, sizeof(int), cudaMemcpyDeviceToHost, system->computeStream));
+			DEVICE_VI_CHECK(cudaEventRecord(system->flagCopied[flag], system->computeStream));
+			system->current = 1 - system->current;
+			++*iterations;
+
+			if (pendingFlag >= 0) {
+				DEVICE_VI_CHECK(cudaEventSynchronize(system->flagCopied[pendingFlag]));
+				blockConverged = system->hostFlags[pendingFlag] == 0;
+			}
+			pendingFlag = flag;
+			aborted = terminate != nullptr && terminate();
+		}
+		if (!blockConverged && pendingFlag >= 0) {
+			DEVICE_VI_CHECK(cudaEventSynchronize(system->flagCopied[pendingFlag]));
+			blockConverged = system->hostFlags[pendingFlag] == 0;
+		}
+
+		// Later blocks may read the values of this block from either buffer.
+		if (!copyToOtherBuffers(system, firstGroup, lastGroup, interval)) {
+			return false;
+		}
+		if (!blockConverged) {
+			// The values of all later blocks depend on the ones of this block.
+			*converged = false;
+			break;
+		}
+	}
+	DEVICE_VI_CHECK(cudaStreamSynchronize(system->computeStream));
+	return true;
+}
+
+char const* deviceValueIteration_getLastError() {
+	return lastError;
+}
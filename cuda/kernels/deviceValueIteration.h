@@ -0,0 +1,76 @@
+#ifndef STORM_CUDAFORSTORM_DEVICEVALUEITERATION_H_
+#define STORM_CUDAFORSTORM_DEVICEVALUEITERATION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+// Library exports
+#include "cudaForStorm.h"
+
+/*
+ * Value iteration on a min/max equation system x = min/max (A*x + b) that stays resident in device memory.
+ *
+ * In contrast to the functions in basicValueIteration.h, the matrix is uploaded once (in compressed row storage with separate column
+ * and value arrays) and can then be used for an arbitrary number of solves. The row groups are solved in blocks of consecutive groups,
+ * where the entries of a block may only refer to groups of the same block or of blocks that have been solved before (e.g., the SCCs of the
+ * system in topological order). All transfers to the device are split into chunks that are staged in page-locked memory, such that
+ * copying the next chunk on the host overlaps the transfer of the previous one. During the iterations, the convergence flag of an
+ * iteration is copied back asynchronously while the next iteration is already running on the device.
+ */
+
+// Opaque handle to a system that is resident in device memory.
+struct DeviceValueIterationSystem;
+
+/*
+ * Uploads the given system to the device. The arrays are only read during the call.
+ * Returns nullptr if the device memory is exhausted or another error occurred (see deviceValueIteration_getLastError).
+ */
+DeviceValueIterationSystem* deviceValueIteration_createSystem(uint64_t rowCount, uint64_t rowGroupCount, uint64_t entryCount, uint64_t const* rowIndications,
+	uint32_t const* columns, double const* values, uint64_t const* rowGroupIndices);
+
+/*
+ * Frees all device and page-locked host memory that is held by the given system.
+ */
+void deviceValueIteration_destroySystem(DeviceValueIterationSystem* system);
+
+/*
+ * Returns the number of bytes of device memory that a system with the given dimensions occupies.
+ */
+size_t deviceValueIteration_getRequiredMemory(uint64_t rowCount, uint64_t rowGroupCount, uint64_t entryCount);
+
+/*
+ * Uploads the right-hand side b (one entry per row).
+ */
+bool deviceValueIteration_setOffsets(DeviceValueIterationSystem* system, double const* b);
+
+/*
+ * Uploads the initial values (one entry per row group). For interval iteration, upper has to be given as well.
+ */
+bool deviceValueIteration_setValues(DeviceValueIterationSystem* system, double const* lower, double const* upper);
+
+/*
+ * Downloads the current values. If upper is not nullptr, the current upper values of interval iteration are downloaded as well.
+ */
+bool deviceValueIteration_getValues(DeviceValueIterationSystem* system, double* lower, double* upper);
+
+/*
+ * Solves the blocks [blockStarts[i], blockStarts[i + 1]) of row groups for i = 0, ..., numberOfBlocks - 1 in this order.
+ *
+ * @param interval If set, interval iteration is performed on the lower and upper values, which then have to be sound bounds.
+ * The iteration for a block stops once the upper and lower values are at most precision apart. Otherwise, the iteration for a block stops
+ * once no value changed by more than precision.
+ * @param maxIterations The maximal number of iterations over all blocks.
+ * @param terminate If not nullptr, this is consulted after each iteration and the computation is aborted once it returns true.
+ * @param iterations Is set to the number of performed iterations (over all blocks).
+ * @param converged Is set to true iff all blocks converged.
+ * @return false iff an error occurred.
+ */
+bool deviceValueIteration_solve(DeviceValueIterationSystem* system, uint64_t numberOfBlocks, uint64_t const* blockStarts, bool minimize, bool interval,
+	double precision, bool relative, uint64_t maxIterations, bool (*terminate)(), uint64_t* iterations, bool* converged);
+
+/*
+ * Returns a description of the last error that occurred in one of the functions above.
+ */
+char const* deviceValueIteration_getLastError();
+
+#endif // STORM_CUDAFORSTORM_DEVICEVALUEITERATION_H_
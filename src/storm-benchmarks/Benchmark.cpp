@@ -0,0 +1,58 @@
+#include "storm-benchmarks/Benchmark.h"
+
+namespace storm {
+namespace benchmarks {
+
+BenchmarkState::BenchmarkState(int64_t argument, double minimalSeconds, uint64_t maximalIterations)
+    : argument(argument), minimalSeconds(minimalSeconds), maximalIterations(maximalIterations), iterations(0), started(false), seconds(0) {
+    // Intentionally left empty.
+}
+
+bool BenchmarkState::keepRunning() {
+    auto now = std::chrono::steady_clock::now();
+    if (!started) {
+        started = true;
+        startTime = now;
+    } else {
+        ++iterations;
+        seconds = std::chrono::duration<double>(now - startTime).count();
+        if (seconds >= minimalSeconds || iterations >= maximalIterations) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int64_t BenchmarkState::getArgument() const {
+    return argument;
+}
+
+void BenchmarkState::setCounter(std::string const& name, double value) {
+    counters[name] = value;
+}
+
+uint64_t BenchmarkState::getIterations() const {
+    return iterations;
+}
+
+double BenchmarkState::getSeconds() const {
+    return seconds;
+}
+
+std::map<std::string, double> const& BenchmarkState::getCounters() const {
+    return counters;
+}
+
+std::vector<RegisteredBenchmark>& getRegisteredBenchmarks() {
+    // A function-local static avoids depending on the initialization order of the translation units that register benchmarks.
+    static std::vector<RegisteredBenchmark> benchmarks;
+    return benchmarks;
+}
+
+bool registerBenchmark(std::string const& name, BenchmarkFunction const& function, std::vector<int64_t> const& arguments) {
+    getRegisteredBenchmarks().push_back({name, function, arguments.empty() ? std::vector<int64_t>({0}) : arguments});
+    return true;
+}
+
+}  // namespace benchmarks
+}  // namespace storm
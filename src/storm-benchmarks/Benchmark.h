@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * The state of a running microbenchmark. The measured code is executed as long as keepRunning() returns true, e.g.
+ *
+ *     while (state.keepRunning()) { ... }
+ *
+ * Everything before the loop (e.g. setting up the input) is not measured.
+ */
+class BenchmarkState {
+   public:
+    BenchmarkState(int64_t argument, double minimalSeconds, uint64_t maximalIterations);
+
+    /*!
+     * Retrieves whether another iteration of the measured code is to be executed. The iterations continue until the minimal time has been
+     * exceeded (or the maximal number of iterations has been reached), but at least one iteration is always executed.
+     */
+    bool keepRunning();
+
+    /*!
+     * Retrieves the argument with which the benchmark is run (e.g. the size of the input).
+     */
+    int64_t getArgument() const;
+
+    /*!
+     * Sets a counter that is exported together with the measurements.
+     */
+    void setCounter(std::string const& name, double value);
+
+    uint64_t getIterations() const;
+    double getSeconds() const;
+    std::map<std::string, double> const& getCounters() const;
+
+   private:
+    int64_t argument;
+    double minimalSeconds;
+    uint64_t maximalIterations;
+
+    uint64_t iterations;
+    bool started;
+    std::chrono::steady_clock::time_point startTime;
+    double seconds;
+    std::map<std::string, double> counters;
+};
+
+typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+/*!
+ * A microbenchmark that is run once for each of its arguments.
+ */
+struct RegisteredBenchmark {
+    std::string name;
+    BenchmarkFunction function;
+    std::vector<int64_t> arguments;
+};
+
+/*!
+ * Retrieves all microbenchmarks that have been registered so far.
+ */
+std::vector<RegisteredBenchmark>& getRegisteredBenchmarks();
+
+/*!
+ * Registers a microbenchmark. This is usually invoked through the STORM_BENCHMARK macro.
+ * @param arguments the arguments for which the benchmark is run. If empty, the benchmark is run once with argument zero.
+ */
+bool registerBenchmark(std::string const& name, BenchmarkFunction const& function, std::vector<int64_t> const& arguments = {});
+
+/*!
+ * Prevents the compiler from optimizing away the computation of the given value.
+ */
+template<typename T>
+inline void doNotOptimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Defines and registers a microbenchmark with the given name that is run for all given arguments (or once with argument zero).
+#define STORM_BENCHMARK(name, ...)                                                                                                            \
+    void name(storm::benchmarks::BenchmarkState& state);                                                                                      \
+    static bool const name##Registered = storm::benchmarks::registerBenchmark(#name, name, std::vector<int64_t>({__VA_ARGS__}));            \
+    void name(storm::benchmarks::BenchmarkState& state)
+
+}  // namespace benchmarks
+}  // namespace storm
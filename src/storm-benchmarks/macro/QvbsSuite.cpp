@@ -0,0 +1,189 @@
+#include "storm-benchmarks/macro/QvbsSuite.h"
+
+#include <exception>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+
+storm::Environment createEnvironment(std::string const& method) {
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    if (method == "vi") {
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    } else if (method == "ii") {
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::IntervalIteration);
+    } else if (method == "svi") {
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SoundValueIteration);
+    } else if (method == "ovi") {
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration);
+    } else if (method == "topological") {
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown solution method '" << method << "'.");
+    }
+    return env;
+}
+
+uint64_t getNumberOfIterations(storm::json<double> const& phases) {
+    uint64_t result = 0;
+    for (auto const& phase : phases) {
+        if (phase.count("counters") > 0 && phase["counters"].count("iterations") > 0) {
+            result += phase["counters"]["iterations"].get<uint64_t>();
+        }
+        if (phase.count("phases") > 0) {
+            result += getNumberOfIterations(phase["phases"]);
+        }
+    }
+    return result;
+}
+
+/*!
+ * Runs the given function and records its time, the peak resident set size and the number of solver iterations in the given JSON object.
+ */
+template<typename FunctionType>
+void measure(storm::json<double>& measurement, FunctionType const& function) {
+    storm::utility::profiling::reset();
+    storm::utility::Stopwatch watch(true);
+    try {
+        function();
+    } catch (std::exception const& e) {
+        measurement["error"] = std::string(e.what());
+    }
+    watch.stop();
+    auto profile = storm::utility::profiling::toJson();
+    measurement["time"] = static_cast<double>(watch.getTimeInNanoseconds()) * 1e-9;
+    measurement["peak-rss-kb"] = profile["peak-rss-kb"];
+    uint64_t iterations = getNumberOfIterations(profile["phases"]);
+    if (iterations > 0) {
+        measurement["iterations"] = iterations;
+    }
+}
+
+void recordResult(storm::json<double>& measurement, std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
+    if (result && result->isQuantitative()) {
+        measurement["result"] = result->asQuantitativeCheckResult<double>().getMin();
+    }
+}
+
+template<typename CheckFunctionType>
+void checkProperties(storm::json<double>& entryResult, std::vector<storm::jani::Property> const& properties, CheckFunctionType const& check) {
+    storm::json<double> propertyResults = storm::json<double>::array();
+    for (auto const& property : properties) {
+        storm::json<double> measurement;
+        measurement["property"] = property.getName();
+        measure(measurement, [&]() { recordResult(measurement, check(storm::api::createTask<double>(property.getRawFormula(), true))); });
+        propertyResults.push_back(std::move(measurement));
+    }
+    entryResult["properties"] = std::move(propertyResults);
+}
+
+}  // namespace
+
+std::vector<QvbsSuiteEntry> createQvbsSuite(std::vector<std::string> const& modelNames, std::vector<std::string> const& engines,
+                                            std::vector<std::string> const& methods) {
+    std::vector<QvbsSuiteEntry> result;
+    for (auto const& modelName : modelNames) {
+        for (auto const& engine : engines) {
+            for (auto const& method : methods) {
+                result.push_back({modelName, 0, engine, method});
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> getDefaultQvbsSuiteModels() {
+    return {"brp", "crowds", "nand", "consensus", "csma", "zeroconf"};
+}
+
+storm::json<double> runQvbsSuiteEntry(QvbsSuiteEntry const& entry) {
+    storm::json<double> result;
+    result["model"] = entry.modelName;
+    result["instance"] = entry.instanceIndex;
+    result["engine"] = entry.engine;
+    result["method"] = entry.method;
+
+    storm::storage::QvbsBenchmark benchmark(entry.modelName);
+    auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(entry.instanceIndex));
+    storm::storage::SymbolicModelDescription modelDescription(janiInput.first);
+    auto constantDefinitions = modelDescription.parseConstantDefinitions(benchmark.getConstantDefinition(entry.instanceIndex));
+    modelDescription = modelDescription.preprocess(constantDefinitions);
+    std::vector<storm::jani::Property> properties = storm::api::substituteConstantsInProperties(janiInput.second, constantDefinitions);
+    auto formulas = storm::api::extractFormulasFromProperties(properties);
+    storm::Environment env = createEnvironment(entry.method);
+
+    bool const previouslyEnabled = storm::utility::profiling::isEnabled();
+    storm::utility::profiling::setEnabled(true);
+    storm::json<double> buildMeasurement;
+    if (entry.engine == "sparse") {
+        std::shared_ptr<storm::models::sparse::Model<double>> model;
+        measure(buildMeasurement, [&]() { model = storm::api::buildSparseModel<double>(modelDescription, formulas); });
+        if (model) {
+            buildMeasurement["states"] = model->getNumberOfStates();
+            buildMeasurement["transitions"] = model->getNumberOfTransitions();
+            result["build"] = std::move(buildMeasurement);
+            checkProperties(result, properties, [&](auto const& task) {
+                auto checkResult = storm::api::verifyWithSparseEngine<double>(env, model, task);
+                if (checkResult) {
+                    checkResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+                }
+                return checkResult;
+            });
+        }
+    } else if (entry.engine == "hybrid" || entry.engine == "dd") {
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model;
+        measure(buildMeasurement, [&]() { model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(modelDescription, formulas); });
+        if (model) {
+            buildMeasurement["states"] = model->getNumberOfStates();
+            buildMeasurement["transitions"] = model->getNumberOfTransitions();
+            result["build"] = std::move(buildMeasurement);
+            checkProperties(result, properties, [&](auto const& task) {
+                auto checkResult = entry.engine == "hybrid" ? storm::api::verifyWithHybridEngine<storm::dd::DdType::CUDD, double>(env, model, task)
+                                                            : storm::api::verifyWithDdEngine<storm::dd::DdType::CUDD, double>(env, model, task);
+                if (checkResult) {
+                    checkResult->filter(
+                        storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>(model->getReachableStates(), model->getInitialStates()));
+                }
+                return checkResult;
+            });
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown engine '" << entry.engine << "'.");
+    }
+    if (result.count("build") == 0) {
+        result["build"] = std::move(buildMeasurement);
+    }
+    storm::utility::profiling::setEnabled(previouslyEnabled);
+    return result;
+}
+
+}  // namespace benchmarks
+}  // namespace storm
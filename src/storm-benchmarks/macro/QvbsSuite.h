@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * An instance of the Quantitative Verification Benchmark Set together with the engine and solution method with which it is checked.
+ */
+struct QvbsSuiteEntry {
+    std::string modelName;
+    uint64_t instanceIndex;
+    // One of "sparse", "hybrid" and "dd".
+    std::string engine;
+    // One of "vi", "ii", "svi", "ovi" and "topological".
+    std::string method;
+};
+
+/*!
+ * Creates the suite that checks all combinations of the given models (in their first instance), engines and methods.
+ */
+std::vector<QvbsSuiteEntry> createQvbsSuite(std::vector<std::string> const& modelNames, std::vector<std::string> const& engines,
+                                            std::vector<std::string> const& methods);
+
+/*!
+ * Retrieves the models that are checked by default. These are small instances of different model types.
+ */
+std::vector<std::string> getDefaultQvbsSuiteModels();
+
+/*!
+ * Builds the model of the given entry and checks all of its properties. For the model and each property, the result records the time,
+ * the peak resident set size and (if the engine reports them) the number of solver iterations. The location of the benchmark set is taken
+ * from the IO settings.
+ */
+storm::json<double> runQvbsSuiteEntry(QvbsSuiteEntry const& entry);
+
+}  // namespace benchmarks
+}  // namespace storm
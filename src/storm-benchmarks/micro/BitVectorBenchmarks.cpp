@@ -0,0 +1,130 @@
+#include "storm-benchmarks/Benchmark.h"
+
+#include <random>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/utility/simd.h"
+
+namespace {
+
+storm::storage::BitVector createRandomBitVector(uint64_t length, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::bernoulli_distribution bit(0.5);
+    storm::storage::BitVector result(length);
+    for (uint64_t index = 0; index < length; ++index) {
+        result.set(index, bit(generator));
+    }
+    return result;
+}
+
+STORM_BENCHMARK(BitVectorAnd, 1000, 1000000) {
+    auto first = createRandomBitVector(state.getArgument(), 1);
+    auto second = createRandomBitVector(state.getArgument(), 2);
+    while (state.keepRunning()) {
+        auto result = first & second;
+        storm::benchmarks::doNotOptimize(result);
+    }
+}
+
+STORM_BENCHMARK(BitVectorComplement, 1000, 1000000) {
+    auto vector = createRandomBitVector(state.getArgument(), 1);
+    while (state.keepRunning()) {
+        auto result = ~vector;
+        storm::benchmarks::doNotOptimize(result);
+    }
+}
+
+STORM_BENCHMARK(BitVectorNumberOfSetBits, 1000, 1000000) {
+    auto vector = createRandomBitVector(state.getArgument(), 1);
+    while (state.keepRunning()) {
+        storm::benchmarks::doNotOptimize(vector.getNumberOfSetBits());
+    }
+}
+
+STORM_BENCHMARK(BitVectorIterateSetBits, 1000, 1000000) {
+    auto vector = createRandomBitVector(state.getArgument(), 1);
+    while (state.keepRunning()) {
+        uint64_t sum = 0;
+        for (auto index : vector) {
+            sum += index;
+        }
+        storm::benchmarks::doNotOptimize(sum);
+    }
+}
+
+STORM_BENCHMARK(BitVectorGetSetIndices, 1000, 1000000) {
+    auto vector = createRandomBitVector(state.getArgument(), 1);
+    while (state.keepRunning()) {
+        auto indices = vector.getSetIndices();
+        storm::benchmarks::doNotOptimize(indices.data());
+    }
+}
+
+/*!
+ * Runs the given kernel on one million random words with the given instruction set. Unsupported instruction sets are skipped, which yields
+ * zero iterations.
+ */
+template<typename KernelType>
+void benchmarkWordKernel(storm::benchmarks::BenchmarkState& state, KernelType const& kernel) {
+    auto instructionSet = static_cast<storm::utility::simd::InstructionSet>(state.getArgument());
+    if (instructionSet > storm::utility::simd::getSupportedInstructionSet()) {
+        return;
+    }
+    uint64_t const count = 1000000 / 64;
+    auto first = createRandomBitVector(count * 64, 1);
+    auto second = createRandomBitVector(count * 64, 2);
+    std::vector<uint64_t> firstWords(count), secondWords(count), result(count);
+    for (uint64_t word = 0; word < count; ++word) {
+        firstWords[word] = first.getAsInt(word * 64, 64);
+        secondWords[word] = second.getAsInt(word * 64, 64);
+    }
+    while (state.keepRunning()) {
+        kernel(instructionSet, count, firstWords.data(), secondWords.data(), result.data());
+    }
+}
+
+// The arguments are the instruction sets (scalar, AVX2 and AVX-512).
+STORM_BENCHMARK(SimdBitwiseAnd, 0, 1, 2) {
+    benchmarkWordKernel(state, [](auto instructionSet, uint64_t count, uint64_t const* first, uint64_t const* second, uint64_t* result) {
+        storm::utility::simd::applyBitwiseOperation(instructionSet, storm::utility::simd::BitwiseOperation::And, count, first, second, result);
+        storm::benchmarks::doNotOptimize(result);
+    });
+}
+
+STORM_BENCHMARK(SimdComplement, 0, 1, 2) {
+    benchmarkWordKernel(state, [](auto instructionSet, uint64_t count, uint64_t const* first, uint64_t const*, uint64_t* result) {
+        storm::utility::simd::applyBitwiseOperation(instructionSet, storm::utility::simd::BitwiseOperation::Complement, count, first, nullptr, result);
+        storm::benchmarks::doNotOptimize(result);
+    });
+}
+
+STORM_BENCHMARK(SimdCountSetBits, 0, 1, 2) {
+    benchmarkWordKernel(state, [](auto instructionSet, uint64_t count, uint64_t const* first, uint64_t const*, uint64_t*) {
+        storm::benchmarks::doNotOptimize(storm::utility::simd::countSetBits(instructionSet, count, first));
+    });
+}
+
+STORM_BENCHMARK(BitVectorHashMapFindOrAdd, 1000, 100000) {
+    // Keys of the size of a typical compressed state. Every key is inserted once and looked up once.
+    uint64_t const numberOfKeys = state.getArgument();
+    std::mt19937_64 generator(42);
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(numberOfKeys);
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        keys.emplace_back(64);
+        keys.back().setFromInt(0, 64, generator());
+    }
+    while (state.keepRunning()) {
+        storm::storage::BitVectorHashMap<uint32_t> map(64);
+        for (uint64_t key = 0; key < numberOfKeys; ++key) {
+            map.findOrAdd(keys[key], key);
+        }
+        for (uint64_t key = 0; key < numberOfKeys; ++key) {
+            storm::benchmarks::doNotOptimize(map.findOrAdd(keys[key], 0));
+        }
+    }
+}
+
+}  // namespace
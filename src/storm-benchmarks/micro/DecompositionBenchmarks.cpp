@@ -0,0 +1,30 @@
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/micro/RandomModels.h"
+
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+namespace {
+
+STORM_BENCHMARK(SccDecomposition, 10000, 1000000) {
+    auto matrix = storm::benchmarks::createRandomTransitionMatrix(state.getArgument(), 1, 3);
+    uint64_t numberOfSccs = 0;
+    while (state.keepRunning()) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix);
+        numberOfSccs = decomposition.size();
+    }
+    state.setCounter("sccs", numberOfSccs);
+}
+
+STORM_BENCHMARK(MecDecomposition, 10000, 100000) {
+    auto matrix = storm::benchmarks::createRandomTransitionMatrix(state.getArgument(), 3, 2);
+    auto backwardTransitions = matrix.transpose(true);
+    uint64_t numberOfMecs = 0;
+    while (state.keepRunning()) {
+        storm::storage::MaximalEndComponentDecomposition<double> decomposition(matrix, backwardTransitions);
+        numberOfMecs = decomposition.size();
+    }
+    state.setCounter("mecs", numberOfMecs);
+}
+
+}  // namespace
@@ -0,0 +1,40 @@
+#include "storm-benchmarks/Benchmark.h"
+
+#include <string>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/prism/Program.h"
+
+namespace {
+
+/*!
+ * Creates an MDP that interleaves the given number of counters, i.e. it has 10^numberOfModules states.
+ */
+storm::prism::Program createCounterProgram(uint64_t numberOfModules) {
+    std::string programString = "mdp\n";
+    for (uint64_t module = 0; module < numberOfModules; ++module) {
+        std::string variable = "x" + std::to_string(module);
+        programString += "module m" + std::to_string(module) + "\n";
+        programString += "  " + variable + " : [0..9] init 0;\n";
+        programString += "  [] " + variable + "<9 -> 0.5 : (" + variable + "'=" + variable + "+1) + 0.5 : (" + variable + "'=0);\n";
+        programString += "  [] " + variable + "=9 -> (" + variable + "'=0);\n";
+        programString += "endmodule\n";
+    }
+    return storm::parser::PrismParser::parseFromString(programString, "counters.nm");
+}
+
+STORM_BENCHMARK(PrismExplicitStateSpaceExploration, 3, 5) {
+    // Explores the complete state space, which is dominated by the next-state generation and the lookup of the successors.
+    auto program = createCounterProgram(state.getArgument());
+    uint64_t numberOfStates = 0;
+    while (state.keepRunning()) {
+        auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+        numberOfStates = model->getNumberOfStates();
+    }
+    state.setCounter("states", numberOfStates);
+}
+
+}  // namespace
@@ -0,0 +1,40 @@
+#include "storm-benchmarks/micro/RandomModels.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+namespace storm {
+namespace benchmarks {
+
+storm::storage::SparseMatrix<double> createRandomTransitionMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice,
+                                                                  uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<int64_t> localOffset(-4, 8);
+    std::uniform_int_distribution<uint64_t> anyState(0, numberOfStates - 1);
+    std::uniform_real_distribution<double> weight(0.1, 1.0);
+    std::bernoulli_distribution longRange(0.01);
+
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates * choicesPerState, numberOfStates, 0, true, true, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(state * choicesPerState);
+        for (uint64_t choice = 0; choice < choicesPerState; ++choice) {
+            std::map<uint64_t, double> successors;
+            double sum = 0;
+            for (uint64_t successor = 0; successor < successorsPerChoice; ++successor) {
+                int64_t target = static_cast<int64_t>(state) + localOffset(generator);
+                uint64_t column = longRange(generator) ? anyState(generator) : static_cast<uint64_t>(std::clamp<int64_t>(target, 0, numberOfStates - 1));
+                double value = weight(generator);
+                successors[column] += value;
+                sum += value;
+            }
+            for (auto const& entry : successors) {
+                builder.addNextValue(state * choicesPerState + choice, entry.first, entry.second / sum);
+            }
+        }
+    }
+    return builder.build();
+}
+
+}  // namespace benchmarks
+}  // namespace storm
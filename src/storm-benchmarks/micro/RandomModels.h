@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * Creates a (row grouped) random transition matrix with the given dimensions. The successors of each state are close to the state itself
+ * (with a few long-range transitions), which yields both small and large SCCs. The same seed always yields the same matrix.
+ */
+storm::storage::SparseMatrix<double> createRandomTransitionMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice,
+                                                                  uint64_t seed = 42);
+
+}  // namespace benchmarks
+}  // namespace storm
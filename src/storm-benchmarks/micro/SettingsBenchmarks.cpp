@@ -0,0 +1,96 @@
+#include "storm-benchmarks/Benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#include "storm/settings/modules/AbstractionSettings.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/CuddSettings.h"
+#include "storm/settings/modules/DebugSettings.h"
+#include "storm/settings/modules/EigenEquationSolverSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/ExplorationSettings.h"
+#include "storm/settings/modules/GameSolverSettings.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/GlpkSettings.h"
+#include "storm/settings/modules/GmmxxEquationSolverSettings.h"
+#include "storm/settings/modules/GurobiSettings.h"
+#include "storm/settings/modules/HintSettings.h"
+#include "storm/settings/modules/IOSettings.h"
+#include "storm/settings/modules/LongRunAverageSolverSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/settings/modules/MultiObjectiveSettings.h"
+#include "storm/settings/modules/MultiplierSettings.h"
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/settings/modules/OviSolverSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/Smt2SmtSolverSettings.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/settings/modules/SylvanSettings.h"
+#include "storm/settings/modules/TimeBoundedSolverSettings.h"
+#include "storm/settings/modules/TopologicalEquationSolverSettings.h"
+#include "storm/settings/modules/TransformationSettings.h"
+
+namespace {
+
+using namespace storm::settings::modules;
+
+// Creates the settings of the modules that are created right away when initializing the settings.
+void createEagerModules(std::vector<std::unique_ptr<ModuleSettings>>& modules) {
+    modules.push_back(std::make_unique<GeneralSettings>());
+    modules.push_back(std::make_unique<IOSettings>());
+    modules.push_back(std::make_unique<BuildSettings>());
+    modules.push_back(std::make_unique<CoreSettings>());
+    modules.push_back(std::make_unique<ModelCheckerSettings>());
+    modules.push_back(std::make_unique<DebugSettings>());
+    modules.push_back(std::make_unique<ResourceSettings>());
+    modules.push_back(std::make_unique<TransformationSettings>());
+}
+
+// Creates the settings of the modules that are only created once they are needed.
+void createLazyModules(std::vector<std::unique_ptr<ModuleSettings>>& modules) {
+    modules.push_back(std::make_unique<CuddSettings>());
+    modules.push_back(std::make_unique<SylvanSettings>());
+    modules.push_back(std::make_unique<GmmxxEquationSolverSettings>());
+    modules.push_back(std::make_unique<EigenEquationSolverSettings>());
+    modules.push_back(std::make_unique<NativeEquationSolverSettings>());
+    modules.push_back(std::make_unique<EliminationSettings>());
+    modules.push_back(std::make_unique<LongRunAverageSolverSettings>());
+    modules.push_back(std::make_unique<TimeBoundedSolverSettings>());
+    modules.push_back(std::make_unique<MinMaxEquationSolverSettings>());
+    modules.push_back(std::make_unique<GameSolverSettings>());
+    modules.push_back(std::make_unique<BisimulationSettings>());
+    modules.push_back(std::make_unique<GlpkSettings>());
+    modules.push_back(std::make_unique<GurobiSettings>());
+    modules.push_back(std::make_unique<TopologicalEquationSolverSettings>());
+    modules.push_back(std::make_unique<Smt2SmtSolverSettings>());
+    modules.push_back(std::make_unique<ExplorationSettings>());
+    modules.push_back(std::make_unique<StatisticalModelCheckingSettings>());
+    modules.push_back(std::make_unique<AbstractionSettings>());
+    modules.push_back(std::make_unique<MultiObjectiveSettings>());
+    modules.push_back(std::make_unique<MultiplierSettings>());
+    modules.push_back(std::make_unique<HintSettings>());
+    modules.push_back(std::make_unique<OviSolverSettings>());
+}
+
+STORM_BENCHMARK(SettingsCreateAllModules) {
+    while (state.keepRunning()) {
+        std::vector<std::unique_ptr<ModuleSettings>> modules;
+        createEagerModules(modules);
+        createLazyModules(modules);
+        storm::benchmarks::doNotOptimize(modules);
+    }
+}
+
+STORM_BENCHMARK(SettingsCreateEagerModules) {
+    while (state.keepRunning()) {
+        std::vector<std::unique_ptr<ModuleSettings>> modules;
+        createEagerModules(modules);
+        storm::benchmarks::doNotOptimize(modules);
+    }
+}
+
+}  // namespace
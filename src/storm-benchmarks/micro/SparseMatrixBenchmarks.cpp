@@ -0,0 +1,37 @@
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/micro/RandomModels.h"
+
+#include <vector>
+
+namespace {
+
+STORM_BENCHMARK(SparseMatrixMultiplyWithVector, 10000, 1000000) {
+    auto matrix = storm::benchmarks::createRandomTransitionMatrix(state.getArgument(), 1, 8);
+    std::vector<double> x(matrix.getColumnCount(), 1.0), result(matrix.getRowCount());
+    while (state.keepRunning()) {
+        matrix.multiplyWithVector(x, result);
+        storm::benchmarks::doNotOptimize(result.data());
+    }
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+STORM_BENCHMARK(SparseMatrixMultiplyAndReduce, 10000, 1000000) {
+    auto matrix = storm::benchmarks::createRandomTransitionMatrix(state.getArgument(), 4, 4);
+    std::vector<double> x(matrix.getColumnCount(), 1.0), b(matrix.getRowCount(), 0.5), result(matrix.getRowGroupCount());
+    while (state.keepRunning()) {
+        matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, result, nullptr);
+        storm::benchmarks::doNotOptimize(result.data());
+    }
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+STORM_BENCHMARK(SparseMatrixTranspose, 10000, 1000000) {
+    auto matrix = storm::benchmarks::createRandomTransitionMatrix(state.getArgument(), 1, 8);
+    while (state.keepRunning()) {
+        auto transposed = matrix.transpose();
+        storm::benchmarks::doNotOptimize(transposed.getEntryCount());
+    }
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+}  // namespace
@@ -0,0 +1,253 @@
+#include "storm-benchmarks/perf/PerfSuite.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
+
+#include "storm/exceptions/BaseException.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+
+// The measured quantities that are compared with the baseline.
+std::vector<std::string> const timeQuantities = {"build-time", "solve-time"};
+std::string const iterationsQuantity = "iterations";
+std::string const memoryQuantity = "peak-rss-kb";
+
+/*!
+ * Resets the peak resident set size of the process such that the peak of each benchmark can be measured separately. This is only possible
+ * on Linux. Elsewhere, the peak of the whole process is measured.
+ */
+void resetPeakResidentMemory() {
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) {
+        clearRefs << "5";
+    }
+#endif
+}
+
+uint64_t getPeakResidentKilobytes() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stoull(line.substr(6));
+        }
+    }
+#endif
+    return storm::utility::profiling::toJson()["peak-rss-kb"].get<uint64_t>();
+}
+
+uint64_t getNumberOfIterations(storm::json<double> const& phases) {
+    uint64_t result = 0;
+    for (auto const& phase : phases) {
+        if (phase.count("counters") > 0 && phase["counters"].count("iterations") > 0) {
+            result += phase["counters"]["iterations"].get<uint64_t>();
+        }
+        if (phase.count("phases") > 0) {
+            result += getNumberOfIterations(phase["phases"]);
+        }
+    }
+    return result;
+}
+
+double getSeconds(storm::utility::Stopwatch const& watch) {
+    return static_cast<double>(watch.getTimeInNanoseconds()) * 1e-9;
+}
+
+storm::Environment createEnvironment() {
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    return env;
+}
+
+/*!
+ * Retrieves the model description and the property of the given benchmark.
+ */
+std::pair<storm::storage::SymbolicModelDescription, storm::jani::Property> loadBenchmark(PerfBenchmark const& benchmark) {
+    if (benchmark.qvbsModel.empty()) {
+        storm::storage::SymbolicModelDescription modelDescription(storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + benchmark.prismFile));
+        auto properties = storm::api::parsePropertiesForPrismProgram(benchmark.property, modelDescription.asPrismProgram());
+        return {modelDescription.preprocess(), properties.front()};
+    }
+    storm::storage::QvbsBenchmark qvbsBenchmark(benchmark.qvbsModel);
+    auto janiInput = storm::api::parseJaniModel(qvbsBenchmark.getJaniFile(benchmark.qvbsInstance));
+    storm::storage::SymbolicModelDescription modelDescription(janiInput.first);
+    auto constantDefinitions = modelDescription.parseConstantDefinitions(qvbsBenchmark.getConstantDefinition(benchmark.qvbsInstance));
+    auto properties = storm::api::substituteConstantsInProperties(janiInput.second, constantDefinitions);
+    STORM_LOG_THROW(!properties.empty(), storm::exceptions::BaseException, "The QVBS model '" << benchmark.qvbsModel << "' has no properties.");
+    return {modelDescription.preprocess(constantDefinitions), properties.front()};
+}
+
+/*!
+ * Compares the given measured value with its baseline.
+ *
+ * @return One of "ok", "regression" and "improvement".
+ */
+std::string compare(double value, double baselineValue, double relativeTolerance, double minimalDifference) {
+    double const difference = value - baselineValue;
+    if (difference > relativeTolerance * baselineValue && difference > minimalDifference) {
+        return "regression";
+    } else if (-difference > relativeTolerance * baselineValue && -difference > minimalDifference) {
+        return "improvement";
+    }
+    return "ok";
+}
+
+void readTolerance(storm::json<double> const& tolerances, std::string const& key, double& tolerance) {
+    if (tolerances.count(key) > 0) {
+        tolerance = tolerances[key].get<double>();
+    }
+}
+
+}  // namespace
+
+std::vector<PerfBenchmark> getPerfBenchmarks() {
+    std::vector<PerfBenchmark> result;
+    result.push_back({"crowds-5-5", "dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]", "", 0});
+    result.push_back({"nand-5-2", "dtmc/nand-5-2.pm", "P=? [F \"target\"]", "", 0});
+    result.push_back({"brp-16-2", "dtmc/brp-16-2.pm", "P=? [F \"target\"]", "", 0});
+    result.push_back({"leader4", "mdp/leader4.nm", "Pmin=? [F \"elected\"]", "", 0});
+    result.push_back({"csma2-2-prob", "mdp/csma2-2.nm", "Pmin=? [F \"all_delivered\"]", "", 0});
+    result.push_back({"csma2-2-time", "mdp/csma2-2.nm", "R{\"time\"}max=? [F \"all_delivered\"]", "", 0});
+    result.push_back({"wlan0-2-4", "mdp/wlan0-2-4.nm", "Pmax=? [F \"twoCollisions\"]", "", 0});
+    result.push_back({"coin2-2", "mdp/coin2-2.nm", "Pmin=? [F \"finished\"]", "", 0});
+    for (std::string const& qvbsModel : {"consensus", "zeroconf", "csma"}) {
+        result.push_back({"qvbs-" + qvbsModel, "", "", qvbsModel, 0});
+    }
+    return result;
+}
+
+storm::json<double> runPerfBenchmark(PerfBenchmark const& benchmark) {
+    storm::json<double> result;
+    std::pair<storm::storage::SymbolicModelDescription, storm::jani::Property> modelAndProperty;
+    try {
+        modelAndProperty = loadBenchmark(benchmark);
+    } catch (std::exception const& e) {
+        // The model is not available, e.g. because the location of the benchmark set is not known.
+        result["skipped"] = std::string(e.what());
+        return result;
+    }
+    bool const previouslyEnabled = storm::utility::profiling::isEnabled();
+    storm::utility::profiling::setEnabled(true);
+    try {
+        storm::Environment env = createEnvironment();
+
+        resetPeakResidentMemory();
+        storm::utility::Stopwatch buildWatch(true);
+        auto model = storm::api::buildSparseModel<double>(modelAndProperty.first, {modelAndProperty.second.getRawFormula()});
+        buildWatch.stop();
+        result["build-time"] = getSeconds(buildWatch);
+        result["states"] = model->getNumberOfStates();
+        result["transitions"] = model->getNumberOfTransitions();
+
+        storm::utility::profiling::reset();
+        storm::utility::Stopwatch solveWatch(true);
+        auto task = storm::api::createTask<double>(modelAndProperty.second.getRawFormula(), true);
+        auto checkResult = storm::api::verifyWithSparseEngine<double>(env, model, task);
+        solveWatch.stop();
+        result["solve-time"] = getSeconds(solveWatch);
+        result[iterationsQuantity] = getNumberOfIterations(storm::utility::profiling::toJson()["phases"]);
+        result[memoryQuantity] = getPeakResidentKilobytes();
+        if (checkResult && checkResult->isQuantitative()) {
+            checkResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            result["result"] = checkResult->asQuantitativeCheckResult<double>().getMin();
+        }
+    } catch (std::exception const& e) {
+        result["error"] = std::string(e.what());
+    }
+    storm::utility::profiling::setEnabled(previouslyEnabled);
+    return result;
+}
+
+storm::json<double> compareWithPerfBaseline(storm::json<double> const& measurements, storm::json<double> const& baseline, PerfTolerances tolerances,
+                                            uint64_t& numberOfRegressions) {
+    if (baseline.count("tolerances") > 0) {
+        auto const& baselineTolerances = baseline["tolerances"];
+        readTolerance(baselineTolerances, "time", tolerances.time);
+        readTolerance(baselineTolerances, "minimal-time-difference", tolerances.minimalTimeDifference);
+        readTolerance(baselineTolerances, "memory", tolerances.memory);
+        readTolerance(baselineTolerances, "iterations", tolerances.iterations);
+    }
+
+    numberOfRegressions = 0;
+    storm::json<double> report;
+    for (auto const& measurement : measurements.items()) {
+        storm::json<double> entry;
+        entry["measured"] = measurement.value();
+        bool const hasBaseline = baseline.count("benchmarks") > 0 && baseline["benchmarks"].count(measurement.key()) > 0;
+        if (measurement.value().count("skipped") > 0) {
+            entry["verdict"] = "skipped";
+        } else if (measurement.value().count("error") > 0) {
+            // A benchmark that fails is a regression, no matter whether it has a baseline.
+            entry["verdict"] = "regression";
+            ++numberOfRegressions;
+        } else if (!hasBaseline) {
+            entry["verdict"] = "no baseline";
+        } else {
+            auto const& baselineEntry = baseline["benchmarks"][measurement.key()];
+            entry["baseline"] = baselineEntry;
+            auto compareQuantity = [&](std::string const& quantity, double relativeTolerance, double minimalDifference) {
+                if (baselineEntry.count(quantity) > 0) {
+                    std::string verdict = compare(measurement.value()[quantity].get<double>(), baselineEntry[quantity].get<double>(), relativeTolerance,
+                                                  minimalDifference);
+                    numberOfRegressions += verdict == "regression" ? 1 : 0;
+                    entry["verdicts"][quantity] = verdict;
+                } else {
+                    entry["verdicts"][quantity] = "no baseline";
+                }
+            };
+            for (auto const& quantity : timeQuantities) {
+                compareQuantity(quantity, tolerances.time, tolerances.minimalTimeDifference);
+            }
+            compareQuantity(iterationsQuantity, tolerances.iterations, 0.0);
+            compareQuantity(memoryQuantity, tolerances.memory, 0.0);
+            // A changed result is never tolerated beyond the precision of the solver.
+            if (baselineEntry.count("result") > 0 && measurement.value().count("result") > 0) {
+                double const baselineResult = baselineEntry["result"].get<double>();
+                double const difference = std::abs(measurement.value()["result"].get<double>() - baselineResult);
+                bool const sameResult = difference <= 1e-5 * std::max(1.0, std::abs(baselineResult));
+                entry["verdicts"]["result"] = sameResult ? "ok" : "regression";
+                numberOfRegressions += sameResult ? 0 : 1;
+            }
+        }
+        report[measurement.key()] = std::move(entry);
+    }
+    return report;
+}
+
+storm::json<double> createPerfBaseline(storm::json<double> const& measurements) {
+    storm::json<double> result;
+    for (auto const& measurement : measurements.items()) {
+        if (measurement.value().count("error") == 0 && measurement.value().count("skipped") == 0) {
+            result["benchmarks"][measurement.key()] = measurement.value();
+        }
+    }
+    return result;
+}
+
+}  // namespace benchmarks
+}  // namespace storm
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * A model checking query of the performance regression suite.
+ */
+struct PerfBenchmark {
+    // The name under which the measurements are reported and compared with the baseline.
+    std::string name;
+    // For benchmarks from the test files, the PRISM file (relative to the test resources) and the property. Otherwise, the model is taken
+    // from the Quantitative Verification Benchmark Set and its first property is checked.
+    std::string prismFile;
+    std::string property;
+    std::string qvbsModel;
+    uint64_t qvbsInstance = 0;
+};
+
+/*!
+ * The tolerated relative deviations from the baseline. Deviations of times below the minimal time difference are ignored, as they are
+ * dominated by noise.
+ */
+struct PerfTolerances {
+    double time = 0.25;
+    double minimalTimeDifference = 0.05;
+    double memory = 0.2;
+    double iterations = 0.0;
+};
+
+/*!
+ * Retrieves the curated benchmarks: models of the test files and (moderately sized) instances of QVBS models. QVBS benchmarks are skipped
+ * if the location of the benchmark set is not known.
+ */
+std::vector<PerfBenchmark> getPerfBenchmarks();
+
+/*!
+ * Builds the model of the given benchmark with the sparse engine and checks its property with value iteration.
+ *
+ * @return The measurements: the build time, the solve time (in seconds), the number of solver iterations, the peak resident set size during
+ * the benchmark (in kilobytes), the number of states and the result. If the model is not available, the result contains the reason under the
+ * key "skipped". If the benchmark fails, the result contains an error.
+ */
+storm::json<double> runPerfBenchmark(PerfBenchmark const& benchmark);
+
+/*!
+ * Compares the given measurements with the baseline. The baseline maps the name of each benchmark to its measurements (as created by
+ * createPerfBaseline) and may override the default tolerances under the key "tolerances".
+ *
+ * @param numberOfRegressions Is set to the number of measurements that exceed the tolerance.
+ * @return The report that lists, for each benchmark, the measurements, the baseline and the verdict for each measured quantity.
+ */
+storm::json<double> compareWithPerfBaseline(storm::json<double> const& measurements, storm::json<double> const& baseline, PerfTolerances tolerances,
+                                            uint64_t& numberOfRegressions);
+
+/*!
+ * Creates a baseline from the given measurements.
+ */
+storm::json<double> createPerfBaseline(storm::json<double> const& measurements);
+
+}  // namespace benchmarks
+}  // namespace storm
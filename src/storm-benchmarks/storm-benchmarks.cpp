@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/macro/QvbsSuite.h"
+#include "storm-benchmarks/perf/PerfSuite.h"
+#include "storm-version-info/storm-version.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/io/file.h"
+#include "storm/parser/CSVParser.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+
+namespace {
+
+struct HarnessOptions {
+    bool runMicrobenchmarks = true;
+    bool runQvbsSuite = false;
+    bool runPerfSuite = false;
+    std::string filter;
+    double minimalSeconds = 0.5;
+    uint64_t maximalIterations = 1000000;
+    std::string jsonFilename;
+    std::vector<std::string> qvbsModels = storm::benchmarks::getDefaultQvbsSuiteModels();
+    std::vector<std::string> engines = {"sparse", "hybrid"};
+    std::vector<std::string> methods = {"vi", "ii", "topological"};
+    std::string baselineFilename;
+    bool updateBaseline = false;
+    std::string reportFilename;
+};
+
+void printUsage() {
+    std::cout << "Usage: storm-benchmarks [options] [storm options]\n"
+              << "  --suite <micro|qvbs|perf|all> the benchmarks to run (default: micro)\n"
+              << "  --filter <substring>         only run the microbenchmarks whose name contains the given string\n"
+              << "  --min-time <seconds>         the minimal time spent for each microbenchmark (default: 0.5)\n"
+              << "  --max-iterations <number>    the maximal number of iterations of each microbenchmark (default: 1000000)\n"
+              << "  --json <filename>            writes the measurements to the given file\n"
+              << "  --qvbs-models <m1,m2,...>    the QVBS models to check (the location of the set is given by --qvbsroot)\n"
+              << "  --engines <e1,e2,...>        the engines for the QVBS suite (sparse, hybrid, dd)\n"
+              << "  --methods <m1,m2,...>        the solution methods for the QVBS suite (vi, ii, svi, ovi, topological)\n"
+              << "  --baseline <filename>        the baseline with which the performance regression suite is compared\n"
+              << "  --update-baseline            writes the measurements of the performance regression suite to the baseline file\n"
+              << "  --report <filename>          writes the comparison of the performance regression suite with the baseline to the given file\n"
+              << "All other options are passed to storm.\n";
+}
+
+/*!
+ * Parses the options of the harness and returns the remaining options, which are passed to storm.
+ */
+std::vector<std::string> parseHarnessOptions(int argc, char const* argv[], HarnessOptions& options) {
+    std::vector<std::string> stormArguments;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument(argv[i]);
+        bool hasValue = i + 1 < argc;
+        if (argument == "--help") {
+            printUsage();
+            std::exit(0);
+        } else if (argument == "--suite" && hasValue) {
+            std::string suite(argv[++i]);
+            options.runMicrobenchmarks = suite == "micro" || suite == "all";
+            options.runQvbsSuite = suite == "qvbs" || suite == "all";
+            options.runPerfSuite = suite == "perf" || suite == "all";
+        } else if (argument == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (argument == "--min-time" && hasValue) {
+            options.minimalSeconds = std::stod(argv[++i]);
+        } else if (argument == "--max-iterations" && hasValue) {
+            options.maximalIterations = std::stoull(argv[++i]);
+        } else if (argument == "--json" && hasValue) {
+            options.jsonFilename = argv[++i];
+        } else if (argument == "--qvbs-models" && hasValue) {
+            options.qvbsModels = storm::parser::parseCommaSeperatedValues(argv[++i]);
+        } else if (argument == "--engines" && hasValue) {
+            options.engines = storm::parser::parseCommaSeperatedValues(argv[++i]);
+        } else if (argument == "--methods" && hasValue) {
+            options.methods = storm::parser::parseCommaSeperatedValues(argv[++i]);
+        } else if (argument == "--baseline" && hasValue) {
+            options.baselineFilename = argv[++i];
+        } else if (argument == "--update-baseline") {
+            options.updateBaseline = true;
+        } else if (argument == "--report" && hasValue) {
+            options.reportFilename = argv[++i];
+        } else {
+            stormArguments.push_back(argument);
+        }
+    }
+    return stormArguments;
+}
+
+storm::json<double> runMicrobenchmarks(HarnessOptions const& options) {
+    storm::json<double> result = storm::json<double>::array();
+    for (auto const& benchmark : storm::benchmarks::getRegisteredBenchmarks()) {
+        if (benchmark.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        for (auto argument : benchmark.arguments) {
+            storm::benchmarks::BenchmarkState state(argument, options.minimalSeconds, options.maximalIterations);
+            benchmark.function(state);
+            double nanosecondsPerIteration = state.getSeconds() * 1e9 / static_cast<double>(std::max<uint64_t>(1, state.getIterations()));
+            std::string name = benchmark.name + "/" + std::to_string(argument);
+            std::cout << name << ": " << nanosecondsPerIteration << " ns/iteration (" << state.getIterations() << " iterations)\n";
+
+            storm::json<double> measurement;
+            measurement["name"] = name;
+            measurement["iterations"] = state.getIterations();
+            measurement["time-per-iteration-ns"] = nanosecondsPerIteration;
+            for (auto const& counter : state.getCounters()) {
+                measurement["counters"][counter.first] = counter.second;
+            }
+            result.push_back(std::move(measurement));
+        }
+    }
+    return result;
+}
+
+storm::json<double> runQvbsSuite(HarnessOptions const& options) {
+    storm::json<double> result = storm::json<double>::array();
+    for (auto const& entry : storm::benchmarks::createQvbsSuite(options.qvbsModels, options.engines, options.methods)) {
+        std::cout << "Checking QVBS model " << entry.modelName << " with the " << entry.engine << " engine and method " << entry.method << ".\n";
+        try {
+            result.push_back(storm::benchmarks::runQvbsSuiteEntry(entry));
+        } catch (storm::exceptions::BaseException const& e) {
+            std::cout << "  Skipped: " << e.what() << '\n';
+            storm::json<double> skipped;
+            skipped["model"] = entry.modelName;
+            skipped["engine"] = entry.engine;
+            skipped["method"] = entry.method;
+            skipped["error"] = std::string(e.what());
+            result.push_back(std::move(skipped));
+        }
+    }
+    return result;
+}
+
+void writeJson(std::string const& filename, storm::json<double> const& json) {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << json.dump(4) << '\n';
+    storm::utility::closeFile(stream);
+}
+
+/*!
+ * Runs the performance regression suite and compares the measurements with the baseline (if given).
+ *
+ * @return The report and the number of measurements that exceed their tolerance.
+ */
+std::pair<storm::json<double>, uint64_t> runPerfSuite(HarnessOptions const& options) {
+    storm::json<double> measurements;
+    for (auto const& benchmark : storm::benchmarks::getPerfBenchmarks()) {
+        std::cout << "Running performance benchmark " << benchmark.name << ".\n";
+        measurements[benchmark.name] = storm::benchmarks::runPerfBenchmark(benchmark);
+    }
+
+    storm::json<double> baseline;
+    if (!options.baselineFilename.empty() && !options.updateBaseline && storm::utility::fileExistsAndIsReadable(options.baselineFilename)) {
+        std::ifstream stream;
+        storm::utility::openFile(options.baselineFilename, stream);
+        baseline = storm::json<double>::parse(stream);
+        storm::utility::closeFile(stream);
+    }
+    uint64_t numberOfRegressions = 0;
+    storm::json<double> report = storm::benchmarks::compareWithPerfBaseline(measurements, baseline, storm::benchmarks::PerfTolerances(), numberOfRegressions);
+    for (auto const& entry : report.items()) {
+        std::cout << entry.key() << ":";
+        if (entry.value().count("verdicts") > 0) {
+            for (auto const& verdict : entry.value()["verdicts"].items()) {
+                std::cout << " " << verdict.key() << " " << verdict.value().get<std::string>();
+            }
+        } else {
+            std::cout << " " << entry.value()["verdict"].get<std::string>();
+        }
+        std::cout << '\n';
+    }
+    std::cout << numberOfRegressions << " performance regression(s).\n";
+
+    if (options.updateBaseline) {
+        STORM_LOG_THROW(!options.baselineFilename.empty(), storm::exceptions::InvalidArgumentException, "Updating the baseline requires --baseline.");
+        writeJson(options.baselineFilename, storm::benchmarks::createPerfBaseline(measurements));
+    }
+    return {report, numberOfRegressions};
+}
+
+}  // namespace
+
+/*!
+ * Runs the microbenchmarks, the QVBS suite and/or the performance regression suite and reports the measurements. If the performance
+ * regression suite exceeds the tolerances of its baseline, the exit code is 2. The inputs of all benchmarks are fixed (e.g. generated from
+ * fixed seeds), which makes the measurements of different builds comparable.
+ */
+int main(int argc, char const* argv[]) {
+    try {
+        storm::utility::setUp();
+        storm::settings::initializeAll("storm-benchmarks", "storm-benchmarks");
+        HarnessOptions options;
+        storm::settings::mutableManager().setFromExplodedString(parseHarnessOptions(argc, argv, options));
+
+        storm::json<double> result;
+        result["context"]["version"] = storm::StormVersion::shortVersionString();
+        result["context"]["build-info"] = storm::StormVersion::buildInfo();
+        if (options.runMicrobenchmarks) {
+            result["microbenchmarks"] = runMicrobenchmarks(options);
+        }
+        if (options.runQvbsSuite) {
+            result["qvbs"] = runQvbsSuite(options);
+        }
+        uint64_t numberOfRegressions = 0;
+        if (options.runPerfSuite) {
+            auto reportAndRegressions = runPerfSuite(options);
+            numberOfRegressions = reportAndRegressions.second;
+            result["perf"]["regressions"] = numberOfRegressions;
+            result["perf"]["benchmarks"] = std::move(reportAndRegressions.first);
+            if (!options.reportFilename.empty()) {
+                storm::json<double> report = result["perf"];
+                report["context"] = result["context"];
+                writeJson(options.reportFilename, report);
+            }
+        }
+
+        if (!options.jsonFilename.empty()) {
+            writeJson(options.jsonFilename, result);
+        }
+        storm::utility::cleanUp();
+        return numberOfRegressions > 0 ? 2 : 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        std::cerr << "An exception caused storm-benchmarks to terminate. The message of the exception is: " << exception.what() << '\n';
+        return 1;
+    }
+}
@@ -3,10 +3,12 @@
 #include "storm-cli-utilities/resources.h"
 #include "storm-version-info/storm-version.h"
 #include "storm/io/file.h"
+#include "storm/utility/MemoryLimit.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 
 #include <boost/algorithm/string/replace.hpp>
 #include <ctime>
@@ -53,12 +55,18 @@ int64_t process(const int argc, const char** argv) {
         return -1;
     }
 
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    storm::utility::profiling::setEnabled(resourceSettings.isExportProfileJsonSet());
     processOptions();
 
     totalTimer.stop();
-    if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+    printMemoryLimitDegradations();
+    if (resourceSettings.isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
+    if (resourceSettings.isExportProfileJsonSet()) {
+        storm::utility::profiling::exportToJsonFile(resourceSettings.getExportProfileJsonFilename());
+    }
 
     storm::utility::cleanUp();
     return 0;
@@ -209,6 +217,11 @@ void setResourceLimits() {
         storm::utility::resources::setTimeoutAlarm(resources.getTimeoutInSeconds());
     }
 
+    // If we were given a memory limit, engines that support it degrade gracefully when approaching it.
+    if (resources.isMemoryLimitSet()) {
+        storm::utility::resources::setMemoryLimit(resources.getMemoryLimitInMegabytes() * 1024 * 1024);
+    }
+
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
 }
@@ -283,6 +296,18 @@ void processOptions() {
 #endif
 }
 
+void printMemoryLimitDegradations() {
+    std::vector<std::string> degradations = storm::utility::resources::getDegradations();
+    if (degradations.empty()) {
+        return;
+    }
+    std::cout << "\nThe memory limit of " << (storm::utility::resources::getMemoryLimit() / 1024 / 1024)
+              << "MB was approached, so the following computations were degraded:\n";
+    for (auto const& degradation : degradations) {
+        std::cout << "  * " << degradation << '\n';
+    }
+}
+
 void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
     struct rusage ru;
     getrusage(RUSAGE_SELF, &ru);
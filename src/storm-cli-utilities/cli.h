@@ -25,6 +25,11 @@ void printVersion(std::string const& name);
 
 void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds = 0);
 
+/*!
+ * Prints the computations that were degraded because the memory limit was approached (if any).
+ */
+void printMemoryLimitDegradations();
+
 /*!
  * Parses the given command line arguments.
  *
@@ -11,16 +11,23 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <limits>
+#include <optional>
 #include <type_traits>
+#include <unordered_map>
 
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/StateSpaceEstimator.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
 
 #include "storm/models/ModelBase.h"
 
@@ -28,6 +35,9 @@
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
+#include "storm/modelchecker/hints/SolutionCache.h"
+#include "storm/modelchecker/results/BoundSweepCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -43,6 +53,7 @@
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
 #include "storm/settings/modules/TransformationSettings.h"
 #include "storm/storage/Qvbs.h"
 #include "storm/storage/jani/localeliminator/AutomaticAction.h"
@@ -134,6 +145,7 @@ SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings const&
 }
 
 SymbolicInput parseSymbolicInput() {
+    storm::utility::profiling::ScopedPhase phase("parse");
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isQvbsInputSet()) {
         return parseSymbolicInputQvbs(ioSettings);
@@ -172,8 +184,32 @@ struct ModelProcessingInformation {
     // A flag which is set to true, if the settings were detected to be compatible.
     // If this is false, it could be that the query can not be handled.
     bool isCompatible;
+
+    // If set, the estimated number of states of the explicit model.
+    std::optional<uint64_t> stateEstimate;
 };
 
+/*!
+ * Estimates the size of the explicit model of the given input and prints the estimate.
+ *
+ * @return The predicted number of states or nothing if the input can not be handled by the explicit state-space exploration.
+ */
+std::optional<uint64_t> estimateStateSpace(SymbolicInput const& input) {
+    storm::utility::profiling::ScopedPhase phase("state space estimation");
+    storm::storage::SymbolicModelDescription const& model = input.model.get();
+    std::optional<storm::builder::StateSpaceEstimator::Estimate> estimate;
+    if (model.isPrismProgram() && storm::generator::PrismNextStateGenerator<double, uint32_t>::canHandle(model.asPrismProgram())) {
+        estimate = storm::builder::StateSpaceEstimator(model.asPrismProgram()).estimate();
+    } else if (model.isJaniModel() && storm::generator::JaniNextStateGenerator<double, uint32_t>::canHandle(model.asJaniModel())) {
+        estimate = storm::builder::StateSpaceEstimator(model.asJaniModel()).estimate();
+    } else {
+        STORM_LOG_WARN("The size of the state space can not be estimated as the input is not supported by the explicit state-space exploration.");
+        return std::nullopt;
+    }
+    estimate->writeToStream(std::cout);
+    return static_cast<uint64_t>(std::min(estimate->states.value, static_cast<double>(std::numeric_limits<uint64_t>::max() / 2)));
+}
+
 void getModelProcessingInformationAutomatic(SymbolicInput const& input, ModelProcessingInformation& mpi) {
     auto hints = storm::settings::getModule<storm::settings::modules::HintSettings>();
 
@@ -188,6 +224,8 @@ void getModelProcessingInformationAutomatic(SymbolicInput const& input, ModelPro
     storm::utility::AutomaticSettings as;
     if (hints.isNumberStatesSet()) {
         as.predict(input.model->asJaniModel(), properties.front(), hints.getNumberStates());
+    } else if (mpi.stateEstimate) {
+        as.predict(input.model->asJaniModel(), properties.front(), mpi.stateEstimate.value());
     } else {
         as.predict(input.model->asJaniModel(), properties.front());
     }
@@ -215,10 +253,16 @@ ModelProcessingInformation getModelProcessingInformation(SymbolicInput const& in
     auto coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
     auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     auto bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
 
     // Set the engine.
     mpi.engine = coreSettings.getEngine();
 
+    // Estimate the size of the state space (if requested), which also guides the automatic engine.
+    if (input.model.is_initialized() && buildSettings.isEstimateSet()) {
+        mpi.stateEstimate = estimateStateSpace(input);
+    }
+
     // Set whether bisimulation is to be used.
     mpi.applyBisimulation = generalSettings.isBisimulationSet();
 
@@ -348,6 +392,7 @@ void ensureNoUndefinedPropertyConstants(std::vector<storm::jani::Property> const
 }
 
 std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input) {
+    storm::utility::profiling::ScopedPhase phase("input preprocessing");
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
 
     SymbolicInput output = input;
@@ -438,10 +483,13 @@ std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& inpu
 }
 
 template<typename ValueType>
-std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings,
+                                                           std::optional<uint64_t> const& stateEstimate = std::nullopt) {
     storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
     options.setBuildChoiceLabels(options.isBuildChoiceLabelsSet() || buildSettings.isBuildChoiceLabelsSet());
-    options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet());
+    // The solution cache identifies states by their valuations.
+    options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet() ||
+                                    storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isSolutionCacheDirectorySet());
     options.setBuildAllLabels(options.isBuildAllLabelsSet() || buildSettings.isBuildAllLabelsSet());
     options.setBuildObservationValuations(options.isBuildObservationValuationsSet() || buildSettings.isBuildObservationValuationsSet());
     bool buildChoiceOrigins = options.isBuildChoiceOriginsSet() || buildSettings.isBuildChoiceOriginsSet();
@@ -463,6 +511,9 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
+    options.setCompileExpressions(buildSettings.isCompileExpressionsSet());
+    options.setSymmetryReduction(buildSettings.isSymmetryReductionSet());
+    options.setPartialOrderReduction(buildSettings.isPartialOrderReductionSet());
     if (buildSettings.isBuildFullModelSet()) {
         options.clearTerminalStates();
         options.setApplyMaximalProgressAssumption(false);
@@ -474,7 +525,12 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
         options.setAddOverlappingGuardsLabel(true);
     }
 
-    return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+    // Size the state storage according to the estimated number of states (if any), so it does not need to grow during the exploration.
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options builderOptions;
+    if (stateEstimate) {
+        builderOptions.expectedNumberOfStates = stateEstimate.value();
+    }
+    return storm::api::buildSparseModel<ValueType>(input.model.get(), options, builderOptions);
 }
 
 template<typename ValueType>
@@ -491,6 +547,8 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitBinarySet()) {
+        result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -501,6 +559,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    storm::utility::profiling::ScopedPhase phase("build");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
@@ -510,9 +569,13 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         if (builderType == storm::builder::BuilderType::Dd) {
             result = buildModelDd<DdType, ValueType>(input);
         } else if (builderType == storm::builder::BuilderType::Explicit) {
-            result = buildModelSparse<ValueType>(input, buildSettings);
+            result = buildModelSparse<ValueType>(input, buildSettings, mpi.stateEstimate);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isBinaryDdSet()) {
+        STORM_LOG_THROW(storm::utility::getBuilderType(mpi.engine) == storm::builder::BuilderType::Dd, storm::exceptions::InvalidSettingsException,
+                        "Can only use DD-based engines with binary DD input.");
+        result = storm::api::buildBinaryDdModel<DdType, ValueType>(ioSettings.getBinaryDdFilename());
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
@@ -521,6 +584,8 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
     modelBuildingWatch.stop();
     if (result) {
         STORM_PRINT("Time for model construction: " << modelBuildingWatch << ".\n\n");
+        storm::utility::profiling::addToCounter("states", result->getNumberOfStates());
+        storm::utility::profiling::addToCounter("transitions", result->getNumberOfTransitions());
     }
 
     return result;
@@ -600,6 +665,13 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         result.second = true;
     }
 
+    if (transformationSettings.isPermuteStatesSet()) {
+        STORM_LOG_INFO("Permuting the states of the model ("
+                       << storm::utility::permutation::toString(transformationSettings.getStateOrder()) << " order)...");
+        result.first = storm::api::permuteModelStates<ValueType>(result.first, transformationSettings.getStateOrder()).first;
+        result.second = true;
+    }
+
     return result;
 }
 
@@ -615,7 +687,8 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
             case storm::exporter::ModelExportFormat::Drn:
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportBuildFilename(),
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
-                                                   !ioSettings.isExplicitExportPlaceholdersDisabled());
+                                                   !ioSettings.isExplicitExportPlaceholdersDisabled(),
+                                                   storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfBuildThreads());
                 break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
@@ -626,12 +699,17 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
         }
     }
 
+    if (ioSettings.isExportBinarySet()) {
+        storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
+    }
+
     // TODO: The following options are depreciated and shall be removed at some point:
 
     if (ioSettings.isExportExplicitSet()) {
         storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(),
                                            input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
-                                           !ioSettings.isExplicitExportPlaceholdersDisabled());
+                                           !ioSettings.isExplicitExportPlaceholdersDisabled(),
+                                           storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfBuildThreads());
     }
 
     if (ioSettings.isExportDdSet()) {
@@ -661,6 +739,10 @@ void exportDdModel(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueT
         }
     }
 
+    if (ioSettings.isExportBinarySet()) {
+        storm::api::exportSymbolicModelAsBinary(model, ioSettings.getExportBinaryFilename());
+    }
+
     // TODO: The following options are depreciated and shall be removed at some point:
 
     if (ioSettings.isExportExplicitSet()) {
@@ -762,6 +844,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::profiling::ScopedPhase phase("preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -862,6 +945,17 @@ void generateCounterexamples<double>(std::shared_ptr<storm::models::ModelBase> c
 
 template<typename ValueType>
 void printFilteredResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::modelchecker::FilterType ft) {
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+        if (result->isBoundSweepCheckResult()) {
+            auto const& sweepResult = result->asBoundSweepCheckResult<ValueType>();
+            STORM_PRINT('\n');
+            for (uint64_t boundIndex = 0; boundIndex < sweepResult.getBounds().size(); ++boundIndex) {
+                STORM_PRINT("  bound " << sweepResult.getBounds()[boundIndex] << ": ");
+                printFilteredResult<ValueType>(sweepResult.getResults()[boundIndex], ft);
+            }
+            return;
+        }
+    }
     if (result->isQuantitative()) {
         if (ft == storm::modelchecker::FilterType::VALUES) {
             STORM_PRINT(*result);
@@ -960,6 +1054,7 @@ void verifyProperties(
     auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
     for (auto const& property : properties) {
         printModelCheckingProperty(property);
+        storm::utility::profiling::ScopedPhase phase("check " + property.getName());
         bool ignored = false;
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1091,18 +1186,140 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithStatisticalEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+    std::optional<storm::modelchecker::ImportanceSplittingOptions> splittingOptions;
+    if (smcSettings.isImportanceSplittingSet()) {
+        splittingOptions = storm::modelchecker::ImportanceSplittingOptions();
+        if (smcSettings.isImportanceFunctionSet()) {
+            storm::parser::ExpressionParser expressionParser(input.model->getManager());
+            std::unordered_map<std::string, storm::expressions::Expression> variableMapping;
+            for (auto const& variableTypePair : input.model->getManager()) {
+                variableMapping[variableTypePair.first.getName()] = variableTypePair.first;
+            }
+            expressionParser.setIdentifierMapping(variableMapping);
+            splittingOptions->importanceFunction = expressionParser.parseFromString(smcSettings.getImportanceFunction());
+        }
+    }
+    verifyProperties<ValueType>(input, [&input, &mpi, &splittingOptions](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                          std::shared_ptr<storm::logic::Formula const> const& states) {
+        STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+        if (splittingOptions) {
+            return storm::api::verifyWithImportanceSplitting<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true),
+                                                                        splittingOptions.value());
+        }
+        return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+    });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+    auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+
+    // If requested, the properties that can be checked in a batch are checked together upfront. Their results are looked up (by formula) when
+    // the properties are processed.
+    std::unordered_map<storm::logic::Formula const*, std::unique_ptr<storm::modelchecker::CheckResult>> batchedResults;
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isBatchPropertiesSet() && !ioSettings.isExportSchedulerSet() &&
+        !transformationSettings.isChainEliminationSet() && !transformationSettings.isToDiscreteTimeModelSet()) {
+        auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+        std::vector<storm::logic::Formula const*> batchedFormulas;
+        std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> batchedTasks;
+        for (auto const& property : properties) {
+            auto task = storm::api::createTask<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula()->isInitialFormula());
+            if (storm::api::canVerifyInBatchWithSparseEngine(mpi.env, sparseModel, task)) {
+                batchedFormulas.push_back(property.getRawFormula().get());
+                batchedTasks.push_back(std::move(task));
+            }
+        }
+        if (batchedTasks.size() > 1) {
+            storm::utility::Stopwatch watch(true);
+            try {
+                auto results = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, batchedTasks);
+                for (uint64_t taskIndex = 0; taskIndex < batchedTasks.size(); ++taskIndex) {
+                    batchedResults[batchedFormulas[taskIndex]] = std::move(results[taskIndex]);
+                }
+            } catch (storm::exceptions::BaseException const& ex) {
+                STORM_LOG_WARN("Cannot check properties in a batch, checking them individually: " << ex.what());
+                batchedResults.clear();
+            }
+            watch.stop();
+            STORM_PRINT("Time for batched model checking of " << batchedTasks.size() << " properties: " << watch << ".\n");
+        }
+    }
+
+    // The LTL formulas of the properties are translated into automata concurrently upfront. The automata are cached, such that checking the
+    // properties does not translate them again.
+    if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+        auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        for (auto const& property : properties) {
+            formulas.push_back(property.getRawFormula());
+        }
+        try {
+            if (sparseModel->isNondeterministicModel()) {
+                storm::modelchecker::helper::SparseLTLHelper<ValueType, true>::translateLTLFormulas(mpi.env, formulas);
+            } else {
+                storm::modelchecker::helper::SparseLTLHelper<ValueType, false>::translateLTLFormulas(mpi.env, formulas);
+            }
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot translate the LTL formulas upfront, translating them individually: " << ex.what());
+        }
+    }
+
+    // If requested, bounded until properties are checked for all bounds of the sweep.
+    std::vector<ValueType> sweepBounds;
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isBoundSweepSet()) {
+        for (auto const& bound : storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getBoundSweep()) {
+            sweepBounds.push_back(storm::utility::convertNumber<ValueType>(bound));
+        }
+    }
+
+    // If requested, the solutions of previous runs are used as initial values and the new solutions are stored.
+    boost::optional<storm::modelchecker::SolutionCache<double>> solutionCache;
+    if (std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isSolutionCacheDirectorySet()) {
+        STORM_LOG_WARN_COND(sparseModel->hasStateValuations(), "The solution cache is not used as the model has no state valuations.");
+        if (sparseModel->hasStateValuations()) {
+            solutionCache.emplace(storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getSolutionCacheDirectory());
+        }
+    }
+
+    auto verificationCallback = [&sparseModel, &ioSettings, &mpi, &batchedResults, &sweepBounds, &solutionCache](
+                                    std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
-        auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-        if (ioSettings.isExportSchedulerSet()) {
-            task.setProduceSchedulers(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        auto batchedResultIt = batchedResults.find(formula.get());
+        if (batchedResultIt != batchedResults.end()) {
+            result = std::move(batchedResultIt->second);
+            batchedResults.erase(batchedResultIt);
+        } else {
+            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+            if (ioSettings.isExportSchedulerSet()) {
+                task.setProduceSchedulers(true);
+            }
+            if constexpr (std::is_same<ValueType, double>::value) {
+                if (solutionCache) {
+                    if (auto hint = solutionCache->loadHint(*sparseModel, *formula)) {
+                        task.setHint(hint);
+                    }
+                }
+            }
+            if (!sweepBounds.empty() && storm::api::canVerifyBoundSweepWithSparseEngine(sparseModel, task)) {
+                result = storm::api::verifyBoundSweepWithSparseEngine<ValueType>(mpi.env, sparseModel, task, sweepBounds);
+            } else {
+                result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+            }
+        }
+        if constexpr (std::is_same<ValueType, double>::value) {
+            if (solutionCache && result && result->isExplicitQuantitativeCheckResult() && result->isResultForAllStates()) {
+                solutionCache->store(*sparseModel, *formula, result->template asExplicitQuantitativeCheckResult<double>().getValueVector());
+            }
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
@@ -1119,8 +1336,8 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
     auto postprocessingCallback = [&sparseModel, &ioSettings, &input, &exportCount](std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
         if (ioSettings.isExportSchedulerSet()) {
             if (result->isExplicitQuantitativeCheckResult()) {
-                if (result->template asExplicitQuantitativeCheckResult<ValueType>().hasScheduler()) {
-                    auto const& scheduler = result->template asExplicitQuantitativeCheckResult<ValueType>().getScheduler();
+                auto const& quantitativeResult = result->template asExplicitQuantitativeCheckResult<ValueType>();
+                if (quantitativeResult.hasScheduler()) {
                     STORM_PRINT_AND_LOG("Exporting scheduler ... ")
                     if (input.model) {
                         STORM_LOG_WARN_COND(sparseModel->hasStateValuations(),
@@ -1136,8 +1353,13 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
                     }
                     STORM_LOG_WARN_COND(exportCount == 0,
                                         "Prepending " << exportCount << " to file name for this property because there are multiple properties.");
-                    storm::api::exportScheduler(sparseModel, scheduler,
-                                                (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportSchedulerFilename());
+                    std::string filename = (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportSchedulerFilename();
+                    if (quantitativeResult.hasPackedScheduler()) {
+                        // Avoid the conversion to the general representation
+                        storm::api::exportScheduler(sparseModel, quantitativeResult.getPackedScheduler(), filename);
+                    } else {
+                        storm::api::exportScheduler(sparseModel, quantitativeResult.getScheduler(), filename);
+                    }
                 } else {
                     STORM_LOG_ERROR("Scheduler requested but could not be generated.");
                 }
@@ -1150,8 +1372,8 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
                                 "No information of state valuations available. The result output will use internal state ids. You might be interested in "
                                 "building the model with state valuations using --buildstateval.");
             STORM_LOG_WARN_COND(exportCount == 0, "Prepending " << exportCount << " to file name for this property because there are multiple properties.");
-            storm::api::exportCheckResultToJson(sparseModel, result,
-                                                (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportCheckResultFilename());
+            storm::api::exportCheckResult(sparseModel, result,
+                                          (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportCheckResultFilename());
         }
         ++exportCount;
     };
@@ -1317,6 +1539,8 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Smc) {
+        verifyWithStatisticalEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
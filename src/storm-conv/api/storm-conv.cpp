@@ -14,10 +14,21 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace api {
 
+namespace {
+std::shared_ptr<storm::utility::solver::SmtSolverFactory> getSmtSolverFactory() {
+    if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return std::make_shared<storm::utility::solver::SmtSolverFactory>();
+    } else {
+        return std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    }
+}
+}  // namespace
+
 void transformJani(storm::jani::Model& janiModel, std::vector<storm::jani::Property>& properties, storm::converter::JaniConversionOptions const& options) {
     if (options.replaceUnassignedVariablesWithConstants) {
         janiModel.replaceUnassignedVariablesWithConstants();
@@ -65,13 +76,7 @@ void transformJani(storm::jani::Model& janiModel, std::vector<storm::jani::Prope
     }
 
     if (options.flatten) {
-        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
-        if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
-            smtSolverFactory = std::make_shared<storm::utility::solver::SmtSolverFactory>();
-        } else {
-            smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
-        }
-        janiModel = janiModel.flattenComposition(smtSolverFactory);
+        janiModel = janiModel.flattenComposition(getSmtSolverFactory());
     }
 
     if (!options.edgeAssignments) {
@@ -102,7 +107,7 @@ void transformPrism(storm::prism::Program& prismProgram, std::vector<storm::jani
         properties = storm::api::substituteConstantsInProperties(properties, prismProgram.getConstantsFormulasSubstitution());
     }
     if (flatten) {
-        prismProgram = prismProgram.flattenModules();
+        prismProgram = prismProgram.flattenModules(getSmtSolverFactory(), storm::utility::parallel::getDefaultNumberOfThreads());
         if (simplify) {
             // Let's simplify the flattened program again ... just to be sure ... twice ...
             prismProgram = prismProgram.simplify().simplify();
@@ -114,7 +119,19 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismTo
                                                                                      std::vector<storm::jani::Property> const& properties,
                                                                                      storm::converter::PrismToJaniConverterOptions options) {
     // Perform conversion
-    auto res = program.toJani(properties, options.allVariablesGlobal);
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> res;
+    bool flattenProgram = options.janiOptions.flatten && program.getNumberOfModules() > 1 && !program.specifiesSystemComposition() &&
+                          (program.getModelType() == storm::prism::Program::ModelType::DTMC || program.getModelType() == storm::prism::Program::ModelType::MDP);
+    // Transformations that refer to the individual automata need the unflattened model.
+    flattenProgram &= options.janiOptions.locationVariables.empty() && !options.janiOptions.locationElimination;
+    if (flattenProgram) {
+        // Flattening the modules of the program before the conversion avoids building the intermediate JANI automata. Moreover, the
+        // combinations of synchronizing commands are enumerated in parallel.
+        res = program.flattenModules(getSmtSolverFactory(), storm::utility::parallel::getDefaultNumberOfThreads())
+                  .toJani(properties, options.allVariablesGlobal);
+    } else {
+        res = program.toJani(properties, options.allVariablesGlobal);
+    }
     if (res.second.empty()) {
         std::vector<storm::jani::Property> clonedProperties;
         for (auto const& p : properties) {
@@ -5,6 +5,7 @@
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace settings {
@@ -20,6 +21,7 @@ const std::string ConversionGeneralSettings::debugOptionName = "debug";
 const std::string ConversionGeneralSettings::traceOptionName = "trace";
 const std::string ConversionGeneralSettings::configOptionName = "config";
 const std::string ConversionGeneralSettings::configOptionShortName = "c";
+const std::string ConversionGeneralSettings::threadsOptionName = "threads";
 
 ConversionGeneralSettings::ConversionGeneralSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -46,6 +48,12 @@ ConversionGeneralSettings::ConversionGeneralSettings() : ModuleSettings(moduleNa
                              .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                              .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads used by parallel conversions.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 uses all threads).")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ConversionGeneralSettings::isHelpSet() const {
@@ -80,8 +88,13 @@ std::string ConversionGeneralSettings::getConfigFilename() const {
     return this->getOption(configOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+uint64_t ConversionGeneralSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::parallel::getNumberOfHardwareThreads() : numberOfThreads;
+}
+
 void ConversionGeneralSettings::finalize() {
-    // Intentionally left empty.
+    storm::utility::parallel::setDefaultNumberOfThreads(getNumberOfThreads());
 }
 
 bool ConversionGeneralSettings::check() const {
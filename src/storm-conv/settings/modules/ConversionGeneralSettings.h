@@ -64,6 +64,14 @@ class ConversionGeneralSettings : public ModuleSettings {
      */
     std::string getConfigFilename() const;
 
+    /*!
+     * Retrieves the number of threads used by parallel conversions (e.g., flattening). A value of zero given by the user is resolved to
+     * the number of hardware threads.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -81,6 +89,7 @@ class ConversionGeneralSettings : public ModuleSettings {
     static const std::string traceOptionName;
     static const std::string configOptionName;
     static const std::string configOptionShortName;
+    static const std::string threadsOptionName;
 };
 }  // namespace modules
 }  // namespace settings
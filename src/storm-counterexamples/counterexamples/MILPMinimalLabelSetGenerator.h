@@ -24,6 +24,7 @@
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/JaniChoiceOrigins.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/solver.h"
 
@@ -535,14 +536,14 @@ class MILPMinimalLabelSetGenerator {
      * does not pick any outgoing action.
      *
      * @param solver The MILP solver.
-     * @param stateInformation The information about the states in the model.
+     * @param states The (relevant) states for which to assert the constraints.
      * @param variableInformation A struct with information about the variables of the model.
      * @return The total number of constraints that were created.
      */
-    static uint_fast64_t assertZeroProbabilityWithoutChoice(storm::solver::LpSolver<double>& solver, StateInformation const& stateInformation,
+    static uint_fast64_t assertZeroProbabilityWithoutChoice(storm::solver::LpSolver<double>& solver, storm::storage::BitVector const& states,
                                                             VariableInformation const& variableInformation) {
         uint_fast64_t numberOfConstraintsCreated = 0;
-        for (auto state : stateInformation.relevantStates) {
+        for (auto state : states) {
             storm::expressions::Expression constraint = variableInformation.stateToProbabilityVariableMap.at(state);
             for (auto const& choiceVariable : variableInformation.stateToChoiceVariablesMap.at(state)) {
                 constraint = constraint - choiceVariable;
@@ -555,21 +556,23 @@ class MILPMinimalLabelSetGenerator {
     }
 
     /*!
-     * Asserts constraints that encode the correct reachability probabilities for all states.
+     * Asserts constraints that encode the correct reachability probabilities for the given states.
      *
      * @param solver The MILP solver.
      * @param mdp The MDP.
      * @param psiStates A bit vector characterizing the psi states in the model.
+     * @param states The (relevant) states for which to assert the constraints.
      * @param stateInformation The information about the states in the model.
      * @param choiceInformation The information about the choices in the model.
      * @param variableInformation A struct with information about the variables of the model.
      * @return The total number of constraints that were created.
      */
     static uint_fast64_t assertReachabilityProbabilities(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
-                                                         storm::storage::BitVector const& psiStates, StateInformation const& stateInformation,
-                                                         ChoiceInformation const& choiceInformation, VariableInformation const& variableInformation) {
+                                                         storm::storage::BitVector const& psiStates, storm::storage::BitVector const& states,
+                                                         StateInformation const& stateInformation, ChoiceInformation const& choiceInformation,
+                                                         VariableInformation const& variableInformation) {
         uint_fast64_t numberOfConstraintsCreated = 0;
-        for (auto state : stateInformation.relevantStates) {
+        for (auto state : states) {
             std::list<storm::expressions::Variable>::const_iterator choiceVariableIterator = variableInformation.stateToChoiceVariablesMap.at(state).begin();
             for (auto choice : choiceInformation.relevantChoicesForRelevantStates.at(state)) {
                 storm::expressions::Expression constraint = variableInformation.stateToProbabilityVariableMap.at(state);
@@ -591,9 +594,19 @@ class MILPMinimalLabelSetGenerator {
                 ++choiceVariableIterator;
             }
         }
+        return numberOfConstraintsCreated;
+    }
 
-        // Make sure that the virtual initial state is being assigned the probability from the initial state
-        // that it selected as a successor state.
+    /*!
+     * Asserts constraints that make sure that the virtual initial state is being assigned the probability from the initial state
+     * that it selected as a successor state.
+     *
+     * @param solver The MILP solver.
+     * @param variableInformation A struct with information about the variables of the model.
+     * @return The total number of constraints that were created.
+     */
+    static uint_fast64_t assertVirtualInitialStateProbability(storm::solver::LpSolver<double>& solver, VariableInformation const& variableInformation) {
+        uint_fast64_t numberOfConstraintsCreated = 0;
         for (auto const& initialStateVariablePair : variableInformation.initialStateToChoiceVariableMap) {
             storm::expressions::Expression constraint = variableInformation.virtualInitialStateVariable -
                                                             variableInformation.stateToProbabilityVariableMap.at(initialStateVariablePair.first) +
@@ -607,35 +620,42 @@ class MILPMinimalLabelSetGenerator {
     }
 
     /*!
-     * Asserts constraints that make sure an unproblematic state is reachable from each problematic state.
+     * Retrieves the variable of the given choice of the given relevant state.
+     */
+    static storm::expressions::Variable const& getChoiceVariable(uint_fast64_t state, uint_fast64_t choice, ChoiceInformation const& choiceInformation,
+                                                                 VariableInformation const& variableInformation) {
+        std::list<storm::expressions::Variable>::const_iterator choiceVariableIterator = variableInformation.stateToChoiceVariablesMap.at(state).begin();
+        for (auto relevantChoice : choiceInformation.relevantChoicesForRelevantStates.at(state)) {
+            if (relevantChoice == choice) {
+                break;
+            }
+            ++choiceVariableIterator;
+        }
+        return *choiceVariableIterator;
+    }
+
+    /*!
+     * Asserts constraints that make sure an unproblematic state is reachable from each of the given problematic states.
      *
      * @param solver The MILP solver.
      * @param mdp The MDP.
+     * @param states The (relevant) states for which to assert the constraints. States that are not problematic are ignored.
      * @param stateInformation The information about the states in the model.
      * @param choiceInformation The information about the choices in the model.
      * @param variableInformation A struct with information about the variables of the model.
      * @return The total number of constraints that were created.
      */
     static uint_fast64_t assertUnproblematicStateReachable(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
-                                                           StateInformation const& stateInformation, ChoiceInformation const& choiceInformation,
-                                                           VariableInformation const& variableInformation) {
+                                                           storm::storage::BitVector const& states, StateInformation const& stateInformation,
+                                                           ChoiceInformation const& choiceInformation, VariableInformation const& variableInformation) {
         uint_fast64_t numberOfConstraintsCreated = 0;
+        storm::storage::BitVector problematicStates = stateInformation.problematicStates & states;
 
-        for (auto stateListPair : choiceInformation.problematicChoicesForProblematicStates) {
-            for (auto problematicChoice : stateListPair.second) {
-                std::list<storm::expressions::Variable>::const_iterator choiceVariableIterator =
-                    variableInformation.stateToChoiceVariablesMap.at(stateListPair.first).begin();
-                for (auto relevantChoice : choiceInformation.relevantChoicesForRelevantStates.at(stateListPair.first)) {
-                    if (relevantChoice == problematicChoice) {
-                        break;
-                    }
-                    ++choiceVariableIterator;
-                }
-
-                storm::expressions::Expression constraint = *choiceVariableIterator;
+        for (auto state : problematicStates) {
+            for (auto problematicChoice : choiceInformation.problematicChoicesForProblematicStates.at(state)) {
+                storm::expressions::Expression constraint = getChoiceVariable(state, problematicChoice, choiceInformation, variableInformation);
                 for (auto const& successorEntry : mdp.getTransitionMatrix().getRow(problematicChoice)) {
-                    constraint =
-                        constraint - variableInformation.problematicTransitionToVariableMap.at(std::make_pair(stateListPair.first, successorEntry.getColumn()));
+                    constraint = constraint - variableInformation.problematicTransitionToVariableMap.at(std::make_pair(state, successorEntry.getColumn()));
                 }
                 constraint = constraint <= solver.getConstant(0);
 
@@ -644,7 +664,7 @@ class MILPMinimalLabelSetGenerator {
             }
         }
 
-        for (auto state : stateInformation.problematicStates) {
+        for (auto state : problematicStates) {
             for (auto problematicChoice : choiceInformation.problematicChoicesForProblematicStates.at(state)) {
                 for (auto const& successorEntry : mdp.getTransitionMatrix().getRow(problematicChoice)) {
                     storm::expressions::Expression constraint = variableInformation.problematicStateToVariableMap.at(state);
@@ -842,6 +862,114 @@ class MILPMinimalLabelSetGenerator {
         return numberOfConstraintsCreated;
     }
 
+    /*!
+     * Asserts the constraints that concern the given states, i.e., the constraints asserted by assertZeroProbabilityWithoutChoice,
+     * assertReachabilityProbabilities and assertUnproblematicStateReachable.
+     *
+     * @param solver The MILP solver.
+     * @param mdp The MDP.
+     * @param psiStates A bit vector characterizing all psi states in the model.
+     * @param states The (relevant) states for which to assert the constraints.
+     * @param stateInformation The information about the states in the model.
+     * @param choiceInformation The information about the choices in the model.
+     * @param variableInformation A struct with information about the variables of the model.
+     * @return The total number of constraints that were created.
+     */
+    static uint_fast64_t assertStateConstraints(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
+                                                storm::storage::BitVector const& psiStates, storm::storage::BitVector const& states,
+                                                StateInformation const& stateInformation, ChoiceInformation const& choiceInformation,
+                                                VariableInformation const& variableInformation) {
+        // Add constraints that encode that the reachability probability from states which do not pick any action
+        // is zero.
+        uint_fast64_t numberOfConstraints = assertZeroProbabilityWithoutChoice(solver, states, variableInformation);
+
+        // Add constraints that encode the reachability probabilities for states.
+        numberOfConstraints += assertReachabilityProbabilities(solver, mdp, psiStates, states, stateInformation, choiceInformation, variableInformation);
+
+        // Add constraints that ensure the reachability of an unproblematic state from each problematic state.
+        numberOfConstraints += assertUnproblematicStateReachable(solver, mdp, states, stateInformation, choiceInformation, variableInformation);
+        return numberOfConstraints;
+    }
+
+    /*!
+     * Determines the given states for which the solution of the given optimized model violates a constraint asserted by
+     * assertStateConstraints.
+     *
+     * @param solver The MILP solver.
+     * @param mdp The MDP.
+     * @param psiStates A bit vector characterizing all psi states in the model.
+     * @param states The (relevant) states whose constraints to check.
+     * @param stateInformation The information about the states in the model.
+     * @param choiceInformation The information about the choices in the model.
+     * @param variableInformation A struct with information about the variables of the model.
+     * @return The states with a violated constraint.
+     */
+    static storm::storage::BitVector getStatesWithViolatedConstraints(storm::solver::LpSolver<double> const& solver, storm::models::sparse::Mdp<T> const& mdp,
+                                                                      storm::storage::BitVector const& psiStates, storm::storage::BitVector const& states,
+                                                                      StateInformation const& stateInformation, ChoiceInformation const& choiceInformation,
+                                                                      VariableInformation const& variableInformation) {
+        // The values of the solution are only precise up to the tolerances of the solver. Constraints that are violated by less than this
+        // tolerance are also violated (up to the tolerances) by the solutions of the full constraint system.
+        double const tolerance = 1e-6;
+        storm::storage::BitVector result(states.size(), false);
+        for (auto state : states) {
+            double probability = solver.getContinuousValue(variableInformation.stateToProbabilityVariableMap.at(state));
+            bool violated = false;
+            bool choiceTaken = false;
+            std::list<storm::expressions::Variable>::const_iterator choiceVariableIterator = variableInformation.stateToChoiceVariablesMap.at(state).begin();
+            for (auto choice : choiceInformation.relevantChoicesForRelevantStates.at(state)) {
+                bool currentChoiceTaken = solver.getBinaryValue(*choiceVariableIterator);
+                ++choiceVariableIterator;
+                choiceTaken |= currentChoiceTaken;
+                double leftHandSide = currentChoiceTaken ? probability + 1 : probability;
+                double rightHandSide = 1;
+                for (auto const& successorEntry : mdp.getTransitionMatrix().getRow(choice)) {
+                    if (stateInformation.relevantStates.get(successorEntry.getColumn())) {
+                        leftHandSide -= storm::utility::convertNumber<double>(successorEntry.getValue()) *
+                                        solver.getContinuousValue(variableInformation.stateToProbabilityVariableMap.at(successorEntry.getColumn()));
+                    } else if (psiStates.get(successorEntry.getColumn())) {
+                        rightHandSide += storm::utility::convertNumber<double>(successorEntry.getValue());
+                    }
+                }
+                if (leftHandSide > rightHandSide + tolerance) {
+                    violated = true;
+                    break;
+                }
+            }
+            if (!violated && !choiceTaken) {
+                violated = probability > tolerance;
+            }
+
+            if (!violated && stateInformation.problematicStates.get(state)) {
+                double problematicValue = solver.getContinuousValue(variableInformation.problematicStateToVariableMap.at(state));
+                for (auto problematicChoice : choiceInformation.problematicChoicesForProblematicStates.at(state)) {
+                    bool transitionTaken = false;
+                    for (auto const& successorEntry : mdp.getTransitionMatrix().getRow(problematicChoice)) {
+                        bool currentTransitionTaken =
+                            solver.getBinaryValue(variableInformation.problematicTransitionToVariableMap.at(std::make_pair(state, successorEntry.getColumn())));
+                        transitionTaken |= currentTransitionTaken;
+                        double leftHandSide =
+                            problematicValue - solver.getContinuousValue(variableInformation.problematicStateToVariableMap.at(successorEntry.getColumn()));
+                        if (currentTransitionTaken) {
+                            leftHandSide += 1;
+                        }
+                        // The constraint is strict, so we also consider it violated if it is only satisfied up to the tolerance.
+                        violated |= leftHandSide > 1 - tolerance;
+                    }
+                    violated |= !transitionTaken && solver.getBinaryValue(getChoiceVariable(state, problematicChoice, choiceInformation, variableInformation));
+                    if (violated) {
+                        break;
+                    }
+                }
+            }
+
+            if (violated) {
+                result.set(state);
+            }
+        }
+        return result;
+    }
+
     /*!
      * Builds a system of constraints that express that the reachability probability in the subsystem exceeeds
      * the given threshold.
@@ -852,6 +980,8 @@ class MILPMinimalLabelSetGenerator {
      * @param stateInformation The information about the states in the model.
      * @param choiceInformation The information about the choices in the model.
      * @param variableInformation A struct with information about the variables of the model.
+     * @param constrainedStates The (relevant) states whose constraints (see assertStateConstraints) are to be asserted. If this is
+     * not the set of all relevant states, the constraint system is a relaxation.
      * @param probabilityThreshold The probability threshold the subsystem is required to exceed.
      * @param strictBound A flag indicating whether the threshold must be exceeded or only matched.
      * @param includeSchedulerCuts If set to true, additional constraints are asserted that reduce the set of
@@ -860,8 +990,8 @@ class MILPMinimalLabelSetGenerator {
     static void buildConstraintSystem(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
                                       std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets, storm::storage::BitVector const& psiStates,
                                       StateInformation const& stateInformation, ChoiceInformation const& choiceInformation,
-                                      VariableInformation const& variableInformation, double probabilityThreshold, bool strictBound,
-                                      bool includeSchedulerCuts = false) {
+                                      VariableInformation const& variableInformation, storm::storage::BitVector const& constrainedStates,
+                                      double probabilityThreshold, bool strictBound, bool includeSchedulerCuts = false) {
         // Assert that the reachability probability in the subsystem exceeds the given threshold.
         uint_fast64_t numberOfConstraints = assertProbabilityGreaterThanThreshold(solver, variableInformation, probabilityThreshold, strictBound);
         STORM_LOG_DEBUG("Asserted that reachability probability exceeds threshold.");
@@ -874,18 +1004,14 @@ class MILPMinimalLabelSetGenerator {
         numberOfConstraints += assertChoicesImplyLabels(solver, mdp, labelSets, stateInformation, choiceInformation, variableInformation);
         STORM_LOG_DEBUG("Asserted that labels implied by choices are taken.");
 
-        // Add constraints that encode that the reachability probability from states which do not pick any action
-        // is zero.
-        numberOfConstraints += assertZeroProbabilityWithoutChoice(solver, stateInformation, variableInformation);
-        STORM_LOG_DEBUG("Asserted that reachability probability is zero if no choice is taken.");
+        // Add constraints that assign the probability of the selected initial state to the virtual initial state.
+        numberOfConstraints += assertVirtualInitialStateProbability(solver, variableInformation);
+        STORM_LOG_DEBUG("Asserted probability of virtual initial state.");
 
-        // Add constraints that encode the reachability probabilities for states.
-        numberOfConstraints += assertReachabilityProbabilities(solver, mdp, psiStates, stateInformation, choiceInformation, variableInformation);
-        STORM_LOG_DEBUG("Asserted constraints for reachability probabilities.");
-
-        // Add constraints that ensure the reachability of an unproblematic state from each problematic state.
-        numberOfConstraints += assertUnproblematicStateReachable(solver, mdp, stateInformation, choiceInformation, variableInformation);
-        STORM_LOG_DEBUG("Asserted that unproblematic state reachable from problematic states.");
+        // Add constraints that encode the reachability probabilities for states and ensure the reachability of an unproblematic state
+        // from each problematic state.
+        numberOfConstraints += assertStateConstraints(solver, mdp, psiStates, constrainedStates, stateInformation, choiceInformation, variableInformation);
+        STORM_LOG_DEBUG("Asserted constraints for reachability probabilities of " << constrainedStates.getNumberOfSetBits() << " states.");
 
         // Add constraints that express that certain labels are already known to be taken.
         numberOfConstraints += assertKnownLabels(solver, choiceInformation, variableInformation);
@@ -980,7 +1106,7 @@ class MILPMinimalLabelSetGenerator {
                                                                      std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
                                                                      storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                                      double probabilityThreshold, bool strictBound, bool checkThresholdFeasible = false,
-                                                                     bool includeSchedulerCuts = false) {
+                                                                     bool includeSchedulerCuts = false, bool useLazyConstraints = false) {
         // (0) Check whether the label sets are valid
         STORM_LOG_THROW(mdp.getNumberOfChoices() == labelSets.size(), storm::exceptions::InvalidArgumentException,
                         "The given number of labels does not match the number of choices.");
@@ -1016,12 +1142,34 @@ class MILPMinimalLabelSetGenerator {
         //  (4.1) Create variables.
         VariableInformation variableInformation = createVariables(*solver, mdp, stateInformation, choiceInformation);
 
-        //  (4.2) Construct constraint system.
-        buildConstraintSystem(*solver, mdp, labelSets, psiStates, stateInformation, choiceInformation, variableInformation, probabilityThreshold, strictBound,
-                              includeSchedulerCuts);
+        //  (4.2) Construct constraint system. With lazy constraints, we start with the constraints of the initial states. The
+        //  constraints of the other states are only added once the solution violates them.
+        storm::storage::BitVector constrainedStates = stateInformation.relevantStates;
+        if (useLazyConstraints) {
+            constrainedStates &= mdp.getInitialStates();
+        }
+        buildConstraintSystem(*solver, mdp, labelSets, psiStates, stateInformation, choiceInformation, variableInformation, constrainedStates,
+                              probabilityThreshold, strictBound, includeSchedulerCuts);
 
-        // (4.3) Optimize the model.
+        // (4.3) Optimize the model. The optimal solution of a relaxation that satisfies all constraints is also optimal for the full
+        // constraint system, so the label set is still minimal.
         solver->optimize();
+        while (useLazyConstraints && !solver->isInfeasible()) {
+            storm::storage::BitVector violatedStates =
+                getStatesWithViolatedConstraints(*solver, mdp, psiStates, stateInformation.relevantStates & ~constrainedStates, stateInformation,
+                                                 choiceInformation, variableInformation);
+            if (violatedStates.empty()) {
+                break;
+            }
+            uint_fast64_t numberOfConstraints =
+                assertStateConstraints(*solver, mdp, psiStates, violatedStates, stateInformation, choiceInformation, variableInformation);
+            constrainedStates |= violatedStates;
+            STORM_LOG_INFO("Added " << numberOfConstraints << " MILP constraints of " << violatedStates.getNumberOfSetBits()
+                                    << " states. Constraints of " << constrainedStates.getNumberOfSetBits() << " out of "
+                                    << stateInformation.relevantStates.getNumberOfSetBits() << " relevant states are asserted.");
+            solver->update();
+            solver->optimize();
+        }
 
         // (4.4) Read off result from variables.
         storm::storage::FlatSet<uint_fast64_t> usedLabelSet = getUsedLabelsInSolution(*solver, variableInformation);
@@ -1111,7 +1259,8 @@ class MILPMinimalLabelSetGenerator {
         auto startTime = std::chrono::high_resolution_clock::now();
         storm::storage::FlatSet<uint_fast64_t> usedLabelSet =
             getMinimalLabelSet(env, mdp, labelSets, phiStates, psiStates, threshold, strictBound, true,
-                               storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>().isUseSchedulerCutsSet());
+                               storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>().isUseSchedulerCutsSet(),
+                               storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>().isUseLazyConstraintsSet());
         auto endTime = std::chrono::high_resolution_clock::now();
         std::cout << "\nComputed minimal command set of size " << usedLabelSet.size() << " in "
                   << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() << "ms.\n";
@@ -15,7 +15,7 @@ void PathCounterexample<ValueType>::addPath(std::vector<storage::sparse::state_t
     if (k >= shortestPaths.size()) {
         shortestPaths.resize(k);
     }
-    shortestPaths[k - 1] = path;
+    shortestPaths[k - 1] = std::move(path);
 }
 
 template<typename ValueType>
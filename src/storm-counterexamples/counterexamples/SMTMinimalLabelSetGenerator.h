@@ -1577,44 +1577,51 @@ class SMTMinimalLabelSetGenerator {
 #endif
 
     /*!
-     * Returns the sub-model obtained from removing all choices that do not originate from the specified filterLabelSet.
+     * Returns the choices whose label sets are fully contained in the specified filterLabelSet.
+     */
+    static storm::storage::BitVector getChoicesOfLabelSet(std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
+                                                          storm::storage::FlatSet<uint_fast64_t> const& filterLabelSet) {
+        storm::storage::BitVector result(labelSets.size(), false);
+        for (uint_fast64_t choice = 0; choice < labelSets.size(); ++choice) {
+            if (std::includes(filterLabelSet.begin(), filterLabelSet.end(), labelSets[choice].begin(), labelSets[choice].end())) {
+                result.set(choice);
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Returns the sub-model obtained from removing all choices that are not selected. States without a selected choice get a self-loop (or a
+     * transition to the absorbState, if given). The sub-model is equipped with the given reward models.
      * Also returns the Labelsets of the sub-model.
      */
-    static std::pair<std::shared_ptr<storm::models::sparse::Model<T>>, std::vector<storm::storage::FlatSet<uint_fast64_t>>> restrictModelToLabelSet(
-        storm::models::sparse::Model<T> const& model, storm::storage::FlatSet<uint_fast64_t> const& filterLabelSet,
+    static std::pair<std::shared_ptr<storm::models::sparse::Model<T>>, std::vector<storm::storage::FlatSet<uint_fast64_t>>> restrictModelToChoices(
+        storm::models::sparse::Model<T> const& model, std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
+        storm::storage::BitVector const& choices, std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<T>> const& rewardModels,
         boost::optional<uint64_t> absorbState = boost::none) {
         bool customRowGrouping = model.isOfType(storm::models::ModelType::Mdp);
-        STORM_LOG_TRACE("Restrict model to label set " << storm::storage::toString(filterLabelSet));
         STORM_LOG_TRACE("Absorb state = " << (absorbState == boost::none ? "none" : std::to_string(absorbState.get())));
         std::vector<storm::storage::FlatSet<uint_fast64_t>> resultLabelSet;
         storm::storage::SparseMatrixBuilder<T> transitionMatrixBuilder(0, model.getTransitionMatrix().getColumnCount(), 0, true, customRowGrouping,
                                                                        model.getTransitionMatrix().getRowGroupCount());
 
-        // Check for each choice of each state, whether the choice commands are fully contained in the given command set.
         uint_fast64_t currentRow = 0;
         for (uint_fast64_t state = 0; state < model.getNumberOfStates(); ++state) {
             bool stateHasValidChoice = false;
-            for (uint_fast64_t choice = model.getTransitionMatrix().getRowGroupIndices()[state];
-                 choice < model.getTransitionMatrix().getRowGroupIndices()[state + 1]; ++choice) {
-                auto const& choiceLabelSet = model.getChoiceOrigins()->isPrismChoiceOrigins()
-                                                 ? model.getChoiceOrigins()->asPrismChoiceOrigins().getCommandSet(choice)
-                                                 : model.getChoiceOrigins()->asJaniChoiceOrigins().getEdgeIndexSet(choice);
-                bool choiceValid = std::includes(filterLabelSet.begin(), filterLabelSet.end(), choiceLabelSet.begin(), choiceLabelSet.end());
-
-                // If the choice is valid, copy over all its elements.
-                if (choiceValid) {
-                    STORM_LOG_TRACE("Choice " << choice << " has a valid label set " << storm::storage::toString(choiceLabelSet));
-
-                    if (!stateHasValidChoice && customRowGrouping) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-                    stateHasValidChoice = true;
-                    for (auto const& entry : model.getTransitionMatrix().getRow(choice)) {
-                        transitionMatrixBuilder.addNextValue(currentRow, entry.getColumn(), entry.getValue());
-                    }
-                    resultLabelSet.push_back(choiceLabelSet);
-                    ++currentRow;
+            for (uint_fast64_t choice = choices.getNextSetIndex(model.getTransitionMatrix().getRowGroupIndices()[state]);
+                 choice < model.getTransitionMatrix().getRowGroupIndices()[state + 1]; choice = choices.getNextSetIndex(choice + 1)) {
+                // The choice is valid, so copy over all its elements.
+                STORM_LOG_TRACE("Choice " << choice << " has a valid label set " << storm::storage::toString(labelSets[choice]));
+
+                if (!stateHasValidChoice && customRowGrouping) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
                 }
+                stateHasValidChoice = true;
+                for (auto const& entry : model.getTransitionMatrix().getRow(choice)) {
+                    transitionMatrixBuilder.addNextValue(currentRow, entry.getColumn(), entry.getValue());
+                }
+                resultLabelSet.push_back(labelSets[choice]);
+                ++currentRow;
             }
 
             // If no choice of the current state may be taken, we insert a self-loop to the state instead.
@@ -1632,16 +1639,32 @@ class SMTMinimalLabelSetGenerator {
 
         std::shared_ptr<storm::models::sparse::Model<T>> resultModel;
         if (model.isOfType(storm::models::ModelType::Dtmc)) {
-            resultModel = std::make_shared<storm::models::sparse::Dtmc<T>>(
-                transitionMatrixBuilder.build(), storm::models::sparse::StateLabeling(model.getStateLabeling()), model.getRewardModels());
+            resultModel = std::make_shared<storm::models::sparse::Dtmc<T>>(transitionMatrixBuilder.build(),
+                                                                           storm::models::sparse::StateLabeling(model.getStateLabeling()), rewardModels);
         } else {
-            resultModel = std::make_shared<storm::models::sparse::Mdp<T>>(
-                transitionMatrixBuilder.build(), storm::models::sparse::StateLabeling(model.getStateLabeling()), model.getRewardModels());
+            resultModel = std::make_shared<storm::models::sparse::Mdp<T>>(transitionMatrixBuilder.build(),
+                                                                          storm::models::sparse::StateLabeling(model.getStateLabeling()), rewardModels);
         }
 
         return std::make_pair(resultModel, std::move(resultLabelSet));
     }
 
+    /*!
+     * Returns the sub-model obtained from removing all choices that do not originate from the specified filterLabelSet.
+     * Also returns the Labelsets of the sub-model.
+     */
+    static std::pair<std::shared_ptr<storm::models::sparse::Model<T>>, std::vector<storm::storage::FlatSet<uint_fast64_t>>> restrictModelToLabelSet(
+        storm::models::sparse::Model<T> const& model, storm::storage::FlatSet<uint_fast64_t> const& filterLabelSet,
+        boost::optional<uint64_t> absorbState = boost::none) {
+        STORM_LOG_TRACE("Restrict model to label set " << storm::storage::toString(filterLabelSet));
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> labelSets(model.getNumberOfChoices());
+        for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
+            labelSets[choice] = model.getChoiceOrigins()->isPrismChoiceOrigins() ? model.getChoiceOrigins()->asPrismChoiceOrigins().getCommandSet(choice)
+                                                                                  : model.getChoiceOrigins()->asJaniChoiceOrigins().getEdgeIndexSet(choice);
+        }
+        return restrictModelToChoices(model, labelSets, getChoicesOfLabelSet(labelSets, filterLabelSet), model.getRewardModels(), absorbState);
+    }
+
     static std::vector<T> computeMaximalReachabilityProbability(Environment const& env, storm::models::sparse::Model<T> const& model,
                                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                                 boost::optional<std::vector<std::string>> const& rewardName) {
@@ -1851,6 +1874,18 @@ class SMTMinimalLabelSetGenerator {
         uint_fast64_t zeroProbabilityCount = 0;
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
+
+        // The sub-models only need the reward models that are checked. Different label sets often enable the same choices, so the
+        // sub-model (and its property values) of the previous iteration is reused whenever possible.
+        std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<T>> subModelRewardModels;
+        if (rewardName) {
+            for (auto const& rewName : rewardName.get()) {
+                subModelRewardModels.emplace(rewName, model.getRewardModel(rewName));
+            }
+        }
+        std::shared_ptr<storm::models::sparse::Model<T>> subModel;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> subLabelSets;
+        storm::storage::BitVector subModelChoices;
         do {
             ++iterations;
 
@@ -1890,12 +1925,19 @@ class SMTMinimalLabelSetGenerator {
                 break;
             }
 
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
+            storm::storage::BitVector choicesOfCommandSet = getChoicesOfLabelSet(labelSets, commandSet);
+            if (!subModel || choicesOfCommandSet != subModelChoices) {
+                auto subChoiceOrigins = restrictModelToChoices(model, labelSets, choicesOfCommandSet, subModelRewardModels,
+                                                               rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+                subModel = std::move(subChoiceOrigins.first);
+                subLabelSets = std::move(subChoiceOrigins.second);
+                subModelChoices = std::move(choicesOfCommandSet);
 
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+                // Now determine the maximal reachability probability in the sub-model.
+                maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+            } else {
+                STORM_LOG_DEBUG("Command set enables the same choices as the previously checked one.");
+            }
             totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
             // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
@@ -20,6 +20,7 @@ const std::string CounterexampleGeneratorSettings::shortestPathMaxKOptionName =
 const std::string CounterexampleGeneratorSettings::minimalCommandMethodOptionName = "mincmdmethod";
 const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
 const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
+const std::string CounterexampleGeneratorSettings::lazyConstraintsOptionName = "lazycons";
 const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
 
 CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
@@ -60,6 +61,11 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                                    "Sets whether to add the scheduler cuts for MILP-based counterexample generation.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, lazyConstraintsOptionName, true,
+                                                   "Sets whether to only add the constraints of states that are violated by the current solution for MILP-based "
+                                                   "counterexample generation.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, noDynamicConstraintsOptionName, true,
                                                    "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.")
                         .setIsAdvanced()
@@ -102,6 +108,10 @@ bool CounterexampleGeneratorSettings::isUseSchedulerCutsSet() const {
     return this->getOption(schedulerCutsOptionName).getHasOptionBeenSet();
 }
 
+bool CounterexampleGeneratorSettings::isUseLazyConstraintsSet() const {
+    return this->getOption(lazyConstraintsOptionName).getHasOptionBeenSet();
+}
+
 bool CounterexampleGeneratorSettings::isUseDynamicConstraintsSet() const {
     return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
 }
@@ -120,6 +130,8 @@ bool CounterexampleGeneratorSettings::check() const {
                             "Encoding reachability is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
         STORM_LOG_WARN_COND(isUseMilpBasedMinimalCommandSetGenerationSet() || !isUseSchedulerCutsSet(),
                             "Using scheduler cuts is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
+        STORM_LOG_WARN_COND(isUseMilpBasedMinimalCommandSetGenerationSet() || !isUseLazyConstraintsSet(),
+                            "Lazy constraints are only available for the MILP-based minimal command set generation, so selecting it has no effect.");
     }
 
     return true;
@@ -84,6 +84,14 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     bool isUseSchedulerCutsSet() const;
 
+    /*!
+     * Retrieves whether the constraints of the states are to be added lazily if the MILP-based technique is used to generate a
+     * minimal command set counterexample.
+     *
+     * @return True iff the constraints of the states are to be added lazily.
+     */
+    bool isUseLazyConstraintsSet() const;
+
     /*!
      * Retrieves whether to use the dynamic constraints in the MAXSAT-based technique.
      *
@@ -105,6 +113,7 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string minimalCommandMethodOptionName;
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
+    static const std::string lazyConstraintsOptionName;
     static const std::string noDynamicConstraintsOptionName;
 };
 
@@ -218,6 +218,35 @@ void processOptions() {
 
     // Analyze DFT
     dft = storm::dft::api::prepareForMarkovAnalysis<ValueType>(*dft);
+
+    // Statistical analysis
+    if (faultTreeSettings.isSimulate()) {
+        STORM_LOG_THROW(dftIOSettings.usePropTimebound() || dftIOSettings.usePropTimepoints(), storm::exceptions::UnmetRequirementException,
+                        "Simulation requires a timebound or timepoints.");
+        dft->setRelevantEvents(relevantEvents, faultTreeSettings.isAllowDCForRelevantEvents());
+        storm::dft::simulator::StatisticalCheckSettings simulationSettings;
+        simulationSettings.precision = faultTreeSettings.getSimulationPrecision();
+        simulationSettings.relativePrecision = faultTreeSettings.isSimulationPrecisionRelative();
+        simulationSettings.confidence = faultTreeSettings.getSimulationConfidence();
+        simulationSettings.maxNumberOfTraces = faultTreeSettings.getSimulationMaxTraces();
+        simulationSettings.numberOfThreads = faultTreeSettings.getSimulationThreads();
+        simulationSettings.seed = faultTreeSettings.getSimulationSeed();
+        simulationSettings.importanceSplitting = faultTreeSettings.isSimulationSplitting();
+
+        std::vector<double> timepoints;
+        if (dftIOSettings.usePropTimepoints()) {
+            timepoints = dftIOSettings.getPropTimepoints();
+        }
+        if (dftIOSettings.usePropTimebound()) {
+            timepoints.push_back(dftIOSettings.getPropTimebound());
+        }
+        for (double timepoint : timepoints) {
+            simulationSettings.timebound = timepoint;
+            storm::dft::api::analyzeDFTSimulation<ValueType>(*dft, simulationSettings, true);
+        }
+        return;
+    }
+
     // TODO allow building of state space even without properties
     if (props.empty()) {
         STORM_LOG_WARN("No property given. No analysis will be performed.");
@@ -34,7 +34,8 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
     }
 
     if (useModularisation && calculateProbability) {
-        storm::dft::modelchecker::DftModularizationChecker checker{dft};
+        storm::dft::modelchecker::DftModularizationChecker checker{
+            dft, storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getModularisationThreads()};
         if (chunksize == 1) {
             for (auto const& timebound : timepoints) {
                 auto const probability{checker.getProbabilityAtTimebound(timebound)};
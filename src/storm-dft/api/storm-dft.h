@@ -8,6 +8,7 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/parser/DFTGalileoParser.h"
 #include "storm-dft/parser/DFTJsonParser.h"
+#include "storm-dft/simulator/DFTStatisticalChecker.h"
 #include "storm-dft/transformations/DftToGspnTransformator.h"
 #include "storm-dft/transformations/DftTransformer.h"
 #include "storm-dft/utility/DftValidator.h"
@@ -193,6 +194,33 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analy
     return results;
 }
 
+/*!
+ * Estimate the probability that the DFT fails within a time bound by simulating failure traces.
+ * The traces are simulated in parallel and the simulation stops once the confidence interval is precise enough.
+ * The DFT must be prepared for Markovian analysis.
+ *
+ * @param dft DFT.
+ * @param settings Settings for the simulation, including time bound, precision and whether importance splitting is used.
+ * @param printOutput If true, the result is printed.
+ * @return Estimate and confidence interval.
+ */
+template<typename ValueType>
+storm::dft::simulator::StatisticalCheckResult analyzeDFTSimulation(storm::dft::storage::DFT<ValueType> const& dft,
+                                                                   storm::dft::simulator::StatisticalCheckSettings const& settings, bool printOutput = false) {
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft.buildStateGenerationInfo(symmetries));
+    storm::dft::simulator::DFTStatisticalChecker<ValueType> checker(dft, stateGenerationInfo);
+    storm::dft::simulator::StatisticalCheckResult result = checker.checkUnreliability(settings);
+    if (printOutput) {
+        std::cout << "Estimated probability of failure within time " << settings.timebound << ": " << result.estimate << '\n';
+        std::cout << settings.confidence * 100 << "% confidence interval: [" << result.lowerBound << ", " << result.upperBound << "] after "
+                  << result.numberOfTraces << " traces" << (result.precisionReached || settings.precision == 0.0 ? "" : " (desired precision not reached)")
+                  << '\n';
+    }
+    return result;
+}
+
 /*!
  * Analyze the DFT using BDDs
  *
@@ -13,6 +13,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
@@ -41,7 +42,8 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
       generator(dft, *stateGenerationInfo),
       matrixBuilder(!generator.isDeterministicModel()),
       stateStorage(dft.stateBitVectorSize()),
-      explorationQueue(1, 0, 0.9, false) {
+      explorationQueue(1, 0, 0.9, false),
+      numberOfExplorationThreads(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getExplorationThreads()) {
     // Set relevant events
     STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
     if (dft.getRelevantEvents().size() <= 1) {
@@ -107,6 +109,11 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
     }
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::setNumberOfExplorationThreads(uint64_t numberOfThreads) {
+    numberOfExplorationThreads = numberOfThreads;
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration, double approximationThreshold,
                                                                storm::dft::builder::ApproximationHeuristic approximationHeuristic) {
@@ -369,156 +376,269 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
     size_t nrSkippedStates = 0;
     storm::utility::ProgressMeasurement progress("explored states");
     progress.startNewMeasurement(0);
-    // TODO: do not empty queue every time but break before
+    uint64_t numberOfThreads = numberOfExplorationThreads;
+    if (numberOfThreads == 0) {
+        numberOfThreads = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
+    if (numberOfThreads > 1) {
+        exploreStateSpaceConcurrently(approximationThreshold, numberOfThreads, nrExpandedStates, nrSkippedStates, progress);
+    } else {
+        // TODO: do not empty queue every time but break before
+        while (!explorationQueue.empty()) {
+            // Get the first state in the queue
+            ExplorationHeuristicPointer currentExplorationHeuristic;
+            DFTStatePointer currentState = getNextStateToExplore(currentExplorationHeuristic);
+
+            // Remember that the current row group was actually filled with the transitions of a different state
+            matrixBuilder.setRemapping(currentState->getId());
+
+            matrixBuilder.newRowGroup();
+
+            // if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
+            if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
+                // Skip the current state
+                ++nrSkippedStates;
+                skipState(currentState, currentExplorationHeuristic);
+            } else {
+                // Explore the current state
+                ++nrExpandedStates;
+                generator.load(currentState);
+                storm::generator::StateBehavior<ValueType, StateType> behavior =
+                    generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
+                addBehavior(behavior, currentExplorationHeuristic);
+            }
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+            // Output number of currently explored states
+            if (nrExpandedStates % 100 == 0) {
+                progress.updateProgress(nrExpandedStates);
+            }
+        }  // end exploration
+    }
+
+    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
+    STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
+    STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpaceConcurrently(double approximationThreshold, uint64_t numberOfThreads,
+                                                                                  size_t& nrExpandedStates, size_t& nrSkippedStates,
+                                                                                  storm::utility::ProgressMeasurement& progress) {
+    // While a batch is expanded, the successor states get a temporary id that counts down from the largest representable id.
+    StateType const maximalStateId = std::numeric_limits<StateType>::max();
+
+    // For each state of a batch, we store its behavior as well as the successor states in the order in which the generator requested them.
+    struct ExpandedState {
+        DFTStatePointer state;
+        ExplorationHeuristicPointer heuristic;
+        bool skip = false;
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        std::vector<DFTStatePointer> successors;
+    };
+
+    // Every thread uses its own generator.
+    std::vector<storm::dft::generator::DftNextStateGenerator<ValueType, StateType>> generators(numberOfThreads, generator);
+    uint64_t const maximalBatchSize = 32 * numberOfThreads;
+    std::vector<ExpandedState> batch;
     while (!explorationQueue.empty()) {
-        // Get the first state in the queue
-        ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-        StateType currentId = currentExplorationHeuristic->getId();
-        auto itFind = statesNotExplored.find(currentId);
-        STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-        DFTStatePointer currentState = itFind->second.first;
-        STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-        STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
-        // Remove it from the list of not explored states
-        statesNotExplored.erase(itFind);
-        STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-        STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-        // Get concrete state if necessary
-        if (currentState->isPseudoState()) {
-            // Create concrete state from pseudo state
-            currentState->construct();
-        }
-        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-        // Remember that the current row group was actually filled with the transitions of a different state
-        matrixBuilder.setRemapping(currentId);
-
-        matrixBuilder.newRowGroup();
-
-        // Try to explore the next state
-        generator.load(currentState);
-
-        // if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
-        if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
-            // Skip the current state
-            ++nrSkippedStates;
-            STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
-            setMarkovian(true);
-            // Add transition to target state with temporary value 0
-            // TODO: what to do when there is no unique target state?
-            // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
-            matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-            // Remember skipped state
-            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
-            matrixBuilder.finishRow();
-        } else {
-            // Explore the current state
+        // Collect the states to expand next. For the depth heuristic, only states with the same depth are taken such that the states are
+        // explored in the same order as in the sequential exploration. For the other heuristics, the order is only kept approximately
+        // because the priorities are not updated while the batch is expanded.
+        batch.clear();
+        double const batchPriority = explorationQueue.top()->getPriority();
+        bool const relaxedOrder = usedHeuristic != storm::dft::builder::ApproximationHeuristic::DEPTH;
+        while (!explorationQueue.empty() && batch.size() < maximalBatchSize && (relaxedOrder || explorationQueue.top()->getPriority() == batchPriority)) {
+            ExpandedState expandedState;
+            expandedState.state = getNextStateToExplore(expandedState.heuristic);
+            expandedState.skip = approximationThreshold > 0.0 && expandedState.heuristic->isSkip(approximationThreshold);
+            batch.push_back(std::move(expandedState));
+        }
+
+        // Expand the states concurrently. The successor states are collected and only added to the state storage afterwards.
+        storm::utility::parallel::forEachChunk(numberOfThreads, batch.size(), 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            auto& threadGenerator = generators[threadIndex];
+            for (uint64_t index = begin; index < end; ++index) {
+                ExpandedState& expandedState = batch[index];
+                if (!expandedState.skip) {
+                    threadGenerator.load(expandedState.state);
+                    expandedState.behavior = threadGenerator.expand([&expandedState, maximalStateId](DFTStatePointer const& successor) {
+                        expandedState.successors.push_back(successor);
+                        return maximalStateId - static_cast<StateType>(expandedState.successors.size() - 1);
+                    });
+                }
+            }
+        });
+
+        // Add the states in the order in which they were taken from the queue.
+        for (auto& expandedState : batch) {
+            // Remember that the current row group was actually filled with the transitions of a different state
+            matrixBuilder.setRemapping(expandedState.state->getId());
+            matrixBuilder.newRowGroup();
+            if (expandedState.skip) {
+                ++nrSkippedStates;
+                skipState(expandedState.state, expandedState.heuristic);
+                continue;
+            }
             ++nrExpandedStates;
-            storm::generator::StateBehavior<ValueType, StateType> behavior =
-                generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-            setMarkovian(behavior.begin()->isMarkovian());
 
-            // Now add all choices.
-            for (auto const& choice : behavior) {
-                // Add the probabilistic behavior to the matrix.
+            // Obtain the actual ids of the successors (in the same order as the sequential exploration would do).
+            std::vector<StateType> successorIds;
+            successorIds.reserve(expandedState.successors.size());
+            for (auto const& successor : expandedState.successors) {
+                successorIds.push_back(getOrAddStateIndex(successor));
+            }
+            StateType const smallestTemporaryId = maximalStateId - static_cast<StateType>(expandedState.successors.size());
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            for (auto const& choice : expandedState.behavior) {
+                storm::generator::Choice<ValueType, StateType> remappedChoice(choice.getActionIndex(), choice.isMarkovian());
                 for (auto const& stateProbabilityPair : choice) {
-                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                    // Set heuristic values for reached states
-                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                    if (iter != statesNotExplored.end()) {
-                        // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
-                            // Initialize heuristic values
-                            ExplorationHeuristicPointer heuristic;
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    heuristic =
-                                        std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
-                            }
-                            if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                // Initialize bounds
-                                // TODO: avoid hack
-                                ValueType lowerBound = getLowerBound(state);
-                                ValueType upperBound = getUpperBound(state);
-                                heuristic->setBounds(lowerBound, upperBound);
-                            }
-
-                            explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
-                            bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
-                                                                                                 /* next values are irrelevant */ stateProbabilityPair.second,
-                                                                                                 stateProbabilityPair.second);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-                            if (changedPriority) {
-                                // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
-                            }
-                        }
-                    }
+                    StateType column = stateProbabilityPair.first;
+                    remappedChoice.addProbability(column > smallestTemporaryId ? successorIds[maximalStateId - column] : column, stateProbabilityPair.second);
                 }
-                matrixBuilder.finishRow();
+                behavior.addChoice(std::move(remappedChoice));
             }
+            behavior.setExpanded();
+            addBehavior(behavior, expandedState.heuristic);
         }
         if (storm::utility::resources::isTerminate()) {
             break;
         }
-        // Output number of currently explored states
-        if (nrExpandedStates % 100 == 0) {
-            progress.updateProgress(nrExpandedStates);
-        }
-    }  // end exploration
+        progress.updateProgress(nrExpandedStates);
+    }
+}
 
-    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
-    STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
-    STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
+template<typename ValueType, typename StateType>
+typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::getNextStateToExplore(
+    ExplorationHeuristicPointer& heuristic) {
+    heuristic = explorationQueue.pop();
+    StateType currentId = heuristic->getId();
+    auto itFind = statesNotExplored.find(currentId);
+    STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+    DFTStatePointer currentState = itFind->second.first;
+    STORM_LOG_ASSERT(heuristic == itFind->second.second, "Exploration heuristics do not match");
+    STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+    // Remove it from the list of not explored states
+    statesNotExplored.erase(itFind);
+    STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
+    STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
+
+    // Get concrete state if necessary
+    if (currentState->isPseudoState()) {
+        // Create concrete state from pseudo state
+        currentState->construct();
+    }
+    STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+    return currentState;
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::skipState(DFTStatePointer const& currentState,
+                                                              ExplorationHeuristicPointer const& currentExplorationHeuristic) {
+    STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
+    setMarkovian(true);
+    // Add transition to target state with temporary value 0
+    // TODO: what to do when there is no unique target state?
+    // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
+    matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
+    // Remember skipped state
+    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
+    matrixBuilder.finishRow();
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                                                                ExplorationHeuristicPointer const& currentExplorationHeuristic) {
+    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+    setMarkovian(behavior.begin()->isMarkovian());
+
+    // Now add all choices.
+    for (auto const& choice : behavior) {
+        // Add the probabilistic behavior to the matrix.
+        for (auto const& stateProbabilityPair : choice) {
+            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+            // Set heuristic values for reached states
+            auto iter = statesNotExplored.find(stateProbabilityPair.first);
+            if (iter != statesNotExplored.end()) {
+                // Update heuristic values
+                DFTStatePointer state = iter->second.first;
+                if (!iter->second.second) {
+                    // Initialize heuristic values
+                    ExplorationHeuristicPointer heuristic;
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            heuristic =
+                                std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+
+                    iter->second.second = heuristic;
+                    // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
+                    // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
+                    // !state->getFailableElements().hasBEs())) {
+                    if (state->getFailableElements().hasDependencies() ||
+                        (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                        // Do not skip absorbing state or if reached by dependencies
+                        iter->second.second->markExpand();
+                    }
+                    if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                        // Compute bounds for heuristic now
+                        if (state->isPseudoState()) {
+                            // Create concrete state from pseudo state
+                            state->construct();
+                        }
+                        STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
+
+                        // Initialize bounds
+                        // TODO: avoid hack
+                        ValueType lowerBound = getLowerBound(state);
+                        ValueType upperBound = getUpperBound(state);
+                        heuristic->setBounds(lowerBound, upperBound);
+                    }
+
+                    explorationQueue.push(heuristic);
+                } else if (!iter->second.second->isExpand()) {
+                    bool changedPriority = false;
+                    double oldPriority = iter->second.second->getPriority();
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
+                                                                                         /* next values are irrelevant */ stateProbabilityPair.second,
+                                                                                         stateProbabilityPair.second);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                                                                         choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                                                                         choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+                    if (changedPriority) {
+                        // Update priority queue
+                        explorationQueue.update(iter->second.second, oldPriority);
+                    }
+                }
+            }
+        }
+        matrixBuilder.finishRow();
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -691,6 +811,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder
     }
 }
 
+template<typename ValueType, typename StateType>
+bool ExplicitDFTModelBuilder<ValueType, StateType>::isDeterministicModel() const {
+    return modelComponents.deterministicModel;
+}
+
+template<typename ValueType, typename StateType>
+std::vector<uint_fast64_t> const& ExplicitDFTModelBuilder<ValueType, StateType>::getStateIdToModelStateMapping() const {
+    return matrixBuilder.stateRemapping;
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::createModel(bool copy) {
     std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
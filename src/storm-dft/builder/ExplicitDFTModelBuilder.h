@@ -11,6 +11,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateStorage.h"
+#include "storm/utility/ProgressMeasurement.h"
 
 #include "storm-dft/builder/DftExplorationHeuristic.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
@@ -155,6 +156,14 @@ class ExplicitDFTModelBuilder {
      */
     ExplicitDFTModelBuilder(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTIndependentSymmetries const& symmetries);
 
+    /*!
+     * Set the number of threads used to expand states during the state space exploration.
+     * By default, the number of threads is taken from the settings.
+     *
+     * @param numberOfThreads The number of threads, 0 for all cores.
+     */
+    void setNumberOfExplorationThreads(uint64_t numberOfThreads);
+
     /*!
      * Build model from DFT.
      *
@@ -182,6 +191,22 @@ class ExplicitDFTModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType>> getModelApproximation(bool lowerBound, bool expectedTime);
 
+    /*!
+     * Check whether the built model is deterministic, i.e., a CTMC.
+     *
+     * @return True, iff the model is deterministic.
+     */
+    bool isDeterministicModel() const;
+
+    /*!
+     * Get the mapping from the ids of the explored DFT states to the states of the built model.
+     * The ids are kept across refinement iterations which allows to relate the states of the approximation models of consecutive iterations.
+     * The mapping only refers to the approximation models if the model is deterministic, as otherwise non-Markovian states might be eliminated.
+     *
+     * @return Vector containing the index of the model state for each state id.
+     */
+    std::vector<uint_fast64_t> const& getStateIdToModelStateMapping() const;
+
    private:
     /*!
      * Explore state space of DFT.
@@ -190,6 +215,45 @@ class ExplicitDFTModelBuilder {
      */
     void exploreStateSpace(double approximationThreshold);
 
+    /*!
+     * Explore state space of DFT with several threads.
+     * The states are taken from the exploration queue in batches. The states of a batch are expanded concurrently and afterwards added
+     * to the model sequentially in the order in which they were taken from the queue.
+     *
+     * @param approximationThreshold Threshold to determine when to skip states.
+     * @param numberOfThreads Number of threads.
+     * @param nrExpandedStates Counter for the expanded states.
+     * @param nrSkippedStates Counter for the skipped states.
+     * @param progress Measurement of the exploration progress.
+     */
+    void exploreStateSpaceConcurrently(double approximationThreshold, uint64_t numberOfThreads, size_t& nrExpandedStates, size_t& nrSkippedStates,
+                                       storm::utility::ProgressMeasurement& progress);
+
+    /*!
+     * Remove the next state from the exploration queue and construct it (if it is a pseudo state).
+     *
+     * @param heuristic Is set to the heuristic of the state.
+     *
+     * @return The state to explore next.
+     */
+    DFTStatePointer getNextStateToExplore(ExplorationHeuristicPointer& heuristic);
+
+    /*!
+     * Add the current state as skipped state, i.e., without expanding it.
+     *
+     * @param currentState The state.
+     * @param currentExplorationHeuristic The heuristic of the state.
+     */
+    void skipState(DFTStatePointer const& currentState, ExplorationHeuristicPointer const& currentExplorationHeuristic);
+
+    /*!
+     * Add the behavior of the current state to the matrix and update the heuristic values of its successors.
+     *
+     * @param behavior The behavior of the state.
+     * @param currentExplorationHeuristic The heuristic of the state.
+     */
+    void addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristicPointer const& currentExplorationHeuristic);
+
     /*!
      * Initialize the matrix for a refinement iteration.
      */
@@ -325,6 +389,9 @@ class ExplicitDFTModelBuilder {
 
     // List of independent subtrees and the BEs contained in them.
     std::vector<std::vector<size_t>> subtreeBEs;
+
+    // The number of threads used to expand states (0 for all cores).
+    uint64_t numberOfExplorationThreads;
 };
 
 }  // namespace builder
@@ -17,6 +17,17 @@ DftNextStateGenerator<ValueType, StateType>::DftNextStateGenerator(storm::dft::s
     mTakeFirstDependency = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isTakeFirstDependency();
 }
 
+template<typename ValueType, typename StateType>
+DftNextStateGenerator<ValueType, StateType>::DftNextStateGenerator(DftNextStateGenerator const& other)
+    : mDft(other.mDft),
+      mStateGenerationInfo(other.mStateGenerationInfo),
+      state(nullptr),
+      uniqueFailedState(other.uniqueFailedState),
+      deterministicModel(other.deterministicModel),
+      mTakeFirstDependency(other.mTakeFirstDependency) {
+    // Intentionally left empty.
+}
+
 template<typename ValueType, typename StateType>
 bool DftNextStateGenerator<ValueType, StateType>::isDeterministicModel() const {
     return deterministicModel;
@@ -228,10 +239,10 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
 
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
-    DFTStatePointer const state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
+    DFTStatePointer const& state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
     std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful) const {
     // Construct new state as copy from original one
-    DFTStatePointer newState = state->copy();
+    DFTStatePointer newState = copyState(state);
 
     if (!dependencySuccessful) {
         // Dependency was unsuccessful -> no BE fails
@@ -282,7 +293,25 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
 }
 
 template<typename ValueType, typename StateType>
-void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer newState,
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::copyState(
+    DFTStatePointer const& state) const {
+    for (auto it = reusableStates.begin(); it != reusableStates.end();) {
+        if (it->use_count() == 1) {
+            // The state is only referenced by the pool and can be overwritten.
+            (*it)->assign(*state);
+            return *it;
+        } else {
+            // The state is (potentially) still in use, e.g., because it was stored as a new state. Hence, it is not available anymore.
+            it = reusableStates.erase(it);
+        }
+    }
+    DFTStatePointer newState = state->copy();
+    reusableStates.push_back(newState);
+    return newState;
+}
+
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer const& newState,
                                                                    std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
                                                                    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     // Propagate failure
@@ -313,7 +342,7 @@ void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePoint
 }
 
 template<typename ValueType, typename StateType>
-void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer newState,
+void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer const& newState,
                                                                     std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
                                                                     storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     // Propagate failsafe
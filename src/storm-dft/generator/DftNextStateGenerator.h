@@ -25,6 +25,12 @@ class DftNextStateGenerator {
 
     DftNextStateGenerator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo);
 
+    /*!
+     * Create a copy of the given generator.
+     * The copy does not share any states with the given generator such that both generators can be used concurrently.
+     */
+    DftNextStateGenerator(DftNextStateGenerator const& other);
+
     bool isDeterministicModel() const;
     std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback);
 
@@ -65,17 +71,28 @@ class DftNextStateGenerator {
      *
      * @return Successor state.
      */
-    DFTStatePointer createSuccessorState(DFTStatePointer const state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
+    DFTStatePointer createSuccessorState(DFTStatePointer const& state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
                                          std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>& triggeringDependency,
                                          bool dependencySuccessful = true) const;
 
+    /*!
+     * Create a copy of the given state.
+     * The copy is taken from a pool of states which are not used anymore (i.e., which are neither stored by the model builder nor by the caller)
+     * such that no memory has to be allocated for the successors which turn out to be already known.
+     *
+     * @param state State to copy.
+     *
+     * @return Copy of the state.
+     */
+    DFTStatePointer copyState(DFTStatePointer const& state) const;
+
     /**
      * Propagate the failures in a given state if the given BE fails
      *
      * @param newState starting state of the propagation
      * @param nextBE BE whose failure is propagated
      */
-    void propagateFailure(DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+    void propagateFailure(DFTStatePointer const& newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
                           storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
 
     /**
@@ -84,7 +101,7 @@ class DftNextStateGenerator {
      * @param newState starting state of the propagation
      * @param nextBE BE whose failure is propagated
      */
-    void propagateFailsafe(DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+    void propagateFailsafe(DFTStatePointer const& newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
                            storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
 
    private:
@@ -108,6 +125,9 @@ class DftNextStateGenerator {
     // Current state
     DFTStatePointer state;
 
+    // States which were created as successors. They can be reused as soon as they are not referenced elsewhere anymore.
+    mutable std::vector<DFTStatePointer> reusableStates;
+
     // Flag indicating whether all failed states should be merged into one unique failed state.
     bool uniqueFailedState;
 
@@ -3,6 +3,7 @@
 #include "storm/builder/ParallelCompositionBuilder.h"
 #include "storm/exceptions/InvalidModelException.h"
 #include "storm/io/DirectEncodingExporter.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/ModelType.h"
@@ -323,6 +324,11 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
         bool probabilityFormula = property->isProbabilityOperatorFormula();
         STORM_LOG_ASSERT((property->isTimeOperatorFormula() && !probabilityFormula) || (!property->isTimeOperatorFormula() && probabilityFormula),
                          "Probability formula not initialized correctly");
+        // The values of the previous iteration are used as initial guesses for the next iteration.
+        // This requires that the states of the checked models correspond to the explored states, which is not the case after bisimulation.
+        bool reuseValues = !storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet();
+        std::vector<ValueType> lowerBoundValues;
+        std::vector<ValueType> upperBoundValues;
         size_t iteration = 0;
         do {
             // Iteratively build finer models
@@ -330,9 +336,9 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
                 explorationTimer.start();
             }
             STORM_LOG_DEBUG("Building model...");
-            // TODO refine model using existing model and MC results
             builder.buildModel(iteration, approximationError, approximationHeuristic);
             explorationTimer.stop();
+            reuseValues &= builder.isDeterministicModel();
             buildingTimer.start();
 
             // TODO: possible to do bisimulation on approximated model and not on concrete one?
@@ -355,7 +361,11 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
             }
 
             // Check lower bounds
-            newResult = checkModel(model, {property});
+            if (reuseValues) {
+                newResult = {checkModelApproximation(model, property, builder.getStateIdToModelStateMapping(), lowerBoundValues)};
+            } else {
+                newResult = checkModel(model, {property});
+            }
             STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
             STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first),
                              "New under-approximation " << newResult[0] << " is smaller than old result " << approxResult.first);
@@ -367,7 +377,11 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
             model = builder.getModelApproximation(false, !probabilityFormula);
             buildingTimer.stop();
             // Check upper bound
-            newResult = checkModel(model, {property});
+            if (reuseValues) {
+                newResult = {checkModelApproximation(model, property, builder.getStateIdToModelStateMapping(), upperBoundValues)};
+            } else {
+                newResult = checkModel(model, {property});
+            }
             STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
             STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult[0]),
                              "New over-approximation " << newResult[0] << " is greater than old result " << approxResult.second);
@@ -485,6 +499,46 @@ std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<st
     return results;
 }
 
+template<typename ValueType>
+ValueType DFTModelChecker<ValueType>::checkModelApproximation(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                              std::shared_ptr<const storm::logic::Formula> const& property,
+                                                              std::vector<uint_fast64_t> const& stateMapping, std::vector<ValueType>& previousValues) {
+    STORM_LOG_ASSERT(model->getNumberOfStates() == stateMapping.size(), "State mapping does not match the model.");
+    STORM_LOG_DEBUG("Model checking...");
+    modelCheckingTimer.start();
+    auto task = storm::api::createTask<ValueType>(property, true);
+    if (!previousValues.empty()) {
+        // Newly explored states get the default initial guess of the solver.
+        ValueType defaultValue = property->isProbabilityOperatorFormula() ? storm::utility::convertNumber<ValueType>(0.5) : storm::utility::one<ValueType>();
+        std::vector<ValueType> resultHint(model->getNumberOfStates(), defaultValue);
+        // State ids are never removed, so all previous states are still present in the model.
+        for (uint64_t id = 0; id < previousValues.size(); ++id) {
+            if (!storm::utility::isInfinity(previousValues[id])) {
+                resultHint[stateMapping[id]] = previousValues[id];
+            }
+        }
+        auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+        hint->setResultHint(std::move(resultHint));
+        task.setHint(hint);
+    }
+
+    ValueType resultValue = -storm::utility::one<ValueType>();
+    std::unique_ptr<storm::modelchecker::CheckResult> result(storm::api::verifyWithSparseEngine<ValueType>(model, task));
+    if (result) {
+        auto const& values = result->asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+        previousValues.resize(stateMapping.size());
+        for (uint64_t id = 0; id < stateMapping.size(); ++id) {
+            previousValues[id] = values[stateMapping[id]];
+        }
+        resultValue = values[*model->getInitialStates().begin()];
+    } else {
+        STORM_LOG_WARN("The property '" << *property << "' could not be checked with the current settings.");
+    }
+    modelCheckingTimer.stop();
+    STORM_LOG_DEBUG("Model checking done.");
+    return resultValue;
+}
+
 template<typename ValueType>
 bool DFTModelChecker<ValueType>::isApproximationSufficient(ValueType, ValueType, double, bool) {
     STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Approximation works only for double.");
@@ -152,6 +152,21 @@ class DFTModelChecker {
      */
     std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
+    /*!
+     * Check the given approximation model for the given property.
+     * The values computed in the previous refinement iteration serve as initial guess for the solver.
+     *
+     * @param model          Approximation model to check
+     * @param property       Property to check for
+     * @param stateMapping   Mapping from the ids of the DFT states to the states of the model
+     * @param previousValues Values of the previous iteration indexed by the ids of the DFT states. Is updated with the values for the model.
+     *
+     * @return Model checking result for the initial state
+     */
+    ValueType checkModelApproximation(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                      std::shared_ptr<const storm::logic::Formula> const& property, std::vector<uint_fast64_t> const& stateMapping,
+                                      std::vector<ValueType>& previousValues);
+
     /*!
      * Checks if the computed approximation is sufficient, i.e.
      * upperBound - lowerBound <= approximationError * mean(lowerBound, upperBound).
@@ -1,5 +1,8 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+#include <functional>
 #include <sstream>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
@@ -12,13 +15,69 @@
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
+namespace {
+
+/*!
+ * Check whether two BEs have the same failure distribution.
+ */
 template<typename ValueType>
-DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()}, modelchecker(true) {
+bool haveEqualDistribution(storm::dft::storage::elements::DFTBE<ValueType> const& first, storm::dft::storage::elements::DFTBE<ValueType> const& second) {
+    using namespace storm::dft::storage::elements;
+    if (first.beType() != second.beType()) {
+        return false;
+    }
+    switch (first.beType()) {
+        case BEType::CONSTANT:
+            return static_cast<BEConst<ValueType> const&>(first).failed() == static_cast<BEConst<ValueType> const&>(second).failed();
+        case BEType::PROBABILITY: {
+            auto const& firstBE = static_cast<BEProbability<ValueType> const&>(first);
+            auto const& secondBE = static_cast<BEProbability<ValueType> const&>(second);
+            return firstBE.activeFailureProbability() == secondBE.activeFailureProbability() &&
+                   firstBE.passiveFailureProbability() == secondBE.passiveFailureProbability();
+        }
+        case BEType::EXPONENTIAL: {
+            auto const& firstBE = static_cast<BEExponential<ValueType> const&>(first);
+            auto const& secondBE = static_cast<BEExponential<ValueType> const&>(second);
+            return firstBE.activeFailureRate() == secondBE.activeFailureRate() && firstBE.passiveFailureRate() == secondBE.passiveFailureRate() &&
+                   firstBE.isTransient() == secondBE.isTransient();
+        }
+        case BEType::ERLANG: {
+            auto const& firstBE = static_cast<BEErlang<ValueType> const&>(first);
+            auto const& secondBE = static_cast<BEErlang<ValueType> const&>(second);
+            return firstBE.activeFailureRate() == secondBE.activeFailureRate() && firstBE.passiveFailureRate() == secondBE.passiveFailureRate() &&
+                   firstBE.phases() == secondBE.phases();
+        }
+        case BEType::WEIBULL: {
+            auto const& firstBE = static_cast<BEWeibull<ValueType> const&>(first);
+            auto const& secondBE = static_cast<BEWeibull<ValueType> const&>(second);
+            return firstBE.shape() == secondBE.shape() && firstBE.rate() == secondBE.rate();
+        }
+        case BEType::LOGNORMAL: {
+            auto const& firstBE = static_cast<BELogNormal<ValueType> const&>(first);
+            auto const& secondBE = static_cast<BELogNormal<ValueType> const&>(second);
+            return firstBE.mean() == secondBE.mean() && firstBE.standardDeviation() == secondBE.standardDeviation();
+        }
+        case BEType::SAMPLES:
+            return static_cast<BESamples<ValueType> const&>(first).activeSamples() == static_cast<BESamples<ValueType> const&>(second).activeSamples();
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+template<typename ValueType>
+DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, uint64_t numberOfThreads)
+    : dft{dft}, numberOfThreads{numberOfThreads}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+    if (this->numberOfThreads == 0) {
+        this->numberOfThreads = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
+
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +85,10 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    for (auto const& module : dynamicModules) {
+        addToModuleClass(module);
+    }
+    STORM_LOG_DEBUG("Found " << dynamicModules.size() << " dynamic modules with " << dynamicModuleClasses.size() << " different structures.");
 }
 
 template<typename ValueType>
@@ -41,6 +104,103 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::addToModuleClass(storm::dft::storage::DftIndependentModule const& module) {
+    STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
+    STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
+
+    DynamicModuleClass newClass;
+    newClass.subtree = std::make_shared<storm::dft::storage::DFT<ValueType>>(module.getSubtree(*dft));
+    computeCanonicalStructure(newClass);
+    for (auto& moduleClass : dynamicModuleClasses) {
+        if (moduleClass.hash == newClass.hash && haveIdenticalStructure(moduleClass, newClass)) {
+            STORM_LOG_DEBUG("Dynamic module " << dft->getElement(module.getRepresentative())->name() << " is identical to module "
+                                              << dft->getElement(moduleClass.representatives.front())->name() << ".");
+            moduleClass.representatives.push_back(module.getRepresentative());
+            return;
+        }
+    }
+    newClass.representatives.push_back(module.getRepresentative());
+    dynamicModuleClasses.push_back(std::move(newClass));
+}
+
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::computeCanonicalStructure(DynamicModuleClass& moduleClass) const {
+    auto const& subtree = *moduleClass.subtree;
+    std::map<size_t, size_t> canonicalIndex;
+
+    // Number the elements in the order of a depth-first search. Elements which are not reachable from the top level element (such as dependencies
+    // and restrictions) are visited in the order of their ids afterwards.
+    std::function<size_t(size_t)> visit = [&](size_t id) -> size_t {
+        auto it = canonicalIndex.find(id);
+        if (it != canonicalIndex.end()) {
+            return it->second;
+        }
+        size_t index = moduleClass.canonicalOrder.size();
+        canonicalIndex.emplace(id, index);
+        moduleClass.canonicalOrder.push_back(id);
+        moduleClass.canonicalChildren.emplace_back();
+
+        std::vector<size_t> childIds;
+        auto const element = subtree.getElement(id);
+        if (element->isGate()) {
+            for (auto const& child : subtree.getGate(id)->children()) {
+                childIds.push_back(child->id());
+            }
+        } else if (element->isDependency()) {
+            auto const dependency = subtree.getDependency(id);
+            childIds.push_back(dependency->triggerEvent()->id());
+            for (auto const& dependentEvent : dependency->dependentEvents()) {
+                childIds.push_back(dependentEvent->id());
+            }
+        } else if (element->isRestriction()) {
+            for (auto const& child : subtree.getRestriction(id)->children()) {
+                childIds.push_back(child->id());
+            }
+        }
+        for (size_t childId : childIds) {
+            size_t childIndex = visit(childId);
+            moduleClass.canonicalChildren[index].push_back(childIndex);
+        }
+        return index;
+    };
+    visit(subtree.getTopLevelIndex());
+    for (size_t id : subtree.getAllIds()) {
+        visit(id);
+    }
+
+    // The hash only considers the types and the structure. Parameters are compared in haveIdenticalStructure().
+    moduleClass.hash = 0;
+    for (size_t index = 0; index < moduleClass.canonicalOrder.size(); ++index) {
+        auto const element = subtree.getElement(moduleClass.canonicalOrder[index]);
+        boost::hash_combine(moduleClass.hash, element->typestring());
+        boost::hash_combine(moduleClass.hash, moduleClass.canonicalChildren[index]);
+    }
+}
+
+template<typename ValueType>
+bool DftModularizationChecker<ValueType>::haveIdenticalStructure(DynamicModuleClass const& first, DynamicModuleClass const& second) const {
+    if (first.canonicalOrder.size() != second.canonicalOrder.size() || first.canonicalChildren != second.canonicalChildren) {
+        return false;
+    }
+    for (size_t index = 0; index < first.canonicalOrder.size(); ++index) {
+        size_t firstId = first.canonicalOrder[index];
+        size_t secondId = second.canonicalOrder[index];
+        auto const firstElement = first.subtree->getElement(firstId);
+        auto const secondElement = second.subtree->getElement(secondId);
+        if (!firstElement->isTypeEqualTo(*secondElement) || firstElement->typestring() != secondElement->typestring()) {
+            return false;
+        }
+        if (firstElement->isBasicElement() && !haveEqualDistribution(*first.subtree->getBasicElement(firstId), *second.subtree->getBasicElement(secondId))) {
+            return false;
+        }
+        if (firstElement->isDependency() && first.subtree->isDependencyInConflict(firstId) != second.subtree->isDependencyInConflict(secondId)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -66,21 +226,55 @@ std::vector<ValueType> DftModularizationChecker<ValueType>::getProbabilitiesAtTi
 
 template<typename ValueType>
 std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<ValueType>::replaceDynamicModules(std::vector<ValueType> const& timepoints) {
+    // Gather the module classes for which some time points were not analysed before
+    std::vector<std::pair<DynamicModuleClass*, std::vector<ValueType>>> tasks;
+    std::vector<FormulaVector> taskProperties;
+    for (auto& moduleClass : dynamicModuleClasses) {
+        std::vector<ValueType> missingTimepoints;
+        for (auto const& timebound : timepoints) {
+            if (moduleClass.probabilities.find(timebound) == moduleClass.probabilities.end() &&
+                std::find(missingTimepoints.begin(), missingTimepoints.end(), timebound) == missingTimepoints.end()) {
+                missingTimepoints.push_back(timebound);
+            }
+        }
+        if (!missingTimepoints.empty()) {
+            tasks.emplace_back(&moduleClass, std::move(missingTimepoints));
+        }
+    }
+
+    // Analyse the largest modules first such that they do not delay the end of the analysis and the big state spaces are built while the other
+    // threads only work on small modules.
+    std::stable_sort(tasks.begin(), tasks.end(), [](auto const& first, auto const& second) {
+        return first.first->subtree->nrElements() > second.first->subtree->nrElements();
+    });
+
+    // Create properties
+    for (auto const& task : tasks) {
+        std::stringstream propertyStream{};
+        for (auto const timebound : task.second) {
+            propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+        }
+        taskProperties.push_back(storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str())));
+    }
+
+    bool const printOutput = numberOfThreads <= 1;
+    storm::utility::parallel::forEachChunk(numberOfThreads, tasks.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t task = begin; task < end; ++task) {
+            analyseDynamicModule(*tasks[task].first, tasks[task].second, taskProperties[task], printOutput);
+        }
+    });
+
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
-
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    for (auto const& moduleClass : dynamicModuleClasses) {
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
-            activeSamples[timebound] = probability;
+        for (auto const& timebound : timepoints) {
+            activeSamples[timebound] = moduleClass.probabilities.at(timebound);
+        }
+        for (size_t representative : moduleClass.representatives) {
+            samplePoints.insert({representative, activeSamples});
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -122,21 +316,17 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 }
 
 template<typename ValueType>
-typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
-    STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
-    STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
-
-    auto subDft = module.getSubtree(*dft);
+void DftModularizationChecker<ValueType>::analyseDynamicModule(DynamicModuleClass& moduleClass, std::vector<ValueType> const& timepoints,
+                                                               FormulaVector const& properties, bool printOutput) const {
+    STORM_LOG_DEBUG("Analyse dynamic module " << moduleClass.subtree->getTopLevelElement()->name() << " representing " << moduleClass.representatives.size()
+                                              << " module(s).");
 
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    // Each analysis uses its own model checker such that modules can be analysed concurrently.
+    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker(printOutput);
+    auto result = modelchecker.check(*moduleClass.subtree, properties, false, false, {});
+    for (size_t i{0}; i < timepoints.size(); ++i) {
+        moduleClass.probabilities[timepoints[i]] = boost::get<ValueType>(result[i]);
     }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
 }
 
 // Explicitly instantiate the class.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -16,6 +17,8 @@ namespace modelchecker {
  * DFT analysis via modularization.
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
+ * Dynamic modules with identical structure (up to the names of the elements) are analyzed only once. The analyses of the remaining modules are
+ * independent and are performed concurrently, starting with the largest modules. Computed module probabilities are reused for later queries.
  *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
@@ -28,8 +31,9 @@ class DftModularizationChecker {
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
+     * @param numberOfThreads Number of threads used to analyse the dynamic modules. Value 0 uses all hardware threads.
      */
-    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft);
+    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, uint64_t numberOfThreads = 1);
 
     /*!
      * Calculate the properties specified by the formulas.
@@ -59,12 +63,48 @@ class DftModularizationChecker {
     }
 
    private:
+    /*!
+     * A class of structurally identical dynamic modules.
+     */
+    struct DynamicModuleClass {
+        // Representatives of all modules in this class.
+        std::vector<size_t> representatives;
+        // Subtree of the first module in this class.
+        std::shared_ptr<storm::dft::storage::DFT<ValueType>> subtree;
+        // Elements of the subtree in canonical order, i.e., in the order of a depth-first search from the top level element.
+        std::vector<size_t> canonicalOrder;
+        // For each element in canonical order, the positions of its children (or trigger and dependent events) in the canonical order.
+        std::vector<std::vector<size_t>> canonicalChildren;
+        // Hash value of the canonical structure.
+        size_t hash;
+        // Failure probabilities of the module computed so far.
+        std::map<ValueType, ValueType> probabilities;
+    };
+
     /*!
      * Recursively populate the list of dynamic modules.
      * @param module Current module to consider.
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Add the given dynamic module to the class of structurally identical modules or create a new class for it.
+     * @param module Dynamic module.
+     */
+    void addToModuleClass(storm::dft::storage::DftIndependentModule const &module);
+
+    /*!
+     * Compute the canonical structure of the subtree of the given module class.
+     * @param moduleClass Module class whose subtree is set.
+     */
+    void computeCanonicalStructure(DynamicModuleClass &moduleClass) const;
+
+    /*!
+     * Check whether two module classes have identical subtrees (up to the names of the elements).
+     * @return True iff the subtrees are identical.
+     */
+    bool haveIdenticalStructure(DynamicModuleClass const &first, DynamicModuleClass const &second) const;
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -73,22 +113,26 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> replaceDynamicModules(std::vector<ValueType> const &timepoints);
 
     /*!
-     * Analyse the given dynamic module.
-     * @param module Module.
+     * Analyse the given dynamic module class and store the resulting probabilities in the class.
+     * @param moduleClass Module class.
      * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probability at the given time points.
+     * @param printOutput Whether the model checker should print model information and results.
      */
-    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+    void analyseDynamicModule(DynamicModuleClass &moduleClass, std::vector<ValueType> const &timepoints, FormulaVector const &properties,
+                              bool printOutput) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
-    // DFT modelchecker
-    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker;
+    // Number of threads used to analyse dynamic modules
+    uint64_t numberOfThreads;
     // don't reinitialize Sylvan BDD
     // temporary
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Classes of structurally identical dynamic modules
+    std::vector<DynamicModuleClass> dynamicModuleClasses;
 };
 
 }  // namespace modelchecker
@@ -1,11 +1,13 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm/adapters/eigen.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -235,6 +237,151 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * A bdd stored as flat arrays.
+ * Node 0 is the zero terminal, node 1 is the one terminal.
+ * The children of a node always have a smaller index than the node itself,
+ * the root is the node with the largest index.
+ */
+struct FlatBdd {
+    FlatBdd() : variables(2, 0), thenNodes{0, 1}, elseNodes{0, 1} {}
+
+    std::vector<uint32_t> variables;
+    std::vector<size_t> thenNodes;
+    std::vector<size_t> elseNodes;
+};
+
+/**
+ * \returns
+ * The index of the given bdd in the flat bdd.
+ *
+ * \param bdd
+ * The bdd to add
+ *
+ * \param flatBdd
+ * The flat bdd which is extended by all sub bdds not contained so far
+ *
+ * \param bddToNode
+ * A cache mapping sub bdds to their index in the flat bdd.
+ */
+size_t flattenBdd(Bdd const bdd, FlatBdd &flatBdd, std::unordered_map<uint64_t, size_t> &bddToNode) {
+    if (bdd.isZero()) {
+        return 0;
+    } else if (bdd.isOne()) {
+        return 1;
+    }
+
+    auto const it{bddToNode.find(bdd.GetBDD())};
+    if (it != bddToNode.end()) {
+        return it->second;
+    }
+
+    auto const thenNode{flattenBdd(bdd.Then(), flatBdd, bddToNode)};
+    auto const elseNode{flattenBdd(bdd.Else(), flatBdd, bddToNode)};
+
+    auto const node{flatBdd.variables.size()};
+    flatBdd.variables.push_back(bdd.TopVar());
+    flatBdd.thenNodes.push_back(thenNode);
+    flatBdd.elseNodes.push_back(elseNode);
+    bddToNode[bdd.GetBDD()] = node;
+    return node;
+}
+
+/**
+ * Calculates the probability of the bdd and the birnbaum factors of all variables
+ * in one bottom-up and one top-down pass over the flat bdd.
+ *
+ * The birnbaum factor of a variable x is the sum over all nodes v labelled with x
+ * of the probability to reach v from the root times P(Then(v)) - P(Else(v)).
+ *
+ * \param chunksize
+ * The width of the Eigen Arrays
+ *
+ * \param flatBdd
+ * The bdd
+ *
+ * \param root
+ * The index of the root node in the flat bdd
+ *
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ *
+ * \param probabilities
+ * Is set to the probabilities of the bdd
+ *
+ * \param birnbaumFactors
+ * Must contain an array of zeros for every variable.
+ * The birnbaum factors are added to these arrays.
+ */
+void flatProbabilitiesAndBirnbaumFactors(size_t const chunksize, FlatBdd const &flatBdd, size_t const root,
+                                         std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities, Eigen::ArrayXd &probabilities,
+                                         std::map<uint32_t, Eigen::ArrayXd> &birnbaumFactors) {
+    auto const numberOfNodes{root + 1};
+
+    // Look up the variable probabilities once per node
+    std::vector<Eigen::ArrayXd const *> variableProbabilities(numberOfNodes, nullptr);
+    std::vector<Eigen::ArrayXd *> variableBirnbaumFactors(numberOfNodes, nullptr);
+    for (size_t node{2}; node < numberOfNodes; ++node) {
+        variableProbabilities[node] = &indexToProbabilities.at(flatBdd.variables[node]);
+        variableBirnbaumFactors[node] = &birnbaumFactors.at(flatBdd.variables[node]);
+    }
+
+    // Bottom-up: P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+    std::vector<Eigen::ArrayXd> nodeProbabilities(numberOfNodes);
+    nodeProbabilities[0] = Eigen::ArrayXd::Constant(chunksize, 0);
+    nodeProbabilities[1] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (size_t node{2}; node < numberOfNodes; ++node) {
+        auto const &currentProbabilities{*variableProbabilities[node]};
+        nodeProbabilities[node] = currentProbabilities * nodeProbabilities[flatBdd.thenNodes[node]] +
+                                  (1 - currentProbabilities) * nodeProbabilities[flatBdd.elseNodes[node]];
+    }
+    probabilities = nodeProbabilities[root];
+
+    // Top-down: probabilities to reach the nodes
+    std::vector<Eigen::ArrayXd> reachProbabilities(numberOfNodes, Eigen::ArrayXd::Constant(chunksize, 0));
+    reachProbabilities[root] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (size_t node{root}; node >= 2; --node) {
+        auto const &currentProbabilities{*variableProbabilities[node]};
+        auto const &reach{reachProbabilities[node]};
+        auto const thenNode{flatBdd.thenNodes[node]};
+        auto const elseNode{flatBdd.elseNodes[node]};
+        *variableBirnbaumFactors[node] += reach * (nodeProbabilities[thenNode] - nodeProbabilities[elseNode]);
+        reachProbabilities[thenNode] += currentProbabilities * reach;
+        reachProbabilities[elseNode] += (1 - currentProbabilities) * reach;
+    }
+}
+
+/**
+ * \returns
+ * A mapping from the bdd variables of the given basic elements
+ * to their probabilities at the given timepoints.
+ */
+std::map<uint32_t, Eigen::ArrayXd> basicElementProbabilities(
+    std::vector<std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType>>> const &basicElements, std::vector<uint32_t> const &basicElementIndices,
+    Eigen::ArrayXd const &timepointsArray) {
+    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        auto const &be{basicElements[i]};
+        // Vectorize known BETypes
+        // fallback to getUnreliability() otherwise
+        if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
+            auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType>>(be)->activeFailureRate()};
+
+            // exponential distribution
+            // p(T <= t) = 1 - exp(-lambda*t)
+            indexToProbabilities[basicElementIndices[i]] = 1 - (-failureRate * timepointsArray).exp();
+        } else {
+            auto probabilities{timepointsArray};
+            for (Eigen::Index j{0}; j < timepointsArray.size(); ++j) {
+                probabilities(j) = be->getUnreliability(timepointsArray(j));
+            }
+            indexToProbabilities[basicElementIndices[i]] = probabilities;
+        }
+    }
+    return indexToProbabilities;
+}
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -293,7 +440,10 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 
     // caches
     auto const basicElements{getDFT()->getBasicElements()};
-    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+    std::vector<uint32_t> basicElementIndices{};
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
 
     // The current timepoints we calculate with
     Eigen::ArrayXd timepointsArray{chunksize};
@@ -311,29 +461,57 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
         }
 
         // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
-            // Vectorize known BETypes
-            // fallback to getUnreliability() otherwise
-            if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
-                auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType>>(be)->activeFailureRate()};
-
-                // exponential distribution
-                // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
-            } else {
-                auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
-                    probabilities(i) = be->getUnreliability(timepointsArray(i));
-                }
-                indexToProbabilities[beIndex] = probabilities;
-            }
-        }
+        auto const indexToProbabilities{basicElementProbabilities(basicElements, basicElementIndices, timepointsArray)};
 
         func(chunksize, timepointsArray, indexToProbabilities);
     }
 }
 
+template<typename FuncType>
+void SFTBDDChecker::batchedCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, size_t numberOfThreads, FuncType func) {
+    if (numberOfThreads == 0) {
+        numberOfThreads = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
+    if (chunksize == 0) {
+        // Distribute the timepoints evenly among the threads
+        chunksize = std::max<size_t>(1, (timepoints.size() + numberOfThreads - 1) / numberOfThreads);
+    }
+
+    // The threads only work on the flat bdd and do not access any Sylvan data structures
+    FlatBdd flatBdd{};
+    std::unordered_map<uint64_t, size_t> bddToNode{};
+    auto const root{flattenBdd(getTopLevelElementBdd(), flatBdd, bddToNode)};
+
+    auto const basicElements{getDFT()->getBasicElements()};
+    std::vector<uint32_t> basicElementIndices{};
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
+
+    auto const numberOfChunks{(timepoints.size() + chunksize - 1) / chunksize};
+    storm::utility::parallel::forEachChunk(numberOfThreads, numberOfChunks, 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t chunk{begin}; chunk < end; ++chunk) {
+            auto const firstTimepoint{chunk * chunksize};
+            auto const currentChunksize{std::min(chunksize, timepoints.size() - firstTimepoint)};
+
+            Eigen::ArrayXd timepointsArray{currentChunksize};
+            for (size_t i{0}; i < currentChunksize; ++i) {
+                timepointsArray(i) = timepoints[firstTimepoint + i];
+            }
+            auto const indexToProbabilities{basicElementProbabilities(basicElements, basicElementIndices, timepointsArray)};
+
+            std::map<uint32_t, Eigen::ArrayXd> indexToBirnbaumFactors{};
+            for (auto const index : basicElementIndices) {
+                indexToBirnbaumFactors[index] = Eigen::ArrayXd::Constant(currentChunksize, 0);
+            }
+            Eigen::ArrayXd probabilitiesArray{};
+            flatProbabilitiesAndBirnbaumFactors(currentChunksize, flatBdd, root, indexToProbabilities, probabilitiesArray, indexToBirnbaumFactors);
+
+            func(firstTimepoint, currentChunksize, basicElementIndices, indexToProbabilities, probabilitiesArray, indexToBirnbaumFactors);
+        }
+    });
+}
+
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
     std::map<uint32_t, ValueType> indexToProbability{};
     for (auto const &be : getDFT()->getBasicElements()) {
@@ -391,26 +569,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const measures{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(measures.size());
+    for (auto const &beMeasures : measures) {
+        resultVector.push_back(beMeasures.front());
     }
     return resultVector;
 }
@@ -454,48 +618,20 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    auto const basicElements{getDFT()->getBasicElements()};
-
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
-    }
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-
-        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-            auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
-
-            // Update result Probabilities
-            for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
-            }
-        }
-    });
+    std::vector<std::vector<ValueType>> resultVector(getDFT()->getBasicElements().size(), std::vector<ValueType>(timepoints.size()));
+
+    batchedCalculationTemplate(timepoints, chunksize, 1,
+                               [&](auto const firstTimepoint, auto const currentChunksize, auto const &basicElementIndices, auto const &indexToProbabilities,
+                                   auto const &probabilitiesArray, auto const &indexToBirnbaumFactors) {
+                                   for (size_t basicElementIndex{0}; basicElementIndex < basicElementIndices.size(); ++basicElementIndex) {
+                                       auto const index{basicElementIndices[basicElementIndex]};
+                                       auto const ImportanceMeasureArray{
+                                           func(indexToProbabilities.at(index), probabilitiesArray, indexToBirnbaumFactors.at(index))};
+                                       for (size_t i{0}; i < currentChunksize; ++i) {
+                                           resultVector[basicElementIndex][firstTimepoint + i] = ImportanceMeasureArray(i);
+                                       }
+                                   }
+                               });
 
     return resultVector;
 }
@@ -539,6 +675,43 @@ struct RRWFunctor {
 
 }  // namespace
 
+SFTBDDChecker::AllMeasures SFTBDDChecker::getAllMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize, size_t numberOfThreads) {
+    auto const numberOfBasicElements{getDFT()->getBasicElements().size()};
+    AllMeasures result{};
+    result.probabilities.resize(timepoints.size());
+    for (auto *measure : {&result.birnbaumFactors, &result.CIFs, &result.DIFs, &result.RAWs, &result.RRWs}) {
+        measure->assign(numberOfBasicElements, std::vector<ValueType>(timepoints.size()));
+    }
+
+    // Each chunk writes to its own range of timepoints
+    batchedCalculationTemplate(
+        timepoints, chunksize, numberOfThreads,
+        [&](auto const firstTimepoint, auto const currentChunksize, auto const &basicElementIndices, auto const &indexToProbabilities,
+            auto const &probabilitiesArray, auto const &indexToBirnbaumFactors) {
+            for (size_t i{0}; i < currentChunksize; ++i) {
+                result.probabilities[firstTimepoint + i] = probabilitiesArray(i);
+            }
+            for (size_t basicElementIndex{0}; basicElementIndex < basicElementIndices.size(); ++basicElementIndex) {
+                auto const index{basicElementIndices[basicElementIndex]};
+                auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
+                auto const &birnbaumFactorsArray{indexToBirnbaumFactors.at(index)};
+
+                auto const storeMeasure = [&](std::vector<std::vector<ValueType>> &measure, Eigen::ArrayXd const &measureArray) {
+                    for (size_t i{0}; i < currentChunksize; ++i) {
+                        measure[basicElementIndex][firstTimepoint + i] = measureArray(i);
+                    }
+                };
+                storeMeasure(result.birnbaumFactors, BirnbaumFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                storeMeasure(result.CIFs, CIFFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                storeMeasure(result.DIFs, DIFFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                storeMeasure(result.RAWs, RAWFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                storeMeasure(result.RRWs, RRWFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+            }
+        });
+
+    return result;
+}
+
 ValueType SFTBDDChecker::getBirnbaumFactorAtTimebound(std::string const &beName, ValueType timebound) {
     return getImportanceMeasureAtTimebound(beName, timebound, BirnbaumFunctor{});
 }
@@ -24,6 +24,21 @@ class SFTBDDChecker {
     using ValueType = double;
     using Bdd = sylvan::Bdd;
 
+    /**
+     * The failure probabilities of the top level event
+     * together with the importance measures of all basic events.
+     * The importance measures are indexed by the basic events
+     * (in the order of DFT::getBasicElements()) and then by the timepoints.
+     */
+    struct AllMeasures {
+        std::vector<ValueType> probabilities;
+        std::vector<std::vector<ValueType>> birnbaumFactors;
+        std::vector<std::vector<ValueType>> CIFs;
+        std::vector<std::vector<ValueType>> DIFs;
+        std::vector<std::vector<ValueType>> RAWs;
+        std::vector<std::vector<ValueType>> RRWs;
+    };
+
     SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft,
                   std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager = std::make_shared<storm::dft::storage::SylvanBddManager>());
 
@@ -340,6 +355,26 @@ class SFTBDDChecker {
      */
     std::vector<std::vector<ValueType>> getAllRRWsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
+    /**
+     * \return
+     * The failure probabilities and all importance measures
+     * of all basic events at the given timepoints.
+     * The BDD is traversed once bottom-up and once top-down per chunk
+     * of timepoints, independently of the number of basic events.
+     *
+     * \param timepoints
+     * Array of timebounds to calculate the measures for.
+     *
+     * \param chunksize
+     * Splits the timepoints array into chunksize chunks.
+     * A value of 0 distributes the timepoints evenly among the threads.
+     *
+     * \param numberOfThreads
+     * The number of threads processing the chunks concurrently.
+     * A value of 0 uses all hardware threads.
+     */
+    AllMeasures getAllMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0, size_t numberOfThreads = 1);
+
    private:
     /**
      * Recursively traverses the given BDD and returns the minimalCutSets.
@@ -360,6 +395,14 @@ class SFTBDDChecker {
     template<typename FuncType>
     void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const;
 
+    /**
+     * Calculates the probabilities and the birnbaum factors of all basic events
+     * for each chunk of timepoints in one pass over the flattened BDD
+     * and passes them to func. The chunks are processed concurrently.
+     */
+    template<typename FuncType>
+    void batchedCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, size_t numberOfThreads, FuncType func);
+
     template<typename FuncType>
     ValueType getImportanceMeasureAtTimebound(std::string const &beName, ValueType timebound, FuncType func);
 
@@ -18,6 +18,8 @@ const std::string FaultTreeSettings::moduleName = "dft";
 const std::string FaultTreeSettings::noSymmetryReductionOptionName = "nosymmetryreduction";
 const std::string FaultTreeSettings::noSymmetryReductionOptionShortName = "nosymred";
 const std::string FaultTreeSettings::modularisationOptionName = "modularisation";
+const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisation-threads";
+const std::string FaultTreeSettings::explorationThreadsOptionName = "exploration-threads";
 const std::string FaultTreeSettings::disableDCOptionName = "disabledc";
 const std::string FaultTreeSettings::allowDCRelevantOptionName = "allowdcrelevant";
 const std::string FaultTreeSettings::relevantEventsOptionName = "relevantevents";
@@ -35,6 +37,14 @@ const std::string FaultTreeSettings::chunksizeOptionName = "chunksize";
 const std::string FaultTreeSettings::mttfPrecisionName = "mttf-precision";
 const std::string FaultTreeSettings::mttfStepsizeName = "mttf-stepsize";
 const std::string FaultTreeSettings::mttfAlgorithmName = "mttf-algorithm";
+const std::string FaultTreeSettings::simulateOptionName = "simulate";
+const std::string FaultTreeSettings::simulationPrecisionOptionName = "simulation-precision";
+const std::string FaultTreeSettings::simulationRelativeOptionName = "simulation-relative";
+const std::string FaultTreeSettings::simulationConfidenceOptionName = "simulation-confidence";
+const std::string FaultTreeSettings::simulationMaxTracesOptionName = "simulation-maxtraces";
+const std::string FaultTreeSettings::simulationThreadsOptionName = "simulation-threads";
+const std::string FaultTreeSettings::simulationSeedOptionName = "simulation-seed";
+const std::string FaultTreeSettings::simulationSplittingOptionName = "simulation-splitting";
 
 FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, noSymmetryReductionOptionName, false, "Do not exploit symmetric structure of model.")
@@ -42,6 +52,20 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false,
+                                                   "The number of threads used to analyse independent dynamic modules.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Set to 0 to use all cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "The number of threads used to expand the states during the state space exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Set to 0 to use all cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.")
@@ -106,6 +130,44 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                              .setDefaultValueString("proceeding")
                              .build())
             .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulateOptionName, false, "Estimate the probability of failure within the timebound by simulation.")
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationPrecisionOptionName, false,
+                                                   "Stop the simulation once the half-width of the confidence interval is at most this value.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve. Set to 0 to disable.")
+                                         .setDefaultValueDouble(1e-3)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationRelativeOptionName, false, "Sets whether the simulation precision is relative.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationConfidenceOptionName, false, "The confidence level of the simulation result.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence level.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationMaxTracesOptionName, false, "The maximal number of simulated traces.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .setDefaultValueUnsignedInteger(1000000)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationThreadsOptionName, false, "The number of threads used for simulation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Set to 0 to use all cores.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationSeedOptionName, false, "The seed for the random numbers used in the simulation.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed.").setDefaultValueUnsignedInteger(5).build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulationSplittingOptionName, false, "Use importance splitting to simulate rare failures.").build());
 }
 
 bool FaultTreeSettings::useSymmetryReduction() const {
@@ -116,6 +178,14 @@ bool FaultTreeSettings::useModularisation() const {
     return this->getOption(modularisationOptionName).getHasOptionBeenSet();
 }
 
+uint64_t FaultTreeSettings::getModularisationThreads() const {
+    return this->getOption(modularisationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool FaultTreeSettings::isDisableDC() const {
     return this->getOption(disableDCOptionName).getHasOptionBeenSet();
 }
@@ -201,6 +271,38 @@ std::string FaultTreeSettings::getMttfAlgorithm() const {
     return this->getOption(mttfAlgorithmName).getArgumentByName("algorithm").getValueAsString();
 }
 
+bool FaultTreeSettings::isSimulate() const {
+    return this->getOption(simulateOptionName).getHasOptionBeenSet();
+}
+
+double FaultTreeSettings::getSimulationPrecision() const {
+    return this->getOption(simulationPrecisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+bool FaultTreeSettings::isSimulationPrecisionRelative() const {
+    return this->getOption(simulationRelativeOptionName).getHasOptionBeenSet();
+}
+
+double FaultTreeSettings::getSimulationConfidence() const {
+    return this->getOption(simulationConfidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t FaultTreeSettings::getSimulationMaxTraces() const {
+    return this->getOption(simulationMaxTracesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getSimulationThreads() const {
+    return this->getOption(simulationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getSimulationSeed() const {
+    return this->getOption(simulationSeedOptionName).getArgumentByName("seed").getValueAsUnsignedInteger();
+}
+
+bool FaultTreeSettings::isSimulationSplitting() const {
+    return this->getOption(simulationSplittingOptionName).getHasOptionBeenSet();
+}
+
 void FaultTreeSettings::finalize() {}
 
 bool FaultTreeSettings::check() const {
@@ -32,6 +32,20 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool useModularisation() const;
 
+    /*!
+     * Retrieves the number of threads used to analyse independent modules.
+     *
+     * @return The number of threads, 0 for all cores.
+     */
+    uint64_t getModularisationThreads() const;
+
+    /*!
+     * Retrieves the number of threads used to expand states during the state space exploration.
+     *
+     * @return The number of threads, 0 for all cores.
+     */
+    uint64_t getExplorationThreads() const;
+
     /*!
      * Retrieves whether the option to disable Dont Care propagation is set.
      *
@@ -167,6 +181,62 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     std::string getMttfAlgorithm() const;
 
+    /*!
+     * Retrieves whether the failure probability should be estimated by simulation.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulate() const;
+
+    /*!
+     * Retrieves the desired half-width of the confidence interval of the simulation.
+     *
+     * @return The precision.
+     */
+    double getSimulationPrecision() const;
+
+    /*!
+     * Retrieves whether the simulation precision is relative to the estimate.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulationPrecisionRelative() const;
+
+    /*!
+     * Retrieves the confidence level of the simulation result.
+     *
+     * @return The confidence level.
+     */
+    double getSimulationConfidence() const;
+
+    /*!
+     * Retrieves the maximal number of simulated traces.
+     *
+     * @return The maximal number of traces.
+     */
+    uint64_t getSimulationMaxTraces() const;
+
+    /*!
+     * Retrieves the number of threads used for simulation.
+     *
+     * @return The number of threads, 0 for all cores.
+     */
+    uint64_t getSimulationThreads() const;
+
+    /*!
+     * Retrieves the seed for the simulation.
+     *
+     * @return The seed.
+     */
+    uint64_t getSimulationSeed() const;
+
+    /*!
+     * Retrieves whether importance splitting should be used for simulation.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulationSplitting() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -179,6 +249,8 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string noSymmetryReductionOptionName;
     static const std::string noSymmetryReductionOptionShortName;
     static const std::string modularisationOptionName;
+    static const std::string modularisationThreadsOptionName;
+    static const std::string explorationThreadsOptionName;
     static const std::string disableDCOptionName;
     static const std::string allowDCRelevantOptionName;
     static const std::string relevantEventsOptionName;
@@ -196,6 +268,14 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string mttfPrecisionName;
     static const std::string mttfStepsizeName;
     static const std::string mttfAlgorithmName;
+    static const std::string simulateOptionName;
+    static const std::string simulationPrecisionOptionName;
+    static const std::string simulationRelativeOptionName;
+    static const std::string simulationConfidenceOptionName;
+    static const std::string simulationMaxTracesOptionName;
+    static const std::string simulationThreadsOptionName;
+    static const std::string simulationSeedOptionName;
+    static const std::string simulationSplittingOptionName;
 };
 
 }  // namespace modules
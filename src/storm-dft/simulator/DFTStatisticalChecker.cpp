@@ -0,0 +1,189 @@
+#include "DFTStatisticalChecker.h"
+
+#include <algorithm>
+#include <boost/math/distributions/normal.hpp>
+#include <cmath>
+#include <random>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm::dft {
+namespace simulator {
+
+namespace {
+
+/*!
+ * Seed the generator with a stream that only depends on the global seed and the index of the batch.
+ */
+void seedForBatch(boost::mt19937& randomGenerator, uint64_t seed, uint64_t batchIndex) {
+    std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(batchIndex),
+                           static_cast<uint32_t>(batchIndex >> 32)};
+    randomGenerator.seed(sequence);
+}
+
+}  // namespace
+
+template<typename ValueType>
+DFTStatisticalChecker<ValueType>::DFTStatisticalChecker(storm::dft::storage::DFT<ValueType> const& dft,
+                                                        storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo)
+    : dft(dft), stateGenerationInfo(stateGenerationInfo) {
+    // Intentionally left empty
+}
+
+template<typename ValueType>
+StatisticalCheckResult DFTStatisticalChecker<ValueType>::checkUnreliability(StatisticalCheckSettings const& settings) const {
+    STORM_LOG_THROW(settings.confidence > 0.0 && settings.confidence < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The confidence level must be in (0,1).");
+    STORM_LOG_THROW(settings.precision >= 0.0, storm::exceptions::InvalidArgumentException, "The precision must be non-negative.");
+    STORM_LOG_THROW(settings.batchSize > 0 && settings.splittingEffort > 0, storm::exceptions::InvalidArgumentException,
+                    "Batch size and splitting effort must be positive.");
+
+    uint64_t numberOfThreads = settings.numberOfThreads == 0 ? storm::utility::parallel::getNumberOfHardwareThreads() : settings.numberOfThreads;
+    numberOfThreads = std::min(numberOfThreads, batchesPerRound);
+    double const z = boost::math::quantile(boost::math::normal(), 1.0 - (1.0 - settings.confidence) / 2.0);
+
+    // Each thread uses its own simulator, whose random number generator is re-seeded for every batch.
+    std::vector<boost::mt19937> randomGenerators(numberOfThreads);
+    std::vector<std::unique_ptr<DFTTraceSimulator<ValueType>>> simulators;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        simulators.push_back(std::make_unique<DFTTraceSimulator<ValueType>>(dft, stateGenerationInfo, randomGenerators[thread]));
+    }
+
+    StatisticalCheckResult result;
+    result.numberOfTraces = 0;
+    result.precisionReached = false;
+    // Plain simulation: number of successful traces. Splitting: sum and sum of squares of the estimates of the runs.
+    uint64_t numberOfSuccessfulTraces = 0;
+    double sumOfEstimates = 0.0;
+    double sumOfSquaredEstimates = 0.0;
+    uint64_t numberOfBatches = 0;
+
+    std::vector<uint64_t> batchSuccesses(batchesPerRound);
+    std::vector<double> batchEstimates(batchesPerRound);
+    std::vector<uint64_t> batchTraces(batchesPerRound);
+    while (!result.precisionReached && result.numberOfTraces < settings.maxNumberOfTraces) {
+        storm::utility::parallel::forEachChunk(numberOfThreads, batchesPerRound, 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            for (uint64_t batch = begin; batch < end; ++batch) {
+                seedForBatch(randomGenerators[threadIndex], settings.seed, numberOfBatches + batch);
+                if (settings.importanceSplitting) {
+                    batchTraces[batch] = 0;
+                    batchEstimates[batch] = simulateSplitting(*simulators[threadIndex], settings.splittingEffort, settings.timebound, batchTraces[batch]);
+                } else {
+                    batchTraces[batch] = settings.batchSize;
+                    batchSuccesses[batch] = simulateTraces(*simulators[threadIndex], settings.batchSize, settings.timebound);
+                }
+            }
+        });
+
+        // Combine the results in the order of the batches.
+        for (uint64_t batch = 0; batch < batchesPerRound; ++batch) {
+            result.numberOfTraces += batchTraces[batch];
+            if (settings.importanceSplitting) {
+                sumOfEstimates += batchEstimates[batch];
+                sumOfSquaredEstimates += batchEstimates[batch] * batchEstimates[batch];
+            } else {
+                numberOfSuccessfulTraces += batchSuccesses[batch];
+            }
+        }
+        numberOfBatches += batchesPerRound;
+
+        double halfWidth;
+        if (settings.importanceSplitting) {
+            double const n = static_cast<double>(numberOfBatches);
+            result.estimate = sumOfEstimates / n;
+            double variance = std::max(0.0, (sumOfSquaredEstimates - n * result.estimate * result.estimate) / (n - 1.0));
+            halfWidth = z * std::sqrt(variance / n);
+            result.lowerBound = std::max(0.0, result.estimate - halfWidth);
+            result.upperBound = std::min(1.0, result.estimate + halfWidth);
+        } else {
+            // Wilson score interval, which is also meaningful if (almost) no trace was successful.
+            double const n = static_cast<double>(result.numberOfTraces);
+            result.estimate = static_cast<double>(numberOfSuccessfulTraces) / n;
+            double const denominator = 1.0 + z * z / n;
+            double const center = (result.estimate + z * z / (2.0 * n)) / denominator;
+            halfWidth = z * std::sqrt(result.estimate * (1.0 - result.estimate) / n + z * z / (4.0 * n * n)) / denominator;
+            result.lowerBound = std::max(0.0, center - halfWidth);
+            result.upperBound = std::min(1.0, center + halfWidth);
+        }
+
+        if (settings.precision > 0.0) {
+            if (settings.relativePrecision) {
+                result.precisionReached = result.estimate > 0.0 && halfWidth <= settings.precision * result.estimate;
+            } else {
+                result.precisionReached = halfWidth <= settings.precision;
+            }
+        }
+        STORM_LOG_INFO("Simulated " << result.numberOfTraces << " traces. Current estimate: " << result.estimate << " in [" << result.lowerBound << ", "
+                                    << result.upperBound << "].");
+    }
+    STORM_LOG_WARN_COND(settings.precision == 0.0 || result.precisionReached,
+                        "Desired precision not reached within " << settings.maxNumberOfTraces << " traces.");
+    return result;
+}
+
+template<typename ValueType>
+uint64_t DFTStatisticalChecker<ValueType>::simulateTraces(DFTTraceSimulator<ValueType>& simulator, uint64_t numberOfTraces, double timebound) const {
+    uint64_t successful = 0;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        // Invalid traces are rejected by the simulator.
+        if (simulator.simulateCompleteTrace(timebound) == SimulationResult::SUCCESSFUL) {
+            ++successful;
+        }
+    }
+    return successful;
+}
+
+template<typename ValueType>
+double DFTStatisticalChecker<ValueType>::simulateSplitting(DFTTraceSimulator<ValueType>& simulator, uint64_t effort, double timebound,
+                                                           uint64_t& numberOfTraces) const {
+    simulator.resetToInitial();
+    if (simulator.getCurrentState()->hasFailed(dft.getTopLevelIndex())) {
+        return 1.0;
+    }
+
+    // The states (and times) in which the current level was entered without failure of the top level event.
+    std::vector<std::pair<DFTStatePointer, double>> entries = {{simulator.getCurrentState(), 0.0}};
+    std::vector<std::pair<DFTStatePointer, double>> nextEntries;
+    // Probability to enter the current level without failure of the top level event.
+    double levelProbability = 1.0;
+    double result = 0.0;
+    while (!entries.empty()) {
+        uint64_t failed = 0;
+        nextEntries.clear();
+        for (uint64_t segment = 0; segment < effort; ++segment) {
+            // Distribute the effort evenly among the entry states.
+            auto const& entry = entries[segment % entries.size()];
+            simulator.setCurrentState(entry.first);
+            auto stepResult = simulator.randomStep();
+            if (stepResult.first == SimulationResult::UNSUCCESSFUL) {
+                // No element can fail anymore.
+                continue;
+            }
+            STORM_LOG_THROW(stepResult.first == SimulationResult::SUCCESSFUL, storm::exceptions::NotSupportedException,
+                            "Handling of invalid states is not supported for simulation");
+            double time = entry.second + stepResult.second;
+            if (time > timebound) {
+                continue;
+            }
+            if (simulator.getCurrentState()->hasFailed(dft.getTopLevelIndex())) {
+                ++failed;
+            } else {
+                nextEntries.emplace_back(simulator.getCurrentState(), time);
+            }
+        }
+        numberOfTraces += effort;
+        result += levelProbability * static_cast<double>(failed) / static_cast<double>(effort);
+        levelProbability *= static_cast<double>(nextEntries.size()) / static_cast<double>(effort);
+        std::swap(entries, nextEntries);
+    }
+    return result;
+}
+
+template class DFTStatisticalChecker<double>;
+template class DFTStatisticalChecker<storm::RationalFunction>;
+
+}  // namespace simulator
+}  // namespace storm::dft
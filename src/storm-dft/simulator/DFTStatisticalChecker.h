@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DFTState.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Settings for the statistical analysis of DFTs.
+ */
+struct StatisticalCheckSettings {
+    // Time bound for the system failure.
+    double timebound = 1.0;
+    // Confidence level of the computed confidence interval.
+    double confidence = 0.95;
+    // The simulation stops once the half-width of the confidence interval is at most this value. Value 0 disables adaptive stopping.
+    double precision = 0.0;
+    // If set, the precision is relative to the estimate.
+    bool relativePrecision = false;
+    // The simulation stops after (at least) this number of simulated traces.
+    uint64_t maxNumberOfTraces = 1000000;
+    // The number of traces simulated in one batch. Each batch uses its own random number stream.
+    uint64_t batchSize = 1000;
+    // The number of threads. Value 0 uses all hardware threads.
+    uint64_t numberOfThreads = 0;
+    // Seed from which the random number streams of all batches are derived.
+    uint64_t seed = 5;
+    // If set, importance splitting is used to estimate (rare) failure probabilities.
+    bool importanceSplitting = false;
+    // The number of trace segments simulated on each level of the importance splitting.
+    uint64_t splittingEffort = 1000;
+};
+
+/*!
+ * Result of the statistical analysis of DFTs.
+ */
+struct StatisticalCheckResult {
+    // The estimated probability.
+    double estimate;
+    // The confidence interval for the probability.
+    double lowerBound;
+    double upperBound;
+    // The number of simulated traces (or trace segments, if importance splitting is used).
+    uint64_t numberOfTraces;
+    // Whether the desired precision was reached.
+    bool precisionReached;
+};
+
+/*!
+ * Estimates the probability that a DFT fails within a time bound by simulating many traces in parallel.
+ *
+ * The traces are simulated in batches. All random numbers of a batch are drawn from a stream that is seeded with the global seed and the index of the
+ * batch. Batches are processed in rounds of fixed size and the results are combined in the order of the batches. Thus, the result only depends on the
+ * settings and not on the number of threads or their scheduling.
+ * After each round, the confidence interval is computed and the simulation stops once the desired precision is reached.
+ *
+ * Without importance splitting, each batch is a set of independent traces and the Wilson score interval is used.
+ * With importance splitting, each batch is one run of fixed-effort multilevel splitting in which level k is entered by performing k failure steps
+ * within the time bound. Trace segments are restarted from the states in which the previous level was entered, so that traces reaching deep into the
+ * failure behaviour are simulated much more often than in plain Monte Carlo simulation. The confidence interval is obtained from the sample variance of
+ * the independent runs.
+ */
+template<typename ValueType>
+class DFTStatisticalChecker {
+    using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
+
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     */
+    DFTStatisticalChecker(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo);
+
+    /*!
+     * Estimate the probability that the top level event fails within the time bound.
+     *
+     * @param settings Settings for the simulation.
+     * @return Estimate and confidence interval.
+     */
+    StatisticalCheckResult checkUnreliability(StatisticalCheckSettings const& settings) const;
+
+   private:
+    /*!
+     * Simulate the given number of independent traces.
+     *
+     * @return Number of traces in which the top level event failed within the time bound.
+     */
+    uint64_t simulateTraces(DFTTraceSimulator<ValueType>& simulator, uint64_t numberOfTraces, double timebound) const;
+
+    /*!
+     * Perform one run of fixed-effort importance splitting.
+     *
+     * @param numberOfTraces Is increased by the number of simulated trace segments.
+     * @return Estimated probability that the top level event fails within the time bound.
+     */
+    double simulateSplitting(DFTTraceSimulator<ValueType>& simulator, uint64_t effort, double timebound, uint64_t& numberOfTraces) const;
+
+    // The DFT to analyse.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    // The number of batches processed before the stopping criterion is checked.
+    static constexpr uint64_t batchesPerRound = 64;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
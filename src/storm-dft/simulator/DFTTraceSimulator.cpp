@@ -27,6 +27,11 @@ typename DFTTraceSimulator<ValueType>::DFTStatePointer DFTTraceSimulator<ValueTy
     return state;
 }
 
+template<typename ValueType>
+void DFTTraceSimulator<ValueType>::setCurrentState(DFTStatePointer newState) {
+    state = newState;
+}
+
 template<typename ValueType>
 std::tuple<storm::dft::storage::FailableElements::const_iterator, double, bool> DFTTraceSimulator<ValueType>::randomNextFailure() {
     auto iterFailable = state->getFailableElements().begin();
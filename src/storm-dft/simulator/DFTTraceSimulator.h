@@ -56,6 +56,14 @@ class DFTTraceSimulator {
      */
     DFTStatePointer getCurrentState() const;
 
+    /*!
+     * Set the current DFT state, e.g., in order to continue a simulation from a previously visited state.
+     * The given state is not modified by subsequent simulation steps.
+     *
+     * @param newState DFT state.
+     */
+    void setCurrentState(DFTStatePointer newState);
+
     /*!
      * Perform one simulation step by letting the next element fail.
      *
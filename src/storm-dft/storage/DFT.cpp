@@ -904,45 +904,49 @@ void DFT<ValueType>::findSymmetriesHelper(std::vector<size_t> const& candidates,
         return;
     }
 
-    std::set<size_t> foundEqClassFor;
-    for (auto it1 = candidates.cbegin(); it1 != candidates.cend(); ++it1) {
-        std::vector<std::vector<size_t>> symClass;
-        if (foundEqClassFor.count(*it1) > 0) {
-            // This item is already in a class.
-            continue;
-        }
-        if (!getElement(*it1)->hasOnlyStaticParents()) {
-            continue;
+    // Candidates can only be symmetric if they have the same parents and dependencies and if their subtrees have the same hash.
+    // We partition the candidates accordingly and only search for bijections within each block.
+    std::map<std::pair<std::tuple<std::vector<size_t>, std::vector<size_t>, std::vector<size_t>>, size_t>, std::vector<size_t>> blocks;
+    for (size_t candidate : candidates) {
+        if (getElement(candidate)->hasOnlyStaticParents()) {
+            blocks[std::make_pair(getSortedParentAndDependencyIds(candidate), colouring.getSubtreeHash(candidate))].push_back(candidate);
         }
+    }
 
-        std::tuple<std::vector<size_t>, std::vector<size_t>, std::vector<size_t>> influencedElem1Ids = getSortedParentAndDependencyIds(*it1);
-        auto it2 = it1;
-        for (++it2; it2 != candidates.cend(); ++it2) {
-            if (!getElement(*it2)->hasOnlyStaticParents()) {
+    for (auto const& block : blocks) {
+        std::vector<size_t> const& blockCandidates = block.second;
+        std::vector<bool> foundEqClassFor(blockCandidates.size(), false);
+        for (size_t i = 0; i < blockCandidates.size(); ++i) {
+            if (foundEqClassFor[i]) {
+                // This item is already in a class.
                 continue;
             }
-
-            if (influencedElem1Ids == getSortedParentAndDependencyIds(*it2)) {
-                std::map<size_t, size_t> bijection = findBijection(*it1, *it2, colouring, true);
+            std::vector<std::vector<size_t>> symClass;
+            for (size_t j = i + 1; j < blockCandidates.size(); ++j) {
+                if (foundEqClassFor[j]) {
+                    // Symmetry is transitive, so the item cannot be symmetric to the current one.
+                    continue;
+                }
+                std::map<size_t, size_t> bijection = findBijection(blockCandidates[i], blockCandidates[j], colouring, true);
                 if (!bijection.empty()) {
                     STORM_LOG_TRACE("Subdfts are symmetric");
-                    foundEqClassFor.insert(*it2);
+                    foundEqClassFor[j] = true;
                     if (symClass.empty()) {
-                        for (auto const& i : bijection) {
-                            symClass.push_back(std::vector<size_t>({i.first}));
+                        for (auto const& k : bijection) {
+                            symClass.push_back(std::vector<size_t>({k.first}));
                         }
                     }
                     auto symClassIt = symClass.begin();
-                    for (auto const& i : bijection) {
-                        symClassIt->emplace_back(i.second);
+                    for (auto const& k : bijection) {
+                        symClassIt->emplace_back(k.second);
                         ++symClassIt;
                     }
                 }
             }
-        }
 
-        if (!symClass.empty()) {
-            result.emplace(*it1, symClass);
+            if (!symClass.empty()) {
+                result.emplace(blockCandidates[i], symClass);
+            }
         }
     }
 }
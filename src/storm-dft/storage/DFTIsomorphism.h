@@ -1,9 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm-dft/storage/DFT.h"
 #include "storm-dft/storage/elements/DFTElementType.h"
 #include "storm-dft/storage/elements/DFTElements.h"
@@ -205,6 +208,7 @@ class DFTColouring {
     std::unordered_map<size_t, BEColourClass<ValueType>> beColour;
     std::unordered_map<size_t, std::pair<ValueType, ValueType>> depColour;
     std::unordered_map<size_t, size_t> restrictionColour;
+    std::unordered_map<size_t, size_t> subtreeHash;
     GateGroupToHash gateColourizer;
     RestrictionGroupToHash restrColourizer;
 
@@ -222,12 +226,29 @@ class DFTColouring {
                 colourize(dft.getRestriction(id));
             }
         }
+        for (size_t id = 0; id < dft.nrElements(); ++id) {
+            if (dft.isBasicElement(id) || dft.isGate(id)) {
+                computeSubtreeHash(id);
+            }
+        }
     }
 
     bool hasSameColour(size_t index1, size_t index2) const {
         return beColour.at(index1) == beColour.at(index2);
     }
 
+    /**
+     * Get the hash of the subtree rooted in the given BE or gate.
+     * The hash only depends on the colours of the elements in the subtree and not on the order of the children.
+     * Isomorphic subtrees therefore have the same hash, and subtrees with different hashes cannot be isomorphic.
+     *
+     * @param index Id of the BE or gate.
+     * @return Hash of the subtree.
+     */
+    size_t getSubtreeHash(size_t index) const {
+        return subtreeHash.at(index);
+    }
+
     BijectionCandidates<ValueType> colourSubdft(std::vector<size_t> const& subDftIndices) const {
         BijectionCandidates<ValueType> res;
         for (size_t index : subDftIndices) {
@@ -314,6 +335,35 @@ class DFTColouring {
     void colourize(std::shared_ptr<const storm::dft::storage::elements::DFTRestriction<ValueType>> const& restr) {
         restrictionColour[restr->id()] = restrColourizer(restr->type(), restr->nrChildren(), restr->rank());
     }
+
+    /**
+     * Compute the hash of the subtree rooted in the given BE or gate from its colour and the hashes of its children.
+     * The hashes of shared subtrees are memoized and therefore only computed once.
+     */
+    size_t computeSubtreeHash(size_t index) {
+        auto it = subtreeHash.find(index);
+        if (it != subtreeHash.end()) {
+            return it->second;
+        }
+        size_t hash;
+        if (dft.isBasicElement(index)) {
+            hash = std::hash<BEColourClass<ValueType>>()(beColour.at(index));
+        } else {
+            STORM_LOG_ASSERT(dft.isGate(index), "Element is no gate.");
+            hash = gateColour.at(index);
+            std::vector<size_t> childHashes;
+            for (auto const& child : dft.getGate(index)->children()) {
+                childHashes.push_back(computeSubtreeHash(child->id()));
+            }
+            // Sort the hashes as the isomorphism check may permute the children
+            std::sort(childHashes.begin(), childHashes.end());
+            for (size_t childHash : childHashes) {
+                boost::hash_combine(hash, childHash);
+            }
+        }
+        subtreeHash[index] = hash;
+        return hash;
+    }
 };
 
 /**
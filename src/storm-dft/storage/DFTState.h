@@ -71,6 +71,14 @@ class DFTState {
 
     std::shared_ptr<DFTState<ValueType>> copy() const;
 
+    /**
+     * Overwrite this state by the given state of the same DFT.
+     * In contrast to copy(), the memory already allocated by this state is reused.
+     *
+     * @param other State to copy.
+     */
+    void assign(DFTState<ValueType> const& other);
+
     DFTElementState getElementState(size_t id) const;
 
     static DFTElementState getElementState(storm::storage::BitVector const& state, DFTStateGenerationInfo const& stateGenerationInfo, size_t id);
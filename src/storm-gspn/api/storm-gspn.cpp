@@ -17,6 +17,11 @@ storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn) {
     return builder.build();
 }
 
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildExplicitModel(storm::gspn::GSPN const& gspn) {
+    storm::builder::ExplicitGspnModelBuilder<double> builder(gspn);
+    return builder.build();
+}
+
 void handleGSPNExportSettings(storm::gspn::GSPN const& gspn,
                               std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter) {
     storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
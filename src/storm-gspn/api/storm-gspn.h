@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
 #include "storm/storage/jani/Model.h"
@@ -14,6 +15,11 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the Markov automaton of the GSPN directly, i.e., without translating it to JANI.
+ */
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildExplicitModel(storm::gspn::GSPN const& gspn);
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
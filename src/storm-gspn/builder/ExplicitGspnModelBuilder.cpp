@@ -1,332 +1,262 @@
-// #include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-// #include "storm/models/sparse/StandardRewardModel.h"
-//
-// #include "storm/utility/macros.h"
-// #include "storm/exceptions/NotImplementedException.h"
-// #include "storm/storage/expressions/ExpressionManager.h"
-// #include "storm-parsers/parser/FormulaParser.h"
-// #include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         template<typename ValueType>
-//         storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string
-//         const& formula) {
-//             // set the given gspn and compute the limits of the net
-//             this->gspn = gspn;
-//             computeCapacities(gspn);
-//
-//             // markings maps markings to their corresponding rowgroups (indices)
-//             markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//             builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//             // add initial marking to todo list
-//             auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//             findOrAddBitvectorToMarkings(*bitvector);
-//             currentRowIndex = 0;
-//
-//             // vector marking markovian states (vector contains an 1 if the state is markovian)
-//             storm::storage::BitVector markovianStates(0);
-//
-//             // vector containing the exit rates for the markovian states
-//             std::vector<ValueType> exitRates;
-//
-//
-//             while (!todo.empty()) {
-//                 // take next element from the todo list
-//                 auto currentBitvector = todo.front();
-//                 todo.pop_front();
-//                 auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                 // increment list of states by one
-//                 markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                 // create new row group for the current marking
-//                 builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                 std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                 auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                 if (!enabledImmediateTransitions.empty()) {
-//                     markovianStates.set(currentRowIndex, 0);
-//                     exitRates.push_back(0);
-//
-//                     auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                     addRowForPartitions(partitions, currentMarking);
-//                 } else {
-//
-//                     auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                     if (!enabledTimedTransitions.empty()) {
-//                         markovianStates.set(currentRowIndex, 1);
-//
-//                         auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                         std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                         exitRates.push_back(accRate);
-//
-//                         addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                     } else {
-//                         markovianStates.set(currentRowIndex, 1);
-//                     }
-//                 }
-//                 ++currentRowIndex;
-//             }
-//
-//             auto matrix = builder.build();
-//
-//             // create expression manager and add variables from the gspn
-//             auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//             for (auto& place : gspn.getPlaces()) {
-//                 expressionManager->declareIntegerVariable(place.getName());
-//             }
-//
-//             // parse formula
-//             storm::parser::FormulaParser formulaParser(expressionManager);
-//             auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//             auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//             // create empty state labeling
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//             storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//             std::cout << '\n';
-//             std::cout << "build labeling:\n";
-//             for (auto& atomicFormula : atomicFormulas) {
-//                 std::cout << atomicFormula;
-//                 auto label = atomicFormula->toString();
-//                 labeling.addLabel(label);
-//
-//                 for (auto statePair : markings) {
-//                     auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                     for (auto& place : gspn.getPlaces()) {
-//                         auto variable = expressionManager->getVariable(place.getName());
-//                         expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                     }
-//                     bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                     if (hold) {
-//                         labeling.addLabelToState(label, statePair.second);
-//                     }
-//                 }
-//
-//             }
-//
-//             //auto labeling = getStateLabeling();
-//
-//             return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         const& partitions, storm::gspn::Marking const& currentMarking) {
-//             for (auto& partition : partitions) {
-//                 std::cout << "\tnew partition:\n";
-//                 auto accWeight = getAccumulatedWeight(partition);
-//                 std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                 std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                 for (auto& trans : partition) {
-//                     std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                     auto newMarking = trans.fire(currentMarking);
-//                     std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                     findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                     auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                     double currentWeight = 0;
-//                     if (it != weights.end()) {
-//                         currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                     }
-//                     currentWeight += trans.getWeight() / accWeight;
-//                     weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                 }
-//
-//                 addValuesToBuilder(weights);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//         enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//             std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//             for (auto& trans : enabledTimedTransitions) {
-//                 std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                 auto newMarking = trans.fire(currentMarking);
-//                 std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                 findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                 auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                 double currentWeightRate = 0;
-//                 if (it != rates.end()) {
-//                     currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                 }
-//                 currentWeightRate += trans.getRate() / accRate;
-//                 rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//             }
-//
-//             addValuesToBuilder(rates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//         storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//             for (auto& it : values) {
-//                 std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                 builder.addNextValue(currentRowIndex, it.first, it.second);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                 storm::gspn::Marking const& marking,
-//                 std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//             decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//             for (auto& trans : enabledImmediateTransitions) {
-//                 if (trans.noWeightAttached()) {
-//                     decltype(weightedTransitions) singleton;
-//                     singleton.push_back(trans);
-//                     result.push_back(singleton);
-//                 } else {
-//                     weightedTransitions.push_back(trans);
-//                 }
-//             }
-//
-//             if (weightedTransitions.size() != 0) {
-//                 result.push_back(weightedTransitions);
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const&
-//         vector) const {
-//             double result = 0;
-//
-//             for (auto &trans : vector) {
-//                 result += trans.getWeight();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//             uint_fast64_t sum = 0;
-//             for (auto& place : gspn.getPlaces()) {//TODO
-//                 numberOfBits[place.getID()] = 1;
-//                 sum += numberOfBits[place.getID()];
-//             }
-//
-//             // compute next multiple of 64
-//             uint_fast64_t rem = sum % 64;
-//             numberOfTotalBits = sum + 64 - rem;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getTimedTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getImmediateTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//             double result = 0;
-//             for (auto trans : vector) {
-//                 result += trans.getRate();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//             for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                 if (std::get<1>(*it) == index) {
-//                     return std::get<0>(*it);
-//                 }
-//             }
-//             return storm::storage::BitVector();
-//         }
-//
-//         template<typename ValueType>
-//         uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//             auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//             if (index == nextRowGroupIndex) {
-//                 // bitvector was not already in the map
-//                 ++nextRowGroupIndex;
-//                 // bitvector was also never in the todo list
-//                 todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//             }
-//             return index;
-//         }
-//
-//         template<typename ValueType>
-//         storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//             std::map<uint_fast64_t , std::string> idToName;
-//             for (auto& place : gspn.getPlaces()) {
-//                 idToName[place.getID()] = place.getName();
-//                 labeling.addLabel(place.getName());
-//             }
-//
-//             auto it = markings.begin();
-//             for ( ; it != markings.end() ; ++it) {
-//                 auto bitvector = std::get<0>(*it);
-//                 storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                 for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                     if (marking.getNumberOfTokensAt(i) > 0) {
-//                         std::cout << i << '\n';
-//                         labeling.addLabelToState(idToName.at(i), i);
-//                     }
-//                 }
-//             }
-//
-//             return labeling;
-//         }
-//
-//         template class ExplicitGspnModelBuilder<double>;
-//     }
-// }
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+
+namespace storm {
+namespace builder {
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t defaultNumberOfBits)
+    : gspn(gspn), totalNumberOfBits(0) {
+    STORM_LOG_THROW(defaultNumberOfBits > 0 && defaultNumberOfBits < 64, storm::exceptions::InvalidArgumentException,
+                    "Invalid number of bits for places without capacity: " << defaultNumberOfBits << ".");
+    uint64_t numberOfPlaces = gspn.getNumberOfPlaces();
+    placeOffsets.resize(numberOfPlaces);
+    placeBits.resize(numberOfPlaces);
+    placeCapacities.resize(numberOfPlaces);
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() < numberOfPlaces, "Unexpected place id " << place.getID() << ".");
+        uint64_t bits = defaultNumberOfBits;
+        uint64_t capacity = (1ull << bits) - 1;
+        if (place.hasRestrictedCapacity()) {
+            capacity = place.getCapacity();
+            bits = 1;
+            while (bits < 64 && (capacity >> bits) > 0) {
+                ++bits;
+            }
+        }
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= capacity, storm::exceptions::InvalidModelException,
+                        "The initial number of tokens of place '" << place.getName() << "' exceeds its capacity.");
+        placeOffsets[place.getID()] = totalNumberOfBits;
+        placeBits[place.getID()] = bits;
+        placeCapacities[place.getID()] = capacity;
+        totalNumberOfBits += bits;
+    }
+
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        immediateTransitions.push_back(createTransitionInfo(transition));
+    }
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        STORM_LOG_THROW(!transition.hasInfiniteServerSemantics() || !transition.getInputPlaces().empty(), storm::exceptions::InvalidModelException,
+                        "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+        timedTransitions.push_back(createTransitionInfo(transition));
+    }
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addLabel(std::string const& name, storm::expressions::Expression const& expression) {
+    STORM_LOG_THROW(name != "init" && name != "deadlock", storm::exceptions::InvalidArgumentException, "The label '" << name << "' is reserved.");
+    labels.emplace_back(name, expression);
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::TransitionInfo ExplicitGspnModelBuilder<ValueType>::createTransitionInfo(
+    storm::gspn::Transition const& transition) const {
+    TransitionInfo result;
+    std::map<uint64_t, int64_t> tokenChanges;
+    for (auto const& inputPlace : transition.getInputPlaces()) {
+        result.inputArcs.emplace_back(placeOffsets[inputPlace.first], placeBits[inputPlace.first], inputPlace.second);
+        tokenChanges[inputPlace.first] -= static_cast<int64_t>(inputPlace.second);
+    }
+    for (auto const& inhibitionPlace : transition.getInhibitionPlaces()) {
+        result.inhibitionArcs.emplace_back(placeOffsets[inhibitionPlace.first], placeBits[inhibitionPlace.first], inhibitionPlace.second);
+    }
+    for (auto const& outputPlace : transition.getOutputPlaces()) {
+        tokenChanges[outputPlace.first] += static_cast<int64_t>(outputPlace.second);
+    }
+    for (auto const& change : tokenChanges) {
+        if (change.second != 0) {
+            result.tokenChanges.push_back(change);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(TransitionInfo const& transition, storm::storage::BitVector const& marking) const {
+    for (auto const& arc : transition.inputArcs) {
+        if (marking.getAsInt(std::get<0>(arc), std::get<1>(arc)) < std::get<2>(arc)) {
+            return false;
+        }
+    }
+    for (auto const& arc : transition.inhibitionArcs) {
+        if (marking.getAsInt(std::get<0>(arc), std::get<1>(arc)) >= std::get<2>(arc)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getEnablingDegree(storm::gspn::TimedTransition<storm::gspn::GSPN::RateType> const& transition,
+                                                                TransitionInfo const& info, storm::storage::BitVector const& marking) const {
+    if (transition.hasSingleServerSemantics()) {
+        return 1;
+    }
+    uint64_t result = transition.hasKServerSemantics() ? transition.getNumberOfServers() : std::numeric_limits<uint64_t>::max();
+    for (auto const& arc : info.inputArcs) {
+        result = std::min(result, marking.getAsInt(std::get<0>(arc), std::get<1>(arc)) / std::get<2>(arc));
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::fire(TransitionInfo const& transition, storm::storage::BitVector const& marking) const {
+    storm::storage::BitVector result = marking;
+    for (auto const& change : transition.tokenChanges) {
+        uint64_t const offset = placeOffsets[change.first];
+        uint64_t const bits = placeBits[change.first];
+        uint64_t tokens = marking.getAsInt(offset, bits);
+        // Input arcs are checked for enabledness, so only output arcs can exceed the capacity.
+        STORM_LOG_ASSERT(change.second > 0 || tokens >= static_cast<uint64_t>(-change.second), "Firing a transition that is not enabled.");
+        tokens += change.second;
+        STORM_LOG_THROW(tokens <= placeCapacities[change.first], storm::exceptions::InvalidModelException,
+                        "The number of tokens of place '" << gspn.getPlace(change.first)->getName() << "' exceeds its capacity.");
+        result.setFromInt(offset, bits, tokens);
+    }
+    return result;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::findOrAddMarking(storm::storage::BitVector const& marking) {
+    uint64_t newIndex = markingToIndex.size();
+    uint64_t index = markingToIndex.findOrAdd(marking, newIndex);
+    if (index == newIndex) {
+        markingsToExplore.emplace_back(marking, index);
+    }
+    return index;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+    // The hash map requires the size of the keys to be a multiple of 64.
+    uint64_t bucketSize = std::max<uint64_t>(64, ((totalNumberOfBits + 63) / 64) * 64);
+    markingToIndex = storm::storage::BitVectorHashMap<uint64_t>(bucketSize);
+    markingsToExplore.clear();
+
+    storm::storage::BitVector initialMarking(bucketSize);
+    for (auto const& place : gspn.getPlaces()) {
+        initialMarking.setFromInt(placeOffsets[place.getID()], placeBits[place.getID()], place.getNumberOfInitialTokens());
+    }
+    findOrAddMarking(initialMarking);
+
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, true, 0);
+    std::vector<ValueType> exitRates;
+    std::vector<uint64_t> markovianStates;
+    std::vector<uint64_t> deadlockStates;
+    // The partitions are sorted by descending priority.
+    auto const& partitions = gspn.getPartitions();
+    uint64_t currentRow = 0;
+    std::map<uint64_t, ValueType> row;
+
+    while (!markingsToExplore.empty()) {
+        storm::storage::BitVector marking = std::move(markingsToExplore.front().first);
+        uint64_t markingIndex = markingsToExplore.front().second;
+        markingsToExplore.pop_front();
+        matrixBuilder.newRowGroup(currentRow);
+
+        // Add one choice for each partition of the highest priority with an enabled transition.
+        bool hasImmediateChoice = false;
+        uint64_t enabledPriority = 0;
+        for (auto const& partition : partitions) {
+            if (hasImmediateChoice && partition.priority < enabledPriority) {
+                break;
+            }
+            row.clear();
+            ValueType totalWeight = storm::utility::zero<ValueType>();
+            for (auto const& transitionId : partition.transitions) {
+                auto const& transition = gspn.getImmediateTransitions()[transitionId];
+                if (transition.noWeightAttached() || !isEnabled(immediateTransitions[transitionId], marking)) {
+                    continue;
+                }
+                ValueType weight = storm::utility::convertNumber<ValueType>(transition.getWeight());
+                row[findOrAddMarking(fire(immediateTransitions[transitionId], marking))] += weight;
+                totalWeight += weight;
+            }
+            if (!row.empty()) {
+                for (auto const& entry : row) {
+                    matrixBuilder.addNextValue(currentRow, entry.first, entry.second / totalWeight);
+                }
+                ++currentRow;
+                hasImmediateChoice = true;
+                enabledPriority = partition.priority;
+            }
+        }
+        if (hasImmediateChoice) {
+            exitRates.push_back(storm::utility::zero<ValueType>());
+            continue;
+        }
+
+        // Otherwise, the timed transitions race against each other.
+        row.clear();
+        ValueType exitRate = storm::utility::zero<ValueType>();
+        for (uint64_t transitionId = 0; transitionId < timedTransitions.size(); ++transitionId) {
+            auto const& transition = gspn.getTimedTransitions()[transitionId];
+            if (storm::utility::isZero(transition.getRate()) || !isEnabled(timedTransitions[transitionId], marking)) {
+                continue;
+            }
+            ValueType rate = storm::utility::convertNumber<ValueType>(transition.getRate()) *
+                             storm::utility::convertNumber<ValueType>(getEnablingDegree(transition, timedTransitions[transitionId], marking));
+            row[findOrAddMarking(fire(timedTransitions[transitionId], marking))] += rate;
+            exitRate += rate;
+        }
+        if (row.empty()) {
+            // Markings without enabled transitions get a Markovian self-loop.
+            deadlockStates.push_back(markingIndex);
+            row[markingIndex] = storm::utility::one<ValueType>();
+            exitRate = storm::utility::one<ValueType>();
+        }
+        for (auto const& entry : row) {
+            matrixBuilder.addNextValue(currentRow, entry.first, entry.second / exitRate);
+        }
+        ++currentRow;
+        exitRates.push_back(exitRate);
+        markovianStates.push_back(markingIndex);
+    }
+
+    uint64_t numberOfStates = markingToIndex.size();
+    storm::models::sparse::StateLabeling stateLabeling(numberOfStates);
+    stateLabeling.addLabel("init");
+    stateLabeling.addLabelToState("init", 0);
+    stateLabeling.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates));
+    if (!labels.empty()) {
+        storm::expressions::ExpressionEvaluator<double> evaluator(*gspn.getExpressionManager());
+        for (auto const& label : labels) {
+            stateLabeling.addLabel(label.first);
+        }
+        for (auto const& markingIndexPair : markingToIndex) {
+            for (auto const& place : gspn.getPlaces()) {
+                evaluator.setIntegerValue(gspn.getExpressionManager()->getVariable(place.getName()),
+                                          markingIndexPair.first.getAsInt(placeOffsets[place.getID()], placeBits[place.getID()]));
+            }
+            for (auto const& label : labels) {
+                if (evaluator.asBool(label.second)) {
+                    stateLabeling.addLabelToState(label.first, markingIndexPair.second);
+                }
+            }
+        }
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(currentRow, numberOfStates, numberOfStates), std::move(stateLabeling),
+                                                                  std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>>(),
+                                                                  false, storm::storage::BitVector(numberOfStates, markovianStates));
+    components.exitRates = std::move(exitRates);
+    return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
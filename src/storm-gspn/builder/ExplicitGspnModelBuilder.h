@@ -1,175 +1,97 @@
-// #ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-// #define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-// #include <string>
-//
-// #include "storm/models/sparse/MarkovAutomaton.h"
-// #include "storm/models/sparse/StandardRewardModel.h"
-// #include "storm/storage/BitVector.h"
-// #include "storm/storage/BitVectorHashMap.h"
-// #include "storm/storage/gspn/GSPN.h"
-// #include "storm/storage/gspn/ImmediateTransition.h"
-// #include "storm/storage/gspn/TimedTransition.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         /*!
-//          * This class provides the facilities for building an markov automaton.
-//          */
-//         template<typename ValueType=double>
-//         class ExplicitGspnModelBuilder {
-//         public:
-//
-//             /*!
-//              * Builds an MarkovAutomaton from the given GSPN.
-//              *
-//              * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//              * @return The resulting MarkovAutomaton
-//              */
-//             storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//         private:
-//
-//             /*!
-//              * Add for each partition a new row in the probability matrix.
-//              *
-//              * @param partitions The partitioned immediate transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              */
-//             void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//             storm::gspn::Marking const& currentMarking);
-//
-//
-//             /*!
-//              * Add row for a markovian state.
-//              *
-//              * @param enabledTimedTransitions List of enabled timed transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              * @param accRate The sum of all rates of the enabled timed transisitons
-//              */
-//             void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//             storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//             /*!
-//              * Struct for comparing unsigned integer for maps
-//              */
-//             struct cmpByIndex {
-//                 bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                     return a < b;
-//                 }
-//             };
-//
-//             /*!
-//              * This method insert the values from a map into the matrix
-//              *
-//              * @param values The values which are inserted
-//              */
-//             void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//             /*!
-//              * This method partitions all enabled immediate transitions w.r.t. a marking.
-//              * All enabled weighted immediate transitions are in one vector. Between these transitions
-//              * is chosen probabilistically by the weights.
-//              *
-//              * All other enabled non-weighted immediate transitions are in an singleton vector.
-//              * Between different vectors is chosen non-deterministically.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//              * @return The vector of vectors which is described above.
-//              */
-//             std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//             const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//             /*!
-//              * Computes the accumulated weight of immediate transisions which are stored in a list.
-//              *
-//              * @param vector List of immediate transisitions.
-//              */
-//             double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//             /*!
-//              * Compute the upper bound for the number of tokens in each place.
-//              * Also computes the number of bits which are used to store a marking.
-//              *
-//              * @param gspn The corresponding gspn.
-//              */
-//             void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//             /*!
-//              * Returns the vector of enabled timed transition with the highest priority.
-//              *
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled timed transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Returns the vector of active immediate transition with the highest priority.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled immediate transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Computes the accumulated rate of a vector of timed transitions.
-//              *
-//              * @param vector The vector of timed transitions.
-//              * @return The accumulated rate.
-//              */
-//             double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//             // is only needed for debugging purposes
-//             // since markings is injective, we can determine the bitvector
-//             storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//             /*!
-//              * Adds the bitvector to the marking-map.
-//              * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//              *
-//              * @return The rowGroup index for the bitvector.
-//              */
-//             uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//             /*!
-//              * Computes the state labeling and returns it.
-//              * Every state is labeled with its name.
-//              *
-//              * @return The computed state labeling.
-//              */
-//             storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//             // contains the number of bits which are used the store the number of tokens at each place
-//             std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//             // contains the number of bits used to create markings
-//             uint_fast64_t numberOfTotalBits;
-//
-//             // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//             storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//             // a list of markings for which the outgoing edges need to be computed
-//             std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//             //the gspn which is transformed
-//             storm::gspn::GSPN gspn;
-//
-//             // the next index for a new rowgroup
-//             uint_fast64_t nextRowGroupIndex = 0;
-//
-//             // builder object which is used to create the probability matrix
-//             storm::storage::SparseMatrixBuilder<double> builder;
-//
-//             // contains the current row index during the computation
-//             uint_fast64_t currentRowIndex;
-//         };
-//     }
-// }
-//
-// #endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the Markov automaton of a GSPN directly from the net, i.e., without translating the net to a JANI model first.
+ * The semantics coincides with the one of the JANI translation (see JaniGSPNBuilder):
+ * - Immediate transitions take precedence over timed ones (maximal progress). Among the immediate transitions, only the partitions of the
+ *   highest priority that has an enabled transition are considered. Every such partition yields one nondeterministic choice in which the
+ *   enabled (weighted) transitions are selected with a probability proportional to their weight.
+ * - Timed transitions race against each other. Their rates are multiplied by the enabling degree for k-server and infinite-server semantics.
+ * - Markings without enabled transitions get a Markovian self-loop.
+ *
+ * Markings are stored as packed bit vectors in which each place occupies just enough bits for its capacity.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given GSPN, which has to outlive the builder.
+     *
+     * @param gspn The GSPN to build the Markov automaton for.
+     * @param defaultNumberOfBits The number of bits used to store the tokens of places without a restricted capacity.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t defaultNumberOfBits = 32);
+
+    /*!
+     * Adds a state label to the resulting model that holds in all markings satisfying the given expression. The expression may only refer
+     * to the (integer) variables representing the places of the GSPN.
+     */
+    void addLabel(std::string const& name, storm::expressions::Expression const& expression);
+
+    /*!
+     * Explores the reachable markings of the GSPN and builds the resulting Markov automaton.
+     * Besides the added labels, the states are labeled with "init" and "deadlock".
+     */
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> build();
+
+   private:
+    /*!
+     * The arcs of a transition preprocessed for the packed representation of markings.
+     */
+    struct TransitionInfo {
+        // The (offset, width, multiplicity) of all input and inhibition arcs, respectively.
+        std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> inputArcs;
+        std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> inhibitionArcs;
+        // The places whose number of tokens changes when firing the transition, together with the (non-zero) change.
+        std::vector<std::pair<uint64_t, int64_t>> tokenChanges;
+    };
+
+    TransitionInfo createTransitionInfo(storm::gspn::Transition const& transition) const;
+    bool isEnabled(TransitionInfo const& transition, storm::storage::BitVector const& marking) const;
+    uint64_t getEnablingDegree(storm::gspn::TimedTransition<storm::gspn::GSPN::RateType> const& transition, TransitionInfo const& info,
+                               storm::storage::BitVector const& marking) const;
+    storm::storage::BitVector fire(TransitionInfo const& transition, storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Retrieves the index of the given marking. New markings are assigned a fresh index and scheduled for exploration.
+     */
+    uint64_t findOrAddMarking(storm::storage::BitVector const& marking);
+
+    storm::gspn::GSPN const& gspn;
+
+    // For every place (by id), the offset and the number of bits in the packed markings.
+    std::vector<uint64_t> placeOffsets;
+    std::vector<uint64_t> placeBits;
+    // For every place (by id), the maximal number of tokens that fits into its bits (or its capacity).
+    std::vector<uint64_t> placeCapacities;
+    uint64_t totalNumberOfBits;
+
+    std::vector<TransitionInfo> immediateTransitions;
+    std::vector<TransitionInfo> timedTransitions;
+
+    std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
+
+    storm::storage::BitVectorHashMap<uint64_t> markingToIndex;
+    // The markings that still need to be explored, in the order of their indices.
+    std::deque<std::pair<storm::storage::BitVector, uint64_t>> markingsToExplore;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -19,6 +19,7 @@
 
 #include "storm-pars/transformer/SparseParametricMdpSimplifier.h"
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
+#include "storm-pars/utility/ModelInstantiator.h"
 #include "storm-pars/derivative/GradientDescentMethod.h"
 
 #include "storm-parsers/parser/KeyValueParser.h"
@@ -430,8 +431,71 @@ namespace storm {
             }
         }
 
-        template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
+        template <typename ValueType>
+        std::vector<storm::utility::parametric::Valuation<ValueType>> getSampleValuations(SampleInformation<ValueType> const& samples) {
+            std::vector<storm::utility::parametric::Valuation<ValueType>> result;
+            storm::utility::parametric::Valuation<ValueType> valuation;
+
+            std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
+            std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
+            std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+
+            for (auto const& product : samples.cartesianProducts) {
+                parameters.clear();
+                iterators.clear();
+                iteratorEnds.clear();
+
+                for (auto const& entry : product) {
+                    parameters.push_back(entry.first);
+                    iterators.push_back(entry.second.cbegin());
+                    iteratorEnds.push_back(entry.second.cend());
+                }
+
+                bool done = false;
+                while (!done) {
+                    // Read off valuation.
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        valuation[parameters[i]] = *iterators[i];
+                    }
+                    result.push_back(valuation);
+
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        ++iterators[i];
+                        if (iterators[i] == iteratorEnds[i]) {
+                            // Reset iterator and proceed to move next iterator.
+                            iterators[i] = product.at(parameters[i]).cbegin();
+
+                            // If the last iterator was removed, we are done.
+                            if (i == parameters.size() - 1) {
+                                done = true;
+                            }
+                        } else {
+                            // If an iterator was moved but not reset, we have another valuation to check.
+                            break;
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+
+        template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ConstantModelType, typename ValueType, typename SolveValueType = double>
         void verifyPropertiesAtSamplePoints(ModelType const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
+            std::vector<storm::utility::parametric::Valuation<ValueType>> valuations = getSampleValuations(samples);
+
+            // Unless all instantiations are known to be graph preserving, we separate the valuations that keep the graph of the model from those
+            // that do not. The former share the graph analysis (and are solved together if possible), the latter are analyzed one by one.
+            storm::storage::BitVector graphPreservingValuations(valuations.size(), true);
+            if (!samples.graphPreserving) {
+                storm::utility::ModelInstantiator<ModelType, ConstantModelType> instantiator(model);
+                graphPreservingValuations = instantiator.getGraphPreservingValuations(valuations);
+                STORM_PRINT_AND_LOG(graphPreservingValuations.getNumberOfSetBits() << " of " << valuations.size() << " sample points preserve the graph of the model.\n");
+            }
+            std::vector<storm::utility::parametric::Valuation<ValueType>> preservingValuations;
+            std::vector<storm::utility::parametric::Valuation<ValueType>> otherValuations;
+            for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+                (graphPreservingValuations.get(valuationIndex) ? preservingValuations : otherValuations).push_back(valuations[valuationIndex]);
+            }
 
             // When samples are provided, we create an instantiation model checker.
             ModelCheckerType<ModelType, SolveValueType> modelchecker(model);
@@ -439,63 +503,32 @@ namespace storm {
             for (auto const& property : input.properties) {
                 storm::cli::printModelCheckingProperty(property);
 
-                modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
-                modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
-
-                storm::utility::parametric::Valuation<ValueType> valuation;
-
-                std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
-
                 storm::utility::Stopwatch watch(true);
-                for (auto const& product : samples.cartesianProducts) {
-                    parameters.clear();
-                    iterators.clear();
-                    iteratorEnds.clear();
-
-                    for (auto const& entry : product) {
-                        parameters.push_back(entry.first);
-                        iterators.push_back(entry.second.cbegin());
-                        iteratorEnds.push_back(entry.second.cend());
-                    }
-
-                    bool done = false;
-                    while (!done) {
-                        // Read off valuation.
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            valuation[parameters[i]] = *iterators[i];
-                        }
-
-                        storm::utility::Stopwatch valuationWatch(true);
-                        std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                        valuationWatch.stop();
-
-                        if (result) {
-                            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
-                        }
-                        printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
-
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            ++iterators[i];
-                            if (iterators[i] == iteratorEnds[i]) {
-                                // Reset iterator and proceed to move next iterator.
-                                iterators[i] = product.at(parameters[i]).cbegin();
-
-                                // If the last iterator was removed, we are done.
-                                if (i == parameters.size() - 1) {
-                                    done = true;
-                                }
-                            } else {
-                                // If an iterator was moved but not reset, we have another valuation to check.
-                                break;
-                            }
-                        }
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> preservingResults;
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> otherResults;
+                if (!preservingValuations.empty()) {
+                    modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
+                    modelchecker.setInstantiationsAreGraphPreserving(true);
+                    preservingResults = modelchecker.checkBatch(Environment(), preservingValuations);
+                }
+                if (!otherValuations.empty()) {
+                    // Specifying the formula again drops the results of the graph analysis for the graph preserving valuations.
+                    modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
+                    modelchecker.setInstantiationsAreGraphPreserving(false);
+                    otherResults = modelchecker.checkBatch(Environment(), otherValuations);
+                }
+                watch.stop();
 
+                auto preservingResultIt = preservingResults.begin();
+                auto otherResultIt = otherResults.begin();
+                for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+                    std::unique_ptr<storm::modelchecker::CheckResult>& result = graphPreservingValuations.get(valuationIndex) ? *preservingResultIt++ : *otherResultIt++;
+                    if (result) {
+                        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
                     }
+                    printInitialStatesResult<ValueType>(result, nullptr, &valuations[valuationIndex]);
                 }
 
-                watch.stop();
                 STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << "\n\n");
             }
         }
@@ -503,11 +536,11 @@ namespace storm {
         template <typename ValueType, typename SolveValueType = double>
         void verifyPropertiesAtSamplePoints(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
             if (model->isOfType(storm::models::ModelType::Dtmc)) {
-                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
+                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<ValueType>, storm::models::sparse::Dtmc<SolveValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
             } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
-                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseCtmcInstantiationModelChecker, storm::models::sparse::Ctmc<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Ctmc<ValueType>>(), input, samples);
+                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseCtmcInstantiationModelChecker, storm::models::sparse::Ctmc<ValueType>, storm::models::sparse::Ctmc<SolveValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Ctmc<ValueType>>(), input, samples);
             } else if (model->isOfType(storm::models::ModelType::Mdp)) {
-                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseMdpInstantiationModelChecker, storm::models::sparse::Mdp<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
+                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseMdpInstantiationModelChecker, storm::models::sparse::Mdp<ValueType>, storm::models::sparse::Mdp<SolveValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sampling is currently only supported for DTMCs, CTMCs and MDPs.");
             }
@@ -656,20 +689,29 @@ namespace storm {
                     = storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>(*formulaWithoutBound);
                 modelChecker.specifyFormula(Environment(), checkTask);
 
-                for (auto const& parameter : vars) {
+                std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters(vars.begin(), vars.end());
+                auto results = modelChecker.checkMultipleParameters(Environment(), instantiation, parameters);
+                for (auto const& parameter : parameters) {
                     std::cout << "Derivative w.r.t. " << parameter << ": ";
-                    
-                    auto result = modelChecker.check(Environment(), instantiation, parameter);
-                    std::cout << *result << '\n';
+                    std::cout << *results.at(parameter) << '\n';
                 }
                 return;
             } else if (derSettings.isFeasibleInstantiationSearchSet()) {
                 STORM_PRINT("Finding an extremum using Gradient Descent\n");
                 storm::utility::Stopwatch derivativeWatch(true);
-                storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double> derivativeChecker(*dtmc, *method, derSettings.getLearningRate(), derSettings.getAverageDecay(), derSettings.getSquaredAverageDecay(), derSettings.getMiniBatchSize(), derSettings.getTerminationEpsilon(), startPoint, *constraintMethod, derSettings.isPrintJsonSet());
+                uint64_t numberOfThreads = derSettings.getNumberOfDescentThreads();
+                STORM_LOG_WARN_COND(numberOfThreads <= 1 || !derSettings.isPrintJsonSet(), "Printing the run as json is not supported for concurrent gradient descents. Continuing with a single thread.");
+                if (derSettings.isPrintJsonSet()) {
+                    numberOfThreads = 1;
+                }
+                std::vector<std::unique_ptr<storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double>>> derivativeCheckers;
                 storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> checkTask(*formula);
-                derivativeChecker.specifyFormula(Environment(), checkTask);
-                auto instantiationAndValue = derivativeChecker.gradientDescent(Environment());
+                for (uint64_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+                    derivativeCheckers.push_back(std::make_unique<storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double>>(*dtmc, *method, derSettings.getLearningRate(), derSettings.getAverageDecay(), derSettings.getSquaredAverageDecay(), derSettings.getMiniBatchSize(), derSettings.getTerminationEpsilon(), startPoint, *constraintMethod, derSettings.isPrintJsonSet()));
+                    derivativeCheckers.back()->specifyFormula(Environment(), checkTask);
+                }
+                auto& derivativeChecker = *derivativeCheckers.front();
+                auto instantiationAndValue = numberOfThreads > 1 ? storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double>::parallelGradientDescent(Environment(), derivativeCheckers) : derivativeChecker.gradientDescent(Environment());
                 if (!derSettings.areInconsequentialParametersOmitted() && omittedParameters) {
                     for (RationalFunctionVariable const& param : *omittedParameters) {
                         if (startPoint) {
@@ -711,7 +753,7 @@ namespace storm {
             storm::utility::Stopwatch monotonicityWatch(true);
             STORM_LOG_THROW(regions.size() <= 1, storm::exceptions::InvalidArgumentException, "Monotonicity analysis only allowed on single region");
             if (!monSettings.isMonSolutionSet()) {
-                auto monotonicityHelper = storm::analysis::MonotonicityHelper<ValueType, double>(model, formulas, regions, monSettings.getNumberOfSamples(), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision(), monSettings.isDotOutputSet());
+                auto monotonicityHelper = storm::analysis::MonotonicityHelper<ValueType, double>(model, formulas, regions, monSettings.getNumberOfSamples(), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision(), monSettings.isDotOutputSet(), monSettings.getNumberOfSamplesThreads());
                 if (monSettings.isExportMonotonicitySet()) {
                     monotonicityHelper.checkMonotonicityInBuild(outfile, monSettings.isUsePLABoundsSet(), monSettings.getDotOutputFilename());
                 } else {
@@ -862,7 +904,7 @@ namespace storm {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, regionSettings.getNumberOfRefinementThreads());
                     return result;
                 };
             } else {
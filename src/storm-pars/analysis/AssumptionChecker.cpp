@@ -11,6 +11,7 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/VariableExpression.h"
 #include "storm/storage/expressions/RationalFunctionToExpression.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 namespace storm {
@@ -22,12 +23,15 @@ namespace storm {
         }
 
         template <typename ValueType, typename ConstantType>
-        void AssumptionChecker<ValueType, ConstantType>::initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples) {
+        void AssumptionChecker<ValueType, ConstantType>::initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples, uint64_t numberOfThreads) {
             // Create sample points
             auto instantiator = utility::ModelInstantiator<models::sparse::Dtmc<ValueType>, models::sparse::Dtmc<ConstantType>>(*model);
             auto matrix = model->getTransitionMatrix();
             std::set<VariableType> variables = models::sparse::getProbabilityParameters(*model);
 
+            // The sample models are instantiated one after another, and checked in batches of one model per thread.
+            numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+            std::vector<models::sparse::Dtmc<ConstantType>> sampleModels;
             for (uint_fast64_t i = 0; i < numberOfSamples; ++i) {
                 auto valuation = utility::parametric::Valuation<ValueType>();
                 for (auto var: variables) {
@@ -37,30 +41,48 @@ namespace storm {
                     auto val = std::pair<VariableType, CoefficientType>(var, (lb + utility::convertNumber<CoefficientType>(i / (numberOfSamples - 1)) * (ub - lb)));
                     valuation.insert(val);
                 }
-                models::sparse::Dtmc<ConstantType> sampleModel = instantiator.instantiate(valuation);
-                auto checker = modelchecker::SparseDtmcPrctlModelChecker<models::sparse::Dtmc<ConstantType>>(sampleModel);
-                std::unique_ptr<modelchecker::CheckResult> checkResult;
-                if (formula->isProbabilityOperatorFormula() &&
-                    formula->asProbabilityOperatorFormula().getSubformula().isUntilFormula()) {
-                    const modelchecker::CheckTask<logic::UntilFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::UntilFormula, ConstantType>(
-                            (*formula).asProbabilityOperatorFormula().getSubformula().asUntilFormula());
-                    checkResult = checker.computeUntilProbabilities(Environment(), checkTask);
-                } else if (formula->isProbabilityOperatorFormula() &&
-                           formula->asProbabilityOperatorFormula().getSubformula().isEventuallyFormula()) {
-                    const modelchecker::CheckTask<logic::EventuallyFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::EventuallyFormula, ConstantType>(
-                            (*formula).asProbabilityOperatorFormula().getSubformula().asEventuallyFormula());
-                    checkResult = checker.computeReachabilityProbabilities(Environment(), checkTask);
-                } else {
-                    STORM_LOG_THROW(false, exceptions::NotSupportedException,
-                                    "Expecting until or eventually formula");
+                sampleModels.push_back(instantiator.instantiate(valuation));
+                if (sampleModels.size() == numberOfThreads || i + 1 == numberOfSamples) {
+                    for (auto& values : computeSampleValues(formula, sampleModels, numberOfThreads)) {
+                        samples.push_back(std::move(values));
+                    }
+                    sampleModels.clear();
                 }
-                auto quantitativeResult = checkResult->asExplicitQuantitativeCheckResult<ConstantType>();
-                std::vector<ConstantType> values = quantitativeResult.getValueVector();
-                samples.push_back(values);
             }
             useSamples = true;
         }
 
+        template <typename ValueType, typename ConstantType>
+        std::vector<std::vector<ConstantType>> AssumptionChecker<ValueType, ConstantType>::computeSampleValues(std::shared_ptr<logic::Formula const> formula, std::vector<models::sparse::Dtmc<ConstantType>> const& sampleModels, uint64_t numberOfThreads) {
+            std::vector<std::vector<ConstantType>> result(sampleModels.size());
+            if (!std::is_same<ConstantType, double>::value) {
+                // Exact numbers are not shared across threads.
+                numberOfThreads = 1;
+            }
+            storm::utility::parallel::forEachChunk(numberOfThreads, sampleModels.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    auto checker = modelchecker::SparseDtmcPrctlModelChecker<models::sparse::Dtmc<ConstantType>>(sampleModels[index]);
+                    std::unique_ptr<modelchecker::CheckResult> checkResult;
+                    if (formula->isProbabilityOperatorFormula() &&
+                        formula->asProbabilityOperatorFormula().getSubformula().isUntilFormula()) {
+                        const modelchecker::CheckTask<logic::UntilFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::UntilFormula, ConstantType>(
+                                (*formula).asProbabilityOperatorFormula().getSubformula().asUntilFormula());
+                        checkResult = checker.computeUntilProbabilities(Environment(), checkTask);
+                    } else if (formula->isProbabilityOperatorFormula() &&
+                               formula->asProbabilityOperatorFormula().getSubformula().isEventuallyFormula()) {
+                        const modelchecker::CheckTask<logic::EventuallyFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::EventuallyFormula, ConstantType>(
+                                (*formula).asProbabilityOperatorFormula().getSubformula().asEventuallyFormula());
+                        checkResult = checker.computeReachabilityProbabilities(Environment(), checkTask);
+                    } else {
+                        STORM_LOG_THROW(false, exceptions::NotSupportedException,
+                                        "Expecting until or eventually formula");
+                    }
+                    result[index] = std::move(checkResult->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
+                }
+            });
+            return result;
+        }
+
         template <typename ValueType, typename ConstantType>
         void AssumptionChecker<ValueType, ConstantType>::setSampleValues(std::vector<std::vector<ConstantType>> samples) {
             this->samples = samples;
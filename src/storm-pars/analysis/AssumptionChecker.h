@@ -51,8 +51,20 @@ namespace storm {
              * @param model The considered model.
              * @param region The region of the model's parameters.
              * @param numberOfSamples Number of sample points.
+             * @param numberOfThreads Number of threads that check the sample points concurrently.
              */
-            void initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples);
+            void initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples, uint64_t numberOfThreads = 1);
+
+            /*!
+             * Computes the values of the given (until or eventually) formula for all states of the given sample models.
+             * If ConstantType is double, the sample models are checked concurrently.
+             *
+             * @param formula The formula to compute the values for.
+             * @param sampleModels The instantiated models.
+             * @param numberOfThreads Number of threads that check the sample models.
+             * @return For each sample model, the values of its states.
+             */
+            static std::vector<std::vector<ConstantType>> computeSampleValues(std::shared_ptr<logic::Formula const> formula, std::vector<models::sparse::Dtmc<ConstantType>> const& sampleModels, uint64_t numberOfThreads);
 
             /*!
              * Sets the sample values to the given vector and useSamples to true.
@@ -62,8 +62,8 @@ namespace storm {
         }
 
         template <typename ValueType, typename ConstantType>
-        void AssumptionMaker<ValueType, ConstantType>::initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples){
-            assumptionChecker.initializeCheckingOnSamples(formula, model, region, numberOfSamples);
+        void AssumptionMaker<ValueType, ConstantType>::initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples, uint64_t numberOfThreads){
+            assumptionChecker.initializeCheckingOnSamples(formula, model, region, numberOfSamples, numberOfThreads);
         }
 
         template <typename ValueType, typename ConstantType>
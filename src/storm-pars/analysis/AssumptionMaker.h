@@ -43,8 +43,9 @@ namespace storm {
              * @param model The considered model.
              * @param region The region of the model's parameters.
              * @param numberOfSamples Number of sample points.
+             * @param numberOfThreads Number of threads that check the sample points concurrently.
              */
-            void initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples);
+            void initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model, storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples, uint64_t numberOfThreads = 1);
 
             /*!
              * Sets the sample values to the given vector.
@@ -16,7 +16,7 @@ namespace storm {
     namespace analysis {
         /*** Constructor ***/
         template <typename ValueType, typename ConstantType>
-        MonotonicityHelper<ValueType, ConstantType>::MonotonicityHelper(std::shared_ptr<models::sparse::Model<ValueType>> model, std::vector<std::shared_ptr<logic::Formula const>> formulas, std::vector<storage::ParameterRegion<ValueType>> regions, uint_fast64_t numberOfSamples, double const& precision, bool dotOutput) : assumptionMaker(model->getTransitionMatrix()){
+        MonotonicityHelper<ValueType, ConstantType>::MonotonicityHelper(std::shared_ptr<models::sparse::Model<ValueType>> model, std::vector<std::shared_ptr<logic::Formula const>> formulas, std::vector<storage::ParameterRegion<ValueType>> regions, uint_fast64_t numberOfSamples, double const& precision, bool dotOutput, uint64_t numberOfThreads) : assumptionMaker(model->getTransitionMatrix()){
             assert (model != nullptr);
 
             this->model = model;
@@ -24,6 +24,7 @@ namespace storm {
             this->precision = utility::convertNumber<ConstantType>(precision);
             this->matrix = model->getTransitionMatrix();
             this->dotOutput = dotOutput;
+            this->numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
 
             if (regions.size() == 1) {
                 this->region = *(regions.begin());
@@ -266,57 +267,51 @@ namespace storm {
                 bool monIncr = true;
 
                 // Check monotonicity in variable (*itr) by instantiating the model
-                // all other variables fixed on lb, only increasing (*itr)
-                for (uint_fast64_t i = 0; (monDecr || monIncr) && i < numberOfSamples; ++i) {
-                    // Create valuation
-                    auto valuation = utility::parametric::Valuation<ValueType>();
-                    for (auto itr2 = variables.begin(); itr2 != variables.end(); ++itr2) {
-                        // Only change value for current variable
-                        if ((*itr) == (*itr2)) {
-                            auto lb = region.getLowerBoundary(itr->name());
-                            auto ub = region.getUpperBoundary(itr->name());
-                            // Creates samples between lb and ub, that is: lb, lb + (ub-lb)/(#samples -1), lb + 2* (ub-lb)/(#samples -1), ..., ub
-                            valuation[*itr2] = (lb + utility::convertNumber<CoefficientType>(i / (numberOfSamples - 1)) * (ub - lb));
-                        } else {
-                            auto lb = region.getLowerBoundary(itr2->name());
-                            valuation[*itr2] = utility::convertNumber<typename utility::parametric::CoefficientType<ValueType>::type>(lb);
+                // all other variables fixed on lb, only increasing (*itr).
+                // The sample models are instantiated one after another and checked in batches of one model per thread.
+                for (uint_fast64_t batchBegin = 0; (monDecr || monIncr) && batchBegin < numberOfSamples; batchBegin += numberOfThreads) {
+                    uint_fast64_t batchEnd = std::min<uint_fast64_t>(batchBegin + numberOfThreads, numberOfSamples);
+                    std::vector<models::sparse::Dtmc<ConstantType>> sampleModels;
+                    for (uint_fast64_t i = batchBegin; i < batchEnd; ++i) {
+                        // Create valuation
+                        auto valuation = utility::parametric::Valuation<ValueType>();
+                        for (auto itr2 = variables.begin(); itr2 != variables.end(); ++itr2) {
+                            // Only change value for current variable
+                            if ((*itr) == (*itr2)) {
+                                auto lb = region.getLowerBoundary(itr->name());
+                                auto ub = region.getUpperBoundary(itr->name());
+                                // Creates samples between lb and ub, that is: lb, lb + (ub-lb)/(#samples -1), lb + 2* (ub-lb)/(#samples -1), ..., ub
+                                valuation[*itr2] = (lb + utility::convertNumber<CoefficientType>(i / (numberOfSamples - 1)) * (ub - lb));
+                            } else {
+                                auto lb = region.getLowerBoundary(itr2->name());
+                                valuation[*itr2] = utility::convertNumber<typename utility::parametric::CoefficientType<ValueType>::type>(lb);
+                            }
                         }
+                        sampleModels.push_back(instantiator.instantiate(valuation));
                     }
 
-                    // Instantiate model and get result
-                    models::sparse::Dtmc<ConstantType> sampleModel = instantiator.instantiate(valuation);
-                    auto checker = modelchecker::SparseDtmcPrctlModelChecker<models::sparse::Dtmc<ConstantType>>(sampleModel);
-                    std::unique_ptr<modelchecker::CheckResult> checkResult;
-                    auto formula = formulas[0];
-                    if (formula->isProbabilityOperatorFormula() && formula->asProbabilityOperatorFormula().getSubformula().isUntilFormula()) {
-                        const modelchecker::CheckTask<logic::UntilFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::UntilFormula, ConstantType>((*formula).asProbabilityOperatorFormula().getSubformula().asUntilFormula());
-                        checkResult = checker.computeUntilProbabilities(Environment(), checkTask);
-                    } else if (formula->isProbabilityOperatorFormula() && formula->asProbabilityOperatorFormula().getSubformula().isEventuallyFormula()) {
-                        const modelchecker::CheckTask<logic::EventuallyFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::EventuallyFormula, ConstantType>((*formula).asProbabilityOperatorFormula().getSubformula().asEventuallyFormula());
-                        checkResult = checker.computeReachabilityProbabilities(Environment(), checkTask);
-                    } else {
-                        STORM_LOG_THROW(false, exceptions::NotSupportedException, "Expecting until or eventually formula");
-                    }
-
-                    auto quantitativeResult = checkResult->asExplicitQuantitativeCheckResult<ConstantType>();
-                    std::vector<ConstantType> values = quantitativeResult.getValueVector();
-                    auto initialStates = model->getInitialStates();
-                    ConstantType initial = 0;
-                    // Get total probability from initial states
-                    for (auto j = initialStates.getNextSetIndex(0); j < model->getNumberOfStates(); j = initialStates.getNextSetIndex(j + 1)) {
-                        initial += values[j];
-                    }
-                    // Calculate difference with result for previous valuation
-                    assert (initial >= 0 - precision && initial <= 1 + precision);
-                    ConstantType diff = previous - initial;
-                    assert (previous == -1 || (diff >= -1 - precision && diff <= 1 + precision));
-
-                    if (previous != -1 && (diff > precision || diff < -precision)) {
-                        monDecr &= diff > precision; // then previous value is larger than the current value from the initial states
-                        monIncr &= diff < -precision;
+                    // Get the results of the batch and compare them with the result for the previous valuation
+                    auto batchValues = AssumptionChecker<ValueType, ConstantType>::computeSampleValues(formulas[0], sampleModels, numberOfThreads);
+                    for (uint_fast64_t batchIndex = 0; (monDecr || monIncr) && batchIndex < batchValues.size(); ++batchIndex) {
+                        std::vector<ConstantType>& values = batchValues[batchIndex];
+                        auto initialStates = model->getInitialStates();
+                        ConstantType initial = 0;
+                        // Get total probability from initial states
+                        for (auto j = initialStates.getNextSetIndex(0); j < model->getNumberOfStates(); j = initialStates.getNextSetIndex(j + 1)) {
+                            initial += values[j];
+                        }
+                        // Calculate difference with result for previous valuation
+                        assert (initial >= 0 - precision && initial <= 1 + precision);
+                        ConstantType diff = previous - initial;
+                        assert (previous == -1 || (diff >= -1 - precision && diff <= 1 + precision));
+
+                        if (previous != -1 && (diff > precision || diff < -precision)) {
+                            monDecr &= diff > precision; // then previous value is larger than the current value from the initial states
+                            monIncr &= diff < -precision;
+                        }
+                        previous = initial;
+                        samples.push_back(std::move(values));
                     }
-                    previous = initial;
-                    samples.push_back(std::move(values));
                 }
                 auto res = (!monIncr && !monDecr) ? MonotonicityResult<VariableType>::Monotonicity::Not : MonotonicityResult<VariableType>::Monotonicity::Unknown;
                 resultCheckOnSamples.addMonotonicityResult(*itr, res);
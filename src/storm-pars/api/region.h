@@ -235,11 +235,20 @@ namespace storm {
          * @param allowModelSimplification
          * @param useMonotonicity
          * @param monThresh if given, determines at which depth to start using monotonicity
+         * @param numberOfThreads the number of threads that analyze regions concurrently. Each thread uses its own region model checker. Not supported in combination with monotonicity.
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfThreads = 1) {
             Environment env;
             bool preconditionsValidated = false;
+            STORM_LOG_WARN_COND(numberOfThreads <= 1 || !monotonicitySetting.useMonotonicity, "Parallel region refinement is not supported in combination with monotonicity. Continuing with a single thread.");
+            if (numberOfThreads > 1 && !monotonicitySetting.useMonotonicity) {
+                std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> regionCheckers;
+                for (uint64_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+                    regionCheckers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting));
+                }
+                return storm::modelchecker::RegionModelChecker<ValueType>::performParallelRegionRefinement(env, regionCheckers, region, coverageThreshold, refinementDepthThreshold, hypothesis);
+            }
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
         }
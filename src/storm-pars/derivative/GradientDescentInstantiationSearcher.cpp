@@ -13,10 +13,12 @@
 #include "settings/modules/GeneralSettings.h"
 #include "solver/helper/SoundValueIterationHelper.h"
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "utility/SignalHandler.h"
 #include "utility/graph.h"
 
@@ -323,9 +325,9 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
+            auto checkResults = derivativeEvaluationHelper->checkMultipleParameters(env, nesterovPredictedPosition, miniBatch, valueVector);
             for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+                ConstantType delta = checkResults.at(parameter)->getValueVector()[derivativeEvaluationHelper->getInitialState()];
                 if (currentCheckTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     currentCheckTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
@@ -376,6 +378,9 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
             STORM_LOG_WARN("Aborting Gradient Descent, returning non-optimal value.");
             break;
         }
+        if (isAbortRequested()) {
+            break;
+        }
     }
     return currentValue;
 }
@@ -405,7 +410,7 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
     std::random_device device;
     std::default_random_engine engine(device());
     std::uniform_real_distribution<> dist(0, 1);
-    bool initialGuess = true;
+    bool initialGuess = tryInitialGuess;
     std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> point;
     while (true) {
         STORM_PRINT_AND_LOG("Trying out a new starting point\n");
@@ -438,18 +443,7 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
         ConstantType prob = stochasticGradientDescent(env, point);
         stochasticWatch.stop();
 
-        bool isFoundPointBetter = false;
-        switch (this->currentCheckTask->getBound().comparisonType) {
-            case logic::ComparisonType::Greater:
-            case logic::ComparisonType::GreaterEqual:
-                isFoundPointBetter = prob > bestValue;
-                break;
-            case logic::ComparisonType::Less:
-            case logic::ComparisonType::LessEqual:
-                isFoundPointBetter = prob < bestValue;
-                break;
-        }
-        if (isFoundPointBetter) {
+        if (isBetterValue(prob, bestValue)) {
             bestInstantiation = point;
             bestValue = prob;
         }
@@ -457,7 +451,7 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
         if (currentCheckTask->getBound().isSatisfied(bestValue)) {
             STORM_PRINT_AND_LOG("Aborting because the bound is satisfied\n");
             break;
-        } else if (storm::utility::resources::isTerminate()) {
+        } else if (storm::utility::resources::isTerminate() || isAbortRequested()) {
             break;
         } else {
             if (constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC) {
@@ -483,6 +477,59 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
     return std::make_pair(bestInstantiation, bestValue);
 }
 
+template<typename FunctionType, typename ConstantType>
+std::pair<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>, ConstantType>
+GradientDescentInstantiationSearcher<FunctionType, ConstantType>::parallelGradientDescent(
+    Environment const& env, std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>>& searchers) {
+    STORM_LOG_THROW(!searchers.empty(), storm::exceptions::InvalidArgumentException, "Parallel gradient descent requires at least one searcher.");
+
+    // Raised as soon as one searcher found an instantiation that satisfies the bound.
+    std::atomic<bool> boundSatisfied(false);
+    std::vector<std::pair<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>, ConstantType>> results(searchers.size());
+    for (uint64_t index = 0; index < searchers.size(); ++index) {
+        searchers[index]->abortFlag = &boundSatisfied;
+        searchers[index]->tryInitialGuess = index == 0;
+    }
+
+    storm::utility::parallel::forEachChunk(searchers.size(), searchers.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t index = begin; index < end; ++index) {
+            auto& searcher = *searchers[index];
+            results[index] = searcher.gradientDescent(env);
+            if (searcher.currentCheckTask->getBound().isSatisfied(results[index].second)) {
+                boundSatisfied = true;
+            }
+        }
+    });
+
+    uint64_t bestIndex = 0;
+    for (uint64_t index = 0; index < searchers.size(); ++index) {
+        searchers[index]->abortFlag = nullptr;
+        searchers[index]->tryInitialGuess = true;
+        if (searchers.front()->isBetterValue(results[index].second, results[bestIndex].second)) {
+            bestIndex = index;
+        }
+    }
+    return std::move(results[bestIndex]);
+}
+
+template<typename FunctionType, typename ConstantType>
+bool GradientDescentInstantiationSearcher<FunctionType, ConstantType>::isAbortRequested() const {
+    return abortFlag != nullptr && abortFlag->load();
+}
+
+template<typename FunctionType, typename ConstantType>
+bool GradientDescentInstantiationSearcher<FunctionType, ConstantType>::isBetterValue(ConstantType const& value, ConstantType const& reference) const {
+    switch (this->currentCheckTask->getBound().comparisonType) {
+        case logic::ComparisonType::Greater:
+        case logic::ComparisonType::GreaterEqual:
+            return value > reference;
+        case logic::ComparisonType::Less:
+        case logic::ComparisonType::LessEqual:
+            return value < reference;
+    }
+    return false;
+}
+
 template<typename FunctionType, typename ConstantType>
 void GradientDescentInstantiationSearcher<FunctionType, ConstantType>::resetDynamicValues() {
     if (Adam* adam = boost::get<Adam>(&gradientDescentType)) {
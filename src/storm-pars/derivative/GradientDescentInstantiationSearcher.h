@@ -1,6 +1,7 @@
 #ifndef STORM_DERIVATIVECHECKER_H
 #define STORM_DERIVATIVECHECKER_H
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include "GradientDescentConstraintMethod.h"
@@ -169,6 +170,19 @@ class GradientDescentInstantiationSearcher {
               ConstantType>
     gradientDescent(Environment const& env);
 
+    /**
+     * Perform Gradient Descent with several searchers concurrently, one per thread. Only the first searcher starts with
+     * the initial guess, the others start from random points. All searchers stop as soon as one of them found an
+     * instantiation that satisfies the bound.
+     * @param env The environment. Pass the same environment as to specifyFormula.
+     * @param searchers The searchers. Each has to own its model and must have been given the same formula.
+     * @return The best instantiation found by any of the searchers and its value.
+     */
+    static std::pair<
+        std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>,
+        ConstantType>
+    parallelGradientDescent(Environment const& env, std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>>& searchers);
+
     /**
      * Print the previously done run as JSON. This run can be retrieved using getVisualizationWalk.
      */
@@ -188,6 +202,8 @@ class GradientDescentInstantiationSearcher {
 
    private:
     void resetDynamicValues();
+    bool isAbortRequested() const;
+    bool isBetterValue(ConstantType const& value, ConstantType const& reference) const;
 
     std::unique_ptr<modelchecker::CheckTask<storm::logic::Formula, FunctionType>> currentCheckTask;
     std::unique_ptr<modelchecker::CheckTask<storm::logic::Formula, FunctionType>> currentCheckTaskNoBound;
@@ -250,6 +266,11 @@ class GradientDescentInstantiationSearcher {
 
     ConstantType logarithmicBarrierTerm;
 
+    // Whether gradientDescent starts with the initial guess before trying random starting points.
+    bool tryInitialGuess = true;
+    // If set, gradientDescent stops once the flag is raised (by another searcher of a parallel descent).
+    std::atomic<bool> const* abortFlag = nullptr;
+
     ConstantType stochasticGradientDescent(
         Environment const& env,
         std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>& position);
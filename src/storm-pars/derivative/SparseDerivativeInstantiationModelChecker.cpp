@@ -39,6 +39,15 @@ template<typename FunctionType, typename ConstantType>
 std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
     boost::optional<std::vector<ConstantType>> const& valueVector) {
+    auto results = checkMultipleParameters(env, valuation, {parameter}, valueVector);
+    return std::move(results.at(parameter));
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::checkMultipleParameters(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, std::vector<VariableType<FunctionType>> const& parameters,
+    boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -58,59 +67,90 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
             interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
         }
     }
-    // Instantiate the matrices with the given instantiation
 
+    // Instantiate the equation system with the given instantiation. It is the same for all parameters.
     instantiationWatch.start();
-
-    // STORM_PRINT_AND_LOG(valuation << "\n");
-
-    // Write results into the placeholders
     for (auto& functionResult : this->functionsUnderived) {
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
-    for (auto& functionResult : this->functionsDerived.at(parameter)) {
-        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
-    }
-
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
-
-    // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMappingUnderived) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
-    for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
-        entryValuePair.first->setValue(*(entryValuePair.second));
-    }
+    instantiationWatch.stop();
 
-    std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
-    for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
-        instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
+    // All parameters share one solver for the equation system, so whatever the solver derives from the matrix (e.g. a decomposition
+    // or a converted copy) is computed only once per instantiation.
+    if (!linearEquationSolver) {
+        storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+        linearEquationSolver = factory.create(env);
+        linearEquationSolver->setCachingEnabled(true);
     }
+    linearEquationSolver->setMatrix(constrainedMatrixInstantiated);
+
+    // The right-hand sides of all parameters are collected (interleaved) such that the equation systems are solved together.
+    uint64_t const numberOfParameters = parameters.size();
+    uint64_t const numberOfRows = constrainedMatrixInstantiated.getRowCount();
+    std::vector<ConstantType> interleavedRightHandSides(numberOfRows * numberOfParameters);
+    std::vector<ConstantType> interleavedResults(numberOfRows * numberOfParameters);
+    for (uint64_t parameterIndex = 0; parameterIndex < numberOfParameters; ++parameterIndex) {
+        auto const& parameter = parameters[parameterIndex];
+        instantiationWatch.start();
+        for (auto& functionResult : this->functionsDerived.at(parameter)) {
+            functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+        }
 
-    instantiationWatch.stop();
+        auto const& deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
 
-    approximationWatch.start();
+        // Write the instantiated values to the matrices and vectors according to the stored mappings
+        for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
+            entryValuePair.first->setValue(*(entryValuePair.second));
+        }
 
-    std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
-    deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
-    for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
-        resultVec[i] += instantiatedDerivedOutputVec[i];
-    }
+        std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
+        for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
+            instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
+        }
 
-    // Here's where the real magic happens - the solver call!
-    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
-    auto solver = factory.create(env);
+        instantiationWatch.stop();
+
+        approximationWatch.start();
+
+        std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
+        deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
+        for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
+            resultVec[i] += instantiatedDerivedOutputVec[i];
+        }
 
-    // Calculate (1-M)^-1 * resultVec
-    // STORM_PRINT_AND_LOG(constrainedMatrixInstantiated << "\n");
-    // STORM_PRINT_AND_LOG("calling solver\n");
-    solver->setMatrix(constrainedMatrixInstantiated);
-    std::vector<ConstantType> finalResult(resultVec.size());
-    solver->solveEquations(env, finalResult, resultVec);
+        // Iterative solvers start from the derivative of the previous call, which is close to the solution if the instantiation changed only
+        // slightly (as it does between the steps of gradient descent).
+        STORM_LOG_ASSERT(resultVec.size() == numberOfRows, "The right-hand side has an unexpected size.");
+        std::vector<ConstantType>& previousResult = previousDerivatives[parameter];
+        previousResult.resize(resultVec.size(), storm::utility::zero<ConstantType>());
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            interleavedRightHandSides[row * numberOfParameters + parameterIndex] = resultVec[row];
+            interleavedResults[row * numberOfParameters + parameterIndex] = previousResult[row];
+        }
 
-    approximationWatch.stop();
+        approximationWatch.stop();
+    }
 
-    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+    // Calculate (1-M)^-1 * resultVec for all parameters at once.
+    if (numberOfParameters > 0) {
+        approximationWatch.start();
+        linearEquationSolver->solveEquations(env, interleavedResults, interleavedRightHandSides, numberOfParameters);
+        approximationWatch.stop();
+    }
+
+    std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> results;
+    for (uint64_t parameterIndex = 0; parameterIndex < numberOfParameters; ++parameterIndex) {
+        std::vector<ConstantType>& finalResult = previousDerivatives[parameters[parameterIndex]];
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            finalResult[row] = interleavedResults[row * numberOfParameters + parameterIndex];
+        }
+        results.emplace(parameters[parameterIndex], std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult));
+    }
+    linearEquationSolver->clearCache();
+    return results;
 }
 
 template<typename FunctionType, typename ConstantType>
@@ -119,6 +159,8 @@ void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::spec
     this->currentFormula = checkTask.getFormula().asSharedPointer();
     this->currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, FunctionType>>(
         checkTask.substituteFormula(*currentFormula).template convertValueType<FunctionType>());
+    this->linearEquationSolver.reset();
+    this->previousDerivatives.clear();
     this->parameters = storm::models::sparse::getProbabilityParameters(model);
     if (checkTask.getFormula().isRewardOperatorFormula()) {
         for (auto const& rewardParameter : storm::models::sparse::getRewardParameters(model)) {
@@ -46,7 +46,21 @@ class SparseDerivativeInstantiationModelChecker {
         Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
-    
+
+    /**
+     * checkMultipleParameters calculates the derivatives of the model w.r.t. several parameters at an instantiation.
+     * The equation system is instantiated once and its solver is shared by all parameters. Each solve starts from the
+     * derivative w.r.t. the same parameter that was computed by the previous call.
+     * Call specifyFormula first!
+     * @param env The environment. Pass the same environment for all calls.
+     * @param parameters The parameters to compute the derivatives for.
+     * @return The derivatives, indexed by parameter.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+    checkMultipleParameters(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                            std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+                            boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
@@ -60,6 +74,10 @@ class SparseDerivativeInstantiationModelChecker {
     std::set<typename utility::parametric::VariableType<FunctionType>::type> parameters;
     std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>>>
         linearEquationSolvers;
+    // The solver for the equation system, which is the same for all parameters.
+    std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>> linearEquationSolver;
+    // The derivatives computed by the last call, used as starting points for the next one.
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<ConstantType>> previousDerivatives;
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMappingUnderived;
     std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>> matrixMappingsDerived;
     std::unordered_map<FunctionType, ConstantType> functionsUnderived;
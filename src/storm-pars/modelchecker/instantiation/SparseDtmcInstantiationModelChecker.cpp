@@ -1,5 +1,12 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -10,6 +17,114 @@
 #include "storm/exceptions/InvalidStateException.h"
 namespace storm {
     namespace modelchecker {
+
+        namespace {
+            /*!
+             * The equation systems x = A x + b over the maybe states of a reachability probability query for several instantiations (lanes) of the
+             * same graph preserving parametric DTMC. The values of the lanes are interleaved, i.e., the matrix entries, right-hand sides and solution
+             * values of all lanes are stored consecutively. Hence, a Gauss-Seidel sweep traverses the (shared) matrix structure only once for all lanes
+             * and the innermost loops run over contiguous values.
+             */
+            class LaneInterleavedEquationSystem {
+            public:
+                static const uint64_t Lanes = 16;
+
+                LaneInterleavedEquationSystem(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& targetStates) : maybeStates(maybeStates), targetStates(targetStates) {
+                    rowBegin.push_back(0);
+                    for (auto state : maybeStates) {
+                        for (auto const& entry : transitionMatrix.getRow(state)) {
+                            if (maybeStates.get(entry.getColumn())) {
+                                columns.push_back(maybeStates.getNumberOfSetBitsBeforeIndex(entry.getColumn()));
+                            }
+                        }
+                        rowBegin.push_back(columns.size());
+                    }
+                    matrixValues.assign(columns.size() * Lanes, 0.0);
+                    rightHandSide.assign(maybeStates.getNumberOfSetBits() * Lanes, 0.0);
+                    solution.assign(maybeStates.getNumberOfSetBits() * Lanes, 0.0);
+                }
+
+                /*!
+                 * Sets the values of the given lane according to the given instantiated transition matrix.
+                 * @param initialValues the initial values of the value iteration for the maybe states.
+                 */
+                void setLane(uint64_t lane, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& initialValues) {
+                    uint64_t entryIndex = 0;
+                    uint64_t row = 0;
+                    for (auto state : maybeStates) {
+                        double targetProbability = 0.0;
+                        for (auto const& entry : transitionMatrix.getRow(state)) {
+                            if (maybeStates.get(entry.getColumn())) {
+                                matrixValues[entryIndex * Lanes + lane] = entry.getValue();
+                                ++entryIndex;
+                            } else if (targetStates.get(entry.getColumn())) {
+                                targetProbability += entry.getValue();
+                            }
+                        }
+                        rightHandSide[row * Lanes + lane] = targetProbability;
+                        solution[row * Lanes + lane] = initialValues[row];
+                        ++row;
+                    }
+                }
+
+                /*!
+                 * Performs Gauss-Seidel sweeps until the values of all lanes have converged (or the maximal number of iterations is reached).
+                 * @return the number of performed iterations.
+                 */
+                uint64_t solve(double precision, bool relative, uint64_t maximalNumberOfIterations) {
+                    uint64_t numberOfRows = rowBegin.size() - 1;
+                    std::array<double, Lanes> rowValues;
+                    uint64_t iterations = 0;
+                    bool converged = false;
+                    while (!converged && iterations < maximalNumberOfIterations) {
+                        converged = true;
+                        for (uint64_t row = 0; row < numberOfRows; ++row) {
+                            std::copy_n(rightHandSide.begin() + row * Lanes, Lanes, rowValues.begin());
+                            for (uint64_t entryIndex = rowBegin[row]; entryIndex < rowBegin[row + 1]; ++entryIndex) {
+                                double const* entryValues = matrixValues.data() + entryIndex * Lanes;
+                                double const* columnValues = solution.data() + columns[entryIndex] * Lanes;
+                                for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                    rowValues[lane] += entryValues[lane] * columnValues[lane];
+                                }
+                            }
+                            double* rowSolution = solution.data() + row * Lanes;
+                            for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                double difference = std::abs(rowValues[lane] - rowSolution[lane]);
+                                converged &= relative ? difference <= precision * std::abs(rowValues[lane]) : difference <= precision;
+                                rowSolution[lane] = rowValues[lane];
+                            }
+                        }
+                        ++iterations;
+                    }
+                    STORM_LOG_WARN_COND(converged, "Batched value iteration did not converge within " << iterations << " iterations.");
+                    return iterations;
+                }
+
+                /*!
+                 * Retrieves the reachability probabilities of all states for the given lane.
+                 */
+                std::vector<double> getLaneResult(uint64_t lane) const {
+                    std::vector<double> result(maybeStates.size(), 0.0);
+                    storm::utility::vector::setVectorValues(result, targetStates, 1.0);
+                    uint64_t row = 0;
+                    for (auto state : maybeStates) {
+                        result[state] = solution[row * Lanes + lane];
+                        ++row;
+                    }
+                    return result;
+                }
+
+            private:
+                storm::storage::BitVector maybeStates;
+                storm::storage::BitVector targetStates;
+                // The structure of the matrix restricted to the maybe states (with local column indices).
+                std::vector<uint64_t> rowBegin;
+                std::vector<uint64_t> columns;
+                std::vector<double> matrixValues;
+                std::vector<double> rightHandSide;
+                std::vector<double> solution;
+            };
+        }
         
         template <typename SparseModelType, typename ConstantType>
         SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
@@ -19,7 +134,71 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            return checkInstantiatedModel(env, modelInstantiator.instantiate(valuation));
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            std::vector<std::unique_ptr<CheckResult>> results(valuations.size());
+            if constexpr (std::is_same<ConstantType, double>::value) {
+                if (this->getInstantiationsAreGraphPreserving() && this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability())) {
+                    // The first instantiation is checked as usual, which also determines the maybe states. The remaining ones are solved in batches.
+                    std::unique_ptr<LaneInterleavedEquationSystem> equationSystem;
+                    std::vector<double> initialValues;
+                    std::vector<uint64_t> laneToValuationIndex;
+                    auto const& nativeEnvironment = env.solver().native();
+                    auto solveLanes = [&]() {
+                        equationSystem->solve(storm::utility::convertNumber<double>(nativeEnvironment.getPrecision()), nativeEnvironment.getRelativeTerminationCriterion(), nativeEnvironment.getMaximalNumberOfIterations());
+                        for (uint64_t lane = 0; lane < laneToValuationIndex.size(); ++lane) {
+                            results[laneToValuationIndex[lane]] = createReachabilityProbabilityResult(equationSystem->getLaneResult(lane));
+                        }
+                        laneToValuationIndex.clear();
+                    };
+
+                    modelInstantiator.instantiateBatch(valuations, [&](uint64_t valuationIndex, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
+                        if (!equationSystem) {
+                            results[valuationIndex] = checkInstantiatedModel(env, instantiatedModel);
+                            auto const& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+                            storm::storage::BitVector const& maybeStates = hint.getMaybeStates();
+                            storm::storage::BitVector targetStates = storm::utility::vector::filter<ConstantType>(hint.getResultHint(), [] (ConstantType const& value) -> bool { return storm::utility::isOne(value); });
+                            targetStates &= ~maybeStates;
+                            equationSystem = std::make_unique<LaneInterleavedEquationSystem>(instantiatedModel.getTransitionMatrix(), maybeStates, targetStates);
+                            initialValues = storm::utility::vector::filterVector(hint.getResultHint(), maybeStates);
+                            return;
+                        }
+                        STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+                        equationSystem->setLane(laneToValuationIndex.size(), instantiatedModel.getTransitionMatrix(), initialValues);
+                        laneToValuationIndex.push_back(valuationIndex);
+                        if (laneToValuationIndex.size() == LaneInterleavedEquationSystem::Lanes) {
+                            solveLanes();
+                        }
+                    });
+                    if (!laneToValuationIndex.empty()) {
+                        // Unused lanes keep the values of previous batches, which have converged already.
+                        solveLanes();
+                    }
+                    return results;
+                }
+            }
+
+            modelInstantiator.instantiateBatch(valuations, [&](uint64_t valuationIndex, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
+                results[valuationIndex] = checkInstantiatedModel(env, instantiatedModel);
+            });
+            return results;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::createReachabilityProbabilityResult(std::vector<ConstantType>&& probabilities) const {
+            auto const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+            if (operatorFormula.hasQuantitativeResult()) {
+                return std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(probabilities));
+            }
+            return ExplicitQuantitativeCheckResult<ConstantType>(std::move(probabilities)).compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>());
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
             STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
             storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
 
@@ -22,8 +22,27 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+            /*!
+             * Checks the specified formula for each of the given valuations. The transition functions are evaluated for batches of valuations at once.
+             * If the instantiations are graph preserving and the formula is a reachability probability formula, the equation systems of several
+             * instantiations are solved together by a value iteration whose sweeps update all of them at once.
+             * Otherwise, the instantiated models are checked one after another.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
+
         protected:
+
+            /*!
+             * Checks the specified formula on the given instantiation of the parametric model.
+             */
+            std::unique_ptr<CheckResult> checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel);
+
+            /*!
+             * Creates the result of the specified reachability probability formula from the given probabilities.
+             */
+            std::unique_ptr<CheckResult> createReachabilityProbabilityResult(std::vector<ConstantType>&& probabilities) const;
             
+
             // Optimizations for the different formula types
             std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
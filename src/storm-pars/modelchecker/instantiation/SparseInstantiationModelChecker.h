@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "storm-pars/utility/parametric.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/CheckTask.h"
@@ -24,6 +27,12 @@ namespace storm {
             void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
+
+            /*!
+             * Checks the specified formula for each of the given valuations. The default implementation checks the valuations one after another.
+             * @return The results in the order of the valuations.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
             
             // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
             // This bypasses the graph analysis for the different instantiations.
@@ -1,5 +1,9 @@
 #include <sstream>
 #include <queue>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
@@ -324,6 +328,122 @@ namespace storm {
                 return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
             }
 
+            template <typename ParametricType>
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+                STORM_LOG_THROW(!checkers.empty(), storm::exceptions::InvalidArgumentException, "Parallel region refinement requires at least one region model checker.");
+                STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " using " << checkers.size() << " threads.");
+
+                auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+                auto areaOfParameterSpace = region.area();
+                auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+
+                // The resulting (sub-)regions
+                std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+
+                // The regions that we still need to process. Regions with a large area are processed first as they contribute most to the coverage.
+                struct UnprocessedRegion {
+                    storm::storage::ParameterRegion<ParametricType> region;
+                    RegionResult initialResult;
+                    uint64_t depth;
+                    CoefficientType area;
+                };
+                auto hasSmallerArea = [](UnprocessedRegion const& lhs, UnprocessedRegion const& rhs) { return lhs.area < rhs.area; };
+                std::priority_queue<UnprocessedRegion, std::vector<UnprocessedRegion>, decltype(hasSmallerArea)> unprocessedRegions(hasSmallerArea);
+                unprocessedRegions.push({region, RegionResult::Unknown, 0, areaOfParameterSpace});
+
+                uint_fast64_t numOfAnalyzedRegions = 0;
+                uint64_t numberOfBusyThreads = 0;
+                std::exception_ptr firstException;
+                std::mutex mutex;
+                std::condition_variable stateChanged;
+
+                // Has to be called while holding the mutex.
+                auto isDone = [&]() {
+                    return firstException || fractionOfUndiscoveredArea <= thresholdAsCoefficient || (unprocessedRegions.empty() && numberOfBusyThreads == 0);
+                };
+
+                auto worker = [&](RegionModelChecker<ParametricType>& checker) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        stateChanged.wait(lock, [&]() { return isDone() || !unprocessedRegions.empty(); });
+                        if (isDone()) {
+                            return;
+                        }
+                        UnprocessedRegion current = unprocessedRegions.top();
+                        unprocessedRegions.pop();
+                        ++numberOfBusyThreads;
+                        lock.unlock();
+
+                        // Analyze (and possibly split) the region without holding the lock.
+                        RegionResult res = RegionResult::Unknown;
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                        try {
+                            res = checker.analyzeRegion(env, current.region, hypothesis, current.initialResult, false);
+                            bool isConclusive = res == RegionResult::AllSat || res == RegionResult::AllViolated;
+                            if (!isConclusive && (!depthThreshold || current.depth < depthThreshold.get())) {
+                                current.region.split(current.region.getCenterPoint(), newRegions);
+                            }
+                        } catch (...) {
+                            lock.lock();
+                            if (!firstException) {
+                                firstException = std::current_exception();
+                            }
+                            --numberOfBusyThreads;
+                            stateChanged.notify_all();
+                            return;
+                        }
+
+                        lock.lock();
+                        --numberOfBusyThreads;
+                        ++numOfAnalyzedRegions;
+                        STORM_LOG_INFO("Analyzed region #" << numOfAnalyzedRegions << " (Refinement depth " << current.depth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        if (res == RegionResult::AllSat || res == RegionResult::AllViolated) {
+                            fractionOfUndiscoveredArea -= current.area / areaOfParameterSpace;
+                            result.emplace_back(std::move(current.region), res);
+                        } else if (newRegions.empty()) {
+                            // If the region is not further refined, it is still added to the result
+                            result.emplace_back(std::move(current.region), res);
+                        } else {
+                            RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                 RegionResult::Unknown);
+                            for (auto& newRegion : newRegions) {
+                                auto newArea = newRegion.area();
+                                unprocessedRegions.push({std::move(newRegion), initResForNewRegions, current.depth + 1, std::move(newArea)});
+                            }
+                        }
+                        stateChanged.notify_all();
+                    }
+                };
+
+                // The calling thread acts as the first worker.
+                std::vector<std::thread> threads;
+                threads.reserve(checkers.size() - 1);
+                for (uint64_t threadIndex = 1; threadIndex < checkers.size(); ++threadIndex) {
+                    threads.emplace_back(worker, std::ref(*checkers[threadIndex]));
+                }
+                worker(*checkers.front());
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                if (firstException) {
+                    std::rethrow_exception(firstException);
+                }
+
+                // Add the still unprocessed regions to the result
+                while (!unprocessedRegions.empty()) {
+                    result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().initialResult);
+                    unprocessedRegions.pop();
+                }
+
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                    STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+                    STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << checkers.size() << " threads.\n");
+                }
+
+                auto regionCopyForResult = region;
+                return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+            }
 
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult){
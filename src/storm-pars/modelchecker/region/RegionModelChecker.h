@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/analysis/OrderExtender.h"
@@ -62,6 +63,17 @@ namespace storm {
              */
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t monThresh = 0);
 
+            /*!
+             * Iteratively refines the region like performRegionRefinement, but analyzes regions concurrently, using one thread per given region model checker.
+             * The unprocessed regions are scheduled by decreasing area. Monotonicity is not considered.
+             * @param checkers the region model checkers used by the threads. They need to be specified for the same model and check task and must not share any mutable state.
+             * @param region the considered region
+             * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
+             * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+             * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+             */
+            static std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+
             // TODO: documentation
             /*!
              * Finds the extremal value within the given region and with the given precision.
@@ -278,6 +278,7 @@ namespace storm {
                 auto multiplier = storm::solver::MultiplierFactory<ConstantType>().create(env, parameterLifter->getMatrix());
                 multiplier->repeatedMultiplyAndReduce(env, dirForParameters, x, &parameterLifter->getVector(), *stepBound);
             } else {
+                applyHintsOfSuperregion(region, dirForParameters);
                 auto solver = solverFactory->create(env, parameterLifter->getMatrix());
                 solver->setHasUniqueSolution();
                 solver->setHasNoEndComponents();
@@ -386,8 +387,12 @@ namespace storm {
                 solver->solveEquations(env, dirForParameters, x, parameterLifter->getVector());
                 if (storm::solver::minimize(dirForParameters)) {
                     minSchedChoices = solver->getSchedulerChoices();
+                    currentRegionHint->minSchedChoices = minSchedChoices;
+                    currentRegionHint->minResult = x;
                 } else {
                     maxSchedChoices = solver->getSchedulerChoices();
+                    currentRegionHint->maxSchedChoices = maxSchedChoices;
+                    currentRegionHint->maxResult = x;
                 }
                 if (isRegionSplitEstimateSupported()) {
                     computeRegionSplitEstimates(x, solver->getSchedulerChoices(), region, dirForParameters);
@@ -488,11 +493,67 @@ namespace storm {
             minSchedChoices = boost::none;
             maxSchedChoices = boost::none;
             x.clear();
+            currentRegionHint = boost::none;
+            regionHints.clear();
             lowerResultBound = boost::none;
             upperResultBound = boost::none;
             regionSplitEstimationsEnabled = false;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::storeHintsForSubregions(storm::storage::ParameterRegion<ValueType> const& region) {
+            if (isCurrentHintRegion(region) && (currentRegionHint->minResult || currentRegionHint->maxResult) && regionHints.size() < MaximalNumberOfRegionHints) {
+                regionHints.push_back(std::move(*currentRegionHint));
+                // Keep the region such that the stored hints are not applied to the region itself.
+                currentRegionHint = RegionHint{region, regionHints.back().area, regionHints.back().area, boost::none, boost::none, boost::none, boost::none};
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::isCurrentHintRegion(storm::storage::ParameterRegion<ValueType> const& region) const {
+            return currentRegionHint && currentRegionHint->region.getLowerBoundaries() == region.getLowerBoundaries() && currentRegionHint->region.getUpperBoundaries() == region.getUpperBoundaries();
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::applyHintsOfSuperregion(storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            if (isCurrentHintRegion(region)) {
+                // The hints for this region have already been applied.
+                return;
+            }
+            CoefficientType area = region.area();
+            currentRegionHint = RegionHint{region, area, area, boost::none, boost::none, boost::none, boost::none};
+
+            // Find the smallest region that contains the given one, which is typically the region that has been split.
+            auto superregionIt = regionHints.end();
+            for (auto hintIt = regionHints.begin(); hintIt != regionHints.end(); ++hintIt) {
+                if (hintIt->region.isSubRegion(region) && (superregionIt == regionHints.end() || hintIt->area < superregionIt->area)) {
+                    superregionIt = hintIt;
+                }
+            }
+            if (superregionIt == regionHints.end()) {
+                // Without a stored hint, the results of the previous solver call are used.
+                return;
+            }
+
+            // The superregion contains the given region, so its lifted model has more choices. Its optimal schedulers and results are therefore good initial guesses.
+            if (superregionIt->minSchedChoices) {
+                minSchedChoices = superregionIt->minSchedChoices;
+            }
+            if (superregionIt->maxSchedChoices) {
+                maxSchedChoices = superregionIt->maxSchedChoices;
+            }
+            auto const& superregionResult = storm::solver::minimize(dirForParameters) ? superregionIt->minResult : superregionIt->maxResult;
+            if (superregionResult) {
+                x = superregionResult.get();
+            }
+
+            // Drop the hint once its region is covered by the subregions that used it.
+            superregionIt->uncoveredArea -= area;
+            if (superregionIt->uncoveredArea <= storm::utility::zero<CoefficientType>()) {
+                regionHints.erase(superregionIt);
+            }
+        }
+
         template <typename SparseModelType, typename ConstantType>
         boost::optional<storm::storage::Scheduler<ConstantType>> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getCurrentMinScheduler() {
             if (!minSchedChoices) {
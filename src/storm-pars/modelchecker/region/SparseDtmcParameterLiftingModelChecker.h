@@ -1,5 +1,6 @@
 #pragma once
 
+#include <list>
 #include <vector>
 #include <memory>
 #include <boost/optional.hpp>
@@ -60,6 +61,8 @@ namespace storm {
             
             virtual void reset() override;
 
+            virtual void storeHintsForSubregions(storm::storage::ParameterRegion<ValueType> const& region) override;
+
             virtual void splitSmart(storm::storage::ParameterRegion<ValueType> &region, std::vector<storm::storage::ParameterRegion<ValueType>> &regionVector, storm::analysis::MonotonicityResult<VariableType> &monRes, bool splitForExtremum) const override;
 
 
@@ -83,6 +86,32 @@ namespace storm {
             std::vector<ConstantType> x;
             boost::optional<ConstantType> lowerResultBound, upperResultBound;
             
+            /*!
+             * Solver results of a region that serve as hints for the analysis of its subregions.
+             */
+            struct RegionHint {
+                storm::storage::ParameterRegion<ValueType> region;
+                CoefficientType area;
+                // The part of the area that is not covered by the subregions that already used this hint.
+                CoefficientType uncoveredArea;
+                boost::optional<std::vector<ConstantType>> minResult, maxResult;
+                boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
+            };
+
+            // Returns true if the current region hint belongs to the given region.
+            bool isCurrentHintRegion(storm::storage::ParameterRegion<ValueType> const& region) const;
+
+            // Prepares the current region hint for the given region and applies the hints of the smallest stored region that contains it.
+            void applyHintsOfSuperregion(storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+
+            // The maximal number of stored region hints. Each hint stores up to two result vectors and schedulers.
+            static const uint64_t MaximalNumberOfRegionHints = 128;
+
+            // The hints for the most recently analyzed region.
+            boost::optional<RegionHint> currentRegionHint;
+            // The hints of regions whose subregions are not analyzed completely.
+            std::list<RegionHint> regionHints;
+
             bool regionSplitEstimationsEnabled;
             std::map<VariableType, double> regionSplitEstimates;
 
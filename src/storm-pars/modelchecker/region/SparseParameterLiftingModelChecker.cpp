@@ -147,8 +147,16 @@ namespace storm {
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "When analyzing a region, an invalid initial result was given: " << initialResult);
             }
+            if (result != RegionResult::AllSat && result != RegionResult::AllViolated) {
+                storeHintsForSubregions(region);
+            }
             return result;
         }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::storeHintsForSubregions(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const&) {
+            // Intentionally left empty.
+        }
         
         template <typename SparseModelType, typename ConstantType>
         RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::sampleVertices(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResult const& initialResult) {
@@ -82,6 +82,13 @@ namespace storm {
 
             virtual std::unique_ptr<CheckResult> computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult = nullptr) = 0;
 
+            /*!
+             * Invoked after the given region has been analyzed without deciding whether it is AllSat or AllViolated, i.e., the region is likely to be split.
+             * Implementations may keep the results obtained for this region in order to use them as hints when analyzing its subregions.
+             * The default implementation does nothing.
+             */
+            virtual void storeHintsForSubregions(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region);
+
 
             std::shared_ptr<SparseModelType> parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
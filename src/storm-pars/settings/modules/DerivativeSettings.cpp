@@ -6,6 +6,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentValidators.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
@@ -28,6 +29,7 @@ namespace storm {
             const std::string DerivativeSettings::omitInconsequentialParams = "omit-inconsequential-params";
             const std::string DerivativeSettings::startPoint = "start-point";
             const std::string DerivativeSettings::constraintMethod = "constraint-method";
+            const std::string DerivativeSettings::descentThreads = "descent-threads";
 
             DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, feasibleInstantiationSearch, false, "Search for a feasible instantiation (restart with new instantiation while not feasible)").build());
@@ -50,6 +52,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, omitInconsequentialParams, false, "Parameters that are removed in minimization because they have no effect on the rational function are normally set to 0.5 in the final instantiation. If this flag is set, they will be omitted from the final instantiation entirely.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, constraintMethod, false, "Constraint Method").setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument(constraintMethod, "Method for dealing with constraints").setDefaultValueString("project-gradient").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, descentThreads, false, "Sets the number of gradient descents that run concurrently from different starting points. Each thread uses its own copy of the model.").setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads.").addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool DerivativeSettings::isFeasibleInstantiationSearchSet() const {
@@ -112,6 +116,10 @@ namespace storm {
                 return boost::none;
             }
 
+            uint64_t DerivativeSettings::getNumberOfDescentThreads() const {
+                return this->getOption(descentThreads).getArgumentByName("number").getValueAsUnsignedInteger();
+            }
+
             boost::optional<derivative::GradientDescentMethod> DerivativeSettings::methodFromString(const std::string &str) const {
                   derivative::GradientDescentMethod method;
                   if (str == "adam") {
@@ -27,6 +27,8 @@ namespace storm {
 
             const std::string MonotonicitySettings::monotoneParameters ="parameters";
 
+            const std::string MonotonicitySettings::samplesThreads = "samples-threads";
+
             MonotonicitySettings::MonotonicitySettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, monotonicityAnalysis, false, "Sets whether monotonicity analysis is done").setIsAdvanced().setShortName(monotonicityAnalysisShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, usePLABounds, true, "Sets whether pla bounds should be used for monotonicity analysis").setIsAdvanced().build());
@@ -40,6 +42,8 @@ namespace storm {
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(monotonicityThreshold, "The depth threshold from which on monotonicity is used for Parameter Lifting").setDefaultValueUnsignedInteger(0).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, monotoneParameters, true, "Sets monotone parameters from file.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("monotoneParametersFilename", "The file where the monotone parameters are set").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, samplesThreads, true, "Sets the number of threads that check the sample points of the monotonicity analysis concurrently.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads.").addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool MonotonicitySettings::isMonotonicityAnalysisSet() const {
@@ -74,6 +78,10 @@ namespace storm {
                 return this->getOption(samplesMonotonicityAnalysis).getArgumentByName("samples").getValueAsUnsignedInteger();
             }
 
+            uint64_t MonotonicitySettings::getNumberOfSamplesThreads() const {
+                return this->getOption(samplesThreads).getArgumentByName("number").getValueAsUnsignedInteger();
+            }
+
             bool MonotonicitySettings::isExportMonotonicitySet() const {
                 return this->getOption(exportMonotonicityName).getHasOptionBeenSet();
             }
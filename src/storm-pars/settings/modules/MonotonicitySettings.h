@@ -49,6 +49,11 @@ namespace storm {
                  */
                 uint_fast64_t getNumberOfSamples() const;
 
+                /*!
+                 * Retrieves the number of threads that check the sample points of the monotonicity analysis
+                 */
+                uint64_t getNumberOfSamplesThreads() const;
+
                 /*!
                  *
                  */
@@ -81,6 +86,7 @@ namespace storm {
                 const static std::string monotoneParameters;
                 const static std::string monSolution;
                 const static std::string monSolutionShortName;
+                const static std::string samplesThreads;
 
             };
 
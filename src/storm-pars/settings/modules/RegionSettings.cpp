@@ -22,6 +22,7 @@ namespace storm {
             const std::string RegionSettings::hypothesisOptionName = "hypothesis";
             const std::string RegionSettings::hypothesisShortOptionName = "hyp";
             const std::string RegionSettings::refineOptionName = "refine";
+            const std::string RegionSettings::refinementThreadsOptionName = "refinement-threads";
             const std::string RegionSettings::extremumOptionName = "extremum";
             const std::string RegionSettings::extremumSuggestionOptionName = "extremum-init";
             const std::string RegionSettings::splittingThresholdName = "splitting-threshold";
@@ -43,6 +44,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, refineOptionName, false, "Enables region refinement.")
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("coverage-threshold", "Refinement converges if the fraction of unknown area falls below this threshold.").setDefaultValueDouble(0.05).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0,1.0)).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("depth-limit", "If given, limits the number of times a region is refined.").setDefaultValueInteger(-1).makeOptional().build()).build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementThreadsOptionName, false, "Sets the number of threads that analyze regions concurrently during region refinement. Each thread uses its own copy of the region model checker.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads.").addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).setDefaultValueUnsignedInteger(1).build()).build());
                 
                 std::vector<std::string> directions = {"min", "max"};
                 std::vector<std::string> precisiontype = {"rel", "abs"};
@@ -122,6 +126,10 @@ namespace storm {
                 return (uint64_t) depth;
             }
             
+            uint64_t RegionSettings::getNumberOfRefinementThreads() const {
+                return this->getOption(refinementThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+            }
+
             bool RegionSettings::isExtremumSet() const {
                 return this->getOption(extremumOptionName).getHasOptionBeenSet();
             }
@@ -1,5 +1,9 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+#include <map>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -331,6 +335,13 @@ namespace storm {
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if (std::is_same<ConstantType, double>::value) {
+                if (!compiledFunctions) {
+                    compileCollectedFunctions();
+                }
+                evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+                return;
+            }
             for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -349,6 +360,82 @@ namespace storm {
             }
         }
         
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            std::vector<ParametricType> functions;
+            functions.reserve(collectedFunctions.size());
+            for (auto const& collectedFunctionValuationPlaceholder : collectedFunctions) {
+                functions.push_back(collectedFunctionValuationPlaceholder.first.first);
+            }
+            compiledFunctions = std::make_unique<storm::utility::BatchedFunctionEvaluator<ParametricType>>(functions);
+
+            std::map<VariableType, uint64_t> variableIndices;
+            for (auto const& variable : compiledFunctions->getVariables()) {
+                variableIndices.emplace(variable, variableIndices.size());
+            }
+            auto toIndices = [&variableIndices] (std::set<VariableType> const& variables) {
+                std::vector<uint64_t> result;
+                result.reserve(variables.size());
+                for (auto const& variable : variables) {
+                    auto indexIt = variableIndices.find(variable);
+                    // Variables that do not occur in the (simplified) function do not need to be assigned.
+                    if (indexIt != variableIndices.end()) {
+                        result.push_back(indexIt->second);
+                    }
+                }
+                return result;
+            };
+
+            compiledValuations.clear();
+            compiledValuations.reserve(collectedFunctions.size());
+            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+                AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+                compiledValuations.push_back({&collectedFunctionValuationPlaceholder.second, toIndices(abstrValuation.getLowerParameters()), toIndices(abstrValuation.getUpperParameters()), toIndices(abstrValuation.getUnspecifiedParameters())});
+            }
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            auto const& variables = compiledFunctions->getVariables();
+            std::vector<double> lowerValues, upperValues;
+            lowerValues.reserve(variables.size());
+            upperValues.reserve(variables.size());
+            for (auto const& variable : variables) {
+                lowerValues.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(variable)));
+                upperValues.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(variable)));
+            }
+
+            bool const minimize = storm::solver::minimize(dirForUnspecifiedParameters);
+            std::vector<double> point(variables.size(), 0.0);
+            for (uint64_t function = 0; function < compiledValuations.size(); ++function) {
+                CompiledValuation const& valuation = compiledValuations[function];
+                for (auto const& variableIndex : valuation.lowerVariables) {
+                    point[variableIndex] = lowerValues[variableIndex];
+                }
+                for (auto const& variableIndex : valuation.upperVariables) {
+                    point[variableIndex] = upperValues[variableIndex];
+                }
+                // Consider all vertices w.r.t. the unspecified variables. The i'th bit of the vertex id indicates that the i'th unspecified variable is set to its upper bound.
+                uint64_t const numberOfVertices = 1ull << valuation.unspecifiedVariables.size();
+                double result = 0.0;
+                for (uint64_t vertexId = 0; vertexId < numberOfVertices; ++vertexId) {
+                    for (uint64_t i = 0; i < valuation.unspecifiedVariables.size(); ++i) {
+                        uint64_t const variableIndex = valuation.unspecifiedVariables[i];
+                        point[variableIndex] = ((vertexId >> i) & 1) ? upperValues[variableIndex] : lowerValues[variableIndex];
+                    }
+                    double currentResult = compiledFunctions->evaluate(function, point);
+                    if (vertexId == 0) {
+                        result = currentResult;
+                    } else if (minimize) {
+                        result = std::min(result, currentResult);
+                    } else {
+                        result = std::max(result, currentResult);
+                    }
+                }
+                *valuation.placeholder = storm::utility::convertNumber<ConstantType>(result);
+            }
+        }
+
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
@@ -7,6 +7,7 @@
 
 
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/BatchedFunctionEvaluator.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -132,9 +133,20 @@ namespace storm {
                  */
                 ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
 
+                /*!
+                 * Evaluates the collected functions w.r.t. the given region and writes the results into the placeholders.
+                 * If the results are computed in double precision, the functions are compiled once upon the first call such that subsequent
+                 * evaluations do not need to use the (generic and comparatively slow) polynomial arithmetic.
+                 */
                 void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
             private:
+                // Compiles the collected functions and translates their abstract valuations to indices of the compiled variables.
+                void compileCollectedFunctions();
+
+                // Evaluates the compiled functions.
+                void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
                 // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
                 typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
 
@@ -150,6 +162,16 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+                // The compiled collected functions. The i'th compiled function corresponds to the i'th entry of compiledValuations.
+                std::unique_ptr<storm::utility::BatchedFunctionEvaluator<ParametricType>> compiledFunctions;
+
+                struct CompiledValuation {
+                    ConstantType* placeholder;
+                    // The indices (w.r.t. the compiled functions) of the variables that are set to the lower bound, the upper bound, or that are unspecified.
+                    std::vector<uint64_t> lowerVariables, upperVariables, unspecifiedVariables;
+                };
+                std::vector<CompiledValuation> compiledValuations;
             };
             
             FunctionValuationCollector functionValuationCollector;
@@ -0,0 +1,132 @@
+#include "storm-pars/utility/BatchedFunctionEvaluator.h"
+
+#include <algorithm>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename FunctionType>
+        BatchedFunctionEvaluator<FunctionType>::BatchedFunctionEvaluator(std::vector<FunctionType> const& functions) {
+            std::map<VariableType, uint64_t> variableIndices;
+            polynomialBegin.reserve(2 * functions.size() + 1);
+            termFactorBegin.push_back(0);
+            for (auto const& function : functions) {
+                polynomialBegin.push_back(termCoefficients.size());
+                compilePolynomial(function.nominatorAsPolynomial().polynomialWithCoefficient(), variableIndices);
+                polynomialBegin.push_back(termCoefficients.size());
+                compilePolynomial(function.denominatorAsPolynomial().polynomialWithCoefficient(), variableIndices);
+            }
+            polynomialBegin.push_back(termCoefficients.size());
+
+            variables.resize(variableIndices.size());
+            for (auto const& variableAndIndex : variableIndices) {
+                variables[variableAndIndex.second] = variableAndIndex.first;
+            }
+        }
+
+        template<typename FunctionType>
+        template<typename PolynomialType>
+        void BatchedFunctionEvaluator<FunctionType>::compilePolynomial(PolynomialType const& polynomial, std::map<VariableType, uint64_t>& variableIndices) {
+            for (auto const& term : polynomial) {
+                termCoefficients.push_back(storm::utility::convertNumber<double>(term.coeff()));
+                if (term.monomial()) {
+                    for (auto const& variableAndExponent : *term.monomial()) {
+                        auto variableIndexIt = variableIndices.emplace(variableAndExponent.first, variableIndices.size()).first;
+                        factorVariables.push_back(variableIndexIt->second);
+                        factorExponents.push_back(variableAndExponent.second);
+                    }
+                }
+                termFactorBegin.push_back(factorVariables.size());
+            }
+        }
+
+        template<typename FunctionType>
+        uint64_t BatchedFunctionEvaluator<FunctionType>::getNumberOfFunctions() const {
+            return (polynomialBegin.size() - 1) / 2;
+        }
+
+        template<typename FunctionType>
+        std::vector<typename BatchedFunctionEvaluator<FunctionType>::VariableType> const& BatchedFunctionEvaluator<FunctionType>::getVariables() const {
+            return variables;
+        }
+
+        template<typename FunctionType>
+        void BatchedFunctionEvaluator<FunctionType>::evaluate(std::vector<storm::utility::parametric::Valuation<FunctionType>> const& valuations, std::vector<double>& result) const {
+            uint64_t numberOfValuations = valuations.size();
+
+            // Gather the values of the variables such that the values of one variable are stored consecutively.
+            std::vector<double> variableValues(variables.size() * numberOfValuations);
+            for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                for (uint64_t valuationIndex = 0; valuationIndex < numberOfValuations; ++valuationIndex) {
+                    auto valueIt = valuations[valuationIndex].find(variables[variableIndex]);
+                    STORM_LOG_THROW(valueIt != valuations[valuationIndex].end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to variable " << variables[variableIndex] << ".");
+                    variableValues[variableIndex * numberOfValuations + valuationIndex] = storm::utility::convertNumber<double>(valueIt->second);
+                }
+            }
+
+            result.assign(getNumberOfFunctions() * numberOfValuations, 0.0);
+            std::vector<double> termValues(numberOfValuations);
+            std::vector<double> denominatorValues(numberOfValuations);
+            for (uint64_t function = 0; function < getNumberOfFunctions(); ++function) {
+                double* functionResult = result.data() + function * numberOfValuations;
+                evaluatePolynomial(polynomialBegin[2 * function], polynomialBegin[2 * function + 1], variableValues, numberOfValuations, termValues, functionResult);
+                std::fill(denominatorValues.begin(), denominatorValues.end(), 0.0);
+                evaluatePolynomial(polynomialBegin[2 * function + 1], polynomialBegin[2 * function + 2], variableValues, numberOfValuations, termValues, denominatorValues.data());
+                for (uint64_t valuationIndex = 0; valuationIndex < numberOfValuations; ++valuationIndex) {
+                    functionResult[valuationIndex] /= denominatorValues[valuationIndex];
+                }
+            }
+        }
+
+        template<typename FunctionType>
+        void BatchedFunctionEvaluator<FunctionType>::evaluatePolynomial(uint64_t termBegin, uint64_t termEnd, std::vector<double> const& variableValues, uint64_t numberOfValuations,
+                                                                        std::vector<double>& termValues, double* result) const {
+            for (uint64_t term = termBegin; term < termEnd; ++term) {
+                std::fill(termValues.begin(), termValues.end(), termCoefficients[term]);
+                for (uint64_t factor = termFactorBegin[term]; factor < termFactorBegin[term + 1]; ++factor) {
+                    double const* values = variableValues.data() + factorVariables[factor] * numberOfValuations;
+                    for (uint64_t exponent = 0; exponent < factorExponents[factor]; ++exponent) {
+                        for (uint64_t valuationIndex = 0; valuationIndex < numberOfValuations; ++valuationIndex) {
+                            termValues[valuationIndex] *= values[valuationIndex];
+                        }
+                    }
+                }
+                for (uint64_t valuationIndex = 0; valuationIndex < numberOfValuations; ++valuationIndex) {
+                    result[valuationIndex] += termValues[valuationIndex];
+                }
+            }
+        }
+
+        template<typename FunctionType>
+        double BatchedFunctionEvaluator<FunctionType>::evaluate(uint64_t function, std::vector<double> const& variableValues) const {
+            STORM_LOG_ASSERT(function < getNumberOfFunctions(), "Invalid function index.");
+            STORM_LOG_ASSERT(variableValues.size() == variables.size(), "Unexpected number of variable values.");
+            return evaluatePolynomial(polynomialBegin[2 * function], polynomialBegin[2 * function + 1], variableValues) /
+                   evaluatePolynomial(polynomialBegin[2 * function + 1], polynomialBegin[2 * function + 2], variableValues);
+        }
+
+        template<typename FunctionType>
+        double BatchedFunctionEvaluator<FunctionType>::evaluatePolynomial(uint64_t termBegin, uint64_t termEnd, std::vector<double> const& variableValues) const {
+            double result = 0.0;
+            for (uint64_t term = termBegin; term < termEnd; ++term) {
+                double termValue = termCoefficients[term];
+                for (uint64_t factor = termFactorBegin[term]; factor < termFactorBegin[term + 1]; ++factor) {
+                    double const value = variableValues[factorVariables[factor]];
+                    for (uint64_t exponent = 0; exponent < factorExponents[factor]; ++exponent) {
+                        termValue *= value;
+                    }
+                }
+                result += termValue;
+            }
+            return result;
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class BatchedFunctionEvaluator<storm::RationalFunction>;
+#endif
+    }
+}
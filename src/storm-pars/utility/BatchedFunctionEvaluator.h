@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Evaluates a fixed set of rational functions for many valuations at once.
+         * The numerators and denominators of the functions are compiled into flat arrays of terms (coefficient and the variables with their exponents).
+         * Evaluation then proceeds term by term for all valuations of a batch, such that the innermost loops run over contiguous arrays of values
+         * (one entry per valuation) and can be vectorized by the compiler. The functions are evaluated in double precision.
+         */
+        template<typename FunctionType>
+        class BatchedFunctionEvaluator {
+        public:
+            typedef typename storm::utility::parametric::VariableType<FunctionType>::type VariableType;
+            typedef typename storm::utility::parametric::CoefficientType<FunctionType>::type CoefficientType;
+
+            /*!
+             * Compiles the given functions.
+             */
+            BatchedFunctionEvaluator(std::vector<FunctionType> const& functions);
+
+            /*!
+             * Retrieves the number of compiled functions.
+             */
+            uint64_t getNumberOfFunctions() const;
+
+            /*!
+             * Retrieves the variables occurring in the compiled functions. The position of a variable in the returned vector is its index.
+             */
+            std::vector<VariableType> const& getVariables() const;
+
+            /*!
+             * Evaluates all functions for the given valuations.
+             * @param valuations The valuations. Each valuation needs to assign a value to every variable occurring in the functions.
+             * @param result The i'th function evaluated at the j'th valuation is written to position i * valuations.size() + j.
+             */
+            void evaluate(std::vector<storm::utility::parametric::Valuation<FunctionType>> const& valuations, std::vector<double>& result) const;
+
+            /*!
+             * Evaluates a single function at a single point.
+             * @param function The index of the function.
+             * @param variableValues The value of each variable, given at the index of the variable. Only the values of variables that occur in the
+             * function are accessed.
+             */
+            double evaluate(uint64_t function, std::vector<double> const& variableValues) const;
+
+        private:
+            /*!
+             * Appends the terms of the given polynomial to the compiled terms.
+             */
+            template<typename PolynomialType>
+            void compilePolynomial(PolynomialType const& polynomial, std::map<VariableType, uint64_t>& variableIndices);
+
+            /*!
+             * Adds the values of the polynomial given by the terms [termBegin, termEnd) for each of the valuations to the given result range.
+             */
+            void evaluatePolynomial(uint64_t termBegin, uint64_t termEnd, std::vector<double> const& variableValues, uint64_t numberOfValuations,
+                                    std::vector<double>& termValues, double* result) const;
+
+            /*!
+             * Computes the value of the polynomial given by the terms [termBegin, termEnd) at the given point.
+             */
+            double evaluatePolynomial(uint64_t termBegin, uint64_t termEnd, std::vector<double> const& variableValues) const;
+
+            // The occurring variables. Variables are referred to by their position in this vector.
+            std::vector<VariableType> variables;
+
+            // For each function, the first term of the numerator. The denominator of function i consists of the terms between the numerator of
+            // function i and the numerator of function i + 1, i.e., there are 2 * #functions + 1 entries.
+            std::vector<uint64_t> polynomialBegin;
+
+            // For each term, its coefficient and the first factor.
+            std::vector<double> termCoefficients;
+            std::vector<uint64_t> termFactorBegin;
+
+            // For each factor, the index of its variable and the exponent.
+            std::vector<uint64_t> factorVariables;
+            std::vector<uint64_t> factorExponents;
+        };
+    }
+}
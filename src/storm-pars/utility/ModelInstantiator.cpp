@@ -1,4 +1,7 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <algorithm>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
 namespace storm {
@@ -139,15 +142,67 @@ namespace storm {
                 //Write results into the placeholders
                 instantiate_helper(valuation);
                 
-                //Write the instantiated values to the matrices and vectors according to the stored mappings
+                applyMappings();
+                return *this->instantiatedModel;
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(uint64_t valuationIndex, ConstantSparseModelType const& instantiatedModel)> const& callback) {
+                if constexpr (std::is_same<ConstantType, double>::value) {
+                    if (!batchedFunctionEvaluator) {
+                        std::vector<ParametricType> occurringFunctions;
+                        occurringFunctions.reserve(this->functions.size());
+                        for (auto& functionResult : this->functions) {
+                            occurringFunctions.push_back(functionResult.first);
+                            batchedFunctionPlaceholders.push_back(&functionResult.second);
+                        }
+                        batchedFunctionEvaluator = std::make_unique<BatchedFunctionEvaluator<ParametricType>>(occurringFunctions);
+                    }
+
+                    std::vector<storm::utility::parametric::Valuation<ParametricType>> batch;
+                    std::vector<double> functionValues;
+                    for (uint64_t batchBegin = 0; batchBegin < valuations.size(); batchBegin += BatchSize) {
+                        uint64_t batchEnd = std::min<uint64_t>(batchBegin + BatchSize, valuations.size());
+                        batch.assign(valuations.begin() + batchBegin, valuations.begin() + batchEnd);
+                        batchedFunctionEvaluator->evaluate(batch, functionValues);
+                        for (uint64_t valuationIndex = batchBegin; valuationIndex < batchEnd; ++valuationIndex) {
+                            for (uint64_t function = 0; function < batchedFunctionPlaceholders.size(); ++function) {
+                                *batchedFunctionPlaceholders[function] = functionValues[function * batch.size() + (valuationIndex - batchBegin)];
+                            }
+                            applyMappings();
+                            callback(valuationIndex, *this->instantiatedModel);
+                        }
+                    }
+                } else {
+                    for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+                        callback(valuationIndex, instantiate(valuations[valuationIndex]));
+                    }
+                }
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            storm::storage::BitVector ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getGraphPreservingValuations(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+                storm::storage::BitVector result(valuations.size(), true);
+                instantiateBatch(valuations, [&](uint64_t valuationIndex, ConstantSparseModelType const&) {
+                    // Constant entries are non-zero, so it suffices to consider the entries given by a function.
+                    for (auto const& entryValuePair : this->matrixMapping) {
+                        if (storm::utility::isZero(entryValuePair.first->getValue())) {
+                            result.set(valuationIndex, false);
+                            break;
+                        }
+                    }
+                });
+                return result;
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::applyMappings() {
                 for(auto& entryValuePair : this->matrixMapping){
                     entryValuePair.first->setValue(*(entryValuePair.second));
                 }
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
-                
-                return *this->instantiatedModel;
             }
         
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
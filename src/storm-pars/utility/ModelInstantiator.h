@@ -1,16 +1,20 @@
 #ifndef STORM_UTILITY_MODELINSTANTIATOR_H
 #define	STORM_UTILITY_MODELINSTANTIATOR_H
 
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
+#include "storm-pars/utility/BatchedFunctionEvaluator.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StochasticTwoPlayerGame.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 
 namespace storm {
@@ -47,6 +51,26 @@ namespace storm {
                  * @return The instantiated model
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
+
+                /*!
+                 * Instantiates the model for each of the given valuations and invokes the callback with each instantiated model.
+                 * If the constant type is double, the occurring functions are evaluated in compiled form for batches of valuations at once,
+                 * which is much faster than evaluating them with exact arithmetic for every valuation separately.
+                 * @param valuations The valuations for which the model is instantiated
+                 * @param callback Invoked with the index of the valuation and the model instantiated for it. The model is only valid during the call.
+                 */
+                void instantiateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(uint64_t valuationIndex, ConstantSparseModelType const& instantiatedModel)> const& callback);
+
+                /*!
+                 * Checks for each of the given valuations whether instantiating the model with it preserves the graph of the parametric model,
+                 * i.e., whether none of the transition functions becomes zero. Such instantiations can share the graph analysis of the model.
+                 * @param valuations The valuations to consider
+                 * @return The set of (indices of) valuations whose instantiations are graph preserving
+                 */
+                storm::storage::BitVector getGraphPreservingValuations(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+
+                /// The number of valuations for which the functions are evaluated at once by instantiateBatch.
+                static const uint64_t BatchSize = 64;
                 
                 /*!
                  *  Check validity
@@ -140,6 +164,11 @@ namespace storm {
                     }
                 }
 
+                /*!
+                 * Writes the values of the placeholders to the matrices and vectors according to the stored mappings.
+                 */
+                void applyMappings();
+
                 /*!
                  * Creates a matrix that has entries at the same position as the given matrix.
                  * The returned matrix is a stochastic matrix, i.e., the rows sum up to one.
@@ -189,6 +218,9 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The compiled occurring functions (only created by instantiateBatch) together with the placeholders of their results
+                std::unique_ptr<BatchedFunctionEvaluator<ParametricType>> batchedFunctionEvaluator;
+                std::vector<ConstantType*> batchedFunctionPlaceholders;
                 
                 
             };
@@ -6,6 +6,8 @@
 #include <type_traits>
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryDdModelParser.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -32,6 +34,22 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const& binaryFile) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        return storm::parser::BinaryModelParser::parseModel(binaryFile);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models in the binary format are not supported.");
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> buildBinaryDdModel(std::string const& binaryDdFile) {
+    if constexpr (std::is_same_v<ValueType, double> || (DdType == storm::dd::DdType::Sylvan && std::is_same_v<ValueType, storm::RationalNumber>)) {
+        return storm::parser::BinaryDdModelParser<DdType, ValueType>::parseModel(binaryDdFile);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parametric models or exact models with CUDD in the binary DD format are not supported.");
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const& imcaFile) {
     if constexpr (std::is_same_v<ValueType, double>) {
@@ -0,0 +1,190 @@
+#include "storm-parsers/parser/BinaryDdModelParser.h"
+
+#include <fstream>
+#include <type_traits>
+
+#include "storm/io/BinaryDdModelFormat.h"
+#include "storm/models/symbolic/Ctmc.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/BinaryEncoding.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+
+using namespace storm::exporter::binarydd;
+using storm::dd::binary::readString;
+using storm::dd::binary::readUint64;
+
+/*!
+ * Creates the meta variables stored in the file and retrieves the mapping from the indices of the DD variables in the file to the indices
+ * of the DD variables in the given manager.
+ */
+template<storm::dd::DdType Type>
+std::vector<uint_fast64_t> readMetaVariables(std::istream& in, storm::dd::DdManager<Type>& manager) {
+    std::vector<std::pair<uint64_t, uint_fast64_t>> indexPairs;
+    uint64_t numberOfGroups = readUint64(in);
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        std::string name = readString(in);
+        auto type = static_cast<storm::dd::MetaVariableType>(readUint64(in));
+        auto low = static_cast<int_fast64_t>(readUint64(in));
+        auto high = static_cast<int_fast64_t>(readUint64(in));
+        uint64_t numberOfLayers = readUint64(in);
+        uint64_t numberOfDdVariables = readUint64(in);
+
+        std::vector<storm::expressions::Variable> layers;
+        switch (type) {
+            case storm::dd::MetaVariableType::Bool:
+                layers = manager.addMetaVariable(name, numberOfLayers);
+                break;
+            case storm::dd::MetaVariableType::Int:
+                layers = manager.addMetaVariable(name, low, high, numberOfLayers);
+                break;
+            case storm::dd::MetaVariableType::BitVector:
+                layers = manager.addBitVectorMetaVariable(name, numberOfDdVariables, numberOfLayers);
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown type of meta variable '" << name << "'.");
+        }
+
+        for (auto const& layer : layers) {
+            auto const& ddVariables = manager.getMetaVariable(layer).getDdVariables();
+            STORM_LOG_THROW(ddVariables.size() == numberOfDdVariables, storm::exceptions::WrongFormatException,
+                            "Inconsistent number of DD variables of meta variable '" << name << "'.");
+            for (auto const& ddVariable : ddVariables) {
+                indexPairs.emplace_back(readUint64(in), ddVariable.getIndex());
+            }
+        }
+    }
+
+    // The indices in the file have to be a permutation of the indices of all DD variables.
+    std::vector<uint_fast64_t> ddVariableIndexMapping(indexPairs.size(), storm::dd::binary::LeafMarker);
+    for (auto const& indexPair : indexPairs) {
+        STORM_LOG_THROW(indexPair.first < ddVariableIndexMapping.size() && ddVariableIndexMapping[indexPair.first] == storm::dd::binary::LeafMarker,
+                        storm::exceptions::WrongFormatException, "Illegal index of DD variable: " << indexPair.first << ".");
+        ddVariableIndexMapping[indexPair.first] = indexPair.second;
+    }
+    return ddVariableIndexMapping;
+}
+
+template<storm::dd::DdType Type>
+std::set<storm::expressions::Variable> readVariables(std::istream& in, storm::dd::DdManager<Type> const& manager) {
+    std::set<storm::expressions::Variable> result;
+    uint64_t numberOfVariables = readUint64(in);
+    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+        result.insert(manager.getMetaVariable(readString(in)));
+    }
+    return result;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Add<Type, ValueType> readAdd(std::istream& in, storm::dd::DdManager<Type> const& manager, std::vector<uint_fast64_t> const& ddVariableIndexMapping) {
+    std::set<storm::expressions::Variable> metaVariables = readVariables(in, manager);
+    return storm::dd::Add<Type, ValueType>::fromBinary(manager, in, metaVariables, ddVariableIndexMapping);
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Bdd<Type> readBdd(std::istream& in, storm::dd::DdManager<Type> const& manager, std::vector<uint_fast64_t> const& ddVariableIndexMapping) {
+    return readAdd<Type, ValueType>(in, manager, ddVariableIndexMapping).notZero();
+}
+
+}  // namespace
+
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> BinaryDdModelParser<Type, ValueType>::parseModel(std::string const& filename) {
+    using storm::models::ModelType;
+
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Could not open file '" << filename << "'.");
+    STORM_LOG_THROW(readUint64(in) == Magic, storm::exceptions::WrongFormatException, "File '" << filename << "' is not a binary DD model file.");
+    STORM_LOG_THROW(readUint64(in) == Version, storm::exceptions::WrongFormatException,
+                    "Binary DD model file '" << filename << "' has an unsupported version.");
+    STORM_LOG_THROW(readUint64(in) == ByteOrderMark, storm::exceptions::WrongFormatException,
+                    "Binary DD model file '" << filename << "' was written on a machine with a different byte order.");
+    auto modelType = static_cast<ModelType>(readUint64(in));
+    // The node tables do not depend on the DD library, so models can be loaded with another library than the one they were built with.
+    readUint64(in);
+    auto valueType = static_cast<ValueTypeTag>(readUint64(in));
+    STORM_LOG_THROW((valueType == ValueTypeTag::Double && std::is_same<ValueType, double>::value) ||
+                        (valueType == ValueTypeTag::RationalNumber && std::is_same<ValueType, storm::RationalNumber>::value),
+                    storm::exceptions::WrongFormatException, "The values in binary DD model file '" << filename << "' have an unexpected type.");
+
+    auto manager = std::make_shared<storm::dd::DdManager<Type>>();
+    std::vector<uint_fast64_t> ddVariableIndexMapping = readMetaVariables(in, *manager);
+
+    std::set<storm::expressions::Variable> rowVariables = readVariables(in, *manager);
+    std::set<storm::expressions::Variable> columnVariables = readVariables(in, *manager);
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs(readUint64(in));
+    for (auto& rowColumnPair : rowColumnMetaVariablePairs) {
+        rowColumnPair.first = manager->getMetaVariable(readString(in));
+        rowColumnPair.second = manager->getMetaVariable(readString(in));
+    }
+    std::set<storm::expressions::Variable> nondeterminismVariables = readVariables(in, *manager);
+
+    storm::dd::Bdd<Type> reachableStates = readBdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+    storm::dd::Bdd<Type> initialStates = readBdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+    storm::dd::Bdd<Type> deadlockStates = readBdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+    storm::dd::Add<Type, ValueType> transitionMatrix = readAdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+
+    std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap;
+    uint64_t numberOfLabels = readUint64(in);
+    for (uint64_t label = 0; label < numberOfLabels; ++label) {
+        std::string name = readString(in);
+        labelToBddMap.emplace(name, readBdd<Type, ValueType>(in, *manager, ddVariableIndexMapping));
+    }
+
+    typedef storm::models::symbolic::StandardRewardModel<Type, ValueType> RewardModelType;
+    std::unordered_map<std::string, RewardModelType> rewardModels;
+    uint64_t numberOfRewardModels = readUint64(in);
+    for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+        std::string name = readString(in);
+        uint64_t flags = readUint64(in);
+        boost::optional<storm::dd::Add<Type, ValueType>> stateRewards, stateActionRewards, transitionRewards;
+        if (flags & StateRewardsFlag) {
+            stateRewards = readAdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+        }
+        if (flags & StateActionRewardsFlag) {
+            stateActionRewards = readAdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+        }
+        if (flags & TransitionRewardsFlag) {
+            transitionRewards = readAdd<Type, ValueType>(in, *manager, ddVariableIndexMapping);
+        }
+        rewardModels.emplace(name, RewardModelType(stateRewards, stateActionRewards, transitionRewards));
+    }
+
+    switch (modelType) {
+        case ModelType::Dtmc:
+            return std::make_shared<storm::models::symbolic::Dtmc<Type, ValueType>>(manager, reachableStates, initialStates, deadlockStates, transitionMatrix,
+                                                                                    rowVariables, columnVariables, rowColumnMetaVariablePairs, labelToBddMap,
+                                                                                    rewardModels);
+        case ModelType::Ctmc:
+            return std::make_shared<storm::models::symbolic::Ctmc<Type, ValueType>>(manager, reachableStates, initialStates, deadlockStates, transitionMatrix,
+                                                                                    rowVariables, columnVariables, rowColumnMetaVariablePairs, labelToBddMap,
+                                                                                    rewardModels);
+        case ModelType::Mdp:
+            return std::make_shared<storm::models::symbolic::Mdp<Type, ValueType>>(manager, reachableStates, initialStates, deadlockStates, transitionMatrix,
+                                                                                   rowVariables, columnVariables, rowColumnMetaVariablePairs,
+                                                                                   nondeterminismVariables, labelToBddMap, rewardModels);
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Binary DD model file '" << filename << "' contains a model of unsupported type " << modelType << ".");
+    }
+}
+
+template class BinaryDdModelParser<storm::dd::DdType::CUDD, double>;
+template class BinaryDdModelParser<storm::dd::DdType::Sylvan, double>;
+template class BinaryDdModelParser<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+
+}  // namespace parser
+}  // namespace storm
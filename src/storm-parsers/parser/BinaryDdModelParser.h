@@ -0,0 +1,33 @@
+#ifndef STORM_PARSER_BINARYDDMODELPARSER_H_
+#define STORM_PARSER_BINARYDDMODELPARSER_H_
+
+#include <memory>
+#include <string>
+
+#include "storm/models/symbolic/Model.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Loads symbolic models that were written in the binary DD format (see storm/io/BinaryDdModelFormat.h).
+ *
+ * The meta variables are created in a new DD manager in the order in which they were created in the manager of the exported model and the
+ * DDs are rebuilt from their node tables, so the model does not have to be built from its description again.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+class BinaryDdModelParser {
+   public:
+    /*!
+     * Loads a model in the binary DD format from the given file.
+     *
+     * @param filename The file to load.
+     * @return The loaded model.
+     */
+    static std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
+
+#endif /* STORM_PARSER_BINARYDDMODELPARSER_H_ */
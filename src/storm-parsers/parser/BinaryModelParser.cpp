@@ -0,0 +1,200 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+
+using namespace storm::exporter::binary;
+
+/*!
+ * A section of the mapped file.
+ */
+struct Section {
+    SectionType type;
+    std::string name;
+    char const* data;
+    uint64_t dataSize;
+};
+
+/*!
+ * Reads consecutive blocks from the mapped file while making sure that we never read past its end.
+ */
+class FileReader {
+   public:
+    FileReader(MappedFile const& file, std::string const& filename) : position(file.getData()), end(file.getDataEnd()), filename(filename) {
+        // Nothing to do.
+    }
+
+    char const* readBlock(uint64_t size) {
+        uint64_t const paddedSize = size + getPadding(size);
+        STORM_LOG_THROW(paddedSize >= size && paddedSize <= static_cast<uint64_t>(end - position), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file '" << filename << "'.");
+        char const* result = position;
+        position += paddedSize;
+        return result;
+    }
+
+    Section readSection() {
+        SectionHeader header;
+        std::memcpy(&header, readBlock(sizeof(SectionHeader)), sizeof(SectionHeader));
+        Section section;
+        section.type = header.type;
+        char const* name = readBlock(header.nameSize);
+        section.name.assign(name, header.nameSize);
+        section.data = readBlock(header.dataSize);
+        section.dataSize = header.dataSize;
+        return section;
+    }
+
+   private:
+    char const* position;
+    char const* end;
+    std::string const& filename;
+};
+
+template<typename T>
+std::vector<T> readVector(Section const& section, uint64_t expectedSize) {
+    STORM_LOG_THROW(section.dataSize == expectedSize * sizeof(T), storm::exceptions::WrongFormatException,
+                    "Section '" << section.name << "' of type " << static_cast<uint32_t>(section.type) << " has unexpected size " << section.dataSize
+                                << " (expected " << expectedSize * sizeof(T) << ").");
+    std::vector<T> result(expectedSize);
+    if (expectedSize > 0) {
+        std::memcpy(result.data(), section.data, section.dataSize);
+    }
+    return result;
+}
+
+storm::storage::BitVector readBitVector(Section const& section, uint64_t size) {
+    std::vector<uint64_t> buckets = readVector<uint64_t>(section, (size + 63) / 64);
+    storm::storage::BitVector result(size);
+    for (uint64_t bucket = 0; bucket < buckets.size(); ++bucket) {
+        uint64_t const bitIndex = bucket * 64;
+        uint64_t const numberOfBits = std::min<uint64_t>(64, size - bitIndex);
+        result.setFromInt(bitIndex, numberOfBits, numberOfBits == 64 ? buckets[bucket] : buckets[bucket] & ((1ull << numberOfBits) - 1));
+    }
+    return result;
+}
+
+}  // namespace
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(std::string const& filename) {
+    typedef storm::storage::sparse::state_type index_type;
+    typedef storm::models::sparse::StandardRewardModel<double> RewardModelType;
+
+    MappedFile file(filename.c_str());
+    FileReader reader(file, filename);
+
+    FileHeader header;
+    std::memcpy(&header, reader.readBlock(sizeof(FileHeader)), sizeof(FileHeader));
+    STORM_LOG_THROW(header.magic == Magic, storm::exceptions::WrongFormatException,
+                    "File '" << filename << "' is not a binary model file (or it was written on a machine with a different byte order).");
+    STORM_LOG_THROW(header.byteOrderMark == ByteOrderMark, storm::exceptions::WrongFormatException,
+                    "Binary model file '" << filename << "' was written on a machine with a different byte order.");
+    STORM_LOG_THROW(header.version == Version, storm::exceptions::WrongFormatException,
+                    "Binary model file '" << filename << "' has version " << header.version << " but version " << Version << " is expected.");
+    STORM_LOG_THROW(header.valueSize == sizeof(double), storm::exceptions::WrongFormatException,
+                    "Binary model file '" << filename << "' does not contain double values.");
+    auto const modelType = static_cast<storm::models::ModelType>(header.modelType);
+    STORM_LOG_THROW(modelType == storm::models::ModelType::Dtmc || modelType == storm::models::ModelType::Ctmc || modelType == storm::models::ModelType::Mdp ||
+                        modelType == storm::models::ModelType::Pomdp || modelType == storm::models::ModelType::MarkovAutomaton,
+                    storm::exceptions::WrongFormatException, "Binary model file '" << filename << "' has an unsupported model type.");
+    bool const nondeterministic =
+        modelType == storm::models::ModelType::Mdp || modelType == storm::models::ModelType::Pomdp || modelType == storm::models::ModelType::MarkovAutomaton;
+    STORM_LOG_THROW(nondeterministic || header.numberOfStates == header.numberOfChoices, storm::exceptions::WrongFormatException,
+                    "The number of choices of the deterministic model in '" << filename << "' does not match the number of states.");
+
+    std::vector<index_type> rowIndications;
+    std::vector<storm::storage::MatrixEntry<index_type, double>> entries;
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+    storm::storage::sparse::ModelComponents<double, RewardModelType> components;
+    components.stateLabeling = storm::models::sparse::StateLabeling(header.numberOfStates);
+    components.rateTransitions = (header.flags & RateTransitionsFlag) != 0;
+    std::unordered_map<std::string, std::optional<std::vector<double>>> stateRewards, stateActionRewards;
+
+    for (Section section = reader.readSection(); section.type != SectionType::End; section = reader.readSection()) {
+        switch (section.type) {
+            case SectionType::RowIndications:
+                rowIndications = readVector<index_type>(section, header.numberOfChoices + 1);
+                break;
+            case SectionType::RowGroupIndices:
+                rowGroupIndices = readVector<index_type>(section, header.numberOfStates + 1);
+                break;
+            case SectionType::Entries:
+                entries = readVector<storm::storage::MatrixEntry<index_type, double>>(section, header.numberOfEntries);
+                break;
+            case SectionType::StateLabel:
+                components.stateLabeling.addLabel(section.name, readBitVector(section, header.numberOfStates));
+                break;
+            case SectionType::ChoiceLabel:
+                if (!components.choiceLabeling) {
+                    components.choiceLabeling = storm::models::sparse::ChoiceLabeling(header.numberOfChoices);
+                }
+                components.choiceLabeling->addLabel(section.name, readBitVector(section, header.numberOfChoices));
+                break;
+            case SectionType::StateRewards:
+                stateRewards[section.name] = readVector<double>(section, header.numberOfStates);
+                stateActionRewards.emplace(section.name, std::nullopt);
+                break;
+            case SectionType::StateActionRewards:
+                stateActionRewards[section.name] = readVector<double>(section, header.numberOfChoices);
+                stateRewards.emplace(section.name, std::nullopt);
+                break;
+            case SectionType::ExitRates:
+                components.exitRates = readVector<double>(section, header.numberOfStates);
+                break;
+            case SectionType::MarkovianStates:
+                components.markovianStates = readBitVector(section, header.numberOfStates);
+                break;
+            case SectionType::Observations:
+                components.observabilityClasses = readVector<uint32_t>(section, header.numberOfStates);
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                                "Unknown section type " << static_cast<uint32_t>(section.type) << " in binary model file '" << filename << "'.");
+        }
+    }
+
+    // Validate the matrix structure before using it.
+    STORM_LOG_THROW(rowIndications.size() == header.numberOfChoices + 1, storm::exceptions::WrongFormatException,
+                    "Binary model file '" << filename << "' does not contain a transition matrix.");
+    STORM_LOG_THROW(rowIndications.front() == 0 && rowIndications.back() == entries.size() && std::is_sorted(rowIndications.begin(), rowIndications.end()),
+                    storm::exceptions::WrongFormatException, "Inconsistent transition matrix in binary model file '" << filename << "'.");
+    for (auto const& entry : entries) {
+        STORM_LOG_THROW(entry.getColumn() < header.numberOfStates, storm::exceptions::WrongFormatException,
+                        "Inconsistent transition matrix in binary model file '" << filename << "'.");
+    }
+    if (nondeterministic) {
+        STORM_LOG_THROW(rowGroupIndices, storm::exceptions::WrongFormatException,
+                        "Binary model file '" << filename << "' does not contain the row groups of the nondeterministic model.");
+        STORM_LOG_THROW(rowGroupIndices->front() == 0 && rowGroupIndices->back() == header.numberOfChoices &&
+                            std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()),
+                        storm::exceptions::WrongFormatException, "Inconsistent row groups in binary model file '" << filename << "'.");
+    }
+    components.transitionMatrix = storm::storage::SparseMatrix<double>(header.numberOfStates, std::move(rowIndications), std::move(entries),
+                                                                       std::move(rowGroupIndices));
+
+    for (auto& rewardModel : stateRewards) {
+        components.rewardModels.emplace(rewardModel.first,
+                                        RewardModelType(std::move(rewardModel.second), std::move(stateActionRewards.at(rewardModel.first))));
+    }
+
+    return storm::utility::builder::buildModelFromComponents(modelType, std::move(components));
+}
+
+}  // namespace parser
+}  // namespace storm
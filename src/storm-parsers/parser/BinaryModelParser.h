@@ -0,0 +1,32 @@
+#ifndef STORM_PARSER_BINARYMODELPARSER_H_
+#define STORM_PARSER_BINARYMODELPARSER_H_
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Loads models that were written in the binary model format (see storm/io/BinaryModelFormat.h).
+ *
+ * The file is mapped to memory and the arrays it contains are copied directly into the data structures of the model,
+ * i.e., no values have to be parsed which makes loading much faster than for textual formats.
+ */
+class BinaryModelParser {
+   public:
+    /*!
+     * Loads a model in the binary format from the given file.
+     *
+     * @param filename The file to load.
+     * @return The loaded model.
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
+
+#endif /* STORM_PARSER_BINARYMODELPARSER_H_ */
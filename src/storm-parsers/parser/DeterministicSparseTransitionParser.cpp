@@ -1,5 +1,6 @@
 #include "storm-parsers/parser/DeterministicSparseTransitionParser.h"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdint>
 #include <cstdio>
@@ -15,6 +16,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
@@ -36,6 +38,109 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     return DeterministicSparseTransitionParser<ValueType>::parse(filename, true, transitionMatrix);
 }
 
+namespace {
+// The (approximate) number of bytes of the file that are processed by one thread at once.
+uint64_t const ChunkSize = 1 << 20;
+
+/*!
+ * A part of the file that starts at the beginning of a line and ends directly after a newline (or at the end of the file).
+ */
+struct Chunk {
+    char const* begin;
+    char const* end;
+
+    // The statistics that are gathered by the first pass.
+    uint64_t numberOfTransitions = 0;
+    uint64_t firstRow = 0;
+    uint64_t firstColumn = 0;
+    uint64_t lastRow = 0;
+    uint64_t lastColumn = 0;
+    uint64_t highestStateIndex = 0;
+    // The states in between the first and the last row of this chunk that do not have outgoing transitions.
+    std::vector<uint64_t> deadlockStates;
+    // Whether the columns of some row are not given in ascending order.
+    bool unsortedColumns = false;
+
+    // The data that the stitching of the first pass provides for the second pass: the first row that was not started by a previous chunk
+    // and the position of the first entry of this chunk in the matrix.
+    uint64_t firstUnstartedRow = 0;
+    uint64_t firstEntry = 0;
+
+    bool isEmpty() const {
+        return numberOfTransitions == 0;
+    }
+};
+
+/*!
+ * Splits the data in [begin, end) into chunks of (approximately) the given size whose boundaries are at the beginning of lines.
+ */
+std::vector<Chunk> splitIntoChunks(char const* begin, char const* end, uint64_t chunkSize) {
+    std::vector<Chunk> chunks;
+    while (begin < end) {
+        char const* chunkEnd = begin + std::min<uint64_t>(chunkSize, end - begin);
+        chunkEnd = std::find(chunkEnd, end, '\n');
+        if (chunkEnd != end) {
+            ++chunkEnd;
+        }
+        chunks.push_back(Chunk());
+        chunks.back().begin = begin;
+        chunks.back().end = chunkEnd;
+        begin = chunkEnd;
+    }
+    return chunks;
+}
+
+/*!
+ * Calls the given function for every transition whose source state starts in the given chunk.
+ */
+template<typename Function>
+void forEachTransition(Chunk const& chunk, Function const& function) {
+    char const* buf = trimWhitespaces(chunk.begin);
+    while (buf < chunk.end && buf[0] != '\0') {
+        uint64_t row = checked_strtol(buf, &buf);
+        uint64_t column = checked_strtol(buf, &buf);
+        double value = checked_strtod(buf, &buf);
+        function(row, column, value);
+        buf = trimWhitespaces(buf);
+    }
+}
+
+/*!
+ * Checks whether the transition (row, column) may follow the transition (lastRow, lastColumn) and returns true iff the columns of the row are
+ * not given in ascending order.
+ */
+bool checkOrder(uint64_t lastRow, uint64_t lastColumn, uint64_t row, uint64_t column) {
+    STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
+    if (row == lastRow && column == lastColumn) {
+        STORM_LOG_ERROR("The same transition (" << row << ", " << column << ") is given twice.");
+        throw storm::exceptions::InvalidArgumentException() << "The same transition (" << row << ", " << column << ") is given twice.";
+    }
+    return row == lastRow && column < lastColumn;
+}
+
+/*!
+ * Gathers the statistics of the first pass for the given chunk.
+ */
+void countTransitions(Chunk& chunk) {
+    forEachTransition(chunk, [&chunk](uint64_t row, uint64_t column, double) {
+        if (chunk.isEmpty()) {
+            chunk.firstRow = row;
+            chunk.firstColumn = column;
+        } else {
+            chunk.unsortedColumns |= checkOrder(chunk.lastRow, chunk.lastColumn, row, column);
+            for (uint64_t skippedRow = chunk.lastRow + 1; skippedRow < row; ++skippedRow) {
+                chunk.deadlockStates.push_back(skippedRow);
+            }
+        }
+        chunk.highestStateIndex = std::max({chunk.highestStateIndex, row, column});
+        chunk.lastRow = row;
+        chunk.lastColumn = column;
+        ++chunk.numberOfTransitions;
+    });
+}
+}  // namespace
+
 template<typename ValueType>
 template<typename MatrixValueType>
 storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parse(
@@ -47,9 +152,55 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     MappedFile file(filename.c_str());
     char const* buf = file.getData();
 
-    // Perform first pass, i.e. count entries that are not zero.
-    DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass =
-        DeterministicSparseTransitionParser<ValueType>::firstPass(file.getData(), !isRewardFile);
+    // Skip the format hint if it is there.
+    buf = trimWhitespaces(buf);
+    if (buf[0] < '0' || buf[0] > '9') {
+        buf = forwardToLineEnd(buf);
+        buf = trimWhitespaces(buf);
+    }
+
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    uint64_t const numberOfThreads = buildSettings.getNumberOfBuildThreads();
+    bool const dontFixDeadlocks = buildSettings.isDontFixDeadlocksSet();
+    bool const insertSelfLoops = !isRewardFile && !dontFixDeadlocks;
+
+    // Perform the first pass on all chunks in parallel, i.e. count the transitions and check their order within each chunk.
+    std::vector<Chunk> chunks = splitIntoChunks(buf, file.getDataEnd(), ChunkSize);
+    storm::utility::parallel::forEachChunk(numberOfThreads, chunks.size(), 1, [&chunks](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t chunk = begin; chunk < end; ++chunk) {
+            countTransitions(chunks[chunk]);
+        }
+    });
+
+    // Stitch the results of the chunks together. This checks the order of the transitions at the chunk boundaries and determines the position of
+    // the entries of each chunk in the matrix (including the self-loops that are inserted for deadlock states).
+    DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass;
+    std::vector<uint64_t> deadlockStates;
+    bool unsortedColumns = false;
+    bool foundTransition = false;
+    uint64_t lastRow = 0, lastColumn = 0;
+    for (auto& chunk : chunks) {
+        if (chunk.isEmpty()) {
+            continue;
+        }
+        chunk.firstUnstartedRow = foundTransition ? lastRow + 1 : 0;
+        chunk.firstEntry = firstPass.numberOfNonzeroEntries;
+        if (foundTransition) {
+            unsortedColumns |= checkOrder(lastRow, lastColumn, chunk.firstRow, chunk.firstColumn);
+        }
+        for (uint64_t skippedRow = chunk.firstUnstartedRow; skippedRow < chunk.firstRow; ++skippedRow) {
+            deadlockStates.push_back(skippedRow);
+        }
+        deadlockStates.insert(deadlockStates.end(), chunk.deadlockStates.begin(), chunk.deadlockStates.end());
+        unsortedColumns |= chunk.unsortedColumns;
+
+        uint64_t numberOfDeadlockStates = chunk.deadlockStates.size() + (chunk.firstRow - std::min(chunk.firstRow, chunk.firstUnstartedRow));
+        firstPass.numberOfNonzeroEntries += chunk.numberOfTransitions + (insertSelfLoops ? numberOfDeadlockStates : 0);
+        firstPass.highestStateIndex = std::max(firstPass.highestStateIndex, chunk.highestStateIndex);
+        foundTransition = true;
+        lastRow = chunk.lastRow;
+        lastColumn = chunk.lastColumn;
+    }
 
     STORM_LOG_TRACE("First pass on " << filename << " shows " << firstPass.numberOfNonzeroEntries << " non-zeros.");
 
@@ -59,15 +210,6 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
         throw storm::exceptions::WrongFormatException();
     }
 
-    // Perform second pass.
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
-
     if (isRewardFile) {
         // The reward matrix should match the size of the transition matrix.
         if (firstPass.highestStateIndex + 1 > transitionMatrix.getRowCount() || firstPass.highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
@@ -77,86 +219,69 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
             // If we found the right number of states or less, we set it to the number of states represented by the transition matrix.
             firstPass.highestStateIndex = transitionMatrix.getRowCount() - 1;
         }
-    }
-
-    // Creating matrix builder here.
-    // The actual matrix will be build once all contents are inserted.
-    storm::storage::SparseMatrixBuilder<ValueType> resultMatrix(firstPass.highestStateIndex + 1, firstPass.highestStateIndex + 1,
-                                                                firstPass.numberOfNonzeroEntries);
-
-    uint_fast64_t row, col, lastRow = 0;
-    double val;
-    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
-    bool hadDeadlocks = false;
-
-    // Read all transitions from file. Note that we assume that the
-    // transitions are listed in canonical order, otherwise this will not
-    // work, i.e. the values in the matrix will be at wrong places.
-
-    // Different parsing routines for transition systems and transition rewards.
-    if (isRewardFile) {
-        while (buf[0] != '\0') {
-            // Read next transition.
-            row = checked_strtol(buf, &buf);
-            col = checked_strtol(buf, &buf);
-            val = checked_strtod(buf, &buf);
-
-            resultMatrix.addNextValue(row, col, val);
-            buf = trimWhitespaces(buf);
-        }
     } else {
-        // Read first row and add self-loops if necessary.
-        char const* tmp;
-        row = checked_strtol(buf, &tmp);
-
-        if (row > 0) {
-            for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-                hadDeadlocks = true;
-                if (!dontFixDeadlocks) {
-                    resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
-                    STORM_LOG_WARN("Warning while parsing " << filename << ": state " << skippedRow
-                                                            << " has no outgoing transitions. A self-loop was inserted.");
-                } else {
-                    STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
-                    // Before throwing the appropriate exception we will give notice of all deadlock states.
-                }
+        for (auto const& state : deadlockStates) {
+            if (!dontFixDeadlocks) {
+                STORM_LOG_INFO("Warning while parsing " << filename << ": state " << state << " has no outgoing transitions. A self-loop was inserted.");
+            } else {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": state " << state << " has no outgoing transitions.");
             }
         }
+        if (!deadlockStates.empty()) {
+            STORM_LOG_WARN("Warning while parsing " << filename << ": " << deadlockStates.size() << " states have no outgoing transitions.");
+        }
+        // If we encountered deadlock and did not fix them, now is the time to throw the exception.
+        STORM_LOG_THROW(!dontFixDeadlocks || deadlockStates.empty(), storm::exceptions::WrongFormatException,
+                        "Some of the states do not have outgoing transitions.");
+    }
 
-        while (buf[0] != '\0') {
-            // Read next transition.
-            row = checked_strtol(buf, &buf);
-            col = checked_strtol(buf, &buf);
-            val = checked_strtod(buf, &buf);
-
-            // Test if we moved to a new row.
-            // Handle all incomplete or skipped rows.
-            if (lastRow != row) {
-                for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                    hadDeadlocks = true;
-                    if (!dontFixDeadlocks) {
-                        resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
-                        STORM_LOG_INFO("Warning while parsing " << filename << ": state " << skippedRow
-                                                                << " has no outgoing transitions. A self-loop was inserted.");
-                    } else {
-                        STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
-                        // Before throwing the appropriate exception we will give notice of all deadlock states.
+    // Perform the second pass on all chunks in parallel. Each chunk writes its entries (and the self-loops of the deadlock states before its
+    // rows) to the positions determined above and starts all rows that were not started by a previous chunk. Note that we assume that the
+    // transitions are listed in canonical order, which was checked in the first pass (up to the order of the columns within a row).
+    uint64_t const rowCount = firstPass.highestStateIndex + 1;
+    std::vector<uint64_t> rowIndications(rowCount + 1, firstPass.numberOfNonzeroEntries);
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> columnsAndValues(firstPass.numberOfNonzeroEntries);
+    storm::utility::parallel::forEachChunk(numberOfThreads, chunks.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t chunkIndex = begin; chunkIndex < end; ++chunkIndex) {
+            Chunk const& chunk = chunks[chunkIndex];
+            if (chunk.isEmpty()) {
+                continue;
+            }
+            uint64_t nextEntry = chunk.firstEntry;
+            uint64_t nextRow = chunk.firstUnstartedRow;
+            forEachTransition(chunk, [&](uint64_t row, uint64_t column, double value) {
+                for (; nextRow <= row; ++nextRow) {
+                    rowIndications[nextRow] = nextEntry;
+                    if (nextRow < row && insertSelfLoops) {
+                        columnsAndValues[nextEntry++] = storm::storage::MatrixEntry<uint64_t, ValueType>(nextRow, storm::utility::one<ValueType>());
                     }
                 }
-                lastRow = row;
-            }
-
-            resultMatrix.addNextValue(row, col, val);
-            buf = trimWhitespaces(buf);
+                columnsAndValues[nextEntry++] = storm::storage::MatrixEntry<uint64_t, ValueType>(column, ValueType(value));
+            });
         }
-
-        // If we encountered deadlock and did not fix them, now is the time to throw the exception.
-        if (dontFixDeadlocks && hadDeadlocks)
-            throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
+    });
+
+    // The columns of a row have to be sorted, so we fix all rows in which they are not given in ascending order.
+    if (unsortedColumns) {
+        storm::utility::parallel::forEachChunk(numberOfThreads, rowCount, ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t row = begin; row < end; ++row) {
+                auto rowBegin = columnsAndValues.begin() + rowIndications[row];
+                auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+                auto compareColumns = [](auto const& first, auto const& second) { return first.getColumn() < second.getColumn(); };
+                if (!std::is_sorted(rowBegin, rowEnd, compareColumns)) {
+                    std::sort(rowBegin, rowEnd, compareColumns);
+                    auto duplicate = std::adjacent_find(rowBegin, rowEnd, [](auto const& first, auto const& second) {
+                        return first.getColumn() == second.getColumn();
+                    });
+                    STORM_LOG_THROW(duplicate == rowEnd, storm::exceptions::InvalidArgumentException,
+                                    "The same transition (" << row << ", " << duplicate->getColumn() << ") is given twice.");
+                }
+            }
+        });
     }
 
     // Finally, build the actual matrix, test and return it.
-    storm::storage::SparseMatrix<ValueType> result = resultMatrix.build();
+    storm::storage::SparseMatrix<ValueType> result(rowCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
 
     // Since we cannot check if each transition for which there is a reward in the reward file also exists in the transition matrix during parsing, we have to
     // do it afterwards.
@@ -168,73 +293,6 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     return result;
 }
 
-template<typename ValueType>
-typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(
-    char const* buf, bool reserveDiagonalElements) {
-    DeterministicSparseTransitionParser<ValueType>::FirstPassResult result;
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
-
-    // Check all transitions for non-zero diagonal entries and deadlock states.
-    uint_fast64_t row, col, lastRow = 0, lastCol = -1;
-
-    // Read first row and reserve space for self-loops if necessary.
-    char const* tmp;
-    row = checked_strtol(buf, &tmp);
-    if (row > 0 && reserveDiagonalElements) {
-        for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-            ++result.numberOfNonzeroEntries;
-        }
-    }
-
-    while (buf[0] != '\0') {
-        // Read the transition.
-        row = checked_strtol(buf, &buf);
-        col = checked_strtol(buf, &buf);
-        // The actual read value is not needed here.
-        checked_strtod(buf, &buf);
-
-        if (lastRow != row && reserveDiagonalElements) {
-            // Compensate for missing rows.
-            for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                ++result.numberOfNonzeroEntries;
-            }
-        }
-
-        // Check if a higher state id was found.
-        if (row > result.highestStateIndex)
-            result.highestStateIndex = row;
-        if (col > result.highestStateIndex)
-            result.highestStateIndex = col;
-
-        ++result.numberOfNonzeroEntries;
-
-        // Have we already seen this transition?
-        if (row == lastRow && col == lastCol) {
-            STORM_LOG_ERROR("The same transition (" << row << ", " << col << ") is given twice.");
-            throw storm::exceptions::InvalidArgumentException() << "The same transition (" << row << ", " << col << ") is given twice.";
-        }
-
-        lastRow = row;
-        lastCol = col;
-
-        buf = trimWhitespaces(buf);
-    }
-
-    if (reserveDiagonalElements) {
-        for (uint_fast64_t skippedRow = (uint_fast64_t)(lastRow + 1); skippedRow <= result.highestStateIndex; ++skippedRow) {
-            ++result.numberOfNonzeroEntries;
-        }
-    }
-
-    return result;
-}
-
 template class DeterministicSparseTransitionParser<double>;
 template storm::storage::SparseMatrix<double> DeterministicSparseTransitionParser<double>::parseDeterministicTransitionRewards(
     std::string const& filename, storm::storage::SparseMatrix<double> const& transitionMatrix);
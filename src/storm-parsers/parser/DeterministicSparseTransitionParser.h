@@ -12,6 +12,8 @@ namespace parser {
  *	The file is parsed in two passes.
  *	The first pass tests the file format and collects statistical data needed for the second pass.
  *	The second pass then parses the file data and constructs a SparseMatrix representing it.
+ *	For both passes, the file is split into chunks of lines, which are processed in parallel by the number of threads given by the build settings.
+ *	The results of the first pass on the chunks are combined to determine where each chunk has to store its entries in the matrix.
  */
 template<typename ValueType = double>
 class DeterministicSparseTransitionParser {
@@ -60,20 +62,9 @@ class DeterministicSparseTransitionParser {
                                                                                        storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix);
 
    private:
-    /*
-     * Performs the first pass on the input pointed to by the given buffer to obtain the number of
-     * transitions and the maximum node id.
-     *
-     * @param buffer The buffer that contains the input.
-     * @param reserveDiagonalElements A flag indicating whether the diagonal elements should be counted as if they
-     * were present to enable fixes later.
-     * @return A structure representing the result of the first pass.
-     */
-    static FirstPassResult firstPass(char const* buffer, bool reserveDiagonalElements);
-
     /*
      * The main parsing routine.
-     * Opens the given file, calls the first pass and performs the second pass, parsing the content of the file into a SparseMatrix.
+     * Opens the given file, performs the first pass and the second pass, parsing the content of the file into a SparseMatrix.
      *
      * @param filename The path and name of the file to be parsed.
      * @param rewardFile A flag set iff the file to be parsed contains transition rewards.
@@ -160,6 +160,10 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
+    // Labels are separated by whitespace and can optionally be enclosed in quotation marks (see below). Compiling the regex is expensive, so it is
+    // only done once.
+    std::regex const labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+
     // Iterate over all lines
     std::string line;
     size_t row = 0;
@@ -278,7 +282,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
                 //   - First part matches string without whitespace and quotation marks [^\s\"]+?
                 //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+                // The regex labelRegex is compiled once before the loop over all lines.
 
                 // Iterate over matches
                 auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
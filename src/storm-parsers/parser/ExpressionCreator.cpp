@@ -1,5 +1,7 @@
 #include "ExpressionCreator.h"
 
+#include <boost/functional/hash.hpp>
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/exceptions/WrongFormatException.h"
@@ -13,7 +15,8 @@
 namespace storm {
 namespace parser {
 
-ExpressionCreator::ExpressionCreator(storm::expressions::ExpressionManager const& manager) : manager(manager) {
+ExpressionCreator::ExpressionCreator(storm::expressions::ExpressionManager const& manager)
+    : manager(manager), trueExpression(manager.boolean(true)), falseExpression(manager.boolean(false)) {
     // Intenetionally left empty.
 }
 
@@ -23,16 +26,44 @@ ExpressionCreator::~ExpressionCreator() {
     }
 }
 
+bool ExpressionCreator::ExpressionKey::operator==(ExpressionKey const& other) const {
+    return operatorType == other.operatorType && operands == other.operands;
+}
+
+std::size_t ExpressionCreator::ExpressionKeyHash::operator()(ExpressionKey const& key) const {
+    std::size_t seed = static_cast<std::size_t>(key.operatorType);
+    for (auto const& operand : key.operands) {
+        boost::hash_combine(seed, operand.get());
+    }
+    return seed;
+}
+
+template<typename CreateFunction>
+storm::expressions::Expression ExpressionCreator::getOrCreate(storm::expressions::OperatorType operatorType, storm::expressions::Expression const& e1,
+                                                              storm::expressions::Expression const* e2, storm::expressions::Expression const* e3,
+                                                              CreateFunction const& create) const {
+    if (!hashConsing) {
+        return create();
+    }
+    ExpressionKey key{operatorType,
+                      {e1.getBaseExpressionPointer(), e2 ? e2->getBaseExpressionPointer() : nullptr, e3 ? e3->getBaseExpressionPointer() : nullptr}};
+    auto it = expressionCache.find(key);
+    if (it == expressionCache.end()) {
+        it = expressionCache.emplace(std::move(key), create()).first;
+    }
+    return it->second;
+}
+
 storm::expressions::Expression ExpressionCreator::createIteExpression(storm::expressions::Expression const& e1, storm::expressions::Expression const& e2,
                                                                       storm::expressions::Expression const& e3, bool& pass) const {
     if (this->createExpressions) {
         try {
-            return storm::expressions::ite(e1, e2, e3);
+            return getOrCreate(storm::expressions::OperatorType::Ite, e1, &e2, &e3, [&]() { return storm::expressions::ite(e1, e2, e3); });
         } catch (storm::exceptions::InvalidTypeException const& e) {
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createOrExpression(storm::expressions::Expression const& e1,
@@ -42,10 +73,10 @@ storm::expressions::Expression ExpressionCreator::createOrExpression(storm::expr
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Or:
-                    return e1 || e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 || e2; });
                     break;
                 case storm::expressions::OperatorType::Implies:
-                    return storm::expressions::implies(e1, e2);
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return storm::expressions::implies(e1, e2); });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -55,7 +86,7 @@ storm::expressions::Expression ExpressionCreator::createOrExpression(storm::expr
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createAndExpression(storm::expressions::Expression const& e1,
@@ -66,7 +97,7 @@ storm::expressions::Expression ExpressionCreator::createAndExpression(storm::exp
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::And:
-                    result = e1 && e2;
+                    result = getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 && e2; });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -77,7 +108,7 @@ storm::expressions::Expression ExpressionCreator::createAndExpression(storm::exp
         }
         return result;
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createRelationalExpression(storm::expressions::Expression const& e1,
@@ -87,16 +118,16 @@ storm::expressions::Expression ExpressionCreator::createRelationalExpression(sto
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::GreaterOrEqual:
-                    return e1 >= e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 >= e2; });
                     break;
                 case storm::expressions::OperatorType::Greater:
-                    return e1 > e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 > e2; });
                     break;
                 case storm::expressions::OperatorType::LessOrEqual:
-                    return e1 <= e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 <= e2; });
                     break;
                 case storm::expressions::OperatorType::Less:
-                    return e1 < e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 < e2; });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -106,7 +137,7 @@ storm::expressions::Expression ExpressionCreator::createRelationalExpression(sto
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createEqualsExpression(storm::expressions::Expression const& e1,
@@ -116,10 +147,11 @@ storm::expressions::Expression ExpressionCreator::createEqualsExpression(storm::
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Equal:
-                    return e1.hasBooleanType() && e2.hasBooleanType() ? storm::expressions::iff(e1, e2) : e1 == e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr,
+                                       [&]() { return e1.hasBooleanType() && e2.hasBooleanType() ? storm::expressions::iff(e1, e2) : e1 == e2; });
                     break;
                 case storm::expressions::OperatorType::NotEqual:
-                    return e1 != e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 != e2; });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -129,7 +161,7 @@ storm::expressions::Expression ExpressionCreator::createEqualsExpression(storm::
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createPlusExpression(storm::expressions::Expression const& e1,
@@ -139,10 +171,10 @@ storm::expressions::Expression ExpressionCreator::createPlusExpression(storm::ex
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Plus:
-                    return e1 + e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 + e2; });
                     break;
                 case storm::expressions::OperatorType::Minus:
-                    return e1 - e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 - e2; });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -152,7 +184,7 @@ storm::expressions::Expression ExpressionCreator::createPlusExpression(storm::ex
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createMultExpression(storm::expressions::Expression const& e1,
@@ -162,10 +194,10 @@ storm::expressions::Expression ExpressionCreator::createMultExpression(storm::ex
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Times:
-                    return e1 * e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 * e2; });
                     break;
                 case storm::expressions::OperatorType::Divide:
-                    return e1 / e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 / e2; });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -175,7 +207,7 @@ storm::expressions::Expression ExpressionCreator::createMultExpression(storm::ex
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createPowerModuloExpression(storm::expressions::Expression const& e1,
@@ -185,10 +217,10 @@ storm::expressions::Expression ExpressionCreator::createPowerModuloExpression(st
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Power:
-                    return storm::expressions::pow(e1, e2, true);
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return storm::expressions::pow(e1, e2, true); });
                     break;
                 case storm::expressions::OperatorType::Modulo:
-                    return e1 % e2;
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return e1 % e2; });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -198,7 +230,7 @@ storm::expressions::Expression ExpressionCreator::createPowerModuloExpression(st
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createUnaryExpression(std::vector<storm::expressions::OperatorType> const& operatorTypes,
@@ -209,10 +241,10 @@ storm::expressions::Expression ExpressionCreator::createUnaryExpression(std::vec
             for (auto const& op : operatorTypes) {
                 switch (op) {
                     case storm::expressions::OperatorType::Not:
-                        result = !result;
+                        result = getOrCreate(op, result, nullptr, nullptr, [&]() { return !result; });
                         break;
                     case storm::expressions::OperatorType::Minus:
-                        result = -result;
+                        result = getOrCreate(op, result, nullptr, nullptr, [&]() { return -result; });
                         break;
                     default:
                         STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -224,7 +256,7 @@ storm::expressions::Expression ExpressionCreator::createUnaryExpression(std::vec
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createRationalLiteralExpression(storm::RationalNumber const& value, bool& pass) const {
@@ -234,25 +266,39 @@ storm::expressions::Expression ExpressionCreator::createRationalLiteralExpressio
     }
 
     if (this->createExpressions) {
-        return manager.rational(value);
+        if (!hashConsing) {
+            return manager.rational(value);
+        }
+        auto it = rationalLiteralCache.find(value);
+        if (it == rationalLiteralCache.end()) {
+            it = rationalLiteralCache.emplace(value, manager.rational(value)).first;
+        }
+        return it->second;
     } else {
-        return manager.boolean(false);
+        return falseExpression;
     }
 }
 
 storm::expressions::Expression ExpressionCreator::createIntegerLiteralExpression(int64_t value, bool&) const {
     if (this->createExpressions) {
-        return manager.integer(value);
+        if (!hashConsing) {
+            return manager.integer(value);
+        }
+        auto it = integerLiteralCache.find(value);
+        if (it == integerLiteralCache.end()) {
+            it = integerLiteralCache.emplace(value, manager.integer(value)).first;
+        }
+        return it->second;
     } else {
-        return manager.boolean(false);
+        return falseExpression;
     }
 }
 
 storm::expressions::Expression ExpressionCreator::createBooleanLiteralExpression(bool value, bool&) const {
     if (this->createExpressions) {
-        return manager.boolean(value);
+        return value ? trueExpression : falseExpression;
     } else {
-        return manager.boolean(false);
+        return falseExpression;
     }
 }
 
@@ -263,10 +309,10 @@ storm::expressions::Expression ExpressionCreator::createMinimumMaximumExpression
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Min:
-                    return storm::expressions::minimum(e1, e2);
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return storm::expressions::minimum(e1, e2); });
                     break;
                 case storm::expressions::OperatorType::Max:
-                    return storm::expressions::maximum(e1, e2);
+                    return getOrCreate(operatorType, e1, &e2, nullptr, [&]() { return storm::expressions::maximum(e1, e2); });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -276,7 +322,7 @@ storm::expressions::Expression ExpressionCreator::createMinimumMaximumExpression
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createFloorCeilExpression(storm::expressions::OperatorType const& operatorType,
@@ -285,10 +331,10 @@ storm::expressions::Expression ExpressionCreator::createFloorCeilExpression(stor
         try {
             switch (operatorType) {
                 case storm::expressions::OperatorType::Floor:
-                    return storm::expressions::floor(e1);
+                    return getOrCreate(operatorType, e1, nullptr, nullptr, [&]() { return storm::expressions::floor(e1); });
                     break;
                 case storm::expressions::OperatorType::Ceil:
-                    return storm::expressions::ceil(e1);
+                    return getOrCreate(operatorType, e1, nullptr, nullptr, [&]() { return storm::expressions::ceil(e1); });
                     break;
                 default:
                     STORM_LOG_ASSERT(false, "Invalid operation.");
@@ -298,7 +344,7 @@ storm::expressions::Expression ExpressionCreator::createFloorCeilExpression(stor
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createRoundExpression(storm::expressions::Expression const& e1, bool& pass) const {
@@ -309,7 +355,7 @@ storm::expressions::Expression ExpressionCreator::createRoundExpression(storm::e
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::createPredicateExpression(storm::expressions::OperatorType const& opTyp,
@@ -330,7 +376,7 @@ storm::expressions::Expression ExpressionCreator::createPredicateExpression(stor
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return falseExpression;
 }
 
 storm::expressions::Expression ExpressionCreator::getIdentifierExpression(std::string const& identifier, bool& pass) const {
@@ -340,11 +386,11 @@ storm::expressions::Expression ExpressionCreator::getIdentifierExpression(std::s
         storm::expressions::Expression const* expression = this->identifiers->find(identifier);
         if (expression == nullptr) {
             pass = false;
-            return manager.boolean(false);
+            return falseExpression;
         }
         return *expression;
     } else {
-        return manager.boolean(false);
+        return falseExpression;
     }
 }
 
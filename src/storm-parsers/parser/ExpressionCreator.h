@@ -1,15 +1,19 @@
 #pragma once
+#include <array>
+#include <map>
 #include <memory>
+#include <unordered_map>
 // Very ugly, but currently we would like to have the symbol table here.
 #include "storm-parsers/parser/SpiritParserDefinitions.h"
 
 #include <boost/optional.hpp>
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/Expression.h"
 
 namespace storm {
 
 namespace expressions {
-class Expression;
+class BaseExpression;
 class ExpressionManager;
 enum struct OperatorType;
 }  // namespace expressions
@@ -53,6 +57,15 @@ class ExpressionCreator {
         acceptDoubleLiterals = set;
     }
 
+    /*!
+     * Sets whether the created expressions are hash-consed, i.e., whether structurally equal (sub)expressions are only created once and are
+     * shared afterwards. This saves memory (and time) for inputs in which the same (sub)expressions occur very often, as it is typically the
+     * case for machine-generated models.
+     */
+    void setHashConsing(bool set = true) {
+        hashConsing = set;
+    }
+
     storm::expressions::Expression createIteExpression(storm::expressions::Expression const& e1, storm::expressions::Expression const& e2,
                                                        storm::expressions::Expression const& e3, bool& pass) const;
 
@@ -86,6 +99,25 @@ class ExpressionCreator {
                                                              std::vector<storm::expressions::Expression> const& operands, bool& pass) const;
 
    private:
+    // The key of an expression in the hash-consing cache: the operator together with the operands (which are kept alive by the key).
+    struct ExpressionKey {
+        storm::expressions::OperatorType operatorType;
+        std::array<std::shared_ptr<storm::expressions::BaseExpression const>, 3> operands;
+
+        bool operator==(ExpressionKey const& other) const;
+    };
+
+    struct ExpressionKeyHash {
+        std::size_t operator()(ExpressionKey const& key) const;
+    };
+
+    // Retrieves the expression with the given operator and operands. If the expression was not yet created (or hash-consing is disabled),
+    // it is created with the given function.
+    template<typename CreateFunction>
+    storm::expressions::Expression getOrCreate(storm::expressions::OperatorType operatorType, storm::expressions::Expression const& e1,
+                                               storm::expressions::Expression const* e2, storm::expressions::Expression const* e3,
+                                               CreateFunction const& create) const;
+
     // The manager responsible for the expressions.
     storm::expressions::ExpressionManager const& manager;
     qi::symbols<char, storm::expressions::Expression> const* identifiers = nullptr;
@@ -95,6 +127,17 @@ class ExpressionCreator {
     bool acceptDoubleLiterals = true;
 
     bool deleteIdentifierMapping = false;
+
+    bool hashConsing = false;
+
+    // The boolean literals. The false literal is also returned whenever no expression is created.
+    storm::expressions::Expression trueExpression;
+    storm::expressions::Expression falseExpression;
+
+    // The caches used for hash-consing.
+    mutable std::unordered_map<ExpressionKey, storm::expressions::Expression, ExpressionKeyHash> expressionCache;
+    mutable std::unordered_map<int64_t, storm::expressions::Expression> integerLiteralCache;
+    mutable std::map<storm::RationalNumber, storm::expressions::Expression> rationalLiteralCache;
 };
 }  // namespace parser
 }  // namespace storm
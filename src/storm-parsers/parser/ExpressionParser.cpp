@@ -310,6 +310,10 @@ void ExpressionParser::setAcceptDoubleLiterals(bool flag) {
     expressionCreator->setAcceptDoubleLiterals(flag);
 }
 
+void ExpressionParser::setHashConsing(bool flag) {
+    expressionCreator->setHashConsing(flag);
+}
+
 bool ExpressionParser::isValidIdentifier(std::string const& identifier) {
     if (this->invalidIdentifiers_.find(identifier) != nullptr) {
         return false;
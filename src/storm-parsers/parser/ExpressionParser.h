@@ -89,6 +89,13 @@ class ExpressionParser : public qi::grammar<Iterator, storm::expressions::Expres
      */
     void setAcceptDoubleLiterals(bool flag);
 
+    /*!
+     * Sets whether structurally equal (sub)expressions are only created once and shared afterwards (hash-consing).
+     *
+     * @param flag If set to true, the created expressions are hash-consed.
+     */
+    void setHashConsing(bool flag);
+
     /*!
      * Parses an expression from the given string.
      * @param ignoreError If set, no exception is thrown upon a parser error. The returned expression will be uninitialized.
@@ -81,29 +81,40 @@ int64_t getSignedInt(typename JaniParser<ValueType>::Json const& structure, std:
     return structure.front();
 }
 
+/*!
+ * Retrieves a callback for the JSON parser that drops the (top-level) properties while reading the document if they are not requested.
+ * This way, they never become part of the parsed structure.
+ */
+template<typename ValueType>
+typename JaniParser<ValueType>::Json::parser_callback_t getParserCallback(bool parseProperties) {
+    return [parseProperties](int depth, typename JaniParser<ValueType>::Json::parse_event_t event, typename JaniParser<ValueType>::Json& parsed) {
+        return parseProperties || depth != 1 || event != JaniParser<ValueType>::Json::parse_event_t::key || parsed != "properties";
+    };
+}
+
 template<typename ValueType>
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parse(std::string const& path, bool parseProperties) {
     JaniParser parser;
-    parser.readFile(path);
+    parser.readFile(path, parseProperties);
     return parser.parseModel(parseProperties);
 }
 
 template<typename ValueType>
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseFromString(std::string const& jsonstring, bool parseProperties) {
-    JaniParser parser(jsonstring);
+    JaniParser parser(jsonstring, parseProperties);
     return parser.parseModel(parseProperties);
 }
 
 template<typename ValueType>
-JaniParser<ValueType>::JaniParser(std::string const& jsonstring) : expressionManager(new storm::expressions::ExpressionManager()) {
-    parsedStructure = Json::parse(jsonstring);
+JaniParser<ValueType>::JaniParser(std::string const& jsonstring, bool parseProperties) : expressionManager(new storm::expressions::ExpressionManager()) {
+    parsedStructure = Json::parse(jsonstring, getParserCallback<ValueType>(parseProperties));
 }
 
 template<typename ValueType>
-void JaniParser<ValueType>::readFile(std::string const& path) {
+void JaniParser<ValueType>::readFile(std::string const& path, bool parseProperties) {
     std::ifstream file;
     storm::utility::openFile(path, file);
-    parsedStructure << file;
+    parsedStructure = Json::parse(file, getParserCallback<ValueType>(parseProperties));
     storm::utility::closeFile(file);
 }
 
@@ -208,8 +219,10 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
     STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
     // Automatons can only be parsed after constants and variables.
-    for (auto const& automataEntry : parsedStructure.at("automata")) {
+    for (auto& automataEntry : parsedStructure.at("automata")) {
         model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+        // The structure of the automaton is no longer needed, so we release its memory right away.
+        automataEntry = nullptr;
     }
     STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
     storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
@@ -1456,7 +1469,7 @@ void JaniParser<ValueType>::parseActions(Json const& actionStructure, storm::jan
 }
 
 template<typename ValueType>
-storm::jani::Automaton JaniParser<ValueType>::parseAutomaton(Json const& automatonStructure, storm::jani::Model const& parentModel, Scope const& globalScope) {
+storm::jani::Automaton JaniParser<ValueType>::parseAutomaton(Json& automatonStructure, storm::jani::Model const& parentModel, Scope const& globalScope) {
     STORM_LOG_THROW(automatonStructure.count("name") == 1, storm::exceptions::InvalidJaniException, "Each automaton must have a name");
     std::string name = getString<ValueType>(automatonStructure.at("name"), " the name field for automaton");
     Scope scope = globalScope.refine(name);
@@ -1550,7 +1563,7 @@ storm::jani::Automaton JaniParser<ValueType>::parseAutomaton(Json const& automat
     automaton.setInitialStatesRestriction(initialValueRestriction);
 
     STORM_LOG_THROW(automatonStructure.count("edges") > 0, storm::exceptions::InvalidJaniException, "Automaton '" << name << "' must have a list of edges");
-    for (auto const& edgeEntry : automatonStructure.at("edges")) {
+    for (auto& edgeEntry : automatonStructure.at("edges")) {
         // source location
         STORM_LOG_THROW(edgeEntry.count("location") == 1, storm::exceptions::InvalidJaniException,
                         "Each edge in automaton '" << name << "' must have a source");
@@ -1683,6 +1696,8 @@ storm::jani::Automaton JaniParser<ValueType>::parseAutomaton(Json const& automat
         automaton.addEdge(storm::jani::Edge(locIds.at(sourceLoc), parentModel.getActionIndex(action),
                                             rateExpr.isInitialized() ? boost::optional<storm::expressions::Expression>(rateExpr) : boost::none, templateEdge,
                                             destinationLocationsAndProbabilities));
+        // Release the structure of the edge, as the edges typically make up most of the document.
+        edgeEntry = nullptr;
     }
 
     return automaton;
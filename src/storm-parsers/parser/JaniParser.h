@@ -39,12 +39,15 @@ class JaniParser {
     typedef storm::json<ValueType> Json;
 
     JaniParser() : expressionManager(new storm::expressions::ExpressionManager()) {}
-    JaniParser(std::string const& jsonstring);
+    JaniParser(std::string const& jsonstring, bool parseProperties = true);
     static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parse(std::string const& path, bool parseProperties = true);
     static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseFromString(std::string const& jsonstring, bool parseProperties = true);
 
    protected:
-    void readFile(std::string const& path);
+    /*!
+     * Reads the JSON document from the given file. If the properties are not requested, they are skipped while reading the document.
+     */
+    void readFile(std::string const& path, bool parseProperties = true);
 
     struct Scope {
         Scope(std::string description = "global", ConstantsMap const* constants = nullptr, VariablesMap const* globalVars = nullptr,
@@ -80,7 +83,8 @@ class JaniParser {
 
     std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseModel(bool parseProperties = true);
     storm::jani::Property parseProperty(storm::jani::Model& model, storm::json<ValueType> const& propertyStructure, Scope const& scope);
-    storm::jani::Automaton parseAutomaton(storm::json<ValueType> const& automatonStructure, storm::jani::Model const& parentModel, Scope const& scope);
+    // Parses the automaton. The structures of the parsed edges are released along the way.
+    storm::jani::Automaton parseAutomaton(storm::json<ValueType>& automatonStructure, storm::jani::Model const& parentModel, Scope const& scope);
     std::pair<std::unique_ptr<storm::jani::JaniType>, storm::expressions::Type> parseType(storm::json<ValueType> const& typeStructure, std::string variableName,
                                                                                           Scope const& scope);
     storm::jani::LValue parseLValue(storm::json<ValueType> const& lValueStructure, Scope const& scope);
@@ -91,6 +91,8 @@ PrismParser::PrismParser(std::string const& filename, Iterator first, bool prism
       annotate(first),
       manager(new storm::expressions::ExpressionManager()),
       expressionParser(new ExpressionParser(*manager, keywords_, false, false)) {
+    // Generated programs often contain the same (sub)expressions very often, so we share them instead of creating them over and over again.
+    expressionParser->setHashConsing(true);
     ExpressionParser& expression_ = *expressionParser;
     boolExpression = (expression_[qi::_val = qi::_1])[qi::_pass = phoenix::bind(&PrismParser::isOfBoolType, phoenix::ref(*this), qi::_val)];
     boolExpression.name("boolean expression");
@@ -2,6 +2,9 @@
 #define STORM_PARSER_VALUEPARSER_H_
 
 #include <boost/lexical_cast.hpp>
+#include <charconv>
+#include <type_traits>
+
 #include "storm-parsers/parser/ExpressionParser.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -55,6 +58,14 @@ class ValueParser {
  */
 template<typename NumberType>
 inline NumberType parseNumber(std::string const& value) {
+    if constexpr (std::is_integral<NumberType>::value && !std::is_same<NumberType, bool>::value) {
+        // Non-negative integers (such as state indices) are parsed with std::from_chars, which is a lot faster than a lexical cast.
+        NumberType result;
+        auto fastResult = std::from_chars(value.data(), value.data() + value.size(), result);
+        if (fastResult.ec == std::errc() && fastResult.ptr == value.data() + value.size()) {
+            return result;
+        }
+    }
     try {
         return boost::lexical_cast<NumberType>(value);
     } catch (boost::bad_lexical_cast&) {
@@ -69,6 +80,13 @@ inline storm::RationalNumber parseNumber(std::string const& value) {
 
 template<>
 inline double parseNumber(std::string const& value) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    double result;
+    auto fastResult = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (fastResult.ec == std::errc() && fastResult.ptr == value.data() + value.size()) {
+        return result;
+    }
+#endif
     try {
         return boost::lexical_cast<double>(value);
     } catch (boost::bad_lexical_cast&) {
@@ -1,5 +1,6 @@
 #include "storm-parsers/util/cstring.h"
 
+#include <charconv>
 #include <cstring>
 
 #include "storm/exceptions/WrongFormatException.h"
@@ -10,6 +11,16 @@ namespace utility {
 
 namespace cstring {
 
+namespace {
+// Returns a pointer to the first whitespace (or terminating) character after the token starting at the given position.
+char const* findTokenEnd(char const* str) {
+    while (*str != '\0' && !isspace(*str)) {
+        ++str;
+    }
+    return str;
+}
+}  // namespace
+
 /*!
  *	Calls strtol() internally and checks if the new pointer is different
  *	from the original one, i.e. if str != *end. If they are the same, a
@@ -19,6 +30,15 @@ namespace cstring {
  *	@return Result of strtol()
  */
 uint_fast64_t checked_strtol(char const* str, char const** end) {
+    // Plain unsigned integers (the common case) are parsed with std::from_chars, which does not depend on the locale and is a lot faster.
+    char const* first = trimWhitespaces(str);
+    uint_fast64_t value;
+    auto fastResult = std::from_chars(first, findTokenEnd(first), value);
+    if (fastResult.ec == std::errc()) {
+        *end = fastResult.ptr;
+        return value;
+    }
+
     uint_fast64_t res = strtol(str, const_cast<char**>(end), 10);
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing integer. Next input token is not a number.");
@@ -37,6 +57,18 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
  *	@return Result of strtod()
  */
 double checked_strtod(char const* str, char const** end) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    // Decimal numbers are parsed with std::from_chars if the standard library supports it for floating point types. Everything it does not
+    // accept (e.g. a leading '+' or hexadecimal numbers) is left to strtod().
+    char const* first = trimWhitespaces(str);
+    double value;
+    auto fastResult = std::from_chars(first, findTokenEnd(first), value);
+    if (fastResult.ec == std::errc()) {
+        *end = fastResult.ptr;
+        return value;
+    }
+#endif
+
     double res = strtod(str, const_cast<char**>(end));
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing floating point. Next input token is not a number.");
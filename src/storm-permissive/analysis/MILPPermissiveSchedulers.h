@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include "storm-permissive/analysis/PermissiveSchedulerComputation.h"
@@ -21,6 +22,12 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
    private:
     bool mCalledOptimizer = false;
     storm::solver::LpSolver<double>& solver;
+    // In incremental mode, the constraints for the model are kept in the solver and only the constraints for the query are replaced.
+    bool mIncremental;
+    bool mModelEncoded = false;
+    std::optional<bool> mEncodedLowerBound;
+    // In incremental mode, the penalty of the scheduler is described by this variable (instead of the objective coefficients).
+    storm::expressions::Variable mPenaltyVariable;
     std::unordered_map<storm::storage::StateActionPair, storm::expressions::Variable> multistrategyVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mProbVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mAlphaVariables;
@@ -28,12 +35,21 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mGammaVariables;
 
    public:
+    /**
+     * @param incremental If set, the MILP is kept in the solver between calls of calculatePermissiveScheduler such that only the parts that
+     * depend on the penalties, the bound and the boundary are replaced. This is useful if permissive schedulers are computed for many penalties on
+     * the same MDP, as the solver does not need to build its model from scratch and may start from the previous solution.
+     */
     MilpPermissiveSchedulerComputation(storm::solver::LpSolver<double>& milpsolver, storm::models::sparse::Mdp<double, RM> const& mdp,
-                                       storm::storage::BitVector const& goalstates, storm::storage::BitVector const& sinkstates)
-        : PermissiveSchedulerComputation<RM>(mdp, goalstates, sinkstates), solver(milpsolver) {}
+                                       storm::storage::BitVector const& goalstates, storm::storage::BitVector const& sinkstates, bool incremental = false)
+        : PermissiveSchedulerComputation<RM>(mdp, goalstates, sinkstates), solver(milpsolver), mIncremental(incremental) {}
 
     void calculatePermissiveScheduler(bool lowerBound, double boundary) override {
-        createMILP(lowerBound, boundary, this->mPenalties);
+        if (mIncremental) {
+            updateMILP(lowerBound, boundary, this->mPenalties);
+        } else {
+            createMILP(lowerBound, boundary, this->mPenalties);
+        }
         // STORM_LOG_DEBUG("Calling optimizer");
         solver.optimize();
         // STORM_LOG_DEBUG("Done optimizing.")
@@ -112,7 +128,8 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 auto stateAndAction = storage::StateActionPair(s, a);
 
                 // Create y_(s,a) variables
-                double penalty = penalties.get(stateAndAction);
+                // In incremental mode, the penalties are not part of the objective but of a constraint that can be replaced.
+                double penalty = mIncremental ? 0.0 : penalties.get(stateAndAction);
                 var = solver.addBinaryVariable("y_" + std::to_string(s) + "_" + std::to_string(a), -penalty);
                 multistrategyVariables[stateAndAction] = var;
 
@@ -127,6 +144,9 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 }
             }
         }
+        if (mIncremental) {
+            mPenaltyVariable = solver.addUnboundedContinuousVariable("pen", 1.0);
+        }
         solver.update();
     }
 
@@ -135,8 +155,15 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
      */
     void createConstraints(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
         // (5) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
+        createBoundaryConstraint(lowerBound, boundary, relevantStates);
+        createBoundDependentConstraints(lowerBound, relevantStates);
+        createModelConstraints(relevantStates);
+    }
 
-        // (1)
+    /**
+     * Create constraint (1), which depends on the bound and the boundary.
+     */
+    void createBoundaryConstraint(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
         STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
@@ -145,18 +172,15 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
         } else {
             solver.addConstraint("c1", mProbVariables[initialStateIndex] <= solver.getConstant(boundary));
         }
+    }
+
+    /**
+     * Create constraints (3), which depend on whether the bound is a lower or an upper bound.
+     */
+    void createBoundDependentConstraints(bool lowerBound, storm::storage::BitVector const& relevantStates) {
         for (uint_fast64_t s : relevantStates) {
             std::string stateString = std::to_string(s);
-            storm::expressions::Expression expr = solver.getConstant(0.0);
-            // (2)
-            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
-            }
-            solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
-            // (5)
-            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
-
-            // (3) For the relevant states.
+            storm::expressions::Expression expr;
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 std::string sastring(stateString + "_" + std::to_string(a));
                 expr = solver.getConstant(0.0);
@@ -175,6 +199,34 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                                          mProbVariables[s] >= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
                 }
             }
+        }
+    }
+
+    /**
+     * Create the constraint that defines the penalty variable (only used in incremental mode).
+     */
+    void createPenaltyConstraint(PermissiveSchedulerPenalties const& penalties) {
+        storm::expressions::Expression expr = solver.getConstant(0.0);
+        for (auto const& entry : multistrategyVariables) {
+            expr = expr + solver.getConstant(penalties.get(entry.first)) * entry.second;
+        }
+        solver.addConstraint("cpen", mPenaltyVariable + expr == solver.getConstant(0.0));
+    }
+
+    /**
+     * Create the constraints (2), (5), (6) and (8), which only depend on the model.
+     */
+    void createModelConstraints(storm::storage::BitVector const& relevantStates) {
+        for (uint_fast64_t s : relevantStates) {
+            std::string stateString = std::to_string(s);
+            storm::expressions::Expression expr = solver.getConstant(0.0);
+            // (2)
+            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
+                expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
+            }
+            solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
+            // (5)
+            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
 
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 // (6)
@@ -221,6 +273,37 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
 
         solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
     }
+
+    /**
+     * Creates the MILP in the first call and otherwise only replaces the constraints that depend on the given query.
+     * The constraints are organized in two scopes on top of the model constraints: one for the constraints that depend on the
+     * type of the bound and one for the boundary and the penalties.
+     */
+    void updateMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
+        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
+        storm::storage::BitVector relevantStates = ~irrelevant;
+        if (!mModelEncoded) {
+            createVariables(penalties, relevantStates);
+            createModelConstraints(relevantStates);
+            solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
+            mModelEncoded = true;
+        } else {
+            solver.pop();
+            if (*mEncodedLowerBound != lowerBound) {
+                solver.pop();
+                mEncodedLowerBound.reset();
+            }
+        }
+        if (!mEncodedLowerBound) {
+            solver.push();
+            createBoundDependentConstraints(lowerBound, relevantStates);
+            mEncodedLowerBound = lowerBound;
+        }
+        solver.push();
+        createBoundaryConstraint(lowerBound, boundary, relevantStates);
+        createPenaltyConstraint(penalties);
+        solver.update();
+    }
 };
 }  // namespace ps
 }  // namespace storm
@@ -16,6 +16,7 @@ const std::string BeliefExplorationSettings::moduleName = "beliefExploration";
 
 const std::string refineOption = "refine";
 const std::string explorationTimeLimitOption = "exploration-time";
+const std::string explorationThreadsOption = "exploration-threads";
 const std::string resolutionOption = "resolution";
 const std::string clipGridResolutionOption = "clip-resolution";
 const std::string sizeThresholdOption = "size-threshold";
@@ -27,6 +28,7 @@ const std::string triangulationModeOption = "triangulationmode";
 const std::string clippingOption = "use-clipping";
 const std::string cutZeroGapOption = "cut-zero-gap";
 const std::string stateEliminationCutoffOption = "state-elimination-cutoff";
+const std::string incrementalSolvingOption = "incremental-solving";
 
 BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -48,6 +50,15 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
             .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "In seconds.").setDefaultValueUnsignedInteger(0).build())
             .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                                   "Sets the number of threads that compute successor beliefs during the exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, resolutionOption, false,
                                        "Sets the resolution of the discretization and how it is increased in case of refinement")
@@ -159,6 +170,10 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
     this->addOption(storm::settings::OptionBuilder(moduleName, stateEliminationCutoffOption, false,
                                                    "If this is set, an additional unfolding step for cut-off beliefs is performed.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, incrementalSolvingOption, false,
+                                                   "If this is set, refinement steps only solve the part of the belief MDP that changed.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BeliefExplorationSettings::isRefineSet() const {
@@ -181,6 +196,10 @@ uint64_t BeliefExplorationSettings::getExplorationTimeLimit() const {
     return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+uint64_t BeliefExplorationSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 uint64_t BeliefExplorationSettings::getResolutionInit() const {
     return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
 }
@@ -249,12 +268,17 @@ bool BeliefExplorationSettings::isCutZeroGapSet() const {
     return this->getOption(cutZeroGapOption).getHasOptionBeenSet();
 }
 
+bool BeliefExplorationSettings::isIncrementalSolvingSet() const {
+    return this->getOption(incrementalSolvingOption).getHasOptionBeenSet();
+}
+
 template<typename ValueType>
 void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
     options.refine = isRefineSet();
     options.refinePrecision = storm::utility::convertNumber<ValueType>(getRefinePrecision());
     options.refineStepLimit = getRefineStepLimit();
     options.explorationTimeLimit = getExplorationTimeLimit();
+    options.explorationThreads = getNumberOfExplorationThreads();
 
     options.clippingGridRes = getClippingGridResolution();
     options.resolutionInit = getResolutionInit();
@@ -282,6 +306,7 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     }
     options.dynamicTriangulation = isDynamicTriangulationModeSet();
     options.cutZeroGap = isCutZeroGapSet();
+    options.incrementalSolving = isIncrementalSolvingSet();
 }
 
 template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(
@@ -39,6 +39,9 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     uint64_t getExplorationTimeLimit() const;
 
+    /// The number of threads that compute successor beliefs
+    uint64_t getNumberOfExplorationThreads() const;
+
     /// Discretization Resolution
     uint64_t getResolutionInit() const;
     double getResolutionFactor() const;
@@ -74,6 +77,9 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     bool isStateEliminationCutoffSet() const;
 
+    /// Controls whether refinement steps only solve the changed part of the belief MDP
+    bool isIncrementalSolvingSet() const;
+
     template<typename ValueType>
     void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
 
@@ -155,6 +155,7 @@ void performQualitativeAnalysis(std::shared_ptr<storm::models::sparse::Pomdp<Val
     // After preprocessing, this might be done cheaper.
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula.asProbabilityOperatorFormula());
     pomdp.getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp.invalidateAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula.asProbabilityOperatorFormula());
     bool computedSomething = false;
     if (qualSettings.isMemlessSearchSet()) {
@@ -506,6 +507,7 @@ int main(const int argc, const char** argv) {
     storm::pomdp::cli::processOptions();
 
     totalTimer.stop();
+    storm::cli::printMemoryLimitDegradations();
     if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
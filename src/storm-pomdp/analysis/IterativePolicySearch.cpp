@@ -90,6 +90,23 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
         k = 10;  // magic constant, consider moving.
     }
 
+    if (analysisScopes > 0) {
+        // The solver still contains the constraints of a previous analysis.
+        reset();
+    }
+    // The encoding of the POMDP depends on the target states, so it can only be reused if they did not change since it was created.
+    if (solverInitialized && encodedTargetStates != targetStates) {
+        STORM_LOG_DEBUG("Target states changed, the POMDP is encoded again.");
+        smtSolver->reset();
+        solverInitialized = false;
+    }
+    if (solverInitialized && (!lookaheadConstraintsRequired || k == lookaheadBound)) {
+        STORM_LOG_DEBUG("Reuse the encoding of the POMDP.");
+        smtSolver->push();
+        analysisScopes = 1;
+        return lookaheadConstraintsRequired;
+    }
+
     if (actionSelectionVars.empty()) {
         for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
             actionSelectionVars.push_back(std::vector<storm::expressions::Variable>());
@@ -132,65 +149,76 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
     if (maxK != std::numeric_limits<uint64_t>::max()) {
         initK = maxK;
     }
-    if (initK < k) {
+    if (lookaheadConstraintsRequired && initK < k) {
         for (uint64_t stateId = 0; stateId < pomdp.getNumberOfStates(); ++stateId) {
-            if (lookaheadConstraintsRequired) {
-                if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                    for (uint64_t i = initK; i < k; ++i) {
-                        pathVars[stateId].push_back(expressionManager->declareBooleanVariable("P-" + std::to_string(stateId) + "-" + std::to_string(i)));
-                        pathVarExpressions[stateId].push_back(pathVars[stateId].back().getExpression());
-                    }
-                } else if (options.pathVariableType == MemlessSearchPathVariables::IntegerRanking) {
-                    pathVars[stateId].push_back(expressionManager->declareIntegerVariable("P-" + std::to_string(stateId)));
+            if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                for (uint64_t i = initK; i < k; ++i) {
+                    pathVars[stateId].push_back(expressionManager->declareBooleanVariable("P-" + std::to_string(stateId) + "-" + std::to_string(i)));
                     pathVarExpressions[stateId].push_back(pathVars[stateId].back().getExpression());
+                }
+            } else if (pathVars[stateId].empty()) {
+                if (options.pathVariableType == MemlessSearchPathVariables::IntegerRanking) {
+                    pathVars[stateId].push_back(expressionManager->declareIntegerVariable("P-" + std::to_string(stateId)));
                 } else {
                     assert(options.pathVariableType == MemlessSearchPathVariables::RealRanking);
                     pathVars[stateId].push_back(expressionManager->declareRationalVariable("P-" + std::to_string(stateId)));
-                    pathVarExpressions[stateId].push_back(pathVars[stateId].back().getExpression());
                 }
+                pathVarExpressions[stateId].push_back(pathVars[stateId].back().getExpression());
             }
         }
+        maxK = k;
     }
 
     assert(!lookaheadConstraintsRequired || pathVarExpressions.size() == pomdp.getNumberOfStates());
     assert(reachVars.size() == pomdp.getNumberOfStates());
     assert(reachVarExpressions.size() == pomdp.getNumberOfStates());
 
-    uint64_t obs = 0;
+    // The constraints are organised in scopes: The (outermost) encoding of the POMDP includes the constraints on the path variables that remain
+    // valid for larger lookaheads, the next scope bounds the path variables by the current lookahead and the innermost scope(s) contain the
+    // constraints of the current analysis. Thus, only the constraints for the additional lookahead have to be added if the lookahead grows.
+    bool encodePomdp = !solverInitialized;
+    if (encodePomdp) {
+        encodedLookahead = 1;
+    } else {
+        // Remove the bounds of the previous lookahead.
+        smtSolver->pop();
+    }
+    uint64_t fromK = encodedLookahead;
 
-    for (auto const& statesForObservation : statesPerObservation) {
-        if (pomdp.getNumberOfChoices(statesForObservation.front()) == 1) {
-            ++obs;
-            continue;
-        }
-        if (options.onlyDeterministicStrategies || statesForObservation.size() == 1) {
-            for (uint64_t a = 0; a < pomdp.getNumberOfChoices(statesForObservation.front()) - 1; ++a) {
-                for (uint64_t b = a + 1; b < pomdp.getNumberOfChoices(statesForObservation.front()); ++b) {
-                    smtSolver->add(!(actionSelectionVarExpressions[obs][a]) || !(actionSelectionVarExpressions[obs][b]));
+    uint64_t obs = 0;
+    if (encodePomdp) {
+        for (auto const& statesForObservation : statesPerObservation) {
+            if (pomdp.getNumberOfChoices(statesForObservation.front()) == 1) {
+                ++obs;
+                continue;
+            }
+            if (options.onlyDeterministicStrategies || statesForObservation.size() == 1) {
+                for (uint64_t a = 0; a < pomdp.getNumberOfChoices(statesForObservation.front()) - 1; ++a) {
+                    for (uint64_t b = a + 1; b < pomdp.getNumberOfChoices(statesForObservation.front()); ++b) {
+                        smtSolver->add(!(actionSelectionVarExpressions[obs][a]) || !(actionSelectionVarExpressions[obs][b]));
+                    }
                 }
             }
+            ++obs;
         }
-        ++obs;
-    }
 
-    obs = 0;
-    for (auto const& actionVars : actionSelectionVarExpressions) {
-        std::vector<storm::expressions::Expression> actExprs = actionVars;
-        actExprs.push_back(followVarExpressions[obs]);
-        smtSolver->add(storm::expressions::disjunction(actExprs));
-        for (auto const& av : actionVars) {
-            smtSolver->add(!followVarExpressions[obs] || !av);
+        obs = 0;
+        for (auto const& actionVars : actionSelectionVarExpressions) {
+            std::vector<storm::expressions::Expression> actExprs = actionVars;
+            actExprs.push_back(followVarExpressions[obs]);
+            smtSolver->add(storm::expressions::disjunction(actExprs));
+            for (auto const& av : actionVars) {
+                smtSolver->add(!followVarExpressions[obs] || !av);
+            }
+            ++obs;
         }
-        ++obs;
-    }
 
-    // Update at least one observation.
-    // PAPER COMMENT: 2
-    smtSolver->add(storm::expressions::disjunction(observationUpdatedExpressions));
+        // Update at least one observation.
+        // PAPER COMMENT: 2
+        smtSolver->add(storm::expressions::disjunction(observationUpdatedExpressions));
 
-    // PAPER COMMENT: 3
-    if (lookaheadConstraintsRequired) {
-        if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+        // PAPER COMMENT: 3
+        if (lookaheadConstraintsRequired && options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
                 if (targetStates.get(state)) {
                     smtSolver->add(pathVarExpressions[state][0]);
@@ -198,73 +226,65 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
                     smtSolver->add(!pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
                 }
             }
-        } else {
-            for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-                smtSolver->add(pathVarExpressions[state][0] <= expressionManager->integer(k));
-                smtSolver->add(pathVarExpressions[state][0] >= expressionManager->integer(0));
-            }
         }
-    }
 
-    uint64_t rowindex = 0;
-    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-        if (targetStates.get(state) || surelyReachSinkStates.get(state)) {
-            rowindex += pomdp.getNumberOfChoices(state);
-            continue;
-        }
-        for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-            std::vector<storm::expressions::Expression> subexprreachSwitch;
-            std::vector<storm::expressions::Expression> subexprreachNoSwitch;
+        uint64_t rowindex = 0;
+        for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+            if (targetStates.get(state) || surelyReachSinkStates.get(state)) {
+                rowindex += pomdp.getNumberOfChoices(state);
+                continue;
+            }
+            for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                std::vector<storm::expressions::Expression> subexprreachSwitch;
+                std::vector<storm::expressions::Expression> subexprreachNoSwitch;
 
-            subexprreachSwitch.push_back(!reachVarExpressions[state]);
-            subexprreachSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
-            subexprreachSwitch.push_back(!switchVarExpressions[pomdp.getObservation(state)]);
-            subexprreachSwitch.push_back(followVarExpressions[pomdp.getObservation(state)]);
+                subexprreachSwitch.push_back(!reachVarExpressions[state]);
+                subexprreachSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
+                subexprreachSwitch.push_back(!switchVarExpressions[pomdp.getObservation(state)]);
+                subexprreachSwitch.push_back(followVarExpressions[pomdp.getObservation(state)]);
 
-            subexprreachNoSwitch.push_back(!reachVarExpressions[state]);
-            subexprreachNoSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
-            subexprreachNoSwitch.push_back(switchVarExpressions[pomdp.getObservation(state)]);
-            subexprreachNoSwitch.push_back(followVarExpressions[pomdp.getObservation(state)]);
+                subexprreachNoSwitch.push_back(!reachVarExpressions[state]);
+                subexprreachNoSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
+                subexprreachNoSwitch.push_back(switchVarExpressions[pomdp.getObservation(state)]);
+                subexprreachNoSwitch.push_back(followVarExpressions[pomdp.getObservation(state)]);
 
-            for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
-                if (!delayedSwitching || pomdp.getObservation(entries.getColumn()) != pomdp.getObservation(state)) {
-                    subexprreachSwitch.push_back(continuationVarExpressions.at(entries.getColumn()));
-                } else {
-                    // TODO: This could be the spot where delayed switching is broken.
-                    subexprreachSwitch.push_back(reachVarExpressions.at(entries.getColumn()));
-                    subexprreachSwitch.push_back(continuationVarExpressions.at(entries.getColumn()));
+                for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
+                    if (!delayedSwitching || pomdp.getObservation(entries.getColumn()) != pomdp.getObservation(state)) {
+                        subexprreachSwitch.push_back(continuationVarExpressions.at(entries.getColumn()));
+                    } else {
+                        // TODO: This could be the spot where delayed switching is broken.
+                        subexprreachSwitch.push_back(reachVarExpressions.at(entries.getColumn()));
+                        subexprreachSwitch.push_back(continuationVarExpressions.at(entries.getColumn()));
+                    }
+                    smtSolver->add(storm::expressions::disjunction(subexprreachSwitch));
+                    subexprreachSwitch.pop_back();
+                    subexprreachNoSwitch.push_back(reachVarExpressions.at(entries.getColumn()));
+                    smtSolver->add(storm::expressions::disjunction(subexprreachNoSwitch));
+                    subexprreachNoSwitch.pop_back();
                 }
-                smtSolver->add(storm::expressions::disjunction(subexprreachSwitch));
-                subexprreachSwitch.pop_back();
-                subexprreachNoSwitch.push_back(reachVarExpressions.at(entries.getColumn()));
-                smtSolver->add(storm::expressions::disjunction(subexprreachNoSwitch));
-                subexprreachNoSwitch.pop_back();
+                rowindex++;
             }
-            rowindex++;
         }
     }
 
-    rowindex = 0;
+    uint64_t rowindex = 0;
     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
         if (surelyReachSinkStates.get(state)) {
-            smtSolver->add(!reachVarExpressions[state]);
-            smtSolver->add(!continuationVarExpressions[state]);
-            if (lookaheadConstraintsRequired) {
-                if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                    for (uint64_t j = 1; j < k; ++j) {
-                        smtSolver->add(!pathVarExpressions[state][j]);
-                    }
-                } else {
-                    smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(k));
+            if (encodePomdp) {
+                smtSolver->add(!reachVarExpressions[state]);
+                smtSolver->add(!continuationVarExpressions[state]);
+            }
+            if (lookaheadConstraintsRequired && options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                for (uint64_t j = fromK; j < k; ++j) {
+                    smtSolver->add(!pathVarExpressions[state][j]);
                 }
             }
             rowindex += pomdp.getNumberOfChoices(state);
         } else if (!targetStates.get(state)) {
             if (lookaheadConstraintsRequired) {
                 if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                    smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state), pathVarExpressions.at(state).back()));
                     std::vector<std::vector<std::vector<storm::expressions::Expression>>> pathsubsubexprs;
-                    for (uint64_t j = 1; j < k; ++j) {
+                    for (uint64_t j = fromK; j < k; ++j) {
                         pathsubsubexprs.push_back(std::vector<std::vector<storm::expressions::Expression>>());
                         for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
                             pathsubsubexprs.back().push_back(std::vector<storm::expressions::Expression>());
@@ -272,20 +292,19 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
                     }
 
                     for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                        std::vector<storm::expressions::Expression> subexprreach;
                         for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
-                            for (uint64_t j = 1; j < k; ++j) {
-                                pathsubsubexprs[j - 1][action].push_back(pathVarExpressions[entries.getColumn()][j - 1]);
+                            for (uint64_t j = fromK; j < k; ++j) {
+                                pathsubsubexprs[j - fromK][action].push_back(pathVarExpressions[entries.getColumn()][j - 1]);
                             }
                         }
                         rowindex++;
                     }
 
-                    for (uint64_t j = 1; j < k; ++j) {
+                    for (uint64_t j = fromK; j < k; ++j) {
                         std::vector<storm::expressions::Expression> pathsubexprs;
                         for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
                             pathsubexprs.push_back(actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action) &&
-                                                   storm::expressions::disjunction(pathsubsubexprs[j - 1][action]));
+                                                   storm::expressions::disjunction(pathsubsubexprs[j - fromK][action]));
                         }
                         if (!delayedSwitching) {
                             pathsubexprs.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
@@ -293,7 +312,7 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
                         }
                         smtSolver->add(storm::expressions::iff(pathVarExpressions[state][j], storm::expressions::disjunction(pathsubexprs)));
                     }
-                } else {
+                } else if (encodePomdp) {
                     std::vector<storm::expressions::Expression> actPathDisjunction;
                     for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
                         std::vector<storm::expressions::Expression> pathDisjunction;
@@ -315,33 +334,65 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
         } else {
             if (lookaheadConstraintsRequired) {
                 if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                    for (uint64_t j = 1; j < k; ++j) {
+                    for (uint64_t j = fromK; j < k; ++j) {
                         smtSolver->add(pathVarExpressions[state][j]);
                     }
-                } else {
+                } else if (encodePomdp) {
                     smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(0));
                 }
             }
-            smtSolver->add(reachVars[state]);
+            if (encodePomdp) {
+                smtSolver->add(reachVars[state]);
+            }
             rowindex += pomdp.getNumberOfChoices(state);
         }
     }
 
-    obs = 0;
-    for (auto const& statesForObservation : statesPerObservation) {
-        for (auto const& state : statesForObservation) {
-            if (!targetStates.get(state)) {
-                smtSolver->add(!continuationVars[state] || schedulerVariableExpressions[obs] > 0);
-                smtSolver->add(!reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
+    if (encodePomdp) {
+        obs = 0;
+        for (auto const& statesForObservation : statesPerObservation) {
+            for (auto const& state : statesForObservation) {
+                if (!targetStates.get(state)) {
+                    smtSolver->add(!continuationVars[state] || schedulerVariableExpressions[obs] > 0);
+                    smtSolver->add(!reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
+                }
             }
+            ++obs;
+        }
+
+        for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+            smtSolver->add(storm::expressions::implies(switchVarExpressions[observation],
+                                                       storm::expressions::disjunction(reachVarExpressionsPerObservation[observation])));
         }
-        ++obs;
+        encodedTargetStates = targetStates;
+        solverInitialized = true;
+    }
+    if (lookaheadConstraintsRequired) {
+        encodedLookahead = std::max(encodedLookahead, k);
     }
 
-    for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
-        smtSolver->add(
-            storm::expressions::implies(switchVarExpressions[observation], storm::expressions::disjunction(reachVarExpressionsPerObservation[observation])));
+    // Bound the path variables by the lookahead.
+    smtSolver->push();
+    if (lookaheadConstraintsRequired) {
+        for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+            if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                if (!surelyReachSinkStates.get(state) && !targetStates.get(state)) {
+                    smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state), pathVarExpressions.at(state).at(k - 1)));
+                }
+            } else {
+                smtSolver->add(pathVarExpressions[state][0] <= expressionManager->integer(k));
+                smtSolver->add(pathVarExpressions[state][0] >= expressionManager->integer(0));
+                if (surelyReachSinkStates.get(state)) {
+                    smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(k));
+                }
+            }
+        }
+        lookaheadBound = k;
     }
+
+    // Open the scope for the constraints of the analysis.
+    smtSolver->push();
+    analysisScopes = 1;
     return lookaheadConstraintsRequired;
 }
 
@@ -369,11 +420,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     STORM_LOG_DEBUG("Target states " << targetStates);
     STORM_LOG_DEBUG("Questionmark states " << (~surelyReachSinkStates & ~targetStates));
     stats.initializeSolverTimer.start();
-    // TODO: When do we need to reinitialize? When the solver has been reset.
     bool lookaheadConstraintsRequired = initialize(k);
-    if (lookaheadConstraintsRequired) {
-        maxK = k;
-    }
 
     stats.winningRegionUpdatesTimer.start();
     storm::storage::BitVector updated(pomdp.getNrObservations());
@@ -479,6 +526,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     }
 
     smtSolver->push();
+    ++analysisScopes;
     for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
         auto constant = expressionManager->integer(schedulerForObs[obs]);
         smtSolver->add(schedulerVariableExpressions[obs] <= constant);
@@ -655,6 +703,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
         }
         // smtSolver->unsetTimeout();
         smtSolver->pop();
+        --analysisScopes;
 
         if (options.computeDebugOutput()) {
             std::stringstream strstr;
@@ -805,6 +854,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
         finalSchedulers.push_back(scheduler);
 
         smtSolver->push();
+        ++analysisScopes;
 
         for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
             if (winningRegion.observationIsWinning(obs)) {
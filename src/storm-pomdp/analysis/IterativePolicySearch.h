@@ -193,15 +193,27 @@ class IterativePolicySearch {
    private:
     storm::expressions::Expression const& getDoneActionExpression(uint64_t obs) const;
 
+    /*!
+     * Removes the constraints of the current analysis from the solver. The encoding of the POMDP is kept and reused by the next initialization
+     * (as long as the target states do not change), while the winning region is kept anyway.
+     */
     void reset() {
         STORM_LOG_INFO("Reset solver to restart with current winning region");
         schedulerForObs.clear();
         finalSchedulers.clear();
-        smtSolver->reset();
+        smtSolver->pop(analysisScopes);
+        analysisScopes = 0;
     }
     void printScheduler(std::vector<InternalObservationScheduler> const&);
     void coveredStatesToStream(std::ostream& os, storm::storage::BitVector const& remaining) const;
 
+    /*!
+     * Prepares the solver for an analysis with lookahead k. Only the constraints that are not yet present in the solver are added, i.e., the
+     * encoding of the POMDP is created if the solver is (or has to be) empty and the constraints on the path variables are extended to the given
+     * lookahead otherwise.
+     *
+     * @return True iff lookahead constraints are required.
+     */
     bool initialize(uint64_t k);
 
     bool smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions = {});
@@ -211,6 +223,15 @@ class IterativePolicySearch {
     std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
     uint64_t maxK = std::numeric_limits<uint64_t>::max();
 
+    // Whether the solver contains the encoding of the POMDP and the target states this encoding was created for.
+    bool solverInitialized = false;
+    storm::storage::BitVector encodedTargetStates;
+    // The lookahead up to which the encoding contains the constraints on the path variables and the lookahead that currently bounds them.
+    uint64_t encodedLookahead = 1;
+    uint64_t lookaheadBound = 0;
+    // The number of solver scopes that contain constraints of the current analysis.
+    uint64_t analysisScopes = 0;
+
     storm::storage::BitVector surelyReachSinkStates;
     storm::storage::BitVector targetStates;
     std::vector<std::vector<uint64_t>> statesPerObservation;
@@ -1,5 +1,7 @@
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 
+#include <algorithm>
+
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/api/verification.h"
@@ -12,6 +14,7 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -36,7 +39,11 @@ template<typename PomdpType, typename BeliefValueType>
 BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,
                                                                  storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const &pomdpValueBounds,
                                                                  ExplorationHeuristic explorationHeuristic)
-    : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), explHeuristic(explorationHeuristic), status(Status::Uninitialized) {
+    : beliefManager(beliefManager),
+      pomdpValueBounds(pomdpValueBounds),
+      incrementalSolving(false),
+      explHeuristic(explorationHeuristic),
+      status(Status::Uninitialized) {
     // Intentionally left empty
 }
 
@@ -233,6 +240,18 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefsOfNextUnexploredStates(
+    uint64_t maxNumberOfStates) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    // States are explored in the order of decreasing priority
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && res.size() < maxNumberOfStates; ++stateIt) {
+        res.push_back(getBeliefId(stateIt->second));
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -913,24 +932,281 @@ template<typename PomdpType, typename BeliefValueType>
 void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir) {
     STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
     STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
-    auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-    auto task = createStandardCheckTask(property);
+    bool solved = false;
+    if (incrementalSolving && previouslySolvedMdp && previouslySolvedMdp->dir == dir &&
+        previouslySolvedMdp->mdp->hasRewardModel() == exploredMdp->hasRewardModel()) {
+        solved = computeValuesOfExploredMdpIncrementally(env, dir, computePreviouslySolvedStates());
+    }
 
-    std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
-    if (res) {
-        values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
-        scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+    if (!solved) {
+        auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
+        auto task = createStandardCheckTask(property);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
+        if (res) {
+            values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+            scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+            solved = true;
+        } else {
+            STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+            STORM_LOG_ERROR("No result obtained while checking.");
+        }
+    }
+    if (solved) {
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                   "Computed values are smaller than the lower bound.");
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
                                   "Computed values are larger than the upper bound.");
+        if (incrementalSolving) {
+            SolvedMdp solvedMdp;
+            solvedMdp.mdp = exploredMdp;
+            solvedMdp.dir = dir;
+            solvedMdp.values = values;
+            solvedMdp.scheduler = scheduler;
+            if (exploredMdp->hasRewardModel()) {
+                solvedMdp.choiceRewards = exploredMdp->getUniqueRewardModel().getTotalRewardVector(exploredMdp->getTransitionMatrix());
+            }
+            solvedMdp.beliefIdToMdpStateMap = beliefIdToMdpStateMap;
+            solvedMdp.extraTargetState = extraTargetState;
+            solvedMdp.extraBottomState = extraBottomState;
+            previouslySolvedMdp = std::move(solvedMdp);
+        }
     } else {
-        STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
-        STORM_LOG_ERROR("No result obtained while checking.");
+        previouslySolvedMdp = std::nullopt;
     }
     status = Status::ModelChecked;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+void BeliefMdpExplorer<PomdpType, BeliefValueType>::setIncrementalSolving(bool value) {
+    incrementalSolving = value;
+    if (!incrementalSolving) {
+        previouslySolvedMdp = std::nullopt;
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType> BeliefMdpExplorer<PomdpType, BeliefValueType>::computePreviouslySolvedStates()
+    const {
+    STORM_LOG_ASSERT(previouslySolvedMdp, "No previously solved MDP available.");
+    auto const &previousMdp = *previouslySolvedMdp->mdp;
+    uint64_t numberOfStates = exploredMdp->getNumberOfStates();
+
+    // First map the states via their beliefs
+    std::vector<MdpStateType> previousStates(numberOfStates, noState());
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        if (extraTargetState && state == extraTargetState.value()) {
+            previousStates[state] = previouslySolvedMdp->extraTargetState.value_or(noState());
+        } else if (extraBottomState && state == extraBottomState.value()) {
+            previousStates[state] = previouslySolvedMdp->extraBottomState.value_or(noState());
+        } else {
+            auto previousStateIt = previouslySolvedMdp->beliefIdToMdpStateMap.find(mdpStateToBeliefIdMap[state]);
+            if (previousStateIt != previouslySolvedMdp->beliefIdToMdpStateMap.end()) {
+                previousStates[state] = previousStateIt->second;
+            }
+        }
+    }
+
+    // Then check whether the mapped states behave the same
+    std::vector<ValueType> choiceRewards;
+    if (exploredMdp->hasRewardModel()) {
+        choiceRewards = exploredMdp->getUniqueRewardModel().getTotalRewardVector(exploredMdp->getTransitionMatrix());
+    }
+    auto const &transitions = exploredMdp->getTransitionMatrix();
+    auto const &previousTransitions = previousMdp.getTransitionMatrix();
+    auto const &targets = exploredMdp->getStates("target");
+    auto const &previousTargets = previousMdp.getStates("target");
+    std::vector<MdpStateType> result(numberOfStates, noState());
+    std::vector<std::pair<MdpStateType, ValueType>> mappedRow;
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        MdpStateType previousState = previousStates[state];
+        if (previousState == noState() || targets.get(state) != previousTargets.get(previousState) ||
+            transitions.getRowGroupSize(state) != previousTransitions.getRowGroupSize(previousState)) {
+            continue;
+        }
+        bool sameBehavior = true;
+        for (uint64_t localChoice = 0; sameBehavior && localChoice < transitions.getRowGroupSize(state); ++localChoice) {
+            uint64_t choice = transitions.getRowGroupIndices()[state] + localChoice;
+            uint64_t previousChoice = previousTransitions.getRowGroupIndices()[previousState] + localChoice;
+            if (!choiceRewards.empty() && choiceRewards[choice] != previouslySolvedMdp->choiceRewards[previousChoice]) {
+                sameBehavior = false;
+                break;
+            }
+            auto const &previousRow = previousTransitions.getRow(previousChoice);
+            if (transitions.getRow(choice).getNumberOfEntries() != previousRow.getNumberOfEntries()) {
+                sameBehavior = false;
+                break;
+            }
+            mappedRow.clear();
+            for (auto const &entry : transitions.getRow(choice)) {
+                if (previousStates[entry.getColumn()] == noState()) {
+                    sameBehavior = false;
+                    break;
+                }
+                mappedRow.emplace_back(previousStates[entry.getColumn()], entry.getValue());
+            }
+            if (sameBehavior) {
+                std::sort(mappedRow.begin(), mappedRow.end(), [](auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
+                auto mappedEntryIt = mappedRow.begin();
+                for (auto const &previousEntry : previousRow) {
+                    if (mappedEntryIt->first != previousEntry.getColumn() || mappedEntryIt->second != previousEntry.getValue()) {
+                        sameBehavior = false;
+                        break;
+                    }
+                    ++mappedEntryIt;
+                }
+            }
+        }
+        if (sameBehavior) {
+            result[state] = previousState;
+        }
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType>
+bool BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdpIncrementally(storm::Environment const &env,
+                                                                                            storm::solver::OptimizationDirection const &dir,
+                                                                                            std::vector<MdpStateType> const &previouslySolvedStates) {
+    bool computeRewards = exploredMdp->hasRewardModel();
+    uint64_t numberOfStates = exploredMdp->getNumberOfStates();
+    auto const &transitions = exploredMdp->getTransitionMatrix();
+
+    // The states that need to be solved again are the ones that can reach a state without a counterpart.
+    // All other states only reach states with the same behavior as in the previously solved MDP, so their values did not change.
+    storm::storage::BitVector changedStates(numberOfStates, false);
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        if (previouslySolvedStates[state] == noState()) {
+            changedStates.set(state, true);
+        }
+    }
+    storm::storage::BitVector affectedStates = storm::utility::graph::performProbGreater0(
+        exploredMdp->getBackwardTransitions(), storm::storage::BitVector(numberOfStates, true), changedStates);
+    if (affectedStates.full()) {
+        return false;
+    }
+    STORM_LOG_INFO("Incrementally solving the explored MDP: " << affectedStates.getNumberOfSetBits() << " of " << numberOfStates
+                                                              << " states need to be solved again.");
+    std::vector<ValueType> newValues(numberOfStates);
+    auto newScheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(numberOfStates);
+    for (auto state : ~affectedStates) {
+        newValues[state] = previouslySolvedMdp->values[previouslySolvedStates[state]];
+        if (computeRewards && storm::utility::isInfinity(newValues[state])) {
+            return false;
+        }
+        newScheduler->setChoice(previouslySolvedMdp->scheduler->getChoice(previouslySolvedStates[state]), state);
+    }
+
+    if (!affectedStates.empty()) {
+        // Build the sub-MDP of the affected states. Transitions to unaffected states are redirected to two extra states (target and bottom).
+        // For probabilities, a transition to an unaffected state s with probability p yields probability p * value(s) to reach the target.
+        // For rewards, the transition yields reward p * value(s) and leads to the target.
+        uint64_t numberOfSubStates = affectedStates.getNumberOfSetBits() + 2;
+        MdpStateType subTarget = numberOfSubStates - 2;
+        MdpStateType subBottom = numberOfSubStates - 1;
+        std::vector<uint64_t> toSubState = affectedStates.getNumberOfSetBitsBeforeIndices();
+        std::vector<ValueType> choiceRewards;
+        if (computeRewards) {
+            choiceRewards = exploredMdp->getUniqueRewardModel().getTotalRewardVector(transitions);
+        }
+        std::vector<ValueType> subChoiceRewards;
+        uint64_t numberOfSubChoices = 2;
+        for (auto state : affectedStates) {
+            numberOfSubChoices += transitions.getRowGroupSize(state);
+        }
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfSubChoices, numberOfSubStates, 0, true, true, numberOfSubStates);
+        uint64_t subChoice = 0;
+        for (auto state : affectedStates) {
+            builder.newRowGroup(subChoice);
+            for (uint64_t choice = transitions.getRowGroupIndices()[state]; choice < transitions.getRowGroupIndices()[state + 1]; ++choice) {
+                ValueType toTarget = storm::utility::zero<ValueType>();
+                ValueType toBottom = storm::utility::zero<ValueType>();
+                ValueType reward = computeRewards ? choiceRewards[choice] : storm::utility::zero<ValueType>();
+                for (auto const &entry : transitions.getRow(choice)) {
+                    if (affectedStates.get(entry.getColumn())) {
+                        builder.addNextValue(subChoice, toSubState[entry.getColumn()], entry.getValue());
+                    } else if (computeRewards) {
+                        reward += entry.getValue() * newValues[entry.getColumn()];
+                        toTarget += entry.getValue();
+                    } else {
+                        toTarget += entry.getValue() * newValues[entry.getColumn()];
+                        toBottom += entry.getValue() * (storm::utility::one<ValueType>() - newValues[entry.getColumn()]);
+                    }
+                }
+                if (!storm::utility::isZero(toTarget)) {
+                    builder.addNextValue(subChoice, subTarget, toTarget);
+                }
+                if (toBottom > storm::utility::zero<ValueType>()) {
+                    builder.addNextValue(subChoice, subBottom, toBottom);
+                }
+                if (computeRewards) {
+                    subChoiceRewards.push_back(reward);
+                }
+                ++subChoice;
+            }
+        }
+        for (MdpStateType sinkState : {subTarget, subBottom}) {
+            builder.newRowGroup(subChoice);
+            builder.addNextValue(subChoice, sinkState, storm::utility::one<ValueType>());
+            ++subChoice;
+            if (computeRewards) {
+                subChoiceRewards.push_back(storm::utility::zero<ValueType>());
+            }
+        }
+
+        storm::models::sparse::StateLabeling subLabeling(numberOfSubStates);
+        subLabeling.addLabel("init");
+        subLabeling.addLabelToState("init", affectedStates.get(initialMdpState) ? toSubState[initialMdpState] : 0);
+        storm::storage::BitVector subTargets = exploredMdp->getStates("target") % affectedStates;
+        subTargets.resize(numberOfSubStates, false);
+        subTargets.set(subTarget, true);
+        subLabeling.addLabel("target", std::move(subTargets));
+        std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> subRewardModels;
+        if (computeRewards) {
+            subRewardModels.emplace("default", storm::models::sparse::StandardRewardModel<ValueType>(std::nullopt, std::move(subChoiceRewards)));
+        }
+        auto subMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(builder.build(), std::move(subLabeling), std::move(subRewardModels));
+
+        // Use the current estimates and the previous choices as hints.
+        std::vector<ValueType> subValueHint = storm::utility::vector::filterVector(values, affectedStates);
+        subValueHint.push_back(computeRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+        subValueHint.push_back(storm::utility::zero<ValueType>());
+        storm::storage::Scheduler<ValueType> subSchedulerHint(numberOfSubStates);
+        for (auto state : affectedStates) {
+            if (previouslySolvedStates[state] != noState()) {
+                subSchedulerHint.setChoice(previouslySolvedMdp->scheduler->getChoice(previouslySolvedStates[state]), toSubState[state]);
+            } else {
+                subSchedulerHint.setChoice(0, toSubState[state]);
+            }
+        }
+        subSchedulerHint.setChoice(0, subTarget);
+        subSchedulerHint.setChoice(0, subBottom);
+
+        auto property = createStandardProperty(dir, computeRewards);
+        auto task = storm::api::createTask<ValueType>(property, false);
+        auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+        hint->setResultHint(std::move(subValueHint));
+        hint->setSchedulerHint(std::move(subSchedulerHint));
+        task.setHint(hint);
+        task.setProduceSchedulers();
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, subMdp, task));
+        if (!res) {
+            STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+            return false;
+        }
+        auto const &subValues = res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+        auto const &subScheduler = res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler();
+        for (auto state : affectedStates) {
+            newValues[state] = subValues[toSubState[state]];
+            newScheduler->setChoice(subScheduler.getChoice(toSubState[state]), state);
+        }
+    }
+
+    values = std::move(newValues);
+    scheduler = std::move(newScheduler);
+    return true;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
     return status == Status::ModelChecked;
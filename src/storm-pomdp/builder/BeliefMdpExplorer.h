@@ -63,6 +63,12 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of (at most) the given number of unexplored states in the order in which they are going to be explored.
+     * The order might change if further states are added to the exploration queue.
+     */
+    std::vector<BeliefId> getBeliefsOfNextUnexploredStates(uint64_t maxNumberOfStates) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -182,6 +188,14 @@ class BeliefMdpExplorer {
 
     void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
 
+    /*!
+     * Sets whether the values of the explored MDP are computed incrementally.
+     * If enabled, the solution of the most recent call of computeValuesOfExploredMdp is kept. In the next call, states whose transitions, rewards, and
+     * successors (in the previously solved MDP) did not change keep their previous value and choice, such that only the part of the MDP that can reach
+     * new or modified states is solved again.
+     */
+    void setIncrementalSolving(bool value);
+
     bool hasComputedValues() const;
 
     bool hasFMSchedulerValues() const;
@@ -274,6 +288,21 @@ class BeliefMdpExplorer {
 
     MdpStateType getOrAddMdpState(BeliefId const &beliefId, ValueType const &transitionValue = storm::utility::zero<ValueType>());
 
+    /*!
+     * Maps each state of the explored MDP to the state of the previously solved MDP with the same belief, provided that both states have the same
+     * behavior, i.e., the same target status and the same choices, rewards, and transitions (modulo the mapping of the successor states).
+     * @return the corresponding states of the previously solved MDP, where noState() indicates that there is no state with the same behavior.
+     */
+    std::vector<MdpStateType> computePreviouslySolvedStates() const;
+
+    /*!
+     * Solves the explored MDP by only considering the states that can reach a state without a counterpart in the previously solved MDP.
+     * All other states get the value and the choice of their counterpart.
+     * @return false if this is not possible (e.g. because of infinite values at the unchanged states).
+     */
+    bool computeValuesOfExploredMdpIncrementally(storm::Environment const &env, storm::solver::OptimizationDirection const &dir,
+                                                 std::vector<MdpStateType> const &previouslySolvedStates);
+
     // Belief state related information
     std::shared_ptr<BeliefManagerType> beliefManager;
     std::vector<BeliefId> mdpStateToBeliefIdMap;
@@ -319,6 +348,20 @@ class BeliefMdpExplorer {
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
 
+    // Information on the most recently solved MDP, used for incremental solving
+    struct SolvedMdp {
+        std::shared_ptr<storm::models::sparse::Mdp<ValueType>> mdp;
+        storm::solver::OptimizationDirection dir;
+        std::vector<ValueType> values;
+        std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+        std::vector<ValueType> choiceRewards;
+        std::map<BeliefId, MdpStateType> beliefIdToMdpStateMap;
+        std::optional<MdpStateType> extraTargetState;
+        std::optional<MdpStateType> extraBottomState;
+    };
+    bool incrementalSolving;
+    std::optional<SolvedMdp> previouslySolvedMdp;
+
     // The current status of this explorer
     ExplorationHeuristic explHeuristic;
     Status status;
@@ -327,6 +327,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             overApproxBeliefManager->setRewardModel(rewardModelName);
         }
         overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, trivialPOMDPBounds, storm::builder::ExplorationHeuristic::BreadthFirst);
+        overApproximation->setIncrementalSolving(options.incrementalSolving);
         overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
         overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -355,6 +356,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             underApproxBeliefManager->setRewardModel(rewardModelName);
         }
         underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+        underApproximation->setIncrementalSolving(options.incrementalSolving);
         underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
         underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -596,6 +598,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
 
     // set up belief MDP explorer
     interactiveUnderApproximationExplorer = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+    interactiveUnderApproximationExplorer->setIncrementalSolving(options.incrementalSolving);
     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
     underApproxHeuristicPar.sizeThreshold = std::numeric_limits<uint64_t>::max() - 1;  // we don't set a size threshold
@@ -923,6 +926,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                     checkRewireForAllActions = true;
                 }
             }
+            if (exploreAllActions || truncateAllActions) {
+                precomputeSuccessorBeliefs(currId, beliefManager, overApproximation);
+            }
             bool expandedAtLeastOneAction = false;
             for (uint64_t action = 0, numActions = beliefManager->getBeliefNumberOfChoices(currId); action < numActions; ++action) {
                 bool expandCurrentAction = exploreAllActions || truncateAllActions;
@@ -1156,6 +1162,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                 if (underApproximation->needsActionAdjustment(numActions)) {
                     underApproximation->adjustActions(numActions);
                 }
+                if (!stateAlreadyExplored) {
+                    precomputeSuccessorBeliefs(currId, beliefManager, underApproximation);
+                }
                 for (uint64_t action = 0; action < numActions; ++action) {
                     // Always restore old behavior if available
                     if (pomdp().hasChoiceLabeling()) {
@@ -1295,6 +1304,19 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     return fixPoint;
 }
 
+template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
+void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::precomputeSuccessorBeliefs(uint64_t beliefId,
+                                                                                                                   std::shared_ptr<BeliefManagerType>& beliefManager,
+                                                                                                                   std::shared_ptr<ExplorerType>& beliefExplorer) {
+    if (options.explorationThreads <= 1 || beliefManager->hasPrecomputedSuccessorBeliefs(beliefId)) {
+        return;
+    }
+    // Take enough beliefs such that all threads are kept busy. The successor beliefs of the beliefs that are not expanded are dropped with the next batch.
+    std::vector<uint64_t> beliefIds = beliefExplorer->getBeliefsOfNextUnexploredStates(64 * options.explorationThreads);
+    beliefIds.insert(beliefIds.begin(), beliefId);
+    beliefManager->precomputeSuccessorBeliefs(beliefIds, options.explorationThreads);
+}
+
 template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
 void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::clipToGrid(uint64_t clippingStateId, bool computeRewards, bool min,
                                                                                                     std::shared_ptr<BeliefManagerType>& beliefManager,
@@ -317,6 +317,15 @@ class BeliefExplorationPomdpModelChecker {
     bool clipToGridExplicitly(uint64_t clippingStateId, bool computeRewards, bool min, std::shared_ptr<BeliefManagerType>& beliefManager,
                               std::shared_ptr<ExplorerType>& beliefExplorer, uint64_t localActionIndex);
 
+    /**
+     * Precomputes the successor beliefs of the given belief and of the beliefs that are explored next using multiple threads.
+     * Nothing is done if only one exploration thread is used or if successors of the given belief have already been precomputed.
+     * @param beliefId the belief that is about to be expanded
+     * @param beliefManager the belief manager used
+     * @param beliefExplorer the belief MDP explorer used
+     */
+    void precomputeSuccessorBeliefs(uint64_t beliefId, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& beliefExplorer);
+
     /**
      * Heuristically rates the quality of the approximation described by the given successor observation info.
      * Here, 0 means a bad approximation and 1 means a good approximation.
@@ -29,6 +29,10 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     uint64_t refineStepLimit = 0;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    // The number of threads that compute successor beliefs during the exploration
+    uint64_t explorationThreads = 1;
+    // Whether only the part of the belief MDP that changed in a refinement step is solved again
+    bool incrementalSolving = false;
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
@@ -8,9 +8,11 @@
 #include "storm/storage/Scheduler.h"
 
 #include "environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -211,12 +213,29 @@ typename PreprocessingPomdpValueBoundsModelChecker<ValueType>::ValueBounds Prepr
     std::vector<storm::storage::Scheduler<ValueType>> guessedSchedulers;
     std::shared_ptr<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>> guessedSchedulerPair;
     std::vector<std::pair<double, bool>> guessParameters({{0.875, false}, {0.875, true}, {0.75, false}, {0.75, true}});
-    for (auto const& pars : guessParameters) {
-        guessedSchedulerPair = std::make_shared<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>>(
-            computeValuesForGuessedScheduler(env, fullyObservableResult, actionBasedRewardsPtr, formula, info, underlyingMdp,
-                                             storm::utility::convertNumber<ValueType>(pars.first), pars.second));
-        guessedSchedulerValues.push_back(guessedSchedulerPair->first);
-        guessedSchedulers.push_back(guessedSchedulerPair->second);
+
+    // The initial guesses only depend on the fully observable result, so they are evaluated concurrently (if multiple threads are requested).
+    // Each guess then runs a sequential analysis on its induced DTMC. Exact computations are always done sequentially.
+    uint64_t numberOfThreads = 1;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        numberOfThreads = env.solver().getNumberOfThreads();
+    }
+    storm::Environment guessEnv = env;
+    if (numberOfThreads > 1) {
+        guessEnv.solver().setNumberOfThreads(1);
+    }
+    std::vector<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>> initialGuesses(
+        guessParameters.size(), std::make_pair(std::vector<ValueType>(), storm::storage::Scheduler<ValueType>(0)));
+    storm::utility::parallel::forEachChunk(numberOfThreads, guessParameters.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t guess = begin; guess < end; ++guess) {
+            initialGuesses[guess] = computeValuesForGuessedScheduler(guessEnv, fullyObservableResult, actionBasedRewardsPtr, formula, info, underlyingMdp,
+                                                                     storm::utility::convertNumber<ValueType>(guessParameters[guess].first),
+                                                                     guessParameters[guess].second);
+        }
+    });
+    for (auto& guess : initialGuesses) {
+        guessedSchedulerValues.push_back(std::move(guess.first));
+        guessedSchedulers.push_back(std::move(guess.second));
     }
 
     // compute the 'best' guess and do a few iterations on it
@@ -1,10 +1,13 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "solver/GlpkLpSolver.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -30,12 +33,15 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(typename BeliefStoreType::Entries const &lhBelief,
+                                                                                       const BeliefType &rhBelief) const {
+    return lhBelief.size() == rhBelief.size() &&
+           std::equal(lhBelief.begin(), lhBelief.end(), rhBelief.begin(),
+                      [](auto const &lhEntry, auto const &rhEntry) { return lhEntry.first == rhEntry.first && lhEntry.second == rhEntry.second; });
 }
 
 template<>
-bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
+bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(BeliefStoreType::Entries const &lhBelief,
                                                                                                         const BeliefType &rhBelief) const {
     // If the sizes are different, we don't have to look inside the belief
     if (lhBelief.size() != rhBelief.size()) {
@@ -46,7 +52,8 @@ bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Beli
     auto rhIt = rhBelief.begin();
     while (lhIt != lhBelief.end() || rhIt != rhBelief.end()) {
         // Iterate over the entries simultaneously, beliefs not equal if they contain either different states or different values for the same state
-        if (lhIt->first != rhIt->first || std::fabs(lhIt->second - rhIt->second) > 1e-15) {
+        auto const lhEntry = *lhIt;
+        if (lhEntry.first != rhIt->first || std::fabs(lhEntry.second - rhIt->second) > 1e-15) {
             return false;
         }
         ++lhIt;
@@ -131,7 +138,7 @@ template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefManager<PomdpType, BeliefValueType, StateType>::getWeightedSum(
     BeliefId const &beliefId, std::vector<ValueType> const &summands) {
     auto result = storm::utility::zero<ValueType>();
-    for (auto const &entry : getBelief(beliefId)) {
+    for (auto const &entry : getBeliefEntries(beliefId)) {
         result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
     }
     return result;
@@ -142,7 +149,7 @@ std::pair<bool, typename BeliefManager<PomdpType, BeliefValueType, StateType>::V
     BeliefId const &beliefId, std::unordered_map<StateType, ValueType> const &summands) {
     bool successful = true;
     auto result = storm::utility::zero<ValueType>();
-    for (auto const &entry : getBelief(beliefId)) {
+    for (auto const &entry : getBeliefEntries(beliefId)) {
         auto probIter = summands.find(entry.first);
         if (probIter != summands.end()) {
             result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
@@ -162,7 +169,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId const &B
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefActionReward(
     BeliefId const &beliefId, uint64_t const &localActionIndex) const {
-    auto const &belief = getBelief(beliefId);
+    auto const belief = getBeliefEntries(beliefId);
     STORM_LOG_ASSERT(!pomdpActionRewardVector.empty(), "Requested a reward although no reward model was specified.");
     auto result = storm::utility::zero<ValueType>();
     auto const &choiceIndices = pomdp.getTransitionMatrix().getRowGroupIndices();
@@ -177,13 +184,12 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefM
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-    return getBeliefObservation(getBelief(beliefId));
+    return pomdp.getObservation(getRepresentativeState(beliefId));
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOfChoices(BeliefId beliefId) {
-    auto const &belief = getBelief(beliefId);
-    return pomdp.getNumberOfChoices(belief.begin()->first);
+    return pomdp.getNumberOfChoices(getRepresentativeState(beliefId));
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -194,7 +200,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -203,7 +209,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -212,8 +218,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(Di
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId const &beliefId, BeliefSupportType &support) {
-    auto const &belief = getBelief(beliefId);
-    for (auto const &entry : belief) {
+    for (auto const &entry : getBeliefEntries(beliefId)) {
         support.insert(entry.first);
     }
 }
@@ -247,21 +252,27 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    return beliefs.getBelief(id);
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefStoreType::Entries
+BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefEntries(BeliefId const &id) const {
+    STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
+    STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
+    return beliefs.getEntries(id);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
     BeliefType const &belief) const {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    BeliefId id = findBeliefId(belief, BeliefHash()(belief));
+    STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+    return id;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -365,8 +376,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
             STORM_LOG_ERROR("Weight greater than one in triangulation.");
         }
         weightSum += triangulation.weights[i];
-        BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-        for (auto const &pointEntry : gridPoint) {
+        for (auto const &pointEntry : getBeliefEntries(triangulation.gridPoints[i])) {
             BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<BeliefValueType>()).first->second;
             triangulatedValue += triangulation.weights[i] * pointEntry.second;
         }
@@ -386,7 +396,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
@@ -401,26 +411,30 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
     // Probabilities will be triangulated to values in 0/N, 1/N, 2/N, ..., N/N
     // Variable names are mostly based on the paper
     // However, we speed this up a little by exploiting that belief states usually have sparse support (i.e. numEntries is much smaller than
-    // pomdp.getNumberOfStates()). Initialize diffs and the first row of the 'qs' matrix (aka v)
-    std::set<FreudenthalDiff, std::greater<>> sorted_diffs;  // d (and p?) in the paper
-    std::vector<BeliefValueType> qsRow;                      // Row of the 'qs' matrix from the paper (initially corresponds to v
-    qsRow.reserve(numEntries);
-    std::vector<StateType> toOriginalIndicesMap;  // Maps 'local' indices to the original pomdp state indices
-    toOriginalIndicesMap.reserve(numEntries);
+    // pomdp.getNumberOfStates()). Initialize diffs and the first row of the 'qs' matrix (aka v).
+    // The buffers are members of the manager, so no memory is allocated once they are large enough.
+    auto &diffs = freudenthalDiffs;                           // d (and p?) in the paper
+    auto &qsRow = freudenthalQsRow;                           // Row of the 'qs' matrix from the paper (initially corresponds to v
+    auto &toOriginalIndicesMap = freudenthalOriginalIndices;  // Maps 'local' indices to the original pomdp state indices
+    diffs.clear();
+    qsRow.clear();
+    toOriginalIndicesMap.clear();
     BeliefValueType x = resolution;
     for (auto const &entry : belief) {
-        qsRow.push_back(storm::utility::floor(x));                            // v
-        sorted_diffs.emplace(toOriginalIndicesMap.size(), x - qsRow.back());  // x-v
+        qsRow.push_back(storm::utility::floor(x));                          // v
+        diffs.emplace_back(toOriginalIndicesMap.size(), x - qsRow.back());  // x-v
         toOriginalIndicesMap.push_back(entry.first);
         x -= entry.second * resolution;
     }
     // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
     qsRow.push_back(storm::utility::zero<BeliefValueType>());
+    // The supports of beliefs are small, so sorting a vector is much cheaper than maintaining an ordered set.
+    std::sort(diffs.begin(), diffs.end(), std::greater<>());
 
     result.weights.reserve(numEntries);
     result.gridPoints.reserve(numEntries);
-    auto currentSortedDiff = sorted_diffs.begin();
-    auto previousSortedDiff = sorted_diffs.end();
+    auto currentSortedDiff = diffs.begin();
+    auto previousSortedDiff = diffs.end();
     --previousSortedDiff;
     for (StateType i = 0; i < numEntries; ++i) {
         // Compute the weight for the grid points
@@ -434,15 +448,16 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
         }
         if (!cc.isZero(weight)) {
             result.weights.push_back(weight);
-            // Compute the grid point
-            BeliefType gridPoint;
+            // Compute the grid point. The entries are inserted in ascending order of the states, so the flat map only appends them.
+            BeliefType &gridPoint = freudenthalGridPoint;
+            gridPoint.clear();
             for (StateType j = 0; j < numEntries; ++j) {
                 BeliefValueType gridPointEntry = qsRow[j] - qsRow[j + 1];
                 if (!cc.isZero(gridPointEntry)) {
-                    gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
+                    gridPoint.emplace_hint(gridPoint.end(), toOriginalIndicesMap[j], gridPointEntry / resolution);
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(getOrAddBeliefId(gridPoint, storm::utility::convertNumber<uint64_t>(resolution)));
         }
         previousSortedDiff = currentSortedDiff++;
     }
@@ -514,14 +529,42 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
+void BeliefManager<PomdpType, BeliefValueType, StateType>::precomputeSuccessorBeliefs(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads) {
+    precomputedSuccessorBeliefs.clear();
+
+    // Enumerate the pairs of beliefs and actions to be able to distribute them among the threads.
+    std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+    for (auto const &beliefId : beliefIds) {
+        for (uint64_t action = 0, numActions = getBeliefNumberOfChoices(beliefId); action < numActions; ++action) {
+            beliefActionPairs.emplace_back(beliefId, action);
+        }
+    }
+
+    // Each thread only writes into the slots of the pairs it processes.
+    std::vector<std::vector<SuccessorBelief>> successors(beliefActionPairs.size());
+    storm::utility::parallel::forEachChunk(numberOfThreads, beliefActionPairs.size(), 16, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t pairIndex = begin; pairIndex < end; ++pairIndex) {
+            successors[pairIndex] = computeSuccessorBeliefs(beliefActionPairs[pairIndex].first, beliefActionPairs[pairIndex].second);
+        }
+    });
+
+    for (uint64_t pairIndex = 0; pairIndex < beliefActionPairs.size(); ++pairIndex) {
+        precomputedSuccessorBeliefs.emplace(beliefActionPairs[pairIndex], std::move(successors[pairIndex]));
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPrecomputedSuccessorBeliefs(BeliefId const &beliefId) const {
+    auto successorsIt = precomputedSuccessorBeliefs.lower_bound(std::pair<BeliefId, uint64_t>(beliefId, 0));
+    return successorsIt != precomputedSuccessorBeliefs.end() && successorsIt->first.first == beliefId;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<typename BeliefManager<PomdpType, BeliefValueType, StateType>::SuccessorBelief>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex) const {
+    std::vector<SuccessorBelief> result;
 
-    BeliefType belief = getBelief(beliefId);
+    auto const belief = getBeliefEntries(beliefId);
 
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
@@ -536,7 +579,8 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
+    result.reserve(successorObs.size());
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -550,27 +594,95 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+        std::size_t hash = BeliefHash()(successorBelief);
+        result.push_back({std::move(successorBelief), successor.second, hash});
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+
+    auto precomputedIt = precomputedSuccessorBeliefs.find(std::make_pair(beliefId, actionIndex));
+    std::vector<TriangulatedSuccessor> *cachedTriangulations = nullptr;
+    if (observationTriangulationResolutions) {
+        cachedTriangulations = &triangulatedSuccessors[std::make_pair(beliefId, actionIndex)];
+        bool allCached = !cachedTriangulations->empty();
+        for (auto const &cached : *cachedTriangulations) {
+            if (cached.resolution != observationTriangulationResolutions.value()[cached.observation]) {
+                allCached = false;
+                break;
+            }
+        }
+        if (allCached) {
+            // The successors were triangulated with the same resolutions before, so there is no need to compute them again.
+            if (precomputedIt != precomputedSuccessorBeliefs.end()) {
+                precomputedSuccessorBeliefs.erase(precomputedIt);
+            }
+            for (auto const &cached : *cachedTriangulations) {
+                for (size_t j = 0; j < cached.triangulation.size(); ++j) {
+                    BeliefValueType a = cached.triangulation.weights[j] * cached.probability;
+                    destinations.emplace_back(cached.triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
+                }
+            }
+            return destinations;
+        }
+    }
+
+    std::vector<SuccessorBelief> successors;
+    if (precomputedIt != precomputedSuccessorBeliefs.end()) {
+        successors = std::move(precomputedIt->second);
+        precomputedSuccessorBeliefs.erase(precomputedIt);
+    } else {
+        successors = computeSuccessorBeliefs(beliefId, actionIndex);
+    }
+    if (cachedTriangulations && cachedTriangulations->size() != successors.size()) {
+        cachedTriangulations->clear();
+        cachedTriangulations->resize(successors.size());
+    }
+
+    // Now for each successor observation we potentially triangulate the successor belief
+    for (uint64_t successorIndex = 0; successorIndex < successors.size(); ++successorIndex) {
+        auto &successor = successors[successorIndex];
+        BeliefType const &successorBelief = successor.belief;
+        uint32_t successorObservation = getBeliefObservation(successorBelief);
 
         // Insert the destination. We know that destinations have to be disjoint since they have different observations
         if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
+            // The successors are computed in the same order every time, so we only triangulate the ones whose resolution changed.
+            TriangulatedSuccessor &cached = (*cachedTriangulations)[successorIndex];
+            BeliefValueType const &resolution = observationTriangulationResolutions.value()[successorObservation];
+            if (cached.triangulation.size() == 0 || cached.observation != successorObservation || cached.resolution != resolution) {
+                cached.observation = successorObservation;
+                cached.probability = successor.probability;
+                cached.resolution = resolution;
+                cached.triangulation = triangulateBelief(successorBelief, resolution);
+            }
+            Triangulation const &triangulation = cached.triangulation;
             for (size_t j = 0; j < triangulation.size(); ++j) {
                 // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
+                BeliefValueType a = triangulation.weights[j] * successor.probability;
                 destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
             }
         } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
+            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successorObservation],
                                                        storm::storage::BitVector(pomdp.getNumberOfStates()));
             if (clipping.isClippable) {
-                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
+                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.probability;
                 destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
             } else {
                 // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+                destinations.emplace_back(
+                    getOrAddBeliefId(successorBelief, successor.hash, clipping.onGrid ? observationGridClippingResolutions.value()[successorObservation] : 0),
+                    storm::utility::convertNumber<ValueType>(successor.probability));
             }
         } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+            destinations.emplace_back(getOrAddBeliefId(successorBelief, successor.hash, 0), storm::utility::convertNumber<ValueType>(successor.probability));
         }
     }
 
@@ -716,7 +828,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping Be
         optDelta = lpSolver->getObjectiveValue();
         for (uint64_t dist = 0; dist < gridCandidates.size(); ++dist) {
             if (lpSolver->getBinaryValue(lpSolver->getManager().getVariable("a_" + std::to_string(dist)))) {
-                targetBelief = getOrAddBeliefId(gridCandidates[dist]);
+                targetBelief = getOrAddBeliefId(gridCandidates[dist], resolution);
                 break;
             }
         }
@@ -767,21 +879,39 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
-    BeliefType const &belief) {
+    BeliefType const &belief, uint64_t gridResolution) {
+    return getOrAddBeliefId(belief, BeliefHash()(belief), gridResolution);
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
+    BeliefType const &belief, std::size_t hash, uint64_t gridResolution) {
+    BeliefId id = findBeliefId(belief, hash);
+    if (id == noId()) {
+        // The belief is new, so add it
+        id = beliefs.addBelief(belief, gridResolution);
+        STORM_LOG_TRACE("Add Belief " << id << " " << toString(belief));
+        beliefToIdMap[getBeliefObservation(belief)].emplace(hash, id);
+    }
+    return id;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefId(
+    BeliefType const &belief, std::size_t hash) const {
     uint32_t obs = getBeliefObservation(belief);
     STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    auto candidates = beliefToIdMap[obs].equal_range(hash);
+    for (auto candidateIt = candidates.first; candidateIt != candidates.second; ++candidateIt) {
+        if (Belief_equal_to()(beliefs.getEntries(candidateIt->second), belief)) {
+            return candidateIt->second;
+        }
     }
-    // Return the id
-    return insertioRes.first->second;
+    return noId();
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
-    return getBelief(beliefId).begin()->first;
+    return beliefs.getState(beliefId, 0);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
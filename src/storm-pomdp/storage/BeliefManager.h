@@ -2,10 +2,12 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <map>
 #include <optional>
 #include <unordered_map>
 #include <vector>
 
+#include "storm-pomdp/storage/BeliefStore.h"
 #include "storm/solver/LpSolver.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -79,7 +81,7 @@ class BeliefManager {
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -93,6 +95,18 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Computes the successor beliefs of all actions of the given beliefs using the given number of threads.
+     * The successor beliefs do not get an id yet. Ids are assigned once the corresponding belief and action is expanded, i.e., in the same order as without
+     * precomputation, which keeps the ids independent of the number of threads. Precomputed successors that have not been used so far are dropped.
+     */
+    void precomputeSuccessorBeliefs(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads);
+
+    /*!
+     * Returns true if there are precomputed successors for some action of the given belief.
+     */
+    bool hasPrecomputedSuccessorBeliefs(BeliefId const &beliefId) const;
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
@@ -100,6 +114,8 @@ class BeliefManager {
     std::vector<BeliefValueType> computeMatrixBeliefProduct(BeliefId const &beliefId, storm::storage::SparseMatrix<BeliefValueType> &matrix);
 
    private:
+    typedef BeliefStore<StateType, BeliefValueType> BeliefStoreType;
+
     std::vector<BeliefValueType> getBeliefAsVector(BeliefId const &beliefId);
 
     std::vector<BeliefValueType> getBeliefAsVector(const BeliefType &belief);
@@ -107,14 +123,33 @@ class BeliefManager {
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
 
     struct BeliefHash {
         std::size_t operator()(const BeliefType &belief) const;
     };
 
     struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+        bool operator()(typename BeliefStoreType::Entries const &lhBelief, const BeliefType &rhBelief) const;
+    };
+
+    struct SuccessorBelief {
+        BeliefType belief;
+        // The probability to move to the observation of the belief.
+        BeliefValueType probability;
+        // The hash value of the belief.
+        std::size_t hash;
+    };
+
+    /*!
+     * The triangulation of a successor belief of some belief and action, which is reused as long as the resolution of its observation does not change.
+     */
+    struct TriangulatedSuccessor {
+        uint32_t observation;
+        // The probability to move to the observation of the successor belief.
+        BeliefValueType probability;
+        BeliefValueType resolution;
+        Triangulation triangulation;
     };
 
     struct FreudenthalDiff {
@@ -125,7 +160,12 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    /*!
+     * Retrieves a copy of the belief with the given id. Use getBeliefEntries for iterating over the entries without copying them.
+     */
+    BeliefType getBelief(BeliefId const &id) const;
+
+    typename BeliefStoreType::Entries getBeliefEntries(BeliefId const &id) const;
 
     BeliefId getId(BeliefType const &belief) const;
 
@@ -137,7 +177,7 @@ class BeliefManager {
 
     bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    uint32_t getBeliefObservation(BeliefType const &belief) const;
 
     void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
 
@@ -145,19 +185,42 @@ class BeliefManager {
 
     Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+    /*!
+     * Computes the successor beliefs of the given belief and action. This does not modify the belief manager and can thus be called concurrently.
+     */
+    std::vector<SuccessorBelief> computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex) const;
+
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
         std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions = std::nullopt);
 
     BeliefId computeInitialBelief();
 
-    BeliefId getOrAddBeliefId(BeliefType const &belief);
+    /*!
+     * Returns the id of the given belief, adding it if it is new.
+     * @param gridResolution If not zero, the belief is expected to be a point of the grid with the given resolution, which allows to store it more compactly.
+     */
+    BeliefId getOrAddBeliefId(BeliefType const &belief, uint64_t gridResolution = 0);
+
+    BeliefId getOrAddBeliefId(BeliefType const &belief, std::size_t hash, uint64_t gridResolution);
+
+    /*!
+     * Returns the id of the given belief with the given hash value or noId() if the belief is not known.
+     */
+    BeliefId findBeliefId(BeliefType const &belief, std::size_t hash) const;
 
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    BeliefStoreType beliefs;
+    // For each observation a mapping from hash values to the ids of the beliefs with that observation and hash value.
+    // As the hash values are stored, they are never recomputed for known beliefs.
+    std::vector<std::unordered_multimap<std::size_t, BeliefId>> beliefToIdMap;
+    // Successor beliefs that are precomputed for pairs of belief ids and actions.
+    std::map<std::pair<BeliefId, uint64_t>, std::vector<SuccessorBelief>> precomputedSuccessorBeliefs;
+    // Triangulations of the successor beliefs of pairs of belief ids and actions. As successor beliefs usually do not have an id, they are identified by
+    // the belief and action they originate from.
+    std::map<std::pair<BeliefId, uint64_t>, std::vector<TriangulatedSuccessor>> triangulatedSuccessors;
     BeliefId initialBeliefId;
 
     storm::utility::ConstantsComparator<BeliefValueType> cc;
@@ -165,6 +228,12 @@ class BeliefManager {
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
 
     TriangulationMode triangulationMode;
+
+    // Buffers for the Freudenthal triangulation that are reused to avoid allocations.
+    std::vector<FreudenthalDiff> freudenthalDiffs;
+    std::vector<BeliefValueType> freudenthalQsRow;
+    std::vector<StateType> freudenthalOriginalIndices;
+    BeliefType freudenthalGridPoint;
 };
 }  // namespace storage
 }  // namespace storm
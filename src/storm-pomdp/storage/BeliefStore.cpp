@@ -0,0 +1,164 @@
+#include "storm-pomdp/storage/BeliefStore.h"
+
+#include <boost/functional/hash.hpp>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename StateType, typename ValueType>
+BeliefStore<StateType, ValueType>::BeliefStore() : supportBegin(1, 0), numberOfQuantizedBeliefs(0) {
+    // Intentionally left empty
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::addBelief(BeliefType const &belief, uint64_t gridResolution) {
+    STORM_LOG_ASSERT(!belief.empty(), "Tried to store an empty belief.");
+    StoredBelief storedBelief;
+    storedBelief.support = getOrAddSupport(belief);
+    // Dirac beliefs are on every grid.
+    if (gridResolution == 0 && belief.size() == 1) {
+        gridResolution = 1;
+    }
+    if (gridResolution != 0 && gridResolution <= std::numeric_limits<uint32_t>::max()) {
+        storedBelief.valuesBegin = quantizedValues.size();
+        storedBelief.resolution = gridResolution;
+        if (addQuantizedValues(belief, gridResolution)) {
+            ++numberOfQuantizedBeliefs;
+            beliefs.push_back(storedBelief);
+            return beliefs.size() - 1;
+        }
+    }
+    storedBelief.valuesBegin = values.size();
+    storedBelief.resolution = 0;
+    for (auto const &entry : belief) {
+        values.push_back(entry.second);
+    }
+    beliefs.push_back(storedBelief);
+    return beliefs.size() - 1;
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::getOrAddSupport(BeliefType const &belief) {
+    std::size_t hash = 0;
+    for (auto const &entry : belief) {
+        boost::hash_combine(hash, entry.first);
+    }
+    auto candidates = supportIndices.equal_range(hash);
+    for (auto candidateIt = candidates.first; candidateIt != candidates.second; ++candidateIt) {
+        uint64_t support = candidateIt->second;
+        if (supportBegin[support + 1] - supportBegin[support] != belief.size()) {
+            continue;
+        }
+        auto stateIt = supportStates.begin() + supportBegin[support];
+        bool equal = true;
+        for (auto const &entry : belief) {
+            if (*stateIt != entry.first) {
+                equal = false;
+                break;
+            }
+            ++stateIt;
+        }
+        if (equal) {
+            return support;
+        }
+    }
+
+    uint64_t support = supportBegin.size() - 1;
+    for (auto const &entry : belief) {
+        supportStates.push_back(entry.first);
+    }
+    supportBegin.push_back(supportStates.size());
+    supportIndices.emplace(hash, support);
+    return support;
+}
+
+template<typename StateType, typename ValueType>
+bool BeliefStore<StateType, ValueType>::addQuantizedValues(BeliefType const &belief, uint64_t resolution) {
+    ValueType resolutionAsValue = storm::utility::convertNumber<ValueType>(resolution);
+    uint64_t quantizedValuesBegin = quantizedValues.size();
+    for (auto const &entry : belief) {
+        ValueType numerator = storm::utility::round<ValueType>(entry.second * resolutionAsValue);
+        // Only quantize if the value is reproduced exactly.
+        if (numerator < storm::utility::zero<ValueType>() || numerator > resolutionAsValue || numerator / resolutionAsValue != entry.second) {
+            quantizedValues.resize(quantizedValuesBegin);
+            return false;
+        }
+        quantizedValues.push_back(storm::utility::convertNumber<uint64_t>(numerator));
+    }
+    return true;
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::size() const {
+    return beliefs.size();
+}
+
+template<typename StateType, typename ValueType>
+typename BeliefStore<StateType, ValueType>::BeliefType BeliefStore<StateType, ValueType>::getBelief(uint64_t beliefIndex) const {
+    BeliefType result;
+    uint64_t numberOfEntries = getSupportSize(beliefIndex);
+    result.reserve(numberOfEntries);
+    for (uint64_t entryIndex = 0; entryIndex < numberOfEntries; ++entryIndex) {
+        result.emplace_hint(result.end(), getState(beliefIndex, entryIndex), getValue(beliefIndex, entryIndex));
+    }
+    return result;
+}
+
+template<typename StateType, typename ValueType>
+typename BeliefStore<StateType, ValueType>::Entries BeliefStore<StateType, ValueType>::getEntries(uint64_t beliefIndex) const {
+    STORM_LOG_ASSERT(beliefIndex < size(), "Belief index " << beliefIndex << " is out of range.");
+    return Entries(*this, beliefIndex);
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::getSupportSize(uint64_t beliefIndex) const {
+    uint64_t support = beliefs[beliefIndex].support;
+    return supportBegin[support + 1] - supportBegin[support];
+}
+
+template<typename StateType, typename ValueType>
+StateType const &BeliefStore<StateType, ValueType>::getState(uint64_t beliefIndex, uint64_t entryIndex) const {
+    STORM_LOG_ASSERT(entryIndex < getSupportSize(beliefIndex), "Entry index " << entryIndex << " is out of range.");
+    return supportStates[supportBegin[beliefs[beliefIndex].support] + entryIndex];
+}
+
+template<typename StateType, typename ValueType>
+ValueType BeliefStore<StateType, ValueType>::getValue(uint64_t beliefIndex, uint64_t entryIndex) const {
+    STORM_LOG_ASSERT(entryIndex < getSupportSize(beliefIndex), "Entry index " << entryIndex << " is out of range.");
+    StoredBelief const &storedBelief = beliefs[beliefIndex];
+    if (storedBelief.resolution == 0) {
+        return values[storedBelief.valuesBegin + entryIndex];
+    } else {
+        return storm::utility::convertNumber<ValueType>(static_cast<uint64_t>(quantizedValues[storedBelief.valuesBegin + entryIndex])) /
+               storm::utility::convertNumber<ValueType>(static_cast<uint64_t>(storedBelief.resolution));
+    }
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::getNumberOfSupports() const {
+    return supportBegin.size() - 1;
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::getNumberOfQuantizedBeliefs() const {
+    return numberOfQuantizedBeliefs;
+}
+
+template<typename StateType, typename ValueType>
+uint64_t BeliefStore<StateType, ValueType>::getSizeInBytes() const {
+    // Values of exact number types are counted with their fixed size only.
+    return beliefs.capacity() * sizeof(StoredBelief) + supportStates.capacity() * sizeof(StateType) + supportBegin.capacity() * sizeof(uint64_t) +
+           supportIndices.size() * (sizeof(std::size_t) + sizeof(uint64_t) + sizeof(void *)) + supportIndices.bucket_count() * sizeof(void *) +
+           values.capacity() * sizeof(ValueType) + quantizedValues.capacity() * sizeof(uint32_t);
+}
+
+template class BeliefStore<uint64_t, double>;
+template class BeliefStore<uint64_t, storm::RationalNumber>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <boost/container/flat_map.hpp>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Stores beliefs compactly in a few contiguous arrays instead of one allocation per belief.
+ *
+ * The support of a belief, i.e., the ordered list of its states, is stored only once for all beliefs with the same support.
+ * The values of a belief are stored consecutively in one large array. If all values of a belief are multiples of 1/N for a given grid resolution N
+ * (as it is the case for the grid points of triangulations and clippings), only the numerators are stored as 32-bit integers.
+ * This quantization is lossless: it is only applied if N/k reproduces every value exactly.
+ */
+template<typename StateType, typename ValueType>
+class BeliefStore {
+   public:
+    typedef boost::container::flat_map<StateType, ValueType> BeliefType;
+
+    /*!
+     * Iterates over the (state, value) pairs of a stored belief in the order of the states.
+     */
+    class EntryIterator {
+       public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::pair<StateType, ValueType> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type const *pointer;
+        typedef value_type reference;
+
+        EntryIterator(BeliefStore const &store, uint64_t beliefIndex, uint64_t entryIndex)
+            : store(&store), beliefIndex(beliefIndex), entryIndex(entryIndex) {}
+
+        value_type operator*() const {
+            return value_type(store->getState(beliefIndex, entryIndex), store->getValue(beliefIndex, entryIndex));
+        }
+
+        EntryIterator &operator++() {
+            ++entryIndex;
+            return *this;
+        }
+
+        bool operator==(EntryIterator const &other) const {
+            return entryIndex == other.entryIndex;
+        }
+
+        bool operator!=(EntryIterator const &other) const {
+            return entryIndex != other.entryIndex;
+        }
+
+       private:
+        BeliefStore const *store;
+        uint64_t beliefIndex;
+        uint64_t entryIndex;
+    };
+
+    /*!
+     * The entries of a stored belief. This is a lightweight view that does not copy the belief.
+     */
+    class Entries {
+       public:
+        Entries(BeliefStore const &store, uint64_t beliefIndex) : store(store), beliefIndex(beliefIndex) {}
+
+        EntryIterator begin() const {
+            return EntryIterator(store, beliefIndex, 0);
+        }
+
+        EntryIterator end() const {
+            return EntryIterator(store, beliefIndex, size());
+        }
+
+        uint64_t size() const {
+            return store.getSupportSize(beliefIndex);
+        }
+
+       private:
+        BeliefStore const &store;
+        uint64_t beliefIndex;
+    };
+
+    BeliefStore();
+
+    /*!
+     * Adds the given belief and returns its index. Beliefs are not checked for duplicates.
+     * @param gridResolution If not zero, the values of the belief are stored as numerators for this denominator, provided that this is exact.
+     */
+    uint64_t addBelief(BeliefType const &belief, uint64_t gridResolution = 0);
+
+    /*!
+     * Retrieves the number of stored beliefs.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves a copy of the belief with the given index.
+     */
+    BeliefType getBelief(uint64_t beliefIndex) const;
+
+    /*!
+     * Retrieves the entries of the belief with the given index without copying them.
+     */
+    Entries getEntries(uint64_t beliefIndex) const;
+
+    /*!
+     * Retrieves the number of states in the support of the given belief.
+     */
+    uint64_t getSupportSize(uint64_t beliefIndex) const;
+
+    /*!
+     * Retrieves the state of the given entry of the given belief.
+     */
+    StateType const &getState(uint64_t beliefIndex, uint64_t entryIndex) const;
+
+    /*!
+     * Retrieves the value of the given entry of the given belief.
+     */
+    ValueType getValue(uint64_t beliefIndex, uint64_t entryIndex) const;
+
+    /*!
+     * Retrieves the number of distinct supports of the stored beliefs.
+     */
+    uint64_t getNumberOfSupports() const;
+
+    /*!
+     * Retrieves the number of beliefs whose values are stored as numerators of a grid resolution.
+     */
+    uint64_t getNumberOfQuantizedBeliefs() const;
+
+    /*!
+     * Retrieves the approximate number of bytes used to store the beliefs.
+     */
+    uint64_t getSizeInBytes() const;
+
+   private:
+    /*!
+     * Returns the index of the given support, adding it if it is not known so far.
+     */
+    uint64_t getOrAddSupport(BeliefType const &belief);
+
+    /*!
+     * Tries to append the values of the given belief as numerators of the given resolution. Returns false (and does not append anything) if the values are
+     * not exact multiples of 1/resolution.
+     */
+    bool addQuantizedValues(BeliefType const &belief, uint64_t resolution);
+
+    struct StoredBelief {
+        // The index of the support of the belief.
+        uint64_t support;
+        // The position of the first value of the belief in either the values or the quantized values.
+        uint64_t valuesBegin;
+        // The denominator of quantized values or zero, if the values are not quantized.
+        uint32_t resolution;
+    };
+
+    std::vector<StoredBelief> beliefs;
+
+    // The states of all supports. The states of the i'th support are located at positions supportBegin[i] to supportBegin[i+1] - 1.
+    std::vector<StateType> supportStates;
+    std::vector<uint64_t> supportBegin;
+    // Maps hash values of supports to the indices of the supports with that hash value.
+    std::unordered_multimap<std::size_t, uint64_t> supportIndices;
+
+    std::vector<ValueType> values;
+    std::vector<uint32_t> quantizedValues;
+    uint64_t numberOfQuantizedBeliefs;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,136 @@
+#include "storm-pomdp/storage/PomdpMemoryProduct.h"
+
+#include <queue>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+PomdpMemoryProduct<ValueType>::PomdpMemoryProduct(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::PomdpMemory const& memory)
+    : pomdp(pomdp), memory(memory) {
+    memorySuccessors.reserve(memory.getNumberOfStates());
+    for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
+        auto const& transitions = memory.getTransitions(memState);
+        memorySuccessors.emplace_back(transitions.begin(), transitions.end());
+    }
+}
+
+template<typename ValueType>
+std::vector<uint64_t> PomdpMemoryProduct<ValueType>::getInitialStates() {
+    std::vector<uint64_t> result;
+    for (auto const& modelState : pomdp.getInitialStates()) {
+        result.push_back(getOrAddState(modelState, memory.getInitialState()));
+    }
+    return result;
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getOrAddState(uint64_t modelState, uint64_t memoryState) {
+    STORM_LOG_ASSERT(modelState < pomdp.getNumberOfStates() && memoryState < memory.getNumberOfStates(), "Invalid product state.");
+    auto insertionRes = unfoldingStateToProductState.emplace(modelState * memory.getNumberOfStates() + memoryState, productStates.size());
+    if (insertionRes.second) {
+        productStates.emplace_back(modelState, memoryState);
+    }
+    return insertionRes.first->second;
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getNumberOfStates() const {
+    return productStates.size();
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getModelState(uint64_t productState) const {
+    return productStates[productState].first;
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getMemoryState(uint64_t productState) const {
+    return productStates[productState].second;
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getUnfoldingState(uint64_t productState) const {
+    return getModelState(productState) * memory.getNumberOfStates() + getMemoryState(productState);
+}
+
+template<typename ValueType>
+uint32_t PomdpMemoryProduct<ValueType>::getModelObservation(uint64_t productState) const {
+    return pomdp.getObservation(getModelState(productState));
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getNumberOfChoices(uint64_t productState) const {
+    return pomdp.getTransitionMatrix().getRowGroupSize(getModelState(productState)) * memorySuccessors[getMemoryState(productState)].size();
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getModelChoice(uint64_t productState, uint64_t localChoice) const {
+    STORM_LOG_ASSERT(localChoice < getNumberOfChoices(productState), "Invalid choice " << localChoice << " of product state " << productState << ".");
+    return pomdp.getTransitionMatrix().getRowGroupIndices()[getModelState(productState)] +
+           localChoice / memorySuccessors[getMemoryState(productState)].size();
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getMemorySuccessor(uint64_t productState, uint64_t localChoice) const {
+    auto const& successors = memorySuccessors[getMemoryState(productState)];
+    return successors[localChoice % successors.size()];
+}
+
+template<typename ValueType>
+std::vector<std::pair<uint64_t, ValueType>> PomdpMemoryProduct<ValueType>::getSuccessors(uint64_t productState, uint64_t localChoice) {
+    uint64_t memorySuccessor = getMemorySuccessor(productState, localChoice);
+    std::vector<std::pair<uint64_t, ValueType>> result;
+    for (auto const& entry : pomdp.getTransitionMatrix().getRow(getModelChoice(productState, localChoice))) {
+        if (storm::utility::isZero(entry.getValue())) {
+            continue;
+        }
+        result.emplace_back(getOrAddState(entry.getColumn(), memorySuccessor), entry.getValue());
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::exploreReachableStates() {
+    storm::storage::BitVector result(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+    std::queue<uint64_t> stateQueue;
+    for (auto const& initialState : getInitialStates()) {
+        if (!result.get(getUnfoldingState(initialState))) {
+            result.set(getUnfoldingState(initialState));
+            stateQueue.push(initialState);
+        }
+    }
+    while (!stateQueue.empty()) {
+        uint64_t productState = stateQueue.front();
+        stateQueue.pop();
+        uint64_t modelState = getModelState(productState);
+        // All choices that belong to the same choice of the POMDP state have the same POMDP successors, so we only iterate over them once.
+        for (uint64_t modelChoice = pomdp.getTransitionMatrix().getRowGroupIndices()[modelState];
+             modelChoice < pomdp.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelChoice) {
+            for (auto const& entry : pomdp.getTransitionMatrix().getRow(modelChoice)) {
+                if (storm::utility::isZero(entry.getValue())) {
+                    continue;
+                }
+                for (auto const& memorySuccessor : memorySuccessors[getMemoryState(productState)]) {
+                    uint64_t successor = getOrAddState(entry.getColumn(), memorySuccessor);
+                    if (!result.get(getUnfoldingState(successor))) {
+                        result.set(getUnfoldingState(successor));
+                        stateQueue.push(successor);
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template class PomdpMemoryProduct<double>;
+template class PomdpMemoryProduct<storm::RationalNumber>;
+template class PomdpMemoryProduct<storm::RationalFunction>;
+
+}  // namespace storage
+}  // namespace storm
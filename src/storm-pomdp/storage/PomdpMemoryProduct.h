@@ -0,0 +1,98 @@
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm-pomdp/storage/PomdpMemory.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * The product of a POMDP and a finite memory that is built on the fly: product states are only instantiated once they are reached and
+ * their transitions are computed from the POMDP and the memory whenever they are queried.
+ *
+ * The choices of a product state (s, m) are the pairs of a choice of s and a memory successor m' of m, ordered by the choice of s first.
+ * Taking such a choice leads to the product states (s', m') for the successors s' of s. This coincides with the product built by
+ * storm::transformer::PomdpMemoryUnfolder.
+ */
+template<typename ValueType>
+class PomdpMemoryProduct {
+   public:
+    PomdpMemoryProduct(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::PomdpMemory const& memory);
+
+    /*!
+     * Retrieves the product states that consist of an initial state of the POMDP and the initial memory state, instantiating them if necessary.
+     */
+    std::vector<uint64_t> getInitialStates();
+
+    /*!
+     * Retrieves the product state of the given POMDP state and memory state, instantiating it if necessary.
+     */
+    uint64_t getOrAddState(uint64_t modelState, uint64_t memoryState);
+
+    /*!
+     * @return The number of product states that have been instantiated so far.
+     */
+    uint64_t getNumberOfStates() const;
+
+    uint64_t getModelState(uint64_t productState) const;
+    uint64_t getMemoryState(uint64_t productState) const;
+
+    /*!
+     * Retrieves the index of the given product state in the full product, i.e., its position if the pairs (s, m) are ordered
+     * lexicographically.
+     */
+    uint64_t getUnfoldingState(uint64_t productState) const;
+
+    /*!
+     * @return The observation of the POMDP state of the given product state.
+     */
+    uint32_t getModelObservation(uint64_t productState) const;
+
+    uint64_t getNumberOfChoices(uint64_t productState) const;
+
+    /*!
+     * @return The row of the POMDP transition matrix that corresponds to the given choice of the given product state.
+     */
+    uint64_t getModelChoice(uint64_t productState, uint64_t localChoice) const;
+
+    /*!
+     * @return The memory state that the given choice of the given product state moves to.
+     */
+    uint64_t getMemorySuccessor(uint64_t productState, uint64_t localChoice) const;
+
+    /*!
+     * Computes the successors of the given choice of the given product state, instantiating the successors if necessary. Transitions with
+     * probability zero are omitted.
+     *
+     * @return The successor product states together with their probabilities.
+     */
+    std::vector<std::pair<uint64_t, ValueType>> getSuccessors(uint64_t productState, uint64_t localChoice);
+
+    /*!
+     * Instantiates all product states that are reachable from the initial product states.
+     *
+     * @return The reachable product states in the order of the full product (see getUnfoldingState), i.e., as a bit vector of size
+     * (number of POMDP states) * (number of memory states).
+     */
+    storm::storage::BitVector exploreReachableStates();
+
+   private:
+    storm::models::sparse::Pomdp<ValueType> const& pomdp;
+    storm::storage::PomdpMemory const& memory;
+
+    // For each memory state its successor memory states.
+    std::vector<std::vector<uint64_t>> memorySuccessors;
+
+    // The pairs of POMDP state and memory state of the instantiated product states.
+    std::vector<std::pair<uint64_t, uint64_t>> productStates;
+    // Maps the indices of instantiated states in the full product to the product states.
+    std::unordered_map<uint64_t, uint64_t> unfoldingStateToProductState;
+};
+
+}  // namespace storage
+}  // namespace storm
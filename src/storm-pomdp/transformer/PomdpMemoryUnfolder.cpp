@@ -2,9 +2,9 @@
 
 #include <limits>
 
+#include "storm-pomdp/storage/PomdpMemoryProduct.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/sparse/ModelComponents.h"
-#include "storm/utility/graph.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -20,28 +20,27 @@ PomdpMemoryUnfolder<ValueType>::PomdpMemoryUnfolder(storm::models::sparse::Pomdp
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<ValueType>::transform(bool dropUnreachableStates) const {
-    // For simplicity we first build the 'full' product of pomdp and memory (with pomdp.numStates * memory.numStates states).
     STORM_LOG_THROW(pomdp.isCanonic(), storm::exceptions::InvalidArgumentException, "POMDP must be canonical to unfold memory into it");
     storm::storage::sparse::ModelComponents<ValueType> components;
-    components.transitionMatrix = transformTransitions();
-    components.stateLabeling = transformStateLabeling();
 
-    // Now delete unreachable states.
-    storm::storage::BitVector allStates(components.transitionMatrix.getRowGroupCount(), true);
-
-    storm::storage::BitVector reachableStates = allStates;
+    storm::storage::BitVector reachableStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), true);
     if (dropUnreachableStates) {
-        reachableStates =
-            storm::utility::graph::getReachableStates(components.transitionMatrix, components.stateLabeling.getStates("init"), allStates, ~allStates);
-        components.transitionMatrix = components.transitionMatrix.getSubmatrix(true, reachableStates, reachableStates);
-        components.stateLabeling = components.stateLabeling.getSubLabeling(reachableStates);
+        // Explore the product on the fly, so only the transitions of reachable product states are built.
+        reachableStates = storm::storage::PomdpMemoryProduct<ValueType>(pomdp, memory).exploreReachableStates();
+        components.transitionMatrix = transformTransitions(reachableStates);
+        components.stateLabeling = transformStateLabeling().getSubLabeling(reachableStates);
         if (keepStateValuations && pomdp.hasStateValuations()) {
-            std::vector<uint64_t> newToOldStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), 0);
-            for (uint64_t newState = 0; newState < newToOldStates.size(); newState++) {
-                newToOldStates[newState] = getModelState(newState);
+            std::vector<uint64_t> newToOldStates;
+            newToOldStates.reserve(reachableStates.getNumberOfSetBits());
+            for (auto const& unfoldingState : reachableStates) {
+                newToOldStates.push_back(getModelState(unfoldingState));
             }
-            components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates).selectStates(reachableStates);
+            components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates);
         }
+    } else {
+        // Build the 'full' product of pomdp and memory (with pomdp.numStates * memory.numStates states).
+        components.transitionMatrix = transformTransitions();
+        components.stateLabeling = transformStateLabeling();
     }
 
     // build the remaining components
@@ -85,6 +84,42 @@ storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transfor
     return builder.build();
 }
 
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions(storm::storage::BitVector const& reachableStates) const {
+    storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
+    std::vector<uint64_t> reachableStatesBefore = reachableStates.getNumberOfSetBitsBeforeIndices();
+    uint64_t numRows = 0;
+    uint64_t numEntries = 0;
+    for (auto const& unfoldingState : reachableStates) {
+        uint64_t modelState = getModelState(unfoldingState);
+        uint64_t memState = getMemoryState(unfoldingState);
+        numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
+        numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
+    }
+    uint64_t numStates = reachableStates.getNumberOfSetBits();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, numStates, numEntries, true, true, numStates);
+
+    uint64_t row = 0;
+    for (auto const& unfoldingState : reachableStates) {
+        uint64_t modelState = getModelState(unfoldingState);
+        uint64_t memState = getMemoryState(unfoldingState);
+        builder.newRowGroup(row);
+        for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
+            for (auto const& memStatePrime : memory.getTransitions(memState)) {
+                for (auto const& entry : origTransitions.getRow(origRow)) {
+                    // Only entries with probability zero can lead to unreachable states.
+                    uint64_t successor = getUnfoldingState(entry.getColumn(), memStatePrime);
+                    if (reachableStates.get(successor)) {
+                        builder.addNextValue(row, reachableStatesBefore[successor], entry.getValue());
+                    }
+                }
+                ++row;
+            }
+        }
+    }
+    return builder.build();
+}
+
 template<typename ValueType>
 storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling() const {
     storm::models::sparse::StateLabeling labeling(pomdp.getNumberOfStates() * memory.getNumberOfStates());
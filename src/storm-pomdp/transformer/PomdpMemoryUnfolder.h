@@ -17,6 +17,7 @@ class PomdpMemoryUnfolder {
 
    private:
     storm::storage::SparseMatrix<ValueType> transformTransitions() const;
+    storm::storage::SparseMatrix<ValueType> transformTransitions(storm::storage::BitVector const& reachableStates) const;
     storm::models::sparse::StateLabeling transformStateLabeling() const;
     std::vector<uint32_t> transformObservabilityClasses(storm::storage::BitVector const& reachableStates) const;
     storm::models::sparse::StandardRewardModel<ValueType> transformRewardModel(storm::models::sparse::StandardRewardModel<ValueType> const& rewardModel,
@@ -0,0 +1,83 @@
+#include "storm-server-cli/server/ModelCache.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace server {
+
+ModelCache::ModelCache(uint64_t capacity) : capacity(capacity), nextId(0) {
+    STORM_LOG_THROW(capacity > 0, storm::exceptions::InvalidArgumentException, "The capacity of the model cache must be positive.");
+}
+
+std::shared_ptr<CachedModel> ModelCache::get(std::string const& key, Builder const& builder, bool& hit) {
+    std::promise<std::shared_ptr<CachedModel>> promise;
+    std::shared_future<std::shared_ptr<CachedModel>> model;
+    uint64_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entryIt = keyToEntry.find(key);
+        hit = entryIt != keyToEntry.end();
+        if (hit) {
+            touch(entryIt->second);
+            model = entryIt->second->model;
+        } else {
+            model = promise.get_future().share();
+            id = nextId++;
+            entries.push_front(Entry{key, id, model});
+            keyToEntry[key] = entries.begin();
+            while (entries.size() > capacity) {
+                STORM_LOG_INFO("Evicting model " << entries.back().key << " from the model cache.");
+                keyToEntry.erase(entries.back().key);
+                entries.pop_back();
+            }
+        }
+    }
+
+    if (!hit) {
+        // Build the model without holding the lock, such that other models can be retrieved in the meantime.
+        try {
+            promise.set_value(builder());
+        } catch (...) {
+            // Do not keep the failed build in the cache (unless the entry has been evicted and added again in the meantime).
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto entryIt = keyToEntry.find(key);
+                if (entryIt != keyToEntry.end() && entryIt->second->id == id) {
+                    entries.erase(entryIt->second);
+                    keyToEntry.erase(entryIt);
+                }
+            }
+            promise.set_exception(std::current_exception());
+        }
+    }
+    return model.get();
+}
+
+void ModelCache::replace(std::string const& key, std::shared_ptr<CachedModel> const& oldModel, std::shared_ptr<CachedModel> const& newModel) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto entryIt = keyToEntry.find(key);
+    if (entryIt == keyToEntry.end()) {
+        return;
+    }
+    auto& model = entryIt->second->model;
+    if (model.wait_for(std::chrono::seconds(0)) != std::future_status::ready || model.get() != oldModel) {
+        return;
+    }
+    std::promise<std::shared_ptr<CachedModel>> promise;
+    promise.set_value(newModel);
+    model = promise.get_future().share();
+    touch(entryIt->second);
+}
+
+uint64_t ModelCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void ModelCache::touch(std::list<Entry>::iterator const& entryIt) {
+    entries.splice(entries.begin(), entries, entryIt);
+}
+
+}  // namespace server
+}  // namespace storm
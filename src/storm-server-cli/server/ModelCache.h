@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace server {
+
+/*!
+ * A model that was built from a symbolic description for a specific definition of the constants.
+ */
+struct CachedModel {
+    // The symbolic description in which the constants are defined.
+    storm::storage::SymbolicModelDescription modelDescription;
+
+    // The definitions of the constants.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
+
+    // The formulas whose atomic expressions are labels of the model.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> respectedFormulas;
+
+    // The built model.
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+
+    // Guards the expression manager of the description, which is used (and extended) when parsing the properties of a query or (re)building the
+    // model. The mutex is shared by all models that are built from the same description.
+    std::shared_ptr<std::mutex> parsingMutex;
+
+    // Serialises the queries that are checked on the model, as checking a model is not thread-safe (e.g. its analysis results are computed
+    // lazily upon first use).
+    std::mutex checkingMutex;
+};
+
+/*!
+ * A thread-safe cache of the built models that evicts the least recently used model once its capacity is exceeded. Models are built at
+ * most once: requests for a model that is currently being built wait for the running build. Evicted models stay alive for as long as they
+ * are used by a query.
+ */
+class ModelCache {
+   public:
+    typedef std::function<std::shared_ptr<CachedModel>()> Builder;
+
+    /*!
+     * Creates an empty cache.
+     *
+     * @param capacity The maximal number of models in the cache.
+     */
+    ModelCache(uint64_t capacity);
+
+    /*!
+     * Retrieves the model with the given key. If the cache does not contain it, it is built with the given builder.
+     *
+     * @param key The key of the model.
+     * @param builder The builder that is invoked (in the calling thread) if the model is not cached.
+     * @param hit Is set to true iff the model was taken from the cache.
+     * @return The model.
+     */
+    std::shared_ptr<CachedModel> get(std::string const& key, Builder const& builder, bool& hit);
+
+    /*!
+     * Replaces the model with the given key by the given one, unless the cached model has been replaced already.
+     *
+     * @param key The key of the model.
+     * @param oldModel The model that is to be replaced.
+     * @param newModel The new model.
+     */
+    void replace(std::string const& key, std::shared_ptr<CachedModel> const& oldModel, std::shared_ptr<CachedModel> const& newModel);
+
+    /*!
+     * Retrieves the number of models in the cache (including the ones that are being built).
+     */
+    uint64_t size() const;
+
+   private:
+    struct Entry {
+        std::string key;
+
+        // Identifies the entry, i.e., an entry that was evicted and added again gets a new identifier.
+        uint64_t id;
+
+        std::shared_future<std::shared_ptr<CachedModel>> model;
+    };
+
+    // Moves the given entry to the front of the list of entries. Requires the mutex to be held.
+    void touch(std::list<Entry>::iterator const& entryIt);
+
+    uint64_t capacity;
+
+    // The identifier of the next entry.
+    uint64_t nextId;
+
+    mutable std::mutex mutex;
+
+    // The entries ordered from the most to the least recently used one.
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> keyToEntry;
+};
+
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,334 @@
+#include "storm-server-cli/server/Server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/io/file.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace server {
+
+namespace {
+/*!
+ * Builds the model for the given description such that all given formulas can be checked on it. As the model is reused for other queries,
+ * all labels and reward models are built and no states are made terminal.
+ */
+std::shared_ptr<storm::models::sparse::Model<double>> buildModel(storm::storage::SymbolicModelDescription const& modelDescription,
+                                                                 std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::builder::BuilderOptions options(formulas, modelDescription);
+    options.clearTerminalStates();
+    options.setBuildAllLabels(true);
+    options.setBuildAllRewardModels(true);
+    return storm::api::buildSparseModel<double>(modelDescription, options);
+}
+
+/*!
+ * Checks whether all atomic expressions of the given formulas are labels of the given model.
+ */
+bool respectsFormulas(storm::models::sparse::Model<double> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    for (auto const& formula : formulas) {
+        for (auto const& atomicExpressionFormula : formula->getAtomicExpressionFormulas()) {
+            std::stringstream stream;
+            stream << atomicExpressionFormula->getExpression();
+            if (!model.hasLabel(stream.str())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<storm::jani::Property> parseProperties(CachedModel const& cachedModel, std::string const& properties) {
+    auto result = storm::api::parsePropertiesForSymbolicModelDescription(properties, cachedModel.modelDescription);
+    return storm::api::substituteConstantsInProperties(result, cachedModel.constantDefinitions);
+}
+
+/*!
+ * Sends the given line over the given connection.
+ *
+ * @return True iff the line was sent completely.
+ */
+bool sendLine(int connection, std::string const& line) {
+    std::string message = line + "\n";
+    uint64_t sent = 0;
+    while (sent < message.size()) {
+        ssize_t result = send(connection, message.data() + sent, message.size() - sent, MSG_NOSIGNAL);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        sent += result;
+    }
+    return true;
+}
+}  // namespace
+
+Server::Server(uint64_t port, uint64_t cacheSize, uint64_t concurrentQueries)
+    : port(port), cache(cacheSize), concurrentQueries(concurrentQueries), runningQueries(0) {
+    // Intentionally left empty.
+}
+
+void Server::run() {
+    int serverSocket = socket(AF_INET, SOCK_STREAM, 0);
+    STORM_LOG_THROW(serverSocket >= 0, storm::exceptions::FileIoException, "Unable to create socket: " << std::strerror(errno) << ".");
+    int reuseAddress = 1;
+    setsockopt(serverSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    // Only accept local connections, as the queries refer to files on this machine.
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    if (bind(serverSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(serverSocket, SOMAXCONN) < 0) {
+        int error = errno;
+        close(serverSocket);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on port " << port << ": " << std::strerror(error) << ".");
+    }
+    STORM_PRINT_AND_LOG("Listening for queries on port " << port << ".\n");
+
+    pollfd serverPoll;
+    serverPoll.fd = serverSocket;
+    serverPoll.events = POLLIN;
+    while (!storm::utility::resources::isTerminate()) {
+        joinConnectionThreads(false);
+        // Wake up regularly to check whether the server is to be terminated.
+        int ready = poll(&serverPoll, 1, 1000);
+        if (ready <= 0) {
+            continue;
+        }
+        int connection = accept(serverSocket, nullptr, nullptr);
+        if (connection < 0) {
+            STORM_LOG_WARN_COND(errno == EINTR, "Unable to accept connection: " << std::strerror(errno) << ".");
+            continue;
+        }
+        ConnectionThread& connectionThread = connectionThreads.emplace_back();
+        connectionThread.thread = std::thread([this, connection, &connectionThread] {
+            handleConnection(connection);
+            connectionThread.finished = true;
+        });
+    }
+    close(serverSocket);
+
+    // The connections notice the termination and are closed once their running queries are answered.
+    joinConnectionThreads(true);
+}
+
+void Server::joinConnectionThreads(bool all) {
+    for (auto it = connectionThreads.begin(); it != connectionThreads.end();) {
+        if (all || it->finished) {
+            it->thread.join();
+            it = connectionThreads.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Server::handleConnection(int connection) {
+    STORM_LOG_INFO("Accepted connection.");
+    std::string buffer;
+    char chunk[4096];
+    bool open = true;
+    pollfd connectionPoll;
+    connectionPoll.fd = connection;
+    connectionPoll.events = POLLIN;
+    while (open && !storm::utility::resources::isTerminate()) {
+        // Wake up regularly to check whether the server is to be terminated.
+        int ready = poll(&connectionPoll, 1, 1000);
+        if (ready == 0 || (ready < 0 && errno == EINTR)) {
+            continue;
+        }
+        if (ready < 0) {
+            break;
+        }
+        ssize_t received = recv(connection, chunk, sizeof(chunk), 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            break;
+        }
+        buffer.append(chunk, received);
+
+        std::size_t lineEnd;
+        while (open && !storm::utility::resources::isTerminate() && (lineEnd = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, lineEnd);
+            buffer.erase(0, lineEnd + 1);
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+
+            storm::json<double> answer;
+            {
+                std::unique_lock<std::mutex> lock(queryMutex);
+                queryFinished.wait(lock, [this] { return runningQueries < concurrentQueries; });
+                ++runningQueries;
+            }
+            try {
+                answer = processQuery(storm::json<double>::parse(line));
+            } catch (std::exception const& exception) {
+                // Parsing the query failed.
+                answer["error"] = std::string("Unable to parse query: ") + exception.what();
+            }
+            {
+                std::lock_guard<std::mutex> lock(queryMutex);
+                --runningQueries;
+            }
+            queryFinished.notify_one();
+            open = sendLine(connection, answer.dump());
+        }
+    }
+    close(connection);
+    STORM_LOG_INFO("Closed connection.");
+}
+
+storm::json<double> Server::processQuery(storm::json<double> const& query) {
+    storm::json<double> answer;
+    try {
+        STORM_LOG_THROW(query.is_object(), storm::exceptions::WrongFormatException, "Expected the query to be a JSON object.");
+        STORM_LOG_THROW(query.count("model") > 0 && query.at("model").is_string(), storm::exceptions::WrongFormatException,
+                        "Expected the query to specify a model file.");
+        STORM_LOG_THROW(query.count("properties") > 0 && query.at("properties").is_string(), storm::exceptions::WrongFormatException,
+                        "Expected the query to specify properties.");
+        std::string modelFile = query.at("model").get<std::string>();
+        std::string properties = query.at("properties").get<std::string>();
+
+        bool isJani = boost::algorithm::ends_with(modelFile, ".jani");
+        if (query.count("type") > 0) {
+            std::string type = query.at("type").get<std::string>();
+            STORM_LOG_THROW(type == "prism" || type == "jani", storm::exceptions::WrongFormatException, "Unknown model type '" << type << "'.");
+            isJani = type == "jani";
+        }
+        std::string constants = query.count("constants") > 0 ? query.at("constants").get<std::string>() : "";
+
+        storm::Environment env;
+        if (query.count("precision") > 0) {
+            storm::RationalNumber precision = storm::utility::convertNumber<storm::RationalNumber>(query.at("precision").get<double>());
+            env.solver().setLinearEquationSolverPrecision(precision);
+            env.solver().minMax().setPrecision(precision);
+        }
+
+        std::vector<storm::jani::Property> parsedProperties;
+        bool hit;
+        auto cachedModel = getModel(modelFile, isJani, constants, properties, parsedProperties, hit);
+        std::lock_guard<std::mutex> checkingLock(cachedModel->checkingMutex);
+        auto const& model = cachedModel->model;
+        answer["cached"] = hit;
+        answer["states"] = model->getNumberOfStates();
+        answer["transitions"] = model->getNumberOfTransitions();
+
+        storm::json<double> results = storm::json<double>::array();
+        for (auto const& property : parsedProperties) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result =
+                storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(property.getRawFormula(), true));
+            STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The property " << property << " is not supported.");
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+
+            // Report the values of the initial states.
+            storm::json<double> values = storm::json<double>::array();
+            for (auto const& initialState : model->getInitialStates()) {
+                if (result->isExplicitQuantitativeCheckResult()) {
+                    values.push_back(result->asExplicitQuantitativeCheckResult<double>()[initialState]);
+                } else {
+                    values.push_back(result->asExplicitQualitativeCheckResult()[initialState]);
+                }
+            }
+            storm::json<double> propertyResult;
+            propertyResult["name"] = property.getName();
+            propertyResult["values"] = values;
+            results.push_back(propertyResult);
+        }
+        answer["results"] = results;
+    } catch (storm::exceptions::BaseException const& exception) {
+        answer = storm::json<double>();
+        answer["error"] = exception.what();
+    } catch (std::exception const& exception) {
+        answer = storm::json<double>();
+        answer["error"] = std::string("Unexpected error: ") + exception.what();
+    }
+    return answer;
+}
+
+std::shared_ptr<CachedModel> Server::getModel(std::string const& modelFile, bool isJani, std::string const& constants, std::string const& properties,
+                                              std::vector<storm::jani::Property>& parsedProperties, bool& hit) {
+    // Identify the model by its contents, such that changes of the file are noticed.
+    std::ifstream stream;
+    storm::io::openFile(modelFile, stream);
+    std::stringstream contents;
+    contents << stream.rdbuf();
+    storm::io::closeFile(stream);
+    std::string key = (isJani ? "jani:" : "prism:") + std::to_string(std::hash<std::string>()(contents.str())) + ":" + constants;
+
+    auto cachedModel = cache.get(
+        key,
+        [&]() {
+            STORM_LOG_INFO("Building model " << key << ".");
+            auto result = std::make_shared<CachedModel>();
+            storm::storage::SymbolicModelDescription modelDescription;
+            if (isJani) {
+                modelDescription = storm::api::parseJaniModel(modelFile, storm::api::getSupportedJaniFeatures(storm::builder::BuilderType::Explicit)).first;
+            } else {
+                modelDescription = storm::api::parseProgram(modelFile);
+            }
+            result->constantDefinitions = modelDescription.parseConstantDefinitions(constants);
+            result->modelDescription = modelDescription.preprocess(result->constantDefinitions);
+            result->parsingMutex = std::make_shared<std::mutex>();
+            parsedProperties = parseProperties(*result, properties);
+            result->respectedFormulas = storm::api::extractFormulasFromProperties(parsedProperties);
+            result->model = buildModel(result->modelDescription, result->respectedFormulas);
+            return result;
+        },
+        hit);
+
+    if (hit) {
+        std::lock_guard<std::mutex> lock(*cachedModel->parsingMutex);
+        parsedProperties = parseProperties(*cachedModel, properties);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(parsedProperties);
+        if (!respectsFormulas(*cachedModel->model, formulas)) {
+            // The cached model lacks labels for some of the atomic expressions, so we rebuild it such that it respects all formulas so far.
+            STORM_LOG_INFO("Rebuilding model " << key << " for additional atomic expressions.");
+            auto result = std::make_shared<CachedModel>();
+            result->modelDescription = cachedModel->modelDescription;
+            result->constantDefinitions = cachedModel->constantDefinitions;
+            result->parsingMutex = cachedModel->parsingMutex;
+            result->respectedFormulas = cachedModel->respectedFormulas;
+            result->respectedFormulas.insert(result->respectedFormulas.end(), formulas.begin(), formulas.end());
+            result->model = buildModel(result->modelDescription, result->respectedFormulas);
+            cache.replace(key, cachedModel, result);
+            cachedModel = result;
+            hit = false;
+        }
+    }
+    return cachedModel;
+}
+
+}  // namespace server
+}  // namespace storm
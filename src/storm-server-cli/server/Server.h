@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storm-server-cli/server/ModelCache.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/storage/jani/Property.h"
+
+namespace storm {
+namespace server {
+
+/*!
+ * A verification server that keeps the built models in memory. Clients connect via TCP and send one query per line. Every query is a JSON
+ * object of the form
+ *
+ *     {"model": "<file>", "type": "prism" | "jani", "constants": "<definitions>", "properties": "<properties>", "precision": <number>}
+ *
+ * where only the model and the properties are mandatory (the type is derived from the file extension by default). For every query, the
+ * server answers with a JSON object in a single line, which either contains the results of the properties (for the initial states) or an
+ * error message. Queries are processed concurrently, each with its own environment, but queries that refer to the same model are checked one after
+ * another.
+ */
+class Server {
+   public:
+    /*!
+     * Creates a server.
+     *
+     * @param port The port on which the server accepts connections.
+     * @param cacheSize The maximal number of models that are kept in the model cache.
+     * @param concurrentQueries The maximal number of queries that are processed concurrently.
+     */
+    Server(uint64_t port, uint64_t cacheSize, uint64_t concurrentQueries);
+
+    /*!
+     * Accepts connections until the process is terminated. Before returning, waits for all connections to be closed.
+     */
+    void run();
+
+    /*!
+     * Processes the given query.
+     *
+     * @param query The query.
+     * @return The answer to the query.
+     */
+    storm::json<double> processQuery(storm::json<double> const& query);
+
+   private:
+    /*!
+     * Answers the queries sent over the given connection until it is closed or the process is terminated.
+     */
+    void handleConnection(int connection);
+
+    /*!
+     * Retrieves the model for the given query, which has to respect all given formulas.
+     *
+     * @param modelFile The file containing the symbolic model description.
+     * @param isJani True iff the file contains a JANI model.
+     * @param constants The definitions of the constants.
+     * @param properties The properties that are to be parsed for the model.
+     * @param parsedProperties Is set to the parsed properties (in which the constants have been substituted).
+     * @param hit Is set to true iff the model was taken from the cache.
+     */
+    std::shared_ptr<CachedModel> getModel(std::string const& modelFile, bool isJani, std::string const& constants, std::string const& properties,
+                                          std::vector<storm::jani::Property>& parsedProperties, bool& hit);
+
+    /*!
+     * A thread that handles a connection.
+     */
+    struct ConnectionThread {
+        std::thread thread;
+
+        // Set once the connection is closed and the thread can be joined.
+        std::atomic<bool> finished{false};
+    };
+
+    /*!
+     * Joins the threads whose connections are closed. If all is set, waits for the remaining threads to finish, too.
+     */
+    void joinConnectionThreads(bool all);
+
+    uint64_t port;
+    ModelCache cache;
+
+    // The threads of the connections that are handled, which are only accessed by the thread running the server.
+    std::list<ConnectionThread> connectionThreads;
+
+    // Bounds the number of queries that are processed concurrently.
+    uint64_t concurrentQueries;
+    uint64_t runningQueries;
+    std::mutex queryMutex;
+    std::condition_variable queryFinished;
+};
+
+}  // namespace server
+}  // namespace storm
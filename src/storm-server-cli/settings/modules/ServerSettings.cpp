@@ -0,0 +1,65 @@
+#include "storm-server-cli/settings/modules/ServerSettings.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string ServerSettings::moduleName = "server";
+const std::string portOptionName = "port";
+const std::string cacheSizeOptionName = "cachesize";
+const std::string concurrentQueriesOptionName = "concurrent";
+
+ServerSettings::ServerSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, portOptionName, false, "Sets the port on which the server accepts connections.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("port", "The port.")
+                                         .setDefaultValueUnsignedInteger(4545)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 65535))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, cacheSizeOptionName, false, "Sets the maximal number of models kept in the model cache.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of models.")
+                                         .setDefaultValueUnsignedInteger(8)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    uint64_t defaultConcurrentQueries = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    this->addOption(storm::settings::OptionBuilder(moduleName, concurrentQueriesOptionName, false,
+                                                   "Sets the maximal number of queries that are processed concurrently.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of queries.")
+                                         .setDefaultValueUnsignedInteger(defaultConcurrentQueries)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+uint64_t ServerSettings::getPort() const {
+    return this->getOption(portOptionName).getArgumentByName("port").getValueAsUnsignedInteger();
+}
+
+uint64_t ServerSettings::getCacheSize() const {
+    return this->getOption(cacheSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t ServerSettings::getNumberOfConcurrentQueries() const {
+    return this->getOption(concurrentQueriesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+void ServerSettings::finalize() {
+    // Intentionally left empty.
+}
+
+bool ServerSettings::check() const {
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
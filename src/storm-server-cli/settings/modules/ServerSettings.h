@@ -0,0 +1,46 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the verification server.
+ */
+class ServerSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of server settings.
+     */
+    ServerSettings();
+
+    virtual ~ServerSettings() = default;
+
+    /*!
+     * Retrieves the port on which the server accepts connections.
+     */
+    uint64_t getPort() const;
+
+    /*!
+     * Retrieves the maximal number of models that are kept in the model cache.
+     */
+    uint64_t getCacheSize() const;
+
+    /*!
+     * Retrieves the maximal number of queries that are processed concurrently.
+     */
+    uint64_t getNumberOfConcurrentQueries() const;
+
+    bool check() const override;
+    void finalize() override;
+
+    // The name of the module.
+    static const std::string moduleName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,44 @@
+#include "storm-server-cli/server/Server.h"
+#include "storm-server-cli/settings/modules/ServerSettings.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+
+/*!
+ * Entry point for the verification server.
+ *
+ * @param argc The argc argument of main().
+ * @param argv The argv argument of main().
+ * @return Return code, 0 if successfull, not 0 otherwise.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-server", argc, argv);
+        storm::settings::initializeAll("Storm-server", "storm-server");
+        storm::settings::addModule<storm::settings::modules::ServerSettings>();
+
+        bool optionsCorrect = storm::cli::parseOptions(argc, argv);
+        if (!optionsCorrect) {
+            return -1;
+        }
+        storm::cli::setUrgentOptions();
+
+        auto const& serverSettings = storm::settings::getModule<storm::settings::modules::ServerSettings>();
+        storm::server::Server server(serverSettings.getPort(), serverSettings.getCacheSize(), serverSettings.getNumberOfConcurrentQueries());
+        server.run();
+
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-server to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-server to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
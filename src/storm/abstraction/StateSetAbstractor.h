@@ -71,7 +71,7 @@ class StateSetAbstractor {
     void constrain(storm::expressions::Expression const& constraint);
 
     /*!
-     * Constraints the abstract states with the given BDD.
+     * Constraints the abstract states with the given BDD. This replaces the previous constraint BDD (if any).
      *
      * @param newConstraint The BDD used as the constraint.
      */
@@ -16,6 +16,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace abstraction {
@@ -26,8 +27,8 @@ using storm::settings::modules::AbstractionSettings;
 template<storm::dd::DdType DdType, typename ValueType>
 AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation,
                                                             std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory,
-                                                            bool useDecomposition, bool addPredicatesForValidBlocks, bool debug)
-    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton) {
+                                                            bool useDecomposition, bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads)
+    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton), numberOfThreads(numberOfThreads) {
     // For each concrete command, we create an abstract counterpart.
     uint64_t edgeId = 0;
     for (auto const& edge : automaton.getEdges()) {
@@ -71,6 +72,14 @@ std::set<storm::expressions::Variable> const& AutomatonAbstractor<DdType, ValueT
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
+    // The SMT solutions of the edges are independent of each other, so they can be enumerated concurrently (each edge has its own
+    // solver). The DD manager is not thread-safe, so the solutions are only translated to BDDs afterwards.
+    storm::utility::parallel::forEachChunk(numberOfThreads, edges.size(), 1, [this](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t index = begin; index < end; ++index) {
+            edges[index].enumerateSolutions();
+        }
+    });
+
     // First, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
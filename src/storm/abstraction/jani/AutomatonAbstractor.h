@@ -34,10 +34,11 @@ class AutomatonAbstractor {
      * @param abstractionInformation An object holding information about the abstraction such as predicates and BDDs.
      * @param smtSolverFactory A factory that is to be used for creating new SMT solvers.
      * @param useDecomposition A flag indicating whether to use the decomposition during abstraction.
+     * @param numberOfThreads The number of threads used to enumerate the SMT solutions of the edges (if the decomposition is not used).
      */
     AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation,
                         std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition,
-                        bool addPredicatesForValidBlocks, bool debug);
+                        bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads = 1);
 
     AutomatonAbstractor(AutomatonAbstractor const&) = default;
     AutomatonAbstractor& operator=(AutomatonAbstractor const&) = default;
@@ -146,6 +147,9 @@ class AutomatonAbstractor {
     // The concrete module this abstract automaton refers to.
     std::reference_wrapper<storm::jani::Automaton const> automaton;
 
+    // The number of threads used to enumerate the SMT solutions of the edges.
+    uint64_t numberOfThreads;
+
     // If the automaton has more than one location, we need variables to encode that.
     boost::optional<std::pair<storm::expressions::Variable, storm::expressions::Variable>> locationVariables;
 };
@@ -39,6 +39,7 @@ EdgeAbstractor<DdType, ValueType>::EdgeAbstractor(uint64_t edgeId, storm::jani::
       addPredicatesForValidBlocks(addPredicatesForValidBlocks),
       skipBottomStates(false),
       forceRecomputation(true),
+      solutionsEnumerated(false),
       abstractGuard(abstractionInformation.getDdManager().getBddZero()),
       bottomStateAbstractor(abstractionInformation, {!edge.getGuard()}, smtSolverFactory),
       debug(debug) {
@@ -82,6 +83,9 @@ void EdgeAbstractor<DdType, ValueType>::refine(std::vector<uint_fast64_t> const&
     bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
     if (relevantPredicatesChanged) {
         addMissingPredicates(newRelevantPredicates);
+
+        // Solutions that were enumerated for the previous predicates are outdated.
+        solutionsEnumerated = false;
     }
     forceRecomputation |= relevantPredicatesChanged;
 
@@ -454,15 +458,20 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition()
     STORM_LOG_TRACE("Recomputing BDD for edge with id " << edgeId << " and guard " << edge.get().getGuard());
     auto start = std::chrono::high_resolution_clock::now();
 
+    // Enumerate the solutions (unless this was already done concurrently with the other edges).
+    if (!solutionsEnumerated) {
+        enumerateSolutions();
+    }
+
     // Create a mapping from source state DDs to their distributions.
     std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-    uint64_t numberOfSolutions = 0;
-    smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-        sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
-            getDistributionBdd(model, relevantPredicatesAndVariables.second));
-        ++numberOfSolutions;
-        return true;
-    });
+    uint64_t numberOfSolutions = enumeratedSolutions.size();
+    for (auto const& solution : enumeratedSolutions) {
+        sourceToDistributionsMap[getSourceStateBdd(solution)].push_back(getDistributionBdd(solution));
+    }
+    enumeratedSolutions.clear();
+    enumeratedSolutions.shrink_to_fit();
+    solutionsEnumerated = false;
 
     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
     // need to encode the nondeterminism.
@@ -684,6 +693,78 @@ storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::computeMissingDestinat
     return result;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void EdgeAbstractor<DdType, ValueType>::enumerateSolutions() {
+    if (!forceRecomputation || useDecomposition || solutionsEnumerated) {
+        return;
+    }
+
+    uint64_t numberOfBits = relevantPredicatesAndVariables.first.size();
+    for (auto const& destinationVariablesAndPredicates : relevantPredicatesAndVariables.second) {
+        numberOfBits += destinationVariablesAndPredicates.size();
+    }
+
+    enumeratedSolutions.clear();
+    smtSolver->allSat(decisionVariables, [this, numberOfBits](storm::solver::SmtSolver::ModelReference const& model) {
+        storm::storage::BitVector solution(numberOfBits);
+        uint64_t bit = 0;
+        for (auto const& variableIndexPair : relevantPredicatesAndVariables.first) {
+            solution.set(bit++, model.getBooleanValue(variableIndexPair.first));
+        }
+        for (auto const& destinationVariablesAndPredicates : relevantPredicatesAndVariables.second) {
+            for (auto const& variableIndexPair : destinationVariablesAndPredicates) {
+                solution.set(bit++, model.getBooleanValue(variableIndexPair.first));
+            }
+        }
+        enumeratedSolutions.push_back(std::move(solution));
+        return true;
+    });
+    solutionsEnumerated = true;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getSourceStateBdd(storm::storage::BitVector const& solution) const {
+    auto const& variablePredicates = relevantPredicatesAndVariables.first;
+    storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
+    for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+        if (solution.get(index - 1)) {
+            result &= this->getAbstractionInformation().encodePredicateAsSource(variablePredicates[index - 1].second);
+        } else {
+            result &= !this->getAbstractionInformation().encodePredicateAsSource(variablePredicates[index - 1].second);
+        }
+    }
+
+    STORM_LOG_ASSERT(!result.isZero(), "Source must not be empty.");
+    return result;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getDistributionBdd(storm::storage::BitVector const& solution) const {
+    storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
+
+    uint64_t offset = relevantPredicatesAndVariables.first.size();
+    for (uint_fast64_t destinationIndex = 0; destinationIndex < edge.get().getNumberOfDestinations(); ++destinationIndex) {
+        auto const& variablePredicates = relevantPredicatesAndVariables.second[destinationIndex];
+        storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
+
+        // Translate the successor predicates of this destination into a successor block.
+        for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+            if (solution.get(offset + index - 1)) {
+                updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variablePredicates[index - 1].second);
+            } else {
+                updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variablePredicates[index - 1].second);
+            }
+        }
+        offset += variablePredicates.size();
+
+        updateBdd &= this->getAbstractionInformation().encodeAux(destinationIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
+        result |= updateBdd;
+    }
+
+    STORM_LOG_ASSERT(!result.isZero(), "Distribution must not be empty.");
+    return result;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> EdgeAbstractor<DdType, ValueType>::abstract() {
     if (forceRecomputation) {
@@ -16,6 +16,8 @@
 
 #include "storm/solver/SmtSolver.h"
 
+#include "storm/storage/BitVector.h"
+
 namespace storm {
 namespace utility {
 namespace solver {
@@ -98,6 +100,13 @@ class EdgeAbstractor {
      */
     GameBddResult<DdType> abstract();
 
+    /*!
+     * If the abstraction needs to be recomputed without the decomposition, this enumerates the solutions of the SMT encoding of the edge
+     * (which dominates the cost of the recomputation). The solutions are only translated to a BDD in the next call to abstract(). As this only
+     * uses the SMT solver of this edge and does not touch the DD manager, it may be called concurrently for different abstractors.
+     */
+    void enumerateSolutions();
+
     /*!
      * Retrieves the transitions to bottom states of this edge.
      *
@@ -190,6 +199,16 @@ class EdgeAbstractor {
      */
     void recomputeCachedBddWithoutDecomposition();
 
+    /*!
+     * Translates the given solution (as enumerated by enumerateSolutions) to a source state DD.
+     */
+    storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& solution) const;
+
+    /*!
+     * Translates the given solution (as enumerated by enumerateSolutions) to a distribution over successor states.
+     */
+    storm::dd::Bdd<DdType> getDistributionBdd(storm::storage::BitVector const& solution) const;
+
     /*!
      * Recomputes the cached BDD using the decomposition.
      */
@@ -266,6 +285,11 @@ class EdgeAbstractor {
     // A flag remembering whether we need to force recomputation of the BDD.
     bool forceRecomputation;
 
+    // The solutions enumerated by the last call to enumerateSolutions that were not yet translated to a BDD. Every solution holds the
+    // values of the relevant source predicates followed by the values of the relevant successor predicates of each destination.
+    std::vector<storm::storage::BitVector> enumeratedSolutions;
+    bool solutionsEnumerated;
+
     // The abstract guard of the edge. This is only used if the guard is not a predicate, because it can
     // then be used to constrain the bottom state abstractor.
     storm::dd::Bdd<DdType> abstractGuard;
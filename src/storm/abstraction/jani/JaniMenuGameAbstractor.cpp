@@ -23,6 +23,7 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 #include "storm-config.h"
@@ -86,8 +87,13 @@ JaniMenuGameAbstractor<DdType, ValueType>::JaniMenuGameAbstractor(storm::jani::M
     restrictToValidBlocks = settings.getValidBlockMode() == storm::settings::modules::AbstractionSettings::ValidBlockMode::BlockEnumeration;
     bool addPredicatesForValidBlocks = !restrictToValidBlocks;
     bool debug = settings.isDebugSet();
+    uint64_t numberOfThreads = settings.getNumberOfThreads();
+    if (numberOfThreads == 0) {
+        numberOfThreads = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
     for (auto const& automaton : model.getAutomata()) {
-        automata.emplace_back(automaton, abstractionInformation, this->smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug);
+        automata.emplace_back(automaton, abstractionInformation, this->smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug,
+                              numberOfThreads);
     }
 
     // Retrieve global BDDs/ADDs so we can multiply them in the abstraction process.
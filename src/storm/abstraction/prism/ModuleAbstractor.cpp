@@ -15,6 +15,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace abstraction {
@@ -25,8 +26,8 @@ using storm::settings::modules::AbstractionSettings;
 template<storm::dd::DdType DdType, typename ValueType>
 ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation,
                                                       std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition,
-                                                      bool addPredicatesForValidBlocks, bool debug)
-    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module) {
+                                                      bool addPredicatesForValidBlocks, bool debug, uint64_t numberOfThreads)
+    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module), numberOfThreads(numberOfThreads) {
     // For each concrete command, we create an abstract counterpart.
     for (auto const& command : module.getCommands()) {
         commands.emplace_back(command, abstractionInformation, smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug);
@@ -64,6 +65,14 @@ std::set<storm::expressions::Variable> const& ModuleAbstractor<DdType, ValueType
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
+    // The SMT solutions of the commands are independent of each other, so they can be enumerated concurrently (each command has its
+    // own solver). The DD manager is not thread-safe, so the solutions are only translated to BDDs afterwards.
+    storm::utility::parallel::forEachChunk(numberOfThreads, commands.size(), 1, [this](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t index = begin; index < end; ++index) {
+            commands[index].enumerateSolutions();
+        }
+    });
+
     // First, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -37,10 +37,11 @@ class ModuleAbstractor {
      * @param abstractionInformation An object holding information about the abstraction such as predicates and BDDs.
      * @param smtSolverFactory A factory that is to be used for creating new SMT solvers.
      * @param useDecomposition A flag that governs whether to use the decomposition in the abstraction.
+     * @param numberOfThreads The number of threads used to enumerate the SMT solutions of the commands (if the decomposition is not used).
      */
     ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation,
                      std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition, bool addPredicatesForValidBlocks,
-                     bool debug);
+                     bool debug, uint64_t numberOfThreads = 1);
 
     ModuleAbstractor(ModuleAbstractor const&) = default;
     ModuleAbstractor& operator=(ModuleAbstractor const&) = default;
@@ -136,6 +137,9 @@ class ModuleAbstractor {
 
     // The concrete module this abstract module refers to.
     std::reference_wrapper<storm::prism::Module const> module;
+
+    // The number of threads used to enumerate the SMT solutions of the commands.
+    uint64_t numberOfThreads;
 };
 }  // namespace prism
 }  // namespace abstraction
@@ -21,6 +21,7 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 #include "storm-config.h"
@@ -80,8 +81,13 @@ PrismMenuGameAbstractor<DdType, ValueType>::PrismMenuGameAbstractor(storm::prism
     restrictToValidBlocks = settings.getValidBlockMode() == storm::settings::modules::AbstractionSettings::ValidBlockMode::BlockEnumeration;
     bool addPredicatesForValidBlocks = !restrictToValidBlocks;
     bool debug = settings.isDebugSet();
+    uint64_t numberOfThreads = settings.getNumberOfThreads();
+    if (numberOfThreads == 0) {
+        numberOfThreads = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
     for (auto const& module : program.getModules()) {
-        this->modules.emplace_back(module, abstractionInformation, this->smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug);
+        this->modules.emplace_back(module, abstractionInformation, this->smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug,
+                                   numberOfThreads);
     }
 
     // Retrieve the command-update probability ADD, so we can multiply it with the abstraction BDD later.
@@ -1,22 +1,47 @@
 #include "storm/adapters/EigenAdapter.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
 namespace storm {
 namespace adapters {
 
 template<typename ValueType>
 std::unique_ptr<Eigen::SparseMatrix<ValueType>> EigenAdapter::toEigenSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
-    // Build a list of triplets and let Eigen care about the insertion.
-    std::vector<Eigen::Triplet<ValueType>> triplets;
-    triplets.reserve(matrix.getNonzeroEntryCount());
+    // Eigen's default storage is column-major, whereas our matrices are stored row-major. Instead of building a list of triplets (which Eigen
+    // sorts and copies again internally), we transpose the compressed storage directly. As the rows are traversed in ascending order, the row
+    // indices within each column are sorted.
+    typedef typename Eigen::SparseMatrix<ValueType>::StorageIndex StorageIndex;
+    STORM_LOG_THROW(matrix.getEntryCount() <= static_cast<uint64_t>(std::numeric_limits<StorageIndex>::max()), storm::exceptions::InvalidArgumentException,
+                    "The matrix has too many entries to be converted to Eigen's format.");
+    std::unique_ptr<Eigen::SparseMatrix<ValueType>> result = std::make_unique<Eigen::SparseMatrix<ValueType>>(matrix.getRowCount(), matrix.getColumnCount());
+    result->resizeNonZeros(matrix.getEntryCount());
+
+    // Count the entries of each column and compute the column starts.
+    StorageIndex* columnStarts = result->outerIndexPtr();
+    std::fill(columnStarts, columnStarts + matrix.getColumnCount() + 1, 0);
+    for (auto const& element : matrix) {
+        ++columnStarts[element.getColumn() + 1];
+    }
+    for (uint64_t column = 0; column < matrix.getColumnCount(); ++column) {
+        columnStarts[column + 1] += columnStarts[column];
+    }
 
+    // Scatter the entries into their columns.
+    std::vector<StorageIndex> nextPositions(columnStarts, columnStarts + matrix.getColumnCount());
+    StorageIndex* rows = result->innerIndexPtr();
+    ValueType* values = result->valuePtr();
     for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
         for (auto const& element : matrix.getRow(row)) {
-            triplets.emplace_back(row, element.getColumn(), element.getValue());
+            StorageIndex& position = nextPositions[element.getColumn()];
+            rows[position] = static_cast<StorageIndex>(row);
+            values[position] = element.getValue();
+            ++position;
         }
     }
-
-    std::unique_ptr<Eigen::SparseMatrix<ValueType>> result = std::make_unique<Eigen::SparseMatrix<ValueType>>(matrix.getRowCount(), matrix.getColumnCount());
-    result->setFromTriplets(triplets.begin(), triplets.end());
     return result;
 }
 
@@ -13,8 +13,9 @@ namespace adapters {
 class EigenAdapter {
    public:
     /*!
-     * Converts a sparse matrix into a sparse matrix in the gmm++ format.
-     * @return A pointer to a row-major sparse matrix in gmm++ format.
+     * Converts a sparse matrix into a (compressed) sparse matrix in Eigen's format. The entries are written into Eigen's storage directly,
+     * without any intermediate copy.
+     * @return A pointer to a column-major sparse matrix in Eigen's format.
      */
     template<class ValueType>
     static std::unique_ptr<Eigen::SparseMatrix<ValueType>> toEigenSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix);
@@ -1,10 +1,12 @@
 #include "storm/adapters/GmmxxAdapter.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -16,28 +18,29 @@ std::unique_ptr<gmm::csr_matrix<T>> GmmxxAdapter<T>::toGmmxxSparseMatrix(storm::
     STORM_LOG_TRACE("Converting " << matrix.getRowCount() << "x" << matrix.getColumnCount() << " matrix with " << realNonZeros
                                   << " non-zeros to gmm++ format.");
 
+    // The indices of gmm++ have (at most) 32 bits, so the row indications can not be shared with our matrix.
+    typedef typename gmm::csr_matrix<T>::IND_TYPE IndexType;
+    STORM_LOG_THROW(realNonZeros <= static_cast<uint_fast64_t>(std::numeric_limits<IndexType>::max()), storm::exceptions::InvalidArgumentException,
+                    "The matrix has too many entries to be converted to gmm++ format.");
+
     // Prepare the resulting matrix.
     std::unique_ptr<gmm::csr_matrix<T>> result(new gmm::csr_matrix<T>(matrix.getRowCount(), matrix.getColumnCount()));
 
     // Copy Row Indications
     std::copy(matrix.rowIndications.begin(), matrix.rowIndications.end(), result->jc.begin());
 
-    // Copy columns and values.
-    std::vector<T> values;
-    values.reserve(matrix.getEntryCount());
-
-    // To match the correct vector type for gmm, we create the vector with the exact same type.
-    decltype(result->ir) columns;
-    columns.reserve(matrix.getEntryCount());
-
+    // Copy columns and values directly into the storage of the result.
+    result->ir.resize(realNonZeros);
+    result->pr.resize(realNonZeros);
+    auto columnIt = result->ir.begin();
+    auto valueIt = result->pr.begin();
     for (auto const& entry : matrix) {
-        columns.emplace_back(entry.getColumn());
-        values.emplace_back(entry.getValue());
+        *columnIt = static_cast<IndexType>(entry.getColumn());
+        *valueIt = entry.getValue();
+        ++columnIt;
+        ++valueIt;
     }
 
-    std::swap(result->ir, columns);
-    std::swap(result->pr, values);
-
     STORM_LOG_TRACE("Done converting matrix to gmm++ format.");
 
     return result;
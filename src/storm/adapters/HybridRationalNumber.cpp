@@ -0,0 +1,140 @@
+#include "storm/adapters/HybridRationalNumber.h"
+
+#include <functional>
+#include <ostream>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+
+namespace {
+typedef typename NumberTraits<storm::RationalNumber>::IntegerType IntegerType;
+
+storm::RationalNumber fractionToRationalNumber(int64_t numerator, int64_t denominator) {
+    storm::RationalNumber result = storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(numerator));
+    if (denominator != 1) {
+        result /= storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(denominator));
+    }
+    return result;
+}
+}  // namespace
+
+HybridRationalNumber::HybridRationalNumber(storm::RationalNumber const& value) : numerator(0), denominator(1), big(nullptr) {
+    assign(value);
+}
+
+storm::RationalNumber HybridRationalNumber::toRationalNumber() const {
+    return isSmall() ? fractionToRationalNumber(numerator, denominator) : *big;
+}
+
+double HybridRationalNumber::toDouble() const {
+    if (isSmall()) {
+        return static_cast<double>(numerator) / static_cast<double>(denominator);
+    }
+    return storm::utility::convertNumber<double>(*big);
+}
+
+void HybridRationalNumber::copyBig(HybridRationalNumber const& other) {
+    if (other.big) {
+        if (big) {
+            *big = *other.big;
+        } else {
+            big = new storm::RationalNumber(*other.big);
+        }
+    } else {
+        destroyBig();
+        numerator = other.numerator;
+        denominator = other.denominator;
+    }
+}
+
+void HybridRationalNumber::destroyBig() {
+    delete big;
+    big = nullptr;
+}
+
+void HybridRationalNumber::assign(storm::RationalNumber const& value) {
+    static IntegerType const limit = storm::utility::convertNumber<IntegerType>(static_cast<uint_fast64_t>(std::numeric_limits<int64_t>::max()));
+    IntegerType valueNumerator = storm::utility::numerator(value);
+    IntegerType valueDenominator = storm::utility::denominator(value);
+    // Switch back to the small representation whenever the value fits, which keeps the representation canonical.
+    if (carl::abs(valueNumerator) <= limit && valueDenominator <= limit) {
+        if (big) {
+            destroyBig();
+        }
+        numerator = carl::toInt<carl::sint>(valueNumerator);
+        denominator = carl::toInt<carl::sint>(valueDenominator);
+    } else if (big) {
+        *big = value;
+    } else {
+        big = new storm::RationalNumber(value);
+    }
+}
+
+void HybridRationalNumber::assignFraction(int64_t fractionNumerator, int64_t fractionDenominator) {
+    STORM_LOG_THROW(fractionDenominator != 0, storm::exceptions::InvalidArgumentException, "Denominator of rational number must not be zero.");
+    assign(fractionToRationalNumber(fractionNumerator, fractionDenominator));
+}
+
+void HybridRationalNumber::addBig(HybridRationalNumber const& other, bool subtract) {
+    storm::RationalNumber result = toRationalNumber();
+    if (subtract) {
+        result -= other.toRationalNumber();
+    } else {
+        result += other.toRationalNumber();
+    }
+    assign(result);
+}
+
+void HybridRationalNumber::multiplyBig(HybridRationalNumber const& other, bool divide) {
+    storm::RationalNumber result = toRationalNumber();
+    if (divide) {
+        STORM_LOG_THROW(!other.isZero(), storm::exceptions::InvalidArgumentException, "Division by zero.");
+        result /= other.toRationalNumber();
+    } else {
+        result *= other.toRationalNumber();
+    }
+    assign(result);
+}
+
+HybridRationalNumber HybridRationalNumber::negateBig() const {
+    return HybridRationalNumber(storm::RationalNumber(-*big));
+}
+
+int HybridRationalNumber::compareBig(HybridRationalNumber const& other) const {
+    storm::RationalNumber first = toRationalNumber();
+    storm::RationalNumber second = other.toRationalNumber();
+    return first < second ? -1 : (second < first ? 1 : 0);
+}
+
+std::ostream& operator<<(std::ostream& out, HybridRationalNumber const& number) {
+    if (number.isSmall()) {
+        out << number.numerator;
+        if (number.denominator != 1) {
+            out << "/" << number.denominator;
+        }
+    } else {
+        out << *number.big;
+    }
+    return out;
+}
+
+std::size_t hash_value(HybridRationalNumber const& number) {
+    // Small and big values never coincide, so they may be hashed differently.
+    if (number.isSmall()) {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, number.numerator);
+        boost::hash_combine(seed, number.denominator);
+        return seed;
+    }
+    return std::hash<storm::RationalNumber>()(*number.big);
+}
+
+}  // namespace storm
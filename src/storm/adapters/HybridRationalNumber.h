@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <numeric>
+
+#include "storm/adapters/RationalNumberForward.h"
+
+namespace storm {
+
+/*!
+ * An exact rational number that stores small fractions inline as a pair of 64-bit integers and only switches to an arbitrary precision
+ * number (storm::RationalNumber) once the numerator or the denominator overflows. The probabilities of most models are small fractions
+ * like 1/2 or 3/10, for which arithmetic then neither allocates memory nor calls into the big number library.
+ *
+ * The representation is canonical: small values are stored in lowest terms with a positive denominator and a numerator that is not the
+ * minimal 64-bit integer, and a value is stored as a big number only if it has no small representation. Thus, two values are equal iff their
+ * representations are equal.
+ */
+class HybridRationalNumber {
+   public:
+    HybridRationalNumber() : numerator(0), denominator(1), big(nullptr) {
+        // Intentionally left empty.
+    }
+
+    HybridRationalNumber(int value) : HybridRationalNumber(static_cast<int64_t>(value)) {
+        // Intentionally left empty.
+    }
+
+    HybridRationalNumber(int64_t numerator, int64_t denominator = 1) : numerator(0), denominator(1), big(nullptr) {
+        if (denominator <= 0 || !reduceSmall(numerator, denominator, this->numerator, this->denominator)) {
+            assignFraction(numerator, denominator);
+        }
+    }
+
+    explicit HybridRationalNumber(storm::RationalNumber const& value);
+
+    HybridRationalNumber(HybridRationalNumber const& other) : numerator(other.numerator), denominator(other.denominator), big(nullptr) {
+        if (other.big) {
+            copyBig(other);
+        }
+    }
+
+    HybridRationalNumber(HybridRationalNumber&& other) noexcept : numerator(other.numerator), denominator(other.denominator), big(other.big) {
+        other.big = nullptr;
+    }
+
+    HybridRationalNumber& operator=(HybridRationalNumber const& other) {
+        if (this != &other) {
+            if (big || other.big) {
+                copyBig(other);
+            } else {
+                numerator = other.numerator;
+                denominator = other.denominator;
+            }
+        }
+        return *this;
+    }
+
+    HybridRationalNumber& operator=(HybridRationalNumber&& other) noexcept {
+        if (this != &other) {
+            if (big) {
+                destroyBig();
+            }
+            numerator = other.numerator;
+            denominator = other.denominator;
+            big = other.big;
+            other.big = nullptr;
+        }
+        return *this;
+    }
+
+    ~HybridRationalNumber() {
+        if (big) {
+            destroyBig();
+        }
+    }
+
+    /*!
+     * @return True iff the value is stored inline.
+     */
+    bool isSmall() const {
+        return big == nullptr;
+    }
+
+    /*!
+     * Retrieves the numerator and the denominator of the value (in lowest terms). May only be called for small values.
+     */
+    int64_t getSmallNumerator() const {
+        return numerator;
+    }
+    int64_t getSmallDenominator() const {
+        return denominator;
+    }
+
+    bool isZero() const {
+        return isSmall() && numerator == 0;
+    }
+
+    bool isOne() const {
+        return isSmall() && numerator == 1 && denominator == 1;
+    }
+
+    storm::RationalNumber toRationalNumber() const;
+    double toDouble() const;
+
+    HybridRationalNumber& operator+=(HybridRationalNumber const& other) {
+        int64_t resultNumerator, resultDenominator;
+        if (bothSmall(other) && addSmall(numerator, denominator, other.numerator, other.denominator, resultNumerator, resultDenominator)) {
+            numerator = resultNumerator;
+            denominator = resultDenominator;
+        } else {
+            addBig(other, false);
+        }
+        return *this;
+    }
+
+    HybridRationalNumber& operator-=(HybridRationalNumber const& other) {
+        int64_t resultNumerator, resultDenominator;
+        if (bothSmall(other) && addSmall(numerator, denominator, -other.numerator, other.denominator, resultNumerator, resultDenominator)) {
+            numerator = resultNumerator;
+            denominator = resultDenominator;
+        } else {
+            addBig(other, true);
+        }
+        return *this;
+    }
+
+    HybridRationalNumber& operator*=(HybridRationalNumber const& other) {
+        int64_t resultNumerator, resultDenominator;
+        if (bothSmall(other) && multiplySmall(numerator, denominator, other.numerator, other.denominator, resultNumerator, resultDenominator)) {
+            numerator = resultNumerator;
+            denominator = resultDenominator;
+        } else {
+            multiplyBig(other, false);
+        }
+        return *this;
+    }
+
+    HybridRationalNumber& operator/=(HybridRationalNumber const& other) {
+        int64_t resultNumerator, resultDenominator;
+        // Dividing multiplies with the reciprocal, whose sign is moved to the numerator. Division by zero is reported by the slow path.
+        if (bothSmall(other) && other.numerator != 0 &&
+            multiplySmall(numerator, denominator, other.numerator < 0 ? -other.denominator : other.denominator,
+                          other.numerator < 0 ? -other.numerator : other.numerator, resultNumerator, resultDenominator)) {
+            numerator = resultNumerator;
+            denominator = resultDenominator;
+        } else {
+            multiplyBig(other, true);
+        }
+        return *this;
+    }
+
+    HybridRationalNumber operator-() const {
+        if (isSmall()) {
+            HybridRationalNumber result;
+            result.numerator = -numerator;
+            result.denominator = denominator;
+            return result;
+        }
+        return negateBig();
+    }
+
+    friend HybridRationalNumber operator+(HybridRationalNumber first, HybridRationalNumber const& second) {
+        first += second;
+        return first;
+    }
+
+    friend HybridRationalNumber operator-(HybridRationalNumber first, HybridRationalNumber const& second) {
+        first -= second;
+        return first;
+    }
+
+    friend HybridRationalNumber operator*(HybridRationalNumber first, HybridRationalNumber const& second) {
+        first *= second;
+        return first;
+    }
+
+    friend HybridRationalNumber operator/(HybridRationalNumber first, HybridRationalNumber const& second) {
+        first /= second;
+        return first;
+    }
+
+    friend bool operator==(HybridRationalNumber const& first, HybridRationalNumber const& second) {
+        if (first.bothSmall(second)) {
+            return first.numerator == second.numerator && first.denominator == second.denominator;
+        } else if (first.isSmall() || second.isSmall()) {
+            // The representation is canonical, so a small value never equals a big one.
+            return false;
+        }
+        return first.compareBig(second) == 0;
+    }
+
+    friend bool operator!=(HybridRationalNumber const& first, HybridRationalNumber const& second) {
+        return !(first == second);
+    }
+
+    friend bool operator<(HybridRationalNumber const& first, HybridRationalNumber const& second) {
+        return first.compare(second) < 0;
+    }
+
+    friend bool operator<=(HybridRationalNumber const& first, HybridRationalNumber const& second) {
+        return first.compare(second) <= 0;
+    }
+
+    friend bool operator>(HybridRationalNumber const& first, HybridRationalNumber const& second) {
+        return first.compare(second) > 0;
+    }
+
+    friend bool operator>=(HybridRationalNumber const& first, HybridRationalNumber const& second) {
+        return first.compare(second) >= 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, HybridRationalNumber const& number);
+
+    friend std::size_t hash_value(HybridRationalNumber const& number);
+
+   private:
+    bool bothSmall(HybridRationalNumber const& other) const {
+        return big == nullptr && other.big == nullptr;
+    }
+
+    /*!
+     * Computes the canonical fraction of n/d for d > 0.
+     *
+     * @return False iff the result has no small representation.
+     */
+    static bool reduceSmall(int64_t n, int64_t d, int64_t& resultNumerator, int64_t& resultDenominator) {
+        if (n == std::numeric_limits<int64_t>::min()) {
+            return false;
+        }
+        int64_t divisor = std::gcd(n, d);
+        resultNumerator = n / divisor;
+        resultDenominator = d / divisor;
+        return true;
+    }
+
+    static bool addSmall(int64_t n1, int64_t d1, int64_t n2, int64_t d2, int64_t& resultNumerator, int64_t& resultDenominator) {
+        int64_t n, d;
+        if (d1 == d2) {
+            if (__builtin_add_overflow(n1, n2, &n)) {
+                return false;
+            }
+            d = d1;
+        } else {
+            int64_t n1d2, n2d1;
+            if (__builtin_mul_overflow(n1, d2, &n1d2) || __builtin_mul_overflow(n2, d1, &n2d1) || __builtin_add_overflow(n1d2, n2d1, &n) ||
+                __builtin_mul_overflow(d1, d2, &d)) {
+                return false;
+            }
+        }
+        return reduceSmall(n, d, resultNumerator, resultDenominator);
+    }
+
+    static bool multiplySmall(int64_t n1, int64_t d1, int64_t n2, int64_t d2, int64_t& resultNumerator, int64_t& resultDenominator) {
+        // Cancelling crosswise keeps the intermediate values small and yields a result in lowest terms.
+        if (n1 == 0 || n2 == 0) {
+            resultNumerator = 0;
+            resultDenominator = 1;
+            return true;
+        }
+        int64_t divisor1 = std::gcd(n1, d2);
+        int64_t divisor2 = std::gcd(n2, d1);
+        return !__builtin_mul_overflow(n1 / divisor1, n2 / divisor2, &resultNumerator) &&
+               !__builtin_mul_overflow(d1 / divisor2, d2 / divisor1, &resultDenominator) &&
+               resultNumerator != std::numeric_limits<int64_t>::min();
+    }
+
+    int compare(HybridRationalNumber const& other) const {
+        if (bothSmall(other)) {
+            // The products of two 64-bit integers do not overflow 128 bits.
+            __int128 left = static_cast<__int128>(numerator) * other.denominator;
+            __int128 right = static_cast<__int128>(other.numerator) * denominator;
+            return left < right ? -1 : (left > right ? 1 : 0);
+        }
+        return compareBig(other);
+    }
+
+    // The slow paths, which operate on big numbers.
+    void copyBig(HybridRationalNumber const& other);
+    void destroyBig();
+    void assign(storm::RationalNumber const& value);
+    void assignFraction(int64_t numerator, int64_t denominator);
+    void addBig(HybridRationalNumber const& other, bool subtract);
+    void multiplyBig(HybridRationalNumber const& other, bool divide);
+    HybridRationalNumber negateBig() const;
+    int compareBig(HybridRationalNumber const& other) const;
+
+    // The value if it is small.
+    int64_t numerator;
+    int64_t denominator;
+
+    // The value if it is big and null otherwise.
+    storm::RationalNumber* big;
+};
+
+}  // namespace storm
+
+namespace std {
+template<>
+struct hash<storm::HybridRationalNumber> {
+    std::size_t operator()(storm::HybridRationalNumber const& number) const {
+        return hash_value(number);
+    }
+};
+}  // namespace std
@@ -35,4 +35,7 @@ typedef GmpRationalNumber RationalNumber;
 #else
 #error GMP is to be used, but is not available.
 #endif
+
+// A rational number with an inline representation for small fractions, see storm/adapters/HybridRationalNumber.h.
+class HybridRationalNumber;
 }  // namespace storm
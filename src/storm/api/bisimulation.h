@@ -4,11 +4,17 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 
+#include "storm/storage/bisimulation/AcyclicStateLumping.h"
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/bisimulation/PartitionCache.h"
 
 #include "storm/storage/dd/BisimulationDecomposition.h"
 #include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
@@ -16,40 +22,121 @@
 namespace storm {
 namespace api {
 
+/*!
+ * Lets the given options of a sparse bisimulation decomposition start from the closest partition of the model in the given cache (if any).
+ *
+ * @return The information preserved by the decomposition if the cache can be used for it.
+ */
+template<typename ModelType, typename OptionsType>
+boost::optional<storm::storage::bisimulation::SparsePreservationInformation> initializeFromPartitionCache(
+    storm::storage::bisimulation::SparsePartitionCache const* partitionCache, std::shared_ptr<void const> const& modelIdentity, ModelType const& model,
+    OptionsType& options) {
+    // Measure-driven initial partitions do not only depend on the preserved labels and weak bisimulations may not start from arbitrary partitions.
+    if (!partitionCache || options.measureDrivenInitialPartition || options.getType() != storm::storage::BisimulationType::Strong) {
+        return boost::none;
+    }
+    storm::storage::bisimulation::SparsePreservationInformation preservationInformation;
+    preservationInformation.atomicPropositions =
+        options.respectedAtomicPropositions ? options.respectedAtomicPropositions.get() : model.getStateLabeling().getLabels();
+    // The initial states are not used to build the initial partition.
+    preservationInformation.atomicPropositions.erase("init");
+    preservationInformation.rewards = options.getKeepRewards() && model.hasRewardModel();
+
+    auto entry = partitionCache->find(modelIdentity, preservationInformation);
+    if (entry) {
+        options.initialStateBlocks = entry->partition;
+    }
+    return preservationInformation;
+}
+
+/*!
+ * Stores the partition of the given (computed) sparse bisimulation decomposition in the given cache.
+ */
+template<typename DecompositionType>
+void storeInPartitionCache(storm::storage::bisimulation::SparsePartitionCache& partitionCache, std::shared_ptr<void const> const& modelIdentity,
+                           storm::storage::bisimulation::SparsePreservationInformation const& preservationInformation,
+                           DecompositionType const& decomposition, uint_fast64_t numberOfStates) {
+    std::vector<uint_fast64_t> stateBlocks(numberOfStates);
+    for (uint_fast64_t block = 0; block < decomposition.size(); ++block) {
+        for (auto state : decomposition.getBlock(block)) {
+            stateBlocks[state] = block;
+        }
+    }
+    partitionCache.insert(modelIdentity, preservationInformation, std::move(stateBlocks));
+}
+
+/*!
+ * Computes the bisimulation quotient of the given deterministic model.
+ *
+ * @param partitionCache If given, the computation starts from the closest partition of the model in this cache and the resulting
+ * partition is stored in it. Models are identified by the given pointer, so the model must not be changed in between.
+ */
 template<typename ModelType>
 std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
                                                                               std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
-                                                                              storm::storage::BisimulationType type) {
+                                                                              storm::storage::BisimulationType type,
+                                                                              storm::storage::bisimulation::SparsePartitionCache* partitionCache = nullptr) {
+    // Lumping the acyclic states yields the same model each time, so the cached partitions of the lumped model belong to the given model.
+    std::shared_ptr<void const> modelIdentity = model;
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    if (type == storm::storage::BisimulationType::Strong && bisimulationSettings.isLumpAcyclicStatesSet()) {
+        // Lumping the acyclic states first lets the partition refinement operate on the smaller model only.
+        model = storm::storage::lumpAcyclicStates(*model);
+    }
+
     typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options options;
     if (!formulas.empty()) {
         options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
+    auto preservationInformation = initializeFromPartitionCache(partitionCache, modelIdentity, *model, options);
 
     storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
+    if (preservationInformation) {
+        storeInPartitionCache(*partitionCache, modelIdentity, preservationInformation.get(), bisimulationDecomposition, model->getNumberOfStates());
+    }
     return bisimulationDecomposition.getQuotient();
 }
 
+/*!
+ * Computes the bisimulation quotient of the given nondeterministic model.
+ *
+ * @param partitionCache If given, the computation starts from the closest partition of the model in this cache and the resulting
+ * partition is stored in it. Models are identified by the given pointer, so the model must not be changed in between.
+ */
 template<typename ModelType>
 std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
                                                                                  std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
-                                                                                 storm::storage::BisimulationType type) {
+                                                                                 storm::storage::BisimulationType type,
+                                                                                 storm::storage::bisimulation::SparsePartitionCache* partitionCache = nullptr) {
     typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options options;
     if (!formulas.empty()) {
         options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    auto preservationInformation = initializeFromPartitionCache(partitionCache, model, *model, options);
 
     storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
+    if (preservationInformation) {
+        storeInPartitionCache(*partitionCache, model, preservationInformation.get(), bisimulationDecomposition, model->getNumberOfStates());
+    }
     return bisimulationDecomposition.getQuotient();
 }
 
+/*!
+ * Computes the bisimulation quotient of the given model that preserves the given formulas.
+ *
+ * @param partitionCache If given, the partitions are reused across calls for the same model (e.g. for batches of properties), see
+ * storm::storage::bisimulation::PartitionCache.
+ */
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(
     std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
-    storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
+    storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong,
+    storm::storage::bisimulation::SparsePartitionCache* partitionCache = nullptr) {
     STORM_LOG_THROW(
         model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp),
         storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs and MDPs.");
@@ -59,13 +146,13 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMini
 
     if (model->isOfType(storm::models::ModelType::Dtmc)) {
         return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(
-            model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type);
+            model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type, partitionCache);
     } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
         return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(
-            model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type);
+            model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type, partitionCache);
     } else {
         return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(
-            model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type);
+            model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type, partitionCache);
     }
 }
 
@@ -76,7 +163,8 @@ performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<D
                                 std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
                                 storm::storage::BisimulationType const& bisimulationType = storm::storage::BisimulationType::Strong,
                                 storm::dd::bisimulation::SignatureMode const& mode = storm::dd::bisimulation::SignatureMode::Eager,
-                                storm::dd::bisimulation::QuotientFormat const& quotientFormat = storm::dd::bisimulation::QuotientFormat::Dd) {
+                                storm::dd::bisimulation::QuotientFormat const& quotientFormat = storm::dd::bisimulation::QuotientFormat::Dd,
+                                storm::dd::bisimulation::PartitionCache<DdType, ValueType>* partitionCache = nullptr) {
     STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) ||
                         model->isOfType(storm::models::ModelType::Mdp) || model->isOfType(storm::models::ModelType::MarkovAutomaton),
                     storm::exceptions::NotSupportedException, "Symbolic bisimulation minimization is currently only available for DTMCs, CTMCs, MDPs and MAs.");
@@ -88,9 +176,27 @@ performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<D
         // Try to get rid of non state-rewards to easy bisimulation computation.
         model->reduceToStateBasedRewards();
 
-        storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType> decomposition(*model, formulas, bisimulationType);
-        decomposition.compute(mode);
-        result = decomposition.getQuotient(quotientFormat);
+        if (!partitionCache) {
+            storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType> decomposition(*model, formulas, bisimulationType);
+            decomposition.compute(mode);
+            result = decomposition.getQuotient(quotientFormat);
+            return;
+        }
+
+        // Start from the cached partition that preserves the largest part of the required information, if there is any.
+        storm::dd::bisimulation::PreservationInformation<DdType, ValueType> preservationInformation(*model, formulas);
+        auto entry = partitionCache->find(model, preservationInformation);
+        std::unique_ptr<storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType>> decomposition;
+        if (entry) {
+            decomposition = std::make_unique<storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType>>(
+                *model, entry->partition, entry->preservationInformation, preservationInformation);
+        } else {
+            decomposition = std::make_unique<storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType>>(*model, bisimulationType,
+                                                                                                                      preservationInformation);
+        }
+        decomposition->compute(mode);
+        partitionCache->insert(model, preservationInformation, decomposition->getStatePartition().withoutChangedStates());
+        result = decomposition->getQuotient(quotientFormat);
     });
     return result;
 }
@@ -102,7 +208,8 @@ performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<D
                                 std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
                                 storm::storage::BisimulationType const& bisimulationType = storm::storage::BisimulationType::Strong,
                                 storm::dd::bisimulation::SignatureMode const& mode = storm::dd::bisimulation::SignatureMode::Eager,
-                                storm::dd::bisimulation::QuotientFormat const& quotientFormat = storm::dd::bisimulation::QuotientFormat::Dd) {
+                                storm::dd::bisimulation::QuotientFormat const& quotientFormat = storm::dd::bisimulation::QuotientFormat::Dd,
+                                storm::dd::bisimulation::PartitionCache<DdType, ValueType>* partitionCache = nullptr) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
                     "Symbolic bisimulation minimization is not supported for this combination of DD library and value type.");
     return nullptr;
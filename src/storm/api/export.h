@@ -2,15 +2,20 @@
 
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/CheckResultExporter.h"
+#include "storm/io/BinaryModelExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/PackedScheduler.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 
@@ -24,15 +29,36 @@ void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& fi
 
 template<typename ValueType>
 void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename,
-                            std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true) {
+                            std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true, uint64_t numberOfThreads = 1) {
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
     storm::exporter::DirectEncodingOptions options;
     options.allowPlaceholders = allowPlaceholders;
+    options.numberOfThreads = numberOfThreads;
     storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        storm::exporter::exportSparseModelAsBinary(stream, model);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting exact or parametric models in the binary format is not supported.");
+    }
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void exportSymbolicModelAsBinary(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    storm::exporter::exportSymbolicModelAsBinary(stream, model);
+    storm::utility::closeFile(stream);
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
@@ -74,27 +100,64 @@ void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> co
 }
 
 template<typename ValueType>
-inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
-                                    std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
+void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::storage::PackedScheduler const& scheduler,
+                     std::string const& filename) {
     std::ofstream stream;
-    storm::utility::openFile(filename, stream);
+    std::string jsonFileExtension = ".json";
+    std::string binaryFileExtension = ".bin";
+    if (filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
+        storm::utility::openFile(filename, stream);
+        scheduler.printJsonToStream(stream, model, false, true);
+    } else if (filename.size() > 3 && std::equal(binaryFileExtension.rbegin(), binaryFileExtension.rend(), filename.rbegin())) {
+        stream.open(filename, std::ios::out | std::ios::binary);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        scheduler.writeBinaryToStream(stream);
+    } else {
+        storm::utility::openFile(filename, stream);
+        scheduler.template toScheduler<ValueType>().printToStream(stream, model, false, true);
+    }
+    storm::utility::closeFile(stream);
+}
+
+/*!
+ * Exports the given check result to the given file. The format is chosen by the extension of the file ('.json', '.jsonl', '.csv' or '.bin').
+ */
+template<typename ValueType>
+inline void exportCheckResult(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                              std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
+    storm::exporter::CheckResultExportFormat format = storm::exporter::getCheckResultExportFormatFromFileExtension(filename);
+    std::ofstream stream;
+    if (format == storm::exporter::CheckResultExportFormat::Binary) {
+        stream.open(filename, std::ios::out | std::ios::binary);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    } else {
+        storm::utility::openFile(filename, stream);
+    }
+    storm::storage::sparse::StateValuations const* stateValuations = model->hasStateValuations() ? &model->getStateValuations() : nullptr;
+    uint64_t numberOfThreads = storm::utility::getDefaultNumberOfThreads();
     if (checkResult->isExplicitQualitativeCheckResult()) {
-        stream << checkResult->asExplicitQualitativeCheckResult().toJson(model->getOptionalStateValuations(), model->getStateLabeling()).dump(4);
+        storm::exporter::exportCheckResult(stream, checkResult->asExplicitQualitativeCheckResult(), format, stateValuations, &model->getStateLabeling(),
+                                           numberOfThreads);
     } else {
         STORM_LOG_THROW(checkResult->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
                         "Export of check results is only supported for explicit check results (e.g. in the sparse engine)");
-        stream << checkResult->template asExplicitQuantitativeCheckResult<ValueType>()
-                      .toJson(model->getOptionalStateValuations(), model->getStateLabeling())
-                      .dump(4);
+        storm::exporter::exportCheckResult(stream, checkResult->template asExplicitQuantitativeCheckResult<ValueType>(), format, stateValuations,
+                                           &model->getStateLabeling(), numberOfThreads);
     }
     storm::utility::closeFile(stream);
 }
 
 template<>
-inline void exportCheckResultToJson<storm::RationalFunction>(std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const&,
-                                                             std::unique_ptr<storm::modelchecker::CheckResult> const&, std::string const&) {
+inline void exportCheckResult<storm::RationalFunction>(std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const&,
+                                                       std::unique_ptr<storm::modelchecker::CheckResult> const&, std::string const&) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of check results is not supported for rational functions. ");
 }
 
+template<typename ValueType>
+inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                    std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
+    exportCheckResult(model, checkResult, filename);
+}
+
 }  // namespace api
 }  // namespace storm
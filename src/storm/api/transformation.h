@@ -2,12 +2,14 @@
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StatePermuter.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
 namespace api {
@@ -146,5 +148,18 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> transformToNondetermini
     }
 }
 
+/*!
+ * Rearranges the states of the given sparse model in the given order (e.g. to improve the memory locality of the solvers).
+ *
+ * @return The permuted model and, for each of its states, the corresponding state of the given model.
+ */
+template<typename ValueType>
+std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, std::vector<uint64_t>> permuteModelStates(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::utility::permutation::OrderKind order) {
+    auto inversePermutation = storm::utility::permutation::createPermutation(order, model->getTransitionMatrix(), model->getInitialStates());
+    auto permutedModel = storm::transformer::permuteStates(*model, inversePermutation);
+    return std::make_pair(std::move(permutedModel), std::move(inversePermutation));
+}
+
 }  // namespace api
 }  // namespace storm
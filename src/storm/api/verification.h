@@ -1,8 +1,11 @@
 #pragma once
 
 #include <type_traits>
+#include <vector>
 
+#include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
@@ -10,20 +13,26 @@
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/exploration/PartialExplorationModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseBatchedPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseBoundSweepModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/statistical/ImportanceSplittingModelChecker.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/Mdp.h"
 
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Smg.h"
@@ -185,6 +194,108 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with partial exploration
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithPartialExploration(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+    storm::modelchecker::PartialExplorationOptions const& options = storm::modelchecker::PartialExplorationOptions()) {
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::PartialExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model, options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        storm::modelchecker::PartialExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(model, options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << model.getModelType() << " is not supported by partial exploration.");
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithPartialExploration(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&,
+    storm::modelchecker::PartialExplorationOptions const& = storm::modelchecker::PartialExplorationOptions()) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Partial exploration does not support data type.");
+}
+
+//
+// Verifying with statistical model checking engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking without building the model is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The model type " << program.getModelType() << " is not supported by the statistical model checking engine.");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+    if (checker.canHandle(task)) {
+        result = checker.check(env, task);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(*dtmc);
+    if (checker.canHandle(task)) {
+        result = checker.check(env, task);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                              storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithStatisticalEngine(env, model, task);
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithImportanceSplitting(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+    storm::modelchecker::ImportanceSplittingOptions const& options = storm::modelchecker::ImportanceSplittingOptions()) {
+    STORM_LOG_THROW(model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The model type " << model.getModelType() << " is not supported by importance splitting.");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::modelchecker::ImportanceSplittingModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model, options);
+    if (checker.canHandle(task)) {
+        result = checker.check(env, task);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithImportanceSplitting(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&,
+    storm::modelchecker::ImportanceSplittingOptions const& = storm::modelchecker::ImportanceSplittingOptions()) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Importance splitting does not support data type.");
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -352,6 +463,128 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
     return verifyWithSparseEngine(env, model, task);
 }
 
+/*!
+ * Returns true iff the given task can be verified in a batch together with other tasks on the given model, i.e., by solving several properties
+ * with shared value iteration sweeps (see SparseBatchedPrctlModelChecker).
+ */
+template<typename ValueType>
+bool canVerifyInBatchWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                      storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        // Batched value iteration gives neither exact nor sound results.
+        if (env.solver().isForceExact() || env.solver().isForceSoundness()) {
+            return false;
+        }
+        if (model->getType() == storm::models::ModelType::Dtmc) {
+            return storm::modelchecker::SparseBatchedPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>>(
+                       *model->template as<storm::models::sparse::Dtmc<ValueType>>())
+                .canHandle(task);
+        } else if (model->getType() == storm::models::ModelType::Mdp) {
+            return storm::modelchecker::SparseBatchedPrctlModelChecker<storm::models::sparse::Mdp<ValueType>>(
+                       *model->template as<storm::models::sparse::Mdp<ValueType>>())
+                .canHandle(task);
+        }
+    }
+    return false;
+}
+
+/*!
+ * Verifies the given tasks on the given model. Tasks that can be verified in a batch (see canVerifyInBatchWithSparseEngine) are solved together,
+ * all other tasks are verified individually.
+ * @return the results for the tasks (in the same order)
+ */
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(tasks.size());
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> batchedTasks;
+    std::vector<uint64_t> batchedTaskIndices;
+    for (uint64_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+        if (canVerifyInBatchWithSparseEngine(env, model, tasks[taskIndex])) {
+            batchedTasks.push_back(tasks[taskIndex]);
+            batchedTaskIndices.push_back(taskIndex);
+        } else {
+            results[taskIndex] = verifyWithSparseEngine(env, model, tasks[taskIndex]);
+        }
+    }
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (!batchedTasks.empty()) {
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> batchedResults;
+            if (model->getType() == storm::models::ModelType::Dtmc) {
+                storm::modelchecker::SparseBatchedPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(
+                    *model->template as<storm::models::sparse::Dtmc<ValueType>>());
+                batchedResults = modelchecker.check(env, batchedTasks);
+            } else {
+                storm::modelchecker::SparseBatchedPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(
+                    *model->template as<storm::models::sparse::Mdp<ValueType>>());
+                batchedResults = modelchecker.check(env, batchedTasks);
+            }
+            for (uint64_t batchedTaskIndex = 0; batchedTaskIndex < batchedTasks.size(); ++batchedTaskIndex) {
+                results[batchedTaskIndices[batchedTaskIndex]] = std::move(batchedResults[batchedTaskIndex]);
+            }
+        }
+    }
+    return results;
+}
+
+/*!
+ * Returns true iff the given task can be verified for a sequence of upper bounds on the given model (see SparseBoundSweepModelChecker).
+ */
+template<typename ValueType>
+bool canVerifyBoundSweepWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+        if (model->getType() == storm::models::ModelType::Dtmc) {
+            return storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Dtmc<ValueType>>(
+                       *model->template as<storm::models::sparse::Dtmc<ValueType>>())
+                .canHandle(task);
+        } else if (model->getType() == storm::models::ModelType::Mdp) {
+            return storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Mdp<ValueType>>(
+                       *model->template as<storm::models::sparse::Mdp<ValueType>>())
+                .canHandle(task);
+        }
+    }
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (model->getType() == storm::models::ModelType::Ctmc) {
+            return storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Ctmc<ValueType>>(
+                       *model->template as<storm::models::sparse::Ctmc<ValueType>>())
+                .canHandle(task);
+        }
+    }
+    return false;
+}
+
+/*!
+ * Verifies the given task for each of the given upper bounds, which replace the upper bound of the (bounded until) formula of the task.
+ * @return a BoundSweepCheckResult with one result per bound
+ */
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyBoundSweepWithSparseEngine(storm::Environment const& env,
+                                                                                   std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                                   storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                                                                                   std::vector<ValueType> const& upperBounds) {
+    STORM_LOG_THROW(canVerifyBoundSweepWithSparseEngine(model, task), storm::exceptions::NotSupportedException,
+                    "The property " << task.getFormula() << " can not be checked for a sequence of bounds on this model.");
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+        if (model->getType() == storm::models::ModelType::Dtmc) {
+            storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(
+                *model->template as<storm::models::sparse::Dtmc<ValueType>>());
+            return modelchecker.check(env, task, upperBounds);
+        } else if (model->getType() == storm::models::ModelType::Mdp) {
+            storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(
+                *model->template as<storm::models::sparse::Mdp<ValueType>>());
+            return modelchecker.check(env, task, upperBounds);
+        }
+    }
+    if constexpr (std::is_same<ValueType, double>::value) {
+        storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(
+            *model->template as<storm::models::sparse::Ctmc<ValueType>>());
+        return modelchecker.check(env, task, upperBounds);
+    }
+    return nullptr;
+}
+
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(
     storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
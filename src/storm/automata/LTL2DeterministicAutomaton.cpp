@@ -1,18 +1,35 @@
 #include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/automata/AcceptanceCondition.h"
 #include "storm/automata/DeterministicAutomaton.h"
 
+#include "cpphoafparser/ast/atom_acceptance.hh"
+
 #include "storm/exceptions/ExpressionEvaluationException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/file.h"
+#include "storm/logic/AtomicLabelFormula.h"
 #include "storm/logic/Formula.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
 
 #ifdef STORM_HAVE_SPOT
 #include "spot/tl/formula.hh"
 #include "spot/tl/parse.hh"
-#include "spot/twaalgos/hoa.hh"
+#include "spot/twa/twagraph.hh"
 #include "spot/twaalgos/totgba.hh"
 #include "spot/twaalgos/translate.hh"
 #endif
@@ -20,9 +37,250 @@
 namespace storm {
 namespace automata {
 
+namespace {
+
+/*!
+ * Creates a copy of the given automaton in which the atomic propositions are renamed. The indices of the atomic propositions, and hence the letters, are
+ * kept, so the transitions can be copied directly.
+ */
+std::shared_ptr<DeterministicAutomaton> renameAtomicPropositions(DeterministicAutomaton const& da, std::map<std::string, std::string> const& renaming) {
+    APSet apSet;
+    for (auto const& ap : da.getAPSet().getAPs()) {
+        auto renamingIt = renaming.find(ap);
+        apSet.add(renamingIt == renaming.end() ? ap : renamingIt->second);
+    }
+    auto result = std::make_shared<DeterministicAutomaton>(apSet, da.getNumberOfStates(), da.getInitialState(), da.getAcceptance());
+    for (std::size_t state = 0; state < da.getNumberOfStates(); ++state) {
+        for (APSet::alphabet_element letter = 0; letter < da.getNumberOfEdgesPerState(); ++letter) {
+            result->setSuccessor(state, letter, da.getSuccessor(state, letter));
+        }
+    }
+    return result;
+}
+
+/*!
+ * An LTL formula in which the atomic propositions are renamed in the order of their first occurrence, which identifies the translation in the
+ * caches.
+ */
+struct NormalizedFormula {
+    std::shared_ptr<storm::logic::Formula> formula;
+    std::string key;
+    std::map<std::string, std::string> fromNormalized;
+};
+
+NormalizedFormula normalize(storm::logic::Formula const& f, bool dnf, boost::optional<std::string> const& ltl2daTool) {
+    NormalizedFormula result;
+    std::map<std::string, std::string> toNormalized;
+    for (auto const& atomicLabelFormula : f.getAtomicLabelFormulas()) {
+        if (toNormalized.count(atomicLabelFormula->getLabel()) == 0) {
+            std::string normalizedLabel = "ap" + std::to_string(toNormalized.size());
+            toNormalized.emplace(atomicLabelFormula->getLabel(), normalizedLabel);
+            result.fromNormalized.emplace(normalizedLabel, atomicLabelFormula->getLabel());
+        }
+    }
+    result.formula = f.substitute(toNormalized);
+    result.key = (ltl2daTool ? "tool " + ltl2daTool.get() : std::string(dnf ? "spot-dnf" : "spot")) + " " + result.formula->toPrefixString();
+    return result;
+}
+
+#ifdef STORM_HAVE_SPOT
+// Spot (and its BDD library) is not thread-safe, so it is only used by one thread at a time.
+std::mutex spotMutex;
+
+/*!
+ * Converts the subcode of the given acceptance code whose operator is at the given position. The code is stored in postfix order, i.e., the
+ * operands of an operator precede it and the operator stores the total size of its operands.
+ */
+AcceptanceCondition::acceptance_expr::ptr convertAcceptance(spot::acc_cond::acc_code const& code, unsigned position) {
+    typedef AcceptanceCondition::acceptance_expr acceptance_expr;
+    auto const& word = code[position];
+    switch (word.sub.op) {
+        case spot::acc_cond::acc_op::Inf:
+        case spot::acc_cond::acc_op::InfNeg:
+        case spot::acc_cond::acc_op::Fin:
+        case spot::acc_cond::acc_op::FinNeg: {
+            // Inf requires all of the given sets to be visited infinitely often whereas Fin requires one of them to be visited finitely often.
+            bool const inf = word.sub.op == spot::acc_cond::acc_op::Inf || word.sub.op == spot::acc_cond::acc_op::InfNeg;
+            bool const negated = word.sub.op == spot::acc_cond::acc_op::InfNeg || word.sub.op == spot::acc_cond::acc_op::FinNeg;
+            acceptance_expr::ptr result;
+            for (unsigned set : code[position - 1].mark.sets()) {
+                auto atom = acceptance_expr::Atom(inf ? (negated ? cpphoafparser::AtomAcceptance::InfNot(set) : cpphoafparser::AtomAcceptance::Inf(set))
+                                                      : (negated ? cpphoafparser::AtomAcceptance::FinNot(set) : cpphoafparser::AtomAcceptance::Fin(set)));
+                result = !result ? atom : (inf ? result & atom : result | atom);
+            }
+            return result ? result : (inf ? acceptance_expr::True() : acceptance_expr::False());
+        }
+        case spot::acc_cond::acc_op::And:
+        case spot::acc_cond::acc_op::Or: {
+            bool const conjunction = word.sub.op == spot::acc_cond::acc_op::And;
+            acceptance_expr::ptr result;
+            unsigned const firstPosition = position - word.sub.size;
+            while (position > firstPosition) {
+                --position;
+                auto operand = convertAcceptance(code, position);
+                result = !result ? operand : (conjunction ? result & operand : result | operand);
+                position -= code[position].sub.size;
+            }
+            return result ? result : (conjunction ? acceptance_expr::True() : acceptance_expr::False());
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown operator in acceptance condition of Spot automaton.");
+}
+
+/*!
+ * Converts the given deterministic and complete automaton with state-based acceptance into a DeterministicAutomaton.
+ */
+std::shared_ptr<DeterministicAutomaton> convertSpotAutomaton(spot::twa_graph_ptr const& aut) {
+    APSet apSet;
+    for (spot::formula const& ap : aut->ap()) {
+        apSet.add(ap.ap_name());
+    }
+
+    spot::acc_cond::acc_code const& code = aut->get_acceptance();
+    AcceptanceCondition::acceptance_expr::ptr acceptanceExpression =
+        code.empty() ? AcceptanceCondition::acceptance_expr::True() : convertAcceptance(code, code.size() - 1);
+    auto acceptance = std::make_shared<AcceptanceCondition>(aut->num_states(), aut->num_sets(), acceptanceExpression);
+    auto da = std::make_shared<DeterministicAutomaton>(apSet, aut->num_states(), aut->get_init_state_number(), acceptance);
+
+    // The i-th bit of a letter is set iff the i-th atomic proposition holds.
+    std::vector<bdd> letters(apSet.alphabetSize(), bddtrue);
+    for (unsigned ap = 0; ap < apSet.size(); ++ap) {
+        int variable = aut->get_dict()->varnum(aut->ap()[ap]);
+        for (APSet::alphabet_element letter = 0; letter < letters.size(); ++letter) {
+            letters[letter] &= (letter & apSet.elementAddAP(apSet.elementAllFalse(), ap)) ? bdd_ithvar(variable) : bdd_nithvar(variable);
+        }
+    }
+
+    for (unsigned state = 0; state < aut->num_states(); ++state) {
+        // The acceptance is state-based if all outgoing edges of a state belong to the same acceptance sets.
+        boost::optional<spot::acc_cond::mark_t> stateMarks;
+        storm::storage::BitVector seenLetters(letters.size());
+        for (auto const& edge : aut->out(state)) {
+            STORM_LOG_THROW(!stateMarks || stateMarks.get() == edge.acc, storm::exceptions::NotSupportedException,
+                            "Spot automaton does not have state-based acceptance.");
+            stateMarks = edge.acc;
+            for (APSet::alphabet_element letter = 0; letter < letters.size(); ++letter) {
+                if ((edge.cond & letters[letter]) != bddfalse) {
+                    STORM_LOG_THROW(!seenLetters.get(letter), storm::exceptions::NotSupportedException, "Spot automaton is not deterministic.");
+                    seenLetters.set(letter);
+                    da->setSuccessor(state, letter, edge.dst);
+                }
+            }
+        }
+        STORM_LOG_THROW(seenLetters.full(), storm::exceptions::NotSupportedException, "Spot automaton is not complete.");
+        for (unsigned set : stateMarks.get().sets()) {
+            acceptance->getAcceptanceSet(set).set(state);
+        }
+    }
+    return da;
+}
+#endif
+
+/*!
+ * Computes a hash of the given key that is stable across runs and platforms (FNV-1a) and can therefore be used as a file name.
+ */
+std::string getCacheFileName(std::string const& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    std::stringstream stream;
+    stream << "da-" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+}  // namespace
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2da(storm::logic::Formula const& f, bool dnf,
+                                                                           boost::optional<std::string> const& ltl2daTool,
+                                                                           boost::optional<std::string> const& cacheDirectory) {
+    // Rename the atomic propositions in the order of their first occurrence.
+    NormalizedFormula normalized = normalize(f, dnf, ltl2daTool);
+    std::string const& key = normalized.key;
+
+    // The automata in the in-memory cache are never modified, so they can be shared.
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::shared_ptr<DeterministicAutomaton>> cache;
+    std::shared_ptr<DeterministicAutomaton> normalizedDa;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto cacheIt = cache.find(key);
+        if (cacheIt != cache.end()) {
+            normalizedDa = cacheIt->second;
+        }
+    }
+
+    std::string cacheFileBase = cacheDirectory ? cacheDirectory.get() + "/" + getCacheFileName(key) : "";
+    if (!normalizedDa && cacheDirectory && storm::io::fileExistsAndIsReadable(cacheFileBase + ".key")) {
+        // The key is stored next to the automaton to detect hash collisions.
+        std::ifstream keyStream;
+        storm::io::openFile(cacheFileBase + ".key", keyStream);
+        std::string storedKey;
+        storm::io::getline(keyStream, storedKey);
+        storm::io::closeFile(keyStream);
+        if (storedKey == key && storm::io::fileExistsAndIsReadable(cacheFileBase + ".hoa")) {
+            STORM_LOG_INFO("Reading cached automaton for " << key << " from " << cacheFileBase << ".hoa");
+            normalizedDa = DeterministicAutomaton::parseFromFile(cacheFileBase + ".hoa");
+        }
+    }
+
+    if (!normalizedDa) {
+        normalizedDa = ltl2daTool ? ltl2daExternalTool(*normalized.formula, ltl2daTool.get()) : ltl2daSpot(*normalized.formula, dnf);
+        if (cacheDirectory) {
+            std::ofstream hoaStream;
+            storm::io::openFile(cacheFileBase + ".hoa", hoaStream);
+            normalizedDa->printHOA(hoaStream);
+            storm::io::closeFile(hoaStream);
+            // Write the key last so that an incomplete automaton file is never used.
+            std::ofstream keyStream;
+            storm::io::openFile(cacheFileBase + ".key", keyStream);
+            keyStream << key << '\n';
+            storm::io::closeFile(keyStream);
+        }
+    } else {
+        STORM_LOG_INFO("Reusing cached automaton for " << key << ".");
+    }
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cache.emplace(key, normalizedDa);
+    }
+
+    return renameAtomicPropositions(*normalizedDa, normalized.fromNormalized);
+}
+
+std::vector<std::shared_ptr<DeterministicAutomaton>> LTL2DeterministicAutomaton::ltl2da(
+    std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, bool dnf, boost::optional<std::string> const& ltl2daTool,
+    boost::optional<std::string> const& cacheDirectory, uint64_t numberOfThreads) {
+    // Formulas with the same translation are translated once (concurrently with the other translations) and then taken from the cache.
+    std::vector<uint64_t> translatedFormulas, remainingFormulas;
+    std::set<std::string> keys;
+    for (uint64_t index = 0; index < formulas.size(); ++index) {
+        if (keys.insert(normalize(*formulas[index], dnf, ltl2daTool).key).second) {
+            translatedFormulas.push_back(index);
+        } else {
+            remainingFormulas.push_back(index);
+        }
+    }
+
+    std::vector<std::shared_ptr<DeterministicAutomaton>> result(formulas.size());
+    storm::utility::forEachChunk(numberOfThreads == 0 ? storm::utility::getDefaultNumberOfThreads() : numberOfThreads, translatedFormulas.size(), 1,
+                                 [&](uint64_t, uint64_t begin, uint64_t end) {
+                                     for (uint64_t position = begin; position < end; ++position) {
+                                         uint64_t index = translatedFormulas[position];
+                                         result[index] = ltl2da(*formulas[index], dnf, ltl2daTool, cacheDirectory);
+                                     }
+                                 });
+    for (auto index : remainingFormulas) {
+        result[index] = ltl2da(*formulas[index], dnf, ltl2daTool, cacheDirectory);
+    }
+    return result;
+}
+
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
 #ifdef STORM_HAVE_SPOT
     std::string prefixLtl = f.toPrefixString();
+    std::lock_guard<std::mutex> lock(spotMutex);
 
     spot::parsed_formula spotPrefixLtl = spot::parse_prefix_ltl(prefixLtl);
     if (!spotPrefixLtl.errors.empty()) {
@@ -47,15 +305,8 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
 
     STORM_LOG_INFO("The deterministic automaton has acceptance condition:  " << aut->get_acceptance());
 
-    STORM_LOG_INFO(aut->get_acceptance());
-
-    std::stringstream autStream;
-    // Print reachable states in HOA format, implicit edges (i), state-based acceptance (s)
-    spot::print_hoa(autStream, aut, "is");
-
-    storm::automata::DeterministicAutomaton::ptr da = DeterministicAutomaton::parse(autStream);
-
-    return da;
+    // Convert the automaton directly, i.e., without printing and parsing it in HOA format.
+    return convertSpotAutomaton(aut);
 
 #else
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Spot support.");
@@ -65,7 +316,12 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
     std::string prefixLtl = f.toPrefixString();
 
-    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' da.hoa");
+    // Every translation uses its own output file, so that several translations can run concurrently.
+    static std::atomic<uint64_t> numberOfTranslations(0);
+    std::string automatonFile = (std::filesystem::temp_directory_path() /
+                                 ("storm-da-" + std::to_string(getpid()) + "-" + std::to_string(numberOfTranslations++) + ".hoa"))
+                                    .string();
+    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' " << automatonFile);
 
     pid_t pid;
 
@@ -74,7 +330,7 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
 
     if (pid == 0) {
         // we are in the child process
-        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), "da.hoa", NULL) < 0) {
+        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), automatonFile.c_str(), NULL) < 0) {
             std::cerr << "ERROR: exec failed: " << strerror(errno) << '\n';
             std::exit(1);
         }
@@ -83,8 +339,8 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     } else {  // in the parent
         int status;
 
-        // wait for completion
-        while (wait(&status) != pid)
+        // wait for completion (of this child only, as other threads may run translations as well)
+        while (waitpid(pid, &status, 0) != pid)
             ;
 
         int rv;
@@ -96,9 +352,11 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
         STORM_LOG_THROW(rv == 0, storm::exceptions::FileIoException,
                         "Could not construct deterministic automaton for " << prefixLtl << ", return code = " << rv);
 
-        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from da.hoa");
+        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from " << automatonFile);
 
-        return DeterministicAutomaton::parseFromFile("da.hoa");
+        DeterministicAutomaton::ptr da = DeterministicAutomaton::parseFromFile(automatonFile);
+        std::remove(automatonFile.c_str());
+        return da;
     }
 }
 
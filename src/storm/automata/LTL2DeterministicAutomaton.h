@@ -1,6 +1,10 @@
 #pragma
 
+#include <boost/optional.hpp>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace storm {
 
@@ -17,7 +21,8 @@ class LTL2DeterministicAutomaton {
    public:
     /*!
      * Converts an LTL formula into a deterministic omega-automaton using the internal LTL2DA tool "Spot".
-     * The resulting DA uses transition-based acceptance and if specified the acceptance condition is converted to DNF.
+     * The resulting DA uses state-based acceptance and if specified the acceptance condition is converted to DNF. The automaton is converted
+     * in-process, i.e., without printing and parsing it in HOA format.
      *
      * @param f The LTL formula.
      * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF.
@@ -35,6 +40,35 @@ class LTL2DeterministicAutomaton {
      * @return An automaton equivalent to the formula.
      */
     static std::shared_ptr<DeterministicAutomaton> ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool);
+
+    /*!
+     * Converts an LTL formula into a deterministic omega-automaton using the given external LTL2DA tool or, if no tool is given, Spot.
+     * Translations are cached for the formula in which the atomic propositions are renamed in the order of their first occurrence. Hence, formulas that
+     * only differ in the names of their atomic propositions are translated only once and the cached automaton is returned for the original atomic
+     * propositions. If a cache directory is given, the automata are additionally stored there in HOA format and are reused across runs.
+     *
+     * @param f The LTL formula.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only relevant for Spot).
+     * @param ltl2daTool The external tool (if any).
+     * @param cacheDirectory The (existing) directory of the persistent cache (if any).
+     * @return An automaton equivalent to the formula.
+     */
+    static std::shared_ptr<DeterministicAutomaton> ltl2da(storm::logic::Formula const& f, bool dnf,
+                                                          boost::optional<std::string> const& ltl2daTool = boost::none,
+                                                          boost::optional<std::string> const& cacheDirectory = boost::none);
+
+    /*!
+     * Converts the given LTL formulas into deterministic omega-automata (see above). The translations run concurrently and formulas that only
+     * differ in the names of their atomic propositions are translated only once. As Spot is not thread-safe, its translations are serialized,
+     * whereas translations with an external tool run in parallel.
+     *
+     * @param numberOfThreads The number of threads. Zero means that the default number of threads is used.
+     * @return For each formula, an automaton equivalent to the formula.
+     */
+    static std::vector<std::shared_ptr<DeterministicAutomaton>> ltl2da(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, bool dnf,
+                                                                       boost::optional<std::string> const& ltl2daTool = boost::none,
+                                                                       boost::optional<std::string> const& cacheDirectory = boost::none,
+                                                                       uint64_t numberOfThreads = 0);
 };
 
 }  // namespace automata
@@ -118,6 +118,9 @@ class BuilderOptions {
     bool isShowProgressSet() const;
     bool isScaleAndLiftTransitionRewardsSet() const;
     bool isAddOutOfBoundsStateSet() const;
+    bool isCompileExpressionsSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isPartialOrderReductionSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
     uint64_t getShowProgressDelay() const;
@@ -200,6 +203,27 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOutOfBoundsState(bool newValue = true);
 
+    /**
+     * Should guards and updates be compiled into code that operates directly on the state encoding (if supported by the generator)
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setCompileExpressions(bool newValue = true);
+
+    /**
+     * Should symmetric modules be detected and only one representative of each orbit of symmetric states be explored (if supported by the generator)
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should interleavings of independent, invisible edges be pruned by ample sets (if supported by the generator)
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
     /**
      * Should a state be labelled for overlapping guards
      * @param newValue the new value (default true)
@@ -268,6 +292,15 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating that guards and updates are to be compiled.
+    bool compileExpressions;
+
+    /// A flag indicating that the state space is to be reduced by symmetries between modules.
+    bool symmetryReduction;
+
+    /// A flag indicating that the state space is to be reduced by a partial-order reduction.
+    bool partialOrderReduction;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
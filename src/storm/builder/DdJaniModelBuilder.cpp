@@ -108,20 +108,28 @@ DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool
       buildAllRewardModels(buildAllRewardModels),
       applyMaximumProgressAssumption(applyMaximumProgressAssumption),
       rewardModelsToBuild(),
-      constantDefinitions() {
+      constantDefinitions(),
+      useChainingReachability(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdChainingReachabilitySet()) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      constantDefinitions(),
+      useChainingReachability(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdChainingReachabilitySet()) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllLabels(false),
+      buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      constantDefinitions(),
+      useChainingReachability(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdChainingReachabilitySet()) {
     if (!formulas.empty()) {
         for (auto const& formula : formulas) {
             this->preserveFormula(*formula);
@@ -539,6 +547,9 @@ struct ComposerResult {
     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
     storm::dd::Bdd<Type> illegalFragment;
     uint64_t numberOfNondeterminismVariables;
+
+    // The transitions of the individual actions (only filled if requested from the composer).
+    std::vector<storm::dd::Bdd<Type>> transitionPartitions;
 };
 
 // A class that is responsible for performing the actual composition. This
@@ -945,15 +956,18 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
 
     CombinedEdgesSystemComposer(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation,
                                 CompositionVariables<Type, ValueType> const& variables, std::vector<storm::expressions::Variable> const& transientVariables,
-                                bool applyMaximumProgress)
+                                bool applyMaximumProgress, bool collectTransitionPartitions = false)
         : SystemComposer<Type, ValueType>(model, variables, transientVariables),
           actionInformation(actionInformation),
-          applyMaximumProgress(applyMaximumProgress) {
+          applyMaximumProgress(applyMaximumProgress),
+          collectTransitionPartitions(collectTransitionPartitions) {
         // Intentionally left empty.
     }
 
     storm::jani::CompositionInformation const& actionInformation;
     bool applyMaximumProgress;
+    // If set, the transitions of the individual actions are stored in the result of the composition.
+    bool collectTransitionPartitions;
 
     ComposerResult<Type, ValueType> compose() override {
         STORM_LOG_THROW(this->model.hasStandardCompliantComposition(), storm::exceptions::WrongFormatException,
@@ -1629,14 +1643,25 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
     }
 
     ActionDd buildActionDdForActionInstantiation(storm::jani::Automaton const& automaton, ActionInstantiation const& instantiation) {
-        // Translate the individual edges.
-        std::vector<EdgeDd> edgeDds;
+        // Translate the individual edges. As they are independent of each other, they are translated in parallel.
+        std::vector<storm::jani::Edge const*> relevantEdges;
         for (auto const& edge : automaton.getEdges()) {
             if (edge.getActionIndex() == instantiation.actionIndex && edge.hasRate() == instantiation.isMarkovian()) {
-                EdgeDd result = buildEdgeDd(automaton, edge);
-                edgeDds.emplace_back(result);
+                relevantEdges.push_back(&edge);
             }
         }
+        std::vector<boost::optional<EdgeDd>> translatedEdgeDds(relevantEdges.size());
+        std::vector<std::function<void()>> translations;
+        for (uint64_t edgeIndex = 0; edgeIndex < relevantEdges.size(); ++edgeIndex) {
+            translations.emplace_back([this, &automaton, &relevantEdges, &translatedEdgeDds, edgeIndex]() {
+                translatedEdgeDds[edgeIndex] = buildEdgeDd(automaton, *relevantEdges[edgeIndex]);
+            });
+        }
+        storm::utility::dd::executeInParallel<Type, ValueType>(*this->variables.manager, translations);
+        std::vector<EdgeDd> edgeDds;
+        for (auto& edgeDd : translatedEdgeDds) {
+            edgeDds.emplace_back(std::move(edgeDd.get()));
+        }
 
         // Now combine the edges to a single action.
         uint64_t localNondeterminismVariableOffset = instantiation.localNondeterminismVariableOffset;
@@ -1931,6 +1956,32 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
         storm::dd::Bdd<Type> nonMarkovianActionGuards = this->variables.manager->getBddZero();
 
         storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+
+        // Build the DDs of all action instantiations. As they are independent of each other, they are built in parallel.
+        std::vector<ActionInstantiation const*> relevantInstantiations;
+        for (auto const& actionInstantiation : actionInstantiations) {
+            if (automaton.hasEdgeLabeledWithActionIndex(actionInstantiation.first)) {
+                for (auto const& instantiation : actionInstantiation.second) {
+                    relevantInstantiations.push_back(&instantiation);
+                }
+            }
+        }
+        std::vector<ActionDd> actionDds(relevantInstantiations.size());
+        std::vector<std::function<void()>> translations;
+        for (uint64_t instantiationIndex = 0; instantiationIndex < relevantInstantiations.size(); ++instantiationIndex) {
+            translations.emplace_back([this, &automaton, &relevantInstantiations, &actionDds, instantiationIndex]() {
+                ActionInstantiation const& instantiation = *relevantInstantiations[instantiationIndex];
+                uint64_t actionIndex = instantiation.actionIndex;
+                STORM_LOG_TRACE("Building " << (instantiation.isMarkovian() ? "(Markovian) " : "")
+                                            << (actionInformation.getActionName(actionIndex).empty() ? "silent " : "") << "action "
+                                            << (actionInformation.getActionName(actionIndex).empty() ? "" : actionInformation.getActionName(actionIndex) + " ")
+                                            << "from offset " << instantiation.localNondeterminismVariableOffset << ".");
+                actionDds[instantiationIndex] = buildActionDdForActionInstantiation(automaton, instantiation);
+            });
+        }
+        storm::utility::dd::executeInParallel<Type, ValueType>(*this->variables.manager, translations);
+
+        auto actionDdIt = actionDds.begin();
         for (auto const& actionInstantiation : actionInstantiations) {
             uint64_t actionIndex = actionInstantiation.first;
             if (!automaton.hasEdgeLabeledWithActionIndex(actionIndex)) {
@@ -1941,11 +1992,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 inputEnabled = true;
             }
             for (auto const& instantiation : actionInstantiation.second) {
-                STORM_LOG_TRACE("Building " << (instantiation.isMarkovian() ? "(Markovian) " : "")
-                                            << (actionInformation.getActionName(actionIndex).empty() ? "silent " : "") << "action "
-                                            << (actionInformation.getActionName(actionIndex).empty() ? "" : actionInformation.getActionName(actionIndex) + " ")
-                                            << "from offset " << instantiation.localNondeterminismVariableOffset << ".");
-                ActionDd actionDd = buildActionDdForActionInstantiation(automaton, instantiation);
+                ActionDd& actionDd = *actionDdIt++;
                 if (inputEnabled) {
                     actionDd.setIsInputEnabled();
                 }
@@ -2020,6 +2067,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
 
             // Add missing global variable identities, action and nondeterminism encodings.
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
             std::unordered_set<ActionIdentification, ActionIdentificationHash> containedActions;
             for (auto& action : automaton.actions) {
                 STORM_LOG_TRACE("Treating action with index " << action.first.actionIndex << (action.first.isMarkovian() ? " (Markovian)" : "") << ".");
@@ -2046,17 +2094,23 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                                                 actionEncoding * missingNondeterminismEncoding * transientAssignment.second);
                 }
 
+                if (collectTransitionPartitions) {
+                    transitionPartitions.push_back(extendedTransitions.notZero());
+                }
                 result += extendedTransitions;
             }
 
-            return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment,
-                                                   numberOfUsedNondeterminismVariables);
+            ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment,
+                                                           numberOfUsedNondeterminismVariables);
+            composerResult.transitionPartitions = std::move(transitionPartitions);
+            return composerResult;
         } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
             // Simply add all actions, but make sure to include the missing global variable identities.
 
             storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
             storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
             std::unordered_set<uint64_t> actionIndices;
             for (auto& action : automaton.actions) {
                 STORM_LOG_THROW(actionIndices.find(action.first.actionIndex) == actionIndices.end(), storm::exceptions::WrongFormatException,
@@ -2065,10 +2119,15 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 illegalFragment |= action.second.illegalFragment;
                 addMissingGlobalVariableIdentities(action.second);
                 addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
+                if (collectTransitionPartitions) {
+                    transitionPartitions.push_back(action.second.transitions.notZero());
+                }
                 result += action.second.transitions;
             }
 
-            return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+            ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+            composerResult.transitionPartitions = std::move(transitionPartitions);
+            return composerResult;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
         }
@@ -2352,7 +2411,8 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
 
     // Create a builder to compose and build the model.
     bool applyMaximumProgress = options.applyMaximumProgressAssumption && model.getModelType() == storm::jani::ModelType::MA;
-    CombinedEdgesSystemComposer<Type, ValueType> composer(model, actionInformation, variables, rewardVariables, applyMaximumProgress);
+    CombinedEdgesSystemComposer<Type, ValueType> composer(model, actionInformation, variables, rewardVariables, applyMaximumProgress,
+                                                          options.useChainingReachability);
     ComposerResult<Type, ValueType> system = composer.compose();
 
     // Postprocess the variables in place.
@@ -2379,9 +2439,24 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
         model.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    if (options.useChainingReachability) {
+        // The partitions need to be treated in the same way as the full transition relation.
+        for (auto& partition : system.transitionPartitions) {
+            partition &= !terminalStates;
+            if (model.getModelType() == storm::jani::ModelType::MDP || model.getModelType() == storm::jani::ModelType::LTS ||
+                model.getModelType() == storm::jani::ModelType::MA) {
+                partition = partition.existsAbstract(variables.allNondeterminismVariables);
+            }
+        }
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStatesByChaining(modelComponents.initialStates, system.transitionPartitions,
+                                                                                               variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+        system.transitionPartitions.clear();
+    } else {
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    }
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -117,6 +117,9 @@ class DdJaniModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // If set, the reachable states are computed by chaining over the transitions of the individual actions.
+        bool useChainingReachability;
     };
 
     /*!
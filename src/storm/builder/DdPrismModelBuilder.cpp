@@ -93,7 +93,8 @@ class ParameterCreator<Type, storm::RationalFunction> {
 template<storm::dd::DdType Type, typename ValueType>
 class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    public:
-    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager)
+    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager,
+                          storm::builder::DdVariableOrdering variableOrdering = storm::builder::DdVariableOrdering::Program)
         : program(program),
           manager(manager),
           rowMetaVariables(),
@@ -108,7 +109,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
           moduleToIdentityMap(),
           parameters() {
         // Initializes variables and identity DDs.
-        createMetaVariablesAndIdentities();
+        createMetaVariablesAndIdentities(variableOrdering);
 
         // Initialize the parameters (if any).
         ParameterCreator<Type, ValueType> parameterCreator;
@@ -164,11 +165,19 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
     // The parameters appearing in the model.
     std::set<storm::RationalFunctionVariable> parameters;
 
+    // If set, the transitions of the individual actions of the system are collected in the transition partitions.
+    bool collectTransitionPartitions = false;
+
+    // The transitions of the individual actions of the system (only filled if requested).
+    std::vector<storm::dd::Bdd<Type>> transitionPartitions;
+
    private:
     /*!
      * Creates the required meta variables and variable/module identities.
+     *
+     * @param variableOrdering The strategy used to order the meta variables of the program variables.
      */
-    void createMetaVariablesAndIdentities() {
+    void createMetaVariablesAndIdentities(storm::builder::DdVariableOrdering variableOrdering) {
         // Add synchronization variables.
         for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
             std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -188,93 +197,61 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Create the meta variables for all program variables in the requested order.
+        std::map<storm::expressions::Variable, storm::prism::IntegerVariable const*> integerVariables;
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-
-            STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
+            integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
+            }
+        }
+        std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToIdentityBdd;
+        for (storm::expressions::Variable const& variable : storm::builder::computeDdVariableOrder(program, variableOrdering)) {
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+            auto integerVariableIt = integerVariables.find(variable);
+            if (integerVariableIt != integerVariables.end()) {
+                int_fast64_t low = integerVariableIt->second->getLowerBoundExpression().evaluateAsInt();
+                int_fast64_t high = integerVariableIt->second->getUpperBoundExpression().evaluateAsInt();
+                variablePair = manager->addMetaVariable(variable.getName(), low, high);
+            } else {
+                variablePair = manager->addMetaVariable(variable.getName());
+            }
+            STORM_LOG_TRACE("Created meta variables for variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and "
+                                                                    << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
 
             rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
+            variableToRowMetaVariableMap->emplace(variable, variablePair.first);
 
             columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
+            variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
 
             storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+            variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
+            variableToIdentityBdd.emplace(variable, variableIdentity);
             rowColumnMetaVariablePairs.push_back(variablePair);
+        }
 
+        for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-
-            STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-
-            rowColumnMetaVariablePairs.push_back(variablePair);
             allGlobalVariables.insert(booleanVariable.getExpressionVariable());
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Create the identities and ranges of the modules.
         for (storm::prism::Module const& module : program.getModules()) {
             storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
 
             for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
-                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleIdentity &= variableToIdentityBdd.at(integerVariable.getExpressionVariable());
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(integerVariable.getExpressionVariable()));
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleIdentity &= variableToIdentityBdd.at(booleanVariable.getExpressionVariable());
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(booleanVariable.getExpressionVariable()));
             }
             moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
             moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -406,12 +383,19 @@ class ModuleComposer : public storm::prism::CompositionVisitor {
     }
 
     virtual boost::any visit(storm::prism::InterleavingParallelComposition const& composition, boost::any const& data) override {
-        // First, we translate the subcompositions.
-        typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left =
-            boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getLeftSubcomposition().accept(*this, data));
-
-        typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right =
-            boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(composition.getRightSubcomposition().accept(*this, data));
+        // First, we translate the subcompositions. As they do not influence each other, this is done in parallel.
+        typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram left;
+        typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram right;
+        storm::utility::dd::executeInParallel<Type, ValueType>(
+            *generationInfo.manager,
+            {[&]() {
+                 left = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(
+                     composition.getLeftSubcomposition().accept(*this, data));
+             },
+             [&]() {
+                 right = boost::any_cast<typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram>(
+                     composition.getRightSubcomposition().accept(*this, data));
+             }});
 
         // Finally, we compose the subcompositions to create the result.
         composeInParallel(left, right, std::set<uint_fast64_t>());
@@ -605,20 +589,39 @@ bool DdPrismModelBuilder<Type, ValueType>::canHandle(storm::prism::Program const
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options()
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      buildAllLabels(false),
+      labelsToBuild(),
+      terminalStates(),
+      variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()),
+      reorderAtPhaseBoundaries(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdReorderAtPhaseBoundariesSet()),
+      useChainingReachability(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdChainingReachabilitySet()) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()) {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      buildAllLabels(false),
+      labelsToBuild(std::set<std::string>()),
+      variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()),
+      reorderAtPhaseBoundaries(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdReorderAtPhaseBoundariesSet()),
+      useChainingReachability(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdChainingReachabilitySet()) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      buildAllLabels(false),
+      labelsToBuild(),
+      variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()),
+      reorderAtPhaseBoundaries(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdReorderAtPhaseBoundariesSet()),
+      useChainingReachability(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdChainingReachabilitySet()) {
     for (auto const& formula : formulas) {
         this->preserveFormula(*formula);
     }
@@ -732,7 +735,7 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
     GenerationInformation& generationInfo, storm::prism::Module const& module, storm::prism::Command const& command) {
     STORM_LOG_TRACE("Translating guard " << command.getGuardExpression());
     storm::dd::Bdd<Type> guard = generationInfo.rowExpressionAdapter->translateBooleanExpression(command.getGuardExpression()) &&
-                                 generationInfo.moduleToRangeMap[module.getName()].notZero();
+                                 generationInfo.moduleToRangeMap.at(module.getName()).notZero();
     STORM_LOG_WARN_COND(!guard.isZero(), "The guard '" << command.getGuardExpression() << "' is unsatisfiable.");
 
     if (!guard.isZero()) {
@@ -788,21 +791,27 @@ template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createActionDecisionDiagram(
     GenerationInformation& generationInfo, storm::prism::Module const& module, uint_fast64_t synchronizationActionIndex,
     uint_fast64_t nondeterminismVariableOffset) {
-    std::vector<ActionDecisionDiagram> commandDds;
+    std::vector<storm::prism::Command const*> relevantCommands;
     for (storm::prism::Command const& command : module.getCommands()) {
         // Determine whether the command is relevant for the selected action.
         bool relevant = (synchronizationActionIndex == 0 && !command.isLabeled()) ||
                         (synchronizationActionIndex && command.isLabeled() && command.getActionIndex() == synchronizationActionIndex);
 
-        if (!relevant) {
-            continue;
+        if (relevant) {
+            relevantCommands.push_back(&command);
         }
+    }
 
-        STORM_LOG_TRACE("Translating command " << command);
-
-        // At this point, the command is known to be relevant for the action.
-        commandDds.push_back(createCommandDecisionDiagram(generationInfo, module, command));
+    // The commands are translated independently of each other, so we translate them in parallel.
+    std::vector<ActionDecisionDiagram> commandDds(relevantCommands.size());
+    std::vector<std::function<void()>> translations;
+    for (uint_fast64_t commandIndex = 0; commandIndex < relevantCommands.size(); ++commandIndex) {
+        translations.emplace_back([&, commandIndex]() {
+            STORM_LOG_TRACE("Translating command " << *relevantCommands[commandIndex]);
+            commandDds[commandIndex] = createCommandDecisionDiagram(generationInfo, module, *relevantCommands[commandIndex]);
+        });
     }
+    storm::utility::dd::executeInParallel<Type, ValueType>(*generationInfo.manager, translations);
 
     ActionDecisionDiagram result(*generationInfo.manager);
     if (!commandDds.empty()) {
@@ -1092,17 +1101,32 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
 template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createModuleDecisionDiagram(
     GenerationInformation& generationInfo, storm::prism::Module const& module, std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap) {
-    // Start by creating the action DD for the independent action.
-    ActionDecisionDiagram independentActionDd = createActionDecisionDiagram(generationInfo, module, 0, 0);
-    uint_fast64_t numberOfUsedNondeterminismVariables = independentActionDd.numberOfUsedNondeterminismVariables;
+    // Create the action DDs for the independent action and all synchronizing actions of the module. As they are independent of each other, they
+    // are created in parallel.
+    std::set<uint_fast64_t> const& synchronizingActionIndices = module.getSynchronizingActionIndices();
+    std::vector<uint_fast64_t> actionIndices(1, 0);
+    actionIndices.insert(actionIndices.end(), synchronizingActionIndices.begin(), synchronizingActionIndices.end());
+    std::vector<ActionDecisionDiagram> actionDds(actionIndices.size());
+    std::vector<std::function<void()>> translations;
+    for (uint_fast64_t i = 0; i < actionIndices.size(); ++i) {
+        translations.emplace_back([&, i]() {
+            uint_fast64_t actionIndex = actionIndices[i];
+            if (actionIndex == 0) {
+                actionDds[i] = createActionDecisionDiagram(generationInfo, module, 0, 0);
+            } else {
+                STORM_LOG_TRACE("Creating DD for action '" << actionIndex << "'.");
+                actionDds[i] = createActionDecisionDiagram(generationInfo, module, actionIndex, synchronizingActionToOffsetMap.at(actionIndex));
+            }
+        });
+    }
+    storm::utility::dd::executeInParallel<Type, ValueType>(*generationInfo.manager, translations);
 
-    // Create module DD for all synchronizing actions of the module.
+    ActionDecisionDiagram independentActionDd = actionDds.front();
+    uint_fast64_t numberOfUsedNondeterminismVariables = independentActionDd.numberOfUsedNondeterminismVariables;
     std::map<uint_fast64_t, ActionDecisionDiagram> actionIndexToDdMap;
-    for (auto const& actionIndex : module.getSynchronizingActionIndices()) {
-        STORM_LOG_TRACE("Creating DD for action '" << actionIndex << "'.");
-        ActionDecisionDiagram tmp = createActionDecisionDiagram(generationInfo, module, actionIndex, synchronizingActionToOffsetMap.at(actionIndex));
-        numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, tmp.numberOfUsedNondeterminismVariables);
-        actionIndexToDdMap.emplace(actionIndex, tmp);
+    for (uint_fast64_t i = 1; i < actionIndices.size(); ++i) {
+        numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, actionDds[i].numberOfUsedNondeterminismVariables);
+        actionIndexToDdMap.emplace(actionIndices[i], actionDds[i]);
     }
 
     return ModuleDecisionDiagram(independentActionDd, actionIndexToDdMap, generationInfo.moduleToIdentityMap.at(module.getName()),
@@ -1191,9 +1215,15 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
 
         // Add variables for synchronization.
         result *= getSynchronizationDecisionDiagram(generationInfo);
+        if (generationInfo.collectTransitionPartitions) {
+            generationInfo.transitionPartitions.push_back(result.notZero());
+        }
 
         for (auto& synchronizingAction : synchronizingActionToDdMap) {
             synchronizingAction.second *= getSynchronizationDecisionDiagram(generationInfo, synchronizingAction.first);
+            if (generationInfo.collectTransitionPartitions) {
+                generationInfo.transitionPartitions.push_back(synchronizingAction.second.notZero());
+            }
         }
 
         // Now, we can simply add all synchronizing actions to the result.
@@ -1216,6 +1246,9 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
         }
 
         result = identityEncoding * module.independentAction.transitionsDd;
+        if (generationInfo.collectTransitionPartitions) {
+            generationInfo.transitionPartitions.push_back(result.notZero());
+        }
         for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
             // Compute missing global variable identities in synchronizing actions.
             missingIdentities = std::set<storm::expressions::Variable>();
@@ -1229,7 +1262,11 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
                 identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
             }
 
-            result += identityEncoding * synchronizingAction.second.transitionsDd;
+            storm::dd::Add<Type, ValueType> actionTransitions = identityEncoding * synchronizingAction.second.transitionsDd;
+            if (generationInfo.collectTransitionPartitions) {
+                generationInfo.transitionPartitions.push_back(actionTransitions.notZero());
+            }
+            result += actionTransitions;
         }
     } else {
         STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal model type.");
@@ -1422,10 +1459,14 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     storm::prism::Program const& program, Options const& options, std::shared_ptr<storm::dd::DdManager<Type>> const& manager) {
     // Start by initializing the structure used for storing all information needed during the model generation.
     // In particular, this creates the meta variables used to encode the model.
-    GenerationInformation generationInfo(program, manager);
+    GenerationInformation generationInfo(program, manager, options.variableOrdering);
+    generationInfo.collectTransitionPartitions = options.useChainingReachability;
 
     SystemResult system = createSystemDecisionDiagram(generationInfo);
     storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
+    if (options.reorderAtPhaseBoundaries) {
+        storm::utility::dd::reorderAtPhaseBoundary(*manager, "composition", transitionMatrix);
+    }
 
     ModuleDecisionDiagram const& globalModule = system.globalModule;
 
@@ -1455,14 +1496,32 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    storm::dd::Bdd<Type> reachableStates;
+    if (options.useChainingReachability) {
+        // The partitions need to be treated in the same way as the full transition relation.
+        for (auto& partition : generationInfo.transitionPartitions) {
+            partition &= !terminalStatesBdd;
+            if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                partition = partition.existsAbstract(generationInfo.allNondeterminismVariables);
+            }
+        }
+        reachableStates = storm::utility::dd::computeReachableStatesByChaining<Type>(initialStates, generationInfo.transitionPartitions,
+                                                                                     generationInfo.rowMetaVariables, generationInfo.columnMetaVariables)
+                              .first;
+        generationInfo.transitionPartitions.clear();
+    } else {
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                                           generationInfo.columnMetaVariables)
+                              .first;
+    }
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
         system.stateActionDd.get() *= reachableStatesAdd;
     }
+    if (options.reorderAtPhaseBoundaries) {
+        storm::utility::dd::reorderAtPhaseBoundary(*manager, "reachability analysis", transitionMatrix);
+    }
 
     // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
     storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(generationInfo.columnMetaVariables);
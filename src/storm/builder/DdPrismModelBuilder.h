@@ -7,6 +7,7 @@
 
 #include "storm/storage/prism/Program.h"
 
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/adapters/AddExpressionAdapter.h"
@@ -94,6 +95,15 @@ class DdPrismModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // The strategy used to order the DD variables of the program variables.
+        storm::builder::DdVariableOrdering variableOrdering;
+
+        // If set, the variables are reordered after the composition of the system and after the restriction to the reachable states.
+        bool reorderAtPhaseBoundaries;
+
+        // If set, the reachable states are computed by chaining over the transitions of the individual actions.
+        bool useChainingReachability;
     };
 
     /*!
@@ -0,0 +1,179 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering) {
+    switch (ordering) {
+        case DdVariableOrdering::Program:
+            out << "program";
+            break;
+        case DdVariableOrdering::Force:
+            out << "force";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+namespace {
+
+/*!
+ * Computes the sum of the spans of all hyperedges under the given positions of the variables.
+ */
+uint64_t computeTotalSpan(std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t> const& positions) {
+    uint64_t result = 0;
+    for (auto const& hyperedge : hyperedges) {
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+        uint64_t maximum = 0;
+        for (auto variable : hyperedge) {
+            minimum = std::min(minimum, positions[variable]);
+            maximum = std::max(maximum, positions[variable]);
+        }
+        result += maximum - minimum;
+    }
+    return result;
+}
+
+}  // namespace
+
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrdering ordering) {
+    // The program ordering lists the global variables first, and then the variables of the modules.
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& integerVariable : program.getGlobalIntegerVariables()) {
+        result.push_back(integerVariable.getExpressionVariable());
+    }
+    for (auto const& booleanVariable : program.getGlobalBooleanVariables()) {
+        result.push_back(booleanVariable.getExpressionVariable());
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& integerVariable : module.getIntegerVariables()) {
+            result.push_back(integerVariable.getExpressionVariable());
+        }
+        for (auto const& booleanVariable : module.getBooleanVariables()) {
+            result.push_back(booleanVariable.getExpressionVariable());
+        }
+    }
+    if (ordering == DdVariableOrdering::Program || result.size() <= 2) {
+        return result;
+    }
+
+    std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < result.size(); ++index) {
+        variableToIndex.emplace(result[index], index);
+    }
+
+    // Each unlabeled command yields a hyperedge. All commands labeled with the same action are executed jointly, so they yield a single hyperedge.
+    std::map<uint64_t, std::set<uint64_t>> actionToVariables;
+    std::vector<std::set<uint64_t>> variableSets;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> variables = command.getGuardExpression().getVariables();
+            for (auto const& update : command.getUpdates()) {
+                std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                variables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                for (auto const& assignment : update.getAssignments()) {
+                    variables.insert(assignment.getVariable());
+                    std::set<storm::expressions::Variable> assignmentVariables = assignment.getExpression().getVariables();
+                    variables.insert(assignmentVariables.begin(), assignmentVariables.end());
+                }
+            }
+            std::set<uint64_t>& variableSet = command.isLabeled() ? actionToVariables[command.getActionIndex()] : variableSets.emplace_back();
+            for (auto const& variable : variables) {
+                auto indexIt = variableToIndex.find(variable);
+                // Skip all variables that are not state variables, e.g. parameters.
+                if (indexIt != variableToIndex.end()) {
+                    variableSet.insert(indexIt->second);
+                }
+            }
+        }
+    }
+    for (auto& actionVariablesPair : actionToVariables) {
+        variableSets.push_back(std::move(actionVariablesPair.second));
+    }
+
+    std::vector<std::vector<uint64_t>> hyperedges;
+    std::vector<std::vector<uint64_t>> variableToHyperedges(result.size());
+    for (auto const& variableSet : variableSets) {
+        if (variableSet.size() > 1) {
+            for (auto variable : variableSet) {
+                variableToHyperedges[variable].push_back(hyperedges.size());
+            }
+            hyperedges.emplace_back(variableSet.begin(), variableSet.end());
+        }
+    }
+
+    // Perform the FORCE iterations, starting from the program ordering.
+    std::vector<uint64_t> order(result.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint64_t> positions = order;
+    std::vector<uint64_t> bestOrder = order;
+    uint64_t bestSpan = computeTotalSpan(hyperedges, positions);
+    uint64_t const initialSpan = bestSpan;
+    std::vector<double> centresOfGravity(hyperedges.size());
+    std::vector<double> newPositions(result.size());
+    std::vector<uint64_t> previousOrder;
+    // The number of iterations is logarithmic in the number of variables as suggested for FORCE.
+    uint64_t numberOfIterations = 10 * static_cast<uint64_t>(std::ceil(std::log2(static_cast<double>(result.size()))));
+    for (uint64_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+        for (uint64_t hyperedge = 0; hyperedge < hyperedges.size(); ++hyperedge) {
+            double sum = 0;
+            for (auto variable : hyperedges[hyperedge]) {
+                sum += static_cast<double>(positions[variable]);
+            }
+            centresOfGravity[hyperedge] = sum / static_cast<double>(hyperedges[hyperedge].size());
+        }
+        for (uint64_t variable = 0; variable < result.size(); ++variable) {
+            if (variableToHyperedges[variable].empty()) {
+                newPositions[variable] = static_cast<double>(positions[variable]);
+            } else {
+                double sum = 0;
+                for (auto hyperedge : variableToHyperedges[variable]) {
+                    sum += centresOfGravity[hyperedge];
+                }
+                newPositions[variable] = sum / static_cast<double>(variableToHyperedges[variable].size());
+            }
+        }
+        previousOrder = order;
+        std::stable_sort(order.begin(), order.end(), [&](uint64_t first, uint64_t second) {
+            return newPositions[first] < newPositions[second] || (newPositions[first] == newPositions[second] && positions[first] < positions[second]);
+        });
+        for (uint64_t position = 0; position < order.size(); ++position) {
+            positions[order[position]] = position;
+        }
+
+        if (order == previousOrder) {
+            // The order is stable, so further iterations do not change it.
+            break;
+        }
+        uint64_t span = computeTotalSpan(hyperedges, positions);
+        if (span < bestSpan) {
+            bestSpan = span;
+            bestOrder = order;
+        }
+    }
+    STORM_LOG_INFO("FORCE variable ordering reduced the total span of the commands from " << initialSpan << " to " << bestSpan << ".");
+
+    std::vector<storm::expressions::Variable> orderedVariables;
+    orderedVariables.reserve(result.size());
+    for (auto variable : bestOrder) {
+        orderedVariables.push_back(result[variable]);
+    }
+    return orderedVariables;
+}
+
+}  // namespace builder
+}  // namespace storm
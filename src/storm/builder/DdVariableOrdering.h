@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace builder {
+
+// An enum that contains all currently supported strategies to order the variables of DD-based models.
+enum class DdVariableOrdering { Program, Force };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering);
+
+/*!
+ * Computes the order in which the DD variables for the (global and module) variables of the given program are to be
+ * created. The current and next state variables of each program variable are always interleaved.
+ *
+ * With the program ordering, the global variables are followed by the variables of the modules (in the order in which
+ * they appear in the program). With the FORCE ordering, variables that are accessed by the same command (or by
+ * commands that synchronize on the same action) are placed close to each other. For this, each command is considered
+ * as a hyperedge connecting the variables in its guard and updates, and the FORCE heuristic iteratively moves each
+ * variable to the centre of gravity of its hyperedges, keeping the order with minimal total span.
+ *
+ * @param program The program whose variables to order.
+ * @param ordering The ordering strategy.
+ * @return The variables of the program in the order in which the DD variables are to be created.
+ */
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrdering ordering);
+
+}  // namespace builder
+}  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -22,6 +25,7 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Automaton.h"
 #include "storm/storage/jani/AutomatonComposition.h"
@@ -29,11 +33,14 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/MemoryLimit.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
+#include "storm/utility/tracing.h"
 
 namespace storm {
 namespace builder {
@@ -55,14 +62,19 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfBuildThreads()),
+      stateStorageType(storm::settings::getModule<storm::settings::modules::BuildSettings>().getStateStorageType()),
+      fixDeadlocks(!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet()) {
     // Intentionally left empty.
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator),
+      options(options),
+      stateStorage(generator->getStateSize(), options.stateStorageType, std::max<uint64_t>(options.expectedNumberOfStates.get_value_or(0), 100000)) {
     // Intentionally left empty.
 }
 
@@ -123,6 +135,14 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
             stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else if (options.explorationOrder == ExplorationOrder::Bfs) {
             statesToExplore.emplace_back(state, actualIndex);
+        } else if (options.explorationOrder == ExplorationOrder::BestFirst) {
+            explorationPriorities.push_back(options.explorationHeuristic ? options.explorationHeuristic(state) : 0.0);
+            statesToExplore.emplace_back(state, actualIndex);
+            std::push_heap(statesToExplore.begin(), statesToExplore.end(),
+                           [this](auto const& first, auto const& second) { return isExploredAfter(first, second); });
+
+            // Reserve one slot for the new state in the remapping.
+            stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else {
             STORM_LOG_ASSERT(false, "Invalid exploration order.");
         }
@@ -131,16 +151,73 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
     return actualIndex;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+storm::generator::StateBehavior<ValueType, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::reuseRecordedBehavior(
+    storm::generator::StateBehavior<ValueType, StateType> const& recordedBehavior, std::vector<CompressedState> const& recordedStates) {
+    storm::generator::StateBehavior<ValueType, StateType> result;
+    for (auto const& recordedChoice : recordedBehavior) {
+        storm::generator::Choice<ValueType, StateType> choice(recordedChoice.getActionIndex(), recordedChoice.isMarkovian());
+        choice.reserve(recordedChoice.size());
+        for (auto const& stateProbabilityPair : recordedChoice) {
+            choice.addProbability(getOrAddStateIndex(recordedStates[stateProbabilityPair.first]), stateProbabilityPair.second);
+        }
+        choice.addRewards(std::vector<ValueType>(recordedChoice.getRewards()));
+        if (recordedChoice.hasLabels()) {
+            choice.addLabels(recordedChoice.getLabels());
+        }
+        if (recordedChoice.hasOriginData()) {
+            choice.addOriginData(recordedChoice.getOriginData());
+        }
+        if (recordedChoice.hasPlayerIndex()) {
+            choice.setPlayerIndex(recordedChoice.getPlayerIndex());
+        }
+        result.addChoice(std::move(choice));
+    }
+    result.addStateRewards(std::vector<ValueType>(recordedBehavior.getStateRewards()));
+    result.setExpanded(recordedBehavior.wasExpanded());
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isExploredAfter(std::pair<CompressedState, StateType> const& first,
+                                                                                  std::pair<CompressedState, StateType> const& second) const {
+    double firstPriority = explorationPriorities[first.second];
+    double secondPriority = explorationPriorities[second.second];
+    return firstPriority > secondPriority || (firstPriority == secondPriority && first.second > second.second);
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isExplorationBudgetExhausted(uint64_t numberOfExploredStates,
+                                                                                               uint64_t numberOfTransitions) const {
+    if (options.stateBudget && numberOfExploredStates >= options.stateBudget.get()) {
+        return true;
+    }
+    if (options.memoryBudget) {
+        // Every discovered state occupies a bucket of the state storage and an index, every transition an entry of the matrix.
+        uint64_t bytesPerState = ((generator->getStateSize() + 63) / 64) * 8 + sizeof(StateType);
+        uint64_t memory = stateStorage.getNumberOfStates() * bytesPerState +
+                          numberOfTransitions * sizeof(storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>);
+        return memory >= options.memoryBudget.get();
+    }
+    return false;
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+std::string ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getUnexploredStatesLabel() {
+    return "unexplored";
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
     StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    STORM_TRACE_ZONE("ExplicitModelBuilder::buildMatrices");
     // Initialize building state valuations (if necessary)
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
         stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
@@ -166,17 +243,69 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint_fast64_t currentRowGroup = 0;
     uint_fast64_t currentRow = 0;
 
+    bool exploreConcurrently = options.numberOfThreads > 1;
+    if (exploreConcurrently && options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("Concurrent state-space exploration requires breadth-first exploration order. Falling back to sequential exploration.");
+        exploreConcurrently = false;
+    }
+    if (exploreConcurrently && (options.stateBudget || options.memoryBudget)) {
+        STORM_LOG_WARN("Concurrent state-space exploration does not support exploration budgets. Falling back to sequential exploration.");
+        exploreConcurrently = false;
+    }
+    if (exploreConcurrently && generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Concurrent state-space exploration does not support labeling states with overlapping guards. Falling back to sequential exploration.");
+        exploreConcurrently = false;
+    }
+    // If the exploration is recorded, the previous record (if any) is taken over, such that it can be replaced by the new one.
+    boost::optional<ExplorationRecord<ValueType, StateType>> previousRecord;
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> recordedBehaviors;
+    uint64_t numberOfReusedStates = 0;
+    if (options.explorationRecord) {
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs && !options.stateBudget && !options.memoryBudget,
+                        storm::exceptions::IllegalArgumentException, "Recording the exploration requires breadth-first exploration without budgets.");
+        if (exploreConcurrently) {
+            STORM_LOG_WARN("Concurrent state-space exploration does not support recording the exploration. Falling back to sequential exploration.");
+            exploreConcurrently = false;
+        }
+        if (options.explorationRecord->stateToId) {
+            previousRecord = std::move(*options.explorationRecord);
+            STORM_LOG_ASSERT(previousRecord->outdatedStates.size() == previousRecord->states.size(), "Invalid size of outdated states.");
+        }
+    }
+
+    if (exploreConcurrently) {
+        exploreStatesConcurrently(currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    }
+
     auto timeOfStart = std::chrono::high_resolution_clock::now();
     auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
+    uint64_t numberOfTransitions = 0;
+
+    // If a memory limit is set, we check it every few states. If it is approached even after dropping cached data, the remaining states are
+    // not expanded, as for an exhausted exploration budget.
+    uint64_t constexpr memoryLimitCheckInterval = 1024;
+    bool checkMemoryLimit = storm::utility::resources::isMemoryLimitSet() && !options.explorationRecord;
+    bool memoryLimitApproached = false;
+    uint64_t numberOfStatesSinceMemoryLimitCheck = 0;
 
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
         // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
+        CompressedState currentState;
+        StateType currentIndex;
+        if (options.explorationOrder == ExplorationOrder::BestFirst) {
+            std::pop_heap(statesToExplore.begin(), statesToExplore.end(),
+                          [this](auto const& first, auto const& second) { return isExploredAfter(first, second); });
+            currentState = std::move(statesToExplore.back().first);
+            currentIndex = statesToExplore.back().second;
+            statesToExplore.pop_back();
+        } else {
+            currentState = statesToExplore.front().first;
+            currentIndex = statesToExplore.front().second;
+            statesToExplore.pop_front();
+        }
 
         // If the exploration order differs from breadth-first, we remember that this row group was actually
         // filled with the transitions of a different state.
@@ -192,104 +321,39 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
-        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
-
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
-                }
-
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+        if (checkMemoryLimit && !memoryLimitApproached && ++numberOfStatesSinceMemoryLimitCheck == memoryLimitCheckInterval) {
+            numberOfStatesSinceMemoryLimitCheck = 0;
+            if (storm::utility::resources::isMemoryLimitApproached()) {
+                storm::utility::resources::reclaimMemory();
+                memoryLimitApproached = storm::utility::resources::isMemoryLimitApproached();
             }
+        }
+        if (memoryLimitApproached || isExplorationBudgetExhausted(numberOfExploredStates, numberOfTransitions)) {
+            // The budget is exhausted, so the state is not expanded (and thereby made absorbing).
+            unexploredStateIndices.push_back(currentIndex);
+            addStateBehavior(currentState, currentIndex, storm::generator::StateBehavior<ValueType, StateType>(), currentRowGroup, currentRow,
+                             transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+            continue;
+        }
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        boost::optional<StateType> previousIndex = previousRecord ? previousRecord->stateToId->find(currentState) : boost::none;
+        if (previousIndex && !previousRecord->outdatedStates.get(previousIndex.get())) {
+            behavior = reuseRecordedBehavior(previousRecord->behaviors[previousIndex.get()], previousRecord->states);
+            ++numberOfReusedStates;
         } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
-            }
-
-            ++currentRowGroup;
+            behavior = generator->expand(stateToIdCallback);
+        }
+        addStateBehavior(currentState, currentIndex, behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                         stateAndChoiceInformationBuilder);
+        for (auto const& choice : behavior) {
+            numberOfTransitions += choice.size();
+        }
+        if (options.explorationRecord) {
+            STORM_LOG_ASSERT(recordedBehaviors.size() == currentIndex, "Breadth-first exploration does not explore the states in the order of their indices.");
+            recordedBehaviors.push_back(std::move(behavior));
+        } else {
+            // Hand the memory of the behavior back to the generator, so that it does not need to allocate when expanding the next state.
+            generator->recycle(std::move(behavior));
         }
 
         ++numberOfExploredStates;
@@ -315,6 +379,12 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             break;
         }
     }
+    if (memoryLimitApproached) {
+        storm::utility::resources::reportDegradation("The state space exploration was stopped after expanding " + std::to_string(numberOfExploredStates) +
+                                                     " states. The " + std::to_string(unexploredStateIndices.size()) +
+                                                     " remaining states are absorbing and labeled with '" + getUnexploredStatesLabel() +
+                                                     "', so results are only bounds.");
+    }
 
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
     // (reversed) mapping of row groups to indices.
@@ -341,8 +411,264 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         // Fix (c).
         this->stateStorage.stateToId.remap([&remapping](StateType const& state) { return remapping[state]; });
 
+        for (auto& stateIndex : unexploredStateIndices) {
+            stateIndex = remapping[stateIndex];
+        }
+
         this->generator->remapStateIds([&remapping](StateType const& state) { return remapping[state]; });
     }
+
+    if (options.explorationRecord) {
+        ExplorationRecord<ValueType, StateType>& record = *options.explorationRecord;
+        record.stateToId = this->stateStorage.stateToId;
+        record.states.resize(this->stateStorage.getNumberOfStates());
+        for (auto const& stateIndexPair : this->stateStorage.stateToId) {
+            record.states[stateIndexPair.second] = stateIndexPair.first;
+        }
+        record.behaviors = std::move(recordedBehaviors);
+        record.outdatedStates = storm::storage::BitVector(record.states.size());
+        record.numberOfReusedStates = numberOfReusedStates;
+        STORM_LOG_INFO("Reused the recorded behavior of " << numberOfReusedStates << " of " << record.states.size() << " states.");
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, uint_fast64_t& currentRowGroup,
+    uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, std::function<StateType(StateType const&)> const& columnRemapping) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (options.fixDeadlocks || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            }
+
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+
+            transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set above
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the probabilistic behavior to the matrix. If the columns are remapped, they might not be in order
+            // anymore, which is fixed by the matrix builder.
+            if (columnRemapping) {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, columnRemapping(stateProbabilityPair.first), stateProbabilityPair.second);
+                }
+            } else {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreStatesConcurrently(
+    uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    STORM_LOG_ASSERT(options.explorationOrder == ExplorationOrder::Bfs, "Concurrent exploration requires breadth-first exploration order.");
+
+    // While a level is expanded, the states that were not known before the level get a temporary index that counts
+    // down from the largest representable index. This way, they can not be confused with regular indices.
+    StateType const maximalStateIndex = std::numeric_limits<StateType>::max();
+
+    // Each worker owns a generator as well as the states it discovered first in the current level (together with
+    // their temporary indices).
+    struct Worker {
+        std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+        std::vector<std::pair<StateType, CompressedState>> discoveredStates;
+    };
+    // For each state of a level, we store its behavior as well as the states discovered while expanding it (in the
+    // order in which the generator requested them).
+    struct ExpandedState {
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        std::vector<StateType> discoveredStates;
+    };
+
+    // The main generator serves as the first worker, because it is not used otherwise while a level is expanded.
+    std::vector<Worker> workers(options.numberOfThreads);
+    for (uint64_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex) {
+        workers[workerIndex].generator = workerIndex == 0 ? generator : generator->clone();
+    }
+
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    uint64_t numberOfExploredStates = 0;
+    uint64_t level = 0;
+    std::vector<std::pair<CompressedState, StateType>> currentLevel;
+    std::vector<ExpandedState> expandedStates;
+    std::vector<CompressedState> discoveredStates;
+    std::vector<StateType> discoveredStateIndices;
+    while (!statesToExplore.empty()) {
+        currentLevel.assign(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.end()));
+        statesToExplore.clear();
+        expandedStates.clear();
+        expandedStates.resize(currentLevel.size());
+
+        // The states discovered in this level are shared among all workers, so every new state is only stored once.
+        storm::storage::ConcurrentBitVectorHashMap<StateType> discoveredStateToTemporaryIndex(generator->getStateSize(), currentLevel.size(), 0.75,
+                                                                                             8 * workers.size());
+        std::atomic<uint64_t> numberOfDiscoveredStates(0);
+
+        // Expand all states of the level concurrently. The state storage is only read in this phase.
+        uint64_t chunkSize = std::max<uint64_t>(1, std::min<uint64_t>(1024, currentLevel.size() / (8 * workers.size())));
+        storm::utility::parallel::forEachChunk(workers.size(), currentLevel.size(), chunkSize, [&](uint64_t workerIndex, uint64_t begin, uint64_t end) {
+            Worker& worker = workers[workerIndex];
+            ExpandedState* expandedState = nullptr;
+            std::function<StateType()> temporaryIndexGenerator = [&numberOfDiscoveredStates]() {
+                return static_cast<StateType>(numberOfDiscoveredStates.fetch_add(1, std::memory_order_relaxed));
+            };
+            std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) -> StateType {
+                boost::optional<StateType> index = this->stateStorage.stateToId.find(state);
+                if (index) {
+                    return index.get();
+                }
+                std::pair<StateType, bool> temporaryIndexAndFlag = discoveredStateToTemporaryIndex.findOrAdd(state, temporaryIndexGenerator);
+                if (temporaryIndexAndFlag.second) {
+                    worker.discoveredStates.emplace_back(temporaryIndexAndFlag.first, state);
+                }
+                StateType temporaryIndex = temporaryIndexAndFlag.first;
+                expandedState->discoveredStates.push_back(temporaryIndex);
+                return maximalStateIndex - temporaryIndex;
+            };
+            for (uint64_t stateIndex = begin; stateIndex < end; ++stateIndex) {
+                expandedState = &expandedStates[stateIndex];
+                worker.generator->load(currentLevel[stateIndex].first);
+                expandedState->behavior = worker.generator->expand(stateToIdCallback);
+            }
+        });
+
+        STORM_LOG_THROW(stateStorage.getNumberOfStates() + numberOfDiscoveredStates.load() < static_cast<uint64_t>(maximalStateIndex),
+                        storm::exceptions::WrongFormatException, "The number of states exceeds the range of the state index type.");
+        discoveredStates.resize(numberOfDiscoveredStates.load());
+        discoveredStateIndices.assign(numberOfDiscoveredStates.load(), maximalStateIndex);
+        for (auto& worker : workers) {
+            for (auto& temporaryIndexStatePair : worker.discoveredStates) {
+                discoveredStates[temporaryIndexStatePair.first] = std::move(temporaryIndexStatePair.second);
+            }
+            worker.discoveredStates.clear();
+        }
+
+        // Now assign the actual indices to the discovered states and add the behaviors in the order of the level.
+        for (uint64_t stateIndex = 0; stateIndex < currentLevel.size(); ++stateIndex) {
+            CompressedState const& currentState = currentLevel[stateIndex].first;
+            StateType currentIndex = currentLevel[stateIndex].second;
+            ExpandedState& expandedState = expandedStates[stateIndex];
+            for (auto temporaryIndex : expandedState.discoveredStates) {
+                if (discoveredStateIndices[temporaryIndex] == maximalStateIndex) {
+                    discoveredStateIndices[temporaryIndex] = getOrAddStateIndex(discoveredStates[temporaryIndex]);
+                }
+            }
+
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->load(currentState);
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+
+            StateType smallestTemporaryIndex = maximalStateIndex - static_cast<StateType>(discoveredStates.size());
+            addStateBehavior(currentState, currentIndex, expandedState.behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                             stateAndChoiceInformationBuilder, [&discoveredStateIndices, smallestTemporaryIndex, maximalStateIndex](StateType const& column) {
+                                 return column > smallestTemporaryIndex ? discoveredStateIndices[maximalStateIndex - column] : column;
+                             });
+            // Free the memory of the behavior as early as possible. The choices are spread over the workers, which only keep a bounded
+            // number of them for the expansion of the next level.
+            workers[stateIndex % workers.size()].generator->recycle(std::move(expandedState.behavior));
+            expandedState = ExpandedState();
+        }
+
+        numberOfExploredStates += currentLevel.size();
+        ++level;
+        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+        if (generator->getOptions().isShowProgressSet()) {
+            std::cout << "Explored " << numberOfExploredStates << " states (" << level << " levels) in " << durationSinceStart << " seconds.\n";
+        }
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -418,7 +744,18 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
-    return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    storm::models::sparse::StateLabeling result =
+        generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices, options.numberOfThreads);
+    if (options.stateBudget || options.memoryBudget || !unexploredStateIndices.empty()) {
+        STORM_LOG_THROW(!result.containsLabel(getUnexploredStatesLabel()), storm::exceptions::WrongFormatException,
+                        "The label '" << getUnexploredStatesLabel() << "' is reserved for states that were not explored.");
+        storm::storage::BitVector unexploredStates(stateStorage.getNumberOfStates());
+        for (auto stateIndex : unexploredStateIndices) {
+            unexploredStates.set(stateIndex);
+        }
+        result.addLabel(getUnexploredStatesLabel(), std::move(unexploredStates));
+    }
+    return result;
 }
 
 // Explicitly instantiate the class.
@@ -6,6 +6,7 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -46,7 +47,7 @@ class StateAndChoiceInformationBuilder;
 template<typename StateType>
 class ExplicitStateLookup {
    public:
-    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::BitVectorHashMap<StateType> const& stateToId)
+    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::sparse::StateToIdMap<StateType> const& stateToId)
         : varInfo(varInfo), stateToId(stateToId) {
         // intentionally left empty.
     }
@@ -64,7 +65,29 @@ class ExplicitStateLookup {
 
    private:
     VariableInformation varInfo;
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    storm::storage::sparse::StateToIdMap<StateType> stateToId;
+};
+
+/*!
+ * The outcome of an exploration that allows to build the model again after small changes to its description. In the next exploration,
+ * the recorded behavior of every state that is not marked as outdated is reused instead of expanding the state anew.
+ */
+template<typename ValueType, typename StateType>
+struct ExplorationRecord {
+    // The explored states and their indices. This is not set as long as nothing has been recorded.
+    boost::optional<storm::storage::sparse::StateToIdMap<StateType>> stateToId;
+
+    // The explored states ordered by their indices.
+    std::vector<CompressedState> states;
+
+    // The behavior of each explored state. The targets of the choices refer to the indices of the recorded states.
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+
+    // The states whose behavior may have changed, which are therefore expanded again in the next exploration.
+    storm::storage::BitVector outdatedStates;
+
+    // The number of states whose (previously recorded) behavior was reused in the exploration that produced this record.
+    uint64_t numberOfReusedStates = 0;
 };
 
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
@@ -78,6 +101,38 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to explore the model and to evaluate the label expressions.
+        uint64_t numberOfThreads;
+
+        // The data structure that stores the explored states.
+        storm::storage::sparse::StateStorageType stateStorageType;
+
+        // If given, the expected number of states (e.g. as predicted by the StateSpaceEstimator). The state storage is sized accordingly, which
+        // avoids increasing its size during the exploration.
+        boost::optional<uint64_t> expectedNumberOfStates;
+
+        // Whether deadlock states are made absorbing by adding a self-loop. Otherwise, deadlock states have no choices.
+        bool fixDeadlocks;
+
+        // For best-first exploration, the heuristic that determines the order in which states are explored. States with lower
+        // values are explored first. If not given, all states have the same value, i.e., the states are explored breadth-first.
+        std::function<double(CompressedState const&)> explorationHeuristic;
+
+        // If given, at most this many states are expanded. The remaining discovered states are made absorbing and are labeled with
+        // the label returned by getUnexploredStatesLabel(). Checking a property once with these states as non-target states and once
+        // as target states yields lower and upper bounds for the (not fully built) model.
+        boost::optional<uint64_t> stateBudget;
+
+        // If given, states are only expanded as long as the (estimated) memory occupied by the states and transitions does not exceed
+        // this many bytes. The remaining states are treated as for the state budget. The same happens (independently of the budgets) if
+        // the memory limit of the process is approached during a sequential exploration, see storm::utility::resources::setMemoryLimit.
+        boost::optional<uint64_t> memoryBudget;
+
+        // If given, the exploration is recorded in this structure. If it already holds the record of a previous exploration, the
+        // recorded behaviors of all states that are not outdated are reused. This requires a sequential breadth-first exploration
+        // without budgets.
+        std::shared_ptr<ExplorationRecord<ValueType, StateType>> explorationRecord;
     };
 
     /*!
@@ -121,7 +176,25 @@ class ExplicitModelBuilder {
      */
     ExplicitStateLookup<StateType> exportExplicitStateLookup() const;
 
+    /*!
+     * Retrieves the name of the label that marks the states that were discovered but not expanded because the exploration budget was exhausted.
+     */
+    static std::string getUnexploredStatesLabel();
+
    private:
+    /*!
+     * Retrieves whether the first state is to be explored after the second one in best-first exploration order.
+     */
+    bool isExploredAfter(std::pair<CompressedState, StateType> const& first, std::pair<CompressedState, StateType> const& second) const;
+
+    /*!
+     * Retrieves whether the state or memory budget (if any) is exhausted, i.e., whether no further state may be expanded.
+     *
+     * @param numberOfExploredStates The number of states expanded so far.
+     * @param numberOfTransitions The number of transitions of the states expanded so far.
+     */
+    bool isExplorationBudgetExhausted(uint64_t numberOfExploredStates, uint64_t numberOfTransitions) const;
+
     /*!
      * Retrieves the state id of the given state. If the state has not been encountered yet, it will be added to
      * the lists of all states with a new id. If the state was already known, the object that is pointed to by
@@ -133,6 +206,16 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Creates a copy of the given recorded behavior in which the targets refer to the (possibly newly added) indices of the
+     * current exploration.
+     *
+     * @param recordedBehavior The behavior whose targets refer to the indices of the given recorded states.
+     * @param recordedStates The states of the exploration in which the behavior was recorded.
+     */
+    storm::generator::StateBehavior<ValueType, StateType> reuseRecordedBehavior(storm::generator::StateBehavior<ValueType, StateType> const& recordedBehavior,
+                                                                                std::vector<CompressedState> const& recordedStates);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
@@ -144,6 +227,33 @@ class ExplicitModelBuilder {
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Adds the given behavior of a state to the matrices and the other components under construction.
+     *
+     * @param state The state whose behavior is added.
+     * @param stateIndex The index of the state.
+     * @param behavior The behavior of the state.
+     * @param currentRowGroup The row group of the state. This is increased to the next row group.
+     * @param currentRow The first row of the state. This is increased to the first row of the next state.
+     * @param columnRemapping If given, this is applied to the target states of the behavior before they are inserted.
+     */
+    void addStateBehavior(CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder,
+                          std::function<StateType(StateType const&)> const& columnRemapping = nullptr);
+
+    /*!
+     * Explores all states that are reachable from the states to explore. This proceeds level by level, where the
+     * states of one level are expanded concurrently by clones of the generator. The indices of the newly discovered
+     * states are assigned afterwards in the same order as a sequential breadth-first search would assign them, so the
+     * resulting model does not depend on the number of threads.
+     */
+    void exploreStatesConcurrently(uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow,
+                                   storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                                   std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                                   StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -167,9 +277,15 @@ class ExplicitModelBuilder {
     /// Internal information about the states that were explored.
     storm::storage::sparse::StateStorage<StateType> stateStorage;
 
-    /// A set of states that still need to be explored.
+    /// A set of states that still need to be explored. For best-first exploration, this is a heap w.r.t. isExploredAfter.
     std::deque<std::pair<CompressedState, StateType>> statesToExplore;
 
+    /// For best-first exploration, the values of the heuristic for all discovered states.
+    std::vector<double> explorationPriorities;
+
+    /// The states that were discovered but not expanded because the exploration budget was exhausted or the memory limit was approached.
+    std::vector<StateType> unexploredStateIndices;
+
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
     boost::optional<std::vector<uint_fast64_t>> stateRemapping;
@@ -6,8 +6,9 @@
 namespace storm {
 namespace builder {
 
-// An enum that contains all currently supported exploration orders.
-enum class ExplorationOrder { Dfs, Bfs };
+// An enum that contains all currently supported exploration orders. Best-first exploration expands the states with the lowest value of a
+// given heuristic first (ties are broken in breadth-first order).
+enum class ExplorationOrder { Dfs, Bfs, BestFirst };
 
 std::ostream& operator<<(std::ostream& out, ExplorationOrder const& order);
 
@@ -0,0 +1,607 @@
+#include "storm/builder/ExternalMemoryModelBuilder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+#include "storm/builder/RewardModelInformation.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/ModelType.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/ExternalSorter.h"
+#include "storm/storage/sparse/StateStorage.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+
+using namespace storm::exporter::binary;
+
+// The number of states of a level that are loaded into memory at once. The states of such a chunk are labeled together.
+uint64_t const statesPerChunk = 1ull << 16;
+
+// The maximal number of sorted runs of visited states. If there are more runs, they are merged into one.
+uint64_t const maximalNumberOfVisitedRuns = 16;
+
+template<typename T>
+void writeRaw(std::ostream& stream, T const& value) {
+    stream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template<typename T>
+T readRaw(std::istream& stream) {
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Unexpected end of a temporary file of the external-memory exploration.");
+    return value;
+}
+
+void writePadding(std::ostream& stream, uint64_t size) {
+    char const zeros[8] = {};
+    stream.write(zeros, getPadding(size));
+}
+
+std::ofstream openOutputFile(std::string const& filename) {
+    std::ofstream result(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(result, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    return result;
+}
+
+std::ifstream openInputFile(std::string const& filename) {
+    std::ifstream result(filename, std::ios::in | std::ios::binary);
+    STORM_LOG_THROW(result, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    return result;
+}
+
+void closeFile(std::ofstream& stream, std::string const& filename) {
+    stream.close();
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write file " << filename << ".");
+}
+
+void toWords(storm::generator::CompressedState const& state, uint64_t* words, uint64_t numberOfWords) {
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        words[word] = state.getAsInt(64 * word, 64);
+    }
+}
+
+storm::generator::CompressedState fromWords(uint64_t const* words, uint64_t numberOfWords) {
+    storm::generator::CompressedState result(64 * numberOfWords);
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        result.setFromInt(64 * word, 64, words[word]);
+    }
+    return result;
+}
+
+/*!
+ * Writes a bit vector to a file in the layout of the binary model format, i.e., bucket by bucket as obtained by BitVector::getAsInt.
+ */
+class BitFileWriter {
+   public:
+    explicit BitFileWriter(std::string const& filename) : filename(filename), stream(openOutputFile(filename)), size(0), currentBucket(0) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Sets the bit with the given index. The indices need to be set in increasing order.
+     */
+    void set(uint64_t index) {
+        STORM_LOG_ASSERT(index >= size, "Bits have to be set in increasing order.");
+        append(index - size, false);
+        append(1, true);
+    }
+
+    /*!
+     * Pads the bit vector with zeros to the given size and closes the file.
+     */
+    void close(uint64_t newSize) {
+        STORM_LOG_ASSERT(newSize >= size, "Unable to shrink the bit vector.");
+        append(newSize - size, false);
+        if (size % 64 != 0) {
+            // The last bucket only holds the remaining bits.
+            writeRaw(stream, currentBucket);
+        }
+        closeFile(stream, filename);
+    }
+
+    std::string const& getFilename() const {
+        return filename;
+    }
+
+   private:
+    void append(uint64_t numberOfBits, bool value) {
+        for (; numberOfBits > 0 && size % 64 != 0; --numberOfBits) {
+            appendBit(value);
+        }
+        // Full buckets are written at once.
+        uint64_t const fullBucket = value ? ~0ull : 0ull;
+        for (; numberOfBits >= 64; numberOfBits -= 64) {
+            writeRaw(stream, fullBucket);
+            size += 64;
+        }
+        for (; numberOfBits > 0; --numberOfBits) {
+            appendBit(value);
+        }
+    }
+
+    void appendBit(bool value) {
+        currentBucket = (currentBucket << 1) | (value ? 1 : 0);
+        ++size;
+        if (size % 64 == 0) {
+            writeRaw(stream, currentBucket);
+            currentBucket = 0;
+        }
+    }
+
+    std::string filename;
+    std::ofstream stream;
+    uint64_t size;
+    uint64_t currentBucket;
+};
+
+/*!
+ * Retrieves the writer of the given label, creating it (and a new file) if necessary.
+ */
+BitFileWriter& getLabelWriter(std::map<std::string, BitFileWriter>& writers, std::string const& label, std::filesystem::path const& directory,
+                              std::string const& prefix) {
+    auto it = writers.find(label);
+    if (it == writers.end()) {
+        it = writers.emplace(label, BitFileWriter((directory / (prefix + std::to_string(writers.size()))).string())).first;
+    }
+    return it->second;
+}
+
+void copySection(std::ostream& output, SectionType type, std::string const& name, std::string const& filename) {
+    uint64_t dataSize = std::filesystem::file_size(filename);
+    SectionHeader header{type, 0, name.size(), dataSize};
+    writeRaw(output, header);
+    output.write(name.data(), name.size());
+    writePadding(output, name.size());
+    if (dataSize > 0) {
+        std::ifstream input = openInputFile(filename);
+        output << input.rdbuf();
+    }
+    writePadding(output, dataSize);
+}
+
+/*!
+ * Removes the temporary files of the exploration, even if it is aborted.
+ */
+struct TemporaryDirectory {
+    explicit TemporaryDirectory(std::filesystem::path const& path) : path(path) {
+        std::filesystem::create_directories(path);
+    }
+
+    ~TemporaryDirectory() {
+        std::error_code errorCode;
+        std::filesystem::remove_all(path, errorCode);
+    }
+
+    std::string getFile(std::string const& name) const {
+        return (path / name).string();
+    }
+
+    std::filesystem::path path;
+};
+
+storm::models::ModelType getModelType(storm::generator::ModelType const& modelType) {
+    switch (modelType) {
+        case storm::generator::ModelType::DTMC:
+            return storm::models::ModelType::Dtmc;
+        case storm::generator::ModelType::CTMC:
+            return storm::models::ModelType::Ctmc;
+        case storm::generator::ModelType::MDP:
+            return storm::models::ModelType::Mdp;
+        case storm::generator::ModelType::POMDP:
+            return storm::models::ModelType::Pomdp;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The external-memory exploration does not support models of this type.");
+    }
+}
+
+}  // namespace
+
+ExternalMemoryModelBuilder::Options::Options()
+    : workingDirectory(storm::settings::getModule<storm::settings::modules::BuildSettings>().isExternalMemoryDirectorySet()
+                           ? storm::settings::getModule<storm::settings::modules::BuildSettings>().getExternalMemoryDirectory()
+                           : std::filesystem::temp_directory_path().string()),
+      memoryLimit(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExternalMemoryLimit() * 1024 * 1024),
+      fixDeadlocks(!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet()) {
+    // Intentionally left empty.
+}
+
+ExternalMemoryModelBuilder::ExternalMemoryModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> const& generator,
+                                                       Options const& options)
+    : generator(generator), options(options) {
+    // Intentionally left empty.
+}
+
+ExternalMemoryModelBuilder::ExternalMemoryModelBuilder(storm::prism::Program const& program,
+                                                       storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions)
+    : ExternalMemoryModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program, generatorOptions), builderOptions) {
+    // Intentionally left empty.
+}
+
+ExternalMemoryModelBuilder::ExternalMemoryModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions,
+                                                       Options const& builderOptions)
+    : ExternalMemoryModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<double, uint32_t>>(model, generatorOptions), builderOptions) {
+    // Intentionally left empty.
+}
+
+ExternalMemoryModelBuilder::Statistics ExternalMemoryModelBuilder::build(std::string const& filename) {
+    storm::models::ModelType const modelType = getModelType(generator->getModelType());
+    STORM_LOG_THROW(!generator->getOptions().isAddOverlappingGuardLabelSet(), storm::exceptions::NotSupportedException,
+                    "The external-memory exploration does not support labeling states with overlapping guards.");
+    bool const deterministicModel = generator->isDeterministicModel();
+    bool const rateTransitions = modelType == storm::models::ModelType::Ctmc;
+    bool const buildChoiceLabels = generator->getOptions().isBuildChoiceLabelsSet();
+    bool const fixDeadlocks = options.fixDeadlocks;
+
+    // The states are stored as sequences of 64-bit words. The sorted runs of states additionally store the index (or another value) of each state.
+    uint64_t const numberOfWords = generator->getStateSize() / 64;
+    uint64_t const stateRecordSize = numberOfWords + 1;
+
+    TemporaryDirectory directory(std::filesystem::path(options.workingDirectory) /
+                                 ("storm-exploration-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count())));
+
+    // The transitions are written to the model file while exploring. The headers are written once all sizes are known.
+    std::ofstream output = openOutputFile(filename);
+    FileHeader fileHeader{Magic, Version, ByteOrderMark, static_cast<uint32_t>(modelType), sizeof(double), 0, 0, 0, rateTransitions ? RateTransitionsFlag : 0};
+    SectionHeader entriesHeader{SectionType::Entries, 0, 0, 0};
+    writeRaw(output, fileHeader);
+    writeRaw(output, entriesHeader);
+
+    // All other components are collected in temporary files.
+    std::string const rowIndicationsFile = directory.getFile("row-indications");
+    std::string const rowGroupIndicesFile = directory.getFile("row-group-indices");
+    std::string const exitRatesFile = directory.getFile("exit-rates");
+    std::string const observationsFile = directory.getFile("observations");
+    std::ofstream rowIndications = openOutputFile(rowIndicationsFile);
+    std::ofstream rowGroupIndices = openOutputFile(rowGroupIndicesFile);
+    std::ofstream exitRates = openOutputFile(exitRatesFile);
+    std::ofstream observations = openOutputFile(observationsFile);
+    std::vector<RewardModelInformation> rewardModelInformation;
+    std::vector<std::string> stateRewardFiles, stateActionRewardFiles;
+    std::vector<std::ofstream> stateRewards, stateActionRewards;
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < generator->getNumberOfRewardModels(); ++rewardModelIndex) {
+        rewardModelInformation.push_back(generator->getRewardModelInformation(rewardModelIndex));
+        stateRewardFiles.push_back(directory.getFile("state-rewards-" + std::to_string(rewardModelIndex)));
+        stateActionRewardFiles.push_back(directory.getFile("state-action-rewards-" + std::to_string(rewardModelIndex)));
+        stateRewards.push_back(openOutputFile(stateRewardFiles.back()));
+        stateActionRewards.push_back(openOutputFile(stateActionRewardFiles.back()));
+    }
+    std::map<std::string, BitFileWriter> stateLabels, choiceLabels;
+
+    // The successors of the currently expanded state. The generator obtains their positions in this vector as their indices.
+    std::vector<storm::generator::CompressedState> successors;
+    std::unordered_map<storm::generator::CompressedState, uint32_t> successorIndices;
+    std::function<uint32_t(storm::generator::CompressedState const&)> stateToIdCallback = [&](storm::generator::CompressedState const& state) {
+        auto indexIt = successorIndices.emplace(state, static_cast<uint32_t>(successors.size()));
+        if (indexIt.second) {
+            successors.push_back(state);
+        }
+        return indexIt.first->second;
+    };
+
+    // The initial states form the first level, i.e., they get the first indices.
+    generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!successors.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+    uint64_t const numberOfInitialStates = successors.size();
+    std::vector<uint64_t> record(stateRecordSize);
+    std::string frontierFile = directory.getFile("frontier-0");
+    std::vector<std::string> visitedRuns = {directory.getFile("visited-0")};
+    {
+        storm::storage::RecordFileWriter frontier(frontierFile, numberOfWords);
+        std::vector<std::vector<uint64_t>> initialRecords;
+        for (uint64_t stateIndex = 0; stateIndex < successors.size(); ++stateIndex) {
+            toWords(successors[stateIndex], record.data(), numberOfWords);
+            record[numberOfWords] = stateIndex;
+            frontier.write(record.data());
+            initialRecords.push_back(record);
+        }
+        frontier.close();
+        std::sort(initialRecords.begin(), initialRecords.end());
+        storm::storage::RecordFileWriter visited(visitedRuns.front(), stateRecordSize);
+        for (auto const& initialRecord : initialRecords) {
+            visited.write(initialRecord.data());
+        }
+        visited.close();
+    }
+
+    Statistics statistics;
+    uint64_t numberOfDiscoveredStates = numberOfInitialStates;
+    uint64_t frontierSize = numberOfInitialStates;
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    while (frontierSize > 0) {
+        std::string const levelString = std::to_string(statistics.numberOfLevels);
+        uint64_t const firstRowOfLevel = statistics.numberOfChoices;
+
+        // Expand the states of the level. For every transition, we remember its target state together with the position of the
+        // transition (its slot) in the level, so that the target index can be associated with the transition after the level.
+        storm::storage::ExternalSorter targets(directory.getFile("targets-" + levelString), stateRecordSize, numberOfWords, options.memoryLimit / 2);
+        std::string const valuesFile = directory.getFile("values-" + levelString);
+        std::string const rowSizesFile = directory.getFile("row-sizes-" + levelString);
+        std::ofstream values = openOutputFile(valuesFile);
+        std::ofstream rowSizes = openOutputFile(rowSizesFile);
+        uint64_t slot = 0;
+        auto addTransition = [&](storm::generator::CompressedState const& target, double value) {
+            toWords(target, record.data(), numberOfWords);
+            record[numberOfWords] = slot++;
+            targets.add(record.data());
+            writeRaw(values, value);
+        };
+
+        storm::storage::RecordFileReader frontier(frontierFile, numberOfWords);
+        std::vector<storm::generator::CompressedState> chunk;
+        bool hasNextState = frontier.next();
+        while (hasNextState) {
+            uint64_t const firstStateOfChunk = statistics.numberOfStates;
+            chunk.clear();
+            for (; hasNextState && chunk.size() < statesPerChunk; hasNextState = frontier.next()) {
+                chunk.push_back(fromWords(frontier.get(), numberOfWords));
+            }
+
+            std::vector<uint32_t> deadlockStates;
+            for (uint64_t stateIndex = 0; stateIndex < chunk.size(); ++stateIndex) {
+                storm::generator::CompressedState const& state = chunk[stateIndex];
+                generator->load(state);
+                successors.clear();
+                successorIndices.clear();
+                storm::generator::StateBehavior<double, uint32_t> behavior = generator->expand(stateToIdCallback);
+
+                if (!deterministicModel) {
+                    writeRaw(rowGroupIndices, statistics.numberOfChoices);
+                }
+                if (behavior.empty()) {
+                    // If there is no behavior, we might have to introduce a self-loop.
+                    STORM_LOG_THROW(fixDeadlocks || !behavior.wasExpanded(), storm::exceptions::WrongFormatException,
+                                    "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                        << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+                    if (behavior.wasExpanded()) {
+                        deadlockStates.push_back(static_cast<uint32_t>(stateIndex));
+                    }
+                    writeRaw(rowIndications, statistics.numberOfTransitions);
+                    addTransition(state, 1.0);
+                    writeRaw(rowSizes, uint64_t(1));
+                    ++statistics.numberOfTransitions;
+                    ++statistics.numberOfChoices;
+                    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelInformation.size(); ++rewardModelIndex) {
+                        if (rewardModelInformation[rewardModelIndex].hasStateRewards()) {
+                            writeRaw(stateRewards[rewardModelIndex], 0.0);
+                        }
+                        if (rewardModelInformation[rewardModelIndex].hasStateActionRewards()) {
+                            writeRaw(stateActionRewards[rewardModelIndex], 0.0);
+                        }
+                    }
+                    if (rateTransitions) {
+                        writeRaw(exitRates, 1.0);
+                    }
+                } else {
+                    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelInformation.size(); ++rewardModelIndex) {
+                        if (rewardModelInformation[rewardModelIndex].hasStateRewards()) {
+                            writeRaw(stateRewards[rewardModelIndex], behavior.getStateRewards()[rewardModelIndex]);
+                        }
+                    }
+                    for (auto const& choice : behavior) {
+                        if (buildChoiceLabels && choice.hasLabels()) {
+                            for (auto const& label : choice.getLabels()) {
+                                getLabelWriter(choiceLabels, label, directory.path, "choice-label-").set(statistics.numberOfChoices);
+                            }
+                        }
+                        writeRaw(rowIndications, statistics.numberOfTransitions);
+                        double exitRate = 0.0;
+                        for (auto const& stateProbabilityPair : choice) {
+                            addTransition(successors[stateProbabilityPair.first], stateProbabilityPair.second);
+                            exitRate += stateProbabilityPair.second;
+                        }
+                        writeRaw(rowSizes, static_cast<uint64_t>(choice.size()));
+                        statistics.numberOfTransitions += choice.size();
+                        ++statistics.numberOfChoices;
+                        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelInformation.size(); ++rewardModelIndex) {
+                            if (rewardModelInformation[rewardModelIndex].hasStateActionRewards()) {
+                                writeRaw(stateActionRewards[rewardModelIndex], choice.getRewards()[rewardModelIndex]);
+                            }
+                        }
+                        if (rateTransitions) {
+                            writeRaw(exitRates, exitRate);
+                        }
+                    }
+                }
+                if (generator->isPartiallyObservable()) {
+                    writeRaw(observations, generator->observabilityClass(state));
+                }
+                // Hand the memory of the behavior back to the generator, so that it does not need to allocate when expanding the next state.
+                generator->recycle(std::move(behavior));
+                ++statistics.numberOfStates;
+            }
+
+            // Label the states of the chunk. For this, they are stored with their index in the chunk.
+            storm::storage::sparse::StateStorage<uint32_t> chunkStorage(generator->getStateSize());
+            for (uint64_t stateIndex = 0; stateIndex < chunk.size(); ++stateIndex) {
+                chunkStorage.stateToId.findOrAdd(chunk[stateIndex], static_cast<uint32_t>(stateIndex));
+            }
+            std::vector<uint32_t> initialStates;
+            for (uint64_t state = firstStateOfChunk; state < numberOfInitialStates && state < statistics.numberOfStates; ++state) {
+                initialStates.push_back(static_cast<uint32_t>(state - firstStateOfChunk));
+            }
+            storm::models::sparse::StateLabeling chunkLabeling = generator->label(chunkStorage, initialStates, deadlockStates);
+            for (auto const& label : chunkLabeling.getLabels()) {
+                BitFileWriter& writer = getLabelWriter(stateLabels, label, directory.path, "state-label-");
+                for (auto state : chunkLabeling.getStates(label)) {
+                    writer.set(firstStateOfChunk + state);
+                }
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+            }
+        }
+        closeFile(values, valuesFile);
+        closeFile(rowSizes, rowSizesFile);
+        std::remove(frontierFile.c_str());
+        targets.sort();
+
+        // Find the indices of the targets by merging them with the visited states. Targets that have not been visited before get
+        // new indices and form the next level.
+        storm::storage::ExternalSorter targetIndices(directory.getFile("target-indices-" + levelString), 2, 1, options.memoryLimit / 2);
+        frontierFile = directory.getFile("frontier-" + std::to_string(statistics.numberOfLevels + 1));
+        std::string const newVisitedRun = directory.getFile("visited-" + std::to_string(statistics.numberOfLevels + 1));
+        {
+            std::vector<storm::storage::RecordFileReader> visitedReaders;
+            std::vector<bool> visitedReaderHasRecord;
+            for (auto const& visitedRun : visitedRuns) {
+                visitedReaders.emplace_back(visitedRun, stateRecordSize);
+                visitedReaderHasRecord.push_back(visitedReaders.back().next());
+            }
+            storm::storage::RecordFileWriter nextFrontier(frontierFile, numberOfWords);
+            storm::storage::RecordFileWriter visited(newVisitedRun, stateRecordSize);
+
+            std::vector<uint64_t> previousTarget;
+            uint64_t targetIndex = 0;
+            std::vector<uint64_t> targetAndSlot(stateRecordSize);
+            while (targets.next(targetAndSlot.data())) {
+                uint64_t const slotOfTransition = targetAndSlot[numberOfWords];
+                if (previousTarget.empty() || !std::equal(previousTarget.begin(), previousTarget.end(), targetAndSlot.begin())) {
+                    previousTarget.assign(targetAndSlot.begin(), targetAndSlot.begin() + numberOfWords);
+                    bool visitedBefore = false;
+                    for (uint64_t reader = 0; reader < visitedReaders.size() && !visitedBefore; ++reader) {
+                        while (visitedReaderHasRecord[reader] && std::lexicographical_compare(visitedReaders[reader].get(),
+                                                                                              visitedReaders[reader].get() + numberOfWords,
+                                                                                              previousTarget.begin(), previousTarget.end())) {
+                            visitedReaderHasRecord[reader] = visitedReaders[reader].next();
+                        }
+                        if (visitedReaderHasRecord[reader] && std::equal(previousTarget.begin(), previousTarget.end(), visitedReaders[reader].get())) {
+                            targetIndex = visitedReaders[reader].get()[numberOfWords];
+                            visitedBefore = true;
+                        }
+                    }
+                    if (!visitedBefore) {
+                        targetIndex = numberOfDiscoveredStates++;
+                        nextFrontier.write(previousTarget.data());
+                        targetAndSlot[numberOfWords] = targetIndex;
+                        visited.write(targetAndSlot.data());
+                    }
+                }
+                uint64_t slotAndIndex[2] = {slotOfTransition, targetIndex};
+                targetIndices.add(slotAndIndex);
+            }
+            nextFrontier.close();
+            visited.close();
+            frontierSize = nextFrontier.getNumberOfRecords();
+        }
+        visitedRuns.push_back(newVisitedRun);
+        if (visitedRuns.size() > maximalNumberOfVisitedRuns) {
+            std::string const mergedRun = directory.getFile("visited-merged-" + levelString);
+            storm::storage::ExternalSorter::mergeFiles(visitedRuns, mergedRun, stateRecordSize, numberOfWords);
+            for (auto const& visitedRun : visitedRuns) {
+                std::remove(visitedRun.c_str());
+            }
+            visitedRuns = {mergedRun};
+        }
+
+        // Write the transitions of the level to the model file. Within each row, the entries are sorted by their columns.
+        targetIndices.sort();
+        {
+            std::ifstream levelValues = openInputFile(valuesFile);
+            std::ifstream levelRowSizes = openInputFile(rowSizesFile);
+            std::vector<std::pair<uint64_t, double>> rowEntries;
+            uint64_t slotAndIndex[2];
+            for (uint64_t row = firstRowOfLevel; row < statistics.numberOfChoices; ++row) {
+                rowEntries.resize(readRaw<uint64_t>(levelRowSizes));
+                for (auto& entry : rowEntries) {
+                    targetIndices.next(slotAndIndex);
+                    entry = std::make_pair(slotAndIndex[1], readRaw<double>(levelValues));
+                }
+                std::sort(rowEntries.begin(), rowEntries.end());
+                for (auto const& entry : rowEntries) {
+                    writeRaw(output, entry.first);
+                    writeRaw(output, entry.second);
+                }
+            }
+        }
+        std::remove(valuesFile.c_str());
+        std::remove(rowSizesFile.c_str());
+
+        ++statistics.numberOfLevels;
+        STORM_LOG_DEBUG("Explored level " << statistics.numberOfLevels << " of the state space, " << statistics.numberOfStates << " states so far.");
+        if (generator->getOptions().isShowProgressSet()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << statistics.numberOfLevels << " levels with " << statistics.numberOfStates << " states in " << durationSinceStart
+                      << " seconds.\n";
+        }
+    }
+    STORM_LOG_ASSERT(numberOfDiscoveredStates == statistics.numberOfStates, "Unexpected number of states.");
+
+    // Finish the components and append them to the model file.
+    writeRaw(rowIndications, statistics.numberOfTransitions);
+    writeRaw(rowGroupIndices, statistics.numberOfChoices);
+    closeFile(rowIndications, rowIndicationsFile);
+    closeFile(rowGroupIndices, rowGroupIndicesFile);
+    closeFile(exitRates, exitRatesFile);
+    closeFile(observations, observationsFile);
+    uint64_t const entriesSize = statistics.numberOfTransitions * (sizeof(uint64_t) + sizeof(double));
+    writePadding(output, entriesSize);
+
+    copySection(output, SectionType::RowIndications, "", rowIndicationsFile);
+    if (!deterministicModel) {
+        copySection(output, SectionType::RowGroupIndices, "", rowGroupIndicesFile);
+    }
+    for (auto& label : stateLabels) {
+        label.second.close(statistics.numberOfStates);
+        copySection(output, SectionType::StateLabel, label.first, label.second.getFilename());
+    }
+    for (auto& label : choiceLabels) {
+        label.second.close(statistics.numberOfChoices);
+        copySection(output, SectionType::ChoiceLabel, label.first, label.second.getFilename());
+    }
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelInformation.size(); ++rewardModelIndex) {
+        closeFile(stateRewards[rewardModelIndex], stateRewardFiles[rewardModelIndex]);
+        closeFile(stateActionRewards[rewardModelIndex], stateActionRewardFiles[rewardModelIndex]);
+        if (rewardModelInformation[rewardModelIndex].hasStateRewards()) {
+            copySection(output, SectionType::StateRewards, rewardModelInformation[rewardModelIndex].getName(), stateRewardFiles[rewardModelIndex]);
+        }
+        if (rewardModelInformation[rewardModelIndex].hasStateActionRewards()) {
+            copySection(output, SectionType::StateActionRewards, rewardModelInformation[rewardModelIndex].getName(),
+                        stateActionRewardFiles[rewardModelIndex]);
+        }
+    }
+    if (rateTransitions) {
+        copySection(output, SectionType::ExitRates, "", exitRatesFile);
+    }
+    if (generator->isPartiallyObservable()) {
+        copySection(output, SectionType::Observations, "", observationsFile);
+    }
+    SectionHeader endHeader{SectionType::End, 0, 0, 0};
+    writeRaw(output, endHeader);
+
+    // Now that all sizes are known, write the headers.
+    fileHeader.numberOfStates = statistics.numberOfStates;
+    fileHeader.numberOfChoices = statistics.numberOfChoices;
+    fileHeader.numberOfEntries = statistics.numberOfTransitions;
+    entriesHeader.dataSize = entriesSize;
+    output.seekp(0);
+    writeRaw(output, fileHeader);
+    writeRaw(output, entriesHeader);
+    closeFile(output, filename);
+
+    STORM_LOG_INFO("Explored " << statistics.numberOfStates << " states with " << statistics.numberOfTransitions << " transitions in "
+                               << statistics.numberOfLevels << " levels and wrote the model to " << filename << ".");
+    return statistics;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "storm/generator/NextStateGenerator.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+/*!
+ * Builds the explicit model of a PRISM program or JANI model without keeping the state space in main memory. The model is written to a
+ * file in the binary model format (see storm/io/BinaryModelFormat.h), from which it can be loaded (or memory-mapped) later.
+ *
+ * The state space is explored breadth-first with delayed duplicate detection: While the states of a level are expanded, their successors
+ * are only written to disk together with the position of the transition that leads to them. After the level, the successors are sorted
+ * (externally) and merged with the sorted runs of the states visited so far, which yields the indices of the known successors and the new
+ * states that form the next level. The transitions of the level are then written to the model file in the order of their source states.
+ * Thus, only a bounded number of states and transitions is held in memory at any time.
+ *
+ * The states are numbered level by level, but within a level, the states are numbered in the order of their encoding (and not in the
+ * order in which they are discovered as for ExplicitModelBuilder). Discrete- and continuous-time Markov chains, MDPs and POMDPs are
+ * supported. State valuations, choice origins and transition rewards are not built.
+ */
+class ExternalMemoryModelBuilder {
+   public:
+    struct Options {
+        /*!
+         * Creates an object representing the default building options.
+         */
+        Options();
+
+        // The directory in which the temporary files are stored.
+        std::string workingDirectory;
+
+        // The number of bytes of main memory that may be used to sort states and transitions.
+        uint64_t memoryLimit;
+
+        // Whether deadlock states are made absorbing by adding a self-loop.
+        bool fixDeadlocks;
+    };
+
+    /*!
+     * Information about the model that was built.
+     */
+    struct Statistics {
+        uint64_t numberOfStates = 0;
+        uint64_t numberOfChoices = 0;
+        uint64_t numberOfTransitions = 0;
+        uint64_t numberOfLevels = 0;
+    };
+
+    /*!
+     * Creates a builder that uses the provided generator.
+     */
+    ExternalMemoryModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> const& generator, Options const& options = Options());
+
+    /*!
+     * Creates a builder for the given PRISM program.
+     */
+    ExternalMemoryModelBuilder(storm::prism::Program const& program,
+                               storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions(),
+                               Options const& builderOptions = Options());
+
+    /*!
+     * Creates a builder for the given JANI model.
+     */
+    ExternalMemoryModelBuilder(storm::jani::Model const& model,
+                               storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions(),
+                               Options const& builderOptions = Options());
+
+    /*!
+     * Explores the state space and writes the model to the given file in the binary model format.
+     *
+     * @param filename The file to write the model to.
+     * @return Information about the built model.
+     */
+    Statistics build(std::string const& filename);
+
+   private:
+    /// The generator to use for the building process.
+    std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> generator;
+
+    /// The options to be used for the building process.
+    Options options;
+};
+
+}  // namespace builder
+}  // namespace storm
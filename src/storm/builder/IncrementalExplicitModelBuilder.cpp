@@ -0,0 +1,125 @@
+#include "storm/builder/IncrementalExplicitModelBuilder.h"
+
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/BoostTypes.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+template<typename T>
+std::string toString(T const& object) {
+    std::stringstream stream;
+    stream << object;
+    return stream.str();
+}
+}  // namespace
+
+template<typename ValueType>
+IncrementalExplicitModelBuilder<ValueType>::IncrementalExplicitModelBuilder(storm::generator::NextStateGeneratorOptions const& generatorOptions,
+                                                                            typename ExplicitModelBuilder<ValueType>::Options const& builderOptions)
+    : generatorOptions(generatorOptions), builderOptions(builderOptions) {
+    // The behavior of a state must only depend on the commands that are enabled in it.
+    STORM_LOG_THROW(!generatorOptions.isSymmetryReductionSet() && !generatorOptions.isPartialOrderReductionSet() &&
+                        !generatorOptions.isAddOverlappingGuardLabelSet() && !generatorOptions.isAddOutOfBoundsStateSet(),
+                    storm::exceptions::IllegalArgumentException,
+                    "Incremental building does not support reductions of the state space, labeling overlapping guards and out-of-bounds states.");
+    this->builderOptions.explorationOrder = ExplorationOrder::Bfs;
+    this->builderOptions.numberOfThreads = 1;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalExplicitModelBuilder<ValueType>::build(storm::prism::Program const& program) {
+    storm::prism::Program preparedProgram = program.substituteConstantsFormulas();
+    auto generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(preparedProgram, generatorOptions);
+
+    bool reuseRecord = false;
+    if (previousProgram && record && record->stateToId) {
+        boost::optional<std::vector<storm::expressions::Expression>> guards = getGuardsOfChangedCommands(previousProgram.get(), preparedProgram);
+        if (guards) {
+            markOutdatedStates(guards.get(), generator->getVariableInformation(), preparedProgram.getManager());
+            STORM_LOG_INFO("Program changed in " << guards->size() / 2 << " commands, which affect " << record->outdatedStates.getNumberOfSetBits()
+                                                 << " of " << record->states.size() << " previously explored states.");
+            reuseRecord = true;
+        } else {
+            STORM_LOG_INFO("Program changed in other aspects than its commands. Building the model from scratch.");
+        }
+    }
+    if (!reuseRecord) {
+        record = std::make_shared<ExplorationRecord<ValueType, uint32_t>>();
+    }
+
+    typename ExplicitModelBuilder<ValueType>::Options options = builderOptions;
+    options.explorationRecord = record;
+    auto result = ExplicitModelBuilder<ValueType>(generator, options).build();
+    previousProgram = std::move(preparedProgram);
+    return result;
+}
+
+template<typename ValueType>
+uint64_t IncrementalExplicitModelBuilder<ValueType>::getNumberOfReusedStates() const {
+    return record ? record->numberOfReusedStates : 0;
+}
+
+template<typename ValueType>
+boost::optional<std::vector<storm::expressions::Expression>> IncrementalExplicitModelBuilder<ValueType>::getGuardsOfChangedCommands(
+    storm::prism::Program const& previousProgram, storm::prism::Program const& program) {
+    // Apart from the commands, the programs have to coincide. The action indices need to be the same as they are part of the behaviors.
+    storm::storage::FlatSet<uint_fast64_t> noCommands;
+    if (toString(previousProgram.restrictCommands(noCommands)) != toString(program.restrictCommands(noCommands)) ||
+        previousProgram.getActionNameToIndexMapping() != program.getActionNameToIndexMapping() ||
+        previousProgram.getNumberOfModules() != program.getNumberOfModules()) {
+        return boost::none;
+    }
+
+    std::vector<storm::expressions::Expression> guards;
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        storm::prism::Module const& previousModule = previousProgram.getModule(moduleIndex);
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        if (previousModule.getNumberOfCommands() != module.getNumberOfCommands()) {
+            return boost::none;
+        }
+        for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+            storm::prism::Command const& previousCommand = previousModule.getCommand(commandIndex);
+            storm::prism::Command const& command = module.getCommand(commandIndex);
+            if (toString(previousCommand) != toString(command)) {
+                guards.push_back(previousCommand.getGuardExpression().changeManager(program.getManager()));
+                guards.push_back(command.getGuardExpression());
+            }
+        }
+    }
+    return guards;
+}
+
+template<typename ValueType>
+void IncrementalExplicitModelBuilder<ValueType>::markOutdatedStates(std::vector<storm::expressions::Expression> const& guards,
+                                                                    storm::generator::VariableInformation const& variableInformation,
+                                                                    storm::expressions::ExpressionManager const& manager) {
+    // Instead of maintaining an index from commands to the states in which they are enabled, the (few) changed guards are evaluated
+    // in all recorded states, which is much cheaper than expanding the states.
+    storm::expressions::ExpressionEvaluator<ValueType> evaluator(manager);
+    for (uint64_t stateIndex = 0; stateIndex < record->states.size(); ++stateIndex) {
+        storm::generator::unpackStateIntoEvaluator(record->states[stateIndex], variableInformation, evaluator);
+        for (auto const& guard : guards) {
+            if (evaluator.asBool(guard)) {
+                record->outdatedStates.set(stateIndex);
+                break;
+            }
+        }
+    }
+}
+
+template class IncrementalExplicitModelBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class IncrementalExplicitModelBuilder<storm::RationalNumber>;
+#endif
+}  // namespace builder
+}  // namespace storm
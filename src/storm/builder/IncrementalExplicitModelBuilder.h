@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the explicit models of a sequence of PRISM programs that differ only slightly, e.g., in the probabilities or guards of a few
+ * commands. The exploration of each program is recorded. When the next program only differs from the previous one in the guards and
+ * updates of some commands, only the states in which one of the changed commands is enabled (before or after the change) are expanded
+ * again. The recorded behavior of all other states is reused, and states that were not reachable before are explored as usual.
+ *
+ * If the programs differ in any other way (e.g., in their variables, labels, reward models or the number of commands), the model is built
+ * from scratch. The resulting models coincide with the ones built by ExplicitModelBuilder up to the numbering of the states. Note that the
+ * record holds all states together with their behaviors, so it takes (at least) as much memory as the model itself.
+ */
+template<typename ValueType>
+class IncrementalExplicitModelBuilder {
+   public:
+    /*!
+     * Creates a builder with the given options. The exploration order of the builder options is ignored, as the states are always
+     * explored sequentially in breadth-first order.
+     */
+    IncrementalExplicitModelBuilder(
+        storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions(),
+        typename ExplicitModelBuilder<ValueType>::Options const& builderOptions = typename ExplicitModelBuilder<ValueType>::Options());
+
+    /*!
+     * Builds the model of the given program. If possible, the behaviors recorded while building the previous model are reused.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(storm::prism::Program const& program);
+
+    /*!
+     * Retrieves the number of states whose recorded behavior was reused while building the last model.
+     */
+    uint64_t getNumberOfReusedStates() const;
+
+   private:
+    /*!
+     * Retrieves the guards of the commands that differ in the given programs. For each changed command, both its previous and its current
+     * guard are returned (in terms of the variables of the current program). If the programs differ in other aspects than their commands,
+     * nothing is returned.
+     */
+    static boost::optional<std::vector<storm::expressions::Expression>> getGuardsOfChangedCommands(storm::prism::Program const& previousProgram,
+                                                                                                  storm::prism::Program const& program);
+
+    /*!
+     * Marks all recorded states in which one of the given guards is satisfied as outdated.
+     */
+    void markOutdatedStates(std::vector<storm::expressions::Expression> const& guards, storm::generator::VariableInformation const& variableInformation,
+                            storm::expressions::ExpressionManager const& manager);
+
+    /// The options for the generators.
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+
+    /// The options for the explicit model builders.
+    typename ExplicitModelBuilder<ValueType>::Options builderOptions;
+
+    /// The program (with substituted constants and formulas) of the model that was built last.
+    boost::optional<storm::prism::Program> previousProgram;
+
+    /// The record of the exploration of the model that was built last.
+    std::shared_ptr<ExplorationRecord<ValueType, uint32_t>> record;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -5,6 +5,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -24,14 +25,12 @@ template<typename ValueType>
 storm::models::sparse::StandardRewardModel<ValueType> RewardModelBuilder<ValueType>::build(uint_fast64_t rowCount, uint_fast64_t, uint_fast64_t rowGroupCount) {
     std::optional<std::vector<ValueType>> optionalStateRewardVector;
     if (hasStateRewards()) {
-        stateRewardVector.resize(rowGroupCount);
-        optionalStateRewardVector = std::move(stateRewardVector);
+        optionalStateRewardVector = stateRewardVector.build(rowGroupCount);
     }
 
     std::optional<std::vector<ValueType>> optionalStateActionRewardVector;
     if (hasStateActionRewards()) {
-        stateActionRewardVector.resize(rowCount);
-        optionalStateActionRewardVector = std::move(stateActionRewardVector);
+        optionalStateActionRewardVector = stateActionRewardVector.build(rowCount);
     }
 
     return storm::models::sparse::StandardRewardModel<ValueType>(std::move(optionalStateRewardVector), std::move(optionalStateActionRewardVector));
@@ -44,12 +43,12 @@ std::string const& RewardModelBuilder<ValueType>::getName() const {
 
 template<typename ValueType>
 void RewardModelBuilder<ValueType>::addStateReward(ValueType const& value) {
-    stateRewardVector.push_back(value);
+    stateRewardVector.add(value);
 }
 
 template<typename ValueType>
 void RewardModelBuilder<ValueType>::addStateActionReward(ValueType const& value) {
-    stateActionRewardVector.push_back(value);
+    stateActionRewardVector.add(value);
 }
 
 template<typename ValueType>
@@ -62,6 +61,42 @@ bool RewardModelBuilder<ValueType>::hasStateActionRewards() const {
     return stateActionRewards;
 }
 
+template<typename ValueType>
+void RewardModelBuilder<ValueType>::RewardVectorBuilder::add(ValueType const& value) {
+    if (dense) {
+        values.push_back(value);
+        return;
+    }
+    if (!storm::utility::isZero(value)) {
+        nonZeroEntries.emplace_back(numberOfEntries, value);
+    }
+    ++numberOfEntries;
+    // Storing an entry together with its index takes (at least) twice the space of a plain entry. To not switch too early when the first
+    // explored states happen to have rewards, only consider switching once a few entries have been collected.
+    if (numberOfEntries >= 1024 && 2 * nonZeroEntries.size() > numberOfEntries) {
+        switchToDense();
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> RewardModelBuilder<ValueType>::RewardVectorBuilder::build(uint_fast64_t size) {
+    if (!dense) {
+        switchToDense();
+    }
+    values.resize(size, storm::utility::zero<ValueType>());
+    return std::move(values);
+}
+
+template<typename ValueType>
+void RewardModelBuilder<ValueType>::RewardVectorBuilder::switchToDense() {
+    values.assign(numberOfEntries, storm::utility::zero<ValueType>());
+    for (auto& entry : nonZeroEntries) {
+        values[entry.first] = std::move(entry.second);
+    }
+    std::vector<std::pair<uint_fast64_t, ValueType>>().swap(nonZeroEntries);
+    dense = true;
+}
+
 template class RewardModelBuilder<double>;
 template class RewardModelBuilder<storm::RationalNumber>;
 template class RewardModelBuilder<storm::RationalFunction>;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "storm/builder/RewardModelInformation.h"
@@ -35,16 +37,39 @@ class RewardModelBuilder {
     bool hasStateActionRewards() const;
 
    private:
+    /*!
+     * Collects the entries of a reward vector. As long as only few entries are non-zero, just these are stored, which keeps the memory
+     * consumption low during exploration of models whose rewards are only assigned to few states or choices. Once the vector turns out to
+     * be dense, the entries are stored in a plain vector.
+     */
+    class RewardVectorBuilder {
+       public:
+        void add(ValueType const& value);
+
+        /*!
+         * Retrieves the (dense) vector of the collected entries, padded with zeros to the given size.
+         */
+        std::vector<ValueType> build(uint_fast64_t size);
+
+       private:
+        void switchToDense();
+
+        uint_fast64_t numberOfEntries = 0;
+        bool dense = false;
+        std::vector<ValueType> values;
+        std::vector<std::pair<uint_fast64_t, ValueType>> nonZeroEntries;
+    };
+
     std::string rewardModelName;
 
     bool stateRewards;
     bool stateActionRewards;
 
     // The state reward vector.
-    std::vector<ValueType> stateRewardVector;
+    RewardVectorBuilder stateRewardVector;
 
     // The state-action reward vector.
-    std::vector<ValueType> stateActionRewardVector;
+    RewardVectorBuilder stateActionRewardVector;
 };
 
 }  // namespace builder
@@ -0,0 +1,287 @@
+#include "storm/builder/StateSpaceEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+
+typedef storm::generator::CompressedState CompressedState;
+
+uint64_t drawIndex(storm::utility::CounterBasedRandomGenerator& random, uint64_t size) {
+    return std::min(static_cast<uint64_t>(random.random() * static_cast<double>(size)), size - 1);
+}
+
+/*!
+ * Counts the choices and transitions that the explicit model builder creates for the given behavior, which includes the self-loop of
+ * deadlock states.
+ */
+void countBehavior(storm::generator::StateBehavior<double, uint32_t> const& behavior, uint64_t& numberOfChoices, uint64_t& numberOfTransitions) {
+    if (behavior.empty()) {
+        ++numberOfChoices;
+        ++numberOfTransitions;
+    } else {
+        numberOfChoices += behavior.getNumberOfChoices();
+        for (auto const& choice : behavior) {
+            numberOfTransitions += choice.size();
+        }
+    }
+}
+
+StateSpaceEstimator::Quantity scale(StateSpaceEstimator::Quantity const& quantity, double factor) {
+    return {quantity.value * factor, quantity.lower * factor, quantity.upper * factor};
+}
+
+/*!
+ * Roughly estimates the memory (in bytes) of the transition matrix and the state storage of the explicit model.
+ */
+double estimateMemory(double numberOfStates, double numberOfChoices, double numberOfTransitions, uint64_t stateSize) {
+    // The entries of the matrix consist of a column and a value, the rows and row groups are given by the index of their first entry (row).
+    double const matrixBytes = numberOfTransitions * (sizeof(uint_fast64_t) + sizeof(double)) + (numberOfChoices + numberOfStates) * sizeof(uint_fast64_t);
+    // The state storage holds the encoding of each state together with its index and is filled to at most three quarters.
+    double const storageBytes = numberOfStates * static_cast<double>((stateSize + 63) / 64 * 8 + sizeof(uint32_t)) * 4.0 / 3.0;
+    return matrixBytes + storageBytes;
+}
+
+void writeQuantity(std::ostream& out, std::string const& name, StateSpaceEstimator::Quantity const& quantity, bool exact) {
+    out << "\t" << name << ": " << quantity.value;
+    if (!exact) {
+        out << " [" << quantity.lower << ", " << quantity.upper << "]";
+    }
+    out << '\n';
+}
+
+}  // namespace
+
+StateSpaceEstimator::Options::Options()
+    : prefixSize(storm::settings::getModule<storm::settings::modules::BuildSettings>().getEstimatePrefixSize()),
+      numberOfWalks(storm::settings::getModule<storm::settings::modules::BuildSettings>().getEstimateNumberOfWalks()),
+      maximalWalkLength(10000),
+      confidence(0.95),
+      seed(0) {
+    // Intentionally left empty.
+}
+
+void StateSpaceEstimator::Estimate::writeToStream(std::ostream& out) const {
+    if (exact) {
+        out << "State space was explored completely:\n";
+    } else {
+        out << "Estimated size of the state space (with " << confidence * 100.0 << "% confidence intervals) after expanding " << numberOfExpandedStates
+            << " and encountering " << numberOfEncounteredStates << " states:\n";
+    }
+    writeQuantity(out, "States", states, exact);
+    writeQuantity(out, "Choices", choices, exact);
+    writeQuantity(out, "Transitions", transitions, exact);
+    writeQuantity(out, "Memory (MB)", scale(memory, 1.0 / (1024.0 * 1024.0)), exact);
+    if (!exact) {
+        writeQuantity(out, "States (Knuth's estimator)", knuthStates, false);
+        writeQuantity(out, "States (capture-recapture with " + std::to_string(numberOfRecaptures) + " recaptures)", captureRecaptureStates, false);
+    }
+}
+
+StateSpaceEstimator::StateSpaceEstimator(std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> const& generator, Options const& options)
+    : generator(generator), options(options) {
+    // Intentionally left empty.
+}
+
+StateSpaceEstimator::StateSpaceEstimator(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions,
+                                         Options const& estimatorOptions)
+    : StateSpaceEstimator(std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program, generatorOptions), estimatorOptions) {
+    // Intentionally left empty.
+}
+
+StateSpaceEstimator::StateSpaceEstimator(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions,
+                                         Options const& estimatorOptions)
+    : StateSpaceEstimator(std::make_shared<storm::generator::JaniNextStateGenerator<double, uint32_t>>(model, generatorOptions), estimatorOptions) {
+    // Intentionally left empty.
+}
+
+StateSpaceEstimator::Estimate StateSpaceEstimator::estimate() {
+    STORM_LOG_THROW(options.numberOfWalks >= 2, storm::exceptions::InvalidArgumentException, "Estimating the state space requires at least two walks.");
+    STORM_LOG_THROW(options.confidence > 0.0 && options.confidence < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The confidence level must be in (0, 1).");
+    Estimate result;
+    result.confidence = options.confidence;
+    uint64_t numberOfChoices = 0;
+    uint64_t numberOfTransitions = 0;
+
+    // The states discovered by the prefix. States are expanded in the order of their indices, so the first states are expanded and
+    // the remaining ones form the frontier.
+    std::vector<CompressedState> states;
+    std::unordered_map<CompressedState, uint32_t> stateIndices;
+    std::function<uint32_t(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) {
+        auto indexIt = stateIndices.emplace(state, static_cast<uint32_t>(states.size()));
+        if (indexIt.second) {
+            states.push_back(state);
+        }
+        return indexIt.first->second;
+    };
+    generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!states.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+
+    uint64_t numberOfExpandedStates = 0;
+    while (numberOfExpandedStates < states.size() && numberOfExpandedStates < options.prefixSize) {
+        // Expanding may add states, so the loaded state must not be an element of the vector.
+        CompressedState currentState = states[numberOfExpandedStates];
+        generator->load(currentState);
+        storm::generator::StateBehavior<double, uint32_t> behavior = generator->expand(stateToIdCallback);
+        countBehavior(behavior, numberOfChoices, numberOfTransitions);
+        generator->recycle(std::move(behavior));
+        ++numberOfExpandedStates;
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space estimation.");
+        }
+    }
+    uint64_t const prefixSize = numberOfExpandedStates;
+
+    if (prefixSize == states.size()) {
+        result.exact = true;
+        result.numberOfEncounteredStates = states.size();
+        result.numberOfExpandedStates = prefixSize;
+        double const exactStates = static_cast<double>(states.size());
+        result.states = {exactStates, exactStates, exactStates};
+        result.choices = {static_cast<double>(numberOfChoices), static_cast<double>(numberOfChoices), static_cast<double>(numberOfChoices)};
+        result.transitions = {static_cast<double>(numberOfTransitions), static_cast<double>(numberOfTransitions), static_cast<double>(numberOfTransitions)};
+        double const exactMemory = estimateMemory(exactStates, result.choices.value, result.transitions.value, generator->getStateSize());
+        result.memory = {exactMemory, exactMemory, exactMemory};
+        return result;
+    }
+
+    // Sample the unexplored part of the state space, i.e., the frontier and the states that are not yet discovered, with random walks.
+    uint64_t const frontierSize = states.size() - prefixSize;
+    std::vector<double> knuthEstimates;
+    knuthEstimates.reserve(options.numberOfWalks);
+    std::unordered_set<CompressedState> samples[2];
+    std::unordered_set<CompressedState> visitedByWalk;
+    std::vector<CompressedState> successors;
+    std::vector<CompressedState> candidates;
+    std::function<uint32_t(CompressedState const&)> successorCallback = [&successors](CompressedState const& state) {
+        successors.push_back(state);
+        return static_cast<uint32_t>(successors.size() - 1);
+    };
+    for (uint64_t walk = 0; walk < options.numberOfWalks; ++walk) {
+        storm::utility::CounterBasedRandomGenerator random(options.seed, walk);
+        std::unordered_set<CompressedState>& sample = samples[walk % 2];
+        visitedByWalk.clear();
+        CompressedState currentState = states[prefixSize + drawIndex(random, frontierSize)];
+        visitedByWalk.insert(currentState);
+        sample.insert(currentState);
+
+        // The weight is the estimated number of nodes at the current depth of the tree.
+        double weight = static_cast<double>(frontierSize);
+        double knuthEstimate = weight;
+        for (uint64_t step = 0; step < options.maximalWalkLength; ++step) {
+            successors.clear();
+            generator->load(currentState);
+            storm::generator::StateBehavior<double, uint32_t> behavior = generator->expand(successorCallback);
+            countBehavior(behavior, numberOfChoices, numberOfTransitions);
+            generator->recycle(std::move(behavior));
+            ++numberOfExpandedStates;
+
+            // The children of a state in the tree are its distinct successors that are neither discovered by the prefix nor visited before.
+            candidates.clear();
+            for (auto const& successor : successors) {
+                if (stateIndices.count(successor) == 0 && visitedByWalk.count(successor) == 0 &&
+                    std::find(candidates.begin(), candidates.end(), successor) == candidates.end()) {
+                    candidates.push_back(successor);
+                }
+            }
+            if (candidates.empty()) {
+                break;
+            }
+            weight *= static_cast<double>(candidates.size());
+            knuthEstimate += weight;
+            currentState = candidates[drawIndex(random, candidates.size())];
+            visitedByWalk.insert(currentState);
+            sample.insert(currentState);
+        }
+        knuthEstimates.push_back(knuthEstimate);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space estimation.");
+        }
+    }
+
+    double const z = boost::math::quantile(boost::math::normal(), (1.0 + options.confidence) / 2.0);
+    double const numberOfPrefixStates = static_cast<double>(prefixSize);
+    uint64_t numberOfSampledStates = samples[0].size();
+    uint64_t numberOfRecaptures = 0;
+    for (auto const& state : samples[1]) {
+        if (samples[0].count(state) > 0) {
+            ++numberOfRecaptures;
+        } else {
+            ++numberOfSampledStates;
+        }
+    }
+    uint64_t numberOfUnsampledFrontierStates = 0;
+    for (uint64_t index = prefixSize; index < states.size(); ++index) {
+        if (samples[0].count(states[index]) == 0 && samples[1].count(states[index]) == 0) {
+            ++numberOfUnsampledFrontierStates;
+        }
+    }
+    result.numberOfEncounteredStates = prefixSize + numberOfSampledStates + numberOfUnsampledFrontierStates;
+    result.numberOfExpandedStates = numberOfExpandedStates;
+    result.numberOfRecaptures = numberOfRecaptures;
+    double const minimalNumberOfStates = static_cast<double>(result.numberOfEncounteredStates);
+
+    // Knuth's estimate is the mean of the estimates of the walks, whose confidence interval follows from the central limit theorem.
+    double knuthMean = 0.0;
+    for (auto estimate : knuthEstimates) {
+        knuthMean += estimate;
+    }
+    knuthMean /= static_cast<double>(knuthEstimates.size());
+    double squaredDeviations = 0.0;
+    for (auto estimate : knuthEstimates) {
+        squaredDeviations += (estimate - knuthMean) * (estimate - knuthMean);
+    }
+    double const numberOfWalks = static_cast<double>(knuthEstimates.size());
+    double const knuthHalfWidth = z * std::sqrt(squaredDeviations / (numberOfWalks - 1.0) / numberOfWalks);
+    result.knuthStates = {std::max(numberOfPrefixStates + knuthMean, minimalNumberOfStates),
+                          std::max(numberOfPrefixStates + knuthMean - knuthHalfWidth, minimalNumberOfStates),
+                          std::max(numberOfPrefixStates + knuthMean + knuthHalfWidth, minimalNumberOfStates)};
+
+    // Chapman's estimator and its variance (Seber, 1970).
+    double const n1 = static_cast<double>(samples[0].size());
+    double const n2 = static_cast<double>(samples[1].size());
+    double const m = static_cast<double>(numberOfRecaptures);
+    double const chapman = (n1 + 1.0) * (n2 + 1.0) / (m + 1.0) - 1.0;
+    double const chapmanHalfWidth = z * std::sqrt((n1 + 1.0) * (n2 + 1.0) * (n1 - m) * (n2 - m) / ((m + 1.0) * (m + 1.0) * (m + 2.0)));
+    result.captureRecaptureStates = {std::max(numberOfPrefixStates + chapman, minimalNumberOfStates),
+                                     std::max(numberOfPrefixStates + chapman - chapmanHalfWidth, minimalNumberOfStates),
+                                     numberOfRecaptures > 0 ? std::max(numberOfPrefixStates + chapman + chapmanHalfWidth, minimalNumberOfStates)
+                                                            : std::numeric_limits<double>::infinity()};
+
+    // Without recaptures, the samples do not tell anything about the number of states beyond the sampled ones.
+    result.states = numberOfRecaptures > 0 ? result.captureRecaptureStates : result.knuthStates;
+    double const choicesPerState = static_cast<double>(numberOfChoices) / static_cast<double>(numberOfExpandedStates);
+    double const transitionsPerState = static_cast<double>(numberOfTransitions) / static_cast<double>(numberOfExpandedStates);
+    result.choices = scale(result.states, choicesPerState);
+    result.transitions = scale(result.states, transitionsPerState);
+    double const memoryPerState = estimateMemory(1.0, choicesPerState, transitionsPerState, generator->getStateSize());
+    result.memory = scale(result.states, memoryPerState);
+    return result;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+#include "storm/generator/NextStateGenerator.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+/*!
+ * Estimates the size of the explicit model of a PRISM program or JANI model without building it, e.g., to decide whether building is
+ * feasible at all or which engine is to be used.
+ *
+ * First, a prefix of the state space is explored (breadth-first) exhaustively. If this already explores all reachable states, the sizes
+ * are exact. Otherwise, the unexplored part is sampled by random walks that start in uniformly chosen states of the frontier of the
+ * prefix and are evaluated with two estimators:
+ * - Knuth's estimator for the size of a tree: Each walk moves to a uniformly chosen successor that was neither discovered by the prefix nor
+ *   visited by the walk before. The product of the numbers of such successors along the walk estimates the number of nodes at the current
+ *   depth of the tree of simple paths that start in the frontier. As states that are reachable via several paths are counted several
+ *   times (and only states within the maximal length of the walks are counted), this tends to overestimate the number of states.
+ * - Capture-recapture: The states visited by the walks are split into two samples (the even and the odd walks), whose overlap yields
+ *   Chapman's estimate of the total number of states. As the walks do not visit all states with the same probability, this tends to
+ *   underestimate the number of states.
+ * The predicted number of states is the capture-recapture estimate if the samples overlap and Knuth's estimate otherwise. The numbers of
+ * choices and transitions are predicted from the average numbers of choices and transitions of the expanded states.
+ */
+class StateSpaceEstimator {
+   public:
+    struct Options {
+        /*!
+         * Creates an object representing the default estimation options.
+         */
+        Options();
+
+        // The maximal number of states that are explored exhaustively.
+        uint64_t prefixSize;
+
+        // The number of random walks that sample the part of the state space that is not explored exhaustively.
+        uint64_t numberOfWalks;
+
+        // The maximal number of steps of a random walk.
+        uint64_t maximalWalkLength;
+
+        // The confidence level of the reported intervals.
+        double confidence;
+
+        // The seed of the random walks.
+        uint64_t seed;
+    };
+
+    /*!
+     * A predicted size together with a confidence interval.
+     */
+    struct Quantity {
+        double value = 0.0;
+        double lower = 0.0;
+        double upper = 0.0;
+    };
+
+    struct Estimate {
+        // Whether all reachable states were explored, i.e., the sizes are exact.
+        bool exact = false;
+
+        // The number of distinct states that were encountered.
+        uint64_t numberOfEncounteredStates = 0;
+
+        // The number of states that were expanded.
+        uint64_t numberOfExpandedStates = 0;
+
+        // The predicted sizes of the explicit model. The memory is given in bytes and only accounts for the transition matrix and the state
+        // storage.
+        Quantity states;
+        Quantity choices;
+        Quantity transitions;
+        Quantity memory;
+
+        // The confidence level of the intervals.
+        double confidence = 0.0;
+
+        // The estimates of the number of states obtained by the individual estimators. Only set if the estimate is not exact.
+        Quantity knuthStates;
+        Quantity captureRecaptureStates;
+
+        // The number of states that are contained in both samples of the capture-recapture estimator.
+        uint64_t numberOfRecaptures = 0;
+
+        void writeToStream(std::ostream& out) const;
+    };
+
+    /*!
+     * Creates an estimator that uses the provided generator.
+     */
+    StateSpaceEstimator(std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> const& generator, Options const& options = Options());
+
+    /*!
+     * Creates an estimator for the given PRISM program.
+     */
+    StateSpaceEstimator(storm::prism::Program const& program,
+                        storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions(),
+                        Options const& estimatorOptions = Options());
+
+    /*!
+     * Creates an estimator for the given JANI model.
+     */
+    StateSpaceEstimator(storm::jani::Model const& model,
+                        storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions(),
+                        Options const& estimatorOptions = Options());
+
+    /*!
+     * Estimates the size of the explicit model.
+     */
+    Estimate estimate();
+
+   private:
+    /// The generator that is used to explore the state space.
+    std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> generator;
+
+    /// The options of the estimation.
+    Options options;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -16,6 +16,11 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isLtl2daCacheDirectorySet()) {
+        ltl2daCacheDirectory = mcSettings.getLtl2daCacheDirectory();
+    }
+    hybridChunkBudget = mcSettings.getHybridChunkBudget() * 1024 * 1024;
+    filterRewZero = mcSettings.isFilterRewZeroSet();
 }
 
 ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -46,4 +51,36 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isLtl2daCacheDirectorySet() const {
+    return ltl2daCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getLtl2daCacheDirectory() const {
+    return ltl2daCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheDirectory(std::string const& value) {
+    ltl2daCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetLtl2daCacheDirectory() {
+    ltl2daCacheDirectory = boost::none;
+}
+
+uint64_t ModelCheckerEnvironment::getHybridChunkBudget() const {
+    return hybridChunkBudget;
+}
+
+void ModelCheckerEnvironment::setHybridChunkBudget(uint64_t value) {
+    hybridChunkBudget = value;
+}
+
+bool ModelCheckerEnvironment::isFilterRewZeroSet() const {
+    return filterRewZero;
+}
+
+void ModelCheckerEnvironment::setFilterRewZero(bool value) {
+    filterRewZero = value;
+}
+
 }  // namespace storm
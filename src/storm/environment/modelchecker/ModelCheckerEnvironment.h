@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -25,8 +26,32 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    /*!
+     * The directory in which deterministic automata for LTL formulas are cached across runs.
+     */
+    bool isLtl2daCacheDirectorySet() const;
+    std::string const& getLtl2daCacheDirectory() const;
+    void setLtl2daCacheDirectory(std::string const& value);
+    void unsetLtl2daCacheDirectory();
+
+    /*!
+     * The memory budget (in bytes) for the explicit representation of a chunk of SCCs solved by the hybrid engine. Zero disables chunking.
+     */
+    uint64_t getHybridChunkBudget() const;
+    void setHybridChunkBudget(uint64_t value);
+
+    /*!
+     * Whether the states with reward zero are determined via a graph analysis (instead of only taking the target states) when computing
+     * expected rewards.
+     */
+    bool isFilterRewZeroSet() const;
+    void setFilterRewZero(bool value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<std::string> ltl2daCacheDirectory;
+    uint64_t hybridChunkBudget;
+    bool filterRewZero;
 };
 }  // namespace storm
@@ -43,6 +43,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
 
     printResults = multiobjectiveSettings.isPrintResultsSet();
     useLexicographicModelChecking = multiobjectiveSettings.isLexicographicModelCheckingSet();
+    numberOfThreads = multiobjectiveSettings.getNumberOfThreads();
 }
 
 MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -168,4 +169,12 @@ bool MultiObjectiveModelCheckerEnvironment::isLexicographicModelCheckingSet() co
 void MultiObjectiveModelCheckerEnvironment::setLexicographicModelChecking(bool value) {
     useLexicographicModelChecking = value;
 }
+
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
 }  // namespace storm
\ No newline at end of file
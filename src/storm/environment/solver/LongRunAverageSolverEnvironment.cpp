@@ -19,6 +19,7 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    aggregationThreshold = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAggregationThreshold());
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +92,12 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+storm::RationalNumber const& LongRunAverageSolverEnvironment::getAggregationThreshold() const {
+    return aggregationThreshold;
+}
+
+void LongRunAverageSolverEnvironment::setAggregationThreshold(storm::RationalNumber value) {
+    aggregationThreshold = value;
+}
+
 }  // namespace storm
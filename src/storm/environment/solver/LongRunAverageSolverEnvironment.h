@@ -32,6 +32,9 @@ class LongRunAverageSolverEnvironment {
     storm::RationalNumber const& getAperiodicFactor() const;
     void setAperiodicFactor(storm::RationalNumber value);
 
+    storm::RationalNumber const& getAggregationThreshold() const;
+    void setAggregationThreshold(storm::RationalNumber value);
+
    private:
     storm::solver::LraMethod detMethod;
     bool detMethodSetFromDefault;
@@ -44,5 +47,6 @@ class LongRunAverageSolverEnvironment {
     boost::optional<uint64_t> maxIters;
 
     storm::RationalNumber aperiodicFactor;
+    storm::RationalNumber aggregationThreshold;
 };
 }  // namespace storm
@@ -5,6 +5,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidEnvironmentException.h"
+
 namespace storm {
 
 MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
@@ -25,6 +27,10 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    policyEvaluationMethod = minMaxSettings.getPolicyEvaluationMethod();
+    numberOfPolicyEvaluationSweeps = minMaxSettings.getNumberOfPolicyEvaluationSweeps();
+    maximalNumberOfStatesForSparsePolicyEvaluation = minMaxSettings.getMaximalNumberOfStatesForSparsePolicyEvaluation();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +90,37 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+storm::solver::PolicyEvaluationMethod const& MinMaxSolverEnvironment::getPolicyEvaluationMethod() const {
+    return policyEvaluationMethod;
+}
+
+void MinMaxSolverEnvironment::setPolicyEvaluationMethod(storm::solver::PolicyEvaluationMethod value) {
+    policyEvaluationMethod = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getNumberOfPolicyEvaluationSweeps() const {
+    return numberOfPolicyEvaluationSweeps;
+}
+
+void MinMaxSolverEnvironment::setNumberOfPolicyEvaluationSweeps(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of policy evaluation sweeps must be positive.");
+    numberOfPolicyEvaluationSweeps = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getMaximalNumberOfStatesForSparsePolicyEvaluation() const {
+    return maximalNumberOfStatesForSparsePolicyEvaluation;
+}
+
+void MinMaxSolverEnvironment::setMaximalNumberOfStatesForSparsePolicyEvaluation(uint64_t value) {
+    maximalNumberOfStatesForSparsePolicyEvaluation = value;
+}
+
+bool MinMaxSolverEnvironment::isMixedPrecision() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
 }  // namespace storm
@@ -26,6 +26,14 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isForceRequireUnique() const;
     void setForceRequireUnique(bool value);
+    storm::solver::PolicyEvaluationMethod const& getPolicyEvaluationMethod() const;
+    void setPolicyEvaluationMethod(storm::solver::PolicyEvaluationMethod value);
+    uint64_t const& getNumberOfPolicyEvaluationSweeps() const;
+    void setNumberOfPolicyEvaluationSweeps(uint64_t value);
+    uint64_t const& getMaximalNumberOfStatesForSparsePolicyEvaluation() const;
+    void setMaximalNumberOfStatesForSparsePolicyEvaluation(uint64_t value);
+    bool isMixedPrecision() const;
+    void setMixedPrecision(bool value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +43,9 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool forceRequireUnique;
+    storm::solver::PolicyEvaluationMethod policyEvaluationMethod;
+    uint64_t numberOfPolicyEvaluationSweeps;
+    uint64_t maximalNumberOfStatesForSparsePolicyEvaluation;
+    bool mixedPrecision;
 };
 }  // namespace storm
@@ -1,6 +1,7 @@
 #include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/MultiplierSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -11,6 +12,9 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    useCompactMatrix = multiplierSettings.isUseCompactMatrixSet();
+    useEncodedMatrix = multiplierSettings.isUseEncodedMatrixSet();
+    parallelize = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +34,28 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool MultiplierEnvironment::isUseCompactMatrixSet() const {
+    return useCompactMatrix;
+}
+
+void MultiplierEnvironment::setUseCompactMatrix(bool value) {
+    useCompactMatrix = value;
+}
+
+bool MultiplierEnvironment::isUseEncodedMatrixSet() const {
+    return useEncodedMatrix;
+}
+
+void MultiplierEnvironment::setUseEncodedMatrix(bool value) {
+    useEncodedMatrix = value;
+}
+
+bool MultiplierEnvironment::isParallelizeSet() const {
+    return parallelize;
+}
+
+void MultiplierEnvironment::setParallelize(bool value) {
+    parallelize = value;
+}
+
 }  // namespace storm
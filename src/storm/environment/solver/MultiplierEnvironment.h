@@ -14,8 +14,26 @@ class MultiplierEnvironment {
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
 
+    bool isUseCompactMatrixSet() const;
+    void setUseCompactMatrix(bool value);
+
+    /*!
+     * Whether the native multiplier uses a copy of the matrix with delta-encoded columns and dictionary-encoded values.
+     */
+    bool isUseEncodedMatrixSet() const;
+    void setUseEncodedMatrix(bool value);
+
+    /*!
+     * Whether matrix-vector multiplications are parallelized (if Intel TBB is available).
+     */
+    bool isParallelizeSet() const;
+    void setParallelize(bool value);
+
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool useCompactMatrix;
+    bool useEncodedMatrix;
+    bool parallelize;
 };
 }  // namespace storm
@@ -3,6 +3,8 @@
 #include "storm/environment/solver/AllSolverEnvironments.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/solver/ConvergenceTelemetry.h"
+#include "storm/solver/SolverCheckpoint.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/utility/macros.h"
@@ -18,6 +20,8 @@ SolverEnvironment::SolverEnvironment() {
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+    checkpointing = storm::solver::SolverCheckpointing::getDefault();
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +124,39 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+uint64_t SolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void SolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of threads must be positive.");
+    numberOfThreads = value;
+}
+
+void SolverEnvironment::setConvergenceTelemetry(std::shared_ptr<storm::solver::ConvergenceTelemetry> const& value) {
+    convergenceTelemetry = value;
+}
+
+std::shared_ptr<storm::solver::ConvergenceTelemetry> const& SolverEnvironment::getConvergenceTelemetry() const {
+    return convergenceTelemetry;
+}
+
+void SolverEnvironment::setConvergenceTelemetrySccIndex(std::optional<uint64_t> const& value) {
+    convergenceTelemetrySccIndex = value;
+}
+
+std::optional<uint64_t> const& SolverEnvironment::getConvergenceTelemetrySccIndex() const {
+    return convergenceTelemetrySccIndex;
+}
+
+void SolverEnvironment::setCheckpointing(std::shared_ptr<storm::solver::SolverCheckpointing> const& value) {
+    checkpointing = value;
+}
+
+std::shared_ptr<storm::solver::SolverCheckpointing> const& SolverEnvironment::getCheckpointing() const {
+    return checkpointing;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <optional>
 
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/environment/Environment.h"
@@ -10,6 +11,11 @@
 
 namespace storm {
 
+namespace solver {
+class ConvergenceTelemetry;
+class SolverCheckpointing;
+}  // namespace solver
+
 // Forward declare subenvironments
 class EigenSolverEnvironment;
 class GmmxxSolverEnvironment;
@@ -52,6 +58,27 @@ class SolverEnvironment {
     void setForceSoundness(bool value);
     bool isForceExact() const;
     void setForceExact(bool value);
+    uint64_t getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
+    /*!
+     * Sets the telemetry that receives (sampled) progress updates of the iterative solvers. Telemetry is disabled by default.
+     */
+    void setConvergenceTelemetry(std::shared_ptr<storm::solver::ConvergenceTelemetry> const& value);
+    std::shared_ptr<storm::solver::ConvergenceTelemetry> const& getConvergenceTelemetry() const;
+
+    /*!
+     * Sets the index of the SCC that is currently being solved, which is passed on to the convergence telemetry.
+     */
+    void setConvergenceTelemetrySccIndex(std::optional<uint64_t> const& value);
+    std::optional<uint64_t> const& getConvergenceTelemetrySccIndex() const;
+
+    /*!
+     * Sets the checkpointing that stores (and restores) the iterates of the iterative solvers. By default, the checkpointing given by the
+     * resource settings is used.
+     */
+    void setCheckpointing(std::shared_ptr<storm::solver::SolverCheckpointing> const& value);
+    std::shared_ptr<storm::solver::SolverCheckpointing> const& getCheckpointing() const;
 
     storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
     void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
@@ -78,5 +105,9 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    uint64_t numberOfThreads;
+    std::shared_ptr<storm::solver::ConvergenceTelemetry> convergenceTelemetry;
+    std::optional<uint64_t> convergenceTelemetrySccIndex;
+    std::shared_ptr<storm::solver::SolverCheckpointing> checkpointing;
 };
 }  // namespace storm
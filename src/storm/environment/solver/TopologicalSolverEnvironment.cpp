@@ -15,6 +15,11 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    directSolverThreshold = topologicalSettings.getDirectSolverThreshold();
+
+    adaptiveMethodSelection = topologicalSettings.isAdaptiveMethodSelectionSet();
+    adaptiveDirectEntryLimit = topologicalSettings.getAdaptiveDirectEntryLimit();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +56,28 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+uint64_t const& TopologicalSolverEnvironment::getDirectSolverThreshold() const {
+    return directSolverThreshold;
+}
+
+void TopologicalSolverEnvironment::setDirectSolverThreshold(uint64_t value) {
+    directSolverThreshold = value;
+}
+
+bool const& TopologicalSolverEnvironment::isAdaptiveMethodSelectionSet() const {
+    return adaptiveMethodSelection;
+}
+
+void TopologicalSolverEnvironment::setAdaptiveMethodSelection(bool value) {
+    adaptiveMethodSelection = value;
+}
+
+uint64_t const& TopologicalSolverEnvironment::getAdaptiveDirectEntryLimit() const {
+    return adaptiveDirectEntryLimit;
+}
+
+void TopologicalSolverEnvironment::setAdaptiveDirectEntryLimit(uint64_t value) {
+    adaptiveDirectEntryLimit = value;
+}
+
 }  // namespace storm
@@ -19,11 +19,25 @@ class TopologicalSolverEnvironment {
     bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
     void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
 
+    uint64_t const& getDirectSolverThreshold() const;
+    void setDirectSolverThreshold(uint64_t value);
+
+    bool const& isAdaptiveMethodSelectionSet() const;
+    void setAdaptiveMethodSelection(bool value);
+
+    uint64_t const& getAdaptiveDirectEntryLimit() const;
+    void setAdaptiveDirectEntryLimit(uint64_t value);
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
 
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
+
+    uint64_t directSolverThreshold;
+
+    bool adaptiveMethodSelection;
+    uint64_t adaptiveDirectEntryLimit;
 };
 }  // namespace storm
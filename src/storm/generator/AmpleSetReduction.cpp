@@ -0,0 +1,186 @@
+#include "storm/generator/AmpleSetReduction.h"
+
+#include <algorithm>
+
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+#include "storm/storage/jani/Location.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+struct AccessedVariables {
+    std::set<storm::expressions::Variable> read;
+    std::set<storm::expressions::Variable> written;
+    bool hasTransientAssignments = false;
+};
+
+void addAssignments(storm::jani::OrderedAssignments const& assignments, AccessedVariables& accessedVariables) {
+    for (auto const& assignment : assignments) {
+        if (assignment.isTransient()) {
+            accessedVariables.hasTransientAssignments = true;
+        } else {
+            accessedVariables.written.insert(assignment.getExpressionVariable());
+        }
+        auto variables = assignment.getAssignedExpression().getVariables();
+        accessedVariables.read.insert(variables.begin(), variables.end());
+    }
+}
+
+void addAccessedVariables(storm::jani::Edge const& edge, AccessedVariables& accessedVariables) {
+    auto guardVariables = edge.getGuard().getVariables();
+    accessedVariables.read.insert(guardVariables.begin(), guardVariables.end());
+    if (edge.hasRate()) {
+        auto rateVariables = edge.getRate().getVariables();
+        accessedVariables.read.insert(rateVariables.begin(), rateVariables.end());
+    }
+    addAssignments(edge.getAssignments(), accessedVariables);
+    for (auto const& destination : edge.getDestinations()) {
+        auto probabilityVariables = destination.getProbability().getVariables();
+        accessedVariables.read.insert(probabilityVariables.begin(), probabilityVariables.end());
+        addAssignments(destination.getOrderedAssignments(), accessedVariables);
+    }
+}
+
+bool intersect(std::set<storm::expressions::Variable> const& first, std::set<storm::expressions::Variable> const& second) {
+    auto firstIt = first.begin();
+    auto secondIt = second.begin();
+    while (firstIt != first.end() && secondIt != second.end()) {
+        if (*firstIt < *secondIt) {
+            ++firstIt;
+        } else if (*secondIt < *firstIt) {
+            ++secondIt;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * Computes a feedback vertex set of the location graph of the given automaton, i.e. a set of locations such that every cycle of the location
+ * graph visits one of them. The set consists of the targets of the back edges of a depth-first search.
+ */
+std::vector<bool> getFeedbackLocations(storm::jani::Automaton const& automaton) {
+    uint64_t numberOfLocations = automaton.getNumberOfLocations();
+    std::vector<std::vector<uint64_t>> successors(numberOfLocations);
+    for (auto const& edge : automaton.getEdges()) {
+        for (auto const& destination : edge.getDestinations()) {
+            successors[edge.getSourceLocationIndex()].push_back(destination.getLocationIndex());
+        }
+    }
+
+    // 0: unvisited, 1: on the stack, 2: finished.
+    std::vector<uint8_t> status(numberOfLocations, 0);
+    std::vector<bool> feedbackLocations(numberOfLocations, false);
+    std::vector<std::pair<uint64_t, uint64_t>> stack;
+    for (uint64_t root = 0; root < numberOfLocations; ++root) {
+        if (status[root] != 0) {
+            continue;
+        }
+        status[root] = 1;
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            auto& locationAndSuccessorIndex = stack.back();
+            uint64_t location = locationAndSuccessorIndex.first;
+            if (locationAndSuccessorIndex.second < successors[location].size()) {
+                uint64_t successor = successors[location][locationAndSuccessorIndex.second++];
+                if (status[successor] == 0) {
+                    status[successor] = 1;
+                    stack.emplace_back(successor, 0);
+                } else if (status[successor] == 1) {
+                    feedbackLocations[successor] = true;
+                }
+            } else {
+                status[location] = 2;
+                stack.pop_back();
+            }
+        }
+    }
+    return feedbackLocations;
+}
+}  // namespace
+
+AmpleSetReduction::AmpleSetReduction(std::vector<std::reference_wrapper<storm::jani::Automaton const>> const& automata,
+                                     std::vector<std::unordered_map<uint64_t, uint64_t>> const& nonSynchronizingEdges,
+                                     std::vector<std::set<uint64_t>> const& synchronizingEdges,
+                                     std::set<storm::expressions::Variable> const& visibleVariables)
+    : candidates(automata.size()) {
+    STORM_LOG_ASSERT(nonSynchronizingEdges.size() == automata.size() && synchronizingEdges.size() == automata.size(), "Inconsistent number of automata.");
+
+    // Determine the variables accessed by each automaton.
+    std::vector<AccessedVariables> accessedVariablesOfAutomata(automata.size());
+    for (uint64_t automatonIndex = 0; automatonIndex < automata.size(); ++automatonIndex) {
+        for (auto const& edge : automata[automatonIndex].get().getEdges()) {
+            addAccessedVariables(edge, accessedVariablesOfAutomata[automatonIndex]);
+        }
+    }
+
+    for (uint64_t automatonIndex = 0; automatonIndex < automata.size(); ++automatonIndex) {
+        storm::jani::Automaton const& automaton = automata[automatonIndex].get();
+
+        // Location changes of the automaton are visible if its locations have transient assignments.
+        bool locationsVisible = std::any_of(automaton.getLocations().begin(), automaton.getLocations().end(),
+                                            [](storm::jani::Location const& location) { return !location.getAssignments().empty(); });
+        if (locationsVisible) {
+            continue;
+        }
+
+        AccessedVariables accessedByOthers;
+        for (uint64_t otherAutomatonIndex = 0; otherAutomatonIndex < automata.size(); ++otherAutomatonIndex) {
+            if (otherAutomatonIndex != automatonIndex) {
+                auto const& otherAccessedVariables = accessedVariablesOfAutomata[otherAutomatonIndex];
+                accessedByOthers.read.insert(otherAccessedVariables.read.begin(), otherAccessedVariables.read.end());
+                accessedByOthers.written.insert(otherAccessedVariables.written.begin(), otherAccessedVariables.written.end());
+            }
+        }
+
+        std::vector<bool> feedbackLocations = getFeedbackLocations(automaton);
+        for (uint64_t locationIndex = 0; locationIndex < automaton.getNumberOfLocations(); ++locationIndex) {
+            if (feedbackLocations[locationIndex]) {
+                continue;
+            }
+            AccessedVariables accessedAtLocation;
+            std::vector<Candidate> candidatesAtLocation;
+            bool reducible = true;
+            for (auto const& edge : automaton.getEdgesFromLocation(locationIndex)) {
+                uint64_t edgeIndex = &edge - &automaton.getEdges().front();
+                auto outputIt = nonSynchronizingEdges[automatonIndex].find(edgeIndex);
+                if (synchronizingEdges[automatonIndex].count(edgeIndex) > 0) {
+                    reducible = false;
+                    break;
+                }
+                addAccessedVariables(edge, accessedAtLocation);
+                if (outputIt != nonSynchronizingEdges[automatonIndex].end()) {
+                    candidatesAtLocation.push_back({edgeIndex, &edge, outputIt->second});
+                }
+            }
+            reducible &= !candidatesAtLocation.empty() && !accessedAtLocation.hasTransientAssignments;
+            reducible &= !intersect(accessedAtLocation.written, accessedByOthers.read) && !intersect(accessedAtLocation.written, accessedByOthers.written);
+            reducible &= !intersect(accessedAtLocation.read, accessedByOthers.written) && !intersect(accessedAtLocation.written, visibleVariables);
+            if (reducible) {
+                candidates[automatonIndex].emplace(locationIndex, std::move(candidatesAtLocation));
+            }
+        }
+    }
+    STORM_LOG_INFO("Partial-order reduction applies to " << getNumberOfReducibleLocations() << " locations.");
+}
+
+std::vector<AmpleSetReduction::Candidate> const* AmpleSetReduction::getCandidates(uint64_t automatonIndex, uint64_t locationIndex) const {
+    auto candidatesIt = candidates[automatonIndex].find(locationIndex);
+    return candidatesIt == candidates[automatonIndex].end() ? nullptr : &candidatesIt->second;
+}
+
+uint64_t AmpleSetReduction::getNumberOfReducibleLocations() const {
+    uint64_t result = 0;
+    for (auto const& candidatesOfAutomaton : candidates) {
+        result += candidatesOfAutomaton.size();
+    }
+    return result;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace jani {
+class Automaton;
+class Edge;
+}  // namespace jani
+
+namespace generator {
+
+/*!
+ * Static information for a partial-order reduction of the interleavings of the automata of a JANI model based on ample sets.
+ *
+ * For a location of an automaton, the enabled edges of the automaton form an ample set if all of the following hold:
+ *   - all edges leaving the location are non-synchronizing and do not have transient assignments,
+ *   - the edges are independent of all edges of the other automata, i.e. they do not write variables that are read or written by the other
+ *     automata and they do not read variables that are written by the other automata,
+ *   - the edges do not write variables that are visible, i.e. that occur in labels or in the expressions defining terminal states; in addition,
+ *     the locations of the automaton may not have transient assignments,
+ *   - the location is not in a feedback vertex set of the location graph of the automaton, which ensures that every cycle of the reduced
+ *     state space contains a fully expanded state.
+ * Furthermore, an ample set may only be used if it consists of a single enabled edge. Under these conditions, the reduction preserves the
+ * maximal and minimal probabilities of properties of the probabilistic LTL without next operator over the visible variables.
+ */
+class AmpleSetReduction {
+   public:
+    struct Candidate {
+        // The index of the edge within its automaton.
+        uint64_t edgeIndex;
+        storm::jani::Edge const* edge;
+        // The index of the action that labels the choice of the edge.
+        uint64_t outputActionIndex;
+    };
+
+    /*!
+     * Computes the locations of the given automata that admit an ample set.
+     *
+     * @param automata The automata that are put in parallel.
+     * @param nonSynchronizingEdges For each automaton a mapping from the indices of the edges that are taken without synchronizing with other
+     * automata to the index of the output action with which they are taken.
+     * @param synchronizingEdges For each automaton the indices of the edges that participate in synchronizations.
+     * @param visibleVariables The variables that are visible.
+     */
+    AmpleSetReduction(std::vector<std::reference_wrapper<storm::jani::Automaton const>> const& automata,
+                      std::vector<std::unordered_map<uint64_t, uint64_t>> const& nonSynchronizingEdges,
+                      std::vector<std::set<uint64_t>> const& synchronizingEdges, std::set<storm::expressions::Variable> const& visibleVariables);
+
+    /*!
+     * Retrieves the edges of the automaton with the given index leaving the given location, if the enabled ones among them form an ample set.
+     *
+     * @return The edges or nullptr if the location does not admit an ample set.
+     */
+    std::vector<Candidate> const* getCandidates(uint64_t automatonIndex, uint64_t locationIndex) const;
+
+    /*!
+     * Retrieves the total number of locations that admit an ample set.
+     */
+    uint64_t getNumberOfReducibleLocations() const;
+
+   private:
+    // For each automaton the locations admitting an ample set together with the edges leaving them.
+    std::vector<std::unordered_map<uint64_t, std::vector<Candidate>>> candidates;
+};
+
+}  // namespace generator
+}  // namespace storm
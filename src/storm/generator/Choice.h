@@ -186,6 +186,12 @@ struct Choice {
      */
     void reserve(std::size_t const& size);
 
+    /*!
+     * Resets this choice to an empty choice with the given action index. In contrast to creating a new choice, the memory of the
+     * distribution and the reward vector is kept, which allows to reuse choices without allocations.
+     */
+    void reset(uint_fast64_t actionIndex = 0, bool markovian = false);
+
    private:
     // A flag indicating whether this choice is Markovian or not.
     bool markovian;
@@ -0,0 +1,63 @@
+#include "storm/generator/ChoicePool.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm::generator {
+
+template<typename ValueType, typename StateType>
+Choice<ValueType, StateType> ChoicePool<ValueType, StateType>::getChoice(uint_fast64_t actionIndex, bool markovian) {
+    if (choices.empty()) {
+        return Choice<ValueType, StateType>(actionIndex, markovian);
+    }
+    Choice<ValueType, StateType> choice = std::move(choices.back());
+    choices.pop_back();
+    choice.reset(actionIndex, markovian);
+    return choice;
+}
+
+template<typename ValueType, typename StateType>
+StateBehavior<ValueType, StateType> ChoicePool<ValueType, StateType>::getStateBehavior() {
+    if (behaviors.empty()) {
+        return StateBehavior<ValueType, StateType>();
+    }
+    StateBehavior<ValueType, StateType> behavior = std::move(behaviors.back());
+    behaviors.pop_back();
+    return behavior;
+}
+
+template<typename ValueType, typename StateType>
+void ChoicePool<ValueType, StateType>::recycle(Choice<ValueType, StateType>&& choice) {
+    if (choices.size() < maximalNumberOfPooledObjects) {
+        choices.push_back(std::move(choice));
+    }
+}
+
+template<typename ValueType, typename StateType>
+void ChoicePool<ValueType, StateType>::recycleChoices(std::vector<Choice<ValueType, StateType>>& choicesToRecycle) {
+    for (auto& choice : choicesToRecycle) {
+        recycle(std::move(choice));
+    }
+    choicesToRecycle.clear();
+}
+
+template<typename ValueType, typename StateType>
+void ChoicePool<ValueType, StateType>::recycle(StateBehavior<ValueType, StateType>&& behavior) {
+    recycleChoices(behavior.getChoices());
+    if (behaviors.size() < maximalNumberOfPooledObjects) {
+        behavior.clear();
+        behaviors.push_back(std::move(behavior));
+    }
+}
+
+template<typename ValueType, typename StateType>
+uint64_t ChoicePool<ValueType, StateType>::getNumberOfPooledChoices() const {
+    return choices.size();
+}
+
+template class ChoicePool<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ChoicePool<storm::RationalNumber>;
+template class ChoicePool<storm::RationalFunction>;
+#endif
+}  // namespace storm::generator
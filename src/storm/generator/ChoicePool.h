@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/Choice.h"
+#include "storm/generator/StateBehavior.h"
+
+namespace storm::generator {
+
+/*!
+ * A pool of choices and state behaviors that were handed back after their contents have been consumed. Objects taken from the pool keep the
+ * memory of their distributions and vectors, so that a generator that expands many states does (almost) not need to allocate once the pool is warm.
+ * The pool is not thread-safe, i.e., each generator has to use its own pool.
+ */
+template<typename ValueType, typename StateType = uint32_t>
+class ChoicePool {
+   public:
+    ChoicePool() = default;
+
+    /*!
+     * Retrieves an empty choice with the given action index.
+     */
+    Choice<ValueType, StateType> getChoice(uint_fast64_t actionIndex = 0, bool markovian = false);
+
+    /*!
+     * Retrieves an unexpanded behavior without choices and state rewards.
+     */
+    StateBehavior<ValueType, StateType> getStateBehavior();
+
+    /*!
+     * Hands the given choice back to the pool.
+     */
+    void recycle(Choice<ValueType, StateType>&& choice);
+
+    /*!
+     * Hands all given choices back to the pool. The given vector is empty afterwards.
+     */
+    void recycleChoices(std::vector<Choice<ValueType, StateType>>& choices);
+
+    /*!
+     * Hands the given behavior (including its choices) back to the pool.
+     */
+    void recycle(StateBehavior<ValueType, StateType>&& behavior);
+
+    /*!
+     * Retrieves the number of choices that are currently stored in the pool.
+     */
+    uint64_t getNumberOfPooledChoices() const;
+
+   private:
+    // The pool never retains more than this many choices or behaviors. This bounds the memory that is held by the pool if many objects are
+    // returned at once, e.g., after a complete level of the state space was explored.
+    static const uint64_t maximalNumberOfPooledObjects = 4096;
+
+    std::vector<Choice<ValueType, StateType>> choices;
+    std::vector<StateBehavior<ValueType, StateType>> behaviors;
+};
+
+}  // namespace storm::generator
@@ -0,0 +1,226 @@
+#include "storm/generator/CommandGuardIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/prism/Module.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+typedef std::unordered_map<storm::expressions::Variable, std::pair<int64_t, int64_t>> IntervalConstraints;
+
+void restrictVariable(IntervalConstraints& constraints, storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+    auto insertionResult = constraints.emplace(variable, std::make_pair(lowerBound, upperBound));
+    if (!insertionResult.second) {
+        auto& interval = insertionResult.first->second;
+        interval.first = std::max(interval.first, lowerBound);
+        interval.second = std::min(interval.second, upperBound);
+    }
+}
+
+/*!
+ * Collects the intervals to which the top-level conjuncts of the given (guard) expression restrict single variables.
+ */
+void collectIntervalConstraints(storm::expressions::Expression const& expression, IntervalConstraints& constraints) {
+    if (expression.isVariable()) {
+        if (expression.hasBooleanType()) {
+            restrictVariable(constraints, expression.getBaseExpression().asVariableExpression().getVariable(), 1, 1);
+        }
+        return;
+    }
+    if (!expression.isFunctionApplication()) {
+        return;
+    }
+
+    storm::expressions::OperatorType operatorType = expression.getOperator();
+    if (operatorType == storm::expressions::OperatorType::And) {
+        collectIntervalConstraints(expression.getOperand(0), constraints);
+        collectIntervalConstraints(expression.getOperand(1), constraints);
+        return;
+    }
+    if (operatorType == storm::expressions::OperatorType::Not) {
+        storm::expressions::Expression operand = expression.getOperand(0);
+        if (operand.isVariable() && operand.hasBooleanType()) {
+            restrictVariable(constraints, operand.getBaseExpression().asVariableExpression().getVariable(), 0, 0);
+        }
+        return;
+    }
+    if (!expression.isRelationalExpression() || expression.getArity() != 2) {
+        return;
+    }
+
+    // Bring the relation into the form 'variable ~ constant'.
+    storm::expressions::Expression variableOperand = expression.getOperand(0);
+    storm::expressions::Expression constantOperand = expression.getOperand(1);
+    bool mirrored = false;
+    if (!variableOperand.isVariable()) {
+        std::swap(variableOperand, constantOperand);
+        mirrored = true;
+    }
+    if (!variableOperand.isVariable() || !variableOperand.hasIntegerType() || constantOperand.containsVariables() || !constantOperand.hasIntegerType()) {
+        return;
+    }
+    storm::expressions::Variable const& variable = variableOperand.getBaseExpression().asVariableExpression().getVariable();
+    int64_t value = constantOperand.evaluateAsInt();
+    int64_t minimalValue = std::numeric_limits<int64_t>::min();
+    int64_t maximalValue = std::numeric_limits<int64_t>::max();
+
+    if (mirrored) {
+        switch (operatorType) {
+            case storm::expressions::OperatorType::Less:
+                operatorType = storm::expressions::OperatorType::Greater;
+                break;
+            case storm::expressions::OperatorType::LessOrEqual:
+                operatorType = storm::expressions::OperatorType::GreaterOrEqual;
+                break;
+            case storm::expressions::OperatorType::Greater:
+                operatorType = storm::expressions::OperatorType::Less;
+                break;
+            case storm::expressions::OperatorType::GreaterOrEqual:
+                operatorType = storm::expressions::OperatorType::LessOrEqual;
+                break;
+            default:
+                break;
+        }
+    }
+
+    switch (operatorType) {
+        case storm::expressions::OperatorType::Equal:
+            restrictVariable(constraints, variable, value, value);
+            break;
+        case storm::expressions::OperatorType::Less:
+            restrictVariable(constraints, variable, minimalValue, value - 1);
+            break;
+        case storm::expressions::OperatorType::LessOrEqual:
+            restrictVariable(constraints, variable, minimalValue, value);
+            break;
+        case storm::expressions::OperatorType::Greater:
+            restrictVariable(constraints, variable, value + 1, maximalValue);
+            break;
+        case storm::expressions::OperatorType::GreaterOrEqual:
+            restrictVariable(constraints, variable, value, maximalValue);
+            break;
+        default:
+            // Other relations (e.g. inequality) do not restrict the variable to an interval.
+            break;
+    }
+}
+
+struct VariableDomain {
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lowerBound;
+    int64_t upperBound;
+};
+}  // namespace
+
+CommandGuardIndex::CommandGuardIndex(storm::prism::Module const& module, VariableInformation const& variableInformation)
+    : bitOffset(0), bitWidth(0), averageNumberOfCandidates(static_cast<double>(module.getNumberOfCommands())) {
+    uint64_t numberOfCommands = module.getNumberOfCommands();
+    allCommands.resize(numberOfCommands);
+    std::iota(allCommands.begin(), allCommands.end(), 0ull);
+
+    std::unordered_map<storm::expressions::Variable, VariableDomain> domains;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        domains[booleanVariable.variable] = {booleanVariable.bitOffset, 1, 0, 1};
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        if (integerVariable.bitWidth <= maximalBitWidth) {
+            domains[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound};
+        }
+    }
+
+    std::vector<IntervalConstraints> constraintsOfCommands(numberOfCommands);
+    std::unordered_map<storm::expressions::Variable, uint64_t> numberOfCandidatesOfVariables;
+    for (uint64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+        collectIntervalConstraints(module.getCommand(commandIndex).getGuardExpression(), constraintsOfCommands[commandIndex]);
+        for (auto const& constraint : constraintsOfCommands[commandIndex]) {
+            if (domains.count(constraint.first) > 0) {
+                numberOfCandidatesOfVariables.emplace(constraint.first, 0);
+            }
+        }
+    }
+
+    // Determine for each variable the number of candidates summed up over all values of its domain and select the variable for which the
+    // average number of candidates is minimal.
+    auto getCandidateRange = [&domains](IntervalConstraints const& constraints, storm::expressions::Variable const& variable) {
+        VariableDomain const& domain = domains.at(variable);
+        auto constraintIt = constraints.find(variable);
+        if (constraintIt == constraints.end()) {
+            return std::pair<int64_t, int64_t>(0, domain.upperBound - domain.lowerBound);
+        }
+        int64_t lower = std::max(constraintIt->second.first, domain.lowerBound);
+        int64_t upper = std::min(constraintIt->second.second, domain.upperBound);
+        return std::pair<int64_t, int64_t>(lower - domain.lowerBound, upper - domain.lowerBound);
+    };
+    boost::optional<storm::expressions::Variable> discriminatingVariable;
+    for (auto& variableCandidates : numberOfCandidatesOfVariables) {
+        VariableDomain const& domain = domains.at(variableCandidates.first);
+        for (auto const& constraints : constraintsOfCommands) {
+            auto range = getCandidateRange(constraints, variableCandidates.first);
+            if (range.first <= range.second) {
+                variableCandidates.second += range.second - range.first + 1;
+            }
+        }
+        double average = static_cast<double>(variableCandidates.second) / static_cast<double>(domain.upperBound - domain.lowerBound + 1);
+        if (average < averageNumberOfCandidates ||
+            (discriminatingVariable && average == averageNumberOfCandidates && variableCandidates.first < discriminatingVariable.get())) {
+            averageNumberOfCandidates = average;
+            discriminatingVariable = variableCandidates.first;
+        }
+    }
+
+    if (discriminatingVariable) {
+        VariableDomain const& domain = domains.at(discriminatingVariable.get());
+        bitOffset = domain.bitOffset;
+        bitWidth = domain.bitWidth;
+        buckets.resize(domain.upperBound - domain.lowerBound + 1);
+        for (uint64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+            auto range = getCandidateRange(constraintsOfCommands[commandIndex], discriminatingVariable.get());
+            for (int64_t value = range.first; value <= range.second; ++value) {
+                buckets[value].push_back(commandIndex);
+            }
+        }
+        STORM_LOG_TRACE("Indexed the commands of module " << module.getName() << " by variable " << discriminatingVariable->getName() << " ("
+                                                          << averageNumberOfCandidates << " instead of " << numberOfCommands
+                                                          << " candidate commands on average).");
+    }
+}
+
+bool CommandGuardIndex::isIndexed() const {
+    return !buckets.empty();
+}
+
+std::vector<uint64_t> const& CommandGuardIndex::getCandidateCommands(CompressedState const& state) const {
+    if (buckets.empty()) {
+        return allCommands;
+    }
+    uint64_t value = state.getAsInt(bitOffset, bitWidth);
+    // Values outside of the domain of the variable do not occur in valid states. We do not exclude any command in this case.
+    return value < buckets.size() ? buckets[value] : allCommands;
+}
+
+bool CommandGuardIndex::isCandidate(CompressedState const& state, uint64_t commandIndex) const {
+    if (buckets.empty()) {
+        return true;
+    }
+    std::vector<uint64_t> const& candidates = getCandidateCommands(state);
+    return std::binary_search(candidates.begin(), candidates.end(), commandIndex);
+}
+
+double CommandGuardIndex::getAverageNumberOfCandidates() const {
+    return averageNumberOfCandidates;
+}
+
+}  // namespace generator
+}  // namespace storm
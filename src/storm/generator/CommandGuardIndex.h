@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace prism {
+class Module;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * An index over the commands of a module that maps the value of a single (discriminating) variable to the commands whose guard can possibly be
+ * satisfied for this value. The index is derived from the top-level conjuncts of the guards that restrict a variable to an interval (e.g. s=3,
+ * x<=N or b). Only the commands of the bucket of the current value need to be considered when looking for enabled commands. The actual guards
+ * still have to be evaluated for these candidates.
+ */
+class CommandGuardIndex {
+   public:
+    /*!
+     * Builds the index for the commands of the given module. If no variable discriminates the commands sufficiently, all commands are
+     * candidates in every state.
+     *
+     * @param module The module whose commands are to be indexed.
+     * @param variableInformation The information about the variables of the compressed states.
+     */
+    CommandGuardIndex(storm::prism::Module const& module, VariableInformation const& variableInformation);
+
+    /*!
+     * Retrieves whether the index discriminates the commands by some variable.
+     */
+    bool isIndexed() const;
+
+    /*!
+     * Retrieves the (local) indices of the commands whose guard can be satisfied in the given state. The indices are sorted.
+     */
+    std::vector<uint64_t> const& getCandidateCommands(CompressedState const& state) const;
+
+    /*!
+     * Retrieves whether the guard of the command with the given (local) index can be satisfied in the given state.
+     */
+    bool isCandidate(CompressedState const& state, uint64_t commandIndex) const;
+
+    /*!
+     * Retrieves the average number of candidate commands over all values of the discriminating variable.
+     */
+    double getAverageNumberOfCandidates() const;
+
+   private:
+    // The maximal number of bits of a discriminating variable. Variables with larger domains are not considered for the index.
+    static const uint64_t maximalBitWidth = 12;
+
+    // The location of the discriminating variable in the compressed state.
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+
+    // The candidate commands for each (encoded) value of the discriminating variable. Empty if the commands are not indexed.
+    std::vector<std::vector<uint64_t>> buckets;
+
+    // The indices of all commands of the module.
+    std::vector<uint64_t> allCommands;
+
+    double averageNumberOfCandidates;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,393 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+CompiledStateExpression::CompiledStateExpression(std::vector<Instruction>&& instructions, uint64_t maximalStackSize)
+    : instructions(std::move(instructions)), stack(maximalStackSize) {
+    STORM_LOG_ASSERT(maximalStackSize > 0, "Expected a non-empty stack.");
+}
+
+bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+    return evaluate(state) != 0;
+}
+
+int64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+    return evaluate(state);
+}
+
+uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+int64_t CompiledStateExpression::evaluate(CompressedState const& state) const {
+    // The pointer always points behind the topmost value of the stack.
+    int64_t* top = stack.data();
+    uint64_t const numberOfInstructions = instructions.size();
+    for (uint64_t index = 0; index < numberOfInstructions; ++index) {
+        Instruction const& instruction = instructions[index];
+        switch (instruction.operation) {
+            case Operation::Constant:
+                *top++ = instruction.value;
+                break;
+            case Operation::LoadBoolean:
+                *top++ = state.get(instruction.bitOffset) ? 1 : 0;
+                break;
+            case Operation::LoadInteger:
+                *top++ = static_cast<int64_t>(state.getAsInt(instruction.bitOffset, instruction.bitWidth)) + instruction.value;
+                break;
+            case Operation::Not:
+                top[-1] = top[-1] == 0 ? 1 : 0;
+                break;
+            case Operation::Negate:
+                top[-1] = -top[-1];
+                break;
+            case Operation::Plus:
+                --top;
+                top[-1] += top[0];
+                break;
+            case Operation::Minus:
+                --top;
+                top[-1] -= top[0];
+                break;
+            case Operation::Times:
+                --top;
+                top[-1] *= top[0];
+                break;
+            case Operation::Divide:
+                --top;
+                top[-1] /= top[0];
+                break;
+            case Operation::Modulo:
+                --top;
+                top[-1] %= top[0];
+                break;
+            case Operation::Min:
+                --top;
+                top[-1] = std::min(top[-1], top[0]);
+                break;
+            case Operation::Max:
+                --top;
+                top[-1] = std::max(top[-1], top[0]);
+                break;
+            case Operation::Power:
+                --top;
+                top[-1] = static_cast<int64_t>(std::pow(top[-1], top[0]));
+                break;
+            case Operation::Xor:
+                --top;
+                top[-1] = (top[-1] != 0) != (top[0] != 0) ? 1 : 0;
+                break;
+            case Operation::Iff:
+                --top;
+                top[-1] = (top[-1] != 0) == (top[0] != 0) ? 1 : 0;
+                break;
+            case Operation::Equal:
+                --top;
+                top[-1] = top[-1] == top[0] ? 1 : 0;
+                break;
+            case Operation::NotEqual:
+                --top;
+                top[-1] = top[-1] != top[0] ? 1 : 0;
+                break;
+            case Operation::Less:
+                --top;
+                top[-1] = top[-1] < top[0] ? 1 : 0;
+                break;
+            case Operation::LessOrEqual:
+                --top;
+                top[-1] = top[-1] <= top[0] ? 1 : 0;
+                break;
+            case Operation::Greater:
+                --top;
+                top[-1] = top[-1] > top[0] ? 1 : 0;
+                break;
+            case Operation::GreaterOrEqual:
+                --top;
+                top[-1] = top[-1] >= top[0] ? 1 : 0;
+                break;
+            case Operation::JumpIfFalseOrPop:
+                if (top[-1] == 0) {
+                    index = instruction.value - 1;
+                } else {
+                    --top;
+                }
+                break;
+            case Operation::JumpIfTrueOrPop:
+                if (top[-1] != 0) {
+                    index = instruction.value - 1;
+                } else {
+                    --top;
+                }
+                break;
+            case Operation::PopAndJumpIfFalse:
+                --top;
+                if (*top == 0) {
+                    index = instruction.value - 1;
+                }
+                break;
+            case Operation::Jump:
+                index = instruction.value - 1;
+                break;
+        }
+    }
+    STORM_LOG_ASSERT(top == stack.data() + 1, "Expected exactly one value on the stack after evaluating a compiled expression.");
+    return stack.front();
+}
+
+/*!
+ * Emits the instructions for an expression in postfix order. If a construct is encountered that can not be compiled, the compilation is
+ * marked as failed and the remaining subexpressions are skipped.
+ */
+class StateExpressionCompiler::CompilingVisitor : public storm::expressions::ExpressionVisitor {
+   public:
+    typedef CompiledStateExpression::Instruction Instruction;
+    typedef CompiledStateExpression::Operation Operation;
+
+    CompilingVisitor(std::unordered_map<storm::expressions::Variable, VariableLocation> const& variableLocations)
+        : variableLocations(variableLocations), supported(true), stackSize(0), maximalStackSize(0) {
+        // Intentionally left empty.
+    }
+
+    boost::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression) {
+        if (expression.hasBooleanType() || expression.hasIntegerType()) {
+            expression.getBaseExpression().accept(*this, boost::none);
+        } else {
+            supported = false;
+        }
+        if (!supported) {
+            return boost::none;
+        }
+        STORM_LOG_ASSERT(stackSize == 1, "Unexpected stack size after compilation.");
+        return CompiledStateExpression(std::move(instructions), maximalStackSize);
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+        if (!isBooleanOrInteger(expression) || !isBooleanOrInteger(*expression.getThenExpression())) {
+            supported = false;
+            return boost::any();
+        }
+        // The value of the condition is removed by the conditional jump and exactly one of the branches pushes its value.
+        expression.getCondition()->accept(*this, data);
+        uint64_t jumpToElse = emitJump(Operation::PopAndJumpIfFalse, -1);
+        expression.getThenExpression()->accept(*this, data);
+        uint64_t jumpToEnd = emitJump(Operation::Jump, -1);
+        instructions[jumpToElse].value = instructions.size();
+        expression.getElseExpression()->accept(*this, data);
+        instructions[jumpToEnd].value = instructions.size();
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::BinaryBooleanFunctionExpression::OperatorType OperatorType;
+        expression.getFirstOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case OperatorType::And:
+                emitShortCircuit(Operation::JumpIfFalseOrPop, *expression.getSecondOperand(), data);
+                break;
+            case OperatorType::Or:
+                emitShortCircuit(Operation::JumpIfTrueOrPop, *expression.getSecondOperand(), data);
+                break;
+            case OperatorType::Implies:
+                emit(Operation::Not, 0);
+                emitShortCircuit(Operation::JumpIfTrueOrPop, *expression.getSecondOperand(), data);
+                break;
+            case OperatorType::Xor:
+                expression.getSecondOperand()->accept(*this, data);
+                emit(Operation::Xor, -1);
+                break;
+            case OperatorType::Iff:
+                expression.getSecondOperand()->accept(*this, data);
+                emit(Operation::Iff, -1);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+        if (!expression.hasIntegerType() || !expression.getFirstOperand()->hasIntegerType() || !expression.getSecondOperand()->hasIntegerType()) {
+            supported = false;
+            return boost::any();
+        }
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        Operation operation = Operation::Plus;
+        switch (expression.getOperatorType()) {
+            case OperatorType::Plus:
+                operation = Operation::Plus;
+                break;
+            case OperatorType::Minus:
+                operation = Operation::Minus;
+                break;
+            case OperatorType::Times:
+                operation = Operation::Times;
+                break;
+            case OperatorType::Divide:
+                operation = Operation::Divide;
+                break;
+            case OperatorType::Min:
+                operation = Operation::Min;
+                break;
+            case OperatorType::Max:
+                operation = Operation::Max;
+                break;
+            case OperatorType::Power:
+                operation = Operation::Power;
+                break;
+            case OperatorType::Modulo:
+                operation = Operation::Modulo;
+                break;
+        }
+        emit(operation, -1);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::RelationType RelationType;
+        if (!isBooleanOrInteger(*expression.getFirstOperand()) || !isBooleanOrInteger(*expression.getSecondOperand())) {
+            supported = false;
+            return boost::any();
+        }
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        Operation operation = Operation::Equal;
+        switch (expression.getRelationType()) {
+            case RelationType::Equal:
+                operation = Operation::Equal;
+                break;
+            case RelationType::NotEqual:
+                operation = Operation::NotEqual;
+                break;
+            case RelationType::Less:
+                operation = Operation::Less;
+                break;
+            case RelationType::LessOrEqual:
+                operation = Operation::LessOrEqual;
+                break;
+            case RelationType::Greater:
+                operation = Operation::Greater;
+                break;
+            case RelationType::GreaterOrEqual:
+                operation = Operation::GreaterOrEqual;
+                break;
+        }
+        emit(operation, -1);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        auto locationIt = variableLocations.find(expression.getVariable());
+        if (locationIt == variableLocations.end()) {
+            supported = false;
+            return boost::any();
+        }
+        VariableLocation const& location = locationIt->second;
+        if (location.isBoolean) {
+            instructions.push_back({Operation::LoadBoolean, location.bitOffset, 0, 0});
+        } else {
+            instructions.push_back({Operation::LoadInteger, location.bitOffset, location.bitWidth, location.lowerBound});
+        }
+        updateStackSize(1);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        expression.getOperand()->accept(*this, data);
+        emit(Operation::Not, 0);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        if (!expression.getOperand()->hasIntegerType()) {
+            supported = false;
+            return boost::any();
+        }
+        expression.getOperand()->accept(*this, data);
+        // Rounding an integer does not change its value.
+        if (expression.getOperatorType() == storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus) {
+            emit(Operation::Negate, 0);
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+        instructions.push_back({Operation::Constant, 0, 0, expression.getValue() ? 1 : 0});
+        updateStackSize(1);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        instructions.push_back({Operation::Constant, 0, 0, expression.getValue()});
+        updateStackSize(1);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const&, boost::any const&) override {
+        supported = false;
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+        supported = false;
+        return boost::any();
+    }
+
+   private:
+    static bool isBooleanOrInteger(storm::expressions::BaseExpression const& expression) {
+        return expression.hasBooleanType() || expression.hasIntegerType();
+    }
+
+    void updateStackSize(int64_t change) {
+        stackSize += change;
+        maximalStackSize = std::max(maximalStackSize, stackSize);
+    }
+
+    void emit(Operation operation, int64_t stackChange) {
+        instructions.push_back({operation, 0, 0, 0});
+        updateStackSize(stackChange);
+    }
+
+    uint64_t emitJump(Operation operation, int64_t stackChange) {
+        emit(operation, stackChange);
+        return instructions.size() - 1;
+    }
+
+    void emitShortCircuit(Operation jump, storm::expressions::BaseExpression const& secondOperand, boost::any const& data) {
+        // If the jump is not taken, the first operand is removed and replaced by the value of the second operand.
+        uint64_t jumpIndex = emitJump(jump, -1);
+        secondOperand.accept(*this, data);
+        instructions[jumpIndex].value = instructions.size();
+    }
+
+    std::unordered_map<storm::expressions::Variable, VariableLocation> const& variableLocations;
+    std::vector<Instruction> instructions;
+    bool supported;
+    int64_t stackSize;
+    int64_t maximalStackSize;
+};
+
+StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) {
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableLocations[booleanVariable.variable] = {true, booleanVariable.bitOffset, 1, 0};
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableLocations[integerVariable.variable] = {false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+    }
+}
+
+boost::optional<CompiledStateExpression> StateExpressionCompiler::compile(storm::expressions::Expression const& expression) const {
+    CompilingVisitor visitor(variableLocations);
+    return visitor.compile(expression);
+}
+
+}  // namespace generator
+}  // namespace storm
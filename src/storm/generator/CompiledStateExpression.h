@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * A boolean or integer expression that was translated into a flat sequence of instructions which read the values of the variables directly
+ * from the bits of a compressed state. In contrast to an expression evaluator, no valuation needs to be filled and no expression tree has to
+ * be traversed when evaluating the expression.
+ * Evaluation uses an internal stack, so a single object must not be evaluated concurrently.
+ */
+class CompiledStateExpression {
+   public:
+    enum class Operation : uint8_t {
+        Constant,
+        LoadBoolean,
+        LoadInteger,
+        Not,
+        Negate,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Modulo,
+        Min,
+        Max,
+        Power,
+        Xor,
+        Iff,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        // Jumps to the target if the topmost value is false (true) and keeps it. Otherwise, the value is removed.
+        JumpIfFalseOrPop,
+        JumpIfTrueOrPop,
+        // Removes the topmost value and jumps to the target if it is false.
+        PopAndJumpIfFalse,
+        Jump
+    };
+
+    struct Instruction {
+        Operation operation;
+        // The bit offset and width of the loaded variable.
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        // The constant to push, the lower bound of a loaded integer variable or the target of a jump.
+        int64_t value;
+    };
+
+    /*!
+     * Creates a compiled expression from the given instructions.
+     *
+     * @param instructions The instructions, which are executed on a stack of values
+     * @param maximalStackSize The maximal number of values on the stack during the execution of the instructions.
+     */
+    CompiledStateExpression(std::vector<Instruction>&& instructions, uint64_t maximalStackSize);
+
+    /*!
+     * Evaluates the (boolean) expression in the given state.
+     */
+    bool evaluateAsBool(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the (integer) expression in the given state.
+     */
+    int64_t evaluateAsInt(CompressedState const& state) const;
+
+    /*!
+     * Retrieves the number of instructions of the compiled expression.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+   private:
+    int64_t evaluate(CompressedState const& state) const;
+
+    std::vector<Instruction> instructions;
+    mutable std::vector<int64_t> stack;
+};
+
+/*!
+ * Translates expressions over the variables of a compressed state into compiled state expressions.
+ */
+class StateExpressionCompiler {
+   public:
+    StateExpressionCompiler(VariableInformation const& variableInformation);
+
+    /*!
+     * Compiles the given expression. Only boolean and integer expressions over the boolean and integer variables of the state are supported.
+     *
+     * @return The compiled expression or none, if the expression contains constructs that can not be compiled (e.g. rational subexpressions).
+     */
+    boost::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression) const;
+
+   private:
+    class CompilingVisitor;
+
+    struct VariableLocation {
+        bool isBoolean;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+    };
+
+    std::unordered_map<storm::expressions::Variable, VariableLocation> variableLocations;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -35,11 +35,23 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/solver.h"
+#include "storm/utility/tracing.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace generator {
 
+namespace {
+bool isStateIndependent(storm::jani::detail::ConstAssignments const& assignments) {
+    for (auto const& assignment : assignments) {
+        if (!assignment.lValueIsVariable() || assignment.getAssignedExpression().containsVariables()) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 template<typename ValueType, typename StateType>
 JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani::Model const& model, NextStateGeneratorOptions const& options)
     : JaniNextStateGenerator(model.substituteConstantsFunctions(), options, false) {
@@ -56,6 +68,8 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
       evaluateRewardExpressionsAtDestinations(false) {
     STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::NotSupportedException,
                     "JANI next-state generator cannot generate choice labels.");
+    STORM_LOG_WARN_COND(!this->options.isSymmetryReductionSet(),
+                        "The JANI next-state generator does not support symmetry reduction. The full state space is explored.");
 
     auto features = this->model.getModelFeatures();
     features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -133,6 +147,80 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
             }
         }
     }
+
+    if (this->options.isPartialOrderReductionSet()) {
+        setUpPartialOrderReduction();
+    }
+}
+
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::setUpPartialOrderReduction() {
+    bool supported = model.getModelType() == storm::jani::ModelType::MDP && rewardExpressions.empty();
+    STORM_LOG_WARN_COND(supported, "Partial-order reduction is only supported for MDPs without reward models. The full state space is explored.");
+    if (!supported) {
+        return;
+    }
+
+    // Collect the edges that are taken with and without synchronization.
+    std::vector<std::unordered_map<uint64_t, uint64_t>> nonSynchronizingEdges(parallelAutomata.size());
+    std::vector<std::set<uint64_t>> synchronizingEdges(parallelAutomata.size());
+    for (auto const& outputAndEdges : edges) {
+        for (auto const& automatonAndEdges : outputAndEdges.second) {
+            for (auto const& locationAndEdges : automatonAndEdges.second) {
+                for (auto const& indexAndEdge : locationAndEdges.second) {
+                    if (outputAndEdges.second.size() == 1) {
+                        nonSynchronizingEdges[automatonAndEdges.first][indexAndEdge.first] =
+                            outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex();
+                    } else {
+                        synchronizingEdges[automatonAndEdges.first].insert(indexAndEdge.first);
+                    }
+                }
+            }
+        }
+    }
+
+    // The visible variables are those that determine the labels and the terminal states. Labels are defined by transient assignments in the
+    // locations and by the initial values of the transient variables.
+    std::set<storm::expressions::Variable> visibleVariables;
+    auto addVisibleVariables = [&visibleVariables](storm::expressions::Expression const& expression) {
+        auto variables = expression.getVariables();
+        visibleVariables.insert(variables.begin(), variables.end());
+    };
+    for (auto const& automaton : parallelAutomata) {
+        for (auto const& location : automaton.get().getLocations()) {
+            for (auto const& assignment : location.getAssignments()) {
+                addVisibleVariables(assignment.getAssignedExpression());
+            }
+        }
+    }
+    for (auto const& variable : model.getGlobalVariables().getTransientVariables()) {
+        if (variable.hasInitExpression()) {
+            addVisibleVariables(variable.getInitExpression());
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        addVisibleVariables(expressionLabel.second);
+    }
+    for (auto const& terminalExpressionAndBool : this->terminalStates) {
+        addVisibleVariables(terminalExpressionAndBool.first);
+    }
+
+    ampleSetReduction = AmpleSetReduction(parallelAutomata, nonSynchronizingEdges, synchronizingEdges, visibleVariables);
+
+    computeStateIndependentTransientValuations();
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+    // The stored model and options already went through the preprocessing of the constructor, which leaves them unchanged
+    // when applied a second time. Only the information about eliminated arrays is lost and needs to be restored.
+    auto result =
+        std::shared_ptr<JaniNextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(this->model, this->options, false));
+    result->arrayEliminatorData = this->arrayEliminatorData;
+    result->variableInformation.registerArrayVariableReplacements(result->arrayEliminatorData);
+    result->transientVariableInformation.registerArrayVariableReplacements(result->arrayEliminatorData);
+    result->transientVariableInformation.setDefaultValuesInEvaluator(*result->evaluator);
+    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -538,12 +626,63 @@ TransientVariableValuation<ValueType> JaniNextStateGenerator<ValueType, StateTyp
         uint64_t currentLocationIndex = locations[automatonIndex];
         storm::jani::Location const& location = automaton.getLocation(currentLocationIndex);
         STORM_LOG_ASSERT(!location.getAssignments().hasMultipleLevels(true), "Indexed assignments at locations are not supported in the jani standard.");
-        applyTransientUpdate(transientVariableValuation, location.getAssignments().getTransientAssignments(), evaluator);
+        auto const& stateIndependentValuation = stateIndependentLocationValuations[automatonIndex][currentLocationIndex];
+        if (stateIndependentValuation) {
+            transientVariableValuation.append(stateIndependentValuation.get());
+        } else {
+            applyTransientUpdate(transientVariableValuation, location.getAssignments().getTransientAssignments(), evaluator);
+        }
         ++automatonIndex;
     }
     return transientVariableValuation;
 }
 
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::computeStateIndependentTransientValuations() {
+    stateIndependentLocationValuations.clear();
+    stateIndependentEdgeValuations.clear();
+    // With exploration checks, out-of-bounds values are to be reported only when they occur in a reachable state.
+    if (this->options.isExplorationChecksSet()) {
+        stateIndependentLocationValuations.resize(parallelAutomata.size());
+        for (uint64_t automatonIndex = 0; automatonIndex < parallelAutomata.size(); ++automatonIndex) {
+            stateIndependentLocationValuations[automatonIndex].resize(parallelAutomata[automatonIndex].get().getNumberOfLocations());
+        }
+        return;
+    }
+
+    // Since the assignments do not read variables, the current values in the evaluator do not matter.
+    for (auto const& automatonRef : parallelAutomata) {
+        auto const& automaton = automatonRef.get();
+        auto& locationValuations = stateIndependentLocationValuations.emplace_back(automaton.getNumberOfLocations());
+        for (uint64_t locationIndex = 0; locationIndex < automaton.getNumberOfLocations(); ++locationIndex) {
+            auto const& assignments = automaton.getLocation(locationIndex).getAssignments().getTransientAssignments();
+            if (isStateIndependent(assignments)) {
+                locationValuations[locationIndex].emplace();
+                applyTransientUpdate(locationValuations[locationIndex].get(), assignments, *this->evaluator);
+            }
+        }
+
+        if (evaluateRewardExpressionsAtEdges) {
+            for (auto const& edge : automaton.getEdges()) {
+                if (edge.getAssignments().empty()) {
+                    continue;
+                }
+                bool stateIndependent = true;
+                for (int64_t level = edge.getAssignments().getLowestLevel(true); stateIndependent && level <= edge.getAssignments().getHighestLevel(true);
+                     ++level) {
+                    stateIndependent = isStateIndependent(edge.getAssignments().getTransientAssignments(level));
+                }
+                if (stateIndependent) {
+                    auto& edgeValuation = stateIndependentEdgeValuations[&edge];
+                    for (int64_t level = edge.getAssignments().getLowestLevel(true); level <= edge.getAssignments().getHighestLevel(true); ++level) {
+                        applyTransientUpdate(edgeValuation, edge.getAssignments().getTransientAssignments(level), *this->evaluator);
+                    }
+                }
+            }
+        }
+    }
+}
+
 template<typename ValueType, typename StateType>
 void JaniNextStateGenerator<ValueType, StateType>::unpackTransientVariableValuesIntoEvaluator(
     CompressedState const& state, storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const {
@@ -560,7 +699,11 @@ storm::storage::sparse::StateValuationsBuilder JaniNextStateGenerator<ValueType,
         result.addVariable(varInfo.variable);
     }
     for (auto const& varInfo : transientVariableInformation.integerVariableInformation) {
-        result.addVariable(varInfo.variable);
+        if (varInfo.lowerBound && varInfo.upperBound) {
+            result.addVariable(varInfo.variable, varInfo.lowerBound.get(), varInfo.upperBound.get());
+        } else {
+            result.addVariable(varInfo.variable);
+        }
     }
     for (auto const& varInfo : transientVariableInformation.rationalVariableInformation) {
         result.addVariable(varInfo.variable);
@@ -626,10 +769,11 @@ void JaniNextStateGenerator<ValueType, StateType>::addStateValuation(storm::stor
 
 template<typename ValueType, typename StateType>
 StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+    STORM_TRACE_ZONE("JaniNextStateGenerator::expand");
     // The evaluator should have the default values of the transient variables right now.
 
     // Prepare the result, in case we return early.
-    StateBehavior<ValueType, StateType> result;
+    StateBehavior<ValueType, StateType> result = this->choicePool.getStateBehavior();
 
     // Retrieve the locations from the state.
     std::vector<uint64_t> locations = getLocations(*this->state);
@@ -657,16 +801,17 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // Get all choices for the state.
     result.setExpanded();
-    std::vector<Choice<ValueType>> allChoices;
+    // The choices are only left over if a previous expansion was aborted.
+    this->choicePool.recycleChoices(allChoices);
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getActionChoices(locations, *this->state, stateToIdCallback, EdgeFilter::WithoutRate);
+        addActionChoices(allChoices, locations, *this->state, stateToIdCallback, EdgeFilter::WithoutRate);
         if (allChoices.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getActionChoices(locations, *this->state, stateToIdCallback, EdgeFilter::WithRate);
+            addActionChoices(allChoices, locations, *this->state, stateToIdCallback, EdgeFilter::WithRate);
         }
-    } else {
-        allChoices = getActionChoices(locations, *this->state, stateToIdCallback);
+    } else if (!ampleSetReduction || !addAmpleChoice(allChoices, locations, *this->state, stateToIdCallback)) {
+        addActionChoices(allChoices, locations, *this->state, stateToIdCallback);
     }
     std::size_t totalNumberOfChoices = allChoices.size();
 
@@ -678,7 +823,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType> globalChoice = this->choicePool.getChoice();
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -718,7 +863,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
         globalChoice.addRewards(std::move(stateActionRewards));
 
         // Move the newly fused choice in place.
-        allChoices.clear();
+        this->choicePool.recycleChoices(allChoices);
         allChoices.push_back(std::move(globalChoice));
     }
 
@@ -726,12 +871,48 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
     for (auto& choice : allChoices) {
         result.addChoice(std::move(choice));
     }
+    allChoices.clear();
 
     this->postprocess(result);
 
     return result;
 }
 
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::addAmpleChoice(std::vector<Choice<ValueType>>& choices, std::vector<uint64_t> const& locations,
+                                                                  CompressedState const& state, StateToIdCallback stateToIdCallback) {
+    for (uint64_t automatonIndex = 0; automatonIndex < parallelAutomata.size(); ++automatonIndex) {
+        auto candidates = ampleSetReduction->getCandidates(automatonIndex, locations[automatonIndex]);
+        if (candidates == nullptr) {
+            continue;
+        }
+
+        // The ample set needs to consist of exactly one enabled edge.
+        AmpleSetReduction::Candidate const* enabledCandidate = nullptr;
+        bool singleEnabledEdge = true;
+        for (auto const& candidate : *candidates) {
+            if (this->evaluator->asBool(candidate.edge->getGuard())) {
+                singleEnabledEdge = enabledCandidate == nullptr;
+                enabledCandidate = &candidate;
+                if (!singleEnabledEdge) {
+                    break;
+                }
+            }
+        }
+        if (enabledCandidate == nullptr || !singleEnabledEdge) {
+            continue;
+        }
+
+        choices.push_back(expandNonSynchronizingEdge(*enabledCandidate->edge, enabledCandidate->outputActionIndex, automatonIndex, state, stateToIdCallback));
+        if (this->getOptions().isBuildChoiceOriginsSet()) {
+            EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(automatonIndex, enabledCandidate->edgeIndex)};
+            choices.back().addOriginData(boost::any(std::move(edgeIndex)));
+        }
+        return true;
+    }
+    return false;
+}
+
 template<typename ValueType, typename StateType>
 Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex,
                                                                                            uint64_t automatonIndex, CompressedState const& state,
@@ -742,7 +923,7 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
         exitRate = this->evaluator->asRational(edge.getRate());
     }
 
-    Choice<ValueType> choice(edge.getActionIndex(), static_cast<bool>(exitRate));
+    Choice<ValueType> choice = this->choicePool.getChoice(edge.getActionIndex(), static_cast<bool>(exitRate));
     std::vector<ValueType> stateActionRewards;
 
     // Perform the transient edge assignments and create the state action rewards
@@ -750,11 +931,16 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
     if (!evaluateRewardExpressionsAtEdges || edge.getAssignments().empty()) {
         stateActionRewards.resize(rewardModelInformation.size(), storm::utility::zero<ValueType>());
     } else {
-        for (int64_t assignmentLevel = edge.getAssignments().getLowestLevel(true); assignmentLevel <= edge.getAssignments().getHighestLevel(true);
-             ++assignmentLevel) {
-            transientVariableValuation.clear();
-            applyTransientUpdate(transientVariableValuation, edge.getAssignments().getTransientAssignments(assignmentLevel), *this->evaluator);
-            transientVariableValuation.setInEvaluator(*this->evaluator, this->getOptions().isExplorationChecksSet());
+        auto stateIndependentValuationIt = stateIndependentEdgeValuations.find(&edge);
+        if (stateIndependentValuationIt != stateIndependentEdgeValuations.end()) {
+            stateIndependentValuationIt->second.setInEvaluator(*this->evaluator, this->getOptions().isExplorationChecksSet());
+        } else {
+            for (int64_t assignmentLevel = edge.getAssignments().getLowestLevel(true); assignmentLevel <= edge.getAssignments().getHighestLevel(true);
+                 ++assignmentLevel) {
+                transientVariableValuation.clear();
+                applyTransientUpdate(transientVariableValuation, edge.getAssignments().getTransientAssignments(assignmentLevel), *this->evaluator);
+                transientVariableValuation.setInEvaluator(*this->evaluator, this->getOptions().isExplorationChecksSet());
+            }
         }
         stateActionRewards = evaluateRewardExpressions();
         transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
@@ -967,7 +1153,7 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         iteratorList[i] = edgeCombination[i].second.cbegin();
     }
 
-    storm::generator::Distribution<StateType, ValueType> distribution;
+    storm::generator::Distribution<StateType, ValueType>& distribution = synchronizedDistribution;
 
     // As long as there is one feasible combination of commands, keep on expanding it.
     bool done = false;
@@ -984,7 +1170,7 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         // At this point, we applied all commands of the current command combination and newTargetStates
         // contains all target states and their respective probabilities. That means we are now ready to
         // add the choice to the list of transitions.
-        newChoices.emplace_back(outputActionIndex);
+        newChoices.push_back(this->choicePool.getChoice(outputActionIndex));
 
         // Now create the actual distribution.
         Choice<ValueType>& choice = newChoices.back();
@@ -1032,11 +1218,9 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
 }
 
 template<typename ValueType, typename StateType>
-std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::getActionChoices(std::vector<uint64_t> const& locations,
-                                                                                              CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                                                              EdgeFilter const& edgeFilter) {
-    std::vector<Choice<ValueType>> result;
-
+void JaniNextStateGenerator<ValueType, StateType>::addActionChoices(std::vector<Choice<ValueType>>& choices, std::vector<uint64_t> const& locations,
+                                                                    CompressedState const& state, StateToIdCallback stateToIdCallback,
+                                                                    EdgeFilter const& edgeFilter) {
     // To avoid reallocations, we declare some memory here here.
     // This vector will store for each automaton the set of edges with the current output and the current source location
     std::vector<EdgeSetWithIndices const*> edgeSetsMemory;
@@ -1063,13 +1247,13 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                         continue;
                     }
 
-                    result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
-                                                                outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
-                                                                automatonIndex, state, stateToIdCallback));
+                    choices.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
+                                                                 outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
+                                                                 automatonIndex, state, stateToIdCallback));
 
                     if (this->getOptions().isBuildChoiceOriginsSet()) {
                         EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first)};
-                        result.back().addOriginData(boost::any(std::move(edgeIndex)));
+                        choices.back().addOriginData(boost::any(std::move(edgeIndex)));
                     }
                 }
             }
@@ -1164,13 +1348,11 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                     ++edgeSetIt;
                     ++edgeIteratorIt;
                 }
-                // insert choices in the result vector.
-                expandSynchronizingEdgeCombination(automataEdgeSets, outputActionIndex, state, stateToIdCallback, result);
+                // insert choices in the given vector.
+                expandSynchronizingEdgeCombination(automataEdgeSets, outputActionIndex, state, stateToIdCallback, choices);
             }
         }
     }
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -1208,7 +1390,8 @@ storm::builder::RewardModelInformation JaniNextStateGenerator<ValueType, StateTy
 template<typename ValueType, typename StateType>
 storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
                                                                                          std::vector<StateType> const& initialStateIndices,
-                                                                                         std::vector<StateType> const& deadlockStateIndices) {
+                                                                                         std::vector<StateType> const& deadlockStateIndices,
+                                                                                         uint64_t numberOfThreads) {
     // As in JANI we can use transient boolean variable assignments in locations to identify states, we need to
     // create a list of boolean transient variables and the expressions that define them.
     std::vector<std::pair<std::string, storm::expressions::Expression>> transientVariableExpressions;
@@ -1219,7 +1402,8 @@ storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType
             }
         }
     }
-    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, transientVariableExpressions);
+    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, transientVariableExpressions,
+                                                           numberOfThreads);
 }
 
 template<typename ValueType, typename StateType>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "storm/generator/AmpleSetReduction.h"
+#include "storm/generator/Distribution.h"
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
 
@@ -15,9 +17,6 @@ class EdgeDestination;
 }  // namespace jani
 
 namespace generator {
-template<typename StateType, typename ValueType>
-class Distribution;
-
 template<typename ValueType, typename StateType = uint32_t>
 class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
    public:
@@ -59,10 +58,12 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
                                                        std::vector<StateType> const& initialStateIndices = {},
-                                                       std::vector<StateType> const& deadlockStateIndices = {}) override;
+                                                       std::vector<StateType> const& deadlockStateIndices = {}, uint64_t numberOfThreads = 1) override;
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
     /*!
      * Sets the values of all transient variables in the current state to the given evaluator.
      * @pre The values of non-transient variables have been set in the provided evaluator
@@ -140,16 +141,21 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     TransientVariableValuation<ValueType> getTransientVariableValuationAtLocations(std::vector<uint64_t> const& locations,
                                                                                    storm::expressions::ExpressionEvaluator<ValueType> const& evaluator) const;
 
+    /*!
+     * Computes the valuations of the transient variables at all locations and edges whose transient assignments do not depend on the state.
+     */
+    void computeStateIndependentTransientValuations();
+
     /*!
      * Retrieves all choices possible from the given state.
      *
+     * @param choices The new choices are inserted in this vector.
      * @param locations The current locations of all automata.
      * @param state The state for which to retrieve the silent choices.
      * @param edgeFilter Restricts the kind of edges to be considered.
-     * @return The action choices of the state.
      */
-    std::vector<Choice<ValueType>> getActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                    EdgeFilter const& edgeFilter = EdgeFilter::All);
+    void addActionChoices(std::vector<Choice<ValueType>>& choices, std::vector<uint64_t> const& locations, CompressedState const& state,
+                          StateToIdCallback stateToIdCallback, EdgeFilter const& edgeFilter = EdgeFilter::All);
 
     /*!
      * Retrieves the choice generated by the given edge.
@@ -157,6 +163,14 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex,
                                                  CompressedState const& state, StateToIdCallback stateToIdCallback);
 
+    /*!
+     * Adds the choice of an ample set of the given state (if there is one).
+     *
+     * @return True iff an ample set was found. In this case, the choice of the ample set is the only choice that needs to be explored.
+     */
+    bool addAmpleChoice(std::vector<Choice<ValueType>>& choices, std::vector<uint64_t> const& locations, CompressedState const& state,
+                        StateToIdCallback stateToIdCallback);
+
     typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
     typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
     typedef std::vector<std::pair<uint64_t, LocationsAndEdges>> AutomataAndEdges;
@@ -197,6 +211,11 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
      */
     void createSynchronizationInformation();
 
+    /*!
+     * Computes the static information for the partial-order reduction (if it is enabled and supported for the model).
+     */
+    void setUpPartialOrderReduction();
+
     /*!
      * Checks the underlying model for validity for this next-state generator.
      */
@@ -231,6 +250,21 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     /// Information about the transient variables of the model.
     TransientVariableInformation<ValueType> transientVariableInformation;
+
+    /// For each automaton and location, the valuation of the transient variables assigned at the location (if it does not depend on the state).
+    std::vector<std::vector<boost::optional<TransientVariableValuation<ValueType>>>> stateIndependentLocationValuations;
+
+    /// The valuations of the transient variables assigned by edges (on all levels) whose transient assignments do not depend on the state.
+    std::unordered_map<storm::jani::Edge const*, TransientVariableValuation<ValueType>> stateIndependentEdgeValuations;
+
+    /// The choices of the state that is currently expanded. The vector and the distribution below are reused across calls to expand.
+    std::vector<Choice<ValueType>> allChoices;
+
+    /// The distribution of the synchronizing edge combination that is currently expanded.
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
+
+    /// If set, the locations in which only the edges of a single automaton need to be explored.
+    boost::optional<AmpleSetReduction> ampleSetReduction;
 };
 
 }  // namespace generator
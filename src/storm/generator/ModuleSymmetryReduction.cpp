@@ -0,0 +1,361 @@
+#include "storm/generator/ModuleSymmetryReduction.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+typedef std::map<storm::expressions::Variable, storm::expressions::Expression> Substitution;
+
+void collectCanonicalOperands(storm::expressions::Expression const& expression, storm::expressions::OperatorType operatorType,
+                              std::vector<std::string>& operands);
+
+/*!
+ * Retrieves a string representation of the given expression that does not depend on the order of the operands of commutative operators.
+ * Syntactically equal expressions (up to commutativity and associativity) have equal canonical forms.
+ */
+std::string getCanonicalForm(storm::expressions::Expression const& expression) {
+    if (!expression.isFunctionApplication()) {
+        return expression.toString();
+    }
+
+    storm::expressions::OperatorType operatorType = expression.getOperator();
+    std::vector<std::string> operands;
+    bool commutative = true;
+    switch (operatorType) {
+        case storm::expressions::OperatorType::And:
+        case storm::expressions::OperatorType::Or:
+        case storm::expressions::OperatorType::Xor:
+        case storm::expressions::OperatorType::Iff:
+        case storm::expressions::OperatorType::Plus:
+        case storm::expressions::OperatorType::Times:
+        case storm::expressions::OperatorType::Min:
+        case storm::expressions::OperatorType::Max:
+            collectCanonicalOperands(expression, operatorType, operands);
+            break;
+        case storm::expressions::OperatorType::Greater:
+        case storm::expressions::OperatorType::GreaterOrEqual:
+            // Express the relation with the mirrored operator.
+            operatorType = operatorType == storm::expressions::OperatorType::Greater ? storm::expressions::OperatorType::Less
+                                                                                     : storm::expressions::OperatorType::LessOrEqual;
+            operands.push_back(getCanonicalForm(expression.getOperand(1)));
+            operands.push_back(getCanonicalForm(expression.getOperand(0)));
+            commutative = false;
+            break;
+        default:
+            for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                operands.push_back(getCanonicalForm(expression.getOperand(operandIndex)));
+            }
+            commutative = operatorType == storm::expressions::OperatorType::Equal || operatorType == storm::expressions::OperatorType::NotEqual ||
+                          operatorType == storm::expressions::OperatorType::AtLeastOneOf ||
+                          operatorType == storm::expressions::OperatorType::AtMostOneOf || operatorType == storm::expressions::OperatorType::ExactlyOneOf;
+            break;
+    }
+    if (commutative) {
+        std::sort(operands.begin(), operands.end());
+    }
+
+    std::stringstream stream;
+    stream << operatorType << "(";
+    for (uint64_t operandIndex = 0; operandIndex < operands.size(); ++operandIndex) {
+        stream << (operandIndex > 0 ? "," : "") << operands[operandIndex];
+    }
+    stream << ")";
+    return stream.str();
+}
+
+void collectCanonicalOperands(storm::expressions::Expression const& expression, storm::expressions::OperatorType operatorType,
+                              std::vector<std::string>& operands) {
+    if (expression.isFunctionApplication() && expression.getOperator() == operatorType) {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            collectCanonicalOperands(expression.getOperand(operandIndex), operatorType, operands);
+        }
+    } else {
+        operands.push_back(getCanonicalForm(expression));
+    }
+}
+
+bool areEquivalent(storm::expressions::Expression const& first, storm::expressions::Expression const& second) {
+    if (first.isInitialized() != second.isInitialized()) {
+        return false;
+    }
+    return !first.isInitialized() || getCanonicalForm(first) == getCanonicalForm(second);
+}
+
+/*!
+ * Retrieves the local variables of the given module. Boolean variables precede integer variables; within these, the order of declaration is kept.
+ */
+std::vector<storm::expressions::Variable> getLocalVariables(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& variable : module.getBooleanVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& variable : module.getIntegerVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    return result;
+}
+
+/*!
+ * Checks whether the local variables of the given modules coincide (positionally) up to their names.
+ */
+bool haveMatchingVariables(storm::prism::Module const& module, storm::prism::Module const& otherModule) {
+    if (module.getNumberOfClockVariables() > 0 || otherModule.getNumberOfClockVariables() > 0 || module.hasInvariant() || otherModule.hasInvariant()) {
+        return false;
+    }
+    if (module.getBooleanVariables().size() != otherModule.getBooleanVariables().size() ||
+        module.getIntegerVariables().size() != otherModule.getIntegerVariables().size() ||
+        module.getNumberOfCommands() != otherModule.getNumberOfCommands() || module.getNumberOfCommands() == 0) {
+        return false;
+    }
+    for (uint64_t variableIndex = 0; variableIndex < module.getBooleanVariables().size(); ++variableIndex) {
+        auto const& variable = module.getBooleanVariables()[variableIndex];
+        auto const& otherVariable = otherModule.getBooleanVariables()[variableIndex];
+        if (variable.hasInitialValue() != otherVariable.hasInitialValue() ||
+            (variable.hasInitialValue() && !areEquivalent(variable.getInitialValueExpression(), otherVariable.getInitialValueExpression()))) {
+            return false;
+        }
+    }
+    for (uint64_t variableIndex = 0; variableIndex < module.getIntegerVariables().size(); ++variableIndex) {
+        auto const& variable = module.getIntegerVariables()[variableIndex];
+        auto const& otherVariable = otherModule.getIntegerVariables()[variableIndex];
+        if (variable.hasInitialValue() != otherVariable.hasInitialValue() ||
+            (variable.hasInitialValue() && !areEquivalent(variable.getInitialValueExpression(), otherVariable.getInitialValueExpression()))) {
+            return false;
+        }
+        if (variable.hasLowerBoundExpression() != otherVariable.hasLowerBoundExpression() ||
+            variable.hasUpperBoundExpression() != otherVariable.hasUpperBoundExpression() ||
+            (variable.hasLowerBoundExpression() && !areEquivalent(variable.getLowerBoundExpression(), otherVariable.getLowerBoundExpression())) ||
+            (variable.hasUpperBoundExpression() && !areEquivalent(variable.getUpperBoundExpression(), otherVariable.getUpperBoundExpression()))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * Checks whether applying the given substitution (of variables) to the commands of the first module yields the commands of the second module.
+ */
+bool isMappedTo(storm::prism::Module const& module, storm::prism::Module const& otherModule, Substitution const& substitution) {
+    for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+        storm::prism::Command const& command = module.getCommand(commandIndex);
+        storm::prism::Command const& otherCommand = otherModule.getCommand(commandIndex);
+        if (command.getActionIndex() != otherCommand.getActionIndex() || command.isMarkovian() != otherCommand.isMarkovian() ||
+            command.getNumberOfUpdates() != otherCommand.getNumberOfUpdates() ||
+            !areEquivalent(command.getGuardExpression().substitute(substitution), otherCommand.getGuardExpression())) {
+            return false;
+        }
+        for (uint64_t updateIndex = 0; updateIndex < command.getNumberOfUpdates(); ++updateIndex) {
+            storm::prism::Update const& update = command.getUpdate(updateIndex);
+            storm::prism::Update const& otherUpdate = otherCommand.getUpdate(updateIndex);
+            if (update.getNumberOfAssignments() != otherUpdate.getNumberOfAssignments() ||
+                !areEquivalent(update.getLikelihoodExpression().substitute(substitution), otherUpdate.getLikelihoodExpression())) {
+                return false;
+            }
+            Substitution otherAssignments = otherUpdate.getAsVariableToExpressionMap();
+            for (auto const& assignment : update.getAssignments()) {
+                // Assignments to global variables are not renamed.
+                auto substitutionIt = substitution.find(assignment.getVariable());
+                storm::expressions::Variable assignedVariable = assignment.getVariable();
+                if (substitutionIt != substitution.end()) {
+                    assignedVariable = substitutionIt->second.getBaseExpression().asVariableExpression().getVariable();
+                }
+                auto otherAssignmentIt = otherAssignments.find(assignedVariable);
+                if (otherAssignmentIt == otherAssignments.end() ||
+                    !areEquivalent(assignment.getExpression().substitute(substitution), otherAssignmentIt->second)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*!
+ * Collects all expressions of the given module.
+ */
+std::vector<storm::expressions::Expression> getExpressions(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Expression> result;
+    for (auto const& command : module.getCommands()) {
+        result.push_back(command.getGuardExpression());
+        for (auto const& update : command.getUpdates()) {
+            result.push_back(update.getLikelihoodExpression());
+            for (auto const& assignment : update.getAssignments()) {
+                result.push_back(assignment.getExpression());
+            }
+        }
+    }
+    return result;
+}
+}  // namespace
+
+ModuleSymmetryReduction::ModuleSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                                                 std::vector<storm::expressions::Expression> const& preservedExpressions) {
+    std::unordered_map<storm::expressions::Variable, std::pair<uint64_t, uint64_t>> variableLocations;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableLocations[booleanVariable.variable] = std::make_pair(booleanVariable.bitOffset, 1ull);
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableLocations[integerVariable.variable] = std::make_pair(integerVariable.bitOffset, integerVariable.bitWidth);
+    }
+
+    // Partition the modules into classes of copies.
+    std::vector<std::vector<uint64_t>> candidateGroups;
+    std::vector<bool> assigned(program.getNumberOfModules(), false);
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        if (assigned[moduleIndex]) {
+            continue;
+        }
+        std::vector<uint64_t> group = {moduleIndex};
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        auto variables = getLocalVariables(module);
+        for (uint64_t otherModuleIndex = moduleIndex + 1; otherModuleIndex < program.getNumberOfModules(); ++otherModuleIndex) {
+            storm::prism::Module const& otherModule = program.getModule(otherModuleIndex);
+            if (assigned[otherModuleIndex] || !haveMatchingVariables(module, otherModule)) {
+                continue;
+            }
+            // The modules are copies if swapping their local variables maps the commands of one module to the commands of the other one.
+            Substitution transposition;
+            auto otherVariables = getLocalVariables(otherModule);
+            for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                transposition[variables[variableIndex]] = otherVariables[variableIndex].getExpression();
+                transposition[otherVariables[variableIndex]] = variables[variableIndex].getExpression();
+            }
+            if (isMappedTo(module, otherModule, transposition)) {
+                assigned[otherModuleIndex] = true;
+                group.push_back(otherModuleIndex);
+            }
+        }
+        if (group.size() > 1) {
+            candidateGroups.push_back(std::move(group));
+        }
+    }
+
+    for (auto const& candidateGroup : candidateGroups) {
+        std::vector<std::vector<storm::expressions::Variable>> variables;
+        for (auto moduleIndex : candidateGroup) {
+            variables.push_back(getLocalVariables(program.getModule(moduleIndex)));
+        }
+
+        // All permutations of the modules are generated by swapping the first two modules and by the rotation of all modules.
+        std::vector<Substitution> permutations(2);
+        uint64_t numberOfModules = candidateGroup.size();
+        for (uint64_t position = 0; position < numberOfModules; ++position) {
+            for (uint64_t variableIndex = 0; variableIndex < variables[position].size(); ++variableIndex) {
+                uint64_t swappedPosition = position < 2 ? 1 - position : position;
+                permutations[0][variables[position][variableIndex]] = variables[swappedPosition][variableIndex].getExpression();
+                permutations[1][variables[position][variableIndex]] = variables[(position + 1) % numberOfModules][variableIndex].getExpression();
+            }
+        }
+
+        // Each permutation needs to map the commands of each module of the group to the commands of the module it is mapped to.
+        std::string const& moduleName = program.getModule(candidateGroup.front()).getName();
+        bool symmetric = true;
+        for (uint64_t position = 0; position < numberOfModules && symmetric; ++position) {
+            storm::prism::Module const& module = program.getModule(candidateGroup[position]);
+            symmetric &= isMappedTo(module, program.getModule(candidateGroup[position < 2 ? 1 - position : position]), permutations[0]);
+            symmetric &= isMappedTo(module, program.getModule(candidateGroup[(position + 1) % numberOfModules]), permutations[1]);
+        }
+        if (!symmetric) {
+            STORM_LOG_INFO("The copies of module " << moduleName << " are not fully symmetric.");
+            continue;
+        }
+
+        std::vector<storm::expressions::Expression> expressionsToCheck = preservedExpressions;
+        if (program.hasInitialConstruct()) {
+            expressionsToCheck.push_back(program.getInitialConstruct().getInitialStatesExpression());
+        }
+        for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            if (std::find(candidateGroup.begin(), candidateGroup.end(), moduleIndex) == candidateGroup.end()) {
+                auto moduleExpressions = getExpressions(program.getModule(moduleIndex));
+                expressionsToCheck.insert(expressionsToCheck.end(), moduleExpressions.begin(), moduleExpressions.end());
+            }
+        }
+        for (auto const& expression : expressionsToCheck) {
+            if (!isInvariant(expression, permutations)) {
+                STORM_LOG_WARN("Symmetry between module " << moduleName << " and its copies is not exploited as expression " << expression
+                                                          << " is not symmetric.");
+                symmetric = false;
+                break;
+            }
+        }
+        if (!symmetric) {
+            continue;
+        }
+
+        SymmetricGroup group;
+        group.moduleIndices = candidateGroup;
+        group.numberOfVariables = variables.front().size();
+        for (auto const& moduleVariables : variables) {
+            for (auto const& variable : moduleVariables) {
+                group.variableLocations.push_back(variableLocations.at(variable));
+            }
+        }
+        STORM_LOG_INFO("Exploiting the symmetry of " << numberOfModules << " copies of module " << moduleName << ".");
+        groups.push_back(std::move(group));
+    }
+}
+
+bool ModuleSymmetryReduction::isInvariant(storm::expressions::Expression const& expression, std::vector<Substitution> const& permutations) {
+    std::string canonicalForm = getCanonicalForm(expression);
+    for (auto const& permutation : permutations) {
+        if (getCanonicalForm(expression.substitute(permutation)) != canonicalForm) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ModuleSymmetryReduction::hasSymmetries() const {
+    return !groups.empty();
+}
+
+std::vector<std::vector<uint64_t>> ModuleSymmetryReduction::getSymmetricModuleGroups() const {
+    std::vector<std::vector<uint64_t>> result;
+    for (auto const& group : groups) {
+        result.push_back(group.moduleIndices);
+    }
+    return result;
+}
+
+void ModuleSymmetryReduction::canonicalize(CompressedState& state) const {
+    for (auto const& group : groups) {
+        uint64_t numberOfVariables = group.numberOfVariables;
+        uint64_t numberOfModules = group.moduleIndices.size();
+        values.resize(group.variableLocations.size());
+        for (uint64_t index = 0; index < group.variableLocations.size(); ++index) {
+            values[index] = state.getAsInt(group.variableLocations[index].first, group.variableLocations[index].second);
+        }
+
+        // Order the modules by their local valuations.
+        order.resize(numberOfModules);
+        std::iota(order.begin(), order.end(), 0ull);
+        auto lessValuation = [this, numberOfVariables](uint64_t first, uint64_t second) {
+            return std::lexicographical_compare(values.begin() + first * numberOfVariables, values.begin() + (first + 1) * numberOfVariables,
+                                                values.begin() + second * numberOfVariables, values.begin() + (second + 1) * numberOfVariables);
+        };
+        if (std::is_sorted(order.begin(), order.end(), lessValuation)) {
+            continue;
+        }
+        std::sort(order.begin(), order.end(), lessValuation);
+
+        for (uint64_t position = 0; position < numberOfModules; ++position) {
+            for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+                auto const& location = group.variableLocations[position * numberOfVariables + variableIndex];
+                state.setFromInt(location.first, location.second, values[order[position] * numberOfVariables + variableIndex]);
+            }
+        }
+    }
+}
+
+}  // namespace generator
+}  // namespace storm
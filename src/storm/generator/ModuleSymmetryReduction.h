@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * Detects groups of fully symmetric modules of a PRISM program and maps compressed states to a canonical representative of their orbit under
+ * all permutations of the modules within each group. A group consists of modules that are copies of each other up to a renaming of their local
+ * variables (as created by module renaming) such that every permutation of the local variables of the modules maps the commands of each module
+ * to the commands of its image. A group is only used if all expressions that are to be preserved (labels, rewards, initial states and the
+ * commands of the remaining modules) are invariant under permutations of its modules.
+ * Canonicalization uses internal buffers, so a single object must not be used concurrently.
+ */
+class ModuleSymmetryReduction {
+   public:
+    /*!
+     * Detects the symmetric module groups of the given program.
+     *
+     * @param program The program whose modules are considered. Constants and formulas have to be substituted.
+     * @param variableInformation The information about the variables of the compressed states.
+     * @param preservedExpressions Expressions (e.g. labels and reward expressions) that need to be invariant under the symmetries.
+     */
+    ModuleSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                            std::vector<storm::expressions::Expression> const& preservedExpressions);
+
+    /*!
+     * Retrieves whether at least one group of symmetric modules was found.
+     */
+    bool hasSymmetries() const;
+
+    /*!
+     * Retrieves the indices of the modules of each symmetric group.
+     */
+    std::vector<std::vector<uint64_t>> getSymmetricModuleGroups() const;
+
+    /*!
+     * Replaces the given state by the canonical representative of its orbit. The representative is obtained by ordering the (local) valuations
+     * of the modules of each group lexicographically.
+     */
+    void canonicalize(CompressedState& state) const;
+
+   private:
+    struct SymmetricGroup {
+        // The indices of the modules in the group.
+        std::vector<uint64_t> moduleIndices;
+
+        // The number of local variables of each module.
+        uint64_t numberOfVariables;
+
+        // The bit offset and width of the local variables, ordered by module first. Corresponding variables of the modules have the same
+        // position.
+        std::vector<std::pair<uint64_t, uint64_t>> variableLocations;
+    };
+
+    /*!
+     * Retrieves whether the given expression is invariant under the given permutations, each of which is given as a substitution of variables.
+     */
+    static bool isInvariant(storm::expressions::Expression const& expression,
+                            std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> const& permutations);
+
+    std::vector<SymmetricGroup> groups;
+
+    // Buffers used during canonicalization.
+    mutable std::vector<uint64_t> values;
+    mutable std::vector<uint64_t> order;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -1,4 +1,9 @@
 #include "storm/generator/NextStateGenerator.h"
+
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
 #include <storm/exceptions/NotImplementedException.h>
 #include <storm/exceptions/WrongFormatException.h>
 
@@ -7,6 +12,7 @@
 
 #include "storm/logic/Formulas.h"
 
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -14,10 +20,45 @@
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace generator {
 
+namespace {
+// Describes how the value of a state variable is decoded from a compressed state.
+struct PackedVariable {
+    bool isBoolean;
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lowerBound;
+};
+
+std::unordered_map<storm::expressions::Variable, PackedVariable> getPackedVariables(VariableInformation const& variableInformation) {
+    std::unordered_map<storm::expressions::Variable, PackedVariable> result;
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        result.emplace(locationVariable.variable, PackedVariable{false, locationVariable.bitOffset, locationVariable.bitWidth, 0});
+    }
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        result.emplace(booleanVariable.variable, PackedVariable{true, booleanVariable.bitOffset, 1, 0});
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        result.emplace(integerVariable.variable,
+                       PackedVariable{false, integerVariable.bitOffset, integerVariable.bitWidth, static_cast<int64_t>(integerVariable.lowerBound)});
+    }
+    return result;
+}
+
+double getValue(CompressedState const& state, PackedVariable const& variable) {
+    if (variable.isBoolean) {
+        return state.get(variable.bitOffset) ? 1.0 : 0.0;
+    } else if (variable.bitWidth == 0) {
+        return static_cast<double>(variable.lowerBound);
+    }
+    return static_cast<double>(static_cast<int64_t>(state.getAsInt(variable.bitOffset, variable.bitWidth)) + variable.lowerBound);
+}
+}  // namespace
+
 template<typename ValueType, typename StateType>
 StateValuationFunctionMask<ValueType, StateType>::StateValuationFunctionMask(std::function<bool(storm::expressions::SimpleValuation const&, uint64_t)> const& f)
     : func(f) {
@@ -77,13 +118,13 @@ template<typename ValueType, typename StateType>
 storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
     storm::storage::sparse::StateValuationsBuilder result;
     for (auto const& v : variableInformation.locationVariables) {
-        result.addVariable(v.variable);
+        result.addVariable(v.variable, 0, static_cast<int64_t>(v.highestValue));
     }
     for (auto const& v : variableInformation.booleanVariables) {
         result.addVariable(v.variable);
     }
     for (auto const& v : variableInformation.integerVariables) {
-        result.addVariable(v.variable);
+        result.addVariable(v.variable, v.lowerBound, v.upperBound);
     }
     return result;
 }
@@ -98,7 +139,7 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
     }
     for (auto const& v : variableInformation.integerVariables) {
         if (v.observable) {
-            result.addVariable(v.variable);
+            result.addVariable(v.variable, v.lowerBound, v.upperBound);
         }
     }
     for (auto const& l : variableInformation.observationLabels) {
@@ -173,7 +214,8 @@ storm::storage::sparse::StateValuations NextStateGenerator<ValueType, StateType>
 template<typename ValueType, typename StateType>
 storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(
     storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices,
-    std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions) {
+    std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions,
+    uint64_t numberOfThreads) {
     labelsAndExpressions.insert(labelsAndExpressions.end(), this->options.getExpressionLabels().begin(), this->options.getExpressionLabels().end());
 
     // Make the labels unique.
@@ -190,22 +232,116 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
     // Prepare result.
     storm::models::sparse::StateLabeling result(stateStorage.getNumberOfStates());
 
-    // Initialize labeling.
-    for (auto const& label : labelsAndExpressions) {
-        result.addLabel(label.first);
+    // The states are split into chunks that are labeled concurrently. As the states are only reachable by iterating over the state storage,
+    // we remember an iterator to the first state of each chunk.
+    uint64_t const chunkSize = 4096;
+    auto const& states = stateStorage.stateToId;
+    std::vector<typename storm::storage::sparse::StateToIdMap<StateType>::const_iterator> chunkBegins;
+    uint64_t stateNumber = 0;
+    for (auto stateIt = states.begin(), stateIte = states.end(); stateIt != stateIte; ++stateIt, ++stateNumber) {
+        if (stateNumber % chunkSize == 0) {
+            chunkBegins.push_back(stateIt);
+        }
     }
 
-    auto const& states = stateStorage.stateToId;
-    for (auto const& stateIndexPair : states) {
-        unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
-        unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
-
-        for (auto const& label : labelsAndExpressions) {
-            // Add label to state, if the corresponding expression is true.
-            if (evaluator->asBool(label.second)) {
-                result.addLabelToState(label.first, stateIndexPair.second);
+    // Labels whose expressions only refer to state variables are evaluated for a whole chunk at once by a batch evaluator. This is not done for
+    // exact models, as the batch evaluator computes in floating point. The values of the needed state variables are decoded column-wise.
+    std::vector<std::unique_ptr<storm::expressions::BatchExpressionEvaluator>> batchEvaluators(labelsAndExpressions.size());
+    std::vector<std::vector<uint64_t>> batchEvaluatorColumns(labelsAndExpressions.size());
+    std::vector<PackedVariable> batchVariables;
+    bool needsStateEvaluator = false;
+    if (std::is_same<ValueType, double>::value) {
+        auto packedVariables = getPackedVariables(variableInformation);
+        std::unordered_map<storm::expressions::Variable, uint64_t> variableToColumn;
+        for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+            storm::expressions::Expression const& expression = labelsAndExpressions[labelIndex].second;
+            if (!storm::expressions::BatchExpressionEvaluator::isSupported(expression)) {
+                needsStateEvaluator = true;
+                continue;
+            }
+            auto batchEvaluator = std::make_unique<storm::expressions::BatchExpressionEvaluator>(expression);
+            auto const& variables = batchEvaluator->getVariables();
+            bool onlyStateVariables = std::all_of(variables.begin(), variables.end(), [&packedVariables](storm::expressions::Variable const& variable) {
+                return packedVariables.count(variable) > 0;
+            });
+            if (!onlyStateVariables) {
+                needsStateEvaluator = true;
+                continue;
+            }
+            for (auto const& variable : batchEvaluator->getVariables()) {
+                auto insertionResult = variableToColumn.emplace(variable, batchVariables.size());
+                if (insertionResult.second) {
+                    batchVariables.push_back(packedVariables.at(variable));
+                }
+                batchEvaluatorColumns[labelIndex].push_back(insertionResult.first->second);
+            }
+            batchEvaluators[labelIndex] = std::move(batchEvaluator);
+        }
+    } else {
+        needsStateEvaluator = true;
+    }
+
+    // The first thread uses the evaluator of this generator, all other threads create their own one.
+    std::vector<std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>>> threadEvaluators(std::max<uint64_t>(numberOfThreads, 1));
+    std::vector<storm::storage::BitVector> labelings(labelsAndExpressions.size(), storm::storage::BitVector(stateStorage.getNumberOfStates()));
+    std::mutex labelingsMutex;
+    storm::utility::parallel::forEachChunk(threadEvaluators.size(), chunkBegins.size(), 1, [&](uint64_t threadIndex, uint64_t chunk, uint64_t) {
+        if (threadIndex > 0 && !threadEvaluators[threadIndex]) {
+            threadEvaluators[threadIndex] = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(*this->expressionManager);
+        }
+        storm::expressions::ExpressionEvaluator<ValueType>& threadEvaluator = threadIndex == 0 ? *this->evaluator : *threadEvaluators[threadIndex];
+
+        // Threads must not write to the same bit vector buckets, so we first collect the labeled states of the chunk.
+        std::vector<std::vector<StateType>> labeledStates(labelsAndExpressions.size());
+        std::vector<StateType> chunkStateIndices;
+        std::vector<std::vector<double>> columns(batchVariables.size());
+        auto stateIt = chunkBegins[chunk];
+        for (uint64_t i = 0; i < chunkSize && stateIt != states.end(); ++i, ++stateIt) {
+            auto stateIndexPair = *stateIt;
+            chunkStateIndices.push_back(stateIndexPair.second);
+            for (uint64_t column = 0; column < batchVariables.size(); ++column) {
+                columns[column].push_back(getValue(stateIndexPair.first, batchVariables[column]));
+            }
+            if (!needsStateEvaluator) {
+                continue;
+            }
+
+            unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, threadEvaluator);
+            unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, threadEvaluator);
+            for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+                // Add label to state, if the corresponding expression is true.
+                if (!batchEvaluators[labelIndex] && threadEvaluator.asBool(labelsAndExpressions[labelIndex].second)) {
+                    labeledStates[labelIndex].push_back(stateIndexPair.second);
+                }
+            }
+        }
+
+        storm::storage::BitVector chunkLabeling(chunkStateIndices.size());
+        for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+            if (!batchEvaluators[labelIndex]) {
+                continue;
+            }
+            std::vector<double const*> evaluatorColumns;
+            for (auto column : batchEvaluatorColumns[labelIndex]) {
+                evaluatorColumns.push_back(columns[column].data());
+            }
+            batchEvaluators[labelIndex]->evaluateAsBool(chunkStateIndices.size(), evaluatorColumns, chunkLabeling);
+            for (auto stateInChunk : chunkLabeling) {
+                labeledStates[labelIndex].push_back(chunkStateIndices[stateInChunk]);
             }
         }
+
+        std::lock_guard<std::mutex> lock(labelingsMutex);
+        for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+            for (auto state : labeledStates[labelIndex]) {
+                labelings[labelIndex].set(state, true);
+            }
+        }
+    });
+
+    // Initialize labeling.
+    for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+        result.addLabel(labelsAndExpressions[labelIndex].first, std::move(labelings[labelIndex]));
     }
 
     if (!result.containsLabel("init")) {
@@ -248,6 +384,11 @@ void NextStateGenerator<ValueType, StateType>::unpackTransientVariableValuesInto
     // This method should be overwritten in case there are transient variables (e.g. JANI).
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::recycle(StateBehavior<ValueType, StateType>&& behavior) {
+    choicePool.recycle(std::move(behavior));
+}
+
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueType, StateType>& result) {
     // If the model we build is a Markov Automaton, we postprocess the choices to sum all Markovian choices
@@ -342,6 +483,11 @@ void NextStateGenerator<ValueType, StateType>::remapStateIds(std::function<State
     // Nothing to be done.
 }
 
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+    STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Cloning is not supported for this next-state generator.");
+}
+
 template class NextStateGenerator<double>;
 
 template class ActionMask<double>;
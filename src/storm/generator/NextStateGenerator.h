@@ -15,6 +15,7 @@
 #include "storm/builder/BuilderOptions.h"
 #include "storm/builder/RewardModelInformation.h"
 
+#include "storm/generator/ChoicePool.h"
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/StateBehavior.h"
 #include "storm/generator/VariableInformation.h"
@@ -98,6 +99,12 @@ class NextStateGenerator {
 
     void load(CompressedState const& state);
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
+
+    /*!
+     * Hands a behavior that was obtained from expand back to the generator once it is no longer needed. Its memory is then reused by
+     * subsequent calls to expand. Calling this method is optional.
+     */
+    void recycle(StateBehavior<ValueType, StateType>&& behavior);
     bool satisfies(storm::expressions::Expression const& expression) const;
 
     /// Adds the valuation for the currently loaded state to the given builder
@@ -118,9 +125,13 @@ class NextStateGenerator {
 
     virtual std::map<std::string, storm::storage::PlayerIndex> getPlayerNameToIndexMap() const;
 
+    /*!
+     * Creates the state labeling for the given states. The label expressions are evaluated by the given number of threads, each of which
+     * uses its own expression evaluator.
+     */
     virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
                                                        std::vector<StateType> const& initialStateIndices = {},
-                                                       std::vector<StateType> const& deadlockStateIndices = {}) = 0;
+                                                       std::vector<StateType> const& deadlockStateIndices = {}, uint64_t numberOfThreads = 1) = 0;
 
     NextStateGeneratorOptions const& getOptions() const;
 
@@ -135,13 +146,22 @@ class NextStateGenerator {
      */
     void remapStateIds(std::function<StateType(StateType const&)> const& remapping);
 
+    /*!
+     * Creates a generator that produces the same behavior as this one, but has its own internal data (e.g. its own
+     * expression evaluator) so that both generators can expand states concurrently.
+     *
+     * @return The new generator.
+     */
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+
    protected:
     /*!
      * Creates the state labeling for the given states using the provided labels and expressions.
      */
     storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
                                                std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices,
-                                               std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions);
+                                               std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions,
+                                               uint64_t numberOfThreads = 1);
 
     /*!
      * Sets the values of all transient variables in the current state to the given evaluator.
@@ -195,6 +215,9 @@ class NextStateGenerator {
     boost::optional<std::vector<uint64_t>> overlappingGuardStates;
 
     std::shared_ptr<ActionMask<ValueType, StateType>> actionMask;
+
+    /// The choices and behaviors that are reused across calls to expand.
+    ChoicePool<ValueType, StateType> choicePool;
 };
 }  // namespace generator
 }  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <unordered_set>
+
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -15,12 +17,14 @@
 #include "storm/solver/SmtSolver.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/utility/combinatorics.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/tracing.h"
 
 #include "storm/utility/vector.h"
 
@@ -101,6 +105,143 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    compileExpressions();
+
+    commandGuardIndices.reserve(program.getNumberOfModules());
+    for (auto const& module : program.getModules()) {
+        commandGuardIndices.emplace_back(module, this->variableInformation);
+    }
+
+    for (uint_fast64_t actionIndex : program.getSynchronizingActionIndices()) {
+        if (synchronizingModulesByActionIndex.size() <= actionIndex) {
+            synchronizingModulesByActionIndex.resize(actionIndex + 1);
+        }
+        for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            if (program.getModule(moduleIndex).hasActionIndex(actionIndex)) {
+                synchronizingModulesByActionIndex[actionIndex].push_back(moduleIndex);
+            }
+        }
+    }
+
+    if (this->options.isSymmetryReductionSet()) {
+        setUpSymmetryReduction();
+    }
+    STORM_LOG_WARN_COND(!this->options.isPartialOrderReductionSet(),
+                        "Partial-order reduction is not supported for PRISM programs. Convert the program to JANI to enable it.");
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::setUpSymmetryReduction() {
+    bool supported = program.getModelType() != storm::prism::Program::ModelType::SMG && !program.isPartiallyObservable() &&
+                     !this->options.isAddOutOfBoundsStateSet() && this->actionMask == nullptr;
+    STORM_LOG_WARN_COND(supported, "Symmetry reduction is not supported for games, partially observable models, action masks and out-of-bounds states. "
+                                   "The full state space is explored.");
+    if (!supported) {
+        return;
+    }
+
+    // Collect the expressions whose values need to be preserved by the reduction.
+    std::vector<storm::expressions::Expression> preservedExpressions;
+    if (this->options.isBuildAllLabelsSet()) {
+        for (auto const& label : program.getLabels()) {
+            preservedExpressions.push_back(label.getStatePredicateExpression());
+        }
+    } else {
+        for (auto const& labelName : this->options.getLabelNames()) {
+            if (program.hasLabel(labelName)) {
+                preservedExpressions.push_back(program.getLabelExpression(labelName));
+            }
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        preservedExpressions.push_back(expressionLabel.second);
+    }
+    for (auto const& terminalExpressionAndBool : this->terminalStates) {
+        preservedExpressions.push_back(terminalExpressionAndBool.first);
+    }
+    for (auto const& rewardModel : rewardModels) {
+        for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+            preservedExpressions.push_back(stateReward.getStatePredicateExpression());
+            preservedExpressions.push_back(stateReward.getRewardValueExpression());
+        }
+        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            preservedExpressions.push_back(stateActionReward.getStatePredicateExpression());
+            preservedExpressions.push_back(stateActionReward.getRewardValueExpression());
+        }
+        for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+            preservedExpressions.push_back(transitionReward.getSourceStatePredicateExpression());
+            preservedExpressions.push_back(transitionReward.getTargetStatePredicateExpression());
+            preservedExpressions.push_back(transitionReward.getRewardValueExpression());
+        }
+    }
+
+    ModuleSymmetryReduction reduction(program, this->variableInformation, preservedExpressions);
+    STORM_LOG_WARN_COND(reduction.hasSymmetries(), "Symmetry reduction is enabled, but no symmetric modules were found.");
+    if (reduction.hasSymmetries()) {
+        symmetryReduction = std::move(reduction);
+    }
+}
+
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::getCanonicalizingCallback(
+    StateToIdCallback const& stateToIdCallback) {
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        canonicalState = state;
+        symmetryReduction->canonicalize(canonicalState);
+        return stateToIdCallback(canonicalState);
+    };
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    uint64_t numberOfCommands = 0;
+    uint64_t numberOfUpdates = 0;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            numberOfCommands = std::max<uint64_t>(numberOfCommands, command.getGlobalIndex() + 1);
+            for (auto const& update : command.getUpdates()) {
+                numberOfUpdates = std::max<uint64_t>(numberOfUpdates, update.getGlobalIndex() + 1);
+            }
+        }
+    }
+    compiledGuards.assign(numberOfCommands, boost::none);
+    compiledAssignments.assign(numberOfUpdates, {});
+
+    bool compile = this->options.isCompileExpressionsSet();
+    StateExpressionCompiler compiler(this->variableInformation);
+    uint64_t numberOfCompiled = 0;
+    uint64_t numberOfExpressions = 0;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            if (compile) {
+                compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+                numberOfCompiled += compiledGuards[command.getGlobalIndex()] ? 1 : 0;
+            }
+            ++numberOfExpressions;
+            for (auto const& update : command.getUpdates()) {
+                auto& compiledUpdate = compiledAssignments[update.getGlobalIndex()];
+                compiledUpdate.assign(update.getNumberOfAssignments(), boost::none);
+                if (compile) {
+                    for (uint64_t assignmentIndex = 0; assignmentIndex < update.getNumberOfAssignments(); ++assignmentIndex) {
+                        compiledUpdate[assignmentIndex] = compiler.compile(update.getAssignments()[assignmentIndex].getExpression());
+                        numberOfCompiled += compiledUpdate[assignmentIndex] ? 1 : 0;
+                    }
+                }
+                numberOfExpressions += update.getNumberOfAssignments();
+            }
+        }
+    }
+    if (compile) {
+        STORM_LOG_INFO("Compiled " << numberOfCompiled << " of " << numberOfExpressions << " guards and assignments.");
+    }
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+    // The stored program is already preprocessed, so we can skip the preprocessing by using the delegate constructor.
+    return std::shared_ptr<PrismNextStateGenerator<ValueType, StateType>>(
+        new PrismNextStateGenerator<ValueType, StateType>(this->program, this->options, this->actionMask, false));
 }
 
 template<typename ValueType, typename StateType>
@@ -178,7 +319,12 @@ bool PrismNextStateGenerator<ValueType, StateType>::isPartiallyObservable() cons
 }
 
 template<typename ValueType, typename StateType>
-std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
+    StateToIdCallback canonicalizingCallback;
+    if (symmetryReduction) {
+        canonicalizingCallback = getCanonicalizingCallback(originalStateToIdCallback);
+    }
+    StateToIdCallback const& stateToIdCallback = symmetryReduction ? canonicalizingCallback : originalStateToIdCallback;
     std::vector<StateType> initialStateIndices;
 
     // If all states are initial, we can simplify the enumeration substantially.
@@ -275,26 +421,33 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
         STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
     }
 
+    if (symmetryReduction) {
+        // Symmetric initial states are represented by the same state.
+        std::unordered_set<StateType> uniqueIndices;
+        auto newEnd = std::remove_if(initialStateIndices.begin(), initialStateIndices.end(),
+                                     [&uniqueIndices](StateType const& index) { return !uniqueIndices.insert(index).second; });
+        initialStateIndices.erase(newEnd, initialStateIndices.end());
+    }
+
     return initialStateIndices;
 }
 
 template<typename ValueType, typename StateType>
-StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& originalStateToIdCallback) {
+    STORM_TRACE_ZONE("PrismNextStateGenerator::expand");
+    StateToIdCallback canonicalizingCallback;
+    if (symmetryReduction) {
+        canonicalizingCallback = getCanonicalizingCallback(originalStateToIdCallback);
+    }
+    StateToIdCallback const& stateToIdCallback = symmetryReduction ? canonicalizingCallback : originalStateToIdCallback;
+
     // Prepare the result, in case we return early.
-    StateBehavior<ValueType, StateType> result;
+    StateBehavior<ValueType, StateType> result = this->choicePool.getStateBehavior();
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
-    for (auto const& rewardModel : rewardModels) {
-        ValueType stateRewardValue = storm::utility::zero<ValueType>();
-        if (rewardModel.get().hasStateRewards()) {
-            for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                    stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
-                }
-            }
-        }
-        result.addStateReward(stateRewardValue);
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        result.addStateReward(getStateReward(rewardModelIndex));
     }
 
     // If a terminal expression was set and we must not expand this state, return now.
@@ -309,18 +462,19 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     // Get all choices for the state.
     result.setExpanded();
 
-    std::vector<Choice<ValueType>> allChoices;
+    // The choices are only left over if a previous expansion was aborted.
+    this->choicePool.recycleChoices(allChoices);
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
         if (allChoices.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
+            addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
             addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
         }
     } else {
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
     }
 
@@ -334,7 +488,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType> globalChoice = this->choicePool.getChoice();
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -387,7 +541,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Move the newly fused choice in place.
-        allChoices.clear();
+        this->choicePool.recycleChoices(allChoices);
         allChoices.push_back(std::move(globalChoice));
     }
 
@@ -418,12 +572,129 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     for (auto& choice : allChoices) {
         result.addChoice(std::move(choice));
     }
+    allChoices.clear();
 
     this->postprocess(result);
 
     return result;
 }
 
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::getStateReward(uint64_t rewardModelIndex) const {
+    ValueType stateRewardValue = storm::utility::zero<ValueType>();
+    storm::prism::RewardModel const& rewardModel = rewardModels[rewardModelIndex].get();
+    if (rewardModel.hasStateRewards()) {
+        for (auto const& stateReward : rewardModel.getStateRewards()) {
+            if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
+                stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
+            }
+        }
+    }
+    return stateRewardValue;
+}
+
+template<typename ValueType, typename StateType>
+boost::optional<CompressedState> PrismNextStateGenerator<ValueType, StateType>::sampleSuccessor(std::function<double()> const& random) {
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Sampling successors is only supported for DTMCs.");
+
+    // Collect the enabled choices, which are the unlabeled commands and the combinations of synchronizing commands.
+    enabledAsynchronousCommands.clear();
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        storm::prism::Module const& module = program.getModule(i);
+        for (uint64_t j : commandGuardIndices[i].getCandidateCommands(*this->state)) {
+            storm::prism::Command const& command = module.getCommand(j);
+            if (isCommandPotentiallySynchronizing(command) || (this->actionMask != nullptr && !this->actionMask->query(*this, command.getActionIndex()))) {
+                continue;
+            }
+            if (isGuardSatisfied(command)) {
+                enabledAsynchronousCommands.push_back(&command);
+            }
+        }
+    }
+    uint64_t numberOfChoices = enabledAsynchronousCommands.size();
+    enabledSynchronizingCommands.clear();
+    for (uint_fast64_t actionIndex : program.getSynchronizingActionIndices()) {
+        if (this->actionMask != nullptr && !this->actionMask->query(*this, actionIndex)) {
+            continue;
+        }
+        auto optionalActiveCommandLists = getActiveCommandsByActionIndex(actionIndex);
+        if (optionalActiveCommandLists) {
+            uint64_t numberOfCombinations = 1;
+            for (auto const& commands : optionalActiveCommandLists.get()) {
+                numberOfCombinations *= commands.size();
+            }
+            numberOfChoices += numberOfCombinations;
+            enabledSynchronizingCommands.push_back(std::move(optionalActiveCommandLists.get()));
+        }
+    }
+    if (numberOfChoices == 0) {
+        return boost::none;
+    }
+
+    // Select one of the choices uniformly.
+    uint64_t choiceIndex = std::min(static_cast<uint64_t>(random() * numberOfChoices), numberOfChoices - 1);
+    if (choiceIndex < enabledAsynchronousCommands.size()) {
+        return applyUpdate(*this->state, sampleUpdate(*enabledAsynchronousCommands[choiceIndex], random()));
+    }
+    choiceIndex -= enabledAsynchronousCommands.size();
+    for (auto const& activeCommandLists : enabledSynchronizingCommands) {
+        uint64_t numberOfCombinations = 1;
+        for (auto const& commands : activeCommandLists) {
+            numberOfCombinations *= commands.size();
+        }
+        if (choiceIndex >= numberOfCombinations) {
+            choiceIndex -= numberOfCombinations;
+            continue;
+        }
+        // Decode the combination of commands and apply one update of each command.
+        CompressedState successor = *this->state;
+        for (auto const& commands : activeCommandLists) {
+            storm::prism::Command const& command = commands[choiceIndex % commands.size()];
+            choiceIndex /= commands.size();
+            successor = applyUpdate(successor, sampleUpdate(command, random()));
+        }
+        return successor;
+    }
+    STORM_LOG_ASSERT(false, "The selected choice does not exist.");
+    return boost::none;
+}
+
+template<typename ValueType, typename StateType>
+storm::prism::Update const& PrismNextStateGenerator<ValueType, StateType>::sampleUpdate(storm::prism::Command const& command, double quantile) const {
+    if (command.getNumberOfUpdates() == 1) {
+        return command.getUpdate(0);
+    }
+    // The likelihoods are normalized by their sum, so that numerical inaccuracies do not bias the selection towards the last update.
+    double sum = 0.0;
+    for (auto const& update : command.getUpdates()) {
+        sum += storm::utility::convertNumber<double>(this->evaluator->asRational(update.getLikelihoodExpression()));
+    }
+    double threshold = quantile * sum;
+    uint64_t lastUpdateWithPositiveLikelihood = 0;
+    double cumulative = 0.0;
+    for (uint64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+        double likelihood = storm::utility::convertNumber<double>(this->evaluator->asRational(command.getUpdate(k).getLikelihoodExpression()));
+        if (likelihood > 0.0) {
+            cumulative += likelihood;
+            lastUpdateWithPositiveLikelihood = k;
+            if (cumulative > threshold) {
+                return command.getUpdate(k);
+            }
+        }
+    }
+    return command.getUpdate(lastUpdateWithPositiveLikelihood);
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isGuardSatisfied(storm::prism::Command const& command) const {
+    auto const& compiledGuard = compiledGuards[command.getGlobalIndex()];
+    if (compiledGuard) {
+        return compiledGuard->evaluateAsBool(*this->state);
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
+}
+
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
     return this->evaluator->asBool(expr);
@@ -440,23 +711,27 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 
     auto assignmentIt = update.getAssignments().begin();
     auto assignmentIte = update.getAssignments().end();
+    // The compiled assignments (if any) are evaluated in the currently loaded state, just like the evaluator.
+    auto compiledAssignmentIt = compiledAssignments[update.getGlobalIndex()].begin();
 
     // Iterate over all boolean assignments and carry them out.
     auto boolIt = this->variableInformation.booleanVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+        newState.set(boolIt->bitOffset, *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsBool(*this->state)
+                                                              : this->evaluator->asBool(assignmentIt->getExpression()));
     }
 
     // Iterate over all integer assignments and carry them out.
     auto integerIt = this->variableInformation.integerVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        int_fast64_t assignedValue = *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsInt(*this->state)
+                                                           : this->evaluator->asInt(assignmentIt->getExpression());
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                 return this->outOfBoundsState;
@@ -482,12 +757,13 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 }
 
 struct ActiveCommandData {
-    ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
+    ActiveCommandData(storm::prism::Module const* modulePtr, CommandGuardIndex const* guardIndexPtr, std::set<uint_fast64_t> const* commandIndicesPtr,
                       typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+        : modulePtr(modulePtr), guardIndexPtr(guardIndexPtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
         // Intentionally left empty
     }
     storm::prism::Module const* modulePtr;
+    CommandGuardIndex const* guardIndexPtr;
     std::set<uint_fast64_t> const* commandIndicesPtr;
     typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
 };
@@ -500,16 +776,13 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
     // If we find one module without an enabled command, we return boost::none.
     // At the same time, we store pointers to the relevant modules, the relevant command sets and the first enabled command within each set.
 
-    // Iterate over all modules.
+    // Iterate over all modules that have a command labeled with the given action.
     std::vector<ActiveCommandData> activeCommands;
-    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+    if (actionIndex >= synchronizingModulesByActionIndex.size()) {
+        return boost::none;
+    }
+    for (uint_fast64_t i : synchronizingModulesByActionIndex[actionIndex]) {
         storm::prism::Module const& module = program.getModule(i);
-
-        // If the module has no command labeled with the given action, we can skip this module.
-        if (!module.hasActionIndex(actionIndex)) {
-            continue;
-        }
-
         std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
 
         // If the module contains the action, but there is no command in the module that is labeled with
@@ -520,7 +793,11 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
 
         // Look up commands by their indices and check if the guard evaluates to true in the given state.
         bool hasOneEnabledCommand = false;
+        CommandGuardIndex const& guardIndex = commandGuardIndices[i];
         for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
+            if (!guardIndex.isCandidate(*this->state, *commandIndexIt)) {
+                continue;
+            }
             storm::prism::Command const& command = module.getCommand(*commandIndexIt);
             if (!isCommandPotentiallySynchronizing(command)) {
                 continue;
@@ -531,10 +808,10 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isGuardSatisfied(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
-                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                activeCommands.emplace_back(&module, &guardIndex, &commandIndices, commandIndexIt);
                 break;
             }
         }
@@ -558,6 +835,9 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         // Look up commands by their indices and add them if the guard evaluates to true in the given state.
         auto commandIndexIte = activeCommand.commandIndicesPtr->end();
         for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
+            if (!activeCommand.guardIndexPtr->isCandidate(*this->state, *commandIndexIt)) {
+                continue;
+            }
             storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
             if (commandFilter != CommandFilter::All) {
                 STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -565,7 +845,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isGuardSatisfied(command)) {
                 commands.push_back(command);
             }
         }
@@ -578,17 +858,15 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
 }
 
 template<typename ValueType, typename StateType>
-std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
-                                                                                                     StateToIdCallback stateToIdCallback,
-                                                                                                     CommandFilter const& commandFilter) {
-    std::vector<Choice<ValueType>> result;
+void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state,
+                                                                           StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter) {
 
     // Iterate over all modules.
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
 
-        // Iterate over all commands.
-        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+        // Iterate over all commands whose guard can be satisfied according to the guard index.
+        for (uint64_t j : commandGuardIndices[i].getCandidateCommands(state)) {
             storm::prism::Command const& command = module.getCommand(j);
 
             // Only consider commands that are not possibly synchronizing.
@@ -608,12 +886,12 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isGuardSatisfied(command)) {
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
+            choices.push_back(this->choicePool.getChoice(command.getActionIndex(), command.isMarkovian()));
+            Choice<ValueType>& choice = choices.back();
 
             // Remember the choice origin only if we were asked to.
             if (this->options.isBuildChoiceOriginsSet()) {
@@ -672,30 +950,52 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
         }
     }
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
 void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribution(
-    storm::storage::BitVector const& state, ValueType const& probability, uint64_t position,
+    storm::storage::BitVector const& state, uint64_t firstChangedPosition,
     std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> const& iteratorList,
     storm::generator::Distribution<StateType, ValueType>& distribution, StateToIdCallback stateToIdCallback) {
-    if (storm::utility::isZero<ValueType>(probability)) {
-        return;
+    uint64_t const numberOfCommands = iteratorList.size();
+    STORM_LOG_ASSERT(numberOfCommands > 0, "Expected at least one synchronizing command.");
+    if (partialSynchronizedDistributions.size() < numberOfCommands) {
+        partialSynchronizedDistributions.resize(numberOfCommands);
+    }
+    if (firstChangedPosition == 0) {
+        partialSynchronizedDistributions[0].clear();
+        partialSynchronizedDistributions[0].emplace_back(state, storm::utility::one<ValueType>());
     }
 
-    if (position >= iteratorList.size()) {
-        StateType id = stateToIdCallback(state);
-        distribution.add(id, probability);
-    } else {
-        storm::prism::Command const& command = *iteratorList[position];
-        for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
-            storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+    // Applies all updates of the given command to the given partial distribution. Combinations with probability zero are dropped.
+    // The resulting states are visited in the same order as in a depth-first enumeration of all update combinations.
+    auto applyCommand = [this](storm::prism::Command const& command, std::vector<std::pair<CompressedState, ValueType>> const& partialDistribution,
+                               auto const& callback) {
+        updateLikelihoods.clear();
+        for (auto const& update : command.getUpdates()) {
+            updateLikelihoods.push_back(this->evaluator->asRational(update.getLikelihoodExpression()));
+        }
+        for (auto const& partialState : partialDistribution) {
+            for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
+                ValueType probability = partialState.second * updateLikelihoods[j];
+                if (!storm::utility::isZero<ValueType>(probability)) {
+                    callback(applyUpdate(partialState.first, command.getUpdate(j)), std::move(probability));
+                }
+            }
         }
+    };
+
+    // Only the partial distributions after the changed command need to be recomputed.
+    for (uint64_t position = firstChangedPosition; position + 1 < numberOfCommands; ++position) {
+        auto& nextPartialDistribution = partialSynchronizedDistributions[position + 1];
+        nextPartialDistribution.clear();
+        applyCommand(*iteratorList[position], partialSynchronizedDistributions[position],
+                     [&nextPartialDistribution](CompressedState&& successor, ValueType&& probability) {
+                         nextPartialDistribution.emplace_back(std::move(successor), std::move(probability));
+                     });
     }
+    applyCommand(*iteratorList.back(), partialSynchronizedDistributions[numberOfCommands - 1],
+                 [&](CompressedState&& successor, ValueType&& probability) { distribution.add(stateToIdCallback(successor), probability); });
 }
 
 template<typename ValueType, typename StateType>
@@ -720,19 +1020,20 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 iteratorList[i] = activeCommandList[i].cbegin();
             }
 
-            storm::generator::Distribution<StateType, ValueType> distribution;
+            storm::generator::Distribution<StateType, ValueType>& distribution = synchronizedDistribution;
 
             // As long as there is one feasible combination of commands, keep on expanding it.
             bool done = false;
+            uint64_t firstChangedPosition = 0;
             while (!done) {
                 distribution.clear();
-                generateSynchronizedDistribution(state, storm::utility::one<ValueType>(), 0, iteratorList, distribution, stateToIdCallback);
+                generateSynchronizedDistribution(state, firstChangedPosition, iteratorList, distribution, stateToIdCallback);
                 distribution.compress();
 
                 // At this point, we applied all commands of the current command combination and newTargetStates
                 // contains all target states and their respective probabilities. That means we are now ready to
                 // add the choice to the list of transitions.
-                choices.push_back(Choice<ValueType>(actionIndex));
+                choices.push_back(this->choicePool.getChoice(actionIndex));
 
                 // Now create the actual distribution.
                 Choice<ValueType>& choice = choices.back();
@@ -794,6 +1095,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                     ++iteratorList[j];
                     if (iteratorList[j] != activeCommandList[j].end()) {
                         movedIterator = true;
+                        firstChangedPosition = j;
                     } else {
                         // Reset the iterator to the beginning of the list.
                         iteratorList[j] = activeCommandList[j].begin();
@@ -814,7 +1116,8 @@ std::map<std::string, storm::storage::PlayerIndex> PrismNextStateGenerator<Value
 template<typename ValueType, typename StateType>
 storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
                                                                                           std::vector<StateType> const& initialStateIndices,
-                                                                                          std::vector<StateType> const& deadlockStateIndices) {
+                                                                                          std::vector<StateType> const& deadlockStateIndices,
+                                                                                          uint64_t numberOfThreads) {
     // Gather a vector of labels and their expressions.
     std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
     if (this->options.isBuildAllLabelsSet()) {
@@ -832,7 +1135,7 @@ storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateTyp
         }
     }
 
-    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, labels);
+    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, labels, numberOfThreads);
 }
 
 template<typename ValueType, typename StateType>
@@ -1,6 +1,14 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <functional>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CommandGuardIndex.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/Distribution.h"
+#include "storm/generator/ModuleSymmetryReduction.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -8,9 +16,6 @@
 
 namespace storm {
 namespace generator {
-template<typename StateType, typename ValueType>
-class Distribution;
-
 template<typename ValueType, typename StateType = uint32_t>
 class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
    public:
@@ -37,16 +42,33 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
     bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const&) const;
 
+    /*!
+     * Samples a successor of the currently loaded state of a DTMC without materializing its choices. As in the choice that expand builds for
+     * deterministic models, every enabled unlabeled command and every enabled combination of synchronizing commands is selected with the same
+     * probability. Only the guards and the likelihoods of the updates of the selected commands are evaluated and no rewards are computed.
+     *
+     * @param random Yields uniformly distributed numbers in [0,1).
+     * @return The sampled successor or none, if no command is enabled in the loaded state.
+     */
+    boost::optional<CompressedState> sampleSuccessor(std::function<double()> const& random);
+
+    /*!
+     * Computes the state reward of the currently loaded state in the (selected) reward model with the given index.
+     */
+    ValueType getStateReward(uint64_t rewardModelIndex) const;
+
     virtual std::size_t getNumberOfRewardModels() const override;
     virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
     virtual std::map<std::string, storm::storage::PlayerIndex> getPlayerNameToIndexMap() const override;
 
     virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
                                                        std::vector<StateType> const& initialStateIndices = {},
-                                                       std::vector<StateType> const& deadlockStateIndices = {}) override;
+                                                       std::vector<StateType> const& deadlockStateIndices = {}, uint64_t numberOfThreads = 1) override;
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
    private:
     void checkValid() const;
 
@@ -89,11 +111,11 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     /*!
      * Retrieves all choices that are definitively asynchronous, possible from the given state.
      *
+     * @param choices The new choices are inserted in this vector
      * @param state The state for which to retrieve the unlabeled choices.
-     * @return The asynchronous choices of the state.
      */
-    std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                          CommandFilter const& commandFilter = CommandFilter::All);
+    void addAsynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback,
+                                CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
@@ -117,14 +139,44 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const override;
 
     /*!
-     * A recursive helper function to generate a synchronziing distribution.
+     * Generates the distribution of the given combination of synchronizing commands. The states (and probabilities) that result from applying
+     * one update of each of the first commands are kept across calls. Hence, consecutive combinations that only differ in their last commands
+     * share the updates of the common commands.
+     *
+     * @param firstChangedPosition The first position of the iterator list that changed since the previous call. Must be zero for the first
+     * combination of a state and action.
      */
-    void generateSynchronizedDistribution(storm::storage::BitVector const& state, ValueType const& probability, uint64_t position,
+    void generateSynchronizedDistribution(storm::storage::BitVector const& state, uint64_t firstChangedPosition,
                                           std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> const& iteratorList,
                                           storm::generator::Distribution<StateType, ValueType>& distribution, StateToIdCallback stateToIdCallback);
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Samples one of the updates of the given command according to their likelihoods in the currently loaded state.
+     */
+    storm::prism::Update const& sampleUpdate(storm::prism::Command const& command, double quantile) const;
+
+    /*!
+     * Retrieves whether the guard of the given command is satisfied in the currently loaded state.
+     */
+    bool isGuardSatisfied(storm::prism::Command const& command) const;
+
+    /*!
+     * Compiles the guards and the assignments of all commands (as far as possible), such that they can be evaluated without the evaluator.
+     */
+    void compileExpressions();
+
+    /*!
+     * Detects the symmetric modules of the program (if symmetry reduction is enabled and supported for the program).
+     */
+    void setUpSymmetryReduction();
+
+    /*!
+     * Creates a callback that maps states to the representative of their orbit before passing them to the given callback.
+     */
+    StateToIdCallback getCanonicalizingCallback(StateToIdCallback const& stateToIdCallback);
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -137,6 +189,42 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The choices of the state that is currently expanded. The vector and the distribution below are reused across calls to expand.
+    std::vector<Choice<ValueType>> allChoices;
+
+    // The distribution of the synchronized command combination that is currently expanded.
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
+
+    // For the synchronized command combination that is currently expanded, entry i holds the states (with their probabilities) that result from
+    // applying one update of each of the first i commands.
+    std::vector<std::vector<std::pair<CompressedState, ValueType>>> partialSynchronizedDistributions;
+
+    // The likelihoods of the updates of the command that is currently applied to the partial distributions.
+    std::vector<ValueType> updateLikelihoods;
+
+    // For each action index, the indices of the modules that have at least one command labeled with the action. Modules that do not
+    // participate in an action are thus never considered when the action is expanded.
+    std::vector<std::vector<uint64_t>> synchronizingModulesByActionIndex;
+
+    // The enabled unlabeled commands and the enabled synchronizing commands (per action and module) of the state in which a successor is
+    // sampled. The vectors are reused across calls to sampleSuccessor.
+    std::vector<storm::prism::Command const*> enabledAsynchronousCommands;
+    std::vector<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>> enabledSynchronizingCommands;
+
+    // The compiled guards (indexed by the global command index) and assignments (indexed by the global update index). An entry is none if
+    // the corresponding expression could not be compiled or if the compilation of expressions is disabled.
+    std::vector<boost::optional<CompiledStateExpression>> compiledGuards;
+    std::vector<std::vector<boost::optional<CompiledStateExpression>>> compiledAssignments;
+
+    // For each module, an index that restricts the commands whose guards need to be evaluated in a given state.
+    std::vector<CommandGuardIndex> commandGuardIndices;
+
+    // If set, states are replaced by the representative of their orbit under the symmetries of the program before they are looked up.
+    boost::optional<ModuleSymmetryReduction> symmetryReduction;
+
+    // A buffer for the representative of the state that is currently looked up.
+    CompressedState canonicalState;
 };
 
 }  // namespace generator
@@ -70,6 +70,13 @@ std::size_t StateBehavior<ValueType, StateType>::getNumberOfChoices() const {
     return choices.size();
 }
 
+template<typename ValueType, typename StateType>
+void StateBehavior<ValueType, StateType>::clear() {
+    choices.clear();
+    stateRewards.clear();
+    expanded = false;
+}
+
 template class StateBehavior<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -76,6 +76,11 @@ class StateBehavior {
      */
     std::size_t getNumberOfChoices() const;
 
+    /*!
+     * Resets the behavior to an unexpanded behavior without choices and state rewards. The memory of the underlying vectors is kept.
+     */
+    void clear();
+
    private:
     // The choices available in the state.
     std::vector<Choice<ValueType, StateType>> choices;
@@ -68,6 +68,15 @@ struct TransientVariableValuation {
         return booleanValues.empty() && integerValues.empty() && rationalValues.empty();
     }
 
+    /*!
+     * Appends the values of the given valuation. If both valuations assign a variable, the given one takes precedence when set in an evaluator.
+     */
+    void append(TransientVariableValuation const& other) {
+        booleanValues.insert(booleanValues.end(), other.booleanValues.begin(), other.booleanValues.end());
+        integerValues.insert(integerValues.end(), other.integerValues.begin(), other.integerValues.end());
+        rationalValues.insert(rationalValues.end(), other.rationalValues.begin(), other.rationalValues.end());
+    }
+
     void setInEvaluator(storm::expressions::ExpressionEvaluator<ValueType>& evaluator, bool explorationChecks) const {
         for (auto const& varValue : booleanValues) {
             evaluator.setBooleanValue(varValue.first->variable, varValue.second);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binarydd {
+
+/*
+ * Layout of the binary format for symbolic models.
+ *
+ * All numbers are 64-bit integers in the byte order of the machine that wrote the file (see ByteOrderMark), strings are stored as their
+ * length followed by their characters. A file consists of
+ * - the header: Magic, Version, ByteOrderMark, the model type (storm::models::ModelType), the DD library (storm::dd::DdType) and the
+ *   value type (see ValueTypeTag),
+ * - the meta variables of the DD manager, grouped by their layers ("x", "x'", ...) and in the order in which they were created: the number
+ *   of groups and for each group its name, its type (storm::dd::MetaVariableType), its lower and upper bound (only meaningful for
+ *   integer variables), the number of layers, the number of DD variables and the indices of the DD variables of each layer,
+ * - the names of the row variables, the column variables, the row/column variable pairs and the nondeterminism variables,
+ * - the reachable states, the initial states, the deadlock states and the transition matrix,
+ * - the number of labels and for each label its name and the states,
+ * - the number of reward models and for each reward model its name, the components it contains (see the reward flags below) and the
+ *   corresponding DDs.
+ *
+ * Every DD is stored as the names of its meta variables followed by its node table (see storm/storage/dd/BinaryEncoding.h). BDDs are
+ * stored as 0/1-ADDs. As the node tables refer to the indices of the DD variables, they can be loaded into a manager in which the meta
+ * variables are created with different indices.
+ */
+
+/// The magic number that identifies the file format.
+uint64_t constexpr Magic = 0x4444424d524f5453ull;  // "STORMBDD" in little endian.
+
+/// The version of the format. The parser rejects files with a different version.
+uint64_t constexpr Version = 1;
+
+/// Detects files that were written on a machine with a different byte order.
+uint64_t constexpr ByteOrderMark = 0x0102030405060708ull;
+
+enum class ValueTypeTag : uint64_t { Double = 0, RationalNumber = 1 };
+
+/// The flags that indicate which components of a reward model are stored.
+uint64_t constexpr StateRewardsFlag = 1;
+uint64_t constexpr StateActionRewardsFlag = 2;
+uint64_t constexpr TransitionRewardsFlag = 4;
+
+}  // namespace binarydd
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,129 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace exporter {
+namespace {
+
+using namespace storm::exporter::binary;
+
+static_assert(std::is_trivially_copyable<storm::storage::MatrixEntry<storm::storage::sparse::state_type, double>>::value &&
+                  sizeof(storm::storage::MatrixEntry<storm::storage::sparse::state_type, double>) == 16,
+              "The binary model format requires matrix entries to consist of a 64-bit column and a double value.");
+
+void writeRaw(std::ostream& os, void const* data, uint64_t size) {
+    os.write(reinterpret_cast<char const*>(data), size);
+}
+
+void writePadding(std::ostream& os, uint64_t size) {
+    char const zeros[8] = {};
+    os.write(zeros, getPadding(size));
+}
+
+void writeSection(std::ostream& os, SectionType type, std::string const& name, void const* data, uint64_t dataSize) {
+    SectionHeader header{type, 0, name.size(), dataSize};
+    writeRaw(os, &header, sizeof(header));
+    writeRaw(os, name.data(), name.size());
+    writePadding(os, name.size());
+    writeRaw(os, data, dataSize);
+    writePadding(os, dataSize);
+}
+
+template<typename T>
+void writeSection(std::ostream& os, SectionType type, std::string const& name, std::vector<T> const& data) {
+    writeSection(os, type, name, data.data(), data.size() * sizeof(T));
+}
+
+void writeSection(std::ostream& os, SectionType type, std::string const& name, storm::storage::BitVector const& bitVector) {
+    std::vector<uint64_t> buckets;
+    buckets.reserve((bitVector.size() + 63) / 64);
+    for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+        buckets.push_back(bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex)));
+    }
+    writeSection(os, type, name, buckets);
+}
+
+}  // namespace
+
+void exportSparseModelAsBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+    using namespace storm::exporter::binary;
+    using storm::models::ModelType;
+
+    ModelType const modelType = sparseModel->getType();
+    STORM_LOG_THROW(modelType == ModelType::Dtmc || modelType == ModelType::Ctmc || modelType == ModelType::Mdp || modelType == ModelType::Pomdp ||
+                        modelType == ModelType::MarkovAutomaton,
+                    storm::exceptions::NotSupportedException, "Exporting models of type " << modelType << " in the binary format is not supported.");
+
+    auto const& matrix = sparseModel->getTransitionMatrix();
+    FileHeader header{Magic,
+                      Version,
+                      ByteOrderMark,
+                      static_cast<uint32_t>(modelType),
+                      sizeof(double),
+                      sparseModel->getNumberOfStates(),
+                      matrix.getRowCount(),
+                      matrix.getEntryCount(),
+                      modelType == ModelType::Ctmc ? RateTransitionsFlag : 0};
+    writeRaw(os, &header, sizeof(header));
+
+    // The transition matrix. Note that for CTMCs, this is the rate matrix.
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    for (uint64_t row = 0; row <= matrix.getRowCount(); ++row) {
+        rowIndications.push_back(matrix.begin(row) - matrix.begin());
+    }
+    writeSection(os, SectionType::RowIndications, "", rowIndications);
+    if (!matrix.hasTrivialRowGrouping()) {
+        writeSection(os, SectionType::RowGroupIndices, "", matrix.getRowGroupIndices());
+    }
+    writeSection(os, SectionType::Entries, "", matrix.getEntryCount() > 0 ? &*matrix.begin() : nullptr,
+                         matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<storm::storage::sparse::state_type, double>));
+
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        writeSection(os, SectionType::StateLabel, label, sparseModel->getStateLabeling().getStates(label));
+    }
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            writeSection(os, SectionType::ChoiceLabel, label, sparseModel->getChoiceLabeling().getChoices(label));
+        }
+    }
+
+    for (auto const& rewardModel : sparseModel->getRewardModels()) {
+        STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                        "Transition rewards (reward model '" << rewardModel.first << "') can not be exported in the binary format.");
+        if (rewardModel.second.hasStateRewards()) {
+            writeSection(os, SectionType::StateRewards, rewardModel.first, rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            writeSection(os, SectionType::StateActionRewards, rewardModel.first, rewardModel.second.getStateActionRewardVector());
+        }
+    }
+
+    if (modelType == ModelType::Ctmc) {
+        writeSection(os, SectionType::ExitRates, "", sparseModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    } else if (modelType == ModelType::MarkovAutomaton) {
+        auto ma = sparseModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        writeSection(os, SectionType::ExitRates, "", ma->getExitRates());
+        writeSection(os, SectionType::MarkovianStates, "", ma->getMarkovianStates());
+    } else if (modelType == ModelType::Pomdp) {
+        writeSection(os, SectionType::Observations, "", sparseModel->as<storm::models::sparse::Pomdp<double>>()->getObservations());
+    }
+
+    writeSection(os, SectionType::End, "", nullptr, 0);
+}
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary model format (see BinaryModelFormat.h), which stores the transition matrix, the labelings,
+ * the reward models and the model-type specific components as raw arrays such that the model can be loaded without parsing.
+ * Transition rewards, state valuations and choice origins are not exported.
+ *
+ * @param os The stream to export to. Should be opened in binary mode.
+ * @param sparseModel The model to export.
+ */
+void exportSparseModelAsBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
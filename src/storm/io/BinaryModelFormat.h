@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binary {
+
+/*
+ * Layout of the binary model format.
+ *
+ * A file consists of a FileHeader followed by a sequence of sections. Each section starts with a SectionHeader, followed by the name of the
+ * section (e.g. the label or the reward model name) and the data of the section. Both the name and the data are padded with zeros to a
+ * multiple of 8 bytes, so that all arrays in a (memory-mapped) file are suitably aligned and can be accessed without any parsing.
+ * The last section has type End. All numbers are stored in the byte order of the machine that wrote the file (see ByteOrderMark).
+ *
+ * Sections:
+ * - RowIndications: numberOfChoices + 1 uint64 values, the index of the first entry of each row (i.e., choice).
+ * - RowGroupIndices: numberOfStates + 1 uint64 values (only for nondeterministic models).
+ * - Entries: numberOfEntries (column, value) pairs with a uint64 column and a double value (the layout of storm::storage::MatrixEntry).
+ * - StateLabel / ChoiceLabel / MarkovianStates: a bit vector over the states (choices), stored as 64-bit integers
+ *   as obtained by BitVector::getAsInt(64 * i, 64).
+ * - StateRewards / StateActionRewards / ExitRates: double values.
+ * - Observations: uint32 values (one per state).
+ */
+
+/// The magic number that identifies the file format.
+uint64_t constexpr Magic = 0x4e49424d524f5453ull;  // "STORMBIN" in little endian.
+
+/// The version of the format. The parser rejects files with a different version.
+uint32_t constexpr Version = 1;
+
+/// Detects files that were written on a machine with a different byte order.
+uint32_t constexpr ByteOrderMark = 0x01020304;
+
+enum class SectionType : uint32_t {
+    End = 0,
+    RowIndications = 1,
+    RowGroupIndices = 2,
+    Entries = 3,
+    StateLabel = 4,
+    ChoiceLabel = 5,
+    StateRewards = 6,
+    StateActionRewards = 7,
+    ExitRates = 8,
+    MarkovianStates = 9,
+    Observations = 10
+};
+
+/// Flags stored in the file header.
+uint64_t constexpr RateTransitionsFlag = 1;
+
+struct FileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t byteOrderMark;
+    /// The model type as given by storm::models::ModelType.
+    uint32_t modelType;
+    /// The size of a single value (in bytes). Currently, only doubles are supported.
+    uint32_t valueSize;
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t numberOfEntries;
+    uint64_t flags;
+};
+
+struct SectionHeader {
+    SectionType type;
+    uint32_t reserved;
+    /// The size of the name (in bytes, without padding).
+    uint64_t nameSize;
+    /// The size of the data (in bytes, without padding).
+    uint64_t dataSize;
+};
+
+static_assert(sizeof(FileHeader) == 56, "Unexpected size of the file header.");
+static_assert(sizeof(SectionHeader) == 24, "Unexpected size of the section header.");
+
+/*!
+ * Retrieves the number of bytes that need to be appended to a block of the given size so that the next block starts at a multiple of 8 bytes.
+ */
+inline uint64_t getPadding(uint64_t size) {
+    return (8 - size % 8) % 8;
+}
+
+}  // namespace binary
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,340 @@
+#include "storm/io/CheckResultExporter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <future>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+
+/// The magic number that identifies the binary check result format.
+uint64_t constexpr ResultMagic = 0x5345524d524f5453ull;  // "STORMRES" in little endian.
+
+/// The version of the binary check result format.
+uint32_t constexpr ResultVersion = 1;
+
+/// The number of entries that are formatted at once by a single thread.
+uint64_t constexpr EntriesPerChunk = 1ull << 16;
+
+/*!
+ * Formats the entries [0, numberOfEntries) in chunks and writes them to the stream in order. The chunks of a batch are formatted in
+ * parallel and written asynchronously while the next batch is formatted, so at most two batches are kept in memory.
+ *
+ * @param formatEntries A callable with signature void(std::string& buffer, uint64_t begin, uint64_t end) that appends the entries
+ * [begin, end) to the buffer.
+ */
+template<typename FormatEntries>
+void writeEntries(std::ostream& os, uint64_t numberOfEntries, uint64_t numberOfThreads, FormatEntries const& formatEntries) {
+    numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+    uint64_t const entriesPerBatch = EntriesPerChunk * 4 * numberOfThreads;
+    std::vector<std::string> batches[2];
+    std::future<void> pendingWrite;
+    uint64_t batchIndex = 0;
+    for (uint64_t batchBegin = 0; batchBegin < numberOfEntries; batchBegin += entriesPerBatch, ++batchIndex) {
+        uint64_t batchSize = std::min(entriesPerBatch, numberOfEntries - batchBegin);
+        // The other batch may still be written, but this one is done.
+        std::vector<std::string>& chunks = batches[batchIndex % 2];
+        chunks.resize((batchSize + EntriesPerChunk - 1) / EntriesPerChunk);
+        storm::utility::parallel::forEachChunk(numberOfThreads, batchSize, EntriesPerChunk, [&](uint64_t, uint64_t begin, uint64_t end) {
+            std::string& chunk = chunks[begin / EntriesPerChunk];
+            chunk.clear();
+            formatEntries(chunk, batchBegin + begin, batchBegin + end);
+        });
+
+        if (pendingWrite.valid()) {
+            pendingWrite.get();
+        }
+        pendingWrite = std::async(std::launch::async, [&os, &chunks]() {
+            for (auto const& chunk : chunks) {
+                os.write(chunk.data(), chunk.size());
+            }
+        });
+    }
+    if (pendingWrite.valid()) {
+        pendingWrite.get();
+    }
+}
+
+void appendInteger(std::string& buffer, uint64_t value) {
+    char characters[24];
+    auto result = std::to_chars(characters, characters + sizeof(characters), value);
+    buffer.append(characters, result.ptr);
+}
+
+/*!
+ * Appends the shortest representation of the value that is parsed to the same double.
+ */
+void appendDouble(std::string& buffer, double value) {
+    char characters[32];
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    auto result = std::to_chars(characters, characters + sizeof(characters), value);
+    buffer.append(characters, result.ptr);
+#else
+    int length = std::snprintf(characters, sizeof(characters), "%.17g", value);
+    buffer.append(characters, length);
+#endif
+}
+
+template<typename ValueType>
+void appendBinary(std::string& buffer, ValueType const& value) {
+    buffer.append(reinterpret_cast<char const*>(&value), sizeof(ValueType));
+}
+
+/*!
+ * Appends the value as it is exported by our JSON adapter, i.e., non-finite values are strings and rationals are rounded to doubles.
+ */
+void appendJsonValue(std::string& buffer, double value) {
+    if (std::isnan(value)) {
+        buffer += "\"nan\"";
+    } else if (std::isinf(value)) {
+        buffer += value > 0 ? "\"inf\"" : "\"-inf\"";
+    } else {
+        appendDouble(buffer, value);
+    }
+}
+
+void appendJsonValue(std::string& buffer, storm::RationalNumber const& value) {
+    appendJsonValue(buffer, storm::utility::convertNumber<double>(value));
+}
+
+void appendJsonValue(std::string& buffer, bool value) {
+    buffer += value ? "true" : "false";
+}
+
+void appendCsvValue(std::string& buffer, double value) {
+    appendDouble(buffer, value);
+}
+
+void appendCsvValue(std::string& buffer, storm::RationalNumber const& value) {
+    // Rationals are exported exactly.
+    buffer += storm::utility::to_string(value);
+}
+
+void appendCsvValue(std::string& buffer, bool value) {
+    buffer += value ? "true" : "false";
+}
+
+void appendCsvString(std::string& buffer, std::string const& value) {
+    buffer += '"';
+    for (char character : value) {
+        if (character == '"') {
+            buffer += '"';
+        }
+        buffer += character;
+    }
+    buffer += '"';
+}
+
+void appendBinaryValue(std::string& buffer, double value) {
+    appendBinary(buffer, value);
+}
+
+void appendBinaryValue(std::string& buffer, storm::RationalNumber const& value) {
+    appendBinary(buffer, storm::utility::convertNumber<double>(value));
+}
+
+void appendBinaryValue(std::string& buffer, bool value) {
+    buffer += value ? '\1' : '\0';
+}
+
+/*!
+ * Exports the given entries, where entry i is the value getValue(i) of the state (*states)[i] (or of state i if no states are given).
+ *
+ * @tparam JsonValueType The value type of the JSON representation of the state valuations.
+ */
+template<typename JsonValueType, typename GetValue>
+void exportEntries(std::ostream& os, uint64_t numberOfEntries, std::vector<uint64_t> const* states, GetValue const& getValue, bool booleanValues,
+                   CheckResultExportFormat format, storm::storage::sparse::StateValuations const* stateValuations,
+                   storm::models::sparse::StateLabeling const* stateLabeling, uint64_t numberOfThreads) {
+    auto getState = [states](uint64_t entry) { return states ? (*states)[entry] : entry; };
+
+    if (format == CheckResultExportFormat::Binary) {
+        uint32_t header32[] = {ResultVersion, storm::exporter::binary::ByteOrderMark};
+        uint64_t header64[] = {booleanValues ? 1ull : 0ull, states ? 0ull : 1ull, numberOfEntries};
+        os.write(reinterpret_cast<char const*>(&ResultMagic), sizeof(ResultMagic));
+        os.write(reinterpret_cast<char const*>(header32), sizeof(header32));
+        os.write(reinterpret_cast<char const*>(header64), sizeof(header64));
+        if (states) {
+            os.write(reinterpret_cast<char const*>(states->data()), states->size() * sizeof(uint64_t));
+        }
+        writeEntries(os, numberOfEntries, numberOfThreads, [&](std::string& buffer, uint64_t begin, uint64_t end) {
+            for (uint64_t entry = begin; entry < end; ++entry) {
+                appendBinaryValue(buffer, getValue(entry));
+            }
+        });
+        if (booleanValues && numberOfEntries % 8 != 0) {
+            os.write("\0\0\0\0\0\0\0", 8 - numberOfEntries % 8);
+        }
+        return;
+    }
+
+    // The labels (with their names already in the output format) in lexicographic order.
+    std::vector<std::pair<std::string, storm::storage::BitVector const*>> labels;
+    if (stateLabeling) {
+        for (auto const& label : stateLabeling->getLabels()) {
+            std::string name;
+            if (format == CheckResultExportFormat::Csv) {
+                name = label;
+            } else {
+                name = storm::json<double>(label).dump();
+            }
+            labels.emplace_back(std::move(name), &stateLabeling->getStates(label));
+        }
+    }
+
+    if (format == CheckResultExportFormat::Csv) {
+        os << "state,value" << (stateValuations ? ",valuation" : "") << (stateLabeling ? ",labels" : "") << '\n';
+        writeEntries(os, numberOfEntries, numberOfThreads, [&](std::string& buffer, uint64_t begin, uint64_t end) {
+            for (uint64_t entry = begin; entry < end; ++entry) {
+                uint64_t state = getState(entry);
+                appendInteger(buffer, state);
+                buffer += ',';
+                appendCsvValue(buffer, getValue(entry));
+                if (stateValuations) {
+                    buffer += ',';
+                    appendCsvString(buffer, stateValuations->toString(state, false));
+                }
+                if (stateLabeling) {
+                    std::string stateLabels;
+                    for (auto const& label : labels) {
+                        if (label.second->get(state)) {
+                            if (!stateLabels.empty()) {
+                                stateLabels += ' ';
+                            }
+                            stateLabels += label.first;
+                        }
+                    }
+                    buffer += ',';
+                    appendCsvString(buffer, stateLabels);
+                }
+                buffer += '\n';
+            }
+        });
+        return;
+    }
+
+    bool jsonLines = format == CheckResultExportFormat::JsonLines;
+    if (!jsonLines) {
+        os << "[";
+    }
+    writeEntries(os, numberOfEntries, numberOfThreads, [&](std::string& buffer, uint64_t begin, uint64_t end) {
+        for (uint64_t entry = begin; entry < end; ++entry) {
+            if (!jsonLines) {
+                buffer += entry == 0 ? "\n" : ",\n";
+            }
+            uint64_t state = getState(entry);
+            buffer += "{\"s\":";
+            if (stateValuations) {
+                buffer += stateValuations->template toJson<JsonValueType>(state).dump();
+            } else {
+                appendInteger(buffer, state);
+            }
+            buffer += ",\"v\":";
+            appendJsonValue(buffer, getValue(entry));
+            if (stateLabeling) {
+                buffer += ",\"l\":[";
+                bool first = true;
+                for (auto const& label : labels) {
+                    if (label.second->get(state)) {
+                        if (!first) {
+                            buffer += ',';
+                        }
+                        first = false;
+                        buffer += label.first;
+                    }
+                }
+                buffer += ']';
+            }
+            buffer += '}';
+            if (jsonLines) {
+                buffer += '\n';
+            }
+        }
+    });
+    if (!jsonLines) {
+        os << "\n]\n";
+    }
+}
+
+}  // namespace
+
+CheckResultExportFormat getCheckResultExportFormatFromFileExtension(std::string const& filename) {
+    auto hasExtension = [&filename](std::string const& extension) {
+        return filename.size() > extension.size() && std::equal(extension.rbegin(), extension.rend(), filename.rbegin());
+    };
+    if (hasExtension(".jsonl")) {
+        return CheckResultExportFormat::JsonLines;
+    } else if (hasExtension(".csv")) {
+        return CheckResultExportFormat::Csv;
+    } else if (hasExtension(".bin")) {
+        return CheckResultExportFormat::Binary;
+    }
+    return CheckResultExportFormat::Json;
+}
+
+template<typename ValueType>
+void exportCheckResult(std::ostream& os, storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult, CheckResultExportFormat format,
+                       storm::storage::sparse::StateValuations const* stateValuations, storm::models::sparse::StateLabeling const* stateLabeling,
+                       uint64_t numberOfThreads) {
+    if (checkResult.isResultForAllStates()) {
+        auto const& values = checkResult.getValueVector();
+        auto getValue = [&values](uint64_t entry) -> ValueType const& { return values[entry]; };
+        exportEntries<ValueType>(os, values.size(), nullptr, getValue, false, format, stateValuations, stateLabeling, numberOfThreads);
+    } else {
+        std::vector<uint64_t> states;
+        std::vector<ValueType const*> values;
+        for (auto const& stateValue : checkResult.getValueMap()) {
+            states.push_back(stateValue.first);
+            values.push_back(&stateValue.second);
+        }
+        auto getValue = [&values](uint64_t entry) -> ValueType const& { return *values[entry]; };
+        exportEntries<ValueType>(os, states.size(), &states, getValue, false, format, stateValuations, stateLabeling, numberOfThreads);
+    }
+}
+
+void exportCheckResult(std::ostream& os, storm::modelchecker::ExplicitQualitativeCheckResult const& checkResult, CheckResultExportFormat format,
+                       storm::storage::sparse::StateValuations const* stateValuations, storm::models::sparse::StateLabeling const* stateLabeling,
+                       uint64_t numberOfThreads) {
+    if (checkResult.isResultForAllStates()) {
+        auto const& values = checkResult.getTruthValuesVector();
+        auto getValue = [&values](uint64_t entry) { return values.get(entry); };
+        exportEntries<storm::RationalNumber>(os, values.size(), nullptr, getValue, true, format, stateValuations, stateLabeling, numberOfThreads);
+    } else {
+        std::vector<uint64_t> states;
+        std::vector<bool> values;
+        for (auto const& stateValue : checkResult.getTruthValuesMap()) {
+            states.push_back(stateValue.first);
+            values.push_back(stateValue.second);
+        }
+        auto getValue = [&values](uint64_t entry) { return static_cast<bool>(values[entry]); };
+        exportEntries<storm::RationalNumber>(os, states.size(), &states, getValue, true, format, stateValuations, stateLabeling, numberOfThreads);
+    }
+}
+
+template void exportCheckResult<double>(std::ostream& os, storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& checkResult,
+                                        CheckResultExportFormat format, storm::storage::sparse::StateValuations const* stateValuations,
+                                        storm::models::sparse::StateLabeling const* stateLabeling, uint64_t numberOfThreads);
+#ifdef STORM_HAVE_CARL
+template void exportCheckResult<storm::RationalNumber>(std::ostream& os,
+                                                       storm::modelchecker::ExplicitQuantitativeCheckResult<storm::RationalNumber> const& checkResult,
+                                                       CheckResultExportFormat format, storm::storage::sparse::StateValuations const* stateValuations,
+                                                       storm::models::sparse::StateLabeling const* stateLabeling, uint64_t numberOfThreads);
+#endif
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace storm {
+namespace models {
+namespace sparse {
+class StateLabeling;
+}
+}  // namespace models
+namespace storage {
+namespace sparse {
+class StateValuations;
+}
+}  // namespace storage
+namespace modelchecker {
+template<typename ValueType>
+class ExplicitQuantitativeCheckResult;
+class ExplicitQualitativeCheckResult;
+}  // namespace modelchecker
+
+namespace exporter {
+
+/*!
+ * The formats in which check results can be exported.
+ * - Json: an array with one object {"s": state, "v": value, "l": labels} per state (as given by the toJson methods of the check results).
+ * - JsonLines: the same objects, one per line.
+ * - Csv: a header line followed by one line per state with the columns state, value and (if given) valuation and labels.
+ * - Binary: the raw values (see below), state valuations and labels are not exported.
+ *
+ * Layout of the binary format: The magic number "STORMRES" (uint64), the version (uint32) and the byte order mark (uint32, as in the
+ * binary model format) are followed by the type of the values (0 for doubles, 1 for Booleans), a flag that is one iff the result is
+ * given for all states and the number of entries n (all as uint64). If the result is not given for all states, n uint64 state indices
+ * follow. Finally, there are n values (as double or as one byte per value, padded with zeros to a multiple of 8 bytes).
+ */
+enum class CheckResultExportFormat { Json, JsonLines, Csv, Binary };
+
+/*!
+ * @return The format that corresponds to the extension of the given file ('.jsonl', '.csv' or '.bin'). For all other files, Json is used.
+ */
+CheckResultExportFormat getCheckResultExportFormatFromFileExtension(std::string const& filename);
+
+/*!
+ * Exports the given check result without assembling the complete document in memory. The entries are formatted in chunks by the given
+ * number of threads, and a chunk is written while the next ones are formatted.
+ *
+ * @param os The stream to export to. For the binary format, it should be opened in binary mode.
+ * @param checkResult The check result to export.
+ * @param format The format of the export.
+ * @param stateValuations If not null, the valuation of each state is exported.
+ * @param stateLabeling If not null, the labels of each state are exported.
+ * @param numberOfThreads The number of threads that format the entries.
+ */
+template<typename ValueType>
+void exportCheckResult(std::ostream& os, storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult, CheckResultExportFormat format,
+                       storm::storage::sparse::StateValuations const* stateValuations = nullptr,
+                       storm::models::sparse::StateLabeling const* stateLabeling = nullptr, uint64_t numberOfThreads = 1);
+
+/*!
+ * Exports the given check result without assembling the complete document in memory (see above).
+ */
+void exportCheckResult(std::ostream& os, storm::modelchecker::ExplicitQualitativeCheckResult const& checkResult, CheckResultExportFormat format,
+                       storm::storage::sparse::StateValuations const* stateValuations = nullptr,
+                       storm::models::sparse::StateLabeling const* stateLabeling = nullptr, uint64_t numberOfThreads = 1);
+
+}  // namespace exporter
+}  // namespace storm
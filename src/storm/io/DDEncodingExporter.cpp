@@ -1,6 +1,20 @@
 #include "storm/io/DDEncodingExporter.h"
+
+#include <algorithm>
+#include <map>
+#include <type_traits>
+
+#include "storm/io/BinaryDdModelFormat.h"
 #include "storm/io/file.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/BinaryEncoding.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
 namespace exporter {
@@ -25,6 +39,136 @@ void explicitExportSymbolicModel(std::string const& filename, std::shared_ptr<st
     }
 }
 
+namespace {
+
+using storm::dd::binary::writeString;
+using storm::dd::binary::writeUint64;
+
+void writeVariables(std::ostream& out, std::set<storm::expressions::Variable> const& variables) {
+    writeUint64(out, variables.size());
+    for (auto const& variable : variables) {
+        writeString(out, variable.getName());
+    }
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void writeAdd(std::ostream& out, storm::dd::Add<Type, ValueType> const& add) {
+    writeVariables(out, add.getContainedMetaVariables());
+    add.exportToBinary(out);
+}
+
+template<storm::dd::DdType Type>
+void writeMetaVariables(std::ostream& out, storm::dd::DdManager<Type> const& manager) {
+    // Group the meta variables by their layers. As names of meta variables cannot end with a prime, the layer is given by the number of primes.
+    std::map<std::string, std::vector<storm::dd::DdMetaVariable<Type> const*>> nameToLayers;
+    for (auto const& name : manager.getAllMetaVariableNames()) {
+        std::string baseName = name.substr(0, name.find('\''));
+        auto& layers = nameToLayers[baseName];
+        layers.resize(std::max<uint64_t>(layers.size(), name.size() - baseName.size() + 1), nullptr);
+        layers[name.size() - baseName.size()] = &manager.getMetaVariable(manager.getMetaVariable(name));
+    }
+
+    // Write the groups in the order in which they were created such that the parser can recreate the DD variables in the same order.
+    std::vector<std::pair<std::string, std::vector<storm::dd::DdMetaVariable<Type> const*>>> groups(nameToLayers.begin(), nameToLayers.end());
+    for (auto const& group : groups) {
+        STORM_LOG_THROW(std::find(group.second.begin(), group.second.end(), nullptr) == group.second.end(), storm::exceptions::NotSupportedException,
+                        "Cannot export meta variable '" << group.first << "' whose layers are incomplete.");
+    }
+    std::sort(groups.begin(), groups.end(),
+              [](auto const& first, auto const& second) { return first.second.front()->getLowestIndex() < second.second.front()->getLowestIndex(); });
+
+    writeUint64(out, groups.size());
+    for (auto const& group : groups) {
+        storm::dd::DdMetaVariable<Type> const& metaVariable = *group.second.front();
+        bool const isInteger = metaVariable.getType() == storm::dd::MetaVariableType::Int;
+        writeString(out, group.first);
+        writeUint64(out, static_cast<uint64_t>(metaVariable.getType()));
+        writeUint64(out, isInteger ? static_cast<uint64_t>(metaVariable.getLow()) : 0);
+        writeUint64(out, isInteger ? static_cast<uint64_t>(metaVariable.getHigh()) : 0);
+        writeUint64(out, group.second.size());
+        writeUint64(out, metaVariable.getNumberOfDdVariables());
+        for (auto const& layer : group.second) {
+            for (auto const& ddVariable : layer->getDdVariables()) {
+                writeUint64(out, ddVariable.getIndex());
+            }
+        }
+    }
+}
+
+}  // namespace
+
+template<storm::dd::DdType Type, typename ValueType>
+void exportSymbolicModelAsBinary(std::ostream& out, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& symbolicModel) {
+    using namespace storm::exporter::binarydd;
+    using storm::models::ModelType;
+
+    ModelType const modelType = symbolicModel->getType();
+    STORM_LOG_THROW(modelType == ModelType::Dtmc || modelType == ModelType::Ctmc || modelType == ModelType::Mdp, storm::exceptions::NotSupportedException,
+                    "Exporting models of type " << modelType << " in the binary DD format is not supported.");
+    ValueTypeTag valueType = ValueTypeTag::Double;
+    if constexpr (std::is_same<ValueType, storm::RationalNumber>::value) {
+        valueType = ValueTypeTag::RationalNumber;
+    } else if constexpr (!std::is_same<ValueType, double>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting parametric models in the binary DD format is not supported.");
+    }
+
+    writeUint64(out, Magic);
+    writeUint64(out, Version);
+    writeUint64(out, ByteOrderMark);
+    writeUint64(out, static_cast<uint64_t>(modelType));
+    writeUint64(out, static_cast<uint64_t>(Type));
+    writeUint64(out, static_cast<uint64_t>(valueType));
+
+    writeMetaVariables(out, symbolicModel->getManager());
+    writeVariables(out, symbolicModel->getRowVariables());
+    writeVariables(out, symbolicModel->getColumnVariables());
+    writeUint64(out, symbolicModel->getRowColumnMetaVariablePairs().size());
+    for (auto const& rowColumnPair : symbolicModel->getRowColumnMetaVariablePairs()) {
+        writeString(out, rowColumnPair.first.getName());
+        writeString(out, rowColumnPair.second.getName());
+    }
+    writeVariables(out, symbolicModel->getNondeterminismVariables());
+
+    writeAdd(out, symbolicModel->getReachableStates().template toAdd<ValueType>());
+    writeAdd(out, symbolicModel->getInitialStates().template toAdd<ValueType>());
+    writeAdd(out, symbolicModel->getDeadlockStates().template toAdd<ValueType>());
+    writeAdd(out, symbolicModel->getTransitionMatrix());
+
+    // The labels are given either as expressions or as BDDs. The initial and deadlock states are stored separately.
+    std::set<std::string> labels;
+    for (auto const& labelExpressionPair : symbolicModel->getLabelToExpressionMap()) {
+        labels.insert(labelExpressionPair.first);
+    }
+    for (auto const& labelBddPair : symbolicModel->getLabelToBddMap()) {
+        labels.insert(labelBddPair.first);
+    }
+    labels.erase("init");
+    labels.erase("deadlock");
+    writeUint64(out, labels.size());
+    for (auto const& label : labels) {
+        writeString(out, label);
+        writeAdd(out, symbolicModel->getStates(label).template toAdd<ValueType>());
+    }
+
+    writeUint64(out, symbolicModel->getRewardModels().size());
+    for (auto const& rewardModel : symbolicModel->getRewardModels()) {
+        writeString(out, rewardModel.first);
+        writeUint64(out, (rewardModel.second.hasStateRewards() ? StateRewardsFlag : 0) |
+                             (rewardModel.second.hasStateActionRewards() ? StateActionRewardsFlag : 0) |
+                             (rewardModel.second.hasTransitionRewards() ? TransitionRewardsFlag : 0));
+        if (rewardModel.second.hasStateRewards()) {
+            writeAdd(out, rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            writeAdd(out, rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            writeAdd(out, rewardModel.second.getTransitionRewardMatrix());
+        }
+    }
+    STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Could not write the binary DD model.");
+}
+
 template void explicitExportSymbolicModel<storm::dd::DdType::CUDD, double>(
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> sparseModel);
 template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, double>(
@@ -34,5 +178,15 @@ template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, storm::Rati
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber>> sparseModel);
 template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, storm::RationalFunction>(
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction>> sparseModel);
+
+template void exportSymbolicModelAsBinary<storm::dd::DdType::CUDD, double>(
+    std::ostream&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> const& symbolicModel);
+template void exportSymbolicModelAsBinary<storm::dd::DdType::Sylvan, double>(
+    std::ostream&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> const& symbolicModel);
+
+template void exportSymbolicModelAsBinary<storm::dd::DdType::Sylvan, storm::RationalNumber>(
+    std::ostream&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber>> const& symbolicModel);
+template void exportSymbolicModelAsBinary<storm::dd::DdType::Sylvan, storm::RationalFunction>(
+    std::ostream&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction>> const& symbolicModel);
 }  // namespace exporter
 }  // namespace storm
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <iostream>
+
 #include "storm/models/symbolic/Model.h"
 
 namespace storm {
@@ -14,5 +16,16 @@ namespace exporter {
 template<storm::dd::DdType Type, typename ValueType>
 void explicitExportSymbolicModel(std::string const& filename, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel);
 
+/*!
+ * Exports a symbolic model into the binary DD format (see BinaryDdModelFormat.h). The DDs of the model are stored as node tables together
+ * with the meta variables of its manager, such that the model can be loaded without building it again. Only DTMCs, CTMCs and MDPs with
+ * double or rational values are supported.
+ *
+ * @param out            The stream to export to. Should be opened in binary mode.
+ * @param symbolicModel  Model to export
+ */
+template<storm::dd::DdType Type, typename ValueType>
+void exportSymbolicModelAsBinary(std::ostream& out, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& symbolicModel);
+
 }  // namespace exporter
 }  // namespace storm
\ No newline at end of file
@@ -1,4 +1,8 @@
 #include "storm/io/DirectEncodingExporter.h"
+
+#include <algorithm>
+#include <sstream>
+
 #include <storm/exceptions/NotSupportedException.h>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -10,12 +14,130 @@
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 namespace storm {
 namespace exporter {
 
+namespace {
+// The number of states that are written by one thread at once.
+uint64_t const ChunkSize = 1024;
+
+/*!
+ * Writes the given state, its choices and its transitions in the DRN format.
+ */
+template<typename ValueType>
+void writeState(std::ostream& os, storm::models::sparse::Model<ValueType> const& model, uint64_t group, std::vector<ValueType> const& exitRates,
+                std::unordered_map<ValueType, std::string> const& placeholders) {
+    storm::storage::SparseMatrix<ValueType> const& matrix = model.getTransitionMatrix();
+    os << "state " << group;
+
+    // Write exit rates for CTMCs and MAs
+    if (!exitRates.empty()) {
+        os << " !";
+        writeValue(os, exitRates.at(group), placeholders);
+    }
+
+    if (model.getType() == storm::models::ModelType::Pomdp) {
+        os << " {" << static_cast<storm::models::sparse::Pomdp<ValueType> const&>(model).getObservation(group) << "}";
+    }
+
+    // Write state rewards
+    bool first = true;
+    for (auto const& rewardModelEntry : model.getRewardModels()) {
+        if (first) {
+            os << " [";
+            first = false;
+        } else {
+            os << ", ";
+        }
+
+        if (rewardModelEntry.second.hasStateRewards()) {
+            writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
+        } else {
+            os << "0";
+        }
+    }
+
+    if (!first) {
+        os << "]";
+    }
+
+    // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+    for (auto const& label : model.getStateLabeling().getLabelsOfState(group)) {
+        STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                        "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+        // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+        if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+            os << " \"" << label << "\"";
+        } else {
+            os << " " << label;
+        }
+    }
+    os << '\n';
+    // Write state valuations as comments
+    if (model.hasStateValuations()) {
+        os << "//" << model.getStateValuations().getStateInfo(group) << '\n';
+    }
+
+    // Write probabilities
+    typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+    typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+    // Iterate over all actions
+    for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
+        // Write choice
+        if (model.hasChoiceLabeling()) {
+            os << "\taction ";
+            bool lfirst = true;
+            if (model.getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                os << "__NOLABEL__";
+            }
+            for (auto const& label : model.getChoiceLabeling().getLabelsOfChoice(row)) {
+                if (!lfirst) {
+                    os << "_";
+                    lfirst = false;
+                }
+                os << label;
+            }
+        } else {
+            os << "\taction " << row - start;
+        }
+
+        // Write action rewards
+        bool first = true;
+        for (auto const& rewardModelEntry : model.getRewardModels()) {
+            if (first) {
+                os << " [";
+                first = false;
+            } else {
+                os << ", ";
+            }
+
+            if (rewardModelEntry.second.hasStateActionRewards()) {
+                writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+            } else {
+                os << "0";
+            }
+        }
+        if (!first) {
+            os << "]";
+        }
+        os << '\n';
+
+        // Write transitions
+        for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
+            ValueType prob = it->getValue();
+            os << "\t\t" << it->getColumn() << " : ";
+            writeValue(os, prob, placeholders);
+            os << '\n';
+        }
+    }
+}
+}  // namespace
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
@@ -69,113 +191,35 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     os << "@model\n";
 
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
+    uint64_t const numberOfStates = matrix.getRowGroupCount();
 
-    // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
-
-        // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
+    // Iterate over states and export state information and outgoing transitions.
+    // The output of rational functions relies on shared caches, which is why they are always written sequentially.
+    if (options.numberOfThreads <= 1 || std::is_same<ValueType, storm::RationalFunction>::value) {
+        for (uint64_t group = 0; group < numberOfStates; ++group) {
+            writeState(os, *sparseModel, group, exitRates, placeholders);
         }
-
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
-        }
-
-        // Write state rewards
-        bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-            if (first) {
-                os << " [";
-                first = false;
-            } else {
-                os << ", ";
-            }
-
-            if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-            } else {
-                os << "0";
-            }
-        }
-
-        if (!first) {
-            os << "]";
-        }
-
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
-            }
-        }
-        os << '\n';
-        // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
-        }
-
-        // Write probabilities
-        typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-        typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-        // Iterate over all actions
-        for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-            // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
-                bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
-                        lfirst = false;
-                    }
-                    os << label;
-                }
-            } else {
-                os << "\taction " << row - start;
-            }
-
-            // Write action rewards
-            bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                if (first) {
-                    os << " [";
-                    first = false;
-                } else {
-                    os << ", ";
-                }
-
-                if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                } else {
-                    os << "0";
+    } else {
+        // The states are written in batches of chunks. Each chunk is formatted into its own buffer (with the format flags of the given stream) and
+        // the buffers of a batch are written to the stream in their original order.
+        uint64_t const batchSize = options.numberOfThreads * ChunkSize * 4;
+        std::vector<std::string> buffers;
+        for (uint64_t batchBegin = 0; batchBegin < numberOfStates; batchBegin += batchSize) {
+            uint64_t const batchEnd = std::min(batchBegin + batchSize, numberOfStates);
+            buffers.assign((batchEnd - batchBegin + ChunkSize - 1) / ChunkSize, std::string());
+            storm::utility::parallel::forEachChunk(options.numberOfThreads, batchEnd - batchBegin, ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+                std::ostringstream buffer;
+                buffer.copyfmt(os);
+                for (uint64_t group = batchBegin + begin; group < batchBegin + end; ++group) {
+                    writeState(buffer, *sparseModel, group, exitRates, placeholders);
                 }
-            }
-            if (!first) {
-                os << "]";
-            }
-            os << '\n';
-
-            // Write transitions
-            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+                buffers[begin / ChunkSize] = buffer.str();
+            });
+            for (auto const& buffer : buffers) {
+                os << buffer;
             }
         }
-    }  // end state iteration
+    }
 }
 
 template<typename ValueType>
@@ -10,6 +10,8 @@ namespace exporter {
 
 struct DirectEncodingOptions {
     bool allowPlaceholders = true;
+    // The number of threads that format the states in parallel (rational functions are always written sequentially).
+    uint64_t numberOfThreads = 1;
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
@@ -1,4 +1,5 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/csl/helper/TransientUniformizationHelper.h"
 
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
@@ -9,7 +10,6 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
-#include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -25,6 +25,7 @@
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -268,6 +269,74 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForUpperBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    for (auto const& upperBound : upperBounds) {
+        STORM_LOG_THROW(upperBound >= 0.0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidArgumentException,
+                        "The upper time bound " << upperBound << " has to be non-negative and finite.");
+    }
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+    std::vector<std::vector<ValueType>> results(upperBounds.size(), initialResult);
+
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+    if (statesWithProbabilityGreater0NonPsi.empty() || upperBounds.empty()) {
+        return results;
+    }
+
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // The uniformized matrix and the compensation vector are the same for all bounds.
+    ValueType uniformizationRate = 0;
+    for (auto state : statesWithProbabilityGreater0NonPsi) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+        computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+    for (auto& element : b) {
+        element /= uniformizationRate;
+    }
+
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& upperBound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+    }
+    TransientUniformizationHelper<ValueType> transientHelper(uniformizedMatrix, &b, uniformizationRate);
+    transientHelper.setNumberOfThreads(env.solver().getNumberOfThreads());
+
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+    bool repeat;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+        std::vector<std::vector<ValueType>> subresults = transientHelper.computeTransientProbabilities(timeBounds, values, epsilon, false);
+        repeat = false;
+        for (uint64_t bound = 0; bound < upperBounds.size(); ++bound) {
+            storm::utility::vector::setVectorValues(results[bound], statesWithProbabilityGreater0NonPsi, subresults[bound]);
+            repeat |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, results[bound], relevantValues);
+        }
+    } while (repeat);
+    return results;
+}
+
 template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                              storm::storage::SparseMatrix<ValueType> const&,
@@ -282,9 +351,10 @@ std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environmen
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                       storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                       std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates,
-                                                                      storm::storage::BitVector const& psiStates, bool qualitative) {
+                                                                      storm::storage::BitVector const& psiStates, bool qualitative,
+                                                                      ModelCheckerHint const& hint) {
     return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector),
-                                                                       backwardTransitions, phiStates, psiStates, qualitative);
+                                                                       backwardTransitions, phiStates, psiStates, qualitative, hint);
 }
 
 template<typename ValueType>
@@ -449,7 +519,8 @@ std::vector<ValueType> SparseCtmcCslHelper::computeReachabilityTimes(Environment
                                                                      storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                      std::vector<ValueType> const& exitRateVector,
-                                                                     storm::storage::BitVector const& targetStates, bool qualitative) {
+                                                                     storm::storage::BitVector const& targetStates, bool qualitative,
+                                                                     ModelCheckerHint const& hint) {
     // Compute expected time on CTMC by reduction to DTMC with rewards.
     storm::storage::SparseMatrix<ValueType> probabilityMatrix = computeProbabilityMatrix(rateMatrix, exitRateVector);
 
@@ -466,7 +537,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeReachabilityTimes(Environment
     }
 
     return storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(
-        env, std::move(goal), probabilityMatrix, backwardTransitions, totalRewardVector, targetStates, qualitative);
+        env, std::move(goal), probabilityMatrix, backwardTransitions, totalRewardVector, targetStates, qualitative, hint);
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -657,85 +728,9 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
                                                                           storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
                                                                           std::vector<ValueType> const* addVector, ValueType timeBound,
                                                                           ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
-    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
-                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
-    ValueType lambda = timeBound * uniformizationRate;
-
-    // If no time can pass, the current values are the result.
-    if (storm::utility::isZero(lambda)) {
-        return values;
-    }
-
-    // Use Fox-Glynn to get the truncation points and the weights.
-    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
-    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
-    // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
-
-    // If the cumulative reward is to be computed, we need to adjust the weights.
-    if (useMixedPoissonProbabilities) {
-        ValueType sum = storm::utility::zero<ValueType>();
-
-        for (auto& element : foxGlynnResult.weights) {
-            sum += element;
-            element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
-        }
-    }
-
-    STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
-
-    // Initialize result.
-    std::vector<ValueType> result;
-    uint_fast64_t startingIteration = foxGlynnResult.left;
-    if (startingIteration == 0) {
-        result = values;
-        storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
-        ++startingIteration;
-    } else {
-        if (useMixedPoissonProbabilities) {
-            result = std::vector<ValueType>(values.size());
-            std::function<ValueType(ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate](ValueType const& a) -> ValueType {
-                return a / uniformizationRate;
-            };
-            storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
-        } else {
-            result = std::vector<ValueType>(values.size());
-        }
-    }
-
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-    if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-        // Perform the matrix-vector multiplications (without adding).
-        multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-    } else if (useMixedPoissonProbabilities) {
-        std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate](ValueType const& a, ValueType const& b) {
-            return a + b / uniformizationRate;
-        };
-
-        // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-        for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-            multiplier->multiply(env, values, nullptr, values);
-            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
-        }
-        // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
-        // between the left and right truncation point, we scale them here with the total sum of the weights.
-        // Note that we divide with this value afterwards. This is to improve numerical stability.
-        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, foxGlynnResult.totalWeight);
-    }
-
-    // For the indices that fall in between the truncation points, we need to perform the matrix-vector
-    // multiplication, scale and add the result.
-    ValueType weight = 0;
-    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
-    for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-        multiplier->multiply(env, values, addVector, values);
-
-        weight = foxGlynnResult.weights[index - foxGlynnResult.left];
-        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
-    }
-
-    // Finally, divide the result by the total weight
-    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-    return result;
+    TransientUniformizationHelper<ValueType> transientHelper(uniformizedMatrix, addVector, uniformizationRate);
+    transientHelper.setNumberOfThreads(env.solver().getNumberOfThreads());
+    return std::move(transientHelper.computeTransientProbabilities({timeBound}, values, epsilon, useMixedPoissonProbabilities).front());
 }
 
 template<typename ValueType>
@@ -773,12 +768,18 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForUpperBounds(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                             std::vector<double> const& exitRateVector,
                                                                             storm::storage::BitVector const& phiStates,
-                                                                            storm::storage::BitVector const& psiStates, bool qualitative);
+                                                                            storm::storage::BitVector const& psiStates, bool qualitative,
+                                                                            ModelCheckerHint const& hint);
 
 template std::vector<double> SparseCtmcCslHelper::computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                                storm::storage::SparseMatrix<double> const& rateMatrix,
@@ -801,7 +802,8 @@ template std::vector<double> SparseCtmcCslHelper::computeReachabilityTimes(Envir
                                                                            storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                            storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                            std::vector<double> const& exitRateVector,
-                                                                           storm::storage::BitVector const& targetStates, bool qualitative);
+                                                                           storm::storage::BitVector const& targetStates, bool qualitative,
+                                                                           ModelCheckerHint const& hint);
 
 template std::vector<double> SparseCtmcCslHelper::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                              storm::storage::SparseMatrix<double> const& rateMatrix,
@@ -848,11 +850,13 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
-    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative,
+    ModelCheckerHint const& hint);
 template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector,
-    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative,
+    ModelCheckerHint const& hint);
 
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeAllUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -883,11 +887,11 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeInstan
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityTimes(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
-    storm::storage::BitVector const& targetStates, bool qualitative);
+    storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
 template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeReachabilityTimes(
     Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector,
-    storm::storage::BitVector const& targetStates, bool qualitative);
+    storm::storage::BitVector const& targetStates, bool qualitative, ModelCheckerHint const& hint);
 
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
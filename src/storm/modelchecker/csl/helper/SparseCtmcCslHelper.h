@@ -3,6 +3,8 @@
 
 #include "storm/storage/BitVector.h"
 
+#include "storm/modelchecker/hints/ModelCheckerHint.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolveGoal.h"
 
@@ -38,12 +40,25 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of the bounded until formulas phi U[0, t] psi for all of the given upper time bounds t at once. All bounds share
+     * the uniformized matrix and a single sweep of transient iterations whose length is determined by the largest bound.
+     *
+     * @return The result vectors in the order of the given upper bounds.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForUpperBounds(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                             std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates,
-                                                            storm::storage::BitVector const& psiStates, bool qualitative);
+                                                            storm::storage::BitVector const& psiStates, bool qualitative,
+                                                            ModelCheckerHint const& hint = ModelCheckerHint());
 
     template<typename ValueType>
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
@@ -95,7 +110,7 @@ class SparseCtmcCslHelper {
                                                            storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                            storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                            std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& targetStates,
-                                                           bool qualitative);
+                                                           bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
 
     template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
     static std::vector<ValueType> computeAllTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
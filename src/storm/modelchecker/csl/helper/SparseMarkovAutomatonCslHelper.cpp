@@ -6,6 +6,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -25,6 +26,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -70,10 +72,18 @@ class UnifPlusHelper {
         // Intentionally left empty
     }
 
-    std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
-                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                            ValueType const& upperTimeBound,
-                                                            boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+    /*!
+     * Computes the probabilities of phi U[0,t] psi for each of the given upper time bounds t. All bounds share the split (and uniformized)
+     * transition matrices, the solver for the probabilistic states and the uniformization rate that was reached for the previous bounds, which
+     * is sound as unif+ only requires a rate that is at least the maximal exit rate. If the environment specifies more than one thread, the
+     * sweeps over the Markovian and probabilistic states are split among the threads.
+     *
+     * @return The result vectors in the order of the given upper bounds.
+     */
+    std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
+                                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                         std::vector<ValueType> const& upperTimeBounds,
+                                                                         boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
         // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
 
         // Compute some important subsets of states
@@ -84,21 +94,24 @@ class UnifPlusHelper {
         storm::storage::BitVector probabilisticStatesModMaybeStates = probabilisticMaybeStates % maybeStates;
         // Catch the case where this query can be solved by solving the untimed variant instead.
         // This is the case if there is no Markovian maybe state (e.g. if the initial state is already a psi state) of if the time bound is infinity.
-        if (markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBound)) {
-            return SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates,
-                                                                                        psiStates, false, false)
-                .values;
+        std::vector<ValueType> untimedResult;
+        auto getUntimedResult = [&]() -> std::vector<ValueType> const& {
+            if (untimedResult.empty()) {
+                untimedResult = SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(
+                                    env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates, psiStates, false, false)
+                                    .values;
+            }
+            return untimedResult;
+        };
+        if (markovianMaybeStates.empty() ||
+            std::all_of(upperTimeBounds.begin(), upperTimeBounds.end(), [](ValueType const& bound) { return storm::utility::isInfinity(bound); })) {
+            return std::vector<std::vector<ValueType>>(upperTimeBounds.size(), getUntimedResult());
         }
 
         boost::optional<storm::storage::BitVector> relevantMaybeStates;
         if (relevantStates) {
             relevantMaybeStates = relevantStates.get() % maybeStates;
         }
-        // Store the best solution known so far (useful in cases where the computation gets aborted)
-        std::vector<ValueType> bestKnownSolution;
-        if (relevantMaybeStates) {
-            bestKnownSolution.resize(relevantStates->size());
-        }
 
         // Get the exit rates restricted to only markovian maybe states.
         std::vector<ValueType> markovianExitRates = storm::utility::vector::filterVector(exitRateVector, markovianMaybeStates);
@@ -106,13 +119,14 @@ class UnifPlusHelper {
         // Obtain parameters of the algorithm
         auto two = storm::utility::convertNumber<ValueType>(2.0);
         // Truncation error
-        ValueType kappa = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
+        ValueType const initialKappa = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
         // Precision to be achieved
         ValueType epsilon = two * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
         bool relativePrecision = env.solver().timeBounded().getRelativeTerminationCriterion();
         // Uniformization rate
         ValueType lambda = *std::max_element(markovianExitRates.begin(), markovianExitRates.end());
         STORM_LOG_DEBUG("Initial lambda is " << lambda << ".");
+        uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
 
         // Split the transitions into various part
         // The (uniformized) probabilities to go from a Markovian state to a psi state in one step
@@ -137,6 +151,13 @@ class UnifPlusHelper {
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
         auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
 
+        // Set up the multipliers. The transitions from probabilistic to Markovian states are not affected by uniformization, so their multiplier
+        // is used for all iterations. The other one has to be recreated whenever the uniformization rate changes.
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianToMaybeMultiplier, probabilisticToMarkovianMultiplier;
+        if (numberOfThreads <= 1) {
+            probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+        }
+
         // Allocate auxiliary memory that can be used during the iterations
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
@@ -145,190 +166,281 @@ class UnifPlusHelper {
             markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
         std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
         std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
+        // The index of each maybe state among the Markovian (or probabilistic) maybe states, used to fuse the values of both kinds of states.
+        std::vector<uint64_t> indexOfMaybeState(maybeStates.getNumberOfSetBits());
+        for (uint64_t maybeState = 0, markovianIndex = 0, probabilisticIndex = 0; maybeState < indexOfMaybeState.size(); ++maybeState) {
+            indexOfMaybeState[maybeState] = markovianStatesModMaybeStates.get(maybeState) ? markovianIndex++ : probabilisticIndex++;
+        }
 
-        // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
+        std::vector<std::vector<ValueType>> results;
+        results.reserve(upperTimeBounds.size());
         storm::utility::ProgressMeasurement progressIterations("iterations");
-        uint64_t iteration = 0;
-        progressIterations.startNewMeasurement(iteration);
-        bool converged = false;
-        bool abortedInnerIterations = false;
-        while (!converged) {
-            // Maximal step size
-            uint64_t N = storm::utility::ceil(lambda * upperTimeBound * std::exp(2) - storm::utility::log(kappa * epsilon));
-            // Compute poisson distribution.
-            // The division by 8 is similar to what is done for CTMCs (probably to reduce numerical impacts?)
-            auto foxGlynnResult = storm::utility::numerical::foxGlynn(lambda * upperTimeBound, epsilon * kappa / storm::utility::convertNumber<ValueType>(8.0));
-            // Scale the weights so they sum to one.
-            // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
-
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
-                auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
-                ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
-                storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
-                                                                  std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
-                progressSteps.setMaxCount(N);
-                progressSteps.startNewMeasurement(0);
-                bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
-                int64_t k = N;
-                // Iteration k = N is always non-relevant
-                for (--k; k >= 0; --k) {
-                    // Check whether the iteration is relevant, that is, whether it will contribute non-zero values to the overall result
-                    if (computeLowerBound) {
-                        // Check whether the value for visiting a target state will be zero.
-                        if (static_cast<uint64_t>(k) > foxGlynnResult.right) {
-                            // Reaching this point means that we are in one of the earlier iterations where fox glynn told us to cut off
-                            continue;
+        for (auto const& upperTimeBound : upperTimeBounds) {
+            if (storm::utility::isInfinity(upperTimeBound)) {
+                results.push_back(getUntimedResult());
+                continue;
+            }
+            STORM_LOG_THROW(upperTimeBound > storm::utility::zero<ValueType>(), storm::exceptions::InvalidArgumentException,
+                            "The upper time bound " << upperTimeBound << " has to be positive.");
+
+            ValueType kappa = initialKappa;
+            // Store the best solution known so far (useful in cases where the computation gets aborted)
+            std::vector<ValueType> bestKnownSolution;
+            if (relevantMaybeStates) {
+                bestKnownSolution.resize(relevantStates->size());
+            }
+            std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
+
+            // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
+            uint64_t iteration = 0;
+            progressIterations.startNewMeasurement(iteration);
+            bool converged = false;
+            bool abortedInnerIterations = false;
+            while (!converged) {
+                // Maximal step size
+                uint64_t N = storm::utility::ceil(lambda * upperTimeBound * std::exp(2) - storm::utility::log(kappa * epsilon));
+                // Compute poisson distribution.
+                // The division by 8 is similar to what is done for CTMCs (probably to reduce numerical impacts?)
+                auto foxGlynnResult =
+                    storm::utility::numerical::foxGlynn(lambda * upperTimeBound, epsilon * kappa / storm::utility::convertNumber<ValueType>(8.0));
+                // Scale the weights so they sum to one.
+                // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+
+                // Set up multiplier (if the uniformized transitions changed)
+                if (numberOfThreads <= 1 && !markovianToMaybeMultiplier) {
+                    markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+                }
+
+                // Perform inner iterations first for upper, then for lower bound
+                STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+                for (bool computeLowerBound : {false, true}) {
+                    auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
+                    ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+                    storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
+                                                                      std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
+                    progressSteps.setMaxCount(N);
+                    progressSteps.startNewMeasurement(0);
+                    bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
+                    int64_t k = N;
+                    // Iteration k = N is always non-relevant
+                    for (--k; k >= 0; --k) {
+                        // Check whether the iteration is relevant, that is, whether it will contribute non-zero values to the overall result
+                        if (computeLowerBound) {
+                            // Check whether the value for visiting a target state will be zero.
+                            if (static_cast<uint64_t>(k) > foxGlynnResult.right) {
+                                // Reaching this point means that we are in one of the earlier iterations where fox glynn told us to cut off
+                                continue;
+                            }
+                        } else {
+                            uint64_t i = N - 1 - k;
+                            if (i > foxGlynnResult.right) {
+                                // Reaching this point means that we are in a later iteration which will not contribute to the upper bound
+                                // Since i will only get larger in subsequent iterations, we can directly break here.
+                                break;
+                            }
                         }
-                    } else {
-                        uint64_t i = N - 1 - k;
-                        if (i > foxGlynnResult.right) {
-                            // Reaching this point means that we are in a later iteration which will not contribute to the upper bound
-                            // Since i will only get larger in subsequent iterations, we can directly break here.
+
+                        // Compute the values at Markovian maybe states.
+                        if (firstIteration) {
+                            firstIteration = false;
+                            // Reaching this point means that this is the very first relevant iteration.
+                            // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
+                            // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
+                            std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                        } else {
+                            // Compute the values at Markovian maybe states.
+                            multiply(env, markovianToMaybeMultiplier.get(), markovianToMaybeTransitions, maybeStatesValues, nextMarkovianStateValues,
+                                     numberOfThreads);
+                            for (auto const& oneStepProb : markovianToPsiProbabilities) {
+                                nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                            }
+                        }
+
+                        // Update the value when reaching a psi state.
+                        // This has to be done after updating the Markovian state values since we needed the 'old' target value above.
+                        if (computeLowerBound && static_cast<uint64_t>(k) >= foxGlynnResult.left) {
+                            assert(static_cast<uint64_t>(k) <= foxGlynnResult.right);  // has to hold since this iteration is relevant
+                            targetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
+                        }
+
+                        // Compute the values at probabilistic states.
+                        multiply(env, probabilisticToMarkovianMultiplier.get(), probabilisticToMarkovianTransitions, nextMarkovianStateValues, eqSysRhs,
+                                 numberOfThreads);
+                        for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
+                            eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                        }
+                        if (solver) {
+                            solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                        } else {
+                            reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues, probabilisticToProbabilisticTransitions.getRowGroupIndices(),
+                                                 numberOfThreads);
+                        }
+
+                        // Create the new values for the maybestates
+                        // Fuse the results together and add the scaled values to the actual result vector (for the upper bound)
+                        ValueType const* weight = nullptr;
+                        if (!computeLowerBound) {
+                            uint64_t i = N - 1 - k;
+                            if (i >= foxGlynnResult.left) {
+                                assert(i <= foxGlynnResult.right);  // has to hold since this iteration is considered relevant.
+                                weight = &foxGlynnResult.weights[i - foxGlynnResult.left];
+                            }
+                        }
+                        storm::utility::parallel::forEachChunk(
+                            numberOfThreads, maybeStatesValues.size(), ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+                                for (uint64_t maybeState = begin; maybeState < end; ++maybeState) {
+                                    uint64_t const index = indexOfMaybeState[maybeState];
+                                    maybeStatesValues[maybeState] = markovianStatesModMaybeStates.get(maybeState) ? nextMarkovianStateValues[index]
+                                                                                                                  : nextProbabilisticStateValues[index];
+                                    if (weight) {
+                                        maybeStatesValuesUpper[maybeState] += *weight * maybeStatesValues[maybeState];
+                                    }
+                                }
+                            });
+
+                        progressSteps.updateProgress(N - k);
+                        if (storm::utility::resources::isTerminate()) {
+                            abortedInnerIterations = true;
                             break;
                         }
                     }
 
-                    // Compute the values at Markovian maybe states.
-                    if (firstIteration) {
-                        firstIteration = false;
-                        // Reaching this point means that this is the very first relevant iteration.
-                        // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
-                        // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                    if (computeLowerBound) {
+                        storm::utility::vector::scaleVectorInPlace(maybeStatesValuesLower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                     } else {
-                        // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
-                        for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
-                        }
+                        storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                     }
 
-                    // Update the value when reaching a psi state.
-                    // This has to be done after updating the Markovian state values since we needed the 'old' target value above.
-                    if (computeLowerBound && static_cast<uint64_t>(k) >= foxGlynnResult.left) {
-                        assert(static_cast<uint64_t>(k) <= foxGlynnResult.right);  // has to hold since this iteration is relevant
-                        targetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
+                    if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                        break;
                     }
 
-                    // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
-                    for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
-                    }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
-                    } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
-                                                                     probabilisticToProbabilisticTransitions.getRowGroupIndices());
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (converged) {
+                        break;
                     }
 
-                    // Create the new values for the maybestates
-                    // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
-                    if (!computeLowerBound) {
-                        // Add the scaled values to the actual result vector
-                        uint64_t i = N - 1 - k;
-                        if (i >= foxGlynnResult.left) {
-                            assert(i <= foxGlynnResult.right);  // has to hold since this iteration is considered relevant.
-                            ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
-                            storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                    // Store the best solution we have found so far.
+                    if (relevantMaybeStates) {
+                        auto currentSolIt = bestKnownSolution.begin();
+                        for (auto state : relevantMaybeStates.get()) {
+                            // We take the average of the lower and upper bounds
+                            *currentSolIt = (maybeStatesValuesLower[state] + maybeStatesValuesUpper[state]) / two;
+                            ++currentSolIt;
                         }
                     }
+                }
 
-                    progressSteps.updateProgress(N - k);
-                    if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
-                        break;
+                if (!converged) {
+                    // Increase the uniformization rate and prepare the next run
+
+                    // Double lambda.
+                    ValueType oldLambda = lambda;
+                    lambda *= two;
+                    STORM_LOG_DEBUG("Increased lambda to " << lambda << ".");
+
+                    if (relativePrecision) {
+                        // Reduce kappa a bit
+                        ValueType minValue;
+                        if (relevantMaybeStates) {
+                            minValue = storm::utility::vector::min_if(maybeStatesValuesUpper, relevantMaybeStates.get());
+                        } else {
+                            minValue = *std::min_element(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end());
+                        }
+                        minValue *= initialKappa;
+                        kappa = std::min(kappa, minValue);
+                        STORM_LOG_DEBUG("Decreased kappa to " << kappa << ".");
                     }
-                }
 
-                if (computeLowerBound) {
-                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesLower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                } else {
-                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                }
+                    // Apply uniformization with new rate
+                    uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
+                    markovianToMaybeMultiplier.reset();
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
+                    // Reset the values of the maybe states to zero.
+                    std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
                 }
-
-                // Check if the lower and upper bound are sufficiently close to each other
-                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
+                progressIterations.updateProgress(++iteration);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Aborted unif+ in iteration " << iteration << ".");
                     break;
                 }
-
-                // Store the best solution we have found so far.
-                if (relevantMaybeStates) {
-                    auto currentSolIt = bestKnownSolution.begin();
-                    for (auto state : relevantMaybeStates.get()) {
-                        // We take the average of the lower and upper bounds
-                        *currentSolIt = (maybeStatesValuesLower[state] + maybeStatesValuesUpper[state]) / two;
-                        ++currentSolIt;
-                    }
-                }
             }
 
-            if (!converged) {
-                // Increase the uniformization rate and prepare the next run
-
-                // Double lambda.
-                ValueType oldLambda = lambda;
-                lambda *= two;
-                STORM_LOG_DEBUG("Increased lambda to " << lambda << ".");
+            // Prepare the result vector
+            std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
 
-                if (relativePrecision) {
-                    // Reduce kappa a bit
-                    ValueType minValue;
-                    if (relevantMaybeStates) {
-                        minValue = storm::utility::vector::min_if(maybeStatesValuesUpper, relevantMaybeStates.get());
-                    } else {
-                        minValue = *std::min_element(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end());
-                    }
-                    minValue *= storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getUnifPlusKappa());
-                    kappa = std::min(kappa, minValue);
-                    STORM_LOG_DEBUG("Decreased kappa to " << kappa << ".");
-                }
-
-                // Apply uniformization with new rate
-                uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
+            if (abortedInnerIterations && iteration > 1 && relevantMaybeStates && relevantStates) {
+                // We should take the stored solution instead of the current (probably more incorrect) lower/upper values
+                storm::utility::vector::setVectorValues(result, maybeStates & relevantStates.get(), bestKnownSolution);
+            } else {
+                // We take the average of the lower and upper bounds
+                std::vector<ValueType> maybeStatesValues(maybeStatesValuesLower.size());
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                    maybeStatesValuesLower, maybeStatesValuesUpper, maybeStatesValues,
+                    [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
 
-                // Reset the values of the maybe states to zero.
-                std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
-            }
-            progressIterations.updateProgress(++iteration);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Aborted unif+ in iteration " << iteration << ".");
-                break;
+                storm::utility::vector::setVectorValues(result, maybeStates, maybeStatesValues);
             }
+            results.push_back(std::move(result));
         }
+        return results;
+    }
 
-        // Prepare the result vector
-        std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-        storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+    std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
+                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                            ValueType const& upperTimeBound,
+                                                            boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+        return std::move(computeBoundedUntilProbabilities(env, dir, phiStates, psiStates, std::vector<ValueType>({upperTimeBound}), relevantStates).front());
+    }
 
-        if (abortedInnerIterations && iteration > 1 && relevantMaybeStates && relevantStates) {
-            // We should take the stored solution instead of the current (probably more incorrect) lower/upper values
-            storm::utility::vector::setVectorValues(result, maybeStates & relevantStates.get(), bestKnownSolution);
-        } else {
-            // We take the average of the lower and upper bounds
-            storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
-                maybeStatesValuesLower, maybeStatesValuesUpper, maybeStatesValuesLower,
-                [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+   private:
+    // The number of rows that a thread processes at once.
+    static constexpr uint64_t ChunkSize = 4096;
 
-            storm::utility::vector::setVectorValues(result, maybeStates, maybeStatesValuesLower);
+    /*!
+     * Computes result = matrix * x, either with the given multiplier or (if there are multiple threads) by splitting the rows among the threads.
+     */
+    static void multiply(storm::Environment const& env, storm::solver::Multiplier<ValueType> const* multiplier,
+                         storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType>& result,
+                         uint64_t numberOfThreads) {
+        if (multiplier) {
+            multiplier->multiply(env, x, nullptr, result);
+            return;
         }
-        return result;
+        storm::utility::parallel::forEachChunk(numberOfThreads, matrix.getRowCount(), ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t row = begin; row < end; ++row) {
+                ValueType value = storm::utility::zero<ValueType>();
+                for (auto const& entry : matrix.getRow(row)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+                result[row] = std::move(value);
+            }
+        });
     }
 
-   private:
+    /*!
+     * Reduces the values of each row group to their minimum (or maximum), splitting the row groups among the threads.
+     */
+    static void reduceVectorMinOrMax(OptimizationDirection dir, std::vector<ValueType> const& source, std::vector<ValueType>& target,
+                                     std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfThreads) {
+        if (numberOfThreads <= 1) {
+            storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGroupIndices);
+            return;
+        }
+        storm::utility::parallel::forEachChunk(numberOfThreads, target.size(), ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t group = begin; group < end; ++group) {
+                ValueType value = source[rowGroupIndices[group]];
+                for (uint64_t row = rowGroupIndices[group] + 1; row < rowGroupIndices[group + 1]; ++row) {
+                    if (storm::solver::minimize(dir) ? source[row] < value : source[row] > value) {
+                        value = source[row];
+                    }
+                }
+                target[group] = std::move(value);
+            }
+        });
+    }
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -724,6 +836,29 @@ std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbab
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForUpperBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_WARN_COND(env.solver().timeBounded().getMaMethod() == storm::solver::MaBoundedReachabilityMethod::UnifPlus,
+                        "Using Unif+ method because only Unif+ supports computing several time bounds at once.");
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& upperBound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+    }
+
+    UnifPlusHelper<ValueType> helper(transitionMatrix, exitRateVector, markovianStates);
+    boost::optional<storm::storage::BitVector> relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+    }
+    return helper.computeBoundedUntilProbabilities(env, goal.direction(), phiStates, psiStates, timeBounds, relevantValues);
+}
+
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -787,6 +922,11 @@ template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntil
     std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForUpperBounds(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
 template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -32,6 +32,18 @@ class SparseMarkovAutomatonCslHelper {
                                                                    storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
                                                                    storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+    /*!
+     * Computes the probabilities of the bounded until formulas phi U[0, t] psi for all of the given upper time bounds t with unif+. All bounds
+     * share the preprocessing, the uniformized matrices and the uniformization rate reached for the previous bounds.
+     *
+     * @return The result vectors in the order of the given upper bounds.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForUpperBounds(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(Environment const& env, OptimizationDirection dir,
                                                                                        storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -0,0 +1,192 @@
+#include "storm/modelchecker/csl/helper/TransientUniformizationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/numerical.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+TransientUniformizationHelper<ValueType>::TransientUniformizationHelper(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                        std::vector<ValueType> const* addVector, ValueType uniformizationRate)
+    : uniformizedMatrix(uniformizedMatrix), addVector(addVector), uniformizationRate(uniformizationRate), numberOfThreads(1), numberOfPerformedIterations(0) {
+    STORM_LOG_THROW(uniformizedMatrix.getRowCount() == uniformizedMatrix.getColumnCount(), storm::exceptions::IllegalArgumentException,
+                    "The uniformized matrix has to be square.");
+    STORM_LOG_THROW(!addVector || addVector->size() == uniformizedMatrix.getRowCount(), storm::exceptions::IllegalArgumentException,
+                    "The size of the add vector (" << addVector->size() << ") does not match the number of rows (" << uniformizedMatrix.getRowCount()
+                                                   << ").");
+}
+
+template<typename ValueType>
+void TransientUniformizationHelper<ValueType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+}
+
+template<typename ValueType>
+uint64_t TransientUniformizationHelper<ValueType>::getNumberOfPerformedIterations() const {
+    return numberOfPerformedIterations;
+}
+
+template<typename ValueType>
+typename TransientUniformizationHelper<ValueType>::PoissonWindow TransientUniformizationHelper<ValueType>::computePoissonWindow(
+    ValueType timeBound, ValueType epsilon, bool useMixedPoissonProbabilities) const {
+    PoissonWindow window;
+    ValueType lambda = timeBound * uniformizationRate;
+
+    // If no time can pass, the initial values are the result.
+    if (storm::utility::isZero(lambda)) {
+        window.right = 0;
+        window.weights.assign(1, storm::utility::one<ValueType>());
+        window.remainingWeights.assign(1, storm::utility::zero<ValueType>());
+        window.totalWeight = storm::utility::one<ValueType>();
+        return window;
+    }
+
+    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBound << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+    window.right = foxGlynnResult.right;
+    window.totalWeight = foxGlynnResult.totalWeight;
+
+    // The weights do not sum up to one, which enhances numerical stability. The result is divided by their total in the end.
+    window.weights.assign(window.right + 1, storm::utility::zero<ValueType>());
+    if (useMixedPoissonProbabilities) {
+        // Every iteration before the left truncation point contributes with the full weight.
+        std::fill(window.weights.begin(), window.weights.begin() + foxGlynnResult.left, foxGlynnResult.totalWeight / uniformizationRate);
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (uint64_t index = 0; index < foxGlynnResult.weights.size(); ++index) {
+            sum += foxGlynnResult.weights[index];
+            window.weights[foxGlynnResult.left + index] = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
+        }
+    } else {
+        std::copy(foxGlynnResult.weights.begin(), foxGlynnResult.weights.end(), window.weights.begin() + foxGlynnResult.left);
+    }
+
+    window.remainingWeights.assign(window.right + 1, storm::utility::zero<ValueType>());
+    for (uint64_t k = window.right; k > 0; --k) {
+        window.remainingWeights[k - 1] = window.remainingWeights[k] + window.weights[k];
+    }
+    return window;
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> TransientUniformizationHelper<ValueType>::computeTransientProbabilities(std::vector<ValueType> const& timeBounds,
+                                                                                                          std::vector<ValueType> const& values,
+                                                                                                          ValueType epsilon,
+                                                                                                          bool useMixedPoissonProbabilities) {
+    uint64_t const rowCount = uniformizedMatrix.getRowCount();
+    STORM_LOG_THROW(values.size() == rowCount, storm::exceptions::IllegalArgumentException,
+                    "The size of the initial values (" << values.size() << ") does not match the number of rows (" << rowCount << ").");
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    ValueType const halfEpsilon = epsilon / storm::utility::convertNumber<ValueType>(2.0);
+
+    std::vector<PoissonWindow> windows;
+    windows.reserve(timeBounds.size());
+    uint64_t maximalRight = 0;
+    for (auto const& timeBound : timeBounds) {
+        windows.push_back(computePoissonWindow(timeBound, halfEpsilon, useMixedPoissonProbabilities));
+        maximalRight = std::max(maximalRight, windows.back().right);
+    }
+
+    std::vector<std::vector<ValueType>> results;
+    results.reserve(timeBounds.size());
+    for (auto const& window : windows) {
+        results.emplace_back(values);
+        for (auto& value : results.back()) {
+            value *= window.weights.front();
+        }
+    }
+
+    // A time bound is active as long as further iterates contribute to its result.
+    std::vector<bool> active(windows.size());
+    uint64_t numberOfActiveTimeBounds = 0;
+    for (uint64_t bound = 0; bound < windows.size(); ++bound) {
+        active[bound] = windows[bound].right > 0;
+        numberOfActiveTimeBounds += active[bound] ? 1 : 0;
+    }
+
+    STORM_LOG_DEBUG("Starting at most " << maximalRight << " iterations with " << rowCount << " x " << rowCount << " matrix for " << timeBounds.size()
+                                        << " time bound(s).");
+    uint64_t const threads = rowCount < MinimalRowCountForParallelization ? 1 : numberOfThreads;
+    std::vector<ValueType> currentValues = values;
+    std::vector<ValueType> nextValues(rowCount);
+    std::vector<ValueType> maximalDifferences(threads);
+    std::vector<std::pair<ValueType*, ValueType>> accumulations;
+    accumulations.reserve(windows.size());
+    numberOfPerformedIterations = 0;
+    for (uint64_t k = 1; k <= maximalRight && numberOfActiveTimeBounds > 0; ++k) {
+        accumulations.clear();
+        for (uint64_t bound = 0; bound < windows.size(); ++bound) {
+            if (active[bound] && !storm::utility::isZero(windows[bound].weights[k])) {
+                accumulations.emplace_back(results[bound].data(), windows[bound].weights[k]);
+            }
+        }
+
+        // Compute the next iterate and add it (weighted) to the results of all time bounds in the same pass.
+        std::fill(maximalDifferences.begin(), maximalDifferences.end(), storm::utility::zero<ValueType>());
+        storm::utility::parallel::forEachChunk(threads, rowCount, ChunkSize, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            ValueType maximalDifference = maximalDifferences[threadIndex];
+            for (uint64_t row = begin; row < end; ++row) {
+                ValueType value = addVector ? (*addVector)[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                    value += entry.getValue() * currentValues[entry.getColumn()];
+                }
+                nextValues[row] = value;
+                maximalDifference = std::max<ValueType>(maximalDifference, storm::utility::abs<ValueType>(value - currentValues[row]));
+                for (auto const& [result, weight] : accumulations) {
+                    result[row] += weight * value;
+                }
+            }
+            maximalDifferences[threadIndex] = maximalDifference;
+        });
+        ++numberOfPerformedIterations;
+        ValueType difference = *std::max_element(maximalDifferences.begin(), maximalDifferences.end());
+
+        // As the matrix is substochastic, the difference between consecutive iterates does not increase. Hence, the iterates j > k differ from the
+        // current one by at most (j - k) * difference. If this is negligible for the remaining weights, the current iterate is used for all of them.
+        for (uint64_t bound = 0; bound < windows.size(); ++bound) {
+            if (!active[bound]) {
+                continue;
+            }
+            PoissonWindow const& window = windows[bound];
+            if (k == window.right) {
+                active[bound] = false;
+                --numberOfActiveTimeBounds;
+            } else if (difference * storm::utility::convertNumber<ValueType>(window.right - k) * window.remainingWeights[k] <=
+                       halfEpsilon * window.totalWeight) {
+                STORM_LOG_DEBUG("Iterates are stationary after " << k << " of " << window.right << " iterations.");
+                std::vector<ValueType>& result = results[bound];
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    result[row] += window.remainingWeights[k] * nextValues[row];
+                }
+                active[bound] = false;
+                --numberOfActiveTimeBounds;
+            }
+        }
+        std::swap(currentValues, nextValues);
+    }
+    STORM_LOG_INFO("Transient analysis for " << timeBounds.size() << " time bound(s) took " << numberOfPerformedIterations << " iterations.");
+
+    // Finally, divide the results by the total weights.
+    for (uint64_t bound = 0; bound < windows.size(); ++bound) {
+        ValueType factor = storm::utility::one<ValueType>() / windows[bound].totalWeight;
+        for (auto& value : results[bound]) {
+            value *= factor;
+        }
+    }
+    return results;
+}
+
+template class TransientUniformizationHelper<double>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Computes transient probabilities (or cumulative values) of a uniformized CTMC, i.e. sums of the form
+ *
+ *     sum_k w_k * v_k   with   v_0 = values,   v_{k + 1} = P * v_k + b,
+ *
+ * where the weights w_k are the Poisson probabilities given by the Fox-Glynn algorithm. Instead of materializing every v_k and adding it to
+ * the result afterwards, each iteration performs the multiplication and accumulates the weighted row values into the results in the same pass
+ * over the matrix. The rows are distributed over the configured number of threads.
+ *
+ * Several time bounds can be handled at once: they share the uniformized matrix and the iterates v_k, so the cost is determined by the
+ * largest right truncation point only. Moreover, the iteration stops early once the iterates are stationary, i.e. once the change between
+ * two consecutive iterates guarantees that the remaining terms differ from the current iterate by less than the allowed error.
+ */
+template<typename ValueType>
+class TransientUniformizationHelper {
+   public:
+    /// Matrices with fewer rows are always processed by a single thread.
+    static constexpr uint64_t MinimalRowCountForParallelization = 1ull << 15;
+    /// The number of consecutive rows that are claimed by a thread at once.
+    static constexpr uint64_t ChunkSize = 1024;
+
+    /*!
+     * @param uniformizedMatrix The (sub)stochastic uniformized transition matrix P.
+     * @param addVector If not nullptr, this vector b is added to the iterates in each step.
+     * @param uniformizationRate The rate that was used to uniformize the matrix.
+     */
+    TransientUniformizationHelper(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+                                  ValueType uniformizationRate);
+
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Computes the transient values for each of the given time bounds.
+     *
+     * @param timeBounds The time bounds (not necessarily sorted).
+     * @param values The initial iterate v_0.
+     * @param epsilon The maximal absolute error of each result. Half of it is spent on the truncation of the Poisson distribution and the other half
+     * on the early termination once the iterates are stationary.
+     * @param useMixedPoissonProbabilities If set, the weights w_k are the probabilities that no more than k jumps happen (scaled with the reciprocal
+     * of the uniformization rate), as it is required for cumulative rewards.
+     * @return The results in the order of the time bounds.
+     */
+    std::vector<std::vector<ValueType>> computeTransientProbabilities(std::vector<ValueType> const& timeBounds, std::vector<ValueType> const& values,
+                                                                      ValueType epsilon, bool useMixedPoissonProbabilities);
+
+    /*!
+     * Retrieves the number of matrix-vector multiplications that were performed in the last call to computeTransientProbabilities.
+     */
+    uint64_t getNumberOfPerformedIterations() const;
+
+   private:
+    struct PoissonWindow {
+        // The last iteration whose weight is non-zero.
+        uint64_t right;
+        // The (unnormalized) weights of the iterations 0, ..., right.
+        std::vector<ValueType> weights;
+        // remainingWeights[k] is the sum of the weights of the iterations k + 1, ..., right.
+        std::vector<ValueType> remainingWeights;
+        // The sum by which the accumulated result has to be divided.
+        ValueType totalWeight;
+    };
+
+    PoissonWindow computePoissonWindow(ValueType timeBound, ValueType epsilon, bool useMixedPoissonProbabilities) const;
+
+    storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix;
+    std::vector<ValueType> const* addVector;
+    ValueType uniformizationRate;
+    uint64_t numberOfThreads;
+    uint64_t numberOfPerformedIterations;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
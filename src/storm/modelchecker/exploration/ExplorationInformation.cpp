@@ -3,6 +3,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -83,6 +84,10 @@ void ExplorationInformation<StateType, ValueType>::terminateCurrentRowGroup() {
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::moveActionToBackOfMatrix(ActionType const& action) {
     matrix.emplace_back(std::move(matrix[action]));
+    if (action < probabilityAliasTables.size()) {
+        probabilityAliasTables.resize(matrix.size());
+        probabilityAliasTables.back() = std::move(probabilityAliasTables[action]);
+    }
 }
 
 template<typename StateType, typename ValueType>
@@ -210,6 +215,11 @@ bool ExplorationInformation<StateType, ValueType>::useDifferenceProbabilitySumHe
     return nextStateHeuristic == storm::settings::modules::ExplorationSettings::NextStateHeuristic::DifferenceProbabilitySum;
 }
 
+template<typename StateType, typename ValueType>
+bool ExplorationInformation<StateType, ValueType>::useDifferenceProbabilityProductHeuristic() const {
+    return nextStateHeuristic == storm::settings::modules::ExplorationSettings::NextStateHeuristic::DifferenceProbabilityProduct;
+}
+
 template<typename StateType, typename ValueType>
 bool ExplorationInformation<StateType, ValueType>::useProbabilityHeuristic() const {
     return nextStateHeuristic == storm::settings::modules::ExplorationSettings::NextStateHeuristic::Probability;
@@ -220,6 +230,54 @@ bool ExplorationInformation<StateType, ValueType>::useUniformHeuristic() const {
     return nextStateHeuristic == storm::settings::modules::ExplorationSettings::NextStateHeuristic::Uniform;
 }
 
+template<typename StateType, typename ValueType>
+typename ExplorationInformation<StateType, ValueType>::AliasTable const& ExplorationInformation<StateType, ValueType>::getProbabilityAliasTable(
+    ActionType const& action) const {
+    if (action >= probabilityAliasTables.size()) {
+        probabilityAliasTables.resize(matrix.size());
+    }
+    AliasTable& table = probabilityAliasTables[action];
+    if (!table.threshold.empty()) {
+        return table;
+    }
+
+    // Build the table with Vose's variant of the alias method: Entries whose scaled probability is below one are filled up by entries
+    // whose scaled probability exceeds one.
+    auto const& row = matrix[action];
+    ValueType sum = storm::utility::zero<ValueType>();
+    for (auto const& entry : row) {
+        sum += entry.getValue();
+    }
+    ValueType const scaling = storm::utility::convertNumber<ValueType>(row.size()) / sum;
+    table.threshold.resize(row.size());
+    table.alias.resize(row.size());
+    std::vector<StateType> small, large;
+    for (StateType index = 0; index < row.size(); ++index) {
+        table.threshold[index] = row[index].getValue() * scaling;
+        table.alias[index] = index;
+        (table.threshold[index] < storm::utility::one<ValueType>() ? small : large).push_back(index);
+    }
+    while (!small.empty() && !large.empty()) {
+        StateType smallIndex = small.back();
+        small.pop_back();
+        StateType largeIndex = large.back();
+        table.alias[smallIndex] = largeIndex;
+        table.threshold[largeIndex] -= storm::utility::one<ValueType>() - table.threshold[smallIndex];
+        if (table.threshold[largeIndex] < storm::utility::one<ValueType>()) {
+            large.pop_back();
+            small.push_back(largeIndex);
+        }
+    }
+    // The remaining entries (only differing from one due to numerical inaccuracies) are always taken.
+    for (auto const& index : small) {
+        table.threshold[index] = storm::utility::one<ValueType>();
+    }
+    for (auto const& index : large) {
+        table.threshold[index] = storm::utility::one<ValueType>();
+    }
+    return table;
+}
+
 template<typename StateType, typename ValueType>
 storm::OptimizationDirection const& ExplorationInformation<StateType, ValueType>::getOptimizationDirection() const {
     return optimizationDirection;
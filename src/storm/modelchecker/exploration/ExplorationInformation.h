@@ -28,6 +28,15 @@ class ExplorationInformation {
     typedef typename IdToStateMap::const_iterator const_iterator;
     typedef std::vector<std::vector<storm::storage::MatrixEntry<StateType, ValueType>>> MatrixType;
 
+    /*!
+     * An alias table (Walker's alias method) that allows to sample an entry of a row according to the probabilities in constant time: After
+     * choosing an entry uniformly, the entry itself is taken with probability threshold[entry] and alias[entry] otherwise.
+     */
+    struct AliasTable {
+        std::vector<ValueType> threshold;
+        std::vector<StateType> alias;
+    };
+
     ExplorationInformation(storm::OptimizationDirection const& direction, ActionType const& unexploredMarker = std::numeric_limits<ActionType>::max());
 
     const_iterator findUnexploredState(StateType const& state) const;
@@ -96,10 +105,18 @@ class ExplorationInformation {
 
     bool useDifferenceProbabilitySumHeuristic() const;
 
+    bool useDifferenceProbabilityProductHeuristic() const;
+
     bool useProbabilityHeuristic() const;
 
     bool useUniformHeuristic() const;
 
+    /*!
+     * Retrieves the alias table for sampling a successor of the given action according to the transition probabilities. The table is built
+     * on first use, so the action must not be modified afterwards (except for moving it to the back of the matrix).
+     */
+    AliasTable const& getProbabilityAliasTable(ActionType const& action) const;
+
     storm::OptimizationDirection const& getOptimizationDirection() const;
 
     void setOptimizationDirection(storm::OptimizationDirection const& direction);
@@ -108,6 +125,9 @@ class ExplorationInformation {
     MatrixType matrix;
     std::vector<StateType> rowGroupIndices;
 
+    // The alias tables of the actions (an empty table indicates that the table was not yet built).
+    mutable std::vector<AliasTable> probabilityAliasTables;
+
     std::vector<StateType> stateToRowGroupMapping;
     StateType unexploredMarker;
     IdToStateMap unexploredStates;
@@ -0,0 +1,141 @@
+#include "storm/modelchecker/exploration/PartialExplorationModelChecker.h"
+
+#include <memory>
+#include <type_traits>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+PartialExplorationOptions::PartialExplorationOptions() : explorationOrder(storm::builder::ExplorationOrder::Bfs) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType>
+PartialExplorationModelChecker<ModelType>::PartialExplorationModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                                                          PartialExplorationOptions const& options)
+    : options(options), lastBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>()), lastNumberOfStates(0, 0) {
+    STORM_LOG_THROW(model.isPrismProgram() || model.isJaniModel(), storm::exceptions::NotSupportedException,
+                    "Partial exploration requires a PRISM program or a JANI model.");
+    if (model.isPrismProgram()) {
+        this->model = model.asPrismProgram().substituteConstantsFormulas();
+    } else {
+        this->model = model.asJaniModel().substituteConstantsFunctions();
+    }
+}
+
+template<typename ModelType>
+bool PartialExplorationModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    if (!checkTask.isOnlyInitialStatesRelevantSet() || !formula.isProbabilityOperatorFormula()) {
+        return false;
+    }
+    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    storm::logic::FragmentSpecification const propositional = storm::logic::propositional();
+    if (pathFormula.isEventuallyFormula()) {
+        return pathFormula.asEventuallyFormula().getSubformula().isInFragment(propositional);
+    } else if (pathFormula.isUntilFormula()) {
+        return pathFormula.asUntilFormula().getLeftSubformula().isInFragment(propositional) &&
+               pathFormula.asUntilFormula().getRightSubformula().isInFragment(propositional);
+    }
+    return false;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> PartialExplorationModelChecker<ModelType>::computeUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    storm::logic::UntilFormula const& until = checkTask.getFormula();
+    std::string const unexploredLabel = storm::builder::ExplicitModelBuilder<ValueType>::getUnexploredStatesLabel();
+    for (auto const& labelFormula : until.getAtomicLabelFormulas()) {
+        STORM_LOG_THROW(labelFormula->getLabel() != unexploredLabel, storm::exceptions::InvalidArgumentException,
+                        "The label '" << unexploredLabel << "' is reserved for partial exploration.");
+    }
+
+    // Build the model until the budget is exhausted. The terminal states of the property are not expanded either.
+    storm::builder::BuilderOptions builderOptions(until, model);
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options explorationOptions;
+    explorationOptions.explorationOrder = options.explorationOrder;
+    if (options.stateBudget) {
+        explorationOptions.stateBudget = options.stateBudget.value();
+    }
+    if (options.memoryBudget) {
+        explorationOptions.memoryBudget = options.memoryBudget.value();
+    }
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> partialModel;
+    if (model.isPrismProgram()) {
+        partialModel = storm::builder::ExplicitModelBuilder<ValueType>(model.asPrismProgram(), builderOptions, explorationOptions).build();
+    } else {
+        partialModel = storm::builder::ExplicitModelBuilder<ValueType>(model.asJaniModel(), builderOptions, explorationOptions).build();
+    }
+    std::shared_ptr<ModelType> typedModel = partialModel->template as<ModelType>();
+    STORM_LOG_THROW(typedModel != nullptr, storm::exceptions::NotSupportedException,
+                    "The model type " << partialModel->getType() << " does not match the type of the model checker.");
+    STORM_LOG_THROW(typedModel->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException,
+                    "Partial exploration requires a single initial state.");
+    uint64_t const initialState = *typedModel->getInitialStates().begin();
+
+    // Unexplored states are no target states for the lower bound and target states for the upper bound.
+    storm::storage::BitVector unexploredStates(typedModel->getNumberOfStates());
+    if (typedModel->hasLabel(unexploredLabel)) {
+        unexploredStates = typedModel->getStates(unexploredLabel);
+    }
+    lastNumberOfStates = std::make_pair(typedModel->getNumberOfStates(), unexploredStates.getNumberOfSetBits());
+
+    typedef typename std::conditional<std::is_same<ModelType, storm::models::sparse::Dtmc<ValueType>>::value, SparseDtmcPrctlModelChecker<ModelType>,
+                                      SparseMdpPrctlModelChecker<ModelType>>::type SparseModelCheckerType;
+    SparseModelCheckerType checker(*typedModel);
+    std::unique_ptr<CheckResult> lowerResult = checker.computeUntilProbabilities(env, checkTask);
+    ValueType lowerBound = lowerResult->template asExplicitQuantitativeCheckResult<ValueType>()[initialState];
+    ValueType upperBound = lowerBound;
+    if (!unexploredStates.empty()) {
+        auto upperRight = std::make_shared<storm::logic::BinaryBooleanStateFormula>(storm::logic::BinaryBooleanStateFormula::OperatorType::Or,
+                                                                                    until.getRightSubformula().asSharedPointer(),
+                                                                                    std::make_shared<storm::logic::AtomicLabelFormula>(unexploredLabel));
+        storm::logic::UntilFormula upperUntil(until.getLeftSubformula().asSharedPointer(), upperRight);
+        std::unique_ptr<CheckResult> upperResult = checker.computeUntilProbabilities(env, checkTask.substituteFormula(upperUntil));
+        upperBound = upperResult->template asExplicitQuantitativeCheckResult<ValueType>()[initialState];
+    }
+    lastBounds = std::make_pair(lowerBound, upperBound);
+    STORM_LOG_INFO("Partial exploration built " << lastNumberOfStates.first << " states (" << lastNumberOfStates.second
+                                                << " unexplored) and yields the bounds [" << lowerBound << ", " << upperBound << "].");
+
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(initialState, (lowerBound + upperBound) / storm::utility::convertNumber<ValueType>(2));
+}
+
+template<typename ModelType>
+std::pair<typename ModelType::ValueType, typename ModelType::ValueType> const& PartialExplorationModelChecker<ModelType>::getLastBounds() const {
+    return lastBounds;
+}
+
+template<typename ModelType>
+std::pair<uint64_t, uint64_t> const& PartialExplorationModelChecker<ModelType>::getLastNumberOfStates() const {
+    return lastNumberOfStates;
+}
+
+template class PartialExplorationModelChecker<storm::models::sparse::Dtmc<double>>;
+template class PartialExplorationModelChecker<storm::models::sparse::Mdp<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
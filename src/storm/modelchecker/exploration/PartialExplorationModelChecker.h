@@ -0,0 +1,66 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "storm/builder/ExplorationOrder.h"
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace modelchecker {
+
+struct PartialExplorationOptions {
+    PartialExplorationOptions();
+
+    // The maximal number of states that are expanded. If neither this nor the memory budget is set, the full model is built.
+    std::optional<uint64_t> stateBudget;
+    // The maximal (estimated) number of bytes occupied by the explored states and transitions.
+    std::optional<uint64_t> memoryBudget;
+    // The order in which the states are explored.
+    storm::builder::ExplorationOrder explorationOrder;
+};
+
+/*!
+ * Computes sound bounds on (unbounded) until probabilities of a PRISM program or JANI model by building only a part of the model.
+ * The exploration stops as soon as the state or memory budget is exhausted. The states that were discovered but not expanded are made
+ * absorbing, so the probability of the model is at least the probability of reaching a target state in the partial model (where the
+ * unexplored states are no target states) and at most the probability of reaching a target or unexplored state. Both bounds hold for all
+ * schedulers, so they also bound minimal and maximal probabilities.
+ *
+ * The result is the center of the interval of the bounds. The bounds themselves can be retrieved via getLastBounds().
+ */
+template<typename ModelType>
+class PartialExplorationModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    explicit PartialExplorationModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                            PartialExplorationOptions const& options = PartialExplorationOptions());
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Retrieves the lower and upper bound of the probability that was computed last.
+     */
+    std::pair<ValueType, ValueType> const& getLastBounds() const;
+
+    /*!
+     * Retrieves the number of states of the partial model that was built last and the number of them that were not expanded.
+     */
+    std::pair<uint64_t, uint64_t> const& getLastNumberOfStates() const;
+
+   private:
+    storm::storage::SymbolicModelDescription model;
+
+    PartialExplorationOptions options;
+
+    std::pair<ValueType, ValueType> lastBounds;
+    std::pair<uint64_t, uint64_t> lastNumberOfStates;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
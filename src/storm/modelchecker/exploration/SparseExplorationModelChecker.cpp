@@ -1,5 +1,8 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <atomic>
+#include <thread>
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
@@ -29,6 +32,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -40,9 +44,16 @@ namespace modelchecker {
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
+    : SparseExplorationModelChecker(program, storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads)
     : program(program.substituteConstantsFormulas()),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
-      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()),
+      numberOfThreads(numberOfThreads == 0 ? storm::utility::parallel::getNumberOfHardwareThreads() : numberOfThreads) {
     // Intentionally left empty.
 }
 
@@ -95,7 +106,10 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
 
     // Now perform the actual sampling.
     Statistics<StateType, ValueType> stats;
-    bool convergenceCriterionMet = false;
+    bool convergenceCriterionMet = numberOfThreads > 1;
+    if (convergenceCriterionMet) {
+        performConcurrentExploration(stateGeneration, explorationInformation, bounds, stats);
+    }
     while (!convergenceCriterionMet) {
         bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
 
@@ -136,11 +150,64 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                       ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                       Bounds<StateType, ValueType>& bounds,
+                                                                                       Statistics<StateType, ValueType>& stats) const {
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+    std::mutex explorationMutex;
+
+    // Every thread expands states with its own generator, but all of them share the storage of the discovered states.
+    std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> stateGenerations;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        stateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(program, stateGeneration, explorationInformation, explorationMutex));
+    }
+
+    std::atomic<bool> done(false);
+    storm::utility::parallel::forEachChunk(numberOfThreads, numberOfThreads, 1, [&](uint64_t, uint64_t thread, uint64_t) {
+        try {
+            StateActionStack stack;
+            std::unique_lock<std::mutex> lock(explorationMutex);
+            while (!done) {
+                bool result = samplePathFromInitialState(*stateGenerations[thread], explorationInformation, stack, bounds, stats, &lock);
+
+                stats.sampledPath();
+                stats.updateMaxPathLength(stack.size());
+
+                // If a terminal state was found, we update the probabilities along the path contained in the stack.
+                if (result) {
+                    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                }
+
+                ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+                STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+                if (comparator.isZero(difference)) {
+                    done = true;
+                } else if (explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                    performPrecomputation(stack, explorationInformation, bounds, stats);
+                }
+                stack.clear();
+
+                // Give the other threads the chance to register the states they expanded.
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+            }
+        } catch (...) {
+            done = true;
+            throw;
+        }
+    });
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                                                      StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
-                                                                                     Statistics<StateType, ValueType>& stats) const {
+                                                                                     Statistics<StateType, ValueType>& stats,
+                                                                                     std::unique_lock<std::mutex>* lock) const {
     // Start the search from the initial state.
     stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
 
@@ -152,7 +219,24 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
 
         // If the state is not yet explored, we need to retrieve its behaviors.
         auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
-        if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+        if (unexploredIt != explorationInformation.unexploredStatesEnd() && lock) {
+            STORM_LOG_TRACE("State was not yet explored.");
+
+            // Claim the state, such that no other thread explores it while the lock is released during the exploration.
+            storm::generator::CompressedState compressedState = unexploredIt->second;
+            explorationInformation.removeUnexploredState(unexploredIt);
+            std::size_t numberOfPrecomputations = stats.numberOfPrecomputations;
+            foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats, lock);
+            if (stats.numberOfPrecomputations != numberOfPrecomputations) {
+                STORM_LOG_TRACE("Aborting the search, because another thread performed a precomputation.");
+                foundTerminalState = false;
+                stack.clear();
+                break;
+            }
+            if (foundTerminalState) {
+                STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
+            }
+        } else if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
             STORM_LOG_TRACE("State was not yet explored.");
 
             // Explore the previously unexplored state.
@@ -162,6 +246,10 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
                 STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
             }
             explorationInformation.removeUnexploredState(unexploredIt);
+        } else if (lock && explorationInformation.isUnexplored(currentStateId)) {
+            STORM_LOG_TRACE("Aborting the search, because another thread is exploring state " << currentStateId << ".");
+            stack.clear();
+            break;
         } else {
             // If the state was already explored, we check whether it is a terminal state or not.
             if (explorationInformation.isTerminal(currentStateId)) {
@@ -205,10 +293,32 @@ template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+                                                                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                                                       std::unique_lock<std::mutex>* lock) const {
     bool isTerminalState = false;
     bool isTargetState = false;
 
+    // Before generating the behavior of the state, we need to determine whether it's a target state that
+    // does not need to be expanded. This only registers newly discovered successors in the exploration information (which is
+    // synchronized by the state generation), so the lock can be released in the meantime.
+    if (lock) {
+        lock->unlock();
+    }
+    stateGeneration.load(currentState);
+    bool isConditionState = false;
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    if (stateGeneration.isTargetState()) {
+        isTargetState = true;
+    } else if (stateGeneration.isConditionState()) {
+        isConditionState = true;
+
+        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
+        behavior = stateGeneration.expand();
+    }
+    if (lock) {
+        lock->lock();
+    }
+
     ++stats.numberOfExploredStates;
 
     // Finally, map the unexplored state to the row group.
@@ -219,18 +329,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
     // all states that have been assigned to a row-group.
     bounds.initializeBoundsForNextState();
 
-    // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
-    stateGeneration.load(currentState);
-    if (stateGeneration.isTargetState()) {
+    if (isTargetState) {
         ++stats.numberOfTargetStates;
-        isTargetState = true;
         isTerminalState = true;
-    } else if (stateGeneration.isConditionState()) {
+    } else if (isConditionState) {
         STORM_LOG_TRACE("Exploring state.");
-
-        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
         STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
 
         // Clumsily check whether we have found a state that forms a trivial BMEC.
@@ -363,21 +466,39 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
     }
 
     // Depending on the selected next-state heuristic, we give the states other likelihoods of getting chosen.
-    if (explorationInformation.useDifferenceProbabilitySumHeuristic() || explorationInformation.useProbabilityHeuristic()) {
-        std::vector<ValueType> probabilities(row.size());
-        if (explorationInformation.useDifferenceProbabilitySumHeuristic()) {
-            std::transform(row.begin(), row.end(), probabilities.begin(),
-                           [&bounds, &explorationInformation](storm::storage::MatrixEntry<StateType, ValueType> const& entry) {
-                               return entry.getValue() + bounds.getDifferenceOfStateBounds(entry.getColumn(), explorationInformation);
-                           });
-        } else if (explorationInformation.useProbabilityHeuristic()) {
-            std::transform(row.begin(), row.end(), probabilities.begin(),
-                           [](storm::storage::MatrixEntry<StateType, ValueType> const& entry) { return entry.getValue(); });
+    if (explorationInformation.useDifferenceProbabilitySumHeuristic() || explorationInformation.useDifferenceProbabilityProductHeuristic()) {
+        // The weights depend on the current bounds, so we compute them (and their sum) and sample by inverting the cumulative weights.
+        successorWeights.resize(row.size());
+        ValueType totalWeight = storm::utility::zero<ValueType>();
+        bool sumHeuristic = explorationInformation.useDifferenceProbabilitySumHeuristic();
+        for (std::size_t index = 0; index < row.size(); ++index) {
+            ValueType difference = bounds.getDifferenceOfStateBounds(row[index].getColumn(), explorationInformation);
+            successorWeights[index] = sumHeuristic ? row[index].getValue() + difference : row[index].getValue() * difference;
+            totalWeight += successorWeights[index];
         }
 
-        // Now sample according to the probabilities.
-        std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        // If the bounds of all successors coincide, we fall back to sampling according to the probabilities.
+        if (!storm::utility::isZero(totalWeight)) {
+            ValueType threshold = std::uniform_real_distribution<ValueType>(storm::utility::zero<ValueType>(), totalWeight)(randomGenerator);
+            for (std::size_t index = 0; index + 1 < row.size(); ++index) {
+                if (threshold < successorWeights[index]) {
+                    return row[index].getColumn();
+                }
+                threshold -= successorWeights[index];
+            }
+            return row.back().getColumn();
+        }
+    }
+
+    if (!explorationInformation.useUniformHeuristic()) {
+        // Sample according to the probabilities with the (cached) alias table of the action.
+        auto const& aliasTable = explorationInformation.getProbabilityAliasTable(chosenAction);
+        StateType index = std::uniform_int_distribution<StateType>(0, row.size() - 1)(randomGenerator);
+        if (std::uniform_real_distribution<ValueType>(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>())(randomGenerator) >=
+            aliasTable.threshold[index]) {
+            index = aliasTable.alias[index];
+        }
+        return row[index].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
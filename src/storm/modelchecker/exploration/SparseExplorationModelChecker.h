@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
+#include <mutex>
 #include <random>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
@@ -48,6 +49,12 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    /*!
+     * Creates a model checker that samples paths with the given number of threads (where 0 means one thread per hardware thread) instead
+     * of the number of threads given by the exploration settings.
+     */
+    SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads);
+
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
 
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
@@ -57,13 +64,28 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    /*!
+     * Samples paths with multiple threads until the bounds of the initial state converged. The threads share the exploration information,
+     * the bounds and the statistics, which are guarded by a single mutex. The mutex is only released while a thread expands a state (with
+     * its own generator), which is the dominating effort while the explored fragment grows.
+     */
+    void performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                      ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                                      Statistics<StateType, ValueType>& stats) const;
+
+    /*!
+     * Samples a path from the initial state. If a lock is given, it is released while expanding states. In this case, the path is abandoned
+     * (i.e. the stack is cleared and false is returned) if it reaches a state that is currently expanded by another thread or if another
+     * thread performed a precomputation in the meantime, because that may have changed the actions of the states on the path.
+     */
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
-                                    Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+                                    Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                    std::unique_lock<std::mutex>* lock = nullptr) const;
 
     bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                      Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+                      Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::unique_lock<std::mutex>* lock = nullptr) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
                                    Bounds<StateType, ValueType>& bounds) const;
@@ -110,6 +132,12 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
+
+    // The number of threads that sample paths.
+    uint64_t numberOfThreads;
+
+    // A buffer for the weights of the successors of an action, such that no memory is allocated when sampling a successor.
+    mutable std::vector<ValueType> successorWeights;
 };
 }  // namespace modelchecker
 }  // namespace storm
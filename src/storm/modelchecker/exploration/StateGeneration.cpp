@@ -13,14 +13,35 @@ StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program con
                                                        storm::expressions::Expression const& conditionStateExpression,
                                                        storm::expressions::Expression const& targetStateExpression)
     : generator(program),
-      stateStorage(generator.getStateSize()),
+      stateStorage(std::make_shared<storm::storage::sparse::StateStorage<StateType>>(generator.getStateSize())),
+      explorationMutex(nullptr),
       conditionStateExpression(conditionStateExpression),
       targetStateExpression(targetStateExpression) {
+    initializeStateToIdCallback(explorationInformation);
+}
+
+template<typename StateType, typename ValueType>
+StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program, StateGeneration<StateType, ValueType> const& other,
+                                                       ExplorationInformation<StateType, ValueType>& explorationInformation, std::mutex& explorationMutex)
+    : generator(program),
+      stateStorage(other.stateStorage),
+      explorationMutex(&explorationMutex),
+      conditionStateExpression(other.conditionStateExpression),
+      targetStateExpression(other.targetStateExpression) {
+    initializeStateToIdCallback(explorationInformation);
+}
+
+template<typename StateType, typename ValueType>
+void StateGeneration<StateType, ValueType>::initializeStateToIdCallback(ExplorationInformation<StateType, ValueType>& explorationInformation) {
     stateToIdCallback = [&explorationInformation, this](storm::generator::CompressedState const& state) -> StateType {
-        StateType newIndex = stateStorage.getNumberOfStates();
+        std::unique_lock<std::mutex> lock;
+        if (explorationMutex) {
+            lock = std::unique_lock<std::mutex>(*explorationMutex);
+        }
+        StateType newIndex = stateStorage->getNumberOfStates();
 
         // Check, if the state was already registered.
-        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage->stateToId.findOrAddAndGetBucket(state, newIndex);
 
         if (actualIndexBucketPair.first == newIndex) {
             explorationInformation.addUnexploredState(newIndex, state);
@@ -37,7 +58,7 @@ void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedSta
 
 template<typename StateType, typename ValueType>
 std::vector<StateType> StateGeneration<StateType, ValueType>::getInitialStates() {
-    return stateStorage.initialStateIndices;
+    return stateStorage->initialStateIndices;
 }
 
 template<typename StateType, typename ValueType>
@@ -57,17 +78,17 @@ bool StateGeneration<StateType, ValueType>::isTargetState() const {
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::computeInitialStates() {
-    stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+    stateStorage->initialStateIndices = generator.getInitialStates(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 StateType StateGeneration<StateType, ValueType>::getFirstInitialState() const {
-    return stateStorage.initialStateIndices.front();
+    return stateStorage->initialStateIndices.front();
 }
 
 template<typename StateType, typename ValueType>
 std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() const {
-    return stateStorage.initialStateIndices.size();
+    return stateStorage->initialStateIndices.size();
 }
 
 template class StateGeneration<uint32_t, double>;
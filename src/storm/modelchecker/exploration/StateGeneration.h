@@ -1,6 +1,9 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+#include <mutex>
+
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 
@@ -24,6 +27,15 @@ class StateGeneration {
     StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
                     storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
 
+    /*!
+     * Creates a state generation that uses its own generator (so that states can be expanded concurrently) but shares the state
+     * storage and the condition and target expressions with the given state generation. Newly discovered states are registered in the
+     * given exploration information while holding the given mutex. Hence, states may only be expanded while the mutex is not held by
+     * the calling thread.
+     */
+    StateGeneration(storm::prism::Program const& program, StateGeneration<StateType, ValueType> const& other,
+                    ExplorationInformation<StateType, ValueType>& explorationInformation, std::mutex& explorationMutex);
+
     void load(storm::generator::CompressedState const& state);
 
     std::vector<StateType> getInitialStates();
@@ -41,10 +53,15 @@ class StateGeneration {
     bool isTargetState() const;
 
    private:
+    void initializeStateToIdCallback(ExplorationInformation<StateType, ValueType>& explorationInformation);
+
     storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
+
+    // If set, this mutex is held while registering newly discovered states.
+    std::mutex* explorationMutex;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
@@ -20,6 +20,18 @@ class SparseDeterministicStepBoundedHorizonHelper {
                                    storm::storage::BitVector const& psiStates, uint64_t lowerBound, uint64_t upperBound,
                                    ModelCheckerHint const& hint = ModelCheckerHint());
 
+    /*!
+     * Computes the probabilities of phi U<=k psi for each of the given upper step bounds k. The step-bounded iteration is performed only once
+     * (up to the largest bound) and the values are recorded whenever a requested bound is reached.
+     *
+     * @return The result vectors in the order of the given upper bounds.
+     */
+    std::vector<std::vector<ValueType>> computeForUpperBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                              std::vector<uint64_t> const& upperBounds);
+
    private:
 };
 
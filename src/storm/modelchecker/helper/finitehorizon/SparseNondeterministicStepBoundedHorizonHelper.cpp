@@ -1,9 +1,14 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
+
+#include <algorithm>
+#include <numeric>
+
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -82,6 +87,57 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
     return result;
 }
 
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseNondeterministicStepBoundedHorizonHelper<ValueType>::computeForUpperBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<uint64_t> const& upperBounds) {
+    std::vector<ValueType> initialResult(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+    std::vector<std::vector<ValueType>> results(upperBounds.size(), initialResult);
+    uint64_t maximalBound = upperBounds.empty() ? 0 : *std::max_element(upperBounds.begin(), upperBounds.end());
+
+    // The states that can reach the target states within the largest bound are the maybe states for all bounds.
+    storm::storage::BitVector maybeStates;
+    if (goal.minimize()) {
+        maybeStates = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates,
+                                                                  psiStates, true, maximalBound);
+    } else {
+        maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, maximalBound);
+    }
+    maybeStates &= ~psiStates;
+    STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
+
+    if (!maybeStates.empty()) {
+        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
+        std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, psiStates);
+        std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+
+        // Process the bounds in ascending order, such that each multiplication is performed only once.
+        std::vector<uint64_t> order(upperBounds.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&upperBounds](uint64_t first, uint64_t second) { return upperBounds[first] < upperBounds[second]; });
+
+        storm::utility::ProgressMeasurement progress("multiplications");
+        progress.setMaxCount(maximalBound);
+        progress.startNewMeasurement(0);
+        uint64_t step = 0;
+        for (auto boundIndex : order) {
+            for (; step < upperBounds[boundIndex] && !storm::utility::resources::isTerminate(); ++step) {
+                progress.updateProgress(step);
+                multiplier->multiplyAndReduce(env, goal.direction(), subresult, &b, subresult);
+            }
+            storm::utility::vector::setVectorValues(results[boundIndex], maybeStates, subresult);
+            if (step < upperBounds[boundIndex]) {
+                STORM_LOG_WARN("Aborting after " << step << " of " << maximalBound << " multiplications.");
+                break;
+            }
+        }
+    }
+    return results;
+}
+
 template class SparseNondeterministicStepBoundedHorizonHelper<double>;
 template class SparseNondeterministicStepBoundedHorizonHelper<storm::RationalNumber>;
 }  // namespace helper
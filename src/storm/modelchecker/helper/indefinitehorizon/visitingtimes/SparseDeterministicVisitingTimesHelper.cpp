@@ -1,6 +1,8 @@
 #include "SparseDeterministicVisitingTimesHelper.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -11,6 +13,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -80,70 +83,146 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
 
 template<typename ValueType>
 void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues) {
-    STORM_LOG_ASSERT(stateValues.size() == _transitionMatrix.getRowCount(), "Dimension missmatch.");
+    computeExpectedVisitingTimes(env, stateValues, 1);
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues,
+                                                                                     uint64_t numberOfDistributions) {
+    STORM_LOG_ASSERT(stateValues.size() == _transitionMatrix.getRowCount() * numberOfDistributions, "Dimension missmatch.");
     createBackwardTransitions();
     createDecomposition(env);
     auto sccEnv = getEnvironmentForSccSolver(env);
 
-    // Create auxiliary data and lambdas
-    storm::storage::BitVector sccAsBitVector(stateValues.size(), false);
-    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
-    auto isExitState = [this, &isLeavingTransition](uint64_t state) {
-        auto row = this->_transitionMatrix.getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransition);
-    };
-    auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
-        return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
-    };
-    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
-        if (!storm::utility::isZero(stateValues[state])) {
-            return true;
-        }
-        auto row = this->_backwardTransitions->getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
-    };
-
     // We solve each SCC individually in *forward* topological order
     storm::utility::ProgressMeasurement progress("sccs");
     progress.setMaxCount(_sccDecomposition->size());
     progress.startNewMeasurement(0);
-    uint64_t sccIndex = 0;
-    auto sccItEnd = std::make_reverse_iterator(_sccDecomposition->begin());
-    for (auto sccIt = std::make_reverse_iterator(_sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
-        auto const& scc = *sccIt;
-        if (scc.size() == 1) {
-            processSingletonScc(*scc.begin(), stateValues);
-        } else {
-            sccAsBitVector.set(scc.begin(), scc.end(), true);
-            if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isExitState)) {
-                // This is not a BSCC
-                auto sccResult = computeValueForNonTrivialScc(sccEnv, sccAsBitVector, stateValues);
-                storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
-            } else {
-                // This is a BSCC
-                if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                } else {
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
-                }
+    uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
+    if (numberOfThreads <= 1) {
+        storm::storage::BitVector sccAsBitVector(_transitionMatrix.getRowCount(), false);
+        uint64_t sccIndex = 0;
+        auto sccItEnd = std::make_reverse_iterator(_sccDecomposition->begin());
+        for (auto sccIt = std::make_reverse_iterator(_sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
+            processScc(sccEnv, *sccIt, sccAsBitVector, stateValues, numberOfDistributions);
+            ++sccIndex;
+            progress.updateProgress(sccIndex);
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << _sccDecomposition->size() << " SCCs.");
+                break;
             }
-            sccAsBitVector.clear();
-        }
-        ++sccIndex;
-        progress.updateProgress(sccIndex);
-        if (storm::utility::resources::isTerminate()) {
-            STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->_computedSccDecomposition->size() << " SCCs.");
-            break;
         }
+    } else {
+        // An SCC can be processed as soon as all SCCs with a transition into it are processed, so independent SCCs are processed in parallel.
+        std::vector<uint64_t> successorStarts, successors;
+        computeSccGraph(successorStarts, successors);
+        std::vector<storm::storage::BitVector> sccsAsBitVectors(numberOfThreads, storm::storage::BitVector(_transitionMatrix.getRowCount(), false));
+        std::atomic<uint64_t> processedSccs(0);
+        std::atomic<bool> aborted(false);
+        storm::utility::parallel::forEachInDag(numberOfThreads, successorStarts, successors, [&](uint64_t threadIndex, uint64_t sccIndex) {
+            if (aborted) {
+                return;
+            }
+            processScc(sccEnv, _sccDecomposition->getBlock(sccIndex), sccsAsBitVectors[threadIndex], stateValues, numberOfDistributions);
+            uint64_t const numberOfProcessedSccs = ++processedSccs;
+            if (threadIndex == 0) {
+                // Only the calling thread reports the progress.
+                progress.updateProgress(numberOfProcessedSccs);
+            }
+            if (storm::utility::resources::isTerminate() && !aborted.exchange(true)) {
+                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << numberOfProcessedSccs << "/" << _sccDecomposition->size()
+                                                                                      << " SCCs.");
+            }
+        });
     }
 
     if (isContinuousTime()) {
         // Divide with the exit rates
         // Since storm::utility::infinity<storm::RationalNumber>() is just set to some big number, we have to treat the infinity-case explicitly.
-        storm::utility::vector::applyPointwise(stateValues, *_exitRates, stateValues, [](ValueType const& xi, ValueType const& yi) -> ValueType {
-            return storm::utility::isInfinity(xi) ? xi : xi / yi;
-        });
+        for (uint64_t state = 0; state < _transitionMatrix.getRowCount(); ++state) {
+            for (uint64_t lane = 0; lane < numberOfDistributions; ++lane) {
+                ValueType& value = stateValues[state * numberOfDistributions + lane];
+                if (!storm::utility::isInfinity(value)) {
+                    value /= (*_exitRates)[state];
+                }
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeSccGraph(std::vector<uint64_t>& successorStarts, std::vector<uint64_t>& successors) const {
+    std::vector<uint64_t> stateToScc(_transitionMatrix.getRowCount());
+    for (uint64_t sccIndex = 0; sccIndex < _sccDecomposition->size(); ++sccIndex) {
+        for (auto state : _sccDecomposition->getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+    // Marks the SCCs that were already added as successors of the current SCC.
+    std::vector<uint64_t> lastPredecessor(_sccDecomposition->size(), std::numeric_limits<uint64_t>::max());
+    successorStarts.clear();
+    successors.clear();
+    for (uint64_t sccIndex = 0; sccIndex < _sccDecomposition->size(); ++sccIndex) {
+        successorStarts.push_back(successors.size());
+        for (auto state : _sccDecomposition->getBlock(sccIndex)) {
+            for (auto const& entry : _transitionMatrix.getRow(state)) {
+                uint64_t const successorScc = stateToScc[entry.getColumn()];
+                if (successorScc != sccIndex && lastPredecessor[successorScc] != sccIndex) {
+                    lastPredecessor[successorScc] = sccIndex;
+                    successors.push_back(successorScc);
+                }
+            }
+        }
+    }
+    successorStarts.push_back(successors.size());
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processScc(storm::Environment const& sccEnv, storm::storage::StronglyConnectedComponent const& scc,
+                                                                   storm::storage::BitVector& sccAsBitVector, std::vector<ValueType>& stateValues,
+                                                                   uint64_t numberOfDistributions) const {
+    if (scc.size() == 1) {
+        processSingletonScc(*scc.begin(), stateValues, numberOfDistributions);
+        return;
+    }
+
+    // Create auxiliary data and lambdas
+    sccAsBitVector.set(scc.begin(), scc.end(), true);
+    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
+    auto isExitState = [this, &isLeavingTransition](uint64_t state) {
+        auto row = this->_transitionMatrix.getRow(state);
+        return std::any_of(row.begin(), row.end(), isLeavingTransition);
+    };
+
+    if (std::any_of(scc.begin(), scc.end(), isExitState)) {
+        // This is not a BSCC
+        auto sccResult = computeValueForNonTrivialScc(sccEnv, sccAsBitVector, stateValues, numberOfDistributions);
+        auto resultIt = sccResult.begin();
+        for (auto state : sccAsBitVector) {
+            std::copy_n(resultIt, numberOfDistributions, stateValues.begin() + state * numberOfDistributions);
+            resultIt += numberOfDistributions;
+        }
+    } else {
+        // This is a BSCC. Its states are visited infinitely often iff the BSCC is reached with positive probability.
+        for (uint64_t lane = 0; lane < numberOfDistributions; ++lane) {
+            auto isLeavingTransitionWithNonZeroValue = [&](auto const& e) {
+                return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn() * numberOfDistributions + lane]);
+            };
+            auto isReachableInState = [&](uint64_t state) {
+                if (!storm::utility::isZero(stateValues[state * numberOfDistributions + lane])) {
+                    return true;
+                }
+                auto row = this->_backwardTransitions->getRow(state);
+                return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
+            };
+            ValueType const value =
+                std::any_of(scc.begin(), scc.end(), isReachableInState) ? storm::utility::infinity<ValueType>() : storm::utility::zero<ValueType>();
+            for (auto state : scc) {
+                stateValues[state * numberOfDistributions + lane] = value;
+            }
+        }
     }
+    sccAsBitVector.set(scc.begin(), scc.end(), false);
 }
 
 template<typename ValueType>
@@ -196,16 +275,20 @@ storm::Environment SparseDeterministicVisitingTimesHelper<ValueType>::getEnviron
 }
 
 template<typename ValueType>
-void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const {
-    auto& stateVal = stateValues[sccState];
+void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues,
+                                                                            uint64_t numberOfDistributions) const {
+    auto stateVals = stateValues.begin() + sccState * numberOfDistributions;
     auto forwardRow = _transitionMatrix.getRow(sccState);
     auto backwardRow = _backwardTransitions->getRow(sccState);
     if (forwardRow.getNumberOfEntries() == 1 && forwardRow.begin()->getColumn() == sccState) {
         // This is a BSCC. We only have to check if there is some non-zero "input"
-        if (!storm::utility::isZero(stateVal) || std::any_of(backwardRow.begin(), backwardRow.end(),
-                                                             [&stateValues](auto const& e) { return !storm::utility::isZero(stateValues[e.getColumn()]); })) {
-            stateVal = storm::utility::infinity<ValueType>();
-        }  // else stateVal = 0 (already implied by !(if-condition))
+        for (uint64_t lane = 0; lane < numberOfDistributions; ++lane) {
+            if (!storm::utility::isZero(stateVals[lane]) || std::any_of(backwardRow.begin(), backwardRow.end(), [&](auto const& e) {
+                    return !storm::utility::isZero(stateValues[e.getColumn() * numberOfDistributions + lane]);
+                })) {
+                stateVals[lane] = storm::utility::infinity<ValueType>();
+            }  // else stateVal = 0 (already implied by !(if-condition))
+        }
     } else {
         // This is not a BSCC. Compute the state value
         ValueType divisor = storm::utility::one<ValueType>();
@@ -214,17 +297,23 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint
                 STORM_LOG_ASSERT(!storm::utility::isOne(entry.getValue()), "found a self-loop state. This is not expected");
                 divisor -= entry.getValue();
             } else {
-                stateVal += entry.getValue() * stateValues[entry.getColumn()];
+                auto predecessorVals = stateValues.begin() + entry.getColumn() * numberOfDistributions;
+                for (uint64_t lane = 0; lane < numberOfDistributions; ++lane) {
+                    stateVals[lane] += entry.getValue() * predecessorVals[lane];
+                }
             }
         }
-        stateVal /= divisor;
+        for (uint64_t lane = 0; lane < numberOfDistributions; ++lane) {
+            stateVals[lane] /= divisor;
+        }
     }
 }
 
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::computeValueForNonTrivialScc(storm::Environment const& env,
                                                                                                        storm::storage::BitVector const& sccAsBitVector,
-                                                                                                       std::vector<ValueType> const& stateValues) const {
+                                                                                                       std::vector<ValueType> const& stateValues,
+                                                                                                       uint64_t numberOfDistributions) const {
     // Here we assume that the SCC is not a BSCC
     // Let P be the SCC matrix. We solve the equation system
     //       x * P + b = x
@@ -244,16 +333,20 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
         sccMatrix.convertToEquationSystem();
     }
 
-    // Get the vector for the equation system
-    auto sccVector = storm::utility::vector::filterVector(stateValues, sccAsBitVector);
-    auto valIt = sccVector.begin();
+    // Get the (interleaved) vectors for the equation systems
+    std::vector<ValueType> sccVector;
+    sccVector.reserve(sccAsBitVector.getNumberOfSetBits() * numberOfDistributions);
     for (auto sccState : sccAsBitVector) {
+        auto valIt = sccVector.insert(sccVector.end(), stateValues.begin() + sccState * numberOfDistributions,
+                                      stateValues.begin() + (sccState + 1) * numberOfDistributions);
         for (auto const& entry : _backwardTransitions->getRow(sccState)) {
             if (!sccAsBitVector.get(entry.getColumn())) {
-                (*valIt) += entry.getValue() * stateValues[entry.getColumn()];
+                auto predecessorVals = stateValues.begin() + entry.getColumn() * numberOfDistributions;
+                for (uint64_t lane = 0; lane < numberOfDistributions; ++lane) {
+                    valIt[lane] += entry.getValue() * predecessorVals[lane];
+                }
             }
         }
-        ++valIt;
     }
 
     // Get the solver object and satisfy requirements
@@ -266,7 +359,7 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     std::vector<ValueType> eqSysValues(sccVector.size());
-    solver->solveEquations(env, eqSysValues, sccVector);
+    solver->solveEquations(env, eqSysValues, sccVector, numberOfDistributions);
     return eqSysValues;
 }
 
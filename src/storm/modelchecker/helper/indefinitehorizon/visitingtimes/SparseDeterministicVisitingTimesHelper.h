@@ -83,6 +83,15 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     void computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues);
 
+    /*!
+     * Computes the expected visiting times for several initial distributions at once. The equation systems of the SCCs are solved for all
+     * distributions together.
+     * @pre parameter stateValues contains at position i * numberOfDistributions + j the initial value (probability) of state i in the j-th
+     * distribution.
+     * @post parameter stateValues contains the desired values (in the same layout)
+     */
+    void computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues, uint64_t numberOfDistributions);
+
    private:
     /*!
      * @return true iff this is a computation on a continuous time model (i.e. CTMC, MA)
@@ -104,17 +113,30 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     storm::Environment getEnvironmentForSccSolver(storm::Environment const& env) const;
 
+    /*!
+     * Computes the graph of the SCC decomposition, i.e., the successors of SCC i are the SCCs that are reachable from SCC i in one step. They
+     * are given by successors[successorStarts[i]], ..., successors[successorStarts[i + 1] - 1].
+     */
+    void computeSccGraph(std::vector<uint64_t>& successorStarts, std::vector<uint64_t>& successors) const;
+
+    /*!
+     * Computes the values of the states of the given SCC, assuming that the values of all states with a transition into the SCC are final.
+     * @param sccAsBitVector An auxiliary bit vector over all states in which no bit is set (before and after the call).
+     */
+    void processScc(storm::Environment const& sccEnv, storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccAsBitVector,
+                    std::vector<ValueType>& stateValues, uint64_t numberOfDistributions) const;
+
     /*!
      * Processes (bottom or non-bottom SCCs consisting of a single state). The resulting value is directly inserted into stateValues
      */
-    void processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const;
+    void processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues, uint64_t numberOfDistributions) const;
 
     /*!
      * Solves the equation system for non-trivial SCCs (i.e. non-bottom SCCs with more than 1 state).
-     * @return for each state of the given SCC the expected number of times that state is visited.
+     * @return for each state of the given SCC (and each distribution) the expected number of times that state is visited.
      */
     std::vector<ValueType> computeValueForNonTrivialScc(storm::Environment const& env, storm::storage::BitVector const& sccAsBitVector,
-                                                        std::vector<ValueType> const& stateValues) const;
+                                                        std::vector<ValueType> const& stateValues, uint64_t numberOfDistributions) const;
 
     storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
     std::vector<ValueType> const* _exitRates;
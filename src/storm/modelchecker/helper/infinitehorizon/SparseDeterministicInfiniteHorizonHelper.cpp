@@ -2,6 +2,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
+#include "storm/modelchecker/helper/infinitehorizon/internal/AggregationDisaggregationHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -80,7 +81,7 @@ ValueType SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForComp
     STORM_LOG_TRACE("Computing LRA for BSCC of size " << component.size() << " using '" << storm::solver::toString(method) << "'.");
     if (method == storm::solver::LraMethod::ValueIteration) {
         return computeLraForBsccVi(env, stateValueGetter, actionValueGetter, component);
-    } else if (method == storm::solver::LraMethod::LraDistributionEquations) {
+    } else if (method == storm::solver::LraMethod::LraDistributionEquations || method == storm::solver::LraMethod::AggregationDisaggregation) {
         // We only need the first element of the pair as the lra distribution is not relevant at this point.
         return computeLraForBsccSteadyStateDistr(env, stateValueGetter, actionValueGetter, component).first;
     }
@@ -258,6 +259,18 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
         return {storm::utility::one<ValueType>()};
     }
 
+    if (env.solver().lra().getDetLraMethod() == storm::solver::LraMethod::AggregationDisaggregation) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            STORM_LOG_WARN_COND(!env.solver().isForceSoundness(),
+                                "Sound computations are not properly implemented for this computation. You might get incorrect results.");
+            internal::AggregationDisaggregationHelper<ValueType> iadHelper(bscc, this->_transitionMatrix, this->_exitRates);
+            return iadHelper.computeSteadyStateDistribution(env);
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                            "The aggregation-disaggregation method for LRA computations is only supported for floating point numbers.");
+        }
+    }
+
     // Prepare an environment for the underlying linear equation solver
     auto subEnv = env;
     if (subEnv.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological) {
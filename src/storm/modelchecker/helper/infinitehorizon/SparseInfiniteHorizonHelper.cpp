@@ -1,5 +1,9 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -18,11 +22,13 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/UnmetRequirementException.h"
 
@@ -30,6 +36,11 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+// The maximal number of states of the components that are batched into a single task if the components are treated concurrently.
+uint64_t const MaximalNumberOfStatesPerTask = 1024;
+}  // namespace
+
 template<typename ValueType, bool Nondeterministic>
 SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::SparseInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
     : _transitionMatrix(transitionMatrix),
@@ -169,11 +180,17 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+    uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
+    if (numberOfThreads > 1 && _longRunComponentDecomposition->size() > 1 && supportsConcurrentComponentComputations(underlyingSolverEnvironment)) {
+        computeLraForComponentsConcurrently(underlyingSolverEnvironment, numberOfThreads, stateRewardsGetter, actionRewardsGetter, componentLraValues,
+                                            progress);
+    } else {
+        for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+            componentLraValues[componentIndex] = computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter,
+                                                                        (*_longRunComponentDecomposition)[componentIndex]);
+            progress.updateProgress(componentIndex + 1);
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -181,6 +198,60 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
 }
 
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::supportsConcurrentComponentComputations(Environment const&) const {
+    // Exact (and in particular parametric) numbers are not guaranteed to be thread-safe.
+    return std::is_same_v<ValueType, double>;
+}
+
+template<typename ValueType, bool Nondeterministic>
+void SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLraForComponentsConcurrently(Environment const& env, uint64_t numberOfThreads,
+                                                                                                   ValueGetter const& stateValuesGetter,
+                                                                                                   ValueGetter const& actionValuesGetter,
+                                                                                                   std::vector<ValueType>& componentLraValues,
+                                                                                                   storm::utility::ProgressMeasurement& progress) {
+    // Components are processed from the largest to the smallest one so that a large component does not delay the end of the computation when
+    // it is started last. Consecutive small components are batched into a single task to keep the scheduling overhead low when there are many.
+    uint64_t const numberOfComponents = _longRunComponentDecomposition->size();
+    std::vector<uint64_t> componentOrder(numberOfComponents);
+    std::iota(componentOrder.begin(), componentOrder.end(), 0);
+    std::stable_sort(componentOrder.begin(), componentOrder.end(), [this](uint64_t first, uint64_t second) {
+        return (*_longRunComponentDecomposition)[first].size() > (*_longRunComponentDecomposition)[second].size();
+    });
+    std::vector<uint64_t> taskStarts;
+    uint64_t statesInTask = 0;
+    for (uint64_t position = 0; position < numberOfComponents; ++position) {
+        uint64_t const componentSize = (*_longRunComponentDecomposition)[componentOrder[position]].size();
+        if (taskStarts.empty() || statesInTask + componentSize > MaximalNumberOfStatesPerTask) {
+            taskStarts.push_back(position);
+            statesInTask = 0;
+        }
+        statesInTask += componentSize;
+    }
+    taskStarts.push_back(numberOfComponents);
+    STORM_LOG_INFO("Computing the long run average values of " << numberOfComponents << " components in " << (taskStarts.size() - 1) << " tasks with "
+                                                                << numberOfThreads << " threads.");
+
+    // The solvers within a component run single-threaded as the components themselves are treated concurrently.
+    Environment componentEnvironment = env;
+    componentEnvironment.solver().setNumberOfThreads(1);
+    std::atomic<uint64_t> numberOfFinishedComponents(0);
+    storm::utility::parallel::forEachChunk(numberOfThreads, taskStarts.size() - 1, 1, [&](uint64_t threadIndex, uint64_t firstTask, uint64_t endTask) {
+        for (uint64_t task = firstTask; task < endTask; ++task) {
+            for (uint64_t position = taskStarts[task]; position < taskStarts[task + 1]; ++position) {
+                uint64_t const componentIndex = componentOrder[position];
+                componentLraValues[componentIndex] =
+                    computeLraForComponent(componentEnvironment, stateValuesGetter, actionValuesGetter, (*_longRunComponentDecomposition)[componentIndex]);
+            }
+            numberOfFinishedComponents += taskStarts[task + 1] - taskStarts[task];
+        }
+        if (threadIndex == 0) {
+            progress.updateProgress(numberOfFinishedComponents.load());
+        }
+    });
+    progress.updateProgress(numberOfComponents);
+}
+
 template<typename ValueType, bool Nondeterministic>
 bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isContinuousTime() const {
     STORM_LOG_ASSERT((_markovianStates == nullptr) || (_exitRates != nullptr), "Inconsistent information given: Have Markovian states but no exit rates.");
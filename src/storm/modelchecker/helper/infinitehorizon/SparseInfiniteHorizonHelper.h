@@ -16,6 +16,10 @@ class StandardRewardModel;
 }
 }  // namespace models
 
+namespace utility {
+class ProgressMeasurement;
+}
+
 namespace modelchecker {
 namespace helper {
 
@@ -123,6 +127,19 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff the LRA values of different components may be computed concurrently (with the given environment).
+     */
+    virtual bool supportsConcurrentComponentComputations(Environment const& env) const;
+
+    /*!
+     * Computes the LRA values of all components with the given number of threads.
+     * @param componentLraValues the LRA value of each component (with respect to the decomposition). Has to be of the correct size.
+     */
+    void computeLraForComponentsConcurrently(Environment const& env, uint64_t numberOfThreads, ValueGetter const& stateValuesGetter,
+                                             ValueGetter const& actionValuesGetter, std::vector<ValueType>& componentLraValues,
+                                             storm::utility::ProgressMeasurement& progress);
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
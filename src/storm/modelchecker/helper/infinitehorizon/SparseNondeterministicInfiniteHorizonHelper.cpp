@@ -95,6 +95,20 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
+    storm::solver::LraMethod method = getLraMethod(env);
+    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
+                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
+    if (method == storm::solver::LraMethod::LinearProgramming) {
+        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else if (method == storm::solver::LraMethod::ValueIteration) {
+        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
+    }
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getLraMethod(Environment const& env) const {
     storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
         method != storm::solver::LraMethod::LinearProgramming) {
@@ -108,15 +122,14 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
             "specify a different LRA method.");
         method = storm::solver::LraMethod::ValueIteration;
     }
-    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
-                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
-    if (method == storm::solver::LraMethod::LinearProgramming) {
-        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else if (method == storm::solver::LraMethod::ValueIteration) {
-        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else {
-        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
-    }
+    return method;
+}
+
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::supportsConcurrentComponentComputations(Environment const& env) const {
+    // The LP solvers are not guaranteed to be thread-safe, so MECs are only treated concurrently if their LRA is computed with value iteration.
+    return SparseInfiniteHorizonHelper<ValueType, true>::supportsConcurrentComponentComputations(env) &&
+           getLraMethod(env) == storm::solver::LraMethod::ValueIteration;
 }
 
 template<typename ValueType>
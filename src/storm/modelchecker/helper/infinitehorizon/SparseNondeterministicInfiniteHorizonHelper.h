@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -65,6 +66,13 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    virtual bool supportsConcurrentComponentComputations(Environment const& env) const override;
+
+    /*!
+     * @return the method that is used to compute the LRA of a nontrivial MEC, taking the requirements of exact and sound computations into account.
+     */
+    storm::solver::LraMethod getLraMethod(Environment const& env) const;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
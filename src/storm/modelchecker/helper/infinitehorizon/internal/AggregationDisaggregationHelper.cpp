@@ -0,0 +1,288 @@
+#include "storm/modelchecker/helper/infinitehorizon/internal/AggregationDisaggregationHelper.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponent.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+namespace {
+// The maximal number of Gauss-Seidel sweeps over a single block (or the aggregated chain) in one iteration.
+uint64_t const MaximalNumberOfSweeps = 10;
+
+template<typename ValueType>
+bool isConverged(ValueType const& oldValue, ValueType const& newValue, ValueType const& precision, bool relative) {
+    ValueType difference = storm::utility::abs<ValueType>(newValue - oldValue);
+    if (relative && !storm::utility::isZero(newValue)) {
+        difference /= newValue;
+    }
+    return difference <= precision;
+}
+
+template<typename ValueType>
+void normalize(std::vector<ValueType>& distribution) {
+    ValueType const sum = std::accumulate(distribution.begin(), distribution.end(), storm::utility::zero<ValueType>());
+    for (auto& value : distribution) {
+        value /= sum;
+    }
+}
+
+uint64_t findRoot(std::vector<uint64_t>& parents, uint64_t state) {
+    while (parents[state] != state) {
+        parents[state] = parents[parents[state]];
+        state = parents[state];
+    }
+    return state;
+}
+}  // namespace
+
+template<typename ValueType>
+AggregationDisaggregationHelper<ValueType>::AggregationDisaggregationHelper(storm::storage::StronglyConnectedComponent const& bscc,
+                                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                            std::vector<ValueType> const* exitRates) {
+    STORM_LOG_ASSERT(bscc.size() > 1, "Expected a BSCC with more than one state.");
+    STORM_LOG_ASSERT(std::is_sorted(bscc.begin(), bscc.end()), "Expected that bsccs are sorted.");
+    uint64_t const numberOfStates = bscc.size();
+    std::vector<uint64_t> toLocalIndex(transitionMatrix.getRowGroupCount(), 0);
+    uint64_t localIndex = 0;
+    for (auto state : bscc) {
+        toLocalIndex[state] = localIndex++;
+    }
+
+    // Count the incoming transitions of each state and compute the rates with which the states are left.
+    this->exitRates.reserve(numberOfStates);
+    outgoingRates.assign(numberOfStates, storm::utility::zero<ValueType>());
+    incomingStarts.assign(numberOfStates + 1, 0);
+    localIndex = 0;
+    for (auto state : bscc) {
+        this->exitRates.push_back(exitRates ? (*exitRates)[state] : storm::utility::one<ValueType>());
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            if (entry.getColumn() != state && !storm::utility::isZero(entry.getValue())) {
+                STORM_LOG_ASSERT(bscc.containsState(entry.getColumn()), "The given component is not a bottom component.");
+                outgoingRates[localIndex] += this->exitRates.back() * entry.getValue();
+                ++incomingStarts[toLocalIndex[entry.getColumn()] + 1];
+            }
+        }
+        ++localIndex;
+    }
+    std::partial_sum(incomingStarts.begin(), incomingStarts.end(), incomingStarts.begin());
+
+    // Fill the transposed generator.
+    incomingStates.resize(incomingStarts.back());
+    incomingRates.resize(incomingStarts.back());
+    std::vector<uint64_t> nextPositions(incomingStarts.begin(), incomingStarts.end() - 1);
+    localIndex = 0;
+    for (auto state : bscc) {
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            if (entry.getColumn() != state && !storm::utility::isZero(entry.getValue())) {
+                uint64_t& position = nextPositions[toLocalIndex[entry.getColumn()]];
+                incomingStates[position] = localIndex;
+                incomingRates[position] = this->exitRates[localIndex] * entry.getValue();
+                ++position;
+            }
+        }
+        ++localIndex;
+    }
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::computeBlocks(ValueType const& threshold) {
+    uint64_t const numberOfStates = outgoingRates.size();
+    std::vector<uint64_t> parents(numberOfStates);
+    std::iota(parents.begin(), parents.end(), 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (uint64_t position = incomingStarts[state]; position < incomingStarts[state + 1]; ++position) {
+            uint64_t const source = incomingStates[position];
+            // The probability of the transition is its rate divided by the exit rate of its source.
+            if (incomingRates[position] >= threshold * exitRates[source]) {
+                uint64_t const firstRoot = findRoot(parents, source);
+                uint64_t const secondRoot = findRoot(parents, state);
+                if (firstRoot != secondRoot) {
+                    parents[std::max(firstRoot, secondRoot)] = std::min(firstRoot, secondRoot);
+                }
+            }
+        }
+    }
+
+    // Number the blocks in the order of their smallest state and sort the states by their block.
+    blockOfState.assign(numberOfStates, 0);
+    std::vector<uint64_t> blockOfRoot(numberOfStates, 0);
+    uint64_t numberOfBlocks = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t const root = findRoot(parents, state);
+        if (root == state) {
+            blockOfRoot[root] = numberOfBlocks++;
+        }
+        blockOfState[state] = blockOfRoot[root];
+    }
+    blockStarts.assign(numberOfBlocks + 1, 0);
+    for (auto block : blockOfState) {
+        ++blockStarts[block + 1];
+    }
+    std::partial_sum(blockStarts.begin(), blockStarts.end(), blockStarts.begin());
+    blockStates.resize(numberOfStates);
+    std::vector<uint64_t> nextPositions(blockStarts.begin(), blockStarts.end() - 1);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        blockStates[nextPositions[blockOfState[state]]++] = state;
+    }
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::aggregateAndDisaggregate(std::vector<ValueType>& distribution, ValueType const& precision, bool relative,
+                                                                          uint64_t maximalNumberOfSweeps) {
+    uint64_t const numberOfBlocks = blockStarts.size() - 1;
+    std::vector<ValueType> blockProbabilities(numberOfBlocks, storm::utility::zero<ValueType>());
+    for (uint64_t state = 0; state < distribution.size(); ++state) {
+        blockProbabilities[blockOfState[state]] += distribution[state];
+    }
+
+    // Build the (transposed) generator of the aggregated chain, weighting the states of a block with their conditional probability.
+    std::vector<uint64_t> aggregatedStarts(numberOfBlocks + 1, 0);
+    std::vector<uint64_t> aggregatedSources;
+    std::vector<ValueType> aggregatedRates;
+    std::vector<ValueType> aggregatedOutgoingRates(numberOfBlocks, storm::utility::zero<ValueType>());
+    std::vector<ValueType> accumulator(numberOfBlocks, storm::utility::zero<ValueType>());
+    std::vector<uint64_t> touchedBlocks;
+    std::vector<bool> isTouched(numberOfBlocks, false);
+    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+        for (uint64_t blockPosition = blockStarts[block]; blockPosition < blockStarts[block + 1]; ++blockPosition) {
+            uint64_t const state = blockStates[blockPosition];
+            for (uint64_t position = incomingStarts[state]; position < incomingStarts[state + 1]; ++position) {
+                uint64_t const source = incomingStates[position];
+                uint64_t const sourceBlock = blockOfState[source];
+                if (sourceBlock != block && !storm::utility::isZero(blockProbabilities[sourceBlock])) {
+                    if (!isTouched[sourceBlock]) {
+                        isTouched[sourceBlock] = true;
+                        touchedBlocks.push_back(sourceBlock);
+                    }
+                    accumulator[sourceBlock] += distribution[source] / blockProbabilities[sourceBlock] * incomingRates[position];
+                }
+            }
+        }
+        std::sort(touchedBlocks.begin(), touchedBlocks.end());
+        for (auto sourceBlock : touchedBlocks) {
+            aggregatedSources.push_back(sourceBlock);
+            aggregatedRates.push_back(accumulator[sourceBlock]);
+            aggregatedOutgoingRates[sourceBlock] += accumulator[sourceBlock];
+            accumulator[sourceBlock] = storm::utility::zero<ValueType>();
+            isTouched[sourceBlock] = false;
+        }
+        touchedBlocks.clear();
+        aggregatedStarts[block + 1] = aggregatedSources.size();
+    }
+
+    // Compute the steady state distribution of the aggregated chain with Gauss-Seidel, starting from the current block probabilities.
+    std::vector<ValueType> aggregatedDistribution = blockProbabilities;
+    for (uint64_t sweep = 0; sweep < maximalNumberOfSweeps; ++sweep) {
+        std::vector<ValueType> previousDistribution = aggregatedDistribution;
+        for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+            if (storm::utility::isZero(aggregatedOutgoingRates[block])) {
+                continue;
+            }
+            ValueType value = storm::utility::zero<ValueType>();
+            for (uint64_t position = aggregatedStarts[block]; position < aggregatedStarts[block + 1]; ++position) {
+                value += aggregatedDistribution[aggregatedSources[position]] * aggregatedRates[position];
+            }
+            aggregatedDistribution[block] = value / aggregatedOutgoingRates[block];
+        }
+        normalize(aggregatedDistribution);
+        bool converged = true;
+        for (uint64_t block = 0; converged && block < numberOfBlocks; ++block) {
+            converged = isConverged(previousDistribution[block], aggregatedDistribution[block], precision, relative);
+        }
+        if (converged) {
+            break;
+        }
+    }
+
+    // Disaggregate.
+    for (uint64_t state = 0; state < distribution.size(); ++state) {
+        uint64_t const block = blockOfState[state];
+        if (!storm::utility::isZero(blockProbabilities[block])) {
+            distribution[state] *= aggregatedDistribution[block] / blockProbabilities[block];
+        }
+    }
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::performBlockSweeps(std::vector<ValueType>& distribution, ValueType const& precision, bool relative) const {
+    uint64_t const numberOfBlocks = blockStarts.size() - 1;
+    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+        for (uint64_t sweep = 0; sweep < MaximalNumberOfSweeps; ++sweep) {
+            bool converged = true;
+            for (uint64_t blockPosition = blockStarts[block]; blockPosition < blockStarts[block + 1]; ++blockPosition) {
+                uint64_t const state = blockStates[blockPosition];
+                ValueType value = storm::utility::zero<ValueType>();
+                for (uint64_t position = incomingStarts[state]; position < incomingStarts[state + 1]; ++position) {
+                    value += distribution[incomingStates[position]] * incomingRates[position];
+                }
+                value /= outgoingRates[state];
+                if (converged) {
+                    converged = isConverged(distribution[state], value, precision, relative);
+                }
+                distribution[state] = std::move(value);
+            }
+            if (converged) {
+                break;
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> AggregationDisaggregationHelper<ValueType>::computeSteadyStateDistribution(Environment const& env) {
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().lra().getPrecision());
+    bool const relative = env.solver().lra().getRelativeTerminationCriterion();
+    uint64_t const maximalNumberOfIterations =
+        env.solver().lra().isMaximalIterationCountSet() ? env.solver().lra().getMaximalIterationCount() : std::numeric_limits<uint64_t>::max();
+
+    computeBlocks(storm::utility::convertNumber<ValueType>(env.solver().lra().getAggregationThreshold()));
+    uint64_t const numberOfStates = outgoingRates.size();
+    uint64_t const numberOfBlocks = blockStarts.size() - 1;
+    STORM_LOG_INFO("Computing the steady state distribution of a BSCC with " << numberOfStates << " states partitioned into " << numberOfBlocks
+                                                                               << " blocks using aggregation-disaggregation.");
+
+    std::vector<ValueType> distribution(numberOfStates, storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(numberOfStates));
+    std::vector<ValueType> previousDistribution;
+    uint64_t iteration = 0;
+    bool converged = false;
+    while (!converged && iteration < maximalNumberOfIterations) {
+        ++iteration;
+        previousDistribution = distribution;
+        if (numberOfBlocks > 1) {
+            aggregateAndDisaggregate(distribution, precision, relative, MaximalNumberOfSweeps * numberOfBlocks);
+        }
+        performBlockSweeps(distribution, precision, relative);
+        normalize(distribution);
+        converged = true;
+        for (uint64_t state = 0; converged && state < numberOfStates; ++state) {
+            converged = isConverged(previousDistribution[state], distribution[state], precision, relative);
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+    if (converged) {
+        STORM_LOG_INFO("Aggregation-disaggregation converged after " << iteration << " iterations.");
+    } else {
+        STORM_LOG_WARN("Aggregation-disaggregation did not converge after " << iteration << " iterations.");
+    }
+    return distribution;
+}
+
+template class AggregationDisaggregationHelper<double>;
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
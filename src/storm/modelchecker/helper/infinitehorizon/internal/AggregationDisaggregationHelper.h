@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+class StronglyConnectedComponent;
+}  // namespace storage
+
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+/*!
+ * Computes the steady state distribution of a BSCC with iterative aggregation-disaggregation (IAD), which converges quickly on nearly
+ * completely decomposable chains, i.e., chains whose states can be partitioned into blocks that are only weakly coupled with each other.
+ * On such chains, the power method and plain Gauss-Seidel iterations need many iterations as probability mass moves only slowly between
+ * the blocks.
+ *
+ * The blocks are the connected components of the graph that only contains the transitions whose probability is at least a given threshold.
+ * Each iteration
+ *  - aggregates the current distribution into a chain over the blocks and computes the steady state distribution of this (small) chain,
+ *  - disaggregates the result, i.e., scales the distribution within each block with the computed probability of the block, and
+ *  - performs Gauss-Seidel sweeps block by block (Takahashi's method).
+ *
+ * @see Stewart: Introduction to the Numerical Solution of Markov Chains, Chapter 6, Princeton University Press, 1994
+ */
+template<typename ValueType>
+class AggregationDisaggregationHelper {
+   public:
+    /*!
+     * Initializes the helper for the given BSCC.
+     * @param bscc The BSCC. Has to consist of more than one state.
+     * @param transitionMatrix The (probabilistic) transition matrix of the model.
+     * @param exitRates The exit rates of the states (for continuous time models). If nullptr, all rates are assumed to be one (discrete time).
+     */
+    AggregationDisaggregationHelper(storm::storage::StronglyConnectedComponent const& bscc, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                    std::vector<ValueType> const* exitRates = nullptr);
+
+    /*!
+     * Computes the steady state distribution with the precision, the aggregation threshold and the maximal number of iterations of the
+     * long run average environment.
+     * @return the probability of each state of the BSCC in the steady state (in the order of the states in the BSCC).
+     */
+    std::vector<ValueType> computeSteadyStateDistribution(Environment const& env);
+
+   private:
+    /*!
+     * Partitions the states into blocks of states that are connected by transitions whose probability is at least the given threshold.
+     */
+    void computeBlocks(ValueType const& threshold);
+
+    /*!
+     * Replaces the distribution within each block by the conditional distribution within the block, scaled with the steady state
+     * probability of the block in the aggregated chain.
+     */
+    void aggregateAndDisaggregate(std::vector<ValueType>& distribution, ValueType const& precision, bool relative, uint64_t maximalNumberOfSweeps);
+
+    /*!
+     * Performs Gauss-Seidel sweeps over the states of each block (until the block converged or the maximal number of sweeps is reached).
+     */
+    void performBlockSweeps(std::vector<ValueType>& distribution, ValueType const& precision, bool relative) const;
+
+    // The transposed generator of the BSCC (without diagonal): The rates of the transitions from incomingStates[k] to state j are
+    // incomingRates[k], for incomingStarts[j] <= k < incomingStarts[j + 1].
+    std::vector<uint64_t> incomingStarts;
+    std::vector<uint64_t> incomingStates;
+    std::vector<ValueType> incomingRates;
+    // The total rate with which each state is left (i.e. the negated diagonal of the generator).
+    std::vector<ValueType> outgoingRates;
+    // The exit rate of each state (one for discrete time models), used to obtain the probability of a transition from its rate.
+    std::vector<ValueType> exitRates;
+
+    // The states of block b are blockStates[blockStarts[b]], ..., blockStates[blockStarts[b + 1] - 1].
+    std::vector<uint64_t> blockOfState;
+    std::vector<uint64_t> blockStarts;
+    std::vector<uint64_t> blockStates;
+};
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
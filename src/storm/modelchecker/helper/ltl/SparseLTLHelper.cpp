@@ -4,8 +4,10 @@
 #include "storm/automata/LTL2DeterministicAutomaton.h"
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+#include "storm/logic/Formulas.h"
 
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -14,6 +16,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
@@ -21,6 +24,17 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+void getTranslationOptions(Environment const& env, boost::optional<std::string>& ltl2daTool, boost::optional<std::string>& cacheDirectory) {
+    if (env.modelchecker().isLtl2daToolSet()) {
+        ltl2daTool = env.modelchecker().getLtl2daTool();
+    }
+    if (env.modelchecker().isLtl2daCacheDirectorySet()) {
+        cacheDirectory = env.modelchecker().getLtl2daCacheDirectory();
+    }
+}
+}  // namespace
+
 template<typename ValueType, bool Nondeterministic>
 SparseLTLHelper<ValueType, Nondeterministic>::SparseLTLHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
     : _transitionMatrix(transitionMatrix) {
@@ -66,7 +80,8 @@ std::map<std::string, storm::storage::BitVector> SparseLTLHelper<ValueType, Nond
 }
 
 template<typename ValueType, bool Nondeterministic>
-storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(Environment const& env,
+                                                                                            automata::AcceptanceCondition const& acceptance,
                                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                             typename transformer::DAProduct<productModelType>::ptr product) {
@@ -86,39 +101,65 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
     std::size_t accMECs = 0;
     std::size_t allMECs = 0;
 
-    for (auto const& conjunction : dnf) {
-        // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
-        storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
-
-        for (auto const& literal : conjunction) {
-            if (literal->isTRUE()) {
-                // skip
-            } else if (literal->isFALSE()) {
-                allowed.clear();
-                break;
-            } else if (literal->isAtom()) {
-                const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
-                if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
-                    // only deal with FIN, ignore INF here
-                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
-                    if (atom.isNegated()) {
-                        // allowed = allowed \ ~accSet = allowed & accSet
-                        allowed &= accSet;
-                    } else {
-                        // allowed = allowed \ accSet = allowed & ~accSet
-                        allowed &= ~accSet;
+    // Every end component that satisfies a conjunction is contained in a MEC of the whole model. Hence, the end components for the conjunctions are only
+    // searched within these MECs (using only the choices that stay inside).
+    storm::storage::MaximalEndComponentDecomposition<ValueType> modelMecs(transitionMatrix, backwardTransitions);
+    storm::storage::BitVector mecStates(transitionMatrix.getRowGroupCount(), false);
+    storm::storage::BitVector mecChoices(transitionMatrix.getRowCount(), false);
+    for (auto const& mec : modelMecs) {
+        for (auto const& stateChoicesPair : mec) {
+            mecStates.set(stateChoicesPair.first);
+            for (auto choice : stateChoicesPair.second) {
+                mecChoices.set(choice);
+            }
+        }
+    }
+
+    // The MEC decompositions for the conjunctions are independent, so they are computed concurrently.
+    std::vector<storm::storage::MaximalEndComponentDecomposition<ValueType>> conjunctionMecs(dnf.size());
+    storm::utility::parallel::forEachChunk(env.solver().getNumberOfThreads(), dnf.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t conjunctionIndex = begin; conjunctionIndex < end; ++conjunctionIndex) {
+            auto const& conjunction = dnf[conjunctionIndex];
+            // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
+            storm::storage::BitVector allowed = mecStates;
+
+            for (auto const& literal : conjunction) {
+                if (literal->isTRUE()) {
+                    // skip
+                } else if (literal->isFALSE()) {
+                    allowed.clear();
+                    break;
+                } else if (literal->isAtom()) {
+                    const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
+                    if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
+                        // only deal with FIN, ignore INF here
+                        const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
+                        if (atom.isNegated()) {
+                            // allowed = allowed \ ~accSet = allowed & accSet
+                            allowed &= accSet;
+                        } else {
+                            // allowed = allowed \ accSet = allowed & ~accSet
+                            allowed &= ~accSet;
+                        }
                     }
                 }
             }
-        }
 
-        if (allowed.empty()) {
-            // skip
-            continue;
+            if (allowed == mecStates) {
+                // No state was removed, so the MECs of the model are the MECs of the allowed fragment.
+                conjunctionMecs[conjunctionIndex] = modelMecs;
+            } else if (!allowed.empty()) {
+                // Compute MECs in the allowed fragment
+                conjunctionMecs[conjunctionIndex] =
+                    storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, allowed, mecChoices);
+            }
         }
+    });
 
-        // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
+    // Check the MECs for acceptance in the order of the conjunctions as the scheduler construction depends on this order.
+    for (uint64_t conjunctionIndex = 0; conjunctionIndex < dnf.size(); ++conjunctionIndex) {
+        auto const& conjunction = dnf[conjunctionIndex];
+        auto const& mecs = conjunctionMecs[conjunctionIndex];
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
             bool accepting = true;
@@ -222,6 +263,9 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     STORM_LOG_INFO("Building " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product with deterministic automaton, starting from "
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
+    // Once the automaton is in an absorbing state, the remaining part of the model does not need to be explored. This breaks the correspondence between
+    // model and product choices that is needed for the scheduler construction.
+    productBuilder.setTruncateAtAbsorbingAutomatonStates(!this->isProduceSchedulerSet());
 
     auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
 
@@ -239,7 +283,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
+        acceptingStates = computeAcceptingECs(env, *product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
                                               product->getProductModel().getBackwardTransitions(), product);
 
     } else {
@@ -315,16 +359,12 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO("Resulting LTL path formula: " << ltlFormula->toString());
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
-    // Convert LTL formula to a deterministic automaton
-    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
-    if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
-    }
+    // Convert LTL formula to a deterministic automaton, either with the external tool given via ltl2da or with the internal tool (Spot).
+    // For nondeterministic models the acceptance condition is transformed into DNF. Translations are cached across properties (and runs).
+    boost::optional<std::string> ltl2daTool, cacheDirectory;
+    getTranslationOptions(env, ltl2daTool, cacheDirectory);
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da =
+        storm::automata::LTL2DeterministicAutomaton::ltl2da(*ltlFormula, Nondeterministic, ltl2daTool, cacheDirectory);
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
@@ -342,6 +382,49 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     return numericResult;
 }
 
+template<typename ValueType, bool Nondeterministic>
+void SparseLTLHelper<ValueType, Nondeterministic>::translateLTLFormulas(Environment const& env,
+                                                                        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    // Obtain the formulas that computeLTLProbabilities translates (see above).
+    std::vector<std::shared_ptr<storm::logic::Formula const>> ltlFormulas;
+    for (auto const& formula : formulas) {
+        if (!formula->isProbabilityOperatorFormula()) {
+            continue;
+        }
+        storm::logic::ProbabilityOperatorFormula const& operatorFormula = formula->asProbabilityOperatorFormula();
+        storm::logic::Formula const& subformula = operatorFormula.getSubformula();
+        if (!subformula.isPathFormula() || subformula.isHOAPathFormula() || subformula.isConditionalProbabilityFormula() ||
+            !subformula.info(false).containsComplexPathFormula()) {
+            continue;
+        }
+        storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+        std::shared_ptr<storm::logic::Formula const> ltlFormula =
+            storm::logic::ExtractMaximalStateFormulasVisitor::extract(subformula.asPathFormula(), extracted);
+        if (Nondeterministic) {
+            bool minimize;
+            if (operatorFormula.hasOptimalityType()) {
+                minimize = storm::solver::minimize(operatorFormula.getOptimalityType());
+            } else if (operatorFormula.hasBound()) {
+                minimize = operatorFormula.getComparisonType() == storm::logic::ComparisonType::Greater ||
+                           operatorFormula.getComparisonType() == storm::logic::ComparisonType::GreaterEqual;
+            } else {
+                continue;
+            }
+            if (minimize) {
+                ltlFormula = std::make_shared<storm::logic::UnaryBooleanPathFormula>(storm::logic::UnaryBooleanOperatorType::Not, ltlFormula);
+            }
+        }
+        ltlFormulas.push_back(ltlFormula);
+    }
+
+    if (ltlFormulas.size() > 1) {
+        boost::optional<std::string> ltl2daTool, cacheDirectory;
+        getTranslationOptions(env, ltl2daTool, cacheDirectory);
+        STORM_LOG_INFO("Translating " << ltlFormulas.size() << " LTL formulas into deterministic automata.");
+        storm::automata::LTL2DeterministicAutomaton::ltl2da(ltlFormulas, Nondeterministic, ltl2daTool, cacheDirectory);
+    }
+}
+
 template class SparseLTLHelper<double, false>;
 template class SparseLTLHelper<double, true>;
 
@@ -86,6 +86,14 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
     std::vector<ValueType> computeLTLProbabilities(Environment const& env, storm::logic::PathFormula const& formula,
                                                    std::map<std::string, storm::storage::BitVector>& apSatSets);
 
+    /*!
+     * Translates the LTL path formulas of the given probability operator formulas into deterministic automata concurrently. The automata are
+     * cached, such that computing the probabilities of the formulas afterwards does not translate them again. Other formulas are ignored.
+     * @param env the environment, which specifies the translation tool and the persistent cache
+     * @param formulas the formulas
+     */
+    static void translateLTLFormulas(Environment const& env, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
    private:
     /*!
      * Computes a set S of states that admit a probability 1 strategy of satisfying the given acceptance condition (in DNF).
@@ -95,11 +103,14 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
      *   P1acc be the set of states that satisfy Pmax=1[ F accEC ].
      * This function then computes a set that contains accEC and is contained by P1acc.
      * However, if the acceptance condition consists of 'true', the whole state space can be returned.
+     * The end components for the different disjuncts are computed concurrently (using the solver threads of the environment) within the MECs of the
+     * whole model.
+     * @param env the environment
      * @param acceptance the acceptance condition (in DNF)
      * @param transitionMatrix the transition matrix of the model
      * @param backwardTransitions the reversed transition relation
      */
-    storm::storage::BitVector computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+    storm::storage::BitVector computeAcceptingECs(Environment const& env, automata::AcceptanceCondition const& acceptance,
                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                   typename transformer::DAProduct<productModelType>::ptr product);
@@ -0,0 +1,132 @@
+#include "storm/modelchecker/hints/SolutionCache.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/io/file.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+
+/*!
+ * Computes a hash of the given key that is stable across runs and platforms (FNV-1a) and can therefore be used as a file name.
+ */
+std::string getCacheFileName(std::string const& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    std::stringstream stream;
+    stream << "solution-" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+}  // namespace
+
+template<typename ValueType>
+SolutionCache<ValueType>::SolutionCache(std::string const& directory) : directory(directory) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::string SolutionCache<ValueType>::getKey(ModelType const& model, storm::logic::Formula const& formula) const {
+    std::stringstream stream;
+    stream << model.getType() << " " << formula;
+    return stream.str();
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitModelCheckerHint<ValueType>> SolutionCache<ValueType>::loadHint(ModelType const& model, storm::logic::Formula const& formula) const {
+    STORM_LOG_THROW(model.hasStateValuations(), storm::exceptions::InvalidArgumentException, "The solution cache requires state valuations.");
+    std::string const key = getKey(model, formula);
+    std::string const fileBase = directory + "/" + getCacheFileName(key);
+    if (!storm::io::fileExistsAndIsReadable(fileBase + ".key") || !storm::io::fileExistsAndIsReadable(fileBase + ".values")) {
+        return nullptr;
+    }
+
+    // The key is stored next to the solution to detect hash collisions.
+    std::ifstream keyStream;
+    storm::io::openFile(fileBase + ".key", keyStream);
+    std::string storedKey;
+    storm::io::getline(keyStream, storedKey);
+    storm::io::closeFile(keyStream);
+    if (storedKey != key) {
+        return nullptr;
+    }
+
+    // Each line holds the value followed by a tab and the valuation of the state.
+    std::unordered_map<std::string, ValueType> valuationToValue;
+    std::ifstream valueStream;
+    storm::io::openFile(fileBase + ".values", valueStream);
+    std::string line;
+    while (storm::io::getline(valueStream, line)) {
+        auto const separator = line.find('\t');
+        if (separator != std::string::npos) {
+            valuationToValue.emplace(line.substr(separator + 1), static_cast<ValueType>(std::strtod(line.c_str(), nullptr)));
+        }
+    }
+    storm::io::closeFile(valueStream);
+
+    auto const& stateValuations = model.getStateValuations();
+    std::vector<ValueType> values(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+    uint64_t numberOfMatchedStates = 0;
+    for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+        auto valueIt = valuationToValue.find(stateValuations.toString(state));
+        if (valueIt != valuationToValue.end()) {
+            values[state] = valueIt->second;
+            ++numberOfMatchedStates;
+        }
+    }
+    STORM_LOG_INFO("Found cached solution for " << numberOfMatchedStates << " of " << model.getNumberOfStates() << " states in " << fileBase
+                                                << ".values.");
+    if (numberOfMatchedStates == 0) {
+        return nullptr;
+    }
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+    hint->setResultHint(std::move(values));
+    return hint;
+}
+
+template<typename ValueType>
+void SolutionCache<ValueType>::store(ModelType const& model, storm::logic::Formula const& formula, std::vector<ValueType> const& solution) const {
+    STORM_LOG_THROW(model.hasStateValuations(), storm::exceptions::InvalidArgumentException, "The solution cache requires state valuations.");
+    STORM_LOG_THROW(solution.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException,
+                    "The solution does not have one value per state.");
+    std::string const key = getKey(model, formula);
+    std::string const fileBase = directory + "/" + getCacheFileName(key);
+
+    std::ofstream valueStream;
+    storm::io::openFile(fileBase + ".values", valueStream);
+    valueStream << std::setprecision(std::numeric_limits<ValueType>::max_digits10);
+    auto const& stateValuations = model.getStateValuations();
+    for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+        valueStream << solution[state] << '\t' << stateValuations.toString(state) << '\n';
+    }
+    storm::io::closeFile(valueStream);
+
+    // Write the key last so that an incomplete solution file is never used.
+    std::ofstream keyStream;
+    storm::io::openFile(fileBase + ".key", keyStream);
+    keyStream << key << '\n';
+    storm::io::closeFile(keyStream);
+}
+
+template class SolutionCache<double>;
+
+}  // namespace modelchecker
+}  // namespace storm
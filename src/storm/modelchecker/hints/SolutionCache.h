@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+
+namespace storm {
+namespace logic {
+class Formula;
+}
+namespace models {
+namespace sparse {
+template<typename ValueType, typename RewardModelType>
+class Model;
+template<typename ValueType>
+class StandardRewardModel;
+}  // namespace sparse
+}  // namespace models
+
+namespace modelchecker {
+
+/*!
+ * Stores the solutions of model checking queries in a directory such that later runs on the same (or a slightly modified) model can use
+ * them as result hints, e.g., for warm-starting value iteration. The solutions are stored per state valuation, so states are mapped across
+ * different versions of a model by their valuations. The cache key consists of the model type and the formula.
+ */
+template<typename ValueType>
+class SolutionCache {
+   public:
+    typedef storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> ModelType;
+
+    /*!
+     * Creates a cache that stores its entries in the given (existing) directory.
+     */
+    explicit SolutionCache(std::string const& directory);
+
+    /*!
+     * Retrieves a hint for the given formula on the given model, if a solution has been stored for it before.
+     * States whose valuation has no stored solution get value zero.
+     *
+     * @param model The model, which needs state valuations.
+     * @param formula The formula that is to be checked.
+     * @return A hint holding the stored solution or nullptr if there is no stored solution that matches a state of the model.
+     */
+    std::shared_ptr<ExplicitModelCheckerHint<ValueType>> loadHint(ModelType const& model, storm::logic::Formula const& formula) const;
+
+    /*!
+     * Stores the given solution of the given formula on the given model. An existing solution for the same key is overwritten.
+     *
+     * @param model The model, which needs state valuations.
+     * @param formula The formula whose solution is given.
+     * @param solution The solution, with one value for each state of the model.
+     */
+    void store(ModelType const& model, storm::logic::Formula const& formula, std::vector<ValueType> const& solution) const;
+
+   private:
+    std::string getKey(ModelType const& model, storm::logic::Formula const& formula) const;
+
+    std::string directory;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
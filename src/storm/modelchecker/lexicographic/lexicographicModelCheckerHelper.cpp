@@ -10,8 +10,8 @@
 #include "storm/modelchecker/lexicographic/spotHelper/spotProduct.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/SchedulerChoice.h"
+#include "storm/utility/constants.h"
 #include "storm/transformer/EndComponentEliminator.h"
-#include "storm/transformer/SubsystemBuilder.h"
 
 namespace storm {
 namespace modelchecker {
@@ -62,10 +62,14 @@ template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 std::pair<storm::storage::MaximalEndComponentDecomposition<ValueType>, std::vector<std::vector<bool>>>
 lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getLexArrays(
     std::shared_ptr<storm::transformer::DAProduct<productModelType>> productModel, std::vector<uint>& acceptanceConditions) {
-    storm::storage::BitVector allowed(productModel->getProductModel().getTransitionMatrix().getRowGroupCount(), true);
+    storm::storage::SparseMatrix<ValueType> const& productMatrix = productModel->getProductModel().getTransitionMatrix();
+    // the backward transitions and the incoming choices of the states are computed once and shared by all MECs and all conditions
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = productMatrix.transpose(true);
+    storm::storage::SparseMatrix<ValueType> incomingChoices = productMatrix.transpose();
+
+    storm::storage::BitVector allowed(productMatrix.getRowGroupCount(), true);
     // get MEC decomposition
-    storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(productModel->getProductModel().getTransitionMatrix(),
-                                                                     productModel->getProductModel().getBackwardTransitions(), allowed);
+    storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(productMatrix, backwardTransitions, allowed);
 
     std::vector<std::vector<bool>> bscc_satisfaction;
     storm::automata::AcceptanceCondition::ptr acceptance = productModel->getAcceptance();
@@ -89,7 +93,7 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
             sprimeTemp.insert(sprimeTemp.end(), sub.begin(), sub.end());
 
             // check whether the Streett-condition in sprimeTemp can be fulfilled in the mec
-            bool accepts = isAcceptingStreettConditions(mec, sprimeTemp, acceptance, productModel->getProductModel());
+            bool accepts = isAcceptingStreettConditions(mec, sprimeTemp, acceptance, productModel->getProductModel(), backwardTransitions, incomingChoices);
 
             if (accepts) {
                 // if the condition can be fulfilled, add the Streett-pairs to the current list of pairs, and mark this property as true for this MEC
@@ -121,43 +125,41 @@ MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelpe
         eliminator.transform(newMatrixWithNewStates, mecs, eliminationStates, storm::storage::BitVector(eliminationStates.size(), false), true);
 
     STORM_LOG_ASSERT(!mecLexArray.empty(), "No MECs in the model!");
-    std::vector<std::vector<bool>> bccLexArrayCurrent(mecLexArray);
     // prepare the result (one reachability probability for each objective)
-    MDPSparseModelCheckingHelperReturnType<ValueType> retResult(std::vector<ValueType>(mecLexArray[0].size()));
-    std::vector<uint_fast64_t> compressedToReducedMapping(compressionResult.matrix.getColumnCount());
-    std::iota(std::begin(compressedToReducedMapping), std::end(compressedToReducedMapping), 0);
-    storm::storage::SparseMatrix<ValueType> transitionMatrix = compressionResult.matrix;
+    MDPSparseModelCheckingHelperReturnType<ValueType> retResult(std::vector<ValueType>(mecLexArray[0].size(), storm::utility::zero<ValueType>()));
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = compressionResult.matrix;
+    uint_fast64_t numStates = transitionMatrix.getRowGroupCount();
+
+    // Get initial states in the compressed model
+    std::vector<uint_fast64_t> newInitialStates;
+    for (auto const& state : originalMdp.getInitialStates()) {
+        newInitialStates.push_back(compressionResult.oldToNewStateMapping[state]);
+    }
+    if (newInitialStates.empty()) {
+        return retResult;
+    }
+    storm::storage::BitVector initialStates(numStates, newInitialStates);
+
+    // All objectives are solved on the states of the compressed model. Restricting the model to the optimal actions of an objective only
+    // removes choices from this set, such that no submodels (and state mappings) need to be built.
+    storm::storage::BitVector allowedChoices(transitionMatrix.getRowCount(), true);
 
     // check reachability for each condition and restrict the model to optimal choices
     for (uint condition = 0; condition < mecLexArray[0].size(); condition++) {
         // get the goal-states for this objective (i.e. the st-states of the MECs where the objective can be fulfilled
-        storm::storage::BitVector psiStates = getGoodStates(mecs, bccLexArrayCurrent, compressionResult.oldToNewStateMapping, condition,
-                                                            transitionMatrix.getColumnCount(), compressedToReducedMapping, bccToStStateMapping);
-        if (psiStates.getNumberOfSetBits() == 0) {
-            retResult.values[condition] = 0;
+        storm::storage::BitVector psiStates =
+            getGoodStates(mecs, mecLexArray, compressionResult.oldToNewStateMapping, condition, numStates, bccToStStateMapping);
+        if (psiStates.empty()) {
             continue;
         }
 
         // solve the reachability query for this set of goal states
-        std::vector<uint_fast64_t> newInitalStates;
-        auto res =
-            solveOneReachability(newInitalStates, psiStates, transitionMatrix, originalMdp, compressedToReducedMapping, compressionResult.oldToNewStateMapping);
-        if (newInitalStates.empty()) {
-            retResult.values[condition] = 0;
-            continue;
-        }
-        retResult.values[condition] = res.values[newInitalStates[0]];
-
-        // create a reduced subsystem that only contains the optimal actions for this objective
-        auto subsystem = getReducedSubsystem(transitionMatrix, res, newInitalStates, psiStates);
-        std::vector<uint_fast64_t> compressedToReducedMappingTemp;
-        compressedToReducedMappingTemp.reserve(compressedToReducedMapping.size());
-        // create a new mapping for the states
-        for (uint_fast64_t newState : subsystem.newToOldStateIndexMapping) {
-            compressedToReducedMappingTemp.push_back(compressedToReducedMapping[newState]);
-        }
-        compressedToReducedMapping = compressedToReducedMappingTemp;
-        transitionMatrix = subsystem.model->getTransitionMatrix();
+        storm::storage::SparseMatrix<ValueType> restrictedMatrix = transitionMatrix.restrictRows(allowedChoices);
+        auto res = solveOneReachability(initialStates, psiStates, restrictedMatrix);
+        retResult.values[condition] = res.values[newInitialStates[0]];
+
+        // only keep the optimal actions for this objective
+        restrictToOptimalChoices(restrictedMatrix, res, allowedChoices);
     }
     return retResult;
 }
@@ -193,7 +195,8 @@ const storm::storage::BitVector& getStreettSet(storm::automata::AcceptanceCondit
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::isAcceptingStreettConditions(
     storm::storage::MaximalEndComponent const& scc, std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
-    storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model) {
+    storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::SparseMatrix<ValueType> const& incomingChoices) {
     // initialize the states and choices we have to consider for mec decomposition
     storm::storage::BitVector mecStates = storm::storage::BitVector(model.getNumberOfStates(), false);
     std::for_each(scc.begin(), scc.end(), [&mecStates](auto const& state) { mecStates.set(state.first); });
@@ -202,16 +205,13 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
     if (mecChoices.empty()) {
         return false;
     }
-    // get easy access to incoming transitions of a state
-    auto incomingChoicesMatrix = model.getTransitionMatrix().transpose();
-    auto incomingStatesMatrix = model.getBackwardTransitions();
     bool changedSomething = true;
     while (changedSomething) {
         // iterate until there is no change
         changedSomething = false;
         // decompose the MEC, if possible
         auto subMecDecomposition =
-            storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), incomingStatesMatrix, mecStates, mecChoices);
+            storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), backwardTransitions, mecStates, mecChoices);
         // iterate over all sub-MECs in the big MEC
         for (storm::storage::MaximalEndComponent const& mec : subMecDecomposition) {
             // iterate over all Streett-pairs
@@ -232,7 +232,7 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
                             // remove the state from the set of states in this EC
                             mecStates.set(state, false);
                             // remove all incoming transitions to this state
-                            auto incChoices = incomingChoicesMatrix.getRow(state);
+                            auto incChoices = incomingChoices.getRow(state);
                             std::for_each(incChoices.begin(), incChoices.end(), [&mecChoices](auto const& entry) { mecChoices.set(entry.getColumn(), false); });
                             changedSomething = true;
                         }
@@ -243,7 +243,7 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
     }
     // decompose one last time
     auto subMecDecomposition =
-        storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), incomingStatesMatrix, mecStates, mecChoices);
+        storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), backwardTransitions, mecStates, mecChoices);
     if (subMecDecomposition.empty()) {
         // there are no more ECs in this set of states
         return false;
@@ -256,101 +256,67 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getGoodStates(
     storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc, std::vector<std::vector<bool>> const& bccLexArray,
-    std::vector<uint_fast64_t> const& oldToNewStateMapping, uint const& condition, uint const numStates,
-    std::vector<uint_fast64_t> const& compressedToReducedMapping, std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
+    std::vector<uint_fast64_t> const& oldToNewStateMapping, uint const& condition, uint_fast64_t const numStates,
+    std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
     STORM_LOG_ASSERT(!bccLexArray.empty(), "Lex-Array is empty!");
     STORM_LOG_ASSERT(condition < bccLexArray[0].size(), "Condition is not in Lex-Array!");
-    std::vector<uint_fast64_t> goodStates;
+    storm::storage::BitVector goodStates(numStates, false);
     for (uint i = 0; i < bcc.size(); i++) {
-        std::vector<bool> const& bccLex = bccLexArray[i];
-        if (bccLex[condition]) {
-            uint_fast64_t bccStateOld = bccToStStateMapping.at(i);
-            uint_fast64_t bccState = oldToNewStateMapping[bccStateOld];
-            auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), bccState);
-            if (pointer != compressedToReducedMapping.end()) {
-                // We have to check whether the state has already been removed
-                uint_fast64_t bccStateReduced = pointer - compressedToReducedMapping.begin();
-                goodStates.push_back(bccStateReduced);
-            }
+        if (bccLexArray[i][condition]) {
+            goodStates.set(oldToNewStateMapping[bccToStStateMapping.at(i)]);
         }
     }
-    return {numStates, goodStates};
+    return goodStates;
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::solveOneReachability(
-    std::vector<uint_fast64_t>& newInitalStates, storm::storage::BitVector const& psiStates, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    SparseModelType const& originalMdp, std::vector<uint_fast64_t> const& compressedToReducedMapping, std::vector<uint_fast64_t> const& oldToNewStateMapping) {
+    storm::storage::BitVector const& initialStates, storm::storage::BitVector const& psiStates,
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     Environment env;
     // A reachability condition "F x" is transformed to "true U x"
     // phi states are all states
     // psi states are the ones from the "good bccs"
     storm::storage::BitVector phiStates(transitionMatrix.getColumnCount(), true);
 
-    // Get initial states in the compressed model
-    storm::storage::BitVector const& originalInitialStates = originalMdp.getInitialStates();
-
-    uint pos = 0;
-    while (originalInitialStates.getNextSetIndex(pos) != originalInitialStates.size()) {
-        pos = originalInitialStates.getNextSetIndex(pos) + 1;
-        auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), oldToNewStateMapping[pos - 1]);
-        if (pointer != compressedToReducedMapping.end()) {
-            newInitalStates.push_back(pointer - compressedToReducedMapping.begin());
-        }
-    }
-    storm::storage::BitVector i(transitionMatrix.getColumnCount(), newInitalStates);
-
     ModelCheckerHint hint;
     MDPSparseModelCheckingHelperReturnType<ValueType> ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-        env, storm::solver::SolveGoal<ValueType>(storm::solver::OptimizationDirection::Maximize, i), transitionMatrix, transitionMatrix.transpose(true),
-        phiStates, psiStates, false, true, hint);
+        env, storm::solver::SolveGoal<ValueType>(storm::solver::OptimizationDirection::Maximize, initialStates), transitionMatrix,
+        transitionMatrix.transpose(true), phiStates, psiStates, false, true, hint);
     return ret;
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
-typename lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::SubsystemReturnType
-lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getReducedSubsystem(
-    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
-    std::vector<uint_fast64_t> const& newInitalStates, storm::storage::BitVector const& goodStates) {
-    std::vector<std::vector<uint>> optimalActions;
-    std::vector<uint_fast64_t> keptActions;
-    std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+void lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::restrictToOptimalChoices(
+    storm::storage::SparseMatrix<ValueType> const& restrictedMatrix, MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
+    storm::storage::BitVector& allowedChoices) {
+    // the rows of the restricted matrix are the allowed choices (in the same order)
+    std::vector<uint_fast64_t> rowToChoice;
+    rowToChoice.reserve(restrictedMatrix.getRowCount());
+    for (auto const& choice : allowedChoices) {
+        rowToChoice.push_back(choice);
+    }
+    std::vector<uint_fast64_t> const& rowGroupIndices = restrictedMatrix.getRowGroupIndices();
 
     // iterate over the states
-    for (uint currentState = 0; currentState < reachabilityResult.values.size(); currentState++) {
-        std::vector<uint> goodActionsForState;
+    for (uint_fast64_t currentState = 0; currentState < restrictedMatrix.getRowGroupCount(); currentState++) {
         uint_fast64_t bestAction = reachabilityResult.scheduler->getChoice(currentState).getDeterministicChoice();
         // determine the value of the best action
         ValueType bestActionValue(0);
-        for (const storm::storage::MatrixEntry<uint_fast64_t, ValueType>& rowEntry : transitionMatrix.getRow(rowGroupIndices[currentState] + bestAction)) {
+        for (const storm::storage::MatrixEntry<uint_fast64_t, ValueType>& rowEntry : restrictedMatrix.getRow(rowGroupIndices[currentState] + bestAction)) {
             bestActionValue += rowEntry.getValue() * reachabilityResult.values[rowEntry.getColumn()];
         }
-        uint lastAction = rowGroupIndices[currentState] + transitionMatrix.getRowGroupSize(currentState);
-        // iterate over all actions in this state to find those that are also optimal
-        for (uint action = rowGroupIndices[currentState]; action < lastAction; action++) {
+        // iterate over all actions in this state and remove those that are not optimal. As the best action is kept, no deadlocks are introduced.
+        for (uint_fast64_t action = rowGroupIndices[currentState]; action < rowGroupIndices[currentState + 1]; action++) {
             ValueType actionValue(0);
-            for (const auto& rowEntry : transitionMatrix.getRow(action)) {
+            for (const auto& rowEntry : restrictedMatrix.getRow(action)) {
                 actionValue += rowEntry.getValue() * reachabilityResult.values[rowEntry.getColumn()];
             }
-            if (actionValue == bestActionValue) {
-                goodActionsForState.push_back(action);
-                keptActions.push_back(action);
+            if (actionValue != bestActionValue) {
+                allowedChoices.set(rowToChoice[action], false);
             }
         }
-        optimalActions.push_back(goodActionsForState);
-    }
-    storm::storage::BitVector subSystemActions(transitionMatrix.getRowCount(), keptActions);
-    storm::storage::BitVector subSystemStates(transitionMatrix.getRowGroupCount(), true);
-    transformer::SubsystemBuilderOptions sbo;
-    sbo.fixDeadlocks = true;
-    storm::models::sparse::StateLabeling stateLabelling(transitionMatrix.getColumnCount());
-    stateLabelling.addLabel("init");
-    for (auto const& state : newInitalStates) {
-        stateLabelling.addLabelToState("init", state);
     }
-    storm::models::sparse::Mdp<ValueType> newModel(transitionMatrix, stateLabelling);
-    SubsystemReturnType subsystemReturn = transformer::buildSubsystem(newModel, subSystemStates, subSystemActions, false, sbo);
-    return subsystemReturn;
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
@@ -12,7 +12,6 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/transformer/DAProductBuilder.h"
-#include "storm/transformer/SubsystemBuilder.h"
 
 namespace storm {
 
@@ -26,7 +25,6 @@ template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHelper<ValueType, storm::models::ModelRepresentation::Sparse> {
    public:
     typedef std::function<storm::storage::BitVector(storm::logic::Formula const&)> CheckFormulaCallback;
-    typedef storm::transformer::SubsystemBuilderReturnType<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> SubsystemReturnType;
     using StateType = storm::storage::sparse::state_type;
     using productModelType = typename storm::models::sparse::Mdp<ValueType>;
 
@@ -47,6 +45,7 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * Given a product of an MDP and a automaton, returns the MECs and their corresponding Lex-Arrays
      * First: get MEC-decomposition
      * Second: for each MEC, run an algorithm to get Lex-arrays
+     * The backward transitions of the product are computed once and used for all MECs.
      * @param productModel product of MDP and automaton
      * @param acceptanceConditions indication which Streett-pairs belong to which subformula
      * @return MECs, corresp. Lex-arrays
@@ -59,6 +58,7 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * In lexicographic order, each objective is solved for reachability, i.e. the MECs where the property can be fulfilled are the goal-states
      * The model is restricted to optimal actions concerning this reachability query
      * This is repeated for all objectives.
+     * All objectives share the MEC-elimination of the product, the restriction to optimal actions only shrinks a set of allowed choices.
      * @param mecs MaximalEndcomponents in the product-model
      * @param mecLexArray corresponding Lex-arrays for each MEC
      * @param productModel the product of MDP and automaton
@@ -90,11 +90,15 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * @param acceptancePairs list of Streett-pairs that create the Streett-condition
      * @param acceptance original acceptance condition of the automaton
      * @param model copy of the product-model
+     * @param backwardTransitions the backward transitions of the product-model
+     * @param incomingChoices the transposed transition matrix of the product-model, i.e., the choices leading to each state
      * @return whether the condition can be fulfilled or not
      */
     bool isAcceptingStreettConditions(storm::storage::MaximalEndComponent const& scc,
                                       std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
-                                      storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model);
+                                      storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model,
+                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                      storm::storage::SparseMatrix<ValueType> const& incomingChoices);
 
     /*!
      * For a given objective, iterates over the MECs and finds the corresponding sink state
@@ -102,35 +106,29 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * @param mecLexArrays the corresponding lex-arrays
      * @param oldToNewStateMapping mapping of original states and compressed states
      * @param condition the condition to be checked
-     * @param numStatesTotal the number of states in total in the compressed model
-     * @param mecToStateMapping mapping of the MECs to their corresponding sink state
-     * @param compressedToReducedMapping mapping of the compressed model to the reduced to optimal
+     * @param numStates the number of states in total in the compressed model
+     * @param bccToStStateMapping mapping of the MECs to their corresponding sink state
      * @return set of "good" states for the given condition
      */
     storm::storage::BitVector getGoodStates(storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc,
                                             std::vector<std::vector<bool>> const& bccLexArray, std::vector<uint_fast64_t> const& oldToNewStateMapping,
-                                            uint const& condition, uint const numStates, std::vector<uint_fast64_t> const& compressedToReducedMapping,
-                                            std::map<uint, uint_fast64_t> const& bccToStStateMapping);
+                                            uint const& condition, uint_fast64_t const numStates, std::map<uint, uint_fast64_t> const& bccToStStateMapping);
 
     /*!
      * Solves the reachability-query for a given set of goal-states and initial-states
      */
-    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(std::vector<uint_fast64_t>& newInitalStates,
+    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(storm::storage::BitVector const& initialStates,
                                                                            storm::storage::BitVector const& psiStates,
-                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                           SparseModelType const& originalMdp,
-                                                                           std::vector<uint_fast64_t> const& compressedToReducedMapping,
-                                                                           std::vector<uint_fast64_t> const& oldToNewStateMapping);
+                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
 
     /*!
-     * Reduces the model to actions that are optimal for the given strategy.
-     * @param transitionMatrix current transition matrix
+     * Restricts the allowed choices to the ones that are optimal for the given strategy.
+     * @param restrictedMatrix the transition matrix restricted to the allowed choices
      * @param reachabilityResult result of the reachability query, that contains (i) the reachability value for each state, and (ii) the optimal scheduler
-     * @return
+     * @param allowedChoices the allowed choices of the compressed model, from which the non-optimal ones are removed
      */
-    SubsystemReturnType getReducedSubsystem(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                            MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
-                                            std::vector<uint_fast64_t> const& newInitalStates, storm::storage::BitVector const& goodStates);
+    void restrictToOptimalChoices(storm::storage::SparseMatrix<ValueType> const& restrictedMatrix,
+                                  MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult, storm::storage::BitVector& allowedChoices);
 
     /*!
      * add a new sink-state for each MEC
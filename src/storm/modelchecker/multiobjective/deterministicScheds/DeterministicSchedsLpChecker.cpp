@@ -57,7 +57,19 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::setCurrentWeigh
     swAll.start();
     initialize(env);
     STORM_LOG_ASSERT(weightVector.size() == objectiveHelper.size(), "Setting a weight vector with invalid number of entries.");
+    bool const keepObjectiveVariables = lpModel->supportsObjectiveFunctionCoefficientChanges();
     if (!currentWeightVector.empty()) {
+        if (keepObjectiveVariables) {
+            // Only exchange the objective function such that the solver can build on previous optimizations (e.g. reuse the previous
+            // solution as start solution of the MILP).
+            currentWeightVector = weightVector;
+            for (uint64_t objIndex = 0; objIndex < currentObjectiveVariables.size(); ++objIndex) {
+                lpModel->setObjectiveFunctionCoefficient(currentObjectiveVariables[objIndex], storm::utility::convertNumber<ValueType>(weightVector[objIndex]));
+            }
+            lpModel->update();
+            swAll.stop();
+            return;
+        }
         // Pop information of the current weight vector.
         lpModel->pop();
         lpModel->update();
@@ -66,7 +78,9 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::setCurrentWeigh
 
     currentWeightVector = weightVector;
 
-    lpModel->push();
+    if (!keepObjectiveVariables) {
+        lpModel->push();
+    }
     // set up objective function for the given weight vector
     for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
         currentObjectiveVariables.push_back(
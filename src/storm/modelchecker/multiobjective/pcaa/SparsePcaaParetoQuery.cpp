@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -9,6 +11,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -63,38 +66,68 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
     STORM_LOG_THROW(env.modelchecker().multi().getPrecisionType() == MultiObjectiveModelCheckerEnvironment::PrecisionType::Absolute,
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
+    // The number of weight vectors that are checked concurrently in each refinement round.
+    uint64_t batchSize = env.modelchecker().multi().getNumberOfThreads();
+    if (batchSize == 0) {
+        batchSize = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
+    auto limitToRemainingSteps = [&](uint64_t size) {
+        if (env.modelchecker().multi().isMaxStepsSet()) {
+            size = std::min<uint64_t>(size, env.modelchecker().multi().getMaxSteps() - this->refinementSteps.size());
+        }
+        return size;
+    };
+
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        std::vector<WeightVector> directions;
+        uint64_t numberOfDirections = limitToRemainingSteps(std::min<uint64_t>(batchSize, this->objectives.size() - objIndex));
+        for (; directions.size() < numberOfDirections; ++objIndex) {
+            WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            direction[objIndex] = storm::utility::one<GeometryValueType>();
+            directions.push_back(std::move(direction));
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
+    GeometryValueType const precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<std::pair<GeometryValueType, uint_fast64_t>> distanceHalfspacePairs;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType halfspaceDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                halfspaceDistance = std::max(halfspaceDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (!storm::utility::isZero(halfspaceDistance)) {
+                distanceHalfspacePairs.emplace_back(halfspaceDistance, halfspaceIndex);
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        // Sort by decreasing distance. Ties are resolved by the index of the halfspace.
+        std::sort(distanceHalfspacePairs.begin(), distanceHalfspacePairs.end(),
+                  [](std::pair<GeometryValueType, uint_fast64_t> const& lhs, std::pair<GeometryValueType, uint_fast64_t> const& rhs) {
+                      return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                  });
+        if (distanceHalfspacePairs.empty() || distanceHalfspacePairs.front().first < precision) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(distanceHalfspacePairs.front().first));
+        std::vector<WeightVector> directions;
+        uint64_t numberOfDirections = limitToRemainingSteps(batchSize);
+        for (auto const& distanceHalfspacePair : distanceHalfspacePairs) {
+            if (directions.size() == numberOfDirections || distanceHalfspacePair.first < precision) {
+                break;
+            }
+            directions.push_back(underApproxHalfspaces[distanceHalfspacePair.second].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
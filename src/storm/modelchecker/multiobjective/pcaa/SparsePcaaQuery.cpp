@@ -12,6 +12,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -29,7 +30,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : preprocessorResult(preprocessorResult),
+      originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -89,26 +93,56 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
-    storm::utility::vector::scaleVectorInPlace(
-        direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-    RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-        }
+    std::vector<WeightVector> directions;
+    directions.push_back(std::move(direction));
+    performRefinementSteps(env, std::move(directions));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    uint64_t numberOfThreads = env.modelchecker().multi().getNumberOfThreads();
+    if (numberOfThreads == 0) {
+        numberOfThreads = storm::utility::parallel::getNumberOfHardwareThreads();
+    }
+    numberOfThreads = std::min<uint64_t>(numberOfThreads, directions.size());
+    // Each thread needs its own weight vector checker as the checkers store the results (and solver data) of the last check.
+    while (additionalWeightVectorCheckers.size() + 1 < numberOfThreads) {
+        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+    }
+    for (auto& checker : additionalWeightVectorCheckers) {
+        checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
     }
-    refinementSteps.push_back(std::move(step));
 
-    updateOverApproximation();
+    std::vector<RefinementStep> steps(directions.size());
+    storm::utility::parallel::forEachChunk(numberOfThreads, directions.size(), 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+        PcaaWeightVectorChecker<SparseModelType>& checker = threadIndex == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[threadIndex - 1];
+        for (uint64_t index = begin; index < end; ++index) {
+            WeightVector& direction = directions[index];
+            // Normalize the direction vector so that the entries sum up to one
+            GeometryValueType sum = std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>());
+            storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / sum);
+            checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+            STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
+                                storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
+            RefinementStep& step = steps[index];
+            step.weightVector = direction;
+            step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+            step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
+        }
+    });
+
+    for (auto& step : steps) {
+        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+            }
+        }
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
+    }
+    // The underapproximation is computed from all refinement steps, so it suffices to update it once.
     updateUnderApproximation();
 }
 
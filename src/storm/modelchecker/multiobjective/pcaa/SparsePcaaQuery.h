@@ -68,6 +68,13 @@ class SparsePcaaQuery {
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. the given direction vectors.
+     * The direction vectors are checked concurrently, where each thread uses its own weight vector checker. The results are then incorporated in the given
+     * order, so the outcome does not depend on the number of threads.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -87,6 +94,7 @@ class SparsePcaaQuery {
      */
     bool maxStepsPerformed(Environment const& env) const;
 
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult;
     SparseModelType const& originalModel;
     storm::logic::MultiObjectiveFormula const& originalFormula;
 
@@ -94,6 +102,8 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Further weight vector checkers that are used (and created on demand) if several weight vectors are checked concurrently
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
@@ -4,6 +4,8 @@
 #include <set>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectiveRewardAnalysis.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -430,12 +432,32 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
         }
     }
 
+    // Warm-start from the solution for the previous weight vector, provided that it was computed for the same quotient. As the quotient has no end
+    // components, every scheduler (in particular the previous optimal one) is a valid initial scheduler. Sound and exact methods rely on their own
+    // initialization, so they are not warm-started.
+    bool warmStart = !ecQuotient->previousWeightVector.empty() && !env.solver().isForceSoundness() && !env.solver().isForceExact();
+    Environment policyIterationEnv = env;
+    if (warmStart && env.solver().minMax().isMethodSetFromDefault()) {
+        bool weightsAreClose = true;
+        for (uint64_t objIndex = 0; objIndex < weightVector.size(); ++objIndex) {
+            if (storm::utility::abs<ValueType>(weightVector[objIndex] - ecQuotient->previousWeightVector[objIndex]) >
+                storm::utility::convertNumber<ValueType>(PolicyIterationWeightDifference)) {
+                weightsAreClose = false;
+                break;
+            }
+        }
+        if (weightsAreClose) {
+            policyIterationEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        }
+    }
+    Environment const& solverEnv = warmStart ? policyIterationEnv : env;
+
     storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> solverFactory;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = solverFactory.create(env, ecQuotient->matrix);
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = solverFactory.create(solverEnv, ecQuotient->matrix);
     solver->setTrackScheduler(true);
     solver->setHasUniqueSolution(true);
     solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
-    auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize);
+    auto req = solver->getRequirements(solverEnv, storm::solver::OptimizationDirection::Maximize, warmStart);
     setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix,
                       ecQuotient->rowsWithSumLessOne, ecQuotient->auxChoiceValues);
     if (solver->hasLowerBound()) {
@@ -444,7 +466,10 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     if (solver->hasUpperBound()) {
         req.clearUpperBounds();
     }
-    if (req.validInitialScheduler()) {
+    if (warmStart) {
+        solver->setInitialScheduler(std::vector<uint_fast64_t>(ecQuotient->previousOptimalChoices));
+        req.clearValidInitialScheduler();
+    } else if (req.validInitialScheduler()) {
         solver->setInitialScheduler(computeValidInitialScheduler(ecQuotient->matrix, ecQuotient->rowsWithSumLessOne));
         req.clearValidInitialScheduler();
     }
@@ -452,10 +477,14 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
 
-    // Use the (0...0) vector as initial guess for the solution.
-    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    if (!warmStart) {
+        // Use the (0...0) vector as initial guess for the solution. Otherwise, the solution for the previous weight vector is kept as initial guess.
+        std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    }
 
-    solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
+    solver->solveEquations(solverEnv, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
+    ecQuotient->previousWeightVector = weightVector;
+    ecQuotient->previousOptimalChoices = solver->getSchedulerChoices();
     this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
 
     transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecqStateToOptimalMecMap, this->weightedResult,
@@ -158,6 +158,9 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
     // The scheduler choices that optimize the weighted rewards of undounded objectives.
     std::vector<uint64_t> optimalChoices;
 
+    // If no entry of the weight vector differs by more than this value from the previous one, policy iteration is started from the previous scheduler.
+    static constexpr double PolicyIterationWeightDifference = 0.1;
+
     struct EcQuotient {
         storm::storage::SparseMatrix<ValueType> matrix;
         std::vector<uint_fast64_t> ecqToOriginalChoiceMapping;
@@ -170,6 +173,11 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
 
         std::vector<ValueType> auxStateValues;
         std::vector<ValueType> auxChoiceValues;
+
+        // The weight vector and the optimal choices of the most recent solution for this quotient (empty if there is none).
+        // Since successive weight vectors tend to be close, they are used to warm-start the solver.
+        std::vector<ValueType> previousWeightVector;
+        std::vector<uint_fast64_t> previousOptimalChoices;
     };
     boost::optional<EcQuotient> ecQuotient;
 
@@ -0,0 +1,133 @@
+#include "storm/modelchecker/prctl/SparseBatchedPrctlModelChecker.h"
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseBatchedPrctlHelper.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/AnalysisCache.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+template<class SparseModelType>
+bool constexpr IsDeterministic = std::is_same_v<SparseModelType, storm::models::sparse::Dtmc<typename SparseModelType::ValueType>>;
+
+template<class SparseModelType>
+using SingleSparsePrctlModelChecker =
+    std::conditional_t<IsDeterministic<SparseModelType>, SparseDtmcPrctlModelChecker<SparseModelType>, SparseMdpPrctlModelChecker<SparseModelType>>;
+}  // namespace
+
+template<class SparseModelType>
+SparseBatchedPrctlModelChecker<SparseModelType>::SparseBatchedPrctlModelChecker(SparseModelType const& model) : model(model) {
+    // Intentionally left empty.
+}
+
+template<class SparseModelType>
+bool SparseBatchedPrctlModelChecker<SparseModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    if (!formula.isProbabilityOperatorFormula() || checkTask.isProduceSchedulersSet() || checkTask.getHint().isExplicitModelCheckerHint()) {
+        return false;
+    }
+    if (!IsDeterministic<SparseModelType> && !checkTask.isOptimizationDirectionSet()) {
+        return false;
+    }
+
+    // The path formula needs to be an unbounded until (or eventually) formula over state formulas that the PRCTL model checker can handle.
+    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    std::vector<storm::logic::Formula const*> stateFormulas;
+    if (pathFormula.isUntilFormula()) {
+        stateFormulas.push_back(&pathFormula.asUntilFormula().getLeftSubformula());
+        stateFormulas.push_back(&pathFormula.asUntilFormula().getRightSubformula());
+    } else if (pathFormula.isEventuallyFormula()) {
+        stateFormulas.push_back(&pathFormula.asEventuallyFormula().getSubformula());
+    } else {
+        return false;
+    }
+    SingleSparsePrctlModelChecker<SparseModelType> checker(model);
+    for (auto stateFormula : stateFormulas) {
+        if (!stateFormula->isStateFormula() || !checker.canHandle(checkTask.substituteFormula(*stateFormula))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class SparseModelType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> SparseBatchedPrctlModelChecker<SparseModelType>::computePhiAndPsiStates(
+    Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    SingleSparsePrctlModelChecker<SparseModelType> checker(model);
+    storm::logic::Formula const& pathFormula = checkTask.getFormula().asProbabilityOperatorFormula().getSubformula();
+    if (pathFormula.isUntilFormula()) {
+        auto leftResult = checker.check(env, pathFormula.asUntilFormula().getLeftSubformula());
+        auto rightResult = checker.check(env, pathFormula.asUntilFormula().getRightSubformula());
+        return {leftResult->asExplicitQualitativeCheckResult().getTruthValuesVector(), rightResult->asExplicitQualitativeCheckResult().getTruthValuesVector()};
+    } else {
+        auto subResult = checker.check(env, pathFormula.asEventuallyFormula().getSubformula());
+        return {storm::storage::BitVector(model.getNumberOfStates(), true), subResult->asExplicitQualitativeCheckResult().getTruthValuesVector()};
+    }
+}
+
+template<class SparseModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseBatchedPrctlModelChecker<SparseModelType>::check(
+    Environment const& env, std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+    // Group the tasks by their optimization direction (which is irrelevant for deterministic models).
+    std::vector<std::optional<storm::OptimizationDirection>> directions;
+    std::vector<std::vector<uint64_t>> groups;
+    for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+        auto const& checkTask = checkTasks[taskIndex];
+        STORM_LOG_THROW(canHandle(checkTask), storm::exceptions::InvalidArgumentException,
+                        "The formula " << checkTask.getFormula() << " can not be checked in a batch.");
+        std::optional<storm::OptimizationDirection> direction;
+        if constexpr (!IsDeterministic<SparseModelType>) {
+            direction = checkTask.getOptimizationDirection();
+        }
+        auto directionIt = std::find(directions.begin(), directions.end(), direction);
+        if (directionIt == directions.end()) {
+            directions.push_back(direction);
+            groups.emplace_back();
+            directionIt = directions.end() - 1;
+        }
+        groups[std::distance(directions.begin(), directionIt)].push_back(taskIndex);
+    }
+
+    std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+    auto backwardTransitions = model.getAnalysisCache().getBackwardTransitions(model.getTransitionMatrix());
+    for (uint64_t group = 0; group < groups.size(); ++group) {
+        std::vector<storm::storage::BitVector> phiStates, psiStates;
+        for (auto taskIndex : groups[group]) {
+            auto phiAndPsiStates = computePhiAndPsiStates(env, checkTasks[taskIndex]);
+            phiStates.push_back(std::move(phiAndPsiStates.first));
+            psiStates.push_back(std::move(phiAndPsiStates.second));
+        }
+        auto values = helper::SparseBatchedPrctlHelper<ValueType>::computeUntilProbabilities(env, directions[group], model.getTransitionMatrix(),
+                                                                                             *backwardTransitions, phiStates, psiStates,
+                                                                                             &model.getAnalysisCache());
+        for (uint64_t property = 0; property < groups[group].size(); ++property) {
+            auto const& checkTask = checkTasks[groups[group][property]];
+            std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(values[property]));
+            if (checkTask.isBoundSet()) {
+                result = result->asQuantitativeCheckResult<ValueType>().compareAgainstBound(checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+            }
+            results[groups[group][property]] = std::move(result);
+        }
+    }
+    return results;
+}
+
+template class SparseBatchedPrctlModelChecker<storm::models::sparse::Dtmc<double>>;
+template class SparseBatchedPrctlModelChecker<storm::models::sparse::Mdp<double>>;
+}  // namespace modelchecker
+}  // namespace storm
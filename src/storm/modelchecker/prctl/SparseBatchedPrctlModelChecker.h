@@ -0,0 +1,54 @@
+#ifndef STORM_MODELCHECKER_SPARSEBATCHEDPRCTLMODELCHECKER_H_
+#define STORM_MODELCHECKER_SPARSEBATCHEDPRCTLMODELCHECKER_H_
+
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+class CheckResult;
+
+/*!
+ * Checks several unbounded reachability and until properties of the form P=? [phi U psi] on the same DTMC or MDP at once. The properties are
+ * solved in batches such that each value iteration sweep over the transition matrix updates the values of all properties of a batch
+ * (see helper::SparseBatchedPrctlHelper). Properties with different optimization directions are solved in separate batches.
+ */
+template<class SparseModelType>
+class SparseBatchedPrctlModelChecker {
+   public:
+    typedef typename SparseModelType::ValueType ValueType;
+
+    explicit SparseBatchedPrctlModelChecker(SparseModelType const& model);
+
+    /*!
+     * Returns true iff the given task can be checked as part of a batch.
+     */
+    bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const;
+
+    /*!
+     * Checks the given tasks, all of which have to be supported (see canHandle).
+     * @return the results for the tasks (in the same order). The results are the same as the ones of the sparse PRCTL model checkers,
+     * up to the precision of the solver.
+     */
+    std::vector<std::unique_ptr<CheckResult>> check(Environment const& env, std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks);
+
+   private:
+    /*!
+     * Computes the phi and psi states of the path formula of the given (supported) task.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> computePhiAndPsiStates(
+        Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) const;
+
+    SparseModelType const& model;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
+
+#endif /* STORM_MODELCHECKER_SPARSEBATCHEDPRCTLMODELCHECKER_H_ */
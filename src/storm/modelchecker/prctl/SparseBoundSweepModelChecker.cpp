@@ -0,0 +1,175 @@
+#include "storm/modelchecker/prctl/SparseBoundSweepModelChecker.h"
+
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
+#include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/BoundSweepCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/AnalysisCache.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/SolveGoal.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+template<class SparseModelType>
+bool constexpr IsDtmc = std::is_same_v<SparseModelType, storm::models::sparse::Dtmc<typename SparseModelType::ValueType>>;
+
+template<class SparseModelType>
+bool constexpr IsCtmc = std::is_same_v<SparseModelType, storm::models::sparse::Ctmc<typename SparseModelType::ValueType>>;
+
+template<class SparseModelType>
+bool constexpr IsMa = std::is_same_v<SparseModelType, storm::models::sparse::MarkovAutomaton<typename SparseModelType::ValueType>>;
+
+template<class SparseModelType>
+using SingleSparseModelChecker = std::conditional_t<
+    IsDtmc<SparseModelType>, SparseDtmcPrctlModelChecker<SparseModelType>,
+    std::conditional_t<IsCtmc<SparseModelType>, SparseCtmcCslModelChecker<SparseModelType>,
+                       std::conditional_t<IsMa<SparseModelType>, SparseMarkovAutomatonCslModelChecker<SparseModelType>,
+                                          SparseMdpPrctlModelChecker<SparseModelType>>>>;
+}  // namespace
+
+template<class SparseModelType>
+SparseBoundSweepModelChecker<SparseModelType>::SparseBoundSweepModelChecker(SparseModelType const& model) : model(model) {
+    // Intentionally left empty.
+}
+
+template<class SparseModelType>
+bool SparseBoundSweepModelChecker<SparseModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    if (!formula.isProbabilityOperatorFormula() || checkTask.isProduceSchedulersSet()) {
+        return false;
+    }
+    if (!IsDtmc<SparseModelType> && !IsCtmc<SparseModelType> && !checkTask.isOptimizationDirectionSet()) {
+        return false;
+    }
+    if constexpr (IsMa<SparseModelType>) {
+        if (!model.isClosed()) {
+            return false;
+        }
+    }
+
+    // The path formula needs to be a one-dimensional bounded until formula that only has an upper bound.
+    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    if (!pathFormula.isBoundedUntilFormula()) {
+        return false;
+    }
+    storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+    if (boundedUntilFormula.isMultiDimensional() || boundedUntilFormula.hasLowerBound() || !boundedUntilFormula.hasUpperBound()) {
+        return false;
+    }
+    if ((IsCtmc<SparseModelType> || IsMa<SparseModelType>) ? !boundedUntilFormula.getTimeBoundReference().isTimeBound()
+                                                           : boundedUntilFormula.getTimeBoundReference().isRewardBound()) {
+        return false;
+    }
+    SingleSparseModelChecker<SparseModelType> checker(model);
+    for (auto stateFormula : {&boundedUntilFormula.getLeftSubformula(), &boundedUntilFormula.getRightSubformula()}) {
+        if (!stateFormula->isStateFormula() || !checker.canHandle(checkTask.substituteFormula(*stateFormula))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class SparseModelType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> SparseBoundSweepModelChecker<SparseModelType>::computePhiAndPsiStates(
+    Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    SingleSparseModelChecker<SparseModelType> checker(model);
+    auto const& pathFormula = checkTask.getFormula().asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+    auto leftResult = checker.check(env, pathFormula.getLeftSubformula());
+    auto rightResult = checker.check(env, pathFormula.getRightSubformula());
+    return {leftResult->asExplicitQualitativeCheckResult().getTruthValuesVector(), rightResult->asExplicitQualitativeCheckResult().getTruthValuesVector()};
+}
+
+template<class SparseModelType>
+std::unique_ptr<CheckResult> SparseBoundSweepModelChecker<SparseModelType>::check(Environment const& env,
+                                                                                  CheckTask<storm::logic::Formula, ValueType> const& checkTask,
+                                                                                  std::vector<ValueType> const& upperBounds) {
+    STORM_LOG_THROW(canHandle(checkTask), storm::exceptions::InvalidArgumentException,
+                    "The formula " << checkTask.getFormula() << " can not be checked for a sequence of bounds.");
+    auto const& pathFormula = checkTask.getFormula().asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+    auto pathTask = checkTask.substituteFormula(pathFormula);
+    auto [phiStates, psiStates] = computePhiAndPsiStates(env, checkTask);
+    auto backwardTransitions = model.getAnalysisCache().getBackwardTransitions(model.getTransitionMatrix());
+
+    std::vector<std::vector<ValueType>> values;
+    if constexpr (IsCtmc<SparseModelType> || IsMa<SparseModelType>) {
+        STORM_LOG_THROW(storm::NumberTraits<ValueType>::SupportsExponential, storm::exceptions::InvalidArgumentException,
+                        "Computing bounded until probabilities is unsupported for this value type.");
+        std::vector<double> timeBounds;
+        timeBounds.reserve(upperBounds.size());
+        for (auto const& upperBound : upperBounds) {
+            timeBounds.push_back(storm::utility::convertNumber<double>(upperBound));
+        }
+        if constexpr (IsCtmc<SparseModelType>) {
+            values = helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForUpperBounds(
+                env, storm::solver::SolveGoal<ValueType>(model, pathTask), model.getTransitionMatrix(), *backwardTransitions, phiStates, psiStates,
+                model.getExitRateVector(), timeBounds);
+        } else {
+            values = helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForUpperBounds(
+                env, storm::solver::SolveGoal<ValueType>(model, pathTask), model.getTransitionMatrix(), model.getExitRates(), model.getMarkovianStates(),
+                phiStates, psiStates, timeBounds);
+        }
+    } else {
+        std::vector<uint64_t> stepBounds;
+        stepBounds.reserve(upperBounds.size());
+        for (auto const& upperBound : upperBounds) {
+            STORM_LOG_THROW(storm::utility::isInteger(upperBound) && upperBound >= storm::utility::zero<ValueType>(),
+                            storm::exceptions::InvalidArgumentException, "The step bound " << upperBound << " is not a non-negative integer.");
+            uint64_t stepBound = storm::utility::convertNumber<uint64_t>(upperBound);
+            if (pathFormula.isUpperBoundStrict()) {
+                STORM_LOG_THROW(stepBound > 0, storm::exceptions::InvalidArgumentException, "The strict step bound must be positive.");
+                --stepBound;
+            }
+            stepBounds.push_back(stepBound);
+        }
+        if constexpr (IsDtmc<SparseModelType>) {
+            helper::SparseDeterministicStepBoundedHorizonHelper<ValueType> helper;
+            values = helper.computeForUpperBounds(env, storm::solver::SolveGoal<ValueType>(model, pathTask), model.getTransitionMatrix(),
+                                                  *backwardTransitions, phiStates, psiStates, stepBounds);
+        } else {
+            helper::SparseNondeterministicStepBoundedHorizonHelper<ValueType> helper;
+            values = helper.computeForUpperBounds(env, storm::solver::SolveGoal<ValueType>(model, pathTask), model.getTransitionMatrix(),
+                                                  *backwardTransitions, phiStates, psiStates, stepBounds);
+        }
+    }
+
+    std::vector<std::unique_ptr<CheckResult>> results;
+    results.reserve(values.size());
+    for (auto& boundValues : values) {
+        std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(boundValues));
+        if (checkTask.isBoundSet()) {
+            result = result->asQuantitativeCheckResult<ValueType>().compareAgainstBound(checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+        }
+        results.push_back(std::move(result));
+    }
+    return std::make_unique<BoundSweepCheckResult<ValueType>>(upperBounds, std::move(results));
+}
+
+template class SparseBoundSweepModelChecker<storm::models::sparse::Dtmc<double>>;
+template class SparseBoundSweepModelChecker<storm::models::sparse::Mdp<double>>;
+template class SparseBoundSweepModelChecker<storm::models::sparse::Ctmc<double>>;
+template class SparseBoundSweepModelChecker<storm::models::sparse::MarkovAutomaton<double>>;
+template class SparseBoundSweepModelChecker<storm::models::sparse::Dtmc<storm::RationalNumber>>;
+template class SparseBoundSweepModelChecker<storm::models::sparse::Mdp<storm::RationalNumber>>;
+}  // namespace modelchecker
+}  // namespace storm
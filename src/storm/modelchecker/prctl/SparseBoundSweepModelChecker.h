@@ -0,0 +1,59 @@
+#ifndef STORM_MODELCHECKER_SPARSEBOUNDSWEEPMODELCHECKER_H_
+#define STORM_MODELCHECKER_SPARSEBOUNDSWEEPMODELCHECKER_H_
+
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+class CheckResult;
+
+/*!
+ * Checks a property of the form P=? [phi U<=b psi] (or P=? [F<=b psi]) on a DTMC, MDP, CTMC or (closed) Markov automaton for a whole sequence
+ * of upper bounds b at once. For the discrete-time models, the step-bounded iteration is performed only once up to the largest bound and the
+ * values are recorded at every requested bound. For CTMCs, all time bounds share the uniformized matrix and a single sweep of transient
+ * iterations. Hence, the total effort is determined by the largest bound instead of the sum of all bounds. For Markov automata, unif+ is run
+ * for each bound, but all bounds share the preprocessing and the uniformized matrices.
+ */
+template<class SparseModelType>
+class SparseBoundSweepModelChecker {
+   public:
+    typedef typename SparseModelType::ValueType ValueType;
+
+    explicit SparseBoundSweepModelChecker(SparseModelType const& model);
+
+    /*!
+     * Returns true iff the given task can be checked for a sequence of bounds. The bound that appears in the formula itself is irrelevant.
+     */
+    bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const;
+
+    /*!
+     * Checks the given (supported) task for each of the given upper bounds, which replace the upper bound of the formula. A strict upper bound
+     * in the formula is preserved, i.e. for a formula with U<b, the result for bound k is the one for U<k. For DTMCs and MDPs, the bounds
+     * have to be non-negative integers.
+     *
+     * @return A BoundSweepCheckResult with one (explicit quantitative) result per bound.
+     */
+    std::unique_ptr<CheckResult> check(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask,
+                                       std::vector<ValueType> const& upperBounds);
+
+   private:
+    /*!
+     * Computes the phi and psi states of the path formula of the given (supported) task.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> computePhiAndPsiStates(
+        Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) const;
+
+    SparseModelType const& model;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
+
+#endif /* STORM_MODELCHECKER_SPARSEBOUNDSWEEPMODELCHECKER_H_ */
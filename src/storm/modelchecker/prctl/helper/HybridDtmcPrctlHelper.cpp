@@ -1,7 +1,11 @@
 #include "storm/modelchecker/prctl/helper/HybridDtmcPrctlHelper.h"
 
+#include <algorithm>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -30,6 +34,62 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+
+/*!
+ * Computes the states in the given set that are reachable from the start states by only visiting states of the set.
+ */
+template<storm::dd::DdType DdType>
+storm::dd::Bdd<DdType> computeForwardReachableWithin(storm::dd::Bdd<DdType> const& startStates, storm::dd::Bdd<DdType> const& states,
+                                                     storm::dd::Bdd<DdType> const& transitions, std::set<storm::expressions::Variable> const& rowVariables,
+                                                     std::set<storm::expressions::Variable> const& columnVariables) {
+    storm::dd::Bdd<DdType> reachable = startStates;
+    storm::dd::Bdd<DdType> frontier = startStates;
+    while (!frontier.isZero()) {
+        frontier = frontier.relationalProduct(transitions, rowVariables, columnVariables) && states && !reachable;
+        reachable |= frontier;
+    }
+    return reachable;
+}
+
+/*!
+ * Computes the states in the given set that can reach the target states by only visiting states of the set.
+ */
+template<storm::dd::DdType DdType>
+storm::dd::Bdd<DdType> computeBackwardReachableWithin(storm::dd::Bdd<DdType> const& targetStates, storm::dd::Bdd<DdType> const& states,
+                                                      storm::dd::Bdd<DdType> const& transitions, std::set<storm::expressions::Variable> const& rowVariables,
+                                                      std::set<storm::expressions::Variable> const& columnVariables) {
+    storm::dd::Bdd<DdType> reachable = targetStates;
+    storm::dd::Bdd<DdType> frontier = targetStates;
+    while (!frontier.isZero()) {
+        frontier = frontier.inverseRelationalProduct(transitions, rowVariables, columnVariables) && states && !reachable;
+        reachable |= frontier;
+    }
+    return reachable;
+}
+
+/*!
+ * Computes one bottom SCC of the subgraph induced by the given (non-empty) set of states.
+ */
+template<storm::dd::DdType DdType>
+storm::dd::Bdd<DdType> computeBottomScc(storm::dd::Bdd<DdType> const& states, storm::dd::Bdd<DdType> const& transitions,
+                                        std::set<storm::expressions::Variable> const& rowVariables,
+                                        std::set<storm::expressions::Variable> const& columnVariables) {
+    storm::dd::Bdd<DdType> candidates = states;
+    while (true) {
+        storm::dd::Bdd<DdType> pivot = candidates.existsAbstractRepresentative(rowVariables);
+        storm::dd::Bdd<DdType> forward = computeForwardReachableWithin(pivot, states, transitions, rowVariables, columnVariables);
+        storm::dd::Bdd<DdType> backward = computeBackwardReachableWithin(pivot, forward, transitions, rowVariables, columnVariables);
+        if (forward == backward) {
+            return forward;
+        }
+        // The states that are reachable from the pivot but cannot reach it have a strictly smaller forward set which contains a bottom SCC.
+        candidates = forward && !backward;
+    }
+}
+
+}  // namespace
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -56,7 +116,9 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
                 maybeStates.template toAdd<ValueType>() * model.getManager().template getConstant<ValueType>(storm::utility::convertNumber<ValueType>(0.5))));
     } else {
         // If there are maybe states, we need to solve an equation system.
-        if (!maybeStates.isZero()) {
+        if (!maybeStates.isZero() && env.modelchecker().getHybridChunkBudget() > 0) {
+            return computeUntilProbabilitiesChunked(env, model, transitionMatrix, maybeStates, statesWithProbability01.second);
+        } else if (!maybeStates.isZero()) {
             storm::utility::Stopwatch conversionWatch;
 
             // Create the ODD for the translation between symbolic and explicit storage.
@@ -121,6 +183,90 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
     }
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilitiesChunked(
+    Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+    storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Bdd<DdType> const& prob1States) {
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    auto req = linearEquationSolverFactory.getRequirements(env);
+    req.clearLowerBounds();
+    req.clearUpperBounds();
+    STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                    "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+    bool convertToEquationSystem =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+
+    uint64_t const budget = env.modelchecker().getHybridChunkBudget();
+    // The graph between the maybe states, which determines the SCCs.
+    storm::dd::Bdd<DdType> maybeTransitions = transitionMatrix.notZero() && maybeStates && maybeStates.swapVariables(model.getRowColumnMetaVariablePairs());
+
+    // The values of all states that are solved already. Initially, these are the states with probability one.
+    storm::dd::Add<DdType, ValueType> values = prob1States.template toAdd<ValueType>();
+    uint64_t numberOfChunks = 0;
+    uint64_t maximalChunkSize = 0;
+    storm::utility::Stopwatch conversionWatch;
+    auto solveChunk = [&](storm::dd::Bdd<DdType> const& chunk) {
+        conversionWatch.start();
+        storm::dd::Odd odd = chunk.createOdd();
+        conversionWatch.stop();
+        storm::dd::Add<DdType, ValueType> chunkAdd = chunk.template toAdd<ValueType>();
+        storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * chunkAdd;
+
+        // The constant terms comprise the one-step probabilities to move to states that are solved already.
+        storm::dd::Add<DdType, ValueType> subvector =
+            (submatrix * values.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+        submatrix *= chunkAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+        if (convertToEquationSystem) {
+            submatrix = (model.getRowColumnIdentity() * chunkAdd) - submatrix;
+        }
+
+        conversionWatch.start();
+        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+        std::vector<ValueType> b = subvector.toVector(odd);
+        conversionWatch.stop();
+
+        std::vector<ValueType> x(odd.getTotalOffset(), storm::utility::convertNumber<ValueType>(0.5));
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+        solver->solveEquations(env, x, b);
+        // Only the symbolic values are kept, the explicit representation of the chunk is released.
+        values += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, odd, model.getRowVariables());
+
+        ++numberOfChunks;
+        maximalChunkSize = std::max<uint64_t>(maximalChunkSize, odd.getTotalOffset());
+    };
+
+    // Estimates the size of the explicit matrix and vectors for the given states.
+    auto estimateMemory = [&](storm::dd::Bdd<DdType> const& states) {
+        uint64_t numberOfStates = states.getNonZeroCount();
+        uint64_t numberOfEntries = (maybeTransitions && states).getNonZeroCount() + (convertToEquationSystem ? numberOfStates : 0);
+        return numberOfEntries * (sizeof(uint64_t) + sizeof(ValueType)) + numberOfStates * (sizeof(uint64_t) + 3 * sizeof(ValueType));
+    };
+
+    // Repeatedly split off bottom SCCs of the unsolved states. Their successors are solved already or contained in the current chunk.
+    storm::dd::Bdd<DdType> remainingStates = maybeStates;
+    storm::dd::Bdd<DdType> chunk = model.getManager().getBddZero();
+    uint64_t chunkMemory = 0;
+    while (!remainingStates.isZero()) {
+        storm::dd::Bdd<DdType> scc = computeBottomScc(remainingStates, maybeTransitions, model.getRowVariables(), model.getColumnVariables());
+        uint64_t sccMemory = estimateMemory(scc);
+        STORM_LOG_INFO_COND(sccMemory <= budget, "SCC with " << scc.getNonZeroCount() << " states exceeds the memory budget of the hybrid chunks.");
+        if (!chunk.isZero() && chunkMemory + sccMemory > budget) {
+            solveChunk(chunk);
+            chunk = model.getManager().getBddZero();
+            chunkMemory = 0;
+        }
+        chunk |= scc;
+        chunkMemory += sccMemory;
+        remainingStates &= !scc;
+    }
+    solveChunk(chunk);
+    STORM_LOG_INFO("Solved " << maybeStates.getNonZeroCount() << " maybe states in " << numberOfChunks << " chunks with at most " << maximalChunkSize
+                             << " states. Converting between symbolic and explicit representation took " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+    return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), values));
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeGloballyProbabilities(
     Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
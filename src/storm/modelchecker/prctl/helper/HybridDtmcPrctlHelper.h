@@ -57,6 +57,20 @@ class HybridDtmcPrctlHelper {
     static std::unique_ptr<CheckResult> computeReachabilityTimes(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                                  storm::dd::Add<DdType, ValueType> const& transitionMatrix,
                                                                  storm::dd::Bdd<DdType> const& targetStates, bool qualitative);
+
+   private:
+    /*!
+     * Computes the until probabilities of the maybe states by converting and solving the equation system one chunk of SCCs at a time. The chunks are
+     * processed in topological order (successors first) and each one is made as large as the memory budget of the environment allows for its explicit
+     * representation. The values of the solved states are kept symbolically and enter the equation systems of the remaining chunks as constant terms.
+     *
+     * @param maybeStates The states whose probability is neither zero nor one.
+     * @param prob1States The states with probability one.
+     * @return The (symbolic) result.
+     */
+    static std::unique_ptr<CheckResult> computeUntilProbabilitiesChunked(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                         storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                                                         storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Bdd<DdType> const& prob1States);
 };
 
 }  // namespace helper
@@ -0,0 +1,167 @@
+#include "storm/modelchecker/prctl/helper/SparseBatchedPrctlHelper.h"
+
+#include <algorithm>
+#include <array>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/models/sparse/AnalysisCache.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseBatchedPrctlHelper<ValueType>::computeUntilProbabilities(
+    Environment const& env, std::optional<storm::OptimizationDirection> const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<storm::storage::BitVector> const& phiStates,
+    std::vector<storm::storage::BitVector> const& psiStates, storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
+    STORM_LOG_THROW(phiStates.size() == psiStates.size(), storm::exceptions::IllegalArgumentException,
+                    "The number of phi states (" << phiStates.size() << ") does not match the number of psi states (" << psiStates.size() << ").");
+    bool const deterministic = transitionMatrix.hasTrivialRowGrouping();
+    STORM_LOG_THROW(deterministic || dir.has_value(), storm::exceptions::IllegalArgumentException,
+                    "An optimization direction is required for nondeterministic models.");
+
+    // Perform the qualitative analysis for every property.
+    typedef typename storm::models::sparse::AnalysisCache<ValueType>::QualitativeAnalysis QualitativeAnalysis;
+    QualitativeAnalysis analysis = QualitativeAnalysis::Prob01;
+    if (!deterministic) {
+        analysis = minimize(*dir) ? QualitativeAnalysis::Prob01Min : QualitativeAnalysis::Prob01Max;
+    }
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> statesWithProbability01;
+    statesWithProbability01.reserve(phiStates.size());
+    for (uint64_t property = 0; property < phiStates.size(); ++property) {
+        auto computeStatesWithProbability01 = [&]() {
+            storm::storage::BitVector const& phi = phiStates[property];
+            storm::storage::BitVector const& psi = psiStates[property];
+            if (analysis == QualitativeAnalysis::Prob01) {
+                return storm::utility::graph::performProb01(backwardTransitions, phi, psi);
+            } else if (analysis == QualitativeAnalysis::Prob01Min) {
+                return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phi, psi);
+            } else {
+                return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phi, psi);
+            }
+        };
+        if (analysisCache) {
+            statesWithProbability01.push_back(
+                *analysisCache->getQualitativeStateSets(analysis, phiStates[property], psiStates[property], computeStatesWithProbability01));
+        } else {
+            statesWithProbability01.push_back(computeStatesWithProbability01());
+        }
+    }
+
+    // Solve the properties in batches. The number of lanes is the smallest supported width that fits the batch.
+    std::vector<std::vector<ValueType>> result(phiStates.size());
+    for (uint64_t first = 0; first < phiStates.size(); first += MaximalBatchSize) {
+        uint64_t count = std::min<uint64_t>(MaximalBatchSize, phiStates.size() - first);
+        STORM_LOG_INFO("Solving properties " << first << " to " << first + count - 1 << " in one batch.");
+        if (count <= 2) {
+            deterministic ? solveBatch<2, true>(env, dir, transitionMatrix, statesWithProbability01, first, count, result)
+                          : solveBatch<2, false>(env, dir, transitionMatrix, statesWithProbability01, first, count, result);
+        } else if (count <= 4) {
+            deterministic ? solveBatch<4, true>(env, dir, transitionMatrix, statesWithProbability01, first, count, result)
+                          : solveBatch<4, false>(env, dir, transitionMatrix, statesWithProbability01, first, count, result);
+        } else {
+            deterministic ? solveBatch<8, true>(env, dir, transitionMatrix, statesWithProbability01, first, count, result)
+                          : solveBatch<8, false>(env, dir, transitionMatrix, statesWithProbability01, first, count, result);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+template<uint64_t Lanes, bool TrivialRowGrouping>
+void SparseBatchedPrctlHelper<ValueType>::solveBatch(
+    Environment const& env, std::optional<storm::OptimizationDirection> const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> const& statesWithProbability01, uint64_t first, uint64_t count,
+    std::vector<std::vector<ValueType>>& result) {
+    STORM_LOG_ASSERT(count <= Lanes, "Too many properties for a batch with " << Lanes << " lanes.");
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+
+    // Lanes that are not occupied by a property are never updated, so their values remain zero.
+    uint64_t const unusedLanes = ~((1ull << count) - 1);
+    std::array<ValueType, Lanes> zeros;
+    zeros.fill(storm::utility::zero<ValueType>());
+    std::vector<std::array<ValueType, Lanes>> operand(numberOfStates, zeros);
+    std::vector<uint64_t> fixedLanes(numberOfStates, unusedLanes);
+    bool hasMaybeStates = false;
+    for (uint64_t lane = 0; lane < count; ++lane) {
+        auto const& [statesWithProbability0, statesWithProbability1] = statesWithProbability01[first + lane];
+        for (auto state : statesWithProbability0) {
+            fixedLanes[state] |= 1ull << lane;
+        }
+        for (auto state : statesWithProbability1) {
+            operand[state][lane] = storm::utility::one<ValueType>();
+            fixedLanes[state] |= 1ull << lane;
+        }
+        hasMaybeStates |= statesWithProbability0.getNumberOfSetBits() + statesWithProbability1.getNumberOfSetBits() < numberOfStates;
+    }
+
+    if (hasMaybeStates) {
+        // Obtain the parameters of the solver that would be used for the single properties.
+        ValueType precision;
+        bool relative;
+        uint64_t maximalNumberOfIterations;
+        storm::solver::MultiplicationStyle multiplicationStyle;
+        if constexpr (TrivialRowGrouping) {
+            precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            relative = env.solver().native().getRelativeTerminationCriterion();
+            maximalNumberOfIterations = env.solver().native().getMaximalNumberOfIterations();
+            multiplicationStyle = env.solver().native().getPowerMethodMultiplicationStyle();
+        } else {
+            precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            relative = env.solver().minMax().getRelativeTerminationCriterion();
+            maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+            multiplicationStyle = env.solver().minMax().getMultiplicationStyle();
+        }
+
+        auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, TrivialRowGrouping>>();
+        viOperator->setMatrixBackwards(transitionMatrix);
+        viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
+        storm::solver::helper::ValueIterationHelper<ValueType, TrivialRowGrouping> viHelper(viOperator);
+        std::vector<ValueType> offsets(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+        uint64_t numIterations{0};
+        auto callback = [&](storm::solver::SolverStatus const& current) {
+            if (current == storm::solver::SolverStatus::InProgress) {
+                if (storm::utility::resources::isTerminate()) {
+                    return storm::solver::SolverStatus::Aborted;
+                } else if (numIterations >= maximalNumberOfIterations) {
+                    return storm::solver::SolverStatus::MaximalIterationsExceeded;
+                }
+            }
+            return current;
+        };
+        auto status = viHelper.template batchVI<Lanes>(operand, offsets, numIterations, relative, precision, dir, &fixedLanes, callback, multiplicationStyle);
+        STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged,
+                            "Batched value iteration did not converge within " << numIterations << " iterations.");
+        STORM_LOG_INFO("Batched value iteration for " << count << " properties took " << numIterations << " iterations.");
+    }
+
+    for (uint64_t lane = 0; lane < count; ++lane) {
+        std::vector<ValueType>& values = result[first + lane];
+        values.reserve(numberOfStates);
+        for (auto const& laneValues : operand) {
+            values.push_back(laneValues[lane]);
+        }
+    }
+}
+
+template class SparseBatchedPrctlHelper<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SparseBatchedPrctlHelper<storm::RationalNumber>;
+#endif
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,68 @@
+#ifndef STORM_MODELCHECKER_SPARSE_BATCHED_PRCTL_MODELCHECKER_HELPER_H_
+#define STORM_MODELCHECKER_SPARSE_BATCHED_PRCTL_MODELCHECKER_HELPER_H_
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+class Environment;
+
+namespace models {
+namespace sparse {
+template<typename ValueType>
+class AnalysisCache;
+}  // namespace sparse
+}  // namespace models
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Computes the probabilities of several until formulas on the same model at once. Instead of solving one equation system per property, the values
+ * of (up to MaximalBatchSize) properties are interleaved such that a single value iteration sweep over the transition matrix updates all of them.
+ * This mainly pays off for large models where the iterations are bound by the memory bandwidth required to traverse the matrix.
+ *
+ * All properties are solved on the full transition matrix, where the states with probability zero or one of a property are excluded from the
+ * updates of that property. Value iteration starts from below, so no end component elimination is needed.
+ */
+template<typename ValueType>
+class SparseBatchedPrctlHelper {
+   public:
+    /// The maximal number of properties that are solved in a single batch.
+    static constexpr uint64_t MaximalBatchSize = 8;
+
+    /*!
+     * Computes the probabilities of the until formulas given by the i'th phi and psi states, respectively.
+     * @param dir The optimization direction for all properties. Must be given iff the transition matrix has a nontrivial row grouping.
+     * @return For each property, the probability of every state.
+     */
+    static std::vector<std::vector<ValueType>> computeUntilProbabilities(Environment const& env, std::optional<storm::OptimizationDirection> const& dir,
+                                                                         storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                         std::vector<storm::storage::BitVector> const& phiStates,
+                                                                         std::vector<storm::storage::BitVector> const& psiStates,
+                                                                         storm::models::sparse::AnalysisCache<ValueType>* analysisCache = nullptr);
+
+   private:
+    /*!
+     * Solves the properties first, ..., first + count - 1 in one batch with the given number of lanes (which has to be at least count).
+     * @param statesWithProbability01 for each property, the states with probability zero and one, respectively.
+     */
+    template<uint64_t Lanes, bool TrivialRowGrouping>
+    static void solveBatch(Environment const& env, std::optional<storm::OptimizationDirection> const& dir,
+                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                           std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> const& statesWithProbability01, uint64_t first,
+                           uint64_t count, std::vector<std::vector<ValueType>>& result);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
+
+#endif /* STORM_MODELCHECKER_SPARSE_BATCHED_PRCTL_MODELCHECKER_HELPER_H_ */
@@ -19,13 +19,13 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
-#include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
-#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/io/export.h"
 #include "storm/utility/ProgressMeasurement.h"
@@ -46,15 +46,16 @@ namespace modelchecker {
 namespace helper {
 
 template<>
-std::map<storm::storage::sparse::state_type, storm::RationalFunction> SparseDtmcPrctlHelper<storm::RationalFunction>::computeRewardBoundedValues(
+boost::container::flat_map<storm::storage::sparse::state_type, storm::RationalFunction>
+SparseDtmcPrctlHelper<storm::RationalFunction>::computeRewardBoundedValues(
     Environment const& env, storm::models::sparse::Dtmc<storm::RationalFunction> const& model,
     std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The specified property is not supported by this value type.");
-    return std::map<storm::storage::sparse::state_type, storm::RationalFunction>();
+    return boost::container::flat_map<storm::storage::sparse::state_type, storm::RationalFunction>();
 }
 
 template<typename ValueType, typename RewardModelType>
-std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(
+boost::container::flat_map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(
     Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula) {
     storm::utility::Stopwatch swAll(true), swBuild, swCheck;
 
@@ -73,8 +74,10 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
 
     Environment preciseEnv = env;
+    // Solvers without a precision (i.e., elimination) fall back to the precision of the min-max equation solver.
+    auto requestedPrecision = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType()).first;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
-        initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
+        initEpoch, storm::utility::convertNumber<ValueType>(requestedPrecision ? requestedPrecision.get() : env.solver().minMax().getPrecision()));
     preciseEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
 
     // In case of cdf export we store the necessary data.
@@ -88,13 +91,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto processAnalyzedEpoch = [&](auto const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -108,12 +105,45 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+    uint64_t numberOfThreads = env.solver().getNumberOfThreads();
+    if (numberOfThreads <= 1) {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            processAnalyzedEpoch(epoch);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+    } else {
+        // Epochs on the same level are independent. Each thread analyzes them with its own solver, which is kept as long as the epoch class is unchanged.
+        // The solvers themselves run sequentially to not oversubscribe the threads.
+        Environment threadEnv = preciseEnv;
+        threadEnv.solver().setNumberOfThreads(1);
+        std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+        swCheck.start();
+        for (auto const& level : rewardUnfolding.getEpochComputationLevels(epochOrder)) {
+            rewardUnfolding.analyzeEpochs(level, numberOfThreads, [&](uint64_t threadIndex, auto& epochModel) {
+                return epochModel.analyzeSingleObjective(threadEnv, threadX[threadIndex], threadB[threadIndex], threadSolvers[threadIndex], lowerBound,
+                                                         upperBound);
+            });
+            for (auto const& epoch : level) {
+                processAnalyzedEpoch(epoch);
+            }
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
+        swCheck.stop();
     }
 
-    std::map<storm::storage::sparse::state_type, ValueType> result;
+    boost::container::flat_map<storm::storage::sparse::state_type, ValueType> result;
     for (auto initState : model.getInitialStates()) {
         result[initState] = rewardUnfolding.getInitialStateResult(initEpoch, initState);
     }
@@ -148,7 +178,7 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, ModelCheckerHint const& hint) {
+    bool qualitative, ModelCheckerHint const& hint, storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
@@ -176,8 +206,15 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                                          << " states remaining).");
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
-        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        // If an analysis cache is given, the state sets are shared with other properties with the same phi and psi states.
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        if (analysisCache) {
+            statesWithProbability01 =
+                *analysisCache->getQualitativeStateSets(storm::models::sparse::AnalysisCache<ValueType>::QualitativeAnalysis::Prob01, phiStates, psiStates,
+                                                        [&]() { return storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates); });
+        } else {
+            statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        }
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -207,8 +244,13 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // We can eliminate the rows and columns from the original transition probability matrix.
-            storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
+            // We can eliminate the rows and columns from the original transition probability matrix. In the same pass, we prepare the
+            // right-hand side of the equation system. For entry i this corresponds to the accumulated probability of going from state i
+            // to some 'yes' state.
+            auto submatrixAndB = transitionMatrix.getSubmatrixAndConstrainedRowGroupSumVector(maybeStates, maybeStates, statesWithProbability1,
+                                                                                              convertToEquationSystem, env.solver().getNumberOfThreads());
+            storm::storage::SparseMatrix<ValueType> submatrix = std::move(submatrixAndB.first);
+            std::vector<ValueType> b = std::move(submatrixAndB.second);
             if (convertToEquationSystem) {
                 // Converting the matrix from the fixpoint notation to the form needed for the equation
                 // system. That is, we go from x = A*x + b to (I-A)x = b.
@@ -225,10 +267,6 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                 x = std::vector<ValueType>(maybeStates.getNumberOfSetBits(), storm::utility::convertNumber<ValueType>(0.5));
             }
 
-            // Prepare the right-hand side of the equation system. For entry i this corresponds to
-            // the accumulated probability of going from state i to some 'yes' state.
-            std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability1);
-
             // Now solve the created system of linear equations.
             goal.restrictRelevantValues(maybeStates);
             std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver =
@@ -309,10 +347,12 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative,
+    storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
     goal.oneMinus();
-    std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions,
-                                                              storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative);
+    std::vector<ValueType> result =
+        computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true),
+                                  ~psiStates, qualitative, ModelCheckerHint(), analysisCache);
     for (auto& entry : result) {
         entry = storm::utility::one<ValueType>() - entry;
     }
@@ -447,7 +487,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 
     // Determine which states have reward zero
     storm::storage::BitVector rew0States;
-    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isFilterRewZeroSet()) {
+    if (env.modelchecker().isFilterRewZeroSet()) {
         rew0States = storm::utility::graph::performProb1(backwardTransitions, zeroRewardStatesGetter(), targetStates);
     } else {
         rew0States = targetStates;
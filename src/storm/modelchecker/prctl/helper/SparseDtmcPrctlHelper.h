@@ -3,9 +3,11 @@
 
 #include <vector>
 
+#include <boost/container/flat_map.hpp>
 #include <boost/optional.hpp>
 
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
+#include "storm/models/sparse/AnalysisCache.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -26,7 +28,7 @@ namespace helper {
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
 class SparseDtmcPrctlHelper {
    public:
-    static std::map<storm::storage::sparse::state_type, ValueType> computeRewardBoundedValues(
+    static boost::container::flat_map<storm::storage::sparse::state_type, ValueType> computeRewardBoundedValues(
         Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula);
 
     static std::vector<ValueType> computeNextProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -36,7 +38,8 @@ class SparseDtmcPrctlHelper {
                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                            storm::models::sparse::AnalysisCache<ValueType>* analysisCache = nullptr);
 
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -46,7 +49,8 @@ class SparseDtmcPrctlHelper {
     static std::vector<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                               storm::storage::BitVector const& psiStates, bool qualitative);
+                                                               storm::storage::BitVector const& psiStates, bool qualitative,
+                                                               storm::models::sparse::AnalysisCache<ValueType>* analysisCache = nullptr);
 
     static std::vector<ValueType> computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix, RewardModelType const& rewardModel,
@@ -1,6 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/FlatMaximalEndComponentDecomposition.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/graph.h"
@@ -13,8 +14,9 @@ namespace modelchecker {
 namespace helper {
 
 template<typename ValueType>
-SparseMdpEndComponentInformation<ValueType>::SparseMdpEndComponentInformation(
-    storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition, storm::storage::BitVector const& maybeStates)
+template<typename DecompositionType>
+SparseMdpEndComponentInformation<ValueType>::SparseMdpEndComponentInformation(DecompositionType const& endComponentDecomposition,
+                                                                              storm::storage::BitVector const& maybeStates)
     : NOT_IN_EC(std::numeric_limits<uint64_t>::max()),
       eliminatedEndComponents(!endComponentDecomposition.empty()),
       numberOfMaybeStatesInEc(0),
@@ -97,8 +99,9 @@ uint64_t SparseMdpEndComponentInformation<ValueType>::getNotInEcMarker() const {
 }
 
 template<typename ValueType>
+template<typename DecompositionType>
 SparseMdpEndComponentInformation<ValueType> SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(
-    storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition,
+    DecompositionType const& endComponentDecomposition,
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const* sumColumns,
     storm::storage::BitVector const* selectedChoices, std::vector<ValueType> const* summand, storm::storage::SparseMatrix<ValueType>& submatrix,
     std::vector<ValueType>* columnSumVector, std::vector<ValueType>* summandResultVector, bool gatherExitChoices) {
@@ -236,8 +239,9 @@ SparseMdpEndComponentInformation<ValueType> SparseMdpEndComponentInformation<Val
 }
 
 template<typename ValueType>
+template<typename DecompositionType>
 SparseMdpEndComponentInformation<ValueType> SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(
-    storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition,
+    DecompositionType const& endComponentDecomposition,
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>& rhsVector, storm::storage::BitVector const& maybeStates,
     storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& subvector, bool gatherExitChoices) {
     SparseMdpEndComponentInformation<ValueType> result(endComponentDecomposition, maybeStates);
@@ -408,9 +412,47 @@ void SparseMdpEndComponentInformation<ValueType>::setScheduler(storm::storage::S
 }
 
 template class SparseMdpEndComponentInformation<double>;
+template SparseMdpEndComponentInformation<double>::SparseMdpEndComponentInformation(
+    storm::storage::MaximalEndComponentDecomposition<double> const&, storm::storage::BitVector const&);
+template SparseMdpEndComponentInformation<double> SparseMdpEndComponentInformation<double>::eliminateEndComponents(
+    storm::storage::MaximalEndComponentDecomposition<double> const&, storm::storage::SparseMatrix<double> const&, storm::storage::BitVector const&,
+    storm::storage::BitVector const*, storm::storage::BitVector const*, std::vector<double> const*, storm::storage::SparseMatrix<double>&, std::vector<double>*,
+    std::vector<double>*, bool);
+template SparseMdpEndComponentInformation<double> SparseMdpEndComponentInformation<double>::eliminateEndComponents(
+    storm::storage::MaximalEndComponentDecomposition<double> const&, storm::storage::SparseMatrix<double> const&, std::vector<double>&,
+    storm::storage::BitVector const&, storm::storage::SparseMatrix<double>&, std::vector<double>&, bool);
+template SparseMdpEndComponentInformation<double>::SparseMdpEndComponentInformation(
+    storm::storage::FlatMaximalEndComponentDecomposition const&, storm::storage::BitVector const&);
+template SparseMdpEndComponentInformation<double> SparseMdpEndComponentInformation<double>::eliminateEndComponents(
+    storm::storage::FlatMaximalEndComponentDecomposition const&, storm::storage::SparseMatrix<double> const&, storm::storage::BitVector const&,
+    storm::storage::BitVector const*, storm::storage::BitVector const*, std::vector<double> const*, storm::storage::SparseMatrix<double>&, std::vector<double>*,
+    std::vector<double>*, bool);
+template SparseMdpEndComponentInformation<double> SparseMdpEndComponentInformation<double>::eliminateEndComponents(
+    storm::storage::FlatMaximalEndComponentDecomposition const&, storm::storage::SparseMatrix<double> const&, std::vector<double>&,
+    storm::storage::BitVector const&, storm::storage::SparseMatrix<double>&, std::vector<double>&, bool);
 
 #ifdef STORM_HAVE_CARL
 template class SparseMdpEndComponentInformation<storm::RationalNumber>;
+template SparseMdpEndComponentInformation<storm::RationalNumber>::SparseMdpEndComponentInformation(
+    storm::storage::MaximalEndComponentDecomposition<storm::RationalNumber> const&, storm::storage::BitVector const&);
+template SparseMdpEndComponentInformation<storm::RationalNumber> SparseMdpEndComponentInformation<storm::RationalNumber>::eliminateEndComponents(
+    storm::storage::MaximalEndComponentDecomposition<storm::RationalNumber> const&, storm::storage::SparseMatrix<storm::RationalNumber> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const*, storm::storage::BitVector const*, std::vector<storm::RationalNumber> const*,
+    storm::storage::SparseMatrix<storm::RationalNumber>&, std::vector<storm::RationalNumber>*, std::vector<storm::RationalNumber>*, bool);
+template SparseMdpEndComponentInformation<storm::RationalNumber> SparseMdpEndComponentInformation<storm::RationalNumber>::eliminateEndComponents(
+    storm::storage::MaximalEndComponentDecomposition<storm::RationalNumber> const&, storm::storage::SparseMatrix<storm::RationalNumber> const&,
+    std::vector<storm::RationalNumber>&, storm::storage::BitVector const&, storm::storage::SparseMatrix<storm::RationalNumber>&,
+    std::vector<storm::RationalNumber>&, bool);
+template SparseMdpEndComponentInformation<storm::RationalNumber>::SparseMdpEndComponentInformation(
+    storm::storage::FlatMaximalEndComponentDecomposition const&, storm::storage::BitVector const&);
+template SparseMdpEndComponentInformation<storm::RationalNumber> SparseMdpEndComponentInformation<storm::RationalNumber>::eliminateEndComponents(
+    storm::storage::FlatMaximalEndComponentDecomposition const&, storm::storage::SparseMatrix<storm::RationalNumber> const&, storm::storage::BitVector const&,
+    storm::storage::BitVector const*, storm::storage::BitVector const*, std::vector<storm::RationalNumber> const*,
+    storm::storage::SparseMatrix<storm::RationalNumber>&, std::vector<storm::RationalNumber>*, std::vector<storm::RationalNumber>*, bool);
+template SparseMdpEndComponentInformation<storm::RationalNumber> SparseMdpEndComponentInformation<storm::RationalNumber>::eliminateEndComponents(
+    storm::storage::FlatMaximalEndComponentDecomposition const&, storm::storage::SparseMatrix<storm::RationalNumber> const&,
+    std::vector<storm::RationalNumber>&, storm::storage::BitVector const&, storm::storage::SparseMatrix<storm::RationalNumber>&,
+    std::vector<storm::RationalNumber>&, bool);
 // template class SparseMdpEndComponentInformation<storm::RationalFunction>;
 #endif
 
@@ -23,8 +23,12 @@ namespace helper {
 template<typename ValueType>
 class SparseMdpEndComponentInformation {
    public:
-    SparseMdpEndComponentInformation(storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition,
-                                     storm::storage::BitVector const& maybeStates);
+    /*!
+     * Creates the information about the given end components, which can be given as a MaximalEndComponentDecomposition or a
+     * FlatMaximalEndComponentDecomposition.
+     */
+    template<typename DecompositionType>
+    SparseMdpEndComponentInformation(DecompositionType const& endComponentDecomposition, storm::storage::BitVector const& maybeStates);
 
     bool isMaybeStateInEc(uint64_t maybeState) const;
     bool isStateInEc(uint64_t state) const;
@@ -54,15 +58,17 @@ class SparseMdpEndComponentInformation {
 
     uint64_t getNotInEcMarker() const;
 
+    template<typename DecompositionType>
     static SparseMdpEndComponentInformation<ValueType> eliminateEndComponents(
-        storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition,
+        DecompositionType const& endComponentDecomposition,
         storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates,
         storm::storage::BitVector const* sumColumns, storm::storage::BitVector const* selectedChoices, std::vector<ValueType> const* summand,
         storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>* columnSumVector, std::vector<ValueType>* summandResultVector,
         bool gatherExitChoices = false);
 
+    template<typename DecompositionType>
     static SparseMdpEndComponentInformation<ValueType> eliminateEndComponents(
-        storm::storage::MaximalEndComponentDecomposition<ValueType> const& endComponentDecomposition,
+        DecompositionType const& endComponentDecomposition,
         storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>& rhsVector, storm::storage::BitVector const& maybeStates,
         storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& subvector, bool gatherExitChoices = false);
 
@@ -7,9 +7,11 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/AnalysisCache.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/storage/FlatMaximalEndComponentDecomposition.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 
 #include "storm/utility/graph.h"
@@ -26,9 +28,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
-#include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
-#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/io/export.h"
 #include "storm/utility/NumberTraits.h"
@@ -38,7 +38,9 @@
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -53,7 +55,7 @@ namespace modelchecker {
 namespace helper {
 
 template<typename ValueType>
-std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<ValueType>::computeRewardBoundedValues(
+boost::container::flat_map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<ValueType>::computeRewardBoundedValues(
     Environment const& env, OptimizationDirection dir, rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding,
     storm::storage::BitVector const& initialStates) {
     storm::utility::Stopwatch swAll(true), swBuild, swCheck;
@@ -70,8 +72,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     std::vector<ValueType> x, b;
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
 
-    ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
-        initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
+    ValueType precision =
+        rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
     Environment preciseEnv = env;
     preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
 
@@ -82,13 +84,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto processAnalyzedEpoch = [&](auto const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -102,12 +98,45 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+    uint64_t numberOfThreads = env.solver().getNumberOfThreads();
+    if (numberOfThreads <= 1) {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            swCheck.stop();
+            processAnalyzedEpoch(epoch);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
+    } else {
+        // Epochs on the same level are independent. Each thread analyzes them with its own solver, which is kept as long as the epoch class is unchanged.
+        // The solvers themselves run sequentially to not oversubscribe the threads.
+        Environment threadEnv = preciseEnv;
+        threadEnv.solver().setNumberOfThreads(1);
+        std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+        swCheck.start();
+        for (auto const& level : rewardUnfolding.getEpochComputationLevels(epochOrder)) {
+            rewardUnfolding.analyzeEpochs(level, numberOfThreads, [&](uint64_t threadIndex, auto& epochModel) {
+                return epochModel.analyzeSingleObjective(threadEnv, dir, threadX[threadIndex], threadB[threadIndex], threadSolvers[threadIndex], lowerBound,
+                                                         upperBound);
+            });
+            for (auto const& epoch : level) {
+                processAnalyzedEpoch(epoch);
+            }
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+        swCheck.stop();
     }
 
-    std::map<storm::storage::sparse::state_type, ValueType> result;
+    boost::container::flat_map<storm::storage::sparse::state_type, ValueType> result;
     for (auto initState : initialStates) {
         result[initState] = rewardUnfolding.getInitialStateResult(initEpoch, initState);
     }
@@ -513,17 +542,26 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
+    auto computeStatesWithProbability01 = [&]() {
+        if (goal.minimize()) {
+            return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        } else {
+            return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        }
+    };
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    if (analysisCache) {
+        // Share the state sets with other properties with the same phi and psi states (and optimization direction).
+        typedef typename storm::models::sparse::AnalysisCache<ValueType>::QualitativeAnalysis QualitativeAnalysis;
+        statesWithProbability01 = *analysisCache->getQualitativeStateSets(goal.minimize() ? QualitativeAnalysis::Prob01Min : QualitativeAnalysis::Prob01Max,
+                                                                          phiStates, psiStates, computeStatesWithProbability01);
     } else {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        statesWithProbability01 = computeStatesWithProbability01();
     }
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
@@ -537,11 +575,12 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint,
+                                                                                 storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, analysisCache);
     }
 }
 
@@ -581,14 +620,14 @@ void extendScheduler(storm::storage::Scheduler<ValueType>& scheduler, storm::sol
 template<typename ValueType>
 void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
-                                               storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b) {
+                                               storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, uint64_t numberOfThreads) {
     // First, we can eliminate the rows and columns from the original transition probability matrix for states
-    // whose probabilities are already known.
-    submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
-
-    // Prepare the right-hand side of the equation system. For entry i this corresponds to
-    // the accumulated probability of going from state i to some state that has probability 1.
-    b = transitionMatrix.getConstrainedRowGroupSumVector(qualitativeStateSets.maybeStates, qualitativeStateSets.statesWithProbability1);
+    // whose probabilities are already known. In the same pass, we prepare the right-hand side of the equation system. For entry i
+    // this corresponds to the accumulated probability of going from state i to some state that has probability 1.
+    auto submatrixAndB = transitionMatrix.getSubmatrixAndConstrainedRowGroupSumVector(
+        qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, qualitativeStateSets.statesWithProbability1, false, numberOfThreads);
+    submatrix = std::move(submatrixAndB.first);
+    b = std::move(submatrixAndB.second);
 
     // If the solve goal has relevant values, we need to adjust them.
     goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
@@ -598,24 +637,30 @@ template<typename ValueType>
 boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
     storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
-    storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
+    storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler,
+    storm::models::sparse::AnalysisCache<ValueType>* analysisCache, uint64_t numberOfThreads) {
     // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
     storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(
         transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.maybeStates);
 
     bool doDecomposition = !candidateStates.empty();
 
-    storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> endComponentDecompositionPtr;
     if (doDecomposition) {
         // Compute the states that are in MECs.
-        endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+        if (analysisCache) {
+            endComponentDecompositionPtr = analysisCache->getMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, candidateStates);
+        } else {
+            endComponentDecompositionPtr =
+                std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, candidateStates);
+        }
     }
 
     // Only do more work if there are actually end-components.
-    if (doDecomposition && !endComponentDecomposition.empty()) {
-        STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " EC(s).");
+    if (doDecomposition && !endComponentDecompositionPtr->empty()) {
+        STORM_LOG_DEBUG("Eliminating " << endComponentDecompositionPtr->size() << " EC(s).");
         SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(
-            endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr,
+            *endComponentDecompositionPtr, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr,
             submatrix, &b, nullptr, produceScheduler);
 
         // If the solve goal has relevant values, we need to adjust them.
@@ -634,7 +679,7 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
         return result;
     } else {
         STORM_LOG_DEBUG("Not eliminating ECs as there are none.");
-        computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
+        computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b, numberOfThreads);
 
         return boost::none;
     }
@@ -644,7 +689,7 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
 
@@ -654,7 +699,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, analysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -698,11 +743,12 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             // If the hint information tells us that we have to eliminate MECs, we do so now.
             boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
             if (hintInformation.getEliminateEndComponents()) {
-                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions,
-                                                                                                qualitativeStateSets, submatrix, b, produceScheduler);
+                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
+                    goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler, analysisCache,
+                    env.solver().getNumberOfThreads());
             } else {
                 // Otherwise, we compute the standard equations.
-                computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
+                computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b, env.solver().getNumberOfThreads());
             }
 
             // Now compute the results for the maybe states.
@@ -745,24 +791,31 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
-    bool useMecBasedTechnique) {
+    bool useMecBasedTechnique, storm::models::sparse::AnalysisCache<ValueType>* analysisCache) {
     if (useMecBasedTechnique) {
         // TODO: does this really work for minimizing objectives?
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
+        std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecomposition;
+        if (analysisCache) {
+            mecDecomposition = analysisCache->getMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, psiStates);
+        } else {
+            mecDecomposition =
+                std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, psiStates);
+        }
         storm::storage::BitVector statesInPsiMecs(transitionMatrix.getRowGroupCount());
-        for (auto const& mec : mecDecomposition) {
+        for (auto const& mec : *mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
                 statesInPsiMecs.set(stateActionsPair.first, true);
             }
         }
 
         return computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, statesInPsiMecs, qualitative,
-                                         produceScheduler);
+                                         produceScheduler, ModelCheckerHint(), analysisCache);
     } else {
         goal.oneMinus();
         auto result =
             computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions,
-                                      storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler);
+                                      storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler,
+                                      ModelCheckerHint(), analysisCache);
         for (auto& element : result.values) {
             element = storm::utility::one<ValueType>() - element;
         }
@@ -1004,7 +1057,7 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
 
 template<typename ValueType>
 QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityRewards(
-    storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    Environment const& env, storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
     QualitativeStateSetsReachabilityRewards result;
@@ -1018,7 +1071,7 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
     }
     result.infinityStates.complement();
 
-    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isFilterRewZeroSet()) {
+    if (env.modelchecker().isFilterRewZeroSet()) {
         if (goal.minimize()) {
             result.rewardZeroStates = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
                                                                            trueStates, targetStates, zeroRewardChoicesGetter());
@@ -1034,7 +1087,7 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
 }
 
 template<typename ValueType>
-QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(storm::solver::SolveGoal<ValueType> const& goal,
+QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal,
                                                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                    storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
@@ -1043,7 +1096,7 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsReachabilityRewardsFromHint<ValueType>(hint, targetStates);
     } else {
-        return computeQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
+        return computeQualitativeStateSetsReachabilityRewards(env, goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
                                                               zeroRewardChoicesGetter);
     }
 }
@@ -1104,12 +1157,16 @@ void computeFixedPointSystemReachabilityRewards(
     // Remove rows and columns from the original transition probability matrix for states whose reward values are already known.
     // If there are infinity states, we additionally have to remove choices of maybeState that lead to infinity.
     if (qualitativeStateSets.infinityStates.empty()) {
-        submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
-        b = totalStateRewardVectorGetter(submatrix.getRowCount(), transitionMatrix, qualitativeStateSets.maybeStates);
         if (oneStepTargetProbabilities) {
-            (*oneStepTargetProbabilities) =
-                transitionMatrix.getConstrainedRowGroupSumVector(qualitativeStateSets.maybeStates, qualitativeStateSets.rewardZeroStates);
+            // Compute the probabilities to reach the target in one step in the same pass as the submatrix.
+            auto submatrixAndOneStepTargetProbabilities = transitionMatrix.getSubmatrixAndConstrainedRowGroupSumVector(
+                qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, qualitativeStateSets.rewardZeroStates);
+            submatrix = std::move(submatrixAndOneStepTargetProbabilities.first);
+            (*oneStepTargetProbabilities) = std::move(submatrixAndOneStepTargetProbabilities.second);
+        } else {
+            submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
         }
+        b = totalStateRewardVectorGetter(submatrix.getRowCount(), transitionMatrix, qualitativeStateSets.maybeStates);
     } else {
         submatrix = transitionMatrix.getSubmatrix(false, *selectedChoices, qualitativeStateSets.maybeStates, false);
         b = totalStateRewardVectorGetter(transitionMatrix.getRowCount(), transitionMatrix,
@@ -1171,11 +1228,12 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
 
     bool doDecomposition = !candidateStates.empty();
 
-    storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+    // The decomposition is only needed for eliminating the end components, so we store it in the flat representation.
+    storm::storage::FlatMaximalEndComponentDecomposition endComponentDecomposition;
     if (doDecomposition) {
         // Then compute the states that are in MECs with zero reward.
         endComponentDecomposition =
-            storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+            storm::storage::FlatMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
     }
 
     // Only do more work if there are actually end-components.
@@ -1236,7 +1294,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
 
     // Determine which states have a reward that is infinity or less than infinity.
     QualitativeStateSetsReachabilityRewards qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(
-        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+        env, goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.infinityStates.getNumberOfSetBits() << " states with reward infinity, "
                                      << qualitativeStateSets.rewardZeroStates.getNumberOfSetBits() << " states with reward zero ("
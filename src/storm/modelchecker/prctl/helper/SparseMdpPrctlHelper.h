@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include <boost/container/flat_map.hpp>
+
 #include "MDPModelCheckingHelperReturnType.h"
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SolutionType.h"
@@ -27,7 +29,10 @@ namespace models {
 namespace sparse {
 template<typename ValueType>
 class StandardRewardModel;
-}
+
+template<typename ValueType>
+class AnalysisCache;
+}  // namespace sparse
 }  // namespace models
 
 namespace modelchecker {
@@ -38,7 +43,7 @@ namespace helper {
 template<typename ValueType>
 class SparseMdpPrctlHelper {
    public:
-    static std::map<storm::storage::sparse::state_type, ValueType> computeRewardBoundedValues(
+    static boost::container::flat_map<storm::storage::sparse::state_type, ValueType> computeRewardBoundedValues(
         Environment const& env, OptimizationDirection dir, rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding,
         storm::storage::BitVector const& initialStates);
 
@@ -49,13 +54,13 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        storm::models::sparse::AnalysisCache<ValueType>* analysisCache = nullptr);
 
-    static MDPSparseModelCheckingHelperReturnType<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
-                                                                                          storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                                          storm::storage::BitVector const& psiStates, bool qualitative,
-                                                                                          bool produceScheduler, bool useMecBasedTechnique = false);
+    static MDPSparseModelCheckingHelperReturnType<ValueType> computeGloballyProbabilities(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
+        bool useMecBasedTechnique = false, storm::models::sparse::AnalysisCache<ValueType>* analysisCache = nullptr);
 
     template<typename RewardModelType>
     static std::vector<ValueType> computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
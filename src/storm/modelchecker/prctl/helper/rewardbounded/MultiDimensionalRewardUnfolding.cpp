@@ -1,11 +1,13 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
 
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -373,14 +375,23 @@ typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch
 template<typename ValueType, bool SingleObjectiveMode>
 std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs) {
+    return getEpochComputationOrder(std::vector<Epoch>({startEpoch}), stopAtComputedEpochs);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationOrder(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs) {
     // Perform a DFS to find all the reachable epochs
     std::vector<Epoch> dfsStack;
     std::set<Epoch, std::function<bool(Epoch const&, Epoch const&)>> collectedEpochs(
         std::bind(&EpochManager::epochClassZigZagOrder, &epochManager, std::placeholders::_1, std::placeholders::_2));
 
-    if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
-        collectedEpochs.insert(startEpoch);
-        dfsStack.push_back(startEpoch);
+    for (auto const& startEpoch : startEpochs) {
+        if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
+            if (collectedEpochs.insert(startEpoch).second) {
+                dfsStack.push_back(startEpoch);
+            }
+        }
     }
     while (!dfsStack.empty()) {
         Epoch currentEpoch = dfsStack.back();
@@ -414,6 +425,35 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         epochModel.epochMatrixChanged = false;
     }
 
+    setStepSolutions(epoch, epochModel);
+
+    assert(epochModel.objectiveRewards.size() == objectives.size());
+    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
+    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
+    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
+    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
+    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
+    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
+    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+
+    currentEpoch = epoch;
+    /*
+    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
+    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
+    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
+    std::cout << "steps: " << epochModel.stepChoices << '\n';
+    std::cout << "step solutions: ";
+    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
+        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+    }
+    std::cout << '\n';
+    */
+    return epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setStepSolutions(
+    Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModelOfEpochClass) const {
     bool containsLowerBoundedObjective = false;
     for (auto const& dimension : dimensions) {
         if (dimension.boundType == DimensionBoundType::LowerBound) {
@@ -430,9 +470,9 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             subSolutions.emplace(successorEpoch, &successorSolIt->second);
         }
     }
-    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-    auto stepSolIt = epochModel.stepSolutions.begin();
-    for (auto reducedChoice : epochModel.stepChoices) {
+    epochModelOfEpochClass.stepSolutions.resize(epochModelOfEpochClass.stepChoices.getNumberOfSetBits());
+    auto stepSolIt = epochModelOfEpochClass.stepSolutions.begin();
+    for (auto reducedChoice : epochModelOfEpochClass.stepChoices) {
         uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
@@ -443,7 +483,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+            bool rewardEarned = !storm::utility::isZero(epochModelOfEpochClass.objectiveRewards[objIndex][reducedChoice]);
             if (rewardEarned) {
                 for (auto dim : objectiveDimensions[objIndex]) {
                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) &&
@@ -453,7 +493,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
                     }
                 }
             }
-            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+            epochModelOfEpochClass.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
         }
         // compute the solution for the stepChoices
         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -485,29 +525,67 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         *stepSolIt = std::move(choiceSolution);
         ++stepSolIt;
     }
+}
 
-    assert(epochModel.objectiveRewards.size() == objectives.size());
-    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationLevels(std::vector<Epoch> const& epochOrder) const {
+    // Within an epoch class, every step either keeps the epoch or strictly decreases the sum of dimensions.
+    // As the computation order sorts the epochs of a class by their sum of dimensions, the levels are consecutive in the order.
+    std::vector<std::vector<Epoch>> levels;
+    for (auto const& epoch : epochOrder) {
+        if (levels.empty() || !epochManager.compareEpochClass(levels.back().front(), epoch) ||
+            epochManager.getSumOfDimensions(levels.back().front()) != epochManager.getSumOfDimensions(epoch)) {
+            levels.emplace_back();
+        }
+        levels.back().push_back(epoch);
+    }
+    return levels;
+}
 
-    currentEpoch = epoch;
-    /*
-    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
-    std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(
+    std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(uint64_t threadIndex, EpochModel<ValueType, SingleObjectiveMode>& epochModel)> const& analyze) {
+    STORM_LOG_ASSERT(!epochs.empty(), "Tried to analyze an empty set of epochs.");
+    numberOfThreads = std::min<uint64_t>(numberOfThreads, epochs.size());
+    if (numberOfThreads <= 1) {
+        for (auto const& epoch : epochs) {
+            setSolutionForCurrentEpoch(analyze(0, setCurrentEpoch(epoch)));
+        }
+        return;
+    }
+
+    // Make sure that the epoch model of the corresponding epoch class is available and copy it for each thread.
+    // The solutions of the epochs are only set after all epochs have been analyzed since the successor solutions might be cleaned up otherwise.
+    if (!currentEpoch || !epochManager.compareEpochClass(epochs.front(), currentEpoch.get())) {
+        setCurrentEpochClass(epochs.front());
+        epochModel.epochMatrixChanged = true;
+    }
+    currentEpoch = epochs.front();
+    EpochClass epochClass = epochManager.getEpochClass(epochs.front());
+    if (!threadEpochModelsClass || threadEpochModelsClass.get() != epochClass || threadEpochModels.size() < numberOfThreads) {
+        threadEpochModels.assign(numberOfThreads, epochModel);
+        for (auto& threadEpochModel : threadEpochModels) {
+            threadEpochModel.epochMatrixChanged = true;
+        }
+        threadEpochModelsClass = epochClass;
+    }
+
+    std::vector<std::vector<SolutionType>> solutions(epochs.size());
+    storm::utility::parallel::forEachChunk(numberOfThreads, epochs.size(), 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+        auto& threadEpochModel = threadEpochModels[threadIndex];
+        for (uint64_t epochIndex = begin; epochIndex < end; ++epochIndex) {
+            STORM_LOG_ASSERT(epochManager.compareEpochClass(epochs[epochIndex], epochs.front()), "Epochs of a level have different epoch classes.");
+            setStepSolutions(epochs[epochIndex], threadEpochModel);
+            solutions[epochIndex] = analyze(threadIndex, threadEpochModel);
+            threadEpochModel.epochMatrixChanged = false;
+        }
+    });
+
+    for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+        setSolutionForEpoch(epochs[epochIndex], std::move(solutions[epochIndex]));
     }
-    std::cout << '\n';
-    */
-    return epochModel;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -860,15 +938,22 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    setSolutionForEpoch(currentEpoch.get(), std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions) {
+    STORM_LOG_ASSERT(currentEpoch && epochManager.compareEpochClass(epoch, currentEpoch.get()),
+                     "Tried to set a solution for an epoch that does not belong to the current epoch class.");
     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
@@ -885,12 +970,12 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     solution.count = predecessorEpochs.size();
     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) const {
     auto epochSolutionIt = epochSolutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return getStateSolution(epochSolutionIt->second, productState);
@@ -898,7 +983,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions,
+                                                                                  Epoch const& epoch) const {
     auto epochSolutionIt = solutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return *epochSolutionIt->second;
@@ -906,7 +992,7 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const {
     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(),
                      "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -62,8 +63,31 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Computes a sequence of epochs that need to be analyzed to get a result at each of the given start epochs.
+     * @param stopAtComputedEpochs if set, the search for epochs that need to be computed is stopped at epochs that already have been computed earlier.
+     */
+    std::vector<Epoch> getEpochComputationOrder(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs = false);
+
+    /*!
+     * Groups the given computation order (as returned by getEpochComputationOrder) into consecutive levels.
+     * All epochs of a level belong to the same epoch class and have the same sum of dimensions. Hence, they do not depend on each other and can be
+     * analyzed concurrently once the solutions of all previous levels are known.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationLevels(std::vector<Epoch> const& epochOrder) const;
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
+    /*!
+     * Analyzes the given epochs, which have to form a level as returned by getEpochComputationLevels, and sets their solutions.
+     * The epochs are distributed among the given number of threads. Each thread works on its own copy of the epoch model which is kept (together
+     * with the solver that the caller associates with the thread) until the epoch class changes.
+     *
+     * @param analyze Callable that analyzes the given epoch model within the thread with the given index and returns the solution at the in states.
+     */
+    void analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+                       std::function<std::vector<SolutionType>(uint64_t threadIndex, EpochModel<ValueType, SingleObjectiveMode>& epochModel)> const& analyze);
+
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
 
     /*!
@@ -86,6 +110,8 @@ class MultiDimensionalRewardUnfolding {
 
    private:
     void setCurrentEpochClass(Epoch const& epoch);
+    void setStepSolutions(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModelOfEpochClass) const;
+    void setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -114,15 +140,15 @@ class MultiDimensionalRewardUnfolding {
     template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
     std::string solutionToString(SolutionType const& solution) const;
 
-    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
+    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState) const;
     struct EpochSolution {
         uint64_t count;
         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
-    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
 
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
@@ -136,6 +162,10 @@ class MultiDimensionalRewardUnfolding {
     EpochModel<ValueType, SingleObjectiveMode> epochModel;
     boost::optional<Epoch> currentEpoch;
 
+    // Copies of the epoch model of the current epoch class for the threads that analyze epochs concurrently.
+    std::vector<EpochModel<ValueType, SingleObjectiveMode>> threadEpochModels;
+    boost::optional<EpochClass> threadEpochModelsClass;
+
     EpochManager epochManager;
 
     std::vector<Dimension<ValueType>> dimensions;
@@ -1,11 +1,13 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
 
 #include <boost/optional.hpp>
+#include <functional>
 #include <memory>
 #include <set>
 #include <vector>
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -395,15 +397,34 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                                                 CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
 
+    // If multiple threads are available, several candidate cost limits are checked at once and the independent epochs of their joint computation order
+    // are analyzed concurrently. Each thread has its own solver, which then runs sequentially.
+    uint64_t numberOfThreads = env.solver().getNumberOfThreads();
+    Environment threadEnv = env;
+    threadEnv.solver().setNumberOfThreads(1);
+    std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadMinMaxSolvers(numberOfThreads);  // Needed for MDP
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadLinEqSolvers(numberOfThreads);         // Needed for DTMC
+    std::function<std::vector<ValueType>(uint64_t, EpochModel<ValueType, true>&)> analyzeEpochModel;
+    if (model.isNondeterministicModel()) {
+        analyzeEpochModel = [&](uint64_t threadIndex, EpochModel<ValueType, true>& epochModel) {
+            return epochModel.analyzeSingleObjective(numberOfThreads > 1 ? threadEnv : env, boundedUntilOperator.getOptimalityType(), threadX[threadIndex],
+                                                     threadB[threadIndex], threadMinMaxSolvers[threadIndex], lowerBound, upperBound);
+        };
+    } else {
+        analyzeEpochModel = [&](uint64_t threadIndex, EpochModel<ValueType, true>& epochModel) {
+            return epochModel.analyzeSingleObjective(numberOfThreads > 1 ? threadEnv : env, threadX[threadIndex], threadB[threadIndex],
+                                                     threadLinEqSolvers[threadIndex], lowerBound, upperBound);
+        };
+    }
+
     swExploration.start();
     bool progress = true;
+    std::vector<EpochManager::Epoch> startEpochs;
     for (CostLimit candidateCostLimitSum(0); progress; ++candidateCostLimitSum.get()) {
         CostLimits currentCandidate(satCostLimits.dimension(), CostLimit(0));
         if (!currentCandidate.empty()) {
@@ -412,40 +433,49 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
         // We can still have progress if one of the closures is empty and the other is not full.
         // This ensures that we do not terminate too early in case that the (un)satCostLimits are initially non-empty.
         progress = (satCostLimits.empty() && !unsatCostLimits.full()) || (unsatCostLimits.empty() && !satCostLimits.full());
-        do {
-            if (!satCostLimits.contains(currentCandidate) && !unsatCostLimits.contains(currentCandidate)) {
-                progress = true;
-                // Transform candidate cost limits to an appropriate start epoch
-                auto startEpoch = rewardUnfolding.getStartEpoch(true);
-                auto costLimitIt = currentCandidate.begin();
-                for (auto dim : consideredDimensions) {
-                    if (lowerBoundedDimensions.get(dim)) {
-                        if (costLimitIt->get() > 0) {
-                            rewardUnfolding.getEpochManager().setDimensionOfEpoch(startEpoch, dim, costLimitIt->get() - 1);
+        bool hasNextCandidate = true;
+        while (hasNextCandidate) {
+            // Collect (up to) one undecided candidate per thread. The satisfaction of a candidate is only checked right before it is added, so results of
+            // previous candidates are taken into account.
+            startEpochs.clear();
+            while (hasNextCandidate && startEpochs.size() < numberOfThreads) {
+                if (!satCostLimits.contains(currentCandidate) && !unsatCostLimits.contains(currentCandidate)) {
+                    progress = true;
+                    // Transform candidate cost limits to an appropriate start epoch
+                    auto startEpoch = rewardUnfolding.getStartEpoch(true);
+                    auto costLimitIt = currentCandidate.begin();
+                    for (auto dim : consideredDimensions) {
+                        if (lowerBoundedDimensions.get(dim)) {
+                            if (costLimitIt->get() > 0) {
+                                rewardUnfolding.getEpochManager().setDimensionOfEpoch(startEpoch, dim, costLimitIt->get() - 1);
+                            } else {
+                                rewardUnfolding.getEpochManager().setBottomDimension(startEpoch, dim);
+                            }
                         } else {
-                            rewardUnfolding.getEpochManager().setBottomDimension(startEpoch, dim);
+                            rewardUnfolding.getEpochManager().setDimensionOfEpoch(startEpoch, dim, costLimitIt->get());
                         }
-                    } else {
-                        rewardUnfolding.getEpochManager().setDimensionOfEpoch(startEpoch, dim, costLimitIt->get());
+                        ++costLimitIt;
                     }
-                    ++costLimitIt;
+                    STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
+                    startEpochs.push_back(std::move(startEpoch));
                 }
-                STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
-                auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
-                    ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
+                hasNextCandidate = getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate);
+            }
+            if (startEpochs.empty()) {
+                continue;
+            }
+
+            // Epochs that have been computed for previous candidates are reused.
+            auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpochs, true);
+            numCheckedEpochs += epochSequence.size();
+            for (auto const& level : rewardUnfolding.getEpochComputationLevels(epochSequence)) {
+                swEpochAnalysis.start();
+                rewardUnfolding.analyzeEpochs(level, numberOfThreads, analyzeEpochModel);
+                swEpochAnalysis.stop();
 
+                for (auto const& epoch : level) {
                     CostLimits epochAsCostLimits;
-                    if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
+                    if (translateEpochToCostLimits(epoch, startEpochs.front(), consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
                                                    epochAsCostLimits)) {
                         ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
                         bool propertySatisfied;
@@ -470,7 +500,7 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                     }
                 }
             }
-        } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
+        }
         if (!progress) {
             progress = !CostLimitClosure::unionFull(satCostLimits, unsatCostLimits);
         }
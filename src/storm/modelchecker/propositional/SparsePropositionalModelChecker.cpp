@@ -4,6 +4,7 @@
 
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/AnalysisCache.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Pomdp.h"
@@ -55,6 +56,15 @@ SparseModelType const& SparsePropositionalModelChecker<SparseModelType>::getMode
     return model;
 }
 
+template<typename SparseModelType>
+storm::storage::SparseMatrix<typename SparsePropositionalModelChecker<SparseModelType>::ValueType> const&
+SparsePropositionalModelChecker<SparseModelType>::getBackwardTransitions() const {
+    if (!backwardTransitions) {
+        backwardTransitions = model.getAnalysisCache().getBackwardTransitions(model.getTransitionMatrix());
+    }
+    return *backwardTransitions;
+}
+
 // Explicitly instantiate the template class.
 template class SparsePropositionalModelChecker<storm::models::sparse::Model<double>>;
 template class SparsePropositionalModelChecker<storm::models::sparse::Dtmc<double>>;
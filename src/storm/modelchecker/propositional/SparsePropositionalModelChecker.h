@@ -1,7 +1,10 @@
 #ifndef STORM_MODELCHECKER_SPARSEPROPOSITIONALMODELCHECKER_H_
 #define STORM_MODELCHECKER_SPARSEPROPOSITIONALMODELCHECKER_H_
 
+#include <memory>
+
 #include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/SparseMatrix.h"
 
 namespace storm {
 namespace modelchecker {
@@ -29,9 +32,20 @@ class SparsePropositionalModelChecker : public AbstractModelChecker<SparseModelT
      */
     SparseModelType const& getModel() const;
 
+    /*!
+     * Retrieves the backward transitions of the model. They are obtained from the analysis cache of the model on the first call
+     * and then shared by all (sub-)formulas that are checked with this model checker instance.
+     *
+     * @return The backward transitions of the model associated with this model checker instance.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const;
+
    private:
     // The model that is to be analyzed by the model checker.
     SparseModelType const& model;
+
+    // The backward transitions of the model (if already retrieved).
+    mutable std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
 };
 }  // namespace modelchecker
 }  // namespace storm
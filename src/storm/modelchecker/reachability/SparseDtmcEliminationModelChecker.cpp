@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <type_traits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -27,6 +28,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/vector.h"
 
@@ -115,7 +117,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     }
 
     // Construct check result based on whether we have computed values for all states or just the initial states.
-    std::unique_ptr<CheckResult> checkResult(new ExplicitQuantitativeCheckResult<ValueType>(result));
+    std::unique_ptr<CheckResult> checkResult(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
     if (checkTask.isOnlyInitialStatesRelevantSet()) {
         // If we computed the results for the initial states only, we need to filter the result to only
         // communicate these results.
@@ -180,7 +182,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     }
 
     // Construct check result based on whether we have computed values for all states or just the initial states.
-    std::unique_ptr<CheckResult> checkResult(new ExplicitQuantitativeCheckResult<ValueType>(result));
+    std::unique_ptr<CheckResult> checkResult(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
     if (checkTask.isOnlyInitialStatesRelevantSet()) {
         // If we computed the results for the initial states only, we need to filter the result to only
         // communicate these results.
@@ -447,7 +449,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
 
     // Construct check result based on whether we have computed values for all states or just the initial states.
-    std::unique_ptr<CheckResult> checkResult(new ExplicitQuantitativeCheckResult<ValueType>(result));
+    std::unique_ptr<CheckResult> checkResult(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
     if (checkTask.isOnlyInitialStatesRelevantSet()) {
         // If we computed the results for the initial (and prob 0 and prob1) states only, we need to filter the
         // result to only communicate these results.
@@ -534,7 +536,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
         }
         return std::move(checkResult);  // move() required by, e.g., clang 3.8
     }
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(result);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(result));
 }
 
 template<typename SparseDtmcModelType>
@@ -642,7 +644,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
         }
         return std::move(checkResult);  // move() required by, e.g., clang 3.8
     }
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(result);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(result));
 }
 
 template<typename SparseDtmcModelType>
@@ -914,9 +916,13 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHyb
     // When using the hybrid technique, we recursively treat the SCCs up to some size.
     std::vector<storm::storage::sparse::state_type> entryStateQueue;
     STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique.\n");
+    // Rational functions share a global factorization cache, so they are always eliminated sequentially.
+    uint64_t numberOfThreads = std::is_same<ValueType, storm::RationalFunction>::value
+                                   ? 1
+                                   : storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
     uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0,
                                           storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue,
-                                          computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                                          computeResultsForInitialStatesOnly, distanceBasedPriorities, numberOfThreads);
 
     // If the entry states were to be eliminated last, we need to do so now.
     if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet()) {
@@ -980,7 +986,7 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize,
     std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly,
-    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, uint64_t numberOfThreads) {
     uint_fast64_t maximalDepth = level;
 
     // If the SCCs are large enough, we try to split them further.
@@ -1016,6 +1022,34 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
 
         // And then recursively treat the remaining sub-SCCs.
         STORM_LOG_TRACE("Eliminating " << remainingSccs.getNumberOfSetBits() << " remaining SCCs on level " << level << ".");
+        bool eliminateSubSccEntryStates =
+            eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet();
+
+        // The elimination of a sub-SCC only touches the rows of its states, its successors and (if its entry states are eliminated) the
+        // predecessors of its entry states. Consecutive sub-SCCs whose touched rows are disjoint are independent, so they are collected in a batch
+        // and eliminated concurrently. As the order of dependent sub-SCCs is preserved, the result does not depend on the number of threads.
+        std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> batch;
+        storm::storage::BitVector touchedStatesOfBatch(forwardTransitions.getRowCount());
+        auto treatBatch = [&]() {
+            std::vector<std::vector<storm::storage::sparse::state_type>> entryStateQueues(batch.size());
+            std::vector<uint_fast64_t> depths(batch.size());
+            uint64_t numberOfThreadsPerScc = batch.size() == 1 ? numberOfThreads : 1;
+            storm::utility::parallel::forEachChunk(numberOfThreads, batch.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+                for (uint64_t batchIndex = begin; batchIndex < end; ++batchIndex) {
+                    // Recursively descend in SCC-hierarchy.
+                    depths[batchIndex] = treatScc(matrix, values, batch[batchIndex].second, batch[batchIndex].first, initialStates, forwardTransitions,
+                                                  backwardTransitions, eliminateSubSccEntryStates, level + 1, maximalSccSize, entryStateQueues[batchIndex],
+                                                  computeResultsForInitialStatesOnly, distanceBasedPriorities, numberOfThreadsPerScc);
+                }
+            });
+            for (uint64_t batchIndex = 0; batchIndex < batch.size(); ++batchIndex) {
+                maximalDepth = std::max(maximalDepth, depths[batchIndex]);
+                entryStateQueue.insert(entryStateQueue.end(), entryStateQueues[batchIndex].begin(), entryStateQueues[batchIndex].end());
+            }
+            batch.clear();
+            touchedStatesOfBatch.clear();
+        };
+
         for (auto sccIndex : remainingSccs) {
             storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
 
@@ -1024,20 +1058,51 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
 
             // Determine the set of entry states of the SCC.
             storm::storage::BitVector entryStates(forwardTransitions.getRowCount());
-            for (auto const& state : newScc) {
-                for (auto const& predecessor : backwardTransitions.getRow(state)) {
-                    if (predecessor.getValue() != storm::utility::zero<ValueType>() && !newSccAsBitVector.get(predecessor.getColumn())) {
-                        entryStates.set(state);
+            auto computeEntryStates = [&]() {
+                entryStates.clear();
+                for (auto const& state : newScc) {
+                    for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                        if (predecessor.getValue() != storm::utility::zero<ValueType>() && !newSccAsBitVector.get(predecessor.getColumn())) {
+                            entryStates.set(state);
+                        }
+                    }
+                }
+            };
+            computeEntryStates();
+
+            if (numberOfThreads > 1) {
+                storm::storage::BitVector touchedStates;
+                auto computeTouchedStates = [&]() {
+                    touchedStates = newSccAsBitVector;
+                    for (auto const& state : newScc) {
+                        for (auto const& successor : matrix.getRow(state)) {
+                            touchedStates.set(successor.getColumn());
+                        }
+                    }
+                    if (eliminateSubSccEntryStates) {
+                        for (auto const& state : entryStates) {
+                            for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                                touchedStates.set(predecessor.getColumn());
+                            }
+                        }
                     }
+                };
+                computeTouchedStates();
+                if (!touchedStates.isDisjointFrom(touchedStatesOfBatch)) {
+                    // The elimination of the batch may change the rows of the SCC, so its entry and touched states are determined again.
+                    treatBatch();
+                    computeEntryStates();
+                    computeTouchedStates();
                 }
+                touchedStatesOfBatch |= touchedStates;
             }
-
-            // Recursively descend in SCC-hierarchy.
-            uint_fast64_t depth =
-                treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions,
-                         eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(),
-                         level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
-            maximalDepth = std::max(maximalDepth, depth);
+            batch.emplace_back(std::move(newSccAsBitVector), std::move(entryStates));
+            if (numberOfThreads <= 1) {
+                treatBatch();
+            }
+        }
+        if (!batch.empty()) {
+            treatBatch();
         }
     } else {
         // In this case, we perform simple state elimination in the current SCC.
@@ -115,7 +115,8 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                   storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level,
                                   uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue,
                                   bool computeResultsForInitialStatesOnly,
-                                  boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none);
+                                  boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none,
+                                  uint64_t numberOfThreads = 1);
 
     static bool checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions);
@@ -0,0 +1,83 @@
+#include "storm/modelchecker/results/BoundSweepCheckResult.h"
+
+#include <ostream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+BoundSweepCheckResult<ValueType>::BoundSweepCheckResult(std::vector<ValueType> const& bounds, std::vector<std::unique_ptr<CheckResult>>&& results)
+    : bounds(bounds), results(std::move(results)) {
+    STORM_LOG_THROW(this->bounds.size() == this->results.size(), storm::exceptions::InvalidArgumentException,
+                    "The number of bounds (" << this->bounds.size() << ") does not match the number of results (" << this->results.size() << ").");
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& BoundSweepCheckResult<ValueType>::getBounds() const {
+    return bounds;
+}
+
+template<typename ValueType>
+std::vector<std::unique_ptr<CheckResult>> const& BoundSweepCheckResult<ValueType>::getResults() const {
+    return results;
+}
+
+template<typename ValueType>
+CheckResult const& BoundSweepCheckResult<ValueType>::getResult(uint64_t boundIndex) const {
+    return *results.at(boundIndex);
+}
+
+template<typename ValueType>
+bool BoundSweepCheckResult<ValueType>::isBoundSweepCheckResult() const {
+    return true;
+}
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> BoundSweepCheckResult<ValueType>::clone() const {
+    std::vector<std::unique_ptr<CheckResult>> clonedResults;
+    clonedResults.reserve(results.size());
+    for (auto const& result : results) {
+        clonedResults.push_back(result->clone());
+    }
+    return std::make_unique<BoundSweepCheckResult<ValueType>>(bounds, std::move(clonedResults));
+}
+
+template<typename ValueType>
+bool BoundSweepCheckResult<ValueType>::isExplicit() const {
+    return true;
+}
+
+template<typename ValueType>
+bool BoundSweepCheckResult<ValueType>::isResultForAllStates() const {
+    for (auto const& result : results) {
+        if (!result->isResultForAllStates()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+void BoundSweepCheckResult<ValueType>::filter(QualitativeCheckResult const& filter) {
+    for (auto& result : results) {
+        result->filter(filter);
+    }
+}
+
+template<typename ValueType>
+std::ostream& BoundSweepCheckResult<ValueType>::writeToStream(std::ostream& out) const {
+    for (uint64_t boundIndex = 0; boundIndex < bounds.size(); ++boundIndex) {
+        out << "bound " << bounds[boundIndex] << ": " << *results[boundIndex] << '\n';
+    }
+    return out;
+}
+
+template class BoundSweepCheckResult<double>;
+template class BoundSweepCheckResult<storm::RationalNumber>;
+
+}  // namespace modelchecker
+}  // namespace storm
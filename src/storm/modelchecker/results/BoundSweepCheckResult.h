@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/results/CheckResult.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * The results of a single property for a sequence of (upper) time or step bounds, e.g. the values of P=? [F<=k goal] for k = 1, ..., 100.
+ * The i-th result belongs to the i-th bound.
+ */
+template<typename ValueType>
+class BoundSweepCheckResult : public CheckResult {
+   public:
+    BoundSweepCheckResult() = default;
+    BoundSweepCheckResult(std::vector<ValueType> const& bounds, std::vector<std::unique_ptr<CheckResult>>&& results);
+    virtual ~BoundSweepCheckResult() = default;
+
+    std::vector<ValueType> const& getBounds() const;
+    std::vector<std::unique_ptr<CheckResult>> const& getResults() const;
+    CheckResult const& getResult(uint64_t boundIndex) const;
+
+    virtual bool isBoundSweepCheckResult() const override;
+    virtual std::unique_ptr<CheckResult> clone() const override;
+    virtual bool isExplicit() const override;
+    virtual bool isResultForAllStates() const override;
+
+    /*!
+     * Filters the results of all bounds.
+     */
+    virtual void filter(QualitativeCheckResult const& filter) override;
+
+    virtual std::ostream& writeToStream(std::ostream& out) const override;
+
+   private:
+    std::vector<ValueType> bounds;
+    std::vector<std::unique_ptr<CheckResult>> results;
+};
+}  // namespace modelchecker
+}  // namespace storm
@@ -3,6 +3,7 @@
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/modelchecker/results/BoundSweepCheckResult.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -45,6 +46,10 @@ bool CheckResult::isLexicographicCheckResult() const {
     return false;
 }
 
+bool CheckResult::isBoundSweepCheckResult() const {
+    return false;
+}
+
 bool CheckResult::isResultForAllStates() const {
     return false;
 }
@@ -120,6 +125,16 @@ LexicographicCheckResult<ValueType> const& CheckResult::asLexicographicCheckResu
     return dynamic_cast<LexicographicCheckResult<ValueType> const&>(*this);
 }
 
+template<typename ValueType>
+BoundSweepCheckResult<ValueType>& CheckResult::asBoundSweepCheckResult() {
+    return dynamic_cast<BoundSweepCheckResult<ValueType>&>(*this);
+}
+
+template<typename ValueType>
+BoundSweepCheckResult<ValueType> const& CheckResult::asBoundSweepCheckResult() const {
+    return dynamic_cast<BoundSweepCheckResult<ValueType> const&>(*this);
+}
+
 QualitativeCheckResult& CheckResult::asQualitativeCheckResult() {
     return dynamic_cast<QualitativeCheckResult&>(*this);
 }
@@ -192,6 +207,8 @@ template ExplicitParetoCurveCheckResult<double>& CheckResult::asExplicitParetoCu
 template ExplicitParetoCurveCheckResult<double> const& CheckResult::asExplicitParetoCurveCheckResult() const;
 template LexicographicCheckResult<double>& CheckResult::asLexicographicCheckResult();
 template LexicographicCheckResult<double> const& CheckResult::asLexicographicCheckResult() const;
+template BoundSweepCheckResult<double>& CheckResult::asBoundSweepCheckResult();
+template BoundSweepCheckResult<double> const& CheckResult::asBoundSweepCheckResult() const;
 
 template SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>& CheckResult::asSymbolicQualitativeCheckResult();
 template SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> const& CheckResult::asSymbolicQualitativeCheckResult() const;
@@ -234,6 +251,9 @@ template ExplicitParetoCurveCheckResult<storm::RationalNumber> const& CheckResul
 template LexicographicCheckResult<storm::RationalNumber>& CheckResult::asLexicographicCheckResult();
 template LexicographicCheckResult<storm::RationalNumber> const& CheckResult::asLexicographicCheckResult() const;
 
+template BoundSweepCheckResult<storm::RationalNumber>& CheckResult::asBoundSweepCheckResult();
+template BoundSweepCheckResult<storm::RationalNumber> const& CheckResult::asBoundSweepCheckResult() const;
+
 #endif
 }  // namespace modelchecker
 }  // namespace storm
@@ -24,6 +24,9 @@ class ExplicitParetoCurveCheckResult;
 template<typename ValueType>
 class LexicographicCheckResult;
 
+template<typename ValueType>
+class BoundSweepCheckResult;
+
 template<storm::dd::DdType Type>
 class SymbolicQualitativeCheckResult;
 
@@ -59,6 +62,7 @@ class CheckResult {
     virtual bool isQualitative() const;
     virtual bool isParetoCurveCheckResult() const;
     virtual bool isLexicographicCheckResult() const;
+    virtual bool isBoundSweepCheckResult() const;
     virtual bool isExplicitQualitativeCheckResult() const;
     virtual bool isExplicitQuantitativeCheckResult() const;
     virtual bool isExplicitParetoCurveCheckResult() const;
@@ -98,6 +102,12 @@ class CheckResult {
     template<typename ValueType>
     LexicographicCheckResult<ValueType> const& asLexicographicCheckResult() const;
 
+    template<typename ValueType>
+    BoundSweepCheckResult<ValueType>& asBoundSweepCheckResult();
+
+    template<typename ValueType>
+    BoundSweepCheckResult<ValueType> const& asBoundSweepCheckResult() const;
+
     template<storm::dd::DdType Type>
     SymbolicQualitativeCheckResult<Type>& asSymbolicQualitativeCheckResult();
 
@@ -68,22 +68,25 @@ ExplicitQuantitativeCheckResult<ValueType>::ExplicitQuantitativeCheckResult(Expl
             newVector.push_back(bvValues.get(i) ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>());
         }
 
-        values = newVector;
+        values = std::move(newVector);
     } else {
         ExplicitQualitativeCheckResult::map_type const& bitMap = other.getTruthValuesMap();
 
         map_type newMap;
+        newMap.reserve(bitMap.size());
         for (auto const& e : bitMap) {
-            newMap[e.first] = e.second ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
+            newMap.emplace_hint(newMap.end(), e.first, e.second ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>());
         }
 
-        values = newMap;
+        values = std::move(newMap);
     }
 }
 
 template<typename ValueType>
 std::unique_ptr<CheckResult> ExplicitQuantitativeCheckResult<ValueType>::clone() const {
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    result->packedScheduler = this->packedScheduler;
+    return result;
 }
 
 template<typename ValueType>
@@ -109,28 +112,32 @@ void ExplicitQuantitativeCheckResult<ValueType>::filter(QualitativeCheckResult c
     ExplicitQualitativeCheckResult const& explicitFilter = filter.asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult::vector_type const& filterTruthValues = explicitFilter.getTruthValuesVector();
 
+    // The states of the filter are visited in ascending order, so the filtered values can be appended to the (sorted) map.
     if (this->isResultForAllStates()) {
+        vector_type& vector = this->getValueVector();
         map_type newMap;
+        newMap.reserve(filterTruthValues.getNumberOfSetBits());
 
         for (auto element : filterTruthValues) {
-            STORM_LOG_THROW(element < this->getValueVector().size(), storm::exceptions::InvalidAccessException, "Invalid index in results.");
-            newMap.emplace(element, this->getValueVector()[element]);
+            STORM_LOG_THROW(element < vector.size(), storm::exceptions::InvalidAccessException, "Invalid index in results.");
+            newMap.emplace_hint(newMap.end(), element, std::move(vector[element]));
         }
-        this->values = newMap;
+        this->values = std::move(newMap);
     } else {
-        map_type const& map = boost::get<map_type>(values);
-
+        map_type& map = boost::get<map_type>(values);
         map_type newMap;
-        for (auto const& element : map) {
+        newMap.reserve(filterTruthValues.getNumberOfSetBits());
+
+        for (auto& element : map) {
             if (filterTruthValues.get(element.first)) {
-                newMap.insert(element);
+                newMap.emplace_hint(newMap.end(), element.first, std::move(element.second));
             }
         }
 
         STORM_LOG_THROW(newMap.size() == filterTruthValues.getNumberOfSetBits(), storm::exceptions::InvalidOperationException,
                         "The check result fails to contain some results referred to by the filter.");
 
-        this->values = newMap;
+        this->values = std::move(newMap);
     }
 }
 
@@ -212,26 +219,56 @@ ValueType ExplicitQuantitativeCheckResult<ValueType>::average() const {
 
 template<typename ValueType>
 bool ExplicitQuantitativeCheckResult<ValueType>::hasScheduler() const {
-    return static_cast<bool>(scheduler);
+    return static_cast<bool>(scheduler) || static_cast<bool>(packedScheduler);
 }
 
 template<typename ValueType>
 void ExplicitQuantitativeCheckResult<ValueType>::setScheduler(std::unique_ptr<storm::storage::Scheduler<ValueType>>&& scheduler) {
-    this->scheduler = std::move(scheduler);
+    if (scheduler && scheduler->isMemorylessScheduler() && scheduler->isDeterministicScheduler()) {
+        setScheduler(std::make_unique<storm::storage::PackedScheduler>(*scheduler));
+    } else {
+        this->scheduler = std::move(scheduler);
+        this->packedScheduler.reset();
+    }
+}
+
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::setScheduler(std::unique_ptr<storm::storage::PackedScheduler>&& scheduler) {
+    this->packedScheduler = std::move(scheduler);
+    this->scheduler = boost::none;
 }
 
 template<typename ValueType>
 storm::storage::Scheduler<ValueType> const& ExplicitQuantitativeCheckResult<ValueType>::getScheduler() const {
     STORM_LOG_THROW(this->hasScheduler(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing scheduler.");
+    if (!scheduler) {
+        scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(packedScheduler->template toScheduler<ValueType>());
+    }
     return *scheduler.get();
 }
 
 template<typename ValueType>
 storm::storage::Scheduler<ValueType>& ExplicitQuantitativeCheckResult<ValueType>::getScheduler() {
     STORM_LOG_THROW(this->hasScheduler(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing scheduler.");
+    if (!scheduler) {
+        scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(packedScheduler->template toScheduler<ValueType>());
+    }
+    // The scheduler might be changed, so the packed one is no longer valid.
+    packedScheduler.reset();
     return *scheduler.get();
 }
 
+template<typename ValueType>
+bool ExplicitQuantitativeCheckResult<ValueType>::hasPackedScheduler() const {
+    return static_cast<bool>(packedScheduler);
+}
+
+template<typename ValueType>
+storm::storage::PackedScheduler const& ExplicitQuantitativeCheckResult<ValueType>::getPackedScheduler() const {
+    STORM_LOG_THROW(this->hasPackedScheduler(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing packed scheduler.");
+    return *packedScheduler;
+}
+
 template<typename ValueType>
 void print(std::ostream& out, ValueType const& value) {
     if (value == storm::utility::infinity<ValueType>()) {
@@ -1,14 +1,15 @@
 #ifndef STORM_MODELCHECKER_EXPLICITQUANTITATIVECHECKRESULT_H_
 #define STORM_MODELCHECKER_EXPLICITQUANTITATIVECHECKRESULT_H_
 
+#include <boost/container/flat_map.hpp>
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
-#include <map>
 #include <optional>
 #include <vector>
 
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/PackedScheduler.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/sparse/StateValuations.h"
@@ -25,7 +26,8 @@ template<typename ValueType>
 class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType> {
    public:
     typedef std::vector<ValueType> vector_type;
-    typedef std::map<storm::storage::sparse::state_type, ValueType> map_type;
+    // Results for a subset of the states (e.g. after filtering) are stored as state indices and values that are sorted by the state index.
+    typedef boost::container::flat_map<storm::storage::sparse::state_type, ValueType> map_type;
 
     ExplicitQuantitativeCheckResult();
     ExplicitQuantitativeCheckResult(map_type const& values);
@@ -77,10 +79,25 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     virtual ValueType sum() const override;
 
     virtual bool hasScheduler() const override;
+
+    /*!
+     * Sets the scheduler that accompanies the values. Deterministic memoryless schedulers are stored in packed form (see PackedScheduler).
+     */
     void setScheduler(std::unique_ptr<storm::storage::Scheduler<ValueType>>&& scheduler);
+    void setScheduler(std::unique_ptr<storm::storage::PackedScheduler>&& scheduler);
+
+    /*!
+     * Retrieves the scheduler. If the scheduler is stored in packed form, it is converted upon the first call.
+     */
     storm::storage::Scheduler<ValueType> const& getScheduler() const;
     storm::storage::Scheduler<ValueType>& getScheduler();
 
+    /*!
+     * Retrieves whether the scheduler is available in packed form, which is the case if it is deterministic and memoryless.
+     */
+    bool hasPackedScheduler() const;
+    storm::storage::PackedScheduler const& getPackedScheduler() const;
+
     storm::json<ValueType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
@@ -88,8 +105,11 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     // The values of the quantitative check result.
     boost::variant<vector_type, map_type> values;
 
-    // An optional scheduler that accompanies the values.
-    boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+    // An optional scheduler that accompanies the values. If the packed scheduler is given, this is only set after being requested.
+    mutable boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+
+    // The scheduler in packed form, if it is deterministic and memoryless.
+    std::shared_ptr<storm::storage::PackedScheduler> packedScheduler;
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -0,0 +1,358 @@
+#include "storm/modelchecker/statistical/ImportanceSplittingModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <boost/math/distributions/students_t.hpp>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace splitting_detail {
+
+// A state from which trials are started together with the number of steps that were needed to reach it.
+struct TrialStart {
+    storm::generator::CompressedState state;
+    uint64_t steps;
+    bool isTarget;
+};
+
+enum class TrialOutcome : uint8_t { Success, Failure, Undecided };
+
+/*!
+ * Simulates trials on the next-state generator of a PRISM program or a JANI model.
+ */
+class TrialSimulator {
+   public:
+    TrialSimulator(storm::storage::SymbolicModelDescription const& model) {
+        if (model.isPrismProgram()) {
+            generator = std::make_unique<storm::generator::PrismNextStateGenerator<double, uint32_t>>(model.asPrismProgram());
+        } else {
+            generator = std::make_unique<storm::generator::JaniNextStateGenerator<double, uint32_t>>(model.asJaniModel());
+        }
+        stateToIdCallback = [this](storm::generator::CompressedState const& state) {
+            discoveredStates.push_back(state);
+            return static_cast<uint32_t>(discoveredStates.size() - 1);
+        };
+    }
+
+    storm::generator::CompressedState getInitialState() {
+        discoveredStates.clear();
+        auto initialStates = generator->getInitialStates(stateToIdCallback);
+        STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Importance splitting requires a unique initial state.");
+        return discoveredStates[initialStates.front()];
+    }
+
+    storm::generator::VariableInformation const& getVariableInformation() const {
+        return generator->getVariableInformation();
+    }
+
+    bool satisfies(storm::generator::CompressedState const& state, storm::expressions::Expression const& expression) {
+        generator->load(state);
+        return generator->satisfies(expression);
+    }
+
+    /*!
+     * Simulates a trial from the given start until it reaches a state that satisfies the level expression or the right expression. The
+     * start is replaced by the state in which the trial ended.
+     */
+    TrialOutcome simulate(TrialStart& start, storm::expressions::Expression const& leftExpression, storm::expressions::Expression const& rightExpression,
+                          storm::expressions::Expression const& levelExpression, std::optional<uint64_t> const& stepBound, uint64_t maximalTraceLength,
+                          storm::utility::CounterBasedRandomGenerator& random) {
+        if (start.isTarget) {
+            return TrialOutcome::Success;
+        }
+        storm::generator::CompressedState& state = start.state;
+        generator->load(state);
+        for (uint64_t length = 0;; ++length) {
+            if (generator->satisfies(rightExpression)) {
+                start.isTarget = true;
+                return TrialOutcome::Success;
+            } else if (generator->satisfies(levelExpression)) {
+                return TrialOutcome::Success;
+            } else if (!generator->satisfies(leftExpression) || (stepBound && start.steps == stepBound.value())) {
+                return TrialOutcome::Failure;
+            } else if (length == maximalTraceLength) {
+                return TrialOutcome::Undecided;
+            }
+
+            discoveredStates.clear();
+            auto behavior = generator->expand(stateToIdCallback);
+            if (behavior.empty()) {
+                return TrialOutcome::Failure;
+            }
+            STORM_LOG_ASSERT(behavior.getNumberOfChoices() == 1, "Expected a single choice in a deterministic model.");
+            auto const& choice = behavior.getChoices().front();
+            // A trial that is stuck in a state can never succeed.
+            bool absorbing = std::all_of(choice.begin(), choice.end(), [&](auto const& entry) { return discoveredStates[entry.first] == state; });
+            uint32_t successor = choice.sampleFromDistribution(random.random());
+            generator->recycle(std::move(behavior));
+            if (absorbing) {
+                return TrialOutcome::Failure;
+            }
+            state = discoveredStates[successor];
+            ++start.steps;
+            generator->load(state);
+        }
+    }
+
+   private:
+    std::unique_ptr<storm::generator::NextStateGenerator<double, uint32_t>> generator;
+    std::vector<storm::generator::CompressedState> discoveredStates;
+    std::function<uint32_t(storm::generator::CompressedState const&)> stateToIdCallback;
+};
+
+storm::expressions::Expression getDistance(storm::expressions::Expression const& expression) {
+    storm::expressions::ExpressionManager const& manager = expression.getManager();
+    storm::expressions::Expression const zero = manager.integer(0);
+    if (expression.isFunctionApplication() && expression.getArity() == 2) {
+        storm::expressions::Expression const first = expression.getOperand(0);
+        storm::expressions::Expression const second = expression.getOperand(1);
+        // Strict inequalities between integers are shifted by one, such that the distance is zero exactly for the satisfying valuations.
+        bool const integral = first.hasIntegerType() && second.hasIntegerType();
+        storm::expressions::Expression const one = integral ? manager.integer(1) : manager.integer(0);
+        switch (expression.getOperator()) {
+            case storm::expressions::OperatorType::And:
+                return getDistance(first) + getDistance(second);
+            case storm::expressions::OperatorType::Or:
+                return storm::expressions::minimum(getDistance(first), getDistance(second));
+            case storm::expressions::OperatorType::GreaterOrEqual:
+                return storm::expressions::maximum(second - first, zero);
+            case storm::expressions::OperatorType::Greater:
+                return storm::expressions::maximum(second - first + one, zero);
+            case storm::expressions::OperatorType::LessOrEqual:
+                return storm::expressions::maximum(first - second, zero);
+            case storm::expressions::OperatorType::Less:
+                return storm::expressions::maximum(first - second + one, zero);
+            case storm::expressions::OperatorType::Equal:
+                if (first.hasNumericalType() && second.hasNumericalType()) {
+                    return storm::expressions::maximum(first - second, second - first);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return storm::expressions::ite(expression, zero, manager.integer(1));
+}
+
+double computeMean(std::vector<double> const& values) {
+    double sum = 0.0;
+    for (auto value : values) {
+        sum += value;
+    }
+    return sum / static_cast<double>(values.size());
+}
+
+}  // namespace splitting_detail
+
+using namespace splitting_detail;
+
+ImportanceSplittingOptions::ImportanceSplittingOptions()
+    : effort(1000), numberOfReplications(16), confidence(0.95), maximalTraceLength(100000), seed(0) {
+    if (storm::settings::hasModule<storm::settings::modules::StatisticalModelCheckingSettings>()) {
+        auto const& settings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+        effort = settings.getSplittingEffort();
+        numberOfReplications = settings.getSplittingReplications();
+        confidence = settings.getConfidence();
+        maximalTraceLength = settings.getMaximalTraceLength();
+        seed = settings.getSeed();
+    }
+}
+
+template<typename ModelType>
+ImportanceSplittingModelChecker<ModelType>::ImportanceSplittingModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                                                            ImportanceSplittingOptions const& options)
+    : options(options), lastConfidenceInterval(0.0, 0.0) {
+    STORM_LOG_THROW(model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Importance splitting is only supported for DTMCs.");
+    STORM_LOG_THROW(options.numberOfReplications > 1, storm::exceptions::NotSupportedException,
+                    "Importance splitting requires at least two replications to compute a confidence interval.");
+    if (model.isPrismProgram()) {
+        this->model = model.asPrismProgram().substituteConstantsFormulas();
+    } else {
+        this->model = model.asJaniModel().substituteConstantsFunctions();
+    }
+}
+
+template<typename ModelType>
+bool ImportanceSplittingModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    if (!checkTask.isOnlyInitialStatesRelevantSet() || !formula.isProbabilityOperatorFormula()) {
+        return false;
+    }
+    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    storm::logic::FragmentSpecification const propositional = storm::logic::propositional();
+    if (pathFormula.isEventuallyFormula()) {
+        return pathFormula.asEventuallyFormula().getSubformula().isInFragment(propositional);
+    } else if (pathFormula.isUntilFormula()) {
+        return pathFormula.asUntilFormula().getLeftSubformula().isInFragment(propositional) &&
+               pathFormula.asUntilFormula().getRightSubformula().isInFragment(propositional);
+    } else if (pathFormula.isBoundedUntilFormula()) {
+        storm::logic::BoundedUntilFormula const& boundedUntil = pathFormula.asBoundedUntilFormula();
+        return !boundedUntil.isMultiDimensional() && boundedUntil.getTimeBoundReference().isStepBound() && !boundedUntil.hasLowerBound() &&
+               boundedUntil.hasUpperBound() && boundedUntil.getLeftSubformula().isInFragment(propositional) &&
+               boundedUntil.getRightSubformula().isInFragment(propositional);
+    }
+    return false;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> ImportanceSplittingModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    storm::logic::BoundedUntilFormula const& boundedUntil = checkTask.getFormula();
+    STORM_LOG_THROW(!boundedUntil.isMultiDimensional() && boundedUntil.getTimeBoundReference().isStepBound(), storm::exceptions::NotSupportedException,
+                    "Importance splitting only supports a single step bound.");
+    STORM_LOG_THROW(!boundedUntil.hasLowerBound() && boundedUntil.hasUpperBound(), storm::exceptions::NotSupportedException,
+                    "Importance splitting only supports upper step bounds.");
+    return estimateProbability(env, boundedUntil.getLeftSubformula(), boundedUntil.getRightSubformula(), boundedUntil.getNonStrictUpperBound<uint64_t>());
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> ImportanceSplittingModelChecker<ModelType>::computeUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    return estimateProbability(env, checkTask.getFormula().getLeftSubformula(), checkTask.getFormula().getRightSubformula(), std::nullopt);
+}
+
+template<typename ModelType>
+storm::expressions::Expression ImportanceSplittingModelChecker<ModelType>::inferImportanceFunction(storm::expressions::Expression const& targetExpression) {
+    return -getDistance(targetExpression.simplify());
+}
+
+template<typename ModelType>
+std::pair<double, double> const& ImportanceSplittingModelChecker<ModelType>::getLastConfidenceInterval() const {
+    return lastConfidenceInterval;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> ImportanceSplittingModelChecker<ModelType>::estimateProbability(Environment const& env, storm::logic::Formula const& left,
+                                                                                            storm::logic::Formula const& right,
+                                                                                            std::optional<uint64_t> const& stepBound) {
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+    if (model.isPrismProgram()) {
+        labelToExpressionMapping = model.asPrismProgram().getLabelToExpressionMapping();
+    } else {
+        storm::jani::Model const& janiModel = model.asJaniModel();
+        for (auto const& variable : janiModel.getGlobalVariables().getBooleanVariables()) {
+            if (variable.isTransient()) {
+                labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+            }
+        }
+    }
+    storm::expressions::ExpressionManager& manager = model.getManager();
+    storm::expressions::Expression const leftExpression = left.toExpression(manager, labelToExpressionMapping);
+    storm::expressions::Expression const rightExpression = right.toExpression(manager, labelToExpressionMapping);
+    storm::expressions::Expression const importance =
+        options.importanceFunction ? options.importanceFunction.value() : inferImportanceFunction(rightExpression);
+    STORM_LOG_THROW(importance.hasNumericalType(), storm::exceptions::InvalidPropertyException,
+                    "The importance function " << importance << " is not numerical.");
+    STORM_LOG_INFO("Importance splitting with importance function " << importance << ".");
+
+    uint64_t const numberOfThreads = std::max<uint64_t>(env.solver().getNumberOfThreads(), 1);
+    std::vector<std::unique_ptr<TrialSimulator>> simulators;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        simulators.push_back(std::make_unique<TrialSimulator>(model));
+    }
+
+    // The levels are the same in all replications.
+    storm::generator::CompressedState const initialState = simulators.front()->getInitialState();
+    storm::expressions::SimpleValuation const initialValuation =
+        storm::generator::unpackStateIntoValuation(initialState, simulators.front()->getVariableInformation(), manager);
+    int64_t const initialLevel = static_cast<int64_t>(std::floor(importance.evaluateAsDouble(&initialValuation)));
+
+    std::vector<double> estimates(options.numberOfReplications);
+    std::vector<uint64_t> numberOfLevels(options.numberOfReplications);
+    std::vector<uint64_t> numberOfUndecidedTrials(options.numberOfReplications);
+    storm::utility::parallel::forEachChunk(numberOfThreads, options.numberOfReplications, 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+        TrialSimulator& simulator = *simulators[threadIndex];
+        std::vector<TrialStart> starts;
+        std::vector<TrialStart> successfulTrials;
+        for (uint64_t replication = begin; replication < end; ++replication) {
+            // All random numbers of a replication are drawn from its own stream, so the result does not depend on the number of threads.
+            storm::utility::CounterBasedRandomGenerator random(options.seed, replication);
+            starts.assign(1, TrialStart{initialState, 0, simulator.satisfies(initialState, rightExpression)});
+            double estimate = 1.0;
+            for (int64_t level = initialLevel + 1;; ++level) {
+                if (std::all_of(starts.begin(), starts.end(), [](TrialStart const& start) { return start.isTarget; })) {
+                    break;
+                }
+                storm::expressions::Expression const levelExpression = importance >= manager.integer(level);
+                successfulTrials.clear();
+                for (uint64_t trial = 0; trial < options.effort; ++trial) {
+                    TrialStart start = starts[std::min<uint64_t>(static_cast<uint64_t>(random.random() * starts.size()), starts.size() - 1)];
+                    TrialOutcome outcome =
+                        simulator.simulate(start, leftExpression, rightExpression, levelExpression, stepBound, options.maximalTraceLength, random);
+                    if (outcome == TrialOutcome::Success) {
+                        successfulTrials.push_back(std::move(start));
+                    } else if (outcome == TrialOutcome::Undecided) {
+                        ++numberOfUndecidedTrials[replication];
+                    }
+                }
+                ++numberOfLevels[replication];
+                estimate *= static_cast<double>(successfulTrials.size()) / static_cast<double>(options.effort);
+                if (successfulTrials.empty()) {
+                    break;
+                }
+                std::swap(starts, successfulTrials);
+            }
+            estimates[replication] = estimate;
+        }
+    });
+    uint64_t const totalNumberOfUndecidedTrials = std::accumulate(numberOfUndecidedTrials.begin(), numberOfUndecidedTrials.end(), uint64_t(0));
+    STORM_LOG_WARN_COND(totalNumberOfUndecidedTrials == 0, totalNumberOfUndecidedTrials << " trials exceeded the maximal length of "
+                                                                                        << options.maximalTraceLength
+                                                                                        << " steps and were considered as violating the property.");
+
+    // The replications are independent, so their mean follows (approximately) a Student's t-distribution.
+    double const mean = computeMean(estimates);
+    double squaredDeviations = 0.0;
+    for (auto estimate : estimates) {
+        squaredDeviations += (estimate - mean) * (estimate - mean);
+    }
+    double const standardError = std::sqrt(squaredDeviations / static_cast<double>(estimates.size() - 1) / static_cast<double>(estimates.size()));
+    boost::math::students_t distribution(static_cast<double>(estimates.size() - 1));
+    double const halfWidth = boost::math::quantile(distribution, (1.0 + options.confidence) / 2.0) * standardError;
+    lastConfidenceInterval = std::make_pair(std::max(mean - halfWidth, 0.0), std::min(mean + halfWidth, 1.0));
+    STORM_PRINT_AND_LOG("Importance splitting estimated probability " << mean << " with " << options.confidence * 100.0 << "% confidence interval ["
+                                                                      << lastConfidenceInterval.first << ", " << lastConfidenceInterval.second << "] from "
+                                                                      << options.numberOfReplications << " runs with up to "
+                                                                      << *std::max_element(numberOfLevels.begin(), numberOfLevels.end()) << " levels.\n");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, mean);
+}
+
+template class ImportanceSplittingModelChecker<storm::models::sparse::Dtmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
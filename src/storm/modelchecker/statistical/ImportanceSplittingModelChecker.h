@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+/*!
+ * Options for the importance splitting. The default values are taken from the statistical model checking settings (if registered).
+ */
+struct ImportanceSplittingOptions {
+    ImportanceSplittingOptions();
+
+    // The function that assigns an importance to every state. If not set, it is derived from the target states of the property.
+    std::optional<storm::expressions::Expression> importanceFunction;
+    // The number of trials that are simulated on each level.
+    uint64_t effort;
+    // The number of independent runs from which the estimate and its confidence interval are computed.
+    uint64_t numberOfReplications;
+    // The probability with which the actual probability lies in the computed confidence interval.
+    double confidence;
+    // The maximal number of steps of a trial.
+    uint64_t maximalTraceLength;
+    // The seed from which the random numbers of all trials are derived.
+    uint64_t seed;
+};
+
+/*!
+ * Estimates (bounded) until probabilities of discrete-time Markov chains given as PRISM program or JANI model with fixed-effort importance
+ * splitting, which is suited for probabilities that are far too small for plain simulation.
+ *
+ * The importance function partitions the states into levels, where level k contains the states whose importance is at least the importance
+ * of the initial state plus k. Starting in the initial state, the given number of trials is simulated from states that entered the current
+ * level. A trial ends as soon as it reaches the next level or a target state (which counts as success) or if it violates the property. The
+ * states in which the successful trials ended are the starting points of the trials on the next level. The product of the fractions of
+ * successful trials estimates the probability. Several independent runs are executed in parallel, which yields the confidence interval.
+ */
+template<typename ModelType>
+class ImportanceSplittingModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker that simulates trials on the given PRISM program or JANI model, i.e. without building the state space.
+     */
+    explicit ImportanceSplittingModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                             ImportanceSplittingOptions const& options = ImportanceSplittingOptions());
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Derives an importance function from the given target expression. The importance of a state is the negated distance of its valuation
+     * to the target states, which is zero exactly for the target states. Distances of (in)equalities between numerical expressions are
+     * their differences, conjunctions add up and disjunctions take the minimal distance of their operands. All other expressions have
+     * distance one if they are not satisfied.
+     */
+    static storm::expressions::Expression inferImportanceFunction(storm::expressions::Expression const& targetExpression);
+
+    /*!
+     * Retrieves the confidence interval of the probability that was computed last.
+     */
+    std::pair<double, double> const& getLastConfidenceInterval() const;
+
+   private:
+    /*!
+     * Estimates the probability of the path property phi U psi with the given optional step bound.
+     */
+    std::unique_ptr<CheckResult> estimateProbability(Environment const& env, storm::logic::Formula const& left, storm::logic::Formula const& right,
+                                                     std::optional<uint64_t> const& stepBound);
+
+    // The model on which the trials are simulated.
+    storm::storage::SymbolicModelDescription model;
+
+    ImportanceSplittingOptions options;
+
+    // The confidence interval of the probability that was computed last.
+    std::pair<double, double> lastConfidenceInterval;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
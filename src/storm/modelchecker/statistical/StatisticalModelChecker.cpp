@@ -0,0 +1,369 @@
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/simulator/PrismProgramTraceSimulator.h"
+
+#include "storm/storage/BitVector.h"
+
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical_detail {
+
+enum class TraceOutcome : uint8_t { Satisfied, Violated, Undecided };
+
+/*!
+ * Simulates traces and decides for each trace whether it satisfies a fixed path property.
+ */
+class TraceSampler {
+   public:
+    virtual ~TraceSampler() = default;
+
+    /*!
+     * Simulates one trace from the initial state whose successors are selected using the given random numbers.
+     *
+     * @return The outcome of the trace, which is undecided if the trace exceeds the maximal length.
+     */
+    virtual TraceOutcome simulate(storm::utility::CounterBasedRandomGenerator& generator, uint64_t maximalTraceLength) = 0;
+};
+
+template<typename ValueType>
+class SparseModelTraceSampler : public TraceSampler {
+   public:
+    /*!
+     * Requires the states in which the outcome of a trace is determined. The states that satisfy phi U psi with probability 0 or 1 are not
+     * necessary for the correctness of the outcomes, but they allow to stop traces as soon as their outcome is known.
+     */
+    SparseModelTraceSampler(storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::storage::BitVector const> const& violatingStates,
+                            std::shared_ptr<storm::storage::BitVector const> const& satisfyingStates, std::optional<uint64_t> const& stepBound)
+        : simulator(model), violatingStates(violatingStates), satisfyingStates(satisfyingStates), stepBound(stepBound) {
+        // Intentionally left empty.
+    }
+
+    virtual TraceOutcome simulate(storm::utility::CounterBasedRandomGenerator& generator, uint64_t maximalTraceLength) override {
+        simulator.resetToInitial();
+        for (uint64_t step = 0;; ++step) {
+            uint64_t state = simulator.getCurrentState();
+            if (satisfyingStates->get(state)) {
+                return TraceOutcome::Satisfied;
+            } else if (violatingStates->get(state) || (stepBound && step == stepBound.value())) {
+                return TraceOutcome::Violated;
+            } else if (step == maximalTraceLength) {
+                return TraceOutcome::Undecided;
+            }
+            simulator.step(0, generator.random());
+        }
+    }
+
+   private:
+    storm::simulator::DiscreteTimeSparseModelSimulator<ValueType> simulator;
+    // The states are shared by the samplers of all threads.
+    std::shared_ptr<storm::storage::BitVector const> violatingStates;
+    std::shared_ptr<storm::storage::BitVector const> satisfyingStates;
+    std::optional<uint64_t> stepBound;
+};
+
+template<typename ValueType>
+class ProgramTraceSampler : public TraceSampler {
+   public:
+    ProgramTraceSampler(storm::prism::Program const& program, storm::expressions::Expression const& leftExpression,
+                        storm::expressions::Expression const& rightExpression, std::optional<uint64_t> const& stepBound)
+        : simulator(program, storm::generator::NextStateGeneratorOptions()),
+          leftExpression(leftExpression),
+          rightExpression(rightExpression),
+          stepBound(stepBound) {
+        // Intentionally left empty.
+    }
+
+    virtual TraceOutcome simulate(storm::utility::CounterBasedRandomGenerator& generator, uint64_t maximalTraceLength) override {
+        simulator.resetToInitial();
+        for (uint64_t step = 0;; ++step) {
+            if (simulator.satisfies(rightExpression)) {
+                return TraceOutcome::Satisfied;
+            } else if (!simulator.satisfies(leftExpression) || (stepBound && step == stepBound.value())) {
+                return TraceOutcome::Violated;
+            } else if (step == maximalTraceLength) {
+                return TraceOutcome::Undecided;
+            }
+            // A trace that is stuck in a state that satisfies neither phi nor psi can never satisfy the property. Whether the state is
+            // absorbing is only checked if a step did not change the state, which is rare compared to the number of steps.
+            if (!simulator.step(generator)) {
+                return TraceOutcome::Violated;
+            }
+            if (!simulator.hasLastStepChangedState() && simulator.isCurrentStateAbsorbing()) {
+                return TraceOutcome::Violated;
+            }
+        }
+    }
+
+   private:
+    storm::simulator::DiscreteTimePrismProgramTraceSimulator<ValueType> simulator;
+    storm::expressions::Expression leftExpression;
+    storm::expressions::Expression rightExpression;
+    std::optional<uint64_t> stepBound;
+};
+
+}  // namespace statistical_detail
+
+using namespace statistical_detail;
+
+StatisticalModelCheckerOptions::StatisticalModelCheckerOptions()
+    : stoppingRule(StoppingRule::ChernoffHoeffding),
+      precision(0.01),
+      confidence(0.95),
+      indifference(0.01),
+      maximalTraceLength(100000),
+      batchSize(1000),
+      seed(0) {
+    if (storm::settings::hasModule<storm::settings::modules::StatisticalModelCheckingSettings>()) {
+        auto const& settings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+        stoppingRule = settings.getStoppingRule();
+        precision = settings.getPrecision();
+        confidence = settings.getConfidence();
+        indifference = settings.getIndifference();
+        maximalTraceLength = settings.getMaximalTraceLength();
+        batchSize = settings.getBatchSize();
+        seed = settings.getSeed();
+    }
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(ModelType const& model, StatisticalModelCheckerOptions const& options)
+    : model(&model), options(options) {
+    STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
+                        "The model has multiple initial states. Only the initial state with the lowest index is considered.");
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program, StatisticalModelCheckerOptions const& options)
+    : model(nullptr), program(program.substituteConstantsFormulas()), options(options) {
+    STORM_LOG_THROW(this->program->getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Statistical model checking is only supported for DTMCs.");
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::~StatisticalModelChecker() = default;
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    if (!checkTask.isOnlyInitialStatesRelevantSet() || !formula.isProbabilityOperatorFormula()) {
+        return false;
+    }
+    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    storm::logic::FragmentSpecification const propositional = storm::logic::propositional();
+    if (pathFormula.isEventuallyFormula()) {
+        return pathFormula.asEventuallyFormula().getSubformula().isInFragment(propositional);
+    } else if (pathFormula.isUntilFormula()) {
+        return pathFormula.asUntilFormula().getLeftSubformula().isInFragment(propositional) &&
+               pathFormula.asUntilFormula().getRightSubformula().isInFragment(propositional);
+    } else if (pathFormula.isBoundedUntilFormula()) {
+        storm::logic::BoundedUntilFormula const& boundedUntil = pathFormula.asBoundedUntilFormula();
+        return !boundedUntil.isMultiDimensional() && boundedUntil.getTimeBoundReference().isStepBound() && !boundedUntil.hasLowerBound() &&
+               boundedUntil.hasUpperBound() && boundedUntil.getLeftSubformula().isInFragment(propositional) &&
+               boundedUntil.getRightSubformula().isInFragment(propositional);
+    }
+    return false;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    if (checkTask.isBoundSet() && options.stoppingRule == StatisticalModelCheckerOptions::StoppingRule::Sprt) {
+        double const threshold = checkTask.getBoundThreshold();
+        if (threshold - options.indifference > 0.0 && threshold + options.indifference < 1.0) {
+            return testProbabilityBound(env, getTraceProperty(checkTask.getFormula().getSubformula()), checkTask.getBound());
+        }
+        STORM_LOG_WARN("The indifference region around threshold " << threshold << " exceeds [0,1]. Falling back to the Chernoff-Hoeffding bound.");
+    }
+    return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    return estimateProbability(env, getTraceProperty(checkTask.getFormula()));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeUntilProbabilities(Environment const& env,
+                                                                                           CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    return estimateProbability(env, getTraceProperty(checkTask.getFormula()));
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::TraceProperty StatisticalModelChecker<ModelType>::getTraceProperty(storm::logic::Formula const& pathFormula) {
+    TraceProperty property;
+    if (pathFormula.isEventuallyFormula()) {
+        property.left = storm::logic::Formula::getTrueFormula();
+        property.right = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+    } else if (pathFormula.isUntilFormula()) {
+        property.left = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+        property.right = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+    } else {
+        STORM_LOG_THROW(pathFormula.isBoundedUntilFormula(), storm::exceptions::InvalidPropertyException,
+                        "The formula " << pathFormula << " is not supported by statistical model checking.");
+        storm::logic::BoundedUntilFormula const& boundedUntil = pathFormula.asBoundedUntilFormula();
+        STORM_LOG_THROW(!boundedUntil.isMultiDimensional() && boundedUntil.getTimeBoundReference().isStepBound(), storm::exceptions::NotSupportedException,
+                        "Statistical model checking only supports a single step bound.");
+        STORM_LOG_THROW(!boundedUntil.hasLowerBound() && boundedUntil.hasUpperBound(), storm::exceptions::NotSupportedException,
+                        "Statistical model checking only supports upper step bounds.");
+        property.left = boundedUntil.getLeftSubformula().asSharedPointer();
+        property.right = boundedUntil.getRightSubformula().asSharedPointer();
+        property.stepBound = boundedUntil.getNonStrictUpperBound<uint64_t>();
+    }
+    return property;
+}
+
+template<typename ModelType>
+std::vector<std::unique_ptr<TraceSampler>> StatisticalModelChecker<ModelType>::createTraceSamplers(Environment const& env, TraceProperty const& property,
+                                                                                                 uint64_t numberOfSamplers) const {
+    std::vector<std::unique_ptr<TraceSampler>> samplers;
+    if (model) {
+        storm::modelchecker::SparsePropositionalModelChecker<ModelType> propositionalChecker(*model);
+        storm::storage::BitVector leftStates = propositionalChecker.check(env, *property.left)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        storm::storage::BitVector rightStates = propositionalChecker.check(env, *property.right)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        auto statesWithProbability01 = storm::utility::graph::performProb01(*model, leftStates, rightStates);
+        auto violatingStates = std::make_shared<storm::storage::BitVector const>(std::move(statesWithProbability01.first));
+        // With a step bound, states that reach psi with probability one might still miss the bound.
+        auto satisfyingStates =
+            std::make_shared<storm::storage::BitVector const>(property.stepBound ? std::move(rightStates) : std::move(statesWithProbability01.second));
+        for (uint64_t sampler = 0; sampler < numberOfSamplers; ++sampler) {
+            samplers.push_back(std::make_unique<SparseModelTraceSampler<ValueType>>(*model, violatingStates, satisfyingStates, property.stepBound));
+        }
+    } else {
+        auto labelToExpressionMapping = program->getLabelToExpressionMapping();
+        storm::expressions::Expression leftExpression = property.left->toExpression(program->getManager(), labelToExpressionMapping);
+        storm::expressions::Expression rightExpression = property.right->toExpression(program->getManager(), labelToExpressionMapping);
+        for (uint64_t sampler = 0; sampler < numberOfSamplers; ++sampler) {
+            samplers.push_back(std::make_unique<ProgramTraceSampler<ValueType>>(program.value(), leftExpression, rightExpression, property.stepBound));
+        }
+    }
+    return samplers;
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::simulateTraces(std::vector<std::unique_ptr<TraceSampler>>& samplers, uint64_t firstTrace,
+                                                        std::vector<TraceOutcome>& outcomes) const {
+    storm::utility::parallel::forEachChunk(samplers.size(), outcomes.size(), options.batchSize, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+        for (uint64_t trace = begin; trace < end; ++trace) {
+            storm::utility::CounterBasedRandomGenerator generator(options.seed, firstTrace + trace);
+            outcomes[trace] = samplers[threadIndex]->simulate(generator, options.maximalTraceLength);
+        }
+    });
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::estimateProbability(Environment const& env, TraceProperty const& property) const {
+    // By the Chernoff-Hoeffding bound, the estimate deviates by more than the precision with probability at most 2 * exp(-2 * n * precision^2).
+    uint64_t const numberOfTraces =
+        static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - options.confidence)) / (2.0 * options.precision * options.precision)));
+    uint64_t const numberOfThreads = std::max<uint64_t>(env.solver().getNumberOfThreads(), 1);
+    auto samplers = createTraceSamplers(env, property, numberOfThreads);
+    STORM_LOG_INFO("Simulating " << numberOfTraces << " traces to achieve precision " << options.precision << " with confidence " << options.confidence << ".");
+
+    uint64_t numberOfSatisfyingTraces = 0;
+    uint64_t numberOfUndecidedTraces = 0;
+    std::vector<TraceOutcome> outcomes;
+    for (uint64_t firstTrace = 0; firstTrace < numberOfTraces; firstTrace += outcomes.size()) {
+        outcomes.resize(std::min(batchesPerRound * options.batchSize, numberOfTraces - firstTrace));
+        simulateTraces(samplers, firstTrace, outcomes);
+        numberOfSatisfyingTraces += std::count(outcomes.begin(), outcomes.end(), TraceOutcome::Satisfied);
+        numberOfUndecidedTraces += std::count(outcomes.begin(), outcomes.end(), TraceOutcome::Undecided);
+    }
+    STORM_LOG_WARN_COND(numberOfUndecidedTraces == 0, numberOfUndecidedTraces << " traces exceeded the maximal length of " << options.maximalTraceLength
+                                                                              << " steps and were considered as violating the property.");
+
+    double estimate = static_cast<double>(numberOfSatisfyingTraces) / static_cast<double>(numberOfTraces);
+    STORM_LOG_INFO("Estimated probability " << estimate << " from " << numberOfTraces << " traces.");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(getInitialState(), estimate);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::testProbabilityBound(Environment const& env, TraceProperty const& property,
+                                                                                      storm::logic::Bound const& bound) const {
+    // Wald's test of the hypothesis H0: p >= threshold + indifference against H1: p <= threshold - indifference, where the probability of
+    // accepting the wrong hypothesis is bounded by 1 - confidence in both cases.
+    double const threshold = bound.threshold.evaluateAsDouble();
+    double const p0 = threshold + options.indifference;
+    double const p1 = threshold - options.indifference;
+    double const error = 1.0 - options.confidence;
+    double const acceptH1Bound = std::log((1.0 - error) / error);
+    double const acceptH0Bound = std::log(error / (1.0 - error));
+    double const satisfiedIncrement = std::log(p1 / p0);
+    double const violatedIncrement = std::log((1.0 - p1) / (1.0 - p0));
+
+    uint64_t const numberOfThreads = std::max<uint64_t>(env.solver().getNumberOfThreads(), 1);
+    auto samplers = createTraceSamplers(env, property, numberOfThreads);
+
+    // The logarithm of the ratio between the likelihoods of the outcomes under H1 and H0.
+    double logLikelihoodRatio = 0.0;
+    uint64_t numberOfTraces = 0;
+    uint64_t numberOfUndecidedTraces = 0;
+    std::optional<bool> acceptedH0;
+    std::vector<TraceOutcome> outcomes(batchesPerRound * options.batchSize);
+    while (!acceptedH0) {
+        simulateTraces(samplers, numberOfTraces, outcomes);
+        // Evaluate the outcomes in the order of the traces, so that the decision does not depend on the number of threads.
+        for (auto outcome : outcomes) {
+            ++numberOfTraces;
+            if (outcome == TraceOutcome::Satisfied) {
+                logLikelihoodRatio += satisfiedIncrement;
+            } else {
+                numberOfUndecidedTraces += outcome == TraceOutcome::Undecided ? 1 : 0;
+                logLikelihoodRatio += violatedIncrement;
+            }
+            if (logLikelihoodRatio <= acceptH0Bound) {
+                acceptedH0 = true;
+                break;
+            } else if (logLikelihoodRatio >= acceptH1Bound) {
+                acceptedH0 = false;
+                break;
+            }
+        }
+    }
+    STORM_LOG_WARN_COND(numberOfUndecidedTraces == 0, numberOfUndecidedTraces << " traces exceeded the maximal length of " << options.maximalTraceLength
+                                                                              << " steps and were considered as violating the property.");
+    STORM_LOG_INFO("Decided that the probability is " << (acceptedH0.value() ? "at least " : "at most ") << (acceptedH0.value() ? p0 : p1) << " after "
+                                                       << numberOfTraces << " traces.");
+
+    bool result = acceptedH0.value() == (bound.comparisonType == storm::logic::ComparisonType::Greater ||
+                                         bound.comparisonType == storm::logic::ComparisonType::GreaterEqual);
+    return std::make_unique<ExplicitQualitativeCheckResult>(getInitialState(), result);
+}
+
+template<typename ModelType>
+uint64_t StatisticalModelChecker<ModelType>::getInitialState() const {
+    // Simulations on the program start in the (unique) initial state, which gets index zero.
+    return model ? *model->getInitialStates().begin() : 0;
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace statistical_detail {
+class TraceSampler;
+enum class TraceOutcome : uint8_t;
+}  // namespace statistical_detail
+
+/*!
+ * Options for the statistical model checker. The default values are taken from the statistical model checking settings (if registered).
+ */
+struct StatisticalModelCheckerOptions {
+    StatisticalModelCheckerOptions();
+
+    typedef storm::settings::modules::StatisticalModelCheckingSettings::StoppingRule StoppingRule;
+
+    // The rule that determines when to stop the simulation.
+    StoppingRule stoppingRule;
+    // The maximal absolute error of estimated probabilities.
+    double precision;
+    // The probability with which the result needs to be correct.
+    double confidence;
+    // The half-width of the indifference region around the threshold of a probability bound (only for the sequential probability ratio test).
+    double indifference;
+    // The maximal number of steps of a trace.
+    uint64_t maximalTraceLength;
+    // The number of traces that are simulated in one batch by the same thread.
+    uint64_t batchSize;
+    // The seed from which the random numbers of all traces are derived.
+    uint64_t seed;
+};
+
+/*!
+ * Estimates (bounded) until probabilities of discrete-time Markov chains by simulating many independent traces.
+ *
+ * The traces are either simulated on a sparse model or directly on a PRISM program. In the latter case, only the current state of each trace is
+ * kept in memory, which allows to analyse models whose transition matrix does not fit in memory.
+ * The random numbers of a trace are drawn from a counter-based generator that only depends on the seed and the index of the trace. Traces are
+ * simulated in rounds and their outcomes are combined in the order of the traces, so the result does not depend on the number of threads.
+ *
+ * Without probability bound (or with the Chernoff-Hoeffding rule), the number of traces is chosen such that the estimate deviates from the actual
+ * probability by at most the precision with (at least) the given confidence. With the sequential probability ratio test, a probability bound is
+ * decided as soon as the traces simulated so far suffice, which typically requires much fewer traces if the probability is far from the threshold.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker that simulates the traces on the given sparse model.
+     */
+    explicit StatisticalModelChecker(ModelType const& model, StatisticalModelCheckerOptions const& options = StatisticalModelCheckerOptions());
+
+    /*!
+     * Creates a model checker that simulates the traces directly on the given program, i.e. without building the state space.
+     */
+    explicit StatisticalModelChecker(storm::prism::Program const& program, StatisticalModelCheckerOptions const& options = StatisticalModelCheckerOptions());
+
+    virtual ~StatisticalModelChecker();
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * A path property phi U psi (with an optional upper step bound) that is decided on each trace.
+     */
+    struct TraceProperty {
+        std::shared_ptr<storm::logic::Formula const> left;
+        std::shared_ptr<storm::logic::Formula const> right;
+        std::optional<uint64_t> stepBound;
+    };
+
+    /*!
+     * Retrieves the property of the traces described by the given path formula.
+     */
+    static TraceProperty getTraceProperty(storm::logic::Formula const& pathFormula);
+
+    /*!
+     * Creates the given number of samplers (one per thread) for the given property.
+     */
+    std::vector<std::unique_ptr<statistical_detail::TraceSampler>> createTraceSamplers(Environment const& env, TraceProperty const& property,
+                                                                                       uint64_t numberOfSamplers) const;
+
+    /*!
+     * Simulates the traces with indices firstTrace, firstTrace + 1, ... and stores their outcomes in the given vector, whose size determines the
+     * number of simulated traces.
+     */
+    void simulateTraces(std::vector<std::unique_ptr<statistical_detail::TraceSampler>>& samplers, uint64_t firstTrace,
+                        std::vector<statistical_detail::TraceOutcome>& outcomes) const;
+
+    /*!
+     * Estimates the probability of the given property using the Chernoff-Hoeffding bound.
+     */
+    std::unique_ptr<CheckResult> estimateProbability(Environment const& env, TraceProperty const& property) const;
+
+    /*!
+     * Decides whether the probability of the given property satisfies the given bound using the sequential probability ratio test.
+     */
+    std::unique_ptr<CheckResult> testProbabilityBound(Environment const& env, TraceProperty const& property, storm::logic::Bound const& bound) const;
+
+    /*!
+     * Retrieves the index of the state for which the results are computed.
+     */
+    uint64_t getInitialState() const;
+
+    // The model on which the traces are simulated (if any).
+    ModelType const* model;
+
+    // The program on which the traces are simulated (if any).
+    std::optional<storm::prism::Program> program;
+
+    StatisticalModelCheckerOptions options;
+
+    // The number of batches that are simulated before the stopping rule is checked.
+    static constexpr uint64_t batchesPerRound = 64;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,249 @@
+#include "storm/models/sparse/AnalysisCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/MemoryLimit.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+namespace {
+// The types of the cached results. The four lowest bits of a key type are reserved for these.
+uint64_t constexpr BackwardTransitionsType = 0;
+uint64_t constexpr SccDecompositionType = 1;
+uint64_t constexpr MecDecompositionType = 2;
+uint64_t constexpr QualitativeStateSetsType = 3;
+
+uint64_t getDefaultMemoryBudget() {
+    uint64_t megabytes = storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()
+                             ? storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getAnalysisCacheSize()
+                             : storm::settings::modules::ModelCheckerSettings::DefaultAnalysisCacheSize;
+    return megabytes * 1024 * 1024;
+}
+
+uint64_t getSize(storm::storage::BitVector const& bitVector) {
+    return sizeof(bitVector) + (bitVector.size() + 63) / 64 * sizeof(uint64_t);
+}
+
+template<typename ValueType>
+uint64_t getSize(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return sizeof(matrix) + matrix.getEntryCount() * sizeof(typename storm::storage::SparseMatrix<ValueType>::value_type) +
+           (matrix.getRowCount() + matrix.getRowGroupCount() + 2) * sizeof(uint64_t);
+}
+
+template<typename BlockType>
+uint64_t getSize(storm::storage::Decomposition<BlockType> const& decomposition) {
+    uint64_t result = sizeof(decomposition) + decomposition.size() * sizeof(BlockType);
+    for (auto const& block : decomposition) {
+        result += block.size() * 4 * sizeof(uint64_t);
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+AnalysisCache<ValueType>::AnalysisCache() : AnalysisCache(getDefaultMemoryBudget()) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+AnalysisCache<ValueType>::AnalysisCache(uint64_t memoryBudget) : memoryBudget(memoryBudget), usedMemory(0), hits(0), misses(0) {
+    reclaimerIdentifier = storm::utility::resources::registerMemoryReclaimer([this]() {
+        uint64_t freedMemory = getUsedMemory();
+        clear();
+        return freedMemory;
+    });
+}
+
+template<typename ValueType>
+AnalysisCache<ValueType>::~AnalysisCache() {
+    // This has to happen first, as the reclaimer might be running concurrently.
+    storm::utility::resources::unregisterMemoryReclaimer(reclaimerIdentifier);
+}
+
+template<typename ValueType>
+bool AnalysisCache<ValueType>::Key::operator==(Key const& other) const {
+    return type == other.type && sets == other.sets;
+}
+
+template<typename ValueType>
+std::size_t AnalysisCache<ValueType>::KeyHash::operator()(Key const& key) const {
+    std::size_t result = std::hash<uint64_t>()(key.type);
+    for (auto const& set : key.sets) {
+        result ^= std::hash<storm::storage::BitVector>()(set) + 0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> AnalysisCache<ValueType>::getBackwardTransitions(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    return getOrCompute<storm::storage::SparseMatrix<ValueType>>(
+        Key{BackwardTransitionsType, {}}, [&]() { return transitionMatrix.transpose(true); },
+        [](storm::storage::SparseMatrix<ValueType> const& matrix) { return getSize(matrix); });
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType> const> AnalysisCache<ValueType>::getStronglyConnectedComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions const& options) {
+    // Encode the options in the key. The subsystem and the choices are distinguished from the default (all states and choices) by a flag.
+    Key key{SccDecompositionType, {}};
+    uint64_t flag = 1ull << 4;
+    for (bool value : {options.areNaiveSccsDropped, options.areOnlyBottomSccsConsidered, options.isTopologicalSortForced, options.isComputeSccDepthsSet,
+                       options.subsystemPtr != nullptr, options.choicesPtr != nullptr}) {
+        if (value) {
+            key.type |= flag;
+        }
+        flag <<= 1;
+    }
+    if (options.subsystemPtr) {
+        key.sets.push_back(*options.subsystemPtr);
+    }
+    if (options.choicesPtr) {
+        key.sets.push_back(*options.choicesPtr);
+    }
+    return getOrCompute<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
+        std::move(key), [&]() { return storm::storage::StronglyConnectedComponentDecomposition<ValueType>(transitionMatrix, options); },
+        [](storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition) { return getSize(decomposition); });
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> AnalysisCache<ValueType>::getMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& states, storm::storage::BitVector const* choices) {
+    Key key{MecDecompositionType, {states}};
+    if (choices) {
+        key.type |= 1ull << 4;
+        key.sets.push_back(*choices);
+    }
+    return getOrCompute<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+        std::move(key),
+        [&]() {
+            if (choices) {
+                return storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, states, *choices);
+            }
+            return storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, states);
+        },
+        [](storm::storage::MaximalEndComponentDecomposition<ValueType> const& decomposition) {
+            uint64_t result = sizeof(decomposition) + decomposition.size() * sizeof(storm::storage::MaximalEndComponent);
+            for (auto const& mec : decomposition) {
+                for (auto const& stateChoices : mec) {
+                    // Account for the node of the hash map and the choices of the state.
+                    result += 6 * sizeof(uint64_t) + stateChoices.second.size() * sizeof(uint64_t);
+                }
+            }
+            return result;
+        });
+}
+
+template<typename ValueType>
+std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> AnalysisCache<ValueType>::getQualitativeStateSets(
+    QualitativeAnalysis analysis, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& compute) {
+    Key key{QualitativeStateSetsType | (static_cast<uint64_t>(analysis) << 4), {phiStates, psiStates}};
+    return getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(
+        std::move(key), compute,
+        [](std::pair<storm::storage::BitVector, storm::storage::BitVector> const& sets) { return getSize(sets.first) + getSize(sets.second); });
+}
+
+template<typename ValueType>
+template<typename ResultType, typename ComputeFunction, typename SizeFunction>
+std::shared_ptr<ResultType const> AnalysisCache<ValueType>::getOrCompute(Key&& key, ComputeFunction const& compute, SizeFunction const& size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto indexIt = index.find(key);
+        if (indexIt != index.end()) {
+            ++hits;
+            // Mark the entry as the most recently used one.
+            entries.splice(entries.begin(), entries, indexIt->second);
+            return std::static_pointer_cast<ResultType const>(indexIt->second->value);
+        }
+        ++misses;
+    }
+
+    // Compute the result without holding the lock, so other threads can use the cache in the meantime.
+    auto result = std::make_shared<ResultType const>(compute());
+
+    // The key also accounts for the memory of the entry as it stores the bit vectors of the key.
+    uint64_t resultSize = size(*result);
+    for (auto const& set : key.sets) {
+        resultSize += getSize(set);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (resultSize <= memoryBudget && index.count(key) == 0) {
+        auto indexIt = index.emplace(std::move(key), entries.end()).first;
+        entries.push_front(Entry{&indexIt->first, result, resultSize});
+        indexIt->second = entries.begin();
+        usedMemory += resultSize;
+        evict();
+    }
+    return result;
+}
+
+template<typename ValueType>
+void AnalysisCache<ValueType>::evict() {
+    while (usedMemory > memoryBudget) {
+        STORM_LOG_ASSERT(!entries.empty(), "Used memory is positive although the cache is empty.");
+        Entry const& entry = entries.back();
+        usedMemory -= entry.size;
+        index.erase(*entry.key);
+        entries.pop_back();
+    }
+}
+
+template<typename ValueType>
+void AnalysisCache<ValueType>::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+    usedMemory = 0;
+}
+
+template<typename ValueType>
+void AnalysisCache<ValueType>::setMemoryBudget(uint64_t memoryBudget) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->memoryBudget = memoryBudget;
+    evict();
+}
+
+template<typename ValueType>
+uint64_t AnalysisCache<ValueType>::getMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return memoryBudget;
+}
+
+template<typename ValueType>
+uint64_t AnalysisCache<ValueType>::getUsedMemory() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return usedMemory;
+}
+
+template<typename ValueType>
+uint64_t AnalysisCache<ValueType>::getNumberOfHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+template<typename ValueType>
+uint64_t AnalysisCache<ValueType>::getNumberOfMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+template class AnalysisCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class AnalysisCache<storm::RationalNumber>;
+template class AnalysisCache<storm::RationalFunction>;
+#endif
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -0,0 +1,161 @@
+#ifndef STORM_MODELS_SPARSE_ANALYSISCACHE_H_
+#define STORM_MODELS_SPARSE_ANALYSISCACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+
+template<typename ValueType>
+class MaximalEndComponentDecomposition;
+
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+
+struct StronglyConnectedComponentDecompositionOptions;
+}  // namespace storage
+
+namespace models {
+namespace sparse {
+
+/*!
+ * Caches the results of (graph-based) analyses of a sparse model, such as its backward transitions, its SCC and MEC decompositions and the
+ * states with probability 0 and 1 for until formulas. When several properties are checked on the same model, these results can then be
+ * reused instead of being recomputed for every property. The cache is bounded by a memory budget; if a new result exceeds the budget,
+ * the least recently used results are evicted.
+ *
+ * All results are computed w.r.t. the transition matrix that is passed to the getters, which has to be the transition matrix of the model
+ * that the cache belongs to. The cache is thread-safe. If a memory limit is set (see storm::utility::resources::setMemoryLimit), the cache is
+ * cleared when the limit is approached.
+ */
+template<typename ValueType>
+class AnalysisCache {
+   public:
+    /*!
+     * The qualitative analyses whose results can be cached (see storm::utility::graph).
+     */
+    enum class QualitativeAnalysis { Prob01, Prob01Min, Prob01Max };
+
+    /*!
+     * Creates an empty cache with the memory budget given by the modelchecker settings.
+     */
+    AnalysisCache();
+
+    /*!
+     * Creates an empty cache with the given memory budget (in bytes).
+     */
+    explicit AnalysisCache(uint64_t memoryBudget);
+
+    ~AnalysisCache();
+
+    /*!
+     * Retrieves the backward transitions, i.e., the transposed transition matrix (with row groups being ignored).
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the SCC decomposition of the model for the given options. The number of threads in the options does not influence which
+     * result is retrieved.
+     */
+    std::shared_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType> const> getStronglyConnectedComponentDecomposition(
+        storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions const& options);
+
+    /*!
+     * Retrieves the MEC decomposition of the subsystem given by the states (and, optionally, the choices).
+     */
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getMaximalEndComponentDecomposition(
+        storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        storm::storage::BitVector const& states, storm::storage::BitVector const* choices = nullptr);
+
+    /*!
+     * Retrieves the result of the given qualitative analysis for the given phi and psi states. If the result is not cached yet, it is
+     * obtained from the given function.
+     *
+     * @param compute A function that computes the pair of states with probability 0 and 1, respectively.
+     */
+    std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> getQualitativeStateSets(
+        QualitativeAnalysis analysis, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+        std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& compute);
+
+    /*!
+     * Removes all cached results.
+     */
+    void clear();
+
+    /*!
+     * Sets the memory budget (in bytes). A budget of zero disables the cache.
+     */
+    void setMemoryBudget(uint64_t memoryBudget);
+    uint64_t getMemoryBudget() const;
+
+    /*!
+     * Retrieves the (estimated) number of bytes occupied by the cached results.
+     */
+    uint64_t getUsedMemory() const;
+
+    /*!
+     * Retrieves the number of requests that were answered from (not answered from) the cache.
+     */
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+
+   private:
+    struct Key {
+        uint64_t type;
+        std::vector<storm::storage::BitVector> sets;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry {
+        Key const* key;
+        std::shared_ptr<void const> value;
+        uint64_t size;
+    };
+
+    /*!
+     * Retrieves the result for the given key. If it is not cached, the result is computed (without holding the lock) and inserted if it fits
+     * into the memory budget.
+     */
+    template<typename ResultType, typename ComputeFunction, typename SizeFunction>
+    std::shared_ptr<ResultType const> getOrCompute(Key&& key, ComputeFunction const& compute, SizeFunction const& size);
+
+    /*!
+     * Evicts the least recently used entries until the used memory fits into the budget. Has to be called while holding the lock.
+     */
+    void evict();
+
+    mutable std::mutex mutex;
+    uint64_t memoryBudget;
+    uint64_t usedMemory;
+    uint64_t hits;
+    uint64_t misses;
+
+    // The identifier under which the cache is registered as memory reclaimer.
+    uint64_t reclaimerIdentifier;
+
+    // The cached results, ordered from the most recently used to the least recently used one.
+    std::list<Entry> entries;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index;
+};
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
+
+#endif /* STORM_MODELS_SPARSE_ANALYSISCACHE_H_ */
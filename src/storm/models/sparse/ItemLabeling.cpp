@@ -1,5 +1,7 @@
 #include "storm/models/sparse/ItemLabeling.h"
 
+#include <mutex>
+
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
 
@@ -10,7 +12,13 @@
 namespace storm {
 namespace models {
 namespace sparse {
-ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings() {
+
+namespace {
+// Guards the conversion of compressed labelings, which may happen in const member functions.
+std::mutex compressedLabelingMutex;
+}  // namespace
+
+ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings(), compressedLabelings() {
     // Intentionally left empty.
 }
 
@@ -45,7 +53,20 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
+        uint64_t otherIndex = other.nameToLabelingIndexMap.at(labelIndexPair.first);
+        auto const& compressed = compressedLabelings[labelIndexPair.second];
+        auto const& otherCompressed = other.compressedLabelings[otherIndex];
+        bool equal;
+        if (compressed && otherCompressed) {
+            equal = compressed.value() == otherCompressed.value();
+        } else if (compressed) {
+            equal = compressed.value() == other.labelings[otherIndex];
+        } else if (otherCompressed) {
+            equal = otherCompressed.value() == labelings[labelIndexPair.second];
+        } else {
+            equal = labelings[labelIndexPair.second] == other.labelings[otherIndex];
+        }
+        if (!equal) {
             return false;
         }
     }
@@ -55,7 +76,12 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
 ItemLabeling ItemLabeling::getSubLabeling(storm::storage::BitVector const& items) const {
     ItemLabeling result(items.getNumberOfSetBits());
     for (auto const& labelIndexPair : nameToLabelingIndexMap) {
-        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        auto const& compressed = compressedLabelings[labelIndexPair.second];
+        if (compressed) {
+            result.addLabel(labelIndexPair.first, compressed->toBitVector() % items);
+        } else {
+            result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        }
     }
     return result;
 }
@@ -73,6 +99,8 @@ void ItemLabeling::removeLabel(std::string const& label) {
     // Erase label by 'swap and pop'
     std::iter_swap(labelings.begin() + labelIndex, labelings.end() - 1);
     labelings.pop_back();
+    std::iter_swap(compressedLabelings.begin() + labelIndex, compressedLabelings.end() - 1);
+    compressedLabelings.pop_back();
 
     // Update index of labeling we swapped from the end
     for (auto& it : nameToLabelingIndexMap) {
@@ -115,12 +143,15 @@ std::set<std::string> ItemLabeling::getLabelsOfItem(uint64_t item) const {
 
 void ItemLabeling::permuteItems(std::vector<uint64_t> const& inversePermutation) {
     STORM_LOG_THROW(inversePermutation.size() == itemCount, storm::exceptions::InvalidArgumentException, "Permutation does not match number of items");
-    std::vector<storm::storage::BitVector> newLabelings;
-    for (storm::storage::BitVector const& source : this->labelings) {
-        newLabelings.push_back(source.permute(inversePermutation));
+    for (uint64_t labelIndex = 0; labelIndex < labelings.size(); ++labelIndex) {
+        auto& compressed = compressedLabelings[labelIndex];
+        if (compressed) {
+            compressed = compressed->permute(inversePermutation);
+            labelings[labelIndex] = storm::storage::BitVector();
+        } else {
+            labelings[labelIndex] = labelings[labelIndex].permute(inversePermutation);
+        }
     }
-
-    this->labelings = newLabelings;
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector const& labeling) {
@@ -128,7 +159,9 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector const&
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.push_back(labeling);
+    labelings.emplace_back();
+    compressedLabelings.emplace_back();
+    storeLabeling(labelings.size() - 1, storage::BitVector(labeling));
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -136,7 +169,9 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& label
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.emplace_back(std::move(labeling));
+    labelings.emplace_back();
+    compressedLabelings.emplace_back();
+    storeLabeling(labelings.size() - 1, std::move(labeling));
 }
 
 std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -158,20 +193,42 @@ bool ItemLabeling::containsLabel(std::string const& label) const {
 void ItemLabeling::addLabelToItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    if (compressedLabelings[labelIndex]) {
+        compressedLabelings[labelIndex]->set(item, true);
+        std::lock_guard<std::mutex> lock(compressedLabelingMutex);
+        if (labelings[labelIndex].size() == itemCount) {
+            labelings[labelIndex].set(item, true);
+        }
+    } else {
+        this->labelings[labelIndex].set(item, true);
+    }
 }
 
 void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
     STORM_LOG_THROW(this->getItemHasLabel(label, item), storm::exceptions::InvalidArgumentException,
                     "Item " << item << " does not have label '" << label << "'.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    if (compressedLabelings[labelIndex]) {
+        compressedLabelings[labelIndex]->set(item, false);
+        std::lock_guard<std::mutex> lock(compressedLabelingMutex);
+        if (labelings[labelIndex].size() == itemCount) {
+            labelings[labelIndex].set(item, false);
+        }
+    } else {
+        this->labelings[labelIndex].set(item, false);
+    }
 }
 
 bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label '" << label << "' is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)].get(item);
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    if (compressedLabelings[labelIndex]) {
+        return compressedLabelings[labelIndex]->get(item);
+    }
+    return this->labelings[labelIndex].get(item);
 }
 
 std::size_t ItemLabeling::getNumberOfLabels() const {
@@ -185,27 +242,29 @@ std::size_t ItemLabeling::getNumberOfItems() const {
 storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)];
+    return getLabeling(nameToLabelingIndexMap.at(label));
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector const& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    storeLabeling(nameToLabelingIndexMap.at(label), storage::BitVector(labeling));
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    storeLabeling(nameToLabelingIndexMap.at(label), std::move(labeling));
 }
 
 void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
     out << this->getNumberOfLabels() << " labels\n";
     for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second].getNumberOfSetBits() << " item(s)\n";
+        auto const& compressed = compressedLabelings[labelIndexPair.second];
+        uint64_t numberOfItems = compressed ? compressed->getNumberOfSetBits() : labelings[labelIndexPair.second].getNumberOfSetBits();
+        out << "   * " << labelIndexPair.first << " -> " << numberOfItems << " item(s)\n";
     }
 }
 
@@ -213,13 +272,35 @@ void ItemLabeling::printCompleteLabelingInformationToStream(std::ostream& out) c
     out << "Labels: \t" << this->getNumberOfLabels() << '\n';
     for (auto label : nameToLabelingIndexMap) {
         out << "Label '" << label.first << "': ";
-        for (auto index : this->labelings[label.second]) {
+        auto const& compressed = compressedLabelings[label.second];
+        for (auto index : compressed ? compressed->getSetIndices() : labelings[label.second].getSetIndices()) {
             out << index << " ";
         }
         out << '\n';
     }
 }
 
+storm::storage::BitVector const& ItemLabeling::getLabeling(uint64_t labelIndex) const {
+    auto const& compressed = compressedLabelings[labelIndex];
+    if (compressed) {
+        std::lock_guard<std::mutex> lock(compressedLabelingMutex);
+        if (labelings[labelIndex].size() != itemCount) {
+            labelings[labelIndex] = compressed->toBitVector();
+        }
+    }
+    return labelings[labelIndex];
+}
+
+void ItemLabeling::storeLabeling(uint64_t labelIndex, storm::storage::BitVector&& labeling) {
+    if (storm::storage::RoaringBitVector::isSparse(labeling.getNumberOfSetBits(), itemCount)) {
+        compressedLabelings[labelIndex] = storm::storage::RoaringBitVector(labeling);
+        labelings[labelIndex] = storm::storage::BitVector();
+    } else {
+        compressedLabelings[labelIndex] = std::nullopt;
+        labelings[labelIndex] = std::move(labeling);
+    }
+}
+
 std::size_t ItemLabeling::hash() const {
     return 0;
 }
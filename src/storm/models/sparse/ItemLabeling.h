@@ -1,11 +1,13 @@
 #pragma once
 
 #include <iostream>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/RoaringBitVector.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -17,6 +19,9 @@ class ChoiceLabeling;
 
 /*!
  * A base class managing the labeling of items with a number of (atomic) labels.
+ *
+ * Labels that hold only few items (e.g. the initial states or the targets of large models) are stored as compressed bit vectors. They are
+ * converted to a BitVector when they are first requested via getItems, which is transparent for the users of this class.
  */
 class ItemLabeling {
    public:
@@ -228,8 +233,21 @@ class ItemLabeling {
     // A mapping from labels to the index of the corresponding bit vector in the vector.
     std::unordered_map<std::string, uint64_t> nameToLabelingIndexMap;
 
-    // A vector that holds the labeling for all known labels.
-    std::vector<storm::storage::BitVector> labelings;
+    // A vector that holds the labeling for all known labels. For a compressed label, the entry is empty until the label is requested.
+    mutable std::vector<storm::storage::BitVector> labelings;
+
+    // For each label, the compressed labeling if the label is sparse.
+    std::vector<std::optional<storm::storage::RoaringBitVector>> compressedLabelings;
+
+    /*!
+     * Retrieves the labeling with the given index, converting it to a BitVector if it is stored compressed.
+     */
+    storm::storage::BitVector const& getLabeling(uint64_t labelIndex) const;
+
+    /*!
+     * Stores the given labeling at the given index, compressing it if it is sparse.
+     */
+    void storeLabeling(uint64_t labelIndex, storm::storage::BitVector&& labeling);
 
     /*!
      * Generate a unique, previously unused label from the given prefix string.
@@ -8,6 +8,7 @@
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/io/export.h"
+#include "storm/models/sparse/AnalysisCache.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -30,7 +31,8 @@ Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sp
       rewardModels(components.rewardModels),
       choiceLabeling(components.choiceLabeling),
       stateValuations(components.stateValuations),
-      choiceOrigins(components.choiceOrigins) {
+      choiceOrigins(components.choiceOrigins),
+      analysisCache(std::make_shared<AnalysisCache<ValueType>>()) {
     assertValidityOfComponents(components);
 }
 
@@ -42,7 +44,8 @@ Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sp
       rewardModels(std::move(components.rewardModels)),
       choiceLabeling(std::move(components.choiceLabeling)),
       stateValuations(std::move(components.stateValuations)),
-      choiceOrigins(std::move(components.choiceOrigins)) {
+      choiceOrigins(std::move(components.choiceOrigins)),
+      analysisCache(std::make_shared<AnalysisCache<ValueType>>()) {
     assertValidityOfComponents(components);
 }
 
@@ -149,6 +152,21 @@ storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBa
     return this->getTransitionMatrix().transpose(true);
 }
 
+template<typename ValueType, typename RewardModelType>
+AnalysisCache<ValueType>& Model<ValueType, RewardModelType>::getAnalysisCache() const {
+    return *analysisCache;
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::invalidateAnalysisCache() {
+    // Copies of this model that share the cache keep their results.
+    if (analysisCache.use_count() > 1) {
+        analysisCache = std::make_shared<AnalysisCache<ValueType>>();
+    } else {
+        analysisCache->clear();
+    }
+}
+
 template<typename ValueType, typename RewardModelType>
 typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
     return this->getTransitionMatrix().getRowGroup(state);
@@ -616,11 +634,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    invalidateAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    invalidateAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
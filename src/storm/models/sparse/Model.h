@@ -27,6 +27,9 @@ namespace sparse {
 template<typename ValueType>
 class StandardRewardModel;
 
+template<typename ValueType>
+class AnalysisCache;
+
 /*!
  * Base class for all sparse models.
  */
@@ -59,6 +62,21 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Retrieves the cache for analysis results of this model (e.g. its backward transitions or its MEC decomposition) that are shared
+     * when checking several properties on this model. Copies of a model share the cache until the transition matrix of one of them is
+     * replaced or the cache of one of them is invalidated.
+     *
+     * @return The analysis cache of this model.
+     */
+    AnalysisCache<ValueType>& getAnalysisCache() const;
+
+    /*!
+     * Discards the cached analysis results of this model. This needs to be called after modifying the matrix obtained from the non-const
+     * getTransitionMatrix(). Copies of this model that share the cache keep their results.
+     */
+    void invalidateAnalysisCache();
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -126,7 +144,8 @@ class Model : public storm::models::Model<CValueType> {
     storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
 
     /*!
-     * Retrieves the matrix representing the transitions of the model.
+     * Retrieves the matrix representing the transitions of the model. If the matrix is modified, the analysis cache has to be
+     * invalidated afterwards (see invalidateAnalysisCache()).
      *
      * @return A matrix representing the transitions of the model.
      */
@@ -452,6 +471,9 @@ class Model : public storm::models::Model<CValueType> {
 
     // if set, gives information about where each choice originates w.r.t. the input model description
     std::optional<std::shared_ptr<storm::storage::sparse::ChoiceOrigins>> choiceOrigins;
+
+    // The cached analysis results of this model.
+    mutable std::shared_ptr<AnalysisCache<ValueType>> analysisCache;
 };
 
 #ifdef STORM_HAVE_CARL
@@ -38,6 +38,7 @@
 #include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 #include "storm/settings/modules/Smt2SmtSolverSettings.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
@@ -48,7 +49,22 @@
 namespace storm {
 namespace settings {
 
-SettingsManager::SettingsManager() : modules(), longNameToOptions(), shortNameToOptions(), moduleOptions() {}
+namespace {
+/*!
+ * Checks whether the given name (as given on the command line) refers to the given option.
+ */
+bool isNameOfOption(std::string const& name, bool isShortName, Option const& option) {
+    if (isShortName) {
+        if (!option.getHasShortName()) {
+            return false;
+        }
+        return name == option.getModuleName() + ":" + option.getShortName() || (!option.getRequiresModulePrefix() && name == option.getShortName());
+    }
+    return name == option.getModuleName() + ":" + option.getLongName() || (!option.getRequiresModulePrefix() && name == option.getLongName());
+}
+}  // namespace
+
+SettingsManager::SettingsManager() : modules(), settingsHaveBeenParsed(false), longNameToOptions(), shortNameToOptions(), moduleOptions() {}
 
 SettingsManager::~SettingsManager() {
     // Intentionally left empty.
@@ -86,6 +102,8 @@ void SettingsManager::setFromString(std::string const& commandLineString) {
 }
 
 void SettingsManager::handleUnknownOption(std::string const& optionName, bool isShort) const {
+    // Suggest options of all modules.
+    const_cast<SettingsManager*>(this)->createAllModules();
     std::string optionNameWithDashes = (isShort ? "-" : "--") + optionName;
     storm::utility::string::SimilarStrings similarStrings(optionNameWithDashes, 0.6, false);
     std::map<std::string, std::vector<std::string>> similarOptionNames;
@@ -132,6 +150,7 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
             if (optionActive) {
                 // At this point we know that a new option is about to come. Hence, we need to assign the current
                 // cache content to the option that was active until now.
+                parsedOptions.push_back({activeOptionName, activeOptionIsShortName, argumentCache});
                 setOptionsArguments(activeOptionName, activeOptionIsShortName ? this->shortNameToOptions : this->longNameToOptions, argumentCache);
 
                 // After the assignment, the argument cache needs to be cleared.
@@ -144,9 +163,12 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 // In this case, the argument has to be the long name of an option. Try to get all options that
                 // match the long name.
                 std::string optionName = currentArgument.substr(2);
-                auto optionIterator = this->longNameToOptions.find(optionName);
-                if (optionIterator == this->longNameToOptions.end()) {
-                    handleUnknownOption(optionName, false);
+                if (this->longNameToOptions.find(optionName) == this->longNameToOptions.end()) {
+                    // The option might belong to a module whose settings have not been created yet.
+                    createAllModules();
+                    if (this->longNameToOptions.find(optionName) == this->longNameToOptions.end()) {
+                        handleUnknownOption(optionName, false);
+                    }
                 }
                 activeOptionIsShortName = false;
                 activeOptionName = optionName;
@@ -154,9 +176,12 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 // In this case, the argument has to be the short name of an option. Try to get all options that
                 // match the short name.
                 std::string optionName = currentArgument.substr(1);
-                auto optionIterator = this->shortNameToOptions.find(optionName);
-                if (optionIterator == this->shortNameToOptions.end()) {
-                    handleUnknownOption(optionName, true);
+                if (this->shortNameToOptions.find(optionName) == this->shortNameToOptions.end()) {
+                    // The option might belong to a module whose settings have not been created yet.
+                    createAllModules();
+                    if (this->shortNameToOptions.find(optionName) == this->shortNameToOptions.end()) {
+                        handleUnknownOption(optionName, true);
+                    }
                 }
                 activeOptionIsShortName = true;
                 activeOptionName = optionName;
@@ -172,9 +197,17 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
 
     // If an option is still active at this point, we need to set it.
     if (optionActive) {
+        parsedOptions.push_back({activeOptionName, activeOptionIsShortName, argumentCache});
         setOptionsArguments(activeOptionName, activeOptionIsShortName ? this->shortNameToOptions : this->longNameToOptions, argumentCache);
     }
 
+    // Create the settings of the remaining modules now. Parsing happens before any worker threads are started, whereas the settings may be
+    // retrieved concurrently later on, so no module is created (and registered) while other threads are reading the options.
+    createAllModules();
+
+    // From now on, modules whose settings are created are finalized on creation.
+    settingsHaveBeenParsed = true;
+
     // Include the options from a possibly specified configuration file, but don't overwrite existing settings.
     if (storm::settings::hasModule<storm::settings::modules::GeneralSettings>() &&
         storm::settings::getModule<storm::settings::modules::GeneralSettings>().isConfigSet()) {
@@ -186,6 +219,8 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
 }
 
 void SettingsManager::setFromConfigurationFile(std::string const& configFilename) {
+    // The configuration file may refer to the options of all modules.
+    createAllModules();
     std::map<std::string, std::vector<std::string>> configurationFileSettings = parseConfigFile(configFilename);
 
     for (auto const& optionArgumentsPair : configurationFileSettings) {
@@ -214,6 +249,8 @@ void SettingsManager::setFromConfigurationFile(std::string const& configFilename
 }
 
 void SettingsManager::printHelp(std::string const& filter) const {
+    // The help covers the options of all modules.
+    const_cast<SettingsManager*>(this)->createAllModules();
     STORM_PRINT("usage: " << executableName << " [options]\n\n");
 
     if (filter == "frequent" || filter == "all") {
@@ -352,6 +389,7 @@ std::string SettingsManager::getHelpForSelection(std::vector<std::string> const&
 }
 
 std::string SettingsManager::getHelpForModule(std::string const& moduleName, uint_fast64_t maxLength, bool includeAdvanced) const {
+    const_cast<SettingsManager*>(this)->createAllModules();
     auto moduleIterator = moduleOptions.find(moduleName);
     if (moduleIterator == this->moduleOptions.end()) {
         return "";
@@ -398,30 +436,67 @@ uint_fast64_t SettingsManager::getPrintLengthOfLongestOption(bool includeAdvance
 }
 
 uint_fast64_t SettingsManager::getPrintLengthOfLongestOption(std::string const& moduleName, bool includeAdvanced) const {
-    auto moduleIterator = modules.find(moduleName);
-    STORM_LOG_THROW(moduleIterator != modules.end(), storm::exceptions::IllegalFunctionCallException,
+    STORM_LOG_THROW(hasModule(moduleName), storm::exceptions::IllegalFunctionCallException,
                     "Unable to retrieve option length of unknown module '" << moduleName << "'.");
-    return moduleIterator->second->getPrintLengthOfLongestOption(includeAdvanced);
+    return getModule(moduleName).getPrintLengthOfLongestOption(includeAdvanced);
 }
 
 void SettingsManager::addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister) {
-    auto moduleIterator = this->modules.find(moduleSettings->getModuleName());
-    STORM_LOG_THROW(moduleIterator == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
-                    "Unable to register module '" << moduleSettings->getModuleName() << "' because a module with the same name already exists.");
+    std::string moduleName = moduleSettings->getModuleName();
+    addLazyModule(moduleName, nullptr, doRegister);
 
     // Take over the module settings object.
-    std::string moduleName = moduleSettings->getModuleName();
+    ModuleEntry& entry = *this->modules.at(moduleName);
+    std::call_once(entry.created, [&]() { initializeModule(entry, std::move(moduleSettings)); });
+}
+
+void SettingsManager::addLazyModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister) {
+    STORM_LOG_THROW(this->modules.find(moduleName) == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
+                    "Unable to register module '" << moduleName << "' because a module with the same name already exists.");
+    auto entry = std::make_unique<ModuleEntry>();
+    entry->name = moduleName;
+    entry->factory = factory;
+    entry->doRegister = doRegister;
     this->moduleNames.push_back(moduleName);
-    this->modules.emplace(moduleSettings->getModuleName(), std::move(moduleSettings));
-    auto iterator = this->modules.find(moduleName);
-    std::unique_ptr<modules::ModuleSettings> const& settings = iterator->second;
+    this->modules.emplace(moduleName, std::move(entry));
+}
+
+void SettingsManager::createModule(ModuleEntry& entry) {
+    std::call_once(entry.created, [&]() { initializeModule(entry, entry.factory()); });
+}
 
-    if (doRegister) {
-        this->moduleOptions.emplace(moduleName, std::vector<std::shared_ptr<Option>>());
+void SettingsManager::createAllModules() {
+    for (auto const& moduleName : this->moduleNames) {
+        createModule(*this->modules.at(moduleName));
+    }
+}
+
+void SettingsManager::initializeModule(ModuleEntry& entry, std::unique_ptr<modules::ModuleSettings>&& settings) {
+    STORM_LOG_THROW(settings->getModuleName() == entry.name, storm::exceptions::IllegalFunctionCallException,
+                    "The settings of module '" << settings->getModuleName() << "' were registered as module '" << entry.name << "'.");
+    entry.settings = std::move(settings);
+
+    if (entry.doRegister) {
+        std::lock_guard<std::mutex> lock(registrationMutex);
+        this->moduleOptions.emplace(entry.name, std::vector<std::shared_ptr<Option>>());
         // Now register the options of the module.
-        for (auto const& option : settings->getOptions()) {
+        for (auto const& option : entry.settings->getOptions()) {
             this->addOption(option);
         }
+
+        // Apply the options that were set before the settings of the module were created.
+        for (auto const& parsedOption : parsedOptions) {
+            for (auto const& option : entry.settings->getOptions()) {
+                if (isNameOfOption(parsedOption.name, parsedOption.isShortName, *option)) {
+                    setOptionArguments(parsedOption.name, option, parsedOption.arguments);
+                }
+            }
+        }
+    }
+
+    if (settingsHaveBeenParsed) {
+        entry.settings->finalize();
+        entry.settings->check();
     }
 }
 
@@ -457,25 +532,29 @@ void SettingsManager::addOption(std::shared_ptr<Option> const& option) {
 }
 
 bool SettingsManager::hasModule(std::string const& moduleName, bool checkHidden) const {
-    if (checkHidden) {
-        return this->moduleOptions.find(moduleName) != this->moduleOptions.end();
-    } else {
-        return this->modules.find(moduleName) != this->modules.end();
+    auto moduleIterator = this->modules.find(moduleName);
+    if (moduleIterator == this->modules.end()) {
+        return false;
     }
+    // Only modules whose options are registered are visible.
+    return !checkHidden || moduleIterator->second->doRegister;
 }
 
 modules::ModuleSettings const& SettingsManager::getModule(std::string const& moduleName) const {
     auto moduleIterator = this->modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    // Creating the settings of a lazily added module does not change the observable state of the manager.
+    const_cast<SettingsManager*>(this)->createModule(*moduleIterator->second);
+    return *moduleIterator->second->settings;
 }
 
 modules::ModuleSettings& SettingsManager::getModule(std::string const& moduleName) {
     auto moduleIterator = this->modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    createModule(*moduleIterator->second);
+    return *moduleIterator->second->settings;
 }
 
 bool SettingsManager::isCompatible(std::shared_ptr<Option> const& option, std::string const& optionName,
@@ -545,9 +624,13 @@ void SettingsManager::addOptionToMap(std::string const& name, std::shared_ptr<Op
 }
 
 void SettingsManager::finalizeAllModules() {
-    for (auto const& nameModulePair : this->modules) {
-        nameModulePair.second->finalize();
-        nameModulePair.second->check();
+    for (auto const& moduleName : this->moduleNames) {
+        // Modules whose settings have not been created yet are finalized on creation.
+        auto const& settings = this->modules.at(moduleName)->settings;
+        if (settings) {
+            settings->finalize();
+            settings->check();
+        }
     }
 }
 
@@ -678,36 +761,38 @@ storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
 void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::mutableManager().setName(name, executableName);
 
-    // Register all known settings modules.
+    // Register all known settings modules. The modules that are needed for every invocation are created right away, the settings of all
+    // other modules are only created once they are needed.
     storm::settings::addModule<storm::settings::modules::GeneralSettings>();
     storm::settings::addModule<storm::settings::modules::IOSettings>();
     storm::settings::addModule<storm::settings::modules::BuildSettings>();
     storm::settings::addModule<storm::settings::modules::CoreSettings>();
     storm::settings::addModule<storm::settings::modules::ModelCheckerSettings>();
     storm::settings::addModule<storm::settings::modules::DebugSettings>();
-    storm::settings::addModule<storm::settings::modules::CuddSettings>();
-    storm::settings::addModule<storm::settings::modules::SylvanSettings>();
-    storm::settings::addModule<storm::settings::modules::GmmxxEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::EigenEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::NativeEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::EliminationSettings>();
-    storm::settings::addModule<storm::settings::modules::LongRunAverageSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::TimeBoundedSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::MinMaxEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::GameSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::BisimulationSettings>();
-    storm::settings::addModule<storm::settings::modules::GlpkSettings>();
-    storm::settings::addModule<storm::settings::modules::GurobiSettings>();
-    storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::Smt2SmtSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::ExplorationSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
-    storm::settings::addModule<storm::settings::modules::AbstractionSettings>();
-    storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
-    storm::settings::addModule<storm::settings::modules::MultiplierSettings>();
     storm::settings::addModule<storm::settings::modules::TransformationSettings>();
-    storm::settings::addModule<storm::settings::modules::HintSettings>();
-    storm::settings::addModule<storm::settings::modules::OviSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::CuddSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::SylvanSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GmmxxEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::EigenEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::NativeEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::EliminationSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::LongRunAverageSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::TimeBoundedSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::MinMaxEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GameSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::BisimulationSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GlpkSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GurobiSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::TopologicalEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::Smt2SmtSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::ExplorationSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::AbstractionSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::MultiObjectiveSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::MultiplierSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::HintSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::OviSolverSettings>();
 }
 
 }  // namespace settings
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -109,6 +111,17 @@ class SettingsManager {
      */
     void addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister = true);
 
+    /*!
+     * Adds a new module whose settings are only created once they are retrieved (or once an option is used that no created module knows).
+     * Options that were set before the settings are created are applied on creation. Parsing the settings (e.g. via setFromCommandLine)
+     * creates the settings of all modules, so settings are only created lazily during the (single-threaded) startup or if the settings are
+     * never parsed. If the module could not be successfully added, an exception is thrown.
+     *
+     * @param moduleName The name of the module to add.
+     * @param factory A function that creates the settings of the module.
+     */
+    void addLazyModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister = true);
+
     /*!
      * Checks whether the module with the given name exists.
      *
@@ -161,9 +174,39 @@ class SettingsManager {
     std::string name;
     std::string executableName;
 
+    /*!
+     * A registered module whose settings are possibly not yet created.
+     */
+    struct ModuleEntry {
+        std::string name;
+        std::function<std::unique_ptr<modules::ModuleSettings>()> factory;
+        bool doRegister;
+        std::once_flag created;
+        std::unique_ptr<modules::ModuleSettings> settings;
+    };
+
+    /*!
+     * An option (with its arguments) that was set from the command line.
+     */
+    struct ParsedOption {
+        std::string name;
+        bool isShortName;
+        std::vector<std::string> arguments;
+    };
+
     // The registered modules.
     std::vector<std::string> moduleNames;
-    std::unordered_map<std::string, std::unique_ptr<modules::ModuleSettings>> modules;
+    std::unordered_map<std::string, std::unique_ptr<ModuleEntry>> modules;
+
+    // The options set from the command line, which are applied to modules whose settings are created later.
+    std::vector<ParsedOption> parsedOptions;
+
+    // Whether the settings have been parsed already, i.e., whether modules need to be finalized on creation.
+    bool settingsHaveBeenParsed;
+
+    // Guards the registration of options of modules that are created lazily by multiple threads. Reading the options (e.g. when parsing or
+    // printing the help) is not guarded, which is why parsing creates the settings of all modules.
+    std::mutex registrationMutex;
 
     // Mappings from all known option names to the options that match it. All options for one option name need
     // to be compatible in the sense that calling isCompatible(...) pairwise on all options must always return true.
@@ -184,6 +227,23 @@ class SettingsManager {
      */
     void addOption(std::shared_ptr<Option> const& option);
 
+    /*!
+     * Creates the settings of the given module (if they have not been created yet).
+     *
+     * @param entry The module.
+     */
+    void createModule(ModuleEntry& entry);
+
+    /*!
+     * Creates the settings of all modules.
+     */
+    void createAllModules();
+
+    /*!
+     * Takes over the given settings for the given module, registers its options and applies the options that have been parsed already.
+     */
+    void initializeModule(ModuleEntry& entry, std::unique_ptr<modules::ModuleSettings>&& settings);
+
     /*!
      * Sets the arguments of the given option from the provided strings.
      *
@@ -274,6 +334,17 @@ void addModule(bool doRegister = true) {
     mutableManager().addModule(std::unique_ptr<modules::ModuleSettings>(new SettingsType()), doRegister);
 }
 
+/*!
+ * Add new module whose settings are only created once they are needed (see SettingsManager::addLazyModule). The new module is given as a
+ * template argument.
+ */
+template<typename SettingsType>
+void addLazyModule(bool doRegister = true) {
+    static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
+    mutableManager().addLazyModule(
+        SettingsType::moduleName, []() { return std::unique_ptr<modules::ModuleSettings>(new SettingsType()); }, doRegister);
+}
+
 /*!
  * Initialize the settings manager with all available modules.
  * @param name Name of the tool.
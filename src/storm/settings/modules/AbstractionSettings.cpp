@@ -34,6 +34,7 @@ const std::string AbstractionSettings::injectRefinementPredicatesOptionName = "i
 const std::string AbstractionSettings::fixPlayer1StrategyOptionName = "fixpl1strat";
 const std::string AbstractionSettings::fixPlayer2StrategyOptionName = "fixpl2strat";
 const std::string AbstractionSettings::validBlockModeOptionName = "validmode";
+const std::string AbstractionSettings::threadsOptionName = "threads";
 
 AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"games", "bisimulation", "bisim"};
@@ -63,6 +64,15 @@ AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads that enumerate the abstractions of the commands concurrently. This only "
+                                                   "applies if the decomposition is not used.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for all hardware).")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
     std::vector<std::string> splitModes = {"all", "none", "non-guard"};
     this->addOption(storm::settings::OptionBuilder(moduleName, splitModeOptionName, true, "Sets which predicates are split into atoms for the refinement.")
                         .setIsAdvanced()
@@ -230,6 +240,10 @@ bool AbstractionSettings::isUseDecompositionSet() const {
     return this->getOption(useDecompositionOptionName).getArgumentByName("value").getValueAsString() == "on";
 }
 
+uint64_t AbstractionSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 AbstractionSettings::SplitMode AbstractionSettings::getSplitMode() const {
     std::string splitModeAsString = this->getOption(splitModeOptionName).getArgumentByName("mode").getValueAsString();
     if (splitModeAsString == "all") {
@@ -40,6 +40,11 @@ class AbstractionSettings : public ModuleSettings {
      */
     bool isUseDecompositionSet() const;
 
+    /*!
+     * Retrieves the number of threads used to enumerate the abstractions of the commands (0 means one thread per hardware thread).
+     */
+    uint64_t getNumberOfThreads() const;
+
     /*!
      * Retrieves the selected split mode.
      *
@@ -207,6 +212,7 @@ class AbstractionSettings : public ModuleSettings {
     const static std::string fixPlayer1StrategyOptionName;
     const static std::string fixPlayer2StrategyOptionName;
     const static std::string validBlockModeOptionName;
+    const static std::string threadsOptionName;
 };
 
 }  // namespace modules
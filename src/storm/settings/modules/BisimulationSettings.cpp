@@ -22,6 +22,8 @@ const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::threadsOptionName = "threads";
+const std::string BisimulationSettings::lumpAcyclicOptionName = "lumpacyclic";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -84,13 +86,30 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                         .build());
 
     std::vector<std::string> refinementModes = {"full", "changed"};
-    this->addOption(storm::settings::OptionBuilder(moduleName, refinementModeOptionName, true, "Sets which refinement mode to use.")
+    this->addOption(storm::settings::OptionBuilder(moduleName, refinementModeOptionName, true,
+                                                   "Sets which refinement mode to use. In mode 'changed', only the states whose block changed in the last "
+                                                   "refinement are used as splitters (requires reusing block numbers).")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
                                          .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads for the partition refinement of sparse models. With more than one thread, "
+                                                   "strong bisimulation of deterministic models is computed by a parallel signature-based refinement.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for all hardware).")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, lumpAcyclicOptionName, true,
+                                                   "If set, the states of sparse deterministic models that do not lie on a cycle are lumped in one bottom-up "
+                                                   "pass before the partition refinement (only applies to strong bisimulation).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +192,14 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+uint64_t BisimulationSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BisimulationSettings::isLumpAcyclicStatesSet() const {
+    return this->getOption(lumpAcyclicOptionName).getHasOptionBeenSet();
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -96,6 +96,18 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the number of threads to use for the partition refinement of sparse models.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether the acyclic states are to be lumped before the partition refinement.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    bool isLumpAcyclicStatesSet() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -113,6 +125,8 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string threadsOptionName;
+    static const std::string lumpAcyclicOptionName;
 };
 }  // namespace modules
 }  // namespace settings
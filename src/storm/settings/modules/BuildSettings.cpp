@@ -11,6 +11,7 @@
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace settings {
@@ -39,6 +40,17 @@ const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-gua
 const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
+const std::string buildThreadsOptionName = "build-threads";
+const std::string stateStorageOptionName = "state-storage";
+const std::string externalMemoryDirectoryOptionName = "external-memory-dir";
+const std::string externalMemoryLimitOptionName = "external-memory-limit";
+const std::string estimateOptionName = "estimate";
+const std::string compileExpressionsOptionName = "compile-expressions";
+const std::string symmetryReductionOptionName = "symmetry-reduction";
+const std::string partialOrderReductionOptionName = "partial-order-reduction";
+const std::string ddVariableOrderingOptionName = "dd-order";
+const std::string ddReorderOptionName = "dd-phase-reorder";
+const std::string ddChainingOptionName = "dd-chaining";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -115,6 +127,87 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .makeOptional()
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, buildThreadsOptionName, false,
+                                                   "Sets the number of threads used for explicit state-space exploration (requires bfs exploration "
+                                                   "order), labeling, and reading and writing explicit model files. Defaults to the value of --threads.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    std::vector<std::string> stateStorageTypes = {"hashmap", "tree"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, stateStorageOptionName, false,
+                                                   "Sets the data structure that stores the states during explicit state-space exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "The name of the data structure. 'tree' uses tree compression, which needs less memory but is slower.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateStorageTypes))
+                                         .setDefaultValueString("hashmap")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, externalMemoryDirectoryOptionName, false,
+                                                   "Sets the directory that holds the temporary files of the external-memory state-space exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, externalMemoryLimitOptionName, false,
+                                                   "Sets the amount of main memory that the external-memory state-space exploration uses to sort states "
+                                                   "and transitions.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The amount of memory in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1024)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, estimateOptionName, false,
+                                                   "If set, the size of the explicit model is estimated (from an exhaustively explored prefix and random walks) "
+                                                   "before building it. The estimate is also used by the automatic engine and to size the state "
+                                                   "storage.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("prefix", "The number of states explored exhaustively.")
+                                         .setDefaultValueUnsignedInteger(10000)
+                                         .makeOptional()
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("walks", "The number of random walks.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterEqualValidator(2))
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compileExpressionsOptionName, false,
+                                                   "If set, guards and updates of PRISM programs are compiled to operate directly on the state encoding.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, fully symmetric modules of PRISM programs are detected and only one representative of each "
+                                                   "orbit of symmetric states is explored.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, interleavings of independent and invisible edges of JANI MDPs are pruned using ample sets. "
+                                                   "Preserves properties of probabilistic LTL without next operator (but no rewards).")
+                        .setIsAdvanced()
+                        .build());
+    std::vector<std::string> ddVariableOrderings = {"program", "force"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false,
+                                                   "Sets the initial order of the DD variables when building PRISM programs symbolically. 'force' places "
+                                                   "variables that are accessed by the same commands close to each other.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the ordering.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderings))
+                                         .setDefaultValueString("program")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddReorderOptionName, false,
+                                                   "If set, the DD variables are reordered (with the CUDD reordering technique) after the composition of the "
+                                                   "system and after the reachability analysis when building PRISM programs symbolically.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddChainingOptionName, false,
+                                                   "If set, the reachable states of symbolically built models are computed by chaining over the transitions of "
+                                                   "the individual actions instead of breadth-first search over the full transition relation.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -206,6 +299,77 @@ uint64_t BuildSettings::getLocationEliminationLocationHeuristic() const {
 uint64_t BuildSettings::getLocationEliminationEdgesHeuristic() const {
     return this->getOption(performLocationElimination).getArgumentByName("edges-heuristic").getValueAsUnsignedInteger();
 }
+
+uint64_t BuildSettings::getNumberOfBuildThreads() const {
+    if (!this->getOption(buildThreadsOptionName).getHasOptionBeenSet()) {
+        return storm::utility::parallel::getDefaultNumberOfThreads();
+    }
+    return this->getOption(buildThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+storm::storage::sparse::StateStorageType BuildSettings::getStateStorageType() const {
+    std::string stateStorageAsString = this->getOption(stateStorageOptionName).getArgumentByName("name").getValueAsString();
+    if (stateStorageAsString == "hashmap") {
+        return storm::storage::sparse::StateStorageType::HashMap;
+    } else if (stateStorageAsString == "tree") {
+        return storm::storage::sparse::StateStorageType::TreeCompression;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state storage '" << stateStorageAsString << "'.");
+}
+
+bool BuildSettings::isExternalMemoryDirectorySet() const {
+    return this->getOption(externalMemoryDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getExternalMemoryDirectory() const {
+    return this->getOption(externalMemoryDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t BuildSettings::getExternalMemoryLimit() const {
+    return this->getOption(externalMemoryLimitOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+}
+
+bool BuildSettings::isEstimateSet() const {
+    return this->getOption(estimateOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BuildSettings::getEstimatePrefixSize() const {
+    return this->getOption(estimateOptionName).getArgumentByName("prefix").getValueAsUnsignedInteger();
+}
+
+uint64_t BuildSettings::getEstimateNumberOfWalks() const {
+    return this->getOption(estimateOptionName).getArgumentByName("walks").getValueAsUnsignedInteger();
+}
+
+bool BuildSettings::isCompileExpressionsSet() const {
+    return this->getOption(compileExpressionsOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
+storm::builder::DdVariableOrdering BuildSettings::getDdVariableOrdering() const {
+    std::string orderingAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+    if (orderingAsString == "program") {
+        return storm::builder::DdVariableOrdering::Program;
+    } else if (orderingAsString == "force") {
+        return storm::builder::DdVariableOrdering::Force;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD variable ordering '" << orderingAsString << "'.");
+}
+
+bool BuildSettings::isDdReorderAtPhaseBoundariesSet() const {
+    return this->getOption(ddReorderOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isDdChainingReachabilitySet() const {
+    return this->getOption(ddChainingOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 
 }  // namespace settings
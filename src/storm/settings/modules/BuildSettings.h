@@ -1,8 +1,10 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/storage/sparse/StateStorageType.h"
 
 namespace storm {
 namespace settings {
@@ -139,6 +141,77 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getLocationEliminationEdgesHeuristic() const;
 
+    /*!
+     * Retrieves the number of threads that are used for explicit state-space exploration. If not set explicitly, this is the global
+     * number of threads.
+     */
+    uint64_t getNumberOfBuildThreads() const;
+
+    /*!
+     * Retrieves the data structure that is used to store the states during explicit state-space exploration.
+     */
+    storm::storage::sparse::StateStorageType getStateStorageType() const;
+
+    /*!
+     * Retrieves whether the directory for the temporary files of the external-memory exploration has been set.
+     */
+    bool isExternalMemoryDirectorySet() const;
+
+    /*!
+     * Retrieves the directory for the temporary files of the external-memory exploration.
+     */
+    std::string getExternalMemoryDirectory() const;
+
+    /*!
+     * Retrieves the amount of main memory (in megabytes) that the external-memory exploration uses for sorting.
+     */
+    uint64_t getExternalMemoryLimit() const;
+
+    /*!
+     * Retrieves whether the size of the explicit model shall be estimated before building it.
+     */
+    bool isEstimateSet() const;
+
+    /*!
+     * Retrieves the number of states that are explored exhaustively when estimating the size of the explicit model.
+     */
+    uint64_t getEstimatePrefixSize() const;
+
+    /*!
+     * Retrieves the number of random walks that are used to estimate the size of the explicit model.
+     */
+    uint64_t getEstimateNumberOfWalks() const;
+
+    /*!
+     * Retrieves whether guards and updates shall be compiled for explicit state-space exploration.
+     */
+    bool isCompileExpressionsSet() const;
+
+    /*!
+     * Retrieves whether the state space shall be reduced by symmetries between modules during explicit state-space exploration.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether a partial-order reduction shall be applied during explicit state-space exploration.
+     */
+    bool isPartialOrderReductionSet() const;
+
+    /*!
+     * Retrieves the strategy used to order the DD variables when building DD-based models.
+     */
+    storm::builder::DdVariableOrdering getDdVariableOrdering() const;
+
+    /*!
+     * Retrieves whether the DD variables are to be reordered at the boundaries of the phases of DD-based model building.
+     */
+    bool isDdReorderAtPhaseBoundariesSet() const;
+
+    /*!
+     * Retrieves whether the reachable states of DD-based models are to be computed by chaining over partitioned transitions.
+     */
+    bool isDdChainingReachabilitySet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
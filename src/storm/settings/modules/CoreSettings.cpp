@@ -14,6 +14,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace settings {
@@ -31,6 +32,9 @@ const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::cudaOptionName = "cuda";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::solverThreadsOptionName = "solver-threads";
+const std::string CoreSettings::threadsOptionName = "threads";
+const std::string CoreSettings::pinThreadsOptionName = "pin-threads";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -88,6 +92,27 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads used by all parallel features (unless overwritten by a more specific option).")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 uses all threads).")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, pinThreadsOptionName, false,
+                                                   "Sets whether worker threads are pinned to distinct processors, which keeps their memory accesses local on "
+                                                   "multi-socket machines (Linux only).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, solverThreadsOptionName, false,
+                                                   "Sets the number of threads used by sparse value-iteration solvers and SCC decompositions on large models. "
+                                                   "Defaults to the value of --" +
+                                                       threadsOptionName + ".")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -166,6 +191,26 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isNumberOfThreadsSet() const {
+    return this->getOption(threadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t CoreSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::parallel::getNumberOfHardwareThreads() : numberOfThreads;
+}
+
+bool CoreSettings::isPinThreadsSet() const {
+    return this->getOption(pinThreadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t CoreSettings::getNumberOfSolverThreads() const {
+    if (!this->getOption(solverThreadsOptionName).getHasOptionBeenSet()) {
+        return getNumberOfThreads();
+    }
+    return this->getOption(solverThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
 bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
@@ -183,6 +228,10 @@ void CoreSettings::finalize() {
     std::string engineStr = this->getOption(engineOptionName).getArgumentByName("name").getValueAsString();
     engine = storm::utility::engineFromString(engineStr);
     STORM_LOG_THROW(engine != storm::utility::Engine::Unknown, storm::exceptions::IllegalArgumentValueException, "Unknown engine '" << engineStr << "'.");
+
+    // Parallel features that are not configured explicitly use the global number of threads.
+    storm::utility::parallel::setDefaultNumberOfThreads(getNumberOfThreads());
+    STORM_LOG_WARN_COND(storm::utility::parallel::setThreadPinning(isPinThreadsSet()), "Pinning threads is not supported on this platform.");
 }
 
 bool CoreSettings::check() const {
@@ -102,6 +102,32 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves whether the global number of threads has been set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads that parallel features use unless a more specific option is set. A value of zero given by the user
+     * is resolved to the number of hardware threads.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether worker threads are to be pinned to distinct processors.
+     */
+    bool isPinThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads that value-iteration based sparse solvers and SCC decompositions are allowed to use. If not set
+     * explicitly, this is the global number of threads.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfSolverThreads() const;
+
     /*!
      * Retrieves whether the option to use CUDA is set.
      *
@@ -141,6 +167,9 @@ class CoreSettings : public ModuleSettings {
     static const std::string ddLibraryOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
+    static const std::string solverThreadsOptionName;
+    static const std::string threadsOptionName;
+    static const std::string pinThreadsOptionName;
     static const std::string cudaOptionName;
 };
 
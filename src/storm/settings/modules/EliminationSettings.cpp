@@ -18,6 +18,7 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::operationCacheSizeOptionName = "opcache";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
@@ -54,6 +55,14 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, operationCacheSizeOptionName, true,
+                                                   "Sets how many results of products and sums of rational functions are memoized during elimination.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "size", "The maximal number of memoized results per operation. Zero disables the memoization.")
+                                         .setDefaultValueUnsignedInteger(DefaultOperationCacheSize)
+                                         .build())
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -101,6 +110,10 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+uint_fast64_t EliminationSettings::getOperationCacheSize() const {
+    return this->getOption(operationCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -62,14 +62,25 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves the maximal number of memoized results of arithmetic operations (per operation) during the elimination of parametric models.
+     *
+     * @return The maximal number of memoized results. Zero means that the results are not memoized.
+     */
+    uint_fast64_t getOperationCacheSize() const;
+
     const static std::string moduleName;
 
+    // The maximal number of memoized operation results if the settings are not available.
+    const static uint_fast64_t DefaultOperationCacheSize = 100000;
+
    private:
     const static std::string eliminationMethodOptionName;
     const static std::string eliminationOrderOptionName;
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string operationCacheSizeOptionName;
 };
 
 }  // namespace modules
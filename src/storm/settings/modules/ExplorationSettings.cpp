@@ -21,6 +21,7 @@ const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOp
 const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
 const std::string ExplorationSettings::precisionOptionName = "precision";
 const std::string ExplorationSettings::precisionOptionShortName = "eps";
+const std::string ExplorationSettings::threadsOptionName = "threads";
 
 ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"local", "global"};
@@ -47,13 +48,15 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
-    std::vector<std::string> nextStateHeuristics = {"probdiffs", "prob", "unif"};
+    std::vector<std::string> nextStateHeuristics = {"probdiffs", "probdiffprod", "prob", "unif"};
     this->addOption(storm::settings::OptionBuilder(moduleName, nextStateHeuristicOptionName, true, "Sets the next-state heuristic to use.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
                                          "name",
                                          "The name of the heuristic to use. 'prob' samples according to the probabilities in the system, 'probdiffs' takes "
-                                         "into account probabilities and the differences between the current bounds and 'unif' samples uniformly.")
+                                         "into account probabilities and the differences between the current bounds, 'probdiffprod' samples proportionally to "
+                                         "the product of the probability and the difference between the bounds of the successor and 'unif' samples "
+                                         "uniformly.")
                                          .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(nextStateHeuristics))
                                          .setDefaultValueString("probdiffs")
                                          .build())
@@ -67,6 +70,15 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads that sample paths concurrently. The threads share the explored "
+                                                   "fragment of the model and expand states in parallel.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for all hardware).")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ExplorationSettings::isLocalPrecomputationSet() const {
@@ -109,6 +121,8 @@ ExplorationSettings::NextStateHeuristic ExplorationSettings::getNextStateHeurist
     std::string nextStateHeuristicAsString = this->getOption(nextStateHeuristicOptionName).getArgumentByName("name").getValueAsString();
     if (nextStateHeuristicAsString == "probdiffs") {
         return ExplorationSettings::NextStateHeuristic::DifferenceProbabilitySum;
+    } else if (nextStateHeuristicAsString == "probdiffprod") {
+        return ExplorationSettings::NextStateHeuristic::DifferenceProbabilityProduct;
     } else if (nextStateHeuristicAsString == "prob") {
         return ExplorationSettings::NextStateHeuristic::Probability;
     } else if (nextStateHeuristicAsString == "unif") {
@@ -121,11 +135,16 @@ double ExplorationSettings::getPrecision() const {
     return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+uint64_t ExplorationSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool ExplorationSettings::check() const {
     bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                      this->getOption(threadsOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Exploration || !optionsSet,
                         "Exploration engine is not selected, so setting options for it has no effect.");
     return true;
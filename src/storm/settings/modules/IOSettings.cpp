@@ -22,6 +22,7 @@ const std::string IOSettings::exportDotMaxWidthOptionName = "dot-maxwidth";
 const std::string IOSettings::exportBuildOptionName = "exportbuild";
 const std::string IOSettings::exportExplicitOptionName = "exportexplicit";
 const std::string IOSettings::exportDdOptionName = "exportdd";
+const std::string IOSettings::exportBinaryOptionName = "exportbinary";
 const std::string IOSettings::exportJaniDotOptionName = "exportjanidot";
 const std::string IOSettings::exportCdfOptionName = "exportcdf";
 const std::string IOSettings::exportCdfOptionShortName = "cdf";
@@ -31,6 +32,9 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
+const std::string IOSettings::explicitBinaryOptionShortName = "binary";
+const std::string IOSettings::binaryDdOptionName = "binarydd";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -104,12 +108,19 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                        "Exports the choices of an optimal scheduler to the given file (if supported by engine).")
             .setIsAdvanced()
             .addArgument(
-                storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build())
+                storm::settings::ArgumentBuilder::createStringArgument(
+                    "filename",
+                    "The output file. Use file extension '.json' to export in json or '.bin' to export deterministic memoryless schedulers in binary.")
+                    .build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false,
-                                                   "Exports the result to a given file (if supported by engine). The export will be in json.")
+                                                   "Exports the result to a given file (if supported by engine). The format is chosen by the file extension.")
                         .setIsAdvanced()
-                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "filename",
+                                         "The output file. Use file extension '.jsonl' for json lines, '.csv' for csv or '.bin' for binary. Otherwise, the "
+                                         "export will be in json.")
+                                         .build())
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "",
@@ -126,6 +137,13 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
             .setIsAdvanced()
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build())
             .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, exportBinaryOptionName, false,
+                                       "If given, the loaded model will be written to the specified file in the binary format, which can be loaded quickly. "
+                                       "Symbolic models are written in the binary DD format.")
+            .addArgument(
+                storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the model is to be written.").build())
+            .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitOptionName, false, "Parses the model given in an explicit (sparse) representation.")
                         .setShortName(explicitOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("transition filename",
@@ -143,6 +161,17 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Parses the model given in the binary format.")
+                        .setShortName(explicitBinaryOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary model file.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, binaryDdOptionName, false, "Parses the symbolic model given in the binary DD format.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the binary DD model file.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -318,6 +347,14 @@ std::string IOSettings::getExportDdFilename() const {
     return this->getOption(exportDdOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool IOSettings::isExportBinarySet() const {
+    return this->getOption(exportBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportBinaryFilename() const {
+    return this->getOption(exportBinaryOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 bool IOSettings::isExportCdfSet() const {
     return this->getOption(exportCdfOptionName).getHasOptionBeenSet();
 }
@@ -366,6 +403,22 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitBinarySet() const {
+    return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitBinaryFilename() const {
+    return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+}
+
+bool IOSettings::isBinaryDdSet() const {
+    return this->getOption(binaryDdOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getBinaryDdFilename() const {
+    return this->getOption(binaryDdOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -522,6 +575,8 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
+    numExplicitInputs += isBinaryDdSet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
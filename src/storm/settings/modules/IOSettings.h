@@ -100,6 +100,20 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExportDdFilename() const;
 
+    /*!
+     * Retrieves whether the export-to-binary option was set.
+     *
+     * @return True if the export-to-binary option was set.
+     */
+    bool isExportBinarySet() const;
+
+    /*!
+     * Retrieves the name of the file in which to write the model in the binary format, if the option was set.
+     *
+     * @return The name of the file in which to write the exported model.
+     */
+    std::string getExportBinaryFilename() const;
+
     /*!
      * Retrieves whether the cumulative density function for reward bounded properties should be exported
      */
@@ -167,6 +181,34 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExplicitDRNFilename() const;
 
+    /*!
+     * Retrieves whether the explicit option with the binary format was set.
+     *
+     * @return True if the explicit option with the binary format was set.
+     */
+    bool isExplicitBinarySet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary format.
+     *
+     * @return The name of the binary file that contains the model.
+     */
+    std::string getExplicitBinaryFilename() const;
+
+    /*!
+     * Retrieves whether a symbolic model in the binary DD format was given.
+     *
+     * @return True if a symbolic model in the binary DD format was given.
+     */
+    bool isBinaryDdSet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the symbolic model in the binary DD format.
+     *
+     * @return The name of the file that contains the symbolic model.
+     */
+    std::string getBinaryDdFilename() const;
+
     /*!
      * Retrieves whether we prevent the usage of placeholders in the explicit DRN format
      * @return
@@ -382,6 +424,7 @@ class IOSettings : public ModuleSettings {
     static const std::string exportJaniDotOptionName;
     static const std::string exportExplicitOptionName;
     static const std::string exportDdOptionName;
+    static const std::string exportBinaryOptionName;
     static const std::string exportCdfOptionName;
     static const std::string exportCdfOptionShortName;
     static const std::string exportSchedulerOptionName;
@@ -390,6 +433,9 @@ class IOSettings : public ModuleSettings {
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitBinaryOptionName;
+    static const std::string explicitBinaryOptionShortName;
+    static const std::string binaryDdOptionName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
@@ -19,9 +19,11 @@ const std::string LongRunAverageSolverSettings::maximalIterationsOptionShortName
 const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
 const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
 const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+const std::string LongRunAverageSolverSettings::aggregationThresholdOptionName = "iad-threshold";
 
 LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration"};
+    std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration",
+                                              "iad", "aggregation-disaggregation"};
     this->addOption(storm::settings::OptionBuilder(moduleName, detLraMethodOptionName, true,
                                                    "Sets which method is preferred for computing long run averages on deterministic models.")
                         .setIsAdvanced()
@@ -69,6 +71,16 @@ LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(mo
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, aggregationThresholdOptionName, false,
+                                                   "If the aggregation-disaggregation method is used, transitions with a probability below this threshold are "
+                                                   "considered weak when partitioning a BSCC into nearly decomposable blocks.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The threshold.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
 }
 
 storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -82,6 +94,9 @@ storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
     if (lraMethodString == "value-iteration" || lraMethodString == "vi") {
         return storm::solver::LraMethod::ValueIteration;
     }
+    if (lraMethodString == "aggregation-disaggregation" || lraMethodString == "iad") {
+        return storm::solver::LraMethod::AggregationDisaggregation;
+    }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
                     "Unknown lra solving technique for deterministic models:'" << lraMethodString << "'.");
 }
@@ -131,6 +146,10 @@ double LongRunAverageSolverSettings::getAperiodicFactor() const {
     return this->getOption(aperiodicFactorOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+double LongRunAverageSolverSettings::getAggregationThreshold() const {
+    return this->getOption(aggregationThresholdOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -73,6 +73,11 @@ class LongRunAverageSolverSettings : public ModuleSettings {
      */
     double getAperiodicFactor() const;
 
+    /*!
+     * Retrieves the probability below which transitions are considered weak when aggregation-disaggregation partitions a BSCC into blocks.
+     */
+    double getAggregationThreshold() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -84,6 +89,7 @@ class LongRunAverageSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string aperiodicFactorOptionName;
+    static const std::string aggregationThresholdOptionName;
 };
 
 }  // namespace modules
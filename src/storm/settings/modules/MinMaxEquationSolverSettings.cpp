@@ -19,12 +19,16 @@ const std::string precisionOptionName = "precision";
 const std::string absoluteOptionName = "absolute";
 const std::string valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string forceUniqueSolutionRequirementOptionName = "force-require-unique";
+const std::string policyEvaluationOptionName = "pi-evaluation";
+const std::string policyEvaluationSweepsOptionName = "pi-sweeps";
+const std::string sparsePolicyEvaluationOptionName = "pi-sparse-states";
+const std::string mixedPrecisionOptionName = "mixed-precision";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "gpu"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -69,6 +73,41 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "simplify solving but causes some overhead.")
                         .setIsAdvanced()
                         .build());
+
+    std::vector<std::string> policyEvaluationMethods = {"linear-solver", "bicgstab", "vi-sweeps"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, policyEvaluationOptionName, false,
+                                       "Sets how policy iteration evaluates a policy: with the configured linear equation solver, with the (multi-threaded) "
+                                       "built-in BiCGSTAB solver, or with a fixed number of value iteration sweeps (modified policy iteration).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a policy evaluation method.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(policyEvaluationMethods))
+                             .setDefaultValueString("linear-solver")
+                             .build())
+            .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, policyEvaluationSweepsOptionName, false,
+                                                   "The number of value iteration sweeps per policy if policies are evaluated with vi-sweeps.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of sweeps.")
+                                         .setDefaultValueUnsignedInteger(10)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparsePolicyEvaluationOptionName, false,
+                                                   "The maximal number of states for which symbolic policy iteration evaluates policies with a sparse linear "
+                                                   "equation solver. Larger systems are solved symbolically.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states (0 disables).")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, value iteration first iterates in single precision and refines the result in double precision.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -93,6 +132,8 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "gpu") {
+        return storm::solver::MinMaxMethod::Gpu;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
@@ -147,6 +188,30 @@ bool MinMaxEquationSolverSettings::isForceUniqueSolutionRequirementSet() const {
     return this->getOption(forceUniqueSolutionRequirementOptionName).getHasOptionBeenSet();
 }
 
+storm::solver::PolicyEvaluationMethod MinMaxEquationSolverSettings::getPolicyEvaluationMethod() const {
+    std::string policyEvaluationString = this->getOption(policyEvaluationOptionName).getArgumentByName("name").getValueAsString();
+    if (policyEvaluationString == "linear-solver") {
+        return storm::solver::PolicyEvaluationMethod::LinearEquationSolver;
+    } else if (policyEvaluationString == "bicgstab") {
+        return storm::solver::PolicyEvaluationMethod::Bicgstab;
+    } else if (policyEvaluationString == "vi-sweeps") {
+        return storm::solver::PolicyEvaluationMethod::ValueIterationSweeps;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown policy evaluation method '" << policyEvaluationString << "'.");
+}
+
+uint64_t MinMaxEquationSolverSettings::getNumberOfPolicyEvaluationSweeps() const {
+    return this->getOption(policyEvaluationSweepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t MinMaxEquationSolverSettings::getMaximalNumberOfStatesForSparsePolicyEvaluation() const {
+    return this->getOption(sparsePolicyEvaluationOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
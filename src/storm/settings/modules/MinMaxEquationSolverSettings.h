@@ -95,6 +95,32 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * Retrieves the method that policy iteration uses to evaluate the current policy.
+     *
+     * @return The policy evaluation method.
+     */
+    storm::solver::PolicyEvaluationMethod getPolicyEvaluationMethod() const;
+
+    /*!
+     * Retrieves the number of value iteration sweeps that (modified) policy iteration performs to evaluate a policy.
+     *
+     * @return The number of sweeps.
+     */
+    uint64_t getNumberOfPolicyEvaluationSweeps() const;
+
+    /*!
+     * Retrieves the maximal number of states for which symbolic policy iteration evaluates policies with a sparse linear equation solver.
+     *
+     * @return The number of states.
+     */
+    uint64_t getMaximalNumberOfStatesForSparsePolicyEvaluation() const;
+
+    /*!
+     * @return true if value iteration should first iterate in single precision before refining the result in double precision.
+     */
+    bool isMixedPrecisionSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -1,11 +1,18 @@
 #include "storm/settings/modules/ModelCheckerSettings.h"
 
+#include <string>
+
+#include "storm/parser/CSVParser.h"
+
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidSettingsException.h"
 
 namespace storm {
 namespace settings {
@@ -14,6 +21,12 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltl2daCacheOptionName = "ltl2dacache";
+const std::string ModelCheckerSettings::solutionCacheOptionName = "solution-cache";
+const std::string ModelCheckerSettings::analysisCacheSizeOptionName = "analysis-cache-size";
+const std::string ModelCheckerSettings::batchPropertiesOptionName = "batch-properties";
+const std::string ModelCheckerSettings::boundSweepOptionName = "bound-sweep";
+const std::string ModelCheckerSettings::hybridChunkBudgetOptionName = "hybrid-chunk-budget";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +40,47 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheOptionName, false,
+                                                   "If set, the deterministic automata for LTL formulas are cached in the given directory and reused for "
+                                                   "formulas that only differ in the names of their atomic propositions.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The (existing) cache directory.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, solutionCacheOptionName, false,
+                                                   "If set, the solutions of properties on sparse models are stored in the given directory and used as "
+                                                   "initial values when the same property is checked on a model whose states have the same valuations.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The (existing) cache directory.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, analysisCacheSizeOptionName, false,
+                                                   "Sets the memory budget for analysis results (e.g. backward transitions and end components) that are "
+                                                   "cached per model and reused across properties.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The budget in megabytes (0 disables the cache).")
+                                         .setDefaultValueUnsignedInteger(DefaultAnalysisCacheSize)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchPropertiesOptionName, false,
+                                                   "If set, unbounded reachability properties on DTMCs and MDPs are solved together with value iteration "
+                                                   "sweeps that are shared between the properties.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, boundSweepOptionName, false,
+                                                   "If set, properties of the form P=? [phi U<=b psi] are checked for each of the given upper bounds b, where "
+                                                   "all bounds share a single step-bounded iteration (or uniformization sweep for CTMCs).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "bounds", "A comma-separated list of bounds and ranges from:to or from:to:step, e.g. 1:100 or 0.5,1,2.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridChunkBudgetOptionName, false,
+                                                   "If set, the hybrid engine converts and solves the equation systems of DTMCs in chunks of SCCs (in "
+                                                   "topological order) whose explicit representation fits into the given memory budget.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The budget in megabytes (0 disables chunking).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +95,74 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isLtl2daCacheDirectorySet() const {
+    return this->getOption(ltl2daCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getLtl2daCacheDirectory() const {
+    return this->getOption(ltl2daCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool ModelCheckerSettings::isSolutionCacheDirectorySet() const {
+    return this->getOption(solutionCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getSolutionCacheDirectory() const {
+    return this->getOption(solutionCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t ModelCheckerSettings::getAnalysisCacheSize() const {
+    return this->getOption(analysisCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isBatchPropertiesSet() const {
+    return this->getOption(batchPropertiesOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isBoundSweepSet() const {
+    return this->getOption(boundSweepOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getHybridChunkBudget() const {
+    return this->getOption(hybridChunkBudgetOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+std::vector<double> ModelCheckerSettings::getBoundSweep() const {
+    std::vector<double> bounds;
+    for (auto const& entry : storm::parser::parseCommaSeperatedValues(this->getOption(boundSweepOptionName).getArgumentByName("bounds").getValueAsString())) {
+        std::vector<double> parts;
+        std::string::size_type start = 0;
+        while (true) {
+            std::string::size_type end = entry.find(':', start);
+            std::string part = entry.substr(start, end == std::string::npos ? std::string::npos : end - start);
+            try {
+                std::size_t parsedCharacters;
+                parts.push_back(std::stod(part, &parsedCharacters));
+                STORM_LOG_THROW(parsedCharacters == part.size(), storm::exceptions::InvalidSettingsException,
+                                "Unable to parse '" << part << "' as a bound.");
+            } catch (std::logic_error const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unable to parse '" << part << "' as a bound.");
+            }
+            if (end == std::string::npos) {
+                break;
+            }
+            start = end + 1;
+        }
+        STORM_LOG_THROW(parts.size() <= 3, storm::exceptions::InvalidSettingsException, "The range '" << entry << "' has too many components.");
+        if (parts.size() == 1) {
+            bounds.push_back(parts.front());
+        } else {
+            double step = parts.size() == 3 ? parts[2] : 1.0;
+            STORM_LOG_THROW(step > 0.0, storm::exceptions::InvalidSettingsException, "The step of the range '" << entry << "' must be positive.");
+            // Compute the bounds from the index to avoid accumulating rounding errors.
+            for (uint64_t index = 0; parts[0] + index * step <= parts[1]; ++index) {
+                bounds.push_back(parts[0] + index * step);
+            }
+        }
+    }
+    return bounds;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
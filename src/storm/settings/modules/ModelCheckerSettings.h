@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -35,6 +37,73 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether a directory has been set in which the deterministic automata for LTL formulas are cached across runs.
+     *
+     * @return True iff the cache directory has been set.
+     */
+    bool isLtl2daCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which the deterministic automata for LTL formulas are cached across runs.
+     *
+     * @return The cache directory.
+     */
+    std::string getLtl2daCacheDirectory() const;
+
+    /*!
+     * Retrieves whether a directory has been set in which the solutions of properties are cached across runs.
+     *
+     * @return True iff the cache directory has been set.
+     */
+    bool isSolutionCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which the solutions of properties are cached across runs.
+     *
+     * @return The cache directory.
+     */
+    std::string getSolutionCacheDirectory() const;
+
+    /*!
+     * Retrieves the memory budget (in megabytes) for the analysis results (e.g., backward transitions or end component decompositions)
+     * that are cached per model and shared when checking multiple properties.
+     *
+     * @return The memory budget of the analysis cache. Zero means that no results are cached.
+     */
+    uint64_t getAnalysisCacheSize() const;
+
+    /*!
+     * Retrieves whether reachability properties are to be checked in batches that share the value iteration sweeps.
+     *
+     * @return True iff batching of properties has been set.
+     */
+    bool isBatchPropertiesSet() const;
+
+    /*!
+     * Retrieves whether bounded until properties are to be checked for a sequence of upper bounds.
+     *
+     * @return True iff the bound sweep has been set.
+     */
+    bool isBoundSweepSet() const;
+
+    /*!
+     * Retrieves the upper bounds of the bound sweep, where ranges are expanded.
+     *
+     * @return The bounds in the order in which they were given.
+     */
+    std::vector<double> getBoundSweep() const;
+
+    /*!
+     * Retrieves the memory budget (in megabytes) for the explicit representation of a single chunk of SCCs that is solved by the hybrid engine.
+     *
+     * @return The memory budget of a chunk. Zero means that the equation system is converted and solved as a whole.
+     */
+    uint64_t getHybridChunkBudget() const;
+
+    // The default memory budget (in megabytes) of the analysis cache.
+    static constexpr uint64_t DefaultAnalysisCacheSize = 1024;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +111,12 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltl2daCacheOptionName;
+    static const std::string solutionCacheOptionName;
+    static const std::string analysisCacheSizeOptionName;
+    static const std::string batchPropertiesOptionName;
+    static const std::string boundSweepOptionName;
+    static const std::string hybridChunkBudgetOptionName;
 };
 
 }  // namespace modules
@@ -101,6 +101,11 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     bool isLexicographicModelCheckingSet() const;
 
+    /*!
+     * Retrieves the number of weight vectors that are checked concurrently. Zero means that all hardware threads are used.
+     */
+    uint64_t getNumberOfThreads() const;
+
     /*!
      * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
      *
@@ -119,6 +124,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
     const static std::string lexicographicOptionName;
+    const static std::string numberOfThreadsOptionName;
 };
 
 }  // namespace modules
@@ -13,9 +13,11 @@ namespace modules {
 
 const std::string MultiplierSettings::moduleName = "multiplier";
 const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+const std::string MultiplierSettings::compactMatrixOptionName = "compact-matrix";
+const std::string MultiplierSettings::encodedMatrixOptionName = "encoded-matrix";
 
 MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+    std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd"};
     this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.")
@@ -23,6 +25,16 @@ MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("gmmxx")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compactMatrixOptionName, false,
+                                                   "If set, the native multiplier operates on a copy of the matrix that stores columns (as 32-bit indices) and "
+                                                   "values in separate arrays. This reduces memory traffic but requires additional memory.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, encodedMatrixOptionName, false,
+                                                   "If set, the native multiplier operates on a copy of the matrix that stores the columns of each row as "
+                                                   "variable-length differences and (if there are few distinct values) the values as dictionary indices.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -31,6 +43,8 @@ storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
         return storm::solver::MultiplierType::Native;
     } else if (type == "gmmxx") {
         return storm::solver::MultiplierType::Gmmxx;
+    } else if (type == "simd") {
+        return storm::solver::MultiplierType::Simd;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -40,6 +54,14 @@ bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
     return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
+
+bool MultiplierSettings::isUseCompactMatrixSet() const {
+    return this->getOption(compactMatrixOptionName).getHasOptionBeenSet();
+}
+
+bool MultiplierSettings::isUseEncodedMatrixSet() const {
+    return this->getOption(encodedMatrixOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
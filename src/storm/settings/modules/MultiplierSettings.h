@@ -21,11 +21,23 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the native multiplier should use a compact copy of the matrix (separate column and value arrays, 32-bit columns).
+     */
+    bool isUseCompactMatrixSet() const;
+
+    /*!
+     * Retrieves whether the native multiplier should use an encoded copy of the matrix (delta-encoded columns, dictionary-encoded values).
+     */
+    bool isUseEncodedMatrixSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string compactMatrixOptionName;
+    static const std::string encodedMatrixOptionName;
 };
 
 }  // namespace modules
@@ -2,6 +2,7 @@
 
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingsManager.h"
@@ -16,6 +17,10 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::exportProfileJsonOptionName = "profile-json";
+const std::string ResourceSettings::memoryLimitOptionName = "memory-limit";
+const std::string ResourceSettings::checkpointOptionName = "checkpoint";
+const std::string ResourceSettings::resumeOptionName = "resume";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -25,9 +30,39 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, memoryLimitOptionName, false,
+                                                   "If given, cached results are dropped and the model is only explored partially when the memory "
+                                                   "consumption approaches the limit.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("megabytes", "The memory limit in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, checkpointOptionName, false,
+                                                   "If given, the iterative solvers periodically write their current iterate to a checkpoint file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to write to.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("interval", "Seconds between two checkpoints.")
+                                         .setDefaultValueUnsignedInteger(600)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resumeOptionName, false,
+                                                   "If given, the computation is resumed from the given checkpoint file. The input has to be the same as "
+                                                   "for the run that wrote the checkpoint.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("checkpoint", "The name of the checkpoint file.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.")
                         .setShortName(printTimeAndMemoryOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportProfileJsonOptionName, false,
+                                                   "Exports the time, the counters and the peak memory consumption of each (nested) phase as JSON.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to write to.").build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, signalWaitingTimeOptionName, false,
                                                    "Specifies how much time can pass until termination when receiving a termination signal.")
                         .setIsAdvanced()
@@ -45,10 +80,46 @@ uint_fast64_t ResourceSettings::getTimeoutInSeconds() const {
     return this->getOption(timeoutOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isMemoryLimitSet() const {
+    return this->getOption(memoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ResourceSettings::getMemoryLimitInMegabytes() const {
+    return this->getOption(memoryLimitOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger();
+}
+
+bool ResourceSettings::isCheckpointSet() const {
+    return this->getOption(checkpointOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getCheckpointFilename() const {
+    return this->getOption(checkpointOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+uint_fast64_t ResourceSettings::getCheckpointIntervalInSeconds() const {
+    return this->getOption(checkpointOptionName).getArgumentByName("interval").getValueAsUnsignedInteger();
+}
+
+bool ResourceSettings::isResumeSet() const {
+    return this->getOption(resumeOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getResumeFilename() const {
+    return this->getOption(resumeOptionName).getArgumentByName("checkpoint").getValueAsString();
+}
+
 bool ResourceSettings::isPrintTimeAndMemorySet() const {
     return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
 }
 
+bool ResourceSettings::isExportProfileJsonSet() const {
+    return this->getOption(exportProfileJsonOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getExportProfileJsonFilename() const {
+    return this->getOption(exportProfileJsonOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
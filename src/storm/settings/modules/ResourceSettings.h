@@ -24,6 +24,20 @@ class ResourceSettings : public ModuleSettings {
      */
     bool isPrintTimeAndMemorySet() const;
 
+    /*!
+     * Retrieves whether the per-phase timings and counters shall be exported.
+     *
+     * @return True iff the option was set.
+     */
+    bool isExportProfileJsonSet() const;
+
+    /*!
+     * Retrieves the file to which the per-phase timings and counters shall be exported.
+     *
+     * @return The name of the file.
+     */
+    std::string getExportProfileJsonFilename() const;
+
     /*!
      * Retrieves whether the timeout option was set.
      *
@@ -38,6 +52,55 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getTimeoutInSeconds() const;
 
+    /*!
+     * Retrieves whether the memory limit option was set.
+     *
+     * @return True if the memory limit option was set.
+     */
+    bool isMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the memory limit in case the memory limit option was set.
+     *
+     * @return The number of megabytes that the process may occupy.
+     */
+    uint_fast64_t getMemoryLimitInMegabytes() const;
+
+    /*!
+     * Retrieves whether the iterative solvers shall periodically write checkpoints.
+     *
+     * @return True iff the option was set.
+     */
+    bool isCheckpointSet() const;
+
+    /*!
+     * Retrieves the file to which the checkpoints shall be written.
+     *
+     * @return The name of the file.
+     */
+    std::string getCheckpointFilename() const;
+
+    /*!
+     * Retrieves the minimal time between two checkpoints.
+     *
+     * @return The number of seconds between two checkpoints.
+     */
+    uint_fast64_t getCheckpointIntervalInSeconds() const;
+
+    /*!
+     * Retrieves whether the computation shall be resumed from a checkpoint.
+     *
+     * @return True iff the option was set.
+     */
+    bool isResumeSet() const;
+
+    /*!
+     * Retrieves the checkpoint file from which the computation shall be resumed.
+     *
+     * @return The name of the file.
+     */
+    std::string getResumeFilename() const;
+
     /*!
      * Retrieves the waiting time of the program after a signal.
      * If a signal to abort is handled, the program should terminate.
@@ -57,6 +120,10 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string exportProfileJsonOptionName;
+    static const std::string memoryLimitOptionName;
+    static const std::string checkpointOptionName;
+    static const std::string resumeOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -0,0 +1,175 @@
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string StatisticalModelCheckingSettings::moduleName = "smc";
+const std::string StatisticalModelCheckingSettings::stoppingRuleOptionName = "rule";
+const std::string StatisticalModelCheckingSettings::precisionOptionName = "precision";
+const std::string StatisticalModelCheckingSettings::confidenceOptionName = "confidence";
+const std::string StatisticalModelCheckingSettings::indifferenceOptionName = "indifference";
+const std::string StatisticalModelCheckingSettings::maximalTraceLengthOptionName = "maxlength";
+const std::string StatisticalModelCheckingSettings::batchSizeOptionName = "batchsize";
+const std::string StatisticalModelCheckingSettings::seedOptionName = "seed";
+const std::string StatisticalModelCheckingSettings::importanceSplittingOptionName = "splitting";
+const std::string StatisticalModelCheckingSettings::importanceFunctionOptionName = "importance";
+const std::string StatisticalModelCheckingSettings::splittingEffortOptionName = "effort";
+const std::string StatisticalModelCheckingSettings::splittingReplicationsOptionName = "replications";
+
+StatisticalModelCheckingSettings::StatisticalModelCheckingSettings() : ModuleSettings(moduleName) {
+    std::vector<std::string> rules = {"chernoff", "sprt"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, stoppingRuleOptionName, true, "Sets the rule that determines when to stop the simulation.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the rule. 'chernoff' simulates as many traces as required by the Chernoff-Hoeffding bound to estimate "
+                                         "the probability. 'sprt' decides probability bounds with Wald's sequential probability ratio test and falls back "
+                                         "to 'chernoff' for properties without bound.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(rules))
+                                         .setDefaultValueString("chernoff")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The maximal absolute error of estimated probabilities.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, true, "The probability with which the result needs to be correct.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence level.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true,
+                                                   "The half-width of the indifference region around the threshold of a probability bound (only for 'sprt').")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width of the indifference region.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maximalTraceLengthOptionName, true,
+                                                   "The maximal number of steps of a trace. Longer traces are considered as not satisfying the property.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of steps.")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true, "The number of traces that are simulated in one batch.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "The seed from which the random numbers of all traces are derived.")
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").setDefaultValueUnsignedInteger(0).build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, importanceSplittingOptionName, true,
+                                                   "Estimates probabilities with fixed-effort importance splitting, which is suited for rare events.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, importanceFunctionOptionName, true,
+                                                   "The importance of the states for importance splitting. By default, it is derived from the property.")
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createStringArgument("expression", "A numerical expression over the variables of the model.")
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splittingEffortOptionName, true, "The number of trials per level of the importance splitting.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of trials.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splittingReplicationsOptionName, true,
+                                                   "The number of independent runs of the importance splitting from which the confidence interval is computed.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of runs.")
+                                         .setDefaultValueUnsignedInteger(16)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(1))
+                                         .build())
+                        .build());
+}
+
+StatisticalModelCheckingSettings::StoppingRule StatisticalModelCheckingSettings::getStoppingRule() const {
+    std::string ruleAsString = this->getOption(stoppingRuleOptionName).getArgumentByName("name").getValueAsString();
+    if (ruleAsString == "chernoff") {
+        return StatisticalModelCheckingSettings::StoppingRule::ChernoffHoeffding;
+    } else if (ruleAsString == "sprt") {
+        return StatisticalModelCheckingSettings::StoppingRule::Sprt;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown stopping rule '" << ruleAsString << "'.");
+}
+
+double StatisticalModelCheckingSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalModelCheckingSettings::getConfidence() const {
+    return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalModelCheckingSettings::getIndifference() const {
+    return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t StatisticalModelCheckingSettings::getMaximalTraceLength() const {
+    return this->getOption(maximalTraceLengthOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+bool StatisticalModelCheckingSettings::isImportanceSplittingSet() const {
+    return this->getOption(importanceSplittingOptionName).getHasOptionBeenSet();
+}
+
+bool StatisticalModelCheckingSettings::isImportanceFunctionSet() const {
+    return this->getOption(importanceFunctionOptionName).getHasOptionBeenSet();
+}
+
+std::string StatisticalModelCheckingSettings::getImportanceFunction() const {
+    return this->getOption(importanceFunctionOptionName).getArgumentByName("expression").getValueAsString();
+}
+
+uint64_t StatisticalModelCheckingSettings::getSplittingEffort() const {
+    return this->getOption(splittingEffortOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getSplittingReplications() const {
+    return this->getOption(splittingReplicationsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool StatisticalModelCheckingSettings::check() const {
+    bool optionsSet = this->getOption(stoppingRuleOptionName).getHasOptionBeenSet() || this->getOption(precisionOptionName).getHasOptionBeenSet() ||
+                      this->getOption(confidenceOptionName).getHasOptionBeenSet() || this->getOption(indifferenceOptionName).getHasOptionBeenSet() ||
+                      this->getOption(maximalTraceLengthOptionName).getHasOptionBeenSet() || this->getOption(batchSizeOptionName).getHasOptionBeenSet() ||
+                      this->getOption(seedOptionName).getHasOptionBeenSet() || isImportanceSplittingSet() || isImportanceFunctionSet() ||
+                      this->getOption(splittingEffortOptionName).getHasOptionBeenSet() ||
+                      this->getOption(splittingReplicationsOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(!isImportanceFunctionSet() || isImportanceSplittingSet(), "An importance function only has an effect with importance splitting.");
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Smc || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class StatisticalModelCheckingSettings : public ModuleSettings {
+   public:
+    // The available rules that determine when to stop the simulation.
+    enum class StoppingRule { ChernoffHoeffding, Sprt };
+
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    StatisticalModelCheckingSettings();
+
+    /*!
+     * Retrieves the selected stopping rule.
+     *
+     * @return The selected stopping rule.
+     */
+    StoppingRule getStoppingRule() const;
+
+    /*!
+     * Retrieves the maximal absolute error of the estimated probabilities.
+     *
+     * @return The maximal absolute error of the estimated probabilities.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the probability with which the computed result needs to be correct.
+     *
+     * @return The confidence level.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the half-width of the indifference region around the threshold of a probability bound, which is used by the sequential
+     * probability ratio test.
+     *
+     * @return The half-width of the indifference region.
+     */
+    double getIndifference() const;
+
+    /*!
+     * Retrieves the maximal number of steps of a simulated trace.
+     *
+     * @return The maximal number of steps of a simulated trace.
+     */
+    uint64_t getMaximalTraceLength() const;
+
+    /*!
+     * Retrieves the number of traces that are simulated in one batch.
+     *
+     * @return The number of traces that are simulated in one batch.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Retrieves the seed from which the random numbers of all traces are derived.
+     *
+     * @return The seed.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves whether importance splitting is to be used to estimate (small) probabilities.
+     *
+     * @return True iff importance splitting is to be used.
+     */
+    bool isImportanceSplittingSet() const;
+
+    /*!
+     * Retrieves whether an importance function has been given.
+     *
+     * @return True iff an importance function has been given.
+     */
+    bool isImportanceFunctionSet() const;
+
+    /*!
+     * Retrieves the (unparsed) expression that assigns an importance to each state.
+     *
+     * @return The expression that assigns an importance to each state.
+     */
+    std::string getImportanceFunction() const;
+
+    /*!
+     * Retrieves the number of trials that are simulated on each level of the importance splitting.
+     *
+     * @return The number of trials per level.
+     */
+    uint64_t getSplittingEffort() const;
+
+    /*!
+     * Retrieves the number of independent runs of the importance splitting from which the confidence interval is computed.
+     *
+     * @return The number of independent runs.
+     */
+    uint64_t getSplittingReplications() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string stoppingRuleOptionName;
+    static const std::string precisionOptionName;
+    static const std::string confidenceOptionName;
+    static const std::string indifferenceOptionName;
+    static const std::string maximalTraceLengthOptionName;
+    static const std::string batchSizeOptionName;
+    static const std::string seedOptionName;
+    static const std::string importanceSplittingOptionName;
+    static const std::string importanceFunctionOptionName;
+    static const std::string splittingEffortOptionName;
+    static const std::string splittingReplicationsOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -23,6 +23,9 @@ namespace modules {
 const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+const std::string TopologicalEquationSolverSettings::directSolverThresholdOptionName = "direct-threshold";
+const std::string TopologicalEquationSolverSettings::adaptiveOptionName = "adaptive";
+const std::string TopologicalEquationSolverSettings::adaptiveDirectEntryLimitOptionName = "adaptive-direct-limit";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -45,6 +48,26 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .setDefaultValueString("value-iteration")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, directSolverThresholdOptionName, true,
+                                                   "SCCs with at most this many states are solved with a dense direct solver instead of the underlying "
+                                                   "equation solver. Not used for sound computations with floating point numbers.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("states", "The threshold (0 to disable).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveOptionName, true,
+                                                   "Chooses the minmax method for each SCC: Small SCCs are solved with policy iteration and a direct solver, "
+                                                   "large SCCs with Gauss-Seidel value iteration (or optimistic value iteration for sound computations).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveDirectEntryLimitOptionName, true,
+                                                   "The maximal number of matrix entries of an SCC that is solved directly by the adaptive method selection.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("entries", "The limit.")
+                                         .setDefaultValueUnsignedInteger(20000)
+                                         .build())
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -102,6 +125,18 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
 }
 
+uint64_t TopologicalEquationSolverSettings::getDirectSolverThreshold() const {
+    return this->getOption(directSolverThresholdOptionName).getArgumentByName("states").getValueAsUnsignedInteger();
+}
+
+bool TopologicalEquationSolverSettings::isAdaptiveMethodSelectionSet() const {
+    return this->getOption(adaptiveOptionName).getHasOptionBeenSet();
+}
+
+uint64_t TopologicalEquationSolverSettings::getAdaptiveDirectEntryLimit() const {
+    return this->getOption(adaptiveDirectEntryLimitOptionName).getArgumentByName("entries").getValueAsUnsignedInteger();
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
@@ -60,6 +60,28 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves the maximal number of states of an SCC that is solved with a dense direct solver (instead of the underlying solver).
+     *
+     * @return The threshold. Zero means that no SCC is solved directly.
+     */
+    uint64_t getDirectSolverThreshold() const;
+
+    /*!
+     * Retrieves whether the minmax method is chosen for each SCC individually.
+     *
+     * @return True iff the adaptive method selection is enabled.
+     */
+    bool isAdaptiveMethodSelectionSet() const;
+
+    /*!
+     * Retrieves the maximal number of matrix entries of an SCC that is solved with policy iteration and a direct solver if the minmax
+     * method is chosen for each SCC individually.
+     *
+     * @return The limit.
+     */
+    uint64_t getAdaptiveDirectEntryLimit() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +91,9 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string directSolverThresholdOptionName;
+    static const std::string adaptiveOptionName;
+    static const std::string adaptiveDirectEntryLimitOptionName;
 };
 
 }  // namespace modules
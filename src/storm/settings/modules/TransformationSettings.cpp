@@ -16,6 +16,7 @@ const std::string TransformationSettings::chainEliminationOptionName = "eliminat
 const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-behavior";
 const std::string TransformationSettings::toNondetOptionName = "to-nondet";
 const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
+const std::string TransformationSettings::permuteStatesOptionName = "permute-states";
 
 TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, chainEliminationOptionName, false,
@@ -46,6 +47,19 @@ TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
                                                    "If set, CTMCs/MAs are converted to DTMCs/MDPs (which might or might not preserve the provided properties).")
                         .setIsAdvanced()
                         .build());
+    std::vector<std::string> stateOrders = {"bfs", "rcm", "scc"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, permuteStatesOptionName, false,
+                                       "If set, the states of sparse models are rearranged before model checking to improve the memory locality of solvers.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "order",
+                             "The order of the states. 'bfs' is the breadth-first order from the initial states, 'rcm' the reverse Cuthill-McKee order and "
+                             "'scc' groups the states by SCCs in topological order (such that each SCC only reaches SCCs before it).")
+                             .setDefaultValueString("rcm")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateOrders))
+                             .build())
+            .build());
 }
 
 bool TransformationSettings::isChainEliminationSet() const {
@@ -73,6 +87,22 @@ bool TransformationSettings::isToDiscreteTimeModelSet() const {
     return this->getOption(toDiscreteTimeOptionName).getHasOptionBeenSet();
 }
 
+bool TransformationSettings::isPermuteStatesSet() const {
+    return this->getOption(permuteStatesOptionName).getHasOptionBeenSet();
+}
+
+storm::utility::permutation::OrderKind TransformationSettings::getStateOrder() const {
+    std::string orderAsString = this->getOption(permuteStatesOptionName).getArgumentByName("order").getValueAsString();
+    if (orderAsString == "bfs") {
+        return storm::utility::permutation::OrderKind::Bfs;
+    } else if (orderAsString == "rcm") {
+        return storm::utility::permutation::OrderKind::ReverseCuthillMcKee;
+    } else if (orderAsString == "scc") {
+        return storm::utility::permutation::OrderKind::TopologicalScc;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << orderAsString << "' set as state order.");
+}
+
 bool TransformationSettings::check() const {
     // Ensure that labeling preservation is only set if chain elimination is set
     STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(), storm::exceptions::InvalidSettingsException,
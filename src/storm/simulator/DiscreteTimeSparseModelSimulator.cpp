@@ -35,10 +35,14 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep()
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action) {
+    return step(action, generator.random());
+}
+
+template<typename ValueType, typename RewardModelType>
+bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action, ValueType const& probability) {
     // TODO lots of optimization potential.
     //  E.g., do not sample random numbers if there is only a single transition
     lastRewards = zeroRewards;
-    ValueType probability = generator.random();
     STORM_LOG_ASSERT(action < model.getTransitionMatrix().getRowGroupSize(currentState), "Action index higher than number of actions");
     uint64_t row = model.getTransitionMatrix().getRowGroupIndices()[currentState] + action;
     uint64_t i = 0;
@@ -19,6 +19,11 @@ class DiscreteTimeSparseModelSimulator {
     DiscreteTimeSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
     void setSeed(uint64_t);
     bool step(uint64_t action);
+    /**
+     * Takes the given action and selects the successor whose cumulative probability first reaches the given probability.
+     * This allows to draw the random numbers from an external source, e.g., one stream per simulated trace.
+     */
+    bool step(uint64_t action, ValueType const& probability);
     bool randomStep();
     std::vector<ValueType> const& getLastRewards() const;
     uint64_t getCurrentState() const;
@@ -30,7 +30,12 @@ void DiscreteTimePrismProgramSimulator<ValueType>::setSeed(uint64_t newSeed) {
 
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::step(uint64_t actionNumber) {
-    uint32_t nextState = behavior.getChoices()[actionNumber].sampleFromDistribution(generator.random());
+    return step(actionNumber, generator.random());
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::step(uint64_t actionNumber, ValueType const& quantile) {
+    uint32_t nextState = behavior.getChoices()[actionNumber].sampleFromDistribution(quantile);
     lastActionRewards = behavior.getChoices()[actionNumber].getRewards();
     STORM_LOG_ASSERT(lastActionRewards.size() == stateGenerator->getNumberOfRewardModels(), "Reward vector should have as many rewards as model.");
     currentState = idToState[nextState];
@@ -54,6 +59,12 @@ bool DiscreteTimePrismProgramSimulator<ValueType>::explore() {
     return true;
 }
 
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::satisfies(storm::expressions::Expression const& expression) const {
+    // The current state is always loaded into the generator, see explore().
+    return stateGenerator->satisfies(expression);
+}
+
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::isSinkState() const {
     if (behavior.empty()) {
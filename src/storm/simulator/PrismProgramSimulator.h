@@ -52,6 +52,19 @@ class DiscreteTimePrismProgramSimulator {
      * @return true, if this action can be taken.
      */
     bool step(uint64_t actionNumber);
+    /**
+     * Make a step with the given action, where the successor is selected using the given quantile in [0,1) instead of a number drawn from the
+     * internal random number generator.
+     *
+     * @param actionNumber The action to select.
+     * @param quantile The quantile of the distribution of the action that determines the successor.
+     * @return true, if this action can be taken.
+     */
+    bool step(uint64_t actionNumber, ValueType const& quantile);
+    /**
+     * Evaluates the given (boolean) expression over the variables of the program in the current state.
+     */
+    bool satisfies(storm::expressions::Expression const& expression) const;
     /**
      * Accessor for the last state action reward and the current state reward, added together.
      * @return A vector with te number of rewards.
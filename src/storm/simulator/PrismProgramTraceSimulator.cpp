@@ -0,0 +1,105 @@
+#include "storm/simulator/PrismProgramTraceSimulator.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+using namespace storm::generator;
+
+namespace storm {
+namespace simulator {
+
+template<typename ValueType>
+DiscreteTimePrismProgramTraceSimulator<ValueType>::DiscreteTimePrismProgramTraceSimulator(storm::prism::Program const& program,
+                                                                                          storm::generator::NextStateGeneratorOptions const& options)
+    : stateGenerator(program, options), lastStepChangedState(false) {
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Simulating traces is only supported for DTMCs.");
+    std::vector<CompressedState> initialStates;
+    stateGenerator.getInitialStates([&initialStates](CompressedState const& state) {
+        initialStates.push_back(state);
+        return static_cast<uint32_t>(initialStates.size() - 1);
+    });
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Program must have a unique initial state");
+    initialState = std::move(initialStates.front());
+    resetToInitial();
+}
+
+template<typename ValueType>
+void DiscreteTimePrismProgramTraceSimulator<ValueType>::resetToInitial() {
+    resetToState(initialState);
+}
+
+template<typename ValueType>
+void DiscreteTimePrismProgramTraceSimulator<ValueType>::resetToState(CompressedState const& compressedState) {
+    currentState = compressedState;
+    lastStepChangedState = false;
+    stateGenerator.load(currentState);
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramTraceSimulator<ValueType>::step(storm::utility::CounterBasedRandomGenerator& generator) {
+    auto successor = stateGenerator.sampleSuccessor([&generator]() { return generator.random(); });
+    if (!successor) {
+        lastStepChangedState = false;
+        return false;
+    }
+    lastStepChangedState = successor.get() != currentState;
+    if (lastStepChangedState) {
+        currentState = std::move(successor.get());
+        stateGenerator.load(currentState);
+    }
+    return true;
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramTraceSimulator<ValueType>::hasLastStepChangedState() const {
+    return lastStepChangedState;
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramTraceSimulator<ValueType>::satisfies(storm::expressions::Expression const& expression) const {
+    return stateGenerator.satisfies(expression);
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramTraceSimulator<ValueType>::isCurrentStateAbsorbing() {
+    // The successors are identified by comparing them with the current state, which gets index 0.
+    bool hasOtherSuccessor = false;
+    auto behavior = stateGenerator.expand([this, &hasOtherSuccessor](CompressedState const& state) {
+        if (state == currentState) {
+            return 0u;
+        }
+        hasOtherSuccessor = true;
+        return 1u;
+    });
+    stateGenerator.recycle(std::move(behavior));
+    return !hasOtherSuccessor;
+}
+
+template<typename ValueType>
+ValueType DiscreteTimePrismProgramTraceSimulator<ValueType>::getCurrentStateReward(uint64_t rewardModelIndex) const {
+    return stateGenerator.getStateReward(rewardModelIndex);
+}
+
+template<typename ValueType>
+CompressedState const& DiscreteTimePrismProgramTraceSimulator<ValueType>::getCurrentState() const {
+    return currentState;
+}
+
+template<typename ValueType>
+std::string DiscreteTimePrismProgramTraceSimulator<ValueType>::getCurrentStateString() const {
+    return stateGenerator.stateToString(currentState);
+}
+
+template<typename ValueType>
+std::vector<std::string> DiscreteTimePrismProgramTraceSimulator<ValueType>::getRewardNames() const {
+    std::vector<std::string> names;
+    for (uint64_t i = 0; i < stateGenerator.getNumberOfRewardModels(); ++i) {
+        names.push_back(stateGenerator.getRewardModelInformation(i).getName());
+    }
+    return names;
+}
+
+template class DiscreteTimePrismProgramTraceSimulator<double>;
+}  // namespace simulator
+}  // namespace storm
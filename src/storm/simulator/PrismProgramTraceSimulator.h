@@ -0,0 +1,89 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace simulator {
+
+/**
+ * This class simulates traces of a discrete-time Markov chain given as a prism program with a high throughput.
+ *
+ * In contrast to the DiscreteTimePrismProgramSimulator, the choices of a state are never materialized. Instead, a step evaluates the guards of
+ * the commands, selects one enabled (combination of) command(s) and then samples one update of each selected command. Rewards are only
+ * evaluated upon request and the simulator does not store any visited states, so simulating a step requires constant memory.
+ * One simulator may be used to simulate many traces (e.g. a batch of traces of one thread) by resetting it to the initial state.
+ *
+ * @tparam ValueType
+ */
+template<typename ValueType>
+class DiscreteTimePrismProgramTraceSimulator {
+   public:
+    /**
+     * Initialize the simulator for a given prism program.
+     *
+     * @param program The prism program (a DTMC). Should have a unique initial state.
+     * @param options The generator options that are used to generate successor states.
+     */
+    DiscreteTimePrismProgramTraceSimulator(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& options);
+
+    /**
+     * Reset to the (unique) initial state.
+     */
+    void resetToInitial();
+
+    void resetToState(generator::CompressedState const& compressedState);
+
+    /**
+     * Make a step to a successor, which is selected using numbers drawn from the given generator.
+     *
+     * @return true, if a command is enabled in the current state. Otherwise, the state is not changed.
+     */
+    bool step(storm::utility::CounterBasedRandomGenerator& generator);
+
+    /**
+     * @return true, if the last step led to a state that differs from its predecessor.
+     */
+    bool hasLastStepChangedState() const;
+
+    /**
+     * Evaluates the given (boolean) expression over the variables of the program in the current state.
+     */
+    bool satisfies(storm::expressions::Expression const& expression) const;
+
+    /**
+     * Checks whether the current state has no successor other than itself. As this requires to explore all choices of the current state,
+     * it should only be called if necessary, e.g. after a step that did not change the state.
+     */
+    bool isCurrentStateAbsorbing();
+
+    /**
+     * Computes the state reward of the current state in the reward model with the given index. Action rewards are not supported.
+     */
+    ValueType getCurrentStateReward(uint64_t rewardModelIndex) const;
+
+    generator::CompressedState const& getCurrentState() const;
+
+    std::string getCurrentStateString() const;
+
+    /**
+     * The names of the reward models whose rewards can be retrieved.
+     */
+    std::vector<std::string> getRewardNames() const;
+
+   private:
+    /// The current state in the program, in its compressed form.
+    generator::CompressedState currentState;
+    /// Generator for the next states
+    storm::generator::PrismNextStateGenerator<ValueType, uint32_t> stateGenerator;
+    /// The initial state of the program.
+    generator::CompressedState initialState;
+    /// Whether the last step changed the current state.
+    bool lastStepChangedState;
+};
+}  // namespace simulator
+}  // namespace storm
@@ -10,6 +10,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 
 namespace storm {
 namespace solver {
@@ -310,6 +311,7 @@ void AbstractEquationSolver<ValueType>::showProgressIterative(uint64_t iteration
 template<typename ValueType>
 void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations) const {
     if (iterations) {
+        storm::utility::profiling::addToCounter("iterations", iterations.get());
         switch (status) {
             case SolverStatus::Converged:
                 STORM_LOG_TRACE("Iterative solver converged after " << iterations.get() << " iterations.");
@@ -1,7 +1,7 @@
 #include "storm/solver/AcyclicLinearEquationSolver.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
-#include "storm/solver/helper/AcyclicSolverHelper.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/utility/vector.h"
 
@@ -65,6 +65,9 @@ bool AcyclicLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         }
         auxiliaryRowVector = std::vector<ValueType>(this->A->getRowCount());
         auxiliaryRowVector2 = std::vector<ValueType>(this->A->getRowCount());
+        if (env.solver().getNumberOfThreads() > 1) {
+            depthLevels = helper::computeDepthLevels(orderedMatrix ? *orderedMatrix : *this->A);
+        }
     }
 
     std::vector<ValueType>* xPtr = &x;
@@ -80,7 +83,15 @@ bool AcyclicLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         xPtr = &auxiliaryRowVector2.get();
     }
 
-    this->multiplier->multiplyGaussSeidel(env, *xPtr, bPtr, true);
+    if (depthLevels) {
+        // Rows of the same depth do not depend on each other.
+        storm::storage::SparseMatrix<ValueType> const& matrix = orderedMatrix ? *orderedMatrix : *this->A;
+        std::vector<ValueType>& result = *xPtr;
+        helper::forEachGroupByDepth(env.solver().getNumberOfThreads(), *depthLevels,
+                                    [&](uint64_t row) { result[row] = (*bPtr)[row] + matrix.multiplyRowWithVector(row, result); });
+    } else {
+        this->multiplier->multiplyGaussSeidel(env, *xPtr, bPtr, true);
+    }
 
     if (rowOrdering) {
         for (uint64_t newRow = 0; newRow < x.size(); ++newRow) {
@@ -114,6 +125,7 @@ void AcyclicLinearEquationSolver<ValueType>::clearCache() const {
     rowOrdering = boost::none;
     auxiliaryRowVector = boost::none;
     auxiliaryRowVector2 = boost::none;
+    depthLevels = boost::none;
     bFactors.clear();
 }
 
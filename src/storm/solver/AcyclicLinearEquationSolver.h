@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/AcyclicSolverHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 namespace storm {
@@ -13,6 +14,7 @@ namespace solver {
 /*!
  * This solver can be used on equation systems that are known to be acyclic.
  * It is optimized for solving many instances of the equation system with the same underlying matrix.
+ * If several threads are available and the system is wide enough, the rows of the same depth are solved in parallel.
  */
 template<typename ValueType>
 class AcyclicLinearEquationSolver : public LinearEquationSolver<ValueType> {
@@ -57,6 +59,8 @@ class AcyclicLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable boost::optional<std::vector<ValueType>> auxiliaryRowVector2;  // A.rowCount() entries
     // contains factors applied to scale the entries of the 'b' vector
     mutable std::vector<std::pair<uint64_t, ValueType>> bFactors;
+    // cached depth levels of the (ordered) matrix (only if the levels are solved in parallel)
+    mutable boost::optional<helper::DepthLevels> depthLevels;
 };
 }  // namespace solver
 }  // namespace storm
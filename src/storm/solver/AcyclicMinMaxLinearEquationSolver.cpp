@@ -1,6 +1,6 @@
 #include "storm/solver/AcyclicMinMaxLinearEquationSolver.h"
 
-#include "storm/solver/helper/AcyclicSolverHelper.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/utility/vector.h"
 
@@ -43,6 +43,9 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
         }
         auxiliaryRowVector = std::vector<ValueType>(this->A->getRowCount());
         auxiliaryRowGroupVector = std::vector<ValueType>(this->A->getRowGroupCount());
+        if (env.solver().getNumberOfThreads() > 1) {
+            depthLevels = helper::computeDepthLevels(orderedMatrix ? *orderedMatrix : *this->A);
+        }
     }
 
     std::vector<ValueType>* xPtr = &x;
@@ -87,7 +90,11 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
     }
 
     // Since a topological ordering is guaranteed, we can solve the equations with a single matrix-vector Multiplication step.
-    this->multiplier->multiplyAndReduceGaussSeidel(env, dir, *xPtr, bPtr, choicesPtr, true);
+    if (depthLevels) {
+        solveByDepthLevels(env, dir, orderedMatrix ? *orderedMatrix : *this->A, *xPtr, *bPtr, choicesPtr);
+    } else {
+        this->multiplier->multiplyAndReduceGaussSeidel(env, dir, *xPtr, bPtr, choicesPtr, true);
+    }
 
     if (rowGroupOrdering) {
         // Restore the correct input-order for the output vector
@@ -108,6 +115,43 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
     return true;
 }
 
+template<typename ValueType>
+void AcyclicMinMaxLinearEquationSolver<ValueType>::solveByDepthLevels(Environment const& env, OptimizationDirection dir,
+                                                                      storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x,
+                                                                      std::vector<ValueType> const& b, std::vector<uint64_t>* choices) const {
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    helper::forEachGroupByDepth(env.solver().getNumberOfThreads(), *depthLevels, [&](uint64_t group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        if (groupStart == groupEnd) {
+            return;
+        }
+        // As in the sequential multiplication, the rows are considered backwards and the previous choice is only changed if there is a strictly
+        // better one.
+        ValueType bestValue = b[groupEnd - 1] + matrix.multiplyRowWithVector(groupEnd - 1, x);
+        uint64_t bestChoice = groupEnd - 1 - groupStart;
+        boost::optional<ValueType> previousChoiceValue;
+        if (choices && (*choices)[group] == bestChoice) {
+            previousChoiceValue = bestValue;
+        }
+        for (uint64_t row = groupEnd - 1; row > groupStart;) {
+            --row;
+            ValueType value = b[row] + matrix.multiplyRowWithVector(row, x);
+            if (choices && (*choices)[group] == row - groupStart) {
+                previousChoiceValue = value;
+            }
+            if (minimize(dir) ? value < bestValue : value > bestValue) {
+                bestValue = value;
+                bestChoice = row - groupStart;
+            }
+        }
+        x[group] = bestValue;
+        if (choices && (!previousChoiceValue || (minimize(dir) ? bestValue < *previousChoiceValue : bestValue > *previousChoiceValue))) {
+            (*choices)[group] = bestChoice;
+        }
+    });
+}
+
 template<typename ValueType>
 MinMaxLinearEquationSolverRequirements AcyclicMinMaxLinearEquationSolver<ValueType>::getRequirements(
     Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
@@ -125,6 +169,7 @@ void AcyclicMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     auxiliaryRowVector = boost::none;
     auxiliaryRowGroupVector = boost::none;
     auxiliaryRowGroupIndexVector = boost::none;
+    depthLevels = boost::none;
     bFactors.clear();
 }
 
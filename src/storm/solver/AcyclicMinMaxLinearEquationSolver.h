@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/AcyclicSolverHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 namespace storm {
@@ -14,6 +15,7 @@ namespace solver {
 /*!
  * This solver can be used on equation systems that are known to be acyclic.
  * It is optimized for solving many instances of the equation system with the same underlying matrix.
+ * If several threads are available and the system is wide enough, the row groups of the same depth are solved in parallel.
  */
 template<typename ValueType>
 class AcyclicMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<ValueType> {
@@ -35,6 +37,12 @@ class AcyclicMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSol
                                         std::vector<ValueType> const& b) const override;
 
    private:
+    /*!
+     * Solves the (ordered) equation system by processing the row groups level by level, where the row groups of each level are processed in parallel.
+     */
+    void solveByDepthLevels(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix,
+                            std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>* choices) const;
+
     // cached multiplier either with original matrix or ordered matrix
     mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplier;
     // cached matrix for the multiplier (only if different from original matrix)
@@ -49,6 +57,8 @@ class AcyclicMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSol
     mutable boost::optional<std::vector<uint64_t>> auxiliaryRowGroupIndexVector;  // A.rowGroupCount() entries
     // contains factors applied to scale the entries of the 'b' vector
     mutable std::vector<std::pair<uint64_t, ValueType>> bFactors;
+    // cached depth levels of the (ordered) matrix (only if the levels are solved in parallel)
+    mutable boost::optional<helper::DepthLevels> depthLevels;
 };
 }  // namespace solver
 }  // namespace storm
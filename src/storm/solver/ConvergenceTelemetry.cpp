@@ -0,0 +1,112 @@
+#include "storm/solver/ConvergenceTelemetry.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+
+ConvergenceTelemetry::ConvergenceTelemetry(Callback const& callback, uint64_t samplingInterval) : callback(callback), samplingInterval(samplingInterval) {
+    STORM_LOG_THROW(samplingInterval > 0, storm::exceptions::InvalidArgumentException, "The sampling interval of the telemetry must be positive.");
+}
+
+std::shared_ptr<ConvergenceTelemetry> ConvergenceTelemetry::createCsvStreamTelemetry(std::ostream& stream, uint64_t samplingInterval) {
+    stream << "method,scc,iteration,residual,bound-gap,seconds-per-iteration\n";
+    auto writeRecord = [&stream](ConvergenceTelemetryRecord const& record) {
+        stream << record.method << ',';
+        if (record.sccIndex) {
+            stream << record.sccIndex.value();
+        }
+        stream << ',' << record.iteration << ',';
+        if (record.residual) {
+            stream << record.residual.value();
+        }
+        stream << ',';
+        if (record.boundGap) {
+            stream << record.boundGap.value();
+        }
+        stream << ',' << record.secondsPerIteration << '\n';
+    };
+    return std::make_shared<ConvergenceTelemetry>(writeRecord, samplingInterval);
+}
+
+uint64_t ConvergenceTelemetry::getSamplingInterval() const {
+    return samplingInterval;
+}
+
+void ConvergenceTelemetry::report(ConvergenceTelemetryRecord const& record) const {
+    if (callback) {
+        callback(record);
+    }
+}
+
+template<typename ValueType>
+ConvergenceTelemetryRecorder<ValueType>::ConvergenceTelemetryRecorder(Environment const& env, std::string const& method)
+    : telemetry(env.solver().getConvergenceTelemetry()),
+      samplingInterval(telemetry ? telemetry->getSamplingInterval() : 1),
+      method(method),
+      sccIndex(env.solver().getConvergenceTelemetrySccIndex()),
+      lastRecordTime(std::chrono::steady_clock::now()),
+      lastRecordIteration(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void ConvergenceTelemetryRecorder<ValueType>::recordIteration(uint64_t iteration, std::vector<ValueType> const& iterate,
+                                                              std::optional<ValueType> const& boundGap) {
+    if (!isIterationRelevant(iteration)) {
+        return;
+    }
+    if (iteration % samplingInterval == 0) {
+        auto now = std::chrono::steady_clock::now();
+        ConvergenceTelemetryRecord record;
+        record.method = method;
+        record.sccIndex = sccIndex;
+        record.iteration = iteration;
+        if (previousIteration == iteration - 1 && previousIterate.size() == iterate.size()) {
+            ValueType residual = storm::utility::zero<ValueType>();
+            for (uint64_t i = 0; i < iterate.size(); ++i) {
+                residual = std::max(residual, storm::utility::abs<ValueType>(iterate[i] - previousIterate[i]));
+            }
+            record.residual = storm::utility::convertNumber<double>(residual);
+        }
+        if (boundGap) {
+            record.boundGap = storm::utility::convertNumber<double>(boundGap.value());
+        }
+        record.secondsPerIteration =
+            std::chrono::duration<double>(now - lastRecordTime).count() / static_cast<double>(std::max<uint64_t>(1, iteration - lastRecordIteration));
+        telemetry->report(record);
+        // The time spent for reporting does not count towards the next record.
+        lastRecordTime = std::chrono::steady_clock::now();
+        lastRecordIteration = iteration;
+    }
+    if ((iteration + 1) % samplingInterval == 0) {
+        previousIterate = iterate;
+        previousIteration = iteration;
+    }
+}
+
+template<typename ValueType>
+ValueType ConvergenceTelemetryRecorder<ValueType>::computeBoundGap(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) {
+    STORM_LOG_ASSERT(lower.size() == upper.size(), "Bound vectors have different sizes.");
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t i = 0; i < lower.size(); ++i) {
+        result = std::max<ValueType>(result, upper[i] - lower[i]);
+    }
+    return result;
+}
+
+template class ConvergenceTelemetryRecorder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ConvergenceTelemetryRecorder<storm::RationalNumber>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * A snapshot of the progress of an iterative solver.
+ */
+struct ConvergenceTelemetryRecord {
+    // The name of the solution method, e.g. "value iteration".
+    std::string method;
+    // The index of the SCC that is being solved (if the solver is invoked by a topological solver).
+    std::optional<uint64_t> sccIndex;
+    // The number of iterations performed so far.
+    uint64_t iteration;
+    // The maximal absolute difference between the last two iterates.
+    std::optional<double> residual;
+    // For methods that maintain a lower and an upper bound, the maximal difference between these bounds.
+    std::optional<double> boundGap;
+    // The average time (in seconds) that one iteration took since the previous record.
+    double secondsPerIteration;
+};
+
+/*!
+ * Receives convergence telemetry from the iterative solvers. To keep the overhead negligible, only every n'th iteration is reported for
+ * the sampling interval n. Telemetry is opt-in: it is only collected if it has been set in the solver environment.
+ */
+class ConvergenceTelemetry {
+   public:
+    typedef std::function<void(ConvergenceTelemetryRecord const&)> Callback;
+
+    ConvergenceTelemetry(Callback const& callback, uint64_t samplingInterval = 100);
+
+    /*!
+     * Creates telemetry that writes each record as a line of comma separated values to the given stream, which needs to outlive the telemetry.
+     */
+    static std::shared_ptr<ConvergenceTelemetry> createCsvStreamTelemetry(std::ostream& stream, uint64_t samplingInterval = 100);
+
+    uint64_t getSamplingInterval() const;
+    void report(ConvergenceTelemetryRecord const& record) const;
+
+   private:
+    Callback callback;
+    uint64_t samplingInterval;
+};
+
+/*!
+ * Collects the telemetry of a single solver invocation. All methods are no-ops if no telemetry is set in the given environment.
+ */
+template<typename ValueType>
+class ConvergenceTelemetryRecorder {
+   public:
+    ConvergenceTelemetryRecorder(Environment const& env, std::string const& method);
+
+    /*!
+     * Retrieves whether the current iterate needs to be passed for the given iteration, i.e., whether the iteration is sampled or precedes a
+     * sampled iteration.
+     */
+    bool isIterationRelevant(uint64_t iteration) const {
+        return telemetry && (iteration % samplingInterval == 0 || (iteration + 1) % samplingInterval == 0);
+    }
+
+    /*!
+     * Passes the iterate of the given iteration (and optionally the gap between the lower and the upper bound). Records are only reported
+     * for sampled iterations.
+     */
+    void recordIteration(uint64_t iteration, std::vector<ValueType> const& iterate, std::optional<ValueType> const& boundGap = std::nullopt);
+
+    /*!
+     * Computes the maximal difference between the given upper and lower bounds.
+     */
+    static ValueType computeBoundGap(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper);
+
+   private:
+    std::shared_ptr<ConvergenceTelemetry> telemetry;
+    uint64_t samplingInterval;
+    std::string method;
+    std::optional<uint64_t> sccIndex;
+
+    // The iterate of the previous iteration (if it was relevant).
+    std::vector<ValueType> previousIterate;
+    std::optional<uint64_t> previousIteration;
+
+    // The time and iteration of the previous record.
+    std::chrono::steady_clock::time_point lastRecordTime;
+    uint64_t lastRecordIteration;
+};
+
+}  // namespace solver
+}  // namespace storm
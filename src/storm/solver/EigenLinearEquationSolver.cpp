@@ -1,5 +1,7 @@
 #include "storm/solver/EigenLinearEquationSolver.h"
 
+#include <type_traits>
+
 #include "storm/adapters/EigenAdapter.h"
 
 #include "storm/environment/solver/EigenSolverEnvironment.h"
@@ -246,6 +248,27 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     return true;
 }
 
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                                          uint64_t numberOfRightHandSides) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (getMethod(env, env.solver().isForceExact()) == EigenLinearEquationSolverMethod::SparseLU) {
+            STORM_LOG_INFO("Solving linear equation system (" << this->eigenA->rows() << " rows) for " << numberOfRightHandSides
+                                                              << " right-hand sides with sparse LU factorization (Eigen library).");
+            // The interleaved vectors are the rows of a dense row-major matrix with one column per right-hand side, so the matrix is factorized
+            // only once and all right-hand sides are solved together.
+            typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> InterleavedMatrix;
+            Eigen::Map<InterleavedMatrix> eigenX(X.data(), this->eigenA->rows(), numberOfRightHandSides);
+            Eigen::Map<InterleavedMatrix const> eigenB(B.data(), this->eigenA->rows(), numberOfRightHandSides);
+            Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
+            solver.compute(*this->eigenA);
+            eigenX = solver.solve(eigenB);
+            return solver.info() == Eigen::ComputationInfo::Success;
+        }
+    }
+    return LinearEquationSolver<ValueType>::internalSolveMultipleEquations(env, X, B, numberOfRightHandSides);
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat EigenLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const&) const {
     return LinearEquationSolverProblemFormat::EquationSystem;
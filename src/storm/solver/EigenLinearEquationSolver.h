@@ -24,6 +24,8 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+    virtual bool internalSolveMultipleEquations(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                uint64_t numberOfRightHandSides) const override;
 
    private:
     EigenLinearEquationSolverMethod getMethod(Environment const& env, bool isExactMode) const;
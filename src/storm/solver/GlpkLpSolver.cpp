@@ -445,6 +445,17 @@ void GlpkLpSolver<ValueType, RawMode>::writeModelToFile(std::string const& filen
     glp_write_lp(this->lp, 0, filename.c_str());
 }
 
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    glp_set_obj_coef(this->lp, variableToIndexMap.at(variable), storm::utility::convertNumber<double>(objectiveFunctionCoefficient));
+    this->currentModelHasBeenOptimized = false;
+}
+
+template<typename ValueType, bool RawMode>
+bool GlpkLpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return true;
+}
+
 template<typename ValueType, bool RawMode>
 void GlpkLpSolver<ValueType, RawMode>::push() {
     if constexpr (RawMode) {
@@ -87,6 +87,9 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
     // Methods to print the LP problem to a file.
     virtual void writeModelToFile(std::string const& filename) const override;
 
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
+    virtual bool supportsObjectiveFunctionCoefficientChanges() const override;
+
     virtual void push() override;
     virtual void pop() override;
 
@@ -201,6 +204,11 @@ class GlpkLpSolver : public LpSolver {
                                                               "requires this support. Please choose a version of support with glpk support.";
     }
 
+    virtual void setObjectiveFunctionCoefficient(Variable const&, ValueType const&) override {
+        throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for glpk. Yet, a method was called that "
+                                                              "requires this support. Please choose a version of support with glpk support.";
+    }
+
     virtual void push() override {
         throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for glpk. Yet, a method was called that "
                                                               "requires this support. Please choose a version of support with glpk support.";
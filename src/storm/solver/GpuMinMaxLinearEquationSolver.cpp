@@ -0,0 +1,265 @@
+#include "storm/solver/GpuMinMaxLinearEquationSolver.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm-config.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+#ifdef STORM_HAVE_CUDA
+#include "cudaForStorm.h"
+#endif
+
+namespace storm {
+namespace solver {
+
+namespace {
+// Consecutive SCCs are merged into blocks of at least this many row groups, as each block costs at least two kernel launches and a
+// synchronization with the host.
+uint64_t const MinimalBlockSize = 1024;
+}  // namespace
+
+template<typename ValueType>
+GpuMinMaxLinearEquationSolver<ValueType>::GpuMinMaxLinearEquationSolver() {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+GpuMinMaxLinearEquationSolver<ValueType>::GpuMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A)
+    : StandardMinMaxLinearEquationSolver<ValueType>(A) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+GpuMinMaxLinearEquationSolver<ValueType>::GpuMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A)
+    : StandardMinMaxLinearEquationSolver<ValueType>(std::move(A)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+GpuMinMaxLinearEquationSolver<ValueType>::~GpuMinMaxLinearEquationSolver() {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void GpuMinMaxLinearEquationSolver<ValueType>::DeviceSystemDeleter::operator()(DeviceValueIterationSystem* system) const {
+#ifdef STORM_HAVE_CUDA
+    deviceValueIteration_destroySystem(system);
+#else
+    STORM_LOG_ASSERT(system == nullptr, "Device system exists although storm is compiled without CUDA support.");
+#endif
+}
+
+template<typename ValueType>
+bool GpuMinMaxLinearEquationSolver<ValueType>::isIntervalIterationUsed(Environment const& env) const {
+    return env.solver().isForceSoundness();
+}
+
+template<typename ValueType>
+void GpuMinMaxLinearEquationSolver<ValueType>::createDeviceSystem() const {
+#ifdef STORM_HAVE_CUDA
+    STORM_LOG_THROW(this->A->getColumnCount() <= std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException,
+                    "The GPU solver does not support equation systems with more than " << std::numeric_limits<uint32_t>::max() << " row groups.");
+
+    // Order the row groups such that the SCCs are consecutive and appear in topological order, i.e., the entries of an SCC only refer to
+    // row groups of the same SCC or of earlier SCCs.
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    rowGroupOrder.clear();
+    rowGroupOrder.reserve(this->A->getRowGroupCount());
+    blockStarts.assign(1, 0);
+    for (auto const& scc : sccDecomposition) {
+        rowGroupOrder.insert(rowGroupOrder.end(), scc.begin(), scc.end());
+        if (rowGroupOrder.size() - blockStarts.back() >= MinimalBlockSize) {
+            blockStarts.push_back(rowGroupOrder.size());
+        }
+    }
+    if (blockStarts.back() != rowGroupOrder.size()) {
+        blockStarts.push_back(rowGroupOrder.size());
+    }
+    STORM_LOG_ASSERT(rowGroupOrder.size() == this->A->getRowGroupCount(), "The SCC decomposition does not cover all row groups.");
+    std::vector<uint32_t> newRowGroupIndex(rowGroupOrder.size());
+    for (uint64_t newGroup = 0; newGroup < rowGroupOrder.size(); ++newGroup) {
+        newRowGroupIndex[rowGroupOrder[newGroup]] = static_cast<uint32_t>(newGroup);
+    }
+
+    // Create the reordered matrix with separate arrays for the columns and values of the entries.
+    std::vector<uint64_t> rowIndications, rowGroupIndices;
+    std::vector<uint32_t> columns;
+    std::vector<double> values;
+    rowIndications.reserve(this->A->getRowCount() + 1);
+    rowGroupIndices.reserve(this->A->getRowGroupCount() + 1);
+    columns.reserve(this->A->getEntryCount());
+    values.reserve(this->A->getEntryCount());
+    rowIndications.push_back(0);
+    rowGroupIndices.push_back(0);
+    auto const& originalRowGroupIndices = this->A->getRowGroupIndices();
+    for (auto group : rowGroupOrder) {
+        for (uint64_t row = originalRowGroupIndices[group]; row < originalRowGroupIndices[group + 1]; ++row) {
+            for (auto const& entry : this->A->getRow(row)) {
+                columns.push_back(newRowGroupIndex[entry.getColumn()]);
+                values.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+            }
+            rowIndications.push_back(columns.size());
+        }
+        rowGroupIndices.push_back(rowIndications.size() - 1);
+    }
+
+    size_t const requiredMemory = deviceValueIteration_getRequiredMemory(this->A->getRowCount(), this->A->getRowGroupCount(), this->A->getEntryCount());
+    size_t const freeMemory = getFreeCudaMemory();
+    STORM_LOG_THROW(requiredMemory <= freeMemory, storm::exceptions::NotSupportedException,
+                    "The equation system requires " << requiredMemory << " bytes of device memory, but only " << freeMemory << " bytes are free.");
+    deviceSystem.reset(deviceValueIteration_createSystem(this->A->getRowCount(), this->A->getRowGroupCount(), this->A->getEntryCount(), rowIndications.data(),
+                                                         columns.data(), values.data(), rowGroupIndices.data()));
+    STORM_LOG_THROW(deviceSystem, storm::exceptions::InvalidStateException,
+                    "Could not upload the equation system to the device: " << deviceValueIteration_getLastError() << ".");
+    STORM_LOG_INFO("Uploaded equation system with " << this->A->getRowGroupCount() << " row groups in " << blockStarts.size() - 1 << " blocks ("
+                                                    << sccDecomposition.size() << " SCCs) to the device.");
+#endif
+}
+
+template<typename ValueType>
+void GpuMinMaxLinearEquationSolver<ValueType>::reorderRowGroupVector(std::vector<ValueType> const& original, std::vector<ValueType>& reordered) const {
+    reordered.resize(rowGroupOrder.size());
+    for (uint64_t newGroup = 0; newGroup < rowGroupOrder.size(); ++newGroup) {
+        reordered[newGroup] = original[rowGroupOrder[newGroup]];
+    }
+}
+
+template<typename ValueType>
+bool GpuMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                      std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_CUDA
+    STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
+    STORM_LOG_ASSERT(b.size() == this->A->getRowCount(), "Provided b-vector has invalid size.");
+    STORM_LOG_WARN_COND(!this->choiceFixedForRowGroup, "The GPU solver ignores choices that are fixed for row groups.");
+    if (!deviceSystem) {
+        createDeviceSystem();
+    }
+    bool const intervalIteration = isIntervalIterationUsed(env);
+
+    // Upload the right-hand side.
+    auxiliaryRowVector.resize(this->A->getRowCount());
+    auto auxiliaryRowIt = auxiliaryRowVector.begin();
+    for (auto group : rowGroupOrder) {
+        auxiliaryRowIt = std::copy(b.begin() + this->A->getRowGroupIndices()[group], b.begin() + this->A->getRowGroupIndices()[group + 1], auxiliaryRowIt);
+    }
+    STORM_LOG_THROW(deviceValueIteration_setOffsets(deviceSystem.get(), auxiliaryRowVector.data()), storm::exceptions::InvalidStateException,
+                    "Could not upload the right-hand side to the device: " << deviceValueIteration_getLastError() << ".");
+
+    // Upload the initial values. Value iteration approaches the solution from below (above) when maximizing (minimizing).
+    if (intervalIteration) {
+        this->createLowerBoundsVector(x);
+        reorderRowGroupVector(x, auxiliaryLowerRowGroupVector);
+        this->createUpperBoundsVector(x);
+        reorderRowGroupVector(x, auxiliaryUpperRowGroupVector);
+    } else {
+        if (!this->hasUniqueSolution()) {
+            if (maximize(dir)) {
+                this->createLowerBoundsVector(x);
+            } else {
+                this->createUpperBoundsVector(x);
+            }
+        }
+        reorderRowGroupVector(x, auxiliaryLowerRowGroupVector);
+    }
+    STORM_LOG_THROW(deviceValueIteration_setValues(deviceSystem.get(), auxiliaryLowerRowGroupVector.data(),
+                                                   intervalIteration ? auxiliaryUpperRowGroupVector.data() : nullptr),
+                    storm::exceptions::InvalidStateException,
+                    "Could not upload the initial values to the device: " << deviceValueIteration_getLastError() << ".");
+
+    // Solve the blocks.
+    uint64_t numIterations{0};
+    bool converged{false};
+    bool const success = deviceValueIteration_solve(
+        deviceSystem.get(), blockStarts.size() - 1, blockStarts.data(), minimize(dir), intervalIteration,
+        storm::utility::convertNumber<double>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(),
+        env.solver().minMax().getMaximalNumberOfIterations(), []() { return storm::utility::resources::isTerminate(); }, &numIterations, &converged);
+    STORM_LOG_THROW(success, storm::exceptions::InvalidStateException,
+                    "An error occurred while solving the equation system on the device: " << deviceValueIteration_getLastError() << ".");
+
+    // Download the result and restore the original order.
+    STORM_LOG_THROW(deviceValueIteration_getValues(deviceSystem.get(), auxiliaryLowerRowGroupVector.data(),
+                                                   intervalIteration ? auxiliaryUpperRowGroupVector.data() : nullptr),
+                    storm::exceptions::InvalidStateException,
+                    "Could not download the result from the device: " << deviceValueIteration_getLastError() << ".");
+    for (uint64_t newGroup = 0; newGroup < rowGroupOrder.size(); ++newGroup) {
+        if (intervalIteration) {
+            x[rowGroupOrder[newGroup]] = (auxiliaryLowerRowGroupVector[newGroup] + auxiliaryUpperRowGroupVector[newGroup]) / 2;
+        } else {
+            x[rowGroupOrder[newGroup]] = auxiliaryLowerRowGroupVector[newGroup];
+        }
+    }
+
+    SolverStatus status = SolverStatus::Converged;
+    if (!converged) {
+        status = storm::utility::resources::isTerminate() ? SolverStatus::Aborted : SolverStatus::MaximalIterationsExceeded;
+    }
+    this->reportStatus(status, numIterations);
+
+    // If requested, we extract the scheduler from the solution.
+    if (this->isTrackSchedulerSet()) {
+        std::vector<ValueType> auxiliaryRowGroupVector(this->A->getRowGroupCount());
+        this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+        this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, auxiliaryRowGroupVector, &this->schedulerChoices.get());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return converged;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without CUDA support.");
+#endif
+}
+
+template<typename ValueType>
+MinMaxLinearEquationSolverRequirements GpuMinMaxLinearEquationSolver<ValueType>::getRequirements(
+    Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
+    MinMaxLinearEquationSolverRequirements requirements;
+    if (isIntervalIterationUsed(env)) {
+        // Interval iteration requires a unique solution and lower+upper bounds
+        if (!this->hasUniqueSolution()) {
+            requirements.requireUniqueSolution();
+        }
+        requirements.requireBounds();
+    } else if (!this->hasUniqueSolution()) {
+        // Computing a scheduler is only possible if the solution is unique
+        if (env.solver().minMax().isForceRequireUnique() || this->isTrackSchedulerSet()) {
+            requirements.requireUniqueSolution();
+        } else {
+            // As we want the smallest (largest) solution for maximizing (minimizing) equation systems, we have to approach the solution from below (above).
+            if (!direction || direction.get() == OptimizationDirection::Maximize) {
+                requirements.requireLowerBounds();
+            }
+            if (!direction || direction.get() == OptimizationDirection::Minimize) {
+                requirements.requireUpperBounds();
+            }
+        }
+    }
+    return requirements;
+}
+
+template<typename ValueType>
+void GpuMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+    deviceSystem.reset();
+    rowGroupOrder.clear();
+    blockStarts.clear();
+    auxiliaryRowVector.clear();
+    auxiliaryLowerRowGroupVector.clear();
+    auxiliaryUpperRowGroupVector.clear();
+    StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
+}
+
+// Explicitly instantiate the min max linear equation solver. The device only supports double precision.
+template class GpuMinMaxLinearEquationSolver<double>;
+}  // namespace solver
+}  // namespace storm
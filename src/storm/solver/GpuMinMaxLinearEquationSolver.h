@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+
+struct DeviceValueIterationSystem;
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * A min-max linear equation solver that performs value iteration on a CUDA device. If sound results are required (see
+ * SolverEnvironment::isForceSoundness), interval iteration is performed instead.
+ *
+ * The SCCs of the system are sorted topologically and consecutive SCCs are merged into blocks that are solved one after another. The system is
+ * reordered accordingly and uploaded to the device once. It stays resident until the cache of the solver is cleared, so all blocks and all
+ * subsequent calls to solveEquations (e.g. with different right-hand sides or optimization directions) use the same copy of the matrix.
+ */
+template<typename ValueType>
+class GpuMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<ValueType> {
+   public:
+    GpuMinMaxLinearEquationSolver();
+    GpuMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
+    GpuMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+
+    virtual ~GpuMinMaxLinearEquationSolver();
+
+    virtual void clearCache() const override;
+
+    virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env,
+                                                                   boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none,
+                                                                   bool const& hasInitialScheduler = false) const override;
+
+   protected:
+    virtual bool internalSolveEquations(storm::Environment const& env, OptimizationDirection d, std::vector<ValueType>& x,
+                                        std::vector<ValueType> const& b) const override;
+
+   private:
+    struct DeviceSystemDeleter {
+        void operator()(DeviceValueIterationSystem* system) const;
+    };
+
+    // Whether interval iteration is performed (instead of value iteration).
+    bool isIntervalIterationUsed(Environment const& env) const;
+
+    // Reorders the system according to the topological order of its SCCs and uploads it to the device.
+    void createDeviceSystem() const;
+
+    // Copies the given vector (in the order of the original row groups) into the given vector in the order of the device system.
+    void reorderRowGroupVector(std::vector<ValueType> const& original, std::vector<ValueType>& reordered) const;
+
+    // The system in device memory.
+    mutable std::unique_ptr<DeviceValueIterationSystem, DeviceSystemDeleter> deviceSystem;
+    // The i-th row group of the device system is the rowGroupOrder[i]-th row group of the original system.
+    mutable std::vector<uint64_t> rowGroupOrder;
+    // The first row group of each block of the device system, followed by the number of row groups.
+    mutable std::vector<uint64_t> blockStarts;
+
+    // Auxiliary vectors in the order of the device system.
+    mutable std::vector<ValueType> auxiliaryRowVector;            // A.rowCount() entries
+    mutable std::vector<ValueType> auxiliaryLowerRowGroupVector;  // A.rowGroupCount() entries
+    mutable std::vector<ValueType> auxiliaryUpperRowGroupVector;  // A.rowGroupCount() entries, only used for interval iteration
+};
+}  // namespace solver
+}  // namespace storm
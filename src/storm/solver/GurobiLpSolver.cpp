@@ -504,6 +504,26 @@ void GurobiLpSolver<ValueType, RawMode>::writeModelToFile(std::string const& fil
     }
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    int varIndex;
+    if constexpr (RawMode) {
+        varIndex = variable;
+    } else {
+        STORM_LOG_ASSERT(variableToIndexMap.count(variable) != 0, "Changing the objective coefficient of unknown variable '" << variable.getName() << "'.");
+        varIndex = variableToIndexMap.at(variable);
+    }
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_OBJ, varIndex, storm::utility::convertNumber<double>(objectiveFunctionCoefficient));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi objective coefficient (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    this->currentModelHasBeenOptimized = false;
+}
+
+template<typename ValueType, bool RawMode>
+bool GurobiLpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return true;
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::push() {
     IncrementalLevel lvl;
@@ -847,6 +867,17 @@ void GurobiLpSolver<ValueType, RawMode>::writeModelToFile(std::string const&) co
                                                           "requires this support. Please choose a version of support with Gurobi support.";
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+bool GurobiLpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return false;
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::push() {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
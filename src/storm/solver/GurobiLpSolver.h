@@ -117,6 +117,9 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
     // Methods to print the LP problem to a file.
     virtual void writeModelToFile(std::string const& filename) const override;
 
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
+    virtual bool supportsObjectiveFunctionCoefficientChanges() const override;
+
     virtual void push() override;
     virtual void pop() override;
 
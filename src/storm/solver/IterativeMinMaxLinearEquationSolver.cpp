@@ -1,15 +1,21 @@
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
+#include "storm/adapters/HybridRationalNumber.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/ConvergenceTelemetry.h"
+#include "storm/solver/SolverCheckpoint.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/PolicyEvaluationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SchedulerTrackingHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
@@ -54,10 +60,12 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
 
     if (isExactMode && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::ViToPi) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
-            STORM_LOG_INFO(
-                "Selecting 'Policy iteration' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
-                "different method.");
-            method = MinMaxMethod::PolicyIteration;
+            // If the solution is unique, a scheduler obtained via (floating point) value iteration is typically (close to) optimal so that policy iteration
+            // only needs to solve very few equation systems exactly. Otherwise, we stick to plain policy iteration as it has weaker requirements.
+            method = this->hasUniqueSolution() ? MinMaxMethod::ViToPi : MinMaxMethod::PolicyIteration;
+            STORM_LOG_INFO("Selecting '" << toString(method)
+                                         << "' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
+                                            "different method.");
         } else {
             STORM_LOG_WARN("The selected solution method " << toString(method) << " does not guarantee exact results.");
         }
@@ -220,12 +228,43 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     }
     storm::Environment const& environmentOfSolver = environmentOfSolverStorage ? *environmentOfSolverStorage : env;
 
+    // Policies may also be evaluated directly on the rows of A (instead of building the induced equation system).
+    auto evaluationMethod = env.solver().minMax().getPolicyEvaluationMethod();
+    if (storm::NumberTraits<ValueType>::IsExact && evaluationMethod != PolicyEvaluationMethod::LinearEquationSolver) {
+        STORM_LOG_WARN("Policy evaluation method '" << toString(evaluationMethod) << "' is not available for exact computations. Falling back to '"
+                                                    << toString(PolicyEvaluationMethod::LinearEquationSolver) << "'.");
+        evaluationMethod = PolicyEvaluationMethod::LinearEquationSolver;
+    }
+    std::unique_ptr<helper::PolicyEvaluationHelper<ValueType>> evaluationHelper;
+    ValueType const evaluationPrecision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+    if constexpr (!storm::NumberTraits<ValueType>::IsExact) {
+        if (evaluationMethod != PolicyEvaluationMethod::LinearEquationSolver) {
+            evaluationHelper = std::make_unique<helper::PolicyEvaluationHelper<ValueType>>(*this->A, env.solver().getNumberOfThreads());
+        }
+    }
+
     SolverStatus status = SolverStatus::InProgress;
     uint64_t iterations = 0;
     this->startMeasureProgress();
     do {
-        // Solve the equation system for the 'DTMC'.
-        solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        // Evaluate the current policy, i.e., solve (or approximate the solution of) the equation system for the 'DTMC'.
+        bool evaluated = false;
+        // Whether the values of the policy are known precisely enough to stop once the policy does not improve.
+        bool valuesConverged = true;
+        if constexpr (!storm::NumberTraits<ValueType>::IsExact) {
+            if (evaluationMethod == PolicyEvaluationMethod::Bicgstab) {
+                evaluated = evaluationHelper->solveWithBicgstab(scheduler, x, b, evaluationPrecision, env.solver().minMax().getMaximalNumberOfIterations());
+                STORM_LOG_WARN_COND(evaluated, "BiCGSTAB failed to evaluate the policy. Falling back to the linear equation solver.");
+            } else if (evaluationMethod == PolicyEvaluationMethod::ValueIterationSweeps) {
+                ValueType change = evaluationHelper->performSweeps(scheduler, x, b, env.solver().minMax().getNumberOfPolicyEvaluationSweeps(), relative);
+                valuesConverged = change <= evaluationPrecision;
+                evaluated = true;
+            }
+        }
+        if (!evaluated) {
+            solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        }
 
         // Go through the multiplication result and see whether we can improve any of the choices.
         bool schedulerImproved = false;
@@ -259,8 +298,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
             }
         }
 
-        // If the scheduler did not improve, we are done.
-        if (!schedulerImproved) {
+        // If the scheduler did not improve (and its values are precise), we are done.
+        if (!schedulerImproved && valuesConverged) {
             status = SolverStatus::Converged;
         }
 
@@ -405,6 +444,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
     }
 
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 
     helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
@@ -442,10 +482,114 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+void IterativeMinMaxLinearEquationSolver<ValueType>::performSinglePrecisionValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                          std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                                          uint64_t& numIterations) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        // The single precision operator converts the entries of the matrix while importing it, so no converted copy of the matrix is built.
+        auto singlePrecisionOperator = std::make_shared<helper::ValueIterationOperator<float, false>>();
+        singlePrecisionOperator->setConvertedMatrixBackwards(*this->A, &this->A->getRowGroupIndices());
+        if (this->choiceFixedForRowGroup) {
+            // Ignore those rows that are not selected
+            assert(this->initialScheduler);
+            singlePrecisionOperator->setIgnoredRows(true, [&](uint64_t groupIndex, uint64_t localRowIndex) {
+                return this->choiceFixedForRowGroup->get(groupIndex) && this->initialScheduler->at(groupIndex) != localRowIndex;
+            });
+        }
+        singlePrecisionOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
+        std::vector<float> singlePrecisionX(x.begin(), x.end());
+        std::vector<float> singlePrecisionB(b.begin(), b.end());
+
+        // Differences below a small multiple of the machine epsilon can not be resolved in single precision. We therefore stop at a relative
+        // precision that single precision iterations can reach (unless less precision is requested anyway) and refine the result afterwards.
+        float const singlePrecision = std::max(static_cast<float>(storm::utility::convertNumber<double>(env.solver().minMax().getPrecision())), 1e-5f);
+        uint64_t const maxIterations = env.solver().minMax().getMaximalNumberOfIterations();
+        auto callback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return numIterations >= maxIterations ? SolverStatus::MaximalIterationsExceeded : current;
+        };
+        helper::ValueIterationHelper<float, false> viHelper(singlePrecisionOperator);
+        auto status = viHelper.VI(singlePrecisionX, singlePrecisionB, numIterations, true, singlePrecision, dir, callback,
+                                  env.solver().minMax().getMultiplicationStyle());
+        if (std::all_of(singlePrecisionX.begin(), singlePrecisionX.end(), [](float const& value) { return std::isfinite(value); })) {
+            std::copy(singlePrecisionX.begin(), singlePrecisionX.end(), x.begin());
+            STORM_LOG_INFO("Single precision value iteration " << (status == SolverStatus::Converged ? "converged" : "stopped") << " after " << numIterations
+                                                                << " iterations. Refining the result in double precision.");
+        } else {
+            STORM_LOG_WARN("Single precision value iteration produced values that are not representable. Discarding its result.");
+        }
+    } else {
+        STORM_LOG_ASSERT(false, "Single precision value iteration requires a double precision equation system.");
+    }
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsHybridRationalValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                              std::vector<ValueType>& x,
+                                                                                              std::vector<ValueType> const& b) const {
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        if (!hybridViOperator) {
+            // The operator converts the entries of the matrix while importing it, so no converted copy of the matrix is built.
+            hybridViOperator = std::make_shared<helper::ValueIterationOperator<storm::HybridRationalNumber, false>>();
+            hybridViOperator->setConvertedMatrixBackwards(*this->A, &this->A->getRowGroupIndices());
+        }
+        hybridViOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
+        std::vector<storm::HybridRationalNumber> hybridX, hybridB;
+        hybridX.reserve(x.size());
+        for (auto const& value : x) {
+            hybridX.emplace_back(value);
+        }
+        hybridB.reserve(b.size());
+        for (auto const& value : b) {
+            hybridB.emplace_back(value);
+        }
+
+        uint64_t numIterations{0};
+        uint64_t const maxIterations = env.solver().minMax().getMaximalNumberOfIterations();
+        auto callback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, false, numIterations, maxIterations);
+        };
+        this->startMeasureProgress();
+        helper::ValueIterationHelper<storm::HybridRationalNumber, false> viHelper(hybridViOperator);
+        auto status = viHelper.VI(hybridX, hybridB, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                  storm::utility::convertNumber<storm::HybridRationalNumber>(env.solver().minMax().getPrecision()), dir, callback,
+                                  env.solver().minMax().getMultiplicationStyle());
+        for (uint64_t i = 0; i < x.size(); ++i) {
+            x[i] = hybridX[i].toRationalNumber();
+        }
+        this->reportStatus(status, numIterations);
+
+        // If requested, we store the scheduler for retrieval.
+        if (this->isTrackSchedulerSet()) {
+            setUpViOperator();
+            this->extractScheduler(x, b, dir);
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    } else {
+        STORM_LOG_ASSERT(false, "Hybrid rational value iteration requires a rational equation system.");
+        return false;
+    }
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                                   std::vector<ValueType> const& b) const {
+    // Exact value iteration mostly operates on small fractions, for which the hybrid representation avoids big number arithmetic. As the
+    // termination condition and the initial scheduler operate on the original representation, these are handled by the regular iterations.
+    if (std::is_same_v<ValueType, storm::RationalNumber> && !this->hasInitialScheduler() && this->hasUniqueSolution() &&
+        !this->hasCustomTerminationCondition() && !env.solver().getConvergenceTelemetry()) {
+        return solveEquationsHybridRationalValueIteration(env, dir, x, b);
+    }
+
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
@@ -501,11 +645,35 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
 
     storm::solver::helper::ValueIterationHelper<ValueType, false> viHelper(viOperator);
     uint64_t numIterations{0};
+    this->startMeasureProgress();
+    if (env.solver().minMax().isMixedPrecision()) {
+        // Iterates that are computed in single precision may violate the guarantee (e.g. be larger than the least fixed point), so the
+        // single precision iterations are only performed if the solution is unique and no guarantee is required.
+        if (std::is_same_v<ValueType, double> && guarantee == SolverGuarantee::None) {
+            performSinglePrecisionValueIteration(env, dir, x, b, numIterations);
+        } else {
+            STORM_LOG_WARN("Mixed precision value iteration is only supported for double precision equation systems with a unique solution. Falling back "
+                           "to value iteration in the original precision.");
+        }
+    }
+    ConvergenceTelemetryRecorder<ValueType> telemetry(env, "value iteration");
+    SolverCheckpointRecorder<ValueType> checkpoints(env, "value iteration");
+    checkpoints.restore(x, numIterations);
+    uint64_t const firstIteration = numIterations;
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
+        if (telemetry.isIterationRelevant(numIterations)) {
+            // With regular multiplication, the iterates of odd iterations are stored in the auxiliary vector of the operator.
+            bool inAuxiliaryVector = env.solver().minMax().getMultiplicationStyle() == MultiplicationStyle::Regular && numIterations % 2 == 1;
+            telemetry.recordIteration(numIterations, inAuxiliaryVector ? viOperator->getAuxiliaryVector() : x);
+        }
+        if (checkpoints.isCheckpointDue()) {
+            bool inAuxiliaryVector =
+                env.solver().minMax().getMultiplicationStyle() == MultiplicationStyle::Regular && (numIterations - firstIteration) % 2 == 1;
+            checkpoints.checkpoint(numIterations, inAuxiliaryVector ? viOperator->getAuxiliaryVector() : x);
+        }
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
     };
-    this->startMeasureProgress();
     auto status = viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
                               storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), dir, viCallback,
                               env.solver().minMax().getMultiplicationStyle());
@@ -539,14 +707,19 @@ template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir,
                                                                                      std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
     helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
     auto upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
 
     uint64_t numIterations{0};
+    ConvergenceTelemetryRecorder<ValueType> telemetry(env, "interval iteration");
     auto iiCallback = [&](helper::IIData<ValueType> const& data) {
         this->showProgressIterative(numIterations);
+        if (telemetry.isIterationRelevant(numIterations)) {
+            telemetry.recordIteration(numIterations, data.x, ConvergenceTelemetryRecorder<ValueType>::computeBoundGap(data.x, data.y));
+        }
         bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                               this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
         return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
@@ -555,9 +728,24 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
     if (this->hasRelevantValues()) {
         optionalRelevantValues = this->getRelevantValues();
     }
+    auto decisionCondition = this->hasCustomTerminationCondition()
+                                 ? dynamic_cast<TerminateIfAllStatesDecided<ValueType> const*>(&this->getTerminationCondition())
+                                 : nullptr;
     this->startMeasureProgress();
-    auto status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback, dir,
-                              iiCallback, optionalRelevantValues);
+    SolverStatus status;
+    if (decisionCondition && !this->choiceFixedForRowGroup && !this->isTrackSchedulerSet()) {
+        // Each state is compared with a threshold, so states can be dropped from the iteration as soon as their comparison is decided.
+        auto isDecided = [decisionCondition](ValueType const& lower, ValueType const& upper) { return decisionCondition->isDecided(lower, upper); };
+        auto decisionCallback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, false, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+        };
+        status = iiHelper.IIWithDecisions(x, *this->A, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, isDecided,
+                                          lowerBoundsCallback, upperBoundsCallback, dir, decisionCallback, decisionCondition->getFilter());
+    } else {
+        status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback, dir,
+                             iiCallback, optionalRelevantValues);
+    }
     this->reportStatus(status, numIterations);
 
     // If requested, we store the scheduler for retrieval.
@@ -587,11 +775,22 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
     }
 
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 
     auto precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     uint64_t numIterations{0};
+    ConvergenceTelemetryRecorder<ValueType> telemetry(env, "sound value iteration");
     auto sviCallback = [&](typename helper::SoundValueIterationHelper<ValueType, false>::SVIData const& current) {
         this->showProgressIterative(numIterations);
+        if (telemetry.isIterationRelevant(numIterations)) {
+            if (current.a && current.b) {
+                std::vector<ValueType> lower(current.xy.first.size()), upper(current.xy.first.size());
+                current.trySetLowerUpper(lower, upper);
+                telemetry.recordIteration(numIterations, lower, ConvergenceTelemetryRecorder<ValueType>::computeBoundGap(lower, upper));
+            } else {
+                telemetry.recordIteration(numIterations, current.xy.first);
+            }
+        }
         return this->updateStatus(current.status,
                                   this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
                                   numIterations, env.solver().minMax().getMaximalNumberOfIterations());
@@ -627,6 +826,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsViToPi(Enviro
     {
         Environment viEnv = env;
         viEnv.solver().minMax().setMethod(MinMaxMethod::ValueIteration);
+        // The values of the imprecise solver are only used to obtain the scheduler. Exactness is guaranteed by the subsequent policy iteration.
+        viEnv.solver().setForceExact(false);
         auto impreciseSolver = GeneralMinMaxLinearEquationSolverFactory<double>().create(viEnv, this->A->template toValueType<double>());
         impreciseSolver->setHasUniqueSolution(this->hasUniqueSolution());
         impreciseSolver->setTrackScheduler(true);
@@ -650,6 +851,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearc
                                                                                   std::vector<ValueType> const& b) const {
     // Set up two value iteration operators. One for exact and one for imprecise computations
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
     std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, false>> exactOp;
     std::shared_ptr<helper::ValueIterationOperator<double, false>> impreciseOp;
     std::function<bool(uint64_t, uint64_t)> fixedChoicesCallback;
@@ -704,6 +906,7 @@ template<typename ValueType>
 void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     auxiliaryRowGroupVector.reset();
     viOperator.reset();
+    hybridViOperator.reset();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -47,6 +47,10 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
     bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    void performSinglePrecisionValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                              uint64_t& numIterations) const;
+    bool solveEquationsHybridRationalValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                    std::vector<ValueType> const& b) const;
     bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                 std::vector<ValueType> const& b) const;
     bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -65,6 +69,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     // possibly cached data
     mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false>> viOperator;
+    // The operator for exact value iteration, which stores small fractions inline (only used for rational numbers).
+    mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<storm::HybridRationalNumber, false>> hybridViOperator;
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
 };
 
@@ -32,6 +32,42 @@ bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std
     return this->internalSolveEquations(env, x, b);
 }
 
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                     uint64_t numberOfRightHandSides) const {
+    STORM_LOG_ASSERT(X.size() == this->getMatrixRowCount() * numberOfRightHandSides, "Provided X-vector has invalid size.");
+    STORM_LOG_ASSERT(B.size() == this->getMatrixRowCount() * numberOfRightHandSides, "Provided B-vector has invalid size.");
+    if (numberOfRightHandSides == 1) {
+        return this->internalSolveEquations(env, X, B);
+    }
+    return this->internalSolveMultipleEquations(env, X, B, numberOfRightHandSides);
+}
+
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                                     uint64_t numberOfRightHandSides) const {
+    // Whatever the solver derives from the matrix is computed only once for all right-hand sides.
+    bool const cachingWasEnabled = this->isCachingEnabled();
+    this->setCachingEnabled(true);
+
+    uint64_t const numberOfRows = this->getMatrixRowCount();
+    std::vector<ValueType> x(numberOfRows), b(numberOfRows);
+    bool result = true;
+    for (uint64_t lane = 0; lane < numberOfRightHandSides; ++lane) {
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            x[row] = X[row * numberOfRightHandSides + lane];
+            b[row] = B[row * numberOfRightHandSides + lane];
+        }
+        result &= this->internalSolveEquations(env, x, b);
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            X[row * numberOfRightHandSides + lane] = x[row];
+        }
+    }
+
+    this->setCachingEnabled(cachingWasEnabled);
+    return result;
+}
+
 template<typename ValueType>
 LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
     return LinearEquationSolverRequirements();
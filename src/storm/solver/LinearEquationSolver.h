@@ -48,6 +48,19 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves the equation system (see the other variant of <code>solveEquations</code>) for several right-hand sides at once. The vectors are
+     * stored interleaved, i.e., the entry of row i for the j-th right-hand side is at position i * numberOfRightHandSides + j. Depending on
+     * the solver, this allows to reuse a factorization of the matrix or to update all solutions within one pass over the matrix.
+     *
+     * @param X The solution vectors that have to be computed. For iterative solvers, they also serve as initial guesses.
+     * @param B The right-hand sides.
+     * @param numberOfRightHandSides The number of right-hand sides. Both X and B need to have this many entries per row of A.
+     *
+     * @return true iff all equation systems were solved successfully.
+     */
+    bool solveEquations(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B, uint64_t numberOfRightHandSides) const;
+
     /*!
      * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
      * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -79,6 +92,13 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves the equation system for several (interleaved) right-hand sides. The default implementation solves the systems one after another
+     * while the cache of the solver is enabled.
+     */
+    virtual bool internalSolveMultipleEquations(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                uint64_t numberOfRightHandSides) const;
+
     // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
     mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
 
@@ -1,10 +1,12 @@
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
 
+#include <limits>
+#include <optional>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
-#include "storm/storage/expressions/RationalLiteralExpression.h"
-#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/expressions/BinaryRelationType.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -37,43 +39,38 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException,
                     "This min max solver does not support the selected technique.");
 
-    // Set up the LP solver
-    std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
+    // Set up the LP solver. We use the raw mode of the solver, i.e., constraints are given as coefficient vectors over variable indices. This avoids
+    // building (and afterwards decomposing) an expression for every choice, which dominates the runtime for large systems.
+    std::unique_ptr<storm::solver::LpSolver<ValueType, true>> solver = lpSolverFactory->createRaw("");
     solver->setOptimizationDirection(invert(dir));
-    // Create a variable for each row group
-    std::vector<storm::expressions::Expression> variableExpressions;
-    variableExpressions.reserve(this->A->getRowGroupCount());
+    // Create a variable for each row group. Row groups whose value is fixed by the bounds are represented by their value instead.
+    uint64_t const noVariable = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> variableIndices(this->A->getRowGroupCount(), noVariable);
+    std::vector<ValueType> fixedValues(this->A->getRowGroupCount(), storm::utility::zero<ValueType>());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+        std::optional<ValueType> lowerBound, upperBound;
         if (this->hasLowerBound()) {
-            ValueType lowerBound = this->getLowerBound(rowGroup);
-            if (this->hasUpperBound()) {
-                ValueType upperBound = this->getUpperBound(rowGroup);
-                if (lowerBound == upperBound) {
-                    // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
-                    // efficient anyways.
-                    variableExpressions.push_back(solver->getConstant(lowerBound));
-                } else {
-                    STORM_LOG_ASSERT(lowerBound <= upperBound,
-                                     "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
-                    variableExpressions.emplace_back(
-                        solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
-                }
-            } else {
-                variableExpressions.emplace_back(
-                    solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
-            }
+            lowerBound = this->getLowerBound(rowGroup);
+        }
+        if (this->hasUpperBound()) {
+            upperBound = this->getUpperBound(rowGroup);
+        }
+        if (lowerBound && upperBound && *lowerBound == *upperBound) {
+            // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
+            // efficient anyways.
+            fixedValues[rowGroup] = *lowerBound;
         } else {
-            if (this->upperBound) {
-                variableExpressions.emplace_back(
-                    solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
-            } else {
-                variableExpressions.emplace_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
-            }
+            STORM_LOG_ASSERT(!lowerBound || !upperBound || *lowerBound <= *upperBound,
+                             "Lower Bound at row group " << rowGroup << " is " << *lowerBound << " which exceeds the upper bound " << *upperBound << ".");
+            variableIndices[rowGroup] =
+                solver->addContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>());
         }
     }
     solver->update();
 
     // Add a constraint for each row
+    storm::expressions::RelationType relationType =
+        minimize(dir) ? storm::expressions::RelationType::LessOrEqual : storm::expressions::RelationType::GreaterOrEqual;
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
         // The rowgroup refers to the state number
         uint64_t rowIndex, rowGroupEnd;
@@ -85,20 +82,28 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
             rowGroupEnd = this->A->getRowGroupIndices()[rowGroup + 1];
         }
         for (; rowIndex < rowGroupEnd; ++rowIndex) {
+            // The constraint is x_rowGroup - sum_j A_{rowIndex,j} * x_j ~ b_rowIndex, where the variables of some row groups are replaced by their values.
             auto row = this->A->getRow(rowIndex);
-            std::vector<storm::expressions::Expression> summands;
-            summands.reserve(1 + row.getNumberOfEntries());
-            summands.push_back(solver->getConstant(b[rowIndex]));
+            storm::solver::RawLpConstraint<ValueType> rowConstraint(relationType, b[rowIndex], 1 + row.getNumberOfEntries());
+            ValueType selfCoefficient = storm::utility::one<ValueType>();
             for (auto const& entry : row) {
-                summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                if (entry.getColumn() == rowGroup) {
+                    // Some solvers do not allow multiple coefficients for the same variable, so the diagonal entry is merged.
+                    selfCoefficient -= entry.getValue();
+                } else if (variableIndices[entry.getColumn()] == noVariable) {
+                    rowConstraint.rhs += entry.getValue() * fixedValues[entry.getColumn()];
+                } else {
+                    rowConstraint.addToLhs(variableIndices[entry.getColumn()], -entry.getValue());
+                }
+            }
+            if (variableIndices[rowGroup] == noVariable) {
+                rowConstraint.rhs -= selfCoefficient * fixedValues[rowGroup];
+            } else if (!storm::utility::isZero(selfCoefficient)) {
+                rowConstraint.addToLhs(variableIndices[rowGroup], selfCoefficient);
             }
-            storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
-            if (minimize(dir)) {
-                rowConstraint = variableExpressions[rowGroup] <= rowConstraint;
-            } else {
-                rowConstraint = variableExpressions[rowGroup] >= rowConstraint;
+            if (!rowConstraint.lhsVariableIndices.empty()) {
+                solver->addConstraint("", rowConstraint);
             }
-            solver->addConstraint("", rowConstraint);
         }
     }
 
@@ -109,16 +114,12 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
 
     // write the solution into the solution vector
-    STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
-    auto xIt = x.begin();
-    auto vIt = variableExpressions.begin();
-    for (; xIt != x.end(); ++xIt, ++vIt) {
-        auto const& vBaseExpr = vIt->getBaseExpression();
-        if (vBaseExpr.isVariable()) {
-            *xIt = solver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
+    STORM_LOG_ASSERT(x.size() == variableIndices.size(), "Dimension of x-vector does not match number of varibales.");
+    for (uint64_t rowGroup = 0; rowGroup < x.size(); ++rowGroup) {
+        if (variableIndices[rowGroup] == noVariable) {
+            x[rowGroup] = fixedValues[rowGroup];
         } else {
-            STORM_LOG_ASSERT(vBaseExpr.isRationalLiteralExpression(), "Variable expression has unexpected type.");
-            *xIt = storm::utility::convertNumber<ValueType>(vBaseExpr.asRationalLiteralExpression().getValue());
+            x[rowGroup] = solver->getContinuousValue(variableIndices[rowGroup]);
         }
     }
 
@@ -6,6 +6,8 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
 namespace solver {
 
@@ -114,6 +116,16 @@ typename LpSolver<ValueType, RawMode>::Constant LpSolver<ValueType, RawMode>::ge
     }
 }
 
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This LP solver does not support changing objective function coefficients.");
+}
+
+template<typename ValueType, bool RawMode>
+bool LpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return false;
+}
+
 template<typename ValueType, bool RawMode>
 void LpSolver<ValueType, RawMode>::setOptimizationDirection(OptimizationDirection const& optimizationDirection) {
     if (optimizationDirection != this->optimizationDirection) {
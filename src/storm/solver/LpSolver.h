@@ -229,6 +229,21 @@ class LpSolver {
     virtual Variable addVariable(std::string const& name, VariableType const& type, std::optional<ValueType> const& lowerBound = std::nullopt,
                                  std::optional<ValueType> const& upperBound = std::nullopt, ValueType objectiveFunctionCoefficient = 0) = 0;
 
+    /*!
+     * Changes the coefficient with which the given variable appears in the objective function. As the remaining model is kept
+     * intact, the solver can reuse information from previous optimizations, e.g., the previous solution as start solution of a MILP.
+     * This is only possible if supportsObjectiveFunctionCoefficientChanges() holds.
+     *
+     * @param variable The variable.
+     * @param objectiveFunctionCoefficient The new coefficient of the variable.
+     */
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient);
+
+    /*!
+     * Retrieves whether this solver can change the objective function coefficients of existing variables.
+     */
+    virtual bool supportsObjectiveFunctionCoefficientChanges() const;
+
     /*!
      * Retrieves an expression that characterizes the given constant value.
      * In RawMode, this just returns the given value
@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "storm/solver/AcyclicMinMaxLinearEquationSolver.h"
+#include "storm/solver/GpuMinMaxLinearEquationSolver.h"
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
@@ -39,6 +40,42 @@ bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& en
     return internalSolveEquations(env, d, x, b);
 }
 
+template<typename ValueType>
+bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& X,
+                                                           std::vector<ValueType> const& B, uint64_t numberOfRightHandSides) const {
+    STORM_LOG_ASSERT(numberOfRightHandSides > 0 && X.size() % numberOfRightHandSides == 0 && B.size() % numberOfRightHandSides == 0,
+                     "Provided vectors have invalid size.");
+    if (numberOfRightHandSides == 1) {
+        return solveEquations(env, d, X, B);
+    }
+    STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
+                              "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
+                              "as checked (if applicable).");
+    return internalSolveMultipleEquations(env, d, X, B, numberOfRightHandSides);
+}
+
+template<typename ValueType>
+bool MinMaxLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& X,
+                                                                           std::vector<ValueType> const& B, uint64_t numberOfRightHandSides) const {
+    uint64_t const numberOfRowGroups = X.size() / numberOfRightHandSides;
+    uint64_t const numberOfRows = B.size() / numberOfRightHandSides;
+    std::vector<ValueType> x(numberOfRowGroups), b(numberOfRows);
+    bool result = true;
+    for (uint64_t lane = 0; lane < numberOfRightHandSides; ++lane) {
+        for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+            x[group] = X[group * numberOfRightHandSides + lane];
+        }
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            b[row] = B[row * numberOfRightHandSides + lane];
+        }
+        result &= internalSolveEquations(env, d, x, b);
+        for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+            X[group * numberOfRightHandSides + lane] = x[group];
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 void MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     STORM_LOG_THROW(isSet(this->direction), storm::exceptions::IllegalFunctionCallException, "Optimization direction not set.");
@@ -227,6 +264,8 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquati
         result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>();
     } else if (method == MinMaxMethod::TopologicalCuda) {
         result = std::make_unique<TopologicalCudaMinMaxLinearEquationSolver<ValueType>>();
+    } else if (method == MinMaxMethod::Gpu) {
+        result = std::make_unique<GpuMinMaxLinearEquationSolver<ValueType>>();
     } else if (method == MinMaxMethod::LinearProgramming) {
         result = std::make_unique<LpMinMaxLinearEquationSolver<ValueType>>(storm::utility::solver::getLpSolverFactory<ValueType>());
     } else if (method == MinMaxMethod::Acyclic) {
@@ -254,6 +293,8 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
         result = std::make_unique<AcyclicMinMaxLinearEquationSolver<storm::RationalNumber>>();
     } else if (method == MinMaxMethod::Topological) {
         result = std::make_unique<TopologicalMinMaxLinearEquationSolver<storm::RationalNumber>>();
+    } else if (method == MinMaxMethod::Gpu) {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "The GPU solver does not support exact arithmetic.");
     } else {
         STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
     }
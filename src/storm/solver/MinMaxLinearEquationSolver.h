@@ -61,6 +61,19 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     void solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves the equation system (see the other variants of <code>solveEquations</code>) for several right-hand sides. The vectors are stored
+     * interleaved, i.e., the entry of row group (or row) i for the j-th right-hand side is at position i * numberOfRightHandSides + j. Note that
+     * the optimal choices may differ between the right-hand sides. If the scheduler is tracked, it refers to the last right-hand side.
+     *
+     * @param X The solution vectors. They also serve as initial guesses.
+     * @param B The right-hand sides.
+     * @param numberOfRightHandSides The number of right-hand sides.
+     * @return true iff all equation systems were solved successfully.
+     */
+    bool solveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                        uint64_t numberOfRightHandSides) const;
+
     /*!
      * Sets an optimization direction to use for calls to methods that do not explicitly provide one.
      */
@@ -180,6 +193,12 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
    protected:
     virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves the equation system for several (interleaved) right-hand sides. The default implementation solves the systems one after another.
+     */
+    virtual bool internalSolveMultipleEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                uint64_t numberOfRightHandSides) const;
+
     /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
     OptimizationDirectionSetting direction;
 
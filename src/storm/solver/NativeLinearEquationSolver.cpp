@@ -1,5 +1,6 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include <atomic>
 #include <limits>
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -7,6 +8,8 @@
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/ConvergenceTelemetry.h"
+#include "storm/solver/SolverCheckpoint.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
@@ -17,6 +20,7 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -359,11 +363,60 @@ typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinea
     return PowerIterationResult(iterations - currentIterations, status);
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveMultipleEquationsPower(Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                                        uint64_t numberOfRightHandSides) const {
+    STORM_LOG_INFO("Solving linear equation system (" << this->A->getRowCount() << " rows) for " << numberOfRightHandSides
+                                                      << " right-hand sides with NativeLinearEquationSolver (Power)");
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    bool const relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+    uint64_t const k = numberOfRightHandSides;
+
+    std::vector<ValueType> newX(X.size());
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    this->startMeasureProgress();
+    while (status == SolverStatus::InProgress) {
+        std::atomic<bool> converged(true);
+        storm::utility::parallel::forEachChunk(env.solver().getNumberOfThreads(), this->A->getRowCount(), 1024, [&](uint64_t, uint64_t begin, uint64_t end) {
+            bool chunkConverged = true;
+            for (uint64_t row = begin; row < end; ++row) {
+                auto result = newX.begin() + row * k;
+                std::copy(B.begin() + row * k, B.begin() + (row + 1) * k, result);
+                for (auto const& entry : this->A->getRow(row)) {
+                    auto operand = X.begin() + entry.getColumn() * k;
+                    for (uint64_t lane = 0; lane < k; ++lane) {
+                        result[lane] += entry.getValue() * operand[lane];
+                    }
+                }
+                for (uint64_t lane = 0; chunkConverged && lane < k; ++lane) {
+                    chunkConverged = storm::utility::vector::equalModuloPrecision(X[row * k + lane], result[lane], precision, relative);
+                }
+            }
+            if (!chunkConverged) {
+                converged.store(false, std::memory_order_relaxed);
+            }
+        });
+        std::swap(X, newX);
+        ++iterations;
+        status = this->updateStatus(converged ? SolverStatus::Converged : SolverStatus::InProgress, false, iterations, maxIterations);
+        this->showProgressIterative(iterations);
+    }
+    this->reportStatus(status, iterations);
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
     // Prepare the solution vectors.
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 
     SolverGuarantee guarantee = SolverGuarantee::None;
     if (this->hasCustomTerminationCondition()) {
@@ -378,8 +431,22 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
 
     storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
     uint64_t numIterations{0};
+    ConvergenceTelemetryRecorder<ValueType> telemetry(env, "power iteration");
+    SolverCheckpointRecorder<ValueType> checkpoints(env, "power iteration");
+    checkpoints.restore(x, numIterations);
+    uint64_t const firstIteration = numIterations;
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
+        if (telemetry.isIterationRelevant(numIterations)) {
+            // With regular multiplication, the iterates of odd iterations are stored in the auxiliary vector of the operator.
+            bool inAuxiliaryVector = env.solver().native().getPowerMethodMultiplicationStyle() == MultiplicationStyle::Regular && numIterations % 2 == 1;
+            telemetry.recordIteration(numIterations, inAuxiliaryVector ? viOperator->getAuxiliaryVector() : x);
+        }
+        if (checkpoints.isCheckpointDue()) {
+            bool inAuxiliaryVector =
+                env.solver().native().getPowerMethodMultiplicationStyle() == MultiplicationStyle::Regular && (numIterations - firstIteration) % 2 == 1;
+            checkpoints.checkpoint(numIterations, inAuxiliaryVector ? viOperator->getAuxiliaryVector() : x);
+        }
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().native().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
@@ -428,14 +495,19 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (IntervalIteration)");
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
     helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
     auto upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
 
     uint64_t numIterations{0};
+    ConvergenceTelemetryRecorder<ValueType> telemetry(env, "interval iteration");
     auto iiCallback = [&](helper::IIData<ValueType> const& data) {
         this->showProgressIterative(numIterations);
+        if (telemetry.isIterationRelevant(numIterations)) {
+            telemetry.recordIteration(numIterations, data.x, ConvergenceTelemetryRecorder<ValueType>::computeBoundGap(data.x, data.y));
+        }
         bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                               this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
         return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().native().getMaximalNumberOfIterations());
@@ -471,11 +543,22 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
     }
 
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 
     auto precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     uint64_t numIterations{0};
+    ConvergenceTelemetryRecorder<ValueType> telemetry(env, "sound value iteration");
     auto sviCallback = [&](typename helper::SoundValueIterationHelper<ValueType, true>::SVIData const& current) {
         this->showProgressIterative(numIterations);
+        if (telemetry.isIterationRelevant(numIterations)) {
+            if (current.a && current.b) {
+                std::vector<ValueType> lower(current.xy.first.size()), upper(current.xy.first.size());
+                current.trySetLowerUpper(lower, upper);
+                telemetry.recordIteration(numIterations, lower, ConvergenceTelemetryRecorder<ValueType>::computeBoundGap(lower, upper));
+            } else {
+                telemetry.recordIteration(numIterations, current.xy.first);
+            }
+        }
         return this->updateStatus(current.status,
                                   this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
                                   numIterations, env.solver().native().getMaximalNumberOfIterations());
@@ -508,6 +591,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
     }
 
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 
     helper::OptimisticValueIterationHelper<ValueType, true> oviHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -544,6 +628,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environ
                                                                          std::vector<ValueType> const& b) const {
     // Set up two value iteration operators. One for exact and one for imprecise computations
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
     std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, true>> exactOp;
     std::shared_ptr<helper::ValueIterationOperator<double, true>> impreciseOp;
 
@@ -630,6 +715,17 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
     return false;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::internalSolveMultipleEquations(Environment const& env, std::vector<ValueType>& X,
+                                                                           std::vector<ValueType> const& B, uint64_t numberOfRightHandSides) const {
+    // Custom termination conditions refer to a single solution vector.
+    if (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == NativeLinearEquationSolverMethod::Power &&
+        !this->hasCustomTerminationCondition()) {
+        return this->solveMultipleEquationsPower(env, X, B, numberOfRightHandSides);
+    }
+    return LinearEquationSolver<ValueType>::internalSolveMultipleEquations(env, X, B, numberOfRightHandSides);
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
@@ -38,6 +38,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
    protected:
     virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+    virtual bool internalSolveMultipleEquations(storm::Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                                uint64_t numberOfRightHandSides) const override;
 
    private:
     struct PowerIterationResult {
@@ -68,6 +70,13 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsWalkerChae(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsPower(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+    /*!
+     * Performs power iterations for several interleaved right-hand sides at once. Each matrix entry is loaded once per iteration and applied
+     * to all solution vectors.
+     */
+    bool solveMultipleEquationsPower(storm::Environment const& env, std::vector<ValueType>& X, std::vector<ValueType> const& B,
+                                     uint64_t numberOfRightHandSides) const;
     virtual bool solveEquationsSoundValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -0,0 +1,221 @@
+#include "storm/solver/OutOfCoreValueIterationSolver.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/MappedSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+
+OutOfCoreValueIterationSolver::OutOfCoreValueIterationSolver(storm::storage::MappedSparseMatrix const& A, uint64_t entriesPerBlock)
+    : A(A), entriesPerBlock(std::max<uint64_t>(entriesPerBlock, 1)), fixedStates(A.getRowGroupCount(), false), numberOfIterations(0) {
+    // Intentionally left empty.
+}
+
+void OutOfCoreValueIterationSolver::setFixedStates(storm::storage::BitVector const& fixedStates) {
+    STORM_LOG_THROW(fixedStates.size() == A.getRowGroupCount(), storm::exceptions::InvalidArgumentException, "Unexpected size of the fixed states.");
+    this->fixedStates = fixedStates;
+    // The dependencies between the blocks ignore the fixed states, so they need to be recomputed.
+    blockStarts.clear();
+}
+
+bool OutOfCoreValueIterationSolver::solveEquations(Environment const& env, std::vector<double>& x, std::vector<double> const& b) const {
+    STORM_LOG_THROW(A.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException,
+                    "Linear equation systems require a matrix with trivial row grouping.");
+    auto const& nativeEnv = env.solver().native();
+    return solve(false, false, storm::utility::convertNumber<double>(nativeEnv.getPrecision()), nativeEnv.getRelativeTerminationCriterion(),
+                 nativeEnv.getMaximalNumberOfIterations(), x, b);
+}
+
+bool OutOfCoreValueIterationSolver::solveEquations(Environment const& env, OptimizationDirection dir, std::vector<double>& x,
+                                                   std::vector<double> const& b) const {
+    auto const& minMaxEnv = env.solver().minMax();
+    return solve(minimize(dir), maximize(dir), storm::utility::convertNumber<double>(minMaxEnv.getPrecision()), minMaxEnv.getRelativeTerminationCriterion(),
+                 minMaxEnv.getMaximalNumberOfIterations(), x, b);
+}
+
+uint64_t OutOfCoreValueIterationSolver::getNumberOfIterations() const {
+    return numberOfIterations;
+}
+
+uint64_t OutOfCoreValueIterationSolver::getNumberOfBlocks() const {
+    if (blockStarts.empty()) {
+        createBlocks();
+    }
+    return blockStarts.size() - 1;
+}
+
+void OutOfCoreValueIterationSolver::createBlocks() const {
+    uint64_t const rowGroupCount = A.getRowGroupCount();
+    blockStarts.clear();
+    blockStarts.push_back(0);
+    uint64_t entriesInBlock = 0;
+    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+        uint64_t const entriesInGroup = A.begin(A.getRowGroupIndex(group + 1)) - A.begin(A.getRowGroupIndex(group));
+        if (entriesInBlock > 0 && entriesInBlock + entriesInGroup > entriesPerBlock) {
+            blockStarts.push_back(group);
+            entriesInBlock = 0;
+        }
+        entriesInBlock += entriesInGroup;
+    }
+    if (rowGroupCount > 0) {
+        blockStarts.push_back(rowGroupCount);
+    }
+    uint64_t const numberOfBlocks = blockStarts.size() - 1;
+
+    // Build the graph in which a block has an edge to every block that contains a successor of one of its (non-fixed) row groups.
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfBlocks, numberOfBlocks);
+    std::vector<uint64_t> successorBlocks;
+    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+        if (block + 1 < numberOfBlocks) {
+            A.prefetchRowGroups(blockStarts[block + 1], blockStarts[block + 2]);
+        }
+        successorBlocks.clear();
+        for (uint64_t group = blockStarts[block]; group < blockStarts[block + 1]; ++group) {
+            if (fixedStates.get(group)) {
+                continue;
+            }
+            for (auto entry = A.begin(A.getRowGroupIndex(group)), end = A.begin(A.getRowGroupIndex(group + 1)); entry != end; ++entry) {
+                uint64_t const column = entry->getColumn();
+                // Most successors are in the current block, so it is checked first.
+                if (column >= blockStarts[block] && column < blockStarts[block + 1]) {
+                    successorBlocks.push_back(block);
+                } else {
+                    successorBlocks.push_back(std::upper_bound(blockStarts.begin(), blockStarts.end(), column) - blockStarts.begin() - 1);
+                }
+            }
+            std::sort(successorBlocks.begin(), successorBlocks.end());
+            successorBlocks.erase(std::unique(successorBlocks.begin(), successorBlocks.end()), successorBlocks.end());
+        }
+        for (auto successorBlock : successorBlocks) {
+            builder.addNextValue(block, successorBlock, storm::utility::one<double>());
+        }
+        A.releaseRowGroups(blockStarts[block], blockStarts[block + 1]);
+    }
+    storm::storage::SparseMatrix<double> blockGraph = builder.build();
+
+    // The topologically sorted SCCs are such that the SCCs a block depends on come first.
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition(
+        blockGraph, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    sccStarts.clear();
+    sccBlocks.clear();
+    cyclicSccs = storm::storage::BitVector(sccDecomposition.size(), false);
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+        auto const& scc = sccDecomposition.getBlock(sccIndex);
+        sccStarts.push_back(sccBlocks.size());
+        sccBlocks.insert(sccBlocks.end(), scc.begin(), scc.end());
+        std::sort(sccBlocks.begin() + sccStarts.back(), sccBlocks.end());
+        if (scc.size() > 1) {
+            cyclicSccs.set(sccIndex);
+        } else {
+            uint64_t const block = *scc.begin();
+            for (auto const& entry : blockGraph.getRow(block)) {
+                if (entry.getColumn() == block) {
+                    cyclicSccs.set(sccIndex);
+                }
+            }
+        }
+    }
+    sccStarts.push_back(sccBlocks.size());
+    STORM_LOG_INFO("Partitioned " << rowGroupCount << " row groups into " << numberOfBlocks << " blocks forming " << sccDecomposition.size()
+                                  << " SCCs (" << cyclicSccs.getNumberOfSetBits() << " of them cyclic).");
+}
+
+bool OutOfCoreValueIterationSolver::performSweep(uint64_t block, bool minimize, bool maximize, double precision, bool relative, std::vector<double>& x,
+                                                 std::vector<double> const& b) const {
+    bool converged = true;
+    for (uint64_t group = blockStarts[block]; group < blockStarts[block + 1]; ++group) {
+        if (fixedStates.get(group)) {
+            continue;
+        }
+        uint64_t const firstRow = A.getRowGroupIndex(group);
+        uint64_t const lastRow = A.getRowGroupIndex(group + 1);
+        if (firstRow == lastRow) {
+            continue;
+        }
+        double newValue = storm::utility::zero<double>();
+        for (uint64_t row = firstRow; row < lastRow; ++row) {
+            double rowValue = b[row];
+            for (auto entry = A.begin(row), end = A.end(row); entry != end; ++entry) {
+                rowValue += entry->getValue() * x[entry->getColumn()];
+            }
+            if (row == firstRow || (minimize && rowValue < newValue) || (maximize && rowValue > newValue)) {
+                newValue = rowValue;
+            }
+        }
+        double const oldValue = x[group];
+        if (converged) {
+            if (relative && oldValue != storm::utility::zero<double>()) {
+                converged = std::abs((newValue - oldValue) / oldValue) <= precision;
+            } else {
+                converged = std::abs(newValue - oldValue) <= precision;
+            }
+        }
+        x[group] = newValue;
+    }
+    return converged;
+}
+
+bool OutOfCoreValueIterationSolver::solve(bool minimize, bool maximize, double precision, bool relative, uint64_t maximalNumberOfIterations,
+                                          std::vector<double>& x, std::vector<double> const& b) const {
+    STORM_LOG_THROW(x.size() == A.getRowGroupCount(), storm::exceptions::InvalidArgumentException, "Unexpected size of the solution vector.");
+    STORM_LOG_THROW(b.size() == A.getRowCount(), storm::exceptions::InvalidArgumentException, "Unexpected size of the right-hand side.");
+    if (blockStarts.empty()) {
+        createBlocks();
+    }
+    numberOfIterations = 0;
+
+    uint64_t const numberOfSccs = sccStarts.size() - 1;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        uint64_t const sccBegin = sccStarts[sccIndex];
+        uint64_t const sccEnd = sccStarts[sccIndex + 1];
+        bool const cyclic = cyclicSccs.get(sccIndex);
+        bool const singleBlock = sccEnd - sccBegin == 1;
+        // The first block of the next SCC is prefetched while the last sweep over this SCC is performed.
+        uint64_t const nextSccBlock = sccIndex + 1 < numberOfSccs ? sccBlocks[sccEnd] : sccBlocks.size();
+
+        bool converged = false;
+        while (!converged) {
+            converged = true;
+            for (uint64_t position = sccBegin; position < sccEnd; ++position) {
+                uint64_t const block = sccBlocks[position];
+                if (position + 1 < sccEnd) {
+                    A.prefetchRowGroups(blockStarts[sccBlocks[position + 1]], blockStarts[sccBlocks[position + 1] + 1]);
+                } else if (nextSccBlock < sccBlocks.size()) {
+                    A.prefetchRowGroups(blockStarts[nextSccBlock], blockStarts[nextSccBlock + 1]);
+                }
+                converged &= performSweep(block, minimize, maximize, precision, relative, x, b);
+                ++numberOfIterations;
+                // A single block is kept in memory until its values have converged.
+                if (!singleBlock) {
+                    A.releaseRowGroups(blockStarts[block], blockStarts[block + 1]);
+                }
+            }
+            // Blocks without dependencies on themselves only depend on blocks whose values are already final.
+            converged |= !cyclic;
+            if (!converged && numberOfIterations >= maximalNumberOfIterations) {
+                STORM_LOG_WARN("Out-of-core value iteration did not converge within " << numberOfIterations << " sweeps.");
+                return false;
+            }
+        }
+        if (singleBlock) {
+            uint64_t const block = sccBlocks[sccBegin];
+            A.releaseRowGroups(blockStarts[block], blockStarts[block + 1]);
+        }
+    }
+    STORM_LOG_INFO("Out-of-core value iteration converged after " << numberOfIterations << " block sweeps.");
+    return true;
+}
+
+}  // namespace solver
+}  // namespace storm
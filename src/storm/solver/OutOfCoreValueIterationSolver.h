@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+
+class Environment;
+
+namespace storage {
+class MappedSparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * Performs Gauss-Seidel value iteration on a matrix that is memory-mapped from a model file (see storm::storage::MappedSparseMatrix).
+ * Only the solution vector and the right-hand side need to be kept in main memory, so the matrix may exceed the available main memory.
+ *
+ * The solver solves the fixpoint equation system x = A*x + b for deterministic systems and x = min/max (A*x + b) for nondeterministic
+ * systems, where the minimum (maximum) is taken over the rows of each row group. The values of the fixed states (if any) are never changed.
+ *
+ * The row groups are partitioned into blocks of consecutive row groups that are streamed sequentially from the file. The next block is
+ * prefetched while the current block is processed, and blocks that are not needed anymore are released. The blocks are processed in
+ * the topological order of the SCCs of the graph induced on the blocks (as TopologicalMinMaxLinearEquationSolver does for the states),
+ * i.e., the values of a block are only computed once the values of all blocks it depends on (outside of its own SCC) have converged.
+ * Within an SCC of blocks, Gauss-Seidel sweeps are performed until the values of the SCC converge.
+ */
+class OutOfCoreValueIterationSolver {
+   public:
+    /*!
+     * Creates a solver for the given matrix.
+     *
+     * @param A The matrix of the system. It must remain valid as long as the solver is used.
+     * @param entriesPerBlock The (approximate) number of matrix entries that are in main memory at the same time.
+     */
+    OutOfCoreValueIterationSolver(storm::storage::MappedSparseMatrix const& A, uint64_t entriesPerBlock = 1ull << 22);
+
+    /*!
+     * Sets the row groups whose values are fixed, i.e., whose values in the initial solution vector are kept.
+     */
+    void setFixedStates(storm::storage::BitVector const& fixedStates);
+
+    /*!
+     * Solves x = A*x + b for a matrix with trivial row grouping. The precision, the termination criterion and the maximal number of
+     * iterations are taken from the native solver environment.
+     *
+     * @param x The initial solution vector (one value per row group). Afterwards, contains the solution.
+     * @param b The right-hand side (one value per row).
+     * @return True iff the values converged.
+     */
+    bool solveEquations(Environment const& env, std::vector<double>& x, std::vector<double> const& b) const;
+
+    /*!
+     * Solves x = min/max (A*x + b). The precision, the termination criterion and the maximal number of iterations are taken from the
+     * min-max solver environment.
+     *
+     * @param dir The direction of the optimization.
+     * @param x The initial solution vector (one value per row group). Afterwards, contains the solution.
+     * @param b The right-hand side (one value per row).
+     * @return True iff the values converged.
+     */
+    bool solveEquations(Environment const& env, OptimizationDirection dir, std::vector<double>& x, std::vector<double> const& b) const;
+
+    /*!
+     * Retrieves the number of Gauss-Seidel sweeps over single blocks that were performed by the last call to solveEquations.
+     */
+    uint64_t getNumberOfIterations() const;
+
+    /*!
+     * Retrieves the number of blocks the row groups are partitioned into.
+     */
+    uint64_t getNumberOfBlocks() const;
+
+   private:
+    // Partitions the row groups into blocks and computes the order in which the blocks are processed.
+    void createBlocks() const;
+
+    // Performs a Gauss-Seidel sweep over the given block and returns whether the values of the block changed by at most the precision.
+    bool performSweep(uint64_t block, bool minimize, bool maximize, double precision, bool relative, std::vector<double>& x,
+                      std::vector<double> const& b) const;
+
+    bool solve(bool minimize, bool maximize, double precision, bool relative, uint64_t maximalNumberOfIterations, std::vector<double>& x,
+               std::vector<double> const& b) const;
+
+    storm::storage::MappedSparseMatrix const& A;
+    uint64_t entriesPerBlock;
+    storm::storage::BitVector fixedStates;
+
+    // The first row group of each block, followed by the number of row groups.
+    mutable std::vector<uint64_t> blockStarts;
+    // The SCCs of blocks in the order in which they are processed. The blocks of the i-th SCC are
+    // sccBlocks[sccStarts[i]], ..., sccBlocks[sccStarts[i + 1] - 1] in ascending order.
+    mutable std::vector<uint64_t> sccStarts;
+    mutable std::vector<uint64_t> sccBlocks;
+    // Whether the SCC needs to be iterated, i.e., whether it is not a single block without dependencies on itself.
+    mutable storm::storage::BitVector cyclicSccs;
+
+    mutable uint64_t numberOfIterations;
+};
+
+}  // namespace solver
+}  // namespace storm
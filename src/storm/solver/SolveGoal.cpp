@@ -97,6 +97,16 @@ bool SolveGoal<ValueType>::isBounded() const {
     return comparisonType && threshold && relevantValueVector;
 }
 
+template<typename ValueType>
+bool SolveGoal<ValueType>::isBoundedForAllStates() const {
+    return comparisonType && threshold && !relevantValueVector;
+}
+
+template<typename ValueType>
+storm::logic::ComparisonType SolveGoal<ValueType>::boundComparisonType() const {
+    return comparisonType.get();
+}
+
 template<typename ValueType>
 bool SolveGoal<ValueType>::boundIsALowerBound() const {
     return (comparisonType.get() == storm::logic::ComparisonType::Greater || comparisonType.get() == storm::logic::ComparisonType::GreaterEqual);
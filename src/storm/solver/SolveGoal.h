@@ -79,6 +79,13 @@ class SolveGoal {
 
     bool isBounded() const;
 
+    /*!
+     * Retrieves whether the values of all states are compared with a bound. In contrast to isBounded, there are no relevant values then.
+     */
+    bool isBoundedForAllStates() const;
+
+    storm::logic::ComparisonType boundComparisonType() const;
+
     bool boundIsALowerBound() const;
 
     bool boundIsStrict() const;
@@ -104,6 +111,7 @@ class SolveGoal {
 template<typename ValueType, typename MatrixType>
 std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> configureMinMaxLinearEquationSolver(
     Environment const& env, SolveGoal<ValueType>&& goal, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& factory, MatrixType&& matrix) {
+    uint64_t const numberOfStates = matrix.getRowGroupCount();
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = factory.create(env, std::forward<MatrixType>(matrix));
     solver->setOptimizationDirection(goal.direction());
     if (goal.isBounded()) {
@@ -114,6 +122,9 @@ std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> configureM
             solver->setTerminationCondition(std::make_unique<TerminateIfFilteredExtremumBelowThreshold<ValueType>>(goal.relevantValues(), goal.boundIsStrict(),
                                                                                                                    goal.thresholdValue(), false));
         }
+    } else if (goal.isBoundedForAllStates()) {
+        solver->setTerminationCondition(std::make_unique<TerminateIfAllStatesDecided<ValueType>>(storm::storage::BitVector(numberOfStates, true),
+                                                                                                 goal.boundComparisonType(), goal.thresholdValue()));
     }
     if (goal.hasRelevantValues()) {
         solver->setRelevantValues(std::move(goal.relevantValues()));
@@ -0,0 +1,190 @@
+#include "storm/solver/SolverCheckpoint.h"
+
+#include <cstdio>
+#include <fstream>
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+std::string const checkpointFileHeader = "storm-solver-checkpoint 1";
+}  // namespace
+
+SolverCheckpointing::SolverCheckpointing(std::optional<std::string> const& checkpointFilename, std::chrono::seconds const& interval,
+                                         std::optional<std::string> const& resumeFilename)
+    : checkpointFilename(checkpointFilename), interval(interval), numberOfSolves(0) {
+    if (resumeFilename) {
+        resumeCheckpoint = readFromFile(resumeFilename.value());
+        STORM_LOG_INFO("Resuming invocation " << resumeCheckpoint->solveIndex << " (" << resumeCheckpoint->method << ") at iteration "
+                                              << resumeCheckpoint->iteration << " from checkpoint '" << resumeFilename.value() << "'.");
+    }
+}
+
+SolverCheckpointing::~SolverCheckpointing() {
+    waitForPendingWrite();
+}
+
+std::shared_ptr<SolverCheckpointing> const& SolverCheckpointing::getDefault() {
+    static std::shared_ptr<SolverCheckpointing> const defaultCheckpointing = []() -> std::shared_ptr<SolverCheckpointing> {
+        if (!storm::settings::hasModule<storm::settings::modules::ResourceSettings>()) {
+            return nullptr;
+        }
+        auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+        if (!resourceSettings.isCheckpointSet() && !resourceSettings.isResumeSet()) {
+            return nullptr;
+        }
+        std::optional<std::string> checkpointFilename, resumeFilename;
+        if (resourceSettings.isCheckpointSet()) {
+            checkpointFilename = resourceSettings.getCheckpointFilename();
+        }
+        if (resourceSettings.isResumeSet()) {
+            resumeFilename = resourceSettings.getResumeFilename();
+        }
+        return std::make_shared<SolverCheckpointing>(checkpointFilename, std::chrono::seconds(resourceSettings.getCheckpointIntervalInSeconds()),
+                                                     resumeFilename);
+    }();
+    return defaultCheckpointing;
+}
+
+uint64_t SolverCheckpointing::registerSolve() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfSolves++;
+}
+
+bool SolverCheckpointing::isWriteCheckpoints() const {
+    return checkpointFilename.has_value();
+}
+
+std::chrono::seconds const& SolverCheckpointing::getInterval() const {
+    return interval;
+}
+
+std::optional<SolverCheckpoint> SolverCheckpointing::takeResumeCheckpoint(std::string const& method, uint64_t solveIndex, uint64_t numberOfValues) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!resumeCheckpoint || resumeCheckpoint->solveIndex != solveIndex) {
+        return std::nullopt;
+    }
+    std::optional<SolverCheckpoint> result;
+    if (resumeCheckpoint->method == method && resumeCheckpoint->values.size() == numberOfValues) {
+        result = std::move(resumeCheckpoint);
+    } else {
+        STORM_LOG_WARN("The checkpoint does not match solver invocation " << solveIndex << " (" << method << " with " << numberOfValues
+                                                                          << " values), so the invocation starts from scratch.");
+    }
+    resumeCheckpoint.reset();
+    return result;
+}
+
+bool SolverCheckpointing::writeAsynchronously(SolverCheckpoint&& checkpoint) {
+    STORM_LOG_ASSERT(isWriteCheckpoints(), "No checkpoint file was given.");
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pendingWrite.valid()) {
+        if (pendingWrite.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        pendingWrite.get();
+    }
+    pendingWrite = std::async(std::launch::async, [checkpoint = std::move(checkpoint), filename = checkpointFilename.value()]() {
+        try {
+            // Writing to a temporary file first ensures that the checkpoint file is never left incomplete.
+            writeToFile(checkpoint, filename + ".tmp");
+            STORM_LOG_THROW(std::rename((filename + ".tmp").c_str(), filename.c_str()) == 0, storm::exceptions::FileIoException,
+                            "Could not replace the checkpoint file '" << filename << "'.");
+        } catch (std::exception const& e) {
+            STORM_LOG_ERROR("Writing the checkpoint failed: " << e.what());
+        }
+    });
+    return true;
+}
+
+void SolverCheckpointing::waitForPendingWrite() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pendingWrite.valid()) {
+        pendingWrite.get();
+    }
+}
+
+void SolverCheckpointing::writeToFile(SolverCheckpoint const& checkpoint, std::string const& filename) {
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file '" << filename << "'.");
+    stream << checkpointFileHeader << '\n'
+           << checkpoint.method << '\n'
+           << checkpoint.solveIndex << ' ' << checkpoint.iteration << ' ' << checkpoint.values.size() << '\n';
+    stream.write(reinterpret_cast<char const*>(checkpoint.values.data()), checkpoint.values.size() * sizeof(double));
+    stream.close();
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write the checkpoint to file '" << filename << "'.");
+}
+
+SolverCheckpoint SolverCheckpointing::readFromFile(std::string const& filename) {
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file '" << filename << "'.");
+    std::string header;
+    std::getline(stream, header);
+    STORM_LOG_THROW(header == checkpointFileHeader, storm::exceptions::WrongFormatException, "The file '" << filename << "' is not a solver checkpoint.");
+    SolverCheckpoint result;
+    std::getline(stream, result.method);
+    uint64_t numberOfValues;
+    stream >> result.solveIndex >> result.iteration >> numberOfValues;
+    STORM_LOG_THROW(stream && stream.get() == '\n', storm::exceptions::WrongFormatException, "The checkpoint file '" << filename << "' is malformed.");
+    result.values.resize(numberOfValues);
+    stream.read(reinterpret_cast<char*>(result.values.data()), numberOfValues * sizeof(double));
+    STORM_LOG_THROW(stream, storm::exceptions::WrongFormatException, "The checkpoint file '" << filename << "' is truncated.");
+    return result;
+}
+
+template<typename ValueType>
+SolverCheckpointRecorder<ValueType>::SolverCheckpointRecorder(Environment const& env, std::string const& method)
+    : checkpointing(env.solver().getCheckpointing()), method(method), solveIndex(0), lastCheckpointTime(std::chrono::steady_clock::now()) {
+    if (checkpointing) {
+        // The invocation gets an index even if it is not checkpointed, so that the indices do not depend on the value types.
+        solveIndex = checkpointing->registerSolve();
+        if (!std::is_same_v<ValueType, double>) {
+            STORM_LOG_WARN_COND(!checkpointing->isWriteCheckpoints(), "Checkpoints are only written for double precision solvers.");
+            checkpointing.reset();
+        }
+    }
+}
+
+template<typename ValueType>
+bool SolverCheckpointRecorder<ValueType>::restore(std::vector<ValueType>& iterate, uint64_t& iteration) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (checkpointing) {
+            if (auto checkpoint = checkpointing->takeResumeCheckpoint(method, solveIndex, iterate.size())) {
+                iterate = std::move(checkpoint->values);
+                iteration = checkpoint->iteration;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<typename ValueType>
+void SolverCheckpointRecorder<ValueType>::checkpoint(uint64_t iteration, std::vector<ValueType> const& iterate) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (checkpointing && checkpointing->isWriteCheckpoints() && isCheckpointDue()) {
+            if (checkpointing->writeAsynchronously(SolverCheckpoint{method, solveIndex, iteration, iterate})) {
+                lastCheckpointTime = std::chrono::steady_clock::now();
+            }
+        }
+    }
+}
+
+template class SolverCheckpointRecorder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SolverCheckpointRecorder<storm::RationalNumber>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * The state of an iterative solver invocation that is written to a checkpoint file.
+ */
+struct SolverCheckpoint {
+    // The name of the solution method, e.g. "value iteration".
+    std::string method;
+    // The index of the solver invocation within the run (see SolverCheckpointing::registerSolve).
+    uint64_t solveIndex;
+    // The number of iterations performed so far.
+    uint64_t iteration;
+    // The current iterate.
+    std::vector<double> values;
+};
+
+/*!
+ * Periodically writes the state of the running iterative solver to a checkpoint file, so that a run that is interrupted can be resumed
+ * from the checkpoint instead of from scratch.
+ *
+ * Solver invocations are identified by the order in which they are started. When resuming, the invocations that precede the checkpointed
+ * one are thus performed again (which is deterministic) and the checkpointed invocation continues from the stored iterate. The stored
+ * iterate is only used if the method and the size of the equation system coincide. Checkpoints are written asynchronously: the iterate is
+ * copied and written by a separate thread. If that thread is still busy with the previous checkpoint, the next checkpoint is postponed.
+ */
+class SolverCheckpointing {
+   public:
+    /*!
+     * @param checkpointFilename If given, checkpoints are written to this file (atomically, via a temporary file).
+     * @param interval The minimal time between two checkpoints of the same solver invocation.
+     * @param resumeFilename If given, the checkpoint in this file is used to resume the corresponding solver invocation.
+     */
+    SolverCheckpointing(std::optional<std::string> const& checkpointFilename, std::chrono::seconds const& interval,
+                        std::optional<std::string> const& resumeFilename);
+
+    /*!
+     * Waits until the pending checkpoint (if any) is written.
+     */
+    ~SolverCheckpointing();
+
+    /*!
+     * Retrieves the checkpointing that is configured by the resource settings (or null if neither checkpointing nor resuming was requested).
+     */
+    static std::shared_ptr<SolverCheckpointing> const& getDefault();
+
+    /*!
+     * Retrieves a new index for a solver invocation that is started.
+     */
+    uint64_t registerSolve();
+
+    bool isWriteCheckpoints() const;
+    std::chrono::seconds const& getInterval() const;
+
+    /*!
+     * Retrieves the checkpoint to resume from if it belongs to the given solver invocation and has the given number of values.
+     * Each checkpoint is handed out at most once.
+     */
+    std::optional<SolverCheckpoint> takeResumeCheckpoint(std::string const& method, uint64_t solveIndex, uint64_t numberOfValues);
+
+    /*!
+     * Writes the given checkpoint in the background.
+     *
+     * @return False if the previous checkpoint is still being written. In this case, the given checkpoint is discarded.
+     */
+    bool writeAsynchronously(SolverCheckpoint&& checkpoint);
+
+    /*!
+     * Waits until the pending checkpoint (if any) is written.
+     */
+    void waitForPendingWrite();
+
+    static void writeToFile(SolverCheckpoint const& checkpoint, std::string const& filename);
+    static SolverCheckpoint readFromFile(std::string const& filename);
+
+   private:
+    std::optional<std::string> checkpointFilename;
+    std::chrono::seconds interval;
+    std::optional<SolverCheckpoint> resumeCheckpoint;
+
+    std::mutex mutex;
+    uint64_t numberOfSolves;
+    std::future<void> pendingWrite;
+};
+
+/*!
+ * Handles the checkpoints of a single solver invocation. All methods are no-ops if no checkpointing is set in the given environment.
+ * Currently, only iterates of double precision solvers are checkpointed.
+ */
+template<typename ValueType>
+class SolverCheckpointRecorder {
+   public:
+    SolverCheckpointRecorder(Environment const& env, std::string const& method);
+
+    /*!
+     * If the run is resumed from a checkpoint of this solver invocation, replaces the given iterate and number of iterations by the stored ones.
+     *
+     * @return True iff the iterate was restored.
+     */
+    bool restore(std::vector<ValueType>& iterate, uint64_t& iteration);
+
+    /*!
+     * Retrieves whether a checkpoint is to be written, i.e., whether the checkpoint interval has passed since the last one.
+     */
+    bool isCheckpointDue() const {
+        return checkpointing && std::chrono::steady_clock::now() - lastCheckpointTime >= checkpointing->getInterval();
+    }
+
+    /*!
+     * Writes the given iterate as checkpoint if a checkpoint is due.
+     */
+    void checkpoint(uint64_t iteration, std::vector<ValueType> const& iterate);
+
+   private:
+    std::shared_ptr<SolverCheckpointing> checkpointing;
+    std::string method;
+    uint64_t solveIndex;
+    std::chrono::steady_clock::time_point lastCheckpointTime;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -26,6 +26,8 @@ std::string toString(MinMaxMethod m) {
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::Gpu:
+            return "gpu";
     }
     return "invalid";
 }
@@ -36,6 +38,8 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Simd:
+            return "Simd";
     }
     return "invalid";
 }
@@ -46,6 +50,8 @@ std::string toString(GameMethod m) {
             return "valueiteration";
         case GameMethod::PolicyIteration:
             return "PolicyIteration";
+        case GameMethod::IntervalIteration:
+            return "intervaliteration";
     }
     return "invalid";
 }
@@ -60,6 +66,8 @@ std::string toString(LraMethod m) {
             return "lra-distribution-equations";
         case LraMethod::GainBiasEquations:
             return "gain-bias-equations";
+        case LraMethod::AggregationDisaggregation:
+            return "aggregation-disaggregation";
     }
     return "invalid";
 }
@@ -189,5 +197,17 @@ std::string toString(EigenLinearEquationSolverPreconditioner t) {
     }
     return "invalid";
 }
+
+std::string toString(PolicyEvaluationMethod t) {
+    switch (t) {
+        case PolicyEvaluationMethod::LinearEquationSolver:
+            return "linear-solver";
+        case PolicyEvaluationMethod::Bicgstab:
+            return "bicgstab";
+        case PolicyEvaluationMethod::ValueIterationSweeps:
+            return "vi-sweeps";
+    }
+    return "invalid";
+}
 }  // namespace solver
 }  // namespace storm
@@ -6,9 +6,11 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic)
-    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx) ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
-        ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
+                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic, Gpu)
+    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx, Simd)
+        ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration, IntervalIteration)
+        ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations,
+                                      AggregationDisaggregation)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3, Soplex)
@@ -21,6 +23,7 @@ ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, Lin
                                     ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                         ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
                                             ExtendEnumsWithSelectionField(EigenLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
+                                                ExtendEnumsWithSelectionField(PolicyEvaluationMethod, LinearEquationSolver, Bicgstab, ValueIterationSweeps)
 }
 }  // namespace storm
 
@@ -15,11 +15,22 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+// The number of row groups that a thread processes at once in the parallel value iteration kernel.
+uint64_t const ChunkSize = 4096;
+
+template<typename ValueType>
+bool isBetter(OptimizationDirection dir, ValueType const& value, ValueType const& reference) {
+    return dir == OptimizationDirection::Minimize ? value < reference : reference < value;
+}
+}  // namespace
+
 template<typename ValueType>
 StandardGameSolver<ValueType>::StandardGameSolver(storm::storage::SparseMatrix<storm::storage::sparse::state_type> const& player1Matrix,
                                                   storm::storage::SparseMatrix<ValueType> const& player2Matrix,
@@ -92,7 +103,7 @@ GameMethod StandardGameSolver<ValueType>::getMethod(Environment const& env, bool
         } else {
             STORM_LOG_WARN("The selected game method does not guarantee exact results.");
         }
-    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration) {
+    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration && method != GameMethod::IntervalIteration) {
         if (env.solver().game().isMethodSetFromDefault()) {
             method = GameMethod::PolicyIteration;
             STORM_LOG_INFO("Changing game method to policy-iteration to guarantee sound results. If you want to override this, specify another method.");
@@ -114,6 +125,8 @@ bool StandardGameSolver<ValueType>::solveGame(Environment const& env, Optimizati
             return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         case GameMethod::PolicyIteration:
             return solveGamePolicyIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+        case GameMethod::IntervalIteration:
+            return solveGameIntervalIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -400,6 +413,82 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
     return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
 }
 
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                               std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                               std::vector<uint64_t>* player1Choices, std::vector<uint64_t>* player2Choices) const {
+    // Iterating from an upper bound only converges to the solution if the fixed point is unique (i.e., there are no end components).
+    if (!this->hasUniqueSolution() || !this->hasLowerBound() || !this->hasUpperBound()) {
+        STORM_LOG_WARN("Interval iteration for games requires a unique solution as well as lower and upper bounds. Falling back to value iteration.");
+        return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+    }
+
+    if (!multiplierPlayer2Matrix) {
+        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
+    }
+    if (!auxiliaryP2RowGroupVector) {
+        auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
+    }
+    if (!auxiliaryP1RowGroupVector) {
+        auxiliaryP1RowGroupVector = std::make_unique<std::vector<ValueType>>(this->getNumberOfPlayer1States());
+    }
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+    bool relative = env.solver().game().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+    ValueType const two = storm::utility::convertNumber<ValueType>(2.0);
+
+    // The lower bounds are stored in x. Applying the (monotone) operator to a bound yields a bound again, so we keep the best bound per state.
+    std::vector<ValueType>& lowerX = x;
+    this->createLowerBoundsVector(lowerX);
+    std::vector<ValueType> upperX(x.size());
+    this->createUpperBoundsVector(upperX);
+    std::vector<ValueType>& newX = *auxiliaryP1RowGroupVector;
+
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        multiplyAndReduce(env, player1Dir, player2Dir, lowerX, &b, *multiplierPlayer2Matrix, *auxiliaryP2RowGroupVector, newX);
+        for (uint64_t state = 0; state < lowerX.size(); ++state) {
+            lowerX[state] = std::max(lowerX[state], newX[state]);
+        }
+        multiplyAndReduce(env, player1Dir, player2Dir, upperX, &b, *multiplierPlayer2Matrix, *auxiliaryP2RowGroupVector, newX);
+        for (uint64_t state = 0; state < upperX.size(); ++state) {
+            upperX[state] = std::min(upperX[state], newX[state]);
+        }
+
+        // The center of the interval is precise enough if the interval has at most twice the desired size.
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(lowerX, upperX, two * precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+
+        ++iterations;
+        status = this->updateStatus(status, lowerX, SolverGuarantee::LessOrEqual, iterations, maxIter);
+    }
+
+    this->reportStatus(status, iterations);
+
+    for (uint64_t state = 0; state < x.size(); ++state) {
+        x[state] += (upperX[state] - x[state]) / two;
+    }
+
+    // If requested, we store the scheduler for retrieval.
+    if (player1Choices && player2Choices) {
+        extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, *player1Choices, *player2Choices);
+    } else if (this->isTrackSchedulersSet()) {
+        this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+        this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+        extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, this->player1SchedulerChoices.get(),
+                       this->player2SchedulerChoices.get());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
+}
+
 template<typename ValueType>
 void StandardGameSolver<ValueType>::repeatedMultiply(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                      std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
@@ -427,6 +516,14 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
                                                       storm::solver::Multiplier<ValueType> const& multiplier, std::vector<ValueType>& player2ReducedResult,
                                                       std::vector<ValueType>& player1ReducedResult, std::vector<uint64_t>* player1SchedulerChoices,
                                                       std::vector<uint64_t>* player2SchedulerChoices) const {
+    uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
+    // The parallel kernel writes the result while other threads still read x, so it is not used for in-place multiplications.
+    if (numberOfThreads > 1 && &x != &player1ReducedResult) {
+        multiplyAndReduceParallel(numberOfThreads, player1Dir, player2Dir, x, b, player2ReducedResult, player1ReducedResult, player1SchedulerChoices,
+                                  player2SchedulerChoices);
+        return;
+    }
+
     multiplier.multiplyAndReduce(env, player2Dir, x, b, player2ReducedResult, player2SchedulerChoices);
 
     if (this->player1RepresentedByMatrix()) {
@@ -461,6 +558,83 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
     }
 }
 
+template<typename ValueType>
+void StandardGameSolver<ValueType>::multiplyAndReduceParallel(uint64_t numberOfThreads, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                              std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                              std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
+                                                              std::vector<uint64_t>* player1SchedulerChoices,
+                                                              std::vector<uint64_t>* player2SchedulerChoices) const {
+    // First stage: reduce the rows of each player 2 state. As in the sequential multipliers, a stored choice is only replaced by a strictly better one.
+    auto const& rowGroupIndices = player2Matrix.getRowGroupIndices();
+    storm::utility::parallel::forEachChunk(numberOfThreads, player2Matrix.getRowGroupCount(), ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t group = begin; group < end; ++group) {
+            uint64_t const firstRow = rowGroupIndices[group];
+            uint64_t const endRow = rowGroupIndices[group + 1];
+            if (firstRow == endRow) {
+                player2ReducedResult[group] = storm::utility::zero<ValueType>();
+                continue;
+            }
+            uint64_t bestChoice = player2SchedulerChoices ? (*player2SchedulerChoices)[group] : 0;
+            ValueType bestValue = b ? (*b)[firstRow + bestChoice] : storm::utility::zero<ValueType>();
+            for (auto const& entry : player2Matrix.getRow(firstRow + bestChoice)) {
+                bestValue += entry.getValue() * x[entry.getColumn()];
+            }
+            for (uint64_t row = firstRow; row < endRow; ++row) {
+                if (row == firstRow + bestChoice) {
+                    continue;
+                }
+                ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : player2Matrix.getRow(row)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+                if (isBetter(player2Dir, value, bestValue)) {
+                    bestValue = std::move(value);
+                    if (player2SchedulerChoices) {
+                        (*player2SchedulerChoices)[group] = row - firstRow;
+                    }
+                }
+            }
+            player2ReducedResult[group] = std::move(bestValue);
+        }
+    });
+
+    // Second stage: reduce the player 2 states that are available in each player 1 state.
+    storm::utility::parallel::forEachChunk(numberOfThreads, getNumberOfPlayer1States(), ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t player1State = begin; player1State < end; ++player1State) {
+            if (this->player1RepresentedByMatrix()) {
+                auto relevantRows = this->getPlayer1Matrix().getRowGroup(player1State);
+                STORM_LOG_ASSERT(relevantRows.getNumberOfEntries() != 0, "There is a choice of player 1 that does not lead to any player 2 choice");
+                auto it = relevantRows.begin();
+                ValueType result = player2ReducedResult[it->getColumn()];
+                for (++it; it != relevantRows.end(); ++it) {
+                    if (isBetter(player1Dir, player2ReducedResult[it->getColumn()], result)) {
+                        result = player2ReducedResult[it->getColumn()];
+                    }
+                }
+                player1ReducedResult[player1State] = std::move(result);
+            } else {
+                uint64_t const firstPlayer2State = this->getPlayer1Grouping()[player1State];
+                uint64_t const endPlayer2State = this->getPlayer1Grouping()[player1State + 1];
+                if (firstPlayer2State == endPlayer2State) {
+                    player1ReducedResult[player1State] = storm::utility::zero<ValueType>();
+                    continue;
+                }
+                uint64_t bestChoice = player1SchedulerChoices ? (*player1SchedulerChoices)[player1State] : 0;
+                ValueType result = player2ReducedResult[firstPlayer2State + bestChoice];
+                for (uint64_t player2State = firstPlayer2State; player2State < endPlayer2State; ++player2State) {
+                    if (isBetter(player1Dir, player2ReducedResult[player2State], result)) {
+                        result = player2ReducedResult[player2State];
+                        if (player1SchedulerChoices) {
+                            (*player1SchedulerChoices)[player1State] = player2State - firstPlayer2State;
+                        }
+                    }
+                }
+                player1ReducedResult[player1State] = std::move(result);
+            }
+        }
+    });
+}
+
 template<typename ValueType>
 bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                    std::vector<ValueType> const& x, std::vector<ValueType> const& b,
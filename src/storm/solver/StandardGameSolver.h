@@ -44,12 +44,23 @@ class StandardGameSolver : public GameSolver<ValueType> {
                                  std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
                                  std::vector<uint64_t>* player2Choices = nullptr) const;
 
+    // Iterates lower and upper bounds until they are sufficiently close. Requires a unique solution as well as lower and upper bounds.
+    bool solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                    std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
+                                    std::vector<uint64_t>* player2Choices = nullptr) const;
+
     // Computes p2Matrix * x + b, reduces the result w.r.t. player 2 choices, and then reduces the result w.r.t. player 1 choices.
     void multiplyAndReduce(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
                            std::vector<ValueType> const* b, storm::solver::Multiplier<ValueType> const& multiplier,
                            std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
                            std::vector<uint64_t>* player1SchedulerChoices = nullptr, std::vector<uint64_t>* player2SchedulerChoices = nullptr) const;
 
+    // Multi-threaded version of multiplyAndReduce that reduces the player 2 states and then the player 1 states in chunks of row groups.
+    void multiplyAndReduceParallel(uint64_t numberOfThreads, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& player2ReducedResult,
+                                   std::vector<ValueType>& player1ReducedResult, std::vector<uint64_t>* player1SchedulerChoices,
+                                   std::vector<uint64_t>* player2SchedulerChoices) const;
+
     // Solves the equation system given by the two choice selections
     void getInducedMatrixVector(std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint_fast64_t> const& player1Choices,
                                 std::vector<uint_fast64_t> const& player2Choices, storm::storage::SparseMatrix<ValueType>& inducedMatrix,
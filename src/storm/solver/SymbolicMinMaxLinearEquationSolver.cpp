@@ -4,6 +4,7 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/constants.h"
 
@@ -11,6 +12,8 @@
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
@@ -60,7 +63,18 @@ MinMaxMethod SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::getMethod(En
             STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
         }
     }
-    if (method != MinMaxMethod::ValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
+    if (!isExactMode && env.solver().isForceSoundness() && method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::RationalSearch) {
+        if (env.solver().minMax().isMethodSetFromDefault()) {
+            STORM_LOG_INFO(
+                "Selecting 'interval iteration' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify "
+                "a different method.");
+            method = MinMaxMethod::IntervalIteration;
+        } else {
+            STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
+        }
+    }
+    if (method != MinMaxMethod::ValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch &&
+        method != MinMaxMethod::IntervalIteration) {
         STORM_LOG_WARN("Selected method is not supported for this solver, switching to value iteration.");
         method = MinMaxMethod::ValueIteration;
     }
@@ -81,6 +95,9 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
         case MinMaxMethod::ValueIteration:
             return solveEquationsValueIteration(env, dir, x, b);
             break;
+        case MinMaxMethod::IntervalIteration:
+            return solveEquationsIntervalIteration(env, dir, x, b);
+            break;
         case MinMaxMethod::PolicyIteration:
             return solveEquationsPolicyIteration(env, dir, x, b);
             break;
@@ -345,6 +362,88 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
     return viResult.values;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult
+SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performIntervalIteration(storm::solver::OptimizationDirection const& dir,
+                                                                                storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
+                                                                                bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+    storm::dd::Add<DdType, ValueType> lowerX = this->getLowerBoundsVector();
+    storm::dd::Add<DdType, ValueType> upperX = this->getUpperBoundsVector();
+    storm::dd::Add<DdType, ValueType> precisionAdd = this->getDdManager().getConstant(precision);
+
+    // The states whose bounds are not yet close enough. The bounds of all other states are no longer updated. As iterating on valid bounds
+    // yields valid bounds, the frozen bounds stay valid and the matrix can be restricted to the choices of the remaining states.
+    storm::dd::Bdd<DdType> unconvergedStates = this->allRows;
+    storm::dd::Add<DdType, ValueType> restrictedA = this->A;
+    storm::dd::Add<DdType, ValueType> restrictedB = b;
+    auto step = [&](storm::dd::Add<DdType, ValueType> const& values) {
+        storm::dd::Add<DdType, ValueType> tmp = restrictedA.multiplyMatrix(values.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+        tmp += restrictedB;
+        if (dir == storm::solver::OptimizationDirection::Minimize) {
+            tmp += illegalMaskAdd;
+            tmp = tmp.minAbstract(this->choiceVariables);
+        } else {
+            tmp = tmp.maxAbstract(this->choiceVariables);
+        }
+        return unconvergedStates.ite(tmp, values);
+    };
+
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maximalIterations) {
+        lowerX = step(lowerX);
+        upperX = step(upperX);
+        ++iterations;
+
+        storm::dd::Add<DdType, ValueType> difference = upperX - lowerX;
+        storm::dd::Bdd<DdType> convergedStates =
+            relativeTerminationCriterion ? difference.lessOrEqual(lowerX * precisionAdd) : difference.lessOrEqual(precisionAdd);
+        storm::dd::Bdd<DdType> newUnconvergedStates = unconvergedStates && !convergedStates;
+        if (newUnconvergedStates.isZero()) {
+            status = SolverStatus::Converged;
+        } else if (newUnconvergedStates != unconvergedStates) {
+            unconvergedStates = newUnconvergedStates;
+            storm::dd::Add<DdType, ValueType> unconvergedStatesAdd = unconvergedStates.template toAdd<ValueType>();
+            restrictedA = this->A * unconvergedStatesAdd;
+            restrictedB = b * unconvergedStatesAdd;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+    }
+
+    if (status == SolverStatus::InProgress && iterations < maximalIterations) {
+        status = SolverStatus::MaximalIterationsExceeded;
+    }
+
+    // Return the center of the intervals.
+    return ValueIterationResult(status, iterations, (lowerX + upperX) / this->getDdManager().getConstant(storm::utility::convertNumber<ValueType>(2)));
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsIntervalIteration(
+    Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
+    storm::dd::Add<DdType, ValueType> const& b) const {
+    // Without a unique solution, the upper bounds might not converge to the (least) solution.
+    if (!this->hasUniqueSolution() || !(this->hasLowerBound() || this->hasLowerBounds()) || !(this->hasUpperBound() || this->hasUpperBounds())) {
+        STORM_LOG_WARN("Interval iteration requires a unique solution as well as lower and upper bounds. Falling back to (unsound) value iteration.");
+        return solveEquationsValueIteration(env, dir, x, b);
+    }
+
+    // Twice the precision bounds the difference between the center and the bounds of the intervals by the precision.
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()) * storm::utility::convertNumber<ValueType>(2);
+    ValueIterationResult result = performIntervalIteration(dir, b, precision, env.solver().minMax().getRelativeTerminationCriterion(),
+                                                           env.solver().minMax().getMaximalNumberOfIterations());
+
+    if (result.status == SolverStatus::Converged) {
+        STORM_LOG_INFO("Iterative solver (interval iteration) converged in " << result.iterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver (interval iteration) did not converge in " << result.iterations << " iterations.");
+    }
+
+    return result.values;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsWithScheduler(
     Environment const& env, storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x,
@@ -381,6 +480,40 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
     return schedulerX;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsWithSchedulerSparse(
+    Environment const& env, storm::dd::Odd const& odd, storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x,
+    storm::dd::Add<DdType, ValueType> const& b) const {
+    // Apply scheduler to the matrix and vector.
+    storm::dd::Add<DdType, ValueType> schedulerA =
+        scheduler.ite(this->A, scheduler.getDdManager().template getAddZero<ValueType>()).sumAbstract(this->choiceVariables);
+    storm::dd::Add<DdType, ValueType> schedulerB =
+        scheduler.ite(b, scheduler.getDdManager().template getAddZero<ValueType>()).sumAbstract(this->choiceVariables);
+
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    storm::storage::SparseMatrix<ValueType> explicitA = schedulerA.toMatrix(this->rowMetaVariables, this->columnMetaVariables, odd, odd);
+    if (linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        explicitA.convertToEquationSystem();
+    }
+    std::vector<ValueType> explicitX = x.toVector(odd);
+    std::vector<ValueType> explicitB = schedulerB.toVector(odd);
+
+    std::unique_ptr<LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitA));
+    if (this->hasLowerBounds()) {
+        solver->setLowerBounds(this->getLowerBounds().toVector(odd));
+    } else if (this->hasLowerBound()) {
+        solver->setLowerBound(this->getLowerBound());
+    }
+    if (this->hasUpperBounds()) {
+        solver->setUpperBounds(this->getUpperBounds().toVector(odd));
+    } else if (this->hasUpperBound()) {
+        solver->setUpperBound(this->getUpperBound());
+    }
+    solver->solveEquations(env, explicitX, explicitB);
+
+    return storm::dd::Add<DdType, ValueType>::fromVector(this->getDdManager(), explicitX, odd, this->rowMetaVariables);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsPolicyIteration(
     Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
@@ -424,11 +557,28 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
         environmentOfSolver, this->allRows, this->rowMetaVariables, this->columnMetaVariables, this->rowColumnMetaVariablePairs);
     this->forwardBounds(*linearEquationSolver);
 
+    // Small enough systems are translated to a sparse representation for the evaluation of the schedulers, as sparse solvers typically
+    // converge much faster. The schedulers are still improved symbolically.
+    boost::optional<storm::dd::Odd> odd;
+    if (this->allRows.getNonZeroCount() <= env.solver().minMax().getMaximalNumberOfStatesForSparsePolicyEvaluation()) {
+        auto requirements = storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getRequirements(environmentOfSolver);
+        if (this->hasLowerBound() || this->hasLowerBounds()) {
+            requirements.clearLowerBounds();
+        }
+        if (this->hasUpperBound() || this->hasUpperBounds()) {
+            requirements.clearUpperBounds();
+        }
+        if (!requirements.hasEnabledCriticalRequirement()) {
+            odd = this->allRows.createOdd();
+        }
+    }
+
     // Iteratively solve and improve the scheduler.
     uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
     while (!converged && iterations < maxIter) {
         storm::dd::Add<DdType, ValueType> schedulerX =
-            solveEquationsWithScheduler(environmentOfSolver, *linearEquationSolver, scheduler, currentSolution, b, diagonal);
+            odd ? solveEquationsWithSchedulerSparse(environmentOfSolver, odd.get(), scheduler, currentSolution, b)
+                : solveEquationsWithScheduler(environmentOfSolver, *linearEquationSolver, scheduler, currentSolution, b, diagonal);
 
         // Policy improvement step.
         storm::dd::Add<DdType, ValueType> choiceValues =
@@ -523,7 +673,11 @@ MinMaxLinearEquationSolverRequirements SymbolicMinMaxLinearEquationSolver<DdType
         if (!this->hasUniqueSolution()) {
             requirements.requireValidInitialScheduler();
         }
-    } else if (method == MinMaxMethod::ValueIteration) {
+    } else if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::IntervalIteration) {
+        // Without a unique solution, interval iteration falls back to value iteration.
+        if (method == MinMaxMethod::IntervalIteration) {
+            requirements.requireBounds(false);
+        }
         if (!this->hasUniqueSolution()) {
             if (!direction || direction.get() == storm::solver::OptimizationDirection::Maximize) {
                 requirements.requireLowerBounds();
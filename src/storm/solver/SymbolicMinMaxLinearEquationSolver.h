@@ -28,6 +28,8 @@ class Add;
 
 template<storm::dd::DdType T>
 class Bdd;
+
+class Odd;
 }  // namespace dd
 
 namespace solver {
@@ -149,9 +151,20 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
                                                                   storm::dd::Add<DdType, ValueType> const& b,
                                                                   storm::dd::Add<DdType, ValueType> const& diagonal) const;
 
+    /*!
+     * Solves the equation system induced by the given scheduler with a sparse linear equation solver. The given ODD has to encode the rows
+     * of the equation system.
+     */
+    storm::dd::Add<DdType, ValueType> solveEquationsWithSchedulerSparse(Environment const& env, storm::dd::Odd const& odd,
+                                                                        storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x,
+                                                                        storm::dd::Add<DdType, ValueType> const& b) const;
+
     storm::dd::Add<DdType, ValueType> solveEquationsValueIteration(Environment const& env, storm::solver::OptimizationDirection const& dir,
                                                                    storm::dd::Add<DdType, ValueType> const& x,
                                                                    storm::dd::Add<DdType, ValueType> const& b) const;
+    storm::dd::Add<DdType, ValueType> solveEquationsIntervalIteration(Environment const& env, storm::solver::OptimizationDirection const& dir,
+                                                                      storm::dd::Add<DdType, ValueType> const& x,
+                                                                      storm::dd::Add<DdType, ValueType> const& b) const;
     storm::dd::Add<DdType, ValueType> solveEquationsPolicyIteration(Environment const& env, storm::solver::OptimizationDirection const& dir,
                                                                     storm::dd::Add<DdType, ValueType> const& x,
                                                                     storm::dd::Add<DdType, ValueType> const& b) const;
@@ -203,6 +216,14 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
                                                storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion,
                                                uint64_t maximalIterations) const;
 
+    /*!
+     * Iterates lower and upper bounds of the solution until the intervals of all states are smaller than the given precision. The choices
+     * of states whose interval is small enough are removed from the matrix, so the cost of an iteration decreases with the number of
+     * converged states.
+     */
+    ValueIterationResult performIntervalIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& b,
+                                                  ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+
    protected:
     // The matrix defining the coefficients of the linear equation system.
     storm::dd::Add<DdType, ValueType> A;
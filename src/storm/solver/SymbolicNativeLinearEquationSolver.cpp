@@ -55,12 +55,22 @@ NativeLinearEquationSolverMethod SymbolicNativeLinearEquationSolver<DdType, Valu
             }
         }
     } else {
+        if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::IntervalIteration &&
+            method != NativeLinearEquationSolverMethod::RationalSearch) {
+            if (env.solver().native().isMethodSetFromDefault()) {
+                method = NativeLinearEquationSolverMethod::IntervalIteration;
+                STORM_LOG_INFO(
+                    "Selecting '" + toString(method) +
+                    "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
+            } else {
+                STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
+            }
+        }
         if (method != NativeLinearEquationSolverMethod::Power && method != NativeLinearEquationSolverMethod::RationalSearch &&
-            method != NativeLinearEquationSolverMethod::Jacobi) {
+            method != NativeLinearEquationSolverMethod::Jacobi && method != NativeLinearEquationSolverMethod::IntervalIteration) {
             method = NativeLinearEquationSolverMethod::Jacobi;
             STORM_LOG_INFO("The selected solution method is not supported in the dd engine. Falling back to '" + toString(method) + "'.");
         }
-        STORM_LOG_WARN_COND_DEBUG(!env.solver().isForceSoundness(), "Sound computations are not supported in the Dd engine.");
     }
     return method;
 }
@@ -74,6 +84,8 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
             return solveEquationsJacobi(env, x, b);
         case NativeLinearEquationSolverMethod::Power:
             return solveEquationsPower(env, x, b);
+        case NativeLinearEquationSolverMethod::IntervalIteration:
+            return solveEquationsIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return solveEquationsRationalSearch(env, x, b);
         default:
@@ -176,6 +188,73 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     return result.values;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult
+SymbolicNativeLinearEquationSolver<DdType, ValueType>::performIntervalIteration(storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
+                                                                                bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+    storm::dd::Add<DdType, ValueType> lowerX = this->getLowerBoundsVector();
+    storm::dd::Add<DdType, ValueType> upperX = this->getUpperBoundsVector();
+    storm::dd::Add<DdType, ValueType> precisionAdd = this->getDdManager().getConstant(precision);
+
+    // The rows whose bounds are not yet close enough. The bounds of all other rows are no longer updated. As iterating on valid bounds
+    // yields valid bounds, the frozen bounds stay valid and the matrix can be restricted to the remaining rows.
+    storm::dd::Bdd<DdType> unconvergedRows = this->allRows;
+    storm::dd::Add<DdType, ValueType> restrictedA = this->A;
+    storm::dd::Add<DdType, ValueType> restrictedB = b;
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maximalIterations) {
+        storm::dd::Add<DdType, ValueType> newLowerX =
+            restrictedA.multiplyMatrix(lowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + restrictedB;
+        storm::dd::Add<DdType, ValueType> newUpperX =
+            restrictedA.multiplyMatrix(upperX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + restrictedB;
+        lowerX = unconvergedRows.ite(newLowerX, lowerX);
+        upperX = unconvergedRows.ite(newUpperX, upperX);
+        ++iterations;
+
+        storm::dd::Add<DdType, ValueType> difference = upperX - lowerX;
+        storm::dd::Bdd<DdType> convergedRows =
+            relativeTerminationCriterion ? difference.lessOrEqual(lowerX * precisionAdd) : difference.lessOrEqual(precisionAdd);
+        storm::dd::Bdd<DdType> newUnconvergedRows = unconvergedRows && !convergedRows;
+        if (newUnconvergedRows.isZero()) {
+            status = SolverStatus::Converged;
+        } else if (newUnconvergedRows != unconvergedRows) {
+            unconvergedRows = newUnconvergedRows;
+            storm::dd::Add<DdType, ValueType> unconvergedRowsAdd = unconvergedRows.template toAdd<ValueType>();
+            restrictedA = this->A * unconvergedRowsAdd;
+            restrictedB = b * unconvergedRowsAdd;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+    }
+
+    // Return the center of the intervals.
+    return PowerIterationResult(status, iterations, (lowerX + upperX) / this->getDdManager().getConstant(storm::utility::convertNumber<ValueType>(2)));
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsIntervalIteration(
+    Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+    if (!(this->hasLowerBound() || this->hasLowerBounds()) || !(this->hasUpperBound() || this->hasUpperBounds())) {
+        STORM_LOG_WARN("Interval iteration requires lower and upper bounds on the solution. Falling back to (unsound) power iteration.");
+        return solveEquationsPower(env, x, b);
+    }
+    STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (interval iteration)");
+    // Twice the precision bounds the difference between the center and the bounds of the intervals by the precision.
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()) * storm::utility::convertNumber<ValueType>(2);
+    PowerIterationResult result = performIntervalIteration(b, precision, env.solver().native().getRelativeTerminationCriterion(),
+                                                           env.solver().native().getMaximalNumberOfIterations());
+
+    if (result.status == SolverStatus::Converged) {
+        STORM_LOG_INFO("Iterative solver (interval iteration) converged in " << result.iterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver (interval iteration) did not converge in " << result.iterations << " iterations.");
+    }
+
+    return result.values;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 bool SymbolicNativeLinearEquationSolver<DdType, ValueType>::isSolutionFixedPoint(storm::dd::Add<DdType, ValueType> const& x,
                                                                                  storm::dd::Add<DdType, ValueType> const& b) const {
@@ -333,6 +412,8 @@ LinearEquationSolverRequirements SymbolicNativeLinearEquationSolver<DdType, Valu
     auto method = getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value);
     if (method == NativeLinearEquationSolverMethod::RationalSearch) {
         requirements.requireLowerBounds();
+    } else if (method == NativeLinearEquationSolverMethod::IntervalIteration) {
+        requirements.requireBounds(false);
     }
     return requirements;
 }
@@ -77,6 +77,8 @@ class SymbolicNativeLinearEquationSolver : public SymbolicLinearEquationSolver<D
                                                            storm::dd::Add<DdType, ValueType> const& b) const;
     storm::dd::Add<DdType, ValueType> solveEquationsPower(Environment const& env, storm::dd::Add<DdType, ValueType> const& x,
                                                           storm::dd::Add<DdType, ValueType> const& b) const;
+    storm::dd::Add<DdType, ValueType> solveEquationsIntervalIteration(Environment const& env, storm::dd::Add<DdType, ValueType> const& x,
+                                                                      storm::dd::Add<DdType, ValueType> const& b) const;
     storm::dd::Add<DdType, ValueType> solveEquationsRationalSearch(Environment const& env, storm::dd::Add<DdType, ValueType> const& x,
                                                                    storm::dd::Add<DdType, ValueType> const& b) const;
 
@@ -123,6 +125,13 @@ class SymbolicNativeLinearEquationSolver : public SymbolicLinearEquationSolver<D
 
     PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b,
                                                ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+
+    /*!
+     * Iterates lower and upper bounds of the solution until the intervals of all rows are smaller than the given precision. Rows whose
+     * interval is small enough are removed from the matrix, so the cost of an iteration decreases with the number of converged rows.
+     */
+    PowerIterationResult performIntervalIteration(storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion,
+                                                  uint64_t maximalIterations) const;
 };
 
 template<storm::dd::DdType DdType, typename ValueType>
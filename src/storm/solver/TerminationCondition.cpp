@@ -1,4 +1,7 @@
 #include "storm/solver/TerminationCondition.h"
+
+#include <algorithm>
+
 #include "storm/utility/vector.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -158,17 +161,77 @@ bool TerminateIfFilteredExtremumBelowThreshold<ValueType>::requiresGuarantee(Sol
     return guarantee == SolverGuarantee::GreaterOrEqual;
 }
 
+template<typename ValueType>
+TerminateIfAllStatesDecided<ValueType>::TerminateIfAllStatesDecided(storm::storage::BitVector const& filter, storm::logic::ComparisonType comparisonType,
+                                                                    ValueType const& threshold)
+    : filter(filter), comparisonType(comparisonType), threshold(threshold) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool TerminateIfAllStatesDecided<ValueType>::terminateNow(std::function<ValueType(uint64_t const&)> const& valueGetter,
+                                                         SolverGuarantee const& guarantee) const {
+    if (guarantee == SolverGuarantee::LessOrEqual) {
+        return std::all_of(filter.begin(), filter.end(), [&](uint64_t const& state) { return isDecidedByLowerBound(valueGetter(state)); });
+    } else if (guarantee == SolverGuarantee::GreaterOrEqual) {
+        return std::all_of(filter.begin(), filter.end(), [&](uint64_t const& state) { return isDecidedByUpperBound(valueGetter(state)); });
+    }
+    return false;
+}
+
+template<typename ValueType>
+bool TerminateIfAllStatesDecided<ValueType>::requiresGuarantee(SolverGuarantee const& guarantee) const {
+    // Values approaching the threshold from the side where the bound is violated can only decide satisfying states (and vice versa).
+    if (storm::logic::isLowerBound(comparisonType)) {
+        return guarantee == SolverGuarantee::LessOrEqual;
+    } else {
+        return guarantee == SolverGuarantee::GreaterOrEqual;
+    }
+}
+
+template<typename ValueType>
+bool TerminateIfAllStatesDecided<ValueType>::isDecided(ValueType const& lowerBound, ValueType const& upperBound) const {
+    return isDecidedByLowerBound(lowerBound) || isDecidedByUpperBound(upperBound);
+}
+
+template<typename ValueType>
+storm::storage::BitVector const& TerminateIfAllStatesDecided<ValueType>::getFilter() const {
+    return filter;
+}
+
+template<typename ValueType>
+bool TerminateIfAllStatesDecided<ValueType>::isDecidedByLowerBound(ValueType const& lowerBound) const {
+    // The value is at least the lower bound, so the bound is satisfied (for >= and >) or violated (for < and <=).
+    if (comparisonType == storm::logic::ComparisonType::GreaterEqual || comparisonType == storm::logic::ComparisonType::Less) {
+        return lowerBound >= threshold;
+    } else {
+        return lowerBound > threshold;
+    }
+}
+
+template<typename ValueType>
+bool TerminateIfAllStatesDecided<ValueType>::isDecidedByUpperBound(ValueType const& upperBound) const {
+    // The value is at most the upper bound, so the bound is violated (for >= and >) or satisfied (for < and <=).
+    if (comparisonType == storm::logic::ComparisonType::Greater || comparisonType == storm::logic::ComparisonType::LessEqual) {
+        return upperBound <= threshold;
+    } else {
+        return upperBound < threshold;
+    }
+}
+
 template class TerminationCondition<double>;
 template class NoTerminationCondition<double>;
 template class TerminateIfFilteredSumExceedsThreshold<double>;
 template class TerminateIfFilteredExtremumExceedsThreshold<double>;
 template class TerminateIfFilteredExtremumBelowThreshold<double>;
+template class TerminateIfAllStatesDecided<double>;
 #ifdef STORM_HAVE_CARL
 template class TerminationCondition<storm::RationalNumber>;
 template class NoTerminationCondition<storm::RationalNumber>;
 template class TerminateIfFilteredSumExceedsThreshold<storm::RationalNumber>;
 template class TerminateIfFilteredExtremumExceedsThreshold<storm::RationalNumber>;
 template class TerminateIfFilteredExtremumBelowThreshold<storm::RationalNumber>;
+template class TerminateIfAllStatesDecided<storm::RationalNumber>;
 #endif
 
 }  // namespace solver
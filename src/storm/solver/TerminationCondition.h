@@ -2,6 +2,7 @@
 
 #include <functional>
 
+#include "storm/logic/ComparisonType.h"
 #include "storm/solver/SolverGuarantee.h"
 #include "storm/storage/BitVector.h"
 
@@ -72,5 +73,34 @@ class TerminateIfFilteredExtremumBelowThreshold : public TerminateIfFilteredSumE
     bool useMinimum;
     mutable uint64_t cachedExtremumIndex;
 };
+
+/*!
+ * Terminates once the comparison with the threshold is decided for every state of the filter, i.e., once it is known for every such state
+ * whether its value satisfies the bound or not. Solvers that compute a lower and an upper bound for each state can use `isDecided` to drop
+ * decided states from further iterations.
+ */
+template<typename ValueType>
+class TerminateIfAllStatesDecided : public TerminationCondition<ValueType> {
+   public:
+    TerminateIfAllStatesDecided(storm::storage::BitVector const& filter, storm::logic::ComparisonType comparisonType, ValueType const& threshold);
+
+    bool terminateNow(std::function<ValueType(uint64_t const&)> const& valueGetter, SolverGuarantee const& guarantee = SolverGuarantee::None) const override;
+    virtual bool requiresGuarantee(SolverGuarantee const& guarantee) const override;
+
+    /*!
+     * Retrieves whether a state whose value lies between the given bounds is decided.
+     */
+    bool isDecided(ValueType const& lowerBound, ValueType const& upperBound) const;
+
+    storm::storage::BitVector const& getFilter() const;
+
+   private:
+    bool isDecidedByLowerBound(ValueType const& lowerBound) const;
+    bool isDecidedByUpperBound(ValueType const& upperBound) const;
+
+    storm::storage::BitVector filter;
+    storm::logic::ComparisonType comparisonType;
+    ValueType threshold;
+};
 }  // namespace solver
 }  // namespace storm
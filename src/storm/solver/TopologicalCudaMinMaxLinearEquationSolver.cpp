@@ -72,7 +72,7 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->A->getRowGroupIndices();
 
     // Check if the decomposition is necessary
-#ifdef STORM_HAVE_CUDA
+#if defined(STORM_HAVE_CUDA) && defined(STORM_HAVE_CUSP)
 #define __USE_CUDAFORSTORM_OPT true
     size_t const gpuSizeOfCompleteSystem = basicValueIteration_mvReduce_uint64_double_calculateMemorySize(
         static_cast<size_t>(A->getRowCount()), nondeterministicChoiceIndices.size(), static_cast<size_t>(A->getEntryCount()));
@@ -87,7 +87,7 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
         // Dummy output for SCC Times
         // std::cout << "Computing the SCC Decomposition took 0ms\n";
 
-#ifdef STORM_HAVE_CUDA
+#if defined(STORM_HAVE_CUDA) && defined(STORM_HAVE_CUSP)
         STORM_LOG_THROW(resetCudaDevice(), storm::exceptions::InvalidStateException, "Could not reset CUDA Device, can not use CUDA Equation Solver.");
 
         bool result = false;
@@ -191,7 +191,7 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
 
             // For the current SCC, we need to perform value iteration until convergence.
             if (useGpu) {
-#ifdef STORM_HAVE_CUDA
+#if defined(STORM_HAVE_CUDA) && defined(STORM_HAVE_CUSP)
                 STORM_LOG_THROW(resetCudaDevice(), storm::exceptions::InvalidStateException,
                                 "Could not reset CUDA Device, can not use CUDA-based equation solver.");
 
@@ -311,7 +311,7 @@ TopologicalCudaMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopo
 
     std::vector<std::pair<bool, storm::storage::StateBlock>> result;
 
-#ifdef STORM_HAVE_CUDA
+#if defined(STORM_HAVE_CUDA) && defined(STORM_HAVE_CUSP)
     // 95% to have a bit of padding
     size_t const cudaFreeMemory = static_cast<size_t>(getFreeCudaMemory() * 0.95);
     size_t lastResultIndex = 0;
@@ -77,7 +77,7 @@ inline bool __basicValueIteration_mvReduce_minimize<uint_fast64_t, double>(
     (void)nondeterministicChoiceIndices;
     (void)iterationCount;
 
-#ifdef STORM_HAVE_CUDA
+#if defined(STORM_HAVE_CUDA) && defined(STORM_HAVE_CUSP)
     return basicValueIteration_mvReduce_uint64_double_minimize(maxIterationCount, precision, relativePrecisionCheck, matrixRowIndices, columnIndicesAndValues,
                                                                x, b, nondeterministicChoiceIndices, iterationCount);
 #else
@@ -106,7 +106,7 @@ inline bool __basicValueIteration_mvReduce_maximize<uint_fast64_t, double>(
     (void)nondeterministicChoiceIndices;
     (void)iterationCount;
 
-#ifdef STORM_HAVE_CUDA
+#if defined(STORM_HAVE_CUDA) && defined(STORM_HAVE_CUSP)
     return basicValueIteration_mvReduce_uint64_double_maximize(maxIterationCount, precision, relativePrecisionCheck, matrixRowIndices, columnIndicesAndValues,
                                                                x, b, nondeterministicChoiceIndices, iterationCount);
 #else
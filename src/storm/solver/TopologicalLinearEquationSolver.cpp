@@ -1,5 +1,8 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+#include <mutex>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -10,6 +13,8 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/profiling.h"
+#include "storm/utility/tracing.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -69,6 +74,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
+        storm::utility::profiling::ScopedPhase phase("scc decomposition");
         createSortedSccDecomposition(needAdaptPrecision);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
@@ -86,37 +92,52 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get() << ".");
     }
 
+    uint64_t const directSolverThreshold = getDirectSolverThreshold(env);
+    if (directSolverThreshold > 0 && !this->denseSccSolver) {
+        this->denseSccSolver = std::make_unique<storm::solver::helper::DenseSccSolver<ValueType>>();
+    }
+
     // Handle the case where there is just one large SCC
     bool returnValue = true;
     if (this->sortedSccDecomposition->size() == 1) {
         if (auto const& scc = *this->sortedSccDecomposition->begin(); scc.size() == 1) {
             // Catch the trivial case where the whole system is just a single state.
             returnValue = solveTrivialScc(*scc.begin(), x, b);
-        } else {
+        } else if (scc.size() > directSolverThreshold || !this->denseSccSolver->solve(*this->A, scc, x, b)) {
             returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
         }
     } else {
         // Solve each SCC individually
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
+        uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
+        if (numberOfThreads > 1 && !env.solver().getConvergenceTelemetry()) {
+            returnValue = solveSccsInParallel(sccSolverEnvironment, numberOfThreads, directSolverThreshold, x, b);
+        } else {
+            storm::storage::BitVector sccAsBitVector(x.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                } else if (scc.size() <= directSolverThreshold && this->denseSccSolver->solve(*this->A, scc, x, b)) {
+                    storm::utility::profiling::addToCounter("states", scc.size());
+                } else {
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    storm::utility::profiling::ScopedPhase phase("solve scc");
+                    storm::utility::profiling::addToCounter("states", scc.size());
+                    sccSolverEnvironment.solver().setConvergenceTelemetrySccIndex(sccIndex);
+                    returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     }
@@ -188,21 +209,25 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& solver,
+                                                          storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
+                                                          std::vector<ValueType> const& globalB) const {
+    STORM_TRACE_ZONE("solve scc");
+    STORM_TRACE_ZONE_VALUE(scc.getNumberOfSetBits());
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!solver) {
+        solver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        solver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = solver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    solver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,24 +247,107 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        solver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        solver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = solver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
 
+template<typename ValueType>
+uint64_t TopologicalLinearEquationSolver<ValueType>::getDirectSolverThreshold(storm::Environment const& env) const {
+    // With floating point numbers, the solution of the direct solver is not guaranteed to be within the precision required for sound results.
+    if (!storm::NumberTraits<ValueType>::IsExact && env.solver().isForceSoundness()) {
+        return 0;
+    }
+    return env.solver().topological().getDirectSolverThreshold();
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads,
+                                                                     uint64_t directSolverThreshold, std::vector<ValueType>& x,
+                                                                     std::vector<ValueType> const& b) const {
+    if (!this->sccTaskGraph) {
+        storm::utility::profiling::ScopedPhase phase("scc task graph");
+        this->sccTaskGraph = std::make_unique<storm::solver::helper::SccTaskGraph<ValueType>>(
+            *this->A, *this->sortedSccDecomposition, storm::solver::helper::SccTaskGraph<ValueType>::DefaultMaximalBatchSize);
+    }
+
+    // Every thread gets its own copy of the data that is modified while solving an SCC. Small SCCs are solved single-threaded (as
+    // other SCCs are solved at the same time), whereas large SCCs may use all threads.
+    struct ThreadData {
+        storm::Environment smallSccEnvironment;
+        storm::Environment largeSccEnvironment;
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> smallSccSolver;
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> largeSccSolver;
+        storm::solver::helper::DenseSccSolver<ValueType> denseSccSolver;
+        storm::storage::BitVector scc;
+    };
+    std::vector<ThreadData> threadData(numberOfThreads);
+    for (auto& data : threadData) {
+        data.smallSccEnvironment = sccSolverEnvironment;
+        data.smallSccEnvironment.solver().setNumberOfThreads(1);
+        data.largeSccEnvironment = sccSolverEnvironment;
+        data.scc = storm::storage::BitVector(x.size(), false);
+    }
+
+    std::atomic<bool> converged(true);
+    std::atomic<bool> aborted(false);
+    std::mutex progressMutex;
+    uint64_t solvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    this->sccTaskGraph->execute(numberOfThreads, [&](uint64_t threadIndex, uint64_t task) {
+        if (aborted || storm::utility::resources::isTerminate()) {
+            aborted = true;
+            return;
+        }
+        ThreadData& data = threadData[threadIndex];
+        bool const largeScc = this->sccTaskGraph->isLargeScc(task);
+        for (auto sccIt = this->sccTaskGraph->sccsBegin(task), sccIte = this->sccTaskGraph->sccsEnd(task); sccIt != sccIte; ++sccIt) {
+            auto const& scc = this->sortedSccDecomposition->getBlock(*sccIt);
+            if (scc.size() == 1) {
+                if (!solveTrivialScc(*scc.begin(), x, b)) {
+                    converged = false;
+                }
+            } else if (scc.size() <= directSolverThreshold && data.denseSccSolver.solve(*this->A, scc, x, b)) {
+                storm::utility::profiling::addToCounter("states", scc.size());
+            } else {
+                for (auto const& state : scc) {
+                    data.scc.set(state, true);
+                }
+                storm::utility::profiling::ScopedPhase phase("solve scc");
+                storm::utility::profiling::addToCounter("states", scc.size());
+                bool sccConverged = largeScc ? solveScc(data.largeSccEnvironment, data.largeSccSolver, data.scc, x, b)
+                                             : solveScc(data.smallSccEnvironment, data.smallSccSolver, data.scc, x, b);
+                if (!sccConverged) {
+                    converged = false;
+                }
+                for (auto const& state : scc) {
+                    data.scc.set(state, false);
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(progressMutex);
+        solvedSccs += this->sccTaskGraph->sccsEnd(task) - this->sccTaskGraph->sccsBegin(task);
+        progress.updateProgress(solvedSccs);
+    });
+    STORM_LOG_WARN_COND(!aborted, "Topological solver aborted after analyzing " << solvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+    return converged;
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat TopologicalLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
     return LinearEquationSolverProblemFormat::FixedPointSystem;
@@ -256,6 +364,8 @@ void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
     sccSolver.reset();
+    sccTaskGraph.reset();
+    denseSccSolver.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -3,6 +3,8 @@
 #include "storm/solver/LinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/DenseSccSolver.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -45,8 +47,15 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+    bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& solver,
+                  storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+
+    // Retrieves the maximal size of SCCs that are solved with the dense direct solver.
+    uint64_t getDirectSolverThreshold(storm::Environment const& env) const;
+
+    // Solves the SCCs with the given number of threads. SCCs that do not depend on each other are solved concurrently.
+    bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, uint64_t directSolverThreshold,
+                             std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -60,6 +69,8 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+    mutable std::unique_ptr<storm::solver::helper::SccTaskGraph<ValueType>> sccTaskGraph;
+    mutable std::unique_ptr<storm::solver::helper::DenseSccSolver<ValueType>> denseSccSolver;
 };
 
 template<typename ValueType>
@@ -1,5 +1,9 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+#include <mutex>
+
+#include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -11,6 +15,8 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/profiling.h"
+#include "storm/utility/tracing.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -48,6 +54,63 @@ storm::Environment TopologicalMinMaxLinearEquationSolver<ValueType>::getEnvironm
     return subEnv;
 }
 
+template<typename ValueType>
+boost::optional<storm::Environment> TopologicalMinMaxLinearEquationSolver<ValueType>::setUpAdaptiveMethodSelection(
+    storm::Environment const& env, OptimizationDirection dir, storm::Environment& sccSolverEnvironment) const {
+    if (!env.solver().topological().isAdaptiveMethodSelectionSet() || env.solver().isForceExact() || !std::is_same_v<ValueType, double>) {
+        return boost::none;
+    }
+    bool const sound = env.solver().isForceSoundness();
+    if (env.solver().topological().isUnderlyingMinMaxMethodSetFromDefault()) {
+        if (sound) {
+            sccSolverEnvironment.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        } else {
+            sccSolverEnvironment.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            sccSolverEnvironment.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+        }
+    }
+    if (sound) {
+        // Policy iteration with a floating point direct solver does not guarantee the precision of the result.
+        return boost::none;
+    }
+
+    storm::Environment directSccSolverEnvironment(sccSolverEnvironment);
+    directSccSolverEnvironment.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+    directSccSolverEnvironment.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+    directSccSolverEnvironment.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+    auto req = GeneralMinMaxLinearEquationSolverFactory<ValueType>().getRequirements(directSccSolverEnvironment, this->hasUniqueSolution(),
+                                                                                     this->hasNoEndComponents(), dir, this->hasInitialScheduler(),
+                                                                                     this->isTrackSchedulerSet());
+    if (req.upperBounds() && this->hasUpperBound()) {
+        req.clearUpperBounds();
+    }
+    if (req.lowerBounds() && this->hasLowerBound()) {
+        req.clearLowerBounds();
+    }
+    if (req.uniqueSolution() && this->hasUniqueSolution()) {
+        req.clearUniqueSolution();
+    }
+    if (req.hasEnabledCriticalRequirement()) {
+        STORM_LOG_INFO("Adaptive method selection does not solve SCCs directly due to the requirements " << req.getEnabledRequirementsAsString()
+                                                                                                        << " of policy iteration.");
+        return boost::none;
+    }
+    return directSccSolverEnvironment;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::isSolvedDirectly(storm::Environment const& env, storm::storage::BitVector const& sccRows) const {
+    uint64_t const entryLimit = env.solver().topological().getAdaptiveDirectEntryLimit();
+    uint64_t numberOfEntries = 0;
+    for (auto row : sccRows) {
+        numberOfEntries += this->A->getRow(row).getNumberOfEntries();
+        if (numberOfEntries > entryLimit) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename ValueType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                               std::vector<ValueType> const& b) const {
@@ -60,6 +123,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
+        storm::utility::profiling::ScopedPhase phase("scc decomposition");
         createSortedSccDecomposition(needAdaptPrecision);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
@@ -72,6 +136,8 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
     needAdaptPrecision = needAdaptPrecision && (this->sortedSccDecomposition->size() != this->A->getRowGroupCount());
 
     storm::Environment sccSolverEnvironment = getEnvironmentForUnderlyingSolver(env, needAdaptPrecision);
+    // Trivial SCCs are always solved in a single pass. With adaptive method selection, small SCCs are additionally solved directly.
+    boost::optional<storm::Environment> directSccSolverEnvironment = setUpAdaptiveMethodSelection(env, dir, sccSolverEnvironment);
 
     if (this->longestSccChainSize) {
         STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get());
@@ -86,6 +152,9 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
                 this->schedulerChoices = std::vector<uint64_t>(1);
             }
             returnValue = solveTrivialScc(*scc.begin(), dir, x, b);
+        } else if (directSccSolverEnvironment && this->A->getEntryCount() <= env.solver().topological().getAdaptiveDirectEntryLimit()) {
+            storm::utility::profiling::ScopedPhase phase("solve scc directly");
+            returnValue = solveFullyConnectedEquationSystem(*directSccSolverEnvironment, dir, x, b);
         } else {
             returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, dir, x, b);
         }
@@ -98,40 +167,48 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
+        uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
+        if (numberOfThreads > 1 && !env.solver().getConvergenceTelemetry()) {
+            returnValue = solveSccsInParallel(sccSolverEnvironment, directSccSolverEnvironment, numberOfThreads, dir, x, b);
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            uint64_t numberOfDirectlySolvedSccs = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    sccRowGroupsAsBitVector.clear();
+                    sccRowsAsBitVector.clear();
+                    setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector, true);
+                    if (directSccSolverEnvironment && isSolvedDirectly(env, sccRowsAsBitVector)) {
+                        storm::utility::profiling::ScopedPhase phase("solve scc directly");
+                        storm::utility::profiling::addToCounter("states", scc.size());
+                        directSccSolverEnvironment->solver().setConvergenceTelemetrySccIndex(sccIndex);
+                        returnValue =
+                            solveScc(*directSccSolverEnvironment, this->directSccSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                        ++numberOfDirectlySolvedSccs;
                     } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+                        storm::utility::profiling::ScopedPhase phase("solve scc");
+                        storm::utility::profiling::addToCounter("states", scc.size());
+                        sccSolverEnvironment.solver().setConvergenceTelemetrySccIndex(sccIndex);
+                        returnValue = solveScc(sccSolverEnvironment, this->sccSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
                     }
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
+                }
             }
+            STORM_LOG_INFO_COND(!directSccSolverEnvironment, "Adaptive method selection solved " << numberOfDirectlySolvedSccs << " of "
+                                                                                             << this->sortedSccDecomposition->size() << " SCCs directly.");
         }
 
         // If requested, we store the scheduler for retrieval.
@@ -290,17 +367,125 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveFullyConnectedEquati
 }
 
 template<typename ValueType>
-bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
-                                                                storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows,
-                                                                std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+void TopologicalMinMaxLinearEquationSolver<ValueType>::setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc,
+                                                                              storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows,
+                                                                              bool value) const {
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroups.set(group, value);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, value);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, value);
+            if (value) {
+                STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment,
+                                                                           boost::optional<storm::Environment> const& directSccSolverEnvironment,
+                                                                           uint64_t numberOfThreads, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                           std::vector<ValueType> const& b) const {
+    if (!this->sccTaskGraph) {
+        storm::utility::profiling::ScopedPhase phase("scc task graph");
+        this->sccTaskGraph = std::make_unique<storm::solver::helper::SccTaskGraph<ValueType>>(
+            *this->A, *this->sortedSccDecomposition, storm::solver::helper::SccTaskGraph<ValueType>::DefaultMaximalBatchSize);
+    }
+
+    // Every thread gets its own copy of the data that is modified while solving an SCC. Small SCCs are solved single-threaded (as
+    // other SCCs are solved at the same time), whereas large SCCs may use all threads.
+    struct ThreadData {
+        storm::Environment smallSccEnvironment;
+        storm::Environment largeSccEnvironment;
+        boost::optional<storm::Environment> directSccEnvironment;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> smallSccSolver;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> largeSccSolver;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> directSccSolver;
+        storm::storage::BitVector sccRowGroups;
+        storm::storage::BitVector sccRows;
+    };
+    std::vector<ThreadData> threadData(numberOfThreads);
+    for (auto& data : threadData) {
+        data.smallSccEnvironment = sccSolverEnvironment;
+        data.smallSccEnvironment.solver().setNumberOfThreads(1);
+        data.largeSccEnvironment = sccSolverEnvironment;
+        if (directSccSolverEnvironment) {
+            data.directSccEnvironment = *directSccSolverEnvironment;
+            data.directSccEnvironment->solver().setNumberOfThreads(1);
+        }
+        data.sccRowGroups = storm::storage::BitVector(x.size(), false);
+        data.sccRows = storm::storage::BitVector(b.size(), false);
+    }
+
+    std::atomic<bool> converged(true);
+    std::atomic<bool> aborted(false);
+    std::mutex progressMutex;
+    uint64_t solvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    this->sccTaskGraph->execute(numberOfThreads, [&](uint64_t threadIndex, uint64_t task) {
+        if (aborted || storm::utility::resources::isTerminate()) {
+            aborted = true;
+            return;
+        }
+        ThreadData& data = threadData[threadIndex];
+        bool const largeScc = this->sccTaskGraph->isLargeScc(task);
+        for (auto sccIt = this->sccTaskGraph->sccsBegin(task), sccIte = this->sccTaskGraph->sccsEnd(task); sccIt != sccIte; ++sccIt) {
+            auto const& scc = this->sortedSccDecomposition->getBlock(*sccIt);
+            if (scc.size() == 1) {
+                if (!solveTrivialScc(*scc.begin(), dir, x, b)) {
+                    converged = false;
+                }
+            } else {
+                setSccRowGroupsAndRows(scc, data.sccRowGroups, data.sccRows, true);
+                bool const solveDirectly = data.directSccEnvironment && isSolvedDirectly(data.smallSccEnvironment, data.sccRows);
+                storm::utility::profiling::ScopedPhase phase(solveDirectly ? "solve scc directly" : "solve scc");
+                storm::utility::profiling::addToCounter("states", scc.size());
+                bool sccConverged;
+                if (solveDirectly) {
+                    sccConverged = solveScc(*data.directSccEnvironment, data.directSccSolver, dir, data.sccRowGroups, data.sccRows, x, b);
+                } else if (largeScc) {
+                    sccConverged = solveScc(data.largeSccEnvironment, data.largeSccSolver, dir, data.sccRowGroups, data.sccRows, x, b);
+                } else {
+                    sccConverged = solveScc(data.smallSccEnvironment, data.smallSccSolver, dir, data.sccRowGroups, data.sccRows, x, b);
+                }
+                if (!sccConverged) {
+                    converged = false;
+                }
+                setSccRowGroupsAndRows(scc, data.sccRowGroups, data.sccRows, false);
+            }
+        }
+        std::lock_guard<std::mutex> lock(progressMutex);
+        solvedSccs += this->sccTaskGraph->sccsEnd(task) - this->sccTaskGraph->sccsBegin(task);
+        progress.updateProgress(solvedSccs);
+    });
+    STORM_LOG_WARN_COND(!aborted, "Topological solver aborted after analyzing " << solvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+    return converged;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& solver,
+                                                                OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups,
+                                                                storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
+                                                                std::vector<ValueType> const& globalB) const {
+    STORM_TRACE_ZONE("solve scc");
+    STORM_TRACE_ZONE_VALUE(sccRowGroups.getNumberOfSetBits());
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!solver) {
+        solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        solver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    solver->setHasUniqueSolution(this->hasUniqueSolution());
+    solver->setHasNoEndComponents(this->hasNoEndComponents());
+    solver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -314,7 +499,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            solver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -323,11 +508,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            solver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    solver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -347,18 +532,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        solver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        solver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = solver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -373,14 +558,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    solver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = solver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, solver->getSchedulerChoices());
     }
 
     // Set solution
@@ -403,6 +588,8 @@ void TopologicalMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
     sccSolver.reset();
+    directSccSolver.reset();
+    sccTaskGraph.reset();
     auxiliaryRowGroupVector.reset();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
@@ -3,6 +3,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -33,6 +34,14 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
    private:
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
+    // For the adaptive method selection, adapts the environment of the underlying solver for SCCs that are not solved directly and
+    // returns the environment for SCCs that are solved directly (if SCCs are solved directly at all).
+    boost::optional<storm::Environment> setUpAdaptiveMethodSelection(storm::Environment const& env, OptimizationDirection d,
+                                                                     storm::Environment& sccSolverEnvironment) const;
+
+    // Retrieves whether the SCC with the given rows has few enough entries to be solved directly by the adaptive method selection.
+    bool isSolvedDirectly(storm::Environment const& env, storm::storage::BitVector const& sccRows) const;
+
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
     void createSortedSccDecomposition(bool needLongestChainSize) const;
 
@@ -43,13 +52,24 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+    bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& solver,
+                  OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows,
+                  std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+
+    // Sets the row groups of the given SCC and the rows that belong to it (i.e., all rows or only the fixed choice of each row group).
+    void setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups,
+                                storm::storage::BitVector& sccRows, bool value) const;
+
+    // Solves the SCCs with the given number of threads. SCCs that do not depend on each other are solved concurrently.
+    bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, boost::optional<storm::Environment> const& directSccSolverEnvironment,
+                             uint64_t numberOfThreads, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+    mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> directSccSolver;
+    mutable std::unique_ptr<storm::solver::helper::SccTaskGraph<ValueType>> sccTaskGraph;
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
 };
 }  // namespace solver
@@ -1,9 +1,14 @@
+#pragma once
+
+#include <boost/optional.hpp>
+
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -122,6 +127,91 @@ storm::storage::SparseMatrix<ValueType> createReorderedMatrix(storm::storage::Sp
     STORM_LOG_DEBUG("Reordered " << matrix.getDimensionsAsString() << " with " << bFactors.size() << " selfloop entries for acyclic solving.");
     return result;
 }
+
+/*!
+ * The row groups of an acyclic equation system, partitioned by their depth. A row group without successors has depth zero and every other row
+ * group has a larger depth than all of its successors. Hence, row groups of the same depth do not depend on each other and can be solved
+ * concurrently as soon as all row groups of smaller depth are solved.
+ */
+struct DepthLevels {
+    /// The row groups, sorted by their depth.
+    std::vector<uint64_t> groups;
+    /// The row groups of depth d are groups[levelStarts[d]], ..., groups[levelStarts[d + 1] - 1].
+    std::vector<uint64_t> levelStarts;
+};
+
+/// The minimal average number of row groups per depth level for which solving the levels in parallel pays off.
+uint64_t const MinimalAverageLevelWidth = 256;
+
+/// The number of row groups of a depth level that a thread claims at once.
+uint64_t const LevelChunkSize = 256;
+
+/*!
+ * Computes the depth levels of the given matrix, which must be ordered such that every row group only depends on row groups with a larger index
+ * (see computeTopologicalGroupOrdering). Entries of a row group on itself are not considered as dependencies, as they only read the value of the
+ * row group before it is updated.
+ *
+ * @return The depth levels, or none if the matrix is not ordered appropriately or the levels are too narrow to be solved in parallel.
+ */
+template<typename ValueType>
+boost::optional<DepthLevels> computeDepthLevels(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    uint64_t const numGroups = matrix.getRowGroupCount();
+    std::vector<uint64_t> depths(numGroups, 0);
+    uint64_t numLevels = numGroups == 0 ? 0 : 1;
+    for (uint64_t group = numGroups; group > 0;) {
+        --group;
+        uint64_t& depth = depths[group];
+        for (auto const& entry : matrix.getRowGroup(group)) {
+            if (entry.getColumn() > group) {
+                depth = std::max(depth, depths[entry.getColumn()] + 1);
+            } else if (entry.getColumn() < group) {
+                // Only zero entries may point to row groups with a smaller index. Reading those values concurrently to their updates would be a race.
+                return boost::none;
+            }
+        }
+        numLevels = std::max(numLevels, depth + 1);
+    }
+    if (numLevels * MinimalAverageLevelWidth > numGroups) {
+        return boost::none;
+    }
+
+    // Sort the row groups by their depth (counting sort keeps them in ascending order within each level).
+    DepthLevels result;
+    result.levelStarts.assign(numLevels + 1, 0);
+    for (auto depth : depths) {
+        ++result.levelStarts[depth + 1];
+    }
+    for (uint64_t level = 0; level < numLevels; ++level) {
+        result.levelStarts[level + 1] += result.levelStarts[level];
+    }
+    result.groups.resize(numGroups);
+    std::vector<uint64_t> nextPositions(result.levelStarts.begin(), result.levelStarts.end() - 1);
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        result.groups[nextPositions[depths[group]]++] = group;
+    }
+    STORM_LOG_DEBUG("Partitioned " << numGroups << " row groups into " << numLevels << " depth levels.");
+    return result;
+}
+
+/*!
+ * Invokes the given body for all row groups such that a row group is only processed after all row groups of smaller depth. The row groups of each
+ * level are processed in parallel chunks.
+ *
+ * @param body A callable with signature void(uint64_t group).
+ */
+template<typename Body>
+void forEachGroupByDepth(uint64_t numberOfThreads, DepthLevels const& levels, Body const& body) {
+    for (uint64_t level = 0; level + 1 < levels.levelStarts.size(); ++level) {
+        uint64_t const levelStart = levels.levelStarts[level];
+        storm::utility::parallel::forEachChunk(numberOfThreads, levels.levelStarts[level + 1] - levelStart, LevelChunkSize,
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t index = levelStart + begin; index < levelStart + end; ++index) {
+                                                       body(levels.groups[index]);
+                                                   }
+                                               });
+    }
+}
+
 }  // namespace helper
 }  // namespace solver
 }  // namespace storm
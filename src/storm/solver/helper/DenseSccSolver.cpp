@@ -0,0 +1,128 @@
+#include "storm/solver/helper/DenseSccSolver.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StateBlock.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+bool DenseSccSolver<ValueType>::solve(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StateBlock const& scc,
+                                      std::vector<ValueType>& x, std::vector<ValueType> const& b) {
+    uint64_t const numberOfStates = matrix.getRowCount();
+    uint64_t const n = scc.size();
+    if (localIndices.size() != numberOfStates) {
+        localIndices.assign(numberOfStates, numberOfStates);
+    }
+    uint64_t localIndex = 0;
+    for (auto state : scc) {
+        localIndices[state] = localIndex++;
+    }
+
+    // Build the dense system (I - A) * x = b', where b' also contains the contributions of the states outside of the SCC.
+    denseMatrix.assign(n * n, storm::utility::zero<ValueType>());
+    rightHandSide.resize(n);
+    localIndex = 0;
+    for (auto state : scc) {
+        ValueType* row = denseMatrix.data() + localIndex * n;
+        row[localIndex] = storm::utility::one<ValueType>();
+        ValueType& rhs = rightHandSide[localIndex];
+        rhs = b[state];
+        for (auto const& entry : matrix.getRow(state)) {
+            uint64_t const column = localIndices[entry.getColumn()];
+            if (column == numberOfStates) {
+                rhs += entry.getValue() * x[entry.getColumn()];
+            } else {
+                row[column] -= entry.getValue();
+            }
+        }
+        ++localIndex;
+    }
+    for (auto state : scc) {
+        localIndices[state] = numberOfStates;
+    }
+
+    // Gaussian elimination with row pivoting. For floating point numbers, we pick the pivot with the largest magnitude. Since most entries
+    // of the (sparse) SCC systems are zero, rows that have no entry in the pivot column are skipped.
+    for (uint64_t pivotColumn = 0; pivotColumn < n; ++pivotColumn) {
+        uint64_t pivotRow = n;
+        if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+            for (uint64_t row = pivotColumn; row < n; ++row) {
+                if (!storm::utility::isZero(denseMatrix[row * n + pivotColumn])) {
+                    pivotRow = row;
+                    break;
+                }
+            }
+        } else {
+            ValueType largestMagnitude = storm::utility::zero<ValueType>();
+            for (uint64_t row = pivotColumn; row < n; ++row) {
+                ValueType magnitude = storm::utility::abs(denseMatrix[row * n + pivotColumn]);
+                if (magnitude > largestMagnitude) {
+                    largestMagnitude = magnitude;
+                    pivotRow = row;
+                }
+            }
+        }
+        if (pivotRow == n) {
+            STORM_LOG_DEBUG("The equation system of an SCC with " << n << " states is singular.");
+            return false;
+        }
+        if (pivotRow != pivotColumn) {
+            std::swap_ranges(denseMatrix.begin() + pivotRow * n + pivotColumn, denseMatrix.begin() + (pivotRow + 1) * n,
+                             denseMatrix.begin() + pivotColumn * n + pivotColumn);
+            std::swap(rightHandSide[pivotRow], rightHandSide[pivotColumn]);
+        }
+        ValueType const* pivotRowValues = denseMatrix.data() + pivotColumn * n;
+        for (uint64_t row = pivotColumn + 1; row < n; ++row) {
+            ValueType* rowValues = denseMatrix.data() + row * n;
+            if (storm::utility::isZero(rowValues[pivotColumn])) {
+                continue;
+            }
+            ValueType const factor = rowValues[pivotColumn] / pivotRowValues[pivotColumn];
+            rowValues[pivotColumn] = storm::utility::zero<ValueType>();
+            for (uint64_t column = pivotColumn + 1; column < n; ++column) {
+                if (!storm::utility::isZero(pivotRowValues[column])) {
+                    rowValues[column] -= factor * pivotRowValues[column];
+                }
+            }
+            rightHandSide[row] -= factor * rightHandSide[pivotColumn];
+        }
+    }
+
+    // Back substitution.
+    for (uint64_t row = n; row > 0;) {
+        --row;
+        ValueType const* rowValues = denseMatrix.data() + row * n;
+        ValueType& value = rightHandSide[row];
+        for (uint64_t column = row + 1; column < n; ++column) {
+            if (!storm::utility::isZero(rowValues[column])) {
+                value -= rowValues[column] * rightHandSide[column];
+            }
+        }
+        value /= rowValues[row];
+    }
+
+    localIndex = 0;
+    for (auto state : scc) {
+        x[state] = std::move(rightHandSide[localIndex++]);
+    }
+    return true;
+}
+
+template class DenseSccSolver<double>;
+
+#ifdef STORM_HAVE_CARL
+template class DenseSccSolver<storm::RationalNumber>;
+template class DenseSccSolver<storm::RationalFunction>;
+#endif
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
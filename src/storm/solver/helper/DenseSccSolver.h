@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+class StateBlock;
+}  // namespace storage
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Solves the equation system x = A*x + b restricted to the states of a (small) SCC with Gaussian elimination on a dense copy of the
+ * system matrix. The values of all states outside of the SCC are taken from x. In contrast to invoking a linear equation solver, neither
+ * the submatrix of the SCC nor the right-hand side have to be built as sparse objects and the memory of the dense matrix is reused for
+ * all SCCs solved with the same object. This makes solving many small SCCs considerably cheaper.
+ */
+template<typename ValueType>
+class DenseSccSolver {
+   public:
+    /*!
+     * Solves the equation system of the given SCC.
+     *
+     * @param matrix The matrix A of the (fixed point) equation system x = A*x + b.
+     * @param scc The states of the SCC.
+     * @param x The solution vector. The values of the states outside of the SCC have to be final. If the equation system of the SCC has a
+     * unique solution, the values of the SCC states are set accordingly.
+     * @param b The right-hand side of the equation system.
+     * @return False iff the equation system of the SCC does not have a unique solution (in which case x is not changed).
+     */
+    bool solve(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StateBlock const& scc, std::vector<ValueType>& x,
+               std::vector<ValueType> const& b);
+
+   private:
+    // The position of each state of the matrix within the current SCC (or the number of states of the matrix if it is not contained).
+    std::vector<uint64_t> localIndices;
+
+    // The row-major dense system matrix I - A of the current SCC and its right-hand side.
+    std::vector<ValueType> denseMatrix;
+    std::vector<ValueType> rightHandSide;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -4,8 +4,11 @@
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/utility/Extremum.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm::solver::helper {
@@ -53,32 +56,72 @@ class IIBackend {
     storm::utility::Extremum<Dir, ValueType> xBest, yBest;
 };
 
+/*!
+ * Backend for iterating only one of the two bounds. As the lower and the upper bound do not depend on each other, the two bounds can be
+ * iterated concurrently, each with its own backend.
+ * @tparam LowerBound whether the values are lower bounds (that may only increase) or upper bounds (that may only decrease)
+ */
+template<typename ValueType, OptimizationDirection Dir, bool LowerBound>
+class IIBoundBackend {
+   public:
+    void startNewIteration() {}
+
+    void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best &= std::move(value);
+    }
+
+    void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if constexpr (LowerBound) {
+            currValue = std::max(currValue, *best);
+        } else {
+            currValue = std::min(currValue, *best);
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool constexpr converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+    void merge([[maybe_unused]] IIBoundBackend const& other) {
+        // intentionally left empty.
+    }
+
+   private:
+    storm::utility::Extremum<Dir, ValueType> best;
+};
+
+template<typename ValueType>
+bool isPrecise(ValueType const& l, ValueType const& u, bool relative, ValueType const& precision) {
+    if (!relative) {
+        return u - l <= precision;
+    }
+    if (l > storm::utility::zero<ValueType>()) {
+        return (u - l) <= l * precision;
+    } else if (u < storm::utility::zero<ValueType>()) {
+        return (l - u) >= u * precision;
+    } else {  //  l <= 0 <= u
+        return l == u;
+    }
+}
+
 template<typename ValueType>
 bool checkConvergence(std::pair<std::vector<ValueType>, std::vector<ValueType>> const& xy, uint64_t& convergenceCheckState,
                       std::function<void()> const& getNextConvergenceCheckState, bool relative, ValueType const& precision) {
-    if (relative) {
-        for (; convergenceCheckState < xy.first.size(); getNextConvergenceCheckState()) {
-            ValueType const& l = xy.first[convergenceCheckState];
-            ValueType const& u = xy.second[convergenceCheckState];
-            if (l > storm::utility::zero<ValueType>()) {
-                if ((u - l) > l * precision) {
-                    return false;
-                }
-            } else if (u < storm::utility::zero<ValueType>()) {
-                if ((l - u) < u * precision) {
-                    return false;
-                }
-            } else {  //  l <= 0 <= u
-                if (l != u) {
-                    return false;
-                }
-            }
-        }
-    } else {
-        for (; convergenceCheckState < xy.first.size(); getNextConvergenceCheckState()) {
-            if (xy.second[convergenceCheckState] - xy.first[convergenceCheckState] > precision) {
-                return false;
-            }
+    for (; convergenceCheckState < xy.first.size(); getNextConvergenceCheckState()) {
+        if (!isPrecise(xy.first[convergenceCheckState], xy.second[convergenceCheckState], relative, precision)) {
+            return false;
         }
     }
     return true;
@@ -103,6 +146,37 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pai
     } else {
         getNextConvergenceCheckState = [&convergenceCheckState]() { ++convergenceCheckState; };
     }
+    uint64_t const numberOfThreads = viOperator->getNumberOfThreads();
+    if (numberOfThreads > 1) {
+        // Iterate the lower and the upper bound concurrently. Each bound gets half of the threads for its own (block parallel) iteration.
+        // The threads synchronize after every iteration such that convergence can be checked on the gap between the two bounds.
+        IIBoundBackend<ValueType, Dir, true> lowerBackend;
+        IIBoundBackend<ValueType, Dir, false> upperBackend;
+        viOperator->setNumberOfThreads(std::max<uint64_t>(numberOfThreads / 2, 1));
+        try {
+            while (status == SolverStatus::InProgress) {
+                ++numIterations;
+                storm::utility::parallel::forEachChunk(2, 2, 1, [&](uint64_t, uint64_t bound, uint64_t) {
+                    if (bound == 0) {
+                        viOperator->template applyInPlace(xy.first, offsets, lowerBackend);
+                    } else {
+                        viOperator->template applyInPlace(xy.second, offsets, upperBackend);
+                    }
+                });
+                if (checkConvergence(xy, convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
+                    status = SolverStatus::Converged;
+                } else if (iterationCallback) {
+                    status = iterationCallback(IIData<ValueType>({xy.first, xy.second, status}));
+                }
+            }
+        } catch (...) {
+            viOperator->setNumberOfThreads(numberOfThreads);
+            throw;
+        }
+        viOperator->setNumberOfThreads(numberOfThreads);
+        return status;
+    }
+
     while (status == SolverStatus::InProgress) {
         ++numIterations;
         viOperator->template applyInPlace(xy, offsets, backend);
@@ -116,13 +190,10 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pai
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets,
-                                                                        uint64_t& numIterations, bool relative, ValueType const& precision,
-                                                                        std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
-                                                                        std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
-                                                                        std::optional<storm::OptimizationDirection> const& dir,
-                                                                        std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::solveOnOperand(
+    std::vector<ValueType>& operand, std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+    std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+    std::function<SolverStatus(std::pair<std::vector<ValueType>, std::vector<ValueType>>&)> const& iterate) const {
     // Create two vectors x and y using the given operand plus an auxiliary vector.
     std::pair<std::vector<ValueType>, std::vector<ValueType>> xy;
     auto& auxVector = viOperator->allocateAuxiliaryVector(operand.size());
@@ -130,16 +201,7 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     xy.second.swap(auxVector);
     prepareLowerBounds(xy.first);
     prepareUpperBounds(xy.second);
-    auto doublePrec = precision + precision;
-    if constexpr (std::is_same_v<ValueType, double>) {
-        doublePrec -= precision * 1e-6;  // be slightly more precise to avoid a good chunk of floating point issues
-    }
-    SolverStatus status;
-    if (!dir.has_value() || maximize(*dir)) {
-        status = II<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
-    } else {
-        status = II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
-    }
+    SolverStatus status = iterate(xy);
     auto two = storm::utility::convertNumber<ValueType>(2.0);
     // get the average of lower- and upper result
     storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
@@ -151,6 +213,176 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     return status;
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets,
+                                                                        uint64_t& numIterations, bool relative, ValueType const& precision,
+                                                                        std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                                                                        std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+                                                                        std::optional<storm::OptimizationDirection> const& dir,
+                                                                        std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+    return solveOnOperand(operand, prepareLowerBounds, prepareUpperBounds, [&](std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy) {
+        if (!dir.has_value() || maximize(*dir)) {
+            return II<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+        } else {
+            return II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+        }
+    });
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<OptimizationDirection Dir>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::IIWithDecisions(
+    std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& offsets,
+    uint64_t& numIterations, bool relative, ValueType const& precision, std::function<bool(ValueType const&, ValueType const&)> const& isDecided,
+    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback, std::optional<storm::storage::BitVector> const& relevantValues) const {
+    uint64_t const numberOfStates = xy.first.size();
+    storm::storage::BitVector const relevantStates = relevantValues ? *relevantValues : storm::storage::BitVector(numberOfStates, true);
+    storm::storage::BitVector decidedStates(numberOfStates, false);
+
+    // The iterated (sub)system. Initially, this is the full system. After dropping decided states, the states of the subsystem are the
+    // active states (in ascending order) and their bounds are stored in subXY.
+    storm::storage::BitVector activeStates(numberOfStates, true);
+    std::vector<uint64_t> activeToState;
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> activeOperator = viOperator;
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> subXY, subOffsets;
+    bool isSubsystem = false;
+    bool mayDropStates = true;
+    storm::storage::BitVector activeRelevantStates = relevantStates;
+    storm::storage::BitVector activeDecidedStates = decidedStates;
+    uint64_t numberOfActiveDecidedStates = 0;
+    ValueType previousGapSum = storm::utility::zero<ValueType>();
+
+    auto writeBackSubsystemBounds = [&]() {
+        for (uint64_t activeState = 0; activeState < activeToState.size(); ++activeState) {
+            xy.first[activeToState[activeState]] = subXY.first[activeState];
+            xy.second[activeToState[activeState]] = subXY.second[activeState];
+        }
+    };
+
+    IIBackend<ValueType, Dir> backend;
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        auto& activeXY = isSubsystem ? subXY : xy;
+        if (isSubsystem) {
+            activeOperator->template applyInPlace(activeXY, subOffsets, backend);
+        } else {
+            activeOperator->template applyInPlace(activeXY, offsets, backend);
+        }
+
+        // The bounds only get tighter, so states remain decided once they are.
+        bool allDecided = true;
+        bool allDecidedOrPrecise = true;
+        ValueType gapSum = storm::utility::zero<ValueType>();
+        for (auto activeState : activeRelevantStates) {
+            if (activeDecidedStates.get(activeState)) {
+                continue;
+            }
+            ValueType const& l = activeXY.first[activeState];
+            ValueType const& u = activeXY.second[activeState];
+            if (isDecided(l, u)) {
+                activeDecidedStates.set(activeState);
+                decidedStates.set(isSubsystem ? activeToState[activeState] : activeState);
+                ++numberOfActiveDecidedStates;
+                continue;
+            }
+            allDecided = false;
+            allDecidedOrPrecise &= isPrecise(l, u, relative, precision);
+            gapSum += u - l;
+        }
+        if (allDecided) {
+            status = SolverStatus::TerminatedEarly;
+            break;
+        } else if (allDecidedOrPrecise) {
+            status = SolverStatus::Converged;
+            break;
+        }
+
+        if (isSubsystem && previousGapSum - gapSum <= (relative ? gapSum * precision : precision)) {
+            // The bounds of the undecided states stagnate, which can happen if they depend on the (frozen) bounds of decided states that
+            // are not sufficiently precise. Hence, we continue on the full system.
+            writeBackSubsystemBounds();
+            activeOperator = viOperator;
+            activeToState.clear();
+            subXY = {};
+            subOffsets = {};
+            isSubsystem = false;
+            mayDropStates = false;
+            activeStates = storm::storage::BitVector(numberOfStates, true);
+            activeRelevantStates = relevantStates;
+            activeDecidedStates = decidedStates;
+        } else if (mayDropStates && numberOfActiveDecidedStates * 8 >= (isSubsystem ? activeToState.size() : numberOfStates)) {
+            // At least an eighth of the iterated states got decided, so we continue on the subsystem of the undecided states.
+            if (isSubsystem) {
+                writeBackSubsystemBounds();
+            }
+            activeStates &= ~decidedStates;
+            auto submatrix = matrix.getSubmatrix(!TrivialRowGrouping, activeStates, activeStates);
+            activeToState.assign(activeStates.begin(), activeStates.end());
+            subXY.first.resize(activeToState.size());
+            subXY.second.resize(activeToState.size());
+            storm::utility::vector::selectVectorValues(subXY.first, activeStates, xy.first);
+            storm::utility::vector::selectVectorValues(subXY.second, activeStates, xy.second);
+            // Transitions into dropped states are taken into account via the offsets.
+            subOffsets.first.clear();
+            subOffsets.second.clear();
+            subOffsets.first.reserve(submatrix.getRowCount());
+            subOffsets.second.reserve(submatrix.getRowCount());
+            for (auto state : activeStates) {
+                uint64_t const endRow = TrivialRowGrouping ? state + 1 : matrix.getRowGroupIndices()[state + 1];
+                for (uint64_t row = TrivialRowGrouping ? state : matrix.getRowGroupIndices()[state]; row < endRow; ++row) {
+                    ValueType lowerOffset = offsets[row];
+                    ValueType upperOffset = offsets[row];
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (!activeStates.get(entry.getColumn())) {
+                            lowerOffset += entry.getValue() * xy.first[entry.getColumn()];
+                            upperOffset += entry.getValue() * xy.second[entry.getColumn()];
+                        }
+                    }
+                    subOffsets.first.push_back(std::move(lowerOffset));
+                    subOffsets.second.push_back(std::move(upperOffset));
+                }
+            }
+            activeOperator = std::make_shared<ValueIterationOperator<ValueType, TrivialRowGrouping>>();
+            activeOperator->setMatrixBackwards(submatrix);
+            activeOperator->setNumberOfThreads(viOperator->getNumberOfThreads());
+            activeRelevantStates = relevantStates % activeStates;
+            activeDecidedStates = storm::storage::BitVector(activeToState.size(), false);
+            numberOfActiveDecidedStates = 0;
+            isSubsystem = true;
+            STORM_LOG_TRACE("Interval iteration continues on " << activeToState.size() << " undecided states after " << numIterations << " iterations.");
+        }
+        previousGapSum = std::move(gapSum);
+
+        if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    if (isSubsystem) {
+        writeBackSubsystemBounds();
+    }
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::IIWithDecisions(
+    std::vector<ValueType>& operand, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+    bool relative, ValueType const& precision, std::function<bool(ValueType const&, ValueType const&)> const& isDecided,
+    std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds, std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+    std::optional<storm::OptimizationDirection> const& dir, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+    std::optional<storm::storage::BitVector> const& relevantValues) const {
+    return solveOnOperand(operand, prepareLowerBounds, prepareUpperBounds, [&](std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy) {
+        if (!dir.has_value() || maximize(*dir)) {
+            return IIWithDecisions<OptimizationDirection::Maximize>(xy, matrix, offsets, numIterations, relative, precision, isDecided, iterationCallback,
+                                                                    relevantValues);
+        } else {
+            return IIWithDecisions<OptimizationDirection::Minimize>(xy, matrix, offsets, numIterations, relative, precision, isDecided, iterationCallback,
+                                                                    relevantValues);
+        }
+    });
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative,
                                                                         ValueType const& precision,
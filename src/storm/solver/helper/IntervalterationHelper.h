@@ -7,6 +7,11 @@
 #include "storm/solver/SolverStatus.h"
 #include "storm/storage/BitVector.h"
 
+namespace storm::storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
 namespace storm::solver::helper {
 
 template<typename ValueType, bool TrivialRowGrouping>
@@ -45,7 +50,44 @@ class IntervalIterationHelper {
                     std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
                     std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
+    /*!
+     * Interval iteration for queries that compare the value of each relevant state with a threshold. A relevant state is decided once its
+     * bounds lie on one side of the threshold. Decided states keep their (sound) bounds and are dropped from further sweeps: whenever
+     * sufficiently many states are decided, the iteration continues on the subsystem of undecided states, where the transitions into decided
+     * states are folded into the offsets. Should the bounds of this subsystem stagnate before all relevant states are decided or precise,
+     * the iteration falls back to the full system.
+     *
+     * @param matrix The matrix of the equation system, i.e., the matrix that the operator of this helper has been created for.
+     * @param isDecided Returns true iff the comparison with the threshold is decided for a value between the given lower and upper bound.
+     * @param iterationCallback Called after every iteration that does not terminate with the current status.
+     * @param relevantValues The states whose comparison with the threshold needs to be decided. If not given, all states are relevant.
+     * @return TerminatedEarly if all relevant states are decided, Converged if all relevant states are decided or have precise bounds
+     */
+    template<OptimizationDirection Dir>
+    SolverStatus IIWithDecisions(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                 std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                                 std::function<bool(ValueType const&, ValueType const&)> const& isDecided,
+                                 std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                                 std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+
+    SolverStatus IIWithDecisions(std::vector<ValueType>& operand, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& offsets,
+                                 uint64_t& numIterations, bool relative, ValueType const& precision,
+                                 std::function<bool(ValueType const&, ValueType const&)> const& isDecided,
+                                 std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                                 std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+                                 std::optional<storm::OptimizationDirection> const& dir = {},
+                                 std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                                 std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+
    private:
+    /*!
+     * Runs the given interval iteration on a lower and an upper bound vector that are prepared from the given operand. Afterwards, the
+     * operand holds the average of both bounds.
+     */
+    SolverStatus solveOnOperand(std::vector<ValueType>& operand, std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                                std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+                                std::function<SolverStatus(std::pair<std::vector<ValueType>, std::vector<ValueType>>&)> const& iterate) const;
+
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
 };
 
@@ -1,5 +1,8 @@
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <type_traits>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -58,6 +61,10 @@ class GSVIBackend {
         return false;
     }
 
+    void merge(GSVIBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
@@ -172,6 +179,13 @@ class OVIBackend {
         return *errorValue;
     }
 
+    void merge(OVIBackend const& other) {
+        isAllUp &= other.isAllUp;
+        isAllDown &= other.isAllDown;
+        crossed |= other.crossed;
+        errorValue &= other.errorValue;
+    }
+
    private:
     bool isAllUp{true};
     bool isAllDown{true};
@@ -193,6 +207,9 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
     ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    if (viOperator->getNumberOfThreads() > 1) {
+        return concurrentOVI<Dir, Relative>(vu, offsets, numIterations, precision, guessValue, lowerBound, upperBound, iterationCallback);
+    }
     ValueType currentGuessValue = guessValue;
     for (uint64_t numTries = 1; true; ++numTries) {
         if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback);
@@ -232,6 +249,124 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     }
 }
 
+template<typename ValueType>
+uint64_t getMaximalNumberOfVerificationIterations(ValueType const& guessValue) {
+    if (storm::utility::isZero(guessValue)) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return storm::utility::convertNumber<uint64_t, ValueType>(storm::utility::ceil<ValueType>(storm::utility::one<ValueType>() / guessValue));
+}
+
+/*!
+ * The verification of a guessed upper bound that runs on its own thread.
+ */
+template<typename ValueType>
+struct OVIVerification {
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> vu;
+    std::atomic<bool> cancelled{false};
+    uint64_t numIterations{0};
+    std::optional<ValueType> error;
+    std::future<bool> verified;
+};
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<OptimizationDirection Dir, bool Relative>
+SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::concurrentOVI(
+    std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
+    ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
+    std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    std::unique_ptr<OVIVerification<ValueType>> verification;
+    auto verify = [this, &offsets](OVIVerification<ValueType>& task, uint64_t maxIterations) {
+        OVIBackend<ValueType, Dir, Relative> backend;
+        while (task.numIterations < maxIterations && !task.cancelled.load(std::memory_order_relaxed)) {
+            ++task.numIterations;
+            if (viOperator->template applyInPlace(task.vu, offsets, backend)) {
+                if (backend.allDown()) {
+                    return true;
+                }
+                break;
+            }
+            if (backend.abort()) {
+                break;
+            }
+        }
+        if (task.numIterations > 0) {
+            task.error = backend.error();
+        }
+        return false;
+    };
+    auto startVerification = [&](ValueType const& currentGuessValue) {
+        verification = std::make_unique<OVIVerification<ValueType>>();
+        verification->vu.first = vu.first;
+        verification->vu.second.resize(vu.first.size());
+        guessCandidate<Relative>(verification->vu, precision, lowerBound, upperBound);
+        verification->verified = std::async(std::launch::async, verify, std::ref(*verification), getMaximalNumberOfVerificationIterations(currentGuessValue));
+    };
+    // Waits for the running verification (if any) and returns whether it succeeded.
+    auto finishVerification = [&](bool cancel) {
+        if (cancel) {
+            verification->cancelled = true;
+        }
+        bool verified = verification->verified.get();
+        numIterations += verification->numIterations;
+        return verified;
+    };
+
+    // The verification and the lower iteration each get half of the threads for their own (block parallel) iterations.
+    uint64_t const numberOfThreads = viOperator->getNumberOfThreads();
+    viOperator->setNumberOfThreads(std::max<uint64_t>(numberOfThreads / 2, 1));
+    SolverStatus status{SolverStatus::InProgress};
+    try {
+        ValueType currentGuessValue = guessValue;
+        auto backend = std::make_unique<GSVIBackend<ValueType, Dir, Relative>>(currentGuessValue);
+        for (uint64_t numTries = 0; status == SolverStatus::InProgress;) {
+            ++numIterations;
+            bool lowerIterationConverged = viOperator->template applyInPlace(vu.first, offsets, *backend);
+            if (verification && verification->verified.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                if (finishVerification(false)) {
+                    vu = std::move(verification->vu);
+                    status = SolverStatus::Converged;
+                    break;
+                }
+                // The next guess should be more precise than the error observed during the failed verification.
+                if (verification->error && *verification->error / storm::utility::convertNumber<ValueType, uint64_t>(2u) < currentGuessValue) {
+                    currentGuessValue = *verification->error / storm::utility::convertNumber<ValueType, uint64_t>(2u);
+                    backend = std::make_unique<GSVIBackend<ValueType, Dir, Relative>>(currentGuessValue);
+                }
+                verification.reset();
+            }
+            if (lowerIterationConverged) {
+                // The lower iteration yields a better guess than the one that is currently verified (if any).
+                if (verification && finishVerification(true)) {
+                    // The verification succeeded before it could be cancelled.
+                    vu = std::move(verification->vu);
+                    status = SolverStatus::Converged;
+                    break;
+                }
+                ++numTries;
+                STORM_LOG_WARN_COND(numTries != 20, "Optimistic Value Iteration did not terminate after 20 refinements. It might be stuck.");
+                startVerification(currentGuessValue);
+                currentGuessValue = currentGuessValue / storm::utility::convertNumber<ValueType, uint64_t>(2u);
+                backend = std::make_unique<GSVIBackend<ValueType, Dir, Relative>>(currentGuessValue);
+            } else if (iterationCallback) {
+                status = iterationCallback(status, vu.first);
+            }
+        }
+        if (verification && status != SolverStatus::Converged) {
+            finishVerification(true);
+        }
+    } catch (...) {
+        if (verification && verification->verified.valid()) {
+            verification->cancelled = true;
+            verification->verified.wait();
+        }
+        viOperator->setNumberOfThreads(numberOfThreads);
+        throw;
+    }
+    viOperator->setNumberOfThreads(numberOfThreads);
+    return status;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
@@ -44,6 +44,16 @@ class OptimisticValueIterationHelper {
                      std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
 
    private:
+    /*!
+     * Optimistic value iteration where the verification of a guessed upper bound runs concurrently with the (continued) lower iteration.
+     * Whenever the lower iteration yields a better guess, a running verification is cancelled and restarted with that guess.
+     */
+    template<OptimizationDirection Dir, bool Relative>
+    SolverStatus concurrentOVI(std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                               ValueType const& precision, ValueType const& guessValue, std::optional<ValueType> const& lowerBound,
+                               std::optional<ValueType> const& upperBound,
+                               std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const;
+
     template<storm::OptimizationDirection Dir, bool Relative>
     SolverStatus GSVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
                       std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
@@ -0,0 +1,201 @@
+#include "storm/solver/helper/PolicyEvaluationHelper.h"
+
+#include <algorithm>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+// The number of row groups that a thread processes at once.
+uint64_t const ChunkSize = 4096;
+}  // namespace
+
+template<typename ValueType>
+PolicyEvaluationHelper<ValueType>::PolicyEvaluationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfThreads)
+    : matrix(matrix), numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+template<typename Body>
+void PolicyEvaluationHelper<ValueType>::forEachChunk(Body const& body) const {
+    storm::utility::parallel::forEachChunk(numberOfThreads, matrix.getRowGroupCount(), ChunkSize,
+                                           [&body](uint64_t, uint64_t begin, uint64_t end) { body(begin, end); });
+}
+
+template<typename ValueType>
+void PolicyEvaluationHelper<ValueType>::multiplyWithSystemMatrix(std::vector<uint64_t> const& policy, std::vector<ValueType> const& vector,
+                                                                 std::vector<ValueType>& result) const {
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    forEachChunk([&](uint64_t begin, uint64_t end) {
+        for (uint64_t group = begin; group < end; ++group) {
+            ValueType value = vector[group];
+            for (auto const& entry : matrix.getRow(rowGroupIndices[group] + policy[group])) {
+                value -= entry.getValue() * vector[entry.getColumn()];
+            }
+            result[group] = value;
+        }
+    });
+}
+
+template<typename ValueType>
+ValueType PolicyEvaluationHelper<ValueType>::dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const {
+    partialSums.assign((matrix.getRowGroupCount() + ChunkSize - 1) / ChunkSize, storm::utility::zero<ValueType>());
+    forEachChunk([&](uint64_t begin, uint64_t end) {
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (uint64_t group = begin; group < end; ++group) {
+            sum += first[group] * second[group];
+        }
+        partialSums[begin / ChunkSize] = sum;
+    });
+    ValueType result = storm::utility::zero<ValueType>();
+    for (auto const& sum : partialSums) {
+        result += sum;
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool PolicyEvaluationHelper<ValueType>::solveWithBicgstab(std::vector<uint64_t> const& policy, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                          ValueType const& precision, uint64_t maximalNumberOfIterations) {
+    uint64_t const numberOfRowGroups = matrix.getRowGroupCount();
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (auto vector : {&residual, &initialResidual, &direction, &preconditionedDirection, &v, &s, &preconditionedS, &t, &inverseDiagonal}) {
+        vector->resize(numberOfRowGroups);
+    }
+
+    // Compute the preconditioner and the initial residual r = b^policy - (I - A^policy) * x. The right-hand side is stored in s for now.
+    forEachChunk([&](uint64_t begin, uint64_t end) {
+        for (uint64_t group = begin; group < end; ++group) {
+            uint64_t const row = rowGroupIndices[group] + policy[group];
+            ValueType diagonal = storm::utility::one<ValueType>();
+            for (auto const& entry : matrix.getRow(row)) {
+                if (entry.getColumn() == group) {
+                    diagonal -= entry.getValue();
+                }
+            }
+            inverseDiagonal[group] = storm::utility::isZero(diagonal) ? storm::utility::one<ValueType>() : storm::utility::one<ValueType>() / diagonal;
+            s[group] = b[row];
+        }
+    });
+    multiplyWithSystemMatrix(policy, x, t);
+    forEachChunk([&](uint64_t begin, uint64_t end) {
+        for (uint64_t group = begin; group < end; ++group) {
+            residual[group] = s[group] - t[group];
+            initialResidual[group] = residual[group];
+            direction[group] = storm::utility::zero<ValueType>();
+            v[group] = storm::utility::zero<ValueType>();
+        }
+    });
+
+    // The residual is compared to the norm of the right-hand side (or absolutely, if the right-hand side is zero).
+    ValueType rightHandSideNorm = storm::utility::sqrt(dotProduct(s, s));
+    if (storm::utility::isZero(rightHandSideNorm)) {
+        rightHandSideNorm = storm::utility::one<ValueType>();
+    }
+    ValueType const squaredTolerance = precision * precision * rightHandSideNorm * rightHandSideNorm;
+    if (dotProduct(residual, residual) <= squaredTolerance) {
+        return true;
+    }
+
+    ValueType rho = storm::utility::one<ValueType>();
+    ValueType alpha = storm::utility::one<ValueType>();
+    ValueType omega = storm::utility::one<ValueType>();
+    for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+        ValueType rhoNew = dotProduct(initialResidual, residual);
+        if (storm::utility::isZero(rhoNew)) {
+            // The shadow residual became orthogonal to the residual, so the method is restarted with the current residual.
+            STORM_LOG_TRACE("Restarting BiCGSTAB after " << iteration << " iterations.");
+            initialResidual = residual;
+            std::fill(direction.begin(), direction.end(), storm::utility::zero<ValueType>());
+            std::fill(v.begin(), v.end(), storm::utility::zero<ValueType>());
+            rhoNew = dotProduct(residual, residual);
+            rho = alpha = omega = storm::utility::one<ValueType>();
+        }
+        ValueType const beta = (rhoNew / rho) * (alpha / omega);
+        forEachChunk([&](uint64_t begin, uint64_t end) {
+            for (uint64_t group = begin; group < end; ++group) {
+                direction[group] = residual[group] + beta * (direction[group] - omega * v[group]);
+                preconditionedDirection[group] = inverseDiagonal[group] * direction[group];
+            }
+        });
+        multiplyWithSystemMatrix(policy, preconditionedDirection, v);
+        ValueType const denominator = dotProduct(initialResidual, v);
+        if (storm::utility::isZero(denominator)) {
+            STORM_LOG_WARN("BiCGSTAB broke down after " << iteration << " iterations.");
+            return false;
+        }
+        alpha = rhoNew / denominator;
+        forEachChunk([&](uint64_t begin, uint64_t end) {
+            for (uint64_t group = begin; group < end; ++group) {
+                x[group] += alpha * preconditionedDirection[group];
+                s[group] = residual[group] - alpha * v[group];
+                preconditionedS[group] = inverseDiagonal[group] * s[group];
+            }
+        });
+        if (dotProduct(s, s) <= squaredTolerance) {
+            STORM_LOG_TRACE("BiCGSTAB converged after " << (iteration + 1) << " iterations.");
+            return true;
+        }
+        multiplyWithSystemMatrix(policy, preconditionedS, t);
+        ValueType const squaredNormOfT = dotProduct(t, t);
+        if (storm::utility::isZero(squaredNormOfT)) {
+            STORM_LOG_WARN("BiCGSTAB broke down after " << iteration << " iterations.");
+            return false;
+        }
+        omega = dotProduct(t, s) / squaredNormOfT;
+        forEachChunk([&](uint64_t begin, uint64_t end) {
+            for (uint64_t group = begin; group < end; ++group) {
+                x[group] += omega * preconditionedS[group];
+                residual[group] = s[group] - omega * t[group];
+            }
+        });
+        if (dotProduct(residual, residual) <= squaredTolerance) {
+            STORM_LOG_TRACE("BiCGSTAB converged after " << (iteration + 1) << " iterations.");
+            return true;
+        }
+        if (storm::utility::isZero(omega)) {
+            STORM_LOG_WARN("BiCGSTAB stagnated after " << iteration << " iterations.");
+            return false;
+        }
+        rho = rhoNew;
+    }
+    STORM_LOG_WARN("BiCGSTAB did not converge within " << maximalNumberOfIterations << " iterations.");
+    return false;
+}
+
+template<typename ValueType>
+ValueType PolicyEvaluationHelper<ValueType>::performSweeps(std::vector<uint64_t> const& policy, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                           uint64_t numberOfSweeps, bool relative) const {
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    ValueType maximalChange = storm::utility::zero<ValueType>();
+    for (uint64_t sweep = 0; sweep < numberOfSweeps; ++sweep) {
+        maximalChange = storm::utility::zero<ValueType>();
+        for (uint64_t group = 0; group < x.size(); ++group) {
+            uint64_t const row = rowGroupIndices[group] + policy[group];
+            ValueType value = b[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                value += entry.getValue() * x[entry.getColumn()];
+            }
+            ValueType change = storm::utility::abs<ValueType>(value - x[group]);
+            if (relative && !storm::utility::isZero(value)) {
+                change /= storm::utility::abs<ValueType>(value);
+            }
+            maximalChange = std::max(maximalChange, change);
+            x[group] = std::move(value);
+        }
+    }
+    return maximalChange;
+}
+
+template class PolicyEvaluationHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Evaluates policies of a min-max equation system x = min/max (A*x + b) without building the matrix induced by the policy. Instead, the
+ * rows that are selected by the policy are accessed directly in A. This allows to evaluate a policy by solving the induced equation
+ * system (I - A^policy) * x = b^policy with a (multi-threaded) Jacobi-preconditioned BiCGSTAB or to approximate its value with a few
+ * Gauss-Seidel sweeps (as done by modified policy iteration). In both cases, the given vector x serves as initial guess, so the values of
+ * the previous policy are used as warm start.
+ */
+template<typename ValueType>
+class PolicyEvaluationHelper {
+   public:
+    /*!
+     * @param matrix The matrix A of the min-max equation system.
+     * @param numberOfThreads The number of threads used for the vector operations of BiCGSTAB.
+     */
+    PolicyEvaluationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfThreads);
+
+    /*!
+     * Solves the equation system induced by the given policy with BiCGSTAB.
+     *
+     * @param policy The chosen row (relative to its row group) for every row group.
+     * @param x The initial guess. Afterwards, contains the solution.
+     * @param b The right-hand side of the min-max equation system (one value per row).
+     * @param precision BiCGSTAB stops as soon as the norm of the residual is at most precision times the norm of the right-hand side.
+     * @param maximalNumberOfIterations The maximal number of BiCGSTAB iterations.
+     * @return True iff the residual is sufficiently small.
+     */
+    bool solveWithBicgstab(std::vector<uint64_t> const& policy, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision,
+                           uint64_t maximalNumberOfIterations);
+
+    /*!
+     * Performs the given number of Gauss-Seidel sweeps over the equation system induced by the given policy.
+     *
+     * @param policy The chosen row (relative to its row group) for every row group.
+     * @param x The initial values. Afterwards, contains the values after the last sweep.
+     * @param b The right-hand side of the min-max equation system (one value per row).
+     * @param relative Whether the returned change is relative to the new value (if that is non-zero).
+     * @return The maximal change of a value in the last sweep.
+     */
+    ValueType performSweeps(std::vector<uint64_t> const& policy, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfSweeps,
+                            bool relative) const;
+
+   private:
+    // Computes result = (I - A^policy) * vector.
+    void multiplyWithSystemMatrix(std::vector<uint64_t> const& policy, std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+
+    // Computes the scalar product of the given vectors.
+    ValueType dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const;
+
+    // Applies the body to the chunks of the row groups (in parallel).
+    template<typename Body>
+    void forEachChunk(Body const& body) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    uint64_t numberOfThreads;
+
+    // The inverse of the diagonal of the system matrix (the Jacobi preconditioner) for the policy it was last computed for.
+    std::vector<ValueType> inverseDiagonal;
+
+    // Auxiliary vectors of BiCGSTAB.
+    std::vector<ValueType> residual, initialResidual, direction, preconditionedDirection, v, s, preconditionedS, t;
+    // Partial sums of the scalar products (one per chunk), such that the result does not depend on the scheduling of the threads.
+    mutable std::vector<ValueType> partialSums;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,152 @@
+#include "storm/solver/helper/SccTaskGraph.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+SccTaskGraph<ValueType>::SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                      storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, uint64_t maximalBatchSize) {
+    uint64_t const numberOfSccs = sccDecomposition.size();
+    std::vector<uint64_t> stateToScc(matrix.getRowGroupCount());
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto state : sccDecomposition.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+
+    // Compute the length of the longest chain of SCCs that each SCC depends on. As the SCCs are sorted topologically, all SCCs an SCC
+    // depends on have been treated before.
+    std::vector<uint64_t> chainLengths(numberOfSccs, 0);
+    uint64_t maximalChainLength = 0;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        uint64_t& chainLength = chainLengths[sccIndex];
+        for (auto state : sccDecomposition.getBlock(sccIndex)) {
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                uint64_t const successorScc = stateToScc[entry.getColumn()];
+                if (successorScc != sccIndex) {
+                    STORM_LOG_ASSERT(successorScc < sccIndex, "The SCCs are not sorted topologically.");
+                    chainLength = std::max(chainLength, chainLengths[successorScc] + 1);
+                }
+            }
+        }
+        maximalChainLength = std::max(maximalChainLength, chainLength);
+    }
+
+    // Sort the small SCCs by their chain length and cut them into batches.
+    std::vector<uint64_t> chainLengthStarts(maximalChainLength + 2, 0);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (sccDecomposition.getBlock(sccIndex).size() < maximalBatchSize) {
+            ++chainLengthStarts[chainLengths[sccIndex] + 1];
+        }
+    }
+    for (uint64_t chainLength = 1; chainLength < chainLengthStarts.size(); ++chainLength) {
+        chainLengthStarts[chainLength] += chainLengthStarts[chainLength - 1];
+    }
+    taskSccs.resize(chainLengthStarts.back());
+    {
+        std::vector<uint64_t> nextPositions(chainLengthStarts.begin(), chainLengthStarts.end() - 1);
+        for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+            if (sccDecomposition.getBlock(sccIndex).size() < maximalBatchSize) {
+                taskSccs[nextPositions[chainLengths[sccIndex]]++] = sccIndex;
+            }
+        }
+    }
+    uint64_t statesInBatch = 0;
+    for (uint64_t position = 0; position < taskSccs.size(); ++position) {
+        uint64_t const sccSize = sccDecomposition.getBlock(taskSccs[position]).size();
+        if (position == 0 || chainLengths[taskSccs[position]] != chainLengths[taskSccs[position - 1]] || statesInBatch + sccSize > maximalBatchSize) {
+            taskStarts.push_back(position);
+            largeSccTasks.push_back(false);
+            statesInBatch = 0;
+        }
+        statesInBatch += sccSize;
+    }
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (sccDecomposition.getBlock(sccIndex).size() >= maximalBatchSize) {
+            taskStarts.push_back(taskSccs.size());
+            taskSccs.push_back(sccIndex);
+            largeSccTasks.push_back(true);
+        }
+    }
+    taskStarts.push_back(taskSccs.size());
+    uint64_t const numberOfTasks = getNumberOfTasks();
+
+    // Compute the dependencies between the tasks.
+    std::vector<uint64_t> sccToTask(numberOfSccs);
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        for (uint64_t position = taskStarts[task]; position < taskStarts[task + 1]; ++position) {
+            sccToTask[taskSccs[position]] = task;
+        }
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+    std::vector<uint64_t> predecessors;
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        predecessors.clear();
+        for (uint64_t position = taskStarts[task]; position < taskStarts[task + 1]; ++position) {
+            for (auto state : sccDecomposition.getBlock(taskSccs[position])) {
+                for (auto const& entry : matrix.getRowGroup(state)) {
+                    uint64_t const predecessor = sccToTask[stateToScc[entry.getColumn()]];
+                    if (predecessor != task) {
+                        predecessors.push_back(predecessor);
+                    }
+                }
+            }
+        }
+        std::sort(predecessors.begin(), predecessors.end());
+        predecessors.erase(std::unique(predecessors.begin(), predecessors.end()), predecessors.end());
+        for (auto predecessor : predecessors) {
+            dependencies.emplace_back(predecessor, task);
+        }
+    }
+    std::sort(dependencies.begin(), dependencies.end());
+    successorStarts.assign(numberOfTasks + 1, 0);
+    successors.reserve(dependencies.size());
+    for (auto const& dependency : dependencies) {
+        ++successorStarts[dependency.first + 1];
+        successors.push_back(dependency.second);
+    }
+    for (uint64_t task = 1; task <= numberOfTasks; ++task) {
+        successorStarts[task] += successorStarts[task - 1];
+    }
+
+    STORM_LOG_INFO("Grouped " << numberOfSccs << " SCCs into " << numberOfTasks << " tasks with " << successors.size() << " dependencies.");
+}
+
+template<typename ValueType>
+uint64_t SccTaskGraph<ValueType>::getNumberOfTasks() const {
+    return taskStarts.size() - 1;
+}
+
+template<typename ValueType>
+std::vector<uint64_t>::const_iterator SccTaskGraph<ValueType>::sccsBegin(uint64_t task) const {
+    return taskSccs.begin() + taskStarts[task];
+}
+
+template<typename ValueType>
+std::vector<uint64_t>::const_iterator SccTaskGraph<ValueType>::sccsEnd(uint64_t task) const {
+    return taskSccs.begin() + taskStarts[task + 1];
+}
+
+template<typename ValueType>
+bool SccTaskGraph<ValueType>::isLargeScc(uint64_t task) const {
+    return largeSccTasks[task];
+}
+
+template class SccTaskGraph<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SccTaskGraph<storm::RationalNumber>;
+template class SccTaskGraph<storm::RationalFunction>;
+#endif
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/utility/parallel.h"
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+}  // namespace storage
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Groups the SCCs of an equation system into tasks that can be solved concurrently and computes the dependencies between these tasks.
+ *
+ * SCCs with less than the given number of states are batched: Each SCC is assigned the length of the longest chain of SCCs it depends
+ * on, and a batch contains (up to the given number of states of) small SCCs with the same chain length. As SCCs with the same chain
+ * length do not depend on each other, the SCCs of a batch can be solved one after another once the batches they depend on are solved.
+ * Every SCC with at least the given number of states forms a task of its own.
+ */
+template<typename ValueType>
+class SccTaskGraph {
+   public:
+    // The batch size used by the topological solvers.
+    static uint64_t constexpr DefaultMaximalBatchSize = 1024;
+
+    /*!
+     * Creates the tasks for the given SCCs.
+     *
+     * @param matrix The matrix of the equation system. The SCCs are formed by row groups.
+     * @param sccDecomposition The SCC decomposition of the matrix, sorted topologically such that each SCC only depends on SCCs before it.
+     * @param maximalBatchSize The maximal number of states of the SCCs that are batched into a single task.
+     */
+    SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix,
+                 storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, uint64_t maximalBatchSize);
+
+    uint64_t getNumberOfTasks() const;
+
+    /*!
+     * Retrieves the indices of the SCCs of the given task (with respect to the SCC decomposition).
+     */
+    std::vector<uint64_t>::const_iterator sccsBegin(uint64_t task) const;
+    std::vector<uint64_t>::const_iterator sccsEnd(uint64_t task) const;
+
+    /*!
+     * Retrieves whether the given task consists of a single SCC with at least the maximal batch size many states.
+     */
+    bool isLargeScc(uint64_t task) const;
+
+    /*!
+     * Executes the given body once for every task, such that a task is only started once all tasks it depends on are finished.
+     *
+     * @param body A callable with signature void(uint64_t threadIndex, uint64_t task).
+     */
+    template<typename Body>
+    void execute(uint64_t numberOfThreads, Body const& body) const {
+        storm::utility::parallel::forEachInDag(numberOfThreads, successorStarts, successors, body);
+    }
+
+   private:
+    // The SCCs of task i are taskSccs[taskStarts[i]], ..., taskSccs[taskStarts[i + 1] - 1].
+    std::vector<uint64_t> taskStarts;
+    std::vector<uint64_t> taskSccs;
+    std::vector<bool> largeSccTasks;
+
+    // The tasks that depend on task i are successors[successorStarts[i]], ..., successors[successorStarts[i + 1] - 1].
+    std::vector<uint64_t> successorStarts;
+    std::vector<uint64_t> successors;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
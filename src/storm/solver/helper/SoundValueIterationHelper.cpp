@@ -34,9 +34,9 @@ class SVIBackend {
     static const SVIStage CurrentStage = Stage;
     using RowValueStorageType = std::vector<std::pair<ValueType, ValueType>>;
 
-    SVIBackend(RowValueStorageType& rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
+    SVIBackend(RowValueStorageType rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
                std::optional<ValueType> const& d = {})
-        : currRowValues(rowValueStorage) {
+        : currRowValues(std::move(rowValueStorage)) {
         if (a.has_value()) {
             aValue &= *a;
         }
@@ -188,6 +188,13 @@ class SVIBackend {
         return nextStage;
     }
 
+    void merge(SVIBackend const& other) {
+        allYLessOne &= other.allYLessOne;
+        curr_a &= other.curr_a;
+        curr_b &= other.curr_b;
+        dValue &= other.dValue;
+    }
+
    private:
     static bool better(ValueType const& lhs, ValueType const& rhs) {
         if constexpr (minimize(Dir)) {
@@ -211,7 +218,7 @@ class SVIBackend {
 
     std::pair<ValueType, ValueType> best;
     ExtremumDir bestValue;
-    RowValueStorageType& currRowValues;
+    RowValueStorageType currRowValues;
     uint64_t currRowValuesIndex{0};
 };
 
@@ -367,8 +374,8 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
     std::function<SolverStatus(SVIData const&)> const& iterationCallback, std::optional<storm::storage::BitVector> const& relevantValues) const {
     typename SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>::RowValueStorageType rowValueStorage;
     rowValueStorage.resize(sizeOfLargestRowGroup - 1);
-    return SVI(xy, offsets, numIterations, relative, precision, SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(rowValueStorage, a, b),
-               iterationCallback, relevantValues);
+    return SVI(xy, offsets, numIterations, relative, precision,
+               SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(std::move(rowValueStorage), a, b), iterationCallback, relevantValues);
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
@@ -1,5 +1,6 @@
 #include "storm/solver/helper/ValueIterationHelper.h"
 
+#include "storm/adapters/HybridRationalNumber.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
@@ -48,12 +49,82 @@ class VIOperatorBackend {
         return false;
     }
 
+    void merge(VIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
     bool isConverged{true};
 };
 
+template<typename ValueType, storm::OptimizationDirection Dir, bool Relative, uint64_t Lanes>
+class BatchVIOperatorBackend {
+   public:
+    static_assert(Lanes <= 64, "The fixed lanes of a row group are encoded in a 64 bit mask.");
+
+    BatchVIOperatorBackend(ValueType const& precision, std::vector<uint64_t> const* fixedLanes) : precision{precision}, fixedLanes{fixedLanes} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(std::array<ValueType, Lanes>&& values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        for (uint64_t lane = 0; lane < Lanes; ++lane) {
+            best[lane] = std::move(values[lane]);
+        }
+    }
+
+    void nextRow(std::array<ValueType, Lanes>&& values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        for (uint64_t lane = 0; lane < Lanes; ++lane) {
+            best[lane] &= values[lane];
+        }
+    }
+
+    void applyUpdate(std::array<ValueType, Lanes>& currValues, uint64_t rowGroup) {
+        uint64_t const fixed = fixedLanes ? (*fixedLanes)[rowGroup] : 0ull;
+        for (uint64_t lane = 0; lane < Lanes; ++lane) {
+            if ((fixed >> lane) & 1ull) {
+                continue;
+            }
+            ValueType& currValue = currValues[lane];
+            if (isConverged) {
+                if constexpr (Relative) {
+                    isConverged = storm::utility::abs<ValueType>(currValue - *best[lane]) <= storm::utility::abs<ValueType>(precision * currValue);
+                } else {
+                    isConverged = storm::utility::abs<ValueType>(currValue - *best[lane]) <= precision;
+                }
+            }
+            currValue = std::move(*best[lane]);
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+    void merge(BatchVIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
+   private:
+    std::array<storm::utility::Extremum<Dir, ValueType>, Lanes> best;
+    ValueType const precision;
+    std::vector<uint64_t> const* fixedLanes;
+    bool isConverged{true};
+};
+
 template<typename ValueType, bool TrivialRowGrouping>
 ValueIterationHelper<ValueType, TrivialRowGrouping>::ValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator)
     : viOperator(viOperator) {
@@ -127,9 +198,114 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::VI(std::vector
     return VI(operand, offsets, numIterations, relative, precision, dir, iterationCallback, mult);
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+template<storm::OptimizationDirection Dir, bool Relative, uint64_t Lanes>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::batchVI(std::vector<std::array<ValueType, Lanes>>& operand,
+                                                                          std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                                          ValueType const& precision, std::vector<uint64_t> const* fixedLanes,
+                                                                          std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                                                                          MultiplicationStyle mult) const {
+    STORM_LOG_ASSERT(!fixedLanes || fixedLanes->size() == operand.size(), "Unexpected size of the fixed lanes.");
+    BatchVIOperatorBackend<ValueType, Dir, Relative, Lanes> backend{precision, fixedLanes};
+    // The auxiliary vector of the operator only holds single values, so we allocate the second operand ourselves.
+    std::vector<std::array<ValueType, Lanes>> auxiliaryOperand;
+    std::vector<std::array<ValueType, Lanes>>* operand1{&operand};
+    std::vector<std::array<ValueType, Lanes>>* operand2{&operand};
+    if (mult == MultiplicationStyle::Regular) {
+        auxiliaryOperand = operand;
+        operand2 = &auxiliaryOperand;
+    }
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        if (viOperator->template apply(*operand1, *operand2, offsets, backend)) {
+            status = SolverStatus::Converged;
+        } else if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+        if (mult == MultiplicationStyle::Regular) {
+            std::swap(operand1, operand2);
+        }
+    }
+    if (operand1 != &operand) {
+        std::swap(operand, auxiliaryOperand);
+    }
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<uint64_t Lanes>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping>::batchVI(std::vector<std::array<ValueType, Lanes>>& operand,
+                                                                          std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
+                                                                          ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir,
+                                                                          std::vector<uint64_t> const* fixedLanes,
+                                                                          std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                                                                          MultiplicationStyle mult) const {
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            return batchVI<storm::OptimizationDirection::Maximize, true>(operand, offsets, numIterations, precision, fixedLanes, iterationCallback, mult);
+        } else {
+            return batchVI<storm::OptimizationDirection::Maximize, false>(operand, offsets, numIterations, precision, fixedLanes, iterationCallback, mult);
+        }
+    } else {
+        if (relative) {
+            return batchVI<storm::OptimizationDirection::Minimize, true>(operand, offsets, numIterations, precision, fixedLanes, iterationCallback, mult);
+        } else {
+            return batchVI<storm::OptimizationDirection::Minimize, false>(operand, offsets, numIterations, precision, fixedLanes, iterationCallback, mult);
+        }
+    }
+}
+
 template class ValueIterationHelper<double, true>;
 template class ValueIterationHelper<double, false>;
 template class ValueIterationHelper<storm::RationalNumber, true>;
 template class ValueIterationHelper<storm::RationalNumber, false>;
+template class ValueIterationHelper<float, true>;
+template class ValueIterationHelper<float, false>;
+template class ValueIterationHelper<storm::HybridRationalNumber, false>;
+
+template SolverStatus ValueIterationHelper<double, true>::batchVI<2>(
+    std::vector<std::array<double, 2>>&, std::vector<double> const&, uint64_t&, bool, double const&, std::optional<storm::OptimizationDirection> const&,
+    std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&, MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<double, true>::batchVI<4>(
+    std::vector<std::array<double, 4>>&, std::vector<double> const&, uint64_t&, bool, double const&, std::optional<storm::OptimizationDirection> const&,
+    std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&, MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<double, true>::batchVI<8>(
+    std::vector<std::array<double, 8>>&, std::vector<double> const&, uint64_t&, bool, double const&, std::optional<storm::OptimizationDirection> const&,
+    std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&, MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<double, false>::batchVI<2>(
+    std::vector<std::array<double, 2>>&, std::vector<double> const&, uint64_t&, bool, double const&, std::optional<storm::OptimizationDirection> const&,
+    std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&, MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<double, false>::batchVI<4>(
+    std::vector<std::array<double, 4>>&, std::vector<double> const&, uint64_t&, bool, double const&, std::optional<storm::OptimizationDirection> const&,
+    std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&, MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<double, false>::batchVI<8>(
+    std::vector<std::array<double, 8>>&, std::vector<double> const&, uint64_t&, bool, double const&, std::optional<storm::OptimizationDirection> const&,
+    std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&, MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<storm::RationalNumber, true>::batchVI<2>(
+    std::vector<std::array<storm::RationalNumber, 2>>&, std::vector<storm::RationalNumber> const&, uint64_t&, bool, storm::RationalNumber const&,
+    std::optional<storm::OptimizationDirection> const&, std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&,
+    MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<storm::RationalNumber, true>::batchVI<4>(
+    std::vector<std::array<storm::RationalNumber, 4>>&, std::vector<storm::RationalNumber> const&, uint64_t&, bool, storm::RationalNumber const&,
+    std::optional<storm::OptimizationDirection> const&, std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&,
+    MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<storm::RationalNumber, true>::batchVI<8>(
+    std::vector<std::array<storm::RationalNumber, 8>>&, std::vector<storm::RationalNumber> const&, uint64_t&, bool, storm::RationalNumber const&,
+    std::optional<storm::OptimizationDirection> const&, std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&,
+    MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<storm::RationalNumber, false>::batchVI<2>(
+    std::vector<std::array<storm::RationalNumber, 2>>&, std::vector<storm::RationalNumber> const&, uint64_t&, bool, storm::RationalNumber const&,
+    std::optional<storm::OptimizationDirection> const&, std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&,
+    MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<storm::RationalNumber, false>::batchVI<4>(
+    std::vector<std::array<storm::RationalNumber, 4>>&, std::vector<storm::RationalNumber> const&, uint64_t&, bool, storm::RationalNumber const&,
+    std::optional<storm::OptimizationDirection> const&, std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&,
+    MultiplicationStyle) const;
+template SolverStatus ValueIterationHelper<storm::RationalNumber, false>::batchVI<8>(
+    std::vector<std::array<storm::RationalNumber, 8>>&, std::vector<storm::RationalNumber> const&, uint64_t&, bool, storm::RationalNumber const&,
+    std::optional<storm::OptimizationDirection> const&, std::vector<uint64_t> const*, std::function<SolverStatus(SolverStatus const&)> const&,
+    MultiplicationStyle) const;
 
 }  // namespace storm::solver::helper
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -32,7 +33,25 @@ class ValueIterationHelper {
                     std::optional<storm::OptimizationDirection> const& dir = {}, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
                     MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
 
+    /*!
+     * Performs value iteration for several systems that share the matrix (and the row offsets) at once.
+     * The values of the systems are interleaved, i.e., operand[i][lane] is the value of row group i in the system of the given lane, so that
+     * each sweep over the matrix updates all systems.
+     * @param fixedLanes if given, the value of lane l in row group i is never updated if the l'th bit of fixedLanes[i] is set.
+     * @return Converged iff all lanes have converged
+     */
+    template<uint64_t Lanes>
+    SolverStatus batchVI(std::vector<std::array<ValueType, Lanes>>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
+                         ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir = {},
+                         std::vector<uint64_t> const* fixedLanes = nullptr, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                         MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
+
    private:
+    template<storm::OptimizationDirection Dir, bool Relative, uint64_t Lanes>
+    SolverStatus batchVI(std::vector<std::array<ValueType, Lanes>>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                         ValueType const& precision, std::vector<uint64_t> const* fixedLanes,
+                         std::function<SolverStatus(SolverStatus const&)> const& iterationCallback, MultiplicationStyle mult) const;
+
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
 };
 
@@ -2,15 +2,41 @@
 
 #include <optional>
 
+#include "storm/adapters/HybridRationalNumber.h"
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
 
 namespace storm::solver::helper {
 
+namespace detail {
+template<typename ValueType, typename EntryFunction>
+void forEachEntryInRow(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t rowIndex, EntryFunction const& function) {
+    for (auto const& entry : matrix.getRow(rowIndex)) {
+        function(entry.getColumn(), entry.getValue());
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType, typename EntryFunction>
+void forEachEntryInRow(storm::storage::CompactSparseMatrix<ValueType, ColumnIndexType> const& matrix, uint64_t rowIndex, EntryFunction const& function) {
+    auto const& rowIndications = matrix.getRowIndications();
+    for (auto entryIndex = rowIndications[rowIndex]; entryIndex < rowIndications[rowIndex + 1]; ++entryIndex) {
+        function(matrix.getColumns()[entryIndex], matrix.getValues()[entryIndex]);
+    }
+}
+}  // namespace detail
+
 template<typename ValueType, bool TrivialRowGrouping>
 template<bool Backward>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
                                                                       std::vector<IndexType> const* rowGroupIndices) {
+    importMatrix<Backward>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<bool Backward, typename MatrixType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::importMatrix(MatrixType const& matrix, std::vector<IndexType> const* rowGroupIndices) {
     if constexpr (TrivialRowGrouping) {
         STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping");
         STORM_LOG_ASSERT(rowGroupIndices == nullptr, "Row groups given, but grouping is supposed to be trivial.");
@@ -27,31 +53,92 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::sto
     auto const numRows = matrix.getRowCount();
     matrixValues.clear();
     matrixColumns.clear();
-    matrixValues.reserve(matrix.getNonzeroEntryCount());
-    matrixColumns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
+    matrixValues.reserve(matrix.getEntryCount());
+    matrixColumns.reserve(matrix.getEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
+    blocks.clear();
+    IndexType numProcessedGroups = 0;
+    auto appendEntry = [this](IndexType column, auto const& value) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, ValueType>) {
+            matrixValues.push_back(value);
+        } else {
+            matrixValues.push_back(storm::utility::convertNumber<ValueType>(value));
+        }
+        matrixColumns.push_back(column);
+    };
+    auto finishRow = [this](uint64_t const rowValueOffset) {
+        if (matrixValues.size() == rowValueOffset + 1 && storm::utility::isOne(matrixValues.back())) {
+            matrixValues.pop_back();
+            matrixColumns.back() += DiracEntryIndicator;
+        }
+        matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+    };
+    auto startBlockIfNecessary = [this, &numProcessedGroups]() {
+        // Called at the start of each row group, i.e., when the last entry of matrixColumns is the indicator for the start of the row group.
+        if (blocks.empty() || matrixValues.size() - blocks.back().valueOffset >= BlockSize) {
+            blocks.push_back({numProcessedGroups, matrixColumns.size() - 1, matrixValues.size(), 0});
+        }
+        ++numProcessedGroups;
+    };
     if constexpr (!TrivialRowGrouping) {
         matrixColumns.push_back(StartOfRowGroupIndicator);  // indicate start of first row(group)
         for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
             STORM_LOG_ASSERT(this->rowGroupIndices->at(groupIndex) != this->rowGroupIndices->at(groupIndex + 1),
                              "There is an empty row group. This is not expected.");
+            startBlockIfNecessary();
             for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
-                for (auto const& entry : matrix.getRow(rowIndex)) {
-                    matrixValues.push_back(entry.getValue());
-                    matrixColumns.push_back(entry.getColumn());
-                }
-                matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+                uint64_t const rowValueOffset = matrixValues.size();
+                detail::forEachEntryInRow(matrix, rowIndex, appendEntry);
+                finishRow(rowValueOffset);
             }
             matrixColumns.back() = StartOfRowGroupIndicator;  // This is the start of the next row group
         }
     } else {
         matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
         for (auto rowIndex : indexRange<Backward>(0, numRows)) {
-            for (auto const& entry : matrix.getRow(rowIndex)) {
-                matrixValues.push_back(entry.getValue());
-                matrixColumns.push_back(entry.getColumn());
+            startBlockIfNecessary();
+            uint64_t const rowValueOffset = matrixValues.size();
+            detail::forEachEntryInRow(matrix, rowIndex, appendEntry);
+            finishRow(rowValueOffset);
+        }
+    }
+    blocks.push_back({numProcessedGroups, matrixColumns.size() - 1, matrixValues.size(), 0});  // sentinel marking the end
+    planGroupRuns<Backward>();
+    computeBoundaryColumns();
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<bool Backward>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::planGroupRuns() {
+    groupRuns.clear();
+    if constexpr (!TrivialRowGrouping) {
+        IndexType const numberOfGroups = blocks.back().firstGroup;
+        // Retrieves the size of the row group that is processed after the given number of other row groups.
+        auto getGroupSize = [this, numberOfGroups](IndexType position) {
+            IndexType const groupIndex = Backward ? numberOfGroups - 1 - position : position;
+            return (*rowGroupIndices)[groupIndex + 1] - (*rowGroupIndices)[groupIndex];
+        };
+        for (uint64_t blockIndex = 0; blockIndex + 1 < blocks.size(); ++blockIndex) {
+            blocks[blockIndex].firstRun = groupRuns.size();
+            IndexType const blockEnd = blocks[blockIndex + 1].firstGroup;
+            IndexType position = blocks[blockIndex].firstGroup;
+            while (position < blockEnd) {
+                // Find the maximal sequence of row groups with the same size.
+                IndexType const groupSize = getGroupSize(position);
+                IndexType sequenceEnd = position + 1;
+                while (sequenceEnd < blockEnd && getGroupSize(sequenceEnd) == groupSize) {
+                    ++sequenceEnd;
+                }
+                if (groupSize <= MaxSpecializedGroupSize && sequenceEnd - position >= MinSpecializedRunLength) {
+                    groupRuns.push_back({position, groupSize});
+                } else if (groupRuns.size() == blocks[blockIndex].firstRun || groupRuns.back().groupSize != 0) {
+                    // Otherwise, the row groups are appended to the current unspecialized run (if there is one within this block).
+                    groupRuns.push_back({position, 0});
+                }
+                position = sequenceEnd;
             }
-            matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
         }
+        blocks.back().firstRun = groupRuns.size();
+        groupRuns.push_back({numberOfGroups, 0});  // sentinel marking the end
     }
 }
 
@@ -67,6 +154,32 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixBackwards(s
     setMatrix<true>(matrix, rowGroupIndices);
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixForwards(storm::storage::CompactSparseMatrix<ValueType, uint32_t> const& matrix,
+                                                                              std::vector<IndexType> const* rowGroupIndices) {
+    importMatrix<false>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixBackwards(storm::storage::CompactSparseMatrix<ValueType, uint32_t> const& matrix,
+                                                                               std::vector<IndexType> const* rowGroupIndices) {
+    importMatrix<true>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<typename MatrixValueType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setConvertedMatrixForwards(storm::storage::SparseMatrix<MatrixValueType> const& matrix,
+                                                                                       std::vector<IndexType> const* rowGroupIndices) {
+    importMatrix<false>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<typename MatrixValueType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setConvertedMatrixBackwards(storm::storage::SparseMatrix<MatrixValueType> const& matrix,
+                                                                                        std::vector<IndexType> const* rowGroupIndices) {
+    importMatrix<true>(matrix, rowGroupIndices);
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::unsetIgnoredRows() {
     for (auto& c : matrixColumns) {
@@ -116,6 +229,17 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool
     }
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setNumberOfThreads(uint64_t numberOfThreads) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "The number of threads must be positive.");
+    this->numberOfThreads = numberOfThreads;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping>::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 std::vector<typename ValueIterationOperator<ValueType, TrivialRowGrouping>::IndexType> const&
 ValueIterationOperator<ValueType, TrivialRowGrouping>::getRowGroupIndices() const {
@@ -141,6 +265,68 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::freeAuxiliaryVector(
     auxiliaryVectorUsedExternally = false;
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+std::vector<ValueType> const& ValueIterationOperator<ValueType, TrivialRowGrouping>::getAuxiliaryVector() const {
+    return auxiliaryVector;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::computeBoundaryColumns() {
+    boundaryColumns.clear();
+    boundarySlots.clear();
+    {
+        // Snapshots of a previous matrix are not reused.
+        std::lock_guard<std::mutex> lock(boundarySnapshotPoolMutex);
+        boundarySnapshotPool.clear();
+    }
+    // With a single block, no values are read across blocks.
+    if (blocks.size() > 2) {
+        IndexType const numberOfGroups = blocks.back().firstGroup;
+        std::vector<bool> isBoundaryColumn(numberOfGroups, false);
+        for (uint64_t blockIndex = 0; blockIndex + 1 < blocks.size(); ++blockIndex) {
+            // Blocks are stored in the order in which the row groups are processed.
+            IndexType const groupBegin = backwards ? numberOfGroups - blocks[blockIndex + 1].firstGroup : blocks[blockIndex].firstGroup;
+            IndexType const groupEnd = backwards ? numberOfGroups - blocks[blockIndex].firstGroup : blocks[blockIndex + 1].firstGroup;
+            for (uint64_t position = blocks[blockIndex].columnOffset; position < blocks[blockIndex + 1].columnOffset; ++position) {
+                IndexType column = matrixColumns[position];
+                if (column >= StartOfRowIndicator) {
+                    continue;
+                }
+                if (isDiracEntry(column)) {
+                    column -= DiracEntryIndicator;
+                }
+                if (column < groupBegin || column >= groupEnd) {
+                    isBoundaryColumn[column] = true;
+                }
+            }
+        }
+        boundarySlots.assign(numberOfGroups, 0);
+        for (IndexType column = 0; column < numberOfGroups; ++column) {
+            if (isBoundaryColumn[column]) {
+                boundarySlots[column] = boundaryColumns.size();
+                boundaryColumns.push_back(column);
+            }
+        }
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+std::vector<ValueType> ValueIterationOperator<ValueType, TrivialRowGrouping>::acquireBoundarySnapshot() const {
+    std::lock_guard<std::mutex> lock(boundarySnapshotPoolMutex);
+    if (boundarySnapshotPool.empty()) {
+        return {};
+    }
+    std::vector<ValueType> snapshot = std::move(boundarySnapshotPool.back());
+    boundarySnapshotPool.pop_back();
+    return snapshot;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::releaseBoundarySnapshot(std::vector<ValueType>&& snapshot) const {
+    std::lock_guard<std::mutex> lock(boundarySnapshotPoolMutex);
+    boundarySnapshotPool.push_back(std::move(snapshot));
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
     do {
@@ -152,8 +338,11 @@ template<typename ValueType, bool TrivialRowGrouping>
 bool ValueIterationOperator<ValueType, TrivialRowGrouping>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
                                                                            typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
     if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask)) {
+        // The entry of a dirac row has no value.
+        if (!isDiracEntry(*(matrixColumnIt + 1))) {
+            matrixValueIt += entriesToSkip - 1;
+        }
         matrixColumnIt += entriesToSkip;
-        matrixValueIt += entriesToSkip - 1;
         return true;
     }
     return false;
@@ -176,5 +365,14 @@ template class ValueIterationOperator<double, true>;
 template class ValueIterationOperator<double, false>;
 template class ValueIterationOperator<storm::RationalNumber, true>;
 template class ValueIterationOperator<storm::RationalNumber, false>;
+template class ValueIterationOperator<float, true>;
+template class ValueIterationOperator<float, false>;
+template class ValueIterationOperator<storm::HybridRationalNumber, false>;
+template void ValueIterationOperator<storm::HybridRationalNumber, false>::setConvertedMatrixBackwards(
+    storm::storage::SparseMatrix<storm::RationalNumber> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, true>::setConvertedMatrixForwards(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, true>::setConvertedMatrixBackwards(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, false>::setConvertedMatrixForwards(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, false>::setConvertedMatrixBackwards(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
 
 }  // namespace storm::solver::helper
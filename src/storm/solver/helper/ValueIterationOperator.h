@@ -1,6 +1,10 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -9,6 +13,8 @@
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/tracing.h"
 #include "storm/utility/vector.h"  // TODO
 
 namespace storm {
@@ -17,6 +23,8 @@ class Environment;
 namespace storage {
 template<typename T>
 class SparseMatrix;
+template<typename T, typename ColumnIndexType>
+class CompactSparseMatrix;
 }
 
 namespace solver::helper {
@@ -59,6 +67,28 @@ class ValueIterationOperator {
      */
     void setMatrixBackwards(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
+    /*!
+     * Initializes this operator with the given compact (structure-of-arrays) matrix for forward or backward iterations, respectively.
+     * This avoids traversing the interleaved entries of a SparseMatrix if a compact copy is available anyway.
+     * @param matrix the transition matrix
+     * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
+     * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
+     */
+    void setMatrixForwards(storm::storage::CompactSparseMatrix<ValueType, uint32_t> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    void setMatrixBackwards(storm::storage::CompactSparseMatrix<ValueType, uint32_t> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
+    /*!
+     * Initializes this operator with a matrix of another value type whose entries are converted to the value type of this operator.
+     * This allows, e.g., to iterate in single precision on a double precision matrix without building a converted copy of the matrix.
+     * @param matrix the transition matrix
+     * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
+     * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
+     */
+    template<typename MatrixValueType>
+    void setConvertedMatrixForwards(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    template<typename MatrixValueType>
+    void setConvertedMatrixBackwards(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
     /*!
      * Applies the operator with the given operands, offsets, and backend.
      * More specifically, for each row group and for each row in a row group,
@@ -77,8 +107,13 @@ class ValueIterationOperator {
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
      *                      applyUpdate gets two operandOutReference's to write the group result to.
+     *                      The operand can also be a vector of std::array's with one entry per group, holding the values of several independent
+     *                      systems (lanes) in an interleaved fashion. Then, each matrix entry is applied to all lanes at once, the rowResult is an array
+     *                      with one value per lane and applyUpdate gets the array of the row group.
      * @tparam OffsetType The type of row offsets. Can be a single value vector (one entry per row) or a pair of a (pointer to a) value vector and a value.
-     *                      The latter case is only valid if OperandType is a pair of two value vectors.
+     *                      If OperandType is a pair of two value vectors, the offsets can also be such a pair, holding separate offsets for both vectors.
+     *                      The latter cases are only valid if OperandType is a pair of two value vectors.
+     *                      For interleaved operands, the offsets are a single value vector that is shared by all lanes.
      * @tparam BackendType The type of backend, shall implement the methods above
      * @param operandIn Input operand
      * @param operandOut Output operand
@@ -86,10 +121,35 @@ class ValueIterationOperator {
      * @param backend the backend
      * @return whatever backend.converged() returns
      *
+     * If more than one thread is set (see `setNumberOfThreads`) and the backend additionally implements
+     * * backend.merge(otherBackend); merges the information that a copy of the backend gathered while processing some of the row groups of this iteration
+     * the row groups are split into blocks that are processed concurrently, each with its own copy of the backend (created after
+     * backend.startNewIteration()). Within a block, row groups are processed in the usual order, i.e., in-place applications
+     * use the values of the current iteration (Gauss-Seidel). Across blocks, in-place applications use the values of the
+     * previous iteration (Jacobi). The copies are merged into the given backend before backend.endOfIteration() is invoked.
+     *
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType>
     bool apply(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        STORM_TRACE_ZONE("ValueIterationOperator::apply");
+        if constexpr (supportsMerge<BackendType>::value) {
+            if (numberOfThreads > 1 && blocks.size() > 2) {
+                if (hasSkippedRows) {
+                    if (backwards) {
+                        return applyParallel<OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
+                    } else {
+                        return applyParallel<OperandType, OffsetType, BackendType, false, true>(operandOut, operandIn, offsets, backend);
+                    }
+                } else {
+                    if (backwards) {
+                        return applyParallel<OperandType, OffsetType, BackendType, true, false>(operandOut, operandIn, offsets, backend);
+                    } else {
+                        return applyParallel<OperandType, OffsetType, BackendType, false, false>(operandOut, operandIn, offsets, backend);
+                    }
+                }
+            }
+        }
         if (hasSkippedRows) {
             if (backwards) {
                 return apply<OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
@@ -127,6 +187,18 @@ class ValueIterationOperator {
      */
     void unsetIgnoredRows();
 
+    /*!
+     * Sets the number of threads that are used when applying the operator. Values larger than one only have an effect
+     * for backends that can be merged (see `apply`) and for matrices that are large enough to be split into several blocks.
+     * @param numberOfThreads the number of threads (at least one)
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * @return the number of threads that are used when applying the operator
+     */
+    uint64_t getNumberOfThreads() const;
+
     /*!
      * @return The considered row group indices
      */
@@ -145,6 +217,11 @@ class ValueIterationOperator {
      */
     void freeAuxiliaryVector();
 
+    /*!
+     * Retrieves the auxiliary vector (which is only meaningful while it is allocated)
+     */
+    std::vector<ValueType> const& getAuxiliaryVector() const;
+
    private:
     /*!
      * Internal variant of `apply`
@@ -158,38 +235,215 @@ class ValueIterationOperator {
         backend.startNewIteration();
         auto matrixValueIt = matrixValues.cbegin();
         auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
-            STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
-            //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
-            if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+        auto applyRowFunction = [&](uint64_t offsetIndex) { return applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, offsetIndex); };
+        if constexpr (!TrivialRowGrouping && !SkipIgnoredRows) {
+            if (applyRuns<OperandType, BackendType, Backward>(0, groupRuns.size() - 1, operandSize, matrixColumnIt, matrixValueIt, operandOut, backend,
+                                                              applyRowFunction)) {
+                return backend.converged();
+            }
+        } else {
+            for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
+                STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
+                applyGroup<OperandType, BackendType, SkipIgnoredRows>(groupIndex, matrixColumnIt, matrixValueIt, operandOut, backend, applyRowFunction);
+                if (backend.abort()) {
+                    return backend.converged();
+                }
+            }
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Parallel variant of `apply`. The blocks of row groups are distributed among the threads.
+     * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
+        STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == getSize(operandIn) + 1, "Dimension mismatch");
+        STORM_LOG_ASSERT(blocks.back().firstGroup == getSize(operandIn), "Dimension mismatch");
+        backend.startNewIteration();
+
+        // For in-place applications, other blocks need to read the values of the previous iteration as the values are overwritten concurrently.
+        // Only the boundary values, i.e., the values that are read by other blocks, are preserved in a compact snapshot. The snapshot is local
+        // to this invocation, so that several applications of this operator can run concurrently.
+        bool const inPlace = &operandIn == &operandOut;
+        std::vector<ValueType> pooledSnapshot;
+        std::optional<OperandType> snapshot;
+        OperandType const* foreignOperand = &operandIn;
+        if (inPlace) {
+            if constexpr (std::is_same_v<OperandType, std::vector<ValueType>>) {
+                pooledSnapshot = acquireBoundarySnapshot();
+                copyBoundaryValues(operandIn, pooledSnapshot);
+                foreignOperand = &pooledSnapshot;
+            } else {
+                snapshot.emplace();
+                copyBoundaryValues(operandIn, snapshot.value());
+                foreignOperand = &snapshot.value();
+            }
+        }
+
+        std::vector<BackendType> threadBackends(numberOfThreads, backend);
+        std::atomic<bool> aborted(false);
+        storm::utility::parallel::forEachChunk(numberOfThreads, blocks.size() - 1, 1, [&](uint64_t threadIndex, uint64_t firstBlock, uint64_t endBlock) {
+            for (uint64_t blockIndex = firstBlock; blockIndex < endBlock && !aborted.load(std::memory_order_relaxed); ++blockIndex) {
+                bool blockAborted = inPlace ? applyBlock<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, true>(
+                                                  blockIndex, operandOut, *foreignOperand, offsets, threadBackends[threadIndex])
+                                            : applyBlock<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, false>(
+                                                  blockIndex, operandOut, operandIn, offsets, threadBackends[threadIndex]);
+                if (blockAborted) {
+                    aborted.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        if constexpr (std::is_same_v<OperandType, std::vector<ValueType>>) {
+            if (inPlace) {
+                releaseBoundarySnapshot(std::move(pooledSnapshot));
+            }
+        }
+
+        for (auto const& threadBackend : threadBackends) {
+            backend.merge(threadBackend);
+        }
+        if (!aborted.load()) {
+            backend.endOfIteration();
+        }
+        return backend.converged();
+    }
+
+    /*!
+     * Applies the operator to the row groups of the given block.
+     * @tparam InPlace if true, the values of row groups within the block are read from the output operand and the others from the input
+     *                 operand, which then is the snapshot of the boundary values (see copyBoundaryValues)
+     * @return true iff the backend requested an abort
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, bool InPlace>
+    bool applyBlock(uint64_t blockIndex, OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        Block const& block = blocks[blockIndex];
+        auto matrixColumnIt = matrixColumns.cbegin() + block.columnOffset;
+        auto matrixValueIt = matrixValues.cbegin() + block.valueOffset;
+        // Blocks are stored in the order in which the row groups are processed.
+        IndexType const operandSize = getSize(operandOut);
+        IndexType const groupBegin = Backward ? operandSize - blocks[blockIndex + 1].firstGroup : block.firstGroup;
+        IndexType const groupEnd = Backward ? operandSize - block.firstGroup : blocks[blockIndex + 1].firstGroup;
+        auto applyRowFunction = [&](uint64_t offsetIndex) {
+            if constexpr (InPlace) {
+                return applyRow(matrixColumnIt, matrixValueIt, operandOut, operandIn, groupBegin, groupEnd, offsets, offsetIndex);
             } else {
-                IndexType rowIndex = (*rowGroupIndices)[groupIndex];
-                if constexpr (SkipIgnoredRows) {
-                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+                return applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, offsetIndex);
+            }
+        };
+        if constexpr (!TrivialRowGrouping && !SkipIgnoredRows) {
+            if (applyRuns<OperandType, BackendType, Backward>(block.firstRun, blocks[blockIndex + 1].firstRun, operandSize, matrixColumnIt, matrixValueIt,
+                                                              operandOut, backend, applyRowFunction)) {
+                return true;
+            }
+        } else {
+            for (auto groupIndex : indexRange<Backward>(groupBegin, groupEnd)) {
+                STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
+                applyGroup<OperandType, BackendType, SkipIgnoredRows>(groupIndex, matrixColumnIt, matrixValueIt, operandOut, backend, applyRowFunction);
+                if (backend.abort()) {
+                    return true;
                 }
-                backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                while (*matrixColumnIt < StartOfRowGroupIndicator) {
-                    ++rowIndex;
-                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+            }
+        }
+        STORM_LOG_ASSERT(matrixColumnIt == matrixColumns.cbegin() + blocks[blockIndex + 1].columnOffset, "Unexpected position of matrix column iterator.");
+        return false;
+    }
+
+    /*!
+     * Processes the row groups of the given runs (see GroupRun) in the order in which they are stored.
+     * Within each run, the row groups are processed by a variant of `applyGroup` that is specialized for the size of the groups of the run.
+     * @return true iff the backend requested an abort
+     */
+    template<typename OperandType, typename BackendType, bool Backward, typename ApplyRowFunction>
+    bool applyRuns(uint64_t const firstRun, uint64_t const endRun, IndexType const operandSize, std::vector<IndexType>::const_iterator& matrixColumnIt,
+                   typename std::vector<ValueType>::const_iterator& matrixValueIt, OperandType& operandOut, BackendType& backend,
+                   ApplyRowFunction const& applyRowFunction) const {
+        for (uint64_t runIndex = firstRun; runIndex < endRun; ++runIndex) {
+            // Runs are stored in the order in which the row groups are processed.
+            IndexType const groupBegin = Backward ? operandSize - groupRuns[runIndex + 1].firstGroup : groupRuns[runIndex].firstGroup;
+            IndexType const groupEnd = Backward ? operandSize - groupRuns[runIndex].firstGroup : groupRuns[runIndex + 1].firstGroup;
+            auto applyGroups = [&](auto groupSize) {
+                for (auto groupIndex : indexRange<Backward>(groupBegin, groupEnd)) {
+                    STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
+                    applyGroup<OperandType, BackendType, false, decltype(groupSize)::value>(groupIndex, matrixColumnIt, matrixValueIt, operandOut, backend,
+                                                                                           applyRowFunction);
+                    if (backend.abort()) {
+                        return true;
                     }
                 }
+                return false;
+            };
+            bool aborted;
+            switch (groupRuns[runIndex].groupSize) {
+                case 1:
+                    aborted = applyGroups(std::integral_constant<IndexType, 1>());
+                    break;
+                case 2:
+                    aborted = applyGroups(std::integral_constant<IndexType, 2>());
+                    break;
+                case 3:
+                    aborted = applyGroups(std::integral_constant<IndexType, 3>());
+                    break;
+                case 4:
+                    aborted = applyGroups(std::integral_constant<IndexType, 4>());
+                    break;
+                default:
+                    aborted = applyGroups(std::integral_constant<IndexType, 0>());
             }
-            if constexpr (isPair<OperandType>::value) {
-                backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
-            } else {
-                backend.applyUpdate(operandOut[groupIndex], groupIndex);
+            if (aborted) {
+                return true;
             }
-            if (backend.abort()) {
-                return backend.converged();
+        }
+        return false;
+    }
+
+    /*!
+     * Processes all rows of the given row group and assigns the result to the output operand
+     * @tparam GroupSize if positive, the number of rows of the row group, which then must not have ignored rows. Otherwise, the end of the group
+     *                   is determined by the row group indicator.
+     * @param applyRowFunction computes the result of a single row (given the offset index) and advances the iterators to the end of the row
+     */
+    template<typename OperandType, typename BackendType, bool SkipIgnoredRows, IndexType GroupSize = 0, typename ApplyRowFunction>
+    void applyGroup(IndexType const groupIndex, std::vector<IndexType>::const_iterator& matrixColumnIt,
+                    typename std::vector<ValueType>::const_iterator& matrixValueIt, OperandType& operandOut, BackendType& backend,
+                    ApplyRowFunction const& applyRowFunction) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        if constexpr (TrivialRowGrouping) {
+            backend.firstRow(applyRowFunction(groupIndex), groupIndex, groupIndex);
+        } else if constexpr (GroupSize > 0) {
+            static_assert(!SkipIgnoredRows, "Row groups of fixed size do not support ignored rows.");
+            STORM_LOG_ASSERT((*rowGroupIndices)[groupIndex + 1] - (*rowGroupIndices)[groupIndex] == GroupSize, "Unexpected size of row group.");
+            IndexType const rowIndex = (*rowGroupIndices)[groupIndex];
+            backend.firstRow(applyRowFunction(rowIndex), groupIndex, rowIndex);
+            // The number of iterations is known at compile time, so this loop is unrolled.
+            for (IndexType offset = 1; offset < GroupSize; ++offset) {
+                backend.nextRow(applyRowFunction(rowIndex + offset), groupIndex, rowIndex + offset);
+            }
+            STORM_LOG_ASSERT(*matrixColumnIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        } else {
+            IndexType rowIndex = (*rowGroupIndices)[groupIndex];
+            if constexpr (SkipIgnoredRows) {
+                rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+            }
+            backend.firstRow(applyRowFunction(rowIndex), groupIndex, rowIndex);
+            while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                ++rowIndex;
+                if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
+                    backend.nextRow(applyRowFunction(rowIndex), groupIndex, rowIndex);
+                }
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
-        backend.endOfIteration();
-        return backend.converged();
+        if constexpr (isPair<OperandType>::value) {
+            backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
+        } else {
+            backend.applyUpdate(operandOut[groupIndex], groupIndex);
+        }
     }
 
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
@@ -211,6 +465,19 @@ class ValueIterationOperator {
         return {(*offsets.first)[offsetIndex], offsets.second};
     }
 
+    template<typename OpT1, typename OpT2, typename OffT1, typename OffT2>
+    std::pair<OpT1, OpT2> initializeRowRes(std::pair<std::vector<OpT1>, std::vector<OpT2>> const&,
+                                           std::pair<std::vector<OffT1>, std::vector<OffT2>> const& offsets, uint64_t offsetIndex) const {
+        return {offsets.first[offsetIndex], offsets.second[offsetIndex]};
+    }
+
+    template<typename OpT, std::size_t Lanes, typename OffT>
+    std::array<OpT, Lanes> initializeRowRes(std::vector<std::array<OpT, Lanes>> const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
+        std::array<OpT, Lanes> result;
+        result.fill(offsets[offsetIndex]);
+        return result;
+    }
+
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
      */
@@ -219,10 +486,20 @@ class ValueIterationOperator {
                   OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
         STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
         auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        if (isDiracEntry(*++matrixColumnIt)) {
+            addDiracEntry(result, operand, *matrixColumnIt - DiracEntryIndicator);
+            ++matrixColumnIt;
+            return result;
+        }
+        for (; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
             if constexpr (isPair<OperandType>::value) {
                 result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
                 result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
+            } else if constexpr (isInterleaved<OperandType>::value) {
+                auto const& laneValues = operand[*matrixColumnIt];
+                for (uint64_t lane = 0; lane < result.size(); ++lane) {
+                    result[lane] += laneValues[lane] * (*matrixValueIt);
+                }
             } else {
                 result += operand[*matrixColumnIt] * (*matrixValueIt);
             }
@@ -230,6 +507,92 @@ class ValueIterationOperator {
         return result;
     }
 
+    /*!
+     * Computes the result for a single row and advances the given iterators to the end of the row.
+     * Entries whose column lies in [localBegin, localEnd) are taken from the local operand, all others from the snapshot of the boundary values.
+     */
+    template<typename OperandType, typename OffsetType>
+    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+                  OperandType const& localOperand, OperandType const& boundarySnapshot, IndexType const localBegin, IndexType const localEnd,
+                  OffsetType const& offsets, uint64_t offsetIndex) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        auto result{initializeRowRes(localOperand, offsets, offsetIndex)};
+        if (isDiracEntry(*++matrixColumnIt)) {
+            IndexType const column = *matrixColumnIt - DiracEntryIndicator;
+            if (column >= localBegin && column < localEnd) {
+                addDiracEntry(result, localOperand, column);
+            } else {
+                addDiracEntry(result, boundarySnapshot, boundarySlots[column]);
+            }
+            ++matrixColumnIt;
+            return result;
+        }
+        for (; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+            bool const local = *matrixColumnIt >= localBegin && *matrixColumnIt < localEnd;
+            auto const& operand = local ? localOperand : boundarySnapshot;
+            IndexType const index = local ? *matrixColumnIt : boundarySlots[*matrixColumnIt];
+            if constexpr (isPair<OperandType>::value) {
+                result.first += operand.first[index] * (*matrixValueIt);
+                result.second += operand.second[index] * (*matrixValueIt);
+            } else if constexpr (isInterleaved<OperandType>::value) {
+                auto const& laneValues = operand[index];
+                for (uint64_t lane = 0; lane < result.size(); ++lane) {
+                    result[lane] += laneValues[lane] * (*matrixValueIt);
+                }
+            } else {
+                result += operand[index] * (*matrixValueIt);
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Stores the values of the boundary columns of the given operand in the given snapshot, where the value of each column is stored at its
+     * slot (see boundarySlots).
+     */
+    template<typename OperandType>
+    void copyBoundaryValues(OperandType const& operand, OperandType& snapshot) const {
+        uint64_t const numberOfSlots = boundaryColumns.size();
+        if constexpr (isPair<OperandType>::value) {
+            snapshot.first.resize(numberOfSlots);
+            snapshot.second.resize(numberOfSlots);
+            for (uint64_t slot = 0; slot < numberOfSlots; ++slot) {
+                snapshot.first[slot] = operand.first[boundaryColumns[slot]];
+                snapshot.second[slot] = operand.second[boundaryColumns[slot]];
+            }
+        } else {
+            snapshot.resize(numberOfSlots);
+            for (uint64_t slot = 0; slot < numberOfSlots; ++slot) {
+                snapshot[slot] = operand[boundaryColumns[slot]];
+            }
+        }
+    }
+
+    /*!
+     * Adds the operand value(s) of the given column to the given row result, i.e., handles an entry with value one
+     */
+    template<typename ResultType, typename OperandType>
+    void addDiracEntry(ResultType& result, OperandType const& operand, IndexType const column) const {
+        if constexpr (isPair<OperandType>::value) {
+            result.first += operand.first[column];
+            result.second += operand.second[column];
+        } else if constexpr (isInterleaved<OperandType>::value) {
+            auto const& laneValues = operand[column];
+            for (uint64_t lane = 0; lane < result.size(); ++lane) {
+                result[lane] += laneValues[lane];
+            }
+        } else {
+            result += operand[column];
+        }
+    }
+
+    /*!
+     * @return true iff the given element of 'matrixColumns' is the only entry of a row whose value is one
+     */
+    bool isDiracEntry(IndexType const matrixColumn) const {
+        return matrixColumn >= DiracEntryIndicator && matrixColumn < StartOfRowIndicator;
+    }
+
     // Auxiliary helpers used for metaprogramming
     template<bool Backward>
     auto indexRange(IndexType start, IndexType end) const {
@@ -256,12 +619,76 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename>
+    struct isInterleaved : std::false_type {};
+
+    template<typename T, std::size_t Lanes>
+    struct isInterleaved<std::vector<std::array<T, Lanes>>> : std::true_type {};
+
+    template<typename BackendType, typename = void>
+    struct supportsMerge : std::false_type {};
+
+    template<typename BackendType>
+    struct supportsMerge<BackendType, std::void_t<decltype(std::declval<BackendType&>().merge(std::declval<BackendType const&>()))>> : std::true_type {};
+
+    /*!
+     * A block of consecutively processed row groups
+     */
+    struct Block {
+        /// The number of row groups that are processed before the first row group of this block
+        IndexType firstGroup;
+        /// The position of the row (group) indicator of the first row group of this block in 'matrixColumns'
+        uint64_t columnOffset;
+        /// The position of the first entry of the first row group of this block in 'matrixValues'
+        uint64_t valueOffset;
+        /// The index of the first run of this block in 'groupRuns'
+        uint64_t firstRun;
+    };
+
+    /*!
+     * A run of consecutively processed row groups within a block. If the groups of a run all have the same (small) number of rows,
+     * the groups are processed by a variant of `applyGroup` that is specialized for this size, avoiding the loop over the rows.
+     */
+    struct GroupRun {
+        /// The number of row groups that are processed before the first row group of this run
+        IndexType firstGroup;
+        /// The number of rows of each row group of this run, or zero if the row groups are processed without specialization
+        IndexType groupSize;
+    };
+
+    /*!
+     * Copies the entries of the given matrix (either a SparseMatrix or a CompactSparseMatrix) into the internal data structures
+     */
+    template<bool Backward, typename MatrixType>
+    void importMatrix(MatrixType const& matrix, std::vector<IndexType> const* rowGroupIndices);
+
+    /*!
+     * Splits the row groups of each block into runs (see GroupRun). Requires that the blocks are set.
+     */
+    template<bool Backward>
+    void planGroupRuns();
+
     /*!
      * Internal variant of setIgnoredRows
      */
     template<bool Backward = true>
     void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
 
+    /*!
+     * Computes the (sorted) columns that are read by a block other than the block that contains the corresponding row group and their slots.
+     */
+    void computeBoundaryColumns();
+
+    /*!
+     * Takes a snapshot of the boundary values out of the pool (or creates a new one if the pool is empty).
+     */
+    std::vector<ValueType> acquireBoundarySnapshot() const;
+
+    /*!
+     * Returns the given snapshot of the boundary values to the pool, such that it can be reused by later applications.
+     */
+    void releaseBoundarySnapshot(std::vector<ValueType>&& snapshot) const;
+
     /*!
      * Moves the given iterator to the end of the current row
      */
@@ -279,7 +706,7 @@ class ValueIterationOperator {
                                      typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
 
     /*!
-     * The non-zero matrix entries.
+     * The non-zero matrix entries (except for the entries of dirac rows, see DiracEntryIndicator).
      */
     std::vector<ValueType> matrixValues;
 
@@ -294,6 +721,56 @@ class ValueIterationOperator {
      */
     std::vector<IndexType> const* rowGroupIndices;
 
+    /*!
+     * The blocks of row groups in the order in which they are processed. The last block is a sentinel that marks the end of the matrix.
+     */
+    std::vector<Block> blocks;
+
+    /*!
+     * The runs of row groups in the order in which they are processed (only for non-trivial row groupings). The last run is a sentinel that
+     * marks the end of the matrix. The runs are not used if there are ignored rows.
+     */
+    std::vector<GroupRun> groupRuns;
+
+    /*!
+     * The columns that are read across blocks, see computeBoundaryColumns. Computed when the matrix is set, so applying the operator does not
+     * modify it.
+     */
+    std::vector<IndexType> boundaryColumns;
+
+    /*!
+     * For each boundary column, its index in boundaryColumns, i.e., its slot in the snapshots of the boundary values. Undefined for the other columns.
+     */
+    std::vector<IndexType> boundarySlots;
+
+    /*!
+     * The snapshots of the boundary values that are currently not used by an in-place parallel application. Every application takes a snapshot
+     * out of the pool and returns it afterwards, so snapshots are only allocated for applications that run concurrently.
+     */
+    mutable std::vector<std::vector<ValueType>> boundarySnapshotPool;
+    mutable std::mutex boundarySnapshotPoolMutex;
+
+    /*!
+     * The number of threads used when applying the operator
+     */
+    uint64_t numberOfThreads{1};
+
+    /*!
+     * The (approximate) number of matrix entries in each block. The corresponding part of the matrix fits into the L2 cache of common CPUs.
+     */
+    uint64_t const BlockSize = 1ull << 15;
+
+    /*!
+     * The largest group size for which there is a specialized variant of `applyGroup`, see `applyRuns`
+     */
+    IndexType const MaxSpecializedGroupSize = 4;
+
+    /*!
+     * The minimal number of consecutive row groups of the same size that form a run for which the specialized variant of `applyGroup` is used.
+     * Shorter sequences are merged into runs that are processed without specialization, which avoids frequent dispatching.
+     */
+    IndexType const MinSpecializedRunLength = 8;
+
     /*!
      * True iff the matrix was set in backward orders
      */
@@ -328,6 +805,12 @@ class ValueIterationOperator {
      * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
      */
     IndexType const SkipNumEntriesMask = ~StartOfRowGroupIndicator;  // 00111..1
+
+    /*!
+     * Rows with a single entry whose value is one (e.g. deterministic moves) do not store the value in 'matrixValues'.
+     * Instead, the column of the entry is marked with this bit such that the multiplication can be skipped.
+     */
+    IndexType const DiracEntryIndicator = 1ull << 61;  // 00100..0
 };
 
 }  // namespace solver::helper
@@ -3,8 +3,7 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
-#include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -36,7 +35,7 @@ void GmmxxMultiplier<ValueType>::clearCache() const {
 template<typename ValueType>
 bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    return env.solver().multiplier().isParallelizeSet();
 #else
     return false;
 #endif
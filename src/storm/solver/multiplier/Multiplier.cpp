@@ -101,7 +101,10 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
         case MultiplierType::Gmmxx:
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
-            return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix, env.solver().multiplier().isUseCompactMatrixSet(), false,
+                                                                 env.solver().multiplier().isUseEncodedMatrixSet());
+        case MultiplierType::Simd:
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix, true, true);
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
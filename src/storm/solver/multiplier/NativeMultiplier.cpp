@@ -1,11 +1,13 @@
 #include "NativeMultiplier.h"
 
+#include <type_traits>
+
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
-#include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/EncodedSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/adapters/IntelTbbAdapter.h"
@@ -18,14 +20,37 @@ namespace storm {
 namespace solver {
 
 template<typename ValueType>
-NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
-    // Intentionally left empty.
+NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, bool useCompactMatrix, bool useSimdKernels,
+                                              bool useEncodedMatrix)
+    : Multiplier<ValueType>(matrix), instructionSet(storm::utility::simd::InstructionSet::Scalar) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (useEncodedMatrix) {
+            encodedMatrix = std::make_unique<storm::storage::EncodedSparseMatrix>(matrix);
+            STORM_LOG_INFO("Using an encoded matrix with " << encodedMatrix->getSizeInBytes() << " bytes for matrix-vector multiplications.");
+        } else if (useCompactMatrix || useSimdKernels) {
+            if (storm::storage::CompactSparseMatrix<ValueType, uint32_t>::canRepresent(matrix)) {
+                compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType, uint32_t>>(matrix);
+            } else {
+                STORM_LOG_WARN("Not using a compact matrix since the number of columns exceeds the range of 32-bit indices.");
+            }
+        }
+        if (useSimdKernels && compactMatrix) {
+            instructionSet = storm::utility::simd::getSupportedInstructionSet();
+            STORM_LOG_INFO("Using " << storm::utility::simd::toString(instructionSet) << " kernels for matrix-vector multiplications.");
+        }
+    } else {
+        STORM_LOG_WARN_COND(!useCompactMatrix && !useSimdKernels && !useEncodedMatrix,
+                            "Compact or encoded matrices and vectorized kernels are only used for double values.");
+    }
 }
 
+template<typename ValueType>
+NativeMultiplier<ValueType>::~NativeMultiplier() = default;
+
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    return env.solver().multiplier().isParallelizeSet();
 #else
     return false;
 #endif
@@ -56,6 +81,24 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                                       bool backwards) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (encodedMatrix) {
+            if (backwards) {
+                encodedMatrix->multiplyWithVectorBackward(x, x, b);
+            } else {
+                encodedMatrix->multiplyWithVectorForward(x, x, b);
+            }
+            return;
+        }
+        if (compactMatrix) {
+            if (backwards) {
+                compactMatrix->multiplyWithVectorBackward(x, x, b);
+            } else {
+                compactMatrix->multiplyWithVectorForward(x, x, b);
+            }
+            return;
+        }
+    }
     if (backwards) {
         this->matrix.multiplyWithVectorBackward(x, x, b);
     } else {
@@ -90,6 +133,24 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (encodedMatrix) {
+            if (backwards) {
+                encodedMatrix->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            } else {
+                encodedMatrix->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+            }
+            return;
+        }
+        if (compactMatrix) {
+            if (backwards) {
+                compactMatrix->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            } else {
+                compactMatrix->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+            }
+            return;
+        }
+    }
     if (backwards) {
         this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
     } else {
@@ -99,6 +160,16 @@ void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (encodedMatrix) {
+            value += encodedMatrix->multiplyRowWithVector(rowIndex, x);
+            return;
+        }
+        if (compactMatrix) {
+            value += compactMatrix->multiplyRowWithVector(rowIndex, x);
+            return;
+        }
+    }
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
         value += entry.getValue() * x[entry.getColumn()];
     }
@@ -115,6 +186,22 @@ void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::ve
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (encodedMatrix) {
+            encodedMatrix->multiplyWithVector(x, result, b);
+            return;
+        }
+        if (compactMatrix) {
+            if (instructionSet != storm::utility::simd::InstructionSet::Scalar) {
+                storm::utility::simd::multiplyRows(instructionSet, compactMatrix->getRowCount(), compactMatrix->getRowIndications().data(),
+                                                   compactMatrix->getColumns().data(), compactMatrix->getValues().data(), x.data(), b ? b->data() : nullptr,
+                                                   result.data());
+            } else {
+                compactMatrix->multiplyWithVector(x, result, b);
+            }
+            return;
+        }
+    }
     this->matrix.multiplyWithVector(x, result, b);
 }
 
@@ -122,6 +209,26 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                 std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                 std::vector<uint64_t>* choices) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (encodedMatrix) {
+            encodedMatrix->multiplyAndReduceForward(dir, rowGroupIndices, x, b, result, choices);
+            return;
+        }
+        if (compactMatrix) {
+            if (instructionSet != storm::utility::simd::InstructionSet::Scalar && !choices) {
+                // Choices are tracked with the scalar code as they are only updated on strict improvements.
+                rowValues.resize(compactMatrix->getRowCount());
+                storm::utility::simd::multiplyRows(instructionSet, compactMatrix->getRowCount(), compactMatrix->getRowIndications().data(),
+                                                   compactMatrix->getColumns().data(), compactMatrix->getValues().data(), x.data(), b ? b->data() : nullptr,
+                                                   rowValues.data());
+                storm::utility::simd::reduceRowGroups(instructionSet, storm::solver::minimize(dir), rowGroupIndices.size() - 1, rowGroupIndices.data(),
+                                                      rowValues.data(), result.data());
+            } else {
+                compactMatrix->multiplyAndReduceForward(dir, rowGroupIndices, x, b, result, choices);
+            }
+            return;
+        }
+    }
     this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
 }
 
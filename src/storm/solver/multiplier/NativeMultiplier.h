@@ -1,13 +1,19 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
 namespace storage {
 template<typename ValueType>
 class SparseMatrix;
+template<typename ValueType, typename ColumnIndexType>
+class CompactSparseMatrix;
+class EncodedSparseMatrix;
 }
 
 namespace solver {
@@ -15,8 +21,18 @@ namespace solver {
 template<typename ValueType>
 class NativeMultiplier : public Multiplier<ValueType> {
    public:
-    NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
-    virtual ~NativeMultiplier() = default;
+    /*!
+     * Creates a multiplier for the given matrix.
+     * @param useCompactMatrix if set and if possible (only for double values and fewer than 2^32 columns), the multiplications are performed on a
+     * copy of the matrix in which columns and values are stored in separate arrays.
+     * @param useSimdKernels if set and if possible, (non-Gauss-Seidel) multiplications are performed by vectorized kernels for the best instruction set
+     * supported by the CPU. Implies useCompactMatrix.
+     * @param useEncodedMatrix if set and if possible (only for double values), the sequential multiplications are performed on a copy of the
+     * matrix with delta-encoded columns and dictionary-encoded values. Takes precedence over the other options.
+     */
+    NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, bool useCompactMatrix = false, bool useSimdKernels = false,
+                     bool useEncodedMatrix = false);
+    virtual ~NativeMultiplier();
 
     virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                           std::vector<ValueType>& result) const override;
@@ -42,6 +58,18 @@ class NativeMultiplier : public Multiplier<ValueType> {
     void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
     void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
                                std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    // If set, this compact copy of the matrix is used for sequential multiplications.
+    std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType, uint32_t>> compactMatrix;
+
+    // If set, this encoded copy of the matrix is used for sequential multiplications.
+    std::unique_ptr<storm::storage::EncodedSparseMatrix> encodedMatrix;
+
+    // The instruction set used for multiplications with the compact matrix. Scalar means that no vectorized kernels are used.
+    storm::utility::simd::InstructionSet instructionSet;
+
+    // Stores the results of the individual rows when multiplying and reducing with vectorized kernels.
+    mutable std::vector<ValueType> rowValues;
 };
 
 }  // namespace solver
@@ -1,5 +1,11 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <iterator>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -16,7 +22,31 @@ template<typename ValueType, ScalingMode Mode>
 EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix)
     : matrix(matrix), transposedMatrix(transposedMatrix) {
-    // Intentionally left empty.
+    // Only operations on rational functions are expensive enough to be worth memoizing.
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        uint64_t operationCacheSize = storm::settings::hasModule<storm::settings::modules::EliminationSettings>()
+                                          ? storm::settings::getModule<storm::settings::modules::EliminationSettings>().getOperationCacheSize()
+                                          : storm::settings::modules::EliminationSettings::DefaultOperationCacheSize;
+        if (operationCacheSize > 0) {
+            operationCache = std::make_unique<OperationCache<ValueType>>(operationCacheSize);
+        }
+    }
+}
+
+template<typename ValueType, ScalingMode Mode>
+ValueType EliminatorBase<ValueType, Mode>::multiply(ValueType const& first, ValueType const& second) {
+    if (operationCache) {
+        return operationCache->multiply(first, second);
+    }
+    return storm::utility::simplify((ValueType)(first * second));
+}
+
+template<typename ValueType, ScalingMode Mode>
+ValueType EliminatorBase<ValueType, Mode>::add(ValueType const& first, ValueType const& second) {
+    if (operationCache) {
+        return operationCache->add(first, second);
+    }
+    return storm::utility::simplify((ValueType)(first + second));
 }
 
 template<typename ValueType, ScalingMode Mode>
@@ -61,7 +91,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Only scale the entries in a different column.
             if (entryIt->getColumn() != column) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(multiply(entryIt->getValue(), columnValue));
             }
         }
         updateValue(row, columnValue);
@@ -75,10 +105,12 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
     FlexibleRowType rowsKeepingEntryInColumnEqualRow;
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-    // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+    // column d. The lists are kept across eliminations to reuse their memory.
+    if (newBackwardEntries.size() < entriesInRow.size()) {
+        newBackwardEntries.resize(entriesInRow.size());
+    }
+    for (uint64_t successorOffset = 0; successorOffset < entriesInRow.size(); ++successorOffset) {
+        newBackwardEntries[successorOffset].clear();
     }
 
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -123,7 +155,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        FlexibleRowType& newSuccessors = mergedRow;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
 
@@ -150,7 +183,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                auto successorEntry = typename FlexibleRowType::value_type(first2->getColumn(), multiply(first2->getValue(), multiplyFactor));
                 *result = successorEntry;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
                 ++first2;
@@ -159,9 +192,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                auto probability = storm::utility::simplify(sum);
+                auto probability = add(first1->getValue(), multiply(multiplyFactor, first2->getValue()));
                 *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
                                                       typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
@@ -172,15 +203,15 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                auto stateProbability = typename FlexibleRowType::value_type(first2->getColumn(), multiply(first2->getValue(), multiplyFactor));
                 *result = stateProbability;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
                 ++successorOffsetInNewBackwardTransitions;
             }
         }
 
-        // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        // Now move the new transitions in place. This reuses the memory of the row if it is large enough.
+        predecessorForwardTransitions.assign(std::make_move_iterator(newSuccessors.begin()), std::make_move_iterator(newSuccessors.end()));
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -217,7 +248,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        FlexibleRowType& newPredecessors = mergedRow;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
 
@@ -257,8 +289,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                              return a.getColumn() != row;
                          });
         }
-        // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        // Now move the new predecessors in place. This reuses the memory of the row if it is large enough.
+        successorBackwardTransitions.assign(std::make_move_iterator(newPredecessors.begin()), std::make_move_iterator(newPredecessors.end()));
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "storm/storage/sparse/StateType.h"
 
+#include "storm/solver/stateelimination/OperationCache.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 
 namespace storm {
@@ -32,8 +36,26 @@ class EliminatorBase {
     virtual bool isFilterPredecessor() const;
 
    protected:
+    /*!
+     * Retrieves the simplified product of the given values (memoized for rational functions, see EliminationSettings).
+     */
+    ValueType multiply(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Retrieves the simplified sum of the given values (memoized for rational functions, see EliminationSettings).
+     */
+    ValueType add(ValueType const& first, ValueType const& second);
+
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+   private:
+    // The memoized results of arithmetic operations, if enabled.
+    std::unique_ptr<OperationCache<ValueType>> operationCache;
+
+    // Buffers that are reused by all eliminations, so merging rows does not allocate a new row each time.
+    FlexibleRowType mergedRow;
+    std::vector<FlexibleRowType> newBackwardEntries;
 };
 
 }  // namespace stateelimination
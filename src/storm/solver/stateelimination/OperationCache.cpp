@@ -0,0 +1,68 @@
+#include "storm/solver/stateelimination/OperationCache.h"
+
+#include <functional>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+OperationCache<ValueType>::OperationCache(uint64_t maximalSize) : maximalSize(maximalSize) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+    return lookup(products, first, second, true);
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::add(ValueType const& first, ValueType const& second) {
+    return lookup(sums, first, second, false);
+}
+
+template<typename ValueType>
+void OperationCache<ValueType>::clear() {
+    products.clear();
+    sums.clear();
+}
+
+template<typename ValueType>
+std::size_t OperationCache<ValueType>::OperandsHash::operator()(std::pair<ValueType, ValueType> const& operands) const {
+    std::hash<ValueType> hasher;
+    std::size_t seed = hasher(operands.first);
+    seed ^= hasher(operands.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+template<typename ValueType>
+ValueType const& OperationCache<ValueType>::lookup(ResultMap& results, ValueType const& first, ValueType const& second, bool multiplication) {
+    // Both operations are commutative, so the operands are ordered by their hash to find the result for either order.
+    std::hash<ValueType> hasher;
+    bool swapOperands = hasher(second) < hasher(first);
+    std::pair<ValueType, ValueType> operands = swapOperands ? std::make_pair(second, first) : std::make_pair(first, second);
+
+    auto resultIt = results.find(operands);
+    if (resultIt != results.end()) {
+        return resultIt->second;
+    }
+
+    ValueType result = multiplication ? storm::utility::simplify((ValueType)(first * second)) : storm::utility::simplify((ValueType)(first + second));
+    if (results.size() >= maximalSize) {
+        results.clear();
+    }
+    return results.emplace(std::move(operands), std::move(result)).first->second;
+}
+
+template class OperationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class OperationCache<storm::RationalNumber>;
+template class OperationCache<storm::RationalFunction>;
+#endif
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+/*!
+ * Memoizes the (simplified) results of products and sums. During state elimination, the same pairs of operands are often combined over and
+ * over again, e.g. when the probability to reach an eliminated state is multiplied with its outgoing probabilities in several predecessors.
+ * For rational functions, each of these operations involves an expensive gcd computation, which the cache avoids. The number of memoized
+ * results is bounded; once the bound is reached, all results are dropped.
+ */
+template<typename ValueType>
+class OperationCache {
+   public:
+    /*!
+     * Creates a cache that memoizes at most the given number of results per operation.
+     */
+    explicit OperationCache(uint64_t maximalSize);
+
+    /*!
+     * Retrieves the simplified product of the given values.
+     */
+    ValueType multiply(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Retrieves the simplified sum of the given values.
+     */
+    ValueType add(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Drops all memoized results.
+     */
+    void clear();
+
+   private:
+    struct OperandsHash {
+        std::size_t operator()(std::pair<ValueType, ValueType> const& operands) const;
+    };
+    typedef std::unordered_map<std::pair<ValueType, ValueType>, ValueType, OperandsHash> ResultMap;
+
+    ValueType const& lookup(ResultMap& results, ValueType const& first, ValueType const& second, bool multiplication);
+
+    uint64_t maximalSize;
+    ResultMap products;
+    ResultMap sums;
+};
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
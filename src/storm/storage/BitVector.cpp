@@ -8,6 +8,7 @@
 #include "storm/utility/Hash.h"
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/simd.h"
 
 #ifdef STORM_DEV
 #define ASSERT_BITVECTOR
@@ -292,41 +293,48 @@ void BitVector::grow(uint_fast64_t minimumLength, bool init) {
     }
 }
 
+namespace {
+// Bulk operations on at least this many buckets are dispatched to the vectorized kernels. For smaller bit vectors, the dispatch does not pay off.
+uint64_t const minimalBucketCountForSimd = 8;
+
+void applyBitwiseOperation(storm::utility::simd::BitwiseOperation operation, uint64_t bucketCount, uint64_t const* first, uint64_t const* second,
+                           uint64_t* result) {
+    storm::utility::simd::applyBitwiseOperation(
+        bucketCount >= minimalBucketCountForSimd ? storm::utility::simd::getSupportedInstructionSet() : storm::utility::simd::InstructionSet::Scalar,
+        operation, bucketCount, first, second, result);
+}
+}  // namespace
+
 BitVector BitVector::operator&(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::And, this->bucketCount(), this->buckets, other.buckets, result.buckets);
     return result;
 }
 
 BitVector& BitVector::operator&=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::And, this->bucketCount(), this->buckets, other.buckets, this->buckets);
     return *this;
 }
 
 BitVector BitVector::operator|(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::Or, this->bucketCount(), this->buckets, other.buckets, result.buckets);
     return result;
 }
 
 BitVector& BitVector::operator|=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::Or, this->bucketCount(), this->buckets, other.buckets, this->buckets);
     return *this;
 }
 
 BitVector BitVector::operator^(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a ^ b; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::Xor, this->bucketCount(), this->buckets, other.buckets, result.buckets);
     result.truncateLastBucket();
     return result;
 }
@@ -361,13 +369,13 @@ BitVector BitVector::operator%(BitVector const& filter) const {
 
 BitVector BitVector::operator~() const {
     BitVector result(this->bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), result.buckets, [](uint64_t const& a) { return ~a; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::Complement, this->bucketCount(), this->buckets, nullptr, result.buckets);
     result.truncateLastBucket();
     return result;
 }
 
 void BitVector::complement() {
-    std::transform(this->buckets, this->buckets + this->bucketCount(), this->buckets, [](uint64_t const& a) { return ~a; });
+    applyBitwiseOperation(storm::utility::simd::BitwiseOperation::Complement, this->bucketCount(), this->buckets, nullptr, this->buckets);
     truncateLastBucket();
 }
 
@@ -638,23 +646,9 @@ uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) cons
 
     // First, count all full buckets.
     uint_fast64_t bucket = index >> 6;
-    for (uint_fast64_t i = 0; i < bucket; ++i) {
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-        // If the target machine does not support SSE4, this will fail.
-        result += _mm_popcnt_u64(bucketVector[i]);
-#else
-        uint_fast32_t cnt;
-        uint_fast64_t bitset = buckets[i];
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
-    }
+    result += storm::utility::simd::countSetBits(
+        bucket >= minimalBucketCountForSimd ? storm::utility::simd::getSupportedInstructionSet() : storm::utility::simd::InstructionSet::Scalar, bucket,
+        buckets);
 
     // Now check if we have to count part of a bucket.
     uint64_t tmp = index & mod64mask;
@@ -692,6 +686,29 @@ std::vector<uint_fast64_t> BitVector::getNumberOfSetBitsBeforeIndices() const {
     return bitsSetBeforeIndices;
 }
 
+std::vector<uint64_t> BitVector::getSetIndices() const {
+    std::vector<uint64_t> result;
+    result.reserve(getNumberOfSetBits());
+    uint64_t const* bucketIt = buckets;
+    for (uint64_t bucketStart = 0; bucketStart < bitCount; bucketStart += 64, ++bucketIt) {
+        // The bits beyond the size of the vector are never set, so the last bucket does not need special treatment.
+        uint64_t remainingInBucket = *bucketIt;
+        while (remainingInBucket != 0) {
+#if (defined(__GNUG__) || defined(__clang__))
+            uint64_t bitInBucket = __builtin_clzll(remainingInBucket);
+#else
+            uint64_t bitInBucket = 0;
+            while ((remainingInBucket & (1ull << (63 - bitInBucket))) == 0) {
+                ++bitInBucket;
+            }
+#endif
+            result.push_back(bucketStart + bitInBucket);
+            remainingInBucket &= ~(1ull << (63 - bitInBucket));
+        }
+    }
+    return result;
+}
+
 size_t BitVector::size() const {
     return static_cast<size_t>(bitCount);
 }
@@ -740,10 +757,14 @@ uint_fast64_t BitVector::getNextIndexWithValue(bool value, uint64_t const* dataP
 
             // Check if there is at least one bit in the remainder of the bucket that is set to true.
             if (remainingInBucket != 0) {
-                // As long as the current bit is not set, move the current bit.
+                // Find the first (i.e. most significant) bit that is set.
+#if (defined(__GNUG__) || defined(__clang__))
+                currentBitInByte = __builtin_clzll(remainingInBucket);
+#else
                 while ((remainingInBucket & (1ull << (63 - currentBitInByte))) == 0) {
                     ++currentBitInByte;
                 }
+#endif
 
                 // Only return the index of the set bit if we are still in the valid range.
                 if (startingIndex + currentBitInByte < endIndex) {
@@ -766,10 +787,14 @@ uint_fast64_t BitVector::getNextIndexWithValue(bool value, uint64_t const* dataP
 
             // Check if there is at least one bit in the remainder of the bucket that is set to false.
             if (remainingInBucket != (-1ull & mask)) {
-                // As long as the current bit is not false, move the current bit.
+                // Find the first (i.e. most significant) bit within the mask that is not set.
+#if (defined(__GNUG__) || defined(__clang__))
+                currentBitInByte = __builtin_clzll(~remainingInBucket & mask);
+#else
                 while ((remainingInBucket & (1ull << (63 - currentBitInByte))) != 0) {
                     ++currentBitInByte;
                 }
+#endif
 
                 // Only return the index of the set bit if we are still in the valid range.
                 if (startingIndex + currentBitInByte < endIndex) {
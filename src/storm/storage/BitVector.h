@@ -486,6 +486,14 @@ class BitVector {
      */
     std::vector<uint_fast64_t> getNumberOfSetBitsBeforeIndices() const;
 
+    /*!
+     * Retrieves the indices of all set bits in ascending order. This is faster than collecting the indices with the iterators as the bits
+     * are extracted bucket-wise.
+     *
+     * @return The indices of the set bits.
+     */
+    std::vector<uint64_t> getSetIndices() const;
+
     /*!
      * Retrieves the number of bits this bit vector can store.
      *
@@ -8,15 +8,22 @@
 
 namespace storm {
 namespace storage {
+
+namespace {
+// The number of buckets of the previous storage that are migrated with each insertion. As the size is doubled once the load factor is
+// exceeded, this finishes the migration long before the load factor is exceeded again.
+uint64_t constexpr MigratedBucketsPerInsertion = 4;
+}  // namespace
+
 template<class ValueType, class Hash>
-BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::BitVectorHashMapIterator(BitVectorHashMap const& map, BitVector::const_iterator indexIt)
-    : map(map), indexIt(indexIt) {
+BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::BitVectorHashMapIterator(BitVectorHashMap const& map, uint64_t bucket)
+    : map(map), bucket(bucket) {
     // Intentionally left empty.
 }
 
 template<class ValueType, class Hash>
 bool BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator==(BitVectorHashMapIterator const& other) {
-    return &map == &other.map && *indexIt == *other.indexIt;
+    return &map == &other.map && bucket == other.bucket;
 }
 
 template<class ValueType, class Hash>
@@ -26,24 +33,24 @@ bool BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator!=(Bit
 
 template<class ValueType, class Hash>
 typename BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator& BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator++(int) {
-    ++indexIt;
+    bucket = map.getNextOccupiedBucket(bucket + 1);
     return *this;
 }
 
 template<class ValueType, class Hash>
 typename BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator& BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator++() {
-    ++indexIt;
+    bucket = map.getNextOccupiedBucket(bucket + 1);
     return *this;
 }
 
 template<class ValueType, class Hash>
 std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator*() const {
-    return map.getBucketAndValue(*indexIt);
+    return map.getBucketAndValue(bucket);
 }
 
 template<class ValueType, class Hash>
 BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
-    : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
+    : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), previousSize(0), migrationPosition(0), numberOfElements(0) {
     STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
 
     while (initialSize > 0) {
@@ -72,26 +79,59 @@ uint64_t BitVectorHashMap<ValueType, Hash>::capacity() const {
     return 1ull << currentSize;
 }
 
+template<class ValueType, class Hash>
+bool BitVectorHashMap<ValueType, Hash>::isResizing() const {
+    return !previousValues.empty();
+}
+
+template<class ValueType, class Hash>
+uint64_t BitVectorHashMap<ValueType, Hash>::getNumberOfBuckets() const {
+    return (1ull << currentSize) + previousValues.size();
+}
+
 template<class ValueType, class Hash>
 void BitVectorHashMap<ValueType, Hash>::increaseSize() {
+    // A pending migration has to be finished first, as only one previous storage is kept.
+    if (isResizing()) {
+        migrateBuckets(previousValues.size() - migrationPosition);
+    }
+
     ++currentSize;
     STORM_LOG_TRACE("Increasing size of hash map from " << (1ull << (currentSize - 1)) << " to " << (1ull << currentSize) << ".");
 
-    // Create new containers and swap them with the old ones.
-    storm::storage::BitVector oldBuckets(bucketSize * (1ull << currentSize));
-    std::swap(oldBuckets, buckets);
-    storm::storage::BitVector oldOccupied = storm::storage::BitVector(1ull << currentSize);
-    std::swap(oldOccupied, occupied);
-    std::vector<ValueType> oldValues = std::vector<ValueType>(1ull << currentSize);
-    std::swap(oldValues, values);
-
-    // Now iterate through the elements and reinsert them in the new storage.
-    uint64_t oldSize = numberOfElements;
-    numberOfElements = 0;
-    for (auto bucketIndex : oldOccupied) {
-        findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+    // Create new containers and keep the old ones until their entries are migrated.
+    previousSize = currentSize - 1;
+    previousBuckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+    std::swap(previousBuckets, buckets);
+    previousOccupied = storm::storage::BitVector(1ull << currentSize);
+    std::swap(previousOccupied, occupied);
+    previousValues = std::vector<ValueType>(1ull << currentSize);
+    std::swap(previousValues, values);
+    migrationPosition = 0;
+}
+
+template<class ValueType, class Hash>
+void BitVectorHashMap<ValueType, Hash>::migrateBuckets(uint64_t numberOfBuckets) {
+    uint64_t end = std::min<uint64_t>(migrationPosition + numberOfBuckets, previousValues.size());
+    for (uint64_t bucket = previousOccupied.getNextSetIndex(migrationPosition); bucket < end; bucket = previousOccupied.getNextSetIndex(bucket + 1)) {
+        // The entries of the previous storage are distinct, so the key can not be contained in the current storage.
+        storm::storage::BitVector key = previousBuckets.get(bucket * bucketSize, bucketSize);
+        std::pair<bool, uint64_t> flagAndBucket = findBucketInStorage(key, buckets, occupied, currentSize);
+        STORM_LOG_ASSERT(!flagAndBucket.first, "Key was migrated twice.");
+        buckets.set(flagAndBucket.second * bucketSize, key);
+        occupied.set(flagAndBucket.second);
+        values[flagAndBucket.second] = previousValues[bucket];
+    }
+    migrationPosition = end;
+
+    if (migrationPosition == previousValues.size()) {
+        STORM_LOG_ASSERT(occupied.getNumberOfSetBits() == numberOfElements,
+                         "Size mismatch in rehashing. Size before was " << numberOfElements << " and new size is " << occupied.getNumberOfSetBits() << ".");
+        previousBuckets = storm::storage::BitVector();
+        previousOccupied = storm::storage::BitVector();
+        previousValues = std::vector<ValueType>();
+        migrationPosition = 0;
     }
-    STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
 }
 
 template<class ValueType, class Hash>
@@ -101,11 +141,14 @@ ValueType BitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector
 
 template<class ValueType, class Hash>
 std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+    if (isResizing()) {
+        migrateBuckets(MigratedBucketsPerInsertion);
+    }
     checkIncreaseSize();
 
     std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key);
     if (flagAndBucket.first) {
-        return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
+        return std::make_pair(getValue(flagAndBucket.second), flagAndBucket.second);
     } else {
         // Insert the new bits into the bucket.
         buckets.set(flagAndBucket.second * bucketSize, key);
@@ -130,12 +173,22 @@ template<class ValueType, class Hash>
 ValueType BitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
     std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
     STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
-    return values[flagBucketPair.second];
+    return getValue(flagBucketPair.second);
 }
 
 template<class ValueType, class Hash>
 ValueType BitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
-    return values[bucket];
+    uint64_t numberOfCurrentBuckets = 1ull << currentSize;
+    return bucket < numberOfCurrentBuckets ? values[bucket] : previousValues[bucket - numberOfCurrentBuckets];
+}
+
+template<class ValueType, class Hash>
+boost::optional<ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    if (flagBucketPair.first) {
+        return getValue(flagBucketPair.second);
+    }
+    return boost::none;
 }
 
 template<class ValueType, class Hash>
@@ -145,30 +198,47 @@ bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const
 
 template<class ValueType, class Hash>
 typename BitVectorHashMap<ValueType, Hash>::const_iterator BitVectorHashMap<ValueType, Hash>::begin() const {
-    return const_iterator(*this, occupied.begin());
+    return const_iterator(*this, getNextOccupiedBucket(0));
 }
 
 template<class ValueType, class Hash>
 typename BitVectorHashMap<ValueType, Hash>::const_iterator BitVectorHashMap<ValueType, Hash>::end() const {
-    return const_iterator(*this, occupied.end());
+    return const_iterator(*this, getNumberOfBuckets());
+}
+
+template<class ValueType, class Hash>
+uint64_t BitVectorHashMap<ValueType, Hash>::getNextOccupiedBucket(uint64_t bucket) const {
+    uint64_t numberOfCurrentBuckets = 1ull << currentSize;
+    if (bucket < numberOfCurrentBuckets) {
+        bucket = occupied.getNextSetIndex(bucket);
+        if (bucket < numberOfCurrentBuckets || !isResizing()) {
+            return bucket;
+        }
+    }
+    if (!isResizing()) {
+        return numberOfCurrentBuckets;
+    }
+    // The buckets of the previous storage before the migration position have already been migrated.
+    return numberOfCurrentBuckets + previousOccupied.getNextSetIndex(std::max(bucket - numberOfCurrentBuckets, migrationPosition));
 }
 
 template<class ValueType, class Hash>
-uint64_t BitVectorHashMap<ValueType, Hash>::getCurrentShiftWidth() const {
-    return (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - currentSize);
+uint64_t BitVectorHashMap<ValueType, Hash>::getShiftWidth(uint64_t storageSize) const {
+    return (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - storageSize);
 }
 
 template<class ValueType, class Hash>
-std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
-    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
-    uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
+std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucketInStorage(storm::storage::BitVector const& key,
+                                                                                 storm::storage::BitVector const& storageBuckets,
+                                                                                 storm::storage::BitVector const& storageOccupied, uint64_t storageSize) const {
+    uint64_t bucket = hasher(key) >> this->getShiftWidth(storageSize);
 
-    while (isBucketOccupied(bucket)) {
-        if (buckets.matches(bucket * bucketSize, key)) {
+    while (storageOccupied.get(bucket)) {
+        if (storageBuckets.matches(bucket * bucketSize, key)) {
             return std::make_pair(true, bucket);
         }
         ++bucket;
-        if (bucket == (1ull << currentSize)) {
+        if (bucket == (1ull << storageSize)) {
             bucket = 0;
         }
     }
@@ -176,9 +246,29 @@ std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::s
     return std::make_pair(false, bucket);
 }
 
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    std::pair<bool, uint64_t> flagAndBucket = findBucketInStorage(key, buckets, occupied, currentSize);
+    if (!flagAndBucket.first && isResizing()) {
+        // The previous storage is never modified, so its collision chains are still intact. Keys that are found in its migrated part
+        // would also have been found in the current storage.
+        std::pair<bool, uint64_t> previousFlagAndBucket = findBucketInStorage(key, previousBuckets, previousOccupied, previousSize);
+        if (previousFlagAndBucket.first) {
+            return std::make_pair(true, (1ull << currentSize) + previousFlagAndBucket.second);
+        }
+    }
+    return flagAndBucket;
+}
+
 template<class ValueType, class Hash>
 std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
-    return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
+    uint64_t numberOfCurrentBuckets = 1ull << currentSize;
+    if (bucket < numberOfCurrentBuckets) {
+        return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
+    }
+    bucket -= numberOfCurrentBuckets;
+    return std::make_pair(previousBuckets.get(bucket * bucketSize, bucketSize), previousValues[bucket]);
 }
 
 template<class ValueType, class Hash>
@@ -186,6 +276,11 @@ void BitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType
     for (auto pos : occupied) {
         values[pos] = remapping(values[pos]);
     }
+    if (isResizing()) {
+        for (uint64_t pos = previousOccupied.getNextSetIndex(migrationPosition); pos < previousValues.size(); pos = previousOccupied.getNextSetIndex(pos + 1)) {
+            previousValues[pos] = remapping(previousValues[pos]);
+        }
+    }
 }
 
 template class BitVectorHashMap<uint64_t>;
@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <functional>
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/BitVector.h"
 
 namespace storm {
@@ -13,6 +15,11 @@ namespace storage {
  * This class represents a hash-map whose keys are bit vectors. The value type is arbitrary. Currently, only
  * queries and insertions are supported. Also, the keys must be bit vectors with a length that is a multiple of
  * 64.
+ *
+ * If the load factor is exceeded, the number of buckets is doubled. Instead of rehashing all entries at once, the
+ * previous buckets are kept until their entries have been migrated to the new buckets. Each insertion migrates a few
+ * of them, so the insertions take roughly the same time (even for huge maps) and the migration is finished long before
+ * the next increase. While migrating, the buckets of the previous storage are numbered after the current ones.
  */
 //        template<typename ValueType, typename Hash = std::hash<storm::storage::BitVector>>
 //        template<typename ValueType, typename Hash = FNV1aBitVectorHash>
@@ -24,9 +31,9 @@ class BitVectorHashMap {
         /*! Creates an iterator that points to the bucket with the given index in the given map.
          *
          * @param map The map of the iterator.
-         * @param indexIt An iterator to the index of the bucket the iterator points to.
+         * @param bucket The index of the (occupied) bucket the iterator points to.
          */
-        BitVectorHashMapIterator(BitVectorHashMap const& map, BitVector::const_iterator indexIt);
+        BitVectorHashMapIterator(BitVectorHashMap const& map, uint64_t bucket);
 
         // Methods to compare two iterators.
         bool operator==(BitVectorHashMapIterator const& other);
@@ -43,8 +50,8 @@ class BitVectorHashMap {
         // The map this iterator refers to.
         BitVectorHashMap const& map;
 
-        // An iterator to the bucket this iterator points to.
-        BitVector::const_iterator indexIt;
+        // The index of the bucket this iterator points to.
+        uint64_t bucket;
     };
 
     typedef BitVectorHashMapIterator const_iterator;
@@ -109,6 +116,15 @@ class BitVectorHashMap {
      */
     ValueType getValue(uint64_t bucket) const;
 
+    /*!
+     * Retrieves the value associated with the given key if the key is contained in the map. As this does not alter
+     * the map, it is safe to call this concurrently as long as no other thread modifies the map.
+     *
+     * @param key The key to search.
+     * @return The value associated with the key or none if the key is not contained in the map.
+     */
+    boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Checks if the given key is already contained in the map.
      *
@@ -145,6 +161,13 @@ class BitVectorHashMap {
      */
     uint64_t capacity() const;
 
+    /*!
+     * Retrieves whether the entries of the previous storage are still being migrated after an increase of the size.
+     *
+     * @return True iff the previous storage is still present.
+     */
+    bool isResizing() const;
+
     /*!
      * Performs a remapping of all values stored by applying the given remapping.
      *
@@ -166,10 +189,35 @@ class BitVectorHashMap {
      *
      * @param key The key to search for.
      * @return A pair whose first component indicates whether the key is already contained in the map and whose
-     * second component indicates in which bucket the key is stored.
+     * second component indicates in which bucket the key is stored. If the key is not contained, the bucket is
+     * the free bucket of the current storage into which the key is to be inserted.
      */
     std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key) const;
 
+    /*!
+     * Searches for the bucket with the given key in the given storage.
+     *
+     * @param key The key to search for.
+     * @param storageBuckets The buckets of the storage.
+     * @param storageOccupied The occupied buckets of the storage.
+     * @param storageSize The number of buckets of the storage is 2^storageSize.
+     * @return A pair as for findBucket, where the bucket is an index of the given storage.
+     */
+    std::pair<bool, uint64_t> findBucketInStorage(storm::storage::BitVector const& key, storm::storage::BitVector const& storageBuckets,
+                                                  storm::storage::BitVector const& storageOccupied, uint64_t storageSize) const;
+
+    /*!
+     * Retrieves the first occupied bucket whose index is at least the given one.
+     *
+     * @return The index of the bucket or the number of buckets if there is no such bucket.
+     */
+    uint64_t getNextOccupiedBucket(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the number of buckets of the current storage and (while resizing) the previous storage.
+     */
+    uint64_t getNumberOfBuckets() const;
+
     /*!
      * Inserts the given key-value pair without resizing the underlying storage. If that fails, this is
      * indicated by the return value.
@@ -181,10 +229,18 @@ class BitVectorHashMap {
     bool insertWithoutIncreasingSize(storm::storage::BitVector const& key, ValueType const& value);
 
     /*!
-     * Increases the size of the hash map and performs the necessary rehashing of all entries.
+     * Increases the size of the hash map. The entries are kept in the previous storage until they are migrated.
      */
     void increaseSize();
 
+    /*!
+     * Migrates the entries of the given number of buckets of the previous storage to the current storage. Once all
+     * buckets are migrated, the previous storage is released.
+     *
+     * @param numberOfBuckets The number of buckets to migrate.
+     */
+    void migrateBuckets(uint64_t numberOfBuckets);
+
     /*!
      * Checks whether the size should be increased and does so if necessary.
      *
@@ -193,9 +249,10 @@ class BitVectorHashMap {
     bool checkIncreaseSize();
 
     /*!
-     * Determines the number of bits by which the hash value must be shifted to obtain a value in the legal range.
+     * Determines the number of bits by which the hash value must be shifted to obtain a bucket of a storage with
+     * 2^storageSize buckets.
      */
-    uint64_t getCurrentShiftWidth() const;
+    uint64_t getShiftWidth(uint64_t storageSize) const;
 
     // The load factor determining when the size of the map is increased.
     double loadFactor;
@@ -215,6 +272,14 @@ class BitVectorHashMap {
     // A vector of the mapped-to values. The entry at position i is the "target" of the key in bucket i.
     std::vector<ValueType> values;
 
+    // The storage before the last increase of the size. The buckets before the migration position have already been
+    // migrated to the current storage. All containers are empty if no migration is pending.
+    uint64_t previousSize;
+    storm::storage::BitVector previousBuckets;
+    storm::storage::BitVector previousOccupied;
+    std::vector<ValueType> previousValues;
+    uint64_t migrationPosition;
+
     // The number of elements in this map.
     uint64_t numberOfElements;
 
@@ -0,0 +1,202 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename ColumnIndexType>
+CompactSparseMatrix<ValueType, ColumnIndexType>::CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : columnCount(matrix.getColumnCount()), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+    STORM_LOG_THROW(canRepresent(matrix), storm::exceptions::InvalidArgumentException,
+                    "The column count " << matrix.getColumnCount() << " of the matrix exceeds the range of the column index type.");
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+    rowIndications.push_back(0);
+    for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(static_cast<ColumnIndexType>(entry.getColumn()));
+            values.push_back(entry.getValue());
+        }
+        rowIndications.push_back(columns.size());
+    }
+    rowGroupIndices = matrix.getRowGroupIndices();
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool CompactSparseMatrix<ValueType, ColumnIndexType>::canRepresent(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return matrix.getColumnCount() == 0 || matrix.getColumnCount() - 1 <= static_cast<index_type>(std::numeric_limits<ColumnIndexType>::max());
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getEntryCount() const {
+    return values.size();
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool CompactSparseMatrix<ValueType, ColumnIndexType>::hasTrivialRowGrouping() const {
+    return trivialRowGrouping;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getRowGroupIndices()
+    const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getRowIndications()
+    const {
+    return rowIndications;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<ColumnIndexType> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getColumns() const {
+    return columns;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<ValueType> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getValues() const {
+    return values;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+ValueType CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    addRowProduct(row, vector, result);
+    return result;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::addRowProduct(index_type row, std::vector<ValueType> const& vector, ValueType& value) const {
+    ColumnIndexType const* columnIt = columns.data() + rowIndications[row];
+    ColumnIndexType const* columnIte = columns.data() + rowIndications[row + 1];
+    ValueType const* valueIt = values.data() + rowIndications[row];
+    for (; columnIt != columnIte; ++columnIt, ++valueIt) {
+        value += *valueIt * vector[*columnIt];
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                         std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "The input and output vectors must not be aliased.");
+    multiplyWithVectorForward(vector, result, summand);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                                std::vector<ValueType> const* summand) const {
+    index_type const rowCount = getRowCount();
+    for (index_type row = 0; row < rowCount; ++row) {
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        addRowProduct(row, vector, newValue);
+        result[row] = std::move(newValue);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                                 std::vector<ValueType> const* summand) const {
+    for (index_type row = getRowCount(); row > 0;) {
+        --row;
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        addRowProduct(row, vector, newValue);
+        result[row] = std::move(newValue);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                               std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                               std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    if (dir == OptimizationDirection::Minimize) {
+        multiplyAndReduce<false, storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    } else {
+        multiplyAndReduce<false, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                                std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                                std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    if (dir == OptimizationDirection::Minimize) {
+        multiplyAndReduce<true, storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    } else {
+        multiplyAndReduce<true, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+template<bool Backward, typename Compare>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                                        std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                        std::vector<uint64_t>* choices) const {
+    Compare compare;
+    uint64_t const numberOfGroups = result.size();
+    for (uint64_t step = 0; step < numberOfGroups; ++step) {
+        uint64_t const group = Backward ? numberOfGroups - 1 - step : step;
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        ValueType currentValue;
+        ValueType oldSelectedChoiceValue;
+        uint64_t selectedChoice = 0;
+        for (uint64_t i = 0; i < groupEnd - groupStart; ++i) {
+            uint64_t const localRow = Backward ? groupEnd - groupStart - 1 - i : i;
+            ValueType newValue = summand ? (*summand)[groupStart + localRow] : storm::utility::zero<ValueType>();
+            addRowProduct(groupStart + localRow, vector, newValue);
+            if (choices && localRow == (*choices)[group]) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (i == 0 || compare(newValue, currentValue)) {
+                currentValue = std::move(newValue);
+                selectedChoice = localRow;
+            }
+        }
+
+        // Finally write value to target vector.
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = std::move(currentValue);
+    }
+}
+
+template class CompactSparseMatrix<double, uint32_t>;
+template class CompactSparseMatrix<double, uint64_t>;
+
+#ifdef STORM_HAVE_CARL
+template class CompactSparseMatrix<storm::RationalNumber, uint32_t>;
+template class CompactSparseMatrix<storm::RationalNumber, uint64_t>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
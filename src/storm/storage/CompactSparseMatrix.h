@@ -0,0 +1,134 @@
+#ifndef STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+#define STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class SparseMatrix;
+
+/*!
+ * A read-only copy of a sparse matrix in compressed row storage format that keeps the column indices and the values of the entries in
+ * separate arrays (structure-of-arrays). In contrast to the SparseMatrix, which stores one MatrixEntry (a 64-bit column plus the value) per entry,
+ * the column indices may be stored with a narrower type. For double values and 32-bit columns this reduces the memory that has to be
+ * streamed per entry in matrix-vector multiplications from 16 to 12 bytes.
+ *
+ * @tparam ColumnIndexType The type used to store the column indices. It must be able to represent the column count of the matrix.
+ */
+template<typename ValueType, typename ColumnIndexType = uint32_t>
+class CompactSparseMatrix {
+   public:
+    typedef storm::storage::sparse::state_type index_type;
+    typedef ColumnIndexType column_index_type;
+    typedef ValueType value_type;
+
+    /*!
+     * Creates a compact copy of the given matrix.
+     *
+     * @param matrix The matrix to copy. Its column count must be representable by the column index type.
+     */
+    explicit CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Retrieves whether the column indices of the given matrix can be represented by the column index type.
+     */
+    static bool canRepresent(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getEntryCount() const;
+    index_type getRowGroupCount() const;
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Retrieves the row group indices of the matrix. If the row grouping is trivial, these are 0,1,...,rowCount.
+     */
+    std::vector<index_type> const& getRowGroupIndices() const;
+
+    /*!
+     * Retrieves the vector whose i-th entry is the index of the first entry of row i. The last entry is the number of entries.
+     */
+    std::vector<index_type> const& getRowIndications() const;
+
+    /*!
+     * Retrieves the column indices of all entries (in row-major order).
+     */
+    std::vector<ColumnIndexType> const& getColumns() const;
+
+    /*!
+     * Retrieves the values of all entries (in row-major order).
+     */
+    std::vector<ValueType> const& getValues() const;
+
+    /*!
+     * Multiplies the matrix with the given vector and writes the result to the given result vector.
+     *
+     * @param vector The vector with which to multiply the matrix.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation. Must not be an alias of vector.
+     * @param summand If given, this summand is added to the result of the multiplication.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Performs the multiplication row by row (in forward or backward order) where result and vector may be aliases, i.e.,
+     * a Gauss-Seidel style multiplication if they are.
+     */
+    void multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+    void multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                    std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector, reduces the results of each row group according to the given direction and writes the
+     * result to the given result vector. Result and vector may be aliases (Gauss-Seidel style multiplication).
+     *
+     * @param dir The direction for the reduction step.
+     * @param rowGroupIndices A vector storing the row groups over which to reduce.
+     * @param vector The vector with which to multiply the matrix.
+     * @param summand If given, this summand is added to the result of the multiplication.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param choices If given, the choices made in the reduction process will be written to this vector. Note that
+     * choices are only updated if the value strictly improves.
+     */
+    void multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                  std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+    void multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                   std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Computes the scalar product of the given row with the given vector.
+     */
+    ValueType multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const;
+
+   private:
+    /*!
+     * Adds the scalar product of the given row with the given vector to the given value.
+     */
+    void addRowProduct(index_type row, std::vector<ValueType> const& vector, ValueType& value) const;
+
+    template<bool Backward, typename Compare>
+    void multiplyAndReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    index_type columnCount;
+
+    // The i-th entry is the index of the first entry of row i in 'columns' and 'values'.
+    std::vector<index_type> rowIndications;
+
+    std::vector<ColumnIndexType> columns;
+    std::vector<ValueType> values;
+
+    std::vector<index_type> rowGroupIndices;
+    bool trivialRowGrouping;
+};
+
+}  // namespace storage
+}  // namespace storm
+
+#endif /* STORM_STORAGE_COMPACTSPARSEMATRIX_H_ */
@@ -0,0 +1,243 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <mutex>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Segment::Segment(uint64_t bucketSize, uint64_t logCapacity)
+    : logCapacity(logCapacity),
+      status(new std::atomic<uint8_t>[1ull << logCapacity]),
+      keys(bucketSize * (1ull << logCapacity)),
+      values(1ull << logCapacity),
+      numberOfElements(0) {
+    for (uint64_t bucket = 0; bucket < (1ull << logCapacity); ++bucket) {
+        status[bucket].store(Empty, std::memory_order_relaxed);
+    }
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor,
+                                                                        uint64_t numberOfSegments)
+    : loadFactor(loadFactor), bucketSize(bucketSize), logNumberOfSegments(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    STORM_LOG_ASSERT(loadFactor > 0.0 && loadFactor < 1.0, "Illegal load factor.");
+    while ((1ull << logNumberOfSegments) < numberOfSegments) {
+        ++logNumberOfSegments;
+    }
+
+    // Every segment gets at least 2^10 buckets, so there is always slack for threads that insert at the same time.
+    uint64_t logCapacity = 10;
+    while ((1ull << (logCapacity + logNumberOfSegments)) < initialSize) {
+        ++logCapacity;
+    }
+
+    segments.reserve(1ull << logNumberOfSegments);
+    for (uint64_t segmentIndex = 0; segmentIndex < (1ull << logNumberOfSegments); ++segmentIndex) {
+        segments.push_back(std::make_unique<Segment>(bucketSize, logCapacity));
+    }
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAdd(key, &value, nullptr);
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key,
+                                                                                  std::function<ValueType()> const& valueGenerator) {
+    return findOrAdd(key, nullptr, &valueGenerator);
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const* value,
+                                                                                  std::function<ValueType()> const* valueGenerator) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t hash = hasher(key);
+    Segment& segment = *segments[getSegmentIndex(hash)];
+
+    while (true) {
+        std::shared_lock<std::shared_mutex> lock(segment.resizeMutex);
+        uint64_t const capacity = 1ull << segment.logCapacity;
+        uint64_t const mask = capacity - 1;
+        uint64_t bucket = hash & mask;
+
+        while (true) {
+            uint8_t status = segment.status[bucket].load(std::memory_order_acquire);
+            if (status == Empty) {
+                // Reserve space for the new element first. If this exceeds the load factor, the segment needs to grow.
+                uint64_t observedLogCapacity = segment.logCapacity;
+                if (segment.numberOfElements.fetch_add(1, std::memory_order_relaxed) + 1 > static_cast<uint64_t>(loadFactor * capacity)) {
+                    segment.numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+                    lock.unlock();
+                    increaseSize(segment, observedLogCapacity);
+                    break;
+                }
+
+                uint8_t expected = Empty;
+                if (segment.status[bucket].compare_exchange_strong(expected, Busy, std::memory_order_acq_rel)) {
+                    // We own the bucket now, so we can write key and value without further synchronization.
+                    segment.keys.set(bucket * bucketSize, key);
+                    ValueType newValue = valueGenerator ? (*valueGenerator)() : *value;
+                    segment.values[bucket] = newValue;
+                    segment.status[bucket].store(Occupied, std::memory_order_release);
+                    return std::make_pair(newValue, true);
+                }
+
+                // Some other thread claimed the bucket in the meantime, so we release the reservation and inspect the bucket again.
+                segment.numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+                status = expected;
+            }
+
+            if (status == Busy) {
+                status = waitWhileBusy(segment.status[bucket]);
+            }
+            STORM_LOG_ASSERT(status == Occupied, "Unexpected bucket status.");
+            if (segment.keys.matches(bucket * bucketSize, key)) {
+                return std::make_pair(segment.values[bucket], false);
+            }
+            bucket = (bucket + 1) & mask;
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+boost::optional<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t hash = hasher(key);
+    Segment const& segment = *segments[getSegmentIndex(hash)];
+
+    std::shared_lock<std::shared_mutex> lock(segment.resizeMutex);
+    std::pair<bool, uint64_t> flagAndBucket = findBucket(segment, key, hash);
+    if (flagAndBucket.first) {
+        return segment.values[flagAndBucket.second];
+    }
+    return boost::none;
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return static_cast<bool>(find(key));
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        result += segment->numberOfElements.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        std::shared_lock<std::shared_mutex> lock(segment->resizeMutex);
+        result += 1ull << segment->logCapacity;
+    }
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const {
+    for (auto const& segment : segments) {
+        for (uint64_t bucket = 0; bucket < (1ull << segment->logCapacity); ++bucket) {
+            if (segment->status[bucket].load(std::memory_order_acquire) == Occupied) {
+                function(segment->keys.get(bucket * bucketSize, bucketSize), segment->values[bucket]);
+            }
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+BitVectorHashMap<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::toBitVectorHashMap() const {
+    BitVectorHashMap<ValueType> result(bucketSize, static_cast<uint64_t>(this->size() / 0.75) + 1);
+    forEach([&result](storm::storage::BitVector const& key, ValueType const& value) { result.findOrAdd(key, value); });
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(Segment const& segment, storm::storage::BitVector const& key,
+                                                                                  uint64_t hash) const {
+    uint64_t const mask = (1ull << segment.logCapacity) - 1;
+    uint64_t bucket = hash & mask;
+    while (true) {
+        uint8_t status = segment.status[bucket].load(std::memory_order_acquire);
+        if (status == Empty) {
+            return std::make_pair(false, bucket);
+        }
+        if (status == Busy) {
+            status = waitWhileBusy(segment.status[bucket]);
+        }
+        if (segment.keys.matches(bucket * bucketSize, key)) {
+            return std::make_pair(true, bucket);
+        }
+        bucket = (bucket + 1) & mask;
+    }
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSize(Segment& segment, uint64_t observedLogCapacity) {
+    std::unique_lock<std::shared_mutex> lock(segment.resizeMutex);
+    if (segment.logCapacity != observedLogCapacity) {
+        // Another thread already increased the size.
+        return;
+    }
+
+    // As we hold the lock exclusively, no bucket is busy and we can rehash the segment without synchronization.
+    uint64_t const oldCapacity = 1ull << segment.logCapacity;
+    ++segment.logCapacity;
+    STORM_LOG_TRACE("Increasing size of hash map segment from " << oldCapacity << " to " << (oldCapacity << 1) << ".");
+    uint64_t const mask = (oldCapacity << 1) - 1;
+
+    std::unique_ptr<std::atomic<uint8_t>[]> oldStatus(new std::atomic<uint8_t>[oldCapacity << 1]);
+    std::swap(oldStatus, segment.status);
+    storm::storage::BitVector oldKeys(bucketSize * (oldCapacity << 1));
+    std::swap(oldKeys, segment.keys);
+    std::vector<ValueType> oldValues(oldCapacity << 1);
+    std::swap(oldValues, segment.values);
+    for (uint64_t bucket = 0; bucket <= mask; ++bucket) {
+        segment.status[bucket].store(Empty, std::memory_order_relaxed);
+    }
+
+    for (uint64_t oldBucket = 0; oldBucket < oldCapacity; ++oldBucket) {
+        if (oldStatus[oldBucket].load(std::memory_order_relaxed) == Occupied) {
+            storm::storage::BitVector key = oldKeys.get(oldBucket * bucketSize, bucketSize);
+            uint64_t bucket = hasher(key) & mask;
+            while (segment.status[bucket].load(std::memory_order_relaxed) != Empty) {
+                bucket = (bucket + 1) & mask;
+            }
+            segment.keys.set(bucket * bucketSize, key);
+            segment.values[bucket] = oldValues[oldBucket];
+            segment.status[bucket].store(Occupied, std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getSegmentIndex(uint64_t hash) const {
+    if (logNumberOfSegments == 0) {
+        return 0;
+    }
+    return hash >> (64 - logNumberOfSegments);
+}
+
+template<typename ValueType, typename Hash>
+uint8_t ConcurrentBitVectorHashMap<ValueType, Hash>::waitWhileBusy(std::atomic<uint8_t> const& status) {
+    uint8_t result = status.load(std::memory_order_acquire);
+    while (result == Busy) {
+        std::this_thread::yield();
+        result = status.load(std::memory_order_acquire);
+    }
+    return result;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
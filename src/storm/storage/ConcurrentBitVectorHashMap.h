@@ -0,0 +1,194 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by several threads
+ * at the same time. As for the BitVectorHashMap, only queries and insertions are supported and the keys must be bit
+ * vectors with a length that is a multiple of 64.
+ *
+ * The map is split into segments (selected by the highest bits of the hash value). Each segment is an open-addressing
+ * table with linear probing in which threads claim empty buckets via compare-and-swap, so insertions and queries do not
+ * block each other. Only when a segment needs to grow, the accesses to this particular segment wait until the segment is
+ * rehashed; all other segments remain available.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+class ConcurrentBitVectorHashMap {
+    static_assert(sizeof(decltype(std::declval<Hash>()(std::declval<storm::storage::BitVector>()))) == sizeof(uint64_t),
+                  "The hash function needs to produce 64-bit values.");
+
+   public:
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available (in total over all segments).
+     * @param loadFactor The load factor that determines at which point the size of a segment is increased.
+     * @param numberOfSegments The number of independent segments. This is rounded up to the next power of two.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, uint64_t numberOfSegments = 64);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and the
+     * provided new value otherwise and whose second component indicates whether the key was inserted by this call.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is
+     * inserted with the value produced by the given generator. The generator is invoked exactly once per inserted
+     * key (and not at all if the key is found), which allows to hand out consecutive indices for new keys even if
+     * several threads try to insert the same key. This may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator A function producing the value for a newly inserted key.
+     * @return A pair whose first component is the value associated with the key and whose second component indicates
+     * whether the key was inserted by this call.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Retrieves the value associated with the given key if the key is contained in the map. This may be called
+     * concurrently.
+     *
+     * @param key The key to search.
+     * @return The value associated with the key or none if the key is not contained in the map.
+     */
+    boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map. This may be called concurrently.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying containers (in total over all segments).
+     *
+     * @return The capacity of the underlying containers.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Calls the given function for all key-value pairs of the map. The order is unspecified. This must not be
+     * called while other threads modify the map.
+     *
+     * @param function The function to call.
+     */
+    void forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const;
+
+    /*!
+     * Creates a (sequential) BitVectorHashMap with the same content. This must not be called while other threads
+     * modify the map.
+     *
+     * @return The equivalent sequential hash map.
+     */
+    BitVectorHashMap<ValueType> toBitVectorHashMap() const;
+
+   private:
+    // The possible states of a bucket. A thread that claimed an empty bucket marks it as busy until key and value are written.
+    enum BucketStatus : uint8_t { Empty = 0, Busy = 1, Occupied = 2 };
+
+    struct Segment {
+        Segment(uint64_t bucketSize, uint64_t logCapacity);
+
+        // Guards the segment against being rehashed while it is accessed. Regular accesses acquire it in shared mode.
+        mutable std::shared_mutex resizeMutex;
+
+        // The number of buckets of this segment is 2^logCapacity.
+        uint64_t logCapacity;
+
+        // The status of every bucket.
+        std::unique_ptr<std::atomic<uint8_t>[]> status;
+
+        // The keys stored in this segment. Bucket i occupies the bits [i * bucketSize, (i+1) * bucketSize).
+        storm::storage::BitVector keys;
+
+        // The values stored in this segment.
+        std::vector<ValueType> values;
+
+        // The number of buckets that are occupied (or reserved for an insertion that is in progress).
+        std::atomic<uint64_t> numberOfElements;
+    };
+
+    /*!
+     * Performs the insertion (or retrieval) of the given key. The value to insert is obtained from exactly one of the
+     * two sources, i.e., either the given value or the generator (if given).
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, ValueType const* value, std::function<ValueType()> const* valueGenerator);
+
+    /*!
+     * Searches the given key in the given segment. The caller needs to hold the resize mutex of the segment.
+     *
+     * @return A pair whose first component indicates whether the key is contained and whose second component is the
+     * bucket of the key (if contained) or the first empty bucket on the probing sequence otherwise.
+     */
+    std::pair<bool, uint64_t> findBucket(Segment const& segment, storm::storage::BitVector const& key, uint64_t hash) const;
+
+    /*!
+     * Doubles the capacity of the given segment (unless another thread already did this in the meantime).
+     *
+     * @param segment The segment to grow.
+     * @param observedLogCapacity The capacity of the segment at the time the caller decided that it needs to grow.
+     */
+    void increaseSize(Segment& segment, uint64_t observedLogCapacity);
+
+    /*!
+     * Retrieves the segment (index) which is responsible for the given hash value.
+     */
+    uint64_t getSegmentIndex(uint64_t hash) const;
+
+    /*!
+     * Waits until the given bucket is not busy anymore and returns its status afterwards.
+     */
+    static uint8_t waitWhileBusy(std::atomic<uint8_t> const& status);
+
+    // The load factor determining when the size of a segment is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The number of segments is 2^logNumberOfSegments.
+    uint64_t logNumberOfSegments;
+
+    // The segments of the map.
+    std::vector<std::unique_ptr<Segment>> segments;
+
+    // Functor object that is used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
@@ -0,0 +1,329 @@
+#include "storm/storage/EncodedSparseMatrix.h"
+
+#include <cstring>
+#include <map>
+#include <type_traits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+
+void encodeVarint(uint64_t value, std::vector<uint8_t>& bytes) {
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<uint8_t>(value));
+}
+
+}  // namespace
+
+EncodedSparseMatrix::const_iterator::const_iterator(EncodedSparseMatrix const& matrix, uint8_t const* position, uint8_t const* rowEnd)
+    : matrix(matrix), position(position), rowEnd(rowEnd), nextPosition(position), column(0), value(storm::utility::zero<value_type>()) {
+    decode();
+}
+
+EncodedSparseMatrix::index_type EncodedSparseMatrix::const_iterator::getColumn() const {
+    return column;
+}
+
+EncodedSparseMatrix::value_type EncodedSparseMatrix::const_iterator::getValue() const {
+    return value;
+}
+
+EncodedSparseMatrix::const_iterator& EncodedSparseMatrix::const_iterator::operator++() {
+    position = nextPosition;
+    decode();
+    return *this;
+}
+
+bool EncodedSparseMatrix::const_iterator::operator==(const_iterator const& other) const {
+    return position == other.position;
+}
+
+bool EncodedSparseMatrix::const_iterator::operator!=(const_iterator const& other) const {
+    return position != other.position;
+}
+
+void EncodedSparseMatrix::const_iterator::decode() {
+    if (position == rowEnd) {
+        return;
+    }
+    nextPosition = position;
+    column += decodeVarint(nextPosition);
+    switch (matrix.valueEncoding) {
+        case ValueEncoding::Plain:
+            value = matrix.decodeValue<ValueEncoding::Plain>(nextPosition);
+            break;
+        case ValueEncoding::Dictionary8:
+            value = matrix.decodeValue<ValueEncoding::Dictionary8>(nextPosition);
+            break;
+        case ValueEncoding::Dictionary16:
+            value = matrix.decodeValue<ValueEncoding::Dictionary16>(nextPosition);
+            break;
+    }
+}
+
+EncodedSparseMatrix::const_row::const_row(const_iterator begin, const_iterator end) : beginIterator(begin), endIterator(end) {
+    // Intentionally left empty.
+}
+
+EncodedSparseMatrix::const_iterator EncodedSparseMatrix::const_row::begin() const {
+    return beginIterator;
+}
+
+EncodedSparseMatrix::const_iterator EncodedSparseMatrix::const_row::end() const {
+    return endIterator;
+}
+
+EncodedSparseMatrix::EncodedSparseMatrix(storm::storage::SparseMatrix<value_type> const& matrix, bool useValueDictionary)
+    : columnCount(matrix.getColumnCount()), entryCount(matrix.getEntryCount()), valueEncoding(ValueEncoding::Plain) {
+    // Collect the distinct values to decide whether a dictionary can be used.
+    std::map<value_type, uint64_t> valueToIndex;
+    if (useValueDictionary) {
+        for (auto const& entry : matrix) {
+            if (valueToIndex.emplace(entry.getValue(), 0).second && valueToIndex.size() > (1ull << 16)) {
+                break;
+            }
+        }
+        if (valueToIndex.size() <= (1ull << 16)) {
+            valueEncoding = valueToIndex.size() <= (1ull << 8) ? ValueEncoding::Dictionary8 : ValueEncoding::Dictionary16;
+            valueDictionary.reserve(valueToIndex.size());
+            for (auto& valueIndexPair : valueToIndex) {
+                valueIndexPair.second = valueDictionary.size();
+                valueDictionary.push_back(valueIndexPair.first);
+            }
+        }
+    }
+
+    rowStarts.reserve(matrix.getRowCount() + 1);
+    rowStarts.push_back(0);
+    for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+        index_type previousColumn = 0;
+        for (auto const& entry : matrix.getRow(row)) {
+            STORM_LOG_ASSERT(entry.getColumn() >= previousColumn, "The columns of a row are expected to be sorted.");
+            encodeVarint(entry.getColumn() - previousColumn, encodedEntries);
+            previousColumn = entry.getColumn();
+            switch (valueEncoding) {
+                case ValueEncoding::Plain: {
+                    uint8_t bytes[sizeof(value_type)];
+                    std::memcpy(bytes, &entry.getValue(), sizeof(value_type));
+                    encodedEntries.insert(encodedEntries.end(), bytes, bytes + sizeof(value_type));
+                    break;
+                }
+                case ValueEncoding::Dictionary8:
+                    encodedEntries.push_back(static_cast<uint8_t>(valueToIndex.at(entry.getValue())));
+                    break;
+                case ValueEncoding::Dictionary16: {
+                    uint16_t index = static_cast<uint16_t>(valueToIndex.at(entry.getValue()));
+                    encodedEntries.push_back(static_cast<uint8_t>(index));
+                    encodedEntries.push_back(static_cast<uint8_t>(index >> 8));
+                    break;
+                }
+            }
+        }
+        rowStarts.push_back(encodedEntries.size());
+    }
+    encodedEntries.shrink_to_fit();
+    rowGroupIndices = matrix.getRowGroupIndices();
+}
+
+EncodedSparseMatrix::index_type EncodedSparseMatrix::getRowCount() const {
+    return rowStarts.size() - 1;
+}
+
+EncodedSparseMatrix::index_type EncodedSparseMatrix::getColumnCount() const {
+    return columnCount;
+}
+
+EncodedSparseMatrix::index_type EncodedSparseMatrix::getEntryCount() const {
+    return entryCount;
+}
+
+EncodedSparseMatrix::index_type EncodedSparseMatrix::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+std::vector<EncodedSparseMatrix::index_type> const& EncodedSparseMatrix::getRowGroupIndices() const {
+    return rowGroupIndices;
+}
+
+EncodedSparseMatrix::ValueEncoding EncodedSparseMatrix::getValueEncoding() const {
+    return valueEncoding;
+}
+
+uint64_t EncodedSparseMatrix::getSizeInBytes() const {
+    return encodedEntries.size() + rowStarts.size() * sizeof(uint64_t) + valueDictionary.size() * sizeof(value_type);
+}
+
+EncodedSparseMatrix::const_row EncodedSparseMatrix::getRow(index_type row) const {
+    uint8_t const* rowBegin = encodedEntries.data() + rowStarts[row];
+    uint8_t const* rowEnd = encodedEntries.data() + rowStarts[row + 1];
+    return const_row(const_iterator(*this, rowBegin, rowEnd), const_iterator(*this, rowEnd, rowEnd));
+}
+
+EncodedSparseMatrix::index_type EncodedSparseMatrix::decodeVarint(uint8_t const*& position) {
+    // Most columns differ only slightly from the previous column of the row, so the single-byte case is handled first.
+    index_type result = *position++;
+    if (result < 0x80) {
+        return result;
+    }
+    result &= 0x7f;
+    for (uint64_t shift = 7;; shift += 7) {
+        uint8_t byte = *position++;
+        result |= static_cast<index_type>(byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            return result;
+        }
+    }
+}
+
+template<EncodedSparseMatrix::ValueEncoding Encoding>
+EncodedSparseMatrix::value_type EncodedSparseMatrix::decodeValue(uint8_t const*& position) const {
+    if constexpr (Encoding == ValueEncoding::Plain) {
+        value_type result;
+        std::memcpy(&result, position, sizeof(value_type));
+        position += sizeof(value_type);
+        return result;
+    } else if constexpr (Encoding == ValueEncoding::Dictionary8) {
+        return valueDictionary[*position++];
+    } else {
+        uint16_t index = static_cast<uint16_t>(position[0]) | static_cast<uint16_t>(position[1] << 8);
+        position += 2;
+        return valueDictionary[index];
+    }
+}
+
+template<typename Function>
+void EncodedSparseMatrix::withValueEncoding(Function const& function) const {
+    switch (valueEncoding) {
+        case ValueEncoding::Plain:
+            function(std::integral_constant<ValueEncoding, ValueEncoding::Plain>());
+            break;
+        case ValueEncoding::Dictionary8:
+            function(std::integral_constant<ValueEncoding, ValueEncoding::Dictionary8>());
+            break;
+        case ValueEncoding::Dictionary16:
+            function(std::integral_constant<ValueEncoding, ValueEncoding::Dictionary16>());
+            break;
+    }
+}
+
+template<EncodedSparseMatrix::ValueEncoding Encoding>
+void EncodedSparseMatrix::addRowProduct(index_type row, std::vector<value_type> const& vector, value_type& value) const {
+    uint8_t const* position = encodedEntries.data() + rowStarts[row];
+    uint8_t const* rowEnd = encodedEntries.data() + rowStarts[row + 1];
+    index_type column = 0;
+    while (position != rowEnd) {
+        column += decodeVarint(position);
+        value += decodeValue<Encoding>(position) * vector[column];
+    }
+}
+
+EncodedSparseMatrix::value_type EncodedSparseMatrix::multiplyRowWithVector(index_type row, std::vector<value_type> const& vector) const {
+    value_type result = storm::utility::zero<value_type>();
+    withValueEncoding([&](auto encoding) { addRowProduct<decltype(encoding)::value>(row, vector, result); });
+    return result;
+}
+
+template<EncodedSparseMatrix::ValueEncoding Encoding, bool Backward>
+void EncodedSparseMatrix::multiplyRows(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+    index_type const rowCount = getRowCount();
+    for (index_type step = 0; step < rowCount; ++step) {
+        index_type const row = Backward ? rowCount - 1 - step : step;
+        value_type newValue = summand ? (*summand)[row] : storm::utility::zero<value_type>();
+        addRowProduct<Encoding>(row, vector, newValue);
+        result[row] = newValue;
+    }
+}
+
+void EncodedSparseMatrix::multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result,
+                                             std::vector<value_type> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "The input and output vectors must not be aliased.");
+    multiplyWithVectorForward(vector, result, summand);
+}
+
+void EncodedSparseMatrix::multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result,
+                                                    std::vector<value_type> const* summand) const {
+    withValueEncoding([&](auto encoding) { multiplyRows<decltype(encoding)::value, false>(vector, result, summand); });
+}
+
+void EncodedSparseMatrix::multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result,
+                                                     std::vector<value_type> const* summand) const {
+    withValueEncoding([&](auto encoding) { multiplyRows<decltype(encoding)::value, true>(vector, result, summand); });
+}
+
+void EncodedSparseMatrix::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                   std::vector<value_type> const& vector, std::vector<value_type> const* summand,
+                                                   std::vector<value_type>& result, std::vector<uint64_t>* choices) const {
+    multiplyAndReduce<false>(dir, rowGroupIndices, vector, summand, result, choices);
+}
+
+void EncodedSparseMatrix::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                    std::vector<value_type> const& vector, std::vector<value_type> const* summand,
+                                                    std::vector<value_type>& result, std::vector<uint64_t>* choices) const {
+    multiplyAndReduce<true>(dir, rowGroupIndices, vector, summand, result, choices);
+}
+
+template<bool Backward>
+void EncodedSparseMatrix::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                            std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result,
+                                            std::vector<uint64_t>* choices) const {
+    withValueEncoding([&](auto encoding) {
+        if (dir == OptimizationDirection::Minimize) {
+            multiplyAndReduceRows<decltype(encoding)::value, Backward, storm::utility::ElementLess<value_type>>(rowGroupIndices, vector, summand, result,
+                                                                                                                  choices);
+        } else {
+            multiplyAndReduceRows<decltype(encoding)::value, Backward, storm::utility::ElementGreater<value_type>>(rowGroupIndices, vector, summand, result,
+                                                                                                                     choices);
+        }
+    });
+}
+
+template<EncodedSparseMatrix::ValueEncoding Encoding, bool Backward, typename Compare>
+void EncodedSparseMatrix::multiplyAndReduceRows(std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector,
+                                                std::vector<value_type> const* summand, std::vector<value_type>& result,
+                                                std::vector<uint64_t>* choices) const {
+    Compare compare;
+    uint64_t const numberOfGroups = result.size();
+    for (uint64_t step = 0; step < numberOfGroups; ++step) {
+        uint64_t const group = Backward ? numberOfGroups - 1 - step : step;
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        value_type currentValue = storm::utility::zero<value_type>();
+        value_type oldSelectedChoiceValue = storm::utility::zero<value_type>();
+        uint64_t selectedChoice = 0;
+        for (uint64_t i = 0; i < groupEnd - groupStart; ++i) {
+            uint64_t const localRow = Backward ? groupEnd - groupStart - 1 - i : i;
+            value_type newValue = summand ? (*summand)[groupStart + localRow] : storm::utility::zero<value_type>();
+            addRowProduct<Encoding>(groupStart + localRow, vector, newValue);
+            if (choices && localRow == (*choices)[group]) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (i == 0 || compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = localRow;
+            }
+        }
+
+        // Finally write value to target vector.
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = currentValue;
+    }
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class SparseMatrix;
+
+/*!
+ * A read-only copy of a sparse matrix (with double values) that is compressed for bandwidth-bound matrix-vector multiplications. The
+ * entries of every row are stored as one byte stream. For each entry, the stream holds the difference of its column to the previous column
+ * of the row (or to zero for the first entry) as a variable-length integer with seven bits per byte, followed by the value.
+ * Since the columns of a row are typically close to each other, most columns take a single byte.
+ *
+ * Optionally, the values are replaced by indices into a dictionary of the distinct values of the matrix, which only pays off as most rows
+ * share a small number of different probabilities. The indices take one byte if there are at most 256 distinct values and two bytes if
+ * there are at most 65536 distinct values. Otherwise, the values are stored as they are.
+ */
+class EncodedSparseMatrix {
+   public:
+    typedef storm::storage::sparse::state_type index_type;
+    typedef double value_type;
+
+    /*!
+     * The way in which the values of the entries are stored.
+     */
+    enum class ValueEncoding { Plain, Dictionary8, Dictionary16 };
+
+    /*!
+     * Decodes the entries of a row one after another.
+     */
+    class const_iterator {
+       public:
+        const_iterator(EncodedSparseMatrix const& matrix, uint8_t const* position, uint8_t const* rowEnd);
+
+        index_type getColumn() const;
+        value_type getValue() const;
+
+        const_iterator& operator++();
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+
+       private:
+        // Decodes the entry at the current position (unless the position is the end of the row).
+        void decode();
+
+        EncodedSparseMatrix const& matrix;
+        uint8_t const* position;
+        uint8_t const* rowEnd;
+        uint8_t const* nextPosition;
+        index_type column;
+        value_type value;
+    };
+
+    /*!
+     * The entries of a single row.
+     */
+    class const_row {
+       public:
+        const_row(const_iterator begin, const_iterator end);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+       private:
+        const_iterator beginIterator;
+        const_iterator endIterator;
+    };
+
+    /*!
+     * Creates an encoded copy of the given matrix.
+     *
+     * @param matrix The matrix to copy.
+     * @param useValueDictionary If set, the values are stored as indices into a dictionary if there are at most 65536 distinct values.
+     */
+    explicit EncodedSparseMatrix(storm::storage::SparseMatrix<value_type> const& matrix, bool useValueDictionary = true);
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getEntryCount() const;
+    index_type getRowGroupCount() const;
+    std::vector<index_type> const& getRowGroupIndices() const;
+
+    ValueEncoding getValueEncoding() const;
+
+    /*!
+     * Retrieves the number of bytes that are occupied by the encoded entries, the row offsets and the value dictionary.
+     */
+    uint64_t getSizeInBytes() const;
+
+    /*!
+     * Retrieves the (decoded) entries of the given row.
+     */
+    const_row getRow(index_type row) const;
+
+    /*!
+     * Computes the scalar product of the given row with the given vector.
+     */
+    value_type multiplyRowWithVector(index_type row, std::vector<value_type> const& vector) const;
+
+    /*!
+     * Multiplies the matrix with the given vector and writes the result to the given result vector.
+     *
+     * @param vector The vector with which to multiply the matrix.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation. Must not be an alias of vector.
+     * @param summand If given, this summand is added to the result of the multiplication.
+     */
+    void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+    /*!
+     * Performs the multiplication row by row (in forward or backward order) where result and vector may be aliases, i.e.,
+     * a Gauss-Seidel style multiplication if they are.
+     */
+    void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result,
+                                   std::vector<value_type> const* summand = nullptr) const;
+    void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result,
+                                    std::vector<value_type> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector, reduces the results of each row group according to the given direction and writes the
+     * result to the given result vector. Result and vector may be aliases (Gauss-Seidel style multiplication).
+     *
+     * @param dir The direction for the reduction step.
+     * @param rowGroupIndices A vector storing the row groups over which to reduce.
+     * @param vector The vector with which to multiply the matrix.
+     * @param summand If given, this summand is added to the result of the multiplication.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param choices If given, the choices made in the reduction process will be written to this vector. Note that
+     * choices are only updated if the value strictly improves.
+     */
+    void multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector,
+                                  std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint64_t>* choices = nullptr) const;
+    void multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector,
+                                   std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+   private:
+    /*!
+     * Decodes a variable-length integer and advances the given position behind it.
+     */
+    static index_type decodeVarint(uint8_t const*& position);
+
+    /*!
+     * Decodes a value that is stored with the given encoding and advances the given position behind it.
+     */
+    template<ValueEncoding Encoding>
+    value_type decodeValue(uint8_t const*& position) const;
+
+    /*!
+     * Adds the scalar product of the given row with the given vector to the given value.
+     */
+    template<ValueEncoding Encoding>
+    void addRowProduct(index_type row, std::vector<value_type> const& vector, value_type& value) const;
+
+    template<ValueEncoding Encoding, bool Backward>
+    void multiplyRows(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+
+    template<ValueEncoding Encoding, bool Backward, typename Compare>
+    void multiplyAndReduceRows(std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand,
+                               std::vector<value_type>& result, std::vector<uint64_t>* choices) const;
+
+    template<bool Backward>
+    void multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector,
+                           std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint64_t>* choices) const;
+
+    /*!
+     * Invokes the given callable with an std::integral_constant that holds the value encoding of this matrix, such that the kernels can be
+     * instantiated for each encoding.
+     */
+    template<typename Function>
+    void withValueEncoding(Function const& function) const;
+
+    index_type columnCount;
+    index_type entryCount;
+
+    // The i-th entry is the offset of the bytes of row i in 'encodedEntries'. The last entry is the number of bytes.
+    std::vector<uint64_t> rowStarts;
+
+    std::vector<uint8_t> encodedEntries;
+
+    ValueEncoding valueEncoding;
+
+    // If a dictionary is used, the distinct values of the matrix.
+    std::vector<value_type> valueDictionary;
+
+    std::vector<index_type> rowGroupIndices;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,212 @@
+#include "storm/storage/ExternalSorter.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The maximal number of runs that are merged at once. This bounds the number of open files.
+uint64_t const maximalFanIn = 128;
+
+bool isLess(uint64_t const* first, uint64_t const* second, uint64_t keySize) {
+    return std::lexicographical_compare(first, first + keySize, second, second + keySize);
+}
+
+// Merges the records of the given readers (that already point to their first record, if any) into the given writer.
+void merge(std::vector<RecordFileReader>& readers, std::vector<uint64_t>& heap, RecordFileWriter& writer, uint64_t keySize) {
+    auto heapComparator = [&readers, keySize](uint64_t first, uint64_t second) { return isLess(readers[second].get(), readers[first].get(), keySize); };
+    std::make_heap(heap.begin(), heap.end(), heapComparator);
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), heapComparator);
+        writer.write(readers[heap.back()].get());
+        if (readers[heap.back()].next()) {
+            std::push_heap(heap.begin(), heap.end(), heapComparator);
+        } else {
+            heap.pop_back();
+        }
+    }
+}
+}  // namespace
+
+RecordFileWriter::RecordFileWriter(std::string const& filename, uint64_t recordSize)
+    : stream(filename, std::ios::out | std::ios::binary | std::ios::trunc), filename(filename), recordSize(recordSize), numberOfRecords(0) {
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+}
+
+void RecordFileWriter::write(uint64_t const* record) {
+    stream.write(reinterpret_cast<char const*>(record), recordSize * sizeof(uint64_t));
+    ++numberOfRecords;
+}
+
+void RecordFileWriter::close() {
+    stream.close();
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write file " << filename << ".");
+}
+
+uint64_t RecordFileWriter::getNumberOfRecords() const {
+    return numberOfRecords;
+}
+
+RecordFileReader::RecordFileReader(std::string const& filename, uint64_t recordSize)
+    : stream(filename, std::ios::in | std::ios::binary), record(recordSize) {
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+}
+
+bool RecordFileReader::next() {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(record.data()), record.size() * sizeof(uint64_t)));
+}
+
+uint64_t const* RecordFileReader::get() const {
+    return record.data();
+}
+
+ExternalSorter::ExternalSorter(std::string const& filePrefix, uint64_t recordSize, uint64_t keySize, uint64_t memoryLimit)
+    : filePrefix(filePrefix),
+      recordSize(recordSize),
+      keySize(keySize),
+      // Each record in the buffer also needs an entry of the order vector.
+      recordsPerBuffer(std::max<uint64_t>(1, memoryLimit / ((recordSize + 1) * sizeof(uint64_t)))),
+      numberOfRecords(0),
+      sorted(false),
+      nextBufferPosition(0) {
+    STORM_LOG_ASSERT(keySize <= recordSize, "The key must not be larger than the records.");
+}
+
+ExternalSorter::~ExternalSorter() {
+    readers.clear();
+    for (auto const& run : runs) {
+        std::remove(run.c_str());
+    }
+}
+
+void ExternalSorter::add(uint64_t const* record) {
+    STORM_LOG_ASSERT(!sorted, "Unable to add records after sorting.");
+    buffer.insert(buffer.end(), record, record + recordSize);
+    ++numberOfRecords;
+    if (buffer.size() == recordsPerBuffer * recordSize) {
+        writeRun();
+    }
+}
+
+void ExternalSorter::sortBuffer() {
+    order.resize(buffer.size() / recordSize);
+    for (uint64_t index = 0; index < order.size(); ++index) {
+        order[index] = index;
+    }
+    std::sort(order.begin(), order.end(),
+              [this](uint64_t first, uint64_t second) { return isLess(buffer.data() + first * recordSize, buffer.data() + second * recordSize, keySize); });
+}
+
+void ExternalSorter::writeRun() {
+    sortBuffer();
+    runs.push_back(filePrefix + "-" + std::to_string(runs.size()) + ".run");
+    RecordFileWriter writer(runs.back(), recordSize);
+    for (auto index : order) {
+        writer.write(buffer.data() + index * recordSize);
+    }
+    writer.close();
+    buffer.clear();
+    order.clear();
+}
+
+void ExternalSorter::sort() {
+    STORM_LOG_ASSERT(!sorted, "Records have already been sorted.");
+    sorted = true;
+    if (runs.empty()) {
+        // All records fit into memory.
+        sortBuffer();
+        return;
+    }
+    if (!buffer.empty()) {
+        writeRun();
+    }
+    buffer.shrink_to_fit();
+    order.shrink_to_fit();
+
+    // Merge the runs until they can be merged at once.
+    uint64_t numberOfMergedRuns = 0;
+    while (runs.size() > maximalFanIn) {
+        std::vector<std::string> inputFiles(runs.begin(), runs.begin() + maximalFanIn);
+        std::string outputFile = filePrefix + "-merged-" + std::to_string(numberOfMergedRuns++) + ".run";
+        mergeFiles(inputFiles, outputFile, recordSize, keySize);
+        for (auto const& inputFile : inputFiles) {
+            std::remove(inputFile.c_str());
+        }
+        runs.erase(runs.begin(), runs.begin() + maximalFanIn);
+        runs.push_back(outputFile);
+    }
+
+    readers.reserve(runs.size());
+    for (auto const& run : runs) {
+        readers.emplace_back(run, recordSize);
+        if (readers.back().next()) {
+            readerHeap.push_back(readers.size() - 1);
+        }
+    }
+    std::make_heap(readerHeap.begin(), readerHeap.end(), [this](uint64_t first, uint64_t second) { return isReaderGreater(first, second); });
+}
+
+bool ExternalSorter::isReaderGreater(uint64_t first, uint64_t second) const {
+    return isLess(readers[second].get(), readers[first].get(), keySize);
+}
+
+void ExternalSorter::advanceReader(uint64_t readerIndex) {
+    if (readers[readerIndex].next()) {
+        readerHeap.push_back(readerIndex);
+        std::push_heap(readerHeap.begin(), readerHeap.end(), [this](uint64_t first, uint64_t second) { return isReaderGreater(first, second); });
+    }
+}
+
+bool ExternalSorter::next(uint64_t* record) {
+    STORM_LOG_ASSERT(sorted, "Unable to retrieve records before sorting.");
+    if (runs.empty()) {
+        if (nextBufferPosition == order.size()) {
+            return false;
+        }
+        uint64_t const* source = buffer.data() + order[nextBufferPosition++] * recordSize;
+        std::copy(source, source + recordSize, record);
+        return true;
+    }
+
+    if (readerHeap.empty()) {
+        return false;
+    }
+    std::pop_heap(readerHeap.begin(), readerHeap.end(), [this](uint64_t first, uint64_t second) { return isReaderGreater(first, second); });
+    uint64_t readerIndex = readerHeap.back();
+    readerHeap.pop_back();
+    std::copy(readers[readerIndex].get(), readers[readerIndex].get() + recordSize, record);
+    advanceReader(readerIndex);
+    return true;
+}
+
+uint64_t ExternalSorter::size() const {
+    return numberOfRecords;
+}
+
+uint64_t ExternalSorter::getNumberOfRuns() const {
+    return runs.size();
+}
+
+void ExternalSorter::mergeFiles(std::vector<std::string> const& inputFiles, std::string const& outputFile, uint64_t recordSize, uint64_t keySize) {
+    std::vector<RecordFileReader> inputReaders;
+    std::vector<uint64_t> heap;
+    inputReaders.reserve(inputFiles.size());
+    for (auto const& inputFile : inputFiles) {
+        inputReaders.emplace_back(inputFile, recordSize);
+        if (inputReaders.back().next()) {
+            heap.push_back(inputReaders.size() - 1);
+        }
+    }
+    RecordFileWriter writer(outputFile, recordSize);
+    merge(inputReaders, heap, writer, keySize);
+    writer.close();
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Writes records that consist of a fixed number of 64-bit words to a file.
+ */
+class RecordFileWriter {
+   public:
+    RecordFileWriter(std::string const& filename, uint64_t recordSize);
+
+    void write(uint64_t const* record);
+
+    /*!
+     * Flushes and closes the file. Afterwards, no further records may be written.
+     */
+    void close();
+
+    uint64_t getNumberOfRecords() const;
+
+   private:
+    std::ofstream stream;
+    std::string filename;
+    uint64_t recordSize;
+    uint64_t numberOfRecords;
+};
+
+/*!
+ * Reads the records of a file written by a RecordFileWriter sequentially.
+ */
+class RecordFileReader {
+   public:
+    RecordFileReader(std::string const& filename, uint64_t recordSize);
+
+    /*!
+     * Moves to the next record.
+     *
+     * @return False iff there is no further record.
+     */
+    bool next();
+
+    /*!
+     * Retrieves the current record. This is only valid after a successful call to next.
+     */
+    uint64_t const* get() const;
+
+   private:
+    std::ifstream stream;
+    std::vector<uint64_t> record;
+};
+
+/*!
+ * Sorts records that consist of a fixed number of 64-bit words using a bounded amount of memory. The records are collected in a buffer
+ * that is sorted and written to a file (a run) whenever it is full. Retrieving the records then merges the runs. The records are compared
+ * lexicographically by their first words (the key).
+ */
+class ExternalSorter {
+   public:
+    /*!
+     * Creates a sorter.
+     *
+     * @param filePrefix The prefix of the names of the files that store the runs.
+     * @param recordSize The number of words of a record.
+     * @param keySize The number of words (at the beginning of a record) by which the records are sorted.
+     * @param memoryLimit The number of bytes that may be used for the buffer.
+     */
+    ExternalSorter(std::string const& filePrefix, uint64_t recordSize, uint64_t keySize, uint64_t memoryLimit);
+    ~ExternalSorter();
+
+    ExternalSorter(ExternalSorter const&) = delete;
+    ExternalSorter& operator=(ExternalSorter const&) = delete;
+
+    /*!
+     * Adds the given record. This must not be called after sort().
+     */
+    void add(uint64_t const* record);
+
+    /*!
+     * Finishes adding records, i.e., afterwards, the records can be retrieved in sorted order.
+     */
+    void sort();
+
+    /*!
+     * Copies the next record (in sorted order) to the given memory.
+     *
+     * @return False iff all records have been retrieved.
+     */
+    bool next(uint64_t* record);
+
+    /*!
+     * Retrieves the number of records added to this sorter.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of runs that were written to disk.
+     */
+    uint64_t getNumberOfRuns() const;
+
+    /*!
+     * Merges the given files, which each contain records sorted by their first keySize words, into a single sorted file.
+     */
+    static void mergeFiles(std::vector<std::string> const& inputFiles, std::string const& outputFile, uint64_t recordSize, uint64_t keySize);
+
+   private:
+    // Sorts the buffer and writes it to a new run.
+    void writeRun();
+    // Sorts the records in the buffer (by means of the order vector).
+    void sortBuffer();
+    // Moves to the next record of the given reader and updates the heap of the readers accordingly.
+    void advanceReader(uint64_t readerIndex);
+    // Compares the current records of the given readers (the heap of the readers is a min-heap).
+    bool isReaderGreater(uint64_t first, uint64_t second) const;
+
+    std::string filePrefix;
+    uint64_t recordSize;
+    uint64_t keySize;
+    uint64_t recordsPerBuffer;
+    uint64_t numberOfRecords;
+    bool sorted;
+
+    // The records that have not been written to a run.
+    std::vector<uint64_t> buffer;
+    // The order of the records in the buffer after sorting as well as the position of the next record to retrieve from the buffer.
+    std::vector<uint64_t> order;
+    uint64_t nextBufferPosition;
+
+    std::vector<std::string> runs;
+    // The readers of the runs that are merged as well as a heap over the readers that still have records (ordered by their current record).
+    std::vector<RecordFileReader> readers;
+    std::vector<uint64_t> readerHeap;
+};
+
+}  // namespace storage
+}  // namespace storm
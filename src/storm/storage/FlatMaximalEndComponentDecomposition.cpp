@@ -0,0 +1,308 @@
+#include "storm/storage/FlatMaximalEndComponentDecomposition.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+namespace storage {
+
+FlatMaximalEndComponentDecomposition::IndexRange::IndexRange(const_iterator first, const_iterator last) : first(first), last(last) {
+    // Intentionally left empty.
+}
+
+FlatMaximalEndComponentDecomposition::IndexRange::const_iterator FlatMaximalEndComponentDecomposition::IndexRange::begin() const {
+    return first;
+}
+
+FlatMaximalEndComponentDecomposition::IndexRange::const_iterator FlatMaximalEndComponentDecomposition::IndexRange::end() const {
+    return last;
+}
+
+std::size_t FlatMaximalEndComponentDecomposition::IndexRange::size() const {
+    return std::distance(first, last);
+}
+
+bool FlatMaximalEndComponentDecomposition::IndexRange::empty() const {
+    return first == last;
+}
+
+FlatMaximalEndComponentDecomposition::IndexRange::const_iterator FlatMaximalEndComponentDecomposition::IndexRange::find(uint_fast64_t index) const {
+    auto it = std::lower_bound(first, last, index);
+    return (it != last && *it == index) ? it : last;
+}
+
+bool FlatMaximalEndComponentDecomposition::IndexRange::contains(uint_fast64_t index) const {
+    return std::binary_search(first, last, index);
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator::const_iterator(FlatMaximalEndComponentDecomposition const* decomposition,
+                                                                                              uint_fast64_t statePosition)
+    : decomposition(decomposition), statePosition(statePosition) {
+    // Intentionally left empty.
+}
+
+FlatMaximalEndComponentDecomposition::StateChoicesPair FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator::operator*() const {
+    auto const& choices = decomposition->choices;
+    auto const& choiceIndications = decomposition->choiceIndications;
+    return StateChoicesPair(decomposition->states[statePosition], IndexRange(choices.begin() + choiceIndications[statePosition],
+                                                                             choices.begin() + choiceIndications[statePosition + 1]));
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator&
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator::operator++() {
+    ++statePosition;
+    return *this;
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator::operator++(int) {
+    const_iterator result = *this;
+    ++statePosition;
+    return result;
+}
+
+bool FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator::operator==(const_iterator const& other) const {
+    return statePosition == other.statePosition;
+}
+
+bool FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator::operator!=(const_iterator const& other) const {
+    return statePosition != other.statePosition;
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::MaximalEndComponentView(FlatMaximalEndComponentDecomposition const& decomposition,
+                                                                                       uint_fast64_t mecIndex)
+    : decomposition(&decomposition), mecIndex(mecIndex) {
+    // Intentionally left empty.
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator FlatMaximalEndComponentDecomposition::MaximalEndComponentView::begin() const {
+    return const_iterator(decomposition, decomposition->mecIndications[mecIndex]);
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView::const_iterator FlatMaximalEndComponentDecomposition::MaximalEndComponentView::end() const {
+    return const_iterator(decomposition, decomposition->mecIndications[mecIndex + 1]);
+}
+
+std::size_t FlatMaximalEndComponentDecomposition::MaximalEndComponentView::size() const {
+    return decomposition->mecIndications[mecIndex + 1] - decomposition->mecIndications[mecIndex];
+}
+
+FlatMaximalEndComponentDecomposition::IndexRange FlatMaximalEndComponentDecomposition::MaximalEndComponentView::getStates() const {
+    auto const& states = decomposition->states;
+    return IndexRange(states.begin() + decomposition->mecIndications[mecIndex], states.begin() + decomposition->mecIndications[mecIndex + 1]);
+}
+
+FlatMaximalEndComponentDecomposition::IndexRange FlatMaximalEndComponentDecomposition::MaximalEndComponentView::getChoicesForState(uint_fast64_t state) const {
+    IndexRange mecStates = getStates();
+    auto stateIt = mecStates.find(state);
+    STORM_LOG_THROW(stateIt != mecStates.end(), storm::exceptions::InvalidStateException, "Invalid call to function 'getChoicesForState' on MEC.");
+    uint_fast64_t statePosition = std::distance(decomposition->states.begin(), stateIt);
+    auto const& choices = decomposition->choices;
+    return IndexRange(choices.begin() + decomposition->choiceIndications[statePosition],
+                      choices.begin() + decomposition->choiceIndications[statePosition + 1]);
+}
+
+bool FlatMaximalEndComponentDecomposition::MaximalEndComponentView::containsState(uint_fast64_t state) const {
+    return getStates().contains(state);
+}
+
+bool FlatMaximalEndComponentDecomposition::MaximalEndComponentView::containsChoice(uint_fast64_t state, uint_fast64_t choice) const {
+    return getChoicesForState(state).contains(choice);
+}
+
+bool FlatMaximalEndComponentDecomposition::MaximalEndComponentView::containsAnyState(storm::storage::BitVector const& stateSet) const {
+    for (auto state : getStates()) {
+        if (stateSet.get(state)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+storm::storage::BitVector FlatMaximalEndComponentDecomposition::MaximalEndComponentView::getStateSet(uint_fast64_t numberOfStates) const {
+    storm::storage::BitVector result(numberOfStates);
+    for (auto state : getStates()) {
+        result.set(state);
+    }
+    return result;
+}
+
+FlatMaximalEndComponentDecomposition::const_iterator::const_iterator(FlatMaximalEndComponentDecomposition const* decomposition, uint_fast64_t mecIndex)
+    : decomposition(decomposition), mecIndex(mecIndex) {
+    // Intentionally left empty.
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView FlatMaximalEndComponentDecomposition::const_iterator::operator*() const {
+    return MaximalEndComponentView(*decomposition, mecIndex);
+}
+
+FlatMaximalEndComponentDecomposition::const_iterator& FlatMaximalEndComponentDecomposition::const_iterator::operator++() {
+    ++mecIndex;
+    return *this;
+}
+
+FlatMaximalEndComponentDecomposition::const_iterator FlatMaximalEndComponentDecomposition::const_iterator::operator++(int) {
+    const_iterator result = *this;
+    ++mecIndex;
+    return result;
+}
+
+bool FlatMaximalEndComponentDecomposition::const_iterator::operator==(const_iterator const& other) const {
+    return mecIndex == other.mecIndex;
+}
+
+bool FlatMaximalEndComponentDecomposition::const_iterator::operator!=(const_iterator const& other) const {
+    return mecIndex != other.mecIndex;
+}
+
+FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition() : mecIndications({0}), choiceIndications({0}) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+}
+
+template<typename ValueType>
+FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                           storm::storage::BitVector const& states) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states);
+}
+
+template<typename ValueType>
+FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                           storm::storage::BitVector const& states, storm::storage::BitVector const& choices) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
+}
+
+template<typename ValueType>
+FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(MaximalEndComponentDecomposition<ValueType> const& decomposition) {
+    mecIndications.reserve(decomposition.size() + 1);
+    choiceIndications.push_back(0);
+    for (auto const& mec : decomposition) {
+        mecIndications.push_back(states.size());
+        // The states of MECs are not stored in any particular order, so we sort them to allow for binary searches.
+        uint_fast64_t firstState = states.size();
+        for (auto const& stateChoicesPair : mec) {
+            states.push_back(stateChoicesPair.first);
+        }
+        std::sort(states.begin() + firstState, states.end());
+        for (auto stateIt = states.begin() + firstState; stateIt != states.end(); ++stateIt) {
+            auto const& mecChoices = mec.getChoicesForState(*stateIt);
+            choices.insert(choices.end(), mecChoices.begin(), mecChoices.end());
+            choiceIndications.push_back(choices.size());
+        }
+    }
+    mecIndications.push_back(states.size());
+}
+
+template<typename ValueType>
+void FlatMaximalEndComponentDecomposition::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                   storm::storage::BitVector const* subsystemStates,
+                                                                                   storm::storage::BitVector const* subsystemChoices) {
+    storm::storage::BitVector includedChoices;
+    std::vector<StateBlock> mecStateSets = MaximalEndComponentDecomposition<ValueType>::computeMaximalEndComponentStateSets(
+        transitionMatrix, backwardTransitions, subsystemStates, subsystemChoices, includedChoices);
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+
+    // The state blocks are sorted, so we can append their states and the included choices of the states right away.
+    mecIndications.reserve(mecStateSets.size() + 1);
+    choiceIndications.push_back(0);
+    for (auto const& mecStateSet : mecStateSets) {
+        mecIndications.push_back(states.size());
+        for (auto state : mecStateSet) {
+            states.push_back(state);
+            for (auto choice = includedChoices.getNextSetIndex(nondeterministicChoiceIndices[state]); choice < nondeterministicChoiceIndices[state + 1];
+                 choice = includedChoices.getNextSetIndex(choice + 1)) {
+                choices.push_back(choice);
+            }
+            STORM_LOG_ASSERT(choices.size() > choiceIndications.back(), "The contained choices of any state in an MEC must be non-empty.");
+            choiceIndications.push_back(choices.size());
+        }
+    }
+    mecIndications.push_back(states.size());
+
+    STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
+}
+
+FlatMaximalEndComponentDecomposition::const_iterator FlatMaximalEndComponentDecomposition::begin() const {
+    return const_iterator(this, 0);
+}
+
+FlatMaximalEndComponentDecomposition::const_iterator FlatMaximalEndComponentDecomposition::end() const {
+    return const_iterator(this, size());
+}
+
+std::size_t FlatMaximalEndComponentDecomposition::size() const {
+    return mecIndications.size() - 1;
+}
+
+bool FlatMaximalEndComponentDecomposition::empty() const {
+    return size() == 0;
+}
+
+FlatMaximalEndComponentDecomposition::MaximalEndComponentView FlatMaximalEndComponentDecomposition::operator[](uint_fast64_t mecIndex) const {
+    STORM_LOG_ASSERT(mecIndex < size(), "Invalid MEC index " << mecIndex << ".");
+    return MaximalEndComponentView(*this, mecIndex);
+}
+
+uint_fast64_t FlatMaximalEndComponentDecomposition::getNumberOfStates() const {
+    return states.size();
+}
+
+uint_fast64_t FlatMaximalEndComponentDecomposition::getNumberOfChoices() const {
+    return choices.size();
+}
+
+// Explicitly instantiate the constructors for the supported value types.
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                    storm::storage::SparseMatrix<double> const& backwardTransitions);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                    storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                    storm::storage::BitVector const& states);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                    storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                    storm::storage::BitVector const& states,
+                                                                                    storm::storage::BitVector const& choices);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(MaximalEndComponentDecomposition<double> const& decomposition);
+
+#ifdef STORM_HAVE_CARL
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states,
+    storm::storage::BitVector const& choices);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    MaximalEndComponentDecomposition<storm::RationalNumber> const& decomposition);
+
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states,
+    storm::storage::BitVector const& choices);
+template FlatMaximalEndComponentDecomposition::FlatMaximalEndComponentDecomposition(
+    MaximalEndComponentDecomposition<storm::RationalFunction> const& decomposition);
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class MaximalEndComponentDecomposition;
+
+/*!
+ * A decomposition of a nondeterministic model into its maximal end components that is stored in four flat arrays instead of one hash map
+ * per MEC: the states of all MECs are stored consecutively (each MEC sorted by state) and indexed by the MEC offsets, and the choices of all
+ * MEC states are stored consecutively (each state sorted by choice) and indexed by the choice offsets of the states. Iterating over the
+ * MECs thus does not chase pointers and the decomposition needs little memory even for models with many MEC states.
+ *
+ * Iterating over an MEC yields pairs of a state and its choices in the MEC, so code that iterates over a MaximalEndComponent can be used
+ * with this decomposition as well.
+ */
+class FlatMaximalEndComponentDecomposition {
+   public:
+    /*!
+     * A range of consecutive entries of one of the arrays. The entries are sorted in ascending order.
+     */
+    class IndexRange {
+       public:
+        typedef std::vector<uint_fast64_t>::const_iterator const_iterator;
+        typedef const_iterator iterator;
+
+        IndexRange(const_iterator first, const_iterator last);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        std::size_t size() const;
+        bool empty() const;
+
+        /*!
+         * Searches the given index in the range.
+         *
+         * @return An iterator to the index or end() if the range does not contain the index.
+         */
+        const_iterator find(uint_fast64_t index) const;
+
+        bool contains(uint_fast64_t index) const;
+
+       private:
+        const_iterator first;
+        const_iterator last;
+    };
+
+    /// A state of an MEC together with its choices in the MEC.
+    typedef std::pair<uint_fast64_t, IndexRange> StateChoicesPair;
+
+    /*!
+     * A view on one MEC of the decomposition. Views are only valid as long as the decomposition they refer to exists and is not modified.
+     */
+    class MaximalEndComponentView {
+       public:
+        /*!
+         * Iterates over the states of the MEC and yields the choices of each state together with the state.
+         */
+        class const_iterator {
+           public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef StateChoicesPair value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef StateChoicesPair const* pointer;
+            typedef StateChoicesPair reference;
+
+            const_iterator(FlatMaximalEndComponentDecomposition const* decomposition, uint_fast64_t statePosition);
+
+            StateChoicesPair operator*() const;
+            const_iterator& operator++();
+            const_iterator operator++(int);
+            bool operator==(const_iterator const& other) const;
+            bool operator!=(const_iterator const& other) const;
+
+           private:
+            FlatMaximalEndComponentDecomposition const* decomposition;
+            uint_fast64_t statePosition;
+        };
+
+        MaximalEndComponentView(FlatMaximalEndComponentDecomposition const& decomposition, uint_fast64_t mecIndex);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        /*!
+         * @return The number of states in this MEC.
+         */
+        std::size_t size() const;
+
+        /*!
+         * @return The states of this MEC in ascending order.
+         */
+        IndexRange getStates() const;
+
+        /*!
+         * Retrieves the choices of the given state that are contained in this MEC. The state has to be contained in the MEC.
+         *
+         * @param state The state for which to retrieve the choices.
+         * @return The choices of the state in ascending order.
+         */
+        IndexRange getChoicesForState(uint_fast64_t state) const;
+
+        bool containsState(uint_fast64_t state) const;
+
+        /*!
+         * Retrieves whether the given choice of the given state is contained in this MEC. The state has to be contained in the MEC.
+         */
+        bool containsChoice(uint_fast64_t state, uint_fast64_t choice) const;
+
+        /*!
+         * Retrieves whether at least one of the given states is contained in this MEC.
+         */
+        bool containsAnyState(storm::storage::BitVector const& stateSet) const;
+
+        /*!
+         * @return The states of this MEC as a bit vector of the given size.
+         */
+        storm::storage::BitVector getStateSet(uint_fast64_t numberOfStates) const;
+
+       private:
+        FlatMaximalEndComponentDecomposition const* decomposition;
+        uint_fast64_t mecIndex;
+    };
+
+    /*!
+     * Iterates over the MECs of the decomposition.
+     */
+    class const_iterator {
+       public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef MaximalEndComponentView value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef MaximalEndComponentView const* pointer;
+        typedef MaximalEndComponentView reference;
+
+        const_iterator(FlatMaximalEndComponentDecomposition const* decomposition, uint_fast64_t mecIndex);
+
+        MaximalEndComponentView operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+
+       private:
+        FlatMaximalEndComponentDecomposition const* decomposition;
+        uint_fast64_t mecIndex;
+    };
+
+    /*!
+     * Creates an empty decomposition.
+     */
+    FlatMaximalEndComponentDecomposition();
+
+    /*!
+     * Creates an MEC decomposition of the given model (represented by a row-grouped matrix).
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The reversed transition relation.
+     */
+    template<typename ValueType>
+    FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+
+    /*!
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     */
+    template<typename ValueType>
+    FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+
+    /*!
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     * @param choices The choices of the subsystem to decompose.
+     */
+    template<typename ValueType>
+    FlatMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
+                                         storm::storage::BitVector const& choices);
+
+    /*!
+     * Creates a flat copy of the given MEC decomposition.
+     *
+     * @param decomposition The MEC decomposition to copy.
+     */
+    template<typename ValueType>
+    explicit FlatMaximalEndComponentDecomposition(MaximalEndComponentDecomposition<ValueType> const& decomposition);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /*!
+     * @return The number of MECs.
+     */
+    std::size_t size() const;
+
+    bool empty() const;
+
+    /*!
+     * Retrieves a view on the MEC with the given index.
+     */
+    MaximalEndComponentView operator[](uint_fast64_t mecIndex) const;
+
+    /*!
+     * @return The number of states that are contained in some MEC.
+     */
+    uint_fast64_t getNumberOfStates() const;
+
+    /*!
+     * @return The number of choices that are contained in some MEC.
+     */
+    uint_fast64_t getNumberOfChoices() const;
+
+   private:
+    template<typename ValueType>
+    void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                 storm::storage::BitVector const* subsystemStates = nullptr,
+                                                 storm::storage::BitVector const* subsystemChoices = nullptr);
+
+    /// For each MEC the position of its first state in the states array. The last entry is the total number of MEC states.
+    std::vector<uint_fast64_t> mecIndications;
+
+    /// The states of all MECs.
+    std::vector<uint_fast64_t> states;
+
+    /// For each position in the states array the position of the first choice of the state in the choices array. The last entry is the total
+    /// number of MEC choices.
+    std::vector<uint_fast64_t> choiceIndications;
+
+    /// The choices of all MEC states.
+    std::vector<uint_fast64_t> choices;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,169 @@
+#include "storm/storage/MappedSparseMatrix.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#if defined LINUX || defined MACOSX
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace storage {
+
+using namespace storm::exporter::binary;
+
+MappedSparseMatrix::MappedSparseMatrix(std::string const& filename)
+    : data(nullptr), dataSize(0), file(-1), rowCount(0), columnCount(0), entryCount(0), rowIndications(nullptr), rowGroupIndices(nullptr), entries(nullptr) {
+#if defined LINUX || defined MACOSX
+    file = open(filename.c_str(), O_RDONLY);
+    STORM_LOG_THROW(file >= 0, storm::exceptions::FileIoException, "Could not open file " << filename << ": " << std::strerror(errno) << ".");
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0) {
+        close(file);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Error in stat(" << filename << "): " << std::strerror(errno) << ".");
+    }
+    dataSize = fileStatus.st_size;
+    void* mapping = dataSize > 0 ? mmap(nullptr, dataSize, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    if (mapping == MAP_FAILED) {
+        close(file);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Error in mmap(" << filename << "): " << std::strerror(errno) << ".");
+    }
+    data = static_cast<char*>(mapping);
+    // The matrix is typically processed sequentially.
+    madvise(data, dataSize, MADV_SEQUENTIAL);
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Mapping matrices to memory is not supported on this platform.");
+#endif
+
+    // Locate the arrays of the matrix. All other sections are skipped.
+    char const* position = data;
+    char const* const dataEnd = data + dataSize;
+    auto readBlock = [&](uint64_t size) {
+        uint64_t const paddedSize = size + getPadding(size);
+        STORM_LOG_THROW(paddedSize >= size && paddedSize <= static_cast<uint64_t>(dataEnd - position), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file '" << filename << "'.");
+        char const* result = position;
+        position += paddedSize;
+        return result;
+    };
+    FileHeader header;
+    std::memcpy(&header, readBlock(sizeof(FileHeader)), sizeof(FileHeader));
+    STORM_LOG_THROW(header.magic == Magic && header.byteOrderMark == ByteOrderMark && header.version == Version && header.valueSize == sizeof(double),
+                    storm::exceptions::WrongFormatException, "File '" << filename << "' is not a compatible binary model file.");
+    rowCount = header.numberOfChoices;
+    columnCount = header.numberOfStates;
+    entryCount = header.numberOfEntries;
+
+    for (;;) {
+        SectionHeader sectionHeader;
+        std::memcpy(&sectionHeader, readBlock(sizeof(SectionHeader)), sizeof(SectionHeader));
+        if (sectionHeader.type == SectionType::End) {
+            break;
+        }
+        readBlock(sectionHeader.nameSize);
+        char const* sectionData = readBlock(sectionHeader.dataSize);
+        if (sectionHeader.type == SectionType::RowIndications) {
+            STORM_LOG_THROW(sectionHeader.dataSize == (rowCount + 1) * sizeof(uint64_t), storm::exceptions::WrongFormatException,
+                            "Unexpected size of the row indications in binary model file '" << filename << "'.");
+            rowIndications = reinterpret_cast<uint64_t const*>(sectionData);
+        } else if (sectionHeader.type == SectionType::RowGroupIndices) {
+            STORM_LOG_THROW(sectionHeader.dataSize == (columnCount + 1) * sizeof(uint64_t), storm::exceptions::WrongFormatException,
+                            "Unexpected size of the row groups in binary model file '" << filename << "'.");
+            rowGroupIndices = reinterpret_cast<uint64_t const*>(sectionData);
+        } else if (sectionHeader.type == SectionType::Entries) {
+            STORM_LOG_THROW(sectionHeader.dataSize == entryCount * sizeof(MatrixEntry), storm::exceptions::WrongFormatException,
+                            "Unexpected size of the matrix entries in binary model file '" << filename << "'.");
+            entries = reinterpret_cast<MatrixEntry const*>(sectionData);
+        }
+    }
+    STORM_LOG_THROW(rowIndications != nullptr && (entries != nullptr || entryCount == 0), storm::exceptions::WrongFormatException,
+                    "Binary model file '" << filename << "' does not contain a transition matrix.");
+    STORM_LOG_THROW(rowGroupIndices != nullptr || rowCount == columnCount, storm::exceptions::WrongFormatException,
+                    "Binary model file '" << filename << "' does not contain the row groups of the nondeterministic model.");
+}
+
+MappedSparseMatrix::~MappedSparseMatrix() {
+#if defined LINUX || defined MACOSX
+    if (data != nullptr) {
+        munmap(data, dataSize);
+    }
+    if (file >= 0) {
+        close(file);
+    }
+#endif
+}
+
+uint64_t MappedSparseMatrix::getRowCount() const {
+    return rowCount;
+}
+
+uint64_t MappedSparseMatrix::getColumnCount() const {
+    return columnCount;
+}
+
+uint64_t MappedSparseMatrix::getEntryCount() const {
+    return entryCount;
+}
+
+uint64_t MappedSparseMatrix::getRowGroupCount() const {
+    return columnCount;
+}
+
+bool MappedSparseMatrix::hasTrivialRowGrouping() const {
+    return rowGroupIndices == nullptr;
+}
+
+uint64_t MappedSparseMatrix::getRowGroupIndex(uint64_t rowGroup) const {
+    return rowGroupIndices == nullptr ? rowGroup : rowGroupIndices[rowGroup];
+}
+
+MappedSparseMatrix::MatrixEntry const* MappedSparseMatrix::begin(uint64_t row) const {
+    return entries + rowIndications[row];
+}
+
+MappedSparseMatrix::MatrixEntry const* MappedSparseMatrix::end(uint64_t row) const {
+    return entries + rowIndications[row + 1];
+}
+
+void MappedSparseMatrix::advise(void const* begin, void const* end, int advice) const {
+#if defined LINUX || defined MACOSX
+    static uint64_t const pageSize = sysconf(_SC_PAGESIZE);
+    uintptr_t const first = reinterpret_cast<uintptr_t>(begin) / pageSize * pageSize;
+    uintptr_t const last = reinterpret_cast<uintptr_t>(end);
+    if (last > first) {
+        // The advice is only a hint, so failures are ignored.
+        madvise(reinterpret_cast<void*>(first), last - first, advice);
+    }
+#endif
+}
+
+void MappedSparseMatrix::prefetchRowGroups(uint64_t firstRowGroup, uint64_t lastRowGroup) const {
+#if defined LINUX || defined MACOSX
+    uint64_t const firstRow = getRowGroupIndex(firstRowGroup);
+    uint64_t const lastRow = getRowGroupIndex(lastRowGroup);
+    advise(begin(firstRow), begin(lastRow), MADV_WILLNEED);
+    advise(rowIndications + firstRow, rowIndications + lastRow + 1, MADV_WILLNEED);
+    if (rowGroupIndices != nullptr) {
+        advise(rowGroupIndices + firstRowGroup, rowGroupIndices + lastRowGroup + 1, MADV_WILLNEED);
+    }
+#endif
+}
+
+void MappedSparseMatrix::releaseRowGroups(uint64_t firstRowGroup, uint64_t lastRowGroup) const {
+#if defined LINUX || defined MACOSX
+    // Only the entries are released, as the (much smaller) indications may share pages with neighboring rows.
+    advise(begin(getRowGroupIndex(firstRowGroup)), begin(getRowGroupIndex(lastRowGroup)), MADV_DONTNEED);
+#endif
+}
+
+}  // namespace storage
+}  // namespace storm
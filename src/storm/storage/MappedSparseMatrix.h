@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only view on the transition matrix of a model file in the binary format (see storm/io/BinaryModelFormat.h). The file is mapped to
+ * memory and the matrix is accessed directly in the mapping, i.e., it is never copied to main memory. The operating system loads the
+ * pages on demand, which can be controlled by prefetching and releasing ranges of rows. This allows to work with matrices that exceed the
+ * available main memory, as long as they are processed in (mostly) sequential blocks of rows.
+ */
+class MappedSparseMatrix {
+   public:
+    typedef storm::storage::sparse::state_type index_type;
+    typedef storm::storage::MatrixEntry<index_type, double> MatrixEntry;
+
+    /*!
+     * Maps the matrix of the given model file to memory.
+     *
+     * @param filename The model file in the binary format.
+     */
+    explicit MappedSparseMatrix(std::string const& filename);
+    ~MappedSparseMatrix();
+
+    MappedSparseMatrix(MappedSparseMatrix const&) = delete;
+    MappedSparseMatrix& operator=(MappedSparseMatrix const&) = delete;
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getRowGroupCount() const;
+
+    /*!
+     * Retrieves whether every row group consists of exactly one row, i.e., whether the matrix belongs to a deterministic model.
+     */
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Retrieves the first row of the given row group. For the row group after the last row group, this is the number of rows.
+     */
+    uint64_t getRowGroupIndex(uint64_t rowGroup) const;
+
+    /*!
+     * Retrieves the entries of the given row.
+     */
+    MatrixEntry const* begin(uint64_t row) const;
+    MatrixEntry const* end(uint64_t row) const;
+
+    /*!
+     * Advises the operating system to load the given rows (of the row groups in the range [firstRowGroup, lastRowGroup)) into memory, as
+     * they will be accessed soon. This returns immediately.
+     */
+    void prefetchRowGroups(uint64_t firstRowGroup, uint64_t lastRowGroup) const;
+
+    /*!
+     * Advises the operating system that the given rows (of the row groups in the range [firstRowGroup, lastRowGroup)) will not be
+     * accessed in the near future, so their memory can be reclaimed.
+     */
+    void releaseRowGroups(uint64_t firstRowGroup, uint64_t lastRowGroup) const;
+
+   private:
+    // Gives the given advice for the memory range [begin, end) (extended to full pages).
+    void advise(void const* begin, void const* end, int advice) const;
+
+    char* data;
+    uint64_t dataSize;
+    int file;
+
+    uint64_t rowCount;
+    uint64_t columnCount;
+    uint64_t entryCount;
+
+    // Pointers to the arrays of the matrix in the mapped file. If the row grouping is trivial, there are no row group indices.
+    uint64_t const* rowIndications;
+    uint64_t const* rowGroupIndices;
+    MatrixEntry const* entries;
+};
+
+}  // namespace storage
+}  // namespace storm
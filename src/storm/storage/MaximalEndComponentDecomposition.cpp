@@ -73,26 +73,25 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
 }
 
 template<typename ValueType>
-void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> backwardTransitions,
-                                                                                          storm::storage::BitVector const* states,
-                                                                                          storm::storage::BitVector const* choices) {
+std::vector<StateBlock> MaximalEndComponentDecomposition<ValueType>::computeMaximalEndComponentStateSets(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const* states, storm::storage::BitVector const* choices, storm::storage::BitVector& includedChoices) {
     // Get some data for convenient access.
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
-    // Initialize the maximal end component list to be the full state space.
-    std::list<StateBlock> endComponentStateSets;
+    // Initialize the maximal end component list to be the full state space. Each candidate is flagged whether it is already known to be an MEC.
+    std::list<std::pair<StateBlock, bool>> endComponentStateSets;
     if (states) {
-        endComponentStateSets.emplace_back(states->begin(), states->end(), true);
+        endComponentStateSets.emplace_back(StateBlock(states->begin(), states->end(), true), false);
     } else {
         std::vector<storm::storage::sparse::state_type> allStates;
         allStates.resize(transitionMatrix.getRowGroupCount());
         std::iota(allStates.begin(), allStates.end(), 0);
-        endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
+        endComponentStateSets.emplace_back(StateBlock(allStates.begin(), allStates.end(), true), false);
     }
     storm::storage::BitVector statesToCheck(numberOfStates);
-    storm::storage::BitVector includedChoices;
+    storm::storage::BitVector statesToRemove(numberOfStates);
     if (choices) {
         includedChoices = *choices;
         if (states) {
@@ -107,8 +106,13 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     }
     storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
 
-    for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-        StateBlock const& mec = *mecIterator;
+    for (auto mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
+        if (mecIterator->second) {
+            // The candidate was not affected by the refinement of its enclosing candidate, so there is nothing to recompute.
+            ++mecIterator;
+            continue;
+        }
+        StateBlock const& mec = mecIterator->first;
         currMecAsBitVector.clear();
         currMecAsBitVector.set(mec.begin(), mec.end(), true);
         // Keep track of whether the MEC changed during this iteration.
@@ -124,11 +128,14 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
 
         // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-        for (auto& scc : sccs) {
+        // An SCC for which no choice and no state is removed is an MEC, so it does not need to be decomposed again.
+        std::vector<bool> sccChanged(sccs.size(), false);
+        for (uint_fast64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+            auto& scc = sccs[sccIndex];
             statesToCheck.set(scc.begin(), scc.end());
 
             while (!statesToCheck.empty()) {
-                storm::storage::BitVector statesToRemove(numberOfStates);
+                statesToRemove.clear();
 
                 for (auto state : statesToCheck) {
                     bool keepStateInMEC = false;
@@ -152,6 +159,7 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
                             if (!scc.containsState(entry.getColumn())) {
                                 includedChoices.set(choice, false);
+                                sccChanged[sccIndex] = true;
                                 choiceContainedInMEC = false;
                                 break;
                             }
@@ -170,6 +178,7 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
                 // Now erase the states that have no option to stay inside the MEC with all successors.
                 mecChanged |= !statesToRemove.empty();
+                sccChanged[sccIndex] = sccChanged[sccIndex] || !statesToRemove.empty();
                 for (uint_fast64_t state : statesToRemove) {
                     scc.erase(state);
                 }
@@ -189,13 +198,13 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
         // the list instead.
         if (mecChanged) {
-            for (StronglyConnectedComponent& scc : sccs) {
-                if (!scc.empty()) {
-                    endComponentStateSets.push_back(std::move(scc));
+            for (uint_fast64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+                if (!sccs[sccIndex].empty()) {
+                    endComponentStateSets.emplace_back(std::move(sccs[sccIndex]), !sccChanged[sccIndex]);
                 }
             }
 
-            std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
+            auto eraseIterator = mecIterator;
             ++mecIterator;
             endComponentStateSets.erase(eraseIterator);
         } else {
@@ -205,20 +214,32 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
     }  // End of loop over all MEC candidates.
 
+    std::vector<StateBlock> result;
+    result.reserve(endComponentStateSets.size());
+    for (auto& mecStateSetFlagPair : endComponentStateSets) {
+        result.emplace_back(std::move(mecStateSetFlagPair.first));
+    }
+    return result;
+}
+
+template<typename ValueType>
+void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                          storm::storage::BitVector const* states,
+                                                                                          storm::storage::BitVector const* choices) {
+    storm::storage::BitVector includedChoices;
+    std::vector<StateBlock> mecStateSets = computeMaximalEndComponentStateSets(transitionMatrix, backwardTransitions, states, choices, includedChoices);
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+
     // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
     // contained in the MEC and store them as actual MECs.
-    this->blocks.reserve(endComponentStateSets.size());
-    for (auto const& mecStateSet : endComponentStateSets) {
+    this->blocks.reserve(mecStateSets.size());
+    for (auto const& mecStateSet : mecStateSets) {
         MaximalEndComponent newMec;
 
         for (auto state : mecStateSet) {
             MaximalEndComponent::set_type containedChoices;
             for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                // Skip the choice if it is not part of our subsystem.
-                if (choices && !choices->get(choice)) {
-                    continue;
-                }
-
                 if (includedChoices.get(choice)) {
                     containedChoices.insert(choice);
                 }
@@ -234,6 +255,51 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
 }
 
+template<typename ValueType>
+void MaximalEndComponentDecomposition<ValueType>::removeChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                storm::storage::BitVector const& removedChoices) {
+    // Keep the MECs that do not contain a removed choice and collect the remaining states and choices of all other MECs.
+    storm::storage::BitVector affectedStates(transitionMatrix.getRowGroupCount(), false);
+    storm::storage::BitVector remainingChoices(transitionMatrix.getRowCount(), false);
+    std::vector<MaximalEndComponent> unaffectedMecs;
+    for (auto& mec : this->blocks) {
+        bool affected = false;
+        for (auto const& stateChoicesPair : mec) {
+            for (auto choice : stateChoicesPair.second) {
+                if (removedChoices.get(choice)) {
+                    affected = true;
+                    break;
+                }
+            }
+            if (affected) {
+                break;
+            }
+        }
+
+        if (affected) {
+            for (auto const& stateChoicesPair : mec) {
+                affectedStates.set(stateChoicesPair.first);
+                for (auto choice : stateChoicesPair.second) {
+                    remainingChoices.set(choice, !removedChoices.get(choice));
+                }
+            }
+        } else {
+            unaffectedMecs.push_back(std::move(mec));
+        }
+    }
+    this->blocks = std::move(unaffectedMecs);
+
+    // Every MEC of the reduced model is contained in an MEC of the original model, so only the affected MECs need to be decomposed again.
+    if (!affectedStates.empty()) {
+        MaximalEndComponentDecomposition<ValueType> affectedMecs(transitionMatrix, backwardTransitions, affectedStates, remainingChoices);
+        for (auto& mec : affectedMecs.blocks) {
+            this->blocks.push_back(std::move(mec));
+        }
+    }
+    STORM_LOG_DEBUG("MEC decomposition was updated to " << this->size() << " MEC(s).");
+}
+
 // Explicitly instantiate the MEC decomposition.
 template class MaximalEndComponentDecomposition<double>;
 template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model);
@@ -4,6 +4,7 @@
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/storage/Decomposition.h"
 #include "storm/storage/MaximalEndComponent.h"
+#include "storm/storage/StateBlock.h"
 
 namespace storm {
 namespace storage {
@@ -94,6 +95,34 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      */
     MaximalEndComponentDecomposition& operator=(MaximalEndComponentDecomposition&& other);
 
+    /*!
+     * Updates the decomposition such that it reflects the MECs of the model in which the given choices are removed. Only the MECs that contain one of
+     * the removed choices are decomposed again, all other MECs are kept.
+     *
+     * @param transitionMatrix The transition relation of the model this decomposition was computed for.
+     * @param backwardTransitions The reversed transition relation.
+     * @param removedChoices The choices to remove.
+     */
+    void removeChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                       storm::storage::BitVector const& removedChoices);
+
+    /*!
+     * Computes the state sets of the MECs of the given subsystem without building the MECs themselves. This allows other representations
+     * of the decomposition to be populated directly.
+     *
+     * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
+     * @param backwardTransitions The reversed transition relation.
+     * @param states The states of the subsystem to decompose. If null, all states are considered.
+     * @param choices The choices of the subsystem to decompose. If null, all choices are considered.
+     * @param includedChoices Is set to the choices that remain in the subsystem. For every state of an MEC, these are exactly the choices
+     * of the state that belong to the MEC.
+     * @return The state sets of the MECs.
+     */
+    static std::vector<StateBlock> computeMaximalEndComponentStateSets(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                       storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                       storm::storage::BitVector const* states, storm::storage::BitVector const* choices,
+                                                                       storm::storage::BitVector& includedChoices);
+
    private:
     /*!
      * Performs the actual decomposition of the given subsystem in the given model into MECs. As a side-effect
@@ -105,7 +134,8 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param choices The choices of the subsystem to decompose.
      */
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                 storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr,
+                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                 storm::storage::BitVector const* states = nullptr,
                                                  storm::storage::BitVector const* choices = nullptr);
 };
 }  // namespace storage
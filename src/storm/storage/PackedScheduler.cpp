@@ -0,0 +1,275 @@
+#include "storm/storage/PackedScheduler.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/math.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+/// Identifies the binary scheduler format ("STORMSCH" in little endian).
+uint64_t constexpr BinaryMagic = 0x4843534d524f5453ull;
+uint32_t constexpr BinaryVersion = 1;
+/// Detects files that were written on a machine with a different byte order.
+uint32_t constexpr BinaryByteOrderMark = 0x01020304;
+
+struct BinaryHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint64_t numberOfStates;
+    uint64_t bitsPerChoice;
+};
+
+uint64_t getBitsPerChoice(uint64_t maximalNumberOfChoices) {
+    return maximalNumberOfChoices <= 1 ? 0 : storm::utility::math::uint64_log2(maximalNumberOfChoices - 1) + 1;
+}
+
+uint64_t getMaximalRowGroupSize(std::vector<uint64_t> const& rowGroupIndices) {
+    uint64_t result = 0;
+    for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+        result = std::max(result, rowGroupIndices[group + 1] - rowGroupIndices[group]);
+    }
+    return result;
+}
+
+void writeBitVector(std::ostream& out, storm::storage::BitVector const& bitVector) {
+    for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+        uint64_t bucket = bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex));
+        out.write(reinterpret_cast<char const*>(&bucket), sizeof(bucket));
+    }
+}
+
+void readBitVector(std::istream& in, storm::storage::BitVector& bitVector) {
+    for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+        uint64_t bucket;
+        in.read(reinterpret_cast<char*>(&bucket), sizeof(bucket));
+        STORM_LOG_THROW(in.good(), storm::exceptions::WrongFormatException, "Unexpected end of the binary scheduler.");
+        bitVector.setFromInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex), bucket);
+    }
+}
+}  // namespace
+
+PackedScheduler::PackedScheduler(uint64_t numberOfStates, uint64_t maximalNumberOfChoices)
+    : numberOfStates(numberOfStates),
+      bitsPerChoice(getBitsPerChoice(maximalNumberOfChoices)),
+      choices(numberOfStates * bitsPerChoice),
+      definedStates(numberOfStates),
+      dontCareStates(numberOfStates) {
+    // Intentionally left empty.
+}
+
+PackedScheduler::PackedScheduler(std::vector<uint64_t> const& rowGroupIndices)
+    : PackedScheduler(rowGroupIndices.empty() ? 0 : rowGroupIndices.size() - 1, getMaximalRowGroupSize(rowGroupIndices)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+PackedScheduler::PackedScheduler(Scheduler<ValueType> const& scheduler) : PackedScheduler(0, 0) {
+    STORM_LOG_THROW(scheduler.isMemorylessScheduler() && scheduler.isDeterministicScheduler(), storm::exceptions::InvalidArgumentException,
+                    "Only deterministic memoryless schedulers can be packed.");
+    uint64_t const modelStates = scheduler.getNumberOfModelStates();
+    uint64_t maximalChoice = 0;
+    for (uint64_t state = 0; state < modelStates; ++state) {
+        auto const& choice = scheduler.getChoice(state);
+        if (choice.isDefined()) {
+            maximalChoice = std::max<uint64_t>(maximalChoice, choice.getDeterministicChoice());
+        }
+    }
+    *this = PackedScheduler(modelStates, maximalChoice + 1);
+    for (uint64_t state = 0; state < modelStates; ++state) {
+        auto const& choice = scheduler.getChoice(state);
+        if (choice.isDefined()) {
+            setChoice(choice.getDeterministicChoice(), state);
+        }
+        if (scheduler.isDontCare(state)) {
+            setDontCare(state, false);
+        }
+    }
+}
+
+void PackedScheduler::setChoice(uint64_t choice, uint64_t modelState) {
+    STORM_LOG_ASSERT(modelState < numberOfStates, "Illegal model state index");
+    STORM_LOG_THROW(bitsPerChoice == 64 || (choice >> bitsPerChoice) == 0, storm::exceptions::InvalidArgumentException,
+                    "Choice " << choice << " can not be stored with " << bitsPerChoice << " bits.");
+    if (bitsPerChoice > 0) {
+        choices.setFromInt(modelState * bitsPerChoice, bitsPerChoice, choice);
+    }
+    definedStates.set(modelState);
+}
+
+void PackedScheduler::clearChoice(uint64_t modelState) {
+    STORM_LOG_ASSERT(modelState < numberOfStates, "Illegal model state index");
+    definedStates.set(modelState, false);
+}
+
+bool PackedScheduler::isChoiceDefined(uint64_t modelState) const {
+    STORM_LOG_ASSERT(modelState < numberOfStates, "Illegal model state index");
+    return definedStates.get(modelState);
+}
+
+uint64_t PackedScheduler::getChoice(uint64_t modelState) const {
+    STORM_LOG_ASSERT(isChoiceDefined(modelState), "The choice of state " << modelState << " is undefined.");
+    return bitsPerChoice == 0 ? 0 : choices.getAsInt(modelState * bitsPerChoice, bitsPerChoice);
+}
+
+void PackedScheduler::setDontCare(uint64_t modelState, bool setArbitraryChoice) {
+    STORM_LOG_ASSERT(modelState < numberOfStates, "Illegal model state index");
+    if (!isChoiceDefined(modelState) && setArbitraryChoice) {
+        setChoice(0, modelState);
+    }
+    dontCareStates.set(modelState);
+}
+
+void PackedScheduler::unSetDontCare(uint64_t modelState) {
+    STORM_LOG_ASSERT(modelState < numberOfStates, "Illegal model state index");
+    dontCareStates.set(modelState, false);
+}
+
+bool PackedScheduler::isDontCare(uint64_t modelState) const {
+    return dontCareStates.get(modelState);
+}
+
+bool PackedScheduler::isPartialScheduler() const {
+    return !definedStates.full();
+}
+
+uint64_t PackedScheduler::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+uint64_t PackedScheduler::getNumberOfBitsPerChoice() const {
+    return bitsPerChoice;
+}
+
+template<typename ValueType>
+Scheduler<ValueType> PackedScheduler::toScheduler() const {
+    Scheduler<ValueType> result(numberOfStates);
+    for (auto state : definedStates) {
+        result.setChoice(getChoice(state), state);
+    }
+    for (auto state : dontCareStates) {
+        result.setDontCare(state, 0, false);
+    }
+    return result;
+}
+
+template<typename ValueType>
+void PackedScheduler::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
+                                        bool skipDontCareStates) const {
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfStates, storm::exceptions::InvalidOperationException,
+                    "The given model is not compatible with this scheduler.");
+    STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
+    bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
+    bool const choiceOriginsGiven = model != nullptr && model->hasChoiceOrigins();
+    bool const choiceLabelsGiven = model != nullptr && model->hasChoiceLabeling();
+
+    out << "[";
+    bool firstEntry = true;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        // Check whether the state is skipped
+        if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
+            continue;
+        }
+        if (skipDontCareStates && isDontCare(state)) {
+            continue;
+        }
+
+        // Only the json structure for the current state is assembled in memory.
+        storm::json<storm::RationalNumber> stateChoicesJson;
+        if (stateValuationsGiven) {
+            stateChoicesJson["s"] = model->getStateValuations().template toJson<storm::RationalNumber>(state);
+        } else {
+            stateChoicesJson["s"] = state;
+        }
+        if (isChoiceDefined(state)) {
+            uint64_t globalChoiceIndex = getChoice(state);
+            if (model != nullptr) {
+                globalChoiceIndex += model->getTransitionMatrix().getRowGroupIndices()[state];
+            }
+            storm::json<storm::RationalNumber> choiceJson;
+            if (choiceOriginsGiven &&
+                model->getChoiceOrigins()->getIdentifier(globalChoiceIndex) != model->getChoiceOrigins()->getIdentifierForChoicesWithNoOrigin()) {
+                choiceJson["origin"] = model->getChoiceOrigins()->getChoiceAsJson(globalChoiceIndex);
+            }
+            if (choiceLabelsGiven) {
+                auto choiceLabels = model->getChoiceLabeling().getLabelsOfChoice(globalChoiceIndex);
+                choiceJson["labels"] = std::vector<std::string>(choiceLabels.begin(), choiceLabels.end());
+            }
+            choiceJson["index"] = globalChoiceIndex;
+            choiceJson["prob"] = storm::utility::one<storm::RationalNumber>();
+            stateChoicesJson["c"].push_back(std::move(choiceJson));
+        } else {
+            stateChoicesJson["c"] = "undefined";
+        }
+        out << (firstEntry ? "\n    " : ",\n    ") << stateChoicesJson.dump();
+        firstEntry = false;
+    }
+    out << (firstEntry ? "]" : "\n]");
+}
+
+void PackedScheduler::writeBinaryToStream(std::ostream& out) const {
+    BinaryHeader header{BinaryMagic, BinaryVersion, BinaryByteOrderMark, numberOfStates, bitsPerChoice};
+    out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    writeBitVector(out, definedStates);
+    writeBitVector(out, dontCareStates);
+    writeBitVector(out, choices);
+}
+
+PackedScheduler PackedScheduler::readBinaryFromStream(std::istream& in) {
+    BinaryHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    STORM_LOG_THROW(in.good() && header.magic == BinaryMagic, storm::exceptions::WrongFormatException, "The input is not a binary scheduler.");
+    STORM_LOG_THROW(header.version == BinaryVersion, storm::exceptions::WrongFormatException,
+                    "Unsupported version " << header.version << " of the binary scheduler format.");
+    STORM_LOG_THROW(header.byteOrderMark == BinaryByteOrderMark, storm::exceptions::WrongFormatException,
+                    "The binary scheduler was written on a machine with a different byte order.");
+    STORM_LOG_THROW(header.bitsPerChoice <= 64, storm::exceptions::WrongFormatException, "Invalid number of bits per choice.");
+    PackedScheduler result(header.numberOfStates, 0);
+    result.bitsPerChoice = header.bitsPerChoice;
+    result.choices = storm::storage::BitVector(header.numberOfStates * header.bitsPerChoice);
+    readBitVector(in, result.definedStates);
+    readBitVector(in, result.dontCareStates);
+    readBitVector(in, result.choices);
+    return result;
+}
+
+bool PackedScheduler::operator==(PackedScheduler const& other) const {
+    if (numberOfStates != other.numberOfStates || definedStates != other.definedStates || dontCareStates != other.dontCareStates) {
+        return false;
+    }
+    for (auto state : definedStates) {
+        if (getChoice(state) != other.getChoice(state)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template PackedScheduler::PackedScheduler(Scheduler<double> const& scheduler);
+template PackedScheduler::PackedScheduler(Scheduler<storm::RationalNumber> const& scheduler);
+template PackedScheduler::PackedScheduler(Scheduler<storm::RationalFunction> const& scheduler);
+template Scheduler<double> PackedScheduler::toScheduler<double>() const;
+template Scheduler<storm::RationalNumber> PackedScheduler::toScheduler<storm::RationalNumber>() const;
+template Scheduler<storm::RationalFunction> PackedScheduler::toScheduler<storm::RationalFunction>() const;
+template void PackedScheduler::printJsonToStream<double>(std::ostream&, std::shared_ptr<storm::models::sparse::Model<double>>, bool, bool) const;
+template void PackedScheduler::printJsonToStream<storm::RationalNumber>(std::ostream&, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>>,
+                                                                        bool, bool) const;
+template void PackedScheduler::printJsonToStream<storm::RationalFunction>(std::ostream&,
+                                                                          std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>>, bool,
+                                                                          bool) const;
+
+}  // namespace storage
+}  // namespace storm
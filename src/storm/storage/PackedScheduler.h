@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class Scheduler;
+
+/*!
+ * A compact representation of a deterministic memoryless scheduler. The (local) choice index of each state is stored in a packed array,
+ * where each entry occupies ceil(log2(n)) bits for the maximal number of choices n of a state. Hence, in contrast to Scheduler, no
+ * distribution is stored per state, which makes this representation suitable for models with a huge number of states.
+ */
+class PackedScheduler {
+   public:
+    /*!
+     * Creates a scheduler for the given number of states in which all choices are undefined.
+     *
+     * @param numberOfStates The number of model states.
+     * @param maximalNumberOfChoices The maximal number of choices in a single state.
+     */
+    PackedScheduler(uint64_t numberOfStates, uint64_t maximalNumberOfChoices);
+
+    /*!
+     * Creates a scheduler for a model with the given row groups in which all choices are undefined.
+     */
+    explicit PackedScheduler(std::vector<uint64_t> const& rowGroupIndices);
+
+    /*!
+     * Creates a packed scheduler with the same choices (and dontCare states) as the given scheduler.
+     * The given scheduler has to be deterministic and memoryless.
+     */
+    template<typename ValueType>
+    explicit PackedScheduler(Scheduler<ValueType> const& scheduler);
+
+    /*!
+     * Sets the (local) choice for the given state.
+     */
+    void setChoice(uint64_t choice, uint64_t modelState);
+
+    /*!
+     * Clears the choice defined for the given state.
+     */
+    void clearChoice(uint64_t modelState);
+
+    /*!
+     * Retrieves whether a choice is defined for the given state.
+     */
+    bool isChoiceDefined(uint64_t modelState) const;
+
+    /*!
+     * Retrieves the (local) choice of the given state, which has to be defined.
+     */
+    uint64_t getChoice(uint64_t modelState) const;
+
+    /*!
+     * Sets the given state to dontCare, i.e., the state is considered unreachable and is ignored when exporting the scheduler.
+     * If not specified otherwise, an arbitrary choice is set if no choice exists.
+     */
+    void setDontCare(uint64_t modelState, bool setArbitraryChoice = true);
+    void unSetDontCare(uint64_t modelState);
+    bool isDontCare(uint64_t modelState) const;
+
+    /*!
+     * Retrieves whether there is a state for which the choice is undefined.
+     */
+    bool isPartialScheduler() const;
+
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Retrieves the number of bits that are used to store the choice of a single state.
+     */
+    uint64_t getNumberOfBitsPerChoice() const;
+
+    /*!
+     * Converts this scheduler into the general representation.
+     */
+    template<typename ValueType>
+    Scheduler<ValueType> toScheduler() const;
+
+    /*!
+     * Prints the scheduler in json format to the given output stream. The format coincides with the one of Scheduler::printJsonToStream, but
+     * the output is written state by state instead of assembling the whole json structure in memory.
+     *
+     * @param out The output stream
+     * @param model If given, provides additional information for printing (e.g., displaying the state valuations instead of state indices).
+     * @param skipUniqueChoices If true, the (unique) choice for deterministic states (i.e., states with only one enabled choice) is not printed explicitly.
+     *                          Requires a model to be given.
+     * @param skipDontCareStates If true, the choice for dontCareStates states is not printed explicitly.
+     */
+    template<typename ValueType>
+    void printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model = nullptr, bool skipUniqueChoices = false,
+                           bool skipDontCareStates = false) const;
+
+    /*!
+     * Writes the scheduler in a binary format to the given output stream. After a small header, the defined states, the dontCare states and the
+     * packed choices are written as bit vectors. All numbers are stored in the byte order of the machine that writes the scheduler.
+     */
+    void writeBinaryToStream(std::ostream& out) const;
+
+    /*!
+     * Reads a scheduler that was written by writeBinaryToStream from the given input stream.
+     */
+    static PackedScheduler readBinaryFromStream(std::istream& in);
+
+    bool operator==(PackedScheduler const& other) const;
+
+   private:
+    uint64_t numberOfStates;
+    uint64_t bitsPerChoice;
+    // The choice of state s is stored in the bits [s * bitsPerChoice, (s + 1) * bitsPerChoice).
+    storm::storage::BitVector choices;
+    storm::storage::BitVector definedStates;
+    storm::storage::BitVector dontCareStates;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,526 @@
+#include "storm/storage/RoaringBitVector.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The number of bits of the index that are stored in a container.
+uint64_t const chunkBits = 16;
+uint64_t const chunkMask = (1ull << chunkBits) - 1;
+uint64_t const wordsPerBitmap = (1ull << chunkBits) / 64;
+// Containers with more set bits than this are stored as bitmaps. At this cardinality, both representations occupy 8 KiB.
+uint64_t const maximalArrayCardinality = 4096;
+
+uint64_t countBits(std::vector<uint64_t> const& words) {
+    uint64_t result = 0;
+    for (auto word : words) {
+        result += __builtin_popcountll(word);
+    }
+    return result;
+}
+
+/*!
+ * Invokes the given function for the offsets of all bits set in the given container in ascending order.
+ */
+template<typename ContainerType, typename FunctionType>
+void forEachOffset(ContainerType const& container, FunctionType const& function) {
+    if (container.isBitmap()) {
+        for (uint64_t wordIndex = 0; wordIndex < wordsPerBitmap; ++wordIndex) {
+            uint64_t word = container.bitmap[wordIndex];
+            while (word != 0) {
+                function(static_cast<uint16_t>(wordIndex * 64 + __builtin_ctzll(word)));
+                word &= word - 1;
+            }
+        }
+    } else {
+        for (auto offset : container.array) {
+            function(offset);
+        }
+    }
+}
+}  // namespace
+
+RoaringBitVector::const_iterator::const_iterator(RoaringBitVector const* bitVector, uint64_t containerIndex, uint64_t position)
+    : bitVector(bitVector), containerIndex(containerIndex), position(position) {
+    moveToSetBit();
+}
+
+void RoaringBitVector::const_iterator::moveToSetBit() {
+    while (containerIndex < bitVector->containers.size()) {
+        Container const& container = bitVector->containers[containerIndex];
+        if (container.isBitmap()) {
+            if (position < (1ull << chunkBits)) {
+                uint64_t wordIndex = position >> 6;
+                uint64_t word = container.bitmap[wordIndex] & (~0ull << (position & 63));
+                while (word == 0 && ++wordIndex < wordsPerBitmap) {
+                    word = container.bitmap[wordIndex];
+                }
+                if (word != 0) {
+                    position = wordIndex * 64 + __builtin_ctzll(word);
+                    return;
+                }
+            }
+        } else if (position < container.array.size()) {
+            return;
+        }
+        ++containerIndex;
+        position = 0;
+    }
+}
+
+RoaringBitVector::const_iterator& RoaringBitVector::const_iterator::operator++() {
+    ++position;
+    moveToSetBit();
+    return *this;
+}
+
+uint64_t RoaringBitVector::const_iterator::operator*() const {
+    Container const& container = bitVector->containers[containerIndex];
+    uint64_t offset = container.isBitmap() ? position : container.array[position];
+    return (container.key << chunkBits) | offset;
+}
+
+bool RoaringBitVector::const_iterator::operator==(const_iterator const& other) const {
+    return containerIndex == other.containerIndex && position == other.position;
+}
+
+bool RoaringBitVector::const_iterator::operator!=(const_iterator const& other) const {
+    return !(*this == other);
+}
+
+bool RoaringBitVector::Container::isBitmap() const {
+    return !bitmap.empty();
+}
+
+bool RoaringBitVector::Container::get(uint16_t offset) const {
+    if (isBitmap()) {
+        return (bitmap[offset >> 6] >> (offset & 63)) & 1ull;
+    }
+    return std::binary_search(array.begin(), array.end(), offset);
+}
+
+void RoaringBitVector::Container::normalize() {
+    if (isBitmap() && cardinality <= maximalArrayCardinality) {
+        std::vector<uint16_t> newArray;
+        newArray.reserve(cardinality);
+        forEachOffset(*this, [&newArray](uint16_t offset) { newArray.push_back(offset); });
+        array = std::move(newArray);
+        bitmap = std::vector<uint64_t>();
+    } else if (!isBitmap() && cardinality > maximalArrayCardinality) {
+        bitmap.assign(wordsPerBitmap, 0);
+        for (auto offset : array) {
+            bitmap[offset >> 6] |= 1ull << (offset & 63);
+        }
+        array = std::vector<uint16_t>();
+    }
+}
+
+bool RoaringBitVector::Container::operator==(Container const& other) const {
+    // As both containers are normalized, equal containers use the same representation.
+    return key == other.key && cardinality == other.cardinality && bitmap == other.bitmap && array == other.array;
+}
+
+RoaringBitVector::RoaringBitVector() : bitCount(0) {
+    // Intentionally left empty.
+}
+
+RoaringBitVector::RoaringBitVector(uint64_t length) : bitCount(length) {
+    // Intentionally left empty.
+}
+
+RoaringBitVector::RoaringBitVector(BitVector const& bitVector) : bitCount(bitVector.size()) {
+    for (auto index : bitVector) {
+        set(index, true);
+    }
+}
+
+bool RoaringBitVector::operator==(RoaringBitVector const& other) const {
+    return bitCount == other.bitCount && containers == other.containers;
+}
+
+bool RoaringBitVector::operator!=(RoaringBitVector const& other) const {
+    return !(*this == other);
+}
+
+bool RoaringBitVector::operator==(BitVector const& other) const {
+    return bitCount == other.size() && getNumberOfSetBits() == other.getNumberOfSetBits() && isSubsetOf(other);
+}
+
+bool RoaringBitVector::operator!=(BitVector const& other) const {
+    return !(*this == other);
+}
+
+uint64_t RoaringBitVector::findContainer(uint64_t key) const {
+    // Indices are usually set in ascending order, so we check the last container first.
+    if (!containers.empty() && containers.back().key < key) {
+        return containers.size();
+    }
+    auto it = std::lower_bound(containers.begin(), containers.end(), key, [](Container const& container, uint64_t k) { return container.key < k; });
+    return std::distance(containers.begin(), it);
+}
+
+void RoaringBitVector::set(uint64_t index, bool value) {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to RoaringBitVector::set: written index " << index << " out of bounds.");
+    uint64_t key = index >> chunkBits;
+    uint16_t offset = static_cast<uint16_t>(index & chunkMask);
+    uint64_t containerIndex = findContainer(key);
+    bool exists = containerIndex < containers.size() && containers[containerIndex].key == key;
+    if (!exists) {
+        if (value) {
+            Container container;
+            container.key = key;
+            container.array.push_back(offset);
+            container.cardinality = 1;
+            containers.insert(containers.begin() + containerIndex, std::move(container));
+        }
+        return;
+    }
+
+    Container& container = containers[containerIndex];
+    if (container.isBitmap()) {
+        uint64_t& word = container.bitmap[offset >> 6];
+        uint64_t mask = 1ull << (offset & 63);
+        if (static_cast<bool>(word & mask) == value) {
+            return;
+        }
+        word ^= mask;
+    } else {
+        auto it = std::lower_bound(container.array.begin(), container.array.end(), offset);
+        bool present = it != container.array.end() && *it == offset;
+        if (present == value) {
+            return;
+        }
+        if (value) {
+            container.array.insert(it, offset);
+        } else {
+            container.array.erase(it);
+        }
+    }
+    if (value) {
+        ++container.cardinality;
+    } else if (--container.cardinality == 0) {
+        containers.erase(containers.begin() + containerIndex);
+        return;
+    }
+    container.normalize();
+}
+
+bool RoaringBitVector::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to RoaringBitVector::get: read index " << index << " out of bounds.");
+    uint64_t key = index >> chunkBits;
+    uint64_t containerIndex = findContainer(key);
+    return containerIndex < containers.size() && containers[containerIndex].key == key &&
+           containers[containerIndex].get(static_cast<uint16_t>(index & chunkMask));
+}
+
+uint64_t RoaringBitVector::size() const {
+    return bitCount;
+}
+
+uint64_t RoaringBitVector::getNumberOfSetBits() const {
+    uint64_t result = 0;
+    for (auto const& container : containers) {
+        result += container.cardinality;
+    }
+    return result;
+}
+
+bool RoaringBitVector::empty() const {
+    // Empty containers are never stored.
+    return containers.empty();
+}
+
+bool RoaringBitVector::full() const {
+    return getNumberOfSetBits() == bitCount;
+}
+
+RoaringBitVector::Container RoaringBitVector::intersect(Container const& first, Container const& second) {
+    Container result;
+    result.key = first.key;
+    if (first.isBitmap() && second.isBitmap()) {
+        result.bitmap.resize(wordsPerBitmap);
+        for (uint64_t wordIndex = 0; wordIndex < wordsPerBitmap; ++wordIndex) {
+            result.bitmap[wordIndex] = first.bitmap[wordIndex] & second.bitmap[wordIndex];
+        }
+        result.cardinality = countBits(result.bitmap);
+    } else if (!first.isBitmap() && !second.isBitmap()) {
+        std::set_intersection(first.array.begin(), first.array.end(), second.array.begin(), second.array.end(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    } else {
+        Container const& arrayContainer = first.isBitmap() ? second : first;
+        Container const& bitmapContainer = first.isBitmap() ? first : second;
+        for (auto offset : arrayContainer.array) {
+            if (bitmapContainer.get(offset)) {
+                result.array.push_back(offset);
+            }
+        }
+        result.cardinality = result.array.size();
+    }
+    result.normalize();
+    return result;
+}
+
+RoaringBitVector::Container RoaringBitVector::unite(Container const& first, Container const& second) {
+    Container result;
+    result.key = first.key;
+    if (!first.isBitmap() && !second.isBitmap()) {
+        std::set_union(first.array.begin(), first.array.end(), second.array.begin(), second.array.end(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    } else {
+        Container const& bitmapContainer = first.isBitmap() ? first : second;
+        Container const& otherContainer = first.isBitmap() ? second : first;
+        result.bitmap = bitmapContainer.bitmap;
+        if (otherContainer.isBitmap()) {
+            for (uint64_t wordIndex = 0; wordIndex < wordsPerBitmap; ++wordIndex) {
+                result.bitmap[wordIndex] |= otherContainer.bitmap[wordIndex];
+            }
+        } else {
+            for (auto offset : otherContainer.array) {
+                result.bitmap[offset >> 6] |= 1ull << (offset & 63);
+            }
+        }
+        result.cardinality = countBits(result.bitmap);
+    }
+    result.normalize();
+    return result;
+}
+
+RoaringBitVector::Container RoaringBitVector::subtract(Container const& first, Container const& second) {
+    Container result;
+    result.key = first.key;
+    if (first.isBitmap()) {
+        result.bitmap = first.bitmap;
+        if (second.isBitmap()) {
+            for (uint64_t wordIndex = 0; wordIndex < wordsPerBitmap; ++wordIndex) {
+                result.bitmap[wordIndex] &= ~second.bitmap[wordIndex];
+            }
+        } else {
+            for (auto offset : second.array) {
+                result.bitmap[offset >> 6] &= ~(1ull << (offset & 63));
+            }
+        }
+        result.cardinality = countBits(result.bitmap);
+    } else {
+        for (auto offset : first.array) {
+            if (!second.get(offset)) {
+                result.array.push_back(offset);
+            }
+        }
+        result.cardinality = result.array.size();
+    }
+    result.normalize();
+    return result;
+}
+
+RoaringBitVector RoaringBitVector::operator&(RoaringBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    RoaringBitVector result(bitCount);
+    auto first = containers.begin();
+    auto second = other.containers.begin();
+    while (first != containers.end() && second != other.containers.end()) {
+        if (first->key < second->key) {
+            ++first;
+        } else if (second->key < first->key) {
+            ++second;
+        } else {
+            Container container = intersect(*first, *second);
+            if (container.cardinality > 0) {
+                result.containers.push_back(std::move(container));
+            }
+            ++first;
+            ++second;
+        }
+    }
+    return result;
+}
+
+RoaringBitVector RoaringBitVector::operator|(RoaringBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    RoaringBitVector result(bitCount);
+    result.containers.reserve(std::max(containers.size(), other.containers.size()));
+    auto first = containers.begin();
+    auto second = other.containers.begin();
+    while (first != containers.end() || second != other.containers.end()) {
+        if (second == other.containers.end() || (first != containers.end() && first->key < second->key)) {
+            result.containers.push_back(*first);
+            ++first;
+        } else if (first == containers.end() || second->key < first->key) {
+            result.containers.push_back(*second);
+            ++second;
+        } else {
+            result.containers.push_back(unite(*first, *second));
+            ++first;
+            ++second;
+        }
+    }
+    return result;
+}
+
+RoaringBitVector& RoaringBitVector::operator&=(RoaringBitVector const& other) {
+    *this = *this & other;
+    return *this;
+}
+
+RoaringBitVector& RoaringBitVector::operator|=(RoaringBitVector const& other) {
+    *this = *this | other;
+    return *this;
+}
+
+RoaringBitVector RoaringBitVector::difference(RoaringBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    RoaringBitVector result(bitCount);
+    auto second = other.containers.begin();
+    for (auto const& container : containers) {
+        while (second != other.containers.end() && second->key < container.key) {
+            ++second;
+        }
+        if (second != other.containers.end() && second->key == container.key) {
+            Container remaining = subtract(container, *second);
+            if (remaining.cardinality > 0) {
+                result.containers.push_back(std::move(remaining));
+            }
+        } else {
+            result.containers.push_back(container);
+        }
+    }
+    return result;
+}
+
+RoaringBitVector RoaringBitVector::operator&(BitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.size(), "Length of the bit vectors does not match.");
+    RoaringBitVector result(bitCount);
+    for (auto index : *this) {
+        if (other.get(index)) {
+            result.set(index, true);
+        }
+    }
+    return result;
+}
+
+bool RoaringBitVector::isSubsetOf(RoaringBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    auto second = other.containers.begin();
+    for (auto const& container : containers) {
+        while (second != other.containers.end() && second->key < container.key) {
+            ++second;
+        }
+        if (second == other.containers.end() || second->key != container.key || second->cardinality < container.cardinality ||
+            subtract(container, *second).cardinality > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RoaringBitVector::isSubsetOf(BitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.size(), "Length of the bit vectors does not match.");
+    for (auto index : *this) {
+        if (!other.get(index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RoaringBitVector::isDisjointFrom(RoaringBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    auto second = other.containers.begin();
+    for (auto const& container : containers) {
+        while (second != other.containers.end() && second->key < container.key) {
+            ++second;
+        }
+        if (second != other.containers.end() && second->key == container.key && intersect(container, *second).cardinality > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RoaringBitVector::isDisjointFrom(BitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.size(), "Length of the bit vectors does not match.");
+    for (auto index : *this) {
+        if (other.get(index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+RoaringBitVector RoaringBitVector::permute(std::vector<uint64_t> const& inversePermutation) const {
+    STORM_LOG_ASSERT(inversePermutation.size() == bitCount, "Permutation does not match the length of the bit vector.");
+    RoaringBitVector result(bitCount);
+    for (uint64_t index = 0; index < bitCount; ++index) {
+        if (get(inversePermutation[index])) {
+            result.set(index, true);
+        }
+    }
+    return result;
+}
+
+BitVector RoaringBitVector::toBitVector() const {
+    BitVector result(bitCount);
+    for (auto index : *this) {
+        result.set(index, true);
+    }
+    return result;
+}
+
+std::vector<uint64_t> RoaringBitVector::getSetIndices() const {
+    std::vector<uint64_t> result;
+    result.reserve(getNumberOfSetBits());
+    for (auto const& container : containers) {
+        uint64_t base = container.key << chunkBits;
+        forEachOffset(container, [&result, base](uint16_t offset) { result.push_back(base | offset); });
+    }
+    return result;
+}
+
+std::size_t RoaringBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + containers.capacity() * sizeof(Container);
+    for (auto const& container : containers) {
+        result += container.bitmap.capacity() * sizeof(uint64_t) + container.array.capacity() * sizeof(uint16_t);
+    }
+    return result;
+}
+
+bool RoaringBitVector::isSparse(uint64_t numberOfSetBits, uint64_t size) {
+    // Estimate the size of the compressed representation assuming that all set bits are in array containers and require at least a
+    // factor of four in savings, as the operations on the compressed representation are slower for dense bit vectors.
+    uint64_t numberOfChunks = (size >> chunkBits) + 1;
+    uint64_t compressedBytes = numberOfSetBits * sizeof(uint16_t) + std::min(numberOfSetBits, numberOfChunks) * sizeof(Container);
+    return 4 * compressedBytes <= size / 8;
+}
+
+RoaringBitVector::const_iterator RoaringBitVector::begin() const {
+    return const_iterator(this, 0, 0);
+}
+
+RoaringBitVector::const_iterator RoaringBitVector::end() const {
+    return const_iterator(this, containers.size(), 0);
+}
+
+std::ostream& operator<<(std::ostream& out, RoaringBitVector const& bitVector) {
+    out << "roaring bit vector(" << bitVector.getNumberOfSetBits() << "/" << bitVector.size() << ") [";
+    for (auto index : bitVector) {
+        out << index << " ";
+    }
+    out << "]";
+    return out;
+}
+
+BitVector operator|(BitVector const& first, RoaringBitVector const& second) {
+    STORM_LOG_ASSERT(first.size() == second.size(), "Length of the bit vectors does not match.");
+    BitVector result(first);
+    for (auto index : second) {
+        result.set(index, true);
+    }
+    return result;
+}
+
+}  // namespace storage
+}  // namespace storm
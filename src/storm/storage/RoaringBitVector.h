@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A compressed bit vector in the style of roaring bitmaps. The index space is split into chunks of 2^16 bits and only chunks that contain a
+ * set bit are stored. A chunk with few set bits is stored as a sorted array of 16-bit offsets, a chunk with many set bits as a plain bitmap.
+ * Hence, the memory consumption and the cost of the set operations depend on the number of set bits rather than on the size.
+ *
+ * The class offers the query interface of BitVector (get, size, getNumberOfSetBits, empty, full, isSubsetOf, isDisjointFrom and iteration
+ * over the set indices) so that code templated over the set type works with both representations. Mixed operations and conversions to
+ * and from BitVector are provided as well.
+ */
+class RoaringBitVector {
+   public:
+    /*!
+     * A forward iterator over the indices whose corresponding bits are set to true.
+     */
+    class const_iterator {
+        friend class RoaringBitVector;
+
+       public:
+        // Define iterator
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = uint64_t*;
+        using reference = uint64_t&;
+
+        const_iterator& operator++();
+        uint64_t operator*() const;
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+
+       private:
+        const_iterator(RoaringBitVector const* bitVector, uint64_t containerIndex, uint64_t position);
+
+        // Moves to the next set bit, starting at the current position (inclusive).
+        void moveToSetBit();
+
+        RoaringBitVector const* bitVector;
+        uint64_t containerIndex;
+        // The index in the array of an array container or the bit offset in a bitmap container.
+        uint64_t position;
+    };
+
+    /*!
+     * Constructs an empty bit vector of size zero.
+     */
+    RoaringBitVector();
+
+    /*!
+     * Constructs a bit vector of the given size in which all bits are set to false.
+     */
+    explicit RoaringBitVector(uint64_t length);
+
+    /*!
+     * Constructs a bit vector that holds the same bits as the given bit vector.
+     */
+    explicit RoaringBitVector(BitVector const& bitVector);
+
+    /*!
+     * Constructs a bit vector of the given size in which exactly the bits at the indices in the given (sorted) range are set.
+     */
+    template<typename InputIterator>
+    RoaringBitVector(uint64_t length, InputIterator first, InputIterator last);
+
+    RoaringBitVector(RoaringBitVector const& other) = default;
+    RoaringBitVector(RoaringBitVector&& other) = default;
+    RoaringBitVector& operator=(RoaringBitVector const& other) = default;
+    RoaringBitVector& operator=(RoaringBitVector&& other) = default;
+
+    bool operator==(RoaringBitVector const& other) const;
+    bool operator!=(RoaringBitVector const& other) const;
+
+    /*!
+     * Checks whether the given bit vector has the same size and holds the same bits.
+     */
+    bool operator==(BitVector const& other) const;
+    bool operator!=(BitVector const& other) const;
+
+    /*!
+     * Sets the given truth value at the given index.
+     */
+    void set(uint64_t index, bool value = true);
+
+    /*!
+     * Retrieves the truth value of the bit at the given index.
+     */
+    bool get(uint64_t index) const;
+
+    /*!
+     * Retrieves the number of bits this bit vector can store.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of bits that are set to true. This runs in time linear in the number of stored chunks.
+     */
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves whether no bit is set.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves whether all bits are set.
+     */
+    bool full() const;
+
+    /*!
+     * Performs a logical "and", "or" or "and not" with the given bit vector of the same size.
+     */
+    RoaringBitVector operator&(RoaringBitVector const& other) const;
+    RoaringBitVector operator|(RoaringBitVector const& other) const;
+    RoaringBitVector& operator&=(RoaringBitVector const& other);
+    RoaringBitVector& operator|=(RoaringBitVector const& other);
+    RoaringBitVector difference(RoaringBitVector const& other) const;
+
+    /*!
+     * Performs a logical "and" with the given (uncompressed) bit vector of the same size. This runs in time linear in the number of bits
+     * set in this bit vector.
+     */
+    RoaringBitVector operator&(BitVector const& other) const;
+
+    /*!
+     * Checks whether all bits set in this bit vector are also set in the given one.
+     */
+    bool isSubsetOf(RoaringBitVector const& other) const;
+    bool isSubsetOf(BitVector const& other) const;
+
+    /*!
+     * Checks whether none of the bits set in this bit vector is also set in the given one.
+     */
+    bool isDisjointFrom(RoaringBitVector const& other) const;
+    bool isDisjointFrom(BitVector const& other) const;
+
+    /*!
+     * Retrieves the bit vector in which the bits are permuted according to the given inverse permutation, i.e., bit i of the result is
+     * bit inversePermutation[i] of this bit vector.
+     */
+    RoaringBitVector permute(std::vector<uint64_t> const& inversePermutation) const;
+
+    /*!
+     * Converts this bit vector to an (uncompressed) BitVector of the same size.
+     */
+    BitVector toBitVector() const;
+
+    /*!
+     * Retrieves the indices of all set bits in ascending order.
+     */
+    std::vector<uint64_t> getSetIndices() const;
+
+    /*!
+     * Retrieves the number of bytes this bit vector occupies in memory.
+     */
+    std::size_t getSizeInBytes() const;
+
+    /*!
+     * Retrieves whether a bit vector of the given size with the given number of set bits is considerably smaller in the compressed
+     * representation than as a BitVector.
+     */
+    static bool isSparse(uint64_t numberOfSetBits, uint64_t size);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    friend std::ostream& operator<<(std::ostream& out, RoaringBitVector const& bitVector);
+
+   private:
+    /*!
+     * The bits of one chunk of 2^16 indices. Exactly one of the two representations is used.
+     */
+    struct Container {
+        // The index of the chunk, i.e., the upper bits of the indices stored in the container.
+        uint64_t key;
+        // If non-empty, the container is a bitmap of 1024 words, where bit i of the chunk is bit (i % 64) of word i / 64.
+        std::vector<uint64_t> bitmap;
+        // The sorted offsets of the set bits (if the container is not a bitmap).
+        std::vector<uint16_t> array;
+        uint64_t cardinality;
+
+        bool isBitmap() const;
+        bool get(uint16_t offset) const;
+        // Switches to the representation that fits the cardinality.
+        void normalize();
+        bool operator==(Container const& other) const;
+    };
+
+    // Retrieves the index of the container with the given key or the index at which it would have to be inserted.
+    uint64_t findContainer(uint64_t key) const;
+
+    static Container intersect(Container const& first, Container const& second);
+    static Container unite(Container const& first, Container const& second);
+    static Container subtract(Container const& first, Container const& second);
+
+    uint64_t bitCount;
+    // The non-empty containers sorted by their keys.
+    std::vector<Container> containers;
+};
+
+template<typename InputIterator>
+RoaringBitVector::RoaringBitVector(uint64_t length, InputIterator first, InputIterator last) : RoaringBitVector(length) {
+    for (; first != last; ++first) {
+        set(*first, true);
+    }
+}
+
+/*!
+ * Performs a logical "or" of an uncompressed and a compressed bit vector, which yields an uncompressed bit vector.
+ */
+BitVector operator|(BitVector const& first, RoaringBitVector const& second);
+
+}  // namespace storage
+}  // namespace storm
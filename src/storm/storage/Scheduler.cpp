@@ -156,6 +156,11 @@ bool Scheduler<ValueType>::isMemorylessScheduler() const {
     return getNumberOfMemoryStates() == 1;
 }
 
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getNumberOfModelStates() const {
+    return schedulerChoices.front().size();
+}
+
 template<typename ValueType>
 uint_fast64_t Scheduler<ValueType>::getNumberOfMemoryStates() const {
     return memoryStructure ? memoryStructure->getNumberOfStates() : 1;
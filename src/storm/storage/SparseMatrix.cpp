@@ -1,5 +1,6 @@
 #include <boost/functional/hash.hpp>
 
+#include "storm/adapters/HybridRationalNumber.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
@@ -7,6 +8,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -93,6 +95,8 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type
       initialRowGroupCount(rowGroups),
       rowGroupIndices(),
       columnsAndValues(),
+      finishedBlocks(),
+      finishedEntryCount(0),
       rowIndications(),
       currentEntryCount(0),
       lastRow(0),
@@ -129,6 +133,8 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& ma
       initialRowGroupCount(0),
       rowGroupIndices(),
       columnsAndValues(std::move(matrix.columnsAndValues)),
+      finishedBlocks(),
+      finishedEntryCount(0),
       rowIndications(std::move(matrix.rowIndications)),
       currentEntryCount(matrix.entryCount),
       currentRowGroupCount() {
@@ -156,7 +162,7 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
     // Check that we did not move backwards wrt. the row.
     STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException,
                     "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
-    STORM_LOG_ASSERT(columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
+    STORM_LOG_ASSERT(finishedEntryCount + columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
 
     // Check if a diagonal entry shall be inserted before
     if (pendingDiagonalEntry) {
@@ -191,6 +197,14 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
             assert(rowIndications.size() == lastRow + 1);
             rowIndications.resize(row + 1, currentEntryCount);
             lastRow = row;
+
+            // As a new row starts, we may start a new block without splitting a row.
+            if (!initialEntryCountSet && columnsAndValues.size() >= EntryBlockSize) {
+                finishedEntryCount += columnsAndValues.size();
+                finishedBlocks.push_back(std::move(columnsAndValues));
+                columnsAndValues = std::vector<MatrixEntry<index_type, value_type>>();
+                columnsAndValues.reserve(EntryBlockSize);
+            }
         }
 
         lastColumn = column;
@@ -205,12 +219,13 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
             // TODO we fix this row directly after the out-of-order insertion, but the code does not exploit that fact.
             STORM_LOG_TRACE("Fix row " << row << " as column " << column << " is added out-of-order.");
             // First, we sort according to columns.
-            std::sort(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(),
+            auto const rowBegin = columnsAndValues.begin() + (rowIndications.back() - finishedEntryCount);
+            std::sort(rowBegin, columnsAndValues.end(),
                       [](storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                           return a.getColumn() < b.getColumn();
                       });
 
-            auto insertIt = columnsAndValues.begin() + rowIndications.back();
+            auto insertIt = rowBegin;
             uint64_t elementsToRemove = 0;
             for (auto it = insertIt + 1; it != columnsAndValues.end(); ++it) {
                 // Iterate over all entries in this last row and detect duplicates.
@@ -223,7 +238,7 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
                 }
             }
             // Then, we eliminate those duplicate entries.
-            std::unique(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(),
+            std::unique(rowBegin, columnsAndValues.end(),
                         [](storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                             return a.getColumn() == b.getColumn();
                         });
@@ -287,6 +302,8 @@ SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overrid
         addNextValue(lastRow, diagColumn, diagValue);
     }
 
+    consolidateEntries();
+
     bool hasEntries = currentEntryCount != 0;
 
     uint_fast64_t rowCount = hasEntries ? lastRow + 1 : 0;
@@ -396,6 +413,7 @@ void print(std::vector<typename SparseMatrix<ValueType>::index_type> const& rowG
 
 template<typename ValueType>
 void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
+    consolidateEntries();
     index_type maxColumn = 0;
 
     for (index_type row = 0; row < rowIndications.size(); ++row) {
@@ -427,6 +445,25 @@ void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> cons
     lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
 }
 
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::consolidateEntries() {
+    if (finishedBlocks.empty()) {
+        return;
+    }
+    // The pages of the result are only claimed while it is filled, and each block is released right after it was copied.
+    // Hence, the peak memory consumption only exceeds the final size by roughly one block.
+    std::vector<MatrixEntry<index_type, value_type>> entries;
+    entries.reserve(currentEntryCount);
+    for (auto& block : finishedBlocks) {
+        entries.insert(entries.end(), std::make_move_iterator(block.begin()), std::make_move_iterator(block.end()));
+        std::vector<MatrixEntry<index_type, value_type>>().swap(block);
+    }
+    entries.insert(entries.end(), std::make_move_iterator(columnsAndValues.begin()), std::make_move_iterator(columnsAndValues.end()));
+    columnsAndValues = std::move(entries);
+    finishedBlocks.clear();
+    finishedEntryCount = 0;
+}
+
 template<typename ValueType>
 void SparseMatrixBuilder<ValueType>::addDiagonalEntry(index_type row, ValueType const& value) {
     STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException,
@@ -1120,9 +1157,9 @@ std::vector<ValueType> SparseMatrix<ValueType>::getConstrainedRowGroupSumVector(
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(bool useGroups, storm::storage::BitVector const& rowConstraint,
                                                               storm::storage::BitVector const& columnConstraint, bool insertDiagonalElements,
-                                                              storm::storage::BitVector const& makeZeroColumns) const {
+                                                              storm::storage::BitVector const& makeZeroColumns, uint64_t numberOfThreads) const {
     if (useGroups) {
-        return getSubmatrix(rowConstraint, columnConstraint, this->getRowGroupIndices(), insertDiagonalElements, makeZeroColumns);
+        return getSubmatrix(rowConstraint, columnConstraint, this->getRowGroupIndices(), insertDiagonalElements, makeZeroColumns, numberOfThreads);
     } else {
         // Create a fake row grouping to reduce this to a call to a more general method.
         std::vector<index_type> fakeRowGroupIndices(rowCount + 1);
@@ -1130,7 +1167,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(bool useGroups, st
         for (std::vector<index_type>::iterator it = fakeRowGroupIndices.begin(); it != fakeRowGroupIndices.end(); ++it, ++i) {
             *it = i;
         }
-        auto res = getSubmatrix(rowConstraint, columnConstraint, fakeRowGroupIndices, insertDiagonalElements, makeZeroColumns);
+        auto res = getSubmatrix(rowConstraint, columnConstraint, fakeRowGroupIndices, insertDiagonalElements, makeZeroColumns, numberOfThreads);
 
         // Create a new row grouping that reflects the new sizes of the row groups if the current matrix has a
         // non trivial row-grouping.
@@ -1162,81 +1199,117 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(bool useGroups, st
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::BitVector const& rowGroupConstraint,
                                                               storm::storage::BitVector const& columnConstraint, std::vector<index_type> const& rowGroupIndices,
-                                                              bool insertDiagonalEntries, storm::storage::BitVector const& makeZeroColumns) const {
+                                                              bool insertDiagonalEntries, storm::storage::BitVector const& makeZeroColumns,
+                                                              uint64_t numberOfThreads, storm::storage::BitVector const* sumColumnConstraint,
+                                                              std::vector<ValueType>* rowSums) const {
     STORM_LOG_THROW(!rowGroupConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
     index_type submatrixColumnCount = columnConstraint.getNumberOfSetBits();
 
     // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
     // bits that were set before that particular index.
     std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
-    std::unique_ptr<std::vector<index_type>> tmp;
-    if (rowGroupConstraint != columnConstraint) {
-        tmp = std::make_unique<std::vector<index_type>>(rowGroupConstraint.getNumberOfSetBitsBeforeIndices());
-    }
-    std::vector<index_type> const& rowBitsSetBeforeIndex = tmp ? *tmp : columnBitsSetBeforeIndex;
-
-    // Then, we need to determine the number of entries and the number of rows of the submatrix.
-    index_type subEntries = 0;
-    index_type subRows = 0;
-    index_type rowGroupCount = 0;
-    for (auto index : rowGroupConstraint) {
-        subRows += rowGroupIndices[index + 1] - rowGroupIndices[index];
-        for (index_type i = rowGroupIndices[index]; i < rowGroupIndices[index + 1]; ++i) {
-            bool foundDiagonalElement = false;
-
-            for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
-                if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
-                    ++subEntries;
-
-                    if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
-                        foundDiagonalElement = true;
+    auto isColumnKept = [&columnConstraint, &makeZeroColumns](index_type column) {
+        return columnConstraint.get(column) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(column));
+    };
+
+    // Determine the first row of each selected row group in the submatrix.
+    std::vector<index_type> selectedRowGroups(rowGroupConstraint.begin(), rowGroupConstraint.end());
+    std::vector<index_type> subRowGroupIndices;
+    subRowGroupIndices.reserve(selectedRowGroups.size() + 1);
+    subRowGroupIndices.push_back(0);
+    for (auto group : selectedRowGroups) {
+        subRowGroupIndices.push_back(subRowGroupIndices.back() + rowGroupIndices[group + 1] - rowGroupIndices[group]);
+    }
+    index_type subRows = subRowGroupIndices.back();
+
+    // The selected row groups are processed in chunks, each of which is handled by one thread. In a first pass, we count the entries
+    // of every row of the submatrix (reserving one entry for the diagonal if requested), so that the prefix sums of the counts
+    // determine where each row starts. In the second pass, the entries are written to their final position. If requested, the
+    // constrained row sums are computed in the first pass.
+    uint64_t const chunkSize = 1024;
+    std::vector<index_type> subRowIndications(subRows + 1, 0);
+    if (rowSums) {
+        rowSums->assign(subRows, storm::utility::zero<ValueType>());
+    }
+    storm::utility::parallel::forEachChunk(numberOfThreads, selectedRowGroups.size(), chunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t subGroup = begin; subGroup < end; ++subGroup) {
+            index_type group = selectedRowGroups[subGroup];
+            index_type subRow = subRowGroupIndices[subGroup];
+            for (index_type row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row, ++subRow) {
+                index_type entries = 0;
+                bool foundDiagonalElement = false;
+                ValueType sum = storm::utility::zero<ValueType>();
+                for (const_iterator it = this->begin(row), ite = this->end(row); it != ite; ++it) {
+                    if (isColumnKept(it->getColumn())) {
+                        ++entries;
+                        if (columnBitsSetBeforeIndex[it->getColumn()] == subGroup) {
+                            foundDiagonalElement = true;
+                        }
+                    }
+                    if (sumColumnConstraint && sumColumnConstraint->get(it->getColumn())) {
+                        sum += it->getValue();
                     }
                 }
-            }
-
-            // If requested, we need to reserve one entry more for inserting the diagonal zero entry.
-            if (insertDiagonalEntries && !foundDiagonalElement && rowGroupCount < submatrixColumnCount) {
-                ++subEntries;
+                if (rowSums) {
+                    (*rowSums)[subRow] = std::move(sum);
+                }
+                // If requested, we need to reserve one entry more for inserting the diagonal zero entry.
+                if (insertDiagonalEntries && !foundDiagonalElement && subGroup < submatrixColumnCount) {
+                    ++entries;
+                }
+                subRowIndications[subRow + 1] = entries;
             }
         }
-        ++rowGroupCount;
+    });
+    for (index_type subRow = 0; subRow < subRows; ++subRow) {
+        subRowIndications[subRow + 1] += subRowIndications[subRow];
     }
 
-    // Create and initialize resulting matrix.
-    SparseMatrixBuilder<ValueType> matrixBuilder(subRows, submatrixColumnCount, subEntries, true, !this->hasTrivialRowGrouping());
-
     // Copy over selected entries.
-    rowGroupCount = 0;
-    index_type rowCount = 0;
-    subEntries = 0;
-    for (auto index : rowGroupConstraint) {
-        if (!this->hasTrivialRowGrouping()) {
-            matrixBuilder.newRowGroup(rowCount);
-        }
-        for (index_type i = rowGroupIndices[index]; i < rowGroupIndices[index + 1]; ++i) {
-            bool insertedDiagonalElement = false;
-
-            for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
-                if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
-                    if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
-                        insertedDiagonalElement = true;
-                    } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[it->getColumn()] > rowBitsSetBeforeIndex[index]) {
-                        matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
-                        insertedDiagonalElement = true;
+    std::vector<MatrixEntry<index_type, ValueType>> subColumnsAndValues(subRowIndications.back());
+    storm::utility::parallel::forEachChunk(numberOfThreads, selectedRowGroups.size(), chunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t subGroup = begin; subGroup < end; ++subGroup) {
+            index_type group = selectedRowGroups[subGroup];
+            index_type subRow = subRowGroupIndices[subGroup];
+            for (index_type row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row, ++subRow) {
+                auto entryIt = subColumnsAndValues.begin() + subRowIndications[subRow];
+                bool insertedDiagonalElement = false;
+                for (const_iterator it = this->begin(row), ite = this->end(row); it != ite; ++it) {
+                    if (isColumnKept(it->getColumn())) {
+                        index_type subColumn = columnBitsSetBeforeIndex[it->getColumn()];
+                        if (subColumn == subGroup) {
+                            insertedDiagonalElement = true;
+                        } else if (insertDiagonalEntries && !insertedDiagonalElement && subColumn > subGroup) {
+                            *entryIt = MatrixEntry<index_type, ValueType>(subGroup, storm::utility::zero<ValueType>());
+                            ++entryIt;
+                            insertedDiagonalElement = true;
+                        }
+                        *entryIt = MatrixEntry<index_type, ValueType>(subColumn, it->getValue());
+                        ++entryIt;
                     }
-                    ++subEntries;
-                    matrixBuilder.addNextValue(rowCount, columnBitsSetBeforeIndex[it->getColumn()], it->getValue());
+                }
+                if (insertDiagonalEntries && !insertedDiagonalElement && subGroup < submatrixColumnCount) {
+                    *entryIt = MatrixEntry<index_type, ValueType>(subGroup, storm::utility::zero<ValueType>());
                 }
             }
-            if (insertDiagonalEntries && !insertedDiagonalElement && rowGroupCount < submatrixColumnCount) {
-                matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
-            }
-            ++rowCount;
         }
-        ++rowGroupCount;
+    });
+
+    boost::optional<std::vector<index_type>> resultRowGroupIndices;
+    if (!this->hasTrivialRowGrouping()) {
+        resultRowGroupIndices = std::move(subRowGroupIndices);
     }
+    return SparseMatrix<ValueType>(submatrixColumnCount, std::move(subRowIndications), std::move(subColumnsAndValues), std::move(resultRowGroupIndices));
+}
 
-    return matrixBuilder.build();
+template<typename ValueType>
+std::pair<SparseMatrix<ValueType>, std::vector<ValueType>> SparseMatrix<ValueType>::getSubmatrixAndConstrainedRowGroupSumVector(
+    storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint,
+    storm::storage::BitVector const& sumColumnConstraint, bool insertDiagonalEntries, uint64_t numberOfThreads) const {
+    std::pair<SparseMatrix<ValueType>, std::vector<ValueType>> result;
+    result.first = getSubmatrix(rowGroupConstraint, columnConstraint, this->getRowGroupIndices(), insertDiagonalEntries, storm::storage::BitVector(),
+                                numberOfThreads, &sumColumnConstraint, &result.second);
+    return result;
 }
 
 template<typename ValueType>
@@ -1330,55 +1403,58 @@ void SparseMatrix<ValueType>::dropZeroEntries() {
 }
 
 template<typename ValueType>
-SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping,
-                                                                         bool insertDiagonalEntries) const {
-    // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
-    // diagonal entries if requested.
-    index_type subEntries = 0;
-    for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
-        // Determine which row we need to select from the current row group.
-        index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
-
-        // Iterate through that row and count the number of slots we have to reserve for copying.
-        bool foundDiagonalElement = false;
-        for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
-            if (it->getColumn() == rowGroupIndex) {
-                foundDiagonalElement = true;
+SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries,
+                                                                         uint64_t numberOfThreads) const {
+    // First, we need to count how many non-zero entries each row of the resulting matrix will have and reserve space for
+    // diagonal entries if requested. The prefix sums of these counts then determine where the rows start.
+    uint64_t const chunkSize = 1024;
+    index_type const resultRowCount = rowGroupToRowIndexMapping.size();
+    std::vector<index_type> resultRowIndications(resultRowCount + 1, 0);
+    storm::utility::parallel::forEachChunk(numberOfThreads, resultRowCount, chunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (index_type rowGroupIndex = begin; rowGroupIndex < end; ++rowGroupIndex) {
+            // Determine which row we need to select from the current row group.
+            index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
+            index_type entries = this->getRow(rowToCopy).getNumberOfEntries();
+            if (insertDiagonalEntries && std::none_of(this->begin(rowToCopy), this->end(rowToCopy),
+                                                      [rowGroupIndex](auto const& entry) { return entry.getColumn() == rowGroupIndex; })) {
+                ++entries;
             }
-            ++subEntries;
-        }
-        if (insertDiagonalEntries && !foundDiagonalElement) {
-            ++subEntries;
+            resultRowIndications[rowGroupIndex + 1] = entries;
         }
+    });
+    for (index_type row = 0; row < resultRowCount; ++row) {
+        resultRowIndications[row + 1] += resultRowIndications[row];
     }
 
-    // Now create the matrix to be returned with the appropriate size.
-    SparseMatrixBuilder<ValueType> matrixBuilder(rowGroupIndices.get().size() - 1, columnCount, subEntries);
-
     // Copy over the selected lines from the source matrix.
-    for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
-        // Determine which row we need to select from the current row group.
-        index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
-
-        // Iterate through that row and copy the entries. This also inserts a zero element on the diagonal if
-        // there is no entry yet.
-        bool insertedDiagonalElement = false;
-        for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
-            if (it->getColumn() == rowGroupIndex) {
-                insertedDiagonalElement = true;
-            } else if (insertDiagonalEntries && !insertedDiagonalElement && it->getColumn() > rowGroupIndex) {
-                matrixBuilder.addNextValue(rowGroupIndex, rowGroupIndex, storm::utility::zero<ValueType>());
-                insertedDiagonalElement = true;
+    std::vector<MatrixEntry<index_type, ValueType>> resultColumnsAndValues(resultRowIndications.back());
+    storm::utility::parallel::forEachChunk(numberOfThreads, resultRowCount, chunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (index_type rowGroupIndex = begin; rowGroupIndex < end; ++rowGroupIndex) {
+            index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
+            auto entryIt = resultColumnsAndValues.begin() + resultRowIndications[rowGroupIndex];
+
+            // Iterate through that row and copy the entries. This also inserts a zero element on the diagonal if
+            // there is no entry yet.
+            bool insertedDiagonalElement = false;
+            for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
+                if (it->getColumn() == rowGroupIndex) {
+                    insertedDiagonalElement = true;
+                } else if (insertDiagonalEntries && !insertedDiagonalElement && it->getColumn() > rowGroupIndex) {
+                    *entryIt = MatrixEntry<index_type, ValueType>(rowGroupIndex, storm::utility::zero<ValueType>());
+                    ++entryIt;
+                    insertedDiagonalElement = true;
+                }
+                *entryIt = *it;
+                ++entryIt;
+            }
+            if (insertDiagonalEntries && !insertedDiagonalElement) {
+                *entryIt = MatrixEntry<index_type, ValueType>(rowGroupIndex, storm::utility::zero<ValueType>());
             }
-            matrixBuilder.addNextValue(rowGroupIndex, it->getColumn(), it->getValue());
-        }
-        if (insertDiagonalEntries && !insertedDiagonalElement) {
-            matrixBuilder.addNextValue(rowGroupIndex, rowGroupIndex, storm::utility::zero<ValueType>());
         }
-    }
+    });
 
     // Finalize created matrix and return result.
-    return matrixBuilder.build();
+    return SparseMatrix<ValueType>(columnCount, std::move(resultRowIndications), std::move(resultColumnsAndValues), boost::none);
 }
 
 template<typename ValueType>
@@ -1424,6 +1500,40 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowIndexSequence(
     return matrixBuilder.build();
 }
 
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRowGroupsAndColumns(std::vector<index_type> const& inversePermutation) const {
+    STORM_LOG_THROW(inversePermutation.size() == this->getRowGroupCount() && columnCount == this->getRowGroupCount(),
+                    storm::exceptions::InvalidArgumentException, "Permutation does not match the dimensions of the matrix.");
+    std::vector<index_type> permutation(inversePermutation.size());
+    for (index_type newState = 0; newState < inversePermutation.size(); ++newState) {
+        permutation[inversePermutation[newState]] = newState;
+    }
+
+    bool const customRowGrouping = !this->hasTrivialRowGrouping();
+    SparseMatrixBuilder<ValueType> matrixBuilder(rowCount, columnCount, entryCount, true, customRowGrouping, customRowGrouping ? this->getRowGroupCount() : 0);
+    std::vector<MatrixEntry<index_type, ValueType>> rowEntries;
+    index_type newRow = 0;
+    for (auto oldGroup : inversePermutation) {
+        if (customRowGrouping) {
+            matrixBuilder.newRowGroup(newRow);
+        }
+        for (auto oldRow : this->getRowGroupIndices(oldGroup)) {
+            // The columns of a row need to be inserted in ascending order.
+            rowEntries.clear();
+            for (auto const& entry : this->getRow(oldRow)) {
+                rowEntries.emplace_back(permutation[entry.getColumn()], entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](MatrixEntry<index_type, ValueType> const& a, MatrixEntry<index_type, ValueType> const& b) { return a.getColumn() < b.getColumn(); });
+            for (auto const& entry : rowEntries) {
+                matrixBuilder.addNextValue(newRow, entry.getColumn(), entry.getValue());
+            }
+            ++newRow;
+        }
+    }
+    return matrixBuilder.build();
+}
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_type> const& inversePermutation) const {
     // Now create the matrix to be returned with the appropriate size.
@@ -1447,53 +1557,126 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_t
     return result;
 }
 
-template<typename ValueType>
-SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros) const {
-    index_type rowCount = this->getColumnCount();
-    index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
-    index_type entryCount;
-    if (keepZeros) {
-        entryCount = this->getEntryCount();
-    } else {
-        this->updateNonzeroEntryCount();
-        entryCount = this->getNonzeroEntryCount();
-    }
+namespace {
+
+/*!
+ * Transposes the given matrix by a counting sort of its entries w.r.t. their columns. The rows (or row groups) of the matrix are split
+ * into consecutive blocks, one for each thread. Every thread counts the entries of its block per column. Then, the offset at which a
+ * thread writes the entries of a column is the start of the column plus the counts of the preceding blocks, so that the threads write
+ * to disjoint positions and the entries of every transposed row remain sorted. The per-thread counts require one index per column and
+ * thread, which is why the number of blocks is limited such that they take at most as much memory as the transposed entries.
+ *
+ * @param makeEntry A callable with signature Entry(index_type source, MatrixEntry const& entry) that creates the transposed entry.
+ */
+template<typename ValueType, typename Entry, typename MakeEntry>
+void transposeEntries(SparseMatrix<ValueType> const& matrix, bool joinGroups, bool keepZeros, uint64_t numberOfThreads,
+                      std::vector<typename SparseMatrix<ValueType>::index_type>& rowIndications, std::vector<Entry>& entries, MakeEntry const& makeEntry) {
+    typedef typename SparseMatrix<ValueType>::index_type index_type;
+    index_type const rowCount = matrix.getColumnCount();
+    index_type const sourceCount = joinGroups ? matrix.getRowGroupCount() : matrix.getRowCount();
+    auto getSource = [&](index_type source) { return joinGroups ? matrix.getRowGroup(source) : matrix.getRow(source); };
+    auto isKept = [keepZeros](MatrixEntry<index_type, ValueType> const& entry) {
+        return keepZeros || entry.getValue() != storm::utility::zero<ValueType>();
+    };
+
+    uint64_t numberOfBlocks = std::min<uint64_t>(numberOfThreads, sourceCount);
+    if (rowCount > 0) {
+        numberOfBlocks = std::min<uint64_t>(numberOfBlocks, matrix.getEntryCount() / rowCount);
+    }
+    rowIndications.assign(rowCount + 1, 0);
+    if (numberOfBlocks <= 1) {
+        // First, we need to count how many entries each column has.
+        for (index_type source = 0; source < sourceCount; ++source) {
+            for (auto const& entry : getSource(source)) {
+                if (isKept(entry)) {
+                    ++rowIndications[entry.getColumn() + 1];
+                }
+            }
+        }
 
-    std::vector<index_type> rowIndications(rowCount + 1);
-    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(entryCount);
+        // Now compute the accumulated offsets.
+        for (index_type i = 1; i < rowCount + 1; ++i) {
+            rowIndications[i] = rowIndications[i - 1] + rowIndications[i];
+        }
+
+        // Create an array that stores the index for the next value to be added for each row in the transposed matrix. Initially this
+        // corresponds to the previously computed accumulated offsets.
+        std::vector<index_type> nextIndices = rowIndications;
 
-    // First, we need to count how many entries each column has.
-    for (index_type group = 0; group < columnCount; ++group) {
-        for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
-            if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
-                ++rowIndications[transition.getColumn() + 1];
+        // Now we are ready to actually fill in the values of the transposed matrix.
+        entries.resize(rowIndications.back());
+        for (index_type source = 0; source < sourceCount; ++source) {
+            for (auto const& entry : getSource(source)) {
+                if (isKept(entry)) {
+                    entries[nextIndices[entry.getColumn()]++] = makeEntry(source, entry);
+                }
             }
         }
+        return;
     }
 
-    // Now compute the accumulated offsets.
-    for (index_type i = 1; i < rowCount + 1; ++i) {
-        rowIndications[i] = rowIndications[i - 1] + rowIndications[i];
-    }
+    uint64_t const blockSize = (sourceCount + numberOfBlocks - 1) / numberOfBlocks;
+    numberOfBlocks = (sourceCount + blockSize - 1) / blockSize;
+    std::vector<std::vector<index_type>> nextIndices(numberOfBlocks);
+    storm::utility::parallel::forEachChunk(numberOfBlocks, sourceCount, blockSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        std::vector<index_type>& counts = nextIndices[begin / blockSize];
+        counts.assign(rowCount, 0);
+        for (index_type source = begin; source < end; ++source) {
+            for (auto const& entry : getSource(source)) {
+                if (isKept(entry)) {
+                    ++counts[entry.getColumn()];
+                }
+            }
+        }
+    });
 
-    // Create an array that stores the index for the next value to be added for
-    // each row in the transposed matrix. Initially this corresponds to the previously
-    // computed accumulated offsets.
-    std::vector<index_type> nextIndices = rowIndications;
+    // Turn the counts into the positions at which the blocks write their first entry of each column.
+    index_type offset = 0;
+    for (index_type row = 0; row < rowCount; ++row) {
+        rowIndications[row] = offset;
+        for (auto& counts : nextIndices) {
+            index_type count = counts[row];
+            counts[row] = offset;
+            offset += count;
+        }
+    }
+    rowIndications[rowCount] = offset;
 
-    // Now we are ready to actually fill in the values of the transposed matrix.
-    for (index_type group = 0; group < columnCount; ++group) {
-        for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
-            if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
-                columnsAndValues[nextIndices[transition.getColumn()]] = std::make_pair(group, transition.getValue());
-                nextIndices[transition.getColumn()]++;
+    entries.resize(offset);
+    storm::utility::parallel::forEachChunk(numberOfBlocks, sourceCount, blockSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+        std::vector<index_type>& positions = nextIndices[begin / blockSize];
+        for (index_type source = begin; source < end; ++source) {
+            for (auto const& entry : getSource(source)) {
+                if (isKept(entry)) {
+                    entries[positions[entry.getColumn()]++] = makeEntry(source, entry);
+                }
             }
         }
-    }
+    });
+}
+
+}  // namespace
 
-    storm::storage::SparseMatrix<ValueType> transposedMatrix(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros, uint64_t numberOfThreads) const {
+    std::vector<index_type> rowIndications;
+    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues;
+    transposeEntries(*this, joinGroups, keepZeros, numberOfThreads, rowIndications, columnsAndValues,
+                     [](index_type source, MatrixEntry<index_type, ValueType> const& entry) {
+                         return MatrixEntry<index_type, ValueType>(source, entry.getValue());
+                     });
+    index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
+    return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
 
-    return transposedMatrix;
+template<typename ValueType>
+SparseMatrixStructure SparseMatrix<ValueType>::transposeStructure(bool joinGroups, bool keepZeros, uint64_t numberOfThreads) const {
+    std::vector<index_type> rowIndications;
+    std::vector<index_type> columns;
+    transposeEntries(*this, joinGroups, keepZeros, numberOfThreads, rowIndications, columns,
+                     [](index_type source, MatrixEntry<index_type, ValueType> const&) { return source; });
+    index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
+    return SparseMatrixStructure(columnCount, std::move(rowIndications), std::move(columns));
 }
 
 template<typename ValueType>
@@ -2655,6 +2838,19 @@ template std::vector<storm::GmpRationalNumber> SparseMatrix<GmpRationalNumber>::
 template bool SparseMatrix<storm::GmpRationalNumber>::isSubmatrixOf(SparseMatrix<storm::GmpRationalNumber> const& matrix) const;
 #endif
 
+// Hybrid Rational Numbers
+template class MatrixEntry<typename SparseMatrix<HybridRationalNumber>::index_type, HybridRationalNumber>;
+template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<HybridRationalNumber>::index_type, HybridRationalNumber> const& entry);
+template class SparseMatrixBuilder<HybridRationalNumber>;
+template class SparseMatrix<HybridRationalNumber>;
+template std::ostream& operator<<(std::ostream& out, SparseMatrix<HybridRationalNumber> const& matrix);
+template storm::HybridRationalNumber SparseMatrix<storm::HybridRationalNumber>::getPointwiseProductRowSum(
+    storm::storage::SparseMatrix<storm::HybridRationalNumber> const& otherMatrix,
+    typename SparseMatrix<storm::HybridRationalNumber>::index_type const& row) const;
+template std::vector<storm::HybridRationalNumber> SparseMatrix<HybridRationalNumber>::getPointwiseProductRowSumVector(
+    storm::storage::SparseMatrix<storm::HybridRationalNumber> const& otherMatrix) const;
+template bool SparseMatrix<storm::HybridRationalNumber>::isSubmatrixOf(SparseMatrix<storm::HybridRationalNumber> const& matrix) const;
+
 // Rational Function
 template class MatrixEntry<typename SparseMatrix<RationalFunction>::index_type, RationalFunction>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<RationalFunction>::index_type, RationalFunction> const& entry);
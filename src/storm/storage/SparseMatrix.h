@@ -12,6 +12,7 @@
 
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrixStructure.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/adapters/IntelTbbAdapter.h"
@@ -254,6 +255,15 @@ class SparseMatrixBuilder {
     void addDiagonalEntry(index_type row, ValueType const& value);
 
    private:
+    /*!
+     * Moves the entries of all finished blocks into the storage of the current block such that all entries are stored in one vector.
+     */
+    void consolidateEntries();
+
+    // If the number of entries is not known upfront, the entries are stored in blocks of (roughly) this many entries. This avoids
+    // that the (large) entry vector needs to be reallocated, which temporarily requires up to three times its final size.
+    static constexpr index_type EntryBlockSize = 1ull << 20;
+
     // A flag indicating whether a row count was set upon construction.
     bool initialRowCountSet;
 
@@ -287,9 +297,15 @@ class SparseMatrixBuilder {
     // The vector that stores the row-group indices (if they are non-trivial).
     boost::optional<std::vector<index_type>> rowGroupIndices;
 
-    // The storage for the columns and values of all entries in the matrix.
+    // The storage for the columns and values of the entries in the current block. Rows never span several blocks.
     std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
 
+    // The entries of the blocks that precede the current block.
+    std::vector<std::vector<MatrixEntry<index_type, value_type>>> finishedBlocks;
+
+    // The number of entries of all finished blocks, i.e., the index of the first entry of the current block.
+    index_type finishedEntryCount;
+
     // A vector containing the indices at which each given row begins. This index is to be interpreted as an
     // index in the valueStorage and the columnIndications vectors. Put differently, the values of the entries
     // in row i are valueStorage[rowIndications[i]] to valueStorage[rowIndications[i + 1]] where the last
@@ -740,11 +756,34 @@ class SparseMatrix {
      * @param columnConstraint A bit vector indicating which columns to keep.
      * @param insertDiagonalEntries If set to true, the resulting matrix will have zero entries in column i for
      * each row i, if there is no value yet. This can then be used for inserting other values later.
+     * @param makeZeroColumns If given, the entries in these columns are dropped as well (while the columns are kept).
+     * @param numberOfThreads The number of threads that copy the selected rows concurrently.
      * @return A matrix corresponding to a submatrix of the current matrix in which only rows and columns given
      * by the constraints are kept and all others are dropped.
      */
     SparseMatrix getSubmatrix(bool useGroups, storm::storage::BitVector const& rowConstraint, storm::storage::BitVector const& columnConstraint,
-                              bool insertDiagonalEntries = false, storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector()) const;
+                              bool insertDiagonalEntries = false, storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector(),
+                              uint64_t numberOfThreads = 1) const;
+
+    /*!
+     * Creates the submatrix of the selected row groups and columns and, in the same pass over the matrix, the sums of the entries in the
+     * given sum columns for all rows in the selected row groups. This yields the same as getSubmatrix(true, rowGroupConstraint,
+     * columnConstraint, insertDiagonalEntries) and getConstrainedRowGroupSumVector(rowGroupConstraint, sumColumnConstraint), e.g., the
+     * matrix and the right-hand side of the equation system for the maybe states of a reachability query.
+     *
+     * @param rowGroupConstraint A bit vector indicating which row groups to keep.
+     * @param columnConstraint A bit vector indicating which columns to keep.
+     * @param sumColumnConstraint A bit vector indicating which columns to sum.
+     * @param insertDiagonalEntries If set to true, the resulting matrix will have zero entries in column i for
+     * each row in row group i, if there is no value yet.
+     * @param numberOfThreads The number of threads that process the selected row groups concurrently.
+     * @return The submatrix and the vector of constrained row sums.
+     */
+    std::pair<SparseMatrix, std::vector<value_type>> getSubmatrixAndConstrainedRowGroupSumVector(storm::storage::BitVector const& rowGroupConstraint,
+                                                                                               storm::storage::BitVector const& columnConstraint,
+                                                                                               storm::storage::BitVector const& sumColumnConstraint,
+                                                                                               bool insertDiagonalEntries = false,
+                                                                                               uint64_t numberOfThreads = 1) const;
 
     /*!
      * Restrict rows in grouped rows matrix. Ensures that the number of groups stays the same.
@@ -766,6 +805,16 @@ class SparseMatrix {
      */
     SparseMatrix permuteRows(std::vector<index_type> const& inversePermutation) const;
 
+    /*!
+     * Permutes the row groups and the columns of the matrix according to the given permutation of states.
+     * That is, row group i of the result consists of the rows of row group inversePermutation[i] (in the same order) and
+     * column inversePermutation[j] of this matrix becomes column j. The matrix needs to have as many columns as row groups.
+     *
+     * @param inversePermutation For each state of the result, the corresponding state of this matrix.
+     * @return The permuted matrix. Its row grouping is trivial iff the row grouping of this matrix is.
+     */
+    SparseMatrix permuteRowGroupsAndColumns(std::vector<index_type> const& inversePermutation) const;
+
     /*!
      * Returns a copy of this matrix that only considers entries in the selected rows.
      * Non-selected rows will not have any entries
@@ -805,9 +854,11 @@ class SparseMatrix {
      *
      * @param insertDiagonalEntries If set to true, the resulting matrix will have zero entries in column i for
      * each row in row group i. This can then be used for inserting other values later.
+     * @param numberOfThreads The number of threads that copy the selected rows concurrently.
      * @return A submatrix of the current matrix by selecting one row out of each row group.
      */
-    SparseMatrix selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries = true) const;
+    SparseMatrix selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries = true,
+                                         uint64_t numberOfThreads = 1) const;
 
     /*!
      * Selects the rows that are given by the sequence of row indices, allowing to select rows arbitrarily often and with an arbitrary order
@@ -825,10 +876,23 @@ class SparseMatrix {
      *
      * @param joinGroups A flag indicating whether the row groups are supposed to be treated as single rows.
      * @param keepZeros A flag indicating whether entries with value zero should be kept.
+     * @param numberOfThreads The number of threads that count and scatter the entries.
      *
      * @return A sparse matrix that represents the transpose of this matrix.
      */
-    storm::storage::SparseMatrix<value_type> transpose(bool joinGroups = false, bool keepZeros = false) const;
+    storm::storage::SparseMatrix<value_type> transpose(bool joinGroups = false, bool keepZeros = false, uint64_t numberOfThreads = 1) const;
+
+    /*!
+     * Transposes the structure of the matrix, i.e., the values of the entries are dropped. This suffices for graph algorithms that only
+     * need the predecessors of states and requires (at most) half of the memory of transpose.
+     *
+     * @param joinGroups A flag indicating whether the row groups are supposed to be treated as single rows.
+     * @param keepZeros A flag indicating whether entries with value zero should be kept.
+     * @param numberOfThreads The number of threads that count and scatter the entries.
+     *
+     * @return The structure of the transpose of this matrix.
+     */
+    storm::storage::SparseMatrixStructure transposeStructure(bool joinGroups = false, bool keepZeros = false, uint64_t numberOfThreads = 1) const;
 
     /*!
      * Transposes the matrix w.r.t. the selected rows.
@@ -1206,12 +1270,19 @@ class SparseMatrix {
      * @param rowGroupIndices A vector indicating which rows belong to a given row group.
      * @param insertDiagonalEntries If set to true, the resulting matrix will have zero entries in column i for
      * each row in row group i. This can then be used for inserting other values later.
+     * @param makeZeroColumns If given, the entries in these columns are dropped as well (while the columns are kept).
+     * @param numberOfThreads The number of threads that copy the selected row groups concurrently. Each thread first counts the entries
+     * of its rows and then, after the row starts have been determined via prefix sums, copies the entries to their final position.
+     * @param sumColumnConstraint If given, the sums of the entries in these columns are computed for all rows of the submatrix while
+     * counting the entries.
+     * @param rowSums If given, the computed sums are stored in this vector.
      * @return A matrix corresponding to a submatrix of the current matrix in which only row groups and columns
      * given by the row group constraint are kept and all others are dropped.
      */
     SparseMatrix getSubmatrix(storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint,
                               std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries = false,
-                              storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector()) const;
+                              storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector(), uint64_t numberOfThreads = 1,
+                              storm::storage::BitVector const* sumColumnConstraint = nullptr, std::vector<value_type>* rowSums = nullptr) const;
 
     // The number of rows of the matrix.
     index_type rowCount;
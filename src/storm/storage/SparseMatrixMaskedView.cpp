@@ -0,0 +1,108 @@
+#include "storm/storage/SparseMatrixMaskedView.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+SparseMatrixMaskedView<ValueType>::SparseMatrixMaskedView(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                          storm::storage::BitVector const& rowGroupConstraint,
+                                                          storm::storage::BitVector const& columnConstraint)
+    : matrix(matrix), columnConstraint(columnConstraint), selectedRowGroups(rowGroupConstraint.begin(), rowGroupConstraint.end()) {
+    STORM_LOG_THROW(rowGroupConstraint.size() == matrix.getRowGroupCount(), storm::exceptions::InvalidArgumentException,
+                    "The row group constraint does not fit the matrix.");
+    STORM_LOG_THROW(columnConstraint.size() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "The column constraint does not fit the matrix.");
+    rowGroupIndices.reserve(selectedRowGroups.size() + 1);
+    rowGroupIndices.push_back(0);
+    for (auto rowGroup : selectedRowGroups) {
+        rowGroupIndices.push_back(rowGroupIndices.back() + matrix.getRowGroupSize(rowGroup));
+    }
+    columnMapping = columnConstraint.getNumberOfSetBitsBeforeIndices();
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixMaskedView<ValueType>::getNumberOfRows() const {
+    return rowGroupIndices.back();
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixMaskedView<ValueType>::getNumberOfRowGroups() const {
+    return selectedRowGroups.size();
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixMaskedView<ValueType>::getNumberOfColumns() const {
+    return columnConstraint.getNumberOfSetBits();
+}
+
+template<typename ValueType>
+std::pair<uint64_t, uint64_t> SparseMatrixMaskedView<ValueType>::getOriginalRows(uint64_t rowGroup) const {
+    uint64_t originalRowGroup = selectedRowGroups[rowGroup];
+    return std::make_pair(matrix.getRowGroupIndices()[originalRowGroup], matrix.getRowGroupIndices()[originalRowGroup + 1]);
+}
+
+template<typename ValueType>
+ValueType SparseMatrixMaskedView<ValueType>::multiplyRow(uint64_t originalRow, uint64_t row, std::vector<ValueType> const& x,
+                                                         std::vector<ValueType> const* b) const {
+    // Start with the offset (as in SparseMatrix::multiplyWithVector) so that both yield the same result.
+    ValueType result = b ? (*b)[row] : storm::utility::zero<ValueType>();
+    for (auto const& entry : matrix.getRow(originalRow)) {
+        if (columnConstraint.get(entry.getColumn())) {
+            result += entry.getValue() * x[columnMapping[entry.getColumn()]];
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SparseMatrixMaskedView<ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(&x != &result, "The input and output vectors must not be the same.");
+    result.resize(getNumberOfRows());
+    for (uint64_t rowGroup = 0; rowGroup < getNumberOfRowGroups(); ++rowGroup) {
+        auto originalRows = getOriginalRows(rowGroup);
+        for (uint64_t originalRow = originalRows.first; originalRow < originalRows.second; ++originalRow) {
+            uint64_t row = rowGroupIndices[rowGroup] + originalRow - originalRows.first;
+            result[row] = multiplyRow(originalRow, row, x, b);
+        }
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixMaskedView<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x,
+                                                          std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                          std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&x != &result, "The input and output vectors must not be the same.");
+    result.resize(getNumberOfRowGroups());
+    if (choices) {
+        choices->resize(getNumberOfRowGroups());
+    }
+    for (uint64_t rowGroup = 0; rowGroup < getNumberOfRowGroups(); ++rowGroup) {
+        auto originalRows = getOriginalRows(rowGroup);
+        ValueType best = storm::utility::zero<ValueType>();
+        uint64_t bestChoice = 0;
+        for (uint64_t originalRow = originalRows.first; originalRow < originalRows.second; ++originalRow) {
+            uint64_t choice = originalRow - originalRows.first;
+            ValueType value = multiplyRow(originalRow, rowGroupIndices[rowGroup] + choice, x, b);
+            if (choice == 0 || (storm::solver::minimize(dir) ? value < best : value > best)) {
+                best = value;
+                bestChoice = choice;
+            }
+        }
+        result[rowGroup] = best;
+        if (choices) {
+            (*choices)[rowGroup] = bestChoice;
+        }
+    }
+}
+
+template class SparseMatrixMaskedView<double>;
+template class SparseMatrixMaskedView<storm::RationalNumber>;
+
+}  // namespace storage
+}  // namespace storm
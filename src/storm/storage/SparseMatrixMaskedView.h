@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only view on the submatrix of a sparse matrix that is given by a set of row groups and a set of columns. In contrast to
+ * SparseMatrix::getSubmatrix, the entries are never copied: rows of selected row groups are read from the original matrix and entries in
+ * columns outside the constraint are skipped on the fly. This is useful if a subsystem is only needed for a few matrix-vector products.
+ *
+ * The rows, row groups and columns of the view are numbered consecutively in the order of the original matrix, i.e., in the same way as
+ * they would be numbered in the result of SparseMatrix::getSubmatrix.
+ */
+template<typename ValueType>
+class SparseMatrixMaskedView {
+   public:
+    /*!
+     * Creates a view on the given matrix. The matrix has to outlive the view.
+     *
+     * @param matrix The matrix to view.
+     * @param rowGroupConstraint The row groups that are part of the view.
+     * @param columnConstraint The columns that are part of the view.
+     */
+    SparseMatrixMaskedView(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& rowGroupConstraint,
+                           storm::storage::BitVector const& columnConstraint);
+
+    uint64_t getNumberOfRows() const;
+    uint64_t getNumberOfRowGroups() const;
+    uint64_t getNumberOfColumns() const;
+
+    /*!
+     * Retrieves the indices of the rows of the original matrix that belong to the given row group of the view.
+     */
+    std::pair<uint64_t, uint64_t> getOriginalRows(uint64_t rowGroup) const;
+
+    /*!
+     * Multiplies the rows of the view with the given vector and adds the given offset (if any).
+     *
+     * @param x The vector with which to multiply. Its size has to be the number of columns of the view.
+     * @param b If not null, the offsets of the rows of the view.
+     * @param result The vector to which the values of the rows of the view are written.
+     */
+    void multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+    /*!
+     * Performs multiply and reduces the values of the rows of each row group to their minimum or maximum.
+     *
+     * @param dir The direction in which to reduce the values of the rows.
+     * @param x The vector with which to multiply. Must not be the same as result.
+     * @param b If not null, the offsets of the rows of the view.
+     * @param result The vector to which the values of the row groups of the view are written.
+     * @param choices If not null, the index of an optimal row (relative to the row group) is written for each row group.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+   private:
+    /*!
+     * Computes the product of the given row of the original matrix with the given vector, skipping the columns outside the view, and
+     * adds the offset of the corresponding row of the view (if any).
+     */
+    ValueType multiplyRow(uint64_t originalRow, uint64_t row, std::vector<ValueType> const& x, std::vector<ValueType> const* b) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    storm::storage::BitVector const columnConstraint;
+
+    // The row groups of the original matrix that are part of the view.
+    std::vector<uint64_t> selectedRowGroups;
+
+    // For every row group of the view, the index of its first row in the view.
+    std::vector<uint64_t> rowGroupIndices;
+
+    // For every column of the original matrix, the index of the column in the view (only meaningful for selected columns).
+    std::vector<uint64_t> columnMapping;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,66 @@
+#include "storm/storage/SparseMatrixStructure.h"
+
+#include <iterator>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+SparseMatrixStructure::const_row::const_row(const_iterator begin, const_iterator end) : beginIterator(begin), endIterator(end) {
+    // Intentionally left empty.
+}
+
+SparseMatrixStructure::const_iterator SparseMatrixStructure::const_row::begin() const {
+    return beginIterator;
+}
+
+SparseMatrixStructure::const_iterator SparseMatrixStructure::const_row::end() const {
+    return endIterator;
+}
+
+SparseMatrixStructure::index_type SparseMatrixStructure::const_row::getNumberOfEntries() const {
+    return std::distance(beginIterator, endIterator);
+}
+
+SparseMatrixStructure::SparseMatrixStructure() : columnCount(0), rowIndications({0}) {
+    // Intentionally left empty.
+}
+
+SparseMatrixStructure::SparseMatrixStructure(index_type columnCount, std::vector<index_type>&& rowIndications, std::vector<index_type>&& columns)
+    : columnCount(columnCount), rowIndications(std::move(rowIndications)), columns(std::move(columns)) {
+    STORM_LOG_ASSERT(!this->rowIndications.empty() && this->rowIndications.back() == this->columns.size(), "Inconsistent matrix structure.");
+}
+
+SparseMatrixStructure::index_type SparseMatrixStructure::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+SparseMatrixStructure::index_type SparseMatrixStructure::getColumnCount() const {
+    return columnCount;
+}
+
+SparseMatrixStructure::index_type SparseMatrixStructure::getEntryCount() const {
+    return columns.size();
+}
+
+SparseMatrixStructure::const_row SparseMatrixStructure::getRow(index_type row) const {
+    return const_row(begin(row), end(row));
+}
+
+SparseMatrixStructure::const_iterator SparseMatrixStructure::begin(index_type row) const {
+    STORM_LOG_ASSERT(row < getRowCount(), "Row " << row << " exceeds row count " << getRowCount() << ".");
+    return columns.begin() + rowIndications[row];
+}
+
+SparseMatrixStructure::const_iterator SparseMatrixStructure::end(index_type row) const {
+    STORM_LOG_ASSERT(row < getRowCount(), "Row " << row << " exceeds row count " << getRowCount() << ".");
+    return columns.begin() + rowIndications[row + 1];
+}
+
+bool SparseMatrixStructure::operator==(SparseMatrixStructure const& other) const {
+    return columnCount == other.columnCount && rowIndications == other.rowIndications && columns == other.columns;
+}
+
+}  // namespace storage
+}  // namespace storm
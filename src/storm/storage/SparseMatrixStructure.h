@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * The structure (i.e., the positions of the entries but not their values) of a sparse matrix in compressed row storage format. This is
+ * sufficient for qualitative (graph) algorithms and requires half of the memory of a SparseMatrix<double> with the same entries.
+ */
+class SparseMatrixStructure {
+   public:
+    typedef storm::storage::sparse::state_type index_type;
+    typedef std::vector<index_type>::const_iterator const_iterator;
+
+    /*!
+     * The columns of the entries of a single row.
+     */
+    class const_row {
+       public:
+        const_row(const_iterator begin, const_iterator end);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        index_type getNumberOfEntries() const;
+
+       private:
+        const_iterator beginIterator;
+        const_iterator endIterator;
+    };
+
+    /*!
+     * Creates an empty structure.
+     */
+    SparseMatrixStructure();
+
+    /*!
+     * Creates a structure from the given contents.
+     *
+     * @param columnCount The number of columns.
+     * @param rowIndications The i-th entry is the index of the first entry of row i in the given columns. The last entry is the number of entries.
+     * @param columns The columns of all entries (in row-major order).
+     */
+    SparseMatrixStructure(index_type columnCount, std::vector<index_type>&& rowIndications, std::vector<index_type>&& columns);
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getEntryCount() const;
+
+    /*!
+     * Retrieves the columns of the entries of the given row.
+     */
+    const_row getRow(index_type row) const;
+
+    const_iterator begin(index_type row) const;
+    const_iterator end(index_type row) const;
+
+    bool operator==(SparseMatrixStructure const& other) const;
+
+   private:
+    index_type columnCount;
+
+    // The i-th entry is the index of the first entry of row i in 'columns'.
+    std::vector<index_type> rowIndications;
+
+    std::vector<index_type> columns;
+};
+
+}  // namespace storage
+}  // namespace storm
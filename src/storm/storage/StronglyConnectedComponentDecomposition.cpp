@@ -1,10 +1,18 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -166,6 +174,471 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+/*!
+ * A multi-threaded SCC decomposition based on the forward-backward algorithm with trimming (Fleischer, Hendrickson, Pinar;
+ * McLendon et al.). First, states without predecessors or successors (in the remaining graph) are repeatedly removed as they
+ * form singleton SCCs. On the remaining states, the SCC of a pivot state is the intersection of its forward and backward closure.
+ * The states that are only forward (backward) reachable and the states that are reached by neither search form independent
+ * subproblems. Large subproblems are processed one after another with level-synchronous parallel searches, small subproblems
+ * are processed concurrently. Finally, the SCCs are sorted topologically (by their depth in the SCC graph) which is computed by
+ * peeling the SCC graph from its bottom SCCs.
+ */
+template<typename ValueType>
+class ParallelSccSearch {
+   public:
+    ParallelSccSearch(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                      storm::storage::BitVector const* choices, uint64_t numberOfThreads)
+        : transitionMatrix(transitionMatrix),
+          rowGroupIndices(transitionMatrix.getRowGroupIndices()),
+          subsystem(subsystem),
+          choices(choices),
+          numberOfThreads(numberOfThreads),
+          numberOfStates(transitionMatrix.getRowGroupCount()),
+          partition(numberOfStates),
+          component(numberOfStates),
+          numberOfComponents(0),
+          nextPartition(1) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Computes the SCCs. The SCC indices are assigned in a topological order, i.e., an SCC may only reach SCCs with a smaller index.
+     *
+     * @param stateToSccMapping Is filled with the SCC index of each (subsystem) state.
+     * @param nonTrivialStates Is set for all states that either have a selfloop or whose SCC is not a singleton.
+     * @param sccDepths Is filled with the depth of each SCC.
+     * @return The number of SCCs.
+     */
+    uint64_t perform(std::vector<uint_fast64_t>& stateToSccMapping, storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& sccDepths) {
+        buildPredecessors();
+        trim();
+
+        // Perform the forward-backward search on the remaining states.
+        std::vector<uint64_t> remainingStates = collectStates(numberOfStates, [this](uint64_t state) { return partition[state].load() == 0; });
+        if (!remainingStates.empty()) {
+            processTasks(Task{std::move(remainingStates), 0});
+        }
+
+        return sortTopologically(stateToSccMapping, nonTrivialStates, sccDepths);
+    }
+
+   private:
+    /// A subproblem of the forward-backward search consisting of all given states that are (still) in the given partition.
+    struct Task {
+        std::vector<uint64_t> states;
+        uint64_t partition;
+    };
+
+    /// The partition of states that have been assigned to an SCC (or that are not part of the subsystem).
+    static constexpr uint64_t Done = std::numeric_limits<uint64_t>::max();
+    /// Subproblems with at least this many states are processed with parallel searches.
+    static constexpr uint64_t LargeTaskSize = 1ull << 16;
+    /// The number of frontier states that a thread claims at once during a parallel search.
+    static constexpr uint64_t ChunkSize = 1024;
+
+    bool isRelevant(uint64_t state) const {
+        return !subsystem || subsystem->get(state);
+    }
+
+    /*!
+     * Calls the given function for each successor of the given state within the subsystem except the state itself.
+     */
+    template<typename Function>
+    void forEachSuccessor(uint64_t state, Function const& function) const {
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (successor.getColumn() != state && isRelevant(successor.getColumn()) && !storm::utility::isZero(successor.getValue())) {
+                    function(successor.getColumn());
+                }
+            }
+        }
+    }
+
+    bool hasSelfLoop(uint64_t state) const {
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (successor.getColumn() == state && !storm::utility::isZero(successor.getValue())) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * Calls the given function for each predecessor of the given state within the subsystem except the state itself.
+     */
+    template<typename Function>
+    void forEachPredecessor(uint64_t state, Function const& function) const {
+        for (uint64_t index = predecessorIndications[state], end = predecessorIndications[state + 1]; index != end; ++index) {
+            function(predecessors[index]);
+        }
+    }
+
+    /*!
+     * Collects all indices in [0, size) that satisfy the given predicate (in an unspecified order).
+     */
+    template<typename Predicate>
+    std::vector<uint64_t> collectStates(uint64_t size, Predicate const& predicate) const {
+        std::vector<std::vector<uint64_t>> localResults(numberOfThreads);
+        storm::utility::parallel::forEachChunk(numberOfThreads, size, ChunkSize, [&](uint64_t thread, uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                if (predicate(index)) {
+                    localResults[thread].push_back(index);
+                }
+            }
+        });
+        return concatenate(localResults);
+    }
+
+    static std::vector<uint64_t> concatenate(std::vector<std::vector<uint64_t>>& vectors) {
+        std::vector<uint64_t> result;
+        for (auto& vector : vectors) {
+            result.insert(result.end(), vector.begin(), vector.end());
+            vector.clear();
+        }
+        return result;
+    }
+
+    /*!
+     * Builds the (transposed) predecessor relation and detects selfloops. Also initializes the partition of all states.
+     */
+    void buildPredecessors() {
+        selfLoop.assign(numberOfStates, false);
+        std::vector<std::atomic<uint64_t>> counts(numberOfStates + 1);
+        storm::utility::parallel::forEachChunk(numberOfThreads, numberOfStates, ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t state = begin; state < end; ++state) {
+                if (!isRelevant(state)) {
+                    partition[state].store(Done, std::memory_order_relaxed);
+                    continue;
+                }
+                partition[state].store(0, std::memory_order_relaxed);
+                selfLoop[state] = hasSelfLoop(state);
+                forEachSuccessor(state, [&](uint64_t successor) { counts[successor].fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+
+        predecessorIndications.resize(numberOfStates + 1);
+        predecessorIndications[0] = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            predecessorIndications[state + 1] = predecessorIndications[state] + counts[state].load(std::memory_order_relaxed);
+            counts[state].store(predecessorIndications[state], std::memory_order_relaxed);
+        }
+        predecessors.resize(predecessorIndications.back());
+        storm::utility::parallel::forEachChunk(numberOfThreads, numberOfStates, ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t state = begin; state < end; ++state) {
+                if (isRelevant(state)) {
+                    forEachSuccessor(state, [&](uint64_t successor) { predecessors[counts[successor].fetch_add(1, std::memory_order_relaxed)] = state; });
+                }
+            }
+        });
+    }
+
+    void assignSingletonComponent(uint64_t state) {
+        component[state] = numberOfComponents.fetch_add(1, std::memory_order_relaxed);
+        partition[state].store(Done, std::memory_order_relaxed);
+    }
+
+    /*!
+     * Repeatedly removes the states without incoming transitions in the remaining graph and then the states without outgoing transitions.
+     * Each removed state forms a singleton SCC.
+     */
+    void trim() {
+        std::vector<std::atomic<uint64_t>> counts(numberOfStates);
+        std::vector<std::vector<uint64_t>> localFrontiers(numberOfThreads);
+
+        // Counts the transitions to (from) remaining states and removes the states for which the count reaches zero.
+        auto trimInDirection = [&](bool backward) {
+            storm::utility::parallel::forEachChunk(numberOfThreads, numberOfStates, ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+                for (uint64_t state = begin; state < end; ++state) {
+                    if (partition[state].load(std::memory_order_relaxed) != Done) {
+                        uint64_t count = 0;
+                        if (backward) {
+                            forEachSuccessor(state, [&](uint64_t successor) { count += partition[successor].load(std::memory_order_relaxed) != Done ? 1 : 0; });
+                        } else {
+                            // As the forward direction is trimmed first, all predecessors are still remaining.
+                            count = predecessorIndications[state + 1] - predecessorIndications[state];
+                        }
+                        counts[state].store(count, std::memory_order_relaxed);
+                    }
+                }
+            });
+            std::vector<uint64_t> frontier = collectStates(numberOfStates, [&](uint64_t state) {
+                return partition[state].load(std::memory_order_relaxed) != Done && counts[state].load(std::memory_order_relaxed) == 0;
+            });
+            while (!frontier.empty()) {
+                storm::utility::parallel::forEachChunk(numberOfThreads, frontier.size(), ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        assignSingletonComponent(frontier[index]);
+                    }
+                });
+                storm::utility::parallel::forEachChunk(numberOfThreads, frontier.size(), ChunkSize, [&](uint64_t thread, uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        auto removeTransition = [&](uint64_t neighbor) {
+                            if (partition[neighbor].load(std::memory_order_relaxed) != Done && counts[neighbor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                                localFrontiers[thread].push_back(neighbor);
+                            }
+                        };
+                        if (backward) {
+                            forEachPredecessor(frontier[index], removeTransition);
+                        } else {
+                            forEachSuccessor(frontier[index], removeTransition);
+                        }
+                    }
+                });
+                frontier = concatenate(localFrontiers);
+            }
+        };
+
+        trimInDirection(false);
+        trimInDirection(true);
+    }
+
+    /*!
+     * Performs a breadth-first search from the given (already claimed) states. The neighbors of a state are given by the provided function and a
+     * neighbor is explored iff it can be claimed. If requested, the levels of the search are processed by multiple threads.
+     *
+     * @return All claimed states (including the initial ones).
+     */
+    template<typename Neighbors, typename Claim>
+    std::vector<uint64_t> search(std::vector<uint64_t>&& frontier, bool parallel, Neighbors const& neighbors, Claim const& claim) const {
+        uint64_t const threads = parallel ? numberOfThreads : 1;
+        std::vector<std::vector<uint64_t>> localFrontiers(threads);
+        std::vector<uint64_t> visited = frontier;
+        while (!frontier.empty()) {
+            storm::utility::parallel::forEachChunk(threads, frontier.size(), ChunkSize, [&](uint64_t thread, uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    neighbors(frontier[index], [&](uint64_t neighbor) {
+                        if (claim(neighbor)) {
+                            localFrontiers[thread].push_back(neighbor);
+                        }
+                    });
+                }
+            });
+            frontier = concatenate(localFrontiers);
+            visited.insert(visited.end(), frontier.begin(), frontier.end());
+        }
+        return visited;
+    }
+
+    /*!
+     * Decomposes the states of the given task. Each state of the task is either assigned to an SCC or to one of the created subtasks.
+     */
+    void processTask(Task const& task, bool parallel, std::vector<Task>& subtasks) {
+        auto forward = [this](uint64_t state, auto const& function) { forEachSuccessor(state, function); };
+        auto backward = [this](uint64_t state, auto const& function) { forEachPredecessor(state, function); };
+        uint64_t const remaining = task.partition;
+
+        for (uint64_t pivot : task.states) {
+            if (partition[pivot].load(std::memory_order_relaxed) != remaining) {
+                continue;
+            }
+            if (task.states.size() == 1) {
+                assignSingletonComponent(pivot);
+                break;
+            }
+
+            uint64_t const forwardOnly = nextPartition.fetch_add(3, std::memory_order_relaxed);
+            uint64_t const backwardOnly = forwardOnly + 1;
+            uint64_t const scc = forwardOnly + 2;
+
+            // Move all states that are forward reachable from the pivot to the forward partition.
+            partition[pivot].store(forwardOnly, std::memory_order_relaxed);
+            // Note that we only attempt to claim states (which is relatively expensive) whose partition indicates that this can succeed.
+            std::vector<uint64_t> forwardStates = search({pivot}, parallel, forward, [&](uint64_t state) {
+                uint64_t expected = partition[state].load(std::memory_order_relaxed);
+                return expected == remaining && partition[state].compare_exchange_strong(expected, forwardOnly, std::memory_order_relaxed);
+            });
+
+            // Move the backward reachable states to the SCC (if they are also forward reachable) or the backward partition.
+            partition[pivot].store(scc, std::memory_order_relaxed);
+            std::vector<uint64_t> backwardStates = search({pivot}, parallel, backward, [&](uint64_t state) {
+                uint64_t expected = partition[state].load(std::memory_order_relaxed);
+                if (expected == forwardOnly && partition[state].compare_exchange_strong(expected, scc, std::memory_order_relaxed)) {
+                    return true;
+                }
+                return expected == remaining && partition[state].compare_exchange_strong(expected, backwardOnly, std::memory_order_relaxed);
+            });
+
+            uint64_t const sccIndex = numberOfComponents.fetch_add(1, std::memory_order_relaxed);
+            Task backwardTask{{}, backwardOnly};
+            for (uint64_t state : backwardStates) {
+                if (partition[state].load(std::memory_order_relaxed) == scc) {
+                    component[state] = sccIndex;
+                    partition[state].store(Done, std::memory_order_relaxed);
+                } else {
+                    backwardTask.states.push_back(state);
+                }
+            }
+            Task forwardTask{{}, forwardOnly};
+            for (uint64_t state : forwardStates) {
+                if (partition[state].load(std::memory_order_relaxed) == forwardOnly) {
+                    forwardTask.states.push_back(state);
+                }
+            }
+            for (Task* subtask : {&forwardTask, &backwardTask}) {
+                if (!subtask->states.empty()) {
+                    subtasks.push_back(std::move(*subtask));
+                }
+            }
+        }
+    }
+
+    void processTasks(Task&& initialTask) {
+        // Process the large tasks one after another, each with parallel searches.
+        std::vector<Task> largeTasks, smallTasks, subtasks;
+        largeTasks.push_back(std::move(initialTask));
+        while (!largeTasks.empty()) {
+            Task task = std::move(largeTasks.back());
+            largeTasks.pop_back();
+            processTask(task, true, subtasks);
+            for (auto& subtask : subtasks) {
+                (subtask.states.size() >= LargeTaskSize ? largeTasks : smallTasks).push_back(std::move(subtask));
+            }
+            subtasks.clear();
+        }
+
+        // Process the small tasks concurrently. Starting with the largest ones improves the load balancing.
+        std::sort(smallTasks.begin(), smallTasks.end(), [](Task const& a, Task const& b) { return a.states.size() > b.states.size(); });
+        storm::utility::parallel::forEachChunk(numberOfThreads, smallTasks.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+            std::vector<Task> localTasks;
+            for (uint64_t index = begin; index < end; ++index) {
+                localTasks.push_back(std::move(smallTasks[index]));
+                while (!localTasks.empty()) {
+                    Task task = std::move(localTasks.back());
+                    localTasks.pop_back();
+                    processTask(task, false, localTasks);
+                }
+            }
+        });
+    }
+
+    /*!
+     * Computes the depth of each SCC and renumbers the SCCs such that they are sorted by their depth. SCCs with the same depth are sorted by
+     * their smallest state, which makes the result independent of the thread scheduling.
+     */
+    uint64_t sortTopologically(std::vector<uint_fast64_t>& stateToSccMapping, storm::storage::BitVector& nonTrivialStates,
+                               std::vector<uint_fast64_t>& sccDepths) {
+        uint64_t const componentCount = numberOfComponents.load();
+
+        // Gather the states of each SCC (in ascending order).
+        std::vector<uint64_t> componentIndications(componentCount + 1, 0);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isRelevant(state)) {
+                ++componentIndications[component[state] + 1];
+            }
+        }
+        for (uint64_t index = 0; index < componentCount; ++index) {
+            componentIndications[index + 1] += componentIndications[index];
+        }
+        std::vector<uint64_t> componentStates(componentIndications.back());
+        std::vector<uint64_t> componentsByMinimalState;
+        componentsByMinimalState.reserve(componentCount);
+        {
+            std::vector<uint64_t> positions(componentIndications.begin(), componentIndications.end() - 1);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (isRelevant(state)) {
+                    uint64_t const stateComponent = component[state];
+                    if (positions[stateComponent] == componentIndications[stateComponent]) {
+                        componentsByMinimalState.push_back(stateComponent);
+                    }
+                    componentStates[positions[stateComponent]++] = state;
+                }
+            }
+        }
+
+        // Count the transitions leaving each SCC and peel the SCC graph starting from the bottom SCCs.
+        std::vector<std::atomic<uint64_t>> leavingTransitions(componentCount);
+        storm::utility::parallel::forEachChunk(numberOfThreads, numberOfStates, ChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t state = begin; state < end; ++state) {
+                if (isRelevant(state)) {
+                    uint64_t count = 0;
+                    forEachSuccessor(state, [&](uint64_t successor) { count += component[successor] != component[state] ? 1 : 0; });
+                    if (count > 0) {
+                        leavingTransitions[component[state]].fetch_add(count, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+        std::vector<uint64_t> depths(componentCount);
+        std::vector<std::vector<uint64_t>> localFrontiers(numberOfThreads);
+        std::vector<uint64_t> frontier =
+            collectStates(componentCount, [&](uint64_t index) { return leavingTransitions[index].load(std::memory_order_relaxed) == 0; });
+        for (uint64_t depth = 0; !frontier.empty(); ++depth) {
+            storm::utility::parallel::forEachChunk(numberOfThreads, frontier.size(), ChunkSize, [&](uint64_t thread, uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    uint64_t const currentComponent = frontier[index];
+                    depths[currentComponent] = depth;
+                    for (uint64_t position = componentIndications[currentComponent]; position < componentIndications[currentComponent + 1]; ++position) {
+                        forEachPredecessor(componentStates[position], [&](uint64_t predecessor) {
+                            uint64_t const predecessorComponent = component[predecessor];
+                            if (predecessorComponent != currentComponent &&
+                                leavingTransitions[predecessorComponent].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                                localFrontiers[thread].push_back(predecessorComponent);
+                            }
+                        });
+                    }
+                }
+            });
+            frontier = concatenate(localFrontiers);
+        }
+
+        // Sort the SCCs by their depth (stable w.r.t. the minimal states).
+        uint64_t const maxDepth = componentCount == 0 ? 0 : *std::max_element(depths.begin(), depths.end());
+        std::vector<uint64_t> depthIndications(maxDepth + 2, 0);
+        for (uint64_t depth : depths) {
+            ++depthIndications[depth + 1];
+        }
+        for (uint64_t depth = 0; depth <= maxDepth; ++depth) {
+            depthIndications[depth + 1] += depthIndications[depth];
+        }
+        std::vector<uint64_t> newIndices(componentCount);
+        sccDepths.resize(componentCount);
+        for (uint64_t currentComponent : componentsByMinimalState) {
+            uint64_t const newIndex = depthIndications[depths[currentComponent]]++;
+            newIndices[currentComponent] = newIndex;
+            sccDepths[newIndex] = depths[currentComponent];
+        }
+
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isRelevant(state)) {
+                uint64_t const stateComponent = component[state];
+                stateToSccMapping[state] = newIndices[stateComponent];
+                if (selfLoop[state] || componentIndications[stateComponent + 1] - componentIndications[stateComponent] > 1) {
+                    nonTrivialStates.set(state, true);
+                }
+            }
+        }
+        return componentCount;
+    }
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    std::vector<uint64_t> const& rowGroupIndices;
+    storm::storage::BitVector const* subsystem;
+    storm::storage::BitVector const* choices;
+    uint64_t const numberOfThreads;
+    uint64_t const numberOfStates;
+
+    // The predecessors of each state in compressed row format.
+    std::vector<uint64_t> predecessorIndications;
+    std::vector<uint64_t> predecessors;
+    // Stores for each state whether it has a selfloop. A vector of chars allows concurrent writes to different entries.
+    std::vector<char> selfLoop;
+
+    // The partition (i.e. the subproblem) of each state or Done.
+    std::vector<std::atomic<uint64_t>> partition;
+    // The SCC of each state that is done.
+    std::vector<uint64_t> component;
+    std::atomic<uint64_t> numberOfComponents;
+    std::atomic<uint64_t> nextPartition;
+};
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -179,7 +652,24 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
 
     // Obtain a mapping from states to the SCC it belongs to
     std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+
+    uint64_t numberOfThreads = options.numberOfThreads;
+    if (numberOfThreads == 0) {
+        numberOfThreads = storm::settings::hasModule<storm::settings::modules::CoreSettings>()
+                              ? storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads()
+                              : 1;
+    }
+    uint64_t numberOfConsideredStates = options.subsystemPtr ? options.subsystemPtr->getNumberOfSetBits() : numberOfStates;
+    // Parametric models are always decomposed sequentially as their values are not safe to access concurrently.
+    if (numberOfThreads > 1 && numberOfConsideredStates >= options.parallelStateThreshold && !std::is_same_v<ValueType, storm::RationalFunction>) {
+        std::vector<uint_fast64_t> allSccDepths;
+        ParallelSccSearch<ValueType> search(transitionMatrix, options.subsystemPtr, options.choicesPtr, numberOfThreads);
+        sccCount = search.perform(stateToSccMapping, nonTrivialStates, allSccDepths);
+        sccDepths = boost::none;
+        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+            sccDepths = std::move(allSccDepths);
+        }
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
@@ -50,12 +50,25 @@ struct StronglyConnectedComponentDecompositionOptions {
         return *this;
     }
 
+    /// Sets the number of threads that may be used for the decomposition. If zero, the number of threads is taken from the core settings.
+    StronglyConnectedComponentDecompositionOptions& threads(uint64_t value) {
+        numberOfThreads = value;
+        return *this;
+    }
+    /// Sets the minimal number of (subsystem) states for which the multi-threaded algorithm is used instead of the sequential one.
+    StronglyConnectedComponentDecompositionOptions& parallelThreshold(uint64_t value) {
+        parallelStateThreshold = value;
+        return *this;
+    }
+
     storm::storage::BitVector const* subsystemPtr = nullptr;
     storm::storage::BitVector const* choicesPtr = nullptr;
     bool areNaiveSccsDropped = false;
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t numberOfThreads = 0;
+    uint64_t parallelStateThreshold = 1000000;
 };
 
 /*!
@@ -129,7 +142,8 @@ class StronglyConnectedComponentDecomposition : public Decomposition<StronglyCon
    private:
     /*
      * Performs the SCC decomposition of the given block in the given model. As a side-effect this fills
-     * the vector of blocks of the decomposition.
+     * the vector of blocks of the decomposition. For large systems and more than one thread, a multi-threaded
+     * forward-backward algorithm is used, otherwise the sequential path-based algorithm.
      *
      * @param transitionMatrix The transition matrix of the system to decompose.
      */
@@ -0,0 +1,277 @@
+#include "storm/storage/TreeCompressedBitVectorHashMap.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace storm {
+namespace storage {
+namespace detail {
+
+namespace {
+uint64_t const initialLogNumberOfSlots = 10;
+}  // namespace
+
+IndexedPairTable::IndexedPairTable() : logNumberOfSlots(initialLogNumberOfSlots) {
+    // The slots are only allocated once the first key is inserted, because the leaves of the tree never store keys.
+}
+
+uint64_t IndexedPairTable::findSlot(uint64_t key) const {
+    // Fibonacci hashing spreads the (often very regular) keys over the slots.
+    uint64_t const mask = slots.size() - 1;
+    uint64_t slot = (key * 0x9E3779B97F4A7C15ull) >> (64 - logNumberOfSlots);
+    while (slots[slot] != 0 && keys[slots[slot] - 1] != key) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+std::pair<uint32_t, bool> IndexedPairTable::findOrAdd(uint64_t key) {
+    if (slots.empty()) {
+        slots.assign(1ull << logNumberOfSlots, 0);
+    }
+    uint64_t slot = findSlot(key);
+    if (slots[slot] != 0) {
+        return std::make_pair(slots[slot] - 1, false);
+    }
+    STORM_LOG_THROW(keys.size() < std::numeric_limits<uint32_t>::max() - 1, storm::exceptions::OutOfRangeException,
+                    "Too many distinct entries in a node of the tree-compressed state storage.");
+    uint32_t index = static_cast<uint32_t>(keys.size());
+    keys.push_back(key);
+    slots[slot] = index + 1;
+    // Keep the load of the table below 3/4.
+    if (4 * keys.size() >= 3 * slots.size()) {
+        increaseSize();
+    }
+    return std::make_pair(index, true);
+}
+
+std::pair<bool, uint32_t> IndexedPairTable::find(uint64_t key) const {
+    if (keys.empty()) {
+        return std::make_pair(false, 0u);
+    }
+    uint64_t slot = findSlot(key);
+    if (slots[slot] != 0) {
+        return std::make_pair(true, slots[slot] - 1);
+    }
+    return std::make_pair(false, 0u);
+}
+
+uint64_t IndexedPairTable::getKey(uint32_t index) const {
+    return keys[index];
+}
+
+uint64_t IndexedPairTable::size() const {
+    return keys.size();
+}
+
+std::size_t IndexedPairTable::getSizeInBytes() const {
+    return sizeof(*this) + keys.capacity() * sizeof(uint64_t) + slots.capacity() * sizeof(uint32_t);
+}
+
+void IndexedPairTable::increaseSize() {
+    ++logNumberOfSlots;
+    slots.assign(1ull << logNumberOfSlots, 0);
+    for (uint64_t index = 0; index < keys.size(); ++index) {
+        slots[findSlot(keys[index])] = static_cast<uint32_t>(index + 1);
+    }
+}
+
+}  // namespace detail
+
+namespace {
+uint64_t const bitsPerWord = 32;
+
+uint64_t toKey(uint32_t left, uint32_t right) {
+    return (static_cast<uint64_t>(left) << 32) | right;
+}
+}  // namespace
+
+template<class ValueType>
+TreeCompressedBitVectorHashMap<ValueType>::const_iterator::const_iterator(TreeCompressedBitVectorHashMap const& map, uint64_t index)
+    : map(&map), index(index) {
+    // Intentionally left empty.
+}
+
+template<class ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::const_iterator::operator==(const_iterator const& other) const {
+    return map == other.map && index == other.index;
+}
+
+template<class ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::const_iterator::operator!=(const_iterator const& other) const {
+    return !(*this == other);
+}
+
+template<class ValueType>
+typename TreeCompressedBitVectorHashMap<ValueType>::const_iterator& TreeCompressedBitVectorHashMap<ValueType>::const_iterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<class ValueType>
+std::pair<storm::storage::BitVector, ValueType> TreeCompressedBitVectorHashMap<ValueType>::const_iterator::operator*() const {
+    return map->getBucketAndValue(index);
+}
+
+template<class ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::Node::isLeaf() const {
+    return numberOfWords == 1;
+}
+
+template<class ValueType>
+TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMap(uint64_t keySize) : keySize(keySize) {
+    STORM_LOG_ASSERT(keySize % 64 == 0, "Key size must be a multiple of 64.");
+    // The root always has two children, so the index of a key is always given by the table of the root.
+    createNode(0, std::max<uint64_t>(2, keySize / bitsPerWord));
+}
+
+template<class ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::createNode(uint64_t firstWord, uint64_t numberOfWords) {
+    uint64_t index = nodes.size();
+    nodes.emplace_back();
+    nodes[index].firstWord = firstWord;
+    nodes[index].numberOfWords = numberOfWords;
+    if (numberOfWords > 1) {
+        uint64_t numberOfLeftWords = numberOfWords / 2;
+        uint64_t leftChild = createNode(firstWord, numberOfLeftWords);
+        uint64_t rightChild = createNode(firstWord + numberOfLeftWords, numberOfWords - numberOfLeftWords);
+        nodes[index].leftChild = leftChild;
+        nodes[index].rightChild = rightChild;
+    }
+    return index;
+}
+
+template<class ValueType>
+uint32_t TreeCompressedBitVectorHashMap<ValueType>::getWord(storm::storage::BitVector const& key, uint64_t wordIndex) const {
+    if (wordIndex * bitsPerWord >= keySize) {
+        // This word only exists because the root needs two children.
+        return 0;
+    }
+    return static_cast<uint32_t>(key.getAsInt(wordIndex * bitsPerWord, bitsPerWord));
+}
+
+template<class ValueType>
+std::pair<bool, uint32_t> TreeCompressedBitVectorHashMap<ValueType>::findIndex(uint64_t node, storm::storage::BitVector const& key) const {
+    Node const& currentNode = nodes[node];
+    if (currentNode.isLeaf()) {
+        return std::make_pair(true, getWord(key, currentNode.firstWord));
+    }
+    auto left = findIndex(currentNode.leftChild, key);
+    if (!left.first) {
+        return left;
+    }
+    auto right = findIndex(currentNode.rightChild, key);
+    if (!right.first) {
+        return right;
+    }
+    return currentNode.table.find(toKey(left.second, right.second));
+}
+
+template<class ValueType>
+std::pair<uint32_t, bool> TreeCompressedBitVectorHashMap<ValueType>::findOrAddIndex(uint64_t node, storm::storage::BitVector const& key) {
+    Node& currentNode = nodes[node];
+    if (currentNode.isLeaf()) {
+        return std::make_pair(getWord(key, currentNode.firstWord), false);
+    }
+    uint32_t left = findOrAddIndex(currentNode.leftChild, key).first;
+    uint32_t right = findOrAddIndex(currentNode.rightChild, key).first;
+    return currentNode.table.findOrAdd(toKey(left, right));
+}
+
+template<class ValueType>
+void TreeCompressedBitVectorHashMap<ValueType>::decode(uint64_t node, uint32_t index, storm::storage::BitVector& key) const {
+    Node const& currentNode = nodes[node];
+    if (currentNode.isLeaf()) {
+        if (currentNode.firstWord * bitsPerWord < keySize) {
+            key.setFromInt(currentNode.firstWord * bitsPerWord, bitsPerWord, index);
+        }
+        return;
+    }
+    uint64_t pair = currentNode.table.getKey(index);
+    decode(currentNode.leftChild, static_cast<uint32_t>(pair >> 32), key);
+    decode(currentNode.rightChild, static_cast<uint32_t>(pair), key);
+}
+
+template<class ValueType>
+ValueType TreeCompressedBitVectorHashMap<ValueType>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<class ValueType>
+std::pair<ValueType, uint64_t> TreeCompressedBitVectorHashMap<ValueType>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                               ValueType const& value) {
+    STORM_LOG_ASSERT(key.size() == keySize, "Size of bit vector and size of keys do not match");
+    auto indexAndFlag = findOrAddIndex(0, key);
+    if (indexAndFlag.second) {
+        values.push_back(value);
+    }
+    return std::make_pair(values[indexAndFlag.first], indexAndFlag.first);
+}
+
+template<class ValueType>
+std::pair<storm::storage::BitVector, ValueType> TreeCompressedBitVectorHashMap<ValueType>::getBucketAndValue(uint64_t bucket) const {
+    storm::storage::BitVector key(keySize);
+    decode(0, static_cast<uint32_t>(bucket), key);
+    return std::make_pair(std::move(key), values[bucket]);
+}
+
+template<class ValueType>
+ValueType TreeCompressedBitVectorHashMap<ValueType>::getValue(storm::storage::BitVector const& key) const {
+    auto flagAndIndex = findIndex(0, key);
+    STORM_LOG_ASSERT(flagAndIndex.first, "Unknown key.");
+    return values[flagAndIndex.second];
+}
+
+template<class ValueType>
+boost::optional<ValueType> TreeCompressedBitVectorHashMap<ValueType>::find(storm::storage::BitVector const& key) const {
+    auto flagAndIndex = findIndex(0, key);
+    if (flagAndIndex.first) {
+        return values[flagAndIndex.second];
+    }
+    return boost::none;
+}
+
+template<class ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::contains(storm::storage::BitVector const& key) const {
+    return findIndex(0, key).first;
+}
+
+template<class ValueType>
+typename TreeCompressedBitVectorHashMap<ValueType>::const_iterator TreeCompressedBitVectorHashMap<ValueType>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<class ValueType>
+typename TreeCompressedBitVectorHashMap<ValueType>::const_iterator TreeCompressedBitVectorHashMap<ValueType>::end() const {
+    return const_iterator(*this, values.size());
+}
+
+template<class ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::size() const {
+    return values.size();
+}
+
+template<class ValueType>
+void TreeCompressedBitVectorHashMap<ValueType>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (auto& value : values) {
+        value = remapping(value);
+    }
+}
+
+template<class ValueType>
+std::size_t TreeCompressedBitVectorHashMap<ValueType>::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + values.capacity() * sizeof(ValueType);
+    for (auto const& node : nodes) {
+        result += node.table.getSizeInBytes();
+    }
+    return result;
+}
+
+template class TreeCompressedBitVectorHashMap<uint32_t>;
+template class TreeCompressedBitVectorHashMap<uint64_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+namespace detail {
+
+/*!
+ * A hash set of 64-bit keys that assigns consecutive indices (starting at zero) to the keys in the order in which they are inserted.
+ */
+class IndexedPairTable {
+   public:
+    IndexedPairTable();
+
+    /*!
+     * Retrieves the index of the given key, inserting the key if it is not yet contained.
+     *
+     * @return The index of the key and a flag that indicates whether the key was inserted.
+     */
+    std::pair<uint32_t, bool> findOrAdd(uint64_t key);
+
+    /*!
+     * Retrieves the index of the given key (if it is contained).
+     */
+    std::pair<bool, uint32_t> find(uint64_t key) const;
+
+    /*!
+     * Retrieves the key with the given index.
+     */
+    uint64_t getKey(uint32_t index) const;
+
+    uint64_t size() const;
+    std::size_t getSizeInBytes() const;
+
+   private:
+    // Retrieves the slot that holds the given key or the empty slot at which the key is to be inserted.
+    uint64_t findSlot(uint64_t key) const;
+    void increaseSize();
+
+    // The keys in the order of their indices.
+    std::vector<uint64_t> keys;
+    // The hash table. A slot is either zero (empty) or holds the index of a key plus one.
+    std::vector<uint32_t> slots;
+    uint64_t logNumberOfSlots;
+};
+
+}  // namespace detail
+
+/*!
+ * A hash map whose keys are bit vectors of a fixed length that stores the keys using tree compression (as in LTSmin). The keys are split
+ * into 32-bit words, which are the leaves of a balanced binary tree. Each inner node of the tree has a table storing the distinct pairs of
+ * indices of its children that have occurred so far. A key is then represented by the index of the pair at the root. As the parts of
+ * the keys (e.g. the values of the variables of an automaton) are typically shared among many keys, this requires considerably less
+ * memory than storing every key individually.
+ *
+ * The interface matches the one of BitVectorHashMap. The buckets of this map are the indices of the keys, which are assigned
+ * consecutively in the order in which the keys are inserted.
+ */
+template<class ValueType>
+class TreeCompressedBitVectorHashMap {
+   public:
+    class const_iterator {
+       public:
+        const_iterator(TreeCompressedBitVectorHashMap const& map, uint64_t index);
+
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+        const_iterator& operator++();
+
+        // Retrieves the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        TreeCompressedBitVectorHashMap const* map;
+        uint64_t index;
+    };
+
+    /*!
+     * Creates a new hash map for keys of the given length.
+     *
+     * @param keySize The number of bits of the keys. This value must be a multiple of 64.
+     */
+    TreeCompressedBitVectorHashMap(uint64_t keySize = 64);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned together with the bucket of the key.
+     * Otherwise, the key is inserted with the given value.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
+     */
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is undefined.
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any).
+     */
+    boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the number of keys stored in the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+    /*!
+     * Retrieves the number of bytes that the keys and values occupy in memory.
+     */
+    std::size_t getSizeInBytes() const;
+
+   private:
+    /*!
+     * A node of the tree that covers a consecutive range of words of the keys.
+     */
+    struct Node {
+        uint64_t firstWord;
+        uint64_t numberOfWords;
+        // The indices of the children in the node vector (only for inner nodes).
+        uint64_t leftChild;
+        uint64_t rightChild;
+        // The pairs of the indices of the children (only for inner nodes).
+        detail::IndexedPairTable table;
+
+        bool isLeaf() const;
+    };
+
+    // Creates the node covering the given words (and its children) and returns its index.
+    uint64_t createNode(uint64_t firstWord, uint64_t numberOfWords);
+
+    // Retrieves the word of the key with the given index.
+    uint32_t getWord(storm::storage::BitVector const& key, uint64_t wordIndex) const;
+
+    // Retrieves the index of the given key in the subtree of the given node, inserting it if requested.
+    std::pair<bool, uint32_t> findIndex(uint64_t node, storm::storage::BitVector const& key) const;
+    std::pair<uint32_t, bool> findOrAddIndex(uint64_t node, storm::storage::BitVector const& key);
+
+    // Writes the words represented by the given index in the subtree of the given node to the given bit vector.
+    void decode(uint64_t node, uint32_t index, storm::storage::BitVector& key) const;
+
+    uint64_t keySize;
+    std::vector<Node> nodes;
+    std::vector<ValueType> values;
+};
+
+}  // namespace storage
+}  // namespace storm
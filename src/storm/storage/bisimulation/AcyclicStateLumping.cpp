@@ -0,0 +1,192 @@
+#include "storm/storage/bisimulation/AcyclicStateLumping.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ModelType>
+std::shared_ptr<ModelType> lumpAcyclicStates(ModelType const& model) {
+    typedef typename ModelType::ValueType ValueType;
+    typedef typename ModelType::RewardModelType RewardModelType;
+    STORM_LOG_THROW(model.getTransitionMatrix().hasTrivialRowGrouping(), storm::exceptions::IllegalArgumentException,
+                    "Lumping of acyclic states requires a deterministic model.");
+    for (auto const& nameRewardModelPair : model.getRewardModels()) {
+        STORM_LOG_THROW(!nameRewardModelPair.second.hasTransitionRewards(), storm::exceptions::IllegalArgumentException,
+                        "Lumping of acyclic states does not support transition rewards.");
+    }
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+    uint64_t numberOfStates = model.getNumberOfStates();
+
+    // Two states can only be merged if they carry the same labels. The sets of labels are numbered consecutively.
+    std::set<std::string> labels = model.getStateLabeling().getLabels();
+    std::vector<storm::storage::BitVector const*> labelStates;
+    for (auto const& label : labels) {
+        labelStates.push_back(&model.getStateLabeling().getStates(label));
+    }
+    std::map<std::vector<uint64_t>, uint64_t> labelSetToIndex;
+    std::vector<uint64_t> labelSetOfState(numberOfStates);
+    std::vector<uint64_t> labelSet;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        labelSet.clear();
+        for (uint64_t labelIndex = 0; labelIndex < labelStates.size(); ++labelIndex) {
+            if (labelStates[labelIndex]->get(state)) {
+                labelSet.push_back(labelIndex);
+            }
+        }
+        labelSetOfState[state] = labelSetToIndex.emplace(labelSet, labelSetToIndex.size()).first->second;
+    }
+
+    // The signature of an acyclic state consists of its labels, its rewards and its distribution over the blocks of its successors.
+    typedef std::tuple<uint64_t, std::vector<ValueType>, std::vector<std::pair<uint64_t, ValueType>>> Signature;
+    std::map<Signature, uint64_t> signatureToBlock;
+    std::vector<uint64_t> stateToBlock(numberOfStates);
+    std::vector<uint64_t> representatives;
+
+    // Retrieves the distribution of the given state over the blocks of its successors, which need to be known already.
+    std::vector<std::pair<uint64_t, ValueType>> distribution;
+    auto computeDistribution = [&](uint64_t state) {
+        distribution.clear();
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            if (!storm::utility::isZero(entry.getValue())) {
+                distribution.emplace_back(stateToBlock[entry.getColumn()], entry.getValue());
+            }
+        }
+        std::sort(distribution.begin(), distribution.end(),
+                  [](std::pair<uint64_t, ValueType> const& first, std::pair<uint64_t, ValueType> const& second) { return first.first < second.first; });
+        // Sum up the entries that lead to the same block.
+        auto targetIt = distribution.begin();
+        for (auto entryIt = distribution.begin(); entryIt != distribution.end(); ++entryIt) {
+            if (targetIt != distribution.begin() && std::prev(targetIt)->first == entryIt->first) {
+                std::prev(targetIt)->second += entryIt->second;
+            } else {
+                *targetIt = *entryIt;
+                ++targetIt;
+            }
+        }
+        distribution.erase(targetIt, distribution.end());
+    };
+
+    // The SCCs are sorted topologically, i.e. the successors of the states of an SCC are contained in the same or a previous SCC.
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<ValueType> rewards;
+    for (auto const& scc : sccDecomposition) {
+        uint64_t state = *scc.begin();
+        bool acyclic = scc.size() == 1;
+        if (acyclic) {
+            for (auto const& entry : transitionMatrix.getRow(state)) {
+                if (entry.getColumn() == state && !storm::utility::isZero(entry.getValue())) {
+                    acyclic = false;
+                    break;
+                }
+            }
+        }
+
+        if (!acyclic) {
+            // States on a cycle are not lumped.
+            for (auto sccState : scc) {
+                stateToBlock[sccState] = representatives.size();
+                representatives.push_back(sccState);
+            }
+            continue;
+        }
+
+        rewards.clear();
+        for (auto const& nameRewardModelPair : model.getRewardModels()) {
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                rewards.push_back(nameRewardModelPair.second.getStateReward(state));
+            }
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                rewards.push_back(nameRewardModelPair.second.getStateActionReward(state));
+            }
+        }
+        computeDistribution(state);
+        auto signatureBlockPair = signatureToBlock.emplace(Signature(labelSetOfState[state], rewards, distribution), representatives.size());
+        stateToBlock[state] = signatureBlockPair.first->second;
+        if (signatureBlockPair.second) {
+            representatives.push_back(state);
+        }
+    }
+    // The signatures are not needed anymore, so we free their memory before building the lumped model.
+    signatureToBlock.clear();
+    STORM_LOG_INFO("Lumping of acyclic states reduced the model from " << numberOfStates << " to " << representatives.size() << " states.");
+
+    // Build the lumped model from the representatives of the blocks.
+    uint64_t numberOfBlocks = representatives.size();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfBlocks, numberOfBlocks);
+    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+        computeDistribution(representatives[block]);
+        for (auto const& entry : distribution) {
+            builder.addNextValue(block, entry.first, entry.second);
+        }
+    }
+
+    storm::models::sparse::StateLabeling newLabeling(numberOfBlocks);
+    uint64_t labelIndex = 0;
+    for (auto const& label : labels) {
+        storm::storage::BitVector newStates(numberOfBlocks);
+        for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+            newStates.set(block, labelStates[labelIndex]->get(representatives[block]));
+        }
+        newLabeling.addLabel(label, std::move(newStates));
+        ++labelIndex;
+    }
+
+    std::unordered_map<std::string, RewardModelType> rewardModels;
+    for (auto const& nameRewardModelPair : model.getRewardModels()) {
+        std::optional<std::vector<ValueType>> stateRewards;
+        std::optional<std::vector<ValueType>> stateActionRewards;
+        if (nameRewardModelPair.second.hasStateRewards()) {
+            stateRewards = std::vector<ValueType>(numberOfBlocks);
+            for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+                stateRewards.value()[block] = nameRewardModelPair.second.getStateReward(representatives[block]);
+            }
+        }
+        if (nameRewardModelPair.second.hasStateActionRewards()) {
+            stateActionRewards = std::vector<ValueType>(numberOfBlocks);
+            for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+                stateActionRewards.value()[block] = nameRewardModelPair.second.getStateActionReward(representatives[block]);
+            }
+        }
+        rewardModels.emplace(nameRewardModelPair.first, RewardModelType(std::move(stateRewards), std::move(stateActionRewards)));
+    }
+
+    return std::make_shared<ModelType>(builder.build(), std::move(newLabeling), std::move(rewardModels));
+}
+
+template std::shared_ptr<storm::models::sparse::Dtmc<double>> lumpAcyclicStates(storm::models::sparse::Dtmc<double> const& model);
+template std::shared_ptr<storm::models::sparse::Ctmc<double>> lumpAcyclicStates(storm::models::sparse::Ctmc<double> const& model);
+
+#ifdef STORM_HAVE_CARL
+template std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalNumber>> lumpAcyclicStates(storm::models::sparse::Dtmc<storm::RationalNumber> const& model);
+template std::shared_ptr<storm::models::sparse::Ctmc<storm::RationalNumber>> lumpAcyclicStates(storm::models::sparse::Ctmc<storm::RationalNumber> const& model);
+
+template std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> lumpAcyclicStates(
+    storm::models::sparse::Dtmc<storm::RationalFunction> const& model);
+template std::shared_ptr<storm::models::sparse::Ctmc<storm::RationalFunction>> lumpAcyclicStates(
+    storm::models::sparse::Ctmc<storm::RationalFunction> const& model);
+#endif
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Lumps the states of the given deterministic model (DTMC or CTMC) that do not lie on a cycle in one bottom-up pass.
+ *
+ * The SCCs of the model are processed in topological order, starting with the bottom SCCs. Every state of a
+ * non-trivial SCC (including states with a self-loop) forms its own block. Every other state is put in the block of an
+ * already processed state with the same labels, the same rewards and the same (exact) distribution over the blocks of
+ * the successors. Since two states are only merged if they are bisimilar, the resulting model is strongly bisimilar to
+ * the given one and preserves all labels and reward models. As the lumping neither requires the backward transitions
+ * nor a partition refinement, it may be applied as a cheap first phase before the regular bisimulation, which then only
+ * operates on the (typically much smaller) lumped model.
+ *
+ * @param model The model whose acyclic states to lump. It must not have transition rewards.
+ * @return The lumped model.
+ */
+template<typename ModelType>
+std::shared_ptr<ModelType> lumpAcyclicStates(ModelType const& model);
+
+}  // namespace storage
+}  // namespace storm
@@ -25,6 +25,7 @@
 
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/tracing.h"
 
 namespace storm {
 namespace storage {
@@ -60,6 +61,7 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -256,6 +258,7 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    STORM_TRACE_ZONE("bisimulation refinement");
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -278,7 +281,11 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
         splitter->data().setSplitter(false);
 
         // Now refine the partition using the current splitter.
-        refinePartitionBasedOnSplitter(*splitter, splitterQueue);
+        {
+            STORM_TRACE_ZONE("refine partition based on splitter");
+            STORM_TRACE_ZONE_VALUE(splitter->getNumberOfStates());
+            refinePartitionBasedOnSplitter(*splitter, splitterQueue);
+        }
 
         if (storm::utility::resources::isTerminate()) {
             std::cout << "Performed " << iterations << " iterations of partition refinement before abort.\n";
@@ -350,6 +357,15 @@ void BisimulationDecomposition<ModelType, BlockDataType>::initializeLabelBasedPa
     if (options.getKeepRewards() && model.hasRewardModel()) {
         this->splitInitialPartitionBasedOnRewards();
     }
+
+    if (options.initialStateBlocks) {
+        std::vector<uint_fast64_t> const& initialStateBlocks = options.initialStateBlocks.get();
+        STORM_LOG_THROW(initialStateBlocks.size() == model.getNumberOfStates(), storm::exceptions::InvalidOptionException,
+                        "The given initial blocks do not match the number of states of the model.");
+        partition.split([&initialStateBlocks](storm::storage::sparse::state_type a, storm::storage::sparse::state_type b) {
+            return initialStateBlocks[a] < initialStateBlocks[b];
+        });
+    }
 }
 
 template<typename ModelType, typename BlockDataType>
@@ -123,9 +123,18 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// respected and which may be ignored. If not given, all atomic propositions of the model are respected.
         boost::optional<std::set<std::string>> respectedAtomicPropositions;
 
+        /// An optional assignment of states to blocks. If given, the label-based initial partition is split such that states with
+        /// different blocks never share a block. This lets the refinement start from a partition that is known to be coarser than the
+        /// bisimulation, e.g., the bisimulation of the model that only respects some of the atomic propositions.
+        boost::optional<std::vector<uint_fast64_t>> initialStateBlocks;
+
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// The number of threads used for the partition refinement. If this is not one, the strong bisimulation of deterministic models is
+        /// computed by a signature-based refinement that processes all states in parallel. Value 0 uses all hardware threads.
+        uint64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -206,7 +215,7 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      * bisimulation equivalence. If required, the quotient model is built and may be retrieved using
      * getQuotient().
      */
-    void performPartitionRefinement();
+    virtual void performPartitionRefinement();
 
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
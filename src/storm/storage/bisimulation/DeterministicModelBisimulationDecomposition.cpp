@@ -13,11 +13,14 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
@@ -592,6 +595,135 @@ void DeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBase
     }
 }
 
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::performPartitionRefinement() {
+    uint64_t numberOfThreads =
+        this->options.numberOfThreads == 0 ? storm::utility::parallel::getNumberOfHardwareThreads() : this->options.numberOfThreads;
+    if (numberOfThreads == 1 || this->options.getType() != BisimulationType::Strong) {
+        STORM_LOG_WARN_COND(numberOfThreads == 1, "Parallel partition refinement is only available for strong bisimulation. Using sequential refinement.");
+        BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement();
+        return;
+    }
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Arithmetic on rational functions is not thread-safe.
+        STORM_LOG_WARN("Parallel partition refinement is not supported for parametric models. Using a single thread.");
+        numberOfThreads = 1;
+    }
+    performSignatureBasedPartitionRefinement(numberOfThreads);
+}
+
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::performSignatureBasedPartitionRefinement(uint64_t numberOfThreads) {
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = this->model.getTransitionMatrix();
+    uint64_t numberOfStates = this->model.getNumberOfStates();
+    uint64_t stateChunkSize = std::max<uint64_t>(1024, numberOfStates / (16 * numberOfThreads));
+
+    // The signature of a state has at most as many entries as its row, so we store it in the slots of the row.
+    std::vector<std::pair<uint64_t, ValueType>> signatureEntries(transitionMatrix.getEntryCount());
+    std::vector<uint64_t> signatureBegins(numberOfStates);
+    std::vector<uint64_t> signatureEnds(numberOfStates);
+    for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+        signatureBegins[state] = std::distance(transitionMatrix.begin(), transitionMatrix.begin(state));
+    }
+
+    // Signatures are ordered lexicographically. Probabilities are compared using the comparator, just like in the splitter-based refinement.
+    auto signatureLess = [&](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+        auto it1 = signatureEntries.cbegin() + signatureBegins[state1], ite1 = signatureEntries.cbegin() + signatureEnds[state1];
+        auto it2 = signatureEntries.cbegin() + signatureBegins[state2], ite2 = signatureEntries.cbegin() + signatureEnds[state2];
+        for (; it1 != ite1 && it2 != ite2; ++it1, ++it2) {
+            if (it1->first != it2->first) {
+                return it1->first < it2->first;
+            }
+            if (this->comparator.isLess(it1->second, it2->second)) {
+                return true;
+            }
+            if (this->comparator.isLess(it2->second, it1->second)) {
+                return false;
+            }
+        }
+        return it1 == ite1 && it2 != ite2;
+    };
+
+    uint64_t rounds = 0;
+    bool refined = true;
+    while (refined) {
+        ++rounds;
+
+        // (1) Compute the signatures of all states wrt. the current partition. States in blocks that do not need to be refined get an empty signature.
+        storm::utility::parallel::forEachChunk(numberOfThreads, numberOfStates, stateChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (storm::storage::sparse::state_type state = begin; state < end; ++state) {
+                auto signatureIt = signatureEntries.begin() + signatureBegins[state];
+                auto signatureIte = signatureIt;
+                if (possiblyNeedsRefinement(this->partition.getBlock(state))) {
+                    for (auto const& entry : transitionMatrix.getRow(state)) {
+                        *signatureIte = std::make_pair(static_cast<uint64_t>(this->partition.getBlock(entry.getColumn()).getId()), entry.getValue());
+                        ++signatureIte;
+                    }
+                    std::sort(signatureIt, signatureIte, [](auto const& entry1, auto const& entry2) { return entry1.first < entry2.first; });
+
+                    // Accumulate the values of entries leading to the same block.
+                    auto writeIt = signatureIt;
+                    for (auto readIt = signatureIt; readIt != signatureIte; ++readIt) {
+                        if (writeIt != signatureIt && std::prev(writeIt)->first == readIt->first) {
+                            std::prev(writeIt)->second += readIt->second;
+                        } else {
+                            if (writeIt != readIt) {
+                                *writeIt = std::move(*readIt);
+                            }
+                            ++writeIt;
+                        }
+                    }
+                    signatureIte = writeIt;
+                }
+                signatureEnds[state] = std::distance(signatureEntries.begin(), signatureIte);
+            }
+        });
+
+        // (2) Sort the states of every block according to their signatures and determine the positions at which the block needs to be split.
+        // As the blocks occupy disjoint ranges of the partition, they can be sorted in parallel.
+        uint64_t numberOfBlocks = this->partition.size();
+        std::vector<std::vector<storm::storage::sparse::state_type>> splitPositions(numberOfBlocks);
+        uint64_t blockChunkSize = std::max<uint64_t>(1, numberOfBlocks / (64 * numberOfThreads));
+        storm::utility::parallel::forEachChunk(numberOfThreads, numberOfBlocks, blockChunkSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t blockIndex = begin; blockIndex < end; ++blockIndex) {
+                Block<BlockDataType>& block = *this->partition.getBlocks()[blockIndex];
+                if (!possiblyNeedsRefinement(block)) {
+                    continue;
+                }
+                auto stateIt = this->partition.begin(block);
+                auto stateIte = this->partition.end(block);
+                std::sort(stateIt, stateIte, signatureLess);
+                this->partition.mapStatesToPositions(block);
+
+                for (auto it = stateIt; it != stateIte;) {
+                    auto upperBound = std::upper_bound(it, stateIte, *it, signatureLess);
+                    if (upperBound != stateIte) {
+                        splitPositions[blockIndex].push_back(block.getBeginIndex() + std::distance(stateIt, upperBound));
+                    }
+                    it = upperBound;
+                }
+            }
+        });
+
+        // (3) Perform the splits. Every split moves the states in front of the split position to a new block.
+        refined = false;
+        for (uint64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+            Block<BlockDataType>& block = *this->partition.getBlocks()[blockIndex];
+            for (auto position : splitPositions[blockIndex]) {
+                auto result = this->partition.splitBlock(block, position);
+                (*result.first)->data().setHasRewards(block.data().hasRewards());
+                refined = true;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << rounds << " rounds of partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based partition refinement converged after " << rounds << " rounds with " << this->partition.size() << " blocks.");
+}
+
 template<typename ModelType>
 void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
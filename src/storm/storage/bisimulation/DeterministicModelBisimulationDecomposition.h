@@ -36,6 +36,8 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
 
     virtual void buildQuotient() override;
 
+    virtual void performPartitionRefinement() override;
+
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
@@ -50,6 +52,15 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     void refinePredecessorBlocksOfSplitterStrong(std::list<bisimulation::Block<BlockDataType>*> const& predecessorBlocks,
                                                  std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue);
 
+    /*!
+     * Refines the partition wrt. strong bisimulation by repeatedly splitting all blocks based on the signatures of their states. A signature
+     * maps each block of the current partition to the probability (or rate) of moving there. In each round, the signatures of all states are
+     * computed in parallel and then all blocks are split in parallel by sorting their states according to their signatures.
+     *
+     * @param numberOfThreads The number of threads to use.
+     */
+    void performSignatureBasedPartitionRefinement(uint64_t numberOfThreads);
+
     /*!
      * Performs the necessary steps to compute a weak bisimulation on a DTMC.
      */
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace storm {
+namespace storage {
+namespace bisimulation {
+
+/*!
+ * The information preserved by a bisimulation of a sparse model, i.e., the respected atomic propositions and whether the (unique)
+ * reward model is respected.
+ */
+struct SparsePreservationInformation {
+    std::set<std::string> atomicPropositions;
+    bool rewards = false;
+
+    /*!
+     * @return True iff all information preserved by this object is also preserved by the given one.
+     */
+    bool isIncludedIn(SparsePreservationInformation const& other) const {
+        return (!rewards || other.rewards) &&
+               std::includes(other.atomicPropositions.begin(), other.atomicPropositions.end(), atomicPropositions.begin(), atomicPropositions.end());
+    }
+
+    /*!
+     * @return A measure for the amount of preserved information.
+     */
+    uint64_t getSize() const {
+        return atomicPropositions.size() + (rewards ? 1 : 0);
+    }
+};
+
+/*!
+ * A cache of the partitions computed by bisimulation decompositions that allows to reuse them across several decompositions of the same
+ * model, e.g., for batches of properties. The partitions are stored together with the information they preserve.
+ *
+ * The coarsest bisimulation that preserves some information refines the coarsest bisimulation of any part of this information. Hence, a
+ * decomposition may start from the cached partition that preserves the largest part of the required information (and nothing else) and
+ * only needs to refine it with respect to the missing information. Partitions that preserve more than required are not used as this
+ * would yield a quotient that is not minimal.
+ *
+ * Models are identified by their address and the cache does not keep them alive.
+ *
+ * @tparam PreservationType The type of the preserved information. It needs to provide the methods isIncludedIn and getSize (see
+ * SparsePreservationInformation).
+ * @tparam PartitionType The type of the cached partitions.
+ */
+template<typename PreservationType, typename PartitionType>
+class PartitionCache {
+   public:
+    struct Entry {
+        PreservationType preservationInformation;
+        PartitionType partition;
+    };
+
+    /*!
+     * Retrieves the cached partition of the given model that preserves the largest part of the given information among the cached
+     * partitions that preserve nothing else.
+     *
+     * @return The entry of the partition or null if there is no such partition.
+     */
+    std::shared_ptr<Entry const> find(std::shared_ptr<void const> const& model, PreservationType const& preservationInformation) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<Entry const> result;
+        for (auto const& modelAndEntry : entries) {
+            if (modelAndEntry.first.lock() == model && modelAndEntry.second->preservationInformation.isIncludedIn(preservationInformation) &&
+                (!result || result->preservationInformation.getSize() < modelAndEntry.second->preservationInformation.getSize())) {
+                result = modelAndEntry.second;
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Stores the given partition of the given model. A cached partition of the model that preserves the same information is replaced.
+     */
+    void insert(std::shared_ptr<void const> const& model, PreservationType preservationInformation, PartitionType partition) {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Drop the partitions of models that no longer exist as well as the one that is replaced.
+        auto isObsolete = [&model, &preservationInformation](std::pair<std::weak_ptr<void const>, std::shared_ptr<Entry const>> const& modelAndEntry) {
+            std::shared_ptr<void const> entryModel = modelAndEntry.first.lock();
+            PreservationType const& entryPreservationInformation = modelAndEntry.second->preservationInformation;
+            return !entryModel || (entryModel == model && entryPreservationInformation.isIncludedIn(preservationInformation) &&
+                                   preservationInformation.isIncludedIn(entryPreservationInformation));
+        };
+        entries.erase(std::remove_if(entries.begin(), entries.end(), isObsolete), entries.end());
+        entries.emplace_back(model, std::make_shared<Entry const>(Entry{std::move(preservationInformation), std::move(partition)}));
+    }
+
+    /*!
+     * @return The number of cached partitions.
+     */
+    uint64_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    /*!
+     * Removes all cached partitions.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+    }
+
+   private:
+    mutable std::mutex mutex;
+    std::vector<std::pair<std::weak_ptr<void const>, std::shared_ptr<Entry const>>> entries;
+};
+
+/*!
+ * The cache for bisimulations of sparse models, which stores for each state the index of its block.
+ */
+typedef PartitionCache<SparsePreservationInformation, std::vector<uint_fast64_t>> SparsePartitionCache;
+
+}  // namespace bisimulation
+}  // namespace storage
+}  // namespace storm
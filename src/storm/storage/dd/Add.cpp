@@ -1145,6 +1145,11 @@ void Add<LibraryType, ValueType>::exportToText(std::string const& filename) cons
     internalAdd.exportToText(filename);
 }
 
+template<DdType LibraryType, typename ValueType>
+void Add<LibraryType, ValueType>::exportToBinary(std::ostream& out) const {
+    internalAdd.exportToBinary(out);
+}
+
 template<DdType LibraryType, typename ValueType>
 AddIterator<LibraryType, ValueType> Add<LibraryType, ValueType>::begin(bool enumerateDontCareMetaVariables) const {
     uint_fast64_t numberOfDdVariables = 0;
@@ -1183,6 +1188,14 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::fromVector(DdManager<Li
                                        metaVariables);
 }
 
+template<DdType LibraryType, typename ValueType>
+Add<LibraryType, ValueType> Add<LibraryType, ValueType>::fromBinary(DdManager<LibraryType> const& ddManager, std::istream& in,
+                                                                    std::set<storm::expressions::Variable> const& metaVariables,
+                                                                    std::vector<uint_fast64_t> const& ddVariableIndexMapping) {
+    return Add<LibraryType, ValueType>(
+        ddManager, InternalAdd<LibraryType, ValueType>::fromBinary(ddManager.getInternalDdManagerPointer(), in, ddVariableIndexMapping), metaVariables);
+}
+
 template<DdType LibraryType, typename ValueType>
 Bdd<LibraryType> Add<LibraryType, ValueType>::toBdd() const {
     return this->notZero();
@@ -2,6 +2,7 @@
 #define STORM_STORAGE_DD_ADD_H_
 
 #include <functional>
+#include <iostream>
 #include <map>
 
 #include "storm/storage/dd/Dd.h"
@@ -60,6 +61,19 @@ class Add : public Dd<LibraryType> {
     static Add<LibraryType, ValueType> fromVector(DdManager<LibraryType> const& ddManager, std::vector<ValueType> const& values, Odd const& odd,
                                                   std::set<storm::expressions::Variable> const& metaVariables);
 
+    /*!
+     * Reads an ADD that was written by exportToBinary.
+     *
+     * @param ddManager The manager responsible for the ADD.
+     * @param in The stream to read from. Should be opened in binary mode.
+     * @param metaVariables The meta variables contained in the ADD.
+     * @param ddVariableIndexMapping Maps the indices of the DD variables in the stream to the indices of the DD variables in the manager.
+     * @return The resulting ADD.
+     */
+    static Add<LibraryType, ValueType> fromBinary(DdManager<LibraryType> const& ddManager, std::istream& in,
+                                                  std::set<storm::expressions::Variable> const& metaVariables,
+                                                  std::vector<uint_fast64_t> const& ddVariableIndexMapping);
+
     /*!
      * Retrieves whether the two DDs represent the same function.
      *
@@ -743,6 +757,14 @@ class Add : public Dd<LibraryType> {
 
     virtual void exportToText(std::string const& filename) const override;
 
+    /*!
+     * Writes the DD as a node table over the indices of the DD variables to the given stream. Contrary to the other export functions,
+     * the DD can be read again using fromBinary.
+     *
+     * @param out The stream to write to. Should be opened in binary mode.
+     */
+    void exportToBinary(std::ostream& out) const;
+
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+namespace binary {
+
+/*
+ * Helpers for the binary encoding of decision diagrams (see Add::exportToBinary).
+ *
+ * A DD is stored as a node table: the number of nodes followed by the nodes in post-order, i.e., every node comes after its successors
+ * and the root is the last node. A leaf is stored as LeafMarker followed by its value, an inner node is stored as the index of its DD
+ * variable followed by the positions of its else- and then-successor in the table. Numbers are stored in the byte order of the machine
+ * that wrote them.
+ */
+
+/// Marks a leaf in the node table, as no DD variable has this index.
+uint64_t constexpr LeafMarker = ~static_cast<uint64_t>(0);
+
+inline void writeUint64(std::ostream& out, uint64_t value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+inline uint64_t readUint64(std::istream& in) {
+    uint64_t value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of binary DD encoding.");
+    return value;
+}
+
+inline void writeString(std::ostream& out, std::string const& value) {
+    writeUint64(out, value.size());
+    out.write(value.data(), value.size());
+}
+
+inline std::string readString(std::istream& in) {
+    std::string value(readUint64(in), '\0');
+    in.read(&value[0], value.size());
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of binary DD encoding.");
+    return value;
+}
+
+/*!
+ * Writes the given value of a leaf. Doubles and integers are written as they are stored in memory, rational numbers as strings.
+ */
+template<typename ValueType>
+void writeValue(std::ostream& out, ValueType const& value) {
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, uint_fast64_t>::value) {
+        out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+    } else if constexpr (std::is_same<ValueType, storm::RationalNumber>::value) {
+        writeString(out, storm::utility::to_string(value));
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary encoding of DDs does not support values of this type.");
+    }
+}
+
+template<typename ValueType>
+ValueType readValue(std::istream& in) {
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, uint_fast64_t>::value) {
+        ValueType value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of binary DD encoding.");
+        return value;
+    } else if constexpr (std::is_same<ValueType, storm::RationalNumber>::value) {
+        return storm::utility::convertNumber<storm::RationalNumber>(readString(in));
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary encoding of DDs does not support values of this type.");
+    }
+}
+
+}  // namespace binary
+}  // namespace dd
+}  // namespace storm
@@ -70,17 +70,32 @@ BisimulationDecomposition<DdType, ValueType, ExportValueType>::BisimulationDecom
     this->initialize();
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+BisimulationDecomposition<DdType, ValueType, ExportValueType>::BisimulationDecomposition(
+    storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialPartition,
+    bisimulation::PreservationInformation<DdType, ValueType> const& initialPreservationInformation,
+    bisimulation::PreservationInformation<DdType, ValueType> const& preservationInformation)
+    : model(model), preservationInformation(preservationInformation), refiner(createRefiner(model, initialPartition)) {
+    std::set<storm::expressions::Expression> const& initialExpressions = initialPreservationInformation.getExpressions();
+    for (auto const& expression : preservationInformation.getExpressions()) {
+        if (initialExpressions.find(expression) == initialExpressions.end()) {
+            refiner->refineWrtStates(model.getStates(expression));
+        }
+    }
+    this->initialize(initialPreservationInformation.getRewardModelNames());
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 BisimulationDecomposition<DdType, ValueType, ExportValueType>::~BisimulationDecomposition() = default;
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
-void BisimulationDecomposition<DdType, ValueType, ExportValueType>::initialize() {
+void BisimulationDecomposition<DdType, ValueType, ExportValueType>::initialize(std::set<std::string> const& respectedRewardModelNames) {
     auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     verboseProgress = generalSettings.isVerboseSet();
     showProgressDelay = generalSettings.getShowProgressDelay();
 
     auto start = std::chrono::high_resolution_clock::now();
-    this->refineWrtRewardModels();
+    this->refineWrtRewardModels(respectedRewardModelNames);
     auto end = std::chrono::high_resolution_clock::now();
     STORM_LOG_INFO("Refining with respect to reward models took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
 
@@ -152,6 +167,16 @@ bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::getReachedFi
     return this->refiner->getStatus() == Status::FixedPoint;
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+Partition<DdType, ValueType> const& BisimulationDecomposition<DdType, ValueType, ExportValueType>::getStatePartition() const {
+    return this->refiner->getStatePartition();
+}
+
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+PreservationInformation<DdType, ValueType> const& BisimulationDecomposition<DdType, ValueType, ExportValueType>::getPreservationInformation() const {
+    return this->preservationInformation;
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 std::shared_ptr<storm::models::Model<ExportValueType>> BisimulationDecomposition<DdType, ValueType, ExportValueType>::getQuotient(
     storm::dd::bisimulation::QuotientFormat const& quotientFormat) const {
@@ -177,8 +202,12 @@ std::shared_ptr<storm::models::Model<ExportValueType>> BisimulationDecomposition
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
-void BisimulationDecomposition<DdType, ValueType, ExportValueType>::refineWrtRewardModels() {
+void BisimulationDecomposition<DdType, ValueType, ExportValueType>::refineWrtRewardModels(std::set<std::string> const& respectedRewardModelNames) {
     for (auto const& rewardModelName : this->preservationInformation.getRewardModelNames()) {
+        if (respectedRewardModelNames.count(rewardModelName) > 0) {
+            // The partition already respects the reward model.
+            continue;
+        }
         auto const& rewardModel = this->model.getRewardModel(rewardModelName);
         refiner->refineWrtRewardModel(rewardModel);
     }
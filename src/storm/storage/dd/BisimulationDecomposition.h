@@ -1,9 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "storm/storage/bisimulation/BisimulationType.h"
+#include "storm/storage/bisimulation/PartitionCache.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/bisimulation/PreservationInformation.h"
 #include "storm/storage/dd/bisimulation/QuotientFormat.h"
@@ -32,6 +35,12 @@ class PartitionRefiner;
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 class PartialQuotientExtractor;
+
+/*!
+ * The cache for bisimulations of symbolic models.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+using PartitionCache = storm::storage::bisimulation::PartitionCache<PreservationInformation<DdType, ValueType>, Partition<DdType, ValueType>>;
 }  // namespace bisimulation
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
@@ -47,6 +56,16 @@ class BisimulationDecomposition {
                               bisimulation::Partition<DdType, ValueType> const& initialPartition,
                               bisimulation::PreservationInformation<DdType, ValueType> const& preservationInformation);
 
+    /*!
+     * Creates a decomposition that starts from the given partition, which preserves the given initial preservation information (e.g.
+     * the bisimulation for that information). The partition is first refined with respect to the expressions and reward models that
+     * are to be preserved but are not preserved by the initial partition.
+     */
+    BisimulationDecomposition(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                              bisimulation::Partition<DdType, ValueType> const& initialPartition,
+                              bisimulation::PreservationInformation<DdType, ValueType> const& initialPreservationInformation,
+                              bisimulation::PreservationInformation<DdType, ValueType> const& preservationInformation);
+
     ~BisimulationDecomposition();
 
     /*!
@@ -67,14 +86,24 @@ class BisimulationDecomposition {
      */
     bool getReachedFixedPoint() const;
 
+    /*!
+     * Retrieves the current state partition.
+     */
+    bisimulation::Partition<DdType, ValueType> const& getStatePartition() const;
+
+    /*!
+     * Retrieves the information that is preserved by the decomposition.
+     */
+    bisimulation::PreservationInformation<DdType, ValueType> const& getPreservationInformation() const;
+
     /*!
      * Retrieves the quotient model after the bisimulation decomposition was computed.
      */
     std::shared_ptr<storm::models::Model<ExportValueType>> getQuotient(storm::dd::bisimulation::QuotientFormat const& quotientFormat) const;
 
    private:
-    void initialize();
-    void refineWrtRewardModels();
+    void initialize(std::set<std::string> const& respectedRewardModelNames = {});
+    void refineWrtRewardModels(std::set<std::string> const& respectedRewardModelNames);
 
     // The model for which to compute the bisimulation decomposition.
     storm::models::symbolic::Model<DdType, ValueType> const& model;
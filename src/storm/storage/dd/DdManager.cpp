@@ -519,6 +519,11 @@ void DdManager<LibraryType>::execute(std::function<void()> const& f) const {
     internalDdManager.execute(f);
 }
 
+template<DdType LibraryType>
+void DdManager<LibraryType>::executeInParallel(std::vector<std::function<void()>> const& functions) const {
+    internalDdManager.executeInParallel(functions);
+}
+
 template class DdManager<DdType::CUDD>;
 
 template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
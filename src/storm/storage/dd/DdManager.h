@@ -5,6 +5,7 @@
 #include <functional>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/AddIterator.h"
@@ -344,6 +345,15 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Executes the given functions, possibly in parallel, and returns once all of them are done. This must only be called from code that is
+     * executed through execute. As the functions may run concurrently, they must not modify data that they share.
+     * For sylvan, the functions are executed as parallel LACE tasks. Other libraries execute them one after another.
+     *
+     * @param functions The functions to execute. If some of them throw, the exception of the first one is rethrown.
+     */
+    void executeInParallel(std::vector<std::function<void()>> const& functions) const;
+
    private:
     /*!
      * Creates a meta variable with the given number of DD variables and layers.
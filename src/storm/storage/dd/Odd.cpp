@@ -2,7 +2,9 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <fstream>
+#include <limits>
 #include <set>
+#include <unordered_map>
 
 #include "storm/storage/BitVector.h"
 
@@ -15,9 +17,48 @@
 
 namespace storm {
 namespace dd {
-Odd::Odd(std::shared_ptr<Odd> elseNode, uint_fast64_t elseOffset, std::shared_ptr<Odd> thenNode, uint_fast64_t thenOffset)
-    : elseNode(elseNode), thenNode(thenNode), elseOffset(elseOffset), thenOffset(thenOffset) {
-    STORM_LOG_ASSERT(this != elseNode.get() && this != thenNode.get(), "Cyclic ODD.");
+namespace {
+uint64_t addToBuilder(Odd const& odd, OddBuilder& builder, std::unordered_map<Odd const*, uint64_t>& nodeToIndex) {
+    auto nodeIt = nodeToIndex.find(&odd);
+    if (nodeIt != nodeToIndex.end()) {
+        return nodeIt->second;
+    }
+    uint64_t result;
+    if (odd.isTerminalNode()) {
+        result = builder.addTerminalNode(odd.getThenOffset());
+    } else {
+        uint64_t elseNode = addToBuilder(odd.getElseSuccessor(), builder, nodeToIndex);
+        uint64_t thenNode = addToBuilder(odd.getThenSuccessor(), builder, nodeToIndex);
+        result = builder.addNode(elseNode, thenNode);
+    }
+    nodeToIndex.emplace(&odd, result);
+    return result;
+}
+}  // namespace
+
+Odd::Odd(Odd const& other)
+    : elseNode(other.elseNode), thenNode(other.thenNode), elseOffset(other.elseOffset), thenOffset(other.thenOffset), nodes(other.nodes) {
+    if (!nodes && !isTerminalNode()) {
+        // The other node is an inner node of another ODD. We copy its sub-ODD, so this copy does not depend on the lifetime of the other ODD.
+        OddBuilder builder;
+        std::unordered_map<Odd const*, uint64_t> nodeToIndex;
+        Odd copy = builder.build(addToBuilder(other, builder, nodeToIndex));
+        elseNode = copy.elseNode;
+        thenNode = copy.thenNode;
+        nodes = std::move(copy.nodes);
+    }
+}
+
+Odd& Odd::operator=(Odd const& other) {
+    if (this != &other) {
+        Odd copy(other);
+        elseNode = copy.elseNode;
+        thenNode = copy.thenNode;
+        elseOffset = copy.elseOffset;
+        thenOffset = copy.thenOffset;
+        nodes = std::move(copy.nodes);
+    }
+    return *this;
 }
 
 Odd const& Odd::getThenSuccessor() const {
@@ -203,6 +244,61 @@ void Odd::addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<sto
     }
 }
 
+uint64_t OddBuilder::addTerminalNode(uint_fast64_t thenOffset) {
+    nodes.push_back(Node{0, 0, 0, thenOffset, true});
+    return nodes.size() - 1;
+}
+
+uint64_t OddBuilder::addNode(uint64_t elseNode, uint64_t thenNode) {
+    STORM_LOG_ASSERT(elseNode < nodes.size() && thenNode < nodes.size(), "Successors have to be added before their predecessors.");
+    nodes.push_back(Node{elseNode, thenNode, nodes[elseNode].elseOffset + nodes[elseNode].thenOffset, nodes[thenNode].elseOffset + nodes[thenNode].thenOffset,
+                         false});
+    return nodes.size() - 1;
+}
+
+Odd OddBuilder::build(uint64_t rootNode) const {
+    STORM_LOG_ASSERT(rootNode < nodes.size(), "Unknown root node.");
+
+    // Number the nodes reachable from the root in breadth-first order. As all paths to a node have the same length, this stores the nodes
+    // of each level contiguously.
+    std::vector<uint64_t> newIndices(nodes.size(), std::numeric_limits<uint64_t>::max());
+    std::vector<uint64_t> order = {rootNode};
+    newIndices[rootNode] = 0;
+    for (uint64_t position = 0; position < order.size(); ++position) {
+        Node const& node = nodes[order[position]];
+        if (node.isTerminal) {
+            continue;
+        }
+        for (auto successor : {node.elseNode, node.thenNode}) {
+            if (newIndices[successor] == std::numeric_limits<uint64_t>::max()) {
+                newIndices[successor] = order.size();
+                order.push_back(successor);
+            }
+        }
+    }
+
+    auto oddNodes = std::make_shared<std::vector<Odd>>(order.size());
+    for (uint64_t position = 0; position < order.size(); ++position) {
+        Node const& node = nodes[order[position]];
+        Odd& oddNode = (*oddNodes)[position];
+        oddNode.elseOffset = node.elseOffset;
+        oddNode.thenOffset = node.thenOffset;
+        if (!node.isTerminal) {
+            oddNode.elseNode = &(*oddNodes)[newIndices[node.elseNode]];
+            oddNode.thenNode = &(*oddNodes)[newIndices[node.thenNode]];
+        }
+    }
+
+    Odd result;
+    Odd const& root = oddNodes->front();
+    result.elseNode = root.elseNode;
+    result.thenNode = root.thenNode;
+    result.elseOffset = root.elseOffset;
+    result.thenOffset = root.thenOffset;
+    result.nodes = std::move(oddNodes);
+    return result;
+}
+
 template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<double> const& oldValues, std::vector<double>& newValues) const;
 template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<storm::RationalNumber> const& oldValues,
                                         std::vector<storm::RationalNumber>& newValues) const;
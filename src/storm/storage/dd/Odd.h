@@ -13,23 +13,21 @@ class BitVector;
 }
 
 namespace dd {
+class OddBuilder;
+
+/*!
+ * An offset-labeled DD. The nodes of an ODD are stored contiguously (ordered by level) in one array that is shared by all copies of the
+ * root node. Copying an inner node yields an independent ODD.
+ */
 class Odd {
    public:
+    Odd() = default;
+
     /*!
-     * Constructs an offset-labeled DD with the given topmost DD node, else- and then-successor.
-     *
-     * @param dd The DD node associated with this ODD node.
-     * @param elseNode The else-successor of thie ODD node.
-     * @param elseOffset The offset of the else-successor.
-     * @param thenNode The then-successor of thie ODD node.
-     * @param thenOffset The offset of the then-successor.
+     * Creates a copy of the given ODD. If the given node is an inner node of another ODD, its sub-ODD is copied.
      */
-    Odd(std::shared_ptr<Odd> elseNode, uint_fast64_t elseOffset, std::shared_ptr<Odd> thenNode, uint_fast64_t thenOffset);
-
-    // Instantiate all copy/move constructors/assignments with the default implementation.
-    Odd() = default;
-    Odd(Odd const& other) = default;
-    Odd& operator=(Odd const& other) = default;
+    Odd(Odd const& other);
+    Odd& operator=(Odd const& other);
 #ifndef WINDOWS
     Odd(Odd&& other) = default;
     Odd& operator=(Odd&& other) = default;
@@ -177,13 +175,59 @@ class Odd {
     static void oldToNewIndexRec(uint_fast64_t oldOffset, storm::dd::Odd const& oldOdd, uint_fast64_t newOffset, storm::dd::Odd const& newOdd,
                                  std::function<void(uint64_t oldOffset, uint64_t newOffset)> const& callback);
 
+    friend class OddBuilder;
+
     // The then- and else-nodes.
-    std::shared_ptr<Odd> elseNode;
-    std::shared_ptr<Odd> thenNode;
+    Odd const* elseNode = nullptr;
+    Odd const* thenNode = nullptr;
 
     // The offsets that need to be added if the then- or else-successor is taken, respectively.
-    uint_fast64_t elseOffset;
-    uint_fast64_t thenOffset;
+    uint_fast64_t elseOffset = 0;
+    uint_fast64_t thenOffset = 0;
+
+    // The nodes of the ODD. This is only set for root nodes and keeps the successors alive.
+    std::shared_ptr<std::vector<Odd> const> nodes;
+};
+
+/*!
+ * Builds an ODD bottom-up. Nodes are referred to by their index in the builder and have to be added after their successors.
+ */
+class OddBuilder {
+   public:
+    /*!
+     * Adds a terminal node, i.e. a node without successors, with the given then-offset and an else-offset of zero.
+     *
+     * @return The index of the new node.
+     */
+    uint64_t addTerminalNode(uint_fast64_t thenOffset);
+
+    /*!
+     * Adds an inner node with the given successors. The offsets of the node are the total offsets of the successors.
+     *
+     * @param elseNode The index of the else-successor.
+     * @param thenNode The index of the then-successor.
+     * @return The index of the new node.
+     */
+    uint64_t addNode(uint64_t elseNode, uint64_t thenNode);
+
+    /*!
+     * Builds the ODD with the given root. Only the nodes reachable from the root are kept.
+     *
+     * @param rootNode The index of the root node.
+     * @return The ODD.
+     */
+    Odd build(uint64_t rootNode) const;
+
+   private:
+    struct Node {
+        uint64_t elseNode;
+        uint64_t thenNode;
+        uint_fast64_t elseOffset;
+        uint_fast64_t thenOffset;
+        bool isTerminal;
+    };
+
+    std::vector<Node> nodes;
 };
 }  // namespace dd
 }  // namespace storm
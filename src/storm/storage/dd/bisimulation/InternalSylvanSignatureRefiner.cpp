@@ -77,21 +77,21 @@ InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::refine(Partition
     signatures.resize(nextFreeBlockIndex);
 
     // Perform the actual recursive refinement step.
-    std::pair<BDD, BDD> result(0, 0);
-    result.first =
+    BDD result =
         RUN(sylvan_refine_partition, signatureAdd.getInternalAdd().getSylvanMtbdd().GetMTBDD(), oldPartition.asBdd().getInternalBdd().getSylvanBdd().GetBDD(),
             nondeterminismVariables.getInternalBdd().getSylvanBdd().GetBDD(), nonBlockVariables.getInternalBdd().getSylvanBdd().GetBDD(), this);
 
     // Construct resulting BDD from the obtained node and the meta information.
-    storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalNewPartitionBdd(&manager.getInternalDdManager(), sylvan::Bdd(result.first));
+    storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalNewPartitionBdd(&manager.getInternalDdManager(), sylvan::Bdd(result));
     storm::dd::Bdd<storm::dd::DdType::Sylvan> newPartitionBdd(oldPartition.asBdd().getDdManager(), internalNewPartitionBdd,
                                                               oldPartition.asBdd().getContainedMetaVariables());
 
     boost::optional<storm::dd::Bdd<storm::dd::DdType::Sylvan>> optionalChangedBdd;
-    if (options.createChangedStates && result.second != 0) {
-        storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalChangedBdd(&manager.getInternalDdManager(), sylvan::Bdd(result.second));
-        storm::dd::Bdd<storm::dd::DdType::Sylvan> changedBdd(oldPartition.asBdd().getDdManager(), internalChangedBdd, stateVariables);
-        optionalChangedBdd = changedBdd;
+    if (options.createChangedStates && options.reuseBlockNumbers) {
+        // The changed states are the ones that were assigned a new block number. As block numbers are reused, these are exactly the states of the
+        // newly created blocks, which serve as splitters in the next refinement. Without reusing block numbers, the new numbers are unrelated to the
+        // old ones, so we do not provide changed states and the next refinement is a full one.
+        optionalChangedBdd = newPartitionBdd.andExists(!oldPartition.asBdd(), {blockVariable});
     }
 
     clearCaches();
@@ -19,7 +19,7 @@ NondeterministicModelPartitionRefiner<DdType, ValueType>::NondeterministicModelP
     if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
         STORM_LOG_TRACE("Refining with respect to exit rates.");
         auto exitRateVector = this->model.template as<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>>()->getExitRateVector();
-        this->statePartition = stateSignatureRefiner.refine(this->statePartition, Signature<DdType, ValueType>(exitRateVector));
+        this->statePartition = stateSignatureRefiner.refine(this->statePartition, Signature<DdType, ValueType>(exitRateVector)).withoutChangedStates();
     }
 }
 
@@ -87,7 +87,8 @@ Partition<DdType, ValueType> const& NondeterministicModelPartitionRefiner<DdType
 template<storm::dd::DdType DdType, typename ValueType>
 bool NondeterministicModelPartitionRefiner<DdType, ValueType>::refineWrtStateRewards(storm::dd::Add<DdType, ValueType> const& stateRewards) {
     STORM_LOG_TRACE("Refining with respect to state rewards.");
-    Partition<DdType, ValueType> newStatePartition = this->stateSignatureRefiner.refine(this->statePartition, Signature<DdType, ValueType>(stateRewards));
+    Partition<DdType, ValueType> newStatePartition =
+        this->stateSignatureRefiner.refine(this->statePartition, Signature<DdType, ValueType>(stateRewards)).withoutChangedStates();
     if (newStatePartition == this->statePartition) {
         return false;
     } else {
@@ -286,6 +286,13 @@ storm::dd::Bdd<DdType> const& Partition<DdType, ValueType>::changedStatesAsBdd()
     return boost::get<storm::dd::Bdd<DdType>>(changedStates.get());
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+Partition<DdType, ValueType> Partition<DdType, ValueType>::withoutChangedStates() const {
+    Partition<DdType, ValueType> result(*this);
+    result.changedStates = boost::none;
+    return result;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 uint64_t Partition<DdType, ValueType>::getNumberOfBlocks() const {
     return numberOfBlocks;
@@ -73,6 +73,13 @@ class Partition {
     storm::dd::Add<DdType, ValueType> const& changedStatesAsAdd() const;
     storm::dd::Bdd<DdType> const& changedStatesAsBdd() const;
 
+    /*!
+     * Retrieves a copy of this partition without the information about the states whose block assignment changed.
+     * This needs to be used whenever the partition was not obtained by refining with respect to the full signature, because then
+     * the changed states are not sufficient as splitters in the next refinement.
+     */
+    Partition<DdType, ValueType> withoutChangedStates() const;
+
    private:
     /*!
      * Creates a new partition from the given data.
@@ -76,6 +76,12 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
             if (newPartition.getNumberOfBlocks() > oldPartition.getNumberOfBlocks()) {
                 refined = true;
             }
+            ++index;
+        }
+
+        // The changed states only serve as splitters for the next refinement if the partition was refined wrt. the full signature.
+        if (mode != SignatureMode::Eager && index < 2 && newPartition.hasChangedStates()) {
+            newPartition = newPartition.withoutChangedStates();
         }
 
         auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
@@ -117,10 +123,16 @@ bool PartitionRefiner<DdType, ValueType>::refineWrtRewardModel(storm::models::sy
     return result;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+bool PartitionRefiner<DdType, ValueType>::refineWrtStates(storm::dd::Bdd<DdType> const& states) {
+    // The states are separated like states with different state rewards.
+    return refineWrtStateRewards(states.template toAdd<ValueType>());
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 bool PartitionRefiner<DdType, ValueType>::refineWrtStateRewards(storm::dd::Add<DdType, ValueType> const& stateRewards) {
     STORM_LOG_TRACE("Refining with respect to state rewards.");
-    Partition<DdType, ValueType> newPartition = signatureRefiner.refine(statePartition, Signature<DdType, ValueType>(stateRewards));
+    Partition<DdType, ValueType> newPartition = signatureRefiner.refine(statePartition, Signature<DdType, ValueType>(stateRewards)).withoutChangedStates();
     if (newPartition == statePartition) {
         return false;
     } else {
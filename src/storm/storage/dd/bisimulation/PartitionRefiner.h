@@ -38,6 +38,12 @@ class PartitionRefiner {
      */
     bool refineWrtRewardModel(storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel);
 
+    /*!
+     * Refines the partition such that the given states do not share a block with other states.
+     * @return True iff the partition was refined.
+     */
+    bool refineWrtStates(storm::dd::Bdd<DdType> const& states);
+
     /*!
      * Retrieves the current state partition in the refinement process.
      */
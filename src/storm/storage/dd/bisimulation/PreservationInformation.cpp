@@ -1,5 +1,7 @@
 #include "storm/storage/dd/bisimulation/PreservationInformation.h"
 
+#include <algorithm>
+
 #include "storm/logic/Formulas.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -104,6 +106,18 @@ std::set<std::string> const& PreservationInformation<DdType, ValueType>::getRewa
     return rewardModelNames;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+bool PreservationInformation<DdType, ValueType>::isIncludedIn(PreservationInformation const& other) const {
+    return std::includes(other.expressions.begin(), other.expressions.end(), expressions.begin(), expressions.end(),
+                         std::less<storm::expressions::Expression>()) &&
+           std::includes(other.rewardModelNames.begin(), other.rewardModelNames.end(), rewardModelNames.begin(), rewardModelNames.end());
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+uint64_t PreservationInformation<DdType, ValueType>::getSize() const {
+    return expressions.size() + rewardModelNames.size();
+}
+
 template class PreservationInformation<storm::dd::DdType::CUDD, double>;
 
 template class PreservationInformation<storm::dd::DdType::Sylvan, double>;
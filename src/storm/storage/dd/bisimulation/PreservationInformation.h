@@ -35,6 +35,17 @@ class PreservationInformation {
     std::set<storm::expressions::Expression> const& getExpressions() const;
     std::set<std::string> const& getRewardModelNames() const;
 
+    /*!
+     * Retrieves whether all expressions and reward models preserved by this object are also preserved by the given one. Expressions
+     * are compared syntactically, i.e., via their identity.
+     */
+    bool isIncludedIn(PreservationInformation const& other) const;
+
+    /*!
+     * @return The number of preserved expressions and reward models.
+     */
+    uint64_t getSize() const;
+
    private:
     std::set<std::string> labels;
     std::set<storm::expressions::Expression> expressions;
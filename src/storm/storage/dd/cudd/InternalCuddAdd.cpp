@@ -1,5 +1,6 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include "storm/storage/dd/BinaryEncoding.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
@@ -10,6 +11,7 @@
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -416,6 +418,46 @@ void InternalAdd<DdType::CUDD, ValueType>::exportToText(std::string const&) cons
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported");
 }
 
+namespace {
+/*!
+ * Collects the nodes of the given DD in post-order and returns the position of the given node.
+ */
+uint64_t collectNodesRec(DdNode* node, std::unordered_map<DdNode*, uint64_t>& nodeToPosition, std::vector<DdNode*>& nodes) {
+    auto positionIt = nodeToPosition.find(node);
+    if (positionIt != nodeToPosition.end()) {
+        return positionIt->second;
+    }
+    // ADDs of CUDD do not have complement edges, so the successors can be used as they are.
+    if (!Cudd_IsConstant(node)) {
+        collectNodesRec(Cudd_E(node), nodeToPosition, nodes);
+        collectNodesRec(Cudd_T(node), nodeToPosition, nodes);
+    }
+    uint64_t position = nodes.size();
+    nodes.push_back(node);
+    nodeToPosition.emplace(node, position);
+    return position;
+}
+}  // namespace
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::exportToBinary(std::ostream& out) const {
+    std::unordered_map<DdNode*, uint64_t> nodeToPosition;
+    std::vector<DdNode*> nodes;
+    collectNodesRec(this->getCuddDdNode(), nodeToPosition, nodes);
+
+    storm::dd::binary::writeUint64(out, nodes.size());
+    for (DdNode* node : nodes) {
+        if (Cudd_IsConstant(node)) {
+            storm::dd::binary::writeUint64(out, storm::dd::binary::LeafMarker);
+            storm::dd::binary::writeValue(out, storm::utility::convertNumber<ValueType>(Cudd_V(node)));
+        } else {
+            storm::dd::binary::writeUint64(out, Cudd_NodeReadIndex(node));
+            storm::dd::binary::writeUint64(out, nodeToPosition.at(Cudd_E(node)));
+            storm::dd::binary::writeUint64(out, nodeToPosition.at(Cudd_T(node)));
+        }
+    }
+}
+
 template<typename ValueType>
 AddIterator<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::begin(DdManager<DdType::CUDD> const& fullDdManager, InternalBdd<DdType::CUDD> const&,
                                                                                  uint_fast64_t, std::set<storm::expressions::Variable> const& metaVariables,
@@ -452,20 +494,20 @@ std::string InternalAdd<DdType::CUDD, ValueType>::getStringId() const {
 template<typename ValueType>
 Odd InternalAdd<DdType::CUDD, ValueType>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
     // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-    std::vector<std::unordered_map<DdNode*, std::shared_ptr<Odd>>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+    std::vector<std::unordered_map<DdNode*, uint64_t>> uniqueTableForLevels(ddVariableIndices.size() + 1);
 
     // Now construct the ODD structure from the ADD.
-    std::shared_ptr<Odd> rootOdd =
-        createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+    OddBuilder builder;
+    uint64_t rootOdd =
+        createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
 
-    // Return a copy of the root node to remove the shared_ptr encapsulation.
-    return Odd(*rootOdd);
+    return builder.build(rootOdd);
 }
 
 template<typename ValueType>
-std::shared_ptr<Odd> InternalAdd<DdType::CUDD, ValueType>::createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel,
-                                                                        uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                                        std::vector<std::unordered_map<DdNode*, std::shared_ptr<Odd>>>& uniqueTableForLevels) {
+uint64_t InternalAdd<DdType::CUDD, ValueType>::createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
+                                                            std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                            std::vector<std::unordered_map<DdNode*, uint64_t>>& uniqueTableForLevels, OddBuilder& builder) {
     // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
     auto const& iterator = uniqueTableForLevels[currentLevel].find(dd);
     if (iterator != uniqueTableForLevels[currentLevel].end()) {
@@ -476,7 +518,6 @@ std::shared_ptr<Odd> InternalAdd<DdType::CUDD, ValueType>::createOddRec(DdNode*
         // If we are already past the maximal level that is to be considered, we can simply create an Odd without
         // successors
         if (currentLevel == maxLevel) {
-            uint_fast64_t elseOffset = 0;
             uint_fast64_t thenOffset = 0;
 
             // If the DD is not the zero leaf, then the then-offset is 1.
@@ -484,27 +525,23 @@ std::shared_ptr<Odd> InternalAdd<DdType::CUDD, ValueType>::createOddRec(DdNode*
                 thenOffset = 1;
             }
 
-            auto oddNode = std::make_shared<Odd>(nullptr, elseOffset, nullptr, thenOffset);
+            uint64_t oddNode = builder.addTerminalNode(thenOffset);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
             // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
             // node for the then-successor as well.
-            std::shared_ptr<Odd> elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = elseNode;
-            auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getElseOffset() + elseNode->getThenOffset(), thenNode,
-                                                 thenNode->getElseOffset() + thenNode->getThenOffset());
+            uint64_t elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = elseNode;
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         } else {
             // Otherwise, we compute the ODDs for both the then- and else successors.
-            std::shared_ptr<Odd> elseNode = createOddRec(Cudd_E(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = createOddRec(Cudd_T(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-
-            uint_fast64_t totalElseOffset = elseNode->getElseOffset() + elseNode->getThenOffset();
-            uint_fast64_t totalThenOffset = thenNode->getElseOffset() + thenNode->getThenOffset();
+            uint64_t elseNode = createOddRec(Cudd_E(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = createOddRec(Cudd_T(dd), manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
 
-            auto oddNode = std::make_shared<Odd>(elseNode, totalElseOffset, thenNode, totalThenOffset);
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         }
@@ -812,6 +849,32 @@ InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::fromV
                              fromVectorRec(ddManager->getCuddManager().getManager(), offset, 0, ddVariableIndices.size(), values, odd, ddVariableIndices)));
 }
 
+template<typename ValueType>
+InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::fromBinary(InternalDdManager<DdType::CUDD> const* ddManager, std::istream& in,
+                                                                                      std::vector<uint_fast64_t> const& ddVariableIndexMapping) {
+    cudd::Cudd const& manager = ddManager->getCuddManager();
+    uint64_t numberOfNodes = storm::dd::binary::readUint64(in);
+    STORM_LOG_THROW(numberOfNodes > 0, storm::exceptions::WrongFormatException, "Binary DD encoding without nodes.");
+
+    // Since the order of the DD variables may differ from the one of the DD that was written, the nodes are created via if-then-else. If
+    // the orders coincide, this directly creates the node.
+    std::vector<cudd::ADD> nodes;
+    nodes.reserve(numberOfNodes);
+    for (uint64_t position = 0; position < numberOfNodes; ++position) {
+        uint64_t index = storm::dd::binary::readUint64(in);
+        if (index == storm::dd::binary::LeafMarker) {
+            nodes.push_back(manager.constant(storm::utility::convertNumber<double>(storm::dd::binary::readValue<ValueType>(in))));
+        } else {
+            uint64_t elsePosition = storm::dd::binary::readUint64(in);
+            uint64_t thenPosition = storm::dd::binary::readUint64(in);
+            STORM_LOG_THROW(index < ddVariableIndexMapping.size() && elsePosition < position && thenPosition < position,
+                            storm::exceptions::WrongFormatException, "Illegal node in binary DD encoding.");
+            nodes.push_back(manager.addVar(static_cast<int>(ddVariableIndexMapping[index])).Ite(nodes[thenPosition], nodes[elsePosition]));
+        }
+    }
+    return InternalAdd<DdType::CUDD, ValueType>(ddManager, nodes.back());
+}
+
 template<typename ValueType>
 DdNode* InternalAdd<DdType::CUDD, ValueType>::fromVectorRec(::DdManager* manager, uint_fast64_t& currentOffset, uint_fast64_t currentLevel,
                                                             uint_fast64_t maxLevel, std::vector<ValueType> const& values, Odd const& odd,
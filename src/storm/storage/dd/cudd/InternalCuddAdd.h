@@ -2,6 +2,7 @@
 #define STORM_STORAGE_DD_CUDD_INTERNALCUDDADD_H_
 
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -526,6 +527,13 @@ class InternalAdd<DdType::CUDD, ValueType> {
      * @param filename The name of the file to which the DD is to be exported.
      */
     void exportToText(std::string const& filename) const;
+
+    /*!
+     * Writes the DD as a node table to the given stream (see BinaryEncoding.h).
+     *
+     * @param out The stream to write to. Should be opened in binary mode.
+     */
+    void exportToBinary(std::ostream& out) const;
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -661,6 +669,16 @@ class InternalAdd<DdType::CUDD, ValueType> {
     static InternalAdd<DdType::CUDD, ValueType> fromVector(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<ValueType> const& values,
                                                            storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
 
+    /*!
+     * Reads an ADD that was written by exportToBinary.
+     *
+     * @param ddManager The manager to use to built the ADD.
+     * @param in The stream to read from.
+     * @param ddVariableIndexMapping Maps the indices of the DD variables in the stream to the indices of the DD variables to use.
+     */
+    static InternalAdd<DdType::CUDD, ValueType> fromBinary(InternalDdManager<DdType::CUDD> const* ddManager, std::istream& in,
+                                                           std::vector<uint_fast64_t> const& ddVariableIndexMapping);
+
     /*!
      * Creates an ODD based on the current ADD.
      *
@@ -818,11 +836,12 @@ class InternalAdd<DdType::CUDD, ValueType> {
      * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
      * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
      * ODD nodes for the same DD and level unique.
-     * @return A pointer to the constructed ODD for the given arguments.
+     * @param builder The builder that stores the nodes of the ODD.
+     * @return The index of the constructed ODD node in the builder.
      */
-    static std::shared_ptr<Odd> createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
-                                             std::vector<uint_fast64_t> const& ddVariableIndices,
-                                             std::vector<std::unordered_map<DdNode*, std::shared_ptr<Odd>>>& uniqueTableForLevels);
+    static uint64_t createOddRec(DdNode* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
+                                 std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<std::unordered_map<DdNode*, uint64_t>>& uniqueTableForLevels,
+                                 OddBuilder& builder);
 
     InternalDdManager<DdType::CUDD> const* ddManager;
 
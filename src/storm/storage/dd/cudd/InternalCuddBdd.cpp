@@ -343,14 +343,14 @@ void InternalBdd<DdType::CUDD>::toVectorRec(DdNode const* dd, cudd::Cudd const&
 
 Odd InternalBdd<DdType::CUDD>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
     // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-    std::vector<std::unordered_map<DdNode const*, std::shared_ptr<Odd>>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+    std::vector<std::unordered_map<DdNode const*, uint64_t>> uniqueTableForLevels(ddVariableIndices.size() + 1);
 
     // Now construct the ODD structure from the BDD.
-    std::shared_ptr<Odd> rootOdd =
-        createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+    OddBuilder builder;
+    uint64_t rootOdd =
+        createOddRec(this->getCuddDdNode(), ddManager->getCuddManager(), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
 
-    // Return a copy of the root node to remove the shared_ptr encapsulation.
-    return Odd(*rootOdd);
+    return builder.build(rootOdd);
 }
 
 std::size_t InternalBdd<DdType::CUDD>::HashFunctor::operator()(std::pair<DdNode const*, bool> const& key) const {
@@ -360,9 +360,9 @@ std::size_t InternalBdd<DdType::CUDD>::HashFunctor::operator()(std::pair<DdNode
     return result;
 }
 
-std::shared_ptr<Odd> InternalBdd<DdType::CUDD>::createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
-                                                             std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                             std::vector<std::unordered_map<DdNode const*, std::shared_ptr<Odd>>>& uniqueTableForLevels) {
+uint64_t InternalBdd<DdType::CUDD>::createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
+                                                 std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                 std::vector<std::unordered_map<DdNode const*, uint64_t>>& uniqueTableForLevels, OddBuilder& builder) {
     // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
     auto it = uniqueTableForLevels[currentLevel].find(dd);
     if (it != uniqueTableForLevels[currentLevel].end()) {
@@ -373,16 +373,16 @@ std::shared_ptr<Odd> InternalBdd<DdType::CUDD>::createOddRec(DdNode const* dd, c
         // If we are already at the maximal level that is to be considered, we can simply create an Odd without
         // successors
         if (currentLevel == maxLevel) {
-            auto oddNode = std::make_shared<Odd>(nullptr, 0, nullptr, dd != Cudd_ReadLogicZero(manager.getManager()) ? 1 : 0);
+            uint64_t oddNode = builder.addTerminalNode(dd != Cudd_ReadLogicZero(manager.getManager()) ? 1 : 0);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
             // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
             // node for the then-successor as well.
-            std::shared_ptr<Odd> elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = elseNode;
+            uint64_t elseNode = createOddRec(dd, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = elseNode;
 
-            auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getTotalOffset(), thenNode, elseNode->getTotalOffset());
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         } else {
@@ -395,10 +395,10 @@ std::shared_ptr<Odd> InternalBdd<DdType::CUDD>::createOddRec(DdNode const* dd, c
                 elseDdNode = Cudd_Not(elseDdNode);
             }
 
-            std::shared_ptr<Odd> elseNode = createOddRec(elseDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = createOddRec(thenDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
+            uint64_t elseNode = createOddRec(elseDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = createOddRec(thenDdNode, manager, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
 
-            auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getTotalOffset(), thenNode, thenNode->getTotalOffset());
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         }
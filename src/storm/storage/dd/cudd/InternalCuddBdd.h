@@ -29,6 +29,7 @@ template<DdType LibraryType, typename ValueType>
 class InternalAdd;
 
 class Odd;
+class OddBuilder;
 
 template<>
 class InternalBdd<DdType::CUDD> {
@@ -474,11 +475,12 @@ class InternalBdd<DdType::CUDD> {
      * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
      * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
      * ODD nodes for the same DD and level unique.
-     * @return A pointer to the constructed ODD for the given arguments.
+     * @param builder The builder that stores the nodes of the ODD.
+     * @return The index of the constructed ODD node in the builder.
      */
-    static std::shared_ptr<Odd> createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
-                                             std::vector<uint_fast64_t> const& ddVariableIndices,
-                                             std::vector<std::unordered_map<DdNode const*, std::shared_ptr<Odd>>>& uniqueTableForLevels);
+    static uint64_t createOddRec(DdNode const* dd, cudd::Cudd const& manager, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
+                                 std::vector<uint_fast64_t> const& ddVariableIndices,
+                                 std::vector<std::unordered_map<DdNode const*, uint64_t>>& uniqueTableForLevels, OddBuilder& builder);
 
     /*!
      * Adds the selected values the target vector.
@@ -205,6 +205,12 @@ void InternalDdManager<DdType::CUDD>::execute(std::function<void()> const& f) co
     f();
 }
 
+void InternalDdManager<DdType::CUDD>::executeInParallel(std::vector<std::function<void()>> const& functions) const {
+    for (auto const& function : functions) {
+        function();
+    }
+}
+
 cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
     return cuddManager;
 }
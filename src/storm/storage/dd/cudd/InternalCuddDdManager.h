@@ -3,6 +3,7 @@
 
 #include <boost/optional.hpp>
 #include <functional>
+#include <vector>
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
@@ -141,6 +142,13 @@ class InternalDdManager<DdType::CUDD> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Executes the given functions. As Cudd is not thread-safe, they are executed one after another.
+     *
+     * @param functions the functions that are executed
+     */
+    void executeInParallel(std::vector<std::function<void()>> const& functions) const;
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
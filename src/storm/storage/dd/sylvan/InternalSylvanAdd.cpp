@@ -1,5 +1,9 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <algorithm>
+#include <type_traits>
+
+#include "storm/storage/dd/BinaryEncoding.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
@@ -10,13 +14,89 @@
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm-config.h"
 
 namespace storm {
 namespace dd {
+namespace {
+// The number of independent row ranges per thread into which the conversion to a matrix is split. Using more ranges than threads balances
+// the load if the rows are distributed unevenly.
+uint64_t const RowRangesPerThread = 16;
+
+/*!
+ * Computes the cofactors of the given node with respect to the given row and column variable in the order else-else, else-then, then-else,
+ * then-then (where the first part refers to the row and the second part refers to the column variable).
+ */
+void getRowColumnCofactors(MTBDD dd, uint_fast64_t rowVariable, uint_fast64_t columnVariable, MTBDD (&cofactors)[4]) {
+    if (mtbdd_isleaf(dd) || columnVariable < mtbdd_getvar(dd)) {
+        cofactors[0] = cofactors[1] = cofactors[2] = cofactors[3] = dd;
+    } else if (rowVariable < mtbdd_getvar(dd)) {
+        cofactors[0] = cofactors[2] = mtbdd_getlow(dd);
+        cofactors[1] = cofactors[3] = mtbdd_gethigh(dd);
+    } else {
+        MTBDD elseNode = mtbdd_getlow(dd);
+        if (mtbdd_isleaf(elseNode) || columnVariable < mtbdd_getvar(elseNode)) {
+            cofactors[0] = cofactors[1] = elseNode;
+        } else {
+            cofactors[0] = mtbdd_getlow(elseNode);
+            cofactors[1] = mtbdd_gethigh(elseNode);
+        }
+
+        MTBDD thenNode = mtbdd_gethigh(dd);
+        if (mtbdd_isleaf(thenNode) || columnVariable < mtbdd_getvar(thenNode)) {
+            cofactors[2] = cofactors[3] = thenNode;
+        } else {
+            cofactors[2] = mtbdd_getlow(thenNode);
+            cofactors[3] = mtbdd_gethigh(thenNode);
+        }
+    }
+}
+
+// A part of the matrix that is converted independently. All parts with the same row range have to be converted in the given order.
+struct MatrixComponentsTask {
+    MTBDD dd;
+    bool negated;
+    Odd const* rowOdd;
+    Odd const* columnOdd;
+    uint_fast64_t rowOffset;
+    uint_fast64_t columnOffset;
+    uint_fast64_t rowRange;
+};
+
+/*!
+ * Splits the conversion into a matrix on the first levels in the same way (and in the same order) as the recursive conversion does.
+ */
+void splitMatrixComponents(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel,
+                           uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, uint_fast64_t rowRange,
+                           std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                           std::vector<MatrixComponentsTask>& tasks) {
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return;
+    }
+    if (currentLevel == splitLevel) {
+        tasks.push_back(MatrixComponentsTask{dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset, rowRange});
+        return;
+    }
+
+    MTBDD cofactors[4];
+    getRowColumnCofactors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], cofactors);
+    for (uint_fast64_t index = 0; index < 4; ++index) {
+        bool rowThen = index >= 2;
+        bool columnThen = index % 2 == 1;
+        splitMatrixComponents(mtbdd_regular(cofactors[index]), mtbdd_hascomp(cofactors[index]) ^ negated,
+                              rowThen ? rowOdd.getThenSuccessor() : rowOdd.getElseSuccessor(),
+                              columnThen ? columnOdd.getThenSuccessor() : columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel,
+                              currentRowOffset + (rowThen ? rowOdd.getElseOffset() : 0), currentColumnOffset + (columnThen ? columnOdd.getElseOffset() : 0),
+                              2 * rowRange + (rowThen ? 1 : 0), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    }
+}
+}  // namespace
+
 template<typename ValueType>
 InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
     // Intentionally left empty.
@@ -865,6 +945,46 @@ void InternalAdd<DdType::Sylvan, ValueType>::exportToDot(std::string const& file
     }
 }
 
+namespace {
+/*!
+ * Collects the nodes of the given DD in post-order and returns the position of the given node.
+ */
+uint64_t collectNodesRec(MTBDD node, std::unordered_map<MTBDD, uint64_t>& nodeToPosition, std::vector<MTBDD>& nodes) {
+    auto positionIt = nodeToPosition.find(node);
+    if (positionIt != nodeToPosition.end()) {
+        return positionIt->second;
+    }
+    // The successors take the complement mark of the node into account, so the nodes can be distinguished by their (possibly marked) handle.
+    if (!mtbdd_isleaf(node)) {
+        collectNodesRec(mtbdd_getlow(node), nodeToPosition, nodes);
+        collectNodesRec(mtbdd_gethigh(node), nodeToPosition, nodes);
+    }
+    uint64_t position = nodes.size();
+    nodes.push_back(node);
+    nodeToPosition.emplace(node, position);
+    return position;
+}
+}  // namespace
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::exportToBinary(std::ostream& out) const {
+    std::unordered_map<MTBDD, uint64_t> nodeToPosition;
+    std::vector<MTBDD> nodes;
+    collectNodesRec(this->getSylvanMtbdd().GetMTBDD(), nodeToPosition, nodes);
+
+    storm::dd::binary::writeUint64(out, nodes.size());
+    for (MTBDD node : nodes) {
+        if (mtbdd_isleaf(node)) {
+            storm::dd::binary::writeUint64(out, storm::dd::binary::LeafMarker);
+            storm::dd::binary::writeValue(out, node == mtbdd_false ? storm::utility::zero<ValueType>() : getValue(node));
+        } else {
+            storm::dd::binary::writeUint64(out, mtbdd_getvar(node));
+            storm::dd::binary::writeUint64(out, nodeToPosition.at(mtbdd_getlow(node)));
+            storm::dd::binary::writeUint64(out, nodeToPosition.at(mtbdd_gethigh(node)));
+        }
+    }
+}
+
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::exportToText(std::string const& filename) const {
     // Open the file, dump the DD and close it again.
@@ -896,20 +1016,20 @@ AddIterator<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::e
 template<typename ValueType>
 Odd InternalAdd<DdType::Sylvan, ValueType>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
     // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-    std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+    std::vector<std::unordered_map<BDD, uint64_t>> uniqueTableForLevels(ddVariableIndices.size() + 1);
 
     // Now construct the ODD structure from the ADD.
-    std::shared_ptr<Odd> rootOdd =
-        createOddRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+    OddBuilder builder;
+    uint64_t rootOdd =
+        createOddRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), 0, ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels, builder);
 
-    // Return a copy of the root node to remove the shared_ptr encapsulation.
-    return Odd(*rootOdd);
+    return builder.build(rootOdd);
 }
 
 template<typename ValueType>
-std::shared_ptr<Odd> InternalAdd<DdType::Sylvan, ValueType>::createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
-                                                                          std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                                          std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>>& uniqueTableForLevels) {
+uint64_t InternalAdd<DdType::Sylvan, ValueType>::createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
+                                                              std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                              std::vector<std::unordered_map<BDD, uint64_t>>& uniqueTableForLevels, OddBuilder& builder) {
     // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
     auto const& iterator = uniqueTableForLevels[currentLevel].find(dd);
     if (iterator != uniqueTableForLevels[currentLevel].end()) {
@@ -920,7 +1040,6 @@ std::shared_ptr<Odd> InternalAdd<DdType::Sylvan, ValueType>::createOddRec(BDD dd
         // If we are already past the maximal level that is to be considered, we can simply create an Odd without
         // successors
         if (currentLevel == maxLevel) {
-            uint_fast64_t elseOffset = 0;
             uint_fast64_t thenOffset = 0;
 
             STORM_LOG_ASSERT(mtbdd_isleaf(dd), "Expected leaf at last level.");
@@ -930,27 +1049,23 @@ std::shared_ptr<Odd> InternalAdd<DdType::Sylvan, ValueType>::createOddRec(BDD dd
                 thenOffset = 1;
             }
 
-            auto oddNode = std::make_shared<Odd>(nullptr, elseOffset, nullptr, thenOffset);
+            uint64_t oddNode = builder.addTerminalNode(thenOffset);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
             // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
             // node for the then-successor as well.
-            std::shared_ptr<Odd> elseNode = createOddRec(dd, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = elseNode;
-            auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getElseOffset() + elseNode->getThenOffset(), thenNode,
-                                                 thenNode->getElseOffset() + thenNode->getThenOffset());
+            uint64_t elseNode = createOddRec(dd, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = elseNode;
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         } else {
             // Otherwise, we compute the ODDs for both the then- and else successors.
-            std::shared_ptr<Odd> elseNode = createOddRec(mtbdd_regular(mtbdd_getlow(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = createOddRec(mtbdd_regular(mtbdd_gethigh(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-
-            uint_fast64_t totalElseOffset = elseNode->getElseOffset() + elseNode->getThenOffset();
-            uint_fast64_t totalThenOffset = thenNode->getElseOffset() + thenNode->getThenOffset();
+            uint64_t elseNode = createOddRec(mtbdd_regular(mtbdd_getlow(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = createOddRec(mtbdd_regular(mtbdd_gethigh(dd)), currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
 
-            auto oddNode = std::make_shared<Odd>(elseNode, totalElseOffset, thenNode, totalThenOffset);
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(dd, oddNode);
             return oddNode;
         }
@@ -1231,9 +1346,45 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+    // Reading the DD is thread-safe, so we convert independent row ranges concurrently using as many threads as sylvan uses. Values of rational
+    // functions are not converted concurrently, because the rational function library is not thread-safe.
+    uint64_t numberOfThreads = std::is_same<ValueType, storm::RationalFunction>::value ? 1 : lace_workers();
+    uint_fast64_t splitLevel = 0;
+    while (splitLevel < std::min(ddRowVariableIndices.size(), ddColumnVariableIndices.size()) &&
+           (1ull << splitLevel) < numberOfThreads * RowRangesPerThread) {
+        ++splitLevel;
+    }
+    if (numberOfThreads <= 1 || splitLevel == 0) {
+        toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Split on the first levels. Parts with different row ranges write to disjoint rows, while parts of the same row range need to be converted
+    // in order to keep the entries of each row sorted by column.
+    std::vector<MatrixComponentsTask> tasks;
+    splitMatrixComponents(mtbdd_regular(dd), mtbdd_hascomp(dd), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
+                          tasks);
+    std::stable_sort(tasks.begin(), tasks.end(),
+                     [](MatrixComponentsTask const& first, MatrixComponentsTask const& second) { return first.rowRange < second.rowRange; });
+    std::vector<uint64_t> rangeBegins;
+    for (uint64_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+        if (taskIndex == 0 || tasks[taskIndex].rowRange != tasks[taskIndex - 1].rowRange) {
+            rangeBegins.push_back(taskIndex);
+        }
+    }
+    rangeBegins.push_back(tasks.size());
+
+    storm::utility::parallel::forEachChunk(numberOfThreads, rangeBegins.size() - 1, 1, [&](uint64_t, uint64_t range, uint64_t) {
+        for (uint64_t taskIndex = rangeBegins[range]; taskIndex < rangeBegins[range + 1]; ++taskIndex) {
+            MatrixComponentsTask const& task = tasks[taskIndex];
+            toMatrixComponentsRec(task.dd, task.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel,
+                                  splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+    });
 }
 
 template<typename ValueType>
@@ -1257,33 +1408,12 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         }
         ++rowIndications[rowGroupOffsets[currentRowOffset]];
     } else {
-        MTBDD elseElse;
-        MTBDD elseThen;
-        MTBDD thenElse;
-        MTBDD thenThen;
-
-        if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = thenElse = mtbdd_getlow(dd);
-            elseThen = thenThen = mtbdd_gethigh(dd);
-        } else {
-            MTBDD elseNode = mtbdd_getlow(dd);
-            if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = mtbdd_getlow(elseNode);
-                elseThen = mtbdd_gethigh(elseNode);
-            }
-
-            MTBDD thenNode = mtbdd_gethigh(dd);
-            if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = mtbdd_getlow(thenNode);
-                thenThen = mtbdd_gethigh(thenNode);
-            }
-        }
+        MTBDD cofactors[4];
+        getRowColumnCofactors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], cofactors);
+        MTBDD elseElse = cofactors[0];
+        MTBDD elseThen = cofactors[1];
+        MTBDD thenElse = cofactors[2];
+        MTBDD thenThen = cofactors[3];
 
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
@@ -1313,6 +1443,49 @@ InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::f
     return InternalAdd<DdType::Sylvan, ValueType>(ddManager, sylvan::Mtbdd(fromVectorRec(offset, 0, ddVariableIndices.size(), values, odd, ddVariableIndices)));
 }
 
+template<typename ValueType>
+InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::fromBinary(InternalDdManager<DdType::Sylvan> const* ddManager,
+                                                                                          std::istream& in,
+                                                                                          std::vector<uint_fast64_t> const& ddVariableIndexMapping) {
+    uint64_t numberOfNodes = storm::dd::binary::readUint64(in);
+    STORM_LOG_THROW(numberOfNodes > 0, storm::exceptions::WrongFormatException, "Binary DD encoding without nodes.");
+
+    // All nodes are kept referenced until the root is created.
+    std::vector<MTBDD> nodes;
+    nodes.reserve(numberOfNodes);
+    for (uint64_t position = 0; position < numberOfNodes; ++position) {
+        uint64_t index = storm::dd::binary::readUint64(in);
+        MTBDD node;
+        if (index == storm::dd::binary::LeafMarker) {
+            ValueType value = storm::dd::binary::readValue<ValueType>(in);
+            node = getLeaf(value);
+        } else {
+            uint64_t elsePosition = storm::dd::binary::readUint64(in);
+            uint64_t thenPosition = storm::dd::binary::readUint64(in);
+            STORM_LOG_THROW(index < ddVariableIndexMapping.size() && elsePosition < position && thenPosition < position,
+                            storm::exceptions::WrongFormatException, "Illegal node in binary DD encoding.");
+            uint32_t variable = static_cast<uint32_t>(ddVariableIndexMapping[index]);
+            MTBDD elseSuccessor = nodes[elsePosition];
+            MTBDD thenSuccessor = nodes[thenPosition];
+            if ((mtbdd_isleaf(elseSuccessor) || mtbdd_getvar(elseSuccessor) > variable) &&
+                (mtbdd_isleaf(thenSuccessor) || mtbdd_getvar(thenSuccessor) > variable)) {
+                node = mtbdd_makenode(variable, elseSuccessor, thenSuccessor);
+            } else {
+                // If the variable is no longer above its successors, the node has to be created via if-then-else.
+                MTBDD currentVar = mtbdd_makenode(variable, mtbdd_false, mtbdd_true);
+                mtbdd_refs_push(currentVar);
+                node = mtbdd_ite(currentVar, thenSuccessor, elseSuccessor);
+                mtbdd_refs_pop(1);
+            }
+        }
+        mtbdd_refs_push(node);
+        nodes.push_back(node);
+    }
+    sylvan::Mtbdd result(nodes.back());
+    mtbdd_refs_pop(numberOfNodes);
+    return InternalAdd<DdType::Sylvan, ValueType>(ddManager, result);
+}
+
 template<typename ValueType>
 MTBDD InternalAdd<DdType::Sylvan, ValueType>::fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
                                                             std::vector<ValueType> const& values, Odd const& odd,
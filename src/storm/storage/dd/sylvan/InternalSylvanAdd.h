@@ -1,6 +1,7 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANADD_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANADD_H_
 
+#include <iostream>
 #include <set>
 #include <unordered_map>
 
@@ -518,6 +519,13 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      */
     void exportToText(std::string const& filename) const;
 
+    /*!
+     * Writes the DD as a node table to the given stream (see BinaryEncoding.h).
+     *
+     * @param out The stream to write to. Should be opened in binary mode.
+     */
+    void exportToBinary(std::ostream& out) const;
+
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -653,6 +661,16 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     static InternalAdd<DdType::Sylvan, ValueType> fromVector(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<ValueType> const& values,
                                                              storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
 
+    /*!
+     * Reads an ADD that was written by exportToBinary.
+     *
+     * @param ddManager The manager to use to built the ADD.
+     * @param in The stream to read from.
+     * @param ddVariableIndexMapping Maps the indices of the DD variables in the stream to the indices of the DD variables to use.
+     */
+    static InternalAdd<DdType::Sylvan, ValueType> fromBinary(InternalDdManager<DdType::Sylvan> const* ddManager, std::istream& in,
+                                                             std::vector<uint_fast64_t> const& ddVariableIndexMapping);
+
     /*!
      * Creates an ODD based on the current ADD.
      *
@@ -688,10 +706,11 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
      * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
      * ODD nodes for the same DD and level unique.
-     * @return A pointer to the constructed ODD for the given arguments.
+     * @param builder The builder that stores the nodes of the ODD.
+     * @return The index of the constructed ODD node in the builder.
      */
-    static std::shared_ptr<Odd> createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices,
-                                             std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>>& uniqueTableForLevels);
+    static uint64_t createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices,
+                                 std::vector<std::unordered_map<BDD, uint64_t>>& uniqueTableForLevels, OddBuilder& builder);
 
     /*!
      * Performs a recursive step for forEach.
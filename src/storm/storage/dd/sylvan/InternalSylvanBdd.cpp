@@ -334,14 +334,14 @@ void InternalBdd<DdType::Sylvan>::toVectorRec(BDD dd, storm::storage::BitVector&
 
 Odd InternalBdd<DdType::Sylvan>::createOdd(std::vector<uint_fast64_t> const& ddVariableIndices) const {
     // Prepare a unique table for each level that keeps the constructed ODD nodes unique.
-    std::vector<std::unordered_map<std::pair<BDD, bool>, std::shared_ptr<Odd>, HashFunctor>> uniqueTableForLevels(ddVariableIndices.size() + 1);
+    std::vector<std::unordered_map<std::pair<BDD, bool>, uint64_t, HashFunctor>> uniqueTableForLevels(ddVariableIndices.size() + 1);
 
     // Now construct the ODD structure from the BDD.
-    std::shared_ptr<Odd> rootOdd = createOddRec(bdd_regular(this->getSylvanBdd().GetBDD()), bdd_isnegated(this->getSylvanBdd().GetBDD()), 0,
-                                                ddVariableIndices.size(), ddVariableIndices, uniqueTableForLevels);
+    OddBuilder builder;
+    uint64_t rootOdd = createOddRec(bdd_regular(this->getSylvanBdd().GetBDD()), bdd_isnegated(this->getSylvanBdd().GetBDD()), 0, ddVariableIndices.size(),
+                                    ddVariableIndices, uniqueTableForLevels, builder);
 
-    // Return a copy of the root node to remove the shared_ptr encapsulation.
-    return Odd(*rootOdd);
+    return builder.build(rootOdd);
 }
 
 std::size_t InternalBdd<DdType::Sylvan>::HashFunctor::operator()(std::pair<BDD, bool> const& key) const {
@@ -351,9 +351,9 @@ std::size_t InternalBdd<DdType::Sylvan>::HashFunctor::operator()(std::pair<BDD,
     return result;
 }
 
-std::shared_ptr<Odd> InternalBdd<DdType::Sylvan>::createOddRec(
+uint64_t InternalBdd<DdType::Sylvan>::createOddRec(
     BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices,
-    std::vector<std::unordered_map<std::pair<BDD, bool>, std::shared_ptr<Odd>, HashFunctor>>& uniqueTableForLevels) {
+    std::vector<std::unordered_map<std::pair<BDD, bool>, uint64_t, HashFunctor>>& uniqueTableForLevels, OddBuilder& builder) {
     // Check whether the ODD for this node has already been computed (for this level) and if so, return this instead.
     auto const& iterator = uniqueTableForLevels[currentLevel].find(std::make_pair(dd, complement));
     if (iterator != uniqueTableForLevels[currentLevel].end()) {
@@ -364,7 +364,6 @@ std::shared_ptr<Odd> InternalBdd<DdType::Sylvan>::createOddRec(
         // If we are already at the maximal level that is to be considered, we can simply create an Odd without
         // successors.
         if (currentLevel == maxLevel) {
-            uint_fast64_t elseOffset = 0;
             uint_fast64_t thenOffset = 0;
 
             // If the DD is not the zero leaf, then the then-offset is 1.
@@ -377,16 +376,15 @@ std::shared_ptr<Odd> InternalBdd<DdType::Sylvan>::createOddRec(
                 thenOffset = 1 - thenOffset;
             }
 
-            auto oddNode = std::make_shared<Odd>(nullptr, elseOffset, nullptr, thenOffset);
+            uint64_t oddNode = builder.addTerminalNode(thenOffset);
             uniqueTableForLevels[currentLevel].emplace(std::make_pair(dd, complement), oddNode);
             return oddNode;
         } else if (bdd_isterminal(dd) || ddVariableIndices[currentLevel] < sylvan_var(dd)) {
             // If we skipped the level in the DD, we compute the ODD just for the else-successor and use the same
             // node for the then-successor as well.
-            std::shared_ptr<Odd> elseNode = createOddRec(dd, complement, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode = elseNode;
-            uint_fast64_t totalOffset = elseNode->getElseOffset() + elseNode->getThenOffset();
-            auto oddNode = std::make_shared<Odd>(elseNode, totalOffset, thenNode, totalOffset);
+            uint64_t elseNode = createOddRec(dd, complement, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode = elseNode;
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(std::make_pair(dd, complement), oddNode);
             return oddNode;
         } else {
@@ -398,13 +396,12 @@ std::shared_ptr<Odd> InternalBdd<DdType::Sylvan>::createOddRec(
             bool elseComplemented = bdd_isnegated(elseDdNode) ^ complement;
             bool thenComplemented = bdd_isnegated(thenDdNode) ^ complement;
 
-            std::shared_ptr<Odd> elseNode =
-                createOddRec(bdd_regular(elseDdNode), elseComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
-            std::shared_ptr<Odd> thenNode =
-                createOddRec(bdd_regular(thenDdNode), thenComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels);
+            uint64_t elseNode =
+                createOddRec(bdd_regular(elseDdNode), elseComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
+            uint64_t thenNode =
+                createOddRec(bdd_regular(thenDdNode), thenComplemented, currentLevel + 1, maxLevel, ddVariableIndices, uniqueTableForLevels, builder);
 
-            auto oddNode = std::make_shared<Odd>(elseNode, elseNode->getElseOffset() + elseNode->getThenOffset(), thenNode,
-                                                 thenNode->getElseOffset() + thenNode->getThenOffset());
+            uint64_t oddNode = builder.addNode(elseNode, thenNode);
             uniqueTableForLevels[currentLevel].emplace(std::make_pair(dd, complement), oddNode);
             return oddNode;
         }
@@ -25,6 +25,7 @@ template<DdType LibraryType>
 class InternalDdManager;
 
 class Odd;
+class OddBuilder;
 
 template<>
 class InternalBdd<DdType::Sylvan> {
@@ -447,11 +448,12 @@ class InternalBdd<DdType::Sylvan> {
      * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
      * @param uniqueTableForLevels A vector of unique tables, one for each level to be considered, that keeps
      * ODD nodes for the same DD and level unique.
-     * @return A pointer to the constructed ODD for the given arguments.
+     * @param builder The builder that stores the nodes of the ODD.
+     * @return The index of the constructed ODD node in the builder.
      */
-    static std::shared_ptr<Odd> createOddRec(BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
-                                             std::vector<uint_fast64_t> const& ddVariableIndices,
-                                             std::vector<std::unordered_map<std::pair<BDD, bool>, std::shared_ptr<Odd>, HashFunctor>>& uniqueTableForLevels);
+    static uint64_t createOddRec(BDD dd, bool complement, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
+                                 std::vector<uint_fast64_t> const& ddVariableIndices,
+                                 std::vector<std::unordered_map<std::pair<BDD, bool>, uint64_t, HashFunctor>>& uniqueTableForLevels, OddBuilder& builder);
 
     /*!
      * Helper function to convert the DD into a bit vector.
@@ -4,6 +4,7 @@
 #include <iostream>
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
@@ -42,6 +43,22 @@ VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*
     }
 }
 
+// Executes the functions in [begin, end) by recursively splitting the range into two parallel tasks.
+VOID_TASK_4(execute_sylvan_parallel, std::function<void()> const*, functions, uint64_t, begin, uint64_t, end, std::exception_ptr*, exceptions) {
+    if (end - begin == 1) {
+        try {
+            functions[begin]();
+        } catch (std::exception& exception) {
+            exceptions[begin] = std::current_exception();
+        }
+        return;
+    }
+    uint64_t middle = begin + (end - begin) / 2;
+    SPAWN(execute_sylvan_parallel, functions, begin, middle, exceptions);
+    CALL(execute_sylvan_parallel, functions, middle, end, exceptions);
+    SYNC(execute_sylvan_parallel);
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
@@ -74,6 +91,9 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
                                 "Setting the number of sylvan threads to " << settings.getNumberOfThreads()
                                                                            << " which exceeds the recommended number for your system (" << numThreads << ").");
             numThreads = settings.getNumberOfThreads();
+        } else if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isNumberOfThreadsSet()) {
+            // Lace workers busy-wait for tasks, so Sylvan should not occupy more cores than requested globally.
+            numThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
         }
         lace_start(numThreads, task_deque_size);
 
@@ -268,6 +288,20 @@ void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f)
     }
 }
 
+void InternalDdManager<DdType::Sylvan>::executeInParallel(std::vector<std::function<void()>> const& functions) const {
+    if (functions.empty()) {
+        return;
+    }
+    std::vector<std::exception_ptr> exceptions(functions.size(), nullptr);
+    // As we are called from within a LACE task, this directly executes the task in the current worker.
+    RUN(execute_sylvan_parallel, functions.data(), 0, functions.size(), exceptions.data());
+    for (auto const& e : exceptions) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
+
 uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
     return nextFreeVariableIndex;
 }
@@ -2,6 +2,8 @@
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
 #include <boost/optional.hpp>
+#include <functional>
+#include <vector>
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
@@ -142,6 +144,13 @@ class InternalDdManager<DdType::Sylvan> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Executes the given functions as parallel LACE tasks and waits until all of them are done.
+     *
+     * @param functions the functions that are executed
+     */
+    void executeInParallel(std::vector<std::function<void()>> const& functions) const;
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
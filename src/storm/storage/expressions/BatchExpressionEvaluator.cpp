@@ -0,0 +1,336 @@
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+namespace {
+// The number of valuations that are processed at once. The registers of a block should fit into the cache.
+uint64_t const BlockSize = 256;
+
+bool isSupportedNode(BaseExpression const& expression) {
+    return expression.isBooleanLiteralExpression() || expression.isIntegerLiteralExpression() || expression.isRationalLiteralExpression() ||
+           expression.isVariableExpression() || expression.isIfThenElseExpression() || expression.isBinaryBooleanFunctionExpression() ||
+           expression.isBinaryNumericalFunctionExpression() || expression.isBinaryRelationExpression() || expression.isUnaryBooleanFunctionExpression() ||
+           expression.isUnaryNumericalFunctionExpression() || expression.isPredicateExpression();
+}
+
+bool isSupported(BaseExpression const& expression, std::unordered_set<BaseExpression const*>& checkedSubexpressions) {
+    if (!checkedSubexpressions.insert(&expression).second) {
+        return true;
+    }
+    if (!isSupportedNode(expression)) {
+        return false;
+    }
+    for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+        if (!isSupported(*expression.getOperand(operandIndex), checkedSubexpressions)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline double toDouble(bool value) {
+    return value ? 1.0 : 0.0;
+}
+
+template<typename Operation>
+void applyUnary(double* target, double const* operand, uint64_t size, Operation const& operation) {
+    for (uint64_t index = 0; index < size; ++index) {
+        target[index] = operation(operand[index]);
+    }
+}
+
+template<typename Operation>
+void applyBinary(double* target, double const* first, double const* second, uint64_t size, Operation const& operation) {
+    for (uint64_t index = 0; index < size; ++index) {
+        target[index] = operation(first[index], second[index]);
+    }
+}
+}  // namespace
+
+BatchExpressionEvaluator::BatchExpressionEvaluator(Expression const& expression) {
+    STORM_LOG_THROW(isSupported(expression), storm::exceptions::NotSupportedException,
+                    "The expression " << expression << " can not be evaluated in batches.");
+    std::unordered_map<BaseExpression const*, uint64_t> compiledSubexpressions;
+    compile(expression.getBaseExpression(), compiledSubexpressions);
+}
+
+bool BatchExpressionEvaluator::isSupported(Expression const& expression) {
+    std::unordered_set<BaseExpression const*> checkedSubexpressions;
+    return expression.isInitialized() && storm::expressions::isSupported(expression.getBaseExpression(), checkedSubexpressions);
+}
+
+std::vector<Variable> const& BatchExpressionEvaluator::getVariables() const {
+    return variables;
+}
+
+uint64_t BatchExpressionEvaluator::compile(BaseExpression const& expression, std::unordered_map<BaseExpression const*, uint64_t>& compiledSubexpressions) {
+    auto compiledIt = compiledSubexpressions.find(&expression);
+    if (compiledIt != compiledSubexpressions.end()) {
+        return compiledIt->second;
+    }
+
+    Instruction instruction;
+    if (expression.isBooleanLiteralExpression()) {
+        instruction.opcode = Opcode::Constant;
+        instruction.value = toDouble(expression.asBooleanLiteralExpression().getValue());
+    } else if (expression.isIntegerLiteralExpression()) {
+        instruction.opcode = Opcode::Constant;
+        instruction.value = static_cast<double>(expression.asIntegerLiteralExpression().getValue());
+    } else if (expression.isRationalLiteralExpression()) {
+        instruction.opcode = Opcode::Constant;
+        instruction.value = expression.asRationalLiteralExpression().getValueAsDouble();
+    } else if (expression.isVariableExpression()) {
+        Variable const& variable = expression.asVariableExpression().getVariable();
+        auto insertionResult = variableToColumn.emplace(variable, variables.size());
+        if (insertionResult.second) {
+            variables.push_back(variable);
+        }
+        instruction.opcode = Opcode::Load;
+        instruction.operands.push_back(insertionResult.first->second);
+    } else {
+        for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            instruction.operands.push_back(compile(*expression.getOperand(operandIndex), compiledSubexpressions));
+        }
+        switch (expression.getOperator()) {
+            case OperatorType::And:
+                instruction.opcode = Opcode::And;
+                break;
+            case OperatorType::Or:
+                instruction.opcode = Opcode::Or;
+                break;
+            case OperatorType::Xor:
+                instruction.opcode = Opcode::Xor;
+                break;
+            case OperatorType::Implies:
+                instruction.opcode = Opcode::Implies;
+                break;
+            case OperatorType::Iff:
+                instruction.opcode = Opcode::Iff;
+                break;
+            case OperatorType::Not:
+                instruction.opcode = Opcode::Not;
+                break;
+            case OperatorType::Plus:
+                instruction.opcode = Opcode::Plus;
+                break;
+            case OperatorType::Minus:
+                // The same operator is used for the unary and the binary minus.
+                instruction.opcode = expression.getArity() == 1 ? Opcode::Negate : Opcode::Minus;
+                break;
+            case OperatorType::Times:
+                instruction.opcode = Opcode::Times;
+                break;
+            case OperatorType::Divide:
+                instruction.opcode = Opcode::Divide;
+                break;
+            case OperatorType::Power:
+                instruction.opcode = Opcode::Power;
+                break;
+            case OperatorType::Modulo:
+                instruction.opcode = Opcode::Modulo;
+                break;
+            case OperatorType::Min:
+                instruction.opcode = Opcode::Min;
+                break;
+            case OperatorType::Max:
+                instruction.opcode = Opcode::Max;
+                break;
+            case OperatorType::Floor:
+                instruction.opcode = Opcode::Floor;
+                break;
+            case OperatorType::Ceil:
+                instruction.opcode = Opcode::Ceil;
+                break;
+            case OperatorType::Equal:
+                instruction.opcode = Opcode::Equal;
+                break;
+            case OperatorType::NotEqual:
+                instruction.opcode = Opcode::NotEqual;
+                break;
+            case OperatorType::Less:
+                instruction.opcode = Opcode::Less;
+                break;
+            case OperatorType::LessOrEqual:
+                instruction.opcode = Opcode::LessOrEqual;
+                break;
+            case OperatorType::Greater:
+                instruction.opcode = Opcode::Greater;
+                break;
+            case OperatorType::GreaterOrEqual:
+                instruction.opcode = Opcode::GreaterOrEqual;
+                break;
+            case OperatorType::Ite:
+                instruction.opcode = Opcode::Ite;
+                break;
+            case OperatorType::AtLeastOneOf:
+                instruction.opcode = Opcode::AtLeastOneOf;
+                break;
+            case OperatorType::AtMostOneOf:
+                instruction.opcode = Opcode::AtMostOneOf;
+                break;
+            case OperatorType::ExactlyOneOf:
+                instruction.opcode = Opcode::ExactlyOneOf;
+                break;
+        }
+    }
+
+    program.push_back(std::move(instruction));
+    uint64_t result = program.size() - 1;
+    compiledSubexpressions.emplace(&expression, result);
+    return result;
+}
+
+template<typename Consumer>
+void BatchExpressionEvaluator::execute(uint64_t numberOfValuations, std::vector<double const*> const& columns, Consumer const& consumer) const {
+    STORM_LOG_THROW(columns.size() == variables.size(), storm::exceptions::InvalidArgumentException,
+                    "Expected " << variables.size() << " columns but got " << columns.size() << ".");
+
+    // Every instruction has a register for a block of values. The values of an instruction are accessed through a pointer, such that loads can
+    // refer to the columns directly. Constants are written only once.
+    std::vector<double> registers(program.size() * BlockSize);
+    std::vector<double const*> values(program.size());
+    for (uint64_t index = 0; index < program.size(); ++index) {
+        values[index] = registers.data() + index * BlockSize;
+        if (program[index].opcode == Opcode::Constant) {
+            std::fill(registers.begin() + index * BlockSize, registers.begin() + (index + 1) * BlockSize, program[index].value);
+        }
+    }
+
+    for (uint64_t begin = 0; begin < numberOfValuations; begin += BlockSize) {
+        uint64_t const size = std::min(BlockSize, numberOfValuations - begin);
+        for (uint64_t index = 0; index < program.size(); ++index) {
+            Instruction const& instruction = program[index];
+            double* target = registers.data() + index * BlockSize;
+            auto operand = [&](uint64_t operandIndex) { return values[instruction.operands[operandIndex]]; };
+            switch (instruction.opcode) {
+                case Opcode::Constant:
+                    break;
+                case Opcode::Load:
+                    values[index] = columns[instruction.operands.front()] + begin;
+                    break;
+                case Opcode::And:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a != 0 && b != 0); });
+                    break;
+                case Opcode::Or:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a != 0 || b != 0); });
+                    break;
+                case Opcode::Xor:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble((a != 0) != (b != 0)); });
+                    break;
+                case Opcode::Implies:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a == 0 || b != 0); });
+                    break;
+                case Opcode::Iff:
+                case Opcode::Equal:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a == b); });
+                    break;
+                case Opcode::Not:
+                    applyUnary(target, operand(0), size, [](double a) { return toDouble(a == 0); });
+                    break;
+                case Opcode::Plus:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return a + b; });
+                    break;
+                case Opcode::Minus:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return a - b; });
+                    break;
+                case Opcode::Times:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return a * b; });
+                    break;
+                case Opcode::Divide:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return a / b; });
+                    break;
+                case Opcode::Power:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return std::pow(a, b); });
+                    break;
+                case Opcode::Modulo:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return std::fmod(a, b); });
+                    break;
+                case Opcode::Min:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return std::min(a, b); });
+                    break;
+                case Opcode::Max:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return std::max(a, b); });
+                    break;
+                case Opcode::Negate:
+                    applyUnary(target, operand(0), size, [](double a) { return -a; });
+                    break;
+                case Opcode::Floor:
+                    applyUnary(target, operand(0), size, [](double a) { return std::floor(a); });
+                    break;
+                case Opcode::Ceil:
+                    applyUnary(target, operand(0), size, [](double a) { return std::ceil(a); });
+                    break;
+                case Opcode::NotEqual:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a != b); });
+                    break;
+                case Opcode::Less:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a < b); });
+                    break;
+                case Opcode::LessOrEqual:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a <= b); });
+                    break;
+                case Opcode::Greater:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a > b); });
+                    break;
+                case Opcode::GreaterOrEqual:
+                    applyBinary(target, operand(0), operand(1), size, [](double a, double b) { return toDouble(a >= b); });
+                    break;
+                case Opcode::Ite: {
+                    double const* condition = operand(0);
+                    double const* thenValues = operand(1);
+                    double const* elseValues = operand(2);
+                    for (uint64_t valuation = 0; valuation < size; ++valuation) {
+                        target[valuation] = condition[valuation] != 0 ? thenValues[valuation] : elseValues[valuation];
+                    }
+                    break;
+                }
+                case Opcode::AtLeastOneOf:
+                case Opcode::AtMostOneOf:
+                case Opcode::ExactlyOneOf: {
+                    // Count the operands that are true.
+                    std::fill(target, target + size, 0.0);
+                    for (uint64_t operandIndex = 0; operandIndex < instruction.operands.size(); ++operandIndex) {
+                        applyBinary(target, target, operand(operandIndex), size, [](double count, double a) { return count + toDouble(a != 0); });
+                    }
+                    if (instruction.opcode == Opcode::AtLeastOneOf) {
+                        applyUnary(target, target, size, [](double count) { return toDouble(count >= 1); });
+                    } else if (instruction.opcode == Opcode::AtMostOneOf) {
+                        applyUnary(target, target, size, [](double count) { return toDouble(count <= 1); });
+                    } else {
+                        applyUnary(target, target, size, [](double count) { return toDouble(count == 1); });
+                    }
+                    break;
+                }
+            }
+        }
+        consumer(begin, size, values.back());
+    }
+}
+
+void BatchExpressionEvaluator::evaluate(uint64_t numberOfValuations, std::vector<double const*> const& columns, double* result) const {
+    execute(numberOfValuations, columns, [result](uint64_t begin, uint64_t size, double const* values) { std::copy(values, values + size, result + begin); });
+}
+
+void BatchExpressionEvaluator::evaluateAsBool(uint64_t numberOfValuations, std::vector<double const*> const& columns, storm::storage::BitVector& result,
+                                              uint64_t offset) const {
+    execute(numberOfValuations, columns, [&result, offset](uint64_t begin, uint64_t size, double const* values) {
+        for (uint64_t valuation = 0; valuation < size; ++valuation) {
+            // As for the ExprtkExpressionEvaluator, an expression is true iff its value is one.
+            result.set(offset + begin + valuation, values[valuation] == 1.0);
+        }
+    });
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace storage {
+class BitVector;
+}
+
+namespace expressions {
+class BaseExpression;
+
+/*!
+ * Evaluates an expression for many valuations at once. The expression is compiled once into a small register-based program. The values of the
+ * variables are given column-wise, i.e., as one array of values per variable, and the program is executed on blocks of valuations such
+ * that every instruction is a simple loop over the block that the compiler can vectorize.
+ *
+ * All values are represented as doubles (with booleans being 0 or 1), which matches the semantics of the ExprtkExpressionEvaluator.
+ * Evaluating is thread-safe, i.e., multiple threads may evaluate the same program concurrently.
+ */
+class BatchExpressionEvaluator {
+   public:
+    /*!
+     * Compiles the given expression.
+     *
+     * @param expression The expression to compile. It has to be supported (see isSupported).
+     */
+    BatchExpressionEvaluator(Expression const& expression);
+
+    /*!
+     * Checks whether the given expression can be compiled, i.e., whether it only consists of literals, variables, the standard operators and
+     * if-then-else expressions.
+     */
+    static bool isSupported(Expression const& expression);
+
+    /*!
+     * Retrieves the variables of the expression. The columns that are passed to the evaluation functions have to be given in this order.
+     */
+    std::vector<Variable> const& getVariables() const;
+
+    /*!
+     * Evaluates the expression for the given valuations.
+     *
+     * @param numberOfValuations The number of valuations.
+     * @param columns For every variable (in the order of getVariables()), a pointer to its values in the valuations.
+     * @param result The array to which the values of the expression are written. Has to hold (at least) numberOfValuations values.
+     */
+    void evaluate(uint64_t numberOfValuations, std::vector<double const*> const& columns, double* result) const;
+
+    /*!
+     * Evaluates the (boolean) expression for the given valuations.
+     *
+     * @param numberOfValuations The number of valuations.
+     * @param columns For every variable (in the order of getVariables()), a pointer to its values in the valuations.
+     * @param result The bit vector in which the bit offset + i is set to the truth value of the expression in valuation i.
+     * @param offset The position of the bit that corresponds to the first valuation.
+     */
+    void evaluateAsBool(uint64_t numberOfValuations, std::vector<double const*> const& columns, storm::storage::BitVector& result,
+                        uint64_t offset = 0) const;
+
+   private:
+    enum class Opcode {
+        Constant,
+        Load,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+        Not,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Power,
+        Modulo,
+        Min,
+        Max,
+        Negate,
+        Floor,
+        Ceil,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Ite,
+        AtLeastOneOf,
+        AtMostOneOf,
+        ExactlyOneOf
+    };
+
+    /*!
+     * An instruction writes the register with its own index. The operands refer to registers of previous instructions (or, for loads, to a
+     * column) and the value is only used by constants.
+     */
+    struct Instruction {
+        Opcode opcode;
+        std::vector<uint64_t> operands;
+        double value = 0;
+    };
+
+    /*!
+     * Compiles the given (sub)expression and returns the register that holds its value. Subexpressions that occur more than once (i.e., that
+     * are already contained in the given map) are only compiled once.
+     */
+    uint64_t compile(BaseExpression const& expression, std::unordered_map<BaseExpression const*, uint64_t>& compiledSubexpressions);
+
+    /*!
+     * Executes the program on all valuations block by block and passes the values of the expression for each block to the given consumer.
+     *
+     * @param consumer A callable with signature void(uint64_t begin, uint64_t size, double const* values).
+     */
+    template<typename Consumer>
+    void execute(uint64_t numberOfValuations, std::vector<double const*> const& columns, Consumer const& consumer) const;
+
+    // The instructions of the program. The value of the expression is stored in the register of the last instruction.
+    std::vector<Instruction> program;
+
+    // The variables of the expression and the columns in which their values are given.
+    std::vector<Variable> variables;
+    std::unordered_map<Variable, uint64_t> variableToColumn;
+};
+
+}  // namespace expressions
+}  // namespace storm
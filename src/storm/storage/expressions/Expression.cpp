@@ -35,10 +35,12 @@ Expression::~Expression() {
 }
 
 Expression::Expression(std::shared_ptr<BaseExpression const> const& expressionPtr) : expressionPtr(expressionPtr) {
-    // Intentionally left empty.
+    if (expressionPtr && expressionPtr->getManager().isHashConsingEnabled()) {
+        this->expressionPtr = expressionPtr->getManager().getUniqueExpression(expressionPtr);
+    }
 }
 
-Expression::Expression(Variable const& variable) : expressionPtr(std::shared_ptr<BaseExpression>(new VariableExpression(variable))) {
+Expression::Expression(Variable const& variable) : Expression(std::shared_ptr<BaseExpression>(new VariableExpression(variable))) {
     // Intentionally left empty.
 }
 
@@ -76,6 +78,9 @@ storm::RationalNumber Expression::evaluateAsRational() const {
 }
 
 Expression Expression::simplify() const {
+    if (this->getManager().isHashConsingEnabled()) {
+        return Expression(this->getManager().getSimplifiedExpression(this->getBaseExpressionPointer()));
+    }
     return Expression(this->getBaseExpression().simplify());
 }
 
@@ -69,7 +69,8 @@ ExpressionManager::ExpressionManager()
       numberOfAuxiliaryBitVectorVariables(0),
       numberOfAuxiliaryRationalVariables(0),
       numberOfAuxiliaryArrayVariables(0),
-      freshVariableCounter(0) {
+      freshVariableCounter(0),
+      hashConsing(false) {
     // Intentionally left empty.
 }
 
@@ -344,6 +345,31 @@ std::shared_ptr<ExpressionManager const> ExpressionManager::getSharedPointer() c
     return this->shared_from_this();
 }
 
+void ExpressionManager::setHashConsing(bool value) {
+    hashConsing = value;
+    if (!hashConsing) {
+        uniqueExpressions.clear();
+    }
+}
+
+bool ExpressionManager::isHashConsingEnabled() const {
+    return hashConsing;
+}
+
+uint64_t ExpressionManager::getNumberOfUniqueExpressions() const {
+    return uniqueExpressions.getNumberOfNodes();
+}
+
+std::shared_ptr<BaseExpression const> ExpressionManager::getUniqueExpression(std::shared_ptr<BaseExpression const> const& expression) const {
+    STORM_LOG_ASSERT(hashConsing, "Hash-consing is disabled.");
+    return uniqueExpressions.findOrAdd(expression);
+}
+
+std::shared_ptr<BaseExpression const> ExpressionManager::getSimplifiedExpression(std::shared_ptr<BaseExpression const> const& expression) const {
+    STORM_LOG_ASSERT(hashConsing, "Hash-consing is disabled.");
+    return uniqueExpressions.simplify(expression);
+}
+
 std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager) {
     out << "manager {\n";
 
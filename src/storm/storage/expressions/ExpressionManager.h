@@ -12,6 +12,7 @@
 
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/UniqueExpressionTable.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/OsDetection.h"
 
@@ -395,6 +396,41 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
      */
     std::shared_ptr<ExpressionManager const> getSharedPointer() const;
 
+    /*!
+     * Sets whether the expressions of this manager are hash-consed. If enabled, every expression that is created afterwards is replaced by a
+     * unique, syntactically equal node (if one exists), so equal subexpressions are shared and can be compared by their address. Moreover,
+     * simplifications of unique nodes are cached. Disabling hash-consing releases all unique nodes that are not referenced elsewhere.
+     *
+     * @param value The new value.
+     */
+    void setHashConsing(bool value);
+
+    /*!
+     * Retrieves whether the expressions of this manager are hash-consed.
+     */
+    bool isHashConsingEnabled() const;
+
+    /*!
+     * Retrieves the number of unique expression nodes in case hash-consing is enabled.
+     */
+    uint64_t getNumberOfUniqueExpressions() const;
+
+    /*!
+     * Retrieves the unique node that is syntactically equal to the given one. This may only be called if hash-consing is enabled.
+     *
+     * @param expression The node to look up. If there is no unique equal node yet, it becomes the unique node.
+     * @return The unique node.
+     */
+    std::shared_ptr<BaseExpression const> getUniqueExpression(std::shared_ptr<BaseExpression const> const& expression) const;
+
+    /*!
+     * Retrieves the (cached) simplification of the given node. This may only be called if hash-consing is enabled.
+     *
+     * @param expression The node to simplify.
+     * @return The unique node of the simplified expression.
+     */
+    std::shared_ptr<BaseExpression const> getSimplifiedExpression(std::shared_ptr<BaseExpression const> const& expression) const;
+
     friend std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager);
 
    private:
@@ -487,6 +523,10 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
     mutable boost::optional<Type> rationalType;
     mutable std::unordered_set<Type> arrayTypes;
 
+    // Whether expressions are hash-consed and the table of unique expression nodes.
+    bool hashConsing;
+    mutable UniqueExpressionTable uniqueExpressions;
+
     // A mask that can be used to query whether a variable is an auxiliary variable.
     static const uint64_t auxiliaryMask = (1ull << 50);
 
@@ -12,6 +12,10 @@ bool SyntacticalEqualityCheckVisitor::isSyntacticallyEqual(storm::expressions::E
 
 boost::any SyntacticalEqualityCheckVisitor::visit(IfThenElseExpression const& expression, boost::any const& data) {
     BaseExpression const& otherBaseExpression = boost::any_cast<std::reference_wrapper<BaseExpression const>>(data).get();
+    if (&expression == &otherBaseExpression) {
+        // Shared (e.g. hash-consed) subexpressions are trivially equal.
+        return true;
+    }
     if (otherBaseExpression.isIfThenElseExpression()) {
         IfThenElseExpression const& otherExpression = otherBaseExpression.asIfThenElseExpression();
 
@@ -30,6 +34,9 @@ boost::any SyntacticalEqualityCheckVisitor::visit(IfThenElseExpression const& ex
 
 boost::any SyntacticalEqualityCheckVisitor::visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
     BaseExpression const& otherBaseExpression = boost::any_cast<std::reference_wrapper<BaseExpression const>>(data).get();
+    if (&expression == &otherBaseExpression) {
+        return true;
+    }
     if (otherBaseExpression.isBinaryBooleanFunctionExpression()) {
         BinaryBooleanFunctionExpression const& otherExpression = otherBaseExpression.asBinaryBooleanFunctionExpression();
 
@@ -48,6 +55,9 @@ boost::any SyntacticalEqualityCheckVisitor::visit(BinaryBooleanFunctionExpressio
 
 boost::any SyntacticalEqualityCheckVisitor::visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
     BaseExpression const& otherBaseExpression = boost::any_cast<std::reference_wrapper<BaseExpression const>>(data).get();
+    if (&expression == &otherBaseExpression) {
+        return true;
+    }
     if (otherBaseExpression.isBinaryNumericalFunctionExpression()) {
         BinaryNumericalFunctionExpression const& otherExpression = otherBaseExpression.asBinaryNumericalFunctionExpression();
 
@@ -66,6 +76,9 @@ boost::any SyntacticalEqualityCheckVisitor::visit(BinaryNumericalFunctionExpress
 
 boost::any SyntacticalEqualityCheckVisitor::visit(BinaryRelationExpression const& expression, boost::any const& data) {
     BaseExpression const& otherBaseExpression = boost::any_cast<std::reference_wrapper<BaseExpression const>>(data).get();
+    if (&expression == &otherBaseExpression) {
+        return true;
+    }
     if (otherBaseExpression.isBinaryRelationExpression()) {
         BinaryRelationExpression const& otherExpression = otherBaseExpression.asBinaryRelationExpression();
 
@@ -94,6 +107,9 @@ boost::any SyntacticalEqualityCheckVisitor::visit(VariableExpression const& expr
 
 boost::any SyntacticalEqualityCheckVisitor::visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
     BaseExpression const& otherBaseExpression = boost::any_cast<std::reference_wrapper<BaseExpression const>>(data).get();
+    if (&expression == &otherBaseExpression) {
+        return true;
+    }
     if (otherBaseExpression.isUnaryBooleanFunctionExpression()) {
         UnaryBooleanFunctionExpression const& otherExpression = otherBaseExpression.asUnaryBooleanFunctionExpression();
 
@@ -109,6 +125,9 @@ boost::any SyntacticalEqualityCheckVisitor::visit(UnaryBooleanFunctionExpression
 
 boost::any SyntacticalEqualityCheckVisitor::visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
     BaseExpression const& otherBaseExpression = boost::any_cast<std::reference_wrapper<BaseExpression const>>(data).get();
+    if (&expression == &otherBaseExpression) {
+        return true;
+    }
     if (otherBaseExpression.isUnaryNumericalFunctionExpression()) {
         UnaryNumericalFunctionExpression const& otherExpression = otherBaseExpression.asUnaryNumericalFunctionExpression();
 
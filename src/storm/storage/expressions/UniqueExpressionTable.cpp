@@ -0,0 +1,148 @@
+#include "storm/storage/expressions/UniqueExpressionTable.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/storage/expressions/Expressions.h"
+
+namespace storm {
+namespace expressions {
+
+namespace {
+// The kinds of nodes that are hash-consed.
+enum class NodeKind { None, BooleanLiteral, IntegerLiteral, RationalLiteral, Variable, Function };
+
+NodeKind getKind(BaseExpression const& expression) {
+    if (expression.isBooleanLiteralExpression()) {
+        return NodeKind::BooleanLiteral;
+    } else if (expression.isIntegerLiteralExpression()) {
+        return NodeKind::IntegerLiteral;
+    } else if (expression.isRationalLiteralExpression()) {
+        return NodeKind::RationalLiteral;
+    } else if (expression.isVariableExpression()) {
+        return NodeKind::Variable;
+    } else if (expression.isIfThenElseExpression() || expression.isBinaryBooleanFunctionExpression() || expression.isBinaryNumericalFunctionExpression() ||
+               expression.isBinaryRelationExpression() || expression.isUnaryBooleanFunctionExpression() ||
+               expression.isUnaryNumericalFunctionExpression() || expression.isPredicateExpression()) {
+        return NodeKind::Function;
+    }
+    return NodeKind::None;
+}
+}  // namespace
+
+UniqueExpressionTable::UniqueExpressionTable(UniqueExpressionTable const&) : UniqueExpressionTable() {
+    // Intentionally left empty.
+}
+
+UniqueExpressionTable& UniqueExpressionTable::operator=(UniqueExpressionTable const& other) {
+    if (this != &other) {
+        clear();
+    }
+    return *this;
+}
+
+std::size_t UniqueExpressionTable::NodeHash::operator()(std::shared_ptr<BaseExpression const> const& expression) const {
+    NodeKind kind = getKind(*expression);
+    std::size_t seed = static_cast<std::size_t>(kind);
+    boost::hash_combine(seed, expression->getType().getMask());
+    switch (kind) {
+        case NodeKind::None:
+            boost::hash_combine(seed, expression.get());
+            break;
+        case NodeKind::BooleanLiteral:
+            boost::hash_combine(seed, expression->asBooleanLiteralExpression().getValue());
+            break;
+        case NodeKind::IntegerLiteral:
+            boost::hash_combine(seed, expression->asIntegerLiteralExpression().getValue());
+            break;
+        case NodeKind::RationalLiteral:
+            // Equal rationals have the same double representation.
+            boost::hash_combine(seed, expression->asRationalLiteralExpression().getValueAsDouble());
+            break;
+        case NodeKind::Variable:
+            boost::hash_combine(seed, expression->asVariableExpression().getVariable().getIndex());
+            break;
+        case NodeKind::Function:
+            boost::hash_combine(seed, static_cast<int>(expression->getOperator()));
+            for (uint_fast64_t operandIndex = 0; operandIndex < expression->getArity(); ++operandIndex) {
+                boost::hash_combine(seed, expression->getOperand(operandIndex).get());
+            }
+            break;
+    }
+    return seed;
+}
+
+bool UniqueExpressionTable::NodeEqual::operator()(std::shared_ptr<BaseExpression const> const& first,
+                                                   std::shared_ptr<BaseExpression const> const& second) const {
+    if (first == second) {
+        return true;
+    }
+    NodeKind kind = getKind(*first);
+    if (kind == NodeKind::None || kind != getKind(*second) || !(first->getType() == second->getType())) {
+        return false;
+    }
+    switch (kind) {
+        case NodeKind::BooleanLiteral:
+            return first->asBooleanLiteralExpression().getValue() == second->asBooleanLiteralExpression().getValue();
+        case NodeKind::IntegerLiteral:
+            return first->asIntegerLiteralExpression().getValue() == second->asIntegerLiteralExpression().getValue();
+        case NodeKind::RationalLiteral:
+            return first->asRationalLiteralExpression().getValue() == second->asRationalLiteralExpression().getValue();
+        case NodeKind::Variable:
+            return first->asVariableExpression().getVariable() == second->asVariableExpression().getVariable();
+        default:
+            break;
+    }
+
+    if (first->getOperator() != second->getOperator() || first->getArity() != second->getArity()) {
+        return false;
+    }
+    for (uint_fast64_t operandIndex = 0; operandIndex < first->getArity(); ++operandIndex) {
+        if (first->getOperand(operandIndex) != second->getOperand(operandIndex)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::findOrAdd(std::shared_ptr<BaseExpression const> const& expression) {
+    if (!expression || getKind(*expression) == NodeKind::None) {
+        return expression;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    return *nodes.insert(expression).first;
+}
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::simplify(std::shared_ptr<BaseExpression const> const& expression) {
+    bool isUniqueNode;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto simplificationIt = simplifications.find(expression.get());
+        if (simplificationIt != simplifications.end()) {
+            return simplificationIt->second;
+        }
+        auto nodeIt = nodes.find(expression);
+        isUniqueNode = nodeIt != nodes.end() && *nodeIt == expression;
+    }
+
+    // The simplification creates new expressions (and thereby accesses the table), so we must not hold the lock here.
+    std::shared_ptr<BaseExpression const> result = findOrAdd(expression->simplify());
+    if (isUniqueNode) {
+        std::lock_guard<std::mutex> lock(mutex);
+        simplifications.emplace(expression.get(), result);
+    }
+    return result;
+}
+
+uint64_t UniqueExpressionTable::getNumberOfNodes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return nodes.size();
+}
+
+void UniqueExpressionTable::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    simplifications.clear();
+    nodes.clear();
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace storm {
+namespace expressions {
+class BaseExpression;
+
+/*!
+ * A table of unique expression nodes that is used by an expression manager to hash-cons its expressions. Two nodes are considered equal if they
+ * are of the same kind and type, have the same value, variable or operator and if their operands are the very same nodes. As all operands of
+ * hash-consed nodes are unique nodes themselves, this coincides with syntactical equality, but can be checked without traversing the operands.
+ *
+ * Only the nodes defined in this module (literals, variables, functions, if-then-else and predicates) are hash-consed. All other nodes are
+ * passed through unchanged. All operations of the table are thread-safe.
+ */
+class UniqueExpressionTable {
+   public:
+    UniqueExpressionTable() = default;
+
+    /*!
+     * Creates an empty table, because the nodes of the other table belong to another manager.
+     */
+    UniqueExpressionTable(UniqueExpressionTable const& other);
+
+    /*!
+     * Clears this table, because the nodes of the other table belong to another manager.
+     */
+    UniqueExpressionTable& operator=(UniqueExpressionTable const& other);
+
+    /*!
+     * Retrieves the unique node that is equal to the given node. If there is none, the given node becomes the unique node.
+     *
+     * @param expression The node to look up.
+     * @return The unique node equal to the given one (or the given node itself if it cannot be hash-consed).
+     */
+    std::shared_ptr<BaseExpression const> findOrAdd(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the simplification of the given node. For unique nodes, the (hash-consed) result is computed only once.
+     *
+     * @param expression The node to simplify.
+     * @return The simplified node.
+     */
+    std::shared_ptr<BaseExpression const> simplify(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the number of unique nodes.
+     */
+    uint64_t getNumberOfNodes() const;
+
+    /*!
+     * Removes all nodes (and simplifications) from the table.
+     */
+    void clear();
+
+   private:
+    struct NodeHash {
+        std::size_t operator()(std::shared_ptr<BaseExpression const> const& expression) const;
+    };
+
+    struct NodeEqual {
+        bool operator()(std::shared_ptr<BaseExpression const> const& first, std::shared_ptr<BaseExpression const> const& second) const;
+    };
+
+    mutable std::mutex mutex;
+
+    // The unique nodes. Note that the table owns the nodes, so their addresses remain valid keys for the simplifications.
+    std::unordered_set<std::shared_ptr<BaseExpression const>, NodeHash, NodeEqual> nodes;
+
+    // The simplifications of the unique nodes.
+    std::unordered_map<BaseExpression const*, std::shared_ptr<BaseExpression const>> simplifications;
+};
+
+}  // namespace expressions
+}  // namespace storm
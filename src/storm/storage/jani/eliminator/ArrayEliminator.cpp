@@ -1,6 +1,7 @@
 #include "ArrayEliminator.h"
 
 #include <unordered_map>
+#include <vector>
 
 #include "storm/storage/expressions/ExpressionVisitor.h"
 #include "storm/storage/jani/Model.h"
@@ -461,7 +462,32 @@ class ArrayEliminatorDataCollector : public JaniTraverser {
     bool converged;
 };
 
-/// Eliminates the array accesses in the given expression, for example  ([[1],[2,3]])[i][j]  --> i=0 ? [1][j] : [2,3][j] --> i=0 ? 1 : (j=0 ? 2 : 3)
+/*!
+ * Builds an expression that yields the element whose index coincides with the value of the given index expression. The elements (sorted by their
+ * indices) are arranged in a balanced tree of if-then-else expressions, so evaluating the result takes a logarithmic number of comparisons in the
+ * number of elements. If the index expression evaluates to an index without element, the result is one of the elements with a neighbouring index.
+ */
+storm::expressions::Expression selectElementByIndex(storm::expressions::Expression const& indexExpr,
+                                                    std::vector<std::pair<uint64_t, storm::expressions::Expression>> const& elements, uint64_t begin,
+                                                    uint64_t end) {
+    STORM_LOG_ASSERT(begin < end, "Expected at least one element.");
+    if (begin + 1 == end) {
+        return elements[begin].second;
+    }
+    uint64_t const middle = begin + (end - begin) / 2;
+    return storm::expressions::ite(indexExpr < indexExpr.getManager().integer(elements[middle].first),
+                                   selectElementByIndex(indexExpr, elements, begin, middle), selectElementByIndex(indexExpr, elements, middle, end));
+}
+
+storm::expressions::Expression selectElementByIndex(storm::expressions::Expression const& indexExpr,
+                                                    std::vector<std::pair<uint64_t, storm::expressions::Expression>> const& elements) {
+    if (elements.empty()) {
+        return storm::expressions::Expression();
+    }
+    return selectElementByIndex(indexExpr, elements, 0, elements.size());
+}
+
+/// Eliminates the array accesses in the given expression, for example  ([[1],[2,3]])[i][j]  --> i<1 ? [1][j] : [2,3][j] --> i<1 ? 1 : (j<1 ? 2 : 3)
 class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionVisitor, public storm::expressions::JaniExpressionVisitor {
    public:
     using storm::expressions::ExpressionVisitor::visit;
@@ -627,22 +653,17 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
         } else {
             STORM_LOG_ASSERT(!replacement.isVariable(), "Are there too many nested array accesses?");
             auto indexExpr = indices[pos - 1];
-            storm::expressions::Expression result;
             if (indexExpr.containsVariables()) {
+                std::vector<std::pair<uint64_t, storm::expressions::Expression>> elements;
                 for (uint64_t index = 0; index < replacement.size(); ++index) {
                     auto child = varElimHelper(replacement.at(index), indices, pos - 1);
                     if (child.isInitialized()) {  // i.e. there is no out-of-bounds situation for the child
-                        if (result.isInitialized()) {
-                            auto currIndexExpr = (indexExpr == indexExpr.getManager().integer(index));
-                            result = storm::expressions::ite(currIndexExpr, child, result);
-                        } else {
-                            result = child;
-                        }
+                        elements.emplace_back(index, std::move(child));
                     }
                 }
-                // At this point result remains uninitialized iff all childs are uninitialized (i.e. out-of-bounds).
+                // The result remains uninitialized iff all childs are uninitialized (i.e. out-of-bounds).
                 // The underlying assumption here is that indexExpr will never evaluate to an index where the access is out-of-bounds.
-                return result;
+                return selectElementByIndex(indexExpr, elements);
             } else {
                 auto index = static_cast<uint64_t>(indexExpr.evaluateAsInt());
                 if (index < replacement.size()) {
@@ -741,18 +762,14 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
             STORM_LOG_THROW(!expression.size()->containsVariables(), storm::exceptions::NotSupportedException,
                             "Unable to eliminate array expression of unknown size.");
             auto exprSize = static_cast<uint64_t>(expression.size()->evaluateAsInt());
-            storm::expressions::Expression result;
+            std::vector<std::pair<uint64_t, storm::expressions::Expression>> elements;
             for (uint64_t index = 0; index < exprSize; ++index) {
                 auto child = boost::any_cast<ResultType>(expression.at(index)->accept(*this, &childIndices));
                 if (!child.isArrayOutOfBounds()) {
-                    if (result.isInitialized()) {
-                        auto currIndexExpr = (indexExpr == indexExpr.getManager().integer(index));
-                        result = storm::expressions::ite(currIndexExpr, child.expr()->toExpression(), result);
-                    } else {
-                        result = child.expr()->toExpression();
-                    }
+                    elements.emplace_back(index, child.expr()->toExpression());
                 }
             }
+            storm::expressions::Expression result = selectElementByIndex(indexExpr, elements);
             if (result.isInitialized()) {
                 return ResultType(result.getBaseExpressionPointer());
             } else {
@@ -1,4 +1,5 @@
 #include "EliminateAction.h"
+#include <algorithm>
 #include <boost/format.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include "storm/exceptions/NotImplementedException.h"
@@ -7,6 +8,29 @@
 namespace storm {
 namespace jani {
 namespace elimination_actions {
+namespace {
+// A destination of an edge that is created during the elimination.
+struct NewDestination {
+    uint64_t locationIndex;
+    expressions::Expression probability;
+    OrderedAssignments assignments;
+};
+
+// Adds the given destination to the destinations of a new edge. If there already is a destination with the same location and the same
+// assignments, the probability is added to the probability of that destination instead.
+void addDestination(std::vector<NewDestination>& destinations, uint64_t locationIndex, expressions::Expression const& probability,
+                    OrderedAssignments&& assignments) {
+    for (auto& destination : destinations) {
+        if (destination.locationIndex == locationIndex && destination.assignments.getNumberOfAssignments() == assignments.getNumberOfAssignments() &&
+            std::equal(destination.assignments.begin(), destination.assignments.end(), assignments.begin())) {
+            destination.probability = (destination.probability + probability).simplify();
+            return;
+        }
+    }
+    destinations.push_back(NewDestination{locationIndex, probability, std::move(assignments)});
+}
+}  // namespace
+
 EliminateAction::EliminateAction(const std::string& automatonName, const std::string& locationName) {
     this->automatonName = automatonName;
     this->locationName = locationName;
@@ -38,7 +62,7 @@ void EliminateAction::doAction(JaniLocalEliminator::Session& session) {
     uint64_t stepsWithoutChange = 0;
     std::vector<Edge>& edges = automaton.getEdges();
     while (stepsWithoutChange <= edges.size()) {
-        Edge edge = edges[edgeIndex];
+        Edge const& edge = edges[edgeIndex];
 
         if (edge.getGuard().containsVariables() || edge.getGuard().evaluateAsBool()) {
             uint64_t destCount = edge.getNumberOfDestinations();
@@ -90,16 +114,16 @@ void EliminateAction::eliminateDestination(JaniLocalEliminator::Session& session
             continue;
 
         expressions::Expression newGuard = session.getNewGuard(edge, dest, outEdge);
-        std::shared_ptr<storm::jani::TemplateEdge> templateEdge = std::make_shared<storm::jani::TemplateEdge>(newGuard);
-        std::vector<std::pair<uint64_t, storm::expressions::Expression>> destinationLocationsAndProbabilities;
-        for (const EdgeDestination& outDest : outEdge.getDestinations()) {
-            expressions::Expression probability = session.getProbability(dest, outDest);
-
-            OrderedAssignments oa = session.executeInSequence(dest, outDest, session.rewardModels);
-            TemplateEdgeDestination templateEdgeDestination(oa);
-            templateEdge->addDestination(templateEdgeDestination);
+        if (newGuard.isFalse()) {
+            // The outgoing edge can never be taken after this destination.
+            continue;
+        }
 
-            destinationLocationsAndProbabilities.emplace_back(outDest.getLocationIndex(), probability);
+        // Destinations that are reached with the same assignments are merged.
+        std::vector<NewDestination> newDestinations;
+        for (const EdgeDestination& outDest : outEdge.getDestinations()) {
+            addDestination(newDestinations, outDest.getLocationIndex(), session.getProbability(dest, outDest),
+                           session.executeInSequence(dest, outDest, session.rewardModels));
         }
 
         // Add remaining destinations back to the edge:
@@ -108,10 +132,15 @@ void EliminateAction::eliminateDestination(JaniLocalEliminator::Session& session
             if (i == destIndex)
                 continue;
             const EdgeDestination& unchangedDest = edge.getDestination(i);
-            OrderedAssignments oa(unchangedDest.getOrderedAssignments().clone());
-            TemplateEdgeDestination templateEdgeDestination(oa);
-            templateEdge->addDestination(templateEdgeDestination);
-            destinationLocationsAndProbabilities.emplace_back(unchangedDest.getLocationIndex(), unchangedDest.getProbability());
+            addDestination(newDestinations, unchangedDest.getLocationIndex(), unchangedDest.getProbability(),
+                           OrderedAssignments(unchangedDest.getOrderedAssignments().clone()));
+        }
+
+        std::shared_ptr<storm::jani::TemplateEdge> templateEdge = std::make_shared<storm::jani::TemplateEdge>(newGuard);
+        std::vector<std::pair<uint64_t, storm::expressions::Expression>> destinationLocationsAndProbabilities;
+        for (auto& newDestination : newDestinations) {
+            templateEdge->addDestination(TemplateEdgeDestination(std::move(newDestination.assignments)));
+            destinationLocationsAndProbabilities.emplace_back(newDestination.locationIndex, newDestination.probability);
         }
 
         STORM_LOG_THROW(!edge.hasRate() && !outEdge.hasRate(), storm::exceptions::NotImplementedException, "Edge Rates are not implemented");
@@ -1,6 +1,9 @@
 #include "EliminateAutomaticallyAction.h"
 #include "EliminateAction.h"
 
+#include <limits>
+#include <map>
+
 #include "storm/exceptions/NotImplementedException.h"
 
 namespace storm {
@@ -76,44 +79,72 @@ void EliminateAutomaticallyAction::doAction(JaniLocalEliminator::Session& sessio
 
             bool done = false;
             while (!done) {
-                uint64_t minNewEdges = 18446744073709551615U;  // max value of uint64
+                // Estimate the effect of eliminating each location. Eliminating a location l replaces every edge with k destinations leading
+                // to l by outgoing(l)^k new edges and removes the outgoing edges of l. We compute these estimates for all locations with a
+                // single pass over the edges and choose the location for which the number of edges grows the least. Edges whose guard is
+                // false (e.g. those that were replaced by previous eliminations) are ignored.
+                std::vector<uint64_t> outgoing(automaton->getNumberOfLocations(), 0);
+                for (const auto& edge : automaton->getEdges()) {
+                    if (!edge.getGuard().isFalse()) {
+                        ++outgoing[edge.getSourceLocationIndex()];
+                    }
+                }
+                std::vector<uint64_t> newEdgeCounts(automaton->getNumberOfLocations(), 0);
+                std::vector<uint64_t> replacedEdgeCounts(automaton->getNumberOfLocations(), 0);
+                std::map<uint64_t, uint64_t> destinationMultiplicities;
+                for (const auto& edge : automaton->getEdges()) {
+                    if (edge.getGuard().isFalse()) {
+                        continue;
+                    }
+                    destinationMultiplicities.clear();
+                    for (const auto& dest : edge.getDestinations()) {
+                        ++destinationMultiplicities[dest.getLocationIndex()];
+                    }
+                    for (auto const& locationAndMultiplicity : destinationMultiplicities) {
+                        uint64_t addedTransitions = 1;
+                        for (uint64_t i = 0; i < locationAndMultiplicity.second; ++i) {
+                            addedTransitions *= outgoing[locationAndMultiplicity.first];
+                            // Stop once we hit the threshold -- otherwise there is a risk of causing
+                            // an overflow due to the exponential growth of addedTransitions:
+                            if (addedTransitions > transitionCountThreshold) {
+                                addedTransitions = transitionCountThreshold + 1ull;
+                                break;
+                            }
+                        }
+                        newEdgeCounts[locationAndMultiplicity.first] += addedTransitions;
+                        ++replacedEdgeCounts[locationAndMultiplicity.first];
+                    }
+                }
+
+                uint64_t minNewEdges = std::numeric_limits<uint64_t>::max();
+                uint64_t minExceedingNewEdges = std::numeric_limits<uint64_t>::max();
+                int64_t minEdgeGrowth = std::numeric_limits<int64_t>::max();
                 int bestLocIndex = -1;
                 for (const auto& loc : automaton->getLocations()) {
                     if (uneliminable[loc.getName()])
                         continue;
 
                     auto locIndex = automaton->getLocationIndex(loc.getName());
-                    uint64_t outgoing = automaton->getEdgesFromLocation(locIndex).size();
-                    uint64_t incoming = 0;
-                    for (const auto& edge : automaton->getEdges()) {
-                        uint64_t addedTransitions = 1;
-                        for (const auto& dest : edge.getDestinations()) {
-                            if (dest.getLocationIndex() == locIndex) {
-                                addedTransitions *= outgoing;
-                                // Stop once we hit the threshold -- otherwise there is a risk of causing
-                                // an overflow due to the exponential growth of addedTransitions:
-                                if (addedTransitions > transitionCountThreshold) {
-                                    break;
-                                }
-                            }
-                        }
-                        incoming += addedTransitions - 1;
+                    if (newEdgeCounts[locIndex] > transitionCountThreshold) {
+                        minExceedingNewEdges = std::min(minExceedingNewEdges, newEdgeCounts[locIndex]);
+                        continue;
                     }
-                    uint64_t newEdges = incoming * outgoing;
-
-                    if (newEdges <= minNewEdges) {
-                        minNewEdges = newEdges;
+                    int64_t edgeGrowth = static_cast<int64_t>(newEdgeCounts[locIndex]) - static_cast<int64_t>(replacedEdgeCounts[locIndex]) -
+                                         static_cast<int64_t>(outgoing[locIndex]);
+                    if (edgeGrowth <= minEdgeGrowth) {
+                        minEdgeGrowth = edgeGrowth;
+                        minNewEdges = newEdgeCounts[locIndex];
                         bestLocIndex = locIndex;
                     }
                 }
 
-                if (bestLocIndex == -1) {
+                if (bestLocIndex == -1 && minExceedingNewEdges == std::numeric_limits<uint64_t>::max()) {
                     done = true;
                     STORM_LOG_TRACE("Cannot eliminate more locations");
-                } else if (minNewEdges > transitionCountThreshold) {
+                } else if (bestLocIndex == -1) {
                     done = true;
-                    STORM_LOG_TRACE("Cannot eliminate more locations without creating too many new transitions (best: " + std::to_string(minNewEdges) +
-                                    " new transitions)");
+                    STORM_LOG_TRACE("Cannot eliminate more locations without creating too many new transitions (best: " +
+                                    std::to_string(minExceedingNewEdges) + " new transitions)");
                 } else {
                     std::string locName = automaton->getLocation(bestLocIndex).getName();
                     STORM_LOG_TRACE("\tEliminating location " + locName + " (" + std::to_string(minNewEdges) + " new edges)");
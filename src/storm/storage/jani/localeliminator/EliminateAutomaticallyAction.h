@@ -4,7 +4,8 @@
 
 // EliminateAutomaticallyAction determines which locations can be eliminated in the given automaton and automatically eliminates them, until doing so would
 // create too many new transitions. The elimination order can be specified, with NewTransitionCount recommended in most cases, since it produces smaller
-// models (at increased runtime cost).
+// models (at increased runtime cost). NewTransitionCount always eliminates the location whose elimination increases the number of edges the least, i.e.
+// for which the number of new edges minus the number of edges that are replaced by them is minimal.
 
 namespace storm {
 namespace jani {
@@ -80,7 +80,7 @@ bool JaniLocalEliminator::Session::isEliminable(const std::string &automatonName
 bool JaniLocalEliminator::Session::hasLoops(const std::string &automatonName, std::string const &locationName) {
     Automaton &automaton = model.getAutomaton(automatonName);
     uint64_t locationIndex = automaton.getLocationIndex(locationName);
-    for (Edge edge : automaton.getEdgesFromLocation(locationIndex)) {
+    for (const Edge &edge : automaton.getEdgesFromLocation(locationIndex)) {
         for (const EdgeDestination &dest : edge.getDestinations()) {
             if (dest.getLocationIndex() == locationIndex)
                 return true;
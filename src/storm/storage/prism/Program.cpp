@@ -2,7 +2,11 @@
 
 #include <algorithm>
 #include <boost/algorithm/string/join.hpp>
+#include <limits>
+#include <mutex>
 #include <sstream>
+#include <tuple>
+#include <unordered_map>
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
@@ -15,8 +19,10 @@
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/solver/SmtSolver.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/VariableExpression.h"
 #include "storm/storage/jani/visitor/JaniExpressionSubstitutionVisitor.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -1899,7 +1905,196 @@ Program Program::simplify() {
                    this->getOptionalSystemCompositionConstruct(), prismCompatibility);
 }
 
-Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory) const {
+namespace {
+/*!
+ * The bounds on the values of integer and Boolean variables (the latter are encoded as 0 and 1) that are implied by a guard.
+ */
+typedef std::vector<std::tuple<storm::expressions::Variable, int64_t, int64_t>> GuardBounds;
+
+/*!
+ * Gathers the bounds implied by the conjuncts of the given guard that are of the form `x ~ c`, `b` or `!b`, where c is an integer
+ * expression without variables. All other conjuncts are ignored, so the bounds are an over-approximation of the guard.
+ */
+void gatherGuardBounds(storm::expressions::Expression const& guard, GuardBounds& bounds) {
+    int64_t const minimum = std::numeric_limits<int64_t>::min();
+    int64_t const maximum = std::numeric_limits<int64_t>::max();
+    if (guard.isVariable()) {
+        if (guard.hasBooleanType()) {
+            bounds.emplace_back(guard.getBaseExpression().asVariableExpression().getVariable(), 1, 1);
+        }
+        return;
+    }
+    if (!guard.isFunctionApplication()) {
+        return;
+    }
+
+    storm::expressions::OperatorType operatorType = guard.getOperator();
+    if (operatorType == storm::expressions::OperatorType::And) {
+        for (uint_fast64_t operandIndex = 0; operandIndex < guard.getArity(); ++operandIndex) {
+            gatherGuardBounds(guard.getOperand(operandIndex), bounds);
+        }
+    } else if (operatorType == storm::expressions::OperatorType::Not) {
+        storm::expressions::Expression operand = guard.getOperand(0);
+        if (operand.isVariable() && operand.hasBooleanType()) {
+            bounds.emplace_back(operand.getBaseExpression().asVariableExpression().getVariable(), 0, 0);
+        }
+    } else if (operatorType == storm::expressions::OperatorType::Equal || operatorType == storm::expressions::OperatorType::Less ||
+               operatorType == storm::expressions::OperatorType::LessOrEqual || operatorType == storm::expressions::OperatorType::Greater ||
+               operatorType == storm::expressions::OperatorType::GreaterOrEqual) {
+        storm::expressions::Expression variableSide = guard.getOperand(0);
+        storm::expressions::Expression valueSide = guard.getOperand(1);
+        if (!variableSide.isVariable()) {
+            // Mirror the relation such that the variable is on the left-hand side.
+            std::swap(variableSide, valueSide);
+            if (operatorType == storm::expressions::OperatorType::Less) {
+                operatorType = storm::expressions::OperatorType::Greater;
+            } else if (operatorType == storm::expressions::OperatorType::LessOrEqual) {
+                operatorType = storm::expressions::OperatorType::GreaterOrEqual;
+            } else if (operatorType == storm::expressions::OperatorType::Greater) {
+                operatorType = storm::expressions::OperatorType::Less;
+            } else if (operatorType == storm::expressions::OperatorType::GreaterOrEqual) {
+                operatorType = storm::expressions::OperatorType::LessOrEqual;
+            }
+        }
+        if (!variableSide.isVariable() || !variableSide.hasIntegerType() || !valueSide.hasIntegerType() || valueSide.containsVariables()) {
+            return;
+        }
+
+        storm::expressions::Variable const& variable = variableSide.getBaseExpression().asVariableExpression().getVariable();
+        int64_t value = valueSide.evaluateAsInt();
+        if (operatorType == storm::expressions::OperatorType::Equal) {
+            bounds.emplace_back(variable, value, value);
+        } else if (operatorType == storm::expressions::OperatorType::Less) {
+            // An empty range if nothing is smaller than the value.
+            bounds.emplace_back(variable, value == minimum ? maximum : minimum, value == minimum ? minimum : value - 1);
+        } else if (operatorType == storm::expressions::OperatorType::LessOrEqual) {
+            bounds.emplace_back(variable, minimum, value);
+        } else if (operatorType == storm::expressions::OperatorType::Greater) {
+            bounds.emplace_back(variable, value == maximum ? maximum : value + 1, value == maximum ? minimum : maximum);
+        } else {
+            bounds.emplace_back(variable, value, maximum);
+        }
+    }
+}
+
+/*!
+ * Enumerates the combinations of commands (one of each module) whose guards can be enabled at the same time. The combinations are
+ * explored depth-first by adding the guard of one module after the other. A partial combination is discarded as soon as the bounds
+ * implied by its guards contradict each other and only then the SMT solver is asked. The solver is not asked either if the new guard
+ * does not share variables with the previous guards, as the guards of all commands are known to be satisfiable on their own.
+ */
+class CommandCombinationEnumerator {
+   public:
+    /*!
+     * @param guards The guard of every command of every module.
+     * @param guardBounds The bounds implied by the guards.
+     * @param guardVariables The variables of the guards, except for the defined constants (which have a fixed value).
+     * @param solver A solver on whose assertion stack are (exactly) the values of the constants and the bounds of the variables.
+     * @param managerMutex A mutex that is held while expressions are translated for the solver, because the translation may add
+     * auxiliary variables to the (shared) expression manager.
+     */
+    CommandCombinationEnumerator(std::vector<std::vector<storm::expressions::Expression>> const& guards,
+                                 std::vector<std::vector<GuardBounds>> const& guardBounds,
+                                 std::vector<std::vector<std::set<storm::expressions::Variable>>> const& guardVariables, storm::solver::SmtSolver& solver,
+                                 std::mutex& managerMutex)
+        : guards(guards), guardBounds(guardBounds), guardVariables(guardVariables), solver(solver), managerMutex(managerMutex) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Enumerates the combinations that contain the given command of the first module.
+     *
+     * @return For each combination the indices of the chosen commands within the modules.
+     */
+    std::vector<std::vector<uint_fast64_t>> enumerate(uint_fast64_t firstCommand) {
+        result.clear();
+        visit(0, firstCommand);
+        return std::move(result);
+    }
+
+   private:
+    void visit(uint_fast64_t module, uint_fast64_t command) {
+        uint_fast64_t undoSize = boundsUndoStack.size();
+        if (intersectBounds(guardBounds[module][command])) {
+            std::set<storm::expressions::Variable> const& variables = guardVariables[module][command];
+            bool dependent = std::any_of(variables.begin(), variables.end(),
+                                         [this](storm::expressions::Variable const& variable) { return prefixVariables.count(variable) > 0; });
+            solver.push();
+            {
+                std::lock_guard<std::mutex> lock(managerMutex);
+                solver.add(guards[module][command]);
+            }
+            // If the solver cannot decide the satisfiability, we keep the combination (just like the guards would be kept).
+            if (!dependent || solver.check() != storm::solver::SmtSolver::CheckResult::Unsat) {
+                std::vector<storm::expressions::Variable> newVariables;
+                for (auto const& variable : variables) {
+                    if (prefixVariables.insert(variable).second) {
+                        newVariables.push_back(variable);
+                    }
+                }
+                currentCombination.push_back(command);
+
+                if (module + 1 == guards.size()) {
+                    result.push_back(currentCombination);
+                } else {
+                    for (uint_fast64_t nextCommand = 0; nextCommand < guards[module + 1].size(); ++nextCommand) {
+                        visit(module + 1, nextCommand);
+                    }
+                }
+
+                currentCombination.pop_back();
+                for (auto const& variable : newVariables) {
+                    prefixVariables.erase(variable);
+                }
+            }
+            solver.pop();
+        }
+        undoBounds(undoSize);
+    }
+
+    /*!
+     * Intersects the current bounds with the given ones and records the previous bounds.
+     *
+     * @return False iff the intersection is empty for some variable.
+     */
+    bool intersectBounds(GuardBounds const& bounds) {
+        for (auto const& [variable, lower, upper] : bounds) {
+            auto boundsIt = currentBounds.emplace(variable, std::make_pair(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max())).first;
+            boundsUndoStack.emplace_back(variable, boundsIt->second);
+            boundsIt->second.first = std::max(boundsIt->second.first, lower);
+            boundsIt->second.second = std::min(boundsIt->second.second, upper);
+            if (boundsIt->second.first > boundsIt->second.second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * Restores the bounds before the intersections that were recorded after the given size of the undo stack.
+     */
+    void undoBounds(uint_fast64_t undoSize) {
+        while (boundsUndoStack.size() > undoSize) {
+            currentBounds[boundsUndoStack.back().first] = boundsUndoStack.back().second;
+            boundsUndoStack.pop_back();
+        }
+    }
+
+    std::vector<std::vector<storm::expressions::Expression>> const& guards;
+    std::vector<std::vector<GuardBounds>> const& guardBounds;
+    std::vector<std::vector<std::set<storm::expressions::Variable>>> const& guardVariables;
+    storm::solver::SmtSolver& solver;
+    std::mutex& managerMutex;
+
+    std::unordered_map<storm::expressions::Variable, std::pair<int64_t, int64_t>> currentBounds;
+    std::vector<std::pair<storm::expressions::Variable, std::pair<int64_t, int64_t>>> boundsUndoStack;
+    std::set<storm::expressions::Variable> prefixVariables;
+    std::vector<uint_fast64_t> currentCombination;
+    std::vector<std::vector<uint_fast64_t>> result;
+};
+}  // namespace
+
+Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, uint64_t numberOfThreads) const {
     // If the current program has only one module, we can simply return a copy.
     if (this->getNumberOfModules() == 1) {
         return Program(*this);
@@ -1922,20 +2117,23 @@ Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolve
     uint_fast64_t nextCommandIndex = 0;
     uint_fast64_t nextUpdateIndex = 0;
 
-    // Assert the values of the constants.
+    // Gather the values of the constants and the bounds of the variables, which are asserted to the solvers.
+    std::vector<storm::expressions::Expression> backgroundAssertions;
+    std::set<storm::expressions::Variable> definedConstants;
     for (auto const& constant : this->getConstants()) {
         if (constant.isDefined()) {
+            definedConstants.insert(constant.getExpressionVariable());
             if (constant.getType().isBooleanType()) {
-                solver->add(storm::expressions::iff(constant.getExpressionVariable(), constant.getExpression()));
+                backgroundAssertions.push_back(storm::expressions::iff(constant.getExpressionVariable(), constant.getExpression()));
             } else {
-                solver->add(constant.getExpressionVariable() == constant.getExpression());
+                backgroundAssertions.push_back(constant.getExpressionVariable() == constant.getExpression());
             }
         }
     }
 
     // Assert the bounds of the global variables.
     for (auto const& variable : this->getGlobalIntegerVariables()) {
-        solver->add(variable.getRangeExpression());
+        backgroundAssertions.push_back(variable.getRangeExpression());
     }
 
     // Make the global variables local, such that the resulting module covers all occurring variables. Note that
@@ -1953,7 +2151,7 @@ Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolve
         allClockVariables.insert(allClockVariables.end(), module.getClockVariables().begin(), module.getClockVariables().end());
 
         for (auto const& variable : module.getIntegerVariables()) {
-            solver->add(variable.getRangeExpression());
+            backgroundAssertions.push_back(variable.getRangeExpression());
         }
 
         if (module.hasInvariant()) {
@@ -1980,17 +2178,26 @@ Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolve
         }
     }
 
-    // Save state of solver so that we can always restore the point where we have exactly the constant values
-    // and variables bounds on the assertion stack.
-    solver->push();
+    for (auto const& assertion : backgroundAssertions) {
+        solver->add(assertion);
+    }
 
-    // Now we need to enumerate all possible combinations of synchronizing commands. For this, we iterate over
-    // all actions and let the solver enumerate the possible combinations of commands that can be enabled together.
+    // Now we need to enumerate all possible combinations of synchronizing commands. For this, we gather for each action the commands
+    // of the participating modules. The combinations of each action are split into one task per command of the first participating
+    // module, such that the tasks can be processed in parallel.
+    struct SynchronizingAction {
+        uint_fast64_t actionIndex;
+        std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> possibleCommands;
+        std::vector<std::vector<storm::expressions::Expression>> guards;
+        std::vector<std::vector<GuardBounds>> guardBounds;
+        std::vector<std::vector<std::set<storm::expressions::Variable>>> guardVariables;
+    };
+    std::vector<SynchronizingAction> synchronizingActions;
+    std::vector<std::pair<uint_fast64_t, uint_fast64_t>> tasks;
     for (auto const& actionIndex : this->getSynchronizingActionIndices()) {
         bool noCombinationsForAction = false;
-
-        // Prepare the list that stores for each module the list of commands with the given action.
-        std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> possibleCommands;
+        SynchronizingAction action;
+        action.actionIndex = actionIndex;
 
         for (auto const& module : this->getModules()) {
             // If the module has no command with this action, we can skip it.
@@ -1998,109 +2205,96 @@ Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolve
                 continue;
             }
 
-            std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+            action.possibleCommands.emplace_back();
+            action.guards.emplace_back();
+            action.guardBounds.emplace_back();
+            action.guardVariables.emplace_back();
+            for (auto const& commandIndex : module.getCommandIndicesByActionIndex(actionIndex)) {
+                storm::prism::Command const& command = module.getCommand(commandIndex);
+
+                // Commands whose guard is unsatisfiable on its own can not be part of any combination.
+                solver->push();
+                solver->add(command.getGuardExpression());
+                bool satisfiable = solver->check() != storm::solver::SmtSolver::CheckResult::Unsat;
+                solver->pop();
+                if (!satisfiable) {
+                    continue;
+                }
+
+                action.possibleCommands.back().push_back(command);
+                action.guards.back().push_back(command.getGuardExpression());
+                action.guardBounds.back().emplace_back();
+                gatherGuardBounds(command.getGuardExpression(), action.guardBounds.back().back());
+                action.guardVariables.back().emplace_back();
+                for (auto const& variable : command.getGuardExpression().getVariables()) {
+                    if (definedConstants.count(variable) == 0) {
+                        action.guardVariables.back().back().insert(variable);
+                    }
+                }
+            }
 
-            // If there is no command even though the module has this action, there is no valid command
+            // If there is no (satisfiable) command even though the module has this action, there is no valid command
             // combination with this action.
-            if (commandIndices.empty()) {
+            if (action.possibleCommands.back().empty()) {
                 noCombinationsForAction = true;
                 break;
             }
-
-            // Prepare empty list of commands for this module.
-            possibleCommands.push_back(std::vector<std::reference_wrapper<storm::prism::Command const>>());
-
-            // Add references to the commands labeled with the current action.
-            for (auto const& commandIndex : commandIndices) {
-                possibleCommands.back().push_back(module.getCommand(commandIndex));
-            }
         }
 
         // If there are no valid combinations for the action, we need to skip the generation of synchronizing
         // commands.
-        if (!noCombinationsForAction) {
-            // Save the solver state to be able to restore it when this action index is done.
-            solver->push();
-
-            // Start by creating a fresh auxiliary variable for each command and link it with the guard.
-            std::vector<std::vector<storm::expressions::Variable>> commandVariables(possibleCommands.size());
-            std::vector<storm::expressions::Variable> allCommandVariables;
-            for (uint_fast64_t outerIndex = 0; outerIndex < possibleCommands.size(); ++outerIndex) {
-                // Create auxiliary variables and link them with the guards.
-                for (uint_fast64_t innerIndex = 0; innerIndex < possibleCommands[outerIndex].size(); ++innerIndex) {
-                    commandVariables[outerIndex].push_back(manager->declareFreshBooleanVariable());
-                    allCommandVariables.push_back(commandVariables[outerIndex].back());
-                    solver->add(implies(commandVariables[outerIndex].back(), possibleCommands[outerIndex][innerIndex].get().getGuardExpression()));
-                }
-
-                storm::expressions::Expression atLeastOneCommandFromModule = manager->boolean(false);
-                for (auto const& commandVariable : commandVariables[outerIndex]) {
-                    atLeastOneCommandFromModule = atLeastOneCommandFromModule || commandVariable;
-                }
-                solver->add(atLeastOneCommandFromModule);
+        if (!noCombinationsForAction && !action.possibleCommands.empty()) {
+            for (uint_fast64_t firstCommand = 0; firstCommand < action.possibleCommands.front().size(); ++firstCommand) {
+                tasks.emplace_back(synchronizingActions.size(), firstCommand);
             }
-
-            // Now we are in a position to start the enumeration over all command variables. While doing so, we
-            // keep track of previously seen command combinations, because the AllSat procedures are not
-            // always guaranteed to only provide distinct models.
-            std::unordered_set<std::vector<uint_fast64_t>, storm::utility::vector::VectorHash<uint_fast64_t>> seenCommandCombinations;
-            solver->allSat(allCommandVariables, [&](storm::solver::SmtSolver::ModelReference& modelReference) -> bool {
-                // Now we need to reconstruct the chosen commands from the valuation of the command variables.
-                std::vector<std::vector<std::reference_wrapper<Command const>>> chosenCommands(possibleCommands.size());
-
-                for (uint_fast64_t outerIndex = 0; outerIndex < commandVariables.size(); ++outerIndex) {
-                    for (uint_fast64_t innerIndex = 0; innerIndex < commandVariables[outerIndex].size(); ++innerIndex) {
-                        if (modelReference.getBooleanValue(commandVariables[outerIndex][innerIndex])) {
-                            chosenCommands[outerIndex].push_back(possibleCommands[outerIndex][innerIndex]);
-                        }
-                    }
+            synchronizingActions.push_back(std::move(action));
+        }
+    }
+
+    // Enumerate the command combinations of all tasks. Every thread uses its own solver (the calling thread reuses the one from above).
+    std::vector<std::vector<std::vector<uint_fast64_t>>> taskCombinations(tasks.size());
+    std::vector<std::unique_ptr<storm::solver::SmtSolver>> workerSolvers(std::max<uint64_t>(numberOfThreads, 1));
+    std::mutex managerMutex;
+    storm::utility::parallel::forEachChunk(numberOfThreads, tasks.size(), 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+        storm::solver::SmtSolver* workerSolver = solver.get();
+        if (threadIndex > 0) {
+            std::unique_ptr<storm::solver::SmtSolver>& ownSolver = workerSolvers[threadIndex];
+            if (!ownSolver) {
+                std::lock_guard<std::mutex> lock(managerMutex);
+                ownSolver = smtSolverFactory->create(*manager);
+                for (auto const& assertion : backgroundAssertions) {
+                    ownSolver->add(assertion);
                 }
+            }
+            workerSolver = ownSolver.get();
+        }
+        for (uint64_t task = begin; task < end; ++task) {
+            SynchronizingAction const& action = synchronizingActions[tasks[task].first];
+            CommandCombinationEnumerator enumerator(action.guards, action.guardBounds, action.guardVariables, *workerSolver, managerMutex);
+            taskCombinations[task] = enumerator.enumerate(tasks[task].second);
+        }
+    });
+
+    // Now that we have the combinations, we need to build their synchronizations and add them to the flattened module. This is done
+    // in the order of the tasks, such that the result does not depend on the number of threads.
+    for (uint_fast64_t task = 0; task < tasks.size(); ++task) {
+        SynchronizingAction const& action = synchronizingActions[tasks[task].first];
+        std::string const& actionName = indexToActionMap.find(action.actionIndex)->second;
+        for (auto const& combination : taskCombinations[task]) {
+            std::vector<std::reference_wrapper<Command const>> commandCombination;
+            commandCombination.reserve(combination.size());
+            for (uint_fast64_t module = 0; module < combination.size(); ++module) {
+                commandCombination.push_back(action.possibleCommands[module][combination[module]]);
+            }
+            newCommands.push_back(synchronizeCommands(nextCommandIndex, action.actionIndex, nextUpdateIndex, actionName, commandCombination));
 
-                // Now that we have retrieved the commands, we need to build their synchronizations and add them
-                // to the flattened module.
-                std::vector<std::vector<std::reference_wrapper<Command const>>::const_iterator> iterators;
-                for (auto const& element : chosenCommands) {
-                    iterators.push_back(element.begin());
-                }
-
-                bool movedAtLeastOneIterator = false;
-                std::vector<std::reference_wrapper<Command const>> commandCombination(chosenCommands.size(), chosenCommands.front().front());
-                std::vector<uint_fast64_t> commandCombinationIndices(iterators.size());
-                do {
-                    for (uint_fast64_t index = 0; index < iterators.size(); ++index) {
-                        commandCombination[index] = *iterators[index];
-                        commandCombinationIndices[index] = commandCombination[index].get().getGlobalIndex();
-                    }
-
-                    // Only add the command combination if it was not previously seen.
-                    auto seenIt = seenCommandCombinations.find(commandCombinationIndices);
-                    if (seenIt == seenCommandCombinations.end()) {
-                        newCommands.push_back(synchronizeCommands(nextCommandIndex, actionIndex, nextUpdateIndex, indexToActionMap.find(actionIndex)->second,
-                                                                  commandCombination));
-                        seenCommandCombinations.insert(commandCombinationIndices);
-
-                        // Move the counters appropriately.
-                        ++nextCommandIndex;
-                        nextUpdateIndex += newCommands.back().getNumberOfUpdates();
-                    }
-
-                    movedAtLeastOneIterator = false;
-                    for (uint_fast64_t index = 0; index < iterators.size(); ++index) {
-                        ++iterators[index];
-                        if (iterators[index] != chosenCommands[index].cend()) {
-                            movedAtLeastOneIterator = true;
-                            break;
-                        } else {
-                            iterators[index] = chosenCommands[index].cbegin();
-                        }
-                    }
-                } while (movedAtLeastOneIterator);
-
-                return true;
-            });
-
-            solver->pop();
+            // Move the counters appropriately.
+            ++nextCommandIndex;
+            nextUpdateIndex += newCommands.back().getNumberOfUpdates();
         }
+
+        // The combinations of this task are no longer needed.
+        std::vector<std::vector<uint_fast64_t>>().swap(taskCombinations[task]);
     }
 
     // Finally, we can create the module and the program and return it.
@@ -712,10 +712,13 @@ class Program : public LocatedInformation {
      * Creates an equivalent program that contains exactly one module.
      *
      * @param smtSolverFactory an SMT solver factory to use. If none is given, the default one is used.
+     * @param numberOfThreads the number of threads that enumerate the combinations of synchronizing commands. Every thread uses its
+     * own solver.
      * @return The resulting program.
      */
     Program flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory =
-                               std::shared_ptr<storm::utility::solver::SmtSolverFactory>(new storm::utility::solver::SmtSolverFactory())) const;
+                               std::shared_ptr<storm::utility::solver::SmtSolverFactory>(new storm::utility::solver::SmtSolverFactory()),
+                           uint64_t numberOfThreads = 1) const;
 
     /*!
      * Give commands that do not have an action name an action,
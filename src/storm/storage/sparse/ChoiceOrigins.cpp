@@ -1,5 +1,7 @@
 #include "storm/storage/sparse/ChoiceOrigins.h"
 
+#include <algorithm>
+
 #include "storm/adapters/JsonAdapter.h"
 
 #include "storm/storage/sparse/JaniChoiceOrigins.h"
@@ -12,12 +14,27 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
-ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping) : indexToIdentifier(indexToIdentifierMapping) {
-    // Intentionally left empty
+ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping) {
+    setIndexToIdentifierMapping(indexToIdentifierMapping);
 }
 
-ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t>&& indexToIdentifierMapping) : indexToIdentifier(std::move(indexToIdentifierMapping)) {
-    // Intentionally left empty
+ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t>&& indexToIdentifierMapping) {
+    setIndexToIdentifierMapping(indexToIdentifierMapping);
+}
+
+void ChoiceOrigins::setIndexToIdentifierMapping(std::vector<uint_fast64_t> const& indexToIdentifierMapping) {
+    numberOfChoices = indexToIdentifierMapping.size();
+    uint_fast64_t maxIdentifier = indexToIdentifierMapping.empty() ? 0 : *std::max_element(indexToIdentifierMapping.begin(), indexToIdentifierMapping.end());
+    bitsPerIdentifier = 0;
+    while (bitsPerIdentifier < 64 && (maxIdentifier >> bitsPerIdentifier) != 0) {
+        ++bitsPerIdentifier;
+    }
+    indexToIdentifier = storm::storage::BitVector(numberOfChoices * bitsPerIdentifier);
+    if (bitsPerIdentifier > 0) {
+        for (uint_fast64_t choiceIndex = 0; choiceIndex < numberOfChoices; ++choiceIndex) {
+            indexToIdentifier.setFromInt(choiceIndex * bitsPerIdentifier, bitsPerIdentifier, indexToIdentifierMapping[choiceIndex]);
+        }
+    }
 }
 
 bool ChoiceOrigins::isPrismChoiceOrigins() const {
@@ -45,12 +62,16 @@ JaniChoiceOrigins const& ChoiceOrigins::asJaniChoiceOrigins() const {
 }
 
 uint_fast64_t ChoiceOrigins::getIdentifier(uint_fast64_t choiceIndex) const {
-    STORM_LOG_ASSERT(choiceIndex < indexToIdentifier.size(), "Invalid choice index: " << choiceIndex);
-    return indexToIdentifier[choiceIndex];
+    STORM_LOG_ASSERT(choiceIndex < numberOfChoices, "Invalid choice index: " << choiceIndex);
+    return bitsPerIdentifier == 0 ? getIdentifierForChoicesWithNoOrigin() : indexToIdentifier.getAsInt(choiceIndex * bitsPerIdentifier, bitsPerIdentifier);
 }
 
 uint_fast64_t ChoiceOrigins::getNumberOfChoices() const {
-    return indexToIdentifier.size();
+    return numberOfChoices;
+}
+
+uint_fast64_t ChoiceOrigins::getSizeOfIdentifierMappingInBytes() const {
+    return (indexToIdentifier.size() + 7) / 8;
 }
 
 uint_fast64_t ChoiceOrigins::getIdentifierForChoicesWithNoOrigin() {
@@ -82,21 +103,27 @@ typename ChoiceOrigins::Json const& ChoiceOrigins::getChoiceAsJson(uint_fast64_t
 }
 
 std::shared_ptr<ChoiceOrigins> ChoiceOrigins::selectChoices(storm::storage::BitVector const& selectedChoices) const {
-    std::vector<uint_fast64_t> indexToIdentifierMapping(selectedChoices.getNumberOfSetBits());
-    storm::utility::vector::selectVectorValues(indexToIdentifierMapping, selectedChoices, indexToIdentifier);
+    std::vector<uint_fast64_t> indexToIdentifierMapping;
+    indexToIdentifierMapping.reserve(selectedChoices.getNumberOfSetBits());
+    for (auto selectedChoice : selectedChoices) {
+        indexToIdentifierMapping.push_back(getIdentifier(selectedChoice));
+    }
     return cloneWithNewIndexToIdentifierMapping(std::move(indexToIdentifierMapping));
 }
 
 void ChoiceOrigins::clearOriginOfChoice(uint_fast64_t choiceIndex) {
-    indexToIdentifier[choiceIndex] = getIdentifierForChoicesWithNoOrigin();
+    STORM_LOG_ASSERT(choiceIndex < numberOfChoices, "Invalid choice index: " << choiceIndex);
+    if (bitsPerIdentifier > 0) {
+        indexToIdentifier.setFromInt(choiceIndex * bitsPerIdentifier, bitsPerIdentifier, getIdentifierForChoicesWithNoOrigin());
+    }
 }
 
 std::shared_ptr<ChoiceOrigins> ChoiceOrigins::selectChoices(std::vector<uint_fast64_t> const& selectedChoices) const {
     std::vector<uint_fast64_t> indexToIdentifierMapping;
     indexToIdentifierMapping.reserve(selectedChoices.size());
     for (auto const& selectedChoice : selectedChoices) {
-        if (selectedChoice < this->indexToIdentifier.size()) {
-            indexToIdentifierMapping.push_back(indexToIdentifier[selectedChoice]);
+        if (selectedChoice < numberOfChoices) {
+            indexToIdentifierMapping.push_back(getIdentifier(selectedChoice));
         } else {
             indexToIdentifierMapping.push_back(getIdentifierForChoicesWithNoOrigin());
         }
@@ -105,12 +132,19 @@ std::shared_ptr<ChoiceOrigins> ChoiceOrigins::selectChoices(std::vector<uint_fas
 }
 
 storm::models::sparse::ChoiceLabeling ChoiceOrigins::toChoiceLabeling() const {
-    storm::models::sparse::ChoiceLabeling result(indexToIdentifier.size());
-    for (uint_fast64_t identifier = 0; identifier < this->getNumberOfIdentifiers(); ++identifier) {
-        storm::storage::BitVector choicesWithIdentifier =
-            storm::utility::vector::filter<uint_fast64_t>(indexToIdentifier, [&identifier](uint_fast64_t i) -> bool { return i == identifier; });
-        if (!choicesWithIdentifier.empty()) {
-            result.addLabel(getIdentifierInfo(identifier), std::move(choicesWithIdentifier));
+    // Collect the choices of all identifiers in a single pass over the choices.
+    std::vector<storm::storage::BitVector> identifierToChoices(this->getNumberOfIdentifiers());
+    for (uint_fast64_t choiceIndex = 0; choiceIndex < numberOfChoices; ++choiceIndex) {
+        auto& choicesWithIdentifier = identifierToChoices[getIdentifier(choiceIndex)];
+        if (choicesWithIdentifier.size() == 0) {
+            choicesWithIdentifier.resize(numberOfChoices);
+        }
+        choicesWithIdentifier.set(choiceIndex, true);
+    }
+    storm::models::sparse::ChoiceLabeling result(numberOfChoices);
+    for (uint_fast64_t identifier = 0; identifier < identifierToChoices.size(); ++identifier) {
+        if (!identifierToChoices[identifier].empty()) {
+            result.addLabel(getIdentifierInfo(identifier), std::move(identifierToChoices[identifier]));
         }
     }
     return result;
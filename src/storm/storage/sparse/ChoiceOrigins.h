@@ -50,6 +50,11 @@ class ChoiceOrigins {
      */
     uint_fast64_t getNumberOfChoices() const;
 
+    /*
+     * Retrieves the number of bytes that are used to store the identifiers of the choices.
+     */
+    uint_fast64_t getSizeOfIdentifierMappingInBytes() const;
+
     /*
      * Returns the identifier that is used for choices without an origin in the input specification
      * E.g., Selfloops introduced on deadlock states
@@ -115,8 +120,20 @@ class ChoiceOrigins {
      */
     virtual void computeIdentifierJson() const = 0;
 
-    std::vector<uint_fast64_t> indexToIdentifier;
+   private:
+    /*
+     * Stores the given mapping of choice indices to identifiers in the packed representation.
+     */
+    void setIndexToIdentifierMapping(std::vector<uint_fast64_t> const& indexToIdentifierMapping);
+
+    uint_fast64_t numberOfChoices;
 
+    // The identifier of choice i is given by the bits [i * bitsPerIdentifier, (i + 1) * bitsPerIdentifier), where bitsPerIdentifier is the
+    // minimal number of bits required to store the largest identifier. This avoids spending a full word per choice on models with many choices.
+    uint_fast64_t bitsPerIdentifier;
+    storm::storage::BitVector indexToIdentifier;
+
+   protected:
     // cached identifier infos might be empty if identifiers have not been generated yet.
     mutable std::vector<std::string> identifierToInfo;
 
@@ -2,7 +2,7 @@
 
 #include <cstdint>
 
-#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/sparse/StateToIdMap.h"
 
 namespace storm {
 namespace storage {
@@ -11,11 +11,12 @@ namespace sparse {
 // A structure holding information about the reachable state space while building it.
 template<typename StateType>
 struct StateStorage {
-    // Creates an empty state storage structure for storing states of the given bit width.
-    StateStorage(uint64_t bitsPerState);
+    // Creates an empty state storage structure for storing states of the given bit width in the given type of data structure. The
+    // storage is sized such that the given number of states can be stored without increasing its size.
+    StateStorage(uint64_t bitsPerState, StateStorageType type = StateStorageType::HashMap, uint64_t initialSize = 100000);
 
     // This member stores all the states and maps them to their unique indices.
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    StateToIdMap<StateType> stateToId;
 
     // A list of initial states in terms of their global indices.
     std::vector<StateType> initialStateIndices;
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * The data structures that can be used to store the explored states.
+ */
+enum class StateStorageType {
+    // Stores every state in a BitVectorHashMap.
+    HashMap,
+    // Stores the states in a TreeCompressedBitVectorHashMap, which requires less memory but is slower.
+    TreeCompression
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,116 @@
+#include "storm/storage/sparse/StateToIdMap.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+template<typename StateType>
+StateToIdMap<StateType>::const_iterator::const_iterator(typename storm::storage::BitVectorHashMap<StateType>::const_iterator const& iterator)
+    : hashMapIterator(iterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::const_iterator::const_iterator(typename storm::storage::TreeCompressedBitVectorHashMap<StateType>::const_iterator const& iterator)
+    : treeIterator(iterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::const_iterator::operator==(const_iterator const& other) const {
+    if (hashMapIterator) {
+        // The comparison of the hash map iterators is not const.
+        auto iterator = hashMapIterator.value();
+        return other.hashMapIterator && iterator == other.hashMapIterator.value();
+    }
+    return other.treeIterator && treeIterator.value() == other.treeIterator.value();
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::const_iterator::operator!=(const_iterator const& other) const {
+    return !(*this == other);
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator& StateToIdMap<StateType>::const_iterator::operator++() {
+    if (hashMapIterator) {
+        ++hashMapIterator.value();
+    } else {
+        ++treeIterator.value();
+    }
+    return *this;
+}
+
+template<typename StateType>
+std::pair<storm::storage::BitVector, StateType> StateToIdMap<StateType>::const_iterator::operator*() const {
+    return hashMapIterator ? *hashMapIterator.value() : *treeIterator.value();
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMap(uint64_t bitsPerState, uint64_t initialSize, StateStorageType type) {
+    if (type == StateStorageType::TreeCompression) {
+        treeMap.emplace(bitsPerState);
+    } else {
+        hashMap.emplace(bitsPerState, initialSize);
+    }
+}
+
+template<typename StateType>
+StateType StateToIdMap<StateType>::findOrAdd(storm::storage::BitVector const& state, StateType const& index) {
+    return hashMap ? hashMap->findOrAdd(state, index) : treeMap->findOrAdd(state, index);
+}
+
+template<typename StateType>
+std::pair<StateType, uint64_t> StateToIdMap<StateType>::findOrAddAndGetBucket(storm::storage::BitVector const& state, StateType const& index) {
+    return hashMap ? hashMap->findOrAddAndGetBucket(state, index) : treeMap->findOrAddAndGetBucket(state, index);
+}
+
+template<typename StateType>
+StateType StateToIdMap<StateType>::getValue(storm::storage::BitVector const& state) const {
+    return hashMap ? hashMap->getValue(state) : treeMap->getValue(state);
+}
+
+template<typename StateType>
+boost::optional<StateType> StateToIdMap<StateType>::find(storm::storage::BitVector const& state) const {
+    return hashMap ? hashMap->find(state) : treeMap->find(state);
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::contains(storm::storage::BitVector const& state) const {
+    return hashMap ? hashMap->contains(state) : treeMap->contains(state);
+}
+
+template<typename StateType>
+uint64_t StateToIdMap<StateType>::size() const {
+    return hashMap ? hashMap->size() : treeMap->size();
+}
+
+template<typename StateType>
+void StateToIdMap<StateType>::remap(std::function<StateType(StateType const&)> const& remapping) {
+    if (hashMap) {
+        hashMap->remap(remapping);
+    } else {
+        treeMap->remap(remapping);
+    }
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator StateToIdMap<StateType>::begin() const {
+    return hashMap ? const_iterator(hashMap->begin()) : const_iterator(treeMap->begin());
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator StateToIdMap<StateType>::end() const {
+    return hashMap ? const_iterator(hashMap->end()) : const_iterator(treeMap->end());
+}
+
+template<typename StateType>
+StateStorageType StateToIdMap<StateType>::getType() const {
+    return hashMap ? StateStorageType::HashMap : StateStorageType::TreeCompression;
+}
+
+template class StateToIdMap<uint32_t>;
+template class StateToIdMap<uint_fast64_t>;
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
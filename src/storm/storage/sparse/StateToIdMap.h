@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/TreeCompressedBitVectorHashMap.h"
+#include "storm/storage/sparse/StateStorageType.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * Maps the (compressed) states to their indices using one of the supported data structures. The interface matches the one of
+ * BitVectorHashMap.
+ */
+template<typename StateType>
+class StateToIdMap {
+   public:
+    class const_iterator {
+       public:
+        explicit const_iterator(typename storm::storage::BitVectorHashMap<StateType>::const_iterator const& iterator);
+        explicit const_iterator(typename storm::storage::TreeCompressedBitVectorHashMap<StateType>::const_iterator const& iterator);
+
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+        const_iterator& operator++();
+        std::pair<storm::storage::BitVector, StateType> operator*() const;
+
+       private:
+        // Exactly one of the iterators is set.
+        std::optional<typename storm::storage::BitVectorHashMap<StateType>::const_iterator> hashMapIterator;
+        std::optional<typename storm::storage::TreeCompressedBitVectorHashMap<StateType>::const_iterator> treeIterator;
+    };
+
+    /*!
+     * Creates an empty map for states of the given bit width.
+     */
+    StateToIdMap(uint64_t bitsPerState, uint64_t initialSize, StateStorageType type = StateStorageType::HashMap);
+
+    StateType findOrAdd(storm::storage::BitVector const& state, StateType const& index);
+    std::pair<StateType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& state, StateType const& index);
+    StateType getValue(storm::storage::BitVector const& state) const;
+    boost::optional<StateType> find(storm::storage::BitVector const& state) const;
+    bool contains(storm::storage::BitVector const& state) const;
+    uint64_t size() const;
+    void remap(std::function<StateType(StateType const&)> const& remapping);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    StateStorageType getType() const;
+
+   private:
+    // Exactly one of the maps is set.
+    std::optional<storm::storage::BitVectorHashMap<StateType>> hashMap;
+    std::optional<storm::storage::TreeCompressedBitVectorHashMap<StateType>> treeMap;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
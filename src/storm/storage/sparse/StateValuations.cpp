@@ -1,34 +1,105 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/adapters/JsonAdapter.h"
 
-#include "storm/adapters/RationalNumberForward.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/storage/BitVector.h"
 
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/utility/macros.h"
-#include "storm/utility/vector.h"
+#include "storm/utility/math.h"
 
 namespace storm {
 namespace storage {
 namespace sparse {
 
-StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
-                                                std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
-    : booleanValues(std::move(booleanValues)),
-      integerValues(std::move(integerValues)),
-      rationalValues(std::move(rationalValues)),
-      observationLabelValues(std::move(observationLabelValues)) {
-    // Intentionally left empty
+namespace detail {
+// Retrieves the number of bits that are needed to distinguish all values between the given bounds.
+uint64_t getRequiredBitWidth(int64_t lowerBound, int64_t upperBound) {
+    uint64_t range = static_cast<uint64_t>(upperBound) - static_cast<uint64_t>(lowerBound);
+    return range == 0 ? 0 : storm::utility::math::uint64_log2(range) + 1;
+}
+}  // namespace detail
+
+StateValuations::PackedIntegerColumn::PackedIntegerColumn() : hasRange(false), lowerBound(0), upperBound(0), bitWidth(0), numberOfEntries(0) {
+    // Intentionally left empty.
+}
+
+void StateValuations::PackedIntegerColumn::extendRange(int64_t lowerBound, int64_t upperBound) {
+    STORM_LOG_ASSERT(lowerBound <= upperBound, "Invalid range [" << lowerBound << ", " << upperBound << "].");
+    if (hasRange && this->lowerBound <= lowerBound && upperBound <= this->upperBound) {
+        return;
+    }
+    int64_t newLowerBound = hasRange ? std::min(this->lowerBound, lowerBound) : lowerBound;
+    int64_t newUpperBound = hasRange ? std::max(this->upperBound, upperBound) : upperBound;
+    uint64_t newBitWidth = detail::getRequiredBitWidth(newLowerBound, newUpperBound);
+    if (hasRange && numberOfEntries > 0 && (newLowerBound != this->lowerBound || newBitWidth != bitWidth)) {
+        // Re-encode the values that are already stored.
+        storm::storage::BitVector newBits(numberOfEntries * newBitWidth);
+        if (newBitWidth > 0) {
+            for (uint64_t index = 0; index < numberOfEntries; ++index) {
+                newBits.setFromInt(index * newBitWidth, newBitWidth, static_cast<uint64_t>(get(index)) - static_cast<uint64_t>(newLowerBound));
+            }
+        }
+        bits = std::move(newBits);
+    } else if (numberOfEntries > 0 && newBitWidth != bitWidth) {
+        // No value has been stored so far.
+        bits = storm::storage::BitVector(numberOfEntries * newBitWidth);
+    }
+    hasRange = true;
+    this->lowerBound = newLowerBound;
+    this->upperBound = newUpperBound;
+    bitWidth = newBitWidth;
+}
+
+void StateValuations::PackedIntegerColumn::resize(uint64_t numberOfEntries) {
+    if (numberOfEntries > this->numberOfEntries) {
+        bits.grow(numberOfEntries * bitWidth);
+    } else {
+        bits.resize(numberOfEntries * bitWidth);
+    }
+    this->numberOfEntries = numberOfEntries;
+}
+
+void StateValuations::PackedIntegerColumn::shrinkToFit() {
+    bits.resize(numberOfEntries * bitWidth);
+}
+
+int64_t StateValuations::PackedIntegerColumn::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < numberOfEntries, "Invalid index " << index << ".");
+    if (bitWidth == 0) {
+        return lowerBound;
+    }
+    return static_cast<int64_t>(static_cast<uint64_t>(lowerBound) + bits.getAsInt(index * bitWidth, bitWidth));
+}
+
+void StateValuations::PackedIntegerColumn::set(uint64_t index, int64_t value) {
+    STORM_LOG_ASSERT(index < numberOfEntries, "Invalid index " << index << ".");
+    extendRange(value, value);
+    if (bitWidth > 0) {
+        bits.setFromInt(index * bitWidth, bitWidth, static_cast<uint64_t>(value) - static_cast<uint64_t>(lowerBound));
+    }
+}
+
+StateValuations::PackedIntegerColumn StateValuations::PackedIntegerColumn::emptyCopy() const {
+    PackedIntegerColumn result;
+    if (hasRange) {
+        result.extendRange(lowerBound, upperBound);
+    }
+    return result;
+}
+
+uint64_t StateValuations::PackedIntegerColumn::getBitWidth() const {
+    return bitWidth;
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-    STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+uint64_t StateValuations::PackedIntegerColumn::getSizeInBytes() const {
+    return sizeof(PackedIntegerColumn) + (bits.size() + 63) / 64 * 8;
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -36,14 +107,16 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                                                        storm::storage::sparse::state_type state)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
       variableEnd(variableEnd),
       labelBegin(labelBegin),
       labelEnd(labelEnd),
-      valuation(valuation) {
+      valuations(valuations),
+      state(state) {
     // Intentionally left empty.
 }
 
@@ -83,28 +156,26 @@ std::string const& StateValuations::StateValueIterator::getName() const {
 
 bool StateValuations::StateValueIterator::getBooleanValue() const {
     STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-    return valuation->booleanValues[variableIt->second];
+    return valuations->booleanColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getIntegerValue() const {
     STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-    return valuation->integerValues[variableIt->second];
+    return valuations->integerColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getLabelValue() const {
     STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-    STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(),
-                     "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-    return valuation->observationLabelValues[labelIt->second];
+    return valuations->observationLabelColumns[labelIt->second].get(state);
 }
 
 storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
     STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-    return valuation->rationalValues[variableIt->second];
+    return valuations->rationalColumns[variableIt->second][state];
 }
 
 bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-    STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+    STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
     return variableIt == other.variableIt && labelIt == other.labelIt;
 }
 bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -131,42 +202,54 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
-    : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations,
+                                                                  storm::storage::sparse::state_type state)
+    : variableMap(variableMap), labelMap(labelMap), valuations(valuations), state(state) {
     // Intentionally left empty.
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    if (!valuations->statesWithValuation.get(state)) {
+        // States without valuation have no values.
+        return end();
+    }
+    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(),
+                              valuations, state);
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations,
+                              state);
+}
+
+StateValuations::StateValuations() : numberOfStates(0) {
+    // Intentionally left empty.
+}
+
+uint64_t StateValuations::getVariableIndex(storm::expressions::Variable const& variable) const {
+    auto findRes = variableToIndexMap.find(variable);
+    STORM_LOG_ASSERT(findRes != variableToIndexMap.end(), "Variable " << variable.getName() << " is not part of this valuation.");
+    return findRes->second;
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
-    STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && statesWithValuation.get(stateIndex), "Invalid state index " << stateIndex << ".");
+    return booleanColumns[getVariableIndex(booleanVariable)].get(stateIndex);
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
-    STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && statesWithValuation.get(stateIndex), "Invalid state index " << stateIndex << ".");
+    return integerColumns[getVariableIndex(integerVariable)].get(stateIndex);
 }
 
 storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                                storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
-    STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && statesWithValuation.get(stateIndex), "Invalid state index " << stateIndex << ".");
+    return rationalColumns[getVariableIndex(rationalVariable)][stateIndex];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-    auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
-    return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+    return stateIndex >= numberOfStates || !statesWithValuation.get(stateIndex) || (variableToIndexMap.empty() && observationLabels.empty());
 }
 
 std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty,
@@ -257,43 +340,6 @@ storm::json<JsonRationalType> StateValuations::toJson(storm::storage::sparse::st
     return result;
 }
 
-bool StateValuations::assertValuation(StateValuation const& valuation) const {
-    storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-    storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-    storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-    for (auto const& varIndex : variableToIndexMap) {
-        storm::storage::BitVector* bv;
-        if (varIndex.first.hasBooleanType()) {
-            bv = &foundBooleanValues;
-        } else if (varIndex.first.hasIntegerType()) {
-            bv = &foundIntegerValues;
-        } else if (varIndex.first.hasRationalType()) {
-            bv = &foundRationalValues;
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-        }
-        if (varIndex.second < bv->size()) {
-            if (bv->get(varIndex.second)) {
-                STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                return false;
-            }
-            bv->set(varIndex.second, true);
-        } else {
-            STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-            return false;
-        }
-    }
-    if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-        STORM_LOG_ERROR("Valuation has too many entries.");
-    }
-    return true;
-}
-
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-    // Intentionally left empty
-}
-
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -301,40 +347,132 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange(variableToIndexMap, observationLabels, this, state);
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return numberOfStates;
+}
+
+uint64_t StateValuations::getNumberOfBitsPerState() const {
+    uint64_t result = booleanColumns.size();
+    for (auto const& column : integerColumns) {
+        result += column.getBitWidth();
+    }
+    return result;
+}
+
+uint64_t StateValuations::getSizeInBytes() const {
+    uint64_t result = sizeof(StateValuations) + (statesWithValuation.size() + 63) / 64 * 8;
+    for (auto const& column : booleanColumns) {
+        result += sizeof(column) + (column.size() + 63) / 64 * 8;
+    }
+    for (auto const& column : integerColumns) {
+        result += column.getSizeInBytes();
+    }
+    for (auto const& column : rationalColumns) {
+        result += sizeof(column) + column.size() * sizeof(storm::RationalNumber);
+    }
+    for (auto const& column : observationLabelColumns) {
+        result += column.getSizeInBytes();
+    }
+    return result;
 }
 
 std::size_t StateValuations::hash() const {
     return 0;
 }
 
-StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+void StateValuations::resize(uint64_t numberOfStates) {
+    STORM_LOG_ASSERT(numberOfStates >= this->numberOfStates, "State valuations can not be made smaller.");
+    this->numberOfStates = numberOfStates;
+    statesWithValuation.grow(numberOfStates);
+    for (auto& column : booleanColumns) {
+        column.grow(numberOfStates);
+    }
+    for (auto& column : integerColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : rationalColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : observationLabelColumns) {
+        column.resize(numberOfStates);
+    }
 }
 
-StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-    std::vector<StateValuation> selectedValuations;
-    selectedValuations.reserve(selectedStates.size());
-    for (auto const& selectedState : selectedStates) {
-        if (selectedState < valuations.size()) {
-            selectedValuations.push_back(valuations[selectedState]);
+void StateValuations::shrinkToFit() {
+    statesWithValuation.resize(numberOfStates);
+    for (auto& column : booleanColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : integerColumns) {
+        column.shrinkToFit();
+    }
+    for (auto& column : rationalColumns) {
+        column.shrink_to_fit();
+    }
+    for (auto& column : observationLabelColumns) {
+        column.shrinkToFit();
+    }
+}
+
+void StateValuations::copyValuation(StateValuations const& other, storm::storage::sparse::state_type otherState, storm::storage::sparse::state_type state) {
+    if (!other.statesWithValuation.get(otherState)) {
+        return;
+    }
+    statesWithValuation.set(state);
+    for (uint64_t column = 0; column < booleanColumns.size(); ++column) {
+        booleanColumns[column].set(state, other.booleanColumns[column].get(otherState));
+    }
+    for (uint64_t column = 0; column < integerColumns.size(); ++column) {
+        integerColumns[column].set(state, other.integerColumns[column].get(otherState));
+    }
+    for (uint64_t column = 0; column < rationalColumns.size(); ++column) {
+        rationalColumns[column][state] = other.rationalColumns[column][otherState];
+    }
+    for (uint64_t column = 0; column < observationLabelColumns.size(); ++column) {
+        observationLabelColumns[column].set(state, other.observationLabelColumns[column].get(otherState));
+    }
+}
+
+StateValuations StateValuations::selectStates(std::vector<uint64_t> const& mapNewToOld, bool allowInvalidStates) const {
+    StateValuations result;
+    result.variableToIndexMap = variableToIndexMap;
+    result.observationLabels = observationLabels;
+    result.booleanColumns.resize(booleanColumns.size());
+    result.rationalColumns.resize(rationalColumns.size());
+    // Keep the encoding of the integer columns to avoid re-encoding them while copying the values.
+    for (auto const& column : integerColumns) {
+        result.integerColumns.push_back(column.emptyCopy());
+    }
+    for (auto const& column : observationLabelColumns) {
+        result.observationLabelColumns.push_back(column.emptyCopy());
+    }
+    result.resize(mapNewToOld.size());
+    for (uint64_t newState = 0; newState < mapNewToOld.size(); ++newState) {
+        uint64_t oldState = mapNewToOld[newState];
+        if (oldState < numberOfStates) {
+            result.copyValuation(*this, oldState, newState);
         } else {
-            selectedValuations.emplace_back();
+            STORM_LOG_ASSERT(allowInvalidStates, "Invalid state index " << oldState << ".");
         }
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    result.shrinkToFit();
+    return result;
+}
+
+StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
+    STORM_LOG_ASSERT(selectedStates.size() == numberOfStates, "Invalid size of selected states.");
+    return selectStates(std::vector<uint64_t>(selectedStates.begin(), selectedStates.end()), false);
+}
+
+StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
+    return selectStates(std::vector<uint64_t>(selectedStates.begin(), selectedStates.end()), true);
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
-    std::vector<StateValuation> newValuations;
-    for (auto const& oldState : mapNewToOld) {
-        newValuations.push_back(valuations[oldState]);
-    }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    return selectStates(mapNewToOld, false);
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -342,35 +480,61 @@ StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVa
 }
 
 void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+    STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
     STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
     if (variable.hasBooleanType()) {
         currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+        currentStateValuations.booleanColumns.emplace_back();
     }
     if (variable.hasIntegerType()) {
         currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+        currentStateValuations.integerColumns.emplace_back();
     }
     if (variable.hasRationalType()) {
         currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+        currentStateValuations.rationalColumns.emplace_back();
+    }
+}
+
+void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+    STORM_LOG_ASSERT(variable.hasIntegerType(), "Bounds can only be given for integer variables, but " << variable.getName() << " is not an integer.");
+    addVariable(variable);
+    if (lowerBound <= upperBound) {
+        currentStateValuations.integerColumns.back().extendRange(lowerBound, upperBound);
     }
 }
 
 void StateValuationsBuilder::addObservationLabel(const std::string& label) {
+    STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a label, although a state has already been added before.");
     currentStateValuations.observationLabels[label] = labelCount++;
+    currentStateValuations.observationLabelColumns.emplace_back();
 }
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
-    if (state > currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.resize(state);
-    }
-    if (state == currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues),
-                                                       std::move(observationLabelValues));
+    STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount, "Expected " << booleanVarCount << " boolean values but got " << booleanValues.size() << ".");
+    STORM_LOG_ASSERT(integerValues.size() == integerVarCount, "Expected " << integerVarCount << " integer values but got " << integerValues.size() << ".");
+    STORM_LOG_ASSERT(rationalValues.size() == rationalVarCount,
+                     "Expected " << rationalVarCount << " rational values but got " << rationalValues.size() << ".");
+    STORM_LOG_ASSERT(observationLabelValues.size() <= labelCount,
+                     "Expected at most " << labelCount << " label values but got " << observationLabelValues.size() << ".");
+    if (state >= currentStateValuations.numberOfStates) {
+        currentStateValuations.resize(state + 1);
     } else {
         STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-        currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues),
-                                                                                            std::move(rationalValues), std::move(observationLabelValues));
+    }
+    currentStateValuations.statesWithValuation.set(state);
+    for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+        currentStateValuations.booleanColumns[index].set(state, booleanValues[index]);
+    }
+    for (uint64_t index = 0; index < integerValues.size(); ++index) {
+        currentStateValuations.integerColumns[index].set(state, integerValues[index]);
+    }
+    for (uint64_t index = 0; index < rationalValues.size(); ++index) {
+        currentStateValuations.rationalColumns[index][state] = std::move(rationalValues[index]);
+    }
+    for (uint64_t index = 0; index < observationLabelValues.size(); ++index) {
+        currentStateValuations.observationLabelColumns[index].set(state, observationLabelValues[index]);
     }
 }
 
@@ -387,11 +551,17 @@ uint64_t StateValuationsBuilder::getLabelCount() const {
 }
 
 StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
-    return std::move(currentStateValuations);
+    if (totalStateCount > currentStateValuations.numberOfStates) {
+        currentStateValuations.resize(totalStateCount);
+    }
+    currentStateValuations.shrinkToFit();
     booleanVarCount = 0;
     integerVarCount = 0;
     rationalVarCount = 0;
     labelCount = 0;
+    StateValuations result = std::move(currentStateValuations);
+    currentStateValuations = StateValuations();
+    return result;
 }
 
 template storm::json<double> StateValuations::toJson<double>(storm::storage::sparse::state_type const&,
@@ -17,25 +17,21 @@ namespace sparse {
 
 class StateValuationsBuilder;
 
-// A structure holding information about the reachable state space that can be retrieved from the outside.
+/*!
+ * A structure holding information about the reachable state space that can be retrieved from the outside.
+ *
+ * The valuations are stored column-wise, i.e. there is one column for each variable (and observation label) holding its value in all states.
+ * Integer values are bit-packed: each column stores the offset to the smallest value of the variable with the minimal number of bits that
+ * suffices for its range. Hence, a state with b boolean and i integer variables only requires b + (sum of the bit widths) bits instead of
+ * several heap allocations. Values are decoded in constant time whenever they are accessed.
+ */
 class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
-    class StateValuation {
-       public:
-        friend class StateValuations;
-        StateValuation() = default;
-        StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,
-                       std::vector<int64_t>&& observationLabelValues = {});
-
-       private:
-        std::vector<bool> booleanValues;
-        std::vector<int64_t> integerValues;
-        std::vector<storm::RationalNumber> rationalValues;
-        std::vector<int64_t> observationLabelValues;
-    };
-
+    /*!
+     * Iterates over the variables and observation labels of a single state. The values are only decoded upon access.
+     */
     class StateValueIterator {
        public:
         StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -43,7 +39,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                           storm::storage::sparse::state_type state);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -73,29 +70,35 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        StateValuations const* valuations;
+        storm::storage::sparse::state_type state;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                StateValuations const* valuations, storm::storage::sparse::state_type state);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        StateValuations const* valuations;
+        storm::storage::sparse::state_type state;
     };
 
-    StateValuations() = default;
+    StateValuations();
     virtual ~StateValuations() = default;
     virtual std::string getStateInfo(storm::storage::sparse::state_type const& state) const override;
+
+    /*!
+     * Retrieves a range over the values of the given state. If the state has no valuation, the range is empty.
+     */
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
     storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                   storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
@@ -122,6 +125,16 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     // Returns the (current) number of states that this object describes.
     uint_fast64_t getNumberOfStates() const;
 
+    /*!
+     * Retrieves the number of bits that are used to encode the boolean and integer values of a single state.
+     */
+    uint64_t getNumberOfBitsPerState() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by the stored values.
+     */
+    uint64_t getSizeInBytes() const;
+
     /*
      * Derive new state valuations from this by selecting the given states.
      */
@@ -138,14 +151,59 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     virtual std::size_t hash() const;
 
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-    bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+    /*!
+     * The values of one integer variable (or observation label) for all states. The value of entry i is offset + d, where d is the unsigned number
+     * given by the bits [i * bitWidth, (i + 1) * bitWidth). Setting a value outside the current range re-encodes the column with a larger range.
+     */
+    class PackedIntegerColumn {
+       public:
+        PackedIntegerColumn();
+
+        /*!
+         * Makes sure that all values between the given bounds can be stored without re-encoding the column.
+         */
+        void extendRange(int64_t lowerBound, int64_t upperBound);
+        void resize(uint64_t numberOfEntries);
+        void shrinkToFit();
+        int64_t get(uint64_t index) const;
+        void set(uint64_t index, int64_t value);
+        // Creates a column without entries that uses the same encoding as this one.
+        PackedIntegerColumn emptyCopy() const;
+        uint64_t getBitWidth() const;
+        uint64_t getSizeInBytes() const;
+
+       private:
+        bool hasRange;
+        int64_t lowerBound;
+        int64_t upperBound;
+        uint64_t bitWidth;
+        uint64_t numberOfEntries;
+        storm::storage::BitVector bits;
+    };
+
+    // Derives new state valuations where the i-th state gets the valuation of state mapNewToOld[i]. Invalid old state indices yield empty valuations.
+    StateValuations selectStates(std::vector<uint64_t> const& mapNewToOld, bool allowInvalidStates) const;
+    // Resizes all columns such that they hold the given number of states.
+    void resize(uint64_t numberOfStates);
+    // Releases the memory that was reserved for further states.
+    void shrinkToFit();
+    // Copies the valuation of the given state of the other state valuations (which need to have the same variables) to the given state.
+    void copyValuation(StateValuations const& other, storm::storage::sparse::state_type otherState, storm::storage::sparse::state_type state);
+    uint64_t getVariableIndex(storm::expressions::Variable const& variable) const;
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
-    // A mapping from state indices to their variable valuations.
-    std::vector<StateValuation> valuations;
+
+    // The number of states that this object describes.
+    uint64_t numberOfStates;
+    // The states for which a valuation has been added.
+    storm::storage::BitVector statesWithValuation;
+
+    // One column for each variable of the corresponding type (in the order given by variableToIndexMap) and each observation label.
+    std::vector<storm::storage::BitVector> booleanColumns;
+    std::vector<PackedIntegerColumn> integerColumns;
+    std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+    std::vector<PackedIntegerColumn> observationLabelColumns;
 };
 
 class StateValuationsBuilder {
@@ -157,6 +215,12 @@ class StateValuationsBuilder {
      */
     void addVariable(storm::expressions::Variable const& variable);
 
+    /*! Adds a new integer variable whose values (in all states) are known to lie within the given bounds.
+     * This avoids re-encoding the values once states are added, but values outside the bounds are still supported.
+     * All variables need to be added before adding new states.
+     */
+    void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound);
+
     void addObservationLabel(std::string const& label);
 
     /*!
@@ -30,6 +30,32 @@ class DAProductBuilder {
         return typename DAProduct<Model>::ptr(new DAProduct<Model>(std::move(*product), prodAcceptance));
     }
 
+    /*!
+     * If set, product states whose automaton state is absorbing (i.e., the automaton stays in this state for every letter) are not explored any further
+     * but get a self-loop instead. As the automaton can not leave such a state, the acceptance of a run through it no longer depends on the model, and
+     * the accepting BSCCs, the accepting end components and the probabilities of reaching them are preserved. However, the choices of the product no
+     * longer correspond to the choices of the model.
+     */
+    void setTruncateAtAbsorbingAutomatonStates(bool value) {
+        absorbingAutomatonStates = storm::storage::BitVector(da.getNumberOfStates(), false);
+        if (value) {
+            for (storm::storage::sparse::state_type automatonState = 0; automatonState < da.getNumberOfStates(); ++automatonState) {
+                bool absorbing = true;
+                for (storm::automata::APSet::alphabet_element letter = 0; absorbing && letter < da.getAPSet().alphabetSize(); ++letter) {
+                    absorbing = da.getSuccessor(automatonState, letter) == automatonState;
+                }
+                absorbingAutomatonStates.set(automatonState, absorbing);
+            }
+        }
+    }
+
+    /*!
+     * Retrieves whether product states with the given automaton state are not explored, see setTruncateAtAbsorbingAutomatonStates.
+     */
+    bool isTruncatedAutomatonState(storm::storage::sparse::state_type automatonState) const {
+        return absorbingAutomatonStates.size() > 0 && absorbingAutomatonStates.get(automatonState);
+    }
+
     storm::storage::sparse::state_type getInitialState(storm::storage::sparse::state_type modelState) const {
         return da.getSuccessor(da.getInitialState(), getLabelForState(modelState));
     }
@@ -41,6 +67,7 @@ class DAProductBuilder {
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    storm::storage::BitVector absorbingAutomatonStates;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
         storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
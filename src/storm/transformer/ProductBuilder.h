@@ -3,6 +3,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
 
 #include <deque>
 #include <map>
@@ -55,7 +56,14 @@ class ProductBuilder {
 
             product_state_type from = productIndexToProductState.at(prodIndexFrom);
             // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
-            if (deterministic) {
+            if (prodOp.isTruncatedAutomatonState(from.second)) {
+                // The successors are irrelevant for the product operator, so the state is made absorbing.
+                if (!deterministic) {
+                    builder.newRowGroup(curRow);
+                }
+                builder.addNextValue(deterministic ? prodIndexFrom : curRow, prodIndexFrom, storm::utility::one<typename Model::ValueType>());
+                ++curRow;
+            } else if (deterministic) {
                 typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
                 for (auto const& entry : row) {
                     state_type t = entry.getColumn();
@@ -0,0 +1,90 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/permutation.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace transformer {
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& inversePermutation) {
+    STORM_LOG_THROW(inversePermutation.size() == originalModel.getNumberOfStates() && storm::utility::permutation::isValidPermutation(inversePermutation),
+                    storm::exceptions::InvalidArgumentException, "The given vector is not a permutation of the states of the model.");
+    STORM_LOG_THROW(originalModel.isOfType(storm::models::ModelType::Dtmc) || originalModel.isOfType(storm::models::ModelType::Ctmc) ||
+                        originalModel.isOfType(storm::models::ModelType::Mdp) || originalModel.isOfType(storm::models::ModelType::MarkovAutomaton),
+                    storm::exceptions::NotSupportedException, "Permuting the states of a " << originalModel.getType() << " is not supported.");
+
+    // The choices are permuted along with their states.
+    auto const& originalMatrix = originalModel.getTransitionMatrix();
+    std::vector<uint64_t> inverseChoicePermutation;
+    inverseChoicePermutation.reserve(originalMatrix.getRowCount());
+    for (auto state : inversePermutation) {
+        for (auto choice : originalMatrix.getRowGroupIndices(state)) {
+            inverseChoicePermutation.push_back(choice);
+        }
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(originalMatrix.permuteRowGroupsAndColumns(inversePermutation));
+    components.stateLabeling = originalModel.getStateLabeling();
+    components.stateLabeling.permuteItems(inversePermutation);
+    for (auto const& rewardModel : originalModel.getRewardModels()) {
+        std::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
+        std::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
+        std::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
+        if (rewardModel.second.hasStateRewards()) {
+            stateRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            stateActionRewardVector =
+                storm::utility::vector::applyInversePermutation(inverseChoicePermutation, rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            transitionRewardMatrix = rewardModel.second.getTransitionRewardMatrix().permuteRowGroupsAndColumns(inversePermutation);
+        }
+        components.rewardModels.emplace(rewardModel.first,
+                                        RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix)));
+    }
+    if (originalModel.hasChoiceLabeling()) {
+        components.choiceLabeling = originalModel.getChoiceLabeling();
+        components.choiceLabeling->permuteItems(inverseChoicePermutation);
+    }
+    if (originalModel.hasStateValuations()) {
+        components.stateValuations = originalModel.getStateValuations().selectStates(inversePermutation);
+    }
+    if (originalModel.hasChoiceOrigins()) {
+        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(inverseChoicePermutation);
+    }
+
+    if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+        components.markovianStates = ma.getMarkovianStates().permute(inversePermutation);
+        components.exitRates = storm::utility::vector::applyInversePermutation(inversePermutation, ma.getExitRates());
+        components.rateTransitions = false;  // Note that the transition matrix of an MA contains probabilities
+    } else if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+        auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+        components.exitRates = storm::utility::vector::applyInversePermutation(inversePermutation, ctmc.getExitRateVector());
+        components.rateTransitions = true;
+    }
+
+    return storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+}
+
+template std::shared_ptr<storm::models::sparse::Model<double>> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                                             std::vector<uint64_t> const& inversePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> permuteStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, std::vector<uint64_t> const& inversePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> permuteStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, std::vector<uint64_t> const& inversePermutation);
+
+}  // namespace transformer
+}  // namespace storm
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * Creates a copy of the given model in which the states are arranged in the given order. All components of the model (transitions,
+ * labels, rewards, choice labels, state valuations, choice origins and the model-specific components of CTMCs and MAs) are permuted
+ * accordingly. The choices of each state keep their order.
+ *
+ * @param originalModel The model whose states are to be permuted. Supported are DTMCs, CTMCs, MDPs and MAs.
+ * @param inversePermutation For each state of the resulting model, the corresponding state of the original model. Results of the
+ * resulting model can be translated back with storm::utility::vector::applyInversePermutation and the inverse of this permutation.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& inversePermutation);
+
+}  // namespace transformer
+}  // namespace storm
@@ -45,7 +45,8 @@ void transformModelSpecificComponents(storm::models::sparse::Model<ValueType, Re
 
 template<typename RewardModelType>
 RewardModelType transformRewardModel(RewardModelType const& originalRewardModel, storm::storage::BitVector const& subsystem,
-                                     storm::storage::BitVector const& subsystemActions, bool makeRowGroupingTrivial) {
+                                     storm::storage::BitVector const& subsystemActions, bool makeRowGroupingTrivial,
+                                     uint64_t numberOfThreads) {
     std::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
     std::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
     std::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
@@ -56,7 +57,8 @@ RewardModelType transformRewardModel(RewardModelType const& originalRewardModel,
         stateActionRewardVector = storm::utility::vector::filterVector(originalRewardModel.getStateActionRewardVector(), subsystemActions);
     }
     if (originalRewardModel.hasTransitionRewards()) {
-        transitionRewardMatrix = originalRewardModel.getTransitionRewardMatrix().getSubmatrix(false, subsystemActions, subsystem);
+        transitionRewardMatrix = originalRewardModel.getTransitionRewardMatrix().getSubmatrix(false, subsystemActions, subsystem, false,
+                                                                                               storm::storage::BitVector(), numberOfThreads);
         if (makeRowGroupingTrivial) {
             STORM_LOG_ASSERT(transitionRewardMatrix.value().getColumnCount() == transitionRewardMatrix.value().getRowCount(), "Matrix should be square");
             transitionRewardMatrix.value().makeRowGroupingTrivial();
@@ -136,9 +138,11 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
         components.transitionMatrix = originalModel.getTransitionMatrix();
         components.transitionMatrix.makeRowGroupsAbsorbing(deadlockStates);
         components.transitionMatrix.dropZeroEntries();
-        components.transitionMatrix = components.transitionMatrix.getSubmatrix(false, keptActions, subsystemStates);
+        components.transitionMatrix = components.transitionMatrix.getSubmatrix(false, keptActions, subsystemStates, false, storm::storage::BitVector(),
+                                                                             options.numberOfThreads);
     } else {
-        components.transitionMatrix = originalModel.getTransitionMatrix().getSubmatrix(false, keptActions, subsystemStates);
+        components.transitionMatrix = originalModel.getTransitionMatrix().getSubmatrix(false, keptActions, subsystemStates, false, storm::storage::BitVector(),
+                                                                                     options.numberOfThreads);
     }
     if (options.makeRowGroupingTrivial) {
         STORM_LOG_ASSERT(components.transitionMatrix.getColumnCount() == components.transitionMatrix.getRowCount(), "Matrix should be square");
@@ -148,7 +152,8 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
     components.stateLabeling = originalModel.getStateLabeling().getSubLabeling(subsystemStates);
     for (auto const& rewardModel : originalModel.getRewardModels()) {
         components.rewardModels.insert(
-            std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions, options.makeRowGroupingTrivial)));
+            std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions, options.makeRowGroupingTrivial,
+                                                                   options.numberOfThreads)));
     }
     if (originalModel.hasChoiceLabeling()) {
         components.choiceLabeling = originalModel.getChoiceLabeling().getSubLabeling(keptActions);
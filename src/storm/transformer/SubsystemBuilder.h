@@ -32,6 +32,8 @@ struct SubsystemBuilderOptions {
     bool buildKeptActions = true;
     bool fixDeadlocks = false;
     bool makeRowGroupingTrivial = false;
+    // The number of threads that are used to copy the transition matrix (and transition rewards) of the subsystem.
+    uint64_t numberOfThreads = 1;
 };
 
 /*
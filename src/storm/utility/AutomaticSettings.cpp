@@ -214,14 +214,21 @@ void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Pr
     }
 }
 
-void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Property const& property, uint64_t) {
-    // typedef pfinternal::PropertyType PropertyType;
-    // auto f = pfinternal::Features(model, property);
-    // f.stateEstimate = stateEstimate;
-    // STORM_LOG_INFO("Automatic engine using features " << f.toString() << ".");
-
-    // Right now, we do not make use of the state estimate, so we just ask the 'default' decision tree.
+void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Property const& property, uint64_t stateEstimate) {
+    // The decision tree is learned from syntactic features only, so we ask it first and only correct its decision if the estimate clearly
+    // suggests otherwise.
     predict(model, property);
+    STORM_LOG_INFO("Automatic engine using state estimate " << stateEstimate << ".");
+
+    // Small models are handled best by the sparse engine, where building the model is cheap and symbolic representations do not pay off.
+    uint64_t const smallModelThreshold = 100000;
+    // The explicit representation of large models may not fit into memory.
+    uint64_t const largeModelThreshold = 100000000;
+    if (stateEstimate <= smallModelThreshold && engine != storm::utility::Engine::Sparse) {
+        sparse();
+    } else if (stateEstimate >= largeModelThreshold && engine == storm::utility::Engine::Sparse && !useExact) {
+        hybrid();
+    }
 }
 
 storm::utility::Engine AutomaticSettings::getEngine() const {
@@ -1,5 +1,6 @@
 #include "storm/utility/ConstantsComparator.h"
 
+#include "storm/adapters/HybridRationalNumber.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/sparse/StateType.h"
 
@@ -106,6 +107,7 @@ template class ConstantsComparator<ClnRationalNumber>;
 template class ConstantsComparator<GmpRationalNumber>;
 #endif
 
+template class ConstantsComparator<HybridRationalNumber>;
 template class ConstantsComparator<RationalFunction>;
 template class ConstantsComparator<Polynomial>;
 template class ConstantsComparator<Interval>;
@@ -22,7 +22,8 @@ class ConstantsComparator {
 // Specialization for numbers where there can be a precision
 template<typename ValueType>
 using ConstantsComparatorEnablePrecision =
-    typename std::enable_if_t<std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value>;
+    typename std::enable_if_t<std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value ||
+                              std::is_same<ValueType, storm::HybridRationalNumber>::value>;
 
 template<typename ValueType>
 class ConstantsComparator<ValueType, ConstantsComparatorEnablePrecision<ValueType>> {
@@ -50,6 +50,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::AbstractionRefinement:
             return "abs";
+        case Engine::Smc:
+            return "smc";
         case Engine::Automatic:
             return "automatic";
         case Engine::Unknown:
@@ -93,6 +95,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
+        case Engine::Smc:
+            return storm::builder::BuilderType::Explicit;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
             return storm::builder::BuilderType::Explicit;
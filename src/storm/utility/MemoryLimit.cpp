@@ -0,0 +1,96 @@
+#include "storm/utility/MemoryLimit.h"
+
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace resources {
+
+namespace detail {
+std::atomic<uint64_t> memoryLimit(0);
+}  // namespace detail
+
+namespace {
+// Guards the registered reclaimers. Reclaimers are called while holding the lock, so unregistering a reclaimer waits for running calls.
+std::mutex reclaimerMutex;
+std::map<uint64_t, std::function<uint64_t()>> reclaimers;
+uint64_t nextReclaimerIdentifier = 0;
+
+std::mutex degradationMutex;
+std::vector<std::string> degradations;
+}  // namespace
+
+void setMemoryLimit(uint64_t bytes) {
+    detail::memoryLimit.store(bytes, std::memory_order_relaxed);
+}
+
+uint64_t getMemoryLimit() {
+    return detail::memoryLimit.load(std::memory_order_relaxed);
+}
+
+uint64_t getResidentMemory() {
+#ifdef LINUX
+    // The second entry of statm is the resident set size in pages.
+    std::ifstream statm("/proc/self/statm");
+    uint64_t totalPages = 0, residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss;
+#else
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss * 1024;
+#endif
+}
+
+bool isMemoryLimitApproached(double fraction) {
+    uint64_t limit = getMemoryLimit();
+    return limit != 0 && static_cast<double>(getResidentMemory()) > fraction * static_cast<double>(limit);
+}
+
+uint64_t registerMemoryReclaimer(std::function<uint64_t()> const& reclaimer) {
+    std::lock_guard<std::mutex> lock(reclaimerMutex);
+    uint64_t identifier = nextReclaimerIdentifier++;
+    reclaimers.emplace(identifier, reclaimer);
+    return identifier;
+}
+
+void unregisterMemoryReclaimer(uint64_t identifier) {
+    std::lock_guard<std::mutex> lock(reclaimerMutex);
+    reclaimers.erase(identifier);
+}
+
+uint64_t reclaimMemory() {
+    std::lock_guard<std::mutex> lock(reclaimerMutex);
+    uint64_t result = 0;
+    for (auto const& identifierReclaimerPair : reclaimers) {
+        result += identifierReclaimerPair.second();
+    }
+    STORM_LOG_INFO("Reclaimed " << result << " bytes of cached data as the memory limit is approached.");
+    return result;
+}
+
+void reportDegradation(std::string const& message) {
+    STORM_LOG_WARN("Memory limit approached: " << message);
+    std::lock_guard<std::mutex> lock(degradationMutex);
+    degradations.push_back(message);
+}
+
+std::vector<std::string> getDegradations() {
+    std::lock_guard<std::mutex> lock(degradationMutex);
+    return degradations;
+}
+
+}  // namespace resources
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace resources {
+
+namespace detail {
+extern std::atomic<uint64_t> memoryLimit;
+}  // namespace detail
+
+/*!
+ * Sets the limit (in bytes) on the resident memory of the process. Engines that can degrade gracefully (e.g., by dropping cached results or by
+ * exploring the model only partially) check this limit and degrade before it is exceeded. A limit of zero disables the checks.
+ */
+void setMemoryLimit(uint64_t bytes);
+
+/*!
+ * Retrieves whether a memory limit was set. This is a single (relaxed) atomic load.
+ */
+inline bool isMemoryLimitSet() {
+    return detail::memoryLimit.load(std::memory_order_relaxed) != 0;
+}
+
+/*!
+ * Retrieves the memory limit in bytes (or zero if no limit was set).
+ */
+uint64_t getMemoryLimit();
+
+/*!
+ * Retrieves the current resident set size of the process in bytes. On systems where the current resident set size is not available, the peak
+ * resident set size is returned instead.
+ */
+uint64_t getResidentMemory();
+
+/*!
+ * Retrieves whether a memory limit was set and the resident memory of the process exceeds the given fraction of the limit.
+ */
+bool isMemoryLimitApproached(double fraction = 0.9);
+
+/*!
+ * Registers a function that frees memory that can be recovered later (such as cached results) and returns the (estimated) number of bytes it
+ * freed. The function may be called from any thread as long as it is registered.
+ *
+ * @return An identifier that is used to unregister the function.
+ */
+uint64_t registerMemoryReclaimer(std::function<uint64_t()> const& reclaimer);
+
+/*!
+ * Unregisters the function with the given identifier. Once this returns, the function is not called anymore.
+ */
+void unregisterMemoryReclaimer(uint64_t identifier);
+
+/*!
+ * Calls all registered reclaimers.
+ *
+ * @return The (estimated) number of bytes that were freed.
+ */
+uint64_t reclaimMemory();
+
+/*!
+ * Records that a computation degraded because the memory limit was approached (e.g., that a model was only explored partially) and issues a
+ * warning. The recorded degradations are reported at the end of a run.
+ */
+void reportDegradation(std::string const& message);
+
+/*!
+ * Retrieves the degradations that were reported so far (in the order in which they were reported).
+ */
+std::vector<std::string> getDegradations();
+
+}  // namespace resources
+}  // namespace utility
+}  // namespace storm
@@ -40,6 +40,14 @@ struct NumberTraits<storm::GmpRationalNumber> {
 };
 #endif
 
+template<>
+struct NumberTraits<storm::HybridRationalNumber> {
+    static const bool SupportsExponential = false;
+    static const bool IsExact = true;
+
+    typedef typename NumberTraits<storm::RationalNumber>::IntegerType IntegerType;
+};
+
 template<>
 struct NumberTraits<storm::RationalFunction> {
     static const bool SupportsExponential = false;
@@ -3,11 +3,15 @@
 #include <cmath>
 #include <type_traits>
 
+#include <boost/container/flat_map.hpp>
+
+
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include "storm/adapters/HybridRationalNumber.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/NumberTraits.h"
@@ -221,6 +225,32 @@ ValueType maximum(std::map<K, ValueType> const& values) {
     return minmax(values).second;
 }
 
+template<typename K, typename ValueType>
+std::pair<ValueType, ValueType> minmax(boost::container::flat_map<K, ValueType> const& values) {
+    assert(!values.empty());
+    ValueType min = values.begin()->second;
+    ValueType max = values.begin()->second;
+    for (auto const& vt : values) {
+        if (vt.second < min) {
+            min = vt.second;
+        }
+        if (vt.second > max) {
+            max = vt.second;
+        }
+    }
+    return std::make_pair(min, max);
+}
+
+template<typename K, typename ValueType>
+ValueType minimum(boost::container::flat_map<K, ValueType> const& values) {
+    return minmax(values).first;
+}
+
+template<typename K, typename ValueType>
+ValueType maximum(boost::container::flat_map<K, ValueType> const& values) {
+    return minmax(values).second;
+}
+
 template<typename ValueType>
 ValueType pow(ValueType const& value, int_fast64_t exponent) {
     return std::pow(value, exponent);
@@ -546,6 +576,26 @@ std::pair<storm::GmpRationalNumber, storm::GmpRationalNumber> minmax(std::map<ui
     return std::make_pair(min, max);
 }
 
+template<>
+std::pair<storm::GmpRationalNumber, storm::GmpRationalNumber> minmax(boost::container::flat_map<uint64_t, storm::GmpRationalNumber> const& values) {
+    assert(!values.empty());
+    storm::GmpRationalNumber min = values.begin()->second;
+    storm::GmpRationalNumber max = values.begin()->second;
+    for (auto const& vt : values) {
+        if (vt.second == storm::utility::infinity<storm::GmpRationalNumber>()) {
+            max = vt.second;
+        } else {
+            if (vt.second < min) {
+                min = vt.second;
+            }
+            if (vt.second > max) {
+                max = vt.second;
+            }
+        }
+    }
+    return std::make_pair(min, max);
+}
+
 template<>
 uint_fast64_t convertNumber(GmpRationalNumber const& number) {
     return carl::toInt<carl::uint>(number);
@@ -701,6 +751,92 @@ storm::ClnRationalNumber convertNumber(storm::GmpRationalNumber const& number) {
 }
 #endif
 
+#ifdef STORM_HAVE_CARL
+template<>
+storm::HybridRationalNumber infinity() {
+    // FIXME: this should be treated more properly.
+    return storm::HybridRationalNumber(static_cast<int64_t>(100000000000));
+}
+
+template<>
+bool isOne(storm::HybridRationalNumber const& a) {
+    return a.isOne();
+}
+
+template<>
+bool isZero(storm::HybridRationalNumber const& a) {
+    return a.isZero();
+}
+
+template<>
+bool isInteger(storm::HybridRationalNumber const& number) {
+    return number.isSmall() ? number.getSmallDenominator() == 1 : isInteger(number.toRationalNumber());
+}
+
+template<>
+storm::HybridRationalNumber convertNumber(double const& number) {
+    return storm::HybridRationalNumber(convertNumber<storm::RationalNumber>(number));
+}
+
+template<>
+storm::HybridRationalNumber convertNumber(int const& number) {
+    return storm::HybridRationalNumber(number);
+}
+
+template<>
+storm::HybridRationalNumber convertNumber(uint_fast64_t const& number) {
+    if (number <= static_cast<uint_fast64_t>(std::numeric_limits<int64_t>::max())) {
+        return storm::HybridRationalNumber(static_cast<int64_t>(number));
+    }
+    return storm::HybridRationalNumber(convertNumber<storm::RationalNumber>(number));
+}
+
+template<>
+storm::HybridRationalNumber convertNumber(int_fast64_t const& number) {
+    return storm::HybridRationalNumber(static_cast<int64_t>(number));
+}
+
+template<>
+storm::HybridRationalNumber convertNumber(std::string const& number) {
+    return storm::HybridRationalNumber(convertNumber<storm::RationalNumber>(number));
+}
+
+template<>
+storm::HybridRationalNumber convertNumber(storm::RationalNumber const& number) {
+    return storm::HybridRationalNumber(number);
+}
+
+template<>
+storm::RationalNumber convertNumber(storm::HybridRationalNumber const& number) {
+    return number.toRationalNumber();
+}
+
+template<>
+double convertNumber(storm::HybridRationalNumber const& number) {
+    return number.toDouble();
+}
+
+template<>
+storm::HybridRationalNumber abs(storm::HybridRationalNumber const& number) {
+    return number < zero<storm::HybridRationalNumber>() ? -number : number;
+}
+
+template<>
+storm::HybridRationalNumber floor(storm::HybridRationalNumber const& number) {
+    return storm::HybridRationalNumber(floor(number.toRationalNumber()));
+}
+
+template<>
+storm::HybridRationalNumber ceil(storm::HybridRationalNumber const& number) {
+    return storm::HybridRationalNumber(ceil(number.toRationalNumber()));
+}
+
+template<>
+storm::HybridRationalNumber pow(storm::HybridRationalNumber const& value, int_fast64_t exponent) {
+    return storm::HybridRationalNumber(pow(value.toRationalNumber(), exponent));
+}
+#endif
+
 #ifdef STORM_HAVE_CARL
 template<>
 storm::RationalFunction infinity() {
@@ -879,6 +1015,21 @@ storm::RationalFunction maximum(std::map<uint64_t, storm::RationalFunction> cons
     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Maximum for rational functions is not defined");
 }
 
+template<>
+std::pair<storm::RationalFunction, storm::RationalFunction> minmax(boost::container::flat_map<uint64_t, storm::RationalFunction> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Maximum/maximum for rational functions is not defined.");
+}
+
+template<>
+storm::RationalFunction minimum(boost::container::flat_map<uint64_t, storm::RationalFunction> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Minimum for rational functions is not defined.");
+}
+
+template<>
+storm::RationalFunction maximum(boost::container::flat_map<uint64_t, storm::RationalFunction> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Maximum for rational functions is not defined");
+}
+
 template<>
 RationalFunction pow(RationalFunction const& value, int_fast64_t exponent) {
     if (exponent >= 0) {
@@ -938,6 +1089,9 @@ template double maximum(std::vector<double> const&);
 template std::pair<double, double> minmax(std::map<uint64_t, double> const&);
 template double minimum(std::map<uint64_t, double> const&);
 template double maximum(std::map<uint64_t, double> const&);
+template std::pair<double, double> minmax(boost::container::flat_map<uint64_t, double> const&);
+template double minimum(boost::container::flat_map<uint64_t, double> const&);
+template double maximum(boost::container::flat_map<uint64_t, double> const&);
 template double pow(double const& value, int_fast64_t exponent);
 template double max(double const& first, double const& second);
 template double min(double const& first, double const& second);
@@ -952,6 +1106,19 @@ template typename NumberTraits<double>::IntegerType trunc(double const& number);
 template double mod(double const& first, double const& second);
 template std::string to_string(double const& value);
 
+// float
+template float one();
+template float zero();
+template float infinity();
+template bool isOne(float const& value);
+template bool isZero(float const& value);
+template bool isInfinity(float const& value);
+template float max(float const& first, float const& second);
+template float min(float const& first, float const& second);
+template float abs(float const& number);
+template float convertNumber(double const& number);
+template double convertNumber(float const& number);
+
 // int
 template int one();
 template int zero();
@@ -1006,6 +1173,9 @@ template storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::
 template std::pair<storm::ClnRationalNumber, storm::ClnRationalNumber> minmax(std::map<uint64_t, storm::ClnRationalNumber> const&);
 template storm::ClnRationalNumber minimum(std::map<uint64_t, storm::ClnRationalNumber> const&);
 template storm::ClnRationalNumber maximum(std::map<uint64_t, storm::ClnRationalNumber> const&);
+template std::pair<storm::ClnRationalNumber, storm::ClnRationalNumber> minmax(boost::container::flat_map<uint64_t, storm::ClnRationalNumber> const&);
+template storm::ClnRationalNumber minimum(boost::container::flat_map<uint64_t, storm::ClnRationalNumber> const&);
+template storm::ClnRationalNumber maximum(boost::container::flat_map<uint64_t, storm::ClnRationalNumber> const&);
 template storm::ClnRationalNumber minimum(std::vector<storm::ClnRationalNumber> const&);
 template storm::ClnRationalNumber maximum(std::vector<storm::ClnRationalNumber> const&);
 template storm::ClnRationalNumber max(storm::ClnRationalNumber const& first, storm::ClnRationalNumber const& second);
@@ -1036,6 +1206,8 @@ template storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::
     storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::GmpRationalNumber>&& matrixEntry);
 template storm::GmpRationalNumber minimum(std::map<uint64_t, storm::GmpRationalNumber> const&);
 template storm::GmpRationalNumber maximum(std::map<uint64_t, storm::GmpRationalNumber> const&);
+template storm::GmpRationalNumber minimum(boost::container::flat_map<uint64_t, storm::GmpRationalNumber> const&);
+template storm::GmpRationalNumber maximum(boost::container::flat_map<uint64_t, storm::GmpRationalNumber> const&);
 template storm::GmpRationalNumber minimum(std::vector<storm::GmpRationalNumber> const&);
 template storm::GmpRationalNumber maximum(std::vector<storm::GmpRationalNumber> const&);
 template storm::GmpRationalNumber max(storm::GmpRationalNumber const& first, storm::GmpRationalNumber const& second);
@@ -1047,6 +1219,34 @@ template std::string to_string(storm::GmpRationalNumber const& value);
 #if defined(STORM_HAVE_CARL) && defined(STORM_HAVE_GMP) && defined(STORM_HAVE_CLN)
 #endif
 
+#ifdef STORM_HAVE_CARL
+// Instantiations for hybrid rational numbers.
+template storm::HybridRationalNumber one();
+template storm::HybridRationalNumber zero();
+template bool isNan(storm::HybridRationalNumber const& value);
+template bool isAlmostZero(storm::HybridRationalNumber const& value);
+template bool isAlmostOne(storm::HybridRationalNumber const& value);
+template bool isConstant(storm::HybridRationalNumber const& value);
+template bool isInfinity(storm::HybridRationalNumber const& value);
+template storm::HybridRationalNumber convertNumber(storm::HybridRationalNumber const& number);
+template storm::HybridRationalNumber simplify(storm::HybridRationalNumber value);
+template storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::HybridRationalNumber> simplify(
+    storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::HybridRationalNumber> matrixEntry);
+template storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::HybridRationalNumber>& simplify(
+    storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::HybridRationalNumber>& matrixEntry);
+template storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::HybridRationalNumber>&& simplify(
+    storm::storage::MatrixEntry<storm::storage::sparse::state_type, storm::HybridRationalNumber>&& matrixEntry);
+template std::pair<storm::HybridRationalNumber, storm::HybridRationalNumber> minmax(std::vector<storm::HybridRationalNumber> const&);
+template storm::HybridRationalNumber minimum(std::vector<storm::HybridRationalNumber> const&);
+template storm::HybridRationalNumber maximum(std::vector<storm::HybridRationalNumber> const&);
+template std::pair<storm::HybridRationalNumber, storm::HybridRationalNumber> minmax(std::map<uint64_t, storm::HybridRationalNumber> const&);
+template storm::HybridRationalNumber minimum(std::map<uint64_t, storm::HybridRationalNumber> const&);
+template storm::HybridRationalNumber maximum(std::map<uint64_t, storm::HybridRationalNumber> const&);
+template storm::HybridRationalNumber max(storm::HybridRationalNumber const& first, storm::HybridRationalNumber const& second);
+template storm::HybridRationalNumber min(storm::HybridRationalNumber const& first, storm::HybridRationalNumber const& second);
+template std::string to_string(storm::HybridRationalNumber const& value);
+#endif
+
 #ifdef STORM_HAVE_CARL
 // Instantiations for rational function.
 template RationalFunction one();
@@ -16,6 +16,8 @@
 #include <map>
 #include <vector>
 
+#include <boost/container/container_fwd.hpp>
+
 #include "storm/utility/NumberTraits.h"
 
 namespace storm {
@@ -137,6 +139,15 @@ ValueType minimum(std::map<K, ValueType> const& values);
 template<typename K, typename ValueType>
 ValueType maximum(std::map<K, ValueType> const& values);
 
+template<typename K, typename ValueType>
+std::pair<ValueType, ValueType> minmax(boost::container::flat_map<K, ValueType> const& values);
+
+template<typename K, typename ValueType>
+ValueType minimum(boost::container::flat_map<K, ValueType> const& values);
+
+template<typename K, typename ValueType>
+ValueType maximum(boost::container::flat_map<K, ValueType> const& values);
+
 template<typename ValueType>
 ValueType pow(ValueType const& value, int_fast64_t exponent);
 
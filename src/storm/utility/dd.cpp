@@ -1,7 +1,11 @@
 #include "storm/utility/dd.h"
 
+#include <chrono>
+#include <type_traits>
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Dd.h"
 #include "storm/storage/dd/DdManager.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -49,6 +53,54 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStatesByChaining(storm::dd::Bdd<Type> const& initialStates,
+                                                                           std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                           std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                           std::set<storm::expressions::Variable> const& columnMetaVariables) {
+    STORM_LOG_TRACE("Computing reachable states by chaining over " << transitionPartitions.size() << " partitions of the transition relation, "
+                                                                   << initialStates.getNonZeroCount() << " initial states).");
+
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+
+    // For every partition, we store the states whose successors (w.r.t. the partition) have already been added.
+    std::vector<storm::dd::Bdd<Type>> expandedStates(transitionPartitions.size(), initialStates.getDdManager().getBddZero());
+
+    bool changed = true;
+    uint_fast64_t iteration = 0;
+    uint_fast64_t numberOfImages = 0;
+    while (changed) {
+        changed = false;
+        for (uint64_t partition = 0; partition < transitionPartitions.size(); ++partition) {
+            // Apply the partition until no new states are found, starting from the states that it has not expanded yet.
+            storm::dd::Bdd<Type> frontier = reachableStates && !expandedStates[partition];
+            while (!frontier.isZero()) {
+                storm::dd::Bdd<Type> newReachableStates =
+                    frontier.relationalProduct(transitionPartitions[partition], rowMetaVariables, columnMetaVariables) && !reachableStates;
+                ++numberOfImages;
+                reachableStates |= newReachableStates;
+                frontier = newReachableStates;
+                if (!newReachableStates.isZero()) {
+                    changed = true;
+                }
+            }
+            expandedStates[partition] = reachableStates;
+        }
+
+        ++iteration;
+        STORM_LOG_TRACE("Iteration " << iteration << " of chaining reachability computation completed: " << reachableStates.getNonZeroCount()
+                                     << " reachable states found.");
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Chaining reachability computation completed in " << iteration << " iterations and " << numberOfImages << " image computations ("
+                                                                       << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                                                                       << "ms).");
+
+    return {reachableStates, iteration};
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -94,6 +146,35 @@ storm::dd::Bdd<Type> getRowColumnDiagonal(
     return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
 }
 
+template<storm::dd::DdType Type>
+std::pair<uint64_t, uint64_t> reorderAtPhaseBoundary(storm::dd::DdManager<Type>& ddManager, std::string const& phase, storm::dd::Dd<Type> const& dd) {
+    uint64_t nodesBefore = dd.getNodeCount();
+    if (Type != storm::dd::DdType::CUDD) {
+        STORM_LOG_WARN("Skipping reordering after " << phase << ", because the DD library does not support reordering.");
+        return std::make_pair(nodesBefore, nodesBefore);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ddManager.triggerReordering();
+    auto end = std::chrono::high_resolution_clock::now();
+    uint64_t nodesAfter = dd.getNodeCount();
+    double savedPercentage = nodesBefore == 0 ? 0.0 : 100.0 * (static_cast<double>(nodesBefore) - static_cast<double>(nodesAfter)) / nodesBefore;
+    STORM_LOG_INFO("Reordering after " << phase << " changed the DD from " << nodesBefore << " to " << nodesAfter << " nodes (saved " << savedPercentage
+                                       << "%) in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+    return std::make_pair(nodesBefore, nodesAfter);
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void executeInParallel(storm::dd::DdManager<Type> const& ddManager, std::vector<std::function<void()>> const& functions) {
+    if (std::is_same<ValueType, double>::value) {
+        ddManager.executeInParallel(functions);
+    } else {
+        for (auto const& function : functions) {
+            function();
+        }
+    }
+}
+
 template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                              storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
                                                                                              std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -120,6 +201,28 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStatesByChaining(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionPartitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
+
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStatesByChaining(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionPartitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
+
+template std::pair<uint64_t, uint64_t> reorderAtPhaseBoundary(storm::dd::DdManager<storm::dd::DdType::CUDD>& ddManager, std::string const& phase,
+                                                              storm::dd::Dd<storm::dd::DdType::CUDD> const& dd);
+template std::pair<uint64_t, uint64_t> reorderAtPhaseBoundary(storm::dd::DdManager<storm::dd::DdType::Sylvan>& ddManager, std::string const& phase,
+                                                              storm::dd::Dd<storm::dd::DdType::Sylvan> const& dd);
+
+template void executeInParallel<storm::dd::DdType::CUDD, double>(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager,
+                                                                std::vector<std::function<void()>> const& functions);
+template void executeInParallel<storm::dd::DdType::Sylvan, double>(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
+                                                                  std::vector<std::function<void()>> const& functions);
+template void executeInParallel<storm::dd::DdType::Sylvan, storm::RationalNumber>(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
+                                                                                 std::vector<std::function<void()>> const& functions);
+template void executeInParallel<storm::dd::DdType::Sylvan, storm::RationalFunction>(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
+                                                                                   std::vector<std::function<void()>> const& functions);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
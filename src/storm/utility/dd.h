@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "storm/storage/dd/DdType.h"
@@ -19,6 +21,9 @@ class Bdd;
 
 template<storm::dd::DdType Type, typename ValueType>
 class Add;
+
+template<storm::dd::DdType Type>
+class Dd;
 }  // namespace dd
 
 namespace utility {
@@ -29,6 +34,24 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes the states reachable from the initial states using a partitioned transition relation. Rather than applying
+ * the union of all partitions in a breadth-first manner, each partition is applied until no new states are found
+ * before moving on to the next one (chaining). This is repeated until a fixpoint is reached. For loosely coupled
+ * systems, this typically keeps the intermediate BDDs much smaller than for the monolithic relation.
+ *
+ * @param initialStates The initial states.
+ * @param transitionPartitions The partitions of the transition relation, whose union is the full relation.
+ * @param rowMetaVariables The meta variables encoding the source states.
+ * @param columnMetaVariables The meta variables encoding the target states.
+ * @return The reachable states and the number of (outer) iterations.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStatesByChaining(storm::dd::Bdd<Type> const& initialStates,
+                                                                           std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                           std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                           std::set<storm::expressions::Variable> const& columnMetaVariables);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -43,6 +66,29 @@ template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager,
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+/*!
+ * Triggers a reordering of the DD variables at the boundary of a build phase and reports how the number of nodes of the
+ * given DD changed. If the library does not support reordering, this does nothing.
+ *
+ * @param ddManager The manager whose variables to reorder.
+ * @param phase The name of the phase that was completed (used for reporting only).
+ * @param dd The DD whose number of nodes is reported.
+ * @return The number of nodes of the given DD before and after the reordering.
+ */
+template<storm::dd::DdType Type>
+std::pair<uint64_t, uint64_t> reorderAtPhaseBoundary(storm::dd::DdManager<Type>& ddManager, std::string const& phase, storm::dd::Dd<Type> const& dd);
+
+/*!
+ * Executes the given functions through the given manager, in parallel whenever the DD operations for the given value type are thread-safe (see
+ * DdManager::executeInParallel). The operations on exact and parametric values rely on number types that must not be shared across threads, so
+ * the functions are executed one after another for these value types.
+ *
+ * @param ddManager The manager through which the functions are executed.
+ * @param functions The functions to execute. They must not modify data that they share.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+void executeInParallel(storm::dd::DdManager<Type> const& ddManager, std::vector<std::function<void()>> const& functions);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
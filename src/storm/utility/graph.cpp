@@ -1,5 +1,6 @@
 #include "graph.h"
 #include <algorithm>
+#include <atomic>
 
 #include "storm-config.h"
 #include "utility/OsDetection.h"
@@ -23,8 +24,13 @@
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/profiling.h"
+#include "storm/utility/tracing.h"
 
 #include <queue>
 
@@ -32,6 +38,108 @@ namespace storm {
 namespace utility {
 namespace graph {
 
+namespace {
+
+std::atomic<uint64_t> numberOfSearchThreads(0);
+std::atomic<uint64_t> parallelSearchThreshold(DefaultParallelSearchThreshold);
+
+/// The number of frontier states that a thread claims at once during a parallel search.
+uint64_t constexpr SearchChunkSize = 1024;
+
+/*!
+ * Retrieves the number of threads with which a backward search on a model with the given number of states is performed.
+ */
+uint64_t getNumberOfSearchThreads(uint64_t numberOfStates) {
+    if (numberOfStates < parallelSearchThreshold.load(std::memory_order_relaxed)) {
+        return 1;
+    }
+    uint64_t result = numberOfSearchThreads.load(std::memory_order_relaxed);
+    if (result == 0) {
+        result = storm::settings::hasModule<storm::settings::modules::CoreSettings>()
+                     ? storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads()
+                     : 1;
+    }
+    return result;
+}
+
+/*!
+ * Retrieves the state that is the source of the given entry of the backward transitions.
+ */
+template<typename ValueType>
+uint64_t getPredecessor(storm::storage::MatrixEntry<storm::storage::sparse::state_type, ValueType> const& entry) {
+    return entry.getColumn();
+}
+
+uint64_t getPredecessor(storm::storage::SparseMatrixStructure::index_type predecessor) {
+    return predecessor;
+}
+
+/*!
+ * Performs a level-synchronous backward search that extends the given reached states by all constraint states that can reach them
+ * and that are accepted by the given predicate. The predecessors of the states on the current level are explored concurrently,
+ * where each thread collects the accepted predecessors in its own buffer. A bit vector of claimed states ensures that every state
+ * is checked at most once per level. During a level, the reached states are only read, i.e., the predicate is evaluated w.r.t. the
+ * states reached in previous levels. Since a state is checked again whenever one of its successors is reached, the result coincides
+ * with the one of the sequential search for every predicate that is monotone in the set of reached states.
+ *
+ * @param backwardTransitions The reversed transition relation of the graph structure to search.
+ * @param constraintStates The states that may be added.
+ * @param reachedStates The states from which the search starts. The reached states are added.
+ * @param numberOfThreads The number of threads to use.
+ * @param accept A callable with signature bool(uint64_t state) that decides whether a (not yet reached) predecessor is added.
+ */
+template<typename BackwardTransitions, typename AcceptPredecessor>
+void performParallelBackwardSearch(BackwardTransitions const& backwardTransitions, storm::storage::BitVector const& constraintStates,
+                                   storm::storage::BitVector& reachedStates, uint64_t numberOfThreads, AcceptPredecessor const& accept) {
+    std::vector<std::atomic<uint64_t>> claimedStates((reachedStates.size() + 63) / 64);
+    std::vector<std::vector<uint64_t>> localClaimedStates(numberOfThreads);
+    std::vector<std::vector<uint64_t>> localNextFrontiers(numberOfThreads);
+    std::vector<uint64_t> frontier(reachedStates.begin(), reachedStates.end());
+
+    while (!frontier.empty()) {
+        storm::utility::parallel::forEachChunk(numberOfThreads, frontier.size(), SearchChunkSize, [&](uint64_t thread, uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                for (auto const& entry : backwardTransitions.getRow(frontier[index])) {
+                    uint64_t const predecessor = getPredecessor(entry);
+                    if (!constraintStates.get(predecessor) || reachedStates.get(predecessor)) {
+                        continue;
+                    }
+                    std::atomic<uint64_t>& word = claimedStates[predecessor / 64];
+                    uint64_t const mask = 1ull << (predecessor % 64);
+                    if ((word.load(std::memory_order_relaxed) & mask) != 0 || (word.fetch_or(mask, std::memory_order_relaxed) & mask) != 0) {
+                        continue;
+                    }
+                    localClaimedStates[thread].push_back(predecessor);
+                    if (accept(predecessor)) {
+                        localNextFrontiers[thread].push_back(predecessor);
+                    }
+                }
+            }
+        });
+
+        // Reset the claims and move the accepted states to the next level.
+        frontier.clear();
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            for (auto state : localClaimedStates[thread]) {
+                claimedStates[state / 64].store(0, std::memory_order_relaxed);
+            }
+            localClaimedStates[thread].clear();
+            for (auto state : localNextFrontiers[thread]) {
+                reachedStates.set(state, true);
+            }
+            frontier.insert(frontier.end(), localNextFrontiers[thread].begin(), localNextFrontiers[thread].end());
+            localNextFrontiers[thread].clear();
+        }
+    }
+}
+
+}  // namespace
+
+void setNumberOfSearchThreads(uint64_t numberOfThreads, uint64_t stateThreshold) {
+    numberOfSearchThreads.store(numberOfThreads, std::memory_order_relaxed);
+    parallelSearchThreshold.store(stateThreshold, std::memory_order_relaxed);
+}
+
 template<typename T>
 storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates,
                                              storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
@@ -309,6 +417,7 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
 template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    STORM_TRACE_ZONE("performProbGreater0");
     // Prepare the resulting bit vector.
     uint_fast64_t numberOfStates = phiStates.size();
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -316,6 +425,12 @@ storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> co
     // Add all psi states as they already satisfy the condition.
     statesWithProbabilityGreater0 |= psiStates;
 
+    uint64_t numberOfThreads = useStepBound ? 1 : getNumberOfSearchThreads(numberOfStates);
+    if (numberOfThreads > 1) {
+        performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, numberOfThreads, [](uint64_t) { return true; });
+        return statesWithProbabilityGreater0;
+    }
+
     // Initialize the stack used for the DFS with the states.
     std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
 
@@ -375,6 +490,49 @@ storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& ba
     return statesWithProbability1;
 }
 
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrixStructure const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates) {
+    STORM_TRACE_ZONE("performProbGreater0");
+    storm::storage::BitVector statesWithProbabilityGreater0 = psiStates;
+    uint64_t numberOfThreads = getNumberOfSearchThreads(phiStates.size());
+    if (numberOfThreads > 1) {
+        performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, numberOfThreads, [](uint64_t) { return true; });
+        return statesWithProbabilityGreater0;
+    }
+
+    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+    while (!stack.empty()) {
+        uint_fast64_t currentState = stack.back();
+        stack.pop_back();
+        for (auto predecessor : backwardTransitions.getRow(currentState)) {
+            if (phiStates.get(predecessor) && !statesWithProbabilityGreater0.get(predecessor)) {
+                statesWithProbabilityGreater0.set(predecessor, true);
+                stack.push_back(predecessor);
+            }
+        }
+    }
+    return statesWithProbabilityGreater0;
+}
+
+storm::storage::BitVector performProb1(storm::storage::SparseMatrixStructure const& backwardTransitions, storm::storage::BitVector const&,
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
+    storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0);
+    statesWithProbability1.complement();
+    return statesWithProbability1;
+}
+
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrixStructure const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
+    storm::utility::profiling::ScopedPhase phase("qualitative analysis");
+    STORM_TRACE_ZONE("qualitative analysis");
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
+    result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
+    result.first.complement();
+    return result;
+}
+
 template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                        storm::storage::BitVector const& psiStates) {
@@ -388,18 +546,18 @@ template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
-    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
-    result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
-    result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
-    result.first.complement();
-    return result;
+    // As only the predecessors of the states are required, the values of the backward transitions are not computed.
+    storm::storage::SparseMatrixStructure backwardTransitions =
+        model.getTransitionMatrix().transposeStructure(true, false, getNumberOfSearchThreads(model.getNumberOfStates()));
+    return performProb01(backwardTransitions, phiStates, psiStates);
 }
 
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    storm::utility::profiling::ScopedPhase phase("qualitative analysis");
+    STORM_TRACE_ZONE("qualitative analysis");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
@@ -680,6 +838,7 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    STORM_TRACE_ZONE("performProbGreater0E");
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -688,6 +847,12 @@ storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> c
     // Add all psi states as the already satisfy the condition.
     statesWithProbabilityGreater0 |= psiStates;
 
+    uint64_t numberOfThreads = useStepBound ? 1 : getNumberOfSearchThreads(numberOfStates);
+    if (numberOfThreads > 1) {
+        performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, numberOfThreads, [](uint64_t) { return true; });
+        return statesWithProbabilityGreater0;
+    }
+
     // Initialize the stack used for the DFS with the states
     std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
 
@@ -750,20 +915,56 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    STORM_TRACE_ZONE("performProb1E");
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
     storm::storage::BitVector currentStates(numberOfStates, true);
+    storm::storage::BitVector nextStates;
     std::vector<uint_fast64_t> stack;
-    stack.reserve(numberOfStates);
+    uint64_t numberOfThreads = getNumberOfSearchThreads(numberOfStates);
+    if (numberOfThreads <= 1) {
+        stack.reserve(numberOfStates);
+    }
+
+    // Checks whether the given state has only successors in the current state set for one of the nondeterministic choices
+    // (and at least one of them is in the next state set).
+    auto hasChoiceWithAllSuccessorsInCurrentStates = [&](uint64_t state) {
+        for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+            if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                bool allSuccessorsInCurrentStates = true;
+                bool hasNextStateSuccessor = false;
+                for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
+                                                                              successorEntryIte = transitionMatrix.end(row);
+                     successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                    if (!currentStates.get(successorEntryIt->getColumn())) {
+                        allSuccessorsInCurrentStates = false;
+                        break;
+                    } else if (nextStates.get(successorEntryIt->getColumn())) {
+                        hasNextStateSuccessor = true;
+                    }
+                }
+
+                if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
 
     // Perform the loop as long as the set of states gets larger.
     bool done = false;
     uint_fast64_t currentState;
     while (!done) {
-        stack.clear();
-        storm::storage::BitVector nextStates(psiStates);
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        nextStates = psiStates;
+
+        if (numberOfThreads > 1) {
+            performParallelBackwardSearch(backwardTransitions, phiStates, nextStates, numberOfThreads, hasChoiceWithAllSuccessorsInCurrentStates);
+        } else {
+            stack.clear();
+            stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        }
 
         while (!stack.empty()) {
             currentState = stack.back();
@@ -773,33 +974,12 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                                                           predecessorEntryIte = backwardTransitions.end(currentState);
                  predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                 if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                    // Check whether the predecessor has only successors in the current state set for one of the
-                    // nondeterminstic choices.
-                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                         row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                        if (!choiceConstraint || choiceConstraint.get().get(row)) {
-                            bool allSuccessorsInCurrentStates = true;
-                            bool hasNextStateSuccessor = false;
-                            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
-                                                                                          successorEntryIte = transitionMatrix.end(row);
-                                 successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                if (!currentStates.get(successorEntryIt->getColumn())) {
-                                    allSuccessorsInCurrentStates = false;
-                                    break;
-                                } else if (nextStates.get(successorEntryIt->getColumn())) {
-                                    hasNextStateSuccessor = true;
-                                }
-                            }
-
-                            // If all successors for a given nondeterministic choice are in the current state set, we
-                            // add it to the set of states for the next iteration and perform a backward search from
-                            // that state.
-                            if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
-                                nextStates.set(predecessorEntryIt->getColumn(), true);
-                                stack.push_back(predecessorEntryIt->getColumn());
-                                break;
-                            }
-                        }
+                    // If all successors for a given nondeterministic choice are in the current state set, we
+                    // add it to the set of states for the next iteration and perform a backward search from
+                    // that state.
+                    if (hasChoiceWithAllSuccessorsInCurrentStates(predecessorEntryIt->getColumn())) {
+                        nextStates.set(predecessorEntryIt->getColumn(), true);
+                        stack.push_back(predecessorEntryIt->getColumn());
                     }
                 }
             }
@@ -829,6 +1009,8 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::profiling::ScopedPhase phase("qualitative analysis");
+    STORM_TRACE_ZONE("qualitative analysis");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
 
     result.first = performProb0A(backwardTransitions, phiStates, psiStates);
@@ -851,6 +1033,7 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    STORM_TRACE_ZONE("performProbGreater0A");
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -859,6 +1042,43 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
     // Add all psi states as the already satisfy the condition.
     statesWithProbabilityGreater0 |= psiStates;
 
+    // Checks whether the given state has at least one successor in the current state set for every nondeterministic choice within the
+    // possibly given choiceConstraint.
+    // Note: The backwards edge that leads to the state might be induced by a choice that violates the choiceConstraint.
+    // However this is not problematic as long as there is at least one enabled choice for the state.
+    auto hasSuccessorWithProbabilityGreater0ForAllChoices = [&](uint64_t state) {
+        uint_fast64_t row = nondeterministicChoiceIndices[state];
+        uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[state + 1];
+        if (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup) {
+            return false;
+        }
+        for (; row < endOfGroup; ++row) {
+            if (!choiceConstraint || choiceConstraint->get(row)) {
+                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
+                                                                              successorEntryIte = transitionMatrix.end(row);
+                     successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                    if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
+                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                        break;
+                    }
+                }
+
+                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    uint64_t numberOfThreads = useStepBound ? 1 : getNumberOfSearchThreads(numberOfStates);
+    if (numberOfThreads > 1) {
+        performParallelBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, numberOfThreads,
+                                      hasSuccessorWithProbabilityGreater0ForAllChoices);
+        return statesWithProbabilityGreater0;
+    }
+
     // Initialize the stack used for the DFS with the states
     std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
 
@@ -893,47 +1113,17 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
              predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
             if (phiStates.get(predecessorEntryIt->getColumn())) {
                 if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
-                    // Check whether the predecessor has at least one successor in the current state set for every
-                    // nondeterministic choice within the possibly given choiceConstraint.
-
-                    // Note: The backwards edge might be induced by a choice that violates the choiceConstraint.
-                    // However this is not problematic as long as there is at least one enabled choice for the predecessor.
-                    uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                    uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
-                    if (!choiceConstraint || choiceConstraint->getNextSetIndex(row) < endOfGroup) {
-                        bool addToStatesWithProbabilityGreater0 = true;
-                        for (; row < endOfGroup; ++row) {
-                            if (!choiceConstraint || choiceConstraint->get(row)) {
-                                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
-                                for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
-                                                                                              successorEntryIte = transitionMatrix.end(row);
-                                     successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                    if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
-                                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
-                                        break;
-                                    }
-                                }
-
-                                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
-                                    addToStatesWithProbabilityGreater0 = false;
-                                    break;
-                                }
-                            }
-                        }
-
-                        // If we need to add the state, then actually add it and perform further search from the state.
-                        if (addToStatesWithProbabilityGreater0) {
-                            // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                            if (useStepBound) {
-                                // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                                stepStack.push_back(currentStepBound - 1);
-                            }
-                            statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
-                            stack.push_back(predecessorEntryIt->getColumn());
+                    // If we need to add the state, then actually add it and perform further search from the state.
+                    if (hasSuccessorWithProbabilityGreater0ForAllChoices(predecessorEntryIt->getColumn())) {
+                        // If we don't have a bound on the number of steps to take, just add the state to the stack.
+                        if (useStepBound) {
+                            // If there is at least one more step to go, we need to push the state and the new number of steps.
+                            remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
+                            stepStack.push_back(currentStepBound - 1);
                         }
+                        statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
+                        stack.push_back(predecessorEntryIt->getColumn());
                     }
-
                 } else if (useStepBound && remainingSteps[predecessorEntryIt->getColumn()] < currentStepBound - 1) {
                     // We have found a shorter path to the predecessor. Hence, we need to explore it again.
                     // If there is a choiceConstraint, we still need to check whether the backwards edge was induced by a valid action
@@ -997,20 +1187,53 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates) {
+    STORM_TRACE_ZONE("performProb1A");
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
     storm::storage::BitVector currentStates(numberOfStates, true);
+    storm::storage::BitVector nextStates;
     std::vector<uint_fast64_t> stack;
-    stack.reserve(numberOfStates);
+    uint64_t numberOfThreads = getNumberOfSearchThreads(numberOfStates);
+    if (numberOfThreads <= 1) {
+        stack.reserve(numberOfStates);
+    }
+
+    // Checks whether the given state has only successors in the current state set for all of the nondeterministic choices
+    // and that for each choice there exists a successor that is already in the next states.
+    auto hasAllChoicesWithSuccessorsInCurrentStates = [&](uint64_t state) {
+        for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+            bool hasAtLeastOneSuccessorWithProbability1 = false;
+            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
+                                                                          successorEntryIte = transitionMatrix.end(row);
+                 successorEntryIt != successorEntryIte; ++successorEntryIt) {
+                if (!currentStates.get(successorEntryIt->getColumn())) {
+                    return false;
+                }
+                if (nextStates.get(successorEntryIt->getColumn())) {
+                    hasAtLeastOneSuccessorWithProbability1 = true;
+                }
+            }
+
+            if (!hasAtLeastOneSuccessorWithProbability1) {
+                return false;
+            }
+        }
+        return true;
+    };
 
     // Perform the loop as long as the set of states gets smaller.
     bool done = false;
     uint_fast64_t currentState;
     while (!done) {
-        stack.clear();
-        storm::storage::BitVector nextStates(psiStates);
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        nextStates = psiStates;
+
+        if (numberOfThreads > 1) {
+            performParallelBackwardSearch(backwardTransitions, phiStates, nextStates, numberOfThreads, hasAllChoicesWithSuccessorsInCurrentStates);
+        } else {
+            stack.clear();
+            stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        }
 
         while (!stack.empty()) {
             currentState = stack.back();
@@ -1020,36 +1243,10 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                                                           predecessorEntryIte = backwardTransitions.end(currentState);
                  predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                 if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                    // Check whether the predecessor has only successors in the current state set for all of the
-                    // nondeterminstic choices and that for each choice there exists a successor that is already
-                    // in the next states.
-                    bool addToStatesWithProbability1 = true;
-                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                         row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                        bool hasAtLeastOneSuccessorWithProbability1 = false;
-                        for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
-                                                                                      successorEntryIte = transitionMatrix.end(row);
-                             successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                            if (!currentStates.get(successorEntryIt->getColumn())) {
-                                addToStatesWithProbability1 = false;
-                                goto afterCheckLoop;
-                            }
-                            if (nextStates.get(successorEntryIt->getColumn())) {
-                                hasAtLeastOneSuccessorWithProbability1 = true;
-                            }
-                        }
-
-                        if (!hasAtLeastOneSuccessorWithProbability1) {
-                            addToStatesWithProbability1 = false;
-                            break;
-                        }
-                    }
-
-                afterCheckLoop:
                     // If all successors for all nondeterministic choices are in the current state set, we
                     // add it to the set of states for the next iteration and perform a backward search from
                     // that state.
-                    if (addToStatesWithProbability1) {
+                    if (hasAllChoicesWithSuccessorsInCurrentStates(predecessorEntryIt->getColumn())) {
                         nextStates.set(predecessorEntryIt->getColumn(), true);
                         stack.push_back(predecessorEntryIt->getColumn());
                     }
@@ -1073,6 +1270,8 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::profiling::ScopedPhase phase("qualitative analysis");
+    STORM_TRACE_ZONE("qualitative analysis");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
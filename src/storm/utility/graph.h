@@ -10,6 +10,7 @@
 #include "storm/models/sparse/DeterministicModel.h"
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/storage/Scheduler.h"
+#include "storm/storage/SparseMatrixStructure.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/dd/Bdd.h"
@@ -122,6 +123,20 @@ template<typename T>
 std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates,
                                         boost::optional<storm::storage::BitVector> const& subsystem = boost::none);
 
+/// Sparse models with at least this many states are searched in parallel (if more than one search thread is used).
+uint64_t constexpr DefaultParallelSearchThreshold = 100000;
+
+/*!
+ * Sets the number of threads used by the backward searches of the qualitative analyses on sparse models (performProbGreater0,
+ * performProbGreater0E, performProbGreater0A, performProb1E, performProb1A and the functions based on them). Models with at least
+ * the given number of states are then searched level by level, where the predecessors of the states on the current level are
+ * explored concurrently. Searches with a step bound are always performed sequentially.
+ *
+ * @param numberOfThreads The number of threads. If zero (default), the value of the solver-threads setting is used.
+ * @param stateThreshold The minimal number of states for which the parallel search is used.
+ */
+void setNumberOfSearchThreads(uint64_t numberOfThreads, uint64_t stateThreshold = DefaultParallelSearchThreshold);
+
 /*!
  * Performs a backward depth-first search trough the underlying graph structure
  * of the given model to determine which states of the model have a positive probability
@@ -172,6 +187,17 @@ template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                        storm::storage::BitVector const& psiStates);
 
+/*!
+ * Performs performProbGreater0, performProb1 and performProb01 (without step bound) on the given structure of the backward transitions.
+ */
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrixStructure const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates);
+storm::storage::BitVector performProb1(storm::storage::SparseMatrixStructure const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrixStructure const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
  * deterministic model.
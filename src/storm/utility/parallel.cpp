@@ -0,0 +1,167 @@
+#include "storm/utility/parallel.h"
+
+#include <condition_variable>
+#include <deque>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+namespace {
+
+std::atomic<uint64_t> defaultNumberOfThreads(1);
+std::atomic<bool> threadPinning(false);
+
+/*!
+ * Binds the calling thread to the processor with the given index among the processors that the process may run on.
+ */
+void pinCurrentThread(uint64_t processorIndex) {
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || CPU_COUNT(&allowed) == 0) {
+        return;
+    }
+    processorIndex %= CPU_COUNT(&allowed);
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &allowed) && processorIndex-- == 0) {
+            cpu_set_t target;
+            CPU_ZERO(&target);
+            CPU_SET(cpu, &target);
+            sched_setaffinity(0, sizeof(target), &target);
+            return;
+        }
+    }
+#else
+    static_cast<void>(processorIndex);
+#endif
+}
+
+/*!
+ * A process-wide set of threads that execute the jobs submitted to it in order. Threads are added whenever a caller requests more
+ * threads than there are. The threads are detached and live until the process terminates.
+ */
+class ThreadPool {
+   public:
+    static ThreadPool& getInstance() {
+        // The pool is intentionally leaked such that its threads never access a destroyed pool during static destruction.
+        static ThreadPool* pool = new ThreadPool();
+        return *pool;
+    }
+
+    /*!
+     * Submits the given job numberOfJobs times and makes sure that there are enough threads to execute them concurrently.
+     */
+    void submit(uint64_t numberOfJobs, std::function<void()> const& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (uint64_t i = 0; i < numberOfJobs; ++i) {
+            jobs.push_back(job);
+        }
+        while (numberOfIdleThreads < jobs.size()) {
+            std::thread(&ThreadPool::work, this, numberOfThreads++).detach();
+            ++numberOfIdleThreads;
+        }
+        jobAvailable.notify_all();
+    }
+
+   private:
+    ThreadPool() = default;
+
+    void work(uint64_t poolThreadIndex) {
+        if (threadPinning) {
+            // The first processor is left to the threads outside the pool, which also participate in the work.
+            pinCurrentThread(poolThreadIndex + 1);
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            jobAvailable.wait(lock, [this]() { return !jobs.empty(); });
+            std::function<void()> job = std::move(jobs.front());
+            jobs.pop_front();
+            --numberOfIdleThreads;
+            lock.unlock();
+            job();
+            lock.lock();
+            ++numberOfIdleThreads;
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::deque<std::function<void()>> jobs;
+    uint64_t numberOfIdleThreads = 0;
+    uint64_t numberOfThreads = 0;
+};
+
+}  // namespace
+
+uint64_t getNumberOfHardwareThreads() {
+    return std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void setDefaultNumberOfThreads(uint64_t numberOfThreads) {
+    defaultNumberOfThreads = numberOfThreads == 0 ? getNumberOfHardwareThreads() : numberOfThreads;
+}
+
+uint64_t getDefaultNumberOfThreads() {
+    return std::max<uint64_t>(defaultNumberOfThreads, 1);
+}
+
+bool setThreadPinning(bool pinThreads) {
+#ifdef __linux__
+    threadPinning = pinThreads;
+    return true;
+#else
+    return !pinThreads;
+#endif
+}
+
+void runOnWorkers(uint64_t numberOfThreads, std::function<void(uint64_t)> const& worker) {
+    if (numberOfThreads <= 1) {
+        worker(0);
+        return;
+    }
+
+    // The state is shared with the submitted jobs as they may only be executed after this call has returned.
+    struct State {
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool closed = false;
+        uint64_t numberOfActiveHelpers = 0;
+        uint64_t nextThreadIndex = 1;
+    };
+    auto state = std::make_shared<State>();
+    std::function<void(uint64_t)> const* workerPointer = &worker;
+
+    ThreadPool::getInstance().submit(numberOfThreads - 1, [state, workerPointer]() {
+        uint64_t threadIndex;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->closed) {
+                // The caller has already finished the work.
+                return;
+            }
+            threadIndex = state->nextThreadIndex++;
+            ++state->numberOfActiveHelpers;
+        }
+        (*workerPointer)(threadIndex);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (--state->numberOfActiveHelpers == 0) {
+            state->finished.notify_all();
+        }
+    });
+
+    worker(0);
+
+    // Helpers that did not start yet do not start anymore and we wait for the ones that did.
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->closed = true;
+    state->finished.wait(lock, [&state]() { return state->numberOfActiveHelpers == 0; });
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Retrieves the number of threads that the hardware can run concurrently. The result is at least one.
+ */
+uint64_t getNumberOfHardwareThreads();
+
+/*!
+ * Sets the number of threads that parallel features use unless they are configured otherwise (e.g., via the global --threads option).
+ *
+ * @param numberOfThreads The number of threads. Zero means that all hardware threads are used.
+ */
+void setDefaultNumberOfThreads(uint64_t numberOfThreads);
+
+/*!
+ * Retrieves the number of threads that parallel features use unless they are configured otherwise. The result is at least one.
+ */
+uint64_t getDefaultNumberOfThreads();
+
+/*!
+ * Sets whether the threads of the pool used by `runOnWorkers` are pinned to distinct processors. Pinning only affects pool threads that are
+ * created afterwards and is only supported on Linux. On machines with several NUMA nodes, pinned threads keep accessing the memory of their
+ * node instead of migrating across sockets.
+ *
+ * @param pinThreads If true, every new pool thread binds itself to one of the processors the process may run on.
+ * @return True iff pinning is supported on this platform (or pinning is disabled).
+ */
+bool setThreadPinning(bool pinThreads);
+
+/*!
+ * Runs the given worker in the calling thread (with thread index zero) and on up to numberOfThreads - 1 threads of a process-wide pool
+ * (with thread indices 1, 2, ...) and returns once all invocations are finished. The pool threads are created on demand and reused by
+ * all parallel features, which avoids creating threads for every parallel operation. If no pool thread becomes available before the
+ * calling thread is done, the worker is not invoked on the pool at all, such that nested parallel operations cannot deadlock. Hence, the
+ * worker has to be able to complete all of the work by itself (e.g., by claiming chunks of work from a shared counter). The worker must
+ * not throw.
+ *
+ * @param numberOfThreads The (maximal) number of concurrent invocations of the worker.
+ * @param worker A callable with signature void(uint64_t threadIndex).
+ */
+void runOnWorkers(uint64_t numberOfThreads, std::function<void(uint64_t)> const& worker);
+
+/*!
+ * Splits the range [0, size) into chunks of (at most) the given size and lets the given number of threads process
+ * them. A thread claims the next unprocessed chunk as soon as it is done with its previous one, so the work is
+ * balanced even if the chunks differ a lot in cost. If the body throws, the remaining chunks are skipped and the
+ * first exception is rethrown in the calling thread.
+ *
+ * @param numberOfThreads The number of threads to use. If this is (at most) one, the body is executed in the calling thread.
+ * @param size The size of the range.
+ * @param chunkSize The number of consecutive indices that are claimed at once.
+ * @param body A callable with signature void(uint64_t threadIndex, uint64_t begin, uint64_t end).
+ */
+template<typename Body>
+void forEachChunk(uint64_t numberOfThreads, uint64_t size, uint64_t chunkSize, Body const& body) {
+    chunkSize = std::max<uint64_t>(chunkSize, 1);
+    uint64_t numberOfChunks = (size + chunkSize - 1) / chunkSize;
+    numberOfThreads = std::min(numberOfThreads, numberOfChunks);
+    if (numberOfThreads <= 1) {
+        for (uint64_t begin = 0; begin < size; begin += chunkSize) {
+            body(0, begin, std::min(begin + chunkSize, size));
+        }
+        return;
+    }
+
+    std::atomic<uint64_t> nextChunk(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto worker = [&](uint64_t threadIndex) {
+        try {
+            for (uint64_t chunk = nextChunk++; chunk < numberOfChunks && !failed; chunk = nextChunk++) {
+                uint64_t begin = chunk * chunkSize;
+                body(threadIndex, begin, std::min(begin + chunkSize, size));
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!failed.exchange(true)) {
+                firstException = std::current_exception();
+            }
+        }
+    };
+
+    runOnWorkers(numberOfThreads, worker);
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+/*!
+ * Executes the tasks of a directed acyclic graph with the given number of threads such that every task is started only after all of
+ * its predecessors are finished. Every thread has its own queue of ready tasks. A thread continues with the task that became ready
+ * most recently in its own queue (as it likely works on data that the thread has just touched) and steals the oldest task of another
+ * thread if its own queue is empty. If the body throws, the remaining tasks are skipped and the first exception is rethrown in the
+ * calling thread.
+ *
+ * @param numberOfThreads The number of threads to use. If this is (at most) one, the tasks are executed in the calling thread.
+ * @param successorStarts The successors of task i are successors[successorStarts[i]], ..., successors[successorStarts[i + 1] - 1].
+ * There is one entry per task plus a final entry.
+ * @param successors The successors of all tasks, i.e., the tasks that may only be started once the task is finished.
+ * @param body A callable with signature void(uint64_t threadIndex, uint64_t task).
+ */
+template<typename Body>
+void forEachInDag(uint64_t numberOfThreads, std::vector<uint64_t> const& successorStarts, std::vector<uint64_t> const& successors, Body const& body) {
+    uint64_t const numberOfTasks = successorStarts.empty() ? 0 : successorStarts.size() - 1;
+    std::unique_ptr<std::atomic<uint64_t>[]> pendingPredecessors(new std::atomic<uint64_t>[numberOfTasks]);
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        pendingPredecessors[task] = 0;
+    }
+    for (auto successor : successors) {
+        ++pendingPredecessors[successor];
+    }
+    std::vector<uint64_t> initialTasks;
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        if (pendingPredecessors[task] == 0) {
+            initialTasks.push_back(task);
+        }
+    }
+
+    numberOfThreads = std::min(numberOfThreads, numberOfTasks);
+    if (numberOfThreads <= 1) {
+        std::vector<uint64_t> readyTasks(initialTasks.rbegin(), initialTasks.rend());
+        while (!readyTasks.empty()) {
+            uint64_t task = readyTasks.back();
+            readyTasks.pop_back();
+            body(0, task);
+            for (uint64_t index = successorStarts[task]; index < successorStarts[task + 1]; ++index) {
+                if (--pendingPredecessors[successors[index]] == 0) {
+                    readyTasks.push_back(successors[index]);
+                }
+            }
+        }
+        return;
+    }
+
+    struct ReadyQueue {
+        std::mutex mutex;
+        std::deque<uint64_t> tasks;
+    };
+    std::vector<ReadyQueue> queues(numberOfThreads);
+    // The initial tasks are distributed round-robin.
+    for (uint64_t index = 0; index < initialTasks.size(); ++index) {
+        queues[index % numberOfThreads].tasks.push_back(initialTasks[index]);
+    }
+    std::atomic<uint64_t> finishedTasks(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto takeTask = [&](uint64_t threadIndex, uint64_t& task) {
+        {
+            ReadyQueue& ownQueue = queues[threadIndex];
+            std::lock_guard<std::mutex> lock(ownQueue.mutex);
+            if (!ownQueue.tasks.empty()) {
+                task = ownQueue.tasks.back();
+                ownQueue.tasks.pop_back();
+                return true;
+            }
+        }
+        for (uint64_t offset = 1; offset < numberOfThreads; ++offset) {
+            ReadyQueue& otherQueue = queues[(threadIndex + offset) % numberOfThreads];
+            std::lock_guard<std::mutex> lock(otherQueue.mutex);
+            if (!otherQueue.tasks.empty()) {
+                task = otherQueue.tasks.front();
+                otherQueue.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto worker = [&](uint64_t threadIndex) {
+        try {
+            uint64_t task;
+            while (finishedTasks < numberOfTasks && !failed) {
+                if (!takeTask(threadIndex, task)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                body(threadIndex, task);
+                for (uint64_t index = successorStarts[task]; index < successorStarts[task + 1]; ++index) {
+                    if (--pendingPredecessors[successors[index]] == 0) {
+                        ReadyQueue& ownQueue = queues[threadIndex];
+                        std::lock_guard<std::mutex> lock(ownQueue.mutex);
+                        ownQueue.tasks.push_back(successors[index]);
+                    }
+                }
+                ++finishedTasks;
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!failed.exchange(true)) {
+                firstException = std::current_exception();
+            }
+        }
+    };
+
+    // Tasks that are queued for threads that do not join are stolen by the others.
+    runOnWorkers(numberOfThreads, worker);
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,177 @@
+#include "storm/utility/permutation.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace utility {
+namespace permutation {
+
+std::string toString(OrderKind const& order) {
+    switch (order) {
+        case OrderKind::Bfs:
+            return "bfs";
+        case OrderKind::ReverseCuthillMcKee:
+            return "rcm";
+        case OrderKind::TopologicalScc:
+            return "scc";
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown order kind.");
+}
+
+namespace {
+
+template<typename ValueType>
+std::vector<uint64_t> createBfsPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector discovered(numberOfStates, false);
+    auto explore = [&](uint64_t start) {
+        // The result vector doubles as queue.
+        uint64_t next = result.size();
+        discovered.set(start);
+        result.push_back(start);
+        for (; next < result.size(); ++next) {
+            for (auto const& entry : transitionMatrix.getRowGroup(result[next])) {
+                if (!discovered.get(entry.getColumn())) {
+                    discovered.set(entry.getColumn());
+                    result.push_back(entry.getColumn());
+                }
+            }
+        }
+    };
+    for (auto state : initialStates) {
+        if (!discovered.get(state)) {
+            explore(state);
+        }
+    }
+    // Unreachable states are appended in their original order.
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (!discovered.get(state)) {
+            explore(state);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createReverseCuthillMcKeePermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    // The neighbours of a state are its successors and its predecessors.
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+    std::vector<uint64_t> degrees(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        degrees[state] = transitionMatrix.getRowGroupEntryCount(state) + backwardTransitions.getRowGroupEntryCount(state);
+    }
+
+    // Each connected component is started at a state of minimal degree.
+    std::vector<uint64_t> statesByDegree(numberOfStates);
+    std::iota(statesByDegree.begin(), statesByDegree.end(), 0);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(), [&degrees](uint64_t a, uint64_t b) { return degrees[a] < degrees[b]; });
+
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector discovered(numberOfStates, false);
+    std::vector<uint64_t> neighbours;
+    for (auto start : statesByDegree) {
+        if (discovered.get(start)) {
+            continue;
+        }
+        // The result vector doubles as queue.
+        uint64_t next = result.size();
+        discovered.set(start);
+        result.push_back(start);
+        for (; next < result.size(); ++next) {
+            uint64_t const state = result[next];
+            neighbours.clear();
+            for (auto const* matrix : {&transitionMatrix, &backwardTransitions}) {
+                for (auto const& entry : matrix->getRowGroup(state)) {
+                    if (!discovered.get(entry.getColumn())) {
+                        discovered.set(entry.getColumn());
+                        neighbours.push_back(entry.getColumn());
+                    }
+                }
+            }
+            std::stable_sort(neighbours.begin(), neighbours.end(), [&degrees](uint64_t a, uint64_t b) { return degrees[a] < degrees[b]; });
+            result.insert(result.end(), neighbours.begin(), neighbours.end());
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createTopologicalSccPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> result;
+    result.reserve(transitionMatrix.getRowGroupCount());
+    for (auto const& scc : sccDecomposition) {
+        result.insert(result.end(), scc.begin(), scc.end());
+    }
+    return result;
+}
+
+}  // namespace
+
+template<typename ValueType>
+std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::BitVector const& initialStates) {
+    STORM_LOG_THROW(transitionMatrix.getRowGroupCount() == transitionMatrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "The transition matrix has " << transitionMatrix.getRowGroupCount() << " row groups but " << transitionMatrix.getColumnCount()
+                                                 << " columns.");
+    std::vector<uint64_t> result;
+    switch (order) {
+        case OrderKind::Bfs:
+            result = createBfsPermutation(transitionMatrix, initialStates);
+            break;
+        case OrderKind::ReverseCuthillMcKee:
+            result = createReverseCuthillMcKeePermutation(transitionMatrix);
+            break;
+        case OrderKind::TopologicalScc:
+            result = createTopologicalSccPermutation(transitionMatrix);
+            break;
+    }
+    STORM_LOG_ASSERT(isValidPermutation(result), "The computed order is not a permutation.");
+    return result;
+}
+
+std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation) {
+    std::vector<uint64_t> result(permutation.size());
+    for (uint64_t index = 0; index < permutation.size(); ++index) {
+        result[permutation[index]] = index;
+    }
+    return result;
+}
+
+bool isValidPermutation(std::vector<uint64_t> const& permutation) {
+    storm::storage::BitVector seen(permutation.size(), false);
+    for (auto index : permutation) {
+        if (index >= permutation.size() || seen.get(index)) {
+            return false;
+        }
+        seen.set(index);
+    }
+    return true;
+}
+
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+
+}  // namespace permutation
+}  // namespace utility
+}  // namespace storm
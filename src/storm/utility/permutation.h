@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+class BitVector;
+}  // namespace storage
+
+namespace utility {
+namespace permutation {
+
+/*!
+ * The orders in which the states of a model can be arranged (e.g. to improve the memory locality of the solvers).
+ */
+enum class OrderKind {
+    // The order in which a breadth-first search from the initial states discovers the states.
+    Bfs,
+    // The reverse Cuthill-McKee order of the (undirected) state graph, which keeps the bandwidth of the transition matrix small.
+    ReverseCuthillMcKee,
+    // The states are grouped by SCCs, where the SCCs are sorted such that each SCC only reaches SCCs before it.
+    TopologicalScc
+};
+
+std::string toString(OrderKind const& order);
+
+/*!
+ * Computes an order of the states of the given transition matrix.
+ *
+ * @param order The kind of order.
+ * @param transitionMatrix The transition matrix, where each row group corresponds to a state.
+ * @param initialStates The initial states.
+ * @return For each position of the order, the state at this position.
+ * That is, the result can be used as inverse permutation (e.g. for SparseMatrix::permuteRowGroupsAndColumns).
+ */
+template<typename ValueType>
+std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::BitVector const& initialStates);
+
+/*!
+ * Inverts the given permutation, i.e., result[permutation[i]] = i for all i.
+ */
+std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation);
+
+/*!
+ * Checks whether the given vector is a permutation of 0, ..., size-1.
+ */
+bool isValidPermutation(std::vector<uint64_t> const& permutation);
+
+}  // namespace permutation
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,173 @@
+#include "storm/utility/profiling.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storm/io/file.h"
+#include "storm/utility/OsDetection.h"
+
+namespace storm {
+namespace utility {
+namespace profiling {
+namespace detail {
+
+std::atomic<bool> enabled(false);
+
+struct Phase {
+    Phase(std::string const& name, Phase* parent) : name(name), parent(parent), count(0), nanoseconds(0), peakResidentKilobytes(0) {
+        // Intentionally left empty.
+    }
+
+    Phase* getOrAddChild(std::string const& childName) {
+        for (auto const& child : children) {
+            if (child->name == childName) {
+                return child.get();
+            }
+        }
+        children.push_back(std::make_unique<Phase>(childName, this));
+        return children.back().get();
+    }
+
+    std::string name;
+    Phase* parent;
+    uint64_t count;
+    int64_t nanoseconds;
+    uint64_t peakResidentKilobytes;
+    std::map<std::string, uint64_t> counters;
+    // The children are kept in the order in which they were entered for the first time.
+    std::vector<std::unique_ptr<Phase>> children;
+};
+
+// The (unnamed) root of all phases, which is never entered. All accesses to the phase tree are guarded by the mutex.
+Phase root("", nullptr);
+std::mutex mutex;
+
+// The innermost active phase of each thread (or null if no phase is active).
+thread_local Phase* currentPhase = nullptr;
+
+}  // namespace detail
+
+namespace {
+
+int64_t getNanosecondsSinceEpoch() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t getPeakResidentKilobytes() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024;
+#else
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss;
+#endif
+}
+
+storm::json<double> phaseToJson(detail::Phase const& phase) {
+    storm::json<double> result;
+    result["name"] = phase.name;
+    result["count"] = phase.count;
+    result["time"] = static_cast<double>(phase.nanoseconds) * 1e-9;
+    result["peak-rss-kb"] = phase.peakResidentKilobytes;
+    if (!phase.counters.empty()) {
+        storm::json<double> counters;
+        for (auto const& nameValuePair : phase.counters) {
+            counters[nameValuePair.first] = nameValuePair.second;
+        }
+        result["counters"] = std::move(counters);
+    }
+    if (!phase.children.empty()) {
+        storm::json<double> children;
+        for (auto const& child : phase.children) {
+            children.push_back(phaseToJson(*child));
+        }
+        result["phases"] = std::move(children);
+    }
+    return result;
+}
+
+}  // namespace
+
+void setEnabled(bool value) {
+    detail::enabled.store(value, std::memory_order_relaxed);
+}
+
+void reset() {
+    std::lock_guard<std::mutex> lock(detail::mutex);
+    detail::root.children.clear();
+    detail::root.counters.clear();
+    detail::currentPhase = nullptr;
+}
+
+ScopedPhase::ScopedPhase(std::string const& name) : phase(nullptr), previousPhase(nullptr), startNanoseconds(0) {
+    if (!isEnabled()) {
+        return;
+    }
+    previousPhase = detail::currentPhase;
+    {
+        std::lock_guard<std::mutex> lock(detail::mutex);
+        phase = (previousPhase ? previousPhase : &detail::root)->getOrAddChild(name);
+    }
+    detail::currentPhase = phase;
+    startNanoseconds = getNanosecondsSinceEpoch();
+}
+
+ScopedPhase::~ScopedPhase() {
+    if (phase == nullptr) {
+        return;
+    }
+    int64_t elapsedNanoseconds = getNanosecondsSinceEpoch() - startNanoseconds;
+    uint64_t peakResidentKilobytes = getPeakResidentKilobytes();
+    {
+        std::lock_guard<std::mutex> lock(detail::mutex);
+        ++phase->count;
+        phase->nanoseconds += elapsedNanoseconds;
+        phase->peakResidentKilobytes = std::max(phase->peakResidentKilobytes, peakResidentKilobytes);
+    }
+    detail::currentPhase = previousPhase;
+}
+
+void addToCounter(std::string const& name, uint64_t value) {
+    if (!isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(detail::mutex);
+    (detail::currentPhase ? detail::currentPhase : &detail::root)->counters[name] += value;
+}
+
+storm::json<double> toJson() {
+    std::lock_guard<std::mutex> lock(detail::mutex);
+    storm::json<double> result;
+    storm::json<double> phases = storm::json<double>::array();
+    for (auto const& child : detail::root.children) {
+        phases.push_back(phaseToJson(*child));
+    }
+    result["phases"] = std::move(phases);
+    if (!detail::root.counters.empty()) {
+        storm::json<double> counters;
+        for (auto const& nameValuePair : detail::root.counters) {
+            counters[nameValuePair.first] = nameValuePair.second;
+        }
+        result["counters"] = std::move(counters);
+    }
+    result["peak-rss-kb"] = getPeakResidentKilobytes();
+    return result;
+}
+
+void exportToJsonFile(std::string const& filename) {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << toJson().dump(4) << '\n';
+    storm::utility::closeFile(stream);
+}
+
+}  // namespace profiling
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace utility {
+namespace profiling {
+
+namespace detail {
+struct Phase;
+extern std::atomic<bool> enabled;
+}  // namespace detail
+
+/*!
+ * Enables (or disables) the collection of phase timings and counters. As long as the collection is disabled, phases and counters cost a
+ * single (relaxed) atomic load.
+ */
+void setEnabled(bool value);
+
+/*!
+ * Retrieves whether phase timings and counters are collected.
+ */
+inline bool isEnabled() {
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Discards all collected phase timings and counters. This must not be called while a phase is active.
+ */
+void reset();
+
+/*!
+ * Measures the time spent between the construction and the destruction of this object as a phase with the given name. Phases that are started
+ * while another phase is active on the same thread are nested in that phase. The measurements of phases with the same name and the same
+ * parent phase are accumulated, which (for example) yields the total time spent for all SCCs of a topological solver. At the end of each phase,
+ * the peak resident set size of the process is recorded.
+ */
+class ScopedPhase {
+   public:
+    explicit ScopedPhase(std::string const& name);
+    ~ScopedPhase();
+
+    ScopedPhase(ScopedPhase const&) = delete;
+    ScopedPhase& operator=(ScopedPhase const&) = delete;
+
+   private:
+    // The measured phase or null if the collection was disabled when this object was created.
+    detail::Phase* phase;
+    detail::Phase* previousPhase;
+    int64_t startNanoseconds;
+};
+
+/*!
+ * Adds the given value to the counter with the given name of the innermost active phase of the calling thread.
+ */
+void addToCounter(std::string const& name, uint64_t value = 1);
+
+/*!
+ * Creates a JSON representation of all phases that have been measured so far. Every phase consists of its name, the number of times it was
+ * entered, its accumulated time in seconds, the peak resident set size (in kilobytes) at its end, its counters and its nested phases.
+ */
+storm::json<double> toJson();
+
+/*!
+ * Writes the JSON representation of all phases that have been measured so far to the given file.
+ */
+void exportToJsonFile(std::string const& filename);
+
+}  // namespace profiling
+}  // namespace utility
+}  // namespace storm
@@ -34,6 +34,25 @@ uint64_t RandomProbabilityGenerator<RationalNumber>::random_uint(uint64_t min, u
     return std::uniform_int_distribution<uint64_t>(min, max)(engine);
 }
 
+namespace {
+// The finalizer of the SplitMix64 generator, which is a bijection on 64 bit numbers with good avalanche properties.
+uint64_t mix(uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+}  // namespace
+
+CounterBasedRandomGenerator::CounterBasedRandomGenerator(uint64_t seed, uint64_t stream) : key(mix(mix(seed) ^ (stream * 0x9e3779b97f4a7c15ull))), counter(0) {
+    // Intentionally left empty.
+}
+
+double CounterBasedRandomGenerator::random() {
+    ++counter;
+    // Use the upper 53 bits, which are exactly representable as double.
+    return static_cast<double>(mix(key + counter * 0x9e3779b97f4a7c15ull) >> 11) * 0x1.0p-53;
+}
+
 BernoulliDistributionGenerator::BernoulliDistributionGenerator(double prob) : distribution(prob) {}
 
 bool BernoulliDistributionGenerator::random(boost::mt19937& engine) {
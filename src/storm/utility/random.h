@@ -41,6 +41,23 @@ class RandomProbabilityGenerator<storm::RationalNumber> {
     std::mt19937 engine;
 };
 
+/*!
+ * A counter-based generator of uniformly distributed numbers in [0,1).
+ *
+ * The i-th number of a stream is obtained by hashing the key of the stream with i. In contrast to seeding a Mersenne twister, creating a stream is
+ * essentially free, so that every trace of a simulation may use its own stream identified by the index of the trace. The drawn numbers then only
+ * depend on the seed and the index of the trace, regardless of which thread simulates the trace.
+ */
+class CounterBasedRandomGenerator {
+   public:
+    CounterBasedRandomGenerator(uint64_t seed, uint64_t stream);
+    double random();
+
+   private:
+    uint64_t key;
+    uint64_t counter;
+};
+
 class BernoulliDistributionGenerator {
    public:
     BernoulliDistributionGenerator(double prob);
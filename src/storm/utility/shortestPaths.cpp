@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <ostream>
 #include <queue>
 #include <set>
@@ -262,15 +263,13 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
 
         for (state_t predecessor : graphPredecessors[node]) {
             // add shortest paths to predecessors plus edge to current node
-            Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
-                                                 shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
-
             // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
+            if (shortestPathToNode.predecessorNode == boost::optional<state_t>(predecessor)) {
+                continue;
             }
+            Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
+                                                 shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
+            addCandidatePath(node, pathToPredecessorPlusEdge);
         }
     }
 
@@ -297,28 +296,30 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // take that path, add an edge to the current node; that's a candidate
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
                                                  kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
+            addCandidatePath(node, pathToPredecessorPlusEdge);
         }
         // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
     }
 
     // Step B.6 in J&M paper
     if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+        // the most probable candidate is on top of the heap
+        std::pop_heap(candidatePaths[node].begin(), candidatePaths[node].end(), WorsePath<T>());
+        kShortestPaths[node].push_back(candidatePaths[node].back());
+        candidatePaths[node].pop_back();
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
     }
 }
 
+template<typename T>
+void ShortestPathsGenerator<T>::addCandidatePath(state_t node, Path<T> const& path) {
+    // every candidate is generated at most once, so there is no need to check for duplicates
+    candidatePaths[node].push_back(path);
+    std::push_heap(candidatePaths[node].begin(), candidatePaths[node].end(), WorsePath<T>());
+}
+
 template<typename T>
 void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
     if (k == 0) {
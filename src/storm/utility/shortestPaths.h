@@ -42,7 +42,7 @@ struct Path {
     unsigned long predecessorK;
     T distance;
 
-    // arbitrary order for std::set
+    // arbitrary order, used to break ties between equally probable paths
     bool operator<(const Path<T>& rhs) const {
         if (predecessorNode != rhs.predecessorNode) {
             return predecessorNode < rhs.predecessorNode;
@@ -55,6 +55,18 @@ struct Path {
     }
 };
 
+// order for the candidate heaps: a path is worse if it is less probable;
+// ties are broken by the arbitrary order above to keep the enumeration deterministic
+template<typename T>
+struct WorsePath {
+    bool operator()(const Path<T>& lhs, const Path<T>& rhs) const {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance < rhs.distance;
+        }
+        return rhs < lhs;
+    }
+};
+
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 
@@ -130,7 +142,8 @@ class ShortestPathsGenerator {
     std::vector<T> shortestPathDistances;
 
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    // candidates for the next shortest path of each node, organized as heaps (w.r.t. `WorsePath`) with the most probable path on top
+    std::vector<std::vector<Path<T>>> candidatePaths;
 
     /*!
      * Computes list of predecessors for all nodes.
@@ -166,6 +179,11 @@ class ShortestPathsGenerator {
      */
     void computeNextPath(state_t node, unsigned long k);
 
+    /*!
+     * Adds the given path to the candidates of the given node.
+     */
+    void addCandidatePath(state_t node, Path<T> const& path);
+
     /*!
      * Computes k-shortest path if not yet computed.
      * @throws std::invalid_argument if no such k-shortest path exists
@@ -185,7 +203,7 @@ class ShortestPathsGenerator {
     // --- tiny helper fcts ---
 
     inline bool isInitialState(state_t node) const {
-        return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+        return node < initialStates.size() && initialStates.get(node);
     }
 
     inline bool isMetaTargetPredecessor(state_t node) const {
@@ -0,0 +1,319 @@
+#include "storm/utility/simd.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define STORM_SIMD_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace simd {
+
+std::string toString(InstructionSet instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            return "scalar";
+        case InstructionSet::Avx2:
+            return "AVX2";
+        case InstructionSet::Avx512:
+            return "AVX-512";
+    }
+    return "invalid";
+}
+
+InstructionSet getSupportedInstructionSet() {
+    static InstructionSet const instructionSet = []() {
+#ifdef STORM_SIMD_X86_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) {
+            return InstructionSet::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return InstructionSet::Avx2;
+        }
+#endif
+        return InstructionSet::Scalar;
+    }();
+    return instructionSet;
+}
+
+namespace detail {
+
+bool isVectorPopcountSupported() {
+    static bool const supported = []() {
+#ifdef STORM_SIMD_X86_KERNELS
+        __builtin_cpu_init();
+        return getSupportedInstructionSet() == InstructionSet::Avx512 && __builtin_cpu_supports("avx512vpopcntdq");
+#else
+        return false;
+#endif
+    }();
+    return supported;
+}
+
+void multiplyRowsScalar(uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector,
+                        double const* summand, double* result) {
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        double value = summand ? summand[row] : 0.0;
+        for (uint64_t entry = rowIndications[row], end = rowIndications[row + 1]; entry < end; ++entry) {
+            value += values[entry] * vector[columns[entry]];
+        }
+        result[row] = value;
+    }
+}
+
+void reduceRowGroupsScalar(bool minimize, uint64_t groupCount, uint64_t const* rowGroupIndices, double const* rowValues, double* result) {
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        double const* groupBegin = rowValues + rowGroupIndices[group];
+        double const* groupEnd = rowValues + rowGroupIndices[group + 1];
+        if (groupBegin != groupEnd) {
+            result[group] = minimize ? *std::min_element(groupBegin, groupEnd) : *std::max_element(groupBegin, groupEnd);
+        }
+    }
+}
+
+void applyBitwiseOperationScalar(BitwiseOperation operation, uint64_t count, uint64_t const* first, uint64_t const* second, uint64_t* result) {
+    switch (operation) {
+        case BitwiseOperation::And:
+            std::transform(first, first + count, second, result, [](uint64_t a, uint64_t b) { return a & b; });
+            break;
+        case BitwiseOperation::Or:
+            std::transform(first, first + count, second, result, [](uint64_t a, uint64_t b) { return a | b; });
+            break;
+        case BitwiseOperation::Xor:
+            std::transform(first, first + count, second, result, [](uint64_t a, uint64_t b) { return a ^ b; });
+            break;
+        case BitwiseOperation::Complement:
+            std::transform(first, first + count, result, [](uint64_t a) { return ~a; });
+            break;
+    }
+}
+
+uint64_t countSetBitsScalar(uint64_t count, uint64_t const* words) {
+    uint64_t result = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+#if (defined(__GNUG__) || defined(__clang__))
+        result += __builtin_popcountll(words[i]);
+#else
+        for (uint64_t word = words[i]; word; word &= word - 1) {
+            ++result;
+        }
+#endif
+    }
+    return result;
+}
+
+#ifdef STORM_SIMD_X86_KERNELS
+__attribute__((target("avx2,fma"))) double horizontalSum(__m256d value) {
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+__attribute__((target("avx2,fma"))) void multiplyRowsAvx2(uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                                                          double const* vector, double const* summand, double* result) {
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        uint64_t entry = rowIndications[row];
+        uint64_t const end = rowIndications[row + 1];
+        __m256d accumulator = _mm256_setzero_pd();
+        for (; entry + 4 <= end; entry += 4) {
+            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+            __m256d vectorValues = _mm256_i32gather_pd(vector, indices, 8);
+            accumulator = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), vectorValues, accumulator);
+        }
+        double value = horizontalSum(accumulator) + (summand ? summand[row] : 0.0);
+        for (; entry < end; ++entry) {
+            value += values[entry] * vector[columns[entry]];
+        }
+        result[row] = value;
+    }
+}
+
+__attribute__((target("avx2"))) void reduceRowGroupsAvx2(bool minimize, uint64_t groupCount, uint64_t const* rowGroupIndices, double const* rowValues,
+                                                         double* result) {
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        uint64_t row = rowGroupIndices[group];
+        uint64_t const end = rowGroupIndices[group + 1];
+        if (row == end) {
+            continue;
+        }
+        double value = rowValues[row];
+        if (end - row >= 4) {
+            __m256d extremum = _mm256_loadu_pd(rowValues + row);
+            for (row += 4; row + 4 <= end; row += 4) {
+                __m256d next = _mm256_loadu_pd(rowValues + row);
+                extremum = minimize ? _mm256_min_pd(extremum, next) : _mm256_max_pd(extremum, next);
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, extremum);
+            value = minimize ? std::min({lanes[0], lanes[1], lanes[2], lanes[3]}) : std::max({lanes[0], lanes[1], lanes[2], lanes[3]});
+        }
+        for (; row < end; ++row) {
+            value = minimize ? std::min(value, rowValues[row]) : std::max(value, rowValues[row]);
+        }
+        result[group] = value;
+    }
+}
+
+__attribute__((target("avx512f,avx512vl"))) void multiplyRowsAvx512(uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns,
+                                                                     double const* values, double const* vector, double const* summand, double* result) {
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        uint64_t entry = rowIndications[row];
+        uint64_t const end = rowIndications[row + 1];
+        __m512d accumulator = _mm512_setzero_pd();
+        for (; entry + 8 <= end; entry += 8) {
+            __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+            __m512d vectorValues = _mm512_i32gather_pd(indices, vector, 8);
+            accumulator = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), vectorValues, accumulator);
+        }
+        if (entry < end) {
+            // Process the remaining (less than 8) entries with masked operations.
+            __mmask8 mask = static_cast<__mmask8>((1u << (end - entry)) - 1);
+            __m256i indices = _mm256_maskz_loadu_epi32(mask, columns + entry);
+            __m512d vectorValues = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, vector, 8);
+            accumulator = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + entry), vectorValues, accumulator);
+        }
+        result[row] = _mm512_reduce_add_pd(accumulator) + (summand ? summand[row] : 0.0);
+    }
+}
+__attribute__((target("avx2"))) void applyBitwiseOperationAvx2(BitwiseOperation operation, uint64_t count, uint64_t const* first, uint64_t const* second,
+                                                               uint64_t* result) {
+    uint64_t i = 0;
+    __m256i const allOnes = _mm256_set1_epi64x(-1);
+    for (; i + 4 <= count; i += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + i));
+        __m256i value;
+        if (operation == BitwiseOperation::Complement) {
+            value = _mm256_xor_si256(a, allOnes);
+        } else {
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + i));
+            if (operation == BitwiseOperation::And) {
+                value = _mm256_and_si256(a, b);
+            } else if (operation == BitwiseOperation::Or) {
+                value = _mm256_or_si256(a, b);
+            } else {
+                value = _mm256_xor_si256(a, b);
+            }
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), value);
+    }
+    applyBitwiseOperationScalar(operation, count - i, first + i, operation == BitwiseOperation::Complement ? nullptr : second + i, result + i);
+}
+
+__attribute__((target("avx2"))) uint64_t countSetBitsAvx2(uint64_t count, uint64_t const* words) {
+    // Looks up the number of set bits of each nibble in a table (Mula et al., Faster Population Counts Using AVX2 Instructions, 2018).
+    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const lowNibbles = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(words + i));
+        __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, lowNibbles));
+        __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), lowNibbles));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countSetBitsScalar(count - i, words + i);
+}
+
+__attribute__((target("avx512f"))) void applyBitwiseOperationAvx512(BitwiseOperation operation, uint64_t count, uint64_t const* first,
+                                                                    uint64_t const* second, uint64_t* result) {
+    uint64_t i = 0;
+    __m512i const allOnes = _mm512_set1_epi64(-1);
+    for (; i + 8 <= count; i += 8) {
+        __m512i a = _mm512_loadu_si512(first + i);
+        __m512i value;
+        if (operation == BitwiseOperation::Complement) {
+            value = _mm512_xor_si512(a, allOnes);
+        } else {
+            __m512i b = _mm512_loadu_si512(second + i);
+            if (operation == BitwiseOperation::And) {
+                value = _mm512_and_si512(a, b);
+            } else if (operation == BitwiseOperation::Or) {
+                value = _mm512_or_si512(a, b);
+            } else {
+                value = _mm512_xor_si512(a, b);
+            }
+        }
+        _mm512_storeu_si512(result + i, value);
+    }
+    applyBitwiseOperationScalar(operation, count - i, first + i, operation == BitwiseOperation::Complement ? nullptr : second + i, result + i);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq"))) uint64_t countSetBitsAvx512(uint64_t count, uint64_t const* words) {
+    __m512i total = _mm512_setzero_si512();
+    uint64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        total = _mm512_add_epi64(total, _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+    }
+    return static_cast<uint64_t>(_mm512_reduce_add_epi64(total)) + countSetBitsScalar(count - i, words + i);
+}
+#endif
+
+}  // namespace detail
+
+void multiplyRows(InstructionSet instructionSet, uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                  double const* vector, double const* summand, double* result) {
+    STORM_LOG_ASSERT(instructionSet == InstructionSet::Scalar || instructionSet <= getSupportedInstructionSet(), "Unsupported instruction set.");
+    switch (instructionSet) {
+#ifdef STORM_SIMD_X86_KERNELS
+        case InstructionSet::Avx512:
+            detail::multiplyRowsAvx512(rowCount, rowIndications, columns, values, vector, summand, result);
+            return;
+        case InstructionSet::Avx2:
+            detail::multiplyRowsAvx2(rowCount, rowIndications, columns, values, vector, summand, result);
+            return;
+#endif
+        default:
+            detail::multiplyRowsScalar(rowCount, rowIndications, columns, values, vector, summand, result);
+    }
+}
+
+void reduceRowGroups(InstructionSet instructionSet, bool minimize, uint64_t groupCount, uint64_t const* rowGroupIndices, double const* rowValues,
+                     double* result) {
+    STORM_LOG_ASSERT(instructionSet == InstructionSet::Scalar || instructionSet <= getSupportedInstructionSet(), "Unsupported instruction set.");
+#ifdef STORM_SIMD_X86_KERNELS
+    if (instructionSet != InstructionSet::Scalar) {
+        detail::reduceRowGroupsAvx2(minimize, groupCount, rowGroupIndices, rowValues, result);
+        return;
+    }
+#endif
+    detail::reduceRowGroupsScalar(minimize, groupCount, rowGroupIndices, rowValues, result);
+}
+
+void applyBitwiseOperation(InstructionSet instructionSet, BitwiseOperation operation, uint64_t count, uint64_t const* first, uint64_t const* second,
+                           uint64_t* result) {
+    STORM_LOG_ASSERT(instructionSet == InstructionSet::Scalar || instructionSet <= getSupportedInstructionSet(), "Unsupported instruction set.");
+    switch (instructionSet) {
+#ifdef STORM_SIMD_X86_KERNELS
+        case InstructionSet::Avx512:
+            detail::applyBitwiseOperationAvx512(operation, count, first, second, result);
+            return;
+        case InstructionSet::Avx2:
+            detail::applyBitwiseOperationAvx2(operation, count, first, second, result);
+            return;
+#endif
+        default:
+            detail::applyBitwiseOperationScalar(operation, count, first, second, result);
+    }
+}
+
+uint64_t countSetBits(InstructionSet instructionSet, uint64_t count, uint64_t const* words) {
+    STORM_LOG_ASSERT(instructionSet == InstructionSet::Scalar || instructionSet <= getSupportedInstructionSet(), "Unsupported instruction set.");
+#ifdef STORM_SIMD_X86_KERNELS
+    if (instructionSet == InstructionSet::Avx512 && detail::isVectorPopcountSupported()) {
+        return detail::countSetBitsAvx512(count, words);
+    } else if (instructionSet != InstructionSet::Scalar) {
+        return detail::countSetBitsAvx2(count, words);
+    }
+#endif
+    return detail::countSetBitsScalar(count, words);
+}
+
+}  // namespace simd
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+namespace utility {
+namespace simd {
+
+/*!
+ * The vector instruction sets for which specialized kernels exist.
+ */
+enum class InstructionSet { Scalar, Avx2, Avx512 };
+
+std::string toString(InstructionSet instructionSet);
+
+/*!
+ * Retrieves the best instruction set that is supported by both the binary and the CPU we are running on.
+ * The CPU is only queried once.
+ */
+InstructionSet getSupportedInstructionSet();
+
+/*!
+ * Multiplies the given rows of a matrix in compressed row storage format (with separate column and value arrays) with the given vector,
+ * i.e., result[r] = summand[r] + sum_{k in row r} values[k] * vector[columns[k]] for all 0 <= r < rowCount.
+ * The kernel is chosen according to the given instruction set (which must be supported).
+ *
+ * @param rowCount The number of rows to multiply.
+ * @param rowIndications The positions where the rows start in the columns and values array (of size rowCount + 1).
+ * @param summand If not nullptr, the i-th entry is added to the value of the i-th row.
+ * @param result The array to which the rowCount results are written. Must not alias the vector.
+ */
+void multiplyRows(InstructionSet instructionSet, uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                  double const* vector, double const* summand, double* result);
+
+/*!
+ * Computes the minimum (or maximum) over each of the given row groups, i.e., result[g] = min/max_{rowGroupIndices[g] <= r < rowGroupIndices[g+1]} rowValues[r].
+ * The result entries of empty groups are not touched.
+ *
+ * @param minimize If true (false), the minimum (maximum) is computed.
+ * @param groupCount The number of row groups.
+ * @param rowGroupIndices The start positions of the groups (of size groupCount + 1).
+ */
+void reduceRowGroups(InstructionSet instructionSet, bool minimize, uint64_t groupCount, uint64_t const* rowGroupIndices, double const* rowValues,
+                     double* result);
+
+/*!
+ * The bitwise operations that can be applied to arrays of 64-bit words.
+ */
+enum class BitwiseOperation { And, Or, Xor, Complement };
+
+/*!
+ * Applies the given operation to the given words, i.e., result[i] = first[i] op second[i] for all 0 <= i < count. For the complement, the
+ * second operand is ignored (and may be nullptr). The result may alias the operands.
+ */
+void applyBitwiseOperation(InstructionSet instructionSet, BitwiseOperation operation, uint64_t count, uint64_t const* first, uint64_t const* second,
+                           uint64_t* result);
+
+/*!
+ * Counts the bits that are set in the given words. If the given instruction set is AVX-512, the VPOPCNTDQ instructions are used if the CPU
+ * supports them.
+ */
+uint64_t countSetBits(InstructionSet instructionSet, uint64_t count, uint64_t const* words);
+
+}  // namespace simd
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,16 @@
+#include "storm/utility/tracing.h"
+
+namespace storm {
+namespace utility {
+namespace tracing {
+#ifdef STORM_HAVE_ITT
+namespace detail {
+__itt_domain* getDomain() {
+    static __itt_domain* const domain = __itt_domain_create("storm");
+    return domain;
+}
+}  // namespace detail
+#endif
+}  // namespace tracing
+}  // namespace utility
+}  // namespace storm
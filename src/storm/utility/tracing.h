@@ -0,0 +1,70 @@
+#pragma once
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_TRACY
+#include <tracy/Tracy.hpp>
+#endif
+#ifdef STORM_HAVE_ITT
+#include <ittnotify.h>
+#endif
+
+/*!
+ * Tracing zones mark the major phases and hot loops of Storm for external profilers, so that samples can be attributed to phases instead of deep
+ * template call stacks. Zones are reported to Tracy (if Storm is configured with STORM_USE_TRACY) and/or the Intel ITT API, e.g., for VTune (if
+ * Storm is configured with STORM_USE_ITT). Otherwise, all macros expand to nothing.
+ *
+ * STORM_TRACE_ZONE(name) opens a zone with the given name (a string literal) that lasts until the end of the enclosing scope. There can be at
+ * most one zone per scope. STORM_TRACE_ZONE_VALUE(value) attaches a number (e.g., the size of an SCC) to the zone of the current scope; it is
+ * only reported to Tracy.
+ */
+
+namespace storm {
+namespace utility {
+namespace tracing {
+#ifdef STORM_HAVE_ITT
+namespace detail {
+/*!
+ * Retrieves the ITT domain to which all zones of Storm belong.
+ */
+__itt_domain* getDomain();
+
+class IttZone {
+   public:
+    explicit IttZone(__itt_string_handle* name) {
+        __itt_task_begin(getDomain(), __itt_null, __itt_null, name);
+    }
+
+    ~IttZone() {
+        __itt_task_end(getDomain());
+    }
+
+    IttZone(IttZone const&) = delete;
+    IttZone& operator=(IttZone const&) = delete;
+};
+}  // namespace detail
+#endif
+}  // namespace tracing
+}  // namespace utility
+}  // namespace storm
+
+#ifdef STORM_HAVE_TRACY
+#define STORM_TRACE_TRACY_ZONE(name) ZoneScopedN(name)
+#define STORM_TRACE_ZONE_VALUE(value) ZoneValue(static_cast<uint64_t>(value))
+#else
+#define STORM_TRACE_TRACY_ZONE(name) static_cast<void>(0)
+#define STORM_TRACE_ZONE_VALUE(value) static_cast<void>(0)
+#endif
+
+#ifdef STORM_HAVE_ITT
+// The string handle of each zone is created once and then reused.
+#define STORM_TRACE_ITT_ZONE(name)                                                              \
+    static __itt_string_handle* const stormTraceIttZoneName = __itt_string_handle_create(name); \
+    storm::utility::tracing::detail::IttZone stormTraceIttZone(stormTraceIttZoneName)
+#else
+#define STORM_TRACE_ITT_ZONE(name) static_cast<void>(0)
+#endif
+
+#define STORM_TRACE_ZONE(name)    \
+    STORM_TRACE_TRACY_ZONE(name); \
+    STORM_TRACE_ITT_ZONE(name)
@@ -0,0 +1,70 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-counterexamples/counterexamples/MILPMinimalLabelSetGenerator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/sparse/PrismChoiceOrigins.h"
+
+#ifdef STORM_HAVE_GLPK
+
+namespace {
+
+// Builds the MDP of the given program with choice origins such that the formula can be checked on it.
+std::shared_ptr<storm::models::sparse::Mdp<double>> buildMdp(storm::prism::Program const& program,
+                                                            std::shared_ptr<storm::logic::Formula const> const& formula) {
+    storm::builder::BuilderOptions options({formula}, program);
+    options.setBuildChoiceOrigins(true);
+    return storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Mdp<double>>();
+}
+
+double computeMaximalProbability(std::shared_ptr<storm::models::sparse::Mdp<double>> const& mdp, std::shared_ptr<storm::logic::Formula const> const& formula) {
+    auto result = storm::api::verifyWithSparseEngine<double>(mdp, storm::api::createTask<double>(formula, true));
+    return result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()];
+}
+
+/*!
+ * Computes a minimal command set of the given program that reaches the goal label with at least the given fraction of the maximal
+ * probability, once with and once without lazy constraints, and checks that both sets are minimal label sets of the same size.
+ */
+void checkLazyConstraints(std::string const& programFile, std::string const& goalLabel, double fraction) {
+    storm::Environment env;
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    auto formula = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"" + goalLabel + "\"]", program))[0];
+    auto mdp = buildMdp(program, formula);
+
+    std::vector<storm::storage::FlatSet<uint_fast64_t>> labelSets(mdp->getNumberOfChoices());
+    auto const& choiceOrigins = mdp->getChoiceOrigins()->asPrismChoiceOrigins();
+    for (uint_fast64_t choice = 0; choice < mdp->getNumberOfChoices(); ++choice) {
+        labelSets[choice] = choiceOrigins.getCommandSet(choice);
+    }
+    storm::storage::BitVector phiStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = mdp->getStates(goalLabel);
+    double threshold = fraction * computeMaximalProbability(mdp, formula);
+
+    typedef storm::counterexamples::MILPMinimalLabelSetGenerator<double> Generator;
+    auto labelSet = Generator::getMinimalLabelSet(env, *mdp, labelSets, phiStates, psiStates, threshold, false, false, false, false);
+    auto lazyLabelSet = Generator::getMinimalLabelSet(env, *mdp, labelSets, phiStates, psiStates, threshold, false, false, false, true);
+    EXPECT_FALSE(labelSet.empty()) << programFile;
+    EXPECT_EQ(labelSet.size(), lazyLabelSet.size()) << programFile;
+
+    // The commands of the set computed with lazy constraints suffice to reach the threshold.
+    storm::prism::Program restrictedProgram = program.restrictCommands(lazyLabelSet);
+    auto restrictedMdp = buildMdp(restrictedProgram, formula);
+    EXPECT_GE(computeMaximalProbability(restrictedMdp, formula), threshold - 1e-6) << programFile;
+}
+
+}  // namespace
+
+TEST(MILPMinimalLabelSetGeneratorTest, LazyConstraints) {
+    checkLazyConstraints(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm", "one", 0.5);
+    checkLazyConstraints(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", "seven", 0.5);
+    checkLazyConstraints(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "all_coins_equal_1", 0.5);
+    checkLazyConstraints(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm", "elected", 0.9);
+}
+
+#endif
@@ -88,4 +88,20 @@ TEST(DftModelBuildingTest, RelevantEvents) {
     EXPECT_EQ(13ul, model->getNumberOfTransitions());
 }
 
+TEST(DftModelBuildingTest, ConcurrentExploration) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft");
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents({"all"}), false);
+
+    // The states are expanded in batches, but the resulting model has to coincide with the sequentially built one.
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+    builder.setNumberOfExplorationThreads(4);
+    builder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+    EXPECT_EQ(512ul, model->getNumberOfStates());
+    EXPECT_EQ(2305ul, model->getNumberOfTransitions());
+}
+
 }  // namespace
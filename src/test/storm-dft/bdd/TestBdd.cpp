@@ -122,6 +122,34 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, AllMeasuresBatched) {
+    auto const &param{TestWithParam::GetParam()};
+    std::vector<double> const timepoints{0.5, 1, 2, 1};
+    auto const measures{checker->getAllMeasuresAtTimepoints(timepoints, 1, 4)};
+    expectVectorNear(measures.probabilities, checker->getProbabilitiesAtTimepoints(timepoints));
+    EXPECT_NEAR(measures.probabilities[1], param.probabilityAtTimeboundOne, 1e-6);
+
+    auto const atTimeOne = [&timepoints](std::vector<std::vector<double>> const &measure) {
+        std::vector<double> result{};
+        for (auto const &beMeasure : measure) {
+            EXPECT_EQ(beMeasure.size(), timepoints.size());
+            EXPECT_EQ(beMeasure[1], beMeasure[3]);
+            result.push_back(beMeasure[1]);
+        }
+        return result;
+    };
+    expectVectorNear(atTimeOne(measures.birnbaumFactors), param.birnbaum);
+    expectVectorNear(atTimeOne(measures.CIFs), param.CIF);
+    expectVectorNear(atTimeOne(measures.DIFs), param.DIF);
+    expectVectorNear(atTimeOne(measures.RAWs), param.RAW);
+    expectVectorNear(atTimeOne(measures.RRWs), param.RRW);
+    auto const birnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints)};
+    ASSERT_EQ(measures.birnbaumFactors.size(), birnbaumFactors.size());
+    for (size_t i{0}; i < birnbaumFactors.size(); ++i) {
+        expectVectorNear(measures.birnbaumFactors[i], birnbaumFactors[i]);
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
@@ -37,9 +37,11 @@ class BddModularizerTest : public testing::TestWithParam<ModularizerTestData> {
         auto const &param{TestWithParam::GetParam()};
         auto dft{storm::dft::api::loadDFTGalileoFile<double>(param.filepath)};
         checker = std::make_shared<storm::dft::modelchecker::DftModularizationChecker<double>>(dft);
+        parallelChecker = std::make_shared<storm::dft::modelchecker::DftModularizationChecker<double>>(dft, 4);
     }
 
     std::shared_ptr<storm::dft::modelchecker::DftModularizationChecker<double>> checker;
+    std::shared_ptr<storm::dft::modelchecker::DftModularizationChecker<double>> parallelChecker;
 };
 
 TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
@@ -47,6 +49,14 @@ TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
     EXPECT_NEAR(checker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
 }
 
+TEST_P(BddModularizerTest, ParallelProbabilityAtTimeOne) {
+    auto const &param{TestWithParam::GetParam()};
+    EXPECT_NEAR(parallelChecker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
+    // Second query reuses the module results
+    auto const probabilities{parallelChecker->getProbabilitiesAtTimepoints({0.5, 1})};
+    EXPECT_NEAR(probabilities.at(1), param.probabilityAtTimeboundOne, 1e-6);
+}
+
 static std::vector<ModularizerTestData> modularizerTestData{
     {
         "And",
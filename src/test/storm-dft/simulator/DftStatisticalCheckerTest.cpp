@@ -0,0 +1,67 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/simulator/DFTStatisticalChecker.h"
+
+namespace {
+
+// Helper function
+storm::dft::simulator::StatisticalCheckResult checkDft(std::string const& file, storm::dft::simulator::StatisticalCheckSettings const& settings) {
+    // Load, build and prepare DFT
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+
+    // Set relevant events
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents<double>(*dft, {}, {});
+    dft->setRelevantEvents(relevantEvents, false);
+
+    return storm::dft::api::analyzeDFTSimulation(*dft, settings);
+}
+
+TEST(DftStatisticalCheckerTest, AndUnreliability) {
+    storm::dft::simulator::StatisticalCheckSettings settings;
+    settings.timebound = 2;
+    settings.precision = 0.01;
+    auto result = checkDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", settings);
+    EXPECT_TRUE(result.precisionReached);
+    EXPECT_NEAR(result.estimate, 0.3995764009, 0.02);
+    EXPECT_LE(result.lowerBound, result.estimate);
+    EXPECT_GE(result.upperBound, result.estimate);
+    EXPECT_LE(result.upperBound - result.lowerBound, 0.02 + 1e-12);
+}
+
+TEST(DftStatisticalCheckerTest, Reproducible) {
+    storm::dft::simulator::StatisticalCheckSettings settings;
+    settings.timebound = 1;
+    settings.maxNumberOfTraces = 100000;
+    settings.numberOfThreads = 1;
+    auto sequential = checkDft(STORM_TEST_RESOURCES_DIR "/dft/voting.dft", settings);
+    settings.numberOfThreads = 4;
+    auto parallel = checkDft(STORM_TEST_RESOURCES_DIR "/dft/voting.dft", settings);
+    EXPECT_EQ(sequential.numberOfTraces, parallel.numberOfTraces);
+    EXPECT_EQ(sequential.estimate, parallel.estimate);
+    EXPECT_NEAR(parallel.estimate, 0.4511883639, 0.01);
+}
+
+TEST(DftStatisticalCheckerTest, ImportanceSplitting) {
+    storm::dft::simulator::StatisticalCheckSettings settings;
+    settings.timebound = 2;
+    settings.importanceSplitting = true;
+    settings.splittingEffort = 200;
+    settings.precision = 0.01;
+    auto result = checkDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", settings);
+    EXPECT_TRUE(result.precisionReached);
+    EXPECT_NEAR(result.estimate, 0.3995764009, 0.02);
+
+    // Splitting is applicable to rare failures within short time bounds.
+    settings.timebound = 0.01;
+    settings.precision = 0.1;
+    settings.relativePrecision = true;
+    result = checkDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", settings);
+    EXPECT_GT(result.estimate, 0.0);
+    EXPECT_LT(result.estimate, 1e-3);
+}
+
+}  // namespace
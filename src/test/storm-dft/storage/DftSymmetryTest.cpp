@@ -0,0 +1,45 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
+#include "storm-dft/storage/SymmetricUnits.h"
+
+namespace {
+
+TEST(DftSymmetryTest, SubtreeHashes) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/symmetry6.dft");
+    storm::dft::storage::DFTColouring<double> colouring = dft->colourDFT();
+
+    // Isomorphic subtrees have the same hash
+    EXPECT_EQ(colouring.getSubtreeHash(dft->getIndex("J")), colouring.getSubtreeHash(dft->getIndex("K")));
+    EXPECT_EQ(colouring.getSubtreeHash(dft->getIndex("J")), colouring.getSubtreeHash(dft->getIndex("L")));
+    EXPECT_EQ(colouring.getSubtreeHash(dft->getIndex("M")), colouring.getSubtreeHash(dft->getIndex("N")));
+    EXPECT_EQ(colouring.getSubtreeHash(dft->getIndex("M1")), colouring.getSubtreeHash(dft->getIndex("N2")));
+    // Subtrees with different gate types or failure rates are distinguished
+    EXPECT_NE(colouring.getSubtreeHash(dft->getIndex("B")), colouring.getSubtreeHash(dft->getIndex("C")));
+    EXPECT_NE(colouring.getSubtreeHash(dft->getIndex("M1")), colouring.getSubtreeHash(dft->getIndex("M3")));
+}
+
+TEST(DftSymmetryTest, FindSymmetries) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/symmetry6.dft");
+    storm::dft::storage::DFTIndependentSymmetries symmetries = dft->findSymmetries(dft->colourDFT());
+
+    // Gates J, K and L are symmetric
+    size_t j = std::min({dft->getIndex("J"), dft->getIndex("K"), dft->getIndex("L")});
+    ASSERT_EQ(1ul, symmetries.groups.count(j));
+    for (auto const& symmetry : symmetries.groups.at(j)) {
+        EXPECT_EQ(3ul, symmetry.size());
+    }
+    // Gates M and N are symmetric
+    size_t m = std::min(dft->getIndex("M"), dft->getIndex("N"));
+    ASSERT_EQ(1ul, symmetries.groups.count(m));
+    for (auto const& symmetry : symmetries.groups.at(m)) {
+        EXPECT_EQ(2ul, symmetry.size());
+    }
+    // Gates B and C are not symmetric
+    EXPECT_EQ(0ul, symmetries.groups.count(dft->getIndex("B")));
+    EXPECT_EQ(0ul, symmetries.groups.count(dft->getIndex("C")));
+}
+
+}  // namespace
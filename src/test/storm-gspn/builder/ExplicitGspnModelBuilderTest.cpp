@@ -0,0 +1,155 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <memory>
+
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+#include "storm-gspn/builder/JaniGSPNBuilder.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/jani/Model.h"
+
+namespace {
+
+// A queue with capacity four whose server may fail. After a failure, the queue is flushed. Then, the server is either rebooted or
+// repaired (probabilistically) or it is inspected (nondeterministically), which also requires a repair.
+std::unique_ptr<storm::gspn::GSPN> buildQueueWithFailures() {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("queue");
+    builder.addPlace(4, 0, "queue");
+    builder.addPlace(1, 1, "up");
+    builder.addPlace(1, 0, "failed");
+    builder.addPlace(1, 0, "down");
+
+    builder.addTimedTransition(0, 2.0, "arrive");
+    builder.addInhibitionArc("queue", "arrive", 4);
+    builder.addOutputArc("arrive", "queue");
+
+    // Two jobs can be served at the same time, as long as the server has not failed.
+    builder.addTimedTransition(0, 3.0, 2, "serve");
+    builder.addInputArc("queue", "serve");
+    builder.addInhibitionArc("failed", "serve");
+    builder.addInhibitionArc("down", "serve");
+
+    builder.addTimedTransition(0, 0.5, "fail");
+    builder.addInputArc("up", "fail");
+    builder.addOutputArc("fail", "failed");
+
+    builder.addImmediateTransition(2, 1.0, "flush");
+    builder.addInputArc("failed", "flush");
+    builder.addInputArc("queue", "flush");
+    builder.addOutputArc("flush", "failed");
+
+    builder.addImmediateTransition(1, 3.0, "reboot");
+    builder.addInputArc("failed", "reboot");
+    builder.addOutputArc("reboot", "up");
+
+    builder.addImmediateTransition(1, 1.0, "giveUp");
+    builder.addInputArc("failed", "giveUp");
+    builder.addOutputArc("giveUp", "down");
+
+    // Without a weight, the transition forms a partition of its own.
+    builder.addImmediateTransition(1, 0.0, "inspect");
+    builder.addInputArc("failed", "inspect");
+    builder.addOutputArc("inspect", "down");
+
+    builder.addTimedTransition(0, 1.5, boost::none, "repair");
+    builder.addInputArc("down", "repair");
+    builder.addOutputArc("repair", "up");
+
+    return std::unique_ptr<storm::gspn::GSPN>(builder.buildGspn());
+}
+
+// Two processes that compete for a mutex. If both are waiting, the one that enters the critical section is chosen nondeterministically.
+std::unique_ptr<storm::gspn::GSPN> buildMutualExclusion() {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("mutex");
+    builder.addPlace(1, 1, "mutex");
+    for (std::string const process : {"1", "2"}) {
+        builder.addPlace(1, 1, "idle" + process);
+        builder.addPlace(1, 0, "wait" + process);
+        builder.addPlace(1, 0, "crit" + process);
+
+        builder.addTimedTransition(0, process == "1" ? 1.0 : 1.5, "request" + process);
+        builder.addInputArc("idle" + process, "request" + process);
+        builder.addOutputArc("request" + process, "wait" + process);
+
+        builder.addImmediateTransition(0, 0.0, "enter" + process);
+        builder.addInputArc("wait" + process, "enter" + process);
+        builder.addInputArc("mutex", "enter" + process);
+        builder.addOutputArc("enter" + process, "crit" + process);
+
+        builder.addTimedTransition(0, process == "1" ? 2.0 : 3.0, "leave" + process);
+        builder.addInputArc("crit" + process, "leave" + process);
+        builder.addOutputArc("leave" + process, "idle" + process);
+        builder.addOutputArc("leave" + process, "mutex");
+    }
+    return std::unique_ptr<storm::gspn::GSPN>(builder.buildGspn());
+}
+
+/*!
+ * Builds the Markov automaton of the given GSPN directly and via the JANI translation and checks that both coincide. The given
+ * properties refer to the goal states via the placeholder GOAL.
+ */
+void compareWithJaniTranslation(storm::gspn::GSPN const& gspn, storm::expressions::Expression const& goal, std::string const& goalAsString,
+                                std::vector<std::string> const& properties) {
+    storm::builder::ExplicitGspnModelBuilder<double> explicitBuilder(gspn);
+    explicitBuilder.addLabel("goal", goal);
+    auto explicitModel = explicitBuilder.build();
+
+    std::unique_ptr<storm::jani::Model> janiModel(storm::builder::JaniGSPNBuilder(gspn).build());
+    std::string janiPropertiesAsString, explicitPropertiesAsString;
+    for (auto const& property : properties) {
+        std::string::size_type position = property.find("GOAL");
+        ASSERT_NE(std::string::npos, position);
+        janiPropertiesAsString += std::string(property).replace(position, 4, "(" + goalAsString + ")") + ";";
+        explicitPropertiesAsString += std::string(property).replace(position, 4, "\"goal\"") + ";";
+    }
+    auto janiFormulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForJaniModel(janiPropertiesAsString, *janiModel));
+    auto explicitFormulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties(explicitPropertiesAsString));
+    ASSERT_EQ(properties.size(), janiFormulas.size());
+    ASSERT_EQ(properties.size(), explicitFormulas.size());
+    auto janiTranslationModel = storm::api::buildSparseModel<double>(*janiModel, janiFormulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+    // The JANI translation does not take maximal progress into account, which only happens when closing the automaton.
+    if (!janiTranslationModel->isClosed()) {
+        janiTranslationModel->close();
+    }
+    ASSERT_TRUE(explicitModel->isClosed());
+
+    EXPECT_EQ(janiTranslationModel->getNumberOfStates(), explicitModel->getNumberOfStates());
+    EXPECT_EQ(janiTranslationModel->getNumberOfChoices(), explicitModel->getNumberOfChoices());
+    EXPECT_EQ(janiTranslationModel->getNumberOfTransitions(), explicitModel->getNumberOfTransitions());
+    EXPECT_EQ(janiTranslationModel->getMarkovianStates().getNumberOfSetBits(), explicitModel->getMarkovianStates().getNumberOfSetBits());
+
+    uint64_t const janiInitialState = *janiTranslationModel->getInitialStates().begin();
+    uint64_t const explicitInitialState = *explicitModel->getInitialStates().begin();
+    for (uint64_t index = 0; index < properties.size(); ++index) {
+        auto janiResult = storm::api::verifyWithSparseEngine<double>(janiTranslationModel, storm::api::createTask<double>(janiFormulas[index], true));
+        auto explicitResult = storm::api::verifyWithSparseEngine<double>(explicitModel, storm::api::createTask<double>(explicitFormulas[index], true));
+        ASSERT_TRUE(janiResult != nullptr && explicitResult != nullptr) << properties[index];
+        double janiValue = janiResult->asExplicitQuantitativeCheckResult<double>()[janiInitialState];
+        double explicitValue = explicitResult->asExplicitQuantitativeCheckResult<double>()[explicitInitialState];
+        EXPECT_GT(janiValue, 0.0) << properties[index];
+        EXPECT_NEAR(janiValue, explicitValue, 1e-4) << properties[index];
+    }
+}
+
+}  // namespace
+
+TEST(ExplicitGspnModelBuilderTest, QueueWithFailures) {
+    auto gspn = buildQueueWithFailures();
+    auto const& manager = *gspn->getExpressionManager();
+    compareWithJaniTranslation(*gspn, manager.getVariableExpression("queue") == manager.integer(4), "queue=4",
+                               {"Pmin=? [F<=1 GOAL]", "Pmax=? [F<=1 GOAL]", "Tmin=? [F GOAL]", "Tmax=? [F GOAL]"});
+}
+
+TEST(ExplicitGspnModelBuilderTest, MutualExclusion) {
+    auto gspn = buildMutualExclusion();
+    auto const& manager = *gspn->getExpressionManager();
+    compareWithJaniTranslation(*gspn, manager.getVariableExpression("crit2") == manager.integer(1), "crit2=1",
+                               {"Pmin=? [F<=0.5 GOAL]", "Pmax=? [F<=0.5 GOAL]", "Tmin=? [F GOAL]", "Tmax=? [F GOAL]"});
+}
@@ -4,6 +4,7 @@
 #include "storm-pars/api/analysis.h"
 #include "storm-pars/api/region.h"
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
+#include "storm-pars/utility/ModelInstantiator.h"
 
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/AutoParser.h"
@@ -421,3 +422,39 @@ TEST(AssumptionCheckerTest, Casestudy3) {
                                                          storm::expressions::RelationType::Equal));
     EXPECT_EQ(storm::analysis::AssumptionStatus::INVALID, checker.validateAssumption(assumption, order, region));
 }
+
+TEST(AssumptionCheckerTest, SampleValuesInParallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=4 & i=N ]";
+    std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    // Instantiate the model at some sample points
+    auto vars = storm::models::sparse::getProbabilityParameters(*dtmc);
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> instantiator(*dtmc);
+    std::vector<storm::models::sparse::Dtmc<double>> sampleModels;
+    for (double value : {0.1, 0.3, 0.5, 0.7, 0.9}) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        for (auto const& var : vars) {
+            valuation[var] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value);
+        }
+        sampleModels.push_back(instantiator.instantiate(valuation));
+    }
+
+    auto sequentialValues = storm::analysis::AssumptionChecker<storm::RationalFunction, double>::computeSampleValues(formulas[0], sampleModels, 1);
+    auto parallelValues = storm::analysis::AssumptionChecker<storm::RationalFunction, double>::computeSampleValues(formulas[0], sampleModels, 3);
+    ASSERT_EQ(sampleModels.size(), sequentialValues.size());
+    ASSERT_EQ(sampleModels.size(), parallelValues.size());
+    for (uint64_t i = 0; i < sampleModels.size(); ++i) {
+        ASSERT_EQ(dtmc->getNumberOfStates(), parallelValues[i].size());
+        for (uint64_t state = 0; state < parallelValues[i].size(); ++state) {
+            EXPECT_EQ(sequentialValues[i][state], parallelValues[i][state]);
+        }
+    }
+}
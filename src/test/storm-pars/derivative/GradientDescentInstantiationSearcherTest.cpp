@@ -126,6 +126,35 @@ TYPED_TEST(GradientDescentInstantiationSearcherTest, Simple) {
     ASSERT_NEAR(doubleInstantiation*4, 1, 1e-6);
 }
 
+TYPED_TEST(GradientDescentInstantiationSearcherTest, SimpleParallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/gradient1.pm";
+    std::string formulaAsString = "P>=0.2499 [F s=2]";
+    std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*dtmc);
+    ASSERT_TRUE(simplifier.simplify(*formulas[0]));
+    model = simplifier.getSimplifiedModel();
+    dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    typedef storm::derivative::GradientDescentInstantiationSearcher<typename TestFixture::FunctionType, typename TestFixture::ConstantType> SearcherType;
+    std::vector<std::unique_ptr<SearcherType>> searchers;
+    storm::modelchecker::CheckTask<storm::logic::Formula, typename TestFixture::FunctionType> checkTask(*formulas[0]);
+    for (uint64_t i = 0; i < 3; ++i) {
+        searchers.push_back(std::make_unique<SearcherType>(*dtmc));
+        searchers.back()->specifyFormula(this->env(), checkTask);
+    }
+    auto instantiationAndValue = SearcherType::parallelGradientDescent(this->env(), searchers);
+    double value = storm::utility::convertNumber<double>(instantiationAndValue.second);
+    ASSERT_GE(value, 0.2499);
+    ASSERT_LE(value, 0.25 + 1e-6);
+}
+
 TYPED_TEST(GradientDescentInstantiationSearcherTest, Crowds) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm";
     std::string formulaAsString = "P<=0.00000001 [F \"observe0Greater1\"]";
@@ -155,6 +155,13 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             auto derivative = derivativeModelChecker.check(env(), instantiation, parameter);
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6) << instantiation;
         }
+
+        // Computing the derivatives w.r.t. all parameters at once has to yield the same results.
+        std::vector<VariableType<storm::RationalFunction>> allParameters(parameters.begin(), parameters.end());
+        auto derivatives = derivativeModelChecker.checkMultipleParameters(env(), instantiation, allParameters);
+        for (auto const& parameter : allParameters) {
+            ASSERT_NEAR(storm::utility::convertNumber<double>(derivatives.at(parameter)->getValueVector()[0]), storm::utility::convertNumber<double>(testCase.second.at(parameter)), 1e-6) << instantiation;
+        }
     }
 }
 
@@ -0,0 +1,97 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> createGrid(uint64_t pointsPerDimension) {
+        storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+        storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+        std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+        for (uint64_t i = 1; i <= pointsPerDimension; ++i) {
+            for (uint64_t j = 1; j <= pointsPerDimension; ++j) {
+                std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+                valuation.emplace(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(static_cast<double>(i) / (pointsPerDimension + 1)));
+                valuation.emplace(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(static_cast<double>(j) / (pointsPerDimension + 1)));
+                valuations.push_back(std::move(valuation));
+            }
+        }
+        return valuations;
+    }
+
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildBrp(std::string const& formulaAsString, std::vector<std::shared_ptr<storm::logic::Formula const>>& formulas) {
+        carl::VariablePool::getInstance().clear();
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+        formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        return storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BatchedReachabilityProbabilities) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    auto dtmc = buildBrp("P=? [F s=5 ]", formulas);
+    auto valuations = createGrid(6);
+    storm::Environment env;
+
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(*dtmc);
+    checker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas.front(), true));
+    checker.setInstantiationsAreGraphPreserving(true);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+    batchChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas.front(), true));
+    batchChecker.setInstantiationsAreGraphPreserving(true);
+
+    auto batchResults = batchChecker.checkBatch(env, valuations);
+    ASSERT_EQ(valuations.size(), batchResults.size());
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+        auto result = checker.check(env, valuations[valuationIndex]);
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initialState], batchResults[valuationIndex]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-5);
+    }
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BatchedQualitativeProbabilities) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    auto dtmc = buildBrp("P<=0.84 [F s=5 ]", formulas);
+    auto valuations = createGrid(5);
+    storm::Environment env;
+
+    // Without graph preservation, the instantiations are only evaluated in batches but checked one after another.
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(*dtmc);
+    checker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas.front(), true));
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+    batchChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas.front(), true));
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> graphPreservingBatchChecker(*dtmc);
+    graphPreservingBatchChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas.front(), true));
+    graphPreservingBatchChecker.setInstantiationsAreGraphPreserving(true);
+
+    auto batchResults = batchChecker.checkBatch(env, valuations);
+    auto graphPreservingBatchResults = graphPreservingBatchChecker.checkBatch(env, valuations);
+    ASSERT_EQ(valuations.size(), batchResults.size());
+    ASSERT_EQ(valuations.size(), graphPreservingBatchResults.size());
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    uint64_t numberOfSatisfyingValuations = 0;
+    for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+        bool isSatisfied = checker.check(env, valuations[valuationIndex])->asExplicitQualitativeCheckResult()[initialState];
+        EXPECT_EQ(isSatisfied, batchResults[valuationIndex]->asExplicitQualitativeCheckResult()[initialState]);
+        EXPECT_EQ(isSatisfied, graphPreservingBatchResults[valuationIndex]->asExplicitQualitativeCheckResult()[initialState]);
+        if (isSatisfied) {
+            ++numberOfSatisfyingValuations;
+        }
+    }
+    EXPECT_LT(0ul, numberOfSatisfyingValuations);
+    EXPECT_GT(valuations.size(), numberOfSatisfyingValuations);
+}
+
+#endif
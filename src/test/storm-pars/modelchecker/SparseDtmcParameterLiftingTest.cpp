@@ -99,6 +99,85 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.6<=pK<=0.95", modelParameters);
+        boost::optional<storm::RationalFunction> coverageThreshold = storm::utility::zero<storm::RationalFunction>();
+        uint64_t depthLimit = 4;
+
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto sequentialResult = regionChecker->performRegionRefinement(this->env(), region, coverageThreshold, depthLimit);
+
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> regionCheckers;
+        for (uint64_t threadIndex = 0; threadIndex < 3; ++threadIndex) {
+            regionCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+        }
+        auto parallelResult = storm::modelchecker::RegionModelChecker<storm::RationalFunction>::performParallelRegionRefinement(this->env(), regionCheckers, region, coverageThreshold, depthLimit);
+
+        // Without coverage threshold, both refinements analyze the same regions (in a different order).
+        auto getArea = [](storm::modelchecker::RegionRefinementCheckResult<storm::RationalFunction> const& result, storm::modelchecker::RegionResult regionResult) {
+            auto area = storm::utility::zero<typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType>();
+            for (auto const& regionAndResult : result.getRegionResults()) {
+                if (regionAndResult.second == regionResult) {
+                    area += regionAndResult.first.area();
+                }
+            }
+            return area;
+        };
+        EXPECT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+        EXPECT_EQ(getArea(*sequentialResult, storm::modelchecker::RegionResult::AllSat), getArea(*parallelResult, storm::modelchecker::RegionResult::AllSat));
+        EXPECT_EQ(getArea(*sequentialResult, storm::modelchecker::RegionResult::AllViolated), getArea(*parallelResult, storm::modelchecker::RegionResult::AllViolated));
+        EXPECT_LT(storm::utility::zero<typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType>(), getArea(*parallelResult, storm::modelchecker::RegionResult::AllSat));
+    }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_RefinementHints) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.6<=pK<=0.95", modelParameters);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto refinementResult = regionChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        // The subregions are analyzed using the results of their parent regions as hints. Analyzing them from scratch yields the same results.
+        uint64_t numberOfDecidedRegions = 0;
+        for (auto const& regionAndResult : refinementResult->getRegionResults()) {
+            if (regionAndResult.second == storm::modelchecker::RegionResult::AllSat || regionAndResult.second == storm::modelchecker::RegionResult::AllViolated) {
+                auto freshChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+                EXPECT_EQ(regionAndResult.second, freshChecker->analyzeRegion(this->env(), regionAndResult.first, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true)) << "for region " << regionAndResult.first;
+                ++numberOfDecidedRegions;
+            }
+        }
+        EXPECT_LT(0ull, numberOfDecidedRegions);
+
+        auto subRegion = storm::api::parseRegion<storm::RationalFunction>("0.5<=pL<=0.6,0.6<=pK<=0.7", modelParameters);
+        EXPECT_TRUE(region.isSubRegion(subRegion));
+        EXPECT_FALSE(subRegion.isSubRegion(region));
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
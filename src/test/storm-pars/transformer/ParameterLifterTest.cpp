@@ -0,0 +1,60 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/transformer/ParameterLifter.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/storage/jani/Property.h"
+
+TEST(ParameterLifterTest, CompiledEvaluationMatchesExactEvaluation) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F \"error\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+
+    storm::storage::BitVector targetStates = model->getStates("error");
+    storm::storage::BitVector maybeStates = ~targetStates;
+    std::vector<storm::RationalFunction> targetProbabilities = model->getTransitionMatrix().getConstrainedRowSumVector(storm::storage::BitVector(model->getNumberOfStates(), true), targetStates);
+
+    storm::transformer::ParameterLifter<storm::RationalFunction, double> doubleLifter(model->getTransitionMatrix(), targetProbabilities, maybeStates, maybeStates);
+    storm::transformer::ParameterLifter<storm::RationalFunction, storm::RationalNumber> exactLifter(model->getTransitionMatrix(), targetProbabilities, maybeStates, maybeStates);
+
+    for (auto const& regionString : {"0.7<=pL<=0.9,0.75<=pK<=0.95", "0.1<=pL<=0.73,0.2<=pK<=0.715"}) {
+        auto region = storm::api::parseRegion<storm::RationalFunction>(regionString, modelParameters);
+        for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+            // Specify the region twice for the compiled evaluation to check that the compiled functions are reused correctly.
+            doubleLifter.specifyRegion(region, dir);
+            doubleLifter.specifyRegion(region, dir);
+            exactLifter.specifyRegion(region, dir);
+
+            auto const& doubleMatrix = doubleLifter.getMatrix();
+            auto const& exactMatrix = exactLifter.getMatrix();
+            ASSERT_EQ(exactMatrix.getEntryCount(), doubleMatrix.getEntryCount());
+            ASSERT_EQ(exactMatrix.getRowCount(), doubleMatrix.getRowCount());
+            for (uint64_t row = 0; row < exactMatrix.getRowCount(); ++row) {
+                auto doubleEntryIt = doubleMatrix.getRow(row).begin();
+                for (auto const& exactEntry : exactMatrix.getRow(row)) {
+                    EXPECT_EQ(exactEntry.getColumn(), doubleEntryIt->getColumn());
+                    EXPECT_NEAR(storm::utility::convertNumber<double>(exactEntry.getValue()), doubleEntryIt->getValue(), 1e-12);
+                    ++doubleEntryIt;
+                }
+            }
+            ASSERT_EQ(exactLifter.getVector().size(), doubleLifter.getVector().size());
+            for (uint64_t row = 0; row < exactLifter.getVector().size(); ++row) {
+                EXPECT_NEAR(storm::utility::convertNumber<double>(exactLifter.getVector()[row]), doubleLifter.getVector()[row], 1e-12);
+            }
+        }
+    }
+}
+
+#endif
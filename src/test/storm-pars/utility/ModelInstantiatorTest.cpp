@@ -139,6 +139,48 @@ TEST(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+
+    // More valuations than fit into a single batch.
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (uint64_t i = 0; i < 10; ++i) {
+        for (uint64_t j = 0; j < 10; ++j) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            valuation.emplace(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.05 + 0.1 * i));
+            valuation.emplace(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.05 + 0.1 * j));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    uint64_t numberOfInstantiatedModels = 0;
+    modelInstantiator.instantiateBatch(valuations, [&](uint64_t valuationIndex, storm::models::sparse::Dtmc<double> const& instantiated) {
+        EXPECT_EQ(numberOfInstantiatedModels, valuationIndex);
+        ++numberOfInstantiatedModels;
+        auto instantiatedEntry = instantiated.getTransitionMatrix().begin();
+        for (auto const& paramEntry : dtmc->getTransitionMatrix()) {
+            EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
+            EXPECT_NEAR(carl::toDouble(paramEntry.getValue().evaluate(valuations[valuationIndex])), instantiatedEntry->getValue(), 1e-12);
+            ++instantiatedEntry;
+        }
+    });
+    EXPECT_EQ(valuations.size(), numberOfInstantiatedModels);
+}
+
 TEST(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
     
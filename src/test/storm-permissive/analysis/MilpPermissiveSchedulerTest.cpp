@@ -1,6 +1,7 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm-permissive/analysis/MILPPermissiveSchedulers.h"
 #include "storm-permissive/analysis/PermissiveSchedulers.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/environment/Environment.h"
@@ -10,6 +11,8 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/solver.h"
 #include "test/storm_gtest.h"
 
 #ifdef STORM_HAVE_GUROBI
@@ -64,4 +67,45 @@ TEST(MilpPermissiveSchedulerTest, DieSelection) {
     EXPECT_TRUE(qualitativeResult1[0]);
 }
 
+TEST(MilpPermissiveSchedulerTest, DieSelectionIncremental) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels().setBuildChoiceLabels(true);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    auto backwardTransitions = mdp->getBackwardTransitions();
+    storm::storage::BitVector goalstates = mdp->getStates("one");
+    goalstates = storm::utility::graph::performProb1A(*mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
+    storm::storage::BitVector sinkstates =
+        storm::utility::graph::performProb0A(backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
+
+    // The same solver is used for all queries such that the model constraints are only created once.
+    auto solver = storm::utility::solver::getLpSolver<double>("Gurobi", storm::solver::LpSolverTypeSelection::Gurobi);
+    storm::ps::MilpPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, *mdp, goalstates, sinkstates, true);
+
+    comp.calculatePermissiveScheduler(true, 0.10);
+    EXPECT_TRUE(comp.foundSolution());
+    comp.calculatePermissiveScheduler(true, 0.17);
+    EXPECT_FALSE(comp.foundSolution());
+    comp.calculatePermissiveScheduler(false, 0.10);
+    EXPECT_FALSE(comp.foundSolution());
+    comp.calculatePermissiveScheduler(false, 0.17);
+    EXPECT_TRUE(comp.foundSolution());
+
+    // Changing the penalties does not change the feasibility.
+    storm::ps::PermissiveSchedulerPenalties penalties;
+    penalties.set(mdp->getInitialStates().getNextSetIndex(0), 0, 3.0);
+    comp.setPenalties(penalties);
+    comp.calculatePermissiveScheduler(true, 0.10);
+    ASSERT_TRUE(comp.foundSolution());
+
+    storm::Environment env;
+    auto formulas = storm::parser::FormulaParser(program.getManager().getSharedPointer()).parseFromString("P>=0.10 [ F \"one\"]");
+    auto submdp = comp.getScheduler().apply();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(submdp);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, formulas[0].getRawFormula()->asProbabilityOperatorFormula());
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
 #endif
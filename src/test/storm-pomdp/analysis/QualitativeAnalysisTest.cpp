@@ -27,6 +27,7 @@ void graphalgorithm_test(std::string const& path, std::string const& constants,
     storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->invalidateAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
 }
 
@@ -44,6 +45,7 @@ void oneshot_test(std::string const& path, std::string const& constants, std::st
     storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->invalidateAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
     std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
     storm::pomdp::OneShotPolicySearch<double> memlessSearch(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory);
@@ -64,6 +66,7 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->invalidateAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
 
     std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
@@ -77,6 +80,38 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     }
 }
 
+void iterativesearch_incremental_test(std::string const& path, std::string const& constants, std::string formulaString) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    // Run graph algorithm
+    auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(*pomdp, *formula);
+    storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+    storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+    pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->invalidateAnalysisCache();
+    storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::pomdp::MemlessSearchOptions options;
+    options.forceLookahead = true;
+    uint64_t lookahead = pomdp->getNumberOfStates();
+    storm::pomdp::IterativePolicySearch<double> search(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+    bool expected = search.analyzeForInitialStates(lookahead);
+
+    // The same search with increasing lookaheads reuses the encoding and the winning region of the previous runs.
+    storm::pomdp::IterativePolicySearch<double> incrementalSearch(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+    for (uint64_t k = 1; k < lookahead; k *= 2) {
+        incrementalSearch.analyzeForInitialStates(k);
+    }
+    EXPECT_EQ(expected, incrementalSearch.analyzeForInitialStates(lookahead));
+}
+
 void symbolicbelsup_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
     storm::prism::Program program = storm::parser::PrismParser::parse(path);
     program = storm::utility::prism::preprocess(program, constants);
@@ -91,6 +126,7 @@ void symbolicbelsup_test(std::string const& path, std::string const& constants,
     storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->invalidateAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
 
     storm::pomdp::qualitative::JaniBeliefSupportMdpGenerator<double> janicreator(*pomdp);
@@ -145,6 +181,12 @@ TEST(QualitativeAnalysis, Iterative_Maze) {
     iterativesearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
 }
 
+TEST(QualitativeAnalysis, Iterative_IncreasingLookahead) {
+    iterativesearch_incremental_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]");
+    iterativesearch_incremental_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]");
+    iterativesearch_incremental_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]");
+}
+
 TEST(QualitativeAnalysis, SymbolicBelSup_Simple) {
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
@@ -908,6 +908,41 @@ TYPED_TEST(BeliefExplorationTest, refuel_Pmax) {
         << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
 }
 
+TYPED_TEST(BeliefExplorationTest, refuel_Pmax_MultiThreaded) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+    auto result = checker.check(this->env(), *data.formula);
+
+    auto options = this->options();
+    options.explorationThreads = 4;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> multiThreadedChecker(data.model, options);
+    auto multiThreadedResult = multiThreadedChecker.check(this->env(), *data.formula);
+
+    // Beliefs are explored in the same order, so the results have to coincide.
+    EXPECT_EQ(result.lowerBound, multiThreadedResult.lowerBound);
+    EXPECT_EQ(result.upperBound, multiThreadedResult.upperBound);
+}
+
+TYPED_TEST(BeliefExplorationTest, refuel_Pmax_Incremental) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+    auto options = this->options();
+    options.incrementalSolving = true;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, options);
+    auto result = checker.check(this->env(), *data.formula);
+
+    ValueType expected = this->parseNumber("38/155");
+    EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
+    EXPECT_GE(result.upperBound, expected - this->modelcheckingPrecision());
+    // Use relative difference of bounds for this one
+    EXPECT_LE(result.diff(), this->precision())
+        << "Result [" << result.lowerBound << ", " << result.upperBound
+        << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
+}
+
 TYPED_TEST(BeliefExplorationTest, refuel_Pmax_SE) {
     typedef typename TestFixture::ValueType ValueType;
 
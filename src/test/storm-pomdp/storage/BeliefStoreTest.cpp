@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-pomdp/storage/BeliefStore.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+
+TEST(BeliefStoreTest, SharedSupportsAndQuantization) {
+    typedef storm::storage::BeliefStore<uint64_t, double> StoreType;
+    StoreType store;
+
+    StoreType::BeliefType onGrid = {{1, 0.25}, {3, 0.75}};
+    StoreType::BeliefType offGrid = {{1, 0.3}, {3, 0.7}};
+    StoreType::BeliefType otherSupport = {{2, 0.5}, {3, 0.5}};
+    StoreType::BeliefType dirac = {{4, 1.0}};
+
+    EXPECT_EQ(0ul, store.addBelief(onGrid, 4));
+    // The values of this belief are not multiples of 1/4, so they are stored unquantized.
+    EXPECT_EQ(1ul, store.addBelief(offGrid, 4));
+    EXPECT_EQ(2ul, store.addBelief(otherSupport));
+    EXPECT_EQ(3ul, store.addBelief(dirac));
+
+    EXPECT_EQ(4ul, store.size());
+    EXPECT_EQ(3ul, store.getNumberOfSupports());
+    EXPECT_EQ(2ul, store.getNumberOfQuantizedBeliefs());
+
+    // Stored beliefs are reproduced exactly.
+    EXPECT_EQ(onGrid, store.getBelief(0));
+    EXPECT_EQ(offGrid, store.getBelief(1));
+    EXPECT_EQ(otherSupport, store.getBelief(2));
+    EXPECT_EQ(dirac, store.getBelief(3));
+
+    uint64_t numberOfEntries = 0;
+    for (auto const& entry : store.getEntries(1)) {
+        EXPECT_EQ(offGrid.at(entry.first), entry.second);
+        ++numberOfEntries;
+    }
+    EXPECT_EQ(2ul, numberOfEntries);
+    EXPECT_EQ(3ul, store.getState(2, 1));
+}
+
+TEST(BeliefStoreTest, ExactValues) {
+    typedef storm::storage::BeliefStore<uint64_t, storm::RationalNumber> StoreType;
+    StoreType store;
+
+    StoreType::BeliefType onGrid = {{0, storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3"))},
+                                    {5, storm::utility::convertNumber<storm::RationalNumber>(std::string("2/3"))}};
+    StoreType::BeliefType offGrid = {{0, storm::utility::convertNumber<storm::RationalNumber>(std::string("1/7"))},
+                                     {5, storm::utility::convertNumber<storm::RationalNumber>(std::string("6/7"))}};
+    store.addBelief(onGrid, 3);
+    store.addBelief(offGrid, 3);
+
+    EXPECT_EQ(1ul, store.getNumberOfSupports());
+    EXPECT_EQ(1ul, store.getNumberOfQuantizedBeliefs());
+    EXPECT_EQ(onGrid, store.getBelief(0));
+    EXPECT_EQ(offGrid, store.getBelief(1));
+}
@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/storage/PomdpMemoryProduct.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/transformer/PomdpMemoryUnfolder.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Pomdp<double>> buildPomdp(std::string const& path, std::string const& constants, std::string const& formulaString) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    return storm::transformer::MakePOMDPCanonic<double>(*pomdp).transform();
+}
+}  // namespace
+
+TEST(PomdpMemoryProductTest, CoincidesWithUnfolding) {
+    auto pomdp = buildPomdp(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.3", "Pmax=? [F \"goal\" ]");
+    storm::storage::PomdpMemory memory = storm::storage::PomdpMemoryBuilder().build(storm::storage::PomdpMemoryPattern::SelectiveCounter, 3);
+
+    auto unfolding = storm::transformer::PomdpMemoryUnfolder<double>(*pomdp, memory).transform();
+    storm::storage::PomdpMemoryProduct<double> product(*pomdp, memory);
+    storm::storage::BitVector reachableStates = product.exploreReachableStates();
+    EXPECT_EQ(unfolding->getNumberOfStates(), reachableStates.getNumberOfSetBits());
+    EXPECT_EQ(unfolding->getNumberOfStates(), product.getNumberOfStates());
+    EXPECT_LE(product.getNumberOfStates(), pomdp->getNumberOfStates() * memory.getNumberOfStates());
+
+    // The unfolding orders its states as the full product, so the i-th reachable state is the i-th state of the unfolding.
+    std::vector<uint64_t> reachableStatesBefore = reachableStates.getNumberOfSetBitsBeforeIndices();
+    uint64_t numberOfChoices = 0;
+    for (uint64_t productState = 0; productState < product.getNumberOfStates(); ++productState) {
+        uint64_t unfoldingState = reachableStatesBefore[product.getUnfoldingState(productState)];
+        ASSERT_EQ(unfolding->getTransitionMatrix().getRowGroupSize(unfoldingState), product.getNumberOfChoices(productState));
+        numberOfChoices += product.getNumberOfChoices(productState);
+        for (uint64_t localChoice = 0; localChoice < product.getNumberOfChoices(productState); ++localChoice) {
+            auto successors = product.getSuccessors(productState, localChoice);
+            auto unfoldingRow = unfolding->getTransitionMatrix().getRow(unfoldingState, localChoice);
+            EXPECT_EQ(unfoldingRow.getNumberOfEntries(), successors.size());
+            double probability = storm::utility::zero<double>();
+            for (auto const& successor : successors) {
+                probability += successor.second;
+                EXPECT_EQ(pomdp->getObservation(product.getModelState(successor.first)), product.getModelObservation(successor.first));
+            }
+            EXPECT_NEAR(1.0, probability, 1e-9);
+        }
+    }
+    EXPECT_EQ(unfolding->getNumberOfChoices(), numberOfChoices);
+    // Querying the successors of reachable states does not instantiate any further states.
+    EXPECT_EQ(unfolding->getNumberOfStates(), product.getNumberOfStates());
+}
@@ -0,0 +1,149 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include "storm-server-cli/server/ModelCache.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+// Creates a builder that counts how often it is invoked.
+storm::server::ModelCache::Builder countingBuilder(uint64_t& numberOfBuilds) {
+    return [&numberOfBuilds]() {
+        ++numberOfBuilds;
+        return std::make_shared<storm::server::CachedModel>();
+    };
+}
+
+}  // namespace
+
+TEST(ModelCacheTest, HitsAndMisses) {
+    storm::server::ModelCache cache(2);
+    uint64_t numberOfBuilds = 0;
+    bool hit = true;
+
+    auto first = cache.get("a", countingBuilder(numberOfBuilds), hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(1ull, numberOfBuilds);
+    EXPECT_EQ(1ull, cache.size());
+
+    auto second = cache.get("a", countingBuilder(numberOfBuilds), hit);
+    EXPECT_TRUE(hit);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1ull, numberOfBuilds);
+
+    auto other = cache.get("b", countingBuilder(numberOfBuilds), hit);
+    EXPECT_FALSE(hit);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2ull, numberOfBuilds);
+    EXPECT_EQ(2ull, cache.size());
+
+    STORM_SILENT_EXPECT_THROW(storm::server::ModelCache(0), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(ModelCacheTest, LeastRecentlyUsedEviction) {
+    storm::server::ModelCache cache(2);
+    uint64_t numberOfBuilds = 0;
+    bool hit;
+
+    auto a = cache.get("a", countingBuilder(numberOfBuilds), hit);
+    cache.get("b", countingBuilder(numberOfBuilds), hit);
+    // Using a makes b the least recently used model, which is evicted when c is added.
+    cache.get("a", countingBuilder(numberOfBuilds), hit);
+    EXPECT_TRUE(hit);
+    cache.get("c", countingBuilder(numberOfBuilds), hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(2ull, cache.size());
+    EXPECT_EQ(3ull, numberOfBuilds);
+
+    EXPECT_EQ(a, cache.get("a", countingBuilder(numberOfBuilds), hit));
+    EXPECT_TRUE(hit);
+    EXPECT_EQ(3ull, numberOfBuilds);
+
+    // Now, c is the least recently used model.
+    cache.get("b", countingBuilder(numberOfBuilds), hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(4ull, numberOfBuilds);
+    cache.get("c", countingBuilder(numberOfBuilds), hit);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(5ull, numberOfBuilds);
+    EXPECT_EQ(2ull, cache.size());
+
+    // The evicted model stays valid for its users.
+    EXPECT_NE(nullptr, a);
+}
+
+TEST(ModelCacheTest, ConcurrentRequestsBuildOnce) {
+    storm::server::ModelCache cache(2);
+    std::atomic<uint64_t> numberOfBuilds(0);
+    std::promise<void> buildStarted, releaseBuild;
+    std::shared_future<void> release = releaseBuild.get_future().share();
+    auto builder = [&]() {
+        ++numberOfBuilds;
+        buildStarted.set_value();
+        release.wait();
+        return std::make_shared<storm::server::CachedModel>();
+    };
+
+    bool firstHit = true;
+    auto first = std::async(std::launch::async, [&]() { return cache.get("a", builder, firstHit); });
+    buildStarted.get_future().wait();
+
+    // The second request has to wait for the running build instead of starting its own one.
+    bool secondHit = false;
+    auto second = std::async(std::launch::async, [&]() { return cache.get("a", builder, secondHit); });
+    EXPECT_EQ(std::future_status::timeout, second.wait_for(std::chrono::milliseconds(100)));
+    EXPECT_EQ(1ull, cache.size());
+
+    releaseBuild.set_value();
+    auto firstModel = first.get();
+    auto secondModel = second.get();
+    EXPECT_EQ(firstModel, secondModel);
+    EXPECT_FALSE(firstHit);
+    EXPECT_TRUE(secondHit);
+    EXPECT_EQ(1ull, numberOfBuilds.load());
+}
+
+TEST(ModelCacheTest, FailedBuildIsRemoved) {
+    storm::server::ModelCache cache(2);
+    bool hit;
+    auto failingBuilder = []() -> std::shared_ptr<storm::server::CachedModel> {
+        throw storm::exceptions::InvalidArgumentException("Unable to build the model.");
+    };
+    STORM_SILENT_EXPECT_THROW(cache.get("a", failingBuilder, hit), storm::exceptions::InvalidArgumentException);
+    EXPECT_FALSE(hit);
+    EXPECT_EQ(0ull, cache.size());
+
+    uint64_t numberOfBuilds = 0;
+    auto model = cache.get("a", countingBuilder(numberOfBuilds), hit);
+    EXPECT_FALSE(hit);
+    EXPECT_NE(nullptr, model);
+    EXPECT_EQ(1ull, numberOfBuilds);
+    EXPECT_EQ(1ull, cache.size());
+}
+
+TEST(ModelCacheTest, ReplaceOnlyCurrentModel) {
+    storm::server::ModelCache cache(2);
+    uint64_t numberOfBuilds = 0;
+    bool hit;
+
+    auto original = cache.get("a", countingBuilder(numberOfBuilds), hit);
+    auto replacement = std::make_shared<storm::server::CachedModel>();
+    cache.replace("a", original, replacement);
+    EXPECT_EQ(replacement, cache.get("a", countingBuilder(numberOfBuilds), hit));
+    EXPECT_TRUE(hit);
+
+    // Replacing a stale model (e.g. by a query that started before the first replacement) keeps the current one.
+    cache.replace("a", original, std::make_shared<storm::server::CachedModel>());
+    EXPECT_EQ(replacement, cache.get("a", countingBuilder(numberOfBuilds), hit));
+    EXPECT_TRUE(hit);
+
+    // Models that are not cached are not added.
+    cache.replace("b", original, replacement);
+    EXPECT_EQ(1ull, cache.size());
+    EXPECT_EQ(1ull, numberOfBuilds);
+}
@@ -0,0 +1,98 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <future>
+#include <vector>
+
+#include "storm-server-cli/server/Server.h"
+
+namespace {
+
+storm::json<double> createQuery(std::string const& properties) {
+    storm::json<double> query;
+    query["model"] = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    query["properties"] = properties;
+    query["precision"] = 1e-8;
+    return query;
+}
+
+}  // namespace
+
+TEST(ServerTest, ProcessQuery) {
+    // The port is only used when running the server.
+    storm::server::Server server(0, 2, 1);
+
+    storm::json<double> answer = server.processQuery(createQuery("P=? [F \"one\"]; R{\"coin_flips\"}=? [F \"done\"]"));
+    ASSERT_EQ(0ull, answer.count("error")) << answer.dump();
+    EXPECT_FALSE(answer.at("cached").get<bool>());
+    EXPECT_EQ(13ull, answer.at("states").get<uint64_t>());
+    EXPECT_EQ(20ull, answer.at("transitions").get<uint64_t>());
+    ASSERT_EQ(2ull, answer.at("results").size());
+    ASSERT_EQ(1ull, answer.at("results")[0].at("values").size());
+    EXPECT_NEAR(1.0 / 6.0, answer.at("results")[0].at("values")[0].get<double>(), 1e-6);
+    EXPECT_NEAR(11.0 / 3.0, answer.at("results")[1].at("values")[0].get<double>(), 1e-6);
+
+    // All labels of the program are built, so the cached model can be reused for other labels.
+    answer = server.processQuery(createQuery("P=? [F \"two\"]"));
+    ASSERT_EQ(0ull, answer.count("error")) << answer.dump();
+    EXPECT_TRUE(answer.at("cached").get<bool>());
+    EXPECT_NEAR(1.0 / 6.0, answer.at("results")[0].at("values")[0].get<double>(), 1e-6);
+
+    // The cached model has no label for this expression, so it is rebuilt.
+    answer = server.processQuery(createQuery("P=? [F s=7&d=6]"));
+    ASSERT_EQ(0ull, answer.count("error")) << answer.dump();
+    EXPECT_FALSE(answer.at("cached").get<bool>());
+    EXPECT_EQ(13ull, answer.at("states").get<uint64_t>());
+    EXPECT_NEAR(1.0 / 6.0, answer.at("results")[0].at("values")[0].get<double>(), 1e-6);
+
+    // The rebuilt model replaced the cached one and respects both the old and the new formulas.
+    answer = server.processQuery(createQuery("P=? [F s=7&d=6]; P=? [F \"one\"]"));
+    ASSERT_EQ(0ull, answer.count("error")) << answer.dump();
+    EXPECT_TRUE(answer.at("cached").get<bool>());
+    ASSERT_EQ(2ull, answer.at("results").size());
+    EXPECT_NEAR(1.0 / 6.0, answer.at("results")[0].at("values")[0].get<double>(), 1e-6);
+    EXPECT_NEAR(1.0 / 6.0, answer.at("results")[1].at("values")[0].get<double>(), 1e-6);
+}
+
+TEST(ServerTest, ConcurrentQueriesOnCachedModel) {
+    storm::server::Server server(0, 2, 4);
+    ASSERT_EQ(0ull, server.processQuery(createQuery("P=? [F \"one\"]")).count("error"));
+
+    // All queries refer to the same cached model, whose checks are serialised.
+    std::vector<std::future<storm::json<double>>> answers;
+    for (uint64_t query = 0; query < 8; ++query) {
+        std::string properties = query % 2 == 0 ? "P=? [F \"two\"]" : "R{\"coin_flips\"}=? [F \"done\"]";
+        answers.push_back(std::async(std::launch::async, [&server, properties]() { return server.processQuery(createQuery(properties)); }));
+    }
+    for (uint64_t query = 0; query < answers.size(); ++query) {
+        storm::json<double> answer = answers[query].get();
+        ASSERT_EQ(0ull, answer.count("error")) << answer.dump();
+        EXPECT_TRUE(answer.at("cached").get<bool>());
+        EXPECT_NEAR(query % 2 == 0 ? 1.0 / 6.0 : 11.0 / 3.0, answer.at("results")[0].at("values")[0].get<double>(), 1e-6);
+    }
+}
+
+TEST(ServerTest, InvalidQueries) {
+    storm::server::Server server(0, 2, 1);
+
+    // Errors are reported in the answer and the server stays usable.
+    storm::test::disableOutput();
+    storm::json<double> query;
+    query["properties"] = "P=? [F \"one\"]";
+    EXPECT_EQ(1ull, server.processQuery(query).count("error"));
+
+    query = createQuery("P=? [F \"one\"]");
+    query["type"] = "dot";
+    EXPECT_EQ(1ull, server.processQuery(query).count("error"));
+
+    query = createQuery("P=? [F \"one\"]");
+    query["model"] = STORM_TEST_RESOURCES_DIR "/dtmc/nonexistent.pm";
+    EXPECT_EQ(1ull, server.processQuery(query).count("error"));
+
+    EXPECT_EQ(1ull, server.processQuery(createQuery("P=? [F \"undefined\"]")).count("error"));
+    storm::test::enableErrorOutput();
+
+    storm::json<double> answer = server.processQuery(createQuery("P=? [F \"one\"]"));
+    ASSERT_EQ(0ull, answer.count("error")) << answer.dump();
+    EXPECT_NEAR(1.0 / 6.0, answer.at("results")[0].at("values")[0].get<double>(), 1e-6);
+}
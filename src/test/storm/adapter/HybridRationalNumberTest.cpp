@@ -0,0 +1,92 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+
+#include "storm/adapters/HybridRationalNumber.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/constants.h"
+
+namespace {
+storm::RationalNumber rational(int64_t numerator, int64_t denominator) {
+    return storm::utility::convertNumber<storm::RationalNumber>(numerator) / storm::utility::convertNumber<storm::RationalNumber>(denominator);
+}
+}  // namespace
+
+TEST(HybridRationalNumberTest, SmallArithmetic) {
+    storm::HybridRationalNumber half(1, 2);
+    storm::HybridRationalNumber threeTenths(3, 10);
+    EXPECT_TRUE(half.isSmall());
+    EXPECT_EQ(storm::HybridRationalNumber(4, 5), half + threeTenths);
+    EXPECT_EQ(storm::HybridRationalNumber(1, 5), half - threeTenths);
+    EXPECT_EQ(storm::HybridRationalNumber(3, 20), half * threeTenths);
+    EXPECT_EQ(storm::HybridRationalNumber(5, 3), half / threeTenths);
+    EXPECT_EQ(storm::HybridRationalNumber(-1, 2), -half);
+    EXPECT_EQ(storm::HybridRationalNumber(1, 2), storm::HybridRationalNumber(-2, -4));
+    EXPECT_TRUE((half - half).isZero());
+    EXPECT_TRUE((half + half).isOne());
+    EXPECT_TRUE(threeTenths < half);
+    EXPECT_FALSE(half < threeTenths);
+
+    auto sum = half + threeTenths;
+    EXPECT_EQ(4, sum.getSmallNumerator());
+    EXPECT_EQ(5, sum.getSmallDenominator());
+    EXPECT_EQ("4/5", storm::utility::to_string(sum));
+    EXPECT_EQ(rational(4, 5), storm::utility::convertNumber<storm::RationalNumber>(sum));
+    EXPECT_NEAR(0.8, storm::utility::convertNumber<double>(sum), 1e-15);
+}
+
+TEST(HybridRationalNumberTest, OverflowSwitchesToBigNumbers) {
+    int64_t const large = std::numeric_limits<int64_t>::max() / 2 + 1;
+    storm::HybridRationalNumber value(large);
+    storm::HybridRationalNumber doubled = value + value;
+    EXPECT_FALSE(doubled.isSmall());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(large) * storm::utility::convertNumber<storm::RationalNumber>(2),
+              doubled.toRationalNumber());
+
+    // Results that fit again switch back to the small representation.
+    storm::HybridRationalNumber back = doubled - value;
+    EXPECT_TRUE(back.isSmall());
+    EXPECT_EQ(value, back);
+
+    storm::HybridRationalNumber tiny(1, large);
+    storm::HybridRationalNumber product = tiny * tiny;
+    EXPECT_FALSE(product.isSmall());
+    EXPECT_EQ(rational(1, large) * rational(1, large), product.toRationalNumber());
+    EXPECT_TRUE(product < tiny);
+    EXPECT_TRUE((product / tiny).isSmall());
+    EXPECT_EQ(tiny, product / tiny);
+    EXPECT_EQ(storm::HybridRationalNumber(product.toRationalNumber()), product);
+}
+
+TEST(HybridRationalNumberTest, ConstantsComparator) {
+    storm::utility::ConstantsComparator<storm::HybridRationalNumber> exactComparator;
+    EXPECT_TRUE(exactComparator.isOne(storm::HybridRationalNumber(3, 3)));
+    EXPECT_FALSE(exactComparator.isEqual(storm::HybridRationalNumber(1, 3), storm::HybridRationalNumber(333, 1000)));
+
+    storm::utility::ConstantsComparator<storm::HybridRationalNumber> comparator(storm::HybridRationalNumber(1, 100));
+    EXPECT_TRUE(comparator.isEqual(storm::HybridRationalNumber(1, 3), storm::HybridRationalNumber(333, 1000)));
+}
+
+TEST(HybridRationalNumberTest, MatrixVectorMultiplication) {
+    storm::storage::SparseMatrixBuilder<storm::RationalNumber> builder(2, 2, 4);
+    builder.addNextValue(0, 0, rational(1, 2));
+    builder.addNextValue(0, 1, rational(1, 2));
+    builder.addNextValue(1, 0, rational(3, 10));
+    builder.addNextValue(1, 1, rational(7, 10));
+    storm::storage::SparseMatrix<storm::RationalNumber> matrix = builder.build();
+    std::vector<storm::RationalNumber> x = {rational(1, 3), rational(2, 3)};
+    std::vector<storm::RationalNumber> result(2);
+    matrix.multiplyWithVector(x, result);
+
+    storm::storage::SparseMatrix<storm::HybridRationalNumber> hybridMatrix = matrix.toValueType<storm::HybridRationalNumber>();
+    std::vector<storm::HybridRationalNumber> hybridX = {storm::HybridRationalNumber(1, 3), storm::HybridRationalNumber(2, 3)};
+    std::vector<storm::HybridRationalNumber> hybridResult(2);
+    hybridMatrix.multiplyWithVector(hybridX, hybridResult);
+    for (uint64_t row = 0; row < 2; ++row) {
+        EXPECT_TRUE(hybridResult[row].isSmall());
+        EXPECT_EQ(result[row], hybridResult[row].toRationalNumber());
+    }
+}
@@ -0,0 +1,96 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/JaniParser.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+// Two independent automata that each first set their variable randomly and then take an internal step to their final location.
+std::string const independentAutomata = R"({
+    "jani-version": 1,
+    "name": "independent_automata",
+    "type": "mdp",
+    "features": [],
+    "actions": [],
+    "variables": [
+        {"name": "a", "type": {"kind": "bounded", "base": "int", "lower-bound": 0, "upper-bound": 1}, "initial-value": 0},
+        {"name": "b", "type": {"kind": "bounded", "base": "int", "lower-bound": 0, "upper-bound": 1}, "initial-value": 0}
+    ],
+    "automata": [
+        {
+            "name": "A",
+            "locations": [{"name": "l0"}, {"name": "l1"}, {"name": "l2"}],
+            "initial-locations": ["l0"],
+            "edges": [
+                {
+                    "location": "l0",
+                    "destinations": [
+                        {"location": "l1", "probability": {"exp": 0.5}, "assignments": [{"ref": "a", "value": 1}]},
+                        {"location": "l1", "probability": {"exp": 0.5}}
+                    ]
+                },
+                {"location": "l1", "destinations": [{"location": "l2"}]},
+                {"location": "l2", "destinations": [{"location": "l2"}]}
+            ]
+        },
+        {
+            "name": "B",
+            "locations": [{"name": "l0"}, {"name": "l1"}, {"name": "l2"}],
+            "initial-locations": ["l0"],
+            "edges": [
+                {
+                    "location": "l0",
+                    "destinations": [
+                        {"location": "l1", "probability": {"exp": 0.5}, "assignments": [{"ref": "b", "value": 1}]},
+                        {"location": "l1", "probability": {"exp": 0.5}}
+                    ]
+                },
+                {"location": "l1", "destinations": [{"location": "l2"}]},
+                {"location": "l2", "destinations": [{"location": "l2"}]}
+            ]
+        }
+    ],
+    "system": {"elements": [{"automaton": "A"}, {"automaton": "B"}], "syncs": []},
+    "properties": []
+})";
+}
+
+TEST(AmpleSetReductionTest, ReducedStateSpace) {
+    storm::jani::Model model = storm::parser::JaniParser::parseFromString(independentAutomata, false).first;
+    auto formulas = storm::api::extractFormulasFromProperties(
+        storm::api::parsePropertiesForJaniModel("Pmax=? [F a=1 & b=1]; Pmin=? [F a=1 & b=0]; Pmax=? [a=0 U b=1]", model));
+    storm::builder::BuilderOptions options(formulas, model);
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(model, options).build();
+    options.setPartialOrderReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(model, options).build();
+
+    // Each automaton has five local states. The internal steps are never interleaved, so no state has both automata in location l1.
+    EXPECT_EQ(25ul, fullModel->getNumberOfStates());
+    EXPECT_EQ(21ul, reducedModel->getNumberOfStates());
+
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine<double>(fullModel, storm::api::createTask<double>(formula, true));
+        auto reducedResult = storm::api::verifyWithSparseEngine<double>(reducedModel, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*fullModel->getInitialStates().begin()],
+                    reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6)
+            << "for " << *formula;
+    }
+}
+
+TEST(AmpleSetReductionTest, DependentEdgesPreventReduction) {
+    // Let the internal step of the second automaton write the variable of the first one.
+    std::string dependentAutomata = independentAutomata;
+    std::string const internalEdge = R"({"location": "l1", "destinations": [{"location": "l2"}]})";
+    dependentAutomata.replace(dependentAutomata.rfind(internalEdge), internalEdge.size(),
+                              R"({"location": "l1", "destinations": [{"location": "l2", "assignments": [{"ref": "a", "value": "a"}]}]})");
+    storm::jani::Model model = storm::parser::JaniParser::parseFromString(dependentAutomata, false).first;
+    storm::builder::BuilderOptions options;
+    options.setPartialOrderReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(model, options).build();
+    EXPECT_EQ(25ul, reducedModel->getNumberOfStates());
+}
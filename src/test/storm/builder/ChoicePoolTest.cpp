@@ -0,0 +1,86 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <unordered_map>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/generator/ChoicePool.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/BoostTypes.h"
+
+TEST(ChoicePoolTest, RecycledChoicesAreReset) {
+    storm::generator::ChoicePool<double> pool;
+    storm::generator::Choice<double> choice = pool.getChoice(3, true);
+    choice.addProbability(0, 0.25);
+    choice.addProbability(7, 0.75);
+    choice.addReward(2.0);
+    choice.addLabel("a");
+    choice.addOriginData(boost::any(storm::storage::FlatSet<uint_fast64_t>({1})));
+    pool.recycle(std::move(choice));
+    EXPECT_EQ(1ull, pool.getNumberOfPooledChoices());
+
+    storm::generator::Choice<double> reusedChoice = pool.getChoice(5);
+    EXPECT_EQ(0ull, pool.getNumberOfPooledChoices());
+    EXPECT_EQ(5ull, reusedChoice.getActionIndex());
+    EXPECT_FALSE(reusedChoice.isMarkovian());
+    EXPECT_EQ(0ull, reusedChoice.size());
+    EXPECT_EQ(0.0, reusedChoice.getTotalMass());
+    EXPECT_TRUE(reusedChoice.getRewards().empty());
+    EXPECT_FALSE(reusedChoice.hasLabels());
+    EXPECT_FALSE(reusedChoice.hasOriginData());
+
+    storm::generator::StateBehavior<double> behavior = pool.getStateBehavior();
+    behavior.addStateReward(1.0);
+    behavior.addChoice(std::move(reusedChoice));
+    behavior.setExpanded();
+    pool.recycle(std::move(behavior));
+    EXPECT_EQ(1ull, pool.getNumberOfPooledChoices());
+
+    storm::generator::StateBehavior<double> reusedBehavior = pool.getStateBehavior();
+    EXPECT_FALSE(reusedBehavior.wasExpanded());
+    EXPECT_TRUE(reusedBehavior.empty());
+    EXPECT_TRUE(reusedBehavior.getStateRewards().empty());
+}
+
+TEST(ChoicePoolTest, ExpansionWithRecycledBehaviors) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::PrismNextStateGenerator<double> generator(program);
+
+    std::unordered_map<storm::generator::CompressedState, uint32_t> stateToId;
+    std::vector<storm::generator::CompressedState> states;
+    auto stateToIdCallback = [&stateToId, &states](storm::generator::CompressedState const& state) {
+        auto findRes = stateToId.emplace(state, static_cast<uint32_t>(states.size()));
+        if (findRes.second) {
+            states.push_back(state);
+        }
+        return findRes.first->second;
+    };
+    generator.getInitialStates(stateToIdCallback);
+
+    // Explore the state space once while recycling every behavior and compare the result with a second expansion without recycling.
+    std::vector<std::vector<std::vector<std::pair<uint32_t, double>>>> transitions;
+    uint64_t numberOfTransitions = 0;
+    for (uint64_t state = 0; state < states.size(); ++state) {
+        generator.load(states[state]);
+        storm::generator::StateBehavior<double> behavior = generator.expand(stateToIdCallback);
+        transitions.emplace_back();
+        for (auto const& choice : behavior) {
+            transitions.back().emplace_back(choice.begin(), choice.end());
+            numberOfTransitions += choice.size();
+        }
+        generator.recycle(std::move(behavior));
+    }
+    EXPECT_EQ(169ull, states.size());
+    EXPECT_EQ(436ull, numberOfTransitions);
+
+    storm::generator::PrismNextStateGenerator<double> otherGenerator(program);
+    for (uint64_t state = 0; state < states.size(); ++state) {
+        otherGenerator.load(states[state]);
+        storm::generator::StateBehavior<double> behavior = otherGenerator.expand(stateToIdCallback);
+        ASSERT_EQ(transitions[state].size(), behavior.getNumberOfChoices());
+        for (uint64_t choice = 0; choice < behavior.getNumberOfChoices(); ++choice) {
+            std::vector<std::pair<uint32_t, double>> entries(behavior.getChoices()[choice].begin(), behavior.getChoices()[choice].end());
+            EXPECT_EQ(transitions[state][choice], entries);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/CommandGuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(CommandGuardIndexTest, CandidateCommands) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(R"(mdp
+module main
+    s : [0..3] init 0;
+    b : bool init false;
+    [] s=0 -> (s'=1);
+    [] s=0 & b -> (s'=2);
+    [] 1<=s & s<3 -> (s'=3);
+    [] s>=3 | b -> (s'=0);
+    [] 2>s & !b -> (b'=true);
+endmodule
+)",
+                                                                                "command_guard_index.nm");
+    storm::generator::VariableInformation variableInformation(program, 32);
+    storm::generator::CommandGuardIndex index(program.getModule(0), variableInformation);
+    ASSERT_TRUE(index.isIndexed());
+    EXPECT_LT(index.getAverageNumberOfCandidates(), 5.0);
+
+    auto const& sInformation = variableInformation.integerVariables[0];
+    auto const& bInformation = variableInformation.booleanVariables[0];
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (int64_t sValue = 0; sValue <= 3; ++sValue) {
+        for (bool bValue : {false, true}) {
+            state.setFromInt(sInformation.bitOffset, sInformation.bitWidth, sValue - sInformation.lowerBound);
+            state.set(bInformation.bitOffset, bValue);
+            std::vector<bool> enabled = {sValue == 0, sValue == 0 && bValue, 1 <= sValue && sValue < 3, sValue >= 3 || bValue, 2 > sValue && !bValue};
+            std::vector<uint64_t> const& candidates = index.getCandidateCommands(state);
+            EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+            for (uint64_t command = 0; command < enabled.size(); ++command) {
+                // Every enabled command must be a candidate.
+                if (enabled[command]) {
+                    EXPECT_TRUE(index.isCandidate(state, command)) << "command " << command << " in state s=" << sValue << ", b=" << bValue;
+                }
+                EXPECT_EQ(index.isCandidate(state, command), std::binary_search(candidates.begin(), candidates.end(), command));
+            }
+        }
+    }
+}
+
+TEST(CommandGuardIndexTest, IndexedModels) {
+    std::vector<std::tuple<std::string, uint64_t, uint64_t>> instances = {
+        {"/dtmc/brp-16-2.pm", 677, 867}, {"/dtmc/crowds-5-5.pm", 8607, 15113}, {"/mdp/coin2-2.nm", 272, 492}, {"/mdp/csma2-2.nm", 1038, 1282}};
+    for (auto const& instance : instances) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + std::get<0>(instance));
+        storm::generator::VariableInformation variableInformation(program, 32);
+        bool someModuleIndexed = false;
+        for (auto const& module : program.getModules()) {
+            storm::generator::CommandGuardIndex index(module, variableInformation);
+            EXPECT_LE(index.getAverageNumberOfCandidates(), static_cast<double>(module.getNumberOfCommands())) << "for " << std::get<0>(instance);
+            someModuleIndexed |= index.isIndexed();
+        }
+        EXPECT_TRUE(someModuleIndexed) << "for " << std::get<0>(instance);
+
+        auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+        EXPECT_EQ(std::get<1>(instance), model->getNumberOfStates()) << "for " << std::get<0>(instance);
+        EXPECT_EQ(std::get<2>(instance), model->getNumberOfTransitions()) << "for " << std::get<0>(instance);
+    }
+}
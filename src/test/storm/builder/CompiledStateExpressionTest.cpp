@@ -0,0 +1,69 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(CompiledStateExpressionTest, Evaluation) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(R"(dtmc
+module main
+    x : [-3..5] init 0;
+    y : [0..7] init 0;
+    b : bool init false;
+    [] true -> (x'=x);
+endmodule
+)",
+                                                                                "compiled_expressions.pm");
+    storm::expressions::ExpressionManager const& manager = program.getManager();
+    storm::expressions::Expression x = manager.getVariableExpression("x");
+    storm::expressions::Expression y = manager.getVariableExpression("y");
+    storm::expressions::Expression b = manager.getVariableExpression("b");
+    storm::expressions::Expression one = manager.integer(1);
+    storm::expressions::Expression two = manager.integer(2);
+
+    storm::generator::VariableInformation variableInformation(program, 32);
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+    auto guard = compiler.compile((x * x >= manager.integer(4) && !b) || x < -two);
+    auto update = compiler.compile(storm::expressions::ite(b, storm::expressions::maximum(x, y) + one, y % manager.integer(3) - x));
+    auto equality = compiler.compile(storm::expressions::iff(b, x == y) || storm::expressions::implies(b, y > two));
+    ASSERT_TRUE(guard.is_initialized());
+    ASSERT_TRUE(update.is_initialized());
+    ASSERT_TRUE(equality.is_initialized());
+    // Rational subexpressions are not compiled.
+    EXPECT_FALSE(compiler.compile(x > manager.rational(1.5)).is_initialized());
+
+    auto const& xInformation = variableInformation.integerVariables[0];
+    auto const& yInformation = variableInformation.integerVariables[1];
+    auto const& bInformation = variableInformation.booleanVariables[0];
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (int64_t xValue = -3; xValue <= 5; ++xValue) {
+        for (int64_t yValue = 0; yValue <= 7; ++yValue) {
+            for (bool bValue : {false, true}) {
+                state.setFromInt(xInformation.bitOffset, xInformation.bitWidth, xValue - xInformation.lowerBound);
+                state.setFromInt(yInformation.bitOffset, yInformation.bitWidth, yValue - yInformation.lowerBound);
+                state.set(bInformation.bitOffset, bValue);
+                EXPECT_EQ((xValue * xValue >= 4 && !bValue) || xValue < -2, guard->evaluateAsBool(state));
+                EXPECT_EQ(bValue ? std::max(xValue, yValue) + 1 : yValue % 3 - xValue, update->evaluateAsInt(state));
+                EXPECT_EQ((bValue == (xValue == yValue)) || !bValue || yValue > 2, equality->evaluateAsBool(state));
+            }
+        }
+    }
+}
+
+TEST(CompiledStateExpressionTest, ModelsCoincide) {
+    std::vector<std::string> files = {"/dtmc/brp-16-2.pm", "/dtmc/crowds-5-5.pm", "/mdp/two_dice.nm", "/mdp/coin2-2.nm", "/mdp/csma2-2.nm"};
+    for (auto const& file : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        storm::builder::BuilderOptions options(true, true);
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+        options.setCompileExpressions();
+        auto compiledModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+        EXPECT_EQ(model->getNumberOfStates(), compiledModel->getNumberOfStates()) << "for " << file;
+        EXPECT_EQ(model->getTransitionMatrix(), compiledModel->getTransitionMatrix()) << "for " << file;
+        EXPECT_EQ(model->getStateLabeling(), compiledModel->getStateLabeling()) << "for " << file;
+    }
+}
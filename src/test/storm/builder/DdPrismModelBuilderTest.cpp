@@ -336,3 +336,45 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest_Cudd, VariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    // Reordering at the phase boundaries must not change the model.
+    options.reorderAtPhaseBoundaries = true;
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_EQ(364ul, model->getNumberOfStates());
+    EXPECT_EQ(654ul, model->getNumberOfTransitions());
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ChainingReachability) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.useChainingReachability = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(364ul, model->getNumberOfStates());
+    EXPECT_EQ(654ul, model->getNumberOfTransitions());
+}
@@ -5,6 +5,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/MemoryLimit.h"
 #include "test/storm_gtest.h"
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -148,6 +149,132 @@ TEST(ExplicitPrismModelBuilderTest, POMdp) {
     model = storm::builder::ExplicitModelBuilder<double>(program).build();
 }
 
+TEST(ExplicitPrismModelBuilderTest, ConcurrentExploration) {
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/leader3.nm", "/mdp/coin2-2.nm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels();
+        generatorOptions.setBuildAllRewardModels();
+
+        storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+        sequentialOptions.numberOfThreads = 1;
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+
+        storm::builder::ExplicitModelBuilder<double>::Options concurrentOptions;
+        concurrentOptions.numberOfThreads = 4;
+        auto concurrentModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, concurrentOptions).build();
+
+        // The state numbering must not depend on the number of threads.
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), concurrentModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getStateLabeling(), concurrentModel->getStateLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getRewardModels().size(), concurrentModel->getRewardModels().size()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& concurrentRewardModel = concurrentModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), concurrentRewardModel.hasStateRewards()) << file;
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), concurrentRewardModel.getStateRewardVector()) << file;
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), concurrentRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), concurrentRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ConcurrentLabeling) {
+    // With depth-first exploration, the states are explored sequentially, but the labels are still computed concurrently.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Dfs;
+    sequentialOptions.numberOfThreads = 1;
+    auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+
+    storm::builder::ExplicitModelBuilder<double>::Options concurrentOptions;
+    concurrentOptions.explorationOrder = storm::builder::ExplorationOrder::Dfs;
+    concurrentOptions.numberOfThreads = 4;
+    auto concurrentModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, concurrentOptions).build();
+
+    EXPECT_EQ(sequentialModel->getTransitionMatrix(), concurrentModel->getTransitionMatrix());
+    EXPECT_EQ(sequentialModel->getStateLabeling(), concurrentModel->getStateLabeling());
+}
+
+TEST(ExplicitPrismModelBuilderTest, TreeCompressedStateStorage) {
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/leader3.nm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels();
+
+        storm::builder::ExplicitModelBuilder<double>::Options hashMapOptions;
+        hashMapOptions.stateStorageType = storm::storage::sparse::StateStorageType::HashMap;
+        auto hashMapModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, hashMapOptions).build();
+
+        storm::builder::ExplicitModelBuilder<double>::Options treeOptions;
+        treeOptions.stateStorageType = storm::storage::sparse::StateStorageType::TreeCompression;
+        auto treeModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, treeOptions).build();
+
+        // The state numbering only depends on the exploration order.
+        EXPECT_EQ(hashMapModel->getTransitionMatrix(), treeModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(hashMapModel->getStateLabeling(), treeModel->getStateLabeling()) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, BestFirstExplorationWithBudget) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::string const unexploredLabel = storm::builder::ExplicitModelBuilder<double>::getUnexploredStatesLabel();
+
+    // Without a budget, all states are explored regardless of the heuristic.
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.explorationOrder = storm::builder::ExplorationOrder::BestFirst;
+    options.explorationHeuristic = [](storm::generator::CompressedState const& state) { return -static_cast<double>(state.getNumberOfSetBits()); };
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    EXPECT_FALSE(model->hasLabel(unexploredLabel));
+
+    // With breadth-first exploration, the first three levels are expanded.
+    options.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    options.stateBudget = 3;
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_EQ(10ul, model->getNumberOfTransitions());
+    EXPECT_EQ(4ul, model->getStates(unexploredLabel).getNumberOfSetBits());
+
+    // The states that are not expanded are absorbing.
+    options.explorationOrder = storm::builder::ExplorationOrder::BestFirst;
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options).build();
+    storm::storage::BitVector const& unexploredStates = model->getStates(unexploredLabel);
+    EXPECT_EQ(model->getNumberOfStates() - 3, unexploredStates.getNumberOfSetBits());
+    for (auto state : unexploredStates) {
+        auto const& row = model->getTransitionMatrix().getRow(state);
+        ASSERT_EQ(1ul, row.getNumberOfEntries());
+        EXPECT_EQ(state, row.begin()->getColumn());
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, MemoryLimit) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    std::string const unexploredLabel = storm::builder::ExplicitModelBuilder<double>::getUnexploredStatesLabel();
+    uint64_t numberOfDegradations = storm::utility::resources::getDegradations().size();
+
+    // The limit is approached at the first check (before the 1024th state is expanded), so the exploration stops there.
+    storm::utility::resources::setMemoryLimit(1);
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    storm::utility::resources::setMemoryLimit(0);
+    EXPECT_LT(model->getNumberOfStates(), 8607ul);
+    ASSERT_TRUE(model->hasLabel(unexploredLabel));
+    EXPECT_EQ(model->getNumberOfStates() - 1023, model->getStates(unexploredLabel).getNumberOfSetBits());
+    EXPECT_EQ(numberOfDegradations + 1, storm::utility::resources::getDegradations().size());
+
+    // Without a limit, the model is built completely.
+    model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_FALSE(model->hasLabel(unexploredLabel));
+}
+
 TEST(ExplicitPrismModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
 
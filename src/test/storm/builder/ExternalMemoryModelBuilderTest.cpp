@@ -0,0 +1,98 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <numeric>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/ExternalMemoryModelBuilder.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+// Builds the model of the given program with the external-memory exploration (using very little memory, such that the sorting
+// has to spill to disk) and with the in-memory exploration and checks that both models agree. As the states are numbered differently,
+// only properties that do not depend on the numbering are compared.
+void checkExternalMemoryExploration(std::string const& filename, bool buildChoiceLabels = false) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(filename, true);
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels().setBuildAllRewardModels().setBuildChoiceLabels(buildChoiceLabels);
+
+    std::string modelFilename = (std::filesystem::temp_directory_path() / "storm-external-memory-test.smb").string();
+    storm::builder::ExternalMemoryModelBuilder::Options builderOptions;
+    builderOptions.memoryLimit = 1 << 14;
+    storm::builder::ExternalMemoryModelBuilder::Statistics statistics =
+        storm::builder::ExternalMemoryModelBuilder(program, generatorOptions, builderOptions).build(modelFilename);
+    auto external = storm::parser::BinaryModelParser::parseModel(modelFilename);
+    std::filesystem::remove(modelFilename);
+    auto expected = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+    ASSERT_EQ(expected->getType(), external->getType());
+    EXPECT_EQ(expected->getNumberOfStates(), statistics.numberOfStates);
+    EXPECT_EQ(expected->getNumberOfStates(), external->getNumberOfStates());
+    EXPECT_EQ(expected->getNumberOfChoices(), external->getNumberOfChoices());
+    EXPECT_EQ(expected->getNumberOfTransitions(), external->getNumberOfTransitions());
+    EXPECT_TRUE(external->getTransitionMatrix().isProbabilistic() || expected->getType() == storm::models::ModelType::Ctmc);
+
+    for (auto const& label : expected->getStateLabeling().getLabels()) {
+        ASSERT_TRUE(external->getStateLabeling().containsLabel(label)) << label;
+        EXPECT_EQ(expected->getStateLabeling().getStates(label).getNumberOfSetBits(), external->getStateLabeling().getStates(label).getNumberOfSetBits())
+            << label;
+    }
+    // The initial states are the first states.
+    EXPECT_EQ(0ul, *external->getInitialStates().begin());
+    ASSERT_EQ(expected->hasChoiceLabeling(), external->hasChoiceLabeling());
+    if (expected->hasChoiceLabeling()) {
+        for (auto const& label : expected->getChoiceLabeling().getLabels()) {
+            EXPECT_EQ(expected->getChoiceLabeling().getChoices(label).getNumberOfSetBits(),
+                      external->getChoiceLabeling().getChoices(label).getNumberOfSetBits())
+                << label;
+        }
+    }
+
+    ASSERT_EQ(expected->getNumberOfRewardModels(), external->getNumberOfRewardModels());
+    for (auto const& rewardModel : expected->getRewardModels()) {
+        auto const& externalRewardModel = external->getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), externalRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            auto const& expectedRewards = rewardModel.second.getStateRewardVector();
+            auto const& externalRewards = externalRewardModel.getStateRewardVector();
+            EXPECT_NEAR(std::accumulate(expectedRewards.begin(), expectedRewards.end(), 0.0), std::accumulate(externalRewards.begin(), externalRewards.end(), 0.0),
+                        1e-9);
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), externalRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            auto const& expectedRewards = rewardModel.second.getStateActionRewardVector();
+            auto const& externalRewards = externalRewardModel.getStateActionRewardVector();
+            EXPECT_NEAR(std::accumulate(expectedRewards.begin(), expectedRewards.end(), 0.0), std::accumulate(externalRewards.begin(), externalRewards.end(), 0.0),
+                        1e-9);
+        }
+    }
+
+    if (expected->getType() == storm::models::ModelType::Ctmc) {
+        auto const& expectedExitRates = expected->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+        auto const& externalExitRates = external->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+        EXPECT_NEAR(std::accumulate(expectedExitRates.begin(), expectedExitRates.end(), 0.0),
+                    std::accumulate(externalExitRates.begin(), externalExitRates.end(), 0.0), 1e-6);
+    }
+}
+
+}  // namespace
+
+TEST(ExternalMemoryModelBuilderTest, Dtmc) {
+    checkExternalMemoryExploration(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    checkExternalMemoryExploration(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkExternalMemoryExploration(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+}
+
+TEST(ExternalMemoryModelBuilderTest, Ctmc) {
+    checkExternalMemoryExploration(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+}
+
+TEST(ExternalMemoryModelBuilderTest, Mdp) {
+    checkExternalMemoryExploration(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", true);
+    checkExternalMemoryExploration(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+}
@@ -0,0 +1,74 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <string>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/IncrementalExplicitModelBuilder.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+// A random walk on 0..100 whose states from 50 onwards behave as given.
+storm::prism::Program createProgram(std::string const& upperCommand, std::string const& goalLabel = "x=100") {
+    std::string programText =
+        "dtmc\n"
+        "module walk\n"
+        "    x : [0..100] init 0;\n"
+        "    [] x<50 -> 0.5 : (x'=x+1) + 0.5 : (x'=max(x-1,0));\n" +
+        upperCommand +
+        "\n"
+        "    [] x=100 -> 1 : (x'=x);\n"
+        "endmodule\n"
+        "label \"goal\" = " +
+        goalLabel + ";\n";
+    return storm::parser::PrismParser::parseFromString(programText, "incremental.pm");
+}
+
+void checkSameModel(storm::prism::Program const& program, std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    auto expected = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(expected->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(expected->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_EQ(expected->getStates("goal").getNumberOfSetBits(), model->getStates("goal").getNumberOfSetBits());
+    EXPECT_TRUE(model->getTransitionMatrix().isProbabilistic());
+}
+
+}  // namespace
+
+TEST(IncrementalExplicitModelBuilderTest, ReuseUnchangedStates) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    storm::builder::IncrementalExplicitModelBuilder<double> builder(generatorOptions);
+
+    // The states from 50 onwards are absorbing, so only the states up to 50 are reachable.
+    storm::prism::Program program = createProgram("    [] x>=50 & x<100 -> 1 : (x'=x);");
+    auto model = builder.build(program);
+    EXPECT_EQ(51ull, model->getNumberOfStates());
+    EXPECT_EQ(0ull, builder.getNumberOfReusedStates());
+    checkSameModel(program, model);
+
+    // Only state 50 enables the changed command, the new states are explored on demand.
+    program = createProgram("    [] x>=50 & x<100 -> 0.5 : (x'=x+1) + 0.5 : (x'=x-1);");
+    model = builder.build(program);
+    EXPECT_EQ(101ull, model->getNumberOfStates());
+    EXPECT_EQ(50ull, builder.getNumberOfReusedStates());
+    checkSameModel(program, model);
+
+    // Changing the probabilities of the same command again reuses all other states.
+    program = createProgram("    [] x>=50 & x<100 -> 0.25 : (x'=x+1) + 0.75 : (x'=x-1);");
+    model = builder.build(program);
+    EXPECT_EQ(101ull, model->getNumberOfStates());
+    EXPECT_EQ(51ull, builder.getNumberOfReusedStates());
+    checkSameModel(program, model);
+
+    // A changed label requires to build the model from scratch.
+    program = createProgram("    [] x>=50 & x<100 -> 0.25 : (x'=x+1) + 0.75 : (x'=x-1);", "x>=90");
+    model = builder.build(program);
+    EXPECT_EQ(0ull, builder.getNumberOfReusedStates());
+    EXPECT_EQ(11ull, model->getStates("goal").getNumberOfSetBits());
+    checkSameModel(program, model);
+}
@@ -0,0 +1,87 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/ModuleSymmetryReduction.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+std::string const symmetricProcesses = R"(dtmc
+module p1
+    s1 : [0..2] init 0;
+    [] s1=0 -> 0.5:(s1'=1) + 0.5:(s1'=2);
+    [] s1>0 -> (s1'=s1);
+endmodule
+module p2 = p1 [s1=s2] endmodule
+module p3 = p1 [s1=s3] endmodule
+
+label "all_done" = s1>0 & s2>0 & s3>0;
+label "first_done" = s1>0;
+)";
+}
+
+TEST(ModuleSymmetryReductionTest, Canonicalization) {
+    storm::prism::Program program =
+        storm::parser::PrismParser::parseFromString(symmetricProcesses, "symmetric_processes.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32);
+    storm::generator::ModuleSymmetryReduction reduction(program, variableInformation, {program.getLabelExpression("all_done")});
+    ASSERT_TRUE(reduction.hasSymmetries());
+    EXPECT_EQ(std::vector<std::vector<uint64_t>>({{0, 1, 2}}), reduction.getSymmetricModuleGroups());
+
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    std::vector<int64_t> valuation = {2, 0, 1};
+    for (uint64_t process = 0; process < 3; ++process) {
+        auto const& information = variableInformation.integerVariables[process];
+        state.setFromInt(information.bitOffset, information.bitWidth, valuation[process] - information.lowerBound);
+    }
+    reduction.canonicalize(state);
+    for (uint64_t process = 0; process < 3; ++process) {
+        auto const& information = variableInformation.integerVariables[process];
+        EXPECT_EQ(static_cast<int64_t>(process), static_cast<int64_t>(state.getAsInt(information.bitOffset, information.bitWidth)) + information.lowerBound);
+    }
+
+    // An asymmetric label prevents the reduction.
+    storm::generator::ModuleSymmetryReduction asymmetricReduction(program, variableInformation, {program.getLabelExpression("first_done")});
+    EXPECT_FALSE(asymmetricReduction.hasSymmetries());
+}
+
+TEST(ModuleSymmetryReductionTest, ReducedStateSpaces) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(symmetricProcesses, "symmetric_processes.pm");
+    storm::builder::BuilderOptions options;
+    options.addLabel("all_done");
+    options.setSymmetryReduction();
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    // The states are given by the multisets of size three over the local states.
+    EXPECT_EQ(10ul, model->getNumberOfStates());
+    EXPECT_EQ(4ul, model->getStates("all_done").getNumberOfSetBits());
+
+    // Building all labels includes the asymmetric label, so the full state space is explored.
+    options.setBuildAllLabels();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+}
+
+TEST(ModuleSymmetryReductionTest, PreservesProperties) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(
+        storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"two\"]; Pmax=? [F s1=7 & s2=7 & d1=d2]; R{\"coinflips\"}min=? [F \"done\"]", program));
+    storm::builder::BuilderOptions options(formulas);
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    options.setSymmetryReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+    EXPECT_EQ(91ul, reducedModel->getNumberOfStates());
+
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        auto reducedResult = storm::api::verifyWithSparseEngine<double>(reducedModel, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()],
+                    reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6)
+            << "for " << *formula;
+    }
+}
@@ -0,0 +1,33 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/builder/RewardModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(RewardModelBuilderTest, SparseAndDenseRewards) {
+    storm::builder::RewardModelBuilder<double> builder(storm::builder::RewardModelInformation("rew", true, true, false));
+    EXPECT_TRUE(builder.hasStateRewards());
+    EXPECT_TRUE(builder.hasStateActionRewards());
+
+    // The state rewards are sparse whereas every choice has a reward.
+    uint64_t const numberOfStates = 5000;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.addStateReward(state % 1000 == 3 ? 1.5 : 0.0);
+        builder.addStateActionReward(static_cast<double>(state + 1));
+        builder.addStateActionReward(0.0);
+    }
+
+    // The last states do not provide rewards, which is why they are padded with zeros.
+    auto rewardModel = builder.build(2 * numberOfStates + 4, numberOfStates + 2, numberOfStates + 2);
+    auto const& stateRewards = rewardModel.getStateRewardVector();
+    auto const& stateActionRewards = rewardModel.getStateActionRewardVector();
+    ASSERT_EQ(numberOfStates + 2, stateRewards.size());
+    ASSERT_EQ(2 * numberOfStates + 4, stateActionRewards.size());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_EQ(state % 1000 == 3 ? 1.5 : 0.0, stateRewards[state]);
+        EXPECT_EQ(static_cast<double>(state + 1), stateActionRewards[2 * state]);
+        EXPECT_EQ(0.0, stateActionRewards[2 * state + 1]);
+    }
+    EXPECT_EQ(0.0, stateRewards[numberOfStates + 1]);
+    EXPECT_EQ(0.0, stateActionRewards[2 * numberOfStates + 3]);
+}
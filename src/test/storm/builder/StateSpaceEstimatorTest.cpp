@@ -0,0 +1,46 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/StateSpaceEstimator.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(StateSpaceEstimatorTest, CompleteExploration) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", true);
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+
+    storm::builder::StateSpaceEstimator::Options options;
+    options.prefixSize = model->getNumberOfStates();
+    storm::builder::StateSpaceEstimator::Estimate estimate =
+        storm::builder::StateSpaceEstimator(program, storm::generator::NextStateGeneratorOptions(), options).estimate();
+    EXPECT_TRUE(estimate.exact);
+    EXPECT_EQ(model->getNumberOfStates(), estimate.numberOfEncounteredStates);
+    EXPECT_EQ(static_cast<double>(model->getNumberOfStates()), estimate.states.value);
+    EXPECT_EQ(static_cast<double>(model->getNumberOfChoices()), estimate.choices.value);
+    EXPECT_EQ(static_cast<double>(model->getNumberOfTransitions()), estimate.transitions.value);
+    EXPECT_EQ(estimate.states.lower, estimate.states.upper);
+}
+
+TEST(StateSpaceEstimatorTest, SampledExploration) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", true);
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+
+    storm::builder::StateSpaceEstimator::Options options;
+    options.prefixSize = 100;
+    options.numberOfWalks = 200;
+    storm::builder::StateSpaceEstimator::Estimate estimate =
+        storm::builder::StateSpaceEstimator(program, storm::generator::NextStateGeneratorOptions(), options).estimate();
+    EXPECT_FALSE(estimate.exact);
+    EXPECT_GT(estimate.numberOfEncounteredStates, options.prefixSize);
+    EXPECT_LE(estimate.numberOfEncounteredStates, model->getNumberOfStates());
+    EXPECT_LE(static_cast<double>(estimate.numberOfEncounteredStates), estimate.states.lower);
+    EXPECT_LE(estimate.states.lower, estimate.states.value);
+    EXPECT_LE(estimate.states.value, estimate.states.upper);
+    EXPECT_LE(estimate.knuthStates.lower, estimate.knuthStates.upper);
+    EXPECT_LE(estimate.captureRecaptureStates.lower, estimate.captureRecaptureStates.upper);
+    // Crowds is a Markov chain, so every state has a single choice (and the estimate does not depend on the sampled states).
+    EXPECT_DOUBLE_EQ(estimate.states.value, estimate.choices.value);
+    EXPECT_GE(estimate.transitions.value, estimate.states.value);
+    EXPECT_GT(estimate.memory.value, 0.0);
+}
@@ -0,0 +1,132 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/AnalysisCache.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/graph.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Mdp<double>> buildCoinMdp() {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    return storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Mdp<double>>();
+}
+}  // namespace
+
+TEST(AnalysisCacheTest, HitsAndMisses) {
+    auto mdp = buildCoinMdp();
+    storm::models::sparse::Mdp<double> const& model = *mdp;
+    storm::models::sparse::AnalysisCache<double>& cache = model.getAnalysisCache();
+    cache.clear();
+    uint64_t hits = cache.getNumberOfHits();
+    uint64_t misses = cache.getNumberOfMisses();
+
+    auto backwardTransitions = cache.getBackwardTransitions(model.getTransitionMatrix());
+    EXPECT_EQ(model.getBackwardTransitions(), *backwardTransitions);
+    EXPECT_EQ(backwardTransitions, cache.getBackwardTransitions(model.getTransitionMatrix()));
+    EXPECT_EQ(hits + 1, cache.getNumberOfHits());
+    EXPECT_EQ(misses + 1, cache.getNumberOfMisses());
+
+    // The qualitative state sets are keyed by the phi and psi states and the kind of analysis.
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = mdp->getStates("all_coins_equal_1");
+    auto computeMin = [&]() { return storm::utility::graph::performProb01Min(*mdp, allStates, psiStates); };
+    auto computeMax = [&]() { return storm::utility::graph::performProb01Max(*mdp, allStates, psiStates); };
+    typedef storm::models::sparse::AnalysisCache<double>::QualitativeAnalysis QualitativeAnalysis;
+    auto minSets = cache.getQualitativeStateSets(QualitativeAnalysis::Prob01Min, allStates, psiStates, computeMin);
+    auto maxSets = cache.getQualitativeStateSets(QualitativeAnalysis::Prob01Max, allStates, psiStates, computeMax);
+    EXPECT_EQ(computeMin(), *minSets);
+    EXPECT_EQ(computeMax(), *maxSets);
+    EXPECT_EQ(minSets, cache.getQualitativeStateSets(QualitativeAnalysis::Prob01Min, allStates, psiStates, computeMin));
+    EXPECT_NE(maxSets, cache.getQualitativeStateSets(QualitativeAnalysis::Prob01Max, allStates, mdp->getStates("all_coins_equal_0"), computeMax));
+    EXPECT_EQ(hits + 2, cache.getNumberOfHits());
+    EXPECT_EQ(misses + 4, cache.getNumberOfMisses());
+
+    auto mecs = cache.getMaximalEndComponentDecomposition(model.getTransitionMatrix(), *backwardTransitions, allStates);
+    EXPECT_EQ(storm::storage::MaximalEndComponentDecomposition<double>(*mdp).size(), mecs->size());
+    EXPECT_EQ(mecs, cache.getMaximalEndComponentDecomposition(model.getTransitionMatrix(), *backwardTransitions, allStates));
+
+    auto options = storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs();
+    auto bsccs = cache.getStronglyConnectedComponentDecomposition(model.getTransitionMatrix(), options);
+    EXPECT_EQ(storm::storage::StronglyConnectedComponentDecomposition<double>(model.getTransitionMatrix(), options).size(), bsccs->size());
+    EXPECT_EQ(bsccs, cache.getStronglyConnectedComponentDecomposition(model.getTransitionMatrix(), options));
+    auto sccs = cache.getStronglyConnectedComponentDecomposition(model.getTransitionMatrix(), storm::storage::StronglyConnectedComponentDecompositionOptions());
+    EXPECT_NE(bsccs, sccs);
+    EXPECT_EQ(hits + 4, cache.getNumberOfHits());
+    EXPECT_EQ(misses + 7, cache.getNumberOfMisses());
+
+    // Invalidating the cache (e.g. after modifying the transition matrix) discards the cached results.
+    EXPECT_LT(0ull, cache.getUsedMemory());
+    mdp->invalidateAnalysisCache();
+    EXPECT_EQ(0ull, model.getAnalysisCache().getUsedMemory());
+    EXPECT_EQ(*backwardTransitions, *model.getAnalysisCache().getBackwardTransitions(model.getTransitionMatrix()));
+}
+
+TEST(AnalysisCacheTest, ReadOnlyAccess) {
+    auto mdp = buildCoinMdp();
+    mdp->getAnalysisCache().clear();
+    auto backwardTransitions = mdp->getAnalysisCache().getBackwardTransitions(mdp->getTransitionMatrix());
+    uint64_t usedMemory = mdp->getAnalysisCache().getUsedMemory();
+    EXPECT_LT(0ull, usedMemory);
+
+    // Retrieving the transition matrix via a non-const reference does not discard the cached results.
+    storm::storage::SparseMatrix<double>& transitionMatrix = mdp->getTransitionMatrix();
+    EXPECT_EQ(mdp->getNumberOfChoices(), transitionMatrix.getRowCount());
+    EXPECT_EQ(usedMemory, mdp->getAnalysisCache().getUsedMemory());
+    EXPECT_EQ(backwardTransitions, mdp->getAnalysisCache().getBackwardTransitions(mdp->getTransitionMatrix()));
+
+    // Copies share the cache until the cache of one of them is invalidated.
+    storm::models::sparse::Mdp<double> copy(*mdp);
+    EXPECT_EQ(backwardTransitions, copy.getAnalysisCache().getBackwardTransitions(copy.getTransitionMatrix()));
+    copy.invalidateAnalysisCache();
+    EXPECT_EQ(0ull, copy.getAnalysisCache().getUsedMemory());
+    EXPECT_EQ(backwardTransitions, mdp->getAnalysisCache().getBackwardTransitions(mdp->getTransitionMatrix()));
+
+    // Callers that modify the transition matrix invalidate the cache afterwards.
+    transitionMatrix.makeRowGroupsAbsorbing(mdp->getInitialStates());
+    mdp->invalidateAnalysisCache();
+    EXPECT_EQ(0ull, mdp->getAnalysisCache().getUsedMemory());
+    EXPECT_EQ(mdp->getBackwardTransitions(), *mdp->getAnalysisCache().getBackwardTransitions(mdp->getTransitionMatrix()));
+    EXPECT_NE(*backwardTransitions, mdp->getBackwardTransitions());
+}
+
+TEST(AnalysisCacheTest, MemoryBudget) {
+    auto mdp = buildCoinMdp();
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    typedef storm::models::sparse::AnalysisCache<double>::QualitativeAnalysis QualitativeAnalysis;
+    auto getMinSets = [&](storm::models::sparse::AnalysisCache<double>& cache, std::string const& label) {
+        storm::storage::BitVector psiStates = mdp->getStates(label);
+        return cache.getQualitativeStateSets(QualitativeAnalysis::Prob01Min, allStates, psiStates,
+                                             [&]() { return storm::utility::graph::performProb01Min(*mdp, allStates, psiStates); });
+    };
+
+    // A budget of zero disables the cache.
+    storm::models::sparse::AnalysisCache<double> disabledCache(0);
+    EXPECT_NE(getMinSets(disabledCache, "all_coins_equal_0"), getMinSets(disabledCache, "all_coins_equal_0"));
+    EXPECT_EQ(0ull, disabledCache.getUsedMemory());
+    EXPECT_EQ(0ull, disabledCache.getNumberOfHits());
+
+    // Determine the size of a single entry and restrict the budget such that only one entry fits.
+    storm::models::sparse::AnalysisCache<double> cache(1024 * 1024);
+    auto first = getMinSets(cache, "all_coins_equal_0");
+    uint64_t entrySize = cache.getUsedMemory();
+    EXPECT_LT(0ull, entrySize);
+    cache.setMemoryBudget(entrySize + entrySize / 2);
+    EXPECT_EQ(first, getMinSets(cache, "all_coins_equal_0"));
+
+    // Inserting a second entry evicts the least recently used one.
+    auto second = getMinSets(cache, "all_coins_equal_1");
+    EXPECT_LE(cache.getUsedMemory(), cache.getMemoryBudget());
+    EXPECT_EQ(second, getMinSets(cache, "all_coins_equal_1"));
+    EXPECT_NE(first, getMinSets(cache, "all_coins_equal_0"));
+    EXPECT_EQ(*first, *getMinSets(cache, "all_coins_equal_0"));
+
+    cache.clear();
+    EXPECT_EQ(0ull, cache.getUsedMemory());
+}
@@ -7,6 +7,7 @@
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -133,3 +134,55 @@ TYPED_TEST(ExpectedVisitingTimesCtmcCslModelCheckerTest, expvisittimestest) {
         << "Result of expected visiting times computation is " << storm::utility::vector::toString(resultVector) << '\n';
 }
 }  // namespace
+
+TEST(ExpectedVisitingTimesHelperTest, SeveralDistributionsInParallel) {
+    // A tree of SCCs with two states each. Every SCC leads to two further SCCs, the leaves lead to an absorbing state.
+    uint64_t const numberOfSccs = 1023;
+    uint64_t const absorbingState = 2 * numberOfSccs;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+        uint64_t const firstChild = 2 * scc + 1;
+        uint64_t const leftTarget = firstChild < numberOfSccs ? 2 * firstChild : absorbingState;
+        uint64_t const rightTarget = firstChild + 1 < numberOfSccs ? 2 * (firstChild + 1) : absorbingState;
+        builder.addNextValue(2 * scc, 2 * scc + 1, 0.5);
+        builder.addNextValue(2 * scc, leftTarget, 0.5);
+        builder.addNextValue(2 * scc + 1, 2 * scc, 0.7);
+        builder.addNextValue(2 * scc + 1, rightTarget, 0.3);
+    }
+    builder.addNextValue(absorbingState, absorbingState, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    uint64_t const numberOfStates = matrix.getRowCount();
+
+    std::vector<std::vector<double>> distributions(3, std::vector<double>(numberOfStates, 0.0));
+    distributions[0][0] = 1.0;
+    distributions[1][1] = 0.5;
+    distributions[1][2 * 100] = 0.5;
+    for (uint64_t state = 0; state < absorbingState; state += 3) {
+        distributions[2][state] = 1.0 / 682.0;
+    }
+
+    storm::Environment sequentialEnv, parallelEnv;
+    sequentialEnv.solver().setNumberOfThreads(1);
+    parallelEnv.solver().setNumberOfThreads(4);
+    std::vector<double> interleaved(numberOfStates * distributions.size());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (uint64_t lane = 0; lane < distributions.size(); ++lane) {
+            interleaved[state * distributions.size() + lane] = distributions[lane][state];
+        }
+    }
+    storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<double> parallelHelper(matrix);
+    parallelHelper.computeExpectedVisitingTimes(parallelEnv, interleaved, distributions.size());
+
+    for (uint64_t lane = 0; lane < distributions.size(); ++lane) {
+        storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<double> sequentialHelper(matrix);
+        std::vector<double> expected = distributions[lane];
+        sequentialHelper.computeExpectedVisitingTimes(sequentialEnv, expected);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (storm::utility::isInfinity(expected[state])) {
+                EXPECT_TRUE(storm::utility::isInfinity(interleaved[state * distributions.size() + lane]));
+            } else {
+                EXPECT_NEAR(expected[state], interleaved[state * distributions.size() + lane], 1e-6);
+            }
+        }
+    }
+}
@@ -204,6 +204,21 @@ class DistrSparseEigenDoubleLUEnvironment {
     }
 };
 
+class AggregationDisaggregationSparseEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const CtmcEngine engine = CtmcEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setDetLraMethod(storm::solver::LraMethod::AggregationDisaggregation);
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        return env;
+    }
+};
+
 class ValueIterationSparseEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
@@ -351,7 +366,7 @@ class LraCtmcCslModelCheckerTest : public ::testing::Test {
 typedef ::testing::Types<GBSparseGmmxxGmresIluEnvironment, GBJaniSparseGmmxxGmresIluEnvironment, GBJaniHybridCuddGmmxxGmresEnvironment,
                          GBJaniHybridSylvanGmmxxGmresEnvironment, GBSparseEigenDGmresEnvironment, GBSparseEigenDoubleLUEnvironment,
                          GBSparseNativeSorEnvironment, DistrSparseGmmxxGmresIluEnvironment, DistrSparseEigenDoubleLUEnvironment,
-                         ValueIterationSparseEnvironment, SoundEnvironment>
+                         AggregationDisaggregationSparseEnvironment, ValueIterationSparseEnvironment, SoundEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LraCtmcCslModelCheckerTest, TestingTypes, );
@@ -0,0 +1,75 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/csl/helper/TransientUniformizationHelper.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+// A CTMC 0 -(2)-> 1 -(3)-> 2 where state 2 is absorbing. The time to reach state 2 from state 0 is hypoexponentially distributed.
+storm::storage::SparseMatrix<double> buildRateMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 3);
+    builder.addNextValue(0, 1, 2.0);
+    builder.addNextValue(1, 2, 3.0);
+    builder.addNextValue(2, 2, 1.0);
+    return builder.build();
+}
+
+double reachWithinTime(double t) {
+    return 1.0 - 3.0 * std::exp(-2.0 * t) + 2.0 * std::exp(-3.0 * t);
+}
+}  // namespace
+
+TEST(TransientUniformizationHelperTest, SeveralUpperBoundsAtOnce) {
+    storm::Environment env;
+    env.solver().setNumberOfThreads(2);
+    storm::storage::SparseMatrix<double> rateMatrix = buildRateMatrix();
+    storm::storage::SparseMatrix<double> backwardTransitions = rateMatrix.transpose(true);
+    std::vector<double> exitRates = {2.0, 3.0, 1.0};
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3, false);
+    psiStates.set(2);
+
+    std::vector<double> upperBounds = {1.0, 0.0, 0.5, 10.0, 1000.0};
+    auto results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForUpperBounds<double>(
+        env, storm::solver::SolveGoal<double>(), rateMatrix, backwardTransitions, phiStates, psiStates, exitRates, upperBounds);
+    ASSERT_EQ(upperBounds.size(), results.size());
+    for (uint64_t bound = 0; bound < upperBounds.size(); ++bound) {
+        double t = upperBounds[bound];
+        auto single = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<double>(
+            env, storm::solver::SolveGoal<double>(), rateMatrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, t);
+        ASSERT_EQ(3ull, results[bound].size());
+        EXPECT_NEAR(reachWithinTime(t), results[bound][0], 1e-6) << "for time bound " << t;
+        EXPECT_NEAR(1.0 - std::exp(-3.0 * t), results[bound][1], 1e-6) << "for time bound " << t;
+        EXPECT_EQ(1.0, results[bound][2]);
+        for (uint64_t state = 0; state < 3; ++state) {
+            EXPECT_NEAR(single[state], results[bound][state], 1e-6) << "for time bound " << t;
+        }
+    }
+}
+
+TEST(TransientUniformizationHelperTest, StopsOnceStationary) {
+    // Uniformize the maybe states {0, 1} of the CTMC above with rate 3.
+    storm::storage::SparseMatrixBuilder<double> builder(2, 2, 3);
+    builder.addNextValue(0, 0, 1.0 / 3.0);
+    builder.addNextValue(0, 1, 2.0 / 3.0);
+    builder.addNextValue(1, 1, 0.0);
+    storm::storage::SparseMatrix<double> uniformizedMatrix = builder.build();
+    std::vector<double> b = {0.0, 1.0};
+
+    storm::modelchecker::helper::TransientUniformizationHelper<double> helper(uniformizedMatrix, &b, 3.0);
+    std::vector<double> values(2, 0.0);
+    auto results = helper.computeTransientProbabilities({2.0, 1000.0}, values, 1e-8, false);
+    ASSERT_EQ(2ull, results.size());
+    EXPECT_NEAR(reachWithinTime(2.0), results[0][0], 1e-8);
+    EXPECT_NEAR(1.0 - std::exp(-6.0), results[0][1], 1e-8);
+    EXPECT_NEAR(1.0, results[1][0], 1e-8);
+    EXPECT_NEAR(1.0, results[1][1], 1e-8);
+
+    // The right truncation point for the larger bound is above 3000, but the iterates are stationary long before.
+    EXPECT_LT(helper.getNumberOfPerformedIterations(), 500ull);
+}
@@ -0,0 +1,76 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/exploration/PartialExplorationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+template<typename ModelType>
+std::pair<double, double> checkBounds(storm::storage::SymbolicModelDescription const& model, std::string const& formulaString,
+                                      storm::modelchecker::PartialExplorationOptions const& options) {
+    storm::modelchecker::PartialExplorationModelChecker<ModelType> checker(model, options);
+    storm::parser::FormulaParser formulaParser;
+    auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    EXPECT_TRUE(checker.canHandle(task));
+    auto result = checker.check(storm::Environment(), task);
+    EXPECT_TRUE(result->isExplicitQuantitativeCheckResult());
+    return checker.getLastBounds();
+}
+
+TEST(PartialExplorationModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::modelchecker::PartialExplorationOptions options;
+
+    // Without a budget, the bounds coincide.
+    auto bounds = checkBounds<storm::models::sparse::Dtmc<double>>(program, "P=? [F \"one\"]", options);
+    EXPECT_NEAR(1.0 / 6.0, bounds.first, 1e-6);
+    EXPECT_NEAR(1.0 / 6.0, bounds.second, 1e-6);
+
+    // After expanding the first two levels, no target state is reached yet.
+    options.stateBudget = 3;
+    bounds = checkBounds<storm::models::sparse::Dtmc<double>>(program, "P=? [F \"one\"]", options);
+    EXPECT_NEAR(0.0, bounds.first, 1e-6);
+    EXPECT_NEAR(1.0, bounds.second, 1e-6);
+
+    // Larger budgets yield tighter bounds.
+    double previousGap = 1.0;
+    for (uint64_t budget = 4; budget <= 13; ++budget) {
+        options.stateBudget = budget;
+        bounds = checkBounds<storm::models::sparse::Dtmc<double>>(program, "P=? [F \"one\"]", options);
+        EXPECT_LE(bounds.first, 1.0 / 6.0 + 1e-6);
+        EXPECT_GE(bounds.second, 1.0 / 6.0 - 1e-6);
+        EXPECT_LE(bounds.second - bounds.first, previousGap + 1e-6);
+        previousGap = bounds.second - bounds.first;
+    }
+}
+
+TEST(PartialExplorationModelCheckerTest, TwoDice) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::modelchecker::PartialExplorationOptions options;
+    options.stateBudget = 50;
+
+    for (std::string const formula : {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]"}) {
+        auto bounds = checkBounds<storm::models::sparse::Mdp<double>>(program, formula, options);
+        EXPECT_LE(bounds.first, 1.0 / 36.0 + 1e-6) << formula;
+        EXPECT_GE(bounds.second, 1.0 / 36.0 - 1e-6) << formula;
+        EXPECT_LT(bounds.first, bounds.second) << formula;
+    }
+
+    // A tiny memory budget stops the exploration right away.
+    options.stateBudget.reset();
+    options.memoryBudget = 1;
+    auto bounds = checkBounds<storm::models::sparse::Mdp<double>>(program, "Pmax=? [F \"two\"]", options);
+    EXPECT_NEAR(0.0, bounds.first, 1e-6);
+    EXPECT_NEAR(1.0, bounds.second, 1e-6);
+}
+
+}  // namespace
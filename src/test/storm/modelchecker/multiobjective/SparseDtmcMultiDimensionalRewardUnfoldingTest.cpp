@@ -4,6 +4,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/settings/SettingsManager.h"
@@ -85,6 +86,35 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_leader) {
               result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_leader_parallel) {
+    storm::Environment env;
+    env.solver().setNumberOfThreads(4);
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm";
+    std::string formulasAsString = "P=? [ F{\"num_rounds\"}<=2 \"elected\" ] ";
+    formulasAsString += "; P=? [ F{\"num_rounds\"}>=2,{\"num_rounds\"}<3 \"elected\" ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalNumber>> dtmc =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    // Epochs on the same level are analyzed concurrently, which must not affect the (exact) result.
+    result = storm::api::verifyWithSparseEngine(env, dtmc, storm::api::createTask<storm::RationalNumber>(formulas[0], true));
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("624/625")),
+              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+
+    result = storm::api::verifyWithSparseEngine(env, dtmc, storm::api::createTask<storm::RationalNumber>(formulas[1], true));
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("24/625")),
+              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+}
+
 TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     storm::Environment env;
     std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
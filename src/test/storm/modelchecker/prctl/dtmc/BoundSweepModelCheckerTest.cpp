@@ -0,0 +1,111 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/prctl/SparseBoundSweepModelChecker.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/BoundSweepCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+template<typename ModelType>
+std::shared_ptr<ModelType> buildModel(std::string const& path) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(path);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    return storm::builder::ExplicitModelBuilder<double>(program).build()->template as<ModelType>();
+}
+
+// Checks the formula prefix + bound + suffix for all bounds at once and compares the results with the ones for the individual bounds.
+template<typename ModelType, typename CheckerType>
+void compareWithIndividualResults(ModelType const& model, std::string const& prefix, std::string const& suffix, std::vector<double> const& bounds,
+                                  double precision, uint64_t numberOfThreads = 1) {
+    storm::Environment env;
+    env.solver().setNumberOfThreads(numberOfThreads);
+    storm::parser::FormulaParser formulaParser;
+    auto sweepFormula = formulaParser.parseSingleFormulaFromString(prefix + "1" + suffix);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> sweepTask(*sweepFormula);
+    storm::modelchecker::SparseBoundSweepModelChecker<ModelType> sweepChecker(model);
+    ASSERT_TRUE(sweepChecker.canHandle(sweepTask));
+    auto result = sweepChecker.check(env, sweepTask, bounds);
+    ASSERT_TRUE(result->isBoundSweepCheckResult());
+    auto const& sweepResult = result->template asBoundSweepCheckResult<double>();
+    ASSERT_EQ(bounds, sweepResult.getBounds());
+
+    CheckerType checker(model);
+    for (uint64_t boundIndex = 0; boundIndex < bounds.size(); ++boundIndex) {
+        std::stringstream formulaString;
+        formulaString << prefix << bounds[boundIndex] << suffix;
+        auto formula = formulaParser.parseSingleFormulaFromString(formulaString.str());
+        auto individualResult = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+        auto const& expected = individualResult->template asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& actual = sweepResult.getResult(boundIndex).template asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expected.size(), actual.size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], actual[state], precision) << formulaString.str() << " in state " << state;
+        }
+    }
+}
+}  // namespace
+
+TEST(BoundSweepModelCheckerTest, Dtmc) {
+    auto dtmc = buildModel<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    using Checker = storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>>;
+    // The bounds are deliberately not sorted.
+    compareWithIndividualResults<storm::models::sparse::Dtmc<double>, Checker>(*dtmc, "P=? [F<=", " \"done\"]", {4, 0, 1, 2, 3, 10, 7}, 1e-12);
+    compareWithIndividualResults<storm::models::sparse::Dtmc<double>, Checker>(*dtmc, "P=? [!\"two\" U<", " \"done\"]", {1, 5, 3}, 1e-12);
+}
+
+TEST(BoundSweepModelCheckerTest, Mdp) {
+    auto mdp = buildModel<storm::models::sparse::Mdp<double>>(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    using Checker = storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>;
+    compareWithIndividualResults<storm::models::sparse::Mdp<double>, Checker>(*mdp, "Pmin=? [F<=", " \"finished\"]", {0, 10, 20, 50}, 1e-12);
+    compareWithIndividualResults<storm::models::sparse::Mdp<double>, Checker>(*mdp, "Pmax=? [F<=", " \"all_coins_equal_1\"]", {30, 15}, 1e-12);
+}
+
+TEST(BoundSweepModelCheckerTest, Ctmc) {
+    auto ctmc = buildModel<storm::models::sparse::Ctmc<double>>(STORM_TEST_RESOURCES_DIR "/ctmc/polling2.sm");
+    using Checker = storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>>;
+    compareWithIndividualResults<storm::models::sparse::Ctmc<double>, Checker>(*ctmc, "P=? [F<=", " \"target\"]", {2, 0.5, 1, 10}, 1e-6);
+}
+
+TEST(BoundSweepModelCheckerTest, MarkovAutomaton) {
+    using ModelType = storm::models::sparse::MarkovAutomaton<double>;
+    using Checker = storm::modelchecker::SparseMarkovAutomatonCslModelChecker<ModelType>;
+    auto simple = buildModel<ModelType>(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    compareWithIndividualResults<ModelType, Checker>(*simple, "Pmin=? [F<=", " s>2]", {1, 0.25, 3}, 1e-5);
+    compareWithIndividualResults<ModelType, Checker>(*simple, "Pmax=? [F<=", " s=3]", {1.3, 0.5, 2}, 1e-5, 2);
+    auto server = buildModel<ModelType>(STORM_TEST_RESOURCES_DIR "/ma/server.ma");
+    compareWithIndividualResults<ModelType, Checker>(*server, "Pmax=? [F<=", " \"error\"]", {1, 5, 0.5}, 1e-5, 2);
+}
+
+TEST(BoundSweepModelCheckerTest, Unsupported) {
+    auto dtmc = buildModel<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::modelchecker::SparseBoundSweepModelChecker<storm::models::sparse::Dtmc<double>> sweepChecker(*dtmc);
+    storm::parser::FormulaParser formulaParser;
+    for (std::string formula : {"P=? [F \"done\"]", "P=? [F[2,5] \"done\"]", "R=? [C<=5]"}) {
+        auto parsed = formulaParser.parseSingleFormulaFromString(formula);
+        EXPECT_FALSE(sweepChecker.canHandle(storm::modelchecker::CheckTask<storm::logic::Formula, double>(*parsed))) << formula;
+    }
+    storm::Environment env;
+    auto parsed = formulaParser.parseSingleFormulaFromString("P=? [F<=4 \"done\"]");
+    STORM_SILENT_EXPECT_THROW(sweepChecker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*parsed), {2.5}),
+                              storm::exceptions::InvalidArgumentException);
+}
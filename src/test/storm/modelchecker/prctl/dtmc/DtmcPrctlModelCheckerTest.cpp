@@ -8,6 +8,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -310,6 +311,40 @@ class SparseTopologicalEigenLUEnvironment {
     }
 };
 
+class SparseTopologicalDirectEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        env.solver().topological().setDirectSolverThreshold(64);
+        return env;
+    }
+};
+
+class SparseTopologicalEigenLUParallelEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class HybridSylvanGmmxxGmresEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -359,6 +394,24 @@ class HybridCuddNativeSoundValueIterationEnvironment {
     }
 };
 
+class HybridCuddNativeJacobiChunkedEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    static const DtmcEngine engine = DtmcEngine::Hybrid;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        // A small budget forces the equation systems to be solved in many chunks.
+        env.modelchecker().setHybridChunkBudget(4096);
+        return env;
+    }
+};
+
 class HybridSylvanNativeRationalSearchEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -557,9 +610,11 @@ typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIlu
                          SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment, SparseEigenRationalLUEnvironment, SparseRationalEliminationEnvironment,
                          SparseNativeJacobiEnvironment, SparseNativeWalkerChaeEnvironment, SparseNativeSorEnvironment, SparseNativePowerEnvironment,
                          SparseNativeSoundValueIterationEnvironment, SparseNativeOptimisticValueIterationEnvironment, SparseNativeIntervalIterationEnvironment,
-                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, HybridSylvanGmmxxGmresEnvironment,
-                         HybridCuddNativeJacobiEnvironment, HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment,
-                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
+                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, SparseTopologicalEigenLUParallelEnvironment,
+                         SparseTopologicalDirectEnvironment, HybridSylvanGmmxxGmresEnvironment,
+                         HybridCuddNativeJacobiEnvironment, HybridCuddNativeJacobiChunkedEnvironment, HybridCuddNativeSoundValueIterationEnvironment,
+                         HybridSylvanNativeRationalSearchEnvironment, DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment,
+                         DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(DtmcPrctlModelCheckerTest, TestingTypes, );
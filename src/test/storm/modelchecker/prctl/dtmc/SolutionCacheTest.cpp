@@ -0,0 +1,51 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/hints/SolutionCache.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+
+TEST(SolutionCacheTest, StoreAndLoad) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F \"two\"]; P=? [F \"three\"]", program));
+    storm::builder::BuilderOptions options(formulas);
+    options.setBuildStateValuations();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "storm-solution-cache-test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directory(directory);
+    storm::modelchecker::SolutionCache<double> cache(directory.string());
+
+    // Nothing is cached initially.
+    EXPECT_EQ(nullptr, cache.loadHint(*model, *formulas[0]));
+
+    auto result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formulas[0], false));
+    auto const& solution = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    cache.store(*model, *formulas[0], solution);
+
+    // The stored solution is restored exactly, but only for the same formula.
+    auto hint = cache.loadHint(*model, *formulas[0]);
+    ASSERT_NE(nullptr, hint);
+    ASSERT_TRUE(hint->hasResultHint());
+    EXPECT_EQ(solution, hint->getResultHint());
+    EXPECT_EQ(nullptr, cache.loadHint(*model, *formulas[1]));
+
+    // A model whose states are numbered differently is matched by the state valuations.
+    auto permutedModel = storm::api::permuteModelStates<double>(model, storm::utility::permutation::OrderKind::Bfs).first;
+    auto permutedHint = cache.loadHint(*permutedModel, *formulas[0]);
+    ASSERT_NE(nullptr, permutedHint);
+    auto permutedResult = storm::api::verifyWithSparseEngine(permutedModel, storm::api::createTask<double>(formulas[0], false));
+    auto const& permutedSolution = permutedResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    ASSERT_EQ(permutedSolution.size(), permutedHint->getResultHint().size());
+    for (uint64_t state = 0; state < permutedSolution.size(); ++state) {
+        EXPECT_NEAR(permutedSolution[state], permutedHint->getResultHint()[state], 1e-6);
+    }
+
+    std::filesystem::remove_all(directory);
+}
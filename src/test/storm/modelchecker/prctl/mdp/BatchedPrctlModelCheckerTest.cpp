@@ -0,0 +1,116 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseBatchedPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace {
+template<typename ModelType>
+std::shared_ptr<ModelType> buildModel(std::string const& path) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(path);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    return storm::builder::ExplicitModelBuilder<double>(program).build()->template as<ModelType>();
+}
+
+std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> createTasks(std::vector<std::string> const& formulas,
+                                                                                        std::vector<std::shared_ptr<storm::logic::Formula const>>& parsed) {
+    storm::parser::FormulaParser formulaParser;
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (auto const& formula : formulas) {
+        parsed.push_back(formulaParser.parseSingleFormulaFromString(formula));
+        tasks.emplace_back(*parsed.back());
+    }
+    return tasks;
+}
+
+template<typename ModelType, typename CheckerType>
+void compareWithIndividualResults(storm::Environment const& env, ModelType const& model, std::vector<std::string> const& formulas) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parsed;
+    auto tasks = createTasks(formulas, parsed);
+    storm::modelchecker::SparseBatchedPrctlModelChecker<ModelType> batchedChecker(model);
+    for (auto const& task : tasks) {
+        ASSERT_TRUE(batchedChecker.canHandle(task)) << task.getFormula();
+    }
+    auto batchedResults = batchedChecker.check(env, tasks);
+    ASSERT_EQ(tasks.size(), batchedResults.size());
+
+    CheckerType checker(model);
+    for (uint64_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+        auto result = checker.check(env, tasks[taskIndex]);
+        if (result->isExplicitQualitativeCheckResult()) {
+            EXPECT_EQ(result->asExplicitQualitativeCheckResult().getTruthValuesVector(),
+                      batchedResults[taskIndex]->asExplicitQualitativeCheckResult().getTruthValuesVector())
+                << formulas[taskIndex];
+        } else {
+            auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            auto const& batchedValues = batchedResults[taskIndex]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(values.size(), batchedValues.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(values[state], batchedValues[state], 1e-6) << formulas[taskIndex] << " in state " << state;
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(BatchedPrctlModelCheckerTest, Die) {
+    auto dtmc = buildModel<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::Environment env;
+    // Use precise (native) solvers for the individual properties, so the results only differ by the precision of the batched value iteration.
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+
+    compareWithIndividualResults<storm::models::sparse::Dtmc<double>, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>>>(
+        env, *dtmc, {"P=? [F \"one\"]", "P=? [F \"two\"]", "P=? [F \"three\"]", "P=? [!\"three\" U \"two\"]", "P>=0.5 [F \"done\"]"});
+
+    // Check that the results are those of a single solved property.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parsed;
+    auto tasks = createTasks({"P=? [F \"one\"]"}, parsed);
+    auto results = storm::modelchecker::SparseBatchedPrctlModelChecker<storm::models::sparse::Dtmc<double>>(*dtmc).check(env, tasks);
+    EXPECT_NEAR(1.0 / 6.0, results.front()->asExplicitQuantitativeCheckResult<double>()[*dtmc->getInitialStates().begin()], 1e-6);
+}
+
+TEST(BatchedPrctlModelCheckerTest, Coin) {
+    auto mdp = buildModel<storm::models::sparse::Mdp<double>>(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+
+    // More than MaximalBatchSize properties with the same direction are split into several batches.
+    compareWithIndividualResults<storm::models::sparse::Mdp<double>, storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>>(
+        env, *mdp,
+        {"Pmin=? [F \"finished\"]", "Pmax=? [F \"finished\"]", "Pmin=? [F \"finished\" & \"all_coins_equal_0\"]",
+         "Pmax=? [F \"finished\" & \"all_coins_equal_0\"]", "Pmin=? [F \"finished\" & \"all_coins_equal_1\"]",
+         "Pmax=? [F \"finished\" & \"all_coins_equal_1\"]", "Pmin=? [F \"finished\" & !\"agree\"]", "Pmax=? [F \"finished\" & !\"agree\"]",
+         "Pmax=? [!\"agree\" U \"finished\"]", "Pmax=? [\"agree\" U \"finished\"]", "Pmax=? [F \"all_coins_equal_0\"]",
+         "Pmax=? [F \"all_coins_equal_1\"]", "Pmax<0.5 [F \"finished\" & !\"agree\"]"});
+}
+
+TEST(BatchedPrctlModelCheckerTest, CanHandle) {
+    auto mdp = buildModel<storm::models::sparse::Mdp<double>>(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::modelchecker::SparseBatchedPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parsed;
+    auto tasks = createTasks({"Pmax=? [F \"finished\"]", "P=? [F \"finished\"]", "Pmax=? [F<=5 \"finished\"]", "Rmax=? [F \"finished\"]",
+                              "Pmax=? [X \"finished\"]"},
+                             parsed);
+    EXPECT_TRUE(checker.canHandle(tasks[0]));
+    for (uint64_t taskIndex = 1; taskIndex < tasks.size(); ++taskIndex) {
+        EXPECT_FALSE(checker.canHandle(tasks[taskIndex])) << tasks[taskIndex].getFormula();
+    }
+    tasks[0].setProduceSchedulers(true);
+    EXPECT_FALSE(checker.canHandle(tasks[0]));
+}
@@ -22,6 +22,7 @@
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 
 namespace {
@@ -39,6 +40,20 @@ class SparseValueTypeValueIterationEnvironment {
     }
 };
 
+class SparseValueTypeValueIterationMultiThreadedEnvironment {
+   public:
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Mdp<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class SparseValueTypeLinearProgrammingEnvironment {
    public:
     static const bool isExact = false;
@@ -119,7 +134,8 @@ class LraMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
+typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeValueIterationMultiThreadedEnvironment,
+                         SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
 #ifdef STORM_HAVE_Z3_OPTIMIZE
                          ,
                          SparseRationalLinearProgrammingEnvironment
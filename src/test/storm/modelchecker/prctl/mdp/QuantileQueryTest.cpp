@@ -44,6 +44,17 @@ class SoundEnvironment {
     }
 };
 
+class ParallelSoundEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class ExactEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -164,7 +175,7 @@ class QuantileQueryTest : public ::testing::Test {
     }
 };
 
-typedef ::testing::Types<UnsoundEnvironment, SoundEnvironment, ExactEnvironment> TestingTypes;
+typedef ::testing::Types<UnsoundEnvironment, SoundEnvironment, ParallelSoundEnvironment, ExactEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(QuantileQueryTest, TestingTypes, );
 
@@ -4,6 +4,7 @@
 #include "storm-conv/api/storm-conv.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm-parsers/api/properties.h"
+#include "storm/adapters/JsonAdapter.h"
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
 
@@ -149,6 +150,37 @@ TYPED_TEST(SchedulerGenerationMdpPrctlModelCheckerTest, reachability) {
     EXPECT_EQ(0ull, scheduler2.getChoice(3).getDeterministicChoice());
 }
 
+TYPED_TEST(SchedulerGenerationMdpPrctlModelCheckerTest, packedReachability) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string formulasString = "Pmax=? [F \"target\"];";
+    auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/mdp/scheduler_generation.nm", formulasString);
+    auto mdp = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> checker(*mdp);
+
+    auto result = checker.check(this->env(), tasks[0]);
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    auto const& quantitativeResult = result->template asExplicitQuantitativeCheckResult<ValueType>();
+    ASSERT_TRUE(quantitativeResult.hasPackedScheduler());
+    storm::storage::PackedScheduler const& packedScheduler = quantitativeResult.getPackedScheduler();
+    ASSERT_EQ(4ull, packedScheduler.getNumberOfStates());
+    // The largest selected choice is 2.
+    EXPECT_EQ(2ull, packedScheduler.getNumberOfBitsPerChoice());
+    EXPECT_EQ(1ull, packedScheduler.getChoice(0));
+    EXPECT_EQ(2ull, packedScheduler.getChoice(1));
+    EXPECT_EQ(0ull, packedScheduler.getChoice(2));
+    EXPECT_EQ(0ull, packedScheduler.getChoice(3));
+
+    // The full scheduler is created on demand and the streamed json output coincides with the one of the full scheduler.
+    storm::storage::Scheduler<ValueType> const& scheduler = quantitativeResult.getScheduler();
+    EXPECT_TRUE(quantitativeResult.hasPackedScheduler());
+    std::stringstream packedJson, json;
+    packedScheduler.printJsonToStream<ValueType>(packedJson, mdp);
+    scheduler.printJsonToStream(json, mdp);
+    EXPECT_EQ(storm::json<double>::parse(json.str()), storm::json<double>::parse(packedJson.str()));
+}
+
 TYPED_TEST(SchedulerGenerationMdpPrctlModelCheckerTest, lra) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/statistical/ImportanceSplittingModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Model.h"
+
+namespace {
+
+typedef storm::modelchecker::ImportanceSplittingModelChecker<storm::models::sparse::Dtmc<double>> ImportanceSplittingModelChecker;
+
+double check(ImportanceSplittingModelChecker& checker, std::string const& formulaString, storm::Environment const& env = storm::Environment()) {
+    storm::parser::FormulaParser formulaParser;
+    auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    EXPECT_TRUE(checker.canHandle(task));
+    auto result = checker.check(env, task);
+    return result->asExplicitQuantitativeCheckResult<double>()[0];
+}
+
+TEST(ImportanceSplittingModelCheckerTest, RandomWalk) {
+    // A random walk that moves up with probability 0.2 and down with probability 0.8. By the gambler's ruin, the probability to reach the
+    // upper end before the lower end is 3 / (4^20 - 1).
+    std::string const programString =
+        "dtmc\n"
+        "module walk\n"
+        "  x : [0..20] init 1;\n"
+        "  [] x>0 & x<20 -> 0.2 : (x'=x+1) + 0.8 : (x'=x-1);\n"
+        "  [] x=0 | x=20 -> true;\n"
+        "endmodule\n"
+        "label \"top\" = x=20;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "walk.pm");
+    storm::modelchecker::ImportanceSplittingOptions options;
+    options.effort = 1000;
+    options.numberOfReplications = 16;
+    ImportanceSplittingModelChecker checker(program, options);
+
+    double const exact = 3.0 / (std::pow(4.0, 20.0) - 1.0);
+    double estimate = check(checker, "P=? [F \"top\"]");
+    EXPECT_NEAR(exact, estimate, 0.5 * exact);
+    EXPECT_LE(checker.getLastConfidenceInterval().first, estimate);
+    EXPECT_GE(checker.getLastConfidenceInterval().second, estimate);
+
+    // Every replication draws its random numbers from its own stream.
+    storm::Environment env;
+    env.solver().setNumberOfThreads(4);
+    EXPECT_EQ(estimate, check(checker, "P=? [F \"top\"]", env));
+
+    // The walk needs at least 19 steps to reach the upper end.
+    EXPECT_EQ(0.0, check(checker, "P=? [F<=18 \"top\"]"));
+    EXPECT_NEAR(std::pow(0.2, 19.0), check(checker, "P=? [F<=19 \"top\"]"), 0.5 * std::pow(0.2, 19.0));
+}
+
+TEST(ImportanceSplittingModelCheckerTest, DieJani) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::jani::Model janiModel = program.toJani();
+    storm::modelchecker::ImportanceSplittingOptions options;
+    options.effort = 2000;
+    ImportanceSplittingModelChecker checker(janiModel, options);
+
+    EXPECT_NEAR(1.0 / 6.0, check(checker, "P=? [F \"one\"]"), 0.02);
+    EXPECT_NEAR(1.0 / 6.0, check(checker, "P=? [!\"done\" U \"two\"]"), 0.02);
+}
+
+TEST(ImportanceSplittingModelCheckerTest, UserImportanceFunction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::modelchecker::ImportanceSplittingOptions options;
+    options.importanceFunction = program.getManager().getVariableExpression("d");
+    options.effort = 2000;
+    ImportanceSplittingModelChecker checker(program, options);
+
+    EXPECT_NEAR(1.0 / 6.0, check(checker, "P=? [F \"three\"]"), 0.02);
+}
+
+}  // namespace
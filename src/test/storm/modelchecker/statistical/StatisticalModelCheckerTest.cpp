@@ -0,0 +1,76 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+double checkQuantitative(storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>>& checker, std::string const& formulaString,
+                         storm::Environment const& env = storm::Environment()) {
+    storm::parser::FormulaParser formulaParser;
+    auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    EXPECT_TRUE(checker.canHandle(task));
+    auto result = checker.check(env, task);
+    return result->asExplicitQuantitativeCheckResult<double>()[0];
+}
+
+bool checkQualitative(storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>>& checker, std::string const& formulaString) {
+    storm::parser::FormulaParser formulaParser;
+    auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+    auto result = checker.check(storm::Environment(), storm::modelchecker::CheckTask<>(*formula, true));
+    return result->asExplicitQualitativeCheckResult()[0];
+}
+
+TEST(StatisticalModelCheckerTest, DieProgram) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::modelchecker::StatisticalModelCheckerOptions options;
+    options.precision = 0.01;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program, options);
+
+    EXPECT_NEAR(1.0 / 6.0, checkQuantitative(checker, "P=? [F \"one\"]"), 0.01);
+    EXPECT_NEAR(0.5, checkQuantitative(checker, "P=? [F<=3 \"done\"]"), 0.01);
+    EXPECT_NEAR(1.0 / 6.0, checkQuantitative(checker, "P=? [!\"done\" U \"two\"]"), 0.01);
+}
+
+TEST(StatisticalModelCheckerTest, DieSparseModel) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto dtmc = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true))
+                    .build()
+                    ->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::StatisticalModelCheckerOptions options;
+    options.precision = 0.01;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc, options);
+
+    double sequential = checkQuantitative(checker, "P=? [F \"two\"]");
+    EXPECT_NEAR(1.0 / 6.0, sequential, 0.01);
+    // The outcome of every trace only depends on the seed and the index of the trace.
+    storm::Environment env;
+    env.solver().setNumberOfThreads(4);
+    EXPECT_EQ(sequential, checkQuantitative(checker, "P=? [F \"two\"]", env));
+    EXPECT_NEAR(0.5, checkQuantitative(checker, "P=? [F<=3 \"done\"]"), 0.01);
+}
+
+TEST(StatisticalModelCheckerTest, SequentialProbabilityRatioTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::modelchecker::StatisticalModelCheckerOptions options;
+    options.stoppingRule = storm::modelchecker::StatisticalModelCheckerOptions::StoppingRule::Sprt;
+    options.confidence = 0.99;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program, options);
+
+    EXPECT_TRUE(checkQualitative(checker, "P>0.1 [F \"one\"]"));
+    EXPECT_FALSE(checkQualitative(checker, "P>=0.25 [F \"one\"]"));
+    EXPECT_TRUE(checkQualitative(checker, "P<0.6 [F<=3 \"done\"]"));
+}
+
+}  // namespace
@@ -0,0 +1,117 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/BinaryDdModelParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DDEncodingExporter.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+namespace {
+
+std::string getTemporaryFilename() {
+    return (std::filesystem::temp_directory_path() / "storm-binary-dd-model-test.sbdd").string();
+}
+
+template<storm::dd::DdType Type>
+std::shared_ptr<storm::models::symbolic::Model<Type, double>> buildModel(std::string const& filename) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(filename).substituteConstantsFormulas();
+    typename storm::builder::DdPrismModelBuilder<Type, double>::Options options;
+    options.buildAllRewardModels = true;
+    options.buildAllLabels = true;
+    return storm::builder::DdPrismModelBuilder<Type, double>().build(program, options);
+}
+
+template<storm::dd::DdType SourceType, storm::dd::DdType TargetType>
+std::shared_ptr<storm::models::symbolic::Model<TargetType, double>> roundTrip(
+    std::shared_ptr<storm::models::symbolic::Model<SourceType, double>> const& model) {
+    std::string filename = getTemporaryFilename();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::exportSymbolicModelAsBinary(stream, model);
+    }
+    auto result = storm::parser::BinaryDdModelParser<TargetType, double>::parseModel(filename);
+    std::filesystem::remove(filename);
+    return result;
+}
+
+template<storm::dd::DdType SourceType, storm::dd::DdType TargetType>
+void checkEqual(storm::models::symbolic::Model<SourceType, double> const& expected, storm::models::symbolic::Model<TargetType, double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    EXPECT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    EXPECT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_EQ(expected.getInitialStates().getNonZeroCount(), actual.getInitialStates().getNonZeroCount());
+    if constexpr (SourceType == TargetType) {
+        EXPECT_EQ(expected.getTransitionMatrix().getNodeCount(), actual.getTransitionMatrix().getNodeCount());
+    }
+    EXPECT_NEAR(expected.getTransitionMatrix().sumAbstract(expected.getTransitionMatrix().getContainedMetaVariables()).getValue(),
+                actual.getTransitionMatrix().sumAbstract(actual.getTransitionMatrix().getContainedMetaVariables()).getValue(), 1e-9);
+    EXPECT_EQ(expected.getNondeterminismVariables().size(), actual.getNondeterminismVariables().size());
+
+    for (auto const& label : expected.getLabels()) {
+        ASSERT_TRUE(actual.hasLabel(label));
+        EXPECT_EQ(expected.getStates(label).getNonZeroCount(), actual.getStates(label).getNonZeroCount());
+    }
+
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            auto const& expectedRewards = rewardModel.second.getStateActionRewardVector();
+            auto const& actualRewards = actualRewardModel.getStateActionRewardVector();
+            if constexpr (SourceType == TargetType) {
+                EXPECT_EQ(expectedRewards.getNodeCount(), actualRewards.getNodeCount());
+            }
+            EXPECT_NEAR(expectedRewards.sumAbstract(expectedRewards.getContainedMetaVariables()).getValue(),
+                        actualRewards.sumAbstract(actualRewards.getContainedMetaVariables()).getValue(), 1e-9);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BinaryDdModelParserTest, DtmcRoundTrip) {
+    auto model = buildModel<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto loaded = roundTrip<storm::dd::DdType::Sylvan, storm::dd::DdType::Sylvan>(model);
+    checkEqual(*model, *loaded);
+    EXPECT_EQ(13ull, loaded->getNumberOfStates());
+}
+
+TEST(BinaryDdModelParserTest, MdpRoundTrip) {
+    auto model = buildModel<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto loaded = roundTrip<storm::dd::DdType::CUDD, storm::dd::DdType::CUDD>(model);
+    checkEqual(*model, *loaded);
+}
+
+TEST(BinaryDdModelParserTest, CtmcRoundTrip) {
+    auto model = buildModel<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm");
+    auto loaded = roundTrip<storm::dd::DdType::Sylvan, storm::dd::DdType::Sylvan>(model);
+    checkEqual(*model, *loaded);
+}
+
+TEST(BinaryDdModelParserTest, OtherLibrary) {
+    // The node tables do not depend on the DD library.
+    auto model = buildModel<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto loaded = roundTrip<storm::dd::DdType::CUDD, storm::dd::DdType::Sylvan>(model);
+    checkEqual(*model, *loaded);
+}
+
+TEST(BinaryDdModelParserTest, WrongFormat) {
+    std::string filename = getTemporaryFilename();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        stream << "This is not a binary DD model file, but it is long enough to contain a header.";
+    }
+    STORM_SILENT_EXPECT_THROW((storm::parser::BinaryDdModelParser<storm::dd::DdType::Sylvan, double>::parseModel(filename)),
+                              storm::exceptions::WrongFormatException);
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,98 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+std::string getTemporaryFilename() {
+    return (std::filesystem::temp_directory_path() / "storm-binary-model-test.smb").string();
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> roundTrip(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    std::string filename = getTemporaryFilename();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::exportSparseModelAsBinary(stream, model);
+    }
+    auto result = storm::parser::BinaryModelParser::parseModel(filename);
+    std::filesystem::remove(filename);
+    return result;
+}
+
+void checkEqual(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+    ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+    if (expected.hasChoiceLabeling()) {
+        EXPECT_TRUE(expected.getChoiceLabeling() == actual.getChoiceLabeling());
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BinaryModelParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto loaded = roundTrip(model);
+    checkEqual(*model, *loaded);
+}
+
+TEST(BinaryModelParserTest, MdpRoundTrip) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+    auto loaded = roundTrip(model);
+    checkEqual(*model, *loaded);
+    EXPECT_EQ(model->getTransitionMatrix().getRowGroupIndices(), loaded->getTransitionMatrix().getRowGroupIndices());
+}
+
+TEST(BinaryModelParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto loaded = roundTrip(model);
+    checkEqual(*model, *loaded);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), loaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryModelParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto loaded = roundTrip(model);
+    checkEqual(*model, *loaded);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto loadedMa = loaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), loadedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), loadedMa->getExitRates());
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    std::string filename = getTemporaryFilename();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        stream << "This is not a binary model file, but it is long enough to contain a header.";
+    }
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+    std::filesystem::remove(filename);
+}
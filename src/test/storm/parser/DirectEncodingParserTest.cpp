@@ -1,7 +1,10 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <sstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -87,3 +90,18 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelExport) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+
+    // Exporting the model with multiple threads has to yield exactly the same output as the sequential export.
+    std::stringstream sequentialStream, parallelStream;
+    sequentialStream.precision(10);
+    parallelStream.precision(10);
+    storm::exporter::DirectEncodingOptions options;
+    storm::exporter::explicitExportSparseModel(sequentialStream, modelPtr, {}, options);
+    options.numberOfThreads = 4;
+    storm::exporter::explicitExportSparseModel(parallelStream, modelPtr, {}, options);
+    EXPECT_EQ(sequentialStream.str(), parallelStream.str());
+}
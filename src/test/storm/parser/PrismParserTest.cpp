@@ -179,6 +179,28 @@ TEST(PrismParser, NAryPredicates) {
     EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
 }
 
+TEST(PrismParser, SharedSubexpressionsTest) {
+    std::string testInput =
+        R"(mdp
+
+    module main
+        x : [0..3] init 0;
+        [] x=1 -> 1: (x'=2);
+        [] x=1 | x=2 -> 1: (x'=3);
+        [] x=1 -> 0.5: (x'=0) + 0.5: (x'=3);
+    endmodule)";
+
+    storm::prism::Program result;
+    EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+    storm::prism::Module const& module = result.getModule(0);
+    ASSERT_EQ(3ul, module.getNumberOfCommands());
+    // Structurally equal guards are represented by the same expression.
+    EXPECT_EQ(module.getCommand(0).getGuardExpression().getBaseExpressionPointer(), module.getCommand(2).getGuardExpression().getBaseExpressionPointer());
+    EXPECT_EQ(module.getCommand(0).getGuardExpression().getBaseExpressionPointer(),
+              module.getCommand(1).getGuardExpression().getBaseExpression().getOperand(0));
+    EXPECT_NE(module.getCommand(0).getGuardExpression().getBaseExpressionPointer(), module.getCommand(1).getGuardExpression().getBaseExpressionPointer());
+}
+
 TEST(PrismParser, IllegalInputTest) {
     std::string testInput =
         R"(ctmc
@@ -0,0 +1,34 @@
+#include "storm/simulator/PrismProgramTraceSimulator.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "test/storm_gtest.h"
+
+TEST(PrismProgramTraceSimulatorTest, KnuthYaoDieTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::simulator::DiscreteTimePrismProgramTraceSimulator<double> sim(program, storm::generator::NextStateGeneratorOptions());
+    storm::expressions::Expression done = program.getLabelExpression("done");
+    storm::expressions::Expression one = program.getLabelExpression("one");
+
+    EXPECT_FALSE(sim.satisfies(done));
+    EXPECT_FALSE(sim.isCurrentStateAbsorbing());
+
+    uint64_t numberOfTraces = 60000;
+    uint64_t ones = 0;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        storm::utility::CounterBasedRandomGenerator generator(42, trace);
+        sim.resetToInitial();
+        while (!sim.satisfies(done)) {
+            ASSERT_TRUE(sim.step(generator));
+            EXPECT_TRUE(sim.hasLastStepChangedState());
+        }
+        if (sim.satisfies(one)) {
+            ++ones;
+        }
+    }
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(ones) / numberOfTraces, 0.01);
+
+    // Once the die is thrown, the only successor of a state is itself.
+    storm::utility::CounterBasedRandomGenerator generator(42, numberOfTraces);
+    EXPECT_TRUE(sim.step(generator));
+    EXPECT_FALSE(sim.hasLastStepChangedState());
+    EXPECT_TRUE(sim.isCurrentStateAbsorbing());
+}
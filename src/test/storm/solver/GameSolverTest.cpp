@@ -23,6 +23,31 @@ class DoubleViEnvironment {
     }
 };
 
+class DoubleParallelViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().game().setMethod(storm::solver::GameMethod::ValueIteration);
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+
+class DoubleIiEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().game().setMethod(storm::solver::GameMethod::IntervalIteration);
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoublePiEnvironment {
    public:
     typedef double ValueType;
@@ -68,7 +93,7 @@ class GameSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
+typedef ::testing::Types<DoubleViEnvironment, DoubleParallelViEnvironment, DoubleIiEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(GameSolverTest, TestingTypes, );
 
@@ -104,6 +129,9 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
 
     storm::solver::GameSolverFactory<ValueType> factory;
     auto solver = factory.create(this->env(), player1Matrix, player2Matrix);
+    // The game has no end components, so the solution is unique. The bounds are required for interval iteration.
+    solver->setHasUniqueSolution();
+    solver->setBounds(this->parseNumber("0"), this->parseNumber("1"));
 
     // Create solution and target state vector.
     std::vector<ValueType> result(4);
@@ -116,7 +144,6 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("0"), result[0], this->precision());
 
     result = std::vector<ValueType>(4);
-    solver->setBounds(this->parseNumber("0"), this->parseNumber("1"));
 
     solver->solveGame(this->env(), storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b);
     EXPECT_NEAR(this->parseNumber("0.5"), result[0], this->precision());
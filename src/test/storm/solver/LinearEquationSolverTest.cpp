@@ -373,4 +373,44 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
+
+TYPED_TEST(LinearEquationSolverTest, solveEquationSystemForMultipleRightHandSides) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1/5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("2/5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("2/5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/50")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("48/50")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/50")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("4/10")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("3/10")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    // The right-hand sides b, -b and 0 are stored interleaved.
+    std::vector<ValueType> b = {this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")};
+    std::vector<ValueType> B, X(9, this->parseNumber("0"));
+    for (auto const& value : b) {
+        B.push_back(value);
+        B.push_back(-value);
+        B.push_back(this->parseNumber("0"));
+    }
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        A.convertToEquationSystem();
+    }
+    auto solver = factory.create(this->env(), A);
+    solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), X, B, 3));
+    std::vector<ValueType> expected = {this->parseNumber("481/9"), this->parseNumber("457/9"), this->parseNumber("875/18")};
+    for (uint64_t row = 0; row < 3; ++row) {
+        EXPECT_NEAR(X[3 * row], expected[row], this->precision());
+        EXPECT_NEAR(X[3 * row + 1], -expected[row], this->precision());
+        EXPECT_NEAR(X[3 * row + 2], this->parseNumber("0"), this->precision());
+    }
+}
 }  // namespace
\ No newline at end of file
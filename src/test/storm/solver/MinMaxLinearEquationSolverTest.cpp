@@ -3,11 +3,17 @@
 
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/solver/ConvergenceTelemetry.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/TerminationCondition.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace {
@@ -37,6 +43,19 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoubleViMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMixedPrecision(true);
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -114,6 +133,43 @@ class DoublePIEnvironment {
         return env;
     }
 };
+class DoublePIBicgstabEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPolicyEvaluationMethod(storm::solver::PolicyEvaluationMethod::Bicgstab);
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+class DoubleModifiedPIEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPolicyEvaluationMethod(storm::solver::PolicyEvaluationMethod::ValueIterationSweeps);
+        env.solver().minMax().setNumberOfPolicyEvaluationSweeps(5);
+        return env;
+    }
+};
+class DoubleLPEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::LinearProgramming);
+        return env;
+    }
+};
+
 class RationalPIEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -135,6 +191,26 @@ class RationalRationalSearchEnvironment {
     }
 };
 
+class RationalViToPiEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ViToPi);
+        return env;
+    }
+};
+class RationalDefaultEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        // The solver picks a method that guarantees exact results.
+        return storm::Environment();
+    }
+};
+
 template<typename TestType>
 class MinMaxLinearEquationSolverTest : public ::testing::Test {
    public:
@@ -154,9 +230,10 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment,
-                         RationalPIEnvironment, RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleViMixedPrecisionEnvironment, DoubleSoundViEnvironment,
+                         DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment,
+                         DoublePIEnvironment, DoublePIBicgstabEnvironment, DoubleModifiedPIEnvironment, DoubleLPEnvironment, RationalPIEnvironment,
+                         RationalRationalSearchEnvironment, RationalViToPiEnvironment, RationalDefaultEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -188,4 +265,259 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(MultiThreadedMinMaxLinearEquationSolverTest, SolveLargeEquations) {
+    // A model whose matrix is large enough to be split into several blocks by the value iteration operator.
+    uint64_t const numberOfStates = 50000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(2 * state);
+        std::map<uint64_t, double> firstRow = {{(state + 1) % numberOfStates, 0.9}, {(state * 7) % numberOfStates, 0.05}};
+        std::map<uint64_t, double> secondRow = {{(state + numberOfStates / 2) % numberOfStates, 0.8}, {(state + numberOfStates - 1) % numberOfStates, 0.15}};
+        for (auto const& row : {firstRow, secondRow}) {
+            for (auto const& entry : row) {
+                builder.addNextValue(b.size(), entry.first, entry.second);
+            }
+            b.push_back(0.05 * ((state + b.size()) % 3));
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(2 * numberOfStates, numberOfStates, numberOfStates);
+
+    for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::OptimisticValueIteration,
+                        storm::solver::MinMaxMethod::SoundValueIteration, storm::solver::MinMaxMethod::IntervalIteration}) {
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<std::vector<double>> results;
+            for (uint64_t numberOfThreads : {1, 4}) {
+                storm::Environment env;
+                env.solver().minMax().setMethod(method);
+                env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+                env.solver().minMax().setRelativeTerminationCriterion(false);
+                env.solver().setNumberOfThreads(numberOfThreads);
+                if (method != storm::solver::MinMaxMethod::ValueIteration) {
+                    env.solver().setForceSoundness(true);
+                }
+                auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+                solver->setHasUniqueSolution(true);
+                solver->setHasNoEndComponents(true);
+                solver->setBounds(0.0, 20.0);
+                std::vector<double> x(numberOfStates);
+                ASSERT_NO_THROW(solver->solveEquations(env, dir, x, b));
+                results.push_back(std::move(x));
+            }
+            for (uint64_t state = 0; state < numberOfStates; state += 97) {
+                EXPECT_NEAR(results[0][state], results[1][state], 1e-6);
+            }
+        }
+    }
+}
+
+TEST(MultiThreadedMinMaxLinearEquationSolverTest, SolveWideAcyclicEquations) {
+    // A layered acyclic model whose layers are wide enough to be solved in parallel.
+    uint64_t const numberOfLayers = 20;
+    uint64_t const layerWidth = 1000;
+    uint64_t const numberOfStates = numberOfLayers * layerWidth;
+    for (bool successorsHaveLargerIndex : {true, false}) {
+        auto stateIndex = [&](uint64_t layer, uint64_t position) {
+            return (successorsHaveLargerIndex ? layer : numberOfLayers - 1 - layer) * layerWidth + position;
+        };
+        std::vector<std::map<uint64_t, double>> rows(2 * numberOfStates);
+        std::vector<double> b(2 * numberOfStates);
+        for (uint64_t layer = 0; layer < numberOfLayers; ++layer) {
+            for (uint64_t position = 0; position < layerWidth; ++position) {
+                uint64_t const row = 2 * stateIndex(layer, position);
+                if (layer + 1 < numberOfLayers) {
+                    rows[row][stateIndex(layer + 1, position)] += 0.5;
+                    rows[row][stateIndex(layer + 1, (position + 1) % layerWidth)] += 0.4;
+                    rows[row + 1][stateIndex(layer + 1, (position * 7) % layerWidth)] += 0.9;
+                }
+                b[row] = 0.1;
+                b[row + 1] = 0.03 * (position % 7);
+            }
+        }
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        for (uint64_t row = 0; row < rows.size(); ++row) {
+            if (row % 2 == 0) {
+                builder.newRowGroup(row);
+            }
+            for (auto const& entry : rows[row]) {
+                builder.addNextValue(row, entry.first, entry.second);
+            }
+        }
+        storm::storage::SparseMatrix<double> A = builder.build(2 * numberOfStates, numberOfStates, numberOfStates);
+
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<std::vector<double>> results;
+            std::vector<std::vector<uint64_t>> choices;
+            for (uint64_t numberOfThreads : {1, 4}) {
+                storm::Environment env;
+                env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Acyclic);
+                env.solver().setNumberOfThreads(numberOfThreads);
+                auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+                solver->setHasUniqueSolution(true);
+                solver->setHasNoEndComponents(true);
+                solver->setTrackScheduler(true);
+                solver->setCachingEnabled(true);
+                std::vector<double> x(numberOfStates);
+                // Solving twice reuses the cached depth levels.
+                ASSERT_NO_THROW(solver->solveEquations(env, dir, x, b));
+                ASSERT_NO_THROW(solver->solveEquations(env, dir, x, b));
+                results.push_back(std::move(x));
+                choices.push_back(solver->getSchedulerChoices());
+            }
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                EXPECT_NEAR(results[0][state], results[1][state], 1e-12);
+            }
+            EXPECT_EQ(choices[0], choices[1]);
+        }
+    }
+}
+
+#ifdef STORM_HAVE_CUDA
+TEST(GpuMinMaxLinearEquationSolverTest, SolveChainOfSccs) {
+    // A chain of SCCs, each of which has two states. The last SCC reaches the target.
+    uint64_t const numberOfSccs = 5000;
+    uint64_t const numberOfStates = 2 * numberOfSccs;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(2 * state);
+        uint64_t const partner = state ^ 1;
+        uint64_t const next = std::min(state + 2 - state % 2, numberOfStates - 1);
+        builder.addNextValue(b.size(), partner, 0.5);
+        builder.addNextValue(b.size(), next, 0.4);
+        b.push_back(0.1 * (state % 2));
+        builder.addNextValue(b.size(), partner, 0.3);
+        b.push_back(0.7 * (state % 3 == 0));
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(2 * numberOfStates, numberOfStates, numberOfStates);
+
+    for (bool sound : {false, true}) {
+        storm::Environment cpuEnv, gpuEnv;
+        for (auto env : {&cpuEnv, &gpuEnv}) {
+            env->solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env->solver().minMax().setRelativeTerminationCriterion(false);
+            env->solver().setForceSoundness(sound);
+        }
+        cpuEnv.solver().minMax().setMethod(sound ? storm::solver::MinMaxMethod::IntervalIteration : storm::solver::MinMaxMethod::ValueIteration);
+        gpuEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::Gpu);
+
+        // The GPU solver keeps the matrix on the device for both optimization directions.
+        auto cpuSolver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(cpuEnv, A);
+        auto gpuSolver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(gpuEnv, A);
+        gpuSolver->setCachingEnabled(true);
+        for (auto solver : {cpuSolver.get(), gpuSolver.get()}) {
+            solver->setHasUniqueSolution(true);
+            solver->setHasNoEndComponents(true);
+            solver->setBounds(0.0, 2.0);
+        }
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> cpuX(numberOfStates), gpuX(numberOfStates);
+            ASSERT_NO_THROW(cpuSolver->solveEquations(cpuEnv, dir, cpuX, b));
+            ASSERT_NO_THROW(gpuSolver->solveEquations(gpuEnv, dir, gpuX, b));
+            for (uint64_t state = 0; state < numberOfStates; state += 7) {
+                EXPECT_NEAR(cpuX[state], gpuX[state], 1e-6);
+            }
+        }
+    }
+}
+#endif
+
+TEST(MinMaxLinearEquationSolverTest, ConvergenceTelemetry) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+    std::vector<double> b = {0.099, 0.5};
+
+    std::vector<storm::solver::ConvergenceTelemetryRecord> records;
+    auto recordCallback = [&records](storm::solver::ConvergenceTelemetryRecord const& record) { records.push_back(record); };
+    auto telemetry = std::make_shared<storm::solver::ConvergenceTelemetry>(recordCallback, 10);
+
+    for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::IntervalIteration}) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+        env.solver().setConvergenceTelemetry(telemetry);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        std::vector<double> x(1);
+        records.clear();
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.99, x[0], 1e-6);
+
+        ASSERT_GE(records.size(), 2ull);
+        for (uint64_t i = 0; i < records.size(); ++i) {
+            EXPECT_EQ((i + 1) * 10, records[i].iteration);
+            EXPECT_FALSE(records[i].sccIndex.has_value());
+            ASSERT_TRUE(records[i].residual.has_value());
+            EXPECT_EQ(method == storm::solver::MinMaxMethod::IntervalIteration, records[i].boundGap.has_value());
+        }
+        // The distance to the fixpoint shrinks by a factor of 0.9 in each iteration.
+        EXPECT_NEAR(std::pow(0.9, 10), records[1].residual.value() / records[0].residual.value(), 1e-6);
+    }
+}
+
+TEST(MinMaxLinearEquationSolverTest, TerminateIfAllStatesDecided) {
+    storm::solver::TerminateIfAllStatesDecided<double> atLeastHalf(storm::storage::BitVector(2, true), storm::logic::ComparisonType::GreaterEqual, 0.5);
+    EXPECT_TRUE(atLeastHalf.isDecided(0.5, 0.7));
+    EXPECT_TRUE(atLeastHalf.isDecided(0.2, 0.4));
+    EXPECT_FALSE(atLeastHalf.isDecided(0.4, 0.5));
+    storm::solver::TerminateIfAllStatesDecided<double> belowHalf(storm::storage::BitVector(2, true), storm::logic::ComparisonType::Less, 0.5);
+    EXPECT_TRUE(belowHalf.isDecided(0.2, 0.4));
+    EXPECT_TRUE(belowHalf.isDecided(0.5, 0.7));
+    EXPECT_FALSE(belowHalf.isDecided(0.4, 0.5));
+    EXPECT_TRUE(atLeastHalf.terminateNow(std::vector<double>({0.5, 0.6}), storm::solver::SolverGuarantee::LessOrEqual));
+    EXPECT_FALSE(atLeastHalf.terminateNow(std::vector<double>({0.4, 0.6}), storm::solver::SolverGuarantee::LessOrEqual));
+    EXPECT_FALSE(atLeastHalf.terminateNow(std::vector<double>({0.5, 0.6}), storm::solver::SolverGuarantee::None));
+
+    uint64_t const numberOfStates = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(2 * state);
+        std::map<uint64_t, double> firstRow = {{(state + 1) % numberOfStates, 0.9}, {(state * 7) % numberOfStates, 0.05}};
+        std::map<uint64_t, double> secondRow = {{(state + numberOfStates / 2) % numberOfStates, 0.8}, {(state + numberOfStates - 1) % numberOfStates, 0.15}};
+        for (auto const& row : {firstRow, secondRow}) {
+            for (auto const& entry : row) {
+                builder.addNextValue(b.size(), entry.first, entry.second);
+            }
+            b.push_back(0.05 * ((state * state + b.size()) % 5));
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(2 * numberOfStates, numberOfStates, numberOfStates);
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+    env.solver().setForceSoundness(true);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    env.solver().minMax().setRelativeTerminationCriterion(false);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 20.0);
+        std::vector<double> reference(numberOfStates);
+        ASSERT_NO_THROW(solver->solveEquations(env, dir, reference, b));
+        std::vector<double> sorted = reference;
+        std::nth_element(sorted.begin(), sorted.begin() + numberOfStates / 2, sorted.end());
+        double const threshold = sorted[numberOfStates / 2];
+
+        for (auto comparisonType : {storm::logic::ComparisonType::GreaterEqual, storm::logic::ComparisonType::Less}) {
+            storm::storage::BitVector allStates(numberOfStates, true);
+            solver->setTerminationCondition(std::make_unique<storm::solver::TerminateIfAllStatesDecided<double>>(allStates, comparisonType, threshold));
+            std::vector<double> x(numberOfStates);
+            ASSERT_NO_THROW(solver->solveEquations(env, dir, x, b));
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (std::abs(reference[state] - threshold) > 1e-9) {
+                    EXPECT_EQ(reference[state] >= threshold, x[state] >= threshold) << "at state " << state;
+                }
+            }
+        }
+    }
+}
 }  // namespace
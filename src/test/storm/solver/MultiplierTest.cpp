@@ -19,6 +19,29 @@ class NativeEnvironment {
     }
 };
 
+class NativeCompactEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setUseCompactMatrix(true);
+        return env;
+    }
+};
+
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
 class GmmxxEnvironment {
    public:
     typedef double ValueType;
@@ -49,7 +72,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, NativeCompactEnvironment, SimdEnvironment, GmmxxEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -0,0 +1,98 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/OutOfCoreValueIterationSolver.h"
+#include "storm/storage/MappedSparseMatrix.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+class OutOfCoreValueIterationSolverTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        filename = (std::filesystem::temp_directory_path() / "storm-out-of-core-test.smb").string();
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().minMax().setRelativeTerminationCriterion(false);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(filename);
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<double>> exportModel(std::string const& drnFile) {
+        auto model = storm::parser::DirectEncodingParser<double>::parseModel(drnFile);
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::exportSparseModelAsBinary(stream, model);
+        return model;
+    }
+
+    std::string filename;
+    storm::Environment env;
+};
+
+}  // namespace
+
+TEST_F(OutOfCoreValueIterationSolverTest, DtmcReachability) {
+    auto model = exportModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    storm::storage::MappedSparseMatrix matrix(filename);
+    ASSERT_EQ(model->getNumberOfStates(), matrix.getRowGroupCount());
+    ASSERT_EQ(model->getNumberOfTransitions(), matrix.getEntryCount());
+    EXPECT_TRUE(matrix.hasTrivialRowGrouping());
+
+    // Use small blocks, such that the matrix is split into several blocks.
+    storm::solver::OutOfCoreValueIterationSolver solver(matrix, 1024);
+    storm::storage::BitVector const& targetStates = model->getStates("observe0Greater1");
+    solver.setFixedStates(targetStates);
+    std::vector<double> x(matrix.getRowGroupCount(), 0.0);
+    storm::utility::vector::setVectorValues(x, targetStates, 1.0);
+    std::vector<double> b(matrix.getRowCount(), 0.0);
+    EXPECT_GT(solver.getNumberOfBlocks(), 1ull);
+    ASSERT_TRUE(solver.solveEquations(env, x, b));
+    EXPECT_NEAR(0.3328800375801578281, x[*model->getInitialStates().begin()], 1e-6);
+}
+
+TEST_F(OutOfCoreValueIterationSolverTest, MdpReachabilityAndRewards) {
+    auto model = exportModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    storm::storage::MappedSparseMatrix matrix(filename);
+    ASSERT_EQ(model->getNumberOfStates(), matrix.getRowGroupCount());
+    ASSERT_EQ(model->getNumberOfChoices(), matrix.getRowCount());
+    EXPECT_FALSE(matrix.hasTrivialRowGrouping());
+    uint64_t initialState = *model->getInitialStates().begin();
+
+    storm::solver::OutOfCoreValueIterationSolver solver(matrix, 64);
+    storm::storage::BitVector const& targetStates = model->getStates("two");
+    solver.setFixedStates(targetStates);
+    std::vector<double> x(matrix.getRowGroupCount(), 0.0);
+    storm::utility::vector::setVectorValues(x, targetStates, 1.0);
+    std::vector<double> b(matrix.getRowCount(), 0.0);
+    ASSERT_TRUE(solver.solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(1.0 / 36.0, x[initialState], 1e-6);
+
+    std::fill(x.begin(), x.end(), 0.0);
+    storm::utility::vector::setVectorValues(x, targetStates, 1.0);
+    ASSERT_TRUE(solver.solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(1.0 / 36.0, x[initialState], 1e-6);
+
+    // The expected number of coin flips until both dice are done.
+    solver.setFixedStates(model->getStates("done"));
+    std::fill(x.begin(), x.end(), 0.0);
+    b = model->getRewardModel("coinflips").getStateActionRewardVector();
+    ASSERT_TRUE(solver.solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(22.0 / 3.0, x[initialState], 1e-6);
+
+    // Linear equation systems require a deterministic model.
+    STORM_SILENT_EXPECT_THROW(solver.solveEquations(env, x, b), storm::exceptions::InvalidArgumentException);
+}
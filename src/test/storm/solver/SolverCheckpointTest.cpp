@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverCheckpoint.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+std::string getCheckpointFilename() {
+    return (std::filesystem::temp_directory_path() / "storm-solver-checkpoint-test.chk").string();
+}
+
+storm::storage::SparseMatrix<double> buildMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    return builder.build(2);
+}
+
+storm::Environment createEnvironment(std::shared_ptr<storm::solver::SolverCheckpointing> const& checkpointing) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    env.solver().setCheckpointing(checkpointing);
+    return env;
+}
+
+std::vector<double> solve(storm::Environment const& env, storm::storage::SparseMatrix<double> const& A) {
+    std::vector<double> b = {0.099, 0.5};
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    std::vector<double> x(1);
+    solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b);
+    return x;
+}
+
+TEST(SolverCheckpointTest, ReadWrite) {
+    storm::solver::SolverCheckpoint checkpoint{"value iteration", 3, 42, {0.25, 1e-300, -7.0}};
+    storm::solver::SolverCheckpointing::writeToFile(checkpoint, getCheckpointFilename());
+    auto result = storm::solver::SolverCheckpointing::readFromFile(getCheckpointFilename());
+    EXPECT_EQ(checkpoint.method, result.method);
+    EXPECT_EQ(checkpoint.solveIndex, result.solveIndex);
+    EXPECT_EQ(checkpoint.iteration, result.iteration);
+    EXPECT_EQ(checkpoint.values, result.values);
+    std::filesystem::remove(getCheckpointFilename());
+}
+
+TEST(SolverCheckpointTest, CheckpointAndResume) {
+    auto A = buildMatrix();
+
+    // With an interval of zero seconds, a checkpoint is written in every iteration (unless the previous one is still being written).
+    auto checkpointing = std::make_shared<storm::solver::SolverCheckpointing>(getCheckpointFilename(), std::chrono::seconds(0), std::nullopt);
+    auto x = solve(createEnvironment(checkpointing), A);
+    EXPECT_NEAR(0.99, x[0], 1e-6);
+    checkpointing->waitForPendingWrite();
+    auto checkpoint = storm::solver::SolverCheckpointing::readFromFile(getCheckpointFilename());
+    EXPECT_EQ("value iteration", checkpoint.method);
+    EXPECT_EQ(0ull, checkpoint.solveIndex);
+    EXPECT_GT(checkpoint.iteration, 0ull);
+    ASSERT_EQ(1ull, checkpoint.values.size());
+    EXPECT_GE(checkpoint.values[0], 0.5);
+    EXPECT_LE(checkpoint.values[0], 0.99 + 1e-6);
+
+    // Five iterations do not suffice to converge from scratch, but they do when resuming from the (almost) converged iterate.
+    storm::solver::SolverCheckpointing::writeToFile(storm::solver::SolverCheckpoint{"value iteration", 1, 0, {0.99}}, getCheckpointFilename());
+    auto resuming = std::make_shared<storm::solver::SolverCheckpointing>(std::nullopt, std::chrono::seconds(0), getCheckpointFilename());
+    auto env = createEnvironment(resuming);
+    env.solver().minMax().setMaximalNumberOfIterations(5);
+    x = solve(env, A);
+    EXPECT_LT(x[0], 0.9);
+    x = solve(env, A);
+    EXPECT_NEAR(0.99, x[0], 1e-6);
+    // The checkpoint is only used once.
+    x = solve(env, A);
+    EXPECT_LT(x[0], 0.9);
+    std::filesystem::remove(getCheckpointFilename());
+}
+
+}  // namespace
@@ -0,0 +1,136 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <map>
+#include <thread>
+
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// A mergeable backend that assigns the result of the (single) row of each row group.
+class AssignBackend {
+   public:
+    void startNewIteration() {
+        // Intentionally left empty.
+    }
+
+    void firstRow(double&& value, uint64_t, uint64_t) {
+        current = value;
+    }
+
+    void applyUpdate(double& currentValue, uint64_t) {
+        currentValue = current;
+    }
+
+    void endOfIteration() const {
+        // Intentionally left empty.
+    }
+
+    bool converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+    void merge(AssignBackend const&) {
+        // Intentionally left empty.
+    }
+
+   private:
+    double current = 0.0;
+};
+
+// A matrix that is large enough to be split into several blocks, whose rows read values of other blocks. The row sums are 0.9.
+storm::storage::SparseMatrix<double> createMatrix(uint64_t numberOfStates) {
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::map<uint64_t, double> row = {{(state + 1) % numberOfStates, 0.5}, {(state + numberOfStates / 2) % numberOfStates, 0.4}};
+        for (auto const& entry : row) {
+            builder.addNextValue(state, entry.first, entry.second);
+        }
+    }
+    return builder.build();
+}
+
+std::vector<double> createOffsets(uint64_t numberOfStates) {
+    std::vector<double> offsets(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        offsets[state] = 0.1 * (state % 3);
+    }
+    return offsets;
+}
+
+}  // namespace
+
+TEST(ValueIterationOperatorTest, ConcurrentParallelInPlaceApplications) {
+    uint64_t const numberOfStates = 50000;
+    storm::storage::SparseMatrix<double> matrix = createMatrix(numberOfStates);
+    std::vector<double> offsets = createOffsets(numberOfStates);
+
+    storm::solver::helper::ValueIterationOperator<double, true> viOperator;
+    viOperator.setMatrixBackwards(matrix);
+    viOperator.setNumberOfThreads(4);
+
+    uint64_t const numberOfIterations = 20;
+    auto iterate = [&](std::vector<double>& operand) {
+        AssignBackend backend;
+        for (uint64_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+            viOperator.applyInPlace(operand, offsets, backend);
+        }
+    };
+
+    // The results of each application do not depend on the scheduling of the blocks, so applying the operator to both operands one
+    // after the other yields the reference for the concurrent applications.
+    std::vector<double> expectedLower(numberOfStates, 0.0);
+    std::vector<double> expectedUpper(numberOfStates, 1.0);
+    iterate(expectedLower);
+    iterate(expectedUpper);
+
+    std::vector<double> lower(numberOfStates, 0.0);
+    std::vector<double> upper(numberOfStates, 1.0);
+    std::thread lowerThread([&]() { iterate(lower); });
+    std::thread upperThread([&]() { iterate(upper); });
+    lowerThread.join();
+    upperThread.join();
+
+    EXPECT_EQ(expectedLower, lower);
+    EXPECT_EQ(expectedUpper, upper);
+}
+
+TEST(ValueIterationOperatorTest, ParallelInPlaceAndOutOfPlaceApplications) {
+    uint64_t const numberOfStates = 50000;
+    storm::storage::SparseMatrix<double> matrix = createMatrix(numberOfStates);
+    std::vector<double> offsets = createOffsets(numberOfStates);
+
+    for (bool backwards : {true, false}) {
+        storm::solver::helper::ValueIterationOperator<double, true> viOperator;
+        if (backwards) {
+            viOperator.setMatrixBackwards(matrix);
+        } else {
+            viOperator.setMatrixForwards(matrix);
+        }
+        viOperator.setNumberOfThreads(4);
+
+        // As the matrix is contracting, both variants converge to the fixpoint up to the precision of the comparison.
+        uint64_t const numberOfIterations = 400;
+        AssignBackend backend;
+        std::vector<double> inPlace(numberOfStates, 0.0);
+        for (uint64_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+            viOperator.applyInPlace(inPlace, offsets, backend);
+        }
+        std::vector<double> outOfPlace(numberOfStates, 0.0);
+        std::vector<double> next(numberOfStates);
+        for (uint64_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+            viOperator.apply(outOfPlace, next, offsets, backend);
+            std::swap(outOfPlace, next);
+        }
+
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            ASSERT_NEAR(outOfPlace[state], inPlace[state], 1e-10) << "state " << state << (backwards ? " (backwards)" : " (forwards)");
+        }
+    }
+}
@@ -67,3 +67,40 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, IncrementalResizing) {
+    storm::storage::BitVectorHashMap<uint64_t> map(64, 3);
+
+    bool resized = false;
+    uint64_t const numberOfKeys = 10000;
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        storm::storage::BitVector key(64);
+        key.setFromInt(0, 64, index * 7919);
+        EXPECT_EQ(index, map.findOrAdd(key, index));
+        resized |= map.isResizing();
+
+        // While the entries are migrated, all keys are found in either storage (and iterating visits every entry once).
+        if (map.isResizing() && index % 97 == 0) {
+            for (uint64_t previousIndex = 0; previousIndex <= index; ++previousIndex) {
+                storm::storage::BitVector previousKey(64);
+                previousKey.setFromInt(0, 64, previousIndex * 7919);
+                ASSERT_EQ(previousIndex, map.getValue(previousKey));
+            }
+            uint64_t numberOfEntries = 0;
+            for (auto const& keyValuePair : map) {
+                EXPECT_EQ(keyValuePair.first.getAsInt(0, 64), keyValuePair.second * 7919);
+                ++numberOfEntries;
+            }
+            EXPECT_EQ(index + 1, numberOfEntries);
+        }
+    }
+    EXPECT_TRUE(resized);
+    EXPECT_EQ(numberOfKeys, map.size());
+
+    map.remap([](uint64_t const& value) { return value + 1; });
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        storm::storage::BitVector key(64);
+        key.setFromInt(0, 64, index * 7919);
+        EXPECT_EQ(index + 1, map.getValue(key));
+    }
+}
@@ -601,3 +601,21 @@ TEST(BitVectorTest, Assignment) {
     v1.set(9999);
     ASSERT_TRUE(v1.get(9999));
 }
+
+TEST(BitVectorTest, GetSetIndices) {
+    // The lengths cover vectors below, at and above the size for which the bulk operations are vectorized.
+    for (uint64_t length : {0ull, 1ull, 64ull, 65ull, 600ull, 5001ull}) {
+        storm::storage::BitVector vector(length);
+        for (uint64_t index = 0; index < length; ++index) {
+            vector.set(index, (index * 7) % 5 < 2);
+        }
+        std::vector<uint64_t> expected(vector.begin(), vector.end());
+        EXPECT_EQ(expected, vector.getSetIndices());
+
+        storm::storage::BitVector complement = ~vector;
+        EXPECT_EQ(length - expected.size(), complement.getNumberOfSetBits());
+        EXPECT_EQ(length, (vector | complement).getNumberOfSetBits());
+        EXPECT_EQ(0ull, (vector & complement).getNumberOfSetBits());
+        EXPECT_EQ(vector | complement, vector ^ complement);
+    }
+}
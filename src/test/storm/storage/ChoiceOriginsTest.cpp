@@ -0,0 +1,42 @@
+#include "storm-config.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/storage/sparse/PrismChoiceOrigins.h"
+
+TEST(ChoiceOriginsTest, PackedIdentifiers) {
+    auto program =
+        std::make_shared<storm::prism::Program const>(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_selection.nm"));
+    std::vector<storm::storage::sparse::PrismChoiceOrigins::CommandSet> identifierToCommandSet(5);
+    for (uint64_t identifier = 1; identifier < identifierToCommandSet.size(); ++identifier) {
+        identifierToCommandSet[identifier].insert(identifier - 1);
+    }
+    std::vector<uint_fast64_t> indexToIdentifier = {1, 4, 4, 0, 2, 1, 3};
+    storm::storage::sparse::PrismChoiceOrigins origins(program, indexToIdentifier, identifierToCommandSet);
+
+    EXPECT_EQ(7ull, origins.getNumberOfChoices());
+    EXPECT_EQ(5ull, origins.getNumberOfIdentifiers());
+    // Three bits suffice for the largest identifier.
+    EXPECT_EQ(3ull, origins.getSizeOfIdentifierMappingInBytes());
+    for (uint64_t choice = 0; choice < indexToIdentifier.size(); ++choice) {
+        EXPECT_EQ(indexToIdentifier[choice], origins.getIdentifier(choice));
+    }
+    EXPECT_EQ(identifierToCommandSet[4], origins.getCommandSet(2));
+
+    storm::models::sparse::ChoiceLabeling labeling = origins.toChoiceLabeling();
+    for (uint64_t choice = 0; choice < indexToIdentifier.size(); ++choice) {
+        EXPECT_TRUE(labeling.getChoices(origins.getChoiceInfo(choice)).get(choice));
+    }
+    EXPECT_EQ(2ull, labeling.getChoices(origins.getIdentifierInfo(4)).getNumberOfSetBits());
+
+    auto selected = origins.selectChoices(std::vector<uint_fast64_t>({6, 1, 100}));
+    EXPECT_EQ(3ull, selected->getNumberOfChoices());
+    EXPECT_EQ(3ull, selected->getIdentifier(0));
+    EXPECT_EQ(4ull, selected->getIdentifier(1));
+    EXPECT_EQ(storm::storage::sparse::ChoiceOrigins::getIdentifierForChoicesWithNoOrigin(), selected->getIdentifier(2));
+
+    origins.clearOriginOfChoice(1);
+    EXPECT_EQ(storm::storage::sparse::ChoiceOrigins::getIdentifierForChoicesWithNoOrigin(), origins.getIdentifier(1));
+    EXPECT_EQ(4ull, origins.getIdentifier(2));
+}
@@ -0,0 +1,108 @@
+#include "test/storm_gtest.h"
+
+#include <vector>
+
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Creates a matrix with 'numberOfGroups' row groups of two or three rows each and (pseudo-random) entries.
+storm::storage::SparseMatrix<double> createMatrix(uint64_t numberOfGroups) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2 + group % 2; ++choice, ++row) {
+            uint64_t firstColumn = (group * 7 + choice * 3) % numberOfGroups;
+            uint64_t secondColumn = (firstColumn + 1 + choice) % numberOfGroups;
+            if (firstColumn > secondColumn) {
+                std::swap(firstColumn, secondColumn);
+            }
+            double const probability = 0.1 + 0.2 * choice;
+            builder.addNextValue(row, firstColumn, probability);
+            builder.addNextValue(row, secondColumn, 1.0 - probability);
+        }
+    }
+    return builder.build();
+}
+
+}  // namespace
+
+TEST(CompactSparseMatrix, Creation) {
+    auto matrix = createMatrix(10);
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix);
+    EXPECT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    EXPECT_EQ(matrix.getRowGroupCount(), compactMatrix.getRowGroupCount());
+    EXPECT_EQ(matrix.getRowGroupIndices(), compactMatrix.getRowGroupIndices());
+    EXPECT_FALSE(compactMatrix.hasTrivialRowGrouping());
+    EXPECT_TRUE((storm::storage::CompactSparseMatrix<double, uint32_t>::canRepresent(matrix)));
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto entryIndex = compactMatrix.getRowIndications()[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), compactMatrix.getColumns()[entryIndex]);
+            EXPECT_EQ(entry.getValue(), compactMatrix.getValues()[entryIndex]);
+            ++entryIndex;
+        }
+        EXPECT_EQ(compactMatrix.getRowIndications()[row + 1], entryIndex);
+    }
+}
+
+TEST(CompactSparseMatrix, Multiplication) {
+    auto matrix = createMatrix(100);
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix);
+
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>(i % 13) / 13.0;
+    }
+    std::vector<double> b(matrix.getRowCount(), 0.25);
+
+    std::vector<double> expected(matrix.getRowCount()), result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_EQ(matrix.multiplyRowWithVector(row, x), compactMatrix.multiplyRowWithVector(row, x));
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    auto matrix = createMatrix(100);
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix);
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>(i % 17) / 17.0;
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<double>(i % 5) / 10.0;
+    }
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount()), result(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0), resultChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expected, &expectedChoices);
+        compactMatrix.multiplyAndReduceForward(dir, rowGroupIndices, x, &b, result, &resultChoices);
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, resultChoices);
+
+        // Gauss-Seidel style multiplications where input and output are aliased.
+        for (bool backward : {false, true}) {
+            std::vector<double> expectedInPlace(x), resultInPlace(x);
+            if (backward) {
+                matrix.multiplyAndReduceBackward(dir, rowGroupIndices, expectedInPlace, &b, expectedInPlace, nullptr);
+                compactMatrix.multiplyAndReduceBackward(dir, rowGroupIndices, resultInPlace, &b, resultInPlace, nullptr);
+            } else {
+                matrix.multiplyAndReduceForward(dir, rowGroupIndices, expectedInPlace, &b, expectedInPlace, nullptr);
+                compactMatrix.multiplyAndReduceForward(dir, rowGroupIndices, resultInPlace, &b, resultInPlace, nullptr);
+            }
+            EXPECT_EQ(expectedInPlace, resultInPlace);
+        }
+    }
+}
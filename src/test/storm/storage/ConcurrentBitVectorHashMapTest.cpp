@@ -0,0 +1,149 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+
+std::vector<storm::storage::BitVector> createKeys(uint64_t numberOfKeys, uint64_t bucketSize) {
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(numberOfKeys);
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        storm::storage::BitVector key(bucketSize);
+        key.setFromInt(0, 64, i * 7919 + 13);
+        key.setFromInt(64, 64, i);
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3, 0.75, 4);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(std::make_pair(static_cast<uint64_t>(1), true), map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    EXPECT_EQ(std::make_pair(static_cast<uint64_t>(2), true), map.findOrAdd(second, 2));
+
+    EXPECT_EQ(std::make_pair(static_cast<uint64_t>(1), false), map.findOrAdd(first, 3));
+    EXPECT_EQ(std::make_pair(static_cast<uint64_t>(2), false), map.findOrAdd(second, 3));
+    EXPECT_EQ(2ul, map.size());
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_FALSE(map.contains(third));
+    EXPECT_FALSE(static_cast<bool>(map.find(third)));
+    EXPECT_EQ(2ul, map.find(second).get());
+
+    // The generator must only be invoked for new keys.
+    uint64_t invocations = 0;
+    std::function<uint64_t()> generator = [&invocations]() { return 10 + invocations++; };
+    EXPECT_EQ(std::make_pair(static_cast<uint64_t>(10), true), map.findOrAdd(third, generator));
+    EXPECT_EQ(std::make_pair(static_cast<uint64_t>(10), false), map.findOrAdd(third, generator));
+    EXPECT_EQ(1ul, invocations);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Resize) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 1, 0.75, 2);
+    auto keys = createKeys(100000, 128);
+    uint64_t initialCapacity = map.capacity();
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        EXPECT_TRUE(map.findOrAdd(keys[i], i).second);
+    }
+    EXPECT_LT(initialCapacity, map.capacity());
+    EXPECT_EQ(keys.size(), map.size());
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(i, map.find(keys[i]).get());
+    }
+
+    auto sequentialMap = map.toBitVectorHashMap();
+    EXPECT_EQ(keys.size(), sequentialMap.size());
+    for (uint64_t i = 0; i < keys.size(); i += 97) {
+        EXPECT_EQ(i, sequentialMap.getValue(keys[i]));
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    uint64_t const numberOfThreads = 8;
+    auto keys = createKeys(50000, 128);
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16, 0.75, 4);
+
+    // All threads insert all keys (in different orders) and draw the values for new keys from one counter.
+    std::atomic<uint64_t> nextValue(0);
+    std::function<uint64_t()> generator = [&nextValue]() { return nextValue++; };
+    std::vector<std::vector<uint64_t>> results(numberOfThreads, std::vector<uint64_t>(keys.size()));
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            std::vector<uint64_t> order(keys.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), std::mt19937(thread));
+            for (auto index : order) {
+                results[thread][index] = map.findOrAdd(keys[index], generator).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(keys.size(), map.size());
+    EXPECT_EQ(keys.size(), nextValue.load());
+    std::vector<bool> valueSeen(keys.size(), false);
+    for (uint64_t index = 0; index < keys.size(); ++index) {
+        uint64_t value = results[0][index];
+        ASSERT_LT(value, keys.size());
+        EXPECT_FALSE(valueSeen[value]);
+        valueSeen[value] = true;
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            ASSERT_EQ(value, results[thread][index]);
+        }
+        EXPECT_EQ(value, map.find(keys[index]).get());
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, RepeatedRequests) {
+    uint64_t const numberOfKeys = 200000;
+    uint64_t const bucketSize = 128;
+    auto keys = createKeys(numberOfKeys, bucketSize);
+
+    for (uint64_t numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads *= 2) {
+        // Every key is requested twice (by different threads) to mimic the repeated discovery of states.
+        storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(bucketSize);
+        std::vector<std::thread> threads;
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            threads.emplace_back([&, thread]() {
+                for (uint64_t i = thread; i < 2 * numberOfKeys; i += numberOfThreads) {
+                    map.findOrAdd(keys[i % numberOfKeys], i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // Each key keeps the value of one of its two requests.
+        ASSERT_EQ(numberOfKeys, map.size()) << numberOfThreads << " threads";
+        for (uint64_t index = 0; index < numberOfKeys; ++index) {
+            auto value = map.find(keys[index]);
+            ASSERT_TRUE(static_cast<bool>(value)) << numberOfThreads << " threads";
+            EXPECT_EQ(index, value.get() % numberOfKeys) << numberOfThreads << " threads";
+        }
+    }
+}
@@ -1,8 +1,10 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/bisimulation.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/AcyclicStateLumping.h"
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "test/storm_gtest.h"
 
@@ -126,3 +128,122 @@ TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     EXPECT_EQ(65ul, result->getNumberOfStates());
     EXPECT_EQ(105ul, result->getNumberOfTransitions());
 }
+
+TEST(DeterministicModelBisimulationDecomposition, CrowdsParallel) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+    options.numberOfThreads = 4;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(*dtmc, options);
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(334ul, result->getNumberOfStates());
+    EXPECT_EQ(546ul, result->getNumberOfTransitions());
+
+    options.respectedAtomicPropositions = std::set<std::string>({"observe0Greater1"});
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim2(*dtmc, options);
+    ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim2.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(65ul, result->getNumberOfStates());
+    EXPECT_EQ(105ul, result->getNumberOfTransitions());
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options3(*dtmc, *formula);
+    options3.numberOfThreads = 4;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim3(*dtmc, options3);
+    ASSERT_NO_THROW(bisim3.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim3.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(64ul, result->getNumberOfStates());
+    EXPECT_EQ(104ul, result->getNumberOfTransitions());
+}
+
+TEST(DeterministicModelBisimulationDecomposition, LumpAcyclicStates) {
+    // State 0 moves to the states 1 and 2, which both move to the absorbing goal state 3.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 3, 1.0);
+    builder.addNextValue(2, 3, 1.0);
+    builder.addNextValue(3, 3, 1.0);
+    storm::models::sparse::StateLabeling labeling(4);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("goal");
+    labeling.addLabelToState("goal", 3);
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), labeling);
+
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> result;
+    ASSERT_NO_THROW(result = storm::storage::lumpAcyclicStates(dtmc));
+    EXPECT_EQ(3ul, result->getNumberOfStates());
+    EXPECT_EQ(3ul, result->getNumberOfTransitions());
+    EXPECT_EQ(1ul, result->getInitialStates().getNumberOfSetBits());
+    EXPECT_EQ(1ul, result->getStates("goal").getNumberOfSetBits());
+
+    // Different rewards prevent the lumping of the states 1 and 2.
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("", storm::models::sparse::StandardRewardModel<double>(std::vector<double>({0.0, 1.0, 2.0, 0.0})));
+    storm::models::sparse::Dtmc<double> dtmcWithRewards(dtmc.getTransitionMatrix(), labeling, rewardModels);
+    ASSERT_NO_THROW(result = storm::storage::lumpAcyclicStates(dtmcWithRewards));
+    EXPECT_EQ(4ul, result->getNumberOfStates());
+
+    // The die has cycles, but lumping its acyclic states first must not change the result of the bisimulation.
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    ASSERT_NO_THROW(result = storm::storage::lumpAcyclicStates(*abstractModel->as<storm::models::sparse::Dtmc<double>>()));
+    EXPECT_EQ(13ul, result->getNumberOfStates());
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+    options.respectedAtomicPropositions = std::set<std::string>({"one"});
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(*result, options);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Model<double>> quotient;
+    ASSERT_NO_THROW(quotient = bisim.getQuotient());
+    EXPECT_EQ(5ul, quotient->getNumberOfStates());
+    EXPECT_EQ(8ul, quotient->getNumberOfTransitions());
+}
+
+TEST(DeterministicModelBisimulationDecomposition, PartitionCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> firstBatch = {formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]"),
+                                                                             formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]")};
+    std::vector<std::shared_ptr<storm::logic::Formula const>> secondBatch = firstBatch;
+    secondBatch.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"three\"]"));
+
+    storm::storage::bisimulation::SparsePartitionCache cache;
+    std::shared_ptr<storm::models::sparse::Model<double>> first, second;
+    ASSERT_NO_THROW(first = storm::api::performBisimulationMinimization<double>(model, firstBatch, storm::storage::BisimulationType::Strong, &cache));
+    EXPECT_EQ(1ul, cache.size());
+
+    // The second batch starts from the partition of the first one and must yield the same quotient as without the cache.
+    ASSERT_NO_THROW(second = storm::api::performBisimulationMinimization<double>(model, secondBatch, storm::storage::BisimulationType::Strong, &cache));
+    EXPECT_EQ(2ul, cache.size());
+    std::shared_ptr<storm::models::sparse::Model<double>> reference = storm::api::performBisimulationMinimization<double>(model, secondBatch);
+    EXPECT_EQ(reference->getNumberOfStates(), second->getNumberOfStates());
+    EXPECT_EQ(reference->getNumberOfTransitions(), second->getNumberOfTransitions());
+    EXPECT_LT(first->getNumberOfStates(), second->getNumberOfStates());
+
+    // Repeating a batch reuses (and replaces) its partition.
+    ASSERT_NO_THROW(second = storm::api::performBisimulationMinimization<double>(model, firstBatch, storm::storage::BisimulationType::Strong, &cache));
+    EXPECT_EQ(2ul, cache.size());
+    EXPECT_EQ(first->getNumberOfStates(), second->getNumberOfStates());
+    EXPECT_EQ(first->getNumberOfTransitions(), second->getNumberOfTransitions());
+}
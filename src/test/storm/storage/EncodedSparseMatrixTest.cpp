@@ -0,0 +1,109 @@
+#include "test/storm_gtest.h"
+
+#include <vector>
+
+#include "storm/storage/EncodedSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Creates a matrix with 'numberOfGroups' row groups of two or three rows each. The rows use 'numberOfValues' different probabilities.
+storm::storage::SparseMatrix<double> createMatrix(uint64_t numberOfGroups, uint64_t numberOfValues) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2 + group % 2; ++choice, ++row) {
+            // Some columns are far apart such that they need more than one byte.
+            uint64_t firstColumn = (group * 7 + choice * 3) % numberOfGroups;
+            uint64_t secondColumn = (firstColumn + 1 + choice * 499) % numberOfGroups;
+            if (firstColumn > secondColumn) {
+                std::swap(firstColumn, secondColumn);
+            }
+            double const probability = static_cast<double>(1 + row % numberOfValues) / static_cast<double>(numberOfValues + 1);
+            builder.addNextValue(row, firstColumn, probability);
+            if (firstColumn != secondColumn) {
+                builder.addNextValue(row, secondColumn, 1.0 - probability);
+            }
+        }
+    }
+    return builder.build();
+}
+
+void checkEncodedMatrix(storm::storage::SparseMatrix<double> const& matrix, storm::storage::EncodedSparseMatrix const& encodedMatrix) {
+    EXPECT_EQ(matrix.getRowCount(), encodedMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), encodedMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), encodedMatrix.getEntryCount());
+    EXPECT_EQ(matrix.getRowGroupIndices(), encodedMatrix.getRowGroupIndices());
+
+    // The decoded entries coincide with the original ones.
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto encodedRow = encodedMatrix.getRow(row);
+        auto encodedIt = encodedRow.begin();
+        for (auto const& entry : matrix.getRow(row)) {
+            ASSERT_TRUE(encodedIt != encodedRow.end());
+            EXPECT_EQ(entry.getColumn(), encodedIt.getColumn());
+            EXPECT_EQ(entry.getValue(), encodedIt.getValue());
+            ++encodedIt;
+        }
+        EXPECT_TRUE(encodedIt == encodedRow.end());
+    }
+
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>(i % 17) / 17.0;
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<double>(i % 5) / 10.0;
+    }
+
+    std::vector<double> expected(matrix.getRowCount()), result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    encodedMatrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_EQ(matrix.multiplyRowWithVector(row, x), encodedMatrix.multiplyRowWithVector(row, x));
+    }
+
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount()), resultReduced(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0), resultChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, expectedReduced, &expectedChoices);
+        encodedMatrix.multiplyAndReduceForward(dir, rowGroupIndices, x, &b, resultReduced, &resultChoices);
+        EXPECT_EQ(expectedReduced, resultReduced);
+        EXPECT_EQ(expectedChoices, resultChoices);
+
+        // Gauss-Seidel style multiplications where input and output are aliased.
+        std::vector<double> expectedInPlace(x), resultInPlace(x);
+        matrix.multiplyAndReduceBackward(dir, rowGroupIndices, expectedInPlace, &b, expectedInPlace, nullptr);
+        encodedMatrix.multiplyAndReduceBackward(dir, rowGroupIndices, resultInPlace, &b, resultInPlace, nullptr);
+        EXPECT_EQ(expectedInPlace, resultInPlace);
+    }
+}
+
+}  // namespace
+
+TEST(EncodedSparseMatrix, SmallDictionary) {
+    auto matrix = createMatrix(1000, 5);
+    storm::storage::EncodedSparseMatrix encodedMatrix(matrix);
+    EXPECT_EQ(storm::storage::EncodedSparseMatrix::ValueEncoding::Dictionary8, encodedMatrix.getValueEncoding());
+    // The columns take at most two bytes and the values take one byte each.
+    EXPECT_LT(encodedMatrix.getSizeInBytes() * 2, matrix.getEntryCount() * 16 + (matrix.getRowCount() + 1) * 8);
+    checkEncodedMatrix(matrix, encodedMatrix);
+}
+
+TEST(EncodedSparseMatrix, LargeDictionary) {
+    auto matrix = createMatrix(1000, 1000);
+    storm::storage::EncodedSparseMatrix encodedMatrix(matrix);
+    EXPECT_EQ(storm::storage::EncodedSparseMatrix::ValueEncoding::Dictionary16, encodedMatrix.getValueEncoding());
+    checkEncodedMatrix(matrix, encodedMatrix);
+}
+
+TEST(EncodedSparseMatrix, PlainValues) {
+    auto matrix = createMatrix(1000, 5);
+    storm::storage::EncodedSparseMatrix encodedMatrix(matrix, false);
+    EXPECT_EQ(storm::storage::EncodedSparseMatrix::ValueEncoding::Plain, encodedMatrix.getValueEncoding());
+    checkEncodedMatrix(matrix, encodedMatrix);
+}
@@ -3,7 +3,10 @@
 
 #include "storm-parsers/parser/ValueParser.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/BatchExpressionEvaluator.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -343,6 +346,91 @@ TEST(Expression, SimplificationTest) {
     EXPECT_TRUE(simplifiedExpression.isFalse());
 }
 
+TEST(Expression, HashConsingTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    manager->setHashConsing(true);
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+
+    // Syntactically equal expressions that are built independently share their nodes.
+    storm::expressions::Expression first = (x.getExpression() + y.getExpression()) * manager->integer(2) > manager->integer(3);
+    storm::expressions::Expression second = (x.getExpression() + y.getExpression()) * manager->integer(2) > manager->integer(3);
+    EXPECT_EQ(first.getBaseExpressionPointer(), second.getBaseExpressionPointer());
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+
+    storm::expressions::Expression third = (y.getExpression() + x.getExpression()) * manager->integer(2) > manager->integer(3);
+    EXPECT_NE(first.getBaseExpressionPointer(), third.getBaseExpressionPointer());
+    EXPECT_FALSE(first.isSyntacticallyEqual(third));
+
+    // Simplifications are hash-consed and cached.
+    storm::expressions::Expression fourth = manager->boolean(true) || first;
+    EXPECT_TRUE(fourth.simplify().isTrue());
+    EXPECT_EQ(fourth.simplify().getBaseExpressionPointer(), fourth.simplify().getBaseExpressionPointer());
+    EXPECT_EQ(manager->boolean(true).getBaseExpressionPointer(), fourth.simplify().getBaseExpressionPointer());
+
+    // Disabling hash-consing releases the unique nodes, but keeps the existing expressions intact.
+    EXPECT_LT(0ull, manager->getNumberOfUniqueExpressions());
+    manager->setHashConsing(false);
+    EXPECT_EQ(0ull, manager->getNumberOfUniqueExpressions());
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+    storm::expressions::Expression fifth = x.getExpression() + y.getExpression();
+    EXPECT_NE(first.getOperand(0).getOperand(0).getBaseExpressionPointer(), fifth.getBaseExpressionPointer());
+}
+
+TEST(Expression, BatchEvaluationTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+
+    // The subexpression y + 1 occurs twice, but is only computed once.
+    storm::expressions::Expression yPlusOne = y.getExpression() + manager->integer(1);
+    storm::expressions::Expression numerical =
+        storm::expressions::ite(x.getExpression(), yPlusOne * z.getExpression(), storm::expressions::minimum(yPlusOne, -z.getExpression()));
+    storm::expressions::Expression boolean = (numerical >= manager->integer(2) && !x.getExpression()) || y.getExpression() == manager->integer(5);
+    ASSERT_TRUE(storm::expressions::BatchExpressionEvaluator::isSupported(numerical));
+    ASSERT_TRUE(storm::expressions::BatchExpressionEvaluator::isSupported(boolean));
+
+    storm::expressions::BatchExpressionEvaluator numericalEvaluator(numerical);
+    storm::expressions::BatchExpressionEvaluator booleanEvaluator(boolean);
+    ASSERT_EQ(3ull, numericalEvaluator.getVariables().size());
+    ASSERT_EQ(3ull, booleanEvaluator.getVariables().size());
+
+    // Use more valuations than fit into one block.
+    uint64_t const numberOfValuations = 1000;
+    std::map<storm::expressions::Variable, std::vector<double>> values;
+    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+        values[x].push_back(valuation % 3 == 0 ? 1.0 : 0.0);
+        values[y].push_back(static_cast<double>(valuation % 11));
+        values[z].push_back(static_cast<double>(valuation % 7) / 2.0 - 1.0);
+    }
+    auto getColumns = [&values](storm::expressions::BatchExpressionEvaluator const& evaluator) {
+        std::vector<double const*> columns;
+        for (auto const& variable : evaluator.getVariables()) {
+            columns.push_back(values[variable].data());
+        }
+        return columns;
+    };
+
+    std::vector<double> numericalResult(numberOfValuations);
+    storm::storage::BitVector booleanResult(numberOfValuations + 1);
+    numericalEvaluator.evaluate(numberOfValuations, getColumns(numericalEvaluator), numericalResult.data());
+    booleanEvaluator.evaluateAsBool(numberOfValuations, getColumns(booleanEvaluator), booleanResult, 1);
+    EXPECT_FALSE(booleanResult.get(0));
+
+    storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+        evaluator.setBooleanValue(x, values[x][valuation] == 1.0);
+        evaluator.setIntegerValue(y, static_cast<int64_t>(values[y][valuation]));
+        evaluator.setRationalValue(z, values[z][valuation]);
+        EXPECT_EQ(evaluator.asRational(numerical), numericalResult[valuation]);
+        EXPECT_EQ(evaluator.asBool(boolean), booleanResult.get(valuation + 1));
+    }
+
+    // The wrong number of columns is rejected.
+    EXPECT_THROW(numericalEvaluator.evaluate(numberOfValuations, {}, numericalResult.data()), storm::exceptions::InvalidArgumentException);
+}
+
 TEST(Expression, SimpleEvaluationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -5,6 +5,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/FlatMaximalEndComponentDecomposition.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "test/storm_gtest.h"
@@ -179,3 +180,84 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, RemoveChoices) {
+    std::string prismModelPath = STORM_TEST_RESOURCES_DIR "/mdp/prism-mec-example2.nm";
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(prismModelPath);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(*mdp);
+    ASSERT_EQ(2ull, mecDecomposition.size());
+
+    // Removing the only choice of state 1 splits the MEC {0, 1}, whereas the MEC {2} is kept.
+    storm::storage::BitVector removedChoices(mdp->getNumberOfChoices(), false);
+    removedChoices.set(3);
+    mecDecomposition.removeChoices(mdp->getTransitionMatrix(), mdp->getBackwardTransitions(), removedChoices);
+
+    EXPECT_EQ(2ull, mecDecomposition.size());
+
+    ASSERT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{2});
+    EXPECT_TRUE(mecDecomposition[0].getChoicesForState(2) == storm::storage::MaximalEndComponent::set_type{4});
+
+    ASSERT_TRUE(mecDecomposition[1].getStateSet() == storm::storage::MaximalEndComponent::set_type{0});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0});
+
+    // The result coincides with the decomposition of the reduced subsystem.
+    storm::storage::MaximalEndComponentDecomposition<double> reducedDecomposition(mdp->getTransitionMatrix(), mdp->getBackwardTransitions(),
+                                                                                  storm::storage::BitVector(mdp->getNumberOfStates(), true), ~removedChoices);
+    EXPECT_EQ(reducedDecomposition.size(), mecDecomposition.size());
+}
+
+TEST(MaximalEndComponentDecomposition, Flat) {
+    std::string prismModelPath = STORM_TEST_RESOURCES_DIR "/mdp/prism-mec-example2.nm";
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(prismModelPath);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(*mdp);
+    storm::storage::FlatMaximalEndComponentDecomposition flatDecomposition(mdp->getTransitionMatrix(), mdp->getBackwardTransitions());
+    ASSERT_EQ(mecDecomposition.size(), flatDecomposition.size());
+
+    // Both decompositions find the MECs in the same order.
+    uint_fast64_t numberOfStates = 0;
+    uint_fast64_t numberOfChoices = 0;
+    for (uint_fast64_t mecIndex = 0; mecIndex < mecDecomposition.size(); ++mecIndex) {
+        auto const& mec = mecDecomposition[mecIndex];
+        auto flatMec = flatDecomposition[mecIndex];
+        ASSERT_EQ(mec.size(), flatMec.size());
+        for (auto const& stateChoicesPair : flatMec) {
+            ASSERT_TRUE(mec.containsState(stateChoicesPair.first));
+            auto const& choices = mec.getChoicesForState(stateChoicesPair.first);
+            EXPECT_TRUE(std::equal(choices.begin(), choices.end(), stateChoicesPair.second.begin(), stateChoicesPair.second.end()));
+            for (uint_fast64_t choice = 0; choice < mdp->getNumberOfChoices(); ++choice) {
+                EXPECT_EQ(mec.containsChoice(stateChoicesPair.first, choice), stateChoicesPair.second.find(choice) != stateChoicesPair.second.end());
+            }
+            ++numberOfStates;
+            numberOfChoices += choices.size();
+        }
+        EXPECT_EQ(mec.getStateSet().size(), flatMec.getStateSet(mdp->getNumberOfStates()).getNumberOfSetBits());
+    }
+    EXPECT_EQ(numberOfStates, flatDecomposition.getNumberOfStates());
+    EXPECT_EQ(numberOfChoices, flatDecomposition.getNumberOfChoices());
+
+    EXPECT_FALSE(flatDecomposition[0].containsState(0));
+    EXPECT_TRUE(flatDecomposition[0].getChoicesForState(2).contains(4));
+    EXPECT_TRUE(flatDecomposition[1].containsChoice(0, 1));
+    EXPECT_FALSE(flatDecomposition[1].containsChoice(0, 2));
+
+    // Copying a decomposition yields the same flat representation.
+    storm::storage::FlatMaximalEndComponentDecomposition copiedDecomposition(mecDecomposition);
+    ASSERT_EQ(flatDecomposition.size(), copiedDecomposition.size());
+    EXPECT_EQ(flatDecomposition.getNumberOfStates(), copiedDecomposition.getNumberOfStates());
+    EXPECT_EQ(flatDecomposition.getNumberOfChoices(), copiedDecomposition.getNumberOfChoices());
+    for (uint_fast64_t mecIndex = 0; mecIndex < flatDecomposition.size(); ++mecIndex) {
+        auto flatStates = flatDecomposition[mecIndex].getStates();
+        auto copiedStates = copiedDecomposition[mecIndex].getStates();
+        EXPECT_TRUE(std::equal(flatStates.begin(), flatStates.end(), copiedStates.begin(), copiedStates.end()));
+    }
+}
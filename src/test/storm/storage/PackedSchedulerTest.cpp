@@ -0,0 +1,96 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/storage/PackedScheduler.h"
+#include "storm/storage/Scheduler.h"
+
+TEST(PackedSchedulerTest, ChoicesAndConversion) {
+    // Row groups of sizes 3, 1, 5 and 2.
+    storm::storage::PackedScheduler scheduler(std::vector<uint64_t>({0, 3, 4, 9, 11}));
+    EXPECT_EQ(4ull, scheduler.getNumberOfStates());
+    EXPECT_EQ(3ull, scheduler.getNumberOfBitsPerChoice());
+    EXPECT_TRUE(scheduler.isPartialScheduler());
+
+    scheduler.setChoice(2, 0);
+    scheduler.setChoice(0, 1);
+    scheduler.setChoice(4, 2);
+    scheduler.setDontCare(3);
+    EXPECT_FALSE(scheduler.isPartialScheduler());
+    EXPECT_EQ(2ull, scheduler.getChoice(0));
+    EXPECT_EQ(0ull, scheduler.getChoice(1));
+    EXPECT_EQ(4ull, scheduler.getChoice(2));
+    EXPECT_TRUE(scheduler.isDontCare(3));
+    EXPECT_EQ(0ull, scheduler.getChoice(3));
+    STORM_SILENT_EXPECT_THROW(scheduler.setChoice(8, 0), storm::exceptions::InvalidArgumentException);
+
+    storm::storage::Scheduler<double> fullScheduler = scheduler.toScheduler<double>();
+    EXPECT_FALSE(fullScheduler.isPartialScheduler());
+    EXPECT_TRUE(fullScheduler.isDeterministicScheduler());
+    EXPECT_EQ(4ull, fullScheduler.getChoice(2).getDeterministicChoice());
+    EXPECT_TRUE(fullScheduler.isDontCare(3));
+    EXPECT_FALSE(fullScheduler.isDontCare(2));
+
+    storm::storage::PackedScheduler packedAgain(fullScheduler);
+    EXPECT_EQ(scheduler, packedAgain);
+
+    scheduler.clearChoice(1);
+    EXPECT_TRUE(scheduler.isPartialScheduler());
+    EXPECT_FALSE(scheduler.isChoiceDefined(1));
+    EXPECT_FALSE(scheduler == packedAgain);
+}
+
+TEST(PackedSchedulerTest, RejectsRandomizedSchedulers) {
+    storm::storage::Scheduler<double> scheduler(2);
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.5);
+    distribution.addProbability(1, 0.5);
+    scheduler.setChoice(distribution, 0);
+    scheduler.setChoice(1, 1);
+    STORM_SILENT_EXPECT_THROW(storm::storage::PackedScheduler packed(scheduler), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(PackedSchedulerTest, BinaryRoundTrip) {
+    uint64_t const numberOfStates = 1000;
+    storm::storage::PackedScheduler scheduler(numberOfStates, 100);
+    EXPECT_EQ(7ull, scheduler.getNumberOfBitsPerChoice());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (state % 7 != 0) {
+            scheduler.setChoice((state * 13) % 100, state);
+        }
+        if (state % 11 == 0) {
+            scheduler.setDontCare(state, false);
+        }
+    }
+
+    std::stringstream stream;
+    scheduler.writeBinaryToStream(stream);
+    storm::storage::PackedScheduler readScheduler = storm::storage::PackedScheduler::readBinaryFromStream(stream);
+    EXPECT_EQ(scheduler, readScheduler);
+    EXPECT_EQ(7ull, readScheduler.getNumberOfBitsPerChoice());
+    EXPECT_FALSE(readScheduler.isChoiceDefined(7));
+    EXPECT_EQ(13ull * 8 % 100, readScheduler.getChoice(8));
+    EXPECT_TRUE(readScheduler.isDontCare(11));
+
+    std::stringstream invalidStream("not a scheduler at all");
+    STORM_SILENT_EXPECT_THROW(storm::storage::PackedScheduler::readBinaryFromStream(invalidStream), storm::exceptions::WrongFormatException);
+}
+
+TEST(PackedSchedulerTest, StreamingJson) {
+    storm::storage::PackedScheduler scheduler(3, 2);
+    scheduler.setChoice(1, 0);
+    scheduler.setDontCare(2, false);
+    std::stringstream stream;
+    scheduler.printJsonToStream<double>(stream, nullptr, false, true);
+    auto json = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(2ull, json.size());
+    EXPECT_EQ(0, json[0]["s"]);
+    EXPECT_EQ(1, json[0]["c"][0]["index"]);
+    EXPECT_EQ(1.0, json[0]["c"][0]["prob"]);
+    EXPECT_EQ(1, json[1]["s"]);
+    EXPECT_EQ("undefined", json[1]["c"]);
+}
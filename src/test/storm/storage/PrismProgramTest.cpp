@@ -140,6 +140,25 @@ TEST(PrismProgramTest, FlattenModules_Dice_Z3) {
     EXPECT_EQ(1ull, program.getNumberOfModules());
     EXPECT_EQ(16ull, program.getModule(0).getNumberOfCommands());
 }
+
+TEST(PrismProgramTest, FlattenModules_Parallel_Z3) {
+    storm::prism::Program program;
+    ASSERT_NO_THROW(program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/firewire.nm"));
+    program = program.substituteFormulas();
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+
+    storm::prism::Program sequentialProgram, parallelProgram;
+    ASSERT_NO_THROW(sequentialProgram = program.flattenModules(smtSolverFactory));
+    ASSERT_NO_THROW(parallelProgram = program.flattenModules(smtSolverFactory, 4));
+    ASSERT_EQ(5024ull, parallelProgram.getModule(0).getNumberOfCommands());
+    ASSERT_EQ(sequentialProgram.getModule(0).getNumberOfCommands(), parallelProgram.getModule(0).getNumberOfCommands());
+    // The result does not depend on the number of threads.
+    for (uint64_t commandIndex = 0; commandIndex < parallelProgram.getModule(0).getNumberOfCommands(); ++commandIndex) {
+        EXPECT_EQ(sequentialProgram.getModule(0).getCommand(commandIndex).getGuardExpression().toString(),
+                  parallelProgram.getModule(0).getCommand(commandIndex).getGuardExpression().toString());
+    }
+}
 #endif
 
 TEST(PrismProgramTest, ConvertToJani) {
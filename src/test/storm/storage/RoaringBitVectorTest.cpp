@@ -0,0 +1,132 @@
+#include "test/storm_gtest.h"
+
+#include <random>
+
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/RoaringBitVector.h"
+
+namespace {
+// Creates a bit vector with a dense region (which is stored as a bitmap container) and a few scattered bits.
+storm::storage::BitVector createTestVector(uint64_t size, uint64_t seed) {
+    storm::storage::BitVector result(size);
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<uint64_t> distribution(0, size - 1);
+    for (uint64_t i = 0; i < 100; ++i) {
+        result.set(distribution(generator), true);
+    }
+    uint64_t denseBegin = (seed % 4) * 65536;
+    for (uint64_t index = denseBegin; index < denseBegin + 65536 && index < size; index += 3) {
+        result.set(index, true);
+    }
+    return result;
+}
+}  // namespace
+
+TEST(RoaringBitVectorTest, GetSet) {
+    storm::storage::RoaringBitVector vector(1000000);
+    EXPECT_TRUE(vector.empty());
+    EXPECT_FALSE(vector.full());
+
+    vector.set(5);
+    vector.set(999999);
+    vector.set(70000);
+    EXPECT_TRUE(vector.get(5));
+    EXPECT_TRUE(vector.get(70000));
+    EXPECT_TRUE(vector.get(999999));
+    EXPECT_FALSE(vector.get(6));
+    EXPECT_EQ(3ul, vector.getNumberOfSetBits());
+    EXPECT_EQ(std::vector<uint64_t>({5, 70000, 999999}), vector.getSetIndices());
+
+    vector.set(70000, false);
+    EXPECT_FALSE(vector.get(70000));
+    EXPECT_EQ(2ul, vector.getNumberOfSetBits());
+
+    // Fill an entire chunk, which turns it into a bitmap, and remove the bits again.
+    for (uint64_t index = 0; index < 65536; ++index) {
+        vector.set(index);
+    }
+    EXPECT_EQ(65537ul, vector.getNumberOfSetBits());
+    for (uint64_t index = 0; index < 65536; ++index) {
+        vector.set(index, false);
+    }
+    EXPECT_EQ(std::vector<uint64_t>({999999}), vector.getSetIndices());
+}
+
+TEST(RoaringBitVectorTest, ConversionAndIteration) {
+    storm::storage::BitVector bitVector = createTestVector(300000, 1);
+    storm::storage::RoaringBitVector roaring(bitVector);
+
+    EXPECT_EQ(bitVector.size(), roaring.size());
+    EXPECT_EQ(bitVector.getNumberOfSetBits(), roaring.getNumberOfSetBits());
+    EXPECT_TRUE(roaring == bitVector);
+    EXPECT_EQ(bitVector, roaring.toBitVector());
+    EXPECT_EQ(bitVector.getSetIndices(), std::vector<uint64_t>(roaring.begin(), roaring.end()));
+
+    std::vector<uint64_t> indices = {3, 17, 200000};
+    storm::storage::RoaringBitVector fromIndices(300000, indices.begin(), indices.end());
+    EXPECT_EQ(indices, fromIndices.getSetIndices());
+}
+
+TEST(RoaringBitVectorTest, SetOperationsMatchBitVector) {
+    storm::storage::BitVector first = createTestVector(300000, 1);
+    storm::storage::BitVector second = createTestVector(300000, 2) | createTestVector(300000, 5);
+    storm::storage::RoaringBitVector roaringFirst(first);
+    storm::storage::RoaringBitVector roaringSecond(second);
+
+    EXPECT_EQ(first & second, (roaringFirst & roaringSecond).toBitVector());
+    EXPECT_EQ(first | second, (roaringFirst | roaringSecond).toBitVector());
+    EXPECT_EQ(first & ~second, roaringFirst.difference(roaringSecond).toBitVector());
+    EXPECT_EQ(first & second, (roaringFirst & second).toBitVector());
+    EXPECT_EQ(first | second, first | roaringSecond);
+
+    EXPECT_EQ(first.isSubsetOf(second), roaringFirst.isSubsetOf(roaringSecond));
+    EXPECT_TRUE((roaringFirst & roaringSecond).isSubsetOf(roaringSecond));
+    EXPECT_TRUE((roaringFirst & roaringSecond).isSubsetOf(second));
+    EXPECT_FALSE(roaringFirst.isDisjointFrom(roaringSecond));
+    EXPECT_TRUE(roaringFirst.difference(roaringSecond).isDisjointFrom(roaringSecond));
+    EXPECT_TRUE(roaringFirst.difference(roaringSecond).isDisjointFrom(second));
+
+    std::vector<uint64_t> inversePermutation(300000);
+    for (uint64_t index = 0; index < inversePermutation.size(); ++index) {
+        inversePermutation[index] = inversePermutation.size() - 1 - index;
+    }
+    EXPECT_EQ(first.permute(inversePermutation), roaringFirst.permute(inversePermutation).toBitVector());
+}
+
+TEST(RoaringBitVectorTest, Sparsity) {
+    EXPECT_TRUE(storm::storage::RoaringBitVector::isSparse(10, 1000000000));
+    EXPECT_FALSE(storm::storage::RoaringBitVector::isSparse(10, 100));
+    EXPECT_FALSE(storm::storage::RoaringBitVector::isSparse(500000, 1000000));
+
+    storm::storage::BitVector bitVector(10000000);
+    bitVector.set(42);
+    storm::storage::RoaringBitVector roaring(bitVector);
+    EXPECT_LT(roaring.getSizeInBytes() * 100, bitVector.getSizeInBytes());
+}
+
+TEST(RoaringBitVectorTest, SparseStateLabels) {
+    uint64_t const numberOfStates = 10000000;
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    storm::storage::BitVector init(numberOfStates);
+    init.set(0);
+    labeling.addLabel("init", init);
+    labeling.addLabel("dense", ~init);
+    labeling.addLabelToState("init", 7);
+
+    EXPECT_TRUE(labeling.getStateHasLabel("init", 7));
+    EXPECT_FALSE(labeling.getStateHasLabel("dense", 0));
+    storm::storage::BitVector expected(numberOfStates);
+    expected.set(0);
+    expected.set(7);
+    EXPECT_EQ(expected, labeling.getStates("init"));
+
+    // Changes after the compressed label has been requested are visible in the returned bit vector.
+    labeling.removeLabelFromState("init", 0);
+    EXPECT_FALSE(labeling.getStates("init").get(0));
+
+    storm::models::sparse::StateLabeling copy(labeling);
+    EXPECT_EQ(labeling, copy);
+    copy.addLabelToState("init", 8);
+    EXPECT_FALSE(labeling == copy);
+}
@@ -1,8 +1,11 @@
+#include <map>
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseMatrixMaskedView.h"
 #include "test/storm_gtest.h"
 
 TEST(SparseMatrixBuilder, CreationWithDimensions) {
@@ -95,6 +98,40 @@ TEST(SparseMatrixBuilder, AddNextValue) {
     ASSERT_NO_THROW(matrixBuilder4.addNextValue(3, 1, 0.2));
 }
 
+TEST(SparseMatrixBuilder, ManyEntriesWithoutDimensions) {
+    // Enough entries such that the builder stores them in several blocks.
+    uint64_t const numberOfRows = 1000000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        if (row % 2 == 0) {
+            matrixBuilder.newRowGroup(row);
+        }
+        // Insert the entries out of order, which requires the current row to be fixed.
+        matrixBuilder.addNextValue(row, (row + 2) % numberOfRows, 0.25);
+        matrixBuilder.addNextValue(row, (row + 1) % numberOfRows, 0.5);
+        matrixBuilder.addDiagonalEntry(row, 0.25);
+    }
+    auto matrix = matrixBuilder.build();
+
+    ASSERT_EQ(numberOfRows, matrix.getRowCount());
+    ASSERT_EQ(numberOfRows / 2, matrix.getRowGroupCount());
+    ASSERT_EQ(3 * numberOfRows, matrix.getEntryCount());
+    for (uint64_t row : {0ul, 1ul, 349525ul, 349526ul, 699050ul, numberOfRows - 2, numberOfRows - 1}) {
+        std::map<uint64_t, double> expectedEntries{{(row + 1) % numberOfRows, 0.5}, {(row + 2) % numberOfRows, 0.25}};
+        expectedEntries[row / 2] += 0.25;
+        std::map<uint64_t, double> entries;
+        uint64_t previousColumn = 0;
+        bool first = true;
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_TRUE(first || previousColumn < entry.getColumn());
+            previousColumn = entry.getColumn();
+            first = false;
+            entries[entry.getColumn()] += entry.getValue();
+        }
+        EXPECT_EQ(expectedEntries, entries) << "in row " << row;
+    }
+}
+
 TEST(SparseMatrix, Build) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder1.addNextValue(0, 1, 1.0));
@@ -487,6 +524,112 @@ TEST(SparseMatrix, Submatrix) {
     ASSERT_TRUE(matrix4 == matrix5);
 }
 
+TEST(SparseMatrix, ParallelSubmatrix) {
+    // Build a matrix with irregular row groups that spans several chunks.
+    uint64_t const numberOfRowGroups = 5000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfRowGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= rowGroup % 3; ++choice, ++row) {
+            uint64_t firstColumn = (rowGroup * 7 + choice) % numberOfRowGroups;
+            uint64_t secondColumn = (rowGroup * 13 + 1) % numberOfRowGroups;
+            if (firstColumn == secondColumn) {
+                matrixBuilder.addNextValue(row, firstColumn, 1.0);
+            } else {
+                matrixBuilder.addNextValue(row, std::min(firstColumn, secondColumn), 0.5);
+                matrixBuilder.addNextValue(row, std::max(firstColumn, secondColumn), 0.5);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::BitVector rowGroupConstraint(numberOfRowGroups);
+    storm::storage::BitVector rowConstraint(matrix.getRowCount());
+    for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; rowGroup += 2) {
+        rowGroupConstraint.set(rowGroup);
+        rowConstraint.set(matrix.getRowGroupIndices()[rowGroup]);
+    }
+    storm::storage::BitVector columnConstraint = rowGroupConstraint;
+
+    for (bool insertDiagonalEntries : {false, true}) {
+        auto sequential = matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint, insertDiagonalEntries);
+        auto parallel = matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint, insertDiagonalEntries, storm::storage::BitVector(), 4);
+        EXPECT_EQ(sequential.getEntryCount(), parallel.getEntryCount());
+        EXPECT_TRUE(sequential == parallel);
+
+        auto sequentialRows = matrix.getSubmatrix(false, rowConstraint, columnConstraint, insertDiagonalEntries);
+        auto parallelRows = matrix.getSubmatrix(false, rowConstraint, columnConstraint, insertDiagonalEntries, storm::storage::BitVector(), 4);
+        EXPECT_EQ(rowGroupConstraint.getNumberOfSetBits(), parallelRows.getRowCount());
+        EXPECT_TRUE(sequentialRows == parallelRows);
+    }
+
+    // Extracting the submatrix together with the constrained row sums yields the same as the separate computations.
+    storm::storage::BitVector sumColumnConstraint = ~rowGroupConstraint;
+    std::vector<double> expectedRowSums = matrix.getConstrainedRowGroupSumVector(rowGroupConstraint, sumColumnConstraint);
+    for (uint64_t numberOfThreads : {1, 4}) {
+        auto submatrixAndRowSums =
+            matrix.getSubmatrixAndConstrainedRowGroupSumVector(rowGroupConstraint, columnConstraint, sumColumnConstraint, true, numberOfThreads);
+        EXPECT_TRUE(matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint, true) == submatrixAndRowSums.first);
+        EXPECT_EQ(expectedRowSums, submatrixAndRowSums.second);
+    }
+
+    std::vector<uint_fast64_t> rowGroupToIndexMapping(numberOfRowGroups);
+    for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+        rowGroupToIndexMapping[rowGroup] = rowGroup % (matrix.getRowGroupSize(rowGroup));
+    }
+    EXPECT_TRUE(matrix.selectRowsFromRowGroups(rowGroupToIndexMapping) == matrix.selectRowsFromRowGroups(rowGroupToIndexMapping, true, 4));
+    EXPECT_TRUE(matrix.selectRowsFromRowGroups(rowGroupToIndexMapping, false) == matrix.selectRowsFromRowGroups(rowGroupToIndexMapping, false, 4));
+}
+
+TEST(SparseMatrix, MaskedView) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::BitVector rowGroupConstraint(4);
+    rowGroupConstraint.set(0);
+    rowGroupConstraint.set(2);
+    rowGroupConstraint.set(3);
+    storm::storage::BitVector columnConstraint = rowGroupConstraint;
+
+    storm::storage::SparseMatrixMaskedView<double> view(matrix, rowGroupConstraint, columnConstraint);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint);
+    EXPECT_EQ(submatrix.getRowCount(), view.getNumberOfRows());
+    EXPECT_EQ(submatrix.getRowGroupCount(), view.getNumberOfRowGroups());
+    EXPECT_EQ(submatrix.getColumnCount(), view.getNumberOfColumns());
+
+    std::vector<double> x = {1.0, 2.0, 3.0};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4};
+    std::vector<double> expected(submatrix.getRowCount());
+    std::vector<double> result;
+    submatrix.multiplyWithVector(x, expected, &b);
+    view.multiply(x, &b, result);
+    EXPECT_EQ(expected, result);
+
+    std::vector<uint64_t> choices;
+    view.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, x, &b, result, &choices);
+    ASSERT_EQ(3ull, result.size());
+    EXPECT_EQ(expected[0], result[0]);
+    EXPECT_EQ(std::max(expected[1], expected[2]), result[1]);
+    EXPECT_EQ(expected[1] >= expected[2] ? 0ull : 1ull, choices[1]);
+    EXPECT_EQ(expected[3], result[2]);
+}
+
 TEST(SparseMatrix, RestrictRows) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(7, 4, 9, true, true, 3);
     ASSERT_NO_THROW(matrixBuilder1.newRowGroup(0));
@@ -597,6 +740,47 @@ TEST(SparseMatrix, Transpose) {
     ASSERT_TRUE(transposeResult == matrix2);
 }
 
+TEST(SparseMatrix, ParallelTranspose) {
+    uint64_t const numberOfRowGroups = 5000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfRowGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= rowGroup % 3; ++choice, ++row) {
+            for (uint64_t column = (rowGroup * 7 + choice) % 11; column < numberOfRowGroups; column += 997) {
+                // Some entries are zero.
+                matrixBuilder.addNextValue(row, column, column % 5 == 0 ? 0.0 : 0.1);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    for (bool joinGroups : {false, true}) {
+        for (bool keepZeros : {false, true}) {
+            storm::storage::SparseMatrix<double> sequential = matrix.transpose(joinGroups, keepZeros);
+            storm::storage::SparseMatrix<double> parallel = matrix.transpose(joinGroups, keepZeros, 4);
+            EXPECT_EQ(sequential.getEntryCount(), parallel.getEntryCount());
+            EXPECT_TRUE(sequential == parallel);
+
+            storm::storage::SparseMatrixStructure structure = matrix.transposeStructure(joinGroups, keepZeros, 4);
+            EXPECT_TRUE(matrix.transposeStructure(joinGroups, keepZeros) == structure);
+            ASSERT_EQ(sequential.getRowCount(), structure.getRowCount());
+            EXPECT_EQ(sequential.getColumnCount(), structure.getColumnCount());
+            EXPECT_EQ(sequential.getEntryCount(), structure.getEntryCount());
+            for (uint64_t transposedRow = 0; transposedRow < sequential.getRowCount(); ++transposedRow) {
+                auto columnIt = structure.begin(transposedRow);
+                for (auto const& entry : sequential.getRow(transposedRow)) {
+                    ASSERT_TRUE(columnIt != structure.end(transposedRow));
+                    EXPECT_EQ(entry.getColumn(), *columnIt);
+                    ++columnIt;
+                }
+                EXPECT_TRUE(columnIt == structure.end(transposedRow));
+            }
+        }
+    }
+}
+
 TEST(SparseMatrix, EquationSystem) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4, 7);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 1.1));
@@ -0,0 +1,101 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+namespace {
+class StateValuationsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        manager = std::make_shared<storm::expressions::ExpressionManager>();
+        b = manager->declareBooleanVariable("b");
+        x = manager->declareIntegerVariable("x");
+        y = manager->declareIntegerVariable("y");
+        r = manager->declareRationalVariable("r");
+    }
+
+    std::shared_ptr<storm::expressions::ExpressionManager> manager;
+    storm::expressions::Variable b, x, y, r;
+};
+}  // namespace
+
+TEST_F(StateValuationsTest, PackedValues) {
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, 0, 7);
+    // No bounds are known for y, so its column is re-encoded whenever a value outside the current range is added.
+    builder.addVariable(y);
+    uint64_t const numberOfStates = 1000;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        int64_t yValue = state % 2 == 0 ? static_cast<int64_t>(state) : -static_cast<int64_t>(state);
+        builder.addState(state, {state % 3 == 0}, {static_cast<int64_t>(state % 8), yValue});
+    }
+    storm::storage::sparse::StateValuations valuations = builder.build(numberOfStates);
+    ASSERT_EQ(numberOfStates, valuations.getNumberOfStates());
+    // 1 bit for b, 3 bits for x and 11 bits for y, whose values range from -999 to 998.
+    EXPECT_EQ(15ull, valuations.getNumberOfBitsPerState());
+
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        int64_t yValue = state % 2 == 0 ? static_cast<int64_t>(state) : -static_cast<int64_t>(state);
+        EXPECT_EQ(state % 3 == 0, valuations.getBooleanValue(state, b));
+        EXPECT_EQ(static_cast<int64_t>(state % 8), valuations.getIntegerValue(state, x));
+        EXPECT_EQ(yValue, valuations.getIntegerValue(state, y));
+        EXPECT_FALSE(valuations.isEmpty(state));
+    }
+    EXPECT_EQ("[!b\t& x=5\t& y=-5]", valuations.toString(5));
+    EXPECT_EQ("[true\t6\t6]", valuations.toString(6, false));
+
+    uint64_t numberOfValues = 0;
+    auto range = valuations.at(9);
+    for (auto valIt = range.begin(); valIt != range.end(); ++valIt) {
+        ++numberOfValues;
+        if (valIt.isBoolean()) {
+            EXPECT_TRUE(valIt.getBooleanValue());
+        } else {
+            ASSERT_TRUE(valIt.isInteger());
+            EXPECT_EQ(valIt.getVariable() == x ? 1 : -9, valIt.getIntegerValue());
+        }
+    }
+    EXPECT_EQ(3ull, numberOfValues);
+}
+
+TEST_F(StateValuationsTest, SelectAndBlowup) {
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, -2, 2);
+    builder.addVariable(r);
+    builder.addState(0, {true}, {-2}, {storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3"))});
+    // State 1 does not get a valuation.
+    builder.addState(2, {false}, {2}, {storm::utility::convertNumber<storm::RationalNumber>(std::string("5"))});
+    storm::storage::sparse::StateValuations valuations = builder.build(4);
+    ASSERT_EQ(4ull, valuations.getNumberOfStates());
+    EXPECT_TRUE(valuations.isEmpty(1));
+    EXPECT_TRUE(valuations.isEmpty(3));
+    EXPECT_EQ("[]", valuations.toString(1));
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3")), valuations.getRationalValue(0, r));
+
+    storm::storage::BitVector selected(4);
+    selected.set(1);
+    selected.set(2);
+    auto selectedValuations = valuations.selectStates(selected);
+    ASSERT_EQ(2ull, selectedValuations.getNumberOfStates());
+    EXPECT_TRUE(selectedValuations.isEmpty(0));
+    EXPECT_FALSE(selectedValuations.getBooleanValue(1, b));
+    EXPECT_EQ(2, selectedValuations.getIntegerValue(1, x));
+
+    auto reorderedValuations = valuations.selectStates(std::vector<storm::storage::sparse::state_type>({2, 7, 0}));
+    ASSERT_EQ(3ull, reorderedValuations.getNumberOfStates());
+    EXPECT_EQ(2, reorderedValuations.getIntegerValue(0, x));
+    EXPECT_TRUE(reorderedValuations.isEmpty(1));
+    EXPECT_EQ(-2, reorderedValuations.getIntegerValue(2, x));
+
+    auto blownUpValuations = valuations.blowup({0, 0, 2, 2, 2});
+    ASSERT_EQ(5ull, blownUpValuations.getNumberOfStates());
+    for (uint64_t state = 0; state < 5; ++state) {
+        EXPECT_EQ(state < 2, blownUpValuations.getBooleanValue(state, b));
+        EXPECT_EQ(state < 2 ? -2 : 2, blownUpValuations.getIntegerValue(state, x));
+    }
+    EXPECT_EQ(valuations.toString(2), blownUpValuations.toString(4));
+}
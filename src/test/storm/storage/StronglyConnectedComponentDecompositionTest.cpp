@@ -1,4 +1,9 @@
 #include "storm-config.h"
+
+#include <limits>
+#include <random>
+#include <set>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -90,3 +95,85 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelMatchesSequential) {
+    // Build a nondeterministic system with long chains, many small and a few large SCCs.
+    uint64_t const numberOfStates = 2000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    std::mt19937 generator(17);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        uint64_t const numberOfChoices = 1 + generator() % 2;
+        for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+            std::set<uint64_t> successors;
+            successors.insert(std::min(numberOfStates - 1, state + 1 + generator() % 2));
+            if (generator() % 5 == 0) {
+                successors.insert(state - std::min<uint64_t>(state, generator() % 20));
+            }
+            if (generator() % 50 == 0) {
+                successors.insert(generator() % numberOfStates);
+            }
+            for (auto successor : successors) {
+                matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    storm::storage::BitVector choices(matrix.getRowCount(), true);
+    for (uint64_t index = 0; index < numberOfStates; index += 7) {
+        subsystem.set(index, false);
+    }
+    for (uint64_t index = 0; index < matrix.getRowCount(); index += 5) {
+        choices.set(index, false);
+    }
+
+    auto toSet = [](storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::set<std::pair<std::vector<uint64_t>, bool>> result;
+        for (auto const& scc : decomposition) {
+            result.emplace(std::vector<uint64_t>(scc.begin(), scc.end()), scc.isTrivial());
+        }
+        return result;
+    };
+
+    for (bool useSubsystem : {false, true}) {
+        for (int variant = 0; variant < 3; ++variant) {
+            storm::storage::StronglyConnectedComponentDecompositionOptions options;
+            if (useSubsystem) {
+                options.subsystem(&subsystem).choices(&choices);
+            }
+            options.dropNaiveSccs(variant == 1).onlyBottomSccs(variant == 2).computeSccDepths();
+            storm::storage::StronglyConnectedComponentDecomposition<double> sequential(matrix, options.threads(1));
+            storm::storage::StronglyConnectedComponentDecomposition<double> parallel(matrix, options.threads(4).parallelThreshold(0));
+            ASSERT_EQ(sequential.size(), parallel.size());
+            EXPECT_EQ(toSet(sequential), toSet(parallel));
+            EXPECT_EQ(sequential.getMaxSccDepth(), parallel.getMaxSccDepth());
+
+            // Check that the SCCs are sorted topologically and that the depths match.
+            std::vector<uint64_t> stateToScc(numberOfStates, std::numeric_limits<uint64_t>::max());
+            for (uint64_t sccIndex = 0; sccIndex < parallel.size(); ++sccIndex) {
+                for (auto state : parallel[sccIndex]) {
+                    stateToScc[state] = sccIndex;
+                }
+            }
+            for (uint64_t sccIndex = 0; sccIndex < parallel.size(); ++sccIndex) {
+                for (auto state : parallel[sccIndex]) {
+                    for (auto choice : matrix.getRowGroupIndices(state)) {
+                        if (useSubsystem && !choices.get(choice)) {
+                            continue;
+                        }
+                        for (auto const& entry : matrix.getRow(choice)) {
+                            uint64_t successorScc = stateToScc[entry.getColumn()];
+                            if (successorScc != std::numeric_limits<uint64_t>::max() && successorScc != sccIndex) {
+                                EXPECT_LT(successorScc, sccIndex);
+                                EXPECT_LT(parallel.getSccDepth(successorScc), parallel.getSccDepth(sccIndex));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/TreeCompressedBitVectorHashMap.h"
+
+namespace {
+// Creates a state of a product of four counters, which is the typical structure of the states of a model.
+storm::storage::BitVector createState(uint64_t first, uint64_t second, uint64_t third, uint64_t fourth) {
+    storm::storage::BitVector result(192);
+    result.setFromInt(0, 10, first);
+    result.setFromInt(40, 10, second);
+    result.setFromInt(100, 10, third);
+    result.setFromInt(180, 10, fourth);
+    return result;
+}
+}  // namespace
+
+TEST(TreeCompressedBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::TreeCompressedBitVectorHashMap<uint64_t> map(64);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(1ul, map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(63);
+    EXPECT_EQ(2ul, map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+    EXPECT_EQ(2ul, map.size());
+
+    EXPECT_TRUE(map.contains(first));
+    EXPECT_EQ(2ul, map.getValue(second));
+    storm::storage::BitVector third(64);
+    third.set(10);
+    EXPECT_FALSE(map.contains(third));
+    EXPECT_FALSE(map.find(third));
+
+    // The buckets are the indices of the keys in the order of their insertion.
+    EXPECT_EQ(second, map.getBucketAndValue(1).first);
+    EXPECT_EQ(std::make_pair(3ul, 2ul), map.findOrAddAndGetBucket(third, 3));
+}
+
+TEST(TreeCompressedBitVectorHashMapTest, MatchesBitVectorHashMap) {
+    storm::storage::TreeCompressedBitVectorHashMap<uint32_t> treeMap(192);
+    storm::storage::BitVectorHashMap<uint32_t> hashMap(192, 1000);
+    uint32_t index = 0;
+    for (uint64_t first = 0; first < 20; ++first) {
+        for (uint64_t second = 0; second < 20; ++second) {
+            for (uint64_t third = 0; third < 20; ++third) {
+                storm::storage::BitVector state = createState(first, second, third, (first + second) % 3);
+                ASSERT_EQ(hashMap.findOrAdd(state, index), treeMap.findOrAdd(state, index));
+                ++index;
+            }
+        }
+    }
+    EXPECT_EQ(hashMap.size(), treeMap.size());
+
+    treeMap.remap([](uint32_t const& value) { return value + 1; });
+    uint64_t numberOfStates = 0;
+    for (auto const& stateValuePair : treeMap) {
+        EXPECT_EQ(hashMap.getValue(stateValuePair.first) + 1, stateValuePair.second);
+        ++numberOfStates;
+    }
+    EXPECT_EQ(hashMap.size(), numberOfStates);
+
+    // The counters share their values among many states, so the tree needs much less memory than the 24 bytes per state of the keys.
+    EXPECT_LT(treeMap.getSizeInBytes(), 24 * treeMap.size());
+}
@@ -0,0 +1,79 @@
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/storage/jani/Property.h"
+#include "test/storm_gtest.h"
+
+TEST(StatePermuterTest, PermutedMdpHasSameResults) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [F \"two\"]; Pmax=? [F \"two\"]; Rmin=? [F \"done\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    storm::builder::BuilderOptions options(formulas);
+    options.setBuildStateValuations();
+    options.setBuildChoiceLabels();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+    ASSERT_TRUE(model->isOfType(storm::models::ModelType::Mdp));
+
+    std::vector<std::vector<double>> originalResults;
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, false));
+        originalResults.push_back(result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+    }
+
+    for (auto order : {storm::utility::permutation::OrderKind::Bfs, storm::utility::permutation::OrderKind::ReverseCuthillMcKee,
+                       storm::utility::permutation::OrderKind::TopologicalScc}) {
+        auto permuted = storm::api::permuteModelStates<double>(model, order);
+        auto const& permutedModel = permuted.first;
+        auto const& inversePermutation = permuted.second;
+        ASSERT_TRUE(storm::utility::permutation::isValidPermutation(inversePermutation));
+        ASSERT_TRUE(permutedModel->isOfType(storm::models::ModelType::Mdp));
+        EXPECT_EQ(model->getNumberOfStates(), permutedModel->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfChoices(), permutedModel->getNumberOfChoices());
+        EXPECT_EQ(model->getNumberOfTransitions(), permutedModel->getNumberOfTransitions());
+        ASSERT_TRUE(permutedModel->hasStateValuations());
+        ASSERT_TRUE(permutedModel->hasChoiceLabeling());
+
+        for (uint64_t state = 0; state < permutedModel->getNumberOfStates(); ++state) {
+            uint64_t const originalState = inversePermutation[state];
+            EXPECT_EQ(model->getStateLabeling().getLabelsOfState(originalState), permutedModel->getStateLabeling().getLabelsOfState(state));
+            EXPECT_EQ(model->getStateValuations().getStateInfo(originalState), permutedModel->getStateValuations().getStateInfo(state));
+            EXPECT_EQ(model->getTransitionMatrix().getRowGroupSize(originalState), permutedModel->getTransitionMatrix().getRowGroupSize(state));
+        }
+
+        for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+            auto result = storm::api::verifyWithSparseEngine(permutedModel, storm::api::createTask<double>(formulas[formulaIndex], false));
+            auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            // Translating the results back yields the results of the original model.
+            auto translatedValues =
+                storm::utility::vector::applyInversePermutation(storm::utility::permutation::invertPermutation(inversePermutation), values);
+            for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+                EXPECT_NEAR(originalResults[formulaIndex][state], translatedValues[state], 1e-6)
+                    << "Order " << storm::utility::permutation::toString(order) << ", formula " << formulaIndex << ", state " << state;
+            }
+        }
+    }
+}
+
+TEST(StatePermuterTest, TopologicalSccOrder) {
+    // A chain 0 -> 1 -> 2 with a selfloop at 2. Successors are placed before their predecessors.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 3);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 2, 1.0);
+    builder.addNextValue(2, 2, 1.0);
+    auto matrix = builder.build();
+    storm::storage::BitVector initialStates(3);
+    initialStates.set(0);
+    auto order = storm::utility::permutation::createPermutation(storm::utility::permutation::OrderKind::TopologicalScc, matrix, initialStates);
+    EXPECT_EQ(std::vector<uint64_t>({2, 1, 0}), order);
+    order = storm::utility::permutation::createPermutation(storm::utility::permutation::OrderKind::Bfs, matrix, initialStates);
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), order);
+
+    auto permutedMatrix = matrix.permuteRowGroupsAndColumns({2, 1, 0});
+    EXPECT_EQ(1.0, permutedMatrix.getRow(0).begin()->getValue());
+    EXPECT_EQ(0ull, permutedMatrix.getRow(0).begin()->getColumn());
+    EXPECT_EQ(0ull, permutedMatrix.getRow(1).begin()->getColumn());
+    EXPECT_EQ(1ull, permutedMatrix.getRow(2).begin()->getColumn());
+}
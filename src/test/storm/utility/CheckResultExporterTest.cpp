@@ -0,0 +1,106 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include "storm/io/CheckResultExporter.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StateLabeling.h"
+
+TEST(CheckResultExporterTest, FileExtension) {
+    using storm::exporter::CheckResultExportFormat;
+    EXPECT_EQ(CheckResultExportFormat::Json, storm::exporter::getCheckResultExportFormatFromFileExtension("result.json"));
+    EXPECT_EQ(CheckResultExportFormat::JsonLines, storm::exporter::getCheckResultExportFormatFromFileExtension("result.jsonl"));
+    EXPECT_EQ(CheckResultExportFormat::Csv, storm::exporter::getCheckResultExportFormatFromFileExtension("result.csv"));
+    EXPECT_EQ(CheckResultExportFormat::Binary, storm::exporter::getCheckResultExportFormatFromFileExtension("result.bin"));
+    EXPECT_EQ(CheckResultExportFormat::Json, storm::exporter::getCheckResultExportFormatFromFileExtension("result"));
+}
+
+TEST(CheckResultExporterTest, Quantitative) {
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> result(std::vector<double>{0.5, 1.0, std::numeric_limits<double>::infinity()});
+    storm::models::sparse::StateLabeling labeling(3);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("goal");
+    labeling.addLabelToState("goal", 1);
+    labeling.addLabelToState("init", 1);
+
+    std::stringstream json;
+    storm::exporter::exportCheckResult(json, result, storm::exporter::CheckResultExportFormat::Json, nullptr, &labeling);
+    EXPECT_EQ("[\n{\"s\":0,\"v\":0.5,\"l\":[\"init\"]},\n{\"s\":1,\"v\":1,\"l\":[\"goal\",\"init\"]},\n{\"s\":2,\"v\":\"inf\",\"l\":[]}\n]\n", json.str());
+
+    std::stringstream jsonLines;
+    storm::exporter::exportCheckResult(jsonLines, result, storm::exporter::CheckResultExportFormat::JsonLines);
+    EXPECT_EQ("{\"s\":0,\"v\":0.5}\n{\"s\":1,\"v\":1}\n{\"s\":2,\"v\":\"inf\"}\n", jsonLines.str());
+
+    std::stringstream csv;
+    storm::exporter::exportCheckResult(csv, result, storm::exporter::CheckResultExportFormat::Csv, nullptr, &labeling);
+    EXPECT_EQ("state,value,labels\n0,0.5,\"init\"\n1,1,\"goal init\"\n2,inf,\"\"\n", csv.str());
+}
+
+TEST(CheckResultExporterTest, Qualitative) {
+    storm::modelchecker::ExplicitQualitativeCheckResult::map_type map;
+    map[1] = true;
+    map[4] = false;
+    storm::modelchecker::ExplicitQualitativeCheckResult result(map);
+
+    std::stringstream jsonLines;
+    storm::exporter::exportCheckResult(jsonLines, result, storm::exporter::CheckResultExportFormat::JsonLines);
+    EXPECT_EQ("{\"s\":1,\"v\":true}\n{\"s\":4,\"v\":false}\n", jsonLines.str());
+
+    std::stringstream binary;
+    storm::exporter::exportCheckResult(binary, result, storm::exporter::CheckResultExportFormat::Binary);
+    std::string data = binary.str();
+    // Header (8 + 4 + 4 + 3 * 8 bytes), two state indices and the values padded to 8 bytes.
+    ASSERT_EQ(40ull + 16ull + 8ull, data.size());
+    EXPECT_EQ("STORMRES", data.substr(0, 8));
+    uint64_t header[3];
+    std::memcpy(header, data.data() + 16, sizeof(header));
+    EXPECT_EQ(1ull, header[0]);
+    EXPECT_EQ(0ull, header[1]);
+    EXPECT_EQ(2ull, header[2]);
+    uint64_t states[2];
+    std::memcpy(states, data.data() + 40, sizeof(states));
+    EXPECT_EQ(1ull, states[0]);
+    EXPECT_EQ(4ull, states[1]);
+    EXPECT_EQ(std::string("\1\0\0\0\0\0\0\0", 8), data.substr(56));
+}
+
+TEST(CheckResultExporterTest, ParallelChunks) {
+    // Enough entries for several batches of chunks.
+    uint64_t const numberOfStates = 1500000;
+    std::vector<double> values(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        values[state] = static_cast<double>(state) / 4;
+    }
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> result(values);
+
+    std::stringstream sequential;
+    storm::exporter::exportCheckResult(sequential, result, storm::exporter::CheckResultExportFormat::Csv, nullptr, nullptr, 1);
+    std::stringstream parallel;
+    storm::exporter::exportCheckResult(parallel, result, storm::exporter::CheckResultExportFormat::Csv, nullptr, nullptr, 4);
+    EXPECT_EQ(sequential.str(), parallel.str());
+
+    std::string line;
+    std::getline(parallel, line);
+    EXPECT_EQ("state,value", line);
+    uint64_t numberOfLines = 0;
+    while (std::getline(parallel, line)) {
+        if (numberOfLines == 123457) {
+            EXPECT_EQ("123457,30864.25", line);
+        }
+        ++numberOfLines;
+    }
+    EXPECT_EQ(numberOfStates, numberOfLines);
+
+    std::stringstream binary;
+    storm::exporter::exportCheckResult(binary, result, storm::exporter::CheckResultExportFormat::Binary, nullptr, nullptr, 4);
+    std::string data = binary.str();
+    ASSERT_EQ(40 + numberOfStates * sizeof(double), data.size());
+    std::vector<double> readValues(numberOfStates);
+    std::memcpy(readValues.data(), data.data() + 40, numberOfStates * sizeof(double));
+    EXPECT_EQ(values, readValues);
+}
@@ -772,3 +772,34 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitProb01MinMaxParallel) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true))
+            .build()
+            ->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> sequentialResults, parallelResults;
+    for (auto resultsPtr : {&sequentialResults, &parallelResults}) {
+        // Enforce the parallel search on this (small) model in the second run.
+        storm::utility::graph::setNumberOfSearchThreads(resultsPtr == &parallelResults ? 4 : 1, 0);
+        for (std::string const& label : {"all_coins_equal_0", "all_coins_equal_1"}) {
+            resultsPtr->push_back(storm::utility::graph::performProb01Min(*mdp, allStates, mdp->getStates(label)));
+            resultsPtr->push_back(storm::utility::graph::performProb01Max(*mdp, allStates, mdp->getStates(label)));
+        }
+    }
+    storm::utility::graph::setNumberOfSearchThreads(0);
+
+    ASSERT_EQ(sequentialResults.size(), parallelResults.size());
+    for (uint64_t i = 0; i < sequentialResults.size(); ++i) {
+        EXPECT_EQ(sequentialResults[i].first, parallelResults[i].first);
+        EXPECT_EQ(sequentialResults[i].second, parallelResults[i].second);
+    }
+    EXPECT_EQ(77ull, parallelResults[0].first.getNumberOfSetBits());
+    EXPECT_EQ(149ull, parallelResults[0].second.getNumberOfSetBits());
+    EXPECT_EQ(74ull, parallelResults[1].first.getNumberOfSetBits());
+    EXPECT_EQ(198ull, parallelResults[1].second.getNumberOfSetBits());
+}
@@ -105,3 +105,16 @@ TEST(KSPTest, kspPathAsList) {
     //    161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0}; EXPECT_EQ(reference,
     //    list);
 }
+
+TEST(KSPTest, nonIncreasingDistances) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+
+    double previousDist = spg.getDistance(1);
+    for (unsigned long k = 2; k <= 500; ++k) {
+        double dist = spg.getDistance(k);
+        EXPECT_LE(dist, previousDist);
+        previousDist = dist;
+    }
+    EXPECT_NEAR(3.0462610000679315e-08, previousDist, 1e-12);
+}
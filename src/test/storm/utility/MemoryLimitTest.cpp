@@ -0,0 +1,28 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/utility/MemoryLimit.h"
+
+TEST(MemoryLimitTest, Reclaimers) {
+    EXPECT_FALSE(storm::utility::resources::isMemoryLimitSet());
+    EXPECT_FALSE(storm::utility::resources::isMemoryLimitApproached());
+    EXPECT_GT(storm::utility::resources::getResidentMemory(), 0ul);
+
+    storm::utility::resources::setMemoryLimit(1);
+    EXPECT_TRUE(storm::utility::resources::isMemoryLimitSet());
+    EXPECT_TRUE(storm::utility::resources::isMemoryLimitApproached());
+    storm::utility::resources::setMemoryLimit(0);
+
+    uint64_t numberOfCalls = 0;
+    uint64_t identifier = storm::utility::resources::registerMemoryReclaimer([&numberOfCalls]() {
+        ++numberOfCalls;
+        return 42ul;
+    });
+    EXPECT_GE(storm::utility::resources::reclaimMemory(), 42ul);
+    EXPECT_EQ(1ul, numberOfCalls);
+
+    // Unregistered reclaimers are not called anymore.
+    storm::utility::resources::unregisterMemoryReclaimer(identifier);
+    storm::utility::resources::reclaimMemory();
+    EXPECT_EQ(1ul, numberOfCalls);
+}
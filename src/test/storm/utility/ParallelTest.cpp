@@ -0,0 +1,94 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "storm/utility/parallel.h"
+
+namespace {
+
+// Creates a layered graph in which every task of a layer is a successor of two tasks of the previous layer.
+void createLayeredGraph(uint64_t numberOfLayers, uint64_t width, std::vector<uint64_t>& successorStarts, std::vector<uint64_t>& successors) {
+    successorStarts.clear();
+    successors.clear();
+    for (uint64_t layer = 0; layer < numberOfLayers; ++layer) {
+        for (uint64_t index = 0; index < width; ++index) {
+            successorStarts.push_back(successors.size());
+            if (layer + 1 < numberOfLayers) {
+                successors.push_back((layer + 1) * width + index);
+                successors.push_back((layer + 1) * width + (index + 1) % width);
+            }
+        }
+    }
+    successorStarts.push_back(successors.size());
+}
+
+}  // namespace
+
+TEST(ParallelTest, ForEachInDagRespectsDependencies) {
+    std::vector<uint64_t> successorStarts, successors;
+    uint64_t const numberOfLayers = 50;
+    uint64_t const width = 40;
+    createLayeredGraph(numberOfLayers, width, successorStarts, successors);
+
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        std::vector<std::atomic<bool>> finished(numberOfLayers * width);
+        for (auto& flag : finished) {
+            flag = false;
+        }
+        std::atomic<uint64_t> violations(0);
+        std::atomic<uint64_t> executions(0);
+        storm::utility::parallel::forEachInDag(numberOfThreads, successorStarts, successors, [&](uint64_t, uint64_t task) {
+            uint64_t const layer = task / width;
+            uint64_t const index = task % width;
+            if (layer > 0 && (!finished[(layer - 1) * width + index] || !finished[(layer - 1) * width + (index + width - 1) % width])) {
+                ++violations;
+            }
+            finished[task] = true;
+            ++executions;
+        });
+        EXPECT_EQ(numberOfLayers * width, executions.load());
+        EXPECT_EQ(0ull, violations.load());
+    }
+}
+
+TEST(ParallelTest, ForEachInDagPropagatesExceptions) {
+    std::vector<uint64_t> successorStarts, successors;
+    createLayeredGraph(10, 10, successorStarts, successors);
+    EXPECT_THROW(storm::utility::parallel::forEachInDag(4, successorStarts, successors,
+                                                        [&](uint64_t, uint64_t task) {
+                                                            if (task == 42) {
+                                                                throw std::runtime_error("failure");
+                                                            }
+                                                        }),
+                 std::runtime_error);
+}
+
+TEST(ParallelTest, NestedForEachChunk) {
+    // Every outer chunk runs an inner parallel loop. As the threads of the pool are shared, this must neither deadlock nor lose work.
+    std::vector<std::atomic<uint64_t>> counts(64);
+    for (uint64_t repetition = 0; repetition < 10; ++repetition) {
+        storm::utility::parallel::forEachChunk(4, counts.size(), 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t outer = begin; outer < end; ++outer) {
+                storm::utility::parallel::forEachChunk(4, 100, 7, [&](uint64_t, uint64_t innerBegin, uint64_t innerEnd) {
+                    counts[outer] += innerEnd - innerBegin;
+                });
+            }
+        });
+    }
+    for (auto const& count : counts) {
+        EXPECT_EQ(1000ul, count.load());
+    }
+}
+
+TEST(ParallelTest, RunOnWorkersUsesDistinctThreadIndices) {
+    std::vector<std::atomic<uint64_t>> invocations(8);
+    storm::utility::parallel::runOnWorkers(invocations.size(), [&](uint64_t threadIndex) { ++invocations[threadIndex]; });
+    // The calling thread always participates whereas each other index is used at most once.
+    EXPECT_EQ(1ul, invocations[0].load());
+    for (auto const& count : invocations) {
+        EXPECT_GE(1ul, count.load());
+    }
+}
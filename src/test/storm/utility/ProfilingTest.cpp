@@ -0,0 +1,41 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/utility/profiling.h"
+
+TEST(ProfilingTest, NestedPhases) {
+    storm::utility::profiling::reset();
+    storm::utility::profiling::setEnabled(true);
+    for (uint64_t i = 0; i < 3; ++i) {
+        storm::utility::profiling::ScopedPhase outer("outer");
+        storm::utility::profiling::addToCounter("iterations", 2);
+        {
+            storm::utility::profiling::ScopedPhase inner("inner");
+            storm::utility::profiling::addToCounter("states");
+        }
+    }
+    storm::utility::profiling::setEnabled(false);
+    {
+        // Phases and counters are ignored if the collection is disabled.
+        storm::utility::profiling::ScopedPhase ignored("ignored");
+        storm::utility::profiling::addToCounter("iterations", 5);
+    }
+
+    auto json = storm::utility::profiling::toJson();
+    ASSERT_EQ(1ul, json["phases"].size());
+    auto const& outer = json["phases"][0];
+    EXPECT_EQ("outer", outer["name"].get<std::string>());
+    EXPECT_EQ(3ul, outer["count"].get<uint64_t>());
+    EXPECT_EQ(6ul, outer["counters"]["iterations"].get<uint64_t>());
+    EXPECT_GE(outer["time"].get<double>(), 0.0);
+    EXPECT_GT(outer["peak-rss-kb"].get<uint64_t>(), 0ul);
+    ASSERT_EQ(1ul, outer["phases"].size());
+    auto const& inner = outer["phases"][0];
+    EXPECT_EQ("inner", inner["name"].get<std::string>());
+    EXPECT_EQ(3ul, inner["count"].get<uint64_t>());
+    EXPECT_EQ(3ul, inner["counters"]["states"].get<uint64_t>());
+    EXPECT_LE(inner["time"].get<double>(), outer["time"].get<double>());
+
+    storm::utility::profiling::reset();
+    EXPECT_EQ(0ul, storm::utility::profiling::toJson()["phases"].size());
+}
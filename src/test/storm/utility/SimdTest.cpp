@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <vector>
+
+#include "storm/utility/simd.h"
+
+TEST(SimdTest, KernelsMatchScalarVersion) {
+    using storm::utility::simd::InstructionSet;
+    // Rows with 0 to 18 entries cover the vectorized loops as well as the remainders.
+    uint64_t const rowCount = 1000;
+    std::vector<uint64_t> rowIndications = {0};
+    std::vector<uint32_t> columns;
+    std::vector<double> values, vector(rowCount), summand(rowCount);
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        for (uint64_t entry = 0; entry < row % 19; ++entry) {
+            columns.push_back((row * 31 + entry * 17) % rowCount);
+            values.push_back(static_cast<double>((row + entry) % 7) / 7.0);
+        }
+        rowIndications.push_back(columns.size());
+        vector[row] = static_cast<double>(row % 11) / 11.0;
+        summand[row] = static_cast<double>(row % 3);
+    }
+    std::vector<uint64_t> rowGroupIndices = {0};
+    for (uint64_t groupSize = 0; rowGroupIndices.back() + groupSize <= rowCount; groupSize = (groupSize + 1) % 10) {
+        rowGroupIndices.push_back(rowGroupIndices.back() + groupSize);
+    }
+    uint64_t const groupCount = rowGroupIndices.size() - 1;
+
+    std::vector<double> expected(rowCount);
+    storm::utility::simd::multiplyRows(InstructionSet::Scalar, rowCount, rowIndications.data(), columns.data(), values.data(), vector.data(), summand.data(),
+                                       expected.data());
+    std::vector<double> expectedMin(groupCount, -1.0), expectedMax(groupCount, -1.0);
+    storm::utility::simd::reduceRowGroups(InstructionSet::Scalar, true, groupCount, rowGroupIndices.data(), expected.data(), expectedMin.data());
+    storm::utility::simd::reduceRowGroups(InstructionSet::Scalar, false, groupCount, rowGroupIndices.data(), expected.data(), expectedMax.data());
+
+    for (auto instructionSet : {InstructionSet::Avx2, InstructionSet::Avx512}) {
+        if (instructionSet > storm::utility::simd::getSupportedInstructionSet()) {
+            continue;
+        }
+        std::vector<double> result(rowCount);
+        storm::utility::simd::multiplyRows(instructionSet, rowCount, rowIndications.data(), columns.data(), values.data(), vector.data(), summand.data(),
+                                           result.data());
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            EXPECT_NEAR(expected[row], result[row], 1e-12) << " at row " << row << " with " << storm::utility::simd::toString(instructionSet);
+        }
+        std::vector<double> resultMin(groupCount, -1.0), resultMax(groupCount, -1.0);
+        storm::utility::simd::reduceRowGroups(instructionSet, true, groupCount, rowGroupIndices.data(), expected.data(), resultMin.data());
+        storm::utility::simd::reduceRowGroups(instructionSet, false, groupCount, rowGroupIndices.data(), expected.data(), resultMax.data());
+        EXPECT_EQ(expectedMin, resultMin);
+        EXPECT_EQ(expectedMax, resultMax);
+    }
+}
+
+TEST(SimdTest, BitwiseKernelsMatchScalarVersion) {
+    using storm::utility::simd::BitwiseOperation;
+    using storm::utility::simd::InstructionSet;
+    // An odd number of words covers the remainders of the vectorized loops.
+    uint64_t const count = 1003;
+    std::vector<uint64_t> first(count), second(count);
+    uint64_t state = 88172645463325252ull;
+    for (uint64_t i = 0; i < count; ++i) {
+        // A xorshift generator yields (pseudo) random words.
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        first[i] = state;
+        second[i] = state * 2654435761ull;
+    }
+    uint64_t const expectedCount = storm::utility::simd::countSetBits(InstructionSet::Scalar, count, first.data());
+
+    for (auto instructionSet : {InstructionSet::Avx2, InstructionSet::Avx512}) {
+        if (instructionSet > storm::utility::simd::getSupportedInstructionSet()) {
+            continue;
+        }
+        EXPECT_EQ(expectedCount, storm::utility::simd::countSetBits(instructionSet, count, first.data()));
+        for (auto operation : {BitwiseOperation::And, BitwiseOperation::Or, BitwiseOperation::Xor, BitwiseOperation::Complement}) {
+            std::vector<uint64_t> expected(count), result(count);
+            storm::utility::simd::applyBitwiseOperation(InstructionSet::Scalar, operation, count, first.data(), second.data(), expected.data());
+            storm::utility::simd::applyBitwiseOperation(instructionSet, operation, count, first.data(), second.data(), result.data());
+            EXPECT_EQ(expected, result) << " with " << storm::utility::simd::toString(instructionSet);
+        }
+    }
+}